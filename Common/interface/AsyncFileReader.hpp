@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::AsyncFileReader class
+
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <atomic>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ThreadPool.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Reads files asynchronously.
+
+/// Read requests are executed by the worker threads of a thread pool, so that
+/// file I/O of the calling thread can be overlapped with other work such as
+/// parsing or shader compilation. Every request is an IAsyncTask, so it can be
+/// waited for, or used as a prerequisite for other tasks enqueued into the same pool.
+///
+/// The contents of a file that is read successfully can be passed directly to
+/// IDearchiver::LoadArchive, IBytecodeCache::Load or any other method that
+/// takes a data blob.
+///
+/// \remarks    The class is thread-safe: requests can be enqueued from multiple threads.
+class AsyncFileReader
+{
+public:
+    /// Completion callback type.
+
+    /// The callback is executed by the worker thread that has read the file.
+    /// pData is null if the file could not be read.
+    using CompletionCallbackType = std::function<void(const Char* FilePath, IDataBlob* pData)>;
+
+    /// Asynchronous file read request
+    class ReadRequest final : public AsyncTaskBase
+    {
+    public:
+        ReadRequest(IReferenceCounters*    pRefCounters,
+                    AsyncFileReader&       Reader,
+                    const Char*            FilePath,
+                    Uint64                 Offset,
+                    Uint64                 Size,
+                    CompletionCallbackType Callback,
+                    float                  fPriority);
+
+        virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE Run(Uint32 ThreadId) override final;
+
+        /// Returns the path of the file.
+        const Char* GetFilePath() const { return m_FilePath.c_str(); }
+
+        /// Returns the offset of the requested region in the file.
+        Uint64 GetOffset() const { return m_Offset; }
+
+        /// Returns the file data, or null if the file has not been read yet or could not be read.
+        IDataBlob* GetData() const
+        {
+            return m_DataReady.load() ? m_pData.RawPtr() : nullptr;
+        }
+
+    private:
+        AsyncFileReader&             m_Reader;
+        const std::string            m_FilePath;
+        const Uint64                 m_Offset;
+        const Uint64                 m_Size; // WholeFile to read the entire file
+        const CompletionCallbackType m_Callback;
+        RefCntAutoPtr<IDataBlob>     m_pData;
+        std::atomic<bool>            m_DataReady{false};
+    };
+
+    struct CreateInfo
+    {
+        /// Thread pool to execute the requests in.
+
+        /// If null, the reader creates its own thread pool with NumThreads threads.
+        IThreadPool* pThreadPool = nullptr;
+
+        /// The number of threads in the reader's own thread pool.
+        /// This member is ignored if pThreadPool is not null.
+        Uint32 NumThreads = 2;
+    };
+
+    explicit AsyncFileReader(const CreateInfo& CI);
+
+    /// Waits for all pending requests to finish.
+    ~AsyncFileReader();
+
+    // clang-format off
+    AsyncFileReader           (const AsyncFileReader&)  = delete;
+    AsyncFileReader           (      AsyncFileReader&&) = delete;
+    AsyncFileReader& operator=(const AsyncFileReader&)  = delete;
+    AsyncFileReader& operator=(      AsyncFileReader&&) = delete;
+    // clang-format on
+
+    /// Enqueues a request to read the whole file.
+
+    /// \param [in] FilePath  - Path to the file to read.
+    /// \param [in] Callback  - Optional callback that is called when the request is complete.
+    /// \param [in] fPriority - Request priority.
+    ///
+    /// \return     The request object that can be used to wait for the
+    ///             completion and to get the file data.
+    ///
+    /// \remarks    If the file could not be read, the request status
+    ///             is set to ASYNC_TASK_STATUS_CANCELLED.
+    RefCntAutoPtr<ReadRequest> ReadFile(const Char*            FilePath,
+                                        CompletionCallbackType Callback  = nullptr,
+                                        float                  fPriority = 0);
+
+    /// Enqueues a request to read a region of the file.
+
+    /// \param [in] FilePath  - Path to the file to read.
+    /// \param [in] Offset    - Offset of the region in the file, in bytes.
+    /// \param [in] Size      - Region size, in bytes. Must not be zero.
+    /// \param [in] Callback  - Optional callback that is called when the request is complete.
+    /// \param [in] fPriority - Request priority.
+    ///
+    /// \return     The request object that can be used to wait for the
+    ///             completion and to get the region data.
+    ///
+    /// \remarks    If the file could not be read or the region exceeds the file size,
+    ///             the request status is set to ASYNC_TASK_STATUS_CANCELLED.
+    RefCntAutoPtr<ReadRequest> ReadFileRegion(const Char*            FilePath,
+                                              Uint64                 Offset,
+                                              Uint64                 Size,
+                                              CompletionCallbackType Callback  = nullptr,
+                                              float                  fPriority = 0);
+
+    /// Blocks until all pending requests are finished.
+
+    /// \remarks   When the method returns, all completion callbacks have been executed
+    ///             and the data of all successful requests is available through ReadRequest::GetData().
+    void WaitForIdle();
+
+    /// Returns the number of requests that are not finished yet.
+    Uint32 GetNumPendingRequests();
+
+    /// Returns the thread pool that executes the requests.
+    IThreadPool* GetThreadPool() const { return m_pThreadPool; }
+
+private:
+    static constexpr Uint64 WholeFile = ~Uint64{0};
+
+    RefCntAutoPtr<ReadRequest> EnqueueRequest(const Char*            FilePath,
+                                              Uint64                 Offset,
+                                              Uint64                 Size,
+                                              CompletionCallbackType Callback,
+                                              float                  fPriority);
+
+    void OnRequestFinished();
+
+private:
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+
+    std::mutex              m_PendingRequestsMtx;
+    std::condition_variable m_PendingRequestsCV;
+    Uint32                  m_NumPendingRequests = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,635 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// SIMD implementations of the frequently used float4 and float4x4 operations.
+///
+/// The functions in the Diligent::SIMD namespace mirror the corresponding BasicMath operations,
+/// but use SSE, NEON or WebAssembly SIMD128 intrinsics, selected at compile time by the target ISA.
+/// If none of the instruction sets is available or DILIGENT_SIMD_MATH_DISABLED is defined,
+/// the functions fall back to the scalar BasicMath implementation.
+///
+/// When DILIGENT_SIMD_MATH_STRICT is defined to 1 before including this header,
+/// all functions produce results that are bit-identical to the scalar BasicMath path:
+/// the operations are performed in the same order, FMA instructions are not used,
+/// and operations that can't be vectorized without changing the order (e.g. Inverse)
+/// use the scalar implementation. Note that this assumes that the scalar code is compiled
+/// without floating-point contraction (e.g. -ffp-contract=off).
+///
+/// Strict and fast implementations are defined in different inline namespaces,
+/// so different translation units may use different modes.
+
+#include "BasicMath.hpp"
+#include "../../Platforms/interface/Intrinsics.hpp"
+
+#ifndef DILIGENT_SIMD_MATH_STRICT
+#    define DILIGENT_SIMD_MATH_STRICT 0
+#endif
+
+#if !defined(DILIGENT_SIMD_MATH_DISABLED)
+#    if DILIGENT_SSE2_ENABLED
+#        define DILIGENT_SIMD_MATH_SSE 1
+#    elif DILIGENT_NEON_ENABLED
+#        define DILIGENT_SIMD_MATH_NEON 1
+#    elif DILIGENT_WASM_SIMD_ENABLED
+#        define DILIGENT_SIMD_MATH_WASM 1
+#    endif
+#endif
+
+#if DILIGENT_SIMD_MATH_SSE || DILIGENT_SIMD_MATH_NEON || DILIGENT_SIMD_MATH_WASM
+#    define DILIGENT_SIMD_MATH_VECTOR 1
+#endif
+
+namespace Diligent
+{
+
+namespace SIMD
+{
+
+#if DILIGENT_SIMD_MATH_SSE
+#    if DILIGENT_SIMD_MATH_STRICT
+inline namespace SSEStrict
+#    else
+inline namespace SSE
+#    endif
+#elif DILIGENT_SIMD_MATH_NEON
+#    if DILIGENT_SIMD_MATH_STRICT
+inline namespace NEONStrict
+#    else
+inline namespace NEON
+#    endif
+#elif DILIGENT_SIMD_MATH_WASM
+#    if DILIGENT_SIMD_MATH_STRICT
+inline namespace WASMStrict
+#    else
+inline namespace WASM
+#    endif
+#else
+inline namespace Scalar
+#endif
+{
+
+#if DILIGENT_SIMD_MATH_VECTOR
+
+namespace Detail
+{
+
+#    if DILIGENT_SIMD_MATH_SSE
+
+using Vec4f = __m128;
+
+inline Vec4f Load(const float* p) { return _mm_loadu_ps(p); }
+inline void  Store(float* p, Vec4f v) { _mm_storeu_ps(p, v); }
+inline Vec4f Splat(float s) { return _mm_set1_ps(s); }
+inline Vec4f Zero() { return _mm_setzero_ps(); }
+
+inline Vec4f Add(Vec4f a, Vec4f b) { return _mm_add_ps(a, b); }
+inline Vec4f Sub(Vec4f a, Vec4f b) { return _mm_sub_ps(a, b); }
+inline Vec4f Mul(Vec4f a, Vec4f b) { return _mm_mul_ps(a, b); }
+inline Vec4f Div(Vec4f a, Vec4f b) { return _mm_div_ps(a, b); }
+
+// std::min(a, b) returns (b < a) ? b : a, while _mm_min_ps(a, b) returns (a < b) ? a : b.
+// Swapping the arguments makes the results (including signed zeros and NaNs) identical to std::min/std::max.
+inline Vec4f Min(Vec4f a, Vec4f b) { return _mm_min_ps(b, a); }
+inline Vec4f Max(Vec4f a, Vec4f b) { return _mm_max_ps(b, a); }
+
+// Returns a * b + c
+inline Vec4f MulAdd(Vec4f a, Vec4f b, Vec4f c)
+{
+#        if DILIGENT_FMA_ENABLED && !DILIGENT_SIMD_MATH_STRICT
+    return _mm_fmadd_ps(a, b, c);
+#        else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#        endif
+}
+
+// Returns {a[X], a[Y], b[Z], b[W]}
+template <int X, int Y, int Z, int W>
+Vec4f Shuffle(Vec4f a, Vec4f b)
+{
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+template <int Lane>
+float GetLane(Vec4f v)
+{
+    return _mm_cvtss_f32(Shuffle<Lane, Lane, Lane, Lane>(v, v));
+}
+
+inline void Transpose(Vec4f& r0, Vec4f& r1, Vec4f& r2, Vec4f& r3)
+{
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+
+#    elif DILIGENT_SIMD_MATH_NEON
+
+using Vec4f = float32x4_t;
+
+inline Vec4f Load(const float* p) { return vld1q_f32(p); }
+inline void  Store(float* p, Vec4f v) { vst1q_f32(p, v); }
+inline Vec4f Splat(float s) { return vdupq_n_f32(s); }
+inline Vec4f Zero() { return vdupq_n_f32(0); }
+
+inline Vec4f Add(Vec4f a, Vec4f b) { return vaddq_f32(a, b); }
+inline Vec4f Sub(Vec4f a, Vec4f b) { return vsubq_f32(a, b); }
+inline Vec4f Mul(Vec4f a, Vec4f b) { return vmulq_f32(a, b); }
+
+inline Vec4f Div(Vec4f a, Vec4f b)
+{
+#        if defined(__aarch64__) || defined(_M_ARM64)
+    return vdivq_f32(a, b);
+#        else
+    // ARMv7 NEON has no division instruction
+    float fa[4], fb[4];
+    vst1q_f32(fa, a);
+    vst1q_f32(fb, b);
+    for (int i = 0; i < 4; ++i)
+        fa[i] /= fb[i];
+    return vld1q_f32(fa);
+#        endif
+}
+
+// vminq_f32/vmaxq_f32 propagate NaNs and order signed zeros differently from std::min/std::max,
+// so use compare and select in strict mode.
+inline Vec4f Min(Vec4f a, Vec4f b)
+{
+#        if DILIGENT_SIMD_MATH_STRICT
+    return vbslq_f32(vcltq_f32(b, a), b, a);
+#        else
+    return vminq_f32(a, b);
+#        endif
+}
+
+inline Vec4f Max(Vec4f a, Vec4f b)
+{
+#        if DILIGENT_SIMD_MATH_STRICT
+    return vbslq_f32(vcltq_f32(a, b), b, a);
+#        else
+    return vmaxq_f32(a, b);
+#        endif
+}
+
+// Returns a * b + c
+inline Vec4f MulAdd(Vec4f a, Vec4f b, Vec4f c)
+{
+#        if (defined(__aarch64__) || defined(_M_ARM64)) && !DILIGENT_SIMD_MATH_STRICT
+    return vfmaq_f32(c, a, b);
+#        else
+    return vaddq_f32(vmulq_f32(a, b), c);
+#        endif
+}
+
+// Returns {a[X], a[Y], b[Z], b[W]}
+template <int X, int Y, int Z, int W>
+Vec4f Shuffle(Vec4f a, Vec4f b)
+{
+    Vec4f r = vdupq_n_f32(vgetq_lane_f32(a, X));
+    r       = vsetq_lane_f32(vgetq_lane_f32(a, Y), r, 1);
+    r       = vsetq_lane_f32(vgetq_lane_f32(b, Z), r, 2);
+    r       = vsetq_lane_f32(vgetq_lane_f32(b, W), r, 3);
+    return r;
+}
+
+template <int Lane>
+float GetLane(Vec4f v)
+{
+    return vgetq_lane_f32(v, Lane);
+}
+
+inline void Transpose(Vec4f& r0, Vec4f& r1, Vec4f& r2, Vec4f& r3)
+{
+    // r01 = {{r0.x, r1.x, r0.z, r1.z}, {r0.y, r1.y, r0.w, r1.w}}
+    const float32x4x2_t r01 = vtrnq_f32(r0, r1);
+    const float32x4x2_t r23 = vtrnq_f32(r2, r3);
+
+    r0 = vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+}
+
+#    elif DILIGENT_SIMD_MATH_WASM
+
+using Vec4f = v128_t;
+
+inline Vec4f Load(const float* p) { return wasm_v128_load(p); }
+inline void  Store(float* p, Vec4f v) { wasm_v128_store(p, v); }
+inline Vec4f Splat(float s) { return wasm_f32x4_splat(s); }
+inline Vec4f Zero() { return wasm_f32x4_const_splat(0.f); }
+
+inline Vec4f Add(Vec4f a, Vec4f b) { return wasm_f32x4_add(a, b); }
+inline Vec4f Sub(Vec4f a, Vec4f b) { return wasm_f32x4_sub(a, b); }
+inline Vec4f Mul(Vec4f a, Vec4f b) { return wasm_f32x4_mul(a, b); }
+inline Vec4f Div(Vec4f a, Vec4f b) { return wasm_f32x4_div(a, b); }
+
+// Pseudo-minimum and pseudo-maximum are defined as (b < a) ? b : a and (a < b) ? b : a,
+// which is exactly std::min/std::max, while wasm_f32x4_min/max propagate NaNs.
+inline Vec4f Min(Vec4f a, Vec4f b) { return wasm_f32x4_pmin(a, b); }
+inline Vec4f Max(Vec4f a, Vec4f b) { return wasm_f32x4_pmax(a, b); }
+
+// Returns a * b + c. Fused multiply-add is only available in the relaxed SIMD extension.
+inline Vec4f MulAdd(Vec4f a, Vec4f b, Vec4f c)
+{
+    return wasm_f32x4_add(wasm_f32x4_mul(a, b), c);
+}
+
+// Returns {a[X], a[Y], b[Z], b[W]}
+template <int X, int Y, int Z, int W>
+Vec4f Shuffle(Vec4f a, Vec4f b)
+{
+    return wasm_i32x4_shuffle(a, b, X, Y, Z + 4, W + 4);
+}
+
+template <int Lane>
+float GetLane(Vec4f v)
+{
+    return wasm_f32x4_extract_lane(v, Lane);
+}
+
+inline void Transpose(Vec4f& r0, Vec4f& r1, Vec4f& r2, Vec4f& r3)
+{
+    // t0 = {r0.x, r1.x, r0.y, r1.y}, t2 = {r0.z, r1.z, r0.w, r1.w}
+    const Vec4f t0 = wasm_i32x4_shuffle(r0, r1, 0, 4, 1, 5);
+    const Vec4f t1 = wasm_i32x4_shuffle(r2, r3, 0, 4, 1, 5);
+    const Vec4f t2 = wasm_i32x4_shuffle(r0, r1, 2, 6, 3, 7);
+    const Vec4f t3 = wasm_i32x4_shuffle(r2, r3, 2, 6, 3, 7);
+
+    r0 = wasm_i32x4_shuffle(t0, t1, 0, 1, 4, 5);
+    r1 = wasm_i32x4_shuffle(t0, t1, 2, 3, 6, 7);
+    r2 = wasm_i32x4_shuffle(t2, t3, 0, 1, 4, 5);
+    r3 = wasm_i32x4_shuffle(t2, t3, 2, 3, 6, 7);
+}
+
+#    endif
+
+template <int Lane>
+Vec4f SplatLane(Vec4f v)
+{
+    return Shuffle<Lane, Lane, Lane, Lane>(v, v);
+}
+
+template <int X, int Y, int Z, int W>
+Vec4f Swizzle(Vec4f v)
+{
+    return Shuffle<X, Y, Z, W>(v, v);
+}
+
+inline Vec4f Load(const float4& v) { return Load(v.Data()); }
+inline Vec4f LoadRow(const float4x4& m, int Row) { return Load(m.m[Row]); }
+
+inline float4 StoreFloat4(Vec4f v)
+{
+    float4 Res;
+    Store(Res.Data(), v);
+    return Res;
+}
+
+// Returns the sum of the lanes in the same order as the scalar code: ((v.x + v.y) + v.z) + v.w
+inline float HorizontalSum(Vec4f v)
+{
+#    if DILIGENT_SIMD_MATH_STRICT
+    return ((GetLane<0>(v) + GetLane<1>(v)) + GetLane<2>(v)) + GetLane<3>(v);
+#    else
+    // (x + z, y + w, ...)
+    const Vec4f Sum2 = Add(v, Swizzle<2, 3, 0, 1>(v));
+    return GetLane<0>(Add(Sum2, SplatLane<1>(Sum2)));
+#    endif
+}
+
+// Computes v * m, where v is a row vector, and the rows of m are r0..r3
+inline Vec4f MulRowVector(Vec4f v, Vec4f r0, Vec4f r1, Vec4f r2, Vec4f r3)
+{
+    // out[j] = ((x * m[0][j] + y * m[1][j]) + z * m[2][j]) + w * m[3][j]
+    Vec4f Res = Mul(SplatLane<0>(v), r0);
+    Res       = MulAdd(SplatLane<1>(v), r1, Res);
+    Res       = MulAdd(SplatLane<2>(v), r2, Res);
+    Res       = MulAdd(SplatLane<3>(v), r3, Res);
+    return Res;
+}
+
+// 2x2 row-major matrix product a * b, where the matrices are packed as {_11, _12, _21, _22}
+inline Vec4f Mat2Mul(Vec4f a, Vec4f b)
+{
+    return Add(Mul(a, Swizzle<0, 3, 0, 3>(b)), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+// 2x2 row-major matrix product adj(a) * b
+inline Vec4f Mat2AdjMul(Vec4f a, Vec4f b)
+{
+    return Sub(Mul(Swizzle<3, 3, 0, 0>(a), b), Mul(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+// 2x2 row-major matrix product a * adj(b)
+inline Vec4f Mat2MulAdj(Vec4f a, Vec4f b)
+{
+    return Sub(Mul(a, Swizzle<3, 0, 3, 0>(b)), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+} // namespace Detail
+
+#endif // DILIGENT_SIMD_MATH_VECTOR
+
+
+/// Returns a + b
+inline float4 Add(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Add(Detail::Load(a), Detail::Load(b)));
+#else
+    return a + b;
+#endif
+}
+
+/// Returns a - b
+inline float4 Sub(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Sub(Detail::Load(a), Detail::Load(b)));
+#else
+    return a - b;
+#endif
+}
+
+/// Returns the component-wise product of a and b
+inline float4 Mul(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Mul(Detail::Load(a), Detail::Load(b)));
+#else
+    return a * b;
+#endif
+}
+
+/// Returns a * s
+inline float4 Mul(const float4& a, float s)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Mul(Detail::Load(a), Detail::Splat(s)));
+#else
+    return a * s;
+#endif
+}
+
+/// Returns the component-wise quotient of a and b
+inline float4 Div(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Div(Detail::Load(a), Detail::Load(b)));
+#else
+    return a / b;
+#endif
+}
+
+/// Returns the component-wise minimum of a and b, same as Diligent::min()
+inline float4 Min(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Min(Detail::Load(a), Detail::Load(b)));
+#else
+    return (min)(a, b);
+#endif
+}
+
+/// Returns the component-wise maximum of a and b, same as Diligent::max()
+inline float4 Max(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::StoreFloat4(Detail::Max(Detail::Load(a), Detail::Load(b)));
+#else
+    return (max)(a, b);
+#endif
+}
+
+/// Returns the dot product of a and b
+inline float Dot(const float4& a, const float4& b)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    return Detail::HorizontalSum(Detail::Mul(Detail::Load(a), Detail::Load(b)));
+#else
+    return dot(a, b);
+#endif
+}
+
+/// Returns the normalized vector, same as Diligent::normalize()
+inline float4 Normalize(const float4& a)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    const Detail::Vec4f va = Detail::Load(a);
+    const float         Len{std::sqrt(Detail::HorizontalSum(Detail::Mul(va, va)))};
+    return Detail::StoreFloat4(Detail::Div(va, Detail::Splat(Len)));
+#else
+    return normalize(a);
+#endif
+}
+
+/// Linearly interpolates between a and b, same as Diligent::lerp()
+inline float4 Lerp(const float4& a, const float4& b, float w)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    const Detail::Vec4f Res = Detail::MulAdd(Detail::Load(b), Detail::Splat(w), Detail::Mul(Detail::Load(a), Detail::Splat(1.f - w)));
+    return Detail::StoreFloat4(Res);
+#else
+    return lerp(a, b, w);
+#endif
+}
+
+
+/// Returns v * m, where v is a row vector
+inline float4 Mul(const float4& v, const float4x4& m)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    using namespace Detail;
+    return StoreFloat4(MulRowVector(Load(v), LoadRow(m, 0), LoadRow(m, 1), LoadRow(m, 2), LoadRow(m, 3)));
+#else
+    return v * m;
+#endif
+}
+
+/// Returns m * v, where v is a column vector
+inline float4 Mul(const float4x4& m, const float4& v)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    using namespace Detail;
+    // m * v == v * transpose(m)
+    Vec4f c0 = LoadRow(m, 0);
+    Vec4f c1 = LoadRow(m, 1);
+    Vec4f c2 = LoadRow(m, 2);
+    Vec4f c3 = LoadRow(m, 3);
+    Transpose(c0, c1, c2, c3);
+    return StoreFloat4(MulRowVector(Load(v), c0, c1, c2, c3));
+#else
+    return m * v;
+#endif
+}
+
+/// Returns m1 * m2
+inline float4x4 Mul(const float4x4& m1, const float4x4& m2)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    using namespace Detail;
+    const Vec4f r0 = LoadRow(m2, 0);
+    const Vec4f r1 = LoadRow(m2, 1);
+    const Vec4f r2 = LoadRow(m2, 2);
+    const Vec4f r3 = LoadRow(m2, 3);
+
+    float4x4 Res;
+    for (int i = 0; i < 4; ++i)
+    {
+        const Vec4f Row = LoadRow(m1, i);
+        // The scalar implementation accumulates the products starting from zero.
+        // This matters for the sign of zero results.
+        Vec4f ResRow = MulAdd(SplatLane<0>(Row), r0, Zero());
+        ResRow       = MulAdd(SplatLane<1>(Row), r1, ResRow);
+        ResRow       = MulAdd(SplatLane<2>(Row), r2, ResRow);
+        ResRow       = MulAdd(SplatLane<3>(Row), r3, ResRow);
+        Store(Res.m[i], ResRow);
+    }
+    return Res;
+#else
+    return m1 * m2;
+#endif
+}
+
+/// Returns the transposed matrix
+inline float4x4 Transpose(const float4x4& m)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    using namespace Detail;
+    Vec4f r0 = LoadRow(m, 0);
+    Vec4f r1 = LoadRow(m, 1);
+    Vec4f r2 = LoadRow(m, 2);
+    Vec4f r3 = LoadRow(m, 3);
+    Detail::Transpose(r0, r1, r2, r3);
+
+    float4x4 Res;
+    Store(Res.m[0], r0);
+    Store(Res.m[1], r1);
+    Store(Res.m[2], r2);
+    Store(Res.m[3], r3);
+    return Res;
+#else
+    return m.Transpose();
+#endif
+}
+
+/// Returns the inverse matrix
+
+/// \remarks    In strict mode, the function uses the scalar implementation.
+///             Otherwise, it uses the block-wise 2x2 inversion that is significantly
+///             faster, but the results may differ from the scalar path in the last bits.
+inline float4x4 Inverse(const float4x4& m)
+{
+#if DILIGENT_SIMD_MATH_VECTOR && !DILIGENT_SIMD_MATH_STRICT
+    using namespace Detail;
+    const Vec4f r0 = LoadRow(m, 0);
+    const Vec4f r1 = LoadRow(m, 1);
+    const Vec4f r2 = LoadRow(m, 2);
+    const Vec4f r3 = LoadRow(m, 3);
+
+    // Split the matrix into 2x2 blocks:
+    //  | A  B |
+    //  | C  D |
+    const Vec4f A = Shuffle<0, 1, 0, 1>(r0, r1);
+    const Vec4f B = Shuffle<2, 3, 2, 3>(r0, r1);
+    const Vec4f C = Shuffle<0, 1, 0, 1>(r2, r3);
+    const Vec4f D = Shuffle<2, 3, 2, 3>(r2, r3);
+
+    // Block determinants (|A|, |B|, |C|, |D|)
+    const Vec4f DetSub = Sub(Mul(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                             Mul(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+
+    const Vec4f DetA = SplatLane<0>(DetSub);
+    const Vec4f DetB = SplatLane<1>(DetSub);
+    const Vec4f DetC = SplatLane<2>(DetSub);
+    const Vec4f DetD = SplatLane<3>(DetSub);
+
+    const Vec4f D_C = Mat2AdjMul(D, C);
+    const Vec4f A_B = Mat2AdjMul(A, B);
+
+    // The inverse is 1/|M| * | X  Y |
+    //                        | Z  W |
+    // The blocks below are adjugates of X, Y, Z, W:
+    //  X# = |D|A - B(D#C)
+    //  W# = |A|D - C(A#B)
+    //  Y# = |B|C - D(A#B)#
+    //  Z# = |C|B - A(D#C)#
+    Vec4f X_ = Sub(Mul(DetD, A), Mat2Mul(B, D_C));
+    Vec4f W_ = Sub(Mul(DetA, D), Mat2Mul(C, A_B));
+    Vec4f Y_ = Sub(Mul(DetB, C), Mat2MulAdj(D, A_B));
+    Vec4f Z_ = Sub(Mul(DetC, B), Mat2MulAdj(A, D_C));
+
+    // |M| = |A|*|D| + |B|*|C| - tr((A#B)(D#C))
+    const float Tr   = HorizontalSum(Mul(A_B, Swizzle<0, 2, 1, 3>(D_C)));
+    const Vec4f DetM = Sub(Add(Mul(DetA, DetD), Mul(DetB, DetC)), Splat(Tr));
+
+    // (1/|M|, -1/|M|, -1/|M|, 1/|M|)
+    const float AdjSignMask[] = {1.f, -1.f, -1.f, 1.f};
+    const Vec4f RcpDetM       = Div(Load(AdjSignMask), DetM);
+
+    X_ = Mul(X_, RcpDetM);
+    Y_ = Mul(Y_, RcpDetM);
+    Z_ = Mul(Z_, RcpDetM);
+    W_ = Mul(W_, RcpDetM);
+
+    // Apply the adjugate and pack the blocks into rows
+    float4x4 Res;
+    Store(Res.m[0], Shuffle<3, 1, 3, 1>(X_, Y_));
+    Store(Res.m[1], Shuffle<2, 0, 2, 0>(X_, Y_));
+    Store(Res.m[2], Shuffle<3, 1, 3, 1>(Z_, W_));
+    Store(Res.m[3], Shuffle<2, 0, 2, 0>(Z_, W_));
+    return Res;
+#else
+    return m.Inverse();
+#endif
+}
+
+
+/// Transforms an array of row vectors by the matrix: pDst[i] = pSrc[i] * m.
+
+/// \remarks    pSrc and pDst may point to the same array.
+inline void TransformVectors(const float4* pSrc, float4* pDst, size_t NumVectors, const float4x4& m)
+{
+#if DILIGENT_SIMD_MATH_VECTOR
+    using namespace Detail;
+    const Vec4f r0 = LoadRow(m, 0);
+    const Vec4f r1 = LoadRow(m, 1);
+    const Vec4f r2 = LoadRow(m, 2);
+    const Vec4f r3 = LoadRow(m, 3);
+    for (size_t i = 0; i < NumVectors; ++i)
+        Store(pDst[i].Data(), MulRowVector(Load(pSrc[i]), r0, r1, r2, r3));
+#else
+    for (size_t i = 0; i < NumVectors; ++i)
+        pDst[i] = pSrc[i] * m;
+#endif
+}
+
+} // inline namespace
+
+} // namespace SIMD
+
+} // namespace Diligent
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// CPU profiler instrumentation macros
+
+// The macros below mark CPU zones and events in the engine's hot paths. By default, they
+// compile to nothing. The profiler backend is selected at build time with the DILIGENT_CPU_PROFILER
+// CMake option that defines one of the following macros:
+//
+//  - DILIGENT_CPU_PROFILER_TRACY   - the macros are mapped to Tracy (https://github.com/wolfpld/tracy).
+//                                    The TracyClient target must be available.
+//  - DILIGENT_CPU_PROFILER_HEADER  - the path to a custom header that defines
+//                                    DILIGENT_CPU_PROFILER_ZONE_IMPL(VarName, Name),
+//                                    DILIGENT_CPU_PROFILER_MARKER_IMPL(Name) and
+//                                    DILIGENT_CPU_PROFILER_SET_THREAD_NAME_IMPL(Name).
+//                                    This is used to integrate Perfetto, ETW, os_signpost or
+//                                    any other profiler.
+//
+// All names must be string literals or otherwise have static storage duration.
+
+#if defined(DILIGENT_CPU_PROFILER_TRACY)
+
+#    include <tracy/Tracy.hpp>
+
+#    define DILIGENT_CPU_PROFILER_ZONE_IMPL(VarName, Name)   ZoneNamedN(VarName, Name, true)
+#    define DILIGENT_CPU_PROFILER_MARKER_IMPL(Name)          TracyMessageL(Name)
+#    define DILIGENT_CPU_PROFILER_SET_THREAD_NAME_IMPL(Name) tracy::SetThreadName(Name)
+
+#elif defined(DILIGENT_CPU_PROFILER_HEADER)
+
+#    include DILIGENT_CPU_PROFILER_HEADER
+
+#    if !defined(DILIGENT_CPU_PROFILER_ZONE_IMPL) || !defined(DILIGENT_CPU_PROFILER_MARKER_IMPL) || !defined(DILIGENT_CPU_PROFILER_SET_THREAD_NAME_IMPL)
+#        error Custom CPU profiler header must define DILIGENT_CPU_PROFILER_ZONE_IMPL, DILIGENT_CPU_PROFILER_MARKER_IMPL and DILIGENT_CPU_PROFILER_SET_THREAD_NAME_IMPL
+#    endif
+
+#endif
+
+#if defined(DILIGENT_CPU_PROFILER_ZONE_IMPL)
+
+#    define DILIGENT_CPU_PROFILER_ENABLED 1
+
+#    define DILIGENT_CPU_PROFILER_CONCAT_IMPL(A, B) A##B
+#    define DILIGENT_CPU_PROFILER_CONCAT(A, B)      DILIGENT_CPU_PROFILER_CONCAT_IMPL(A, B)
+
+/// Marks a CPU zone that lasts until the end of the current scope.
+#    define DILIGENT_PROFILE_ZONE(Name) DILIGENT_CPU_PROFILER_ZONE_IMPL(DILIGENT_CPU_PROFILER_CONCAT(_DiligentProfilerZone, __LINE__), Name)
+
+/// Marks a CPU zone named after the current function that lasts until the end of the current scope.
+#    define DILIGENT_PROFILE_FUNCTION() DILIGENT_PROFILE_ZONE(__func__)
+
+/// Records an instant event.
+#    define DILIGENT_PROFILE_MARKER(Name) DILIGENT_CPU_PROFILER_MARKER_IMPL(Name)
+
+/// Sets the name of the calling thread.
+#    define DILIGENT_PROFILE_SET_THREAD_NAME(Name) DILIGENT_CPU_PROFILER_SET_THREAD_NAME_IMPL(Name)
+
+#else
+
+#    define DILIGENT_CPU_PROFILER_ENABLED 0
+
+#    define DILIGENT_PROFILE_ZONE(Name)            do {} while (false)
+#    define DILIGENT_PROFILE_FUNCTION()            do {} while (false)
+#    define DILIGENT_PROFILE_MARKER(Name)          do {} while (false)
+#    define DILIGENT_PROFILE_SET_THREAD_NAME(Name) do {} while (false)
+
+#endif
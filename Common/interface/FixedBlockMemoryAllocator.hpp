@@ -39,6 +39,7 @@
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Primitives/interface/MemoryAllocator.h"
 #include "STDAllocator.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
@@ -47,7 +48,23 @@ namespace Diligent
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
-    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage);
+    /// Creates the allocator.
+
+    /// \param [in] RawMemoryAllocator - Raw memory allocator that is used to allocate memory pages.
+    /// \param [in] BlockSize          - The size of one block.
+    /// \param [in] NumBlocksInPage    - The number of blocks in one memory page.
+    /// \param [in] ThreadCacheSize    - The maximum number of free blocks kept in each thread cache.
+    ///                                  If zero, thread caches are disabled.
+    ///
+    /// \remarks   When thread caches are enabled, every thread is assigned one of the caches
+    ///            that keeps a small number of free blocks. Allocations and deallocations are
+    ///            served from the cache and only access the shared pages when the cache
+    ///            is empty or full. In this case a batch of ThreadCacheSize/2 blocks is moved
+    ///            between the cache and the pages under the allocator mutex.
+    ///            This significantly reduces the lock contention when multiple threads
+    ///            allocate and release blocks, at the cost of keeping up to ThreadCacheSize
+    ///            free blocks per cache reserved.
+    FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator, size_t BlockSize, Uint32 NumBlocksInPage, Uint32 ThreadCacheSize = 0);
     ~FixedBlockMemoryAllocator();
 
     /// Allocates block of memory
@@ -62,6 +79,24 @@ public:
     /// Releases memory allocated with AllocateAligned
     virtual void FreeAligned(void* Ptr) override final;
 
+    /// Thread cache statistics
+    struct ThreadCacheStats
+    {
+        /// The number of allocations and deallocations that were served
+        /// by the thread caches without accessing the shared pages.
+        Uint64 NumHits = 0;
+
+        /// The number of allocations and deallocations that had to
+        /// move blocks between the thread caches and the shared pages.
+        Uint64 NumMisses = 0;
+    };
+
+    /// Returns the thread cache statistics accumulated since the allocator was created.
+    ThreadCacheStats GetThreadCacheStats();
+
+    /// Returns all blocks kept in the thread caches to the shared pages.
+    void FlushThreadCaches();
+
 private:
     // clang-format off
     FixedBlockMemoryAllocator             (const FixedBlockMemoryAllocator&) = delete;
@@ -72,6 +107,13 @@ private:
 
     void CreateNewPage();
 
+    // Allocates a block from the shared pages. m_Mutex must be locked.
+    void* AllocateFromPages();
+    // Returns the block to the shared pages. m_Mutex must be locked.
+    void FreeToPages(void* Ptr);
+    // Returns the block held by a thread cache to the shared pages. m_Mutex must be locked.
+    void FreeCachedBlockToPages(void* Ptr);
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -122,6 +164,34 @@ private:
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
     const Uint32      m_NumBlocksInPage;
+
+    // Free blocks cached by a group of threads. Every thread always uses the same cache,
+    // so the lock is practically uncontended unless there are more threads than caches.
+    // Caches are allocated with AllocateAligned() so that each one occupies its own cache line.
+    struct alignas(64) ThreadCache
+    {
+        Threading::SpinLock Lock;
+
+        // The number of blocks in the cache. The blocks are stored in
+        // m_CachedBlocks[CacheIdx * m_ThreadCacheSize, CacheIdx * m_ThreadCacheSize + NumBlocks).
+        Uint32 NumBlocks = 0;
+
+        Uint64 NumHits   = 0;
+        Uint64 NumMisses = 0;
+    };
+    static constexpr Uint32 NumThreadCaches = 16;
+
+    const Uint32 m_ThreadCacheSize;
+
+    const Uint32 m_NumThreadCaches;
+    ThreadCache* m_ThreadCaches = nullptr;
+
+    std::vector<void*, STDAllocatorRawMem<void*>> m_CachedBlocks;
+
+#ifdef DILIGENT_DEBUG
+    // Free blocks that are currently held by the thread caches. Protected by m_Mutex.
+    std::unordered_set<void*, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<void*>> m_dbgCachedBlocks;
+#endif
 };
 
 IMemoryAllocator& GetRawAllocator();
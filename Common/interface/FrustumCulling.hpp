@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batched view frustum culling functions.
+
+#include "AdvancedMath.hpp"
+
+namespace Diligent
+{
+
+struct IThreadPool;
+
+/// Axis-aligned bounding boxes stored in structure-of-arrays layout.
+
+/// Every array must contain at least as many elements as the number of boxes being tested.
+struct BoundBoxArraysSoA
+{
+    const float* MinX = nullptr;
+    const float* MinY = nullptr;
+    const float* MinZ = nullptr;
+    const float* MaxX = nullptr;
+    const float* MaxY = nullptr;
+    const float* MaxZ = nullptr;
+};
+
+/// Bounding spheres stored in structure-of-arrays layout.
+
+/// Every array must contain at least as many elements as the number of spheres being tested.
+struct BoundSphereArraysSoA
+{
+    const float* CenterX = nullptr;
+    const float* CenterY = nullptr;
+    const float* CenterZ = nullptr;
+    const float* Radius  = nullptr;
+};
+
+/// Tests an array of bounding boxes against the view frustum and writes the visibility bit mask.
+
+/// \param[in]  Frustum        - View frustum.
+/// \param[in]  Boxes          - Bounding boxes in SoA layout.
+/// \param[in]  NumBoxes       - The number of boxes to test.
+/// \param[out] pVisibleMask   - Visibility bit mask. Bit i % 32 of element i / 32 is set if
+///                              box i is not invisible, i.e. GetBoxVisibility() would return
+///                              BoxVisibility::Intersecting or BoxVisibility::FullyVisible for it.
+///                              The array must contain at least (NumBoxes + 31) / 32 elements.
+///                              Unused bits of the last element are set to zero.
+/// \param[in]  PlaneFlags     - Frustum planes to test the boxes against.
+/// \param[in]  pThreadPool    - Optional thread pool that is used to split the work
+///                              across multiple threads, see Diligent::ParallelFor().
+///                              If null, all boxes are processed by the calling thread.
+///
+/// \remarks    The function uses AVX2, SSE2, NEON or WebAssembly SIMD128 instructions when available.
+///             The results are identical to testing every box with GetBoxVisibility().
+void GetBoxesVisibility(const ViewFrustum&       Frustum,
+                        const BoundBoxArraysSoA& Boxes,
+                        Uint32                   NumBoxes,
+                        Uint32*                  pVisibleMask,
+                        FRUSTUM_PLANE_FLAGS      PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*             pThreadPool = nullptr);
+
+/// Tests an array of bounding spheres against the view frustum and writes the visibility bit mask.
+
+/// \param[in]  Frustum        - View frustum.
+/// \param[in]  Spheres        - Bounding spheres in SoA layout.
+/// \param[in]  NumSpheres     - The number of spheres to test.
+/// \param[out] pVisibleMask   - Visibility bit mask. Bit i % 32 of element i / 32 is set if
+///                              sphere i is not fully outside one of the frustum planes.
+///                              The array must contain at least (NumSpheres + 31) / 32 elements.
+///                              Unused bits of the last element are set to zero.
+/// \param[in]  PlaneFlags     - Frustum planes to test the spheres against.
+/// \param[in]  pThreadPool    - Optional thread pool that is used to split the work
+///                              across multiple threads.
+///
+/// \remarks    Frustum plane normals don't have to be normalized.
+void GetSpheresVisibility(const ViewFrustum&          Frustum,
+                          const BoundSphereArraysSoA& Spheres,
+                          Uint32                      NumSpheres,
+                          Uint32*                     pVisibleMask,
+                          FRUSTUM_PLANE_FLAGS         PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                          IThreadPool*                pThreadPool = nullptr);
+
+/// Writes the indices of the set bits of the visibility mask to the index list.
+
+/// \param[in]  pVisibleMask    - Visibility bit mask written by GetBoxesVisibility() or GetSpheresVisibility().
+/// \param[in]  NumItems        - The number of items in the mask.
+/// \param[out] pVisibleIndices - Compacted list of visible item indices in ascending order.
+///                               The array must be large enough to contain all visible indices
+///                               (NumItems in the worst case).
+/// \return     The number of visible items written to pVisibleIndices.
+Uint32 CompactVisibleIndices(const Uint32* pVisibleMask,
+                             Uint32        NumItems,
+                             Uint32*       pVisibleIndices);
+
+/// Tests an array of bounding boxes against the view frustum and writes the indices of visible boxes.
+
+/// \return The number of visible boxes written to pVisibleIndices.
+///
+/// \remarks See GetBoxesVisibility() for the description of the parameters.
+///          pVisibleIndices must contain at least NumBoxes elements.
+Uint32 GetVisibleBoxes(const ViewFrustum&       Frustum,
+                       const BoundBoxArraysSoA& Boxes,
+                       Uint32                   NumBoxes,
+                       Uint32*                  pVisibleIndices,
+                       FRUSTUM_PLANE_FLAGS      PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                       IThreadPool*             pThreadPool = nullptr);
+
+/// Tests an array of bounding spheres against the view frustum and writes the indices of visible spheres.
+
+/// \return The number of visible spheres written to pVisibleIndices.
+///
+/// \remarks See GetSpheresVisibility() for the description of the parameters.
+///          pVisibleIndices must contain at least NumSpheres elements.
+Uint32 GetVisibleSpheres(const ViewFrustum&          Frustum,
+                         const BoundSphereArraysSoA& Spheres,
+                         Uint32                      NumSpheres,
+                         Uint32*                     pVisibleIndices,
+                         FRUSTUM_PLANE_FLAGS         PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                         IThreadPool*                pThreadPool = nullptr);
+
+} // namespace Diligent
@@ -39,6 +39,7 @@
 #include "../../Graphics/GraphicsEngine/interface/DepthStencilState.h"
 #include "../../Graphics/GraphicsEngine/interface/BlendState.h"
 #include "../../Graphics/GraphicsEngine/interface/TextureView.h"
+#include "../../Graphics/GraphicsEngine/interface/BufferView.h"
 #include "../../Graphics/GraphicsEngine/interface/PipelineResourceSignature.h"
 #include "../../Graphics/GraphicsEngine/interface/PipelineState.h"
 #include "../../Graphics/GraphicsTools/interface/VertexPool.h"
@@ -139,51 +140,124 @@ std::size_t ComputeHash(const FirstArgType& FirstArg, const RestArgsType&... Res
     return Seed;
 }
 
-inline std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept
+namespace HashUtilsInternal
+{
+
+// XXH64 constants, see https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+static constexpr Uint64 XXH64Prime1 = 0x9E3779B185EBCA87ull;
+static constexpr Uint64 XXH64Prime2 = 0xC2B2AE3D27D4EB4Full;
+static constexpr Uint64 XXH64Prime3 = 0x165667B19E3779F9ull;
+static constexpr Uint64 XXH64Prime4 = 0x85EBCA77C2B2AE63ull;
+static constexpr Uint64 XXH64Prime5 = 0x27D4EB2F165667C5ull;
+
+constexpr Uint64 RotL64(Uint64 x, int r) noexcept
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline Uint64 Read64(const Uint8* Ptr) noexcept
 {
-    size_t Hash = 0;
+    Uint64 Val;
+    std::memcpy(&Val, Ptr, sizeof(Val));
+    return Val;
+}
 
-    const auto* BytePtr  = static_cast<const Uint8*>(pData);
-    const auto* EndPtr   = BytePtr + Size;
-    const auto* DwordPtr = static_cast<const Uint32*>(AlignUp(pData, alignof(Uint32)));
+inline Uint32 Read32(const Uint8* Ptr) noexcept
+{
+    Uint32 Val;
+    std::memcpy(&Val, Ptr, sizeof(Val));
+    return Val;
+}
 
-    // Process initial bytes before we get to the 32-bit aligned pointer
-    Uint64 Buffer = 0;
-    Uint64 Shift  = 0;
-    while (BytePtr < EndPtr && BytePtr < reinterpret_cast<const Uint8*>(DwordPtr))
+constexpr Uint64 XXH64Round(Uint64 Acc, Uint64 Input) noexcept
+{
+    return RotL64(Acc + Input * XXH64Prime2, 31) * XXH64Prime1;
+}
+
+constexpr Uint64 XXH64MergeRound(Uint64 Acc, Uint64 Val) noexcept
+{
+    return (Acc ^ XXH64Round(0, Val)) * XXH64Prime1 + XXH64Prime4;
+}
+
+} // namespace HashUtilsInternal
+
+/// Computes the 64-bit XXH64 hash of a memory buffer.
+
+/// The data is processed by four independent 64-bit lanes, 32 bytes per iteration, which
+/// lets the CPU execute the lanes in parallel. The buffer does not need to be aligned.
+/// The result is identical to the reference XXH64 implementation on little-endian platforms.
+inline Uint64 ComputeHashRaw64(const void* pData, size_t Size, Uint64 Seed = 0) noexcept
+{
+    using namespace HashUtilsInternal;
+
+    const Uint8*       Ptr    = static_cast<const Uint8*>(pData);
+    const Uint8* const EndPtr = Ptr + Size;
+
+    Uint64 Hash;
+    if (Size >= 32)
     {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
-    }
-    VERIFY_EXPR(Shift <= 24);
+        Uint64 Acc0 = Seed + XXH64Prime1 + XXH64Prime2;
+        Uint64 Acc1 = Seed + XXH64Prime2;
+        Uint64 Acc2 = Seed;
+        Uint64 Acc3 = Seed - XXH64Prime1;
 
-    // Process dwords
-    while (DwordPtr + 1 <= reinterpret_cast<const Uint32*>(EndPtr))
+        const Uint8* const LimitPtr = EndPtr - 32;
+        do
+        {
+            Acc0 = XXH64Round(Acc0, Read64(Ptr + 0));
+            Acc1 = XXH64Round(Acc1, Read64(Ptr + 8));
+            Acc2 = XXH64Round(Acc2, Read64(Ptr + 16));
+            Acc3 = XXH64Round(Acc3, Read64(Ptr + 24));
+            Ptr += 32;
+        } while (Ptr <= LimitPtr);
+
+        Hash = RotL64(Acc0, 1) + RotL64(Acc1, 7) + RotL64(Acc2, 12) + RotL64(Acc3, 18);
+        Hash = XXH64MergeRound(Hash, Acc0);
+        Hash = XXH64MergeRound(Hash, Acc1);
+        Hash = XXH64MergeRound(Hash, Acc2);
+        Hash = XXH64MergeRound(Hash, Acc3);
+    }
+    else
     {
-        Buffer |= Uint64{*(DwordPtr++)} << Shift;
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
+        Hash = Seed + XXH64Prime5;
     }
 
+    Hash += static_cast<Uint64>(Size);
+
     // Process the remaining bytes
-    BytePtr = reinterpret_cast<const Uint8*>(DwordPtr);
-    while (BytePtr < EndPtr)
+    for (; EndPtr - Ptr >= 8; Ptr += 8)
     {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
+        Hash ^= XXH64Round(0, Read64(Ptr));
+        Hash = RotL64(Hash, 27) * XXH64Prime1 + XXH64Prime4;
     }
-    VERIFY_EXPR(Shift <= (3 + 3) * 8);
-
-    while (Shift != 0)
+    if (EndPtr - Ptr >= 4)
     {
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
-        Shift -= (std::min)(Shift, Uint64{32});
+        Hash ^= Uint64{Read32(Ptr)} * XXH64Prime1;
+        Hash = RotL64(Hash, 23) * XXH64Prime2 + XXH64Prime3;
+        Ptr += 4;
     }
+    for (; Ptr < EndPtr; ++Ptr)
+    {
+        Hash ^= Uint64{*Ptr} * XXH64Prime5;
+        Hash = RotL64(Hash, 11) * XXH64Prime1;
+    }
+
+    // Final avalanche
+    Hash ^= Hash >> 33;
+    Hash *= XXH64Prime2;
+    Hash ^= Hash >> 29;
+    Hash *= XXH64Prime3;
+    Hash ^= Hash >> 32;
 
     return Hash;
 }
 
+/// Computes the hash of a memory buffer, see ComputeHashRaw64().
+inline std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept
+{
+    return static_cast<std::size_t>(ComputeHashRaw64(pData, Size));
+}
+
 template <typename CharType>
 struct CStringHash
 {
@@ -597,6 +671,33 @@ struct HashCombiner<HasherType, TextureViewDesc> : HashCombinerBase<HasherType>
 };
 
 
+template <typename HasherType>
+struct HashCombiner<HasherType, BufferViewDesc> : HashCombinerBase<HasherType>
+{
+    HashCombiner(HasherType& Hasher) :
+        HashCombinerBase<HasherType>{Hasher}
+    {}
+
+    void operator()(const BufferViewDesc& BuffViewDesc) const
+    {
+        ASSERT_SIZEOF(BuffViewDesc.ViewType, 1, "Hash logic below may be incorrect.");
+        ASSERT_SIZEOF(BuffViewDesc.Format.ValueType, 1, "Hash logic below may be incorrect.");
+        ASSERT_SIZEOF(BuffViewDesc.Format.NumComponents, 1, "Hash logic below may be incorrect.");
+        ASSERT_SIZEOF(BuffViewDesc.Format.IsNormalized, 1, "Hash logic below may be incorrect.");
+
+        // Ignore Name. This is consistent with the operator==
+        this->m_Hasher(
+            ((static_cast<uint32_t>(BuffViewDesc.ViewType) << 0u) |
+             (static_cast<uint32_t>(BuffViewDesc.Format.ValueType) << 8u) |
+             (static_cast<uint32_t>(BuffViewDesc.Format.NumComponents) << 16u) |
+             (static_cast<uint32_t>(BuffViewDesc.Format.IsNormalized) << 24u)),
+            BuffViewDesc.ByteOffset,
+            BuffViewDesc.ByteWidth);
+        ASSERT_SIZEOF64(BuffViewDesc, 32, "Did you add new members to BufferViewDesc? Please handle them here.");
+    }
+};
+
+
 template <typename HasherType>
 struct HashCombiner<HasherType, SampleDesc> : HashCombinerBase<HasherType>
 {
@@ -992,7 +1093,8 @@ struct HashCombiner<HasherType, GraphicsPipelineDesc> : HashCombinerBase<HasherT
             ((static_cast<uint32_t>(Desc.NumViewports) << 0u) |
              (static_cast<uint32_t>(Desc.NumRenderTargets) << 8u) |
              (static_cast<uint32_t>(Desc.SubpassIndex) << 16u) |
-             (static_cast<uint32_t>(Desc.ShadingRateFlags) << 24u)));
+             (static_cast<uint32_t>(Desc.ShadingRateFlags) << 24u)),
+            Desc.DynamicStateFlags);
 
         for (size_t i = 0; i < Desc.NumRenderTargets; ++i)
             this->m_Hasher(Desc.RTVFormats[i]);
@@ -1313,7 +1415,8 @@ struct DefaultHasher
     template <typename... ArgsType>
     std::size_t operator()(const ArgsType&... Args) noexcept
     {
-        HashCombine(m_Seed, Args...);
+        using Expander = int[];
+        (void)Expander{0, (Combine(Args), 0)...};
         return m_Seed;
     }
 
@@ -1328,6 +1431,19 @@ struct DefaultHasher
     }
 
 private:
+    template <typename T>
+    void Combine(const T& Val) noexcept
+    {
+        HashCombine(m_Seed, Val);
+    }
+
+    // C strings in descriptions (names, semantics) are hashed by their contents to be
+    // consistent with the comparison operators that use SafeStrEqual().
+    void Combine(const Char* Str) noexcept
+    {
+        HashCombine(m_Seed, CStringHash<Char>{}(Str));
+    }
+
     size_t m_Seed = 0;
 };
 
@@ -1386,6 +1502,7 @@ DEFINE_HASH(Diligent::DepthStencilStateDesc);
 DEFINE_HASH(Diligent::RasterizerStateDesc);
 DEFINE_HASH(Diligent::BlendStateDesc);
 DEFINE_HASH(Diligent::TextureViewDesc);
+DEFINE_HASH(Diligent::BufferViewDesc);
 DEFINE_HASH(Diligent::SampleDesc);
 DEFINE_HASH(Diligent::ShaderResourceVariableDesc);
 DEFINE_HASH(Diligent::ImmutableSamplerDesc);
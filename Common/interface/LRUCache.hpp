@@ -24,12 +24,35 @@
 #include <algorithm>
 #include <atomic>
 #include <vector>
+#include <array>
+#include <functional>
 
 #include "../../../DiligentCore/Platforms/Basic/interface/DebugUtilities.hpp"
 
 namespace Diligent
 {
 
+/// LRU cache statistics
+struct LRUCacheStats
+{
+    /// The number of Get() calls that found initialized data in the cache.
+    size_t NumHits = 0;
+
+    /// The number of Get() calls that initialized the data.
+    size_t NumMisses = 0;
+
+    /// The number of objects removed from the cache to keep it within the size budget.
+    size_t NumEvictions = 0;
+
+    LRUCacheStats& operator+=(const LRUCacheStats& rhs)
+    {
+        NumHits += rhs.NumHits;
+        NumMisses += rhs.NumMisses;
+        NumEvictions += rhs.NumEvictions;
+        return *this;
+    }
+};
+
 /// A thread-safe and exception-safe LRU cache.
 ///
 /// Usage example:
@@ -85,6 +108,7 @@ public:
             DataType Data;
             size_t   DataSize = 0;
             InitData(Data, DataSize); // May throw
+            m_NumMisses.fetch_add(1);
             return Data;
         }
 
@@ -99,6 +123,7 @@ public:
         // InitData may throw, which will leave the wrapper in the cache in the 'InitFailure' state.
         // It will be removed from the cache later when the LRU queue is processed.
         auto Data = pDataWrpr->GetData(std::forward<InitDataType>(InitData), IsNewObject);
+        (IsNewObject ? m_NumMisses : m_NumHits).fetch_add(1);
 
         // Process the release queue
         std::vector<std::shared_ptr<DataWrapper>> DeleteList;
@@ -202,6 +227,7 @@ public:
                 m_LRUQueue.erase(m_LRUQueue.begin() + idx);
                 VERIFY_EXPR(m_CurrSize >= AccountedSize);
                 m_CurrSize -= AccountedSize;
+                m_NumEvictions.fetch_add(1);
             }
             VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
         }
@@ -224,6 +250,16 @@ public:
         return m_CurrSize;
     }
 
+    /// Returns the cache statistics.
+    LRUCacheStats GetStats() const
+    {
+        LRUCacheStats Stats;
+        Stats.NumHits      = m_NumHits.load();
+        Stats.NumMisses    = m_NumMisses.load();
+        Stats.NumEvictions = m_NumEvictions.load();
+        return Stats;
+    }
+
     ~LRUCache()
     {
 #ifdef DILIGENT_DEBUG
@@ -347,6 +383,86 @@ private:
 
     std::atomic<size_t> m_CurrSize{0};
     std::atomic<size_t> m_MaxSize{0};
+
+    std::atomic<size_t> m_NumHits{0};
+    std::atomic<size_t> m_NumMisses{0};
+    std::atomic<size_t> m_NumEvictions{0};
+};
+
+
+/// A thread-safe LRU cache that is split into NumShards independent LRUCache segments.
+///
+/// A segment is selected by the key hash, and every segment has its own mutex, LRU queue and
+/// size budget that equals 1/NumShards of the total maximum size. Threads that access
+/// different keys thus rarely contend for the same mutex, which makes the cache suitable
+/// for sharing between many worker threads.
+///
+/// The data is atomically initialized once, in the same way as in LRUCache.
+///
+/// \note  Since every segment evicts its own data, the cache may release an object
+///        while there is unused space in other segments.
+template <typename KeyType, typename DataType, typename KeyHasher = std::hash<KeyType>, size_t NumShards = 16>
+class ShardedLRUCache
+{
+public:
+    static_assert(NumShards > 0, "The number of shards must not be zero");
+
+    ShardedLRUCache() noexcept
+    {}
+
+    explicit ShardedLRUCache(size_t MaxSize) noexcept
+    {
+        SetMaxSize(MaxSize);
+    }
+
+    /// Finds the data in the cache and returns it. If the data is not found, it is atomically created
+    /// using the provided initializer, see LRUCache::Get().
+    template <typename InitDataType>
+    DataType Get(const KeyType& Key,
+                 InitDataType&& InitData // May throw
+                 ) noexcept(false)
+    {
+        return m_Shards[GetShardIndex(Key)].Get(Key, std::forward<InitDataType>(InitData));
+    }
+
+    /// Sets the maximum total cache size. Every shard gets an equal part of the budget.
+    void SetMaxSize(size_t MaxSize)
+    {
+        const size_t ShardMaxSize = (MaxSize + NumShards - 1) / NumShards;
+        for (auto& Shard : m_Shards)
+            Shard.SetMaxSize(ShardMaxSize);
+    }
+
+    /// Returns the current total cache size.
+    size_t GetCurrSize() const
+    {
+        size_t Size = 0;
+        for (const auto& Shard : m_Shards)
+            Size += Shard.GetCurrSize();
+        return Size;
+    }
+
+    /// Returns the statistics accumulated over all shards.
+    LRUCacheStats GetStats() const
+    {
+        LRUCacheStats Stats;
+        for (const auto& Shard : m_Shards)
+            Stats += Shard.GetStats();
+        return Stats;
+    }
+
+    static constexpr size_t GetNumShards() { return NumShards; }
+
+private:
+    size_t GetShardIndex(const KeyType& Key) const
+    {
+        // Many std::hash implementations are identity functions for integer types,
+        // so mix the bits to distribute sequential keys between shards.
+        const uint64_t Hash = static_cast<uint64_t>(KeyHasher{}(Key)) * uint64_t{0x9E3779B97F4A7C15};
+        return static_cast<size_t>(Hash >> 32) % NumShards;
+    }
+
+    std::array<LRUCache<KeyType, DataType, KeyHasher>, NumShards> m_Shards;
 };
 
 } // namespace Diligent
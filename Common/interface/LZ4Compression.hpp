@@ -0,0 +1,71 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// LZ4 block compression
+
+#include <cstddef>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Returns the maximum size of the LZ4-compressed data for the given source size.
+size_t GetLZ4CompressedSizeBound(size_t SrcSize);
+
+/// Compresses the data using the LZ4 block format.
+
+/// \param [in]  pSrc        - Source data.
+/// \param [in]  SrcSize     - Source data size, in bytes.
+/// \param [out] pDst        - Destination buffer.
+/// \param [in]  DstCapacity - Destination buffer size, in bytes.
+/// \return     The size of the compressed data, or zero if the destination
+///             buffer is too small.
+///
+/// \remarks    The output is compatible with the standard LZ4 block decoder.
+///             The compressed data does not contain the source data size, so
+///             it must be stored separately.
+///             If DstCapacity is at least GetLZ4CompressedSizeBound(SrcSize),
+///             compression never fails.
+size_t CompressLZ4(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity);
+
+/// Decompresses the data compressed with CompressLZ4().
+
+/// \param [in]  pSrc    - Compressed data.
+/// \param [in]  SrcSize - Compressed data size, in bytes.
+/// \param [out] pDst    - Destination buffer.
+/// \param [in]  DstSize - The size of the decompressed data, in bytes.
+/// \return     true if the data was decompressed successfully and exactly
+///             DstSize bytes were written, and false otherwise.
+///
+/// \remarks    The function never reads or writes outside of the source and
+///             destination buffers, so it is safe to use with untrusted data.
+bool DecompressLZ4(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize);
+
+} // namespace Diligent
@@ -0,0 +1,140 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the IDataBlob interface backed by a memory-mapped file
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Data blob whose contents are backed by a memory-mapped file.
+
+/// The file is mapped copy-on-write: pages are only read from disk when they are
+/// accessed for the first time, and writes through GetDataPtr() do not modify the file.
+/// This makes the blob suitable for zero-copy loading of large read-only data such as
+/// device object archives: only the parts of the archive that are actually used are paged in.
+///
+/// On platforms that do not support file mapping, the whole file is read into memory.
+class MappedFileDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    typedef ObjectBase<IDataBlob> TBase;
+
+    // {E4332957-1E48-4CB9-8C07-DBE88CF9E058}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0xe4332957, 0x1e48, 0x4cb9, {0x8c, 0x7, 0xdb, 0xe8, 0x8c, 0xf9, 0xe0, 0x58}};
+
+    /// Access pattern hint, see MappedFileDataBlob::Advise().
+    enum class AccessHint : Uint8
+    {
+        /// No special treatment.
+        Normal,
+
+        /// The data will be accessed sequentially, so the pages can be read ahead aggressively.
+        Sequential,
+
+        /// The data will be accessed in random order, so read-ahead is not useful.
+        Random,
+
+        /// The data will be accessed soon, so the pages should be read in the background.
+        WillNeed
+    };
+
+    /// Maps the file and returns the data blob, or null if the file could not be opened.
+
+    /// \param [in] FilePath - Path to the file to map.
+    /// \param [in] Hint     - Access hint for the entire file, see Diligent::MappedFileDataBlob::AccessHint.
+    static RefCntAutoPtr<IDataBlob> Create(const Char* FilePath, AccessHint Hint = AccessHint::Normal);
+
+    ~MappedFileDataBlob() override;
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_InternalImpl, IID_DataBlob, TBase)
+
+    /// Gives the system a hint about how the range of the mapped data will be accessed.
+
+    /// \param [in] Hint   - Access hint.
+    /// \param [in] Offset - Offset of the range.
+    /// \param [in] Size   - Size of the range. If zero, the range extends to the end of the data.
+    ///
+    /// \return    true if the hint was passed to the system, and false otherwise.
+    ///
+    /// \remarks   The hint only affects performance and never the data.
+    ///            Sequential and Random hints are ignored on Win32, and WillNeed
+    ///            requires Windows 8 or later.
+    bool Advise(AccessHint Hint, size_t Offset = 0, size_t Size = 0) const;
+
+    /// If pDataBlob is a mapped file data blob, calls Advise() for it and returns the result.
+    /// Otherwise, returns false.
+    static bool Advise(IDataBlob* pDataBlob, AccessHint Hint, size_t Offset = 0, size_t Size = 0);
+
+    /// Resizing is not supported by the mapped file data blob
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the mapped file
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override
+    {
+        return m_Size;
+    }
+
+    /// Returns the pointer to the mapped data
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr(size_t Offset = 0) override
+    {
+        VERIFY(Offset < m_Size || (Offset == 0 && m_Size == 0), "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+        return static_cast<Uint8*>(m_pData) + Offset;
+    }
+
+    /// Returns the const pointer to the mapped data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr(size_t Offset = 0) const override
+    {
+        VERIFY(Offset < m_Size || (Offset == 0 && m_Size == 0), "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+        return static_cast<const Uint8*>(m_pData) + Offset;
+    }
+
+private:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewRCObj;
+
+    MappedFileDataBlob(IReferenceCounters* pRefCounters,
+                       void*               pData,
+                       size_t              Size,
+                       void*               pMappingHandle);
+
+private:
+    void* const  m_pData;
+    const size_t m_Size;
+
+    // Platform-specific handle of the file mapping
+    void* const m_pMappingHandle;
+};
+
+} // namespace Diligent
@@ -107,4 +107,26 @@ public:
     }
 };
 
+/// Template class implementing base functionality for an object that keeps
+/// the reference counter in the object itself (see IntrusiveRefCountedObject)
+template <typename BaseInterface>
+class IntrusiveObjectBase : public IntrusiveRefCountedObject<BaseInterface>
+{
+public:
+    IntrusiveObjectBase() noexcept {}
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface)
+    {
+        if (ppInterface == nullptr)
+            return;
+
+        *ppInterface = nullptr;
+        if (IID == IID_Unknown)
+        {
+            *ppInterface = this;
+            (*ppInterface)->AddRef();
+        }
+    }
+};
+
 } // namespace Diligent
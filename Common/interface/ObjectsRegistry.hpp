@@ -19,11 +19,14 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <shared_mutex>
 #include <memory>
 #include <algorithm>
 #include <atomic>
+#include <array>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "SpinLock.hpp"
 #include "RefCntAutoPtr.hpp"
 
 namespace Diligent
@@ -107,6 +110,11 @@ auto _IsWeakPtrExpired(std::weak_ptr<T>& pWeakPtr)
 ///
 ///         It is guaranteed, that the Object will only be initialized once, even if multiple threads call Get() simultaneously.
 ///
+///         The registry is optimized for read-mostly use: the objects are distributed between NumShards
+///         independent hash maps, each protected by its own shared mutex. Looking up an existing object only
+///         acquires the shared lock of one shard, so that readers never block each other. Insertions and
+///         removals are serialized per shard. Expired entries are purged incrementally, one shard at a time.
+///
 template <typename KeyType,
           typename StrongPtrType,
           typename KeyHasher = std::hash<KeyType>,
@@ -116,8 +124,11 @@ class ObjectsRegistry
 public:
     using WeakPtrType = typename _StrongPtrHelper<StrongPtrType>::WeakPtrType;
 
+    static constexpr size_t NumShards = 16;
+
     explicit ObjectsRegistry(Uint32 NumRequestsToPurge = 1024) noexcept :
-        m_NumRequestsToPurge{NumRequestsToPurge}
+        // Every purge only processes one shard
+        m_NumRequestsToPurgeShard{(std::max)(NumRequestsToPurge / static_cast<Uint32>(NumShards), 1u)}
     {}
 
     /// Finds the object in the registry and returns strong pointer to it (std::shared_ptr or RefCntAutoPtr).
@@ -140,16 +151,28 @@ public:
                       CreateObjectType&& CreateObject // May throw
                       ) noexcept(false)
     {
+        Shard& KeyShard = GetShard(Key);
+
         // Get the Object wrapper. Since this is a shared pointer, it may not be destroyed
         // while we keep one, even if it is popped from the registry by another thread.
-        std::shared_ptr<ObjectWrapper> pObjectWrpr;
+        std::shared_ptr<ObjectWrapper> pObjectWrpr = KeyShard.Find(Key);
+        if (pObjectWrpr)
+        {
+            // Fast path: the object exists and is alive
+            if (StrongPtrType pObject = pObjectWrpr->Lock())
+            {
+                OnRequest();
+                return pObject;
+            }
+        }
+        else
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::lock_guard<std::shared_timed_mutex> Guard{KeyShard.Mtx};
 
-            auto it = m_Cache.find(Key);
-            if (it == m_Cache.end())
+            auto it = KeyShard.Map.find(Key);
+            if (it == KeyShard.Map.end())
             {
-                it = m_Cache.emplace(Key, std::make_shared<ObjectWrapper>()).first;
+                it = KeyShard.Map.emplace(Key, std::make_shared<ObjectWrapper>()).first;
             }
             pObjectWrpr = it->second;
         }
@@ -161,10 +184,10 @@ public:
         }
         catch (...)
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::lock_guard<std::shared_timed_mutex> Guard{KeyShard.Mtx};
 
-            auto it = m_Cache.find(Key);
-            if (it != m_Cache.end())
+            auto it = KeyShard.Map.find(Key);
+            if (it != KeyShard.Map.end())
             {
                 pObject = it->second->Lock();
                 if (pObject)
@@ -174,7 +197,7 @@ public:
                 }
                 else
                 {
-                    m_Cache.erase(it);
+                    KeyShard.Map.erase(it);
                 }
             }
 
@@ -182,33 +205,32 @@ public:
         }
 
         {
-            std::lock_guard<std::mutex> Guard{m_CacheMtx};
+            std::lock_guard<std::shared_timed_mutex> Guard{KeyShard.Mtx};
 
-            auto it = m_Cache.find(Key);
+            auto it = KeyShard.Map.find(Key);
             if (pObject)
             {
-                if (it == m_Cache.end())
+                if (it == KeyShard.Map.end())
                 {
                     // The wrapper was removed from the cache by another thread while we were waiting
                     // for the lock - add it back.
-                    m_Cache.emplace(Key, pObjectWrpr);
+                    KeyShard.Map.emplace(Key, pObjectWrpr);
                 }
             }
             else
             {
-                if (it != m_Cache.end())
+                if (it != KeyShard.Map.end())
                 {
                     pObject = it->second->Lock();
                     // Note that the object may have been created by another thread while we were waiting for the lock
                     if (!pObject)
-                        m_Cache.erase(it);
+                        KeyShard.Map.erase(it);
                 }
             }
-
-            if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
-                PurgeUnguarded();
         }
 
+        OnRequest();
+
         return pObject;
     }
 
@@ -221,20 +243,28 @@ public:
     ///             or empty pointer otherwise.
     StrongPtrType Get(const KeyType& Key)
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
+        OnRequest();
 
-        if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
-            PurgeUnguarded();
+        Shard& KeyShard = GetShard(Key);
+
+        std::shared_ptr<ObjectWrapper> pObjectWrpr = KeyShard.Find(Key);
+        if (!pObjectWrpr)
+            return {};
+
+        if (StrongPtrType pObject = pObjectWrpr->Lock())
+            return pObject;
 
-        auto it = m_Cache.find(Key);
-        if (it != m_Cache.end())
+        std::lock_guard<std::shared_timed_mutex> Guard{KeyShard.Mtx};
+
+        auto it = KeyShard.Map.find(Key);
+        if (it != KeyShard.Map.end())
         {
             auto pObject = it->second->Lock();
             if (!pObject)
             {
                 // Note that we may remove the entry from the cache while another thread is creating the object.
                 // This is OK as it will be added back to the cache.
-                m_Cache.erase(it);
+                KeyShard.Map.erase(it);
             }
 
             return pObject;
@@ -246,20 +276,23 @@ public:
     /// Removes all expired pointers from the cache
     void Purge()
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        PurgeUnguarded();
+        for (auto& CurrShard : m_Shards)
+            CurrShard.Purge();
     }
 
     /// Processes each element in the cache with the specified handler.
     template <typename HandlerType>
     void ProcessElements(HandlerType&& Handler)
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        for (auto& Entry : m_Cache)
+        for (auto& CurrShard : m_Shards)
         {
-            if (auto pObject = Entry.second->Lock())
+            std::shared_lock<std::shared_timed_mutex> Guard{CurrShard.Mtx};
+            for (auto& Entry : CurrShard.Map)
             {
-                Handler(Entry.first, *pObject);
+                if (auto pObject = Entry.second->Lock())
+                {
+                    Handler(Entry.first, *pObject);
+                }
             }
         }
     }
@@ -267,8 +300,11 @@ public:
     /// Removes all objects from the cache.
     void Clear()
     {
-        std::lock_guard<std::mutex> Guard{m_CacheMtx};
-        m_Cache.clear();
+        for (auto& CurrShard : m_Shards)
+        {
+            std::lock_guard<std::shared_timed_mutex> Guard{CurrShard.Mtx};
+            CurrShard.Map.clear();
+        }
         m_NumRequestsSinceLastPurge.store(0);
     }
 
@@ -279,60 +315,94 @@ private:
         template <typename CreateObjectType>
         const StrongPtrType Get(CreateObjectType&& CreateObject) noexcept(false)
         {
-            StrongPtrType pObject;
-
             std::lock_guard<std::mutex> Guard{m_CreateObjectMtx};
-            pObject = _LockWeakPtr(m_wpObject);
+
+            StrongPtrType pObject = Lock();
             if (!pObject)
             {
-                pObject    = CreateObject(); // May throw
+                pObject = CreateObject(); // May throw
+
+                Threading::SpinLockGuard PtrGuard{m_PtrLock};
                 m_wpObject = pObject;
             }
 
             return pObject;
         }
 
+        // Never waits for the object creation to finish
         StrongPtrType Lock()
         {
+            Threading::SpinLockGuard PtrGuard{m_PtrLock};
             return _LockWeakPtr(m_wpObject);
         }
 
         bool IsExpired()
         {
+            Threading::SpinLockGuard PtrGuard{m_PtrLock};
             return _IsWeakPtrExpired(m_wpObject);
         }
 
     private:
-        std::mutex  m_CreateObjectMtx;
-        WeakPtrType m_wpObject;
+        std::mutex          m_CreateObjectMtx;
+        Threading::SpinLock m_PtrLock;
+        WeakPtrType         m_wpObject;
     };
 
-    void PurgeUnguarded()
+    using CacheType = std::unordered_map<KeyType, std::shared_ptr<ObjectWrapper>, KeyHasher, KeyEqual>;
+
+    struct Shard
     {
-        for (auto it = m_Cache.begin(); it != m_Cache.end();)
+        std::shared_timed_mutex Mtx;
+        CacheType               Map;
+
+        std::shared_ptr<ObjectWrapper> Find(const KeyType& Key)
         {
-            if (it->second->IsExpired())
-            {
-                it = m_Cache.erase(it);
-            }
-            else
+            std::shared_lock<std::shared_timed_mutex> Guard{Mtx};
+
+            auto it = Map.find(Key);
+            return it != Map.end() ? it->second : nullptr;
+        }
+
+        void Purge()
+        {
+            std::lock_guard<std::shared_timed_mutex> Guard{Mtx};
+            for (auto it = Map.begin(); it != Map.end();)
             {
-                ++it;
+                if (it->second->IsExpired())
+                {
+                    it = Map.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
             }
         }
+    };
 
-        m_NumRequestsSinceLastPurge.store(0);
+    Shard& GetShard(const KeyType& Key)
+    {
+        // Mix the bits as std::hash is the identity function for integer types in many implementations
+        const uint64_t Hash = static_cast<uint64_t>(KeyHasher{}(Key)) * uint64_t{0x9E3779B97F4A7C15};
+        return m_Shards[static_cast<size_t>(Hash >> 32) % NumShards];
     }
 
-private:
-    using CacheType = std::unordered_map<KeyType, std::shared_ptr<ObjectWrapper>, KeyHasher, KeyEqual>;
+    void OnRequest()
+    {
+        if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurgeShard)
+        {
+            m_NumRequestsSinceLastPurge.store(0);
+            m_Shards[m_NextPurgeShard.fetch_add(1) % NumShards].Purge();
+        }
+    }
 
-    const Uint32 m_NumRequestsToPurge;
+private:
+    const Uint32 m_NumRequestsToPurgeShard;
 
     std::atomic<Uint32> m_NumRequestsSinceLastPurge{0};
+    std::atomic<Uint32> m_NextPurgeShard{0};
 
-    std::mutex m_CacheMtx;
-    CacheType  m_Cache;
+    std::array<Shard, NumShards> m_Shards;
 };
 
 } // namespace Diligent
@@ -0,0 +1,159 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::PooledRawMemoryAllocator class
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "SpinLock.hpp"
+
+namespace Diligent
+{
+
+/// Raw memory allocator that serves small allocations from size-classed pools
+/// with per-thread caches.
+
+/// Allocations up to MaxPooledSize bytes are rounded up to one of the size classes
+/// and are served from the free list of the calling thread without any locking.
+/// When a thread's list is empty, a batch of blocks is taken from the shared list of the
+/// size class, and when it grows too long, a batch is returned to the shared list.
+/// Larger allocations are forwarded to the DefaultRawMemoryAllocator.
+///
+/// The allocator can be passed to the engine through EngineCreateInfo::pRawMemAllocator.
+///
+/// \remarks    Memory of the pools is never returned to the system, and the allocator
+///             instance is never destroyed, so that objects released during the static
+///             deinitialization can still be freed safely.
+class PooledRawMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    /// Allocations larger than this size are not pooled.
+    static constexpr size_t MaxPooledSize = 32768;
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override;
+
+    static PooledRawMemoryAllocator& GetAllocator();
+
+    /// Allocation statistics for one allocation description.
+    struct DescriptionStats
+    {
+        /// Allocation description, e.g. "Raw memory for DynamicLinearAllocator".
+        std::string Description;
+
+        /// The number of allocations made with this description.
+        Uint64 NumAllocations = 0;
+
+        /// The total number of bytes requested by these allocations.
+        Uint64 TotalSize = 0;
+    };
+
+    /// Enables or disables collecting the allocation statistics.
+
+    /// \remarks    Statistics are grouped by the dbgDescription argument of the allocation
+    ///             methods, which the engine sets for every allocation. Collecting the
+    ///             statistics requires a lock for every allocation, so it is disabled
+    ///             by default.
+    void EnableStats(bool Enable);
+
+    /// Returns the statistics collected since the last ResetStats() call.
+    std::vector<DescriptionStats> GetStats();
+
+    /// Clears the statistics.
+    void ResetStats();
+
+    /// Returns the size of the block that is used for an allocation of the given size.
+    static size_t GetBlockSize(size_t Size);
+
+private:
+    PooledRawMemoryAllocator();
+
+    // clang-format off
+    PooledRawMemoryAllocator           (const PooledRawMemoryAllocator&)  = delete;
+    PooledRawMemoryAllocator           (      PooledRawMemoryAllocator&&) = delete;
+    PooledRawMemoryAllocator& operator=(const PooledRawMemoryAllocator&)  = delete;
+    PooledRawMemoryAllocator& operator=(      PooledRawMemoryAllocator&&) = delete;
+    // clang-format on
+
+    void RecordAllocation(size_t Size, const Char* dbgDescription);
+
+public:
+    // Implementation details used by the thread caches
+    struct FreeBlock
+    {
+        FreeBlock* pNext;
+    };
+
+    // 16-byte steps up to 128 bytes, then four classes per power of two up to MaxPooledSize
+    static constexpr Uint32 NumSizeClasses = 8 + 4 * 8;
+
+    // Takes up to MaxCount blocks of the size class from the shared list.
+    // Returns the list of blocks and the actual number of blocks in Count.
+    FreeBlock* AcquireBlocks(Uint32 SizeClass, Uint32 MaxCount, Uint32& Count);
+
+    // Returns the list of Count blocks to the shared list of the size class.
+    void ReleaseBlocks(Uint32 SizeClass, FreeBlock* pFirst, FreeBlock* pLast, Uint32 Count);
+
+private:
+    struct SizeClassPool
+    {
+        Threading::SpinLock Lock;
+
+        FreeBlock* pFreeList     = nullptr;
+        Uint32     NumFreeBlocks = 0;
+    };
+    SizeClassPool m_Pools[NumSizeClasses];
+
+    std::atomic<bool> m_StatsEnabled{false};
+
+    struct DescStatsCounters
+    {
+        Uint64 NumAllocations = 0;
+        Uint64 TotalSize      = 0;
+    };
+    std::mutex                                         m_StatsMtx;
+    std::unordered_map<const Char*, DescStatsCounters> m_Stats;
+};
+
+} // namespace Diligent
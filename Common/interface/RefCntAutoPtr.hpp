@@ -450,6 +450,58 @@ protected:
     T* m_pObject = nullptr;
 };
 
+/// Non-owning pointer to a reference counting object
+
+/// A borrowed pointer never touches the reference counters: it is a raw pointer that documents
+/// the ownership. It is intended for hot paths such as command recording, where the object is
+/// known to be kept alive by a strong reference held elsewhere (e.g. by the device context
+/// state or by the caller) for as long as the borrowed pointer is used.
+/// Use Promote() to obtain a strong reference when the object must outlive that owner.
+template <typename T>
+class RefCntBorrowedPtr
+{
+public:
+    RefCntBorrowedPtr() noexcept {}
+
+    RefCntBorrowedPtr(std::nullptr_t) noexcept {}
+
+    RefCntBorrowedPtr(T* pObj) noexcept :
+        m_pObject{pObj}
+    {}
+
+    template <typename DerivedType, typename = typename std::enable_if<std::is_base_of<T, DerivedType>::value>::type>
+    RefCntBorrowedPtr(const RefCntAutoPtr<DerivedType>& AutoPtr) noexcept :
+        m_pObject{AutoPtr.RawPtr()}
+    {}
+
+    template <typename DerivedType, typename = typename std::enable_if<std::is_base_of<T, DerivedType>::value>::type>
+    RefCntBorrowedPtr(const RefCntBorrowedPtr<DerivedType>& BorrowedPtr) noexcept :
+        m_pObject{BorrowedPtr.RawPtr()}
+    {}
+
+    // Borrowing from a temporary smart pointer would leave the pointer dangling
+    template <typename DerivedType>
+    RefCntBorrowedPtr(RefCntAutoPtr<DerivedType>&&) = delete;
+
+    /// Obtains a strong reference to the object
+    RefCntAutoPtr<T> Promote() const noexcept { return RefCntAutoPtr<T>{m_pObject}; }
+
+    T* RawPtr() const noexcept { return m_pObject; }
+
+    template <typename DstType>
+    DstType* RawPtr() const noexcept { return ClassPtrCast<DstType>(m_pObject); }
+
+    operator T*() const noexcept { return m_pObject; }
+    T& operator*() const noexcept { return *m_pObject; }
+    T* operator->() const noexcept { return m_pObject; }
+
+    bool operator!() const noexcept { return m_pObject == nullptr; }
+    explicit operator bool() const noexcept { return m_pObject != nullptr; }
+
+private:
+    T* m_pObject = nullptr;
+};
+
 template <typename DstType, typename SrcType>
 NODISCARD DstType StaticCast(const RefCntAutoPtr<SrcType>& Src)
 {
@@ -50,7 +50,10 @@ public:
     {
         VERIFY(m_ObjectState.load() == ObjectState::Alive, "Attempting to increment strong reference counter for a destroyed or not initialized object!");
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
-        return m_NumStrongReferences.fetch_add(+1) + 1;
+        // The caller already holds a strong reference, so the counter can't reach zero
+        // concurrently and the increment does not need to synchronize with other threads.
+        // Note that QueryObject() increments the counter under the lock and does not use this method.
+        return m_NumStrongReferences.fetch_add(+1, std::memory_order_relaxed) + 1;
     }
 
     template <class TPreObjectDestroy>
@@ -60,7 +63,9 @@ public:
         VERIFY(m_ObjectWrapperBuffer[0] != 0 && m_ObjectWrapperBuffer[1] != 0, "Object wrapper is not initialized");
 
         // Decrement strong reference counter without acquiring the lock.
-        const auto RefCount = m_NumStrongReferences.fetch_add(-1) - 1;
+        // Acquire-release ordering makes all writes to the object by other threads
+        // visible to the thread that destroys it.
+        const auto RefCount = m_NumStrongReferences.fetch_add(-1, std::memory_order_acq_rel) - 1;
         VERIFY(RefCount >= 0, "Inconsistent call to ReleaseStrongRef()");
         if (RefCount == 0)
         {
@@ -78,7 +83,8 @@ public:
 
     inline virtual ReferenceCounterValueType AddWeakRef() override final
     {
-        return m_NumWeakReferences.fetch_add(+1) + 1;
+        // Same as for strong references, the caller holds a reference that keeps the counters alive.
+        return m_NumWeakReferences.fetch_add(+1, std::memory_order_relaxed) + 1;
     }
 
     inline virtual ReferenceCounterValueType ReleaseWeakRef() override final
@@ -696,4 +702,237 @@ private:
 
 #define NEW_RC_OBJ(Allocator, Desc, Type, ...) Diligent::MakeNewRCObj<Type, typename std::remove_reference<decltype(Allocator)>::type>(Allocator, Desc, __FILE__, __LINE__, ##__VA_ARGS__)
 
+
+/// Base class for reference counting objects that keep the reference counter in the object itself
+
+/// Unlike RefCountedObject, AddRef() and Release() update the counter directly instead of
+/// going through a separately allocated reference counters object. This saves one allocation
+/// per object and one indirection on every reference count update. The price is that
+/// intrusive objects
+/// - do not support weak references (RefCntWeakPtr), and
+/// - can't be owners of other objects (MakeNewRCObj with non-null pOwner).
+///
+/// Intrusive objects must be created by MakeNewIntrusiveRCObj (see NEW_INTRUSIVE_RC_OBJ).
+template <typename Base>
+class IntrusiveRefCountedObject : public Base
+{
+public:
+    template <typename... BaseCtorArgTypes>
+    IntrusiveRefCountedObject(BaseCtorArgTypes&&... BaseCtorArgs) noexcept :
+        // clang-format off
+        Base         {std::forward<BaseCtorArgTypes>(BaseCtorArgs)...},
+        m_RefCounters{*this}
+    // clang-format on
+    {
+    }
+
+    virtual ~IntrusiveRefCountedObject()
+    {
+        VERIFY(m_NumReferences.load() == 0, "There remain references to the object being destroyed");
+    }
+
+    /// Returns the reference counters interface that forwards strong references to the object.
+    /// Weak reference methods of the returned interface must not be used.
+    inline virtual IReferenceCounters* DILIGENT_CALL_TYPE GetReferenceCounters() const override final
+    {
+        return &m_RefCounters;
+    }
+
+    inline virtual ReferenceCounterValueType DILIGENT_CALL_TYPE AddRef() override final
+    {
+        VERIFY(m_pDestroy != nullptr, "The object was not created by MakeNewIntrusiveRCObj");
+        // The caller already holds a reference, so the counter can't reach zero concurrently
+        return m_NumReferences.fetch_add(+1, std::memory_order_relaxed) + 1;
+    }
+
+    inline virtual ReferenceCounterValueType DILIGENT_CALL_TYPE Release() override
+    {
+        VERIFY(m_pDestroy != nullptr, "The object was not created by MakeNewIntrusiveRCObj");
+        // Acquire-release ordering makes all writes to the object by other threads
+        // visible to the thread that destroys it.
+        const auto RefCount = m_NumReferences.fetch_add(-1, std::memory_order_acq_rel) - 1;
+        VERIFY(RefCount >= 0, "Inconsistent call to Release()");
+        if (RefCount == 0)
+        {
+            m_pDestroy(this, m_pAllocator);
+        }
+        return RefCount;
+    }
+
+protected:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewIntrusiveRCObj;
+
+    // Operator delete can only be called from MakeNewIntrusiveRCObj if an exception is thrown,
+    // or from Release() when the object is destroyed.
+    // It needs to be protected (not private!) to allow generation of destructors in derived classes
+
+    void operator delete(void* ptr)
+    {
+        free(ptr);
+    }
+
+    template <typename ObjectAllocatorType>
+    void operator delete(void* ptr, ObjectAllocatorType& Allocator, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+    {
+        return Allocator.Free(ptr);
+    }
+
+private:
+    // Operator new is private, and can only be called by MakeNewIntrusiveRCObj
+
+    void* operator new(size_t Size)
+    {
+        return malloc(Size);
+    }
+
+    template <typename ObjectAllocatorType>
+    void* operator new(size_t Size, ObjectAllocatorType& Allocator, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+    {
+        return Allocator.Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+    }
+
+    template <typename ObjectType, typename AllocatorType>
+    void InitIntrusiveRefCounting(AllocatorType* pAllocator)
+    {
+        VERIFY(m_pDestroy == nullptr, "Reference counting has already been initialized");
+        m_pAllocator = pAllocator;
+        m_pDestroy   = [](IntrusiveRefCountedObject* pThis, void* pAllocator) {
+            // It is crucially important that the object is destroyed
+            // through the pointer to the most derived type.
+            ObjectType* pObject = static_cast<ObjectType*>(pThis);
+            if (pAllocator != nullptr)
+            {
+                pObject->~ObjectType();
+                static_cast<AllocatorType*>(pAllocator)->Free(pObject);
+            }
+            else
+            {
+                delete pObject;
+            }
+        };
+    }
+
+    // Reference counters interface returned by GetReferenceCounters()
+    class IntrusiveRefCounters final : public IReferenceCounters
+    {
+    public:
+        explicit IntrusiveRefCounters(IntrusiveRefCountedObject& Object) noexcept :
+            m_Object{Object}
+        {}
+
+        inline virtual ReferenceCounterValueType AddStrongRef() override final
+        {
+            return m_Object.AddRef();
+        }
+
+        inline virtual ReferenceCounterValueType ReleaseStrongRef() override final
+        {
+            return m_Object.Release();
+        }
+
+        inline virtual ReferenceCounterValueType AddWeakRef() override final
+        {
+            UNEXPECTED("Intrusive reference counting objects do not support weak references");
+            return 0;
+        }
+
+        inline virtual ReferenceCounterValueType ReleaseWeakRef() override final
+        {
+            UNEXPECTED("Intrusive reference counting objects do not support weak references");
+            return 0;
+        }
+
+        inline virtual void QueryObject(struct IObject** ppObject) override final
+        {
+            UNEXPECTED("Intrusive reference counting objects do not support weak references");
+        }
+
+        inline virtual ReferenceCounterValueType GetNumStrongRefs() const override final
+        {
+            return m_Object.m_NumReferences.load();
+        }
+
+        inline virtual ReferenceCounterValueType GetNumWeakRefs() const override final
+        {
+            return 0;
+        }
+
+    private:
+        IntrusiveRefCountedObject& m_Object;
+    };
+
+    std::atomic<ReferenceCounterValueType> m_NumReferences{0};
+
+    mutable IntrusiveRefCounters m_RefCounters;
+
+    void* m_pAllocator = nullptr;
+    void (*m_pDestroy)(IntrusiveRefCountedObject* pThis, void* pAllocator) = nullptr;
+};
+
+
+template <typename ObjectType, typename AllocatorType = IMemoryAllocator>
+class MakeNewIntrusiveRCObj
+{
+public:
+    MakeNewIntrusiveRCObj(AllocatorType& Allocator, const Char* Description, const char* FileName, const Int32 LineNumber) noexcept :
+        // clang-format off
+        m_pAllocator{&Allocator}
+#ifdef DILIGENT_DEVELOPMENT
+      , m_dvpDescription{Description}
+      , m_dvpFileName   {FileName   }
+      , m_dvpLineNumber {LineNumber }
+#endif
+    // clang-format on
+    {
+    }
+
+    MakeNewIntrusiveRCObj() noexcept :
+        // clang-format off
+        m_pAllocator    {nullptr}
+#ifdef DILIGENT_DEVELOPMENT
+      , m_dvpDescription{nullptr}
+      , m_dvpFileName   {nullptr}
+      , m_dvpLineNumber {0      }
+#endif
+    // clang-format on
+    {}
+
+    // clang-format off
+    MakeNewIntrusiveRCObj           (const MakeNewIntrusiveRCObj&)  = delete;
+    MakeNewIntrusiveRCObj           (      MakeNewIntrusiveRCObj&&) = delete;
+    MakeNewIntrusiveRCObj& operator=(const MakeNewIntrusiveRCObj&)  = delete;
+    MakeNewIntrusiveRCObj& operator=(      MakeNewIntrusiveRCObj&&) = delete;
+    // clang-format on
+
+    template <typename... CtorArgTypes>
+    ObjectType* operator()(CtorArgTypes&&... CtorArgs)
+    {
+#ifndef DILIGENT_DEVELOPMENT
+        static constexpr const char* m_dvpDescription = "<Unavailable in release build>";
+        static constexpr const char* m_dvpFileName    = "<Unavailable in release build>";
+        static constexpr Int32       m_dvpLineNumber  = -1;
+#endif
+        // Operators new and delete of IntrusiveRefCountedObject are private and only accessible
+        // by methods of MakeNewIntrusiveRCObj. If the constructor throws, the memory is released
+        // by the matching operator delete.
+        ObjectType* pObj = m_pAllocator ?
+            new (*m_pAllocator, m_dvpDescription, m_dvpFileName, m_dvpLineNumber) ObjectType{std::forward<CtorArgTypes>(CtorArgs)...} :
+            new ObjectType{std::forward<CtorArgTypes>(CtorArgs)...};
+        pObj->template InitIntrusiveRefCounting<ObjectType>(m_pAllocator);
+        return pObj;
+    }
+
+private:
+    AllocatorType* const m_pAllocator;
+
+#ifdef DILIGENT_DEVELOPMENT
+    const Char* const m_dvpDescription;
+    const char* const m_dvpFileName;
+    Int32 const       m_dvpLineNumber;
+#endif
+};
+
+#define NEW_INTRUSIVE_RC_OBJ(Allocator, Desc, Type) Diligent::MakeNewIntrusiveRCObj<Type, typename std::remove_reference<decltype(Allocator)>::type>(Allocator, Desc, __FILE__, __LINE__)
+
 } // namespace Diligent
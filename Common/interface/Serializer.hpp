@@ -231,6 +231,22 @@ public:
                         CountType&              Count,
                         ArrayElemSerializerType ElemSerializer);
 
+    /// Serializes an array of trivially serializable elements
+    ///
+    ///  * Measure/Write
+    ///      Writes Count
+    ///      Aligns up current offset to the element alignment
+    ///      Writes Count elements as a single block
+    ///
+    ///  * Read
+    ///      Reads Count
+    ///      Aligns up current offset to the element alignment
+    ///      If Elements is a pointer to const elements and the data in the source
+    ///      buffer is properly aligned, sets Elements to point directly to the data.
+    ///      Otherwise, copies the elements to the memory allocated from Allocator.
+    ///
+    /// \note  The offset is aligned relative to the start of the serialized data, so
+    ///        the source buffer must be aligned for the elements to be read without copying.
     template <typename ElemPtrType, typename CountType>
     bool SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                            ElemPtrType&            Elements,
@@ -482,17 +498,71 @@ bool Serializer<SerializerMode::Read>::SerializeArray(DynamicLinearAllocator* Al
 }
 
 
-template <SerializerMode Mode>
+template <SerializerMode Mode> // Write or Measure
 template <typename ElemPtrType, typename CountType>
 bool Serializer<Mode>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
                                          ElemPtrType&            Elements,
                                          CountType&              Count)
 {
-    return SerializeArray(Allocator, Elements, Count,
-                          [](Serializer<Mode>& Ser, auto& Elem) //
-                          {
-                              return Ser(Elem);
-                          });
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+
+    using ElemType = RawType<decltype(Elements[0])>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Array elements must be trivially serializable");
+    VERIFY_EXPR((Elements != nullptr) == (Count != 0));
+
+    if (!(*this)(Count))
+        return false;
+
+    if (Count == 0)
+        return true;
+
+    AlignOffset(alignof(ElemType));
+    return Copy(Elements, sizeof(ElemType) * static_cast<size_t>(Count));
+}
+
+template <>
+template <typename ElemPtrType, typename CountType>
+bool Serializer<SerializerMode::Read>::SerializeArrayRaw(DynamicLinearAllocator* Allocator,
+                                                         ElemPtrType&            Elements,
+                                                         CountType&              Count)
+{
+    using ElemType = RawType<decltype(Elements[0])>;
+    static_assert(IsTriviallySerializable<ElemType>::value, "Array elements must be trivially serializable");
+    VERIFY_EXPR(Elements == nullptr);
+
+    if (!(*this)(Count))
+        return false;
+
+    if (Count == 0)
+        return true;
+
+    const size_t Offset  = GetSize();
+    const size_t DataPos = AlignUp(Offset, alignof(ElemType));
+    const size_t Size    = sizeof(ElemType) * static_cast<size_t>(Count);
+    if (DataPos - Offset > GetRemainingSize() || Size > GetRemainingSize() - (DataPos - Offset))
+    {
+        UNEXPECTED("Note enough data to read ", Count, " array elements");
+        return false;
+    }
+    m_Ptr = m_Start + DataPos;
+
+    constexpr bool IsConstElem = std::is_const<std::remove_pointer_t<ElemPtrType>>::value;
+    if (IsConstElem && reinterpret_cast<size_t>(m_Ptr) % alignof(ElemType) == 0)
+    {
+        // Reference the data in the source buffer.
+        // const_cast is only needed to compile the non-const branch that is never taken.
+        Elements = const_cast<ElemPtrType>(reinterpret_cast<const ElemType*>(m_Ptr));
+        m_Ptr += Size;
+        return true;
+    }
+
+    VERIFY_EXPR(Allocator != nullptr);
+    auto* pDstElements = Allocator->Allocate<ElemType>(static_cast<size_t>(Count));
+    if (!Copy(pDstElements, Size))
+        return false;
+    Elements = pDstElements;
+
+    return true;
 }
 
 #undef CHECK_REMAINING_SIZE
@@ -0,0 +1,318 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::SmallVector class
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <new>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Vector that stores up to N elements in place and only allocates
+/// memory from the heap when the number of elements exceeds N.
+
+/// The interface follows std::vector, so that the class can be used as a drop-in
+/// replacement in the code that operates on small arrays, e.g. command buffer lists
+/// or queue family indices, that typically contain just a few elements.
+///
+/// \remarks    Unlike std::vector, moving the vector that uses the in-place storage
+///             moves the elements individually, so iterators to the source vector elements are not preserved.
+template <typename T, size_t N>
+class SmallVector
+{
+public:
+    static_assert(N > 0, "The number of in-place elements must not be zero");
+
+    using value_type      = T;
+    using size_type       = size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    SmallVector() noexcept {}
+
+    explicit SmallVector(size_t Count)
+    {
+        resize(Count);
+    }
+
+    SmallVector(size_t Count, const T& Value)
+    {
+        resize(Count, Value);
+    }
+
+    SmallVector(std::initializer_list<T> List)
+    {
+        assign(List.begin(), List.end());
+    }
+
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    SmallVector(InputIt First, InputIt Last)
+    {
+        assign(First, Last);
+    }
+
+    SmallVector(const SmallVector& Other)
+    {
+        assign(Other.begin(), Other.end());
+    }
+
+    SmallVector(SmallVector&& Other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        MoveFrom(std::move(Other));
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        ReleaseHeapStorage();
+    }
+
+    SmallVector& operator=(const SmallVector& Other)
+    {
+        if (this != &Other)
+            assign(Other.begin(), Other.end());
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& Other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &Other)
+        {
+            clear();
+            ReleaseHeapStorage();
+            MoveFrom(std::move(Other));
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> List)
+    {
+        assign(List.begin(), List.end());
+        return *this;
+    }
+
+    template <typename InputIt>
+    void assign(InputIt First, InputIt Last)
+    {
+        clear();
+        reserve(static_cast<size_t>(std::distance(First, Last)));
+        for (; First != Last; ++First)
+            new (m_Data + m_Size++) T(*First);
+    }
+
+    // clang-format off
+    T*       data()       noexcept { return m_Data; }
+    const T* data() const noexcept { return m_Data; }
+
+    iterator       begin()       noexcept { return m_Data; }
+    const_iterator begin() const noexcept { return m_Data; }
+    iterator       end()         noexcept { return m_Data + m_Size; }
+    const_iterator end()   const noexcept { return m_Data + m_Size; }
+
+    size_t size()     const noexcept { return m_Size; }
+    size_t capacity() const noexcept { return m_Capacity; }
+    bool   empty()    const noexcept { return m_Size == 0; }
+    // clang-format on
+
+    /// Returns true if the elements are stored in place, i.e. no heap memory is used.
+    bool IsUsingInplaceStorage() const noexcept
+    {
+        return m_Data == InplaceData();
+    }
+
+    T& operator[](size_t Idx)
+    {
+        VERIFY(Idx < m_Size, "Index (", Idx, ") is out of range (", m_Size, ")");
+        return m_Data[Idx];
+    }
+    const T& operator[](size_t Idx) const
+    {
+        VERIFY(Idx < m_Size, "Index (", Idx, ") is out of range (", m_Size, ")");
+        return m_Data[Idx];
+    }
+
+    T& front()
+    {
+        VERIFY_EXPR(!empty());
+        return m_Data[0];
+    }
+    const T& front() const
+    {
+        VERIFY_EXPR(!empty());
+        return m_Data[0];
+    }
+
+    T& back()
+    {
+        VERIFY_EXPR(!empty());
+        return m_Data[m_Size - 1];
+    }
+    const T& back() const
+    {
+        VERIFY_EXPR(!empty());
+        return m_Data[m_Size - 1];
+    }
+
+    void reserve(size_t NewCapacity)
+    {
+        if (NewCapacity <= m_Capacity)
+            return;
+
+        T* pNewData = static_cast<T*>(DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(sizeof(T) * NewCapacity, alignof(T), "SmallVector storage", __FILE__, __LINE__));
+        for (size_t i = 0; i < m_Size; ++i)
+        {
+            new (pNewData + i) T(std::move(m_Data[i]));
+            m_Data[i].~T();
+        }
+        ReleaseHeapStorage();
+
+        m_Data     = pNewData;
+        m_Capacity = NewCapacity;
+    }
+
+    template <typename... ArgsType>
+    T& emplace_back(ArgsType&&... Args)
+    {
+        if (m_Size == m_Capacity)
+            reserve(m_Capacity * 2);
+        T* pElem = new (m_Data + m_Size) T(std::forward<ArgsType>(Args)...);
+        ++m_Size;
+        return *pElem;
+    }
+
+    void push_back(const T& Value)
+    {
+        emplace_back(Value);
+    }
+
+    void push_back(T&& Value)
+    {
+        emplace_back(std::move(Value));
+    }
+
+    void pop_back()
+    {
+        VERIFY_EXPR(!empty());
+        m_Data[--m_Size].~T();
+    }
+
+    void resize(size_t NewSize)
+    {
+        ResizeImpl(NewSize);
+    }
+
+    void resize(size_t NewSize, const T& Value)
+    {
+        ResizeImpl(NewSize, Value);
+    }
+
+    /// Destroys all elements. The capacity is not changed.
+    void clear() noexcept
+    {
+        for (size_t i = 0; i < m_Size; ++i)
+            m_Data[i].~T();
+        m_Size = 0;
+    }
+
+private:
+    T* InplaceData() noexcept
+    {
+        return reinterpret_cast<T*>(m_InplaceStorage);
+    }
+    const T* InplaceData() const noexcept
+    {
+        return reinterpret_cast<const T*>(m_InplaceStorage);
+    }
+
+    template <typename... ArgsType>
+    void ResizeImpl(size_t NewSize, const ArgsType&... Args)
+    {
+        if (NewSize > m_Capacity)
+            reserve(std::max(NewSize, m_Capacity * 2));
+
+        while (m_Size > NewSize)
+            m_Data[--m_Size].~T();
+        while (m_Size < NewSize)
+            new (m_Data + m_Size++) T(Args...);
+    }
+
+    void MoveFrom(SmallVector&& Other)
+    {
+        if (Other.IsUsingInplaceStorage())
+        {
+            for (size_t i = 0; i < Other.m_Size; ++i)
+                new (m_Data + i) T(std::move(Other.m_Data[i]));
+            m_Size = Other.m_Size;
+            Other.clear();
+        }
+        else
+        {
+            // Take over the heap storage
+            m_Data     = Other.m_Data;
+            m_Size     = Other.m_Size;
+            m_Capacity = Other.m_Capacity;
+
+            Other.m_Data     = Other.InplaceData();
+            Other.m_Size     = 0;
+            Other.m_Capacity = N;
+        }
+    }
+
+    void ReleaseHeapStorage()
+    {
+        if (!IsUsingInplaceStorage())
+        {
+            DefaultRawMemoryAllocator::GetAllocator().FreeAligned(m_Data);
+            m_Data     = InplaceData();
+            m_Capacity = N;
+        }
+    }
+
+private:
+    T*     m_Data     = InplaceData();
+    size_t m_Size     = 0;
+    size_t m_Capacity = N;
+
+    alignas(T) Uint8 m_InplaceStorage[sizeof(T) * N];
+};
+
+} // namespace Diligent
@@ -28,6 +28,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <cstdint>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -94,4 +95,77 @@ private:
 
 using SpinLockGuard = std::lock_guard<SpinLock>;
 
+
+/// Lock that spins with exponential backoff for a short time and then
+/// parks the waiting thread in the OS until the lock is released.
+///
+/// \remarks   Unlike SpinLock, waiting threads do not consume CPU time when the lock
+///             is held for a long time or when the system is oversubscribed.
+///             Use SpinLock for very short critical sections and AdaptiveLock
+///             for critical sections that may take longer (e.g. ones that allocate
+///             memory or create objects).
+///
+///             Threads are parked on a futex on Linux and Android, with WaitOnAddress
+///             on Windows, and on a shared parking lot on other platforms.
+class AdaptiveLock
+{
+public:
+    AdaptiveLock() noexcept {}
+
+    // clang-format off
+    AdaptiveLock             (const AdaptiveLock&)  = delete;
+    AdaptiveLock& operator = (const AdaptiveLock&)  = delete;
+    AdaptiveLock             (      AdaptiveLock&&) = delete;
+    AdaptiveLock& operator = (      AdaptiveLock&&) = delete;
+    // clang-format on
+
+    void lock() noexcept
+    {
+        // Assume that lock is free on the first try.
+        StateType Expected = Unlocked;
+        if (m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+
+        LockContended();
+    }
+
+    bool try_lock() noexcept
+    {
+        if (is_locked())
+            return false;
+
+        StateType Expected = Unlocked;
+        return m_State.compare_exchange_strong(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void unlock() noexcept
+    {
+        VERIFY(is_locked(), "Attempting to unlock an adaptive lock that is not locked. This is a strong indication of a flawed logic.");
+        if (m_State.exchange(Unlocked, std::memory_order_release) == LockedWithWaiters)
+            WakeOne();
+    }
+
+    bool is_locked() const noexcept
+    {
+        return m_State.load(std::memory_order_relaxed) != Unlocked;
+    }
+
+private:
+    void LockContended() noexcept;
+    void Park() noexcept;
+    void WakeOne() noexcept;
+
+private:
+    // 32-bit state is required by futex and is natively supported by WaitOnAddress.
+    using StateType = uint32_t;
+
+    static constexpr StateType Unlocked          = 0;
+    static constexpr StateType Locked            = 1;
+    static constexpr StateType LockedWithWaiters = 2;
+
+    std::atomic<StateType> m_State{Unlocked};
+};
+
+using AdaptiveLockGuard = std::lock_guard<AdaptiveLock>;
+
 } // namespace Threading
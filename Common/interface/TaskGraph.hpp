@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::TaskGraph class
+
+#include <vector>
+#include <functional>
+
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// A simple task graph that executes a set of tasks with dependencies using the thread pool.
+
+/// The graph is built by adding tasks with AddTask() and defining dependencies with
+/// AddDependency(). Execute() then enqueues all tasks into the thread pool in the
+/// topological order. A task is started only after all its prerequisites are complete.
+///
+/// \remarks    The class is not thread-safe: the graph must be built and executed
+///             from one thread. The tasks themselves may run concurrently.
+class TaskGraph
+{
+public:
+    using NodeId = Uint32;
+
+    /// Task handler function. The argument is the id of the thread that runs the task.
+    using HandlerType = std::function<void(Uint32)>;
+
+    static constexpr NodeId InvalidNodeId = ~NodeId{0};
+
+    TaskGraph() = default;
+
+    // clang-format off
+    TaskGraph           (const TaskGraph&)  = delete;
+    TaskGraph& operator=(const TaskGraph&)  = delete;
+    TaskGraph           (TaskGraph&&)       = default;
+    TaskGraph& operator=(TaskGraph&&)       = default;
+    // clang-format on
+
+    /// Adds a task to the graph and returns its id.
+    NodeId AddTask(HandlerType Handler, float fPriority = 0);
+
+    /// Makes the task wait for the prerequisite task to complete.
+    void AddDependency(NodeId Task, NodeId Prerequisite);
+
+    /// Enqueues all tasks of the graph into the thread pool.
+
+    /// \param [in] pThreadPool - Thread pool to use. If null, the tasks are
+    ///                           executed serially by the calling thread.
+    /// \return     true if the tasks were successfully enqueued, and false otherwise
+    ///             (e.g. if the graph contains a cycle or has already been executed).
+    ///
+    /// \remarks    The function does not wait for the tasks to complete.
+    ///             Use WaitForCompletion() or IsFinished() to check the status.
+    bool Execute(IThreadPool* pThreadPool);
+
+    /// Waits until all tasks of the graph are finished.
+    void WaitForCompletion() const;
+
+    /// Returns true if all tasks of the graph are finished.
+    bool IsFinished() const;
+
+    /// Returns the number of tasks in the graph.
+    Uint32 GetNumTasks() const { return static_cast<Uint32>(m_Nodes.size()); }
+
+private:
+    struct Node
+    {
+        HandlerType Handler;
+        float       fPriority = 0;
+
+        std::vector<NodeId> Prerequisites;
+
+        RefCntAutoPtr<IAsyncTask> pTask;
+    };
+
+    // Returns the nodes in topological order, or an empty vector if the graph has a cycle.
+    std::vector<NodeId> SortNodes() const;
+
+    std::vector<Node> m_Nodes;
+
+    bool m_Executed = false;
+};
+
+} // namespace Diligent
@@ -167,6 +167,10 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     ///
     /// \remarks    Thread pool will keep a strong reference to the task,
     ///             so an application is free to release it after enqueuing.
+    ///
+    ///             If the prerequisites have been enqueued into the same thread pool,
+    ///             the task is not added to the run queue until the last of them is finished.
+    ///             Other prerequisites are checked every time the task is dequeued.
     /// 
     /// \note       An application must ensure that the task prerequisites are not circular
     ///             to avoid deadlocks.
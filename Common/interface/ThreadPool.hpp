@@ -31,6 +31,8 @@
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <memory>
+#include <algorithm>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -40,6 +42,49 @@
 namespace Diligent
 {
 
+/// Thread pool task scheduler type
+enum THREAD_POOL_SCHEDULER : Uint8
+{
+    /// All worker threads share a single priority queue protected by a mutex.
+    /// Tasks are strictly ordered by their priority.
+    THREAD_POOL_SCHEDULER_PRIORITY_QUEUE = 0,
+
+    /// Every worker thread owns a task queue. Idle workers steal tasks from
+    /// the queues of other workers.
+    ///
+    /// \remarks    Task priorities are quantized into coarse buckets (see
+    ///             ThreadPoolCreateInfo::NumPriorityBuckets). Tasks in higher buckets
+    ///             are always started first, but tasks within the same bucket are
+    ///             processed in FIFO order regardless of their exact priorities.
+    ///
+    ///             This scheduler significantly reduces the lock contention
+    ///             when many worker threads process a large number of short tasks.
+    THREAD_POOL_SCHEDULER_WORK_STEALING,
+
+    THREAD_POOL_SCHEDULER_COUNT
+};
+
+/// Defines which CPU cores the thread pool worker threads are allowed to run on.
+enum THREAD_POOL_CORE_POLICY : Uint8
+{
+    /// Worker threads may run on any core.
+    THREAD_POOL_CORE_POLICY_ANY = 0,
+
+    /// Worker threads are restricted to performance cores.
+    /// Use this policy for time-critical work such as shader and PSO compilation.
+    THREAD_POOL_CORE_POLICY_PERFORMANCE,
+
+    /// Worker threads are restricted to efficiency cores.
+    /// Use this policy for background work such as asset streaming.
+    THREAD_POOL_CORE_POLICY_EFFICIENCY,
+
+    /// Worker threads are restricted to one logical core of every physical core,
+    /// so that they do not compete with each other for SMT sibling resources.
+    THREAD_POOL_CORE_POLICY_PHYSICAL,
+
+    THREAD_POOL_CORE_POLICY_COUNT
+};
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -58,10 +103,41 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Task scheduler type, see Diligent::THREAD_POOL_SCHEDULER.
+    THREAD_POOL_SCHEDULER Scheduler = THREAD_POOL_SCHEDULER_PRIORITY_QUEUE;
+
+    /// The number of priority buckets used by the work-stealing scheduler.
+
+    /// \remarks    Task priority P is mapped to bucket floor(P) clamped to the
+    ///             [0, NumPriorityBuckets-1] range, so tasks with
+    ///             priorities below 1 go to bucket 0, tasks with priorities in the [1, 2)
+    ///             range go to bucket 1 and so on.
+    ///             The value is clamped to the [1, 32] range.
+    ///
+    ///             This member is ignored by the priority-queue scheduler.
+    Uint32 NumPriorityBuckets = 4;
+
+    /// Core policy, see Diligent::THREAD_POOL_CORE_POLICY.
+
+    /// \remarks   The affinity of every worker thread is set to the cores selected by the policy
+    ///             before OnThreadStarted is called, so the callback may further restrict it
+    ///             (e.g. with PinWorkerThread()).
+    ///
+    ///             If the platform can't tell the requested cores apart (e.g. the CPU is not hybrid
+    ///             or the platform does not support affinity masks), worker threads are not restricted.
+    THREAD_POOL_CORE_POLICY CorePolicy = THREAD_POOL_CORE_POLICY_ANY;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
 
+/// Returns the affinity mask of the cores selected by the core policy,
+/// or 0 if worker threads should not be restricted.
+///
+/// \remarks    The mask can be passed to PinWorkerThread() to pin every worker thread
+///             to a single core of the set.
+Uint64 GetThreadPoolCoresMask(THREAD_POOL_CORE_POLICY Policy);
+
 /// Pins the worker thread to one of the allowed cores.
 ///
 /// \param ThreadId         - The thread ID.
@@ -223,4 +299,93 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+
+/// Calls Handler(Idx) for every index in the [StartIdx, EndIdx) range using the thread pool.
+
+/// \param [in] pThreadPool    - Thread pool to use. If null, all items are processed by the calling thread.
+/// \param [in] StartIdx       - The first index of the range.
+/// \param [in] EndIdx         - The index past the last index of the range.
+/// \param [in] GrainSize      - The number of consecutive items processed by one thread at a time.
+///                              Larger values reduce the scheduling overhead, while smaller
+///                              values improve the load balancing.
+/// \param [in] Handler        - The function that processes one item: void(Uint32 Idx).
+///                              The function is called concurrently from multiple threads.
+/// \param [in] MaxConcurrency - The maximum number of threads, including the calling thread,
+///                              that process the range. If zero, the number of hardware threads is used.
+/// \param [in] fPriority      - Priority of the worker tasks.
+///
+/// \remarks    The function blocks until all items are processed.
+///
+///             The range is split into chunks of GrainSize items. The function enqueues at most
+///             MaxConcurrency-1 tasks that, together with the calling thread, keep taking the next
+///             chunk until the range is exhausted, so there is no task allocation per item.
+///
+///             Since the calling thread also processes the chunks, the function can be safely
+///             called from the worker thread of the same pool as well as for a pool with no threads.
+template <typename HandlerType>
+void ParallelFor(IThreadPool* pThreadPool,
+                 Uint32       StartIdx,
+                 Uint32       EndIdx,
+                 Uint32       GrainSize,
+                 HandlerType  Handler,
+                 Uint32       MaxConcurrency = 0,
+                 float        fPriority      = 0)
+{
+    if (EndIdx <= StartIdx)
+        return;
+
+    GrainSize              = (std::max)(GrainSize, 1u);
+    const Uint32 NumChunks = (EndIdx - StartIdx - 1) / GrainSize + 1;
+
+    if (MaxConcurrency == 0)
+        MaxConcurrency = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+    const Uint32 NumWorkerTasks = pThreadPool != nullptr ? (std::min)(NumChunks, MaxConcurrency) - 1 : 0;
+    if (NumWorkerTasks == 0)
+    {
+        for (Uint32 Idx = StartIdx; Idx < EndIdx; ++Idx)
+            Handler(Idx);
+        return;
+    }
+
+    struct SharedState
+    {
+        std::atomic<Uint32> NextChunk{0};
+        std::atomic<Uint32> NumChunksDone{0};
+    };
+    // Worker tasks may start after the function returns, so the state must be kept alive by the tasks.
+    auto pState = std::make_shared<SharedState>();
+
+    // NB: the handler is only accessed after a chunk has been claimed. Since the function does not
+    //     return until all chunks are processed, the handler is never accessed after it is destroyed.
+    auto ProcessChunks = [StartIdx, EndIdx, GrainSize, NumChunks, &Handler](SharedState& State) {
+        for (Uint32 Chunk = State.NextChunk.fetch_add(1); Chunk < NumChunks; Chunk = State.NextChunk.fetch_add(1))
+        {
+            const Uint32 ChunkStart = StartIdx + Chunk * GrainSize;
+            const Uint32 ChunkEnd   = ChunkStart + (std::min)(GrainSize, EndIdx - ChunkStart);
+            for (Uint32 Idx = ChunkStart; Idx < ChunkEnd; ++Idx)
+                Handler(Idx);
+
+            State.NumChunksDone.fetch_add(1);
+        }
+    };
+
+    for (Uint32 i = 0; i < NumWorkerTasks; ++i)
+    {
+        EnqueueAsyncWork(
+            pThreadPool,
+            [pState, ProcessChunks](Uint32 ThreadId) {
+                ProcessChunks(*pState);
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            fPriority);
+    }
+
+    ProcessChunks(*pState);
+
+    // Wait for the chunks that are being processed by other threads
+    while (pState->NumChunksDone.load() < NumChunks)
+        std::this_thread::yield();
+}
+
 } // namespace Diligent
@@ -0,0 +1,167 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::TrackingMemoryAllocator class
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "UniqueIdentifier.hpp"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+/// Raw memory allocator that tracks live memory and allocation rate per allocation description.
+
+/// The allocator forwards all requests to the base allocator and prepends every block with
+/// a small header that references the counters of the allocation description, i.e. the
+/// dbgDescription argument that the engine sets for every allocation. The counters are updated
+/// with relaxed atomic operations, and descriptions are looked up in a small per-thread cache,
+/// so that the allocator is cheap enough to be used in release builds.
+///
+/// The allocator can be passed to the engine through EngineCreateInfo::pRawMemAllocator.
+/// It must outlive all objects created by the engine.
+///
+/// \remarks    Descriptions are identified by the string pointer. Statistics of different
+///             pointers to the same string are merged when they are reported.
+class TrackingMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    explicit TrackingMemoryAllocator(IMemoryAllocator& BaseAllocator);
+    ~TrackingMemoryAllocator();
+
+    // clang-format off
+    TrackingMemoryAllocator           (const TrackingMemoryAllocator&)  = delete;
+    TrackingMemoryAllocator           (      TrackingMemoryAllocator&&) = delete;
+    TrackingMemoryAllocator& operator=(const TrackingMemoryAllocator&)  = delete;
+    TrackingMemoryAllocator& operator=(      TrackingMemoryAllocator&&) = delete;
+    // clang-format on
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override;
+
+    /// Allocation statistics for one allocation description.
+    struct DescriptionStats
+    {
+        /// Allocation description, e.g. "Raw memory for DynamicLinearAllocator".
+        std::string Description;
+
+        /// The number of bytes that are currently allocated.
+        Uint64 LiveSize = 0;
+
+        /// The number of allocations that have not been released yet.
+        Uint64 NumLiveAllocations = 0;
+
+        /// The total number of allocations made since the allocator was created.
+        Uint64 NumAllocations = 0;
+
+        /// The total number of bytes allocated since the allocator was created.
+        Uint64 TotalSize = 0;
+
+        /// The number of allocations made since the last StartInterval() call.
+        Uint64 NumIntervalAllocations = 0;
+
+        /// The number of bytes allocated since the last StartInterval() call.
+        Uint64 IntervalSize = 0;
+
+        /// The number of allocations per second since the last StartInterval() call.
+        double AllocationRate = 0;
+    };
+
+    /// Returns the statistics for all descriptions that were ever used.
+    std::vector<DescriptionStats> GetStats() const;
+
+    /// Resets the interval counters that are used to compute the allocation rate.
+
+    /// \remarks    To find allocation churn in steady-state frames, call this method
+    ///             at the start of the measured period, e.g. a number of frames, and
+    ///             GetStats() or GetReport() at the end.
+    void StartInterval();
+
+    /// Report sort order
+    enum class ReportSortOrder
+    {
+        /// Sort by the live size, in descending order.
+        LiveSize,
+
+        /// Sort by the number of allocations in the current interval, in descending order.
+        AllocationRate
+    };
+
+    /// Returns a human-readable report of the statistics sorted in the specified order.
+    std::string GetReport(ReportSortOrder SortOrder = ReportSortOrder::LiveSize) const;
+
+public:
+    // Implementation details used by the per-thread description cache
+    struct DescCounters
+    {
+        std::atomic<Int64>  LiveSize{0};
+        std::atomic<Int64>  NumLiveAllocations{0};
+        std::atomic<Uint64> NumAllocations{0};
+        std::atomic<Uint64> TotalSize{0};
+        std::atomic<Uint64> NumIntervalAllocations{0};
+        std::atomic<Uint64> IntervalSize{0};
+    };
+
+private:
+    // Returns the counters of the description using the per-thread cache
+    DescCounters& GetCounters(const Char* dbgDescription);
+
+    // Finds or creates the counters of the description
+    DescCounters& FindCounters(const Char* dbgDescription);
+
+    void* TrackAllocation(void* pBlock, size_t Offset, size_t Size, const Char* dbgDescription);
+
+    IMemoryAllocator& m_BaseAllocator;
+
+    // Identifies the allocator in the per-thread cache
+    const UniqueIdHelper<TrackingMemoryAllocator> m_ID;
+
+    mutable std::mutex                                             m_CountersMtx;
+    std::unordered_map<const Char*, std::unique_ptr<DescCounters>> m_Counters;
+    Timer                                                          m_IntervalTimer;
+};
+
+} // namespace Diligent
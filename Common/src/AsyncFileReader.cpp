@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AsyncFileReader.hpp"
+
+#include <algorithm>
+
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "DebugUtilities.hpp"
+#include "Cast.hpp"
+
+namespace Diligent
+{
+
+AsyncFileReader::ReadRequest::ReadRequest(IReferenceCounters*    pRefCounters,
+                                          AsyncFileReader&       Reader,
+                                          const Char*            FilePath,
+                                          Uint64                 Offset,
+                                          Uint64                 Size,
+                                          CompletionCallbackType Callback,
+                                          float                  fPriority) :
+    AsyncTaskBase{pRefCounters, fPriority},
+    m_Reader{Reader},
+    m_FilePath{FilePath},
+    m_Offset{Offset},
+    m_Size{Size},
+    m_Callback{std::move(Callback)}
+{
+}
+
+static bool ReadRegion(const char* FilePath, Uint64 Offset, Uint64 Size, IDataBlob** ppData)
+{
+    FileWrapper File{FilePath};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "'");
+        return false;
+    }
+
+    const Uint64 FileSize = File->GetSize();
+    if (Offset > FileSize || Size > FileSize - Offset)
+    {
+        LOG_ERROR_MESSAGE("Region [", Offset, ", ", Offset + Size, ") exceeds the size of file '", FilePath, "' (", FileSize, ")");
+        return false;
+    }
+
+    auto pData = DataBlobImpl::Create(StaticCast<size_t>(Size));
+    if (!File->SetPos(StaticCast<size_t>(Offset), FilePosOrigin::Start) ||
+        !File->Read(pData->GetDataPtr(), pData->GetSize()))
+    {
+        LOG_ERROR_MESSAGE("Failed to read region [", Offset, ", ", Offset + Size, ") of file '", FilePath, "'");
+        return false;
+    }
+
+    *ppData = pData.Detach();
+    return true;
+}
+
+ASYNC_TASK_STATUS AsyncFileReader::ReadRequest::Run(Uint32 ThreadId)
+{
+    ASYNC_TASK_STATUS Status = ASYNC_TASK_STATUS_CANCELLED;
+    if (!m_bSafelyCancel.load())
+    {
+        const bool Succeeded = m_Size == WholeFile ?
+            FileWrapper::ReadWholeFile(m_FilePath.c_str(), &m_pData) :
+            ReadRegion(m_FilePath.c_str(), m_Offset, m_Size, &m_pData);
+        if (Succeeded)
+            Status = ASYNC_TASK_STATUS_COMPLETE;
+        else
+            m_pData.Release();
+
+        m_DataReady.store(true);
+
+        if (m_Callback)
+            m_Callback(m_FilePath.c_str(), m_pData);
+    }
+
+    // The reader may be destroyed as soon as the request is finished
+    m_Reader.OnRequestFinished();
+
+    return Status;
+}
+
+
+AsyncFileReader::AsyncFileReader(const CreateInfo& CI) :
+    m_pThreadPool{CI.pThreadPool}
+{
+    if (!m_pThreadPool)
+    {
+        ThreadPoolCreateInfo ThreadPoolCI;
+        ThreadPoolCI.NumThreads = std::max(CI.NumThreads, 1u);
+        m_pThreadPool           = CreateThreadPool(ThreadPoolCI);
+    }
+    VERIFY_EXPR(m_pThreadPool);
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+    WaitForIdle();
+}
+
+RefCntAutoPtr<AsyncFileReader::ReadRequest> AsyncFileReader::ReadFile(const Char*            FilePath,
+                                                                      CompletionCallbackType Callback,
+                                                                      float                  fPriority)
+{
+    return EnqueueRequest(FilePath, 0, WholeFile, std::move(Callback), fPriority);
+}
+
+RefCntAutoPtr<AsyncFileReader::ReadRequest> AsyncFileReader::ReadFileRegion(const Char*            FilePath,
+                                                                            Uint64                 Offset,
+                                                                            Uint64                 Size,
+                                                                            CompletionCallbackType Callback,
+                                                                            float                  fPriority)
+{
+    if (Size == 0 || Size == WholeFile)
+    {
+        DEV_ERROR("Invalid region size");
+        return {};
+    }
+    return EnqueueRequest(FilePath, Offset, Size, std::move(Callback), fPriority);
+}
+
+RefCntAutoPtr<AsyncFileReader::ReadRequest> AsyncFileReader::EnqueueRequest(const Char*            FilePath,
+                                                                            Uint64                 Offset,
+                                                                            Uint64                 Size,
+                                                                            CompletionCallbackType Callback,
+                                                                            float                  fPriority)
+{
+    if (FilePath == nullptr)
+    {
+        DEV_ERROR("File path must not be null");
+        return {};
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_PendingRequestsMtx};
+        ++m_NumPendingRequests;
+    }
+
+    RefCntAutoPtr<ReadRequest> pRequest{MakeNewRCObj<ReadRequest>()(*this, FilePath, Offset, Size, std::move(Callback), fPriority)};
+    m_pThreadPool->EnqueueTask(pRequest);
+
+    return pRequest;
+}
+
+void AsyncFileReader::OnRequestFinished()
+{
+    // Notify while holding the lock as the reader may be destroyed
+    // as soon as the waiting thread sees no pending requests.
+    std::lock_guard<std::mutex> Lock{m_PendingRequestsMtx};
+    VERIFY_EXPR(m_NumPendingRequests > 0);
+    --m_NumPendingRequests;
+    m_PendingRequestsCV.notify_all();
+}
+
+void AsyncFileReader::WaitForIdle()
+{
+    std::unique_lock<std::mutex> Lock{m_PendingRequestsMtx};
+    m_PendingRequestsCV.wait(Lock, [this]() { return m_NumPendingRequests == 0; });
+}
+
+Uint32 AsyncFileReader::GetNumPendingRequests()
+{
+    std::lock_guard<std::mutex> Lock{m_PendingRequestsMtx};
+    return m_NumPendingRequests;
+}
+
+} // namespace Diligent
@@ -27,6 +27,7 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -171,16 +172,32 @@ static size_t AdjustBlockSize(size_t BlockSize)
 
 FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemoryAllocator,
                                                      size_t            BlockSize,
-                                                     Uint32            NumBlocksInPage) :
+                                                     Uint32            NumBlocksInPage,
+                                                     Uint32            ThreadCacheSize) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
     m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_NumBlocksInPage   {NumBlocksInPage           },
+    m_ThreadCacheSize   {ThreadCacheSize           },
+    m_NumThreadCaches   {ThreadCacheSize > 0 ? NumThreadCaches : 0},
+    m_CachedBlocks      (size_t{m_NumThreadCaches} * ThreadCacheSize, STD_ALLOCATOR_RAW_MEM(void*, RawMemoryAllocator, "Allocator for vector<void*>"))
+#ifdef DILIGENT_DEBUG
+  , m_dbgCachedBlocks   (STD_ALLOCATOR_RAW_MEM(void*, RawMemoryAllocator, "Allocator for unordered_set<void*>"))
+#endif
 // clang-format on
 {
+    if (m_NumThreadCaches > 0)
+    {
+        void* pCachesMem = m_RawMemoryAllocator.AllocateAligned(sizeof(ThreadCache) * m_NumThreadCaches, alignof(ThreadCache),
+                                                                "FixedBlockMemoryAllocator thread caches", __FILE__, __LINE__);
+        m_ThreadCaches   = static_cast<ThreadCache*>(pCachesMem);
+        for (Uint32 i = 0; i < m_NumThreadCaches; ++i)
+            new (m_ThreadCaches + i) ThreadCache{};
+    }
+
     // Allocate one page
     if (m_BlockSize > 0)
     {
@@ -190,7 +207,16 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    FlushThreadCaches();
+    if (m_ThreadCaches != nullptr)
+    {
+        for (Uint32 i = 0; i < m_NumThreadCaches; ++i)
+            m_ThreadCaches[i].~ThreadCache();
+        m_RawMemoryAllocator.FreeAligned(m_ThreadCaches);
+    }
+
 #ifdef DILIGENT_DEBUG
+    VERIFY(m_dbgCachedBlocks.empty(), "All cached blocks must have been returned to the pages");
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
         VERIFY(!m_PagePool[p].HasAllocations(), "Memory leak detected: memory page has allocated block");
@@ -207,15 +233,8 @@ void FixedBlockMemoryAllocator::CreateNewPage()
     m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
 }
 
-void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+void* FixedBlockMemoryAllocator::AllocateFromPages()
 {
-    VERIFY_EXPR(Size > 0);
-
-    Size = AdjustBlockSize(Size);
-    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
-
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-
     if (m_AvailablePages.empty())
     {
         CreateNewPage();
@@ -233,10 +252,9 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     return Ptr;
 }
 
-void FixedBlockMemoryAllocator::Free(void* Ptr)
+void FixedBlockMemoryAllocator::FreeToPages(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
+    auto PageIdIt = m_AddrToPageId.find(Ptr);
     if (PageIdIt != m_AddrToPageId.end())
     {
         auto PageId = PageIdIt->second;
@@ -259,6 +277,153 @@ void FixedBlockMemoryAllocator::Free(void* Ptr)
     }
 }
 
+void FixedBlockMemoryAllocator::FreeCachedBlockToPages(void* Ptr)
+{
+#ifdef DILIGENT_DEBUG
+    VERIFY(m_dbgCachedBlocks.erase(Ptr) == 1, "The block is not in the thread caches");
+#endif
+    FreeToPages(Ptr);
+}
+
+static Uint32 GetThreadCacheIndex()
+{
+    // Assign caches to threads in round-robin fashion so that
+    // a small number of threads never share the same cache.
+    static std::atomic<Uint32> NextThreadIdx{0};
+    static thread_local Uint32 ThreadIdx = NextThreadIdx.fetch_add(1);
+    return ThreadIdx;
+}
+
+void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+
+    Size = AdjustBlockSize(Size);
+    VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
+
+    if (m_ThreadCacheSize == 0)
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        return AllocateFromPages();
+    }
+
+    const Uint32 CacheIdx = GetThreadCacheIndex() % NumThreadCaches;
+    ThreadCache& Cache    = m_ThreadCaches[CacheIdx];
+    void**       Blocks   = &m_CachedBlocks[size_t{CacheIdx} * m_ThreadCacheSize];
+
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+    if (Cache.NumBlocks == 0)
+    {
+        // Refill the cache with half of its capacity so that allocations and
+        // deallocations alternating at the boundary do not hit the shared pages every time.
+        const Uint32 BatchSize = std::max(m_ThreadCacheSize / 2, 1u);
+
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        // Store the blocks in reverse order so that they are allocated in the page order
+        for (Uint32 i = 0; i < BatchSize; ++i)
+        {
+            void* Ptr = AllocateFromPages();
+#ifdef DILIGENT_DEBUG
+            m_dbgCachedBlocks.insert(Ptr);
+#endif
+            Blocks[BatchSize - 1 - i] = Ptr;
+        }
+        Cache.NumBlocks = BatchSize;
+        ++Cache.NumMisses;
+    }
+    else
+    {
+        ++Cache.NumHits;
+    }
+
+    void* Ptr = Blocks[--Cache.NumBlocks];
+#ifdef DILIGENT_DEBUG
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        m_dbgCachedBlocks.erase(Ptr);
+    }
+#endif
+    FillWithDebugPattern(Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
+    return Ptr;
+}
+
+void FixedBlockMemoryAllocator::Free(void* Ptr)
+{
+    if (m_ThreadCacheSize == 0)
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        FreeToPages(Ptr);
+        return;
+    }
+
+    const Uint32 CacheIdx = GetThreadCacheIndex() % NumThreadCaches;
+    ThreadCache& Cache    = m_ThreadCaches[CacheIdx];
+    void**       Blocks   = &m_CachedBlocks[size_t{CacheIdx} * m_ThreadCacheSize];
+
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+#ifdef DILIGENT_DEBUG
+    {
+        // Cached blocks bypass FreeToPages(), so perform the same ownership check here.
+        // The check also catches blocks that are already held by any of the thread caches.
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        if (m_AddrToPageId.find(Ptr) == m_AddrToPageId.end())
+            UNEXPECTED("Address not found in the allocations list - the block was not allocated by this allocator?");
+        else if (!m_dbgCachedBlocks.insert(Ptr).second)
+            UNEXPECTED("The block is already in a thread cache - double freeing memory?");
+    }
+#endif
+
+    if (Cache.NumBlocks == m_ThreadCacheSize)
+    {
+        // Return the oldest half of the cache to the pages and keep the recently released blocks
+        const Uint32 BatchSize = std::max(m_ThreadCacheSize / 2, 1u);
+
+        {
+            std::lock_guard<std::mutex> LockGuard(m_Mutex);
+            for (Uint32 i = 0; i < BatchSize; ++i)
+                FreeCachedBlockToPages(Blocks[i]);
+        }
+        Cache.NumBlocks -= BatchSize;
+        memmove(Blocks, Blocks + BatchSize, Cache.NumBlocks * sizeof(void*));
+        ++Cache.NumMisses;
+    }
+    else
+    {
+        ++Cache.NumHits;
+    }
+
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+    Blocks[Cache.NumBlocks++] = Ptr;
+}
+
+FixedBlockMemoryAllocator::ThreadCacheStats FixedBlockMemoryAllocator::GetThreadCacheStats()
+{
+    ThreadCacheStats Stats;
+    for (Uint32 CacheIdx = 0; CacheIdx < m_NumThreadCaches; ++CacheIdx)
+    {
+        ThreadCache& Cache = m_ThreadCaches[CacheIdx];
+        Threading::SpinLockGuard CacheGuard{Cache.Lock};
+        Stats.NumHits += Cache.NumHits;
+        Stats.NumMisses += Cache.NumMisses;
+    }
+    return Stats;
+}
+
+void FixedBlockMemoryAllocator::FlushThreadCaches()
+{
+    for (Uint32 CacheIdx = 0; CacheIdx < m_NumThreadCaches; ++CacheIdx)
+    {
+        ThreadCache& Cache  = m_ThreadCaches[CacheIdx];
+        void**       Blocks = &m_CachedBlocks[size_t{CacheIdx} * m_ThreadCacheSize];
+
+        Threading::SpinLockGuard    CacheGuard{Cache.Lock};
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        for (Uint32 i = 0; i < Cache.NumBlocks; ++i)
+            FreeCachedBlockToPages(Blocks[i]);
+        Cache.NumBlocks = 0;
+    }
+}
+
 void* FixedBlockMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
     VERIFY(Alignment <= sizeof(void*), "Alignment (", Alignment, ") exceeds the default alignment (", sizeof(void*), ")");
@@ -0,0 +1,385 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Frustum planes selected by the plane flags
+struct FrustumPlanes
+{
+    Uint32  NumPlanes = 0;
+    Plane3D Planes[ViewFrustum::NUM_PLANES];
+    float3  AbsNormals[ViewFrustum::NUM_PLANES];
+    float   NormalLengths[ViewFrustum::NUM_PLANES];
+
+    FrustumPlanes(const ViewFrustum& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+            Planes[NumPlanes]        = Plane;
+            AbsNormals[NumPlanes]    = abs(Plane.Normal);
+            NormalLengths[NumPlanes] = length(Plane.Normal);
+            ++NumPlanes;
+        }
+    }
+};
+
+bool IsVisible(const FrustumPlanes& Planes, const BoundBoxArraysSoA& Boxes, Uint32 Idx)
+{
+    BoundBox Box;
+    Box.Min = float3{Boxes.MinX[Idx], Boxes.MinY[Idx], Boxes.MinZ[Idx]};
+    Box.Max = float3{Boxes.MaxX[Idx], Boxes.MaxY[Idx], Boxes.MaxZ[Idx]};
+    for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+    {
+        if (GetBoxVisibilityAgainstPlane(Planes.Planes[i], Box) == BoxVisibility::Invisible)
+            return false;
+    }
+    return true;
+}
+
+bool IsVisible(const FrustumPlanes& Planes, const BoundSphereArraysSoA& Spheres, Uint32 Idx)
+{
+    const float3 Center{Spheres.CenterX[Idx], Spheres.CenterY[Idx], Spheres.CenterZ[Idx]};
+    const float  Radius = Spheres.Radius[Idx];
+    for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+    {
+        const Plane3D& Plane = Planes.Planes[i];
+        // Since the normal is not normalized, the distance is scaled by the normal length
+        if (dot(Center, Plane.Normal) + Plane.Distance < -Radius * Planes.NormalLengths[i])
+            return false;
+    }
+    return true;
+}
+
+#if DILIGENT_AVX2_ENABLED
+struct AVX2Ops
+{
+    static constexpr Uint32 Width = 8;
+
+    using Vec  = __m256;
+    using Mask = __m256;
+
+    static Vec    Load(const float* p) { return _mm256_loadu_ps(p); }
+    static Vec    Set1(float s) { return _mm256_set1_ps(s); }
+    static Vec    Add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+    static Vec    Sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+    static Vec    Mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+    static Vec    Neg(Vec a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.f)); }
+    static Mask   CmpLt(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask   Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+    static Mask   MaskNone() { return _mm256_setzero_ps(); }
+    static Uint32 MoveMask(Mask m) { return static_cast<Uint32>(_mm256_movemask_ps(m)); }
+};
+#endif
+
+#if DILIGENT_SSE2_ENABLED
+struct SSE2Ops
+{
+    static constexpr Uint32 Width = 4;
+
+    using Vec  = __m128;
+    using Mask = __m128;
+
+    static Vec    Load(const float* p) { return _mm_loadu_ps(p); }
+    static Vec    Set1(float s) { return _mm_set1_ps(s); }
+    static Vec    Add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+    static Vec    Sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+    static Vec    Mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+    static Vec    Neg(Vec a) { return _mm_xor_ps(a, _mm_set1_ps(-0.f)); }
+    static Mask   CmpLt(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+    static Mask   Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+    static Mask   MaskNone() { return _mm_setzero_ps(); }
+    static Uint32 MoveMask(Mask m) { return static_cast<Uint32>(_mm_movemask_ps(m)); }
+};
+#endif
+
+#if DILIGENT_NEON_ENABLED
+struct NEONOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Vec  = float32x4_t;
+    using Mask = uint32x4_t;
+
+    static Vec  Load(const float* p) { return vld1q_f32(p); }
+    static Vec  Set1(float s) { return vdupq_n_f32(s); }
+    static Vec  Add(Vec a, Vec b) { return vaddq_f32(a, b); }
+    static Vec  Sub(Vec a, Vec b) { return vsubq_f32(a, b); }
+    static Vec  Mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+    static Vec  Neg(Vec a) { return vnegq_f32(a); }
+    static Mask CmpLt(Vec a, Vec b) { return vcltq_f32(a, b); }
+    static Mask Or(Mask a, Mask b) { return vorrq_u32(a, b); }
+    static Mask MaskNone() { return vdupq_n_u32(0); }
+
+    static Uint32 MoveMask(Mask m)
+    {
+        return (vgetq_lane_u32(m, 0) & 1u) |
+            (vgetq_lane_u32(m, 1) & 2u) |
+            (vgetq_lane_u32(m, 2) & 4u) |
+            (vgetq_lane_u32(m, 3) & 8u);
+    }
+};
+#endif
+
+#if DILIGENT_WASM_SIMD_ENABLED
+struct WASMOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Vec  = v128_t;
+    using Mask = v128_t;
+
+    static Vec    Load(const float* p) { return wasm_v128_load(p); }
+    static Vec    Set1(float s) { return wasm_f32x4_splat(s); }
+    static Vec    Add(Vec a, Vec b) { return wasm_f32x4_add(a, b); }
+    static Vec    Sub(Vec a, Vec b) { return wasm_f32x4_sub(a, b); }
+    static Vec    Mul(Vec a, Vec b) { return wasm_f32x4_mul(a, b); }
+    static Vec    Neg(Vec a) { return wasm_f32x4_neg(a); }
+    static Mask   CmpLt(Vec a, Vec b) { return wasm_f32x4_lt(a, b); }
+    static Mask   Or(Mask a, Mask b) { return wasm_v128_or(a, b); }
+    static Mask   MaskNone() { return wasm_i32x4_const_splat(0); }
+    static Uint32 MoveMask(Mask m) { return static_cast<Uint32>(wasm_i32x4_bitmask(m)); }
+};
+#endif
+
+// Returns the visibility bits of Ops::Width boxes starting at Idx
+template <typename Ops>
+Uint32 GetVisibilityBits(const FrustumPlanes& Planes, const BoundBoxArraysSoA& Boxes, Uint32 Idx)
+{
+    using Vec  = typename Ops::Vec;
+    using Mask = typename Ops::Mask;
+
+    const Vec MinX = Ops::Load(Boxes.MinX + Idx);
+    const Vec MinY = Ops::Load(Boxes.MinY + Idx);
+    const Vec MinZ = Ops::Load(Boxes.MinZ + Idx);
+    const Vec MaxX = Ops::Load(Boxes.MaxX + Idx);
+    const Vec MaxY = Ops::Load(Boxes.MaxY + Idx);
+    const Vec MaxZ = Ops::Load(Boxes.MaxZ + Idx);
+
+    // Use the same operations in the same order as GetBoxVisibilityAgainstPlane()
+    // so that the results are identical.
+    const Vec SumX  = Ops::Add(MaxX, MinX);
+    const Vec SumY  = Ops::Add(MaxY, MinY);
+    const Vec SumZ  = Ops::Add(MaxZ, MinZ);
+    const Vec DiffX = Ops::Sub(MaxX, MinX);
+    const Vec DiffY = Ops::Sub(MaxY, MinY);
+    const Vec DiffZ = Ops::Sub(MaxZ, MinZ);
+    const Vec Half  = Ops::Set1(0.5f);
+
+    Mask Invisible = Ops::MaskNone();
+    for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+    {
+        const Plane3D& Plane  = Planes.Planes[i];
+        const float3&  AbsNrm = Planes.AbsNormals[i];
+
+        // DistanceToCenter = dot(Box.Max + Box.Min, Plane.Normal) * 0.5f + Plane.Distance
+        Vec DistanceToCenter = Ops::Mul(SumX, Ops::Set1(Plane.Normal.x));
+        DistanceToCenter     = Ops::Add(DistanceToCenter, Ops::Mul(SumY, Ops::Set1(Plane.Normal.y)));
+        DistanceToCenter     = Ops::Add(DistanceToCenter, Ops::Mul(SumZ, Ops::Set1(Plane.Normal.z)));
+        DistanceToCenter     = Ops::Add(Ops::Mul(DistanceToCenter, Half), Ops::Set1(Plane.Distance));
+
+        // ProjHalfLen = dot(Box.Max - Box.Min, abs(Plane.Normal)) * 0.5f
+        Vec ProjHalfLen = Ops::Mul(DiffX, Ops::Set1(AbsNrm.x));
+        ProjHalfLen     = Ops::Add(ProjHalfLen, Ops::Mul(DiffY, Ops::Set1(AbsNrm.y)));
+        ProjHalfLen     = Ops::Add(ProjHalfLen, Ops::Mul(DiffZ, Ops::Set1(AbsNrm.z)));
+        ProjHalfLen     = Ops::Mul(ProjHalfLen, Half);
+
+        Invisible = Ops::Or(Invisible, Ops::CmpLt(DistanceToCenter, Ops::Neg(ProjHalfLen)));
+    }
+
+    return ~Ops::MoveMask(Invisible) & ((1u << Ops::Width) - 1u);
+}
+
+// Returns the visibility bits of Ops::Width spheres starting at Idx
+template <typename Ops>
+Uint32 GetVisibilityBits(const FrustumPlanes& Planes, const BoundSphereArraysSoA& Spheres, Uint32 Idx)
+{
+    using Vec  = typename Ops::Vec;
+    using Mask = typename Ops::Mask;
+
+    const Vec CenterX   = Ops::Load(Spheres.CenterX + Idx);
+    const Vec CenterY   = Ops::Load(Spheres.CenterY + Idx);
+    const Vec CenterZ   = Ops::Load(Spheres.CenterZ + Idx);
+    const Vec NegRadius = Ops::Neg(Ops::Load(Spheres.Radius + Idx));
+
+    Mask Invisible = Ops::MaskNone();
+    for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+    {
+        const Plane3D& Plane = Planes.Planes[i];
+
+        // dot(Center, Plane.Normal) + Plane.Distance < -Radius * NormalLength
+        Vec Distance = Ops::Mul(CenterX, Ops::Set1(Plane.Normal.x));
+        Distance     = Ops::Add(Distance, Ops::Mul(CenterY, Ops::Set1(Plane.Normal.y)));
+        Distance     = Ops::Add(Distance, Ops::Mul(CenterZ, Ops::Set1(Plane.Normal.z)));
+        Distance     = Ops::Add(Distance, Ops::Set1(Plane.Distance));
+
+        Invisible = Ops::Or(Invisible, Ops::CmpLt(Distance, Ops::Mul(NegRadius, Ops::Set1(Planes.NormalLengths[i]))));
+    }
+
+    return ~Ops::MoveMask(Invisible) & ((1u << Ops::Width) - 1u);
+}
+
+// Returns the visibility mask of up to 32 items starting at FirstIdx
+template <typename BoundsType>
+Uint32 GetVisibilityMaskWord(const FrustumPlanes& Planes, const BoundsType& Bounds, Uint32 FirstIdx, Uint32 NumItems)
+{
+    VERIFY_EXPR(NumItems <= 32);
+
+    Uint32 Mask = 0;
+    Uint32 i    = 0;
+
+#if DILIGENT_AVX2_ENABLED
+    using SIMDOps = AVX2Ops;
+#elif DILIGENT_SSE2_ENABLED
+    using SIMDOps = SSE2Ops;
+#elif DILIGENT_NEON_ENABLED
+    using SIMDOps = NEONOps;
+#elif DILIGENT_WASM_SIMD_ENABLED
+    using SIMDOps = WASMOps;
+#endif
+
+#if DILIGENT_AVX2_ENABLED || DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED || DILIGENT_WASM_SIMD_ENABLED
+    for (; i + SIMDOps::Width <= NumItems; i += SIMDOps::Width)
+    {
+        Mask |= GetVisibilityBits<SIMDOps>(Planes, Bounds, FirstIdx + i) << i;
+    }
+#endif
+
+    for (; i < NumItems; ++i)
+    {
+        if (IsVisible(Planes, Bounds, FirstIdx + i))
+            Mask |= 1u << i;
+    }
+
+    return Mask;
+}
+
+template <typename BoundsType>
+void GetVisibilityMask(const ViewFrustum&  Frustum,
+                       const BoundsType&   Bounds,
+                       Uint32              NumItems,
+                       Uint32*             pVisibleMask,
+                       FRUSTUM_PLANE_FLAGS PlaneFlags,
+                       IThreadPool*        pThreadPool)
+{
+    if (NumItems == 0)
+        return;
+
+    DEV_CHECK_ERR(pVisibleMask != nullptr, "Visibility mask must not be null");
+
+    const FrustumPlanes Planes{Frustum, PlaneFlags};
+
+    // Every thread processes whole mask words, so no synchronization is required.
+    // One grain is 64 words, or 2048 items.
+    constexpr Uint32 GrainSize = 64;
+    const Uint32     NumWords  = (NumItems + 31) / 32;
+    ParallelFor(pThreadPool, 0, NumWords, GrainSize,
+                [&](Uint32 WordIdx) {
+                    const Uint32 FirstIdx  = WordIdx * 32;
+                    pVisibleMask[WordIdx] = GetVisibilityMaskWord(Planes, Bounds, FirstIdx, std::min(NumItems - FirstIdx, 32u));
+                });
+}
+
+} // namespace
+
+void GetBoxesVisibility(const ViewFrustum&       Frustum,
+                        const BoundBoxArraysSoA& Boxes,
+                        Uint32                   NumBoxes,
+                        Uint32*                  pVisibleMask,
+                        FRUSTUM_PLANE_FLAGS      PlaneFlags,
+                        IThreadPool*             pThreadPool)
+{
+    GetVisibilityMask(Frustum, Boxes, NumBoxes, pVisibleMask, PlaneFlags, pThreadPool);
+}
+
+void GetSpheresVisibility(const ViewFrustum&          Frustum,
+                          const BoundSphereArraysSoA& Spheres,
+                          Uint32                      NumSpheres,
+                          Uint32*                     pVisibleMask,
+                          FRUSTUM_PLANE_FLAGS         PlaneFlags,
+                          IThreadPool*                pThreadPool)
+{
+    GetVisibilityMask(Frustum, Spheres, NumSpheres, pVisibleMask, PlaneFlags, pThreadPool);
+}
+
+Uint32 CompactVisibleIndices(const Uint32* pVisibleMask,
+                             Uint32        NumItems,
+                             Uint32*       pVisibleIndices)
+{
+    Uint32       NumVisible = 0;
+    const Uint32 NumWords   = (NumItems + 31) / 32;
+    for (Uint32 WordIdx = 0; WordIdx < NumWords; ++WordIdx)
+    {
+        for (Uint32 Bits = pVisibleMask[WordIdx]; Bits != 0; Bits &= Bits - 1)
+        {
+            pVisibleIndices[NumVisible++] = WordIdx * 32 + PlatformMisc::GetLSB(Bits);
+        }
+    }
+    return NumVisible;
+}
+
+Uint32 GetVisibleBoxes(const ViewFrustum&       Frustum,
+                       const BoundBoxArraysSoA& Boxes,
+                       Uint32                   NumBoxes,
+                       Uint32*                  pVisibleIndices,
+                       FRUSTUM_PLANE_FLAGS      PlaneFlags,
+                       IThreadPool*             pThreadPool)
+{
+    std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32);
+    GetBoxesVisibility(Frustum, Boxes, NumBoxes, VisibleMask.data(), PlaneFlags, pThreadPool);
+    return CompactVisibleIndices(VisibleMask.data(), NumBoxes, pVisibleIndices);
+}
+
+Uint32 GetVisibleSpheres(const ViewFrustum&          Frustum,
+                         const BoundSphereArraysSoA& Spheres,
+                         Uint32                      NumSpheres,
+                         Uint32*                     pVisibleIndices,
+                         FRUSTUM_PLANE_FLAGS         PlaneFlags,
+                         IThreadPool*                pThreadPool)
+{
+    std::vector<Uint32> VisibleMask((NumSpheres + 31) / 32);
+    GetSpheresVisibility(Frustum, Spheres, NumSpheres, VisibleMask.data(), PlaneFlags, pThreadPool);
+    return CompactVisibleIndices(VisibleMask.data(), NumSpheres, pVisibleIndices);
+}
+
+} // namespace Diligent
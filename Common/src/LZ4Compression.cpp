@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZ4Compression.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace Diligent
+{
+
+namespace
+{
+
+// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+constexpr size_t MinMatch     = 4;
+constexpr size_t LastLiterals = 5;  // The last 5 bytes are always literals
+constexpr size_t MFLimit      = 12; // The last match must start at least 12 bytes before the end
+constexpr size_t MaxOffset    = 65535;
+constexpr Uint32 HashLog      = 12;
+
+inline Uint32 Read32(const Uint8* p)
+{
+    Uint32 Val;
+    std::memcpy(&Val, p, sizeof(Val));
+    return Val;
+}
+
+inline Uint32 Hash(Uint32 Seq)
+{
+    return (Seq * 2654435761u) >> (32 - HashLog);
+}
+
+// Returns the number of bytes required to encode the length that does not fit into the token.
+inline size_t GetExtraLengthSize(size_t Length)
+{
+    return Length >= 15 ? (Length - 15) / 255 + 1 : 0;
+}
+
+inline Uint8* WriteExtraLength(Uint8* pDst, size_t Length)
+{
+    if (Length < 15)
+        return pDst;
+
+    Length -= 15;
+    for (; Length >= 255; Length -= 255)
+        *pDst++ = 255;
+    *pDst++ = static_cast<Uint8>(Length);
+    return pDst;
+}
+
+// Writes a sequence of literals optionally followed by a match.
+// Returns the new destination pointer, or null if the destination buffer is too small.
+Uint8* WriteSequence(Uint8*       pDst,
+                     const Uint8* pDstEnd,
+                     const Uint8* pLiterals,
+                     size_t       LiteralLength,
+                     size_t       Offset,
+                     size_t       MatchLength)
+{
+    const bool   HasMatch     = Offset != 0;
+    const size_t SequenceSize = 1 + GetExtraLengthSize(LiteralLength) + LiteralLength + (HasMatch ? 2 + GetExtraLengthSize(MatchLength) : 0);
+    if (SequenceSize > static_cast<size_t>(pDstEnd - pDst))
+        return nullptr;
+
+    Uint8* pToken = pDst++;
+    *pToken       = static_cast<Uint8>((LiteralLength < 15 ? LiteralLength : 15) << 4);
+    pDst          = WriteExtraLength(pDst, LiteralLength);
+    std::memcpy(pDst, pLiterals, LiteralLength);
+    pDst += LiteralLength;
+
+    if (HasMatch)
+    {
+        *pToken |= static_cast<Uint8>(MatchLength < 15 ? MatchLength : 15);
+        *pDst++ = static_cast<Uint8>(Offset & 0xFF);
+        *pDst++ = static_cast<Uint8>(Offset >> 8);
+        pDst    = WriteExtraLength(pDst, MatchLength);
+    }
+
+    return pDst;
+}
+
+// Reads the length that does not fit into the token.
+inline bool ReadExtraLength(const Uint8*& pSrc, const Uint8* pSrcEnd, size_t& Length)
+{
+    if (Length != 15)
+        return true;
+
+    Uint8 Byte = 0;
+    do
+    {
+        if (pSrc >= pSrcEnd)
+            return false;
+        Byte = *pSrc++;
+        Length += Byte;
+    } while (Byte == 255);
+
+    return true;
+}
+
+} // namespace
+
+size_t GetLZ4CompressedSizeBound(size_t SrcSize)
+{
+    return SrcSize + SrcSize / 255 + 16;
+}
+
+size_t CompressLZ4(const void* pSrc, size_t SrcSize, void* pDst, size_t DstCapacity)
+{
+    const Uint8* const pSrcStart = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pSrcEnd   = pSrcStart + SrcSize;
+    Uint8* const       pDstStart = static_cast<Uint8*>(pDst);
+    const Uint8* const pDstEnd   = pDstStart + DstCapacity;
+
+    Uint8*       pOut    = pDstStart;
+    const Uint8* pAnchor = pSrcStart;
+
+    if (SrcSize > MFLimit)
+    {
+        const Uint8* const pMatchStartLimit = pSrcEnd - MFLimit;
+        const Uint8* const pMatchEndLimit   = pSrcEnd - LastLiterals;
+
+        // Positions of the last occurrences of 4-byte sequences
+        std::vector<Uint32> HashTable(size_t{1} << HashLog, 0);
+
+        const Uint8* pIn         = pSrcStart;
+        Uint32       NumAttempts = 0;
+        while (pIn < pMatchStartLimit)
+        {
+            const Uint32 Seq = Read32(pIn);
+            const Uint32 h   = Hash(Seq);
+
+            const Uint8* pRef = pSrcStart + HashTable[h];
+            HashTable[h]      = static_cast<Uint32>(pIn - pSrcStart);
+
+            if (pRef >= pIn || static_cast<size_t>(pIn - pRef) > MaxOffset || Read32(pRef) != Seq)
+            {
+                // Skip faster through incompressible data
+                pIn += 1 + (NumAttempts++ >> 6);
+                continue;
+            }
+            NumAttempts = 0;
+
+            // Extend the match backwards
+            while (pIn > pAnchor && pRef > pSrcStart && pIn[-1] == pRef[-1])
+            {
+                --pIn;
+                --pRef;
+            }
+
+            // Extend the match forward
+            const Uint8* pMatchEnd = pIn + MinMatch;
+            for (const Uint8* pRefEnd = pRef + MinMatch; pMatchEnd < pMatchEndLimit && *pMatchEnd == *pRefEnd; ++pRefEnd)
+                ++pMatchEnd;
+
+            pOut = WriteSequence(pOut, pDstEnd, pAnchor, pIn - pAnchor, pIn - pRef, pMatchEnd - pIn - MinMatch);
+            if (pOut == nullptr)
+                return 0;
+
+            pIn = pAnchor = pMatchEnd;
+        }
+    }
+
+    // The last sequence only contains literals
+    pOut = WriteSequence(pOut, pDstEnd, pAnchor, pSrcEnd - pAnchor, 0, 0);
+    if (pOut == nullptr)
+        return 0;
+
+    return pOut - pDstStart;
+}
+
+bool DecompressLZ4(const void* pSrc, size_t SrcSize, void* pDst, size_t DstSize)
+{
+    const Uint8*       pIn       = static_cast<const Uint8*>(pSrc);
+    const Uint8* const pSrcEnd   = pIn + SrcSize;
+    Uint8* const       pDstStart = static_cast<Uint8*>(pDst);
+    Uint8*             pOut      = pDstStart;
+    const Uint8* const pDstEnd   = pDstStart + DstSize;
+
+    while (pIn < pSrcEnd)
+    {
+        const Uint8 Token = *pIn++;
+
+        size_t LiteralLength = Token >> 4;
+        if (!ReadExtraLength(pIn, pSrcEnd, LiteralLength))
+            return false;
+        if (LiteralLength > static_cast<size_t>(pSrcEnd - pIn) || LiteralLength > static_cast<size_t>(pDstEnd - pOut))
+            return false;
+
+        std::memcpy(pOut, pIn, LiteralLength);
+        pIn += LiteralLength;
+        pOut += LiteralLength;
+
+        // The last sequence does not have a match
+        if (pIn == pSrcEnd)
+            break;
+
+        if (pSrcEnd - pIn < 2)
+            return false;
+        const size_t Offset = size_t{pIn[0]} | (size_t{pIn[1]} << 8);
+        pIn += 2;
+        if (Offset == 0 || Offset > static_cast<size_t>(pOut - pDstStart))
+            return false;
+
+        size_t MatchLength = Token & 0x0F;
+        if (!ReadExtraLength(pIn, pSrcEnd, MatchLength))
+            return false;
+        MatchLength += MinMatch;
+        if (MatchLength > static_cast<size_t>(pDstEnd - pOut))
+            return false;
+
+        const Uint8* pMatch = pOut - Offset;
+        if (Offset >= MatchLength)
+        {
+            std::memcpy(pOut, pMatch, MatchLength);
+            pOut += MatchLength;
+        }
+        else
+        {
+            // Overlapping match repeats the last Offset bytes
+            for (size_t i = 0; i < MatchLength; ++i)
+                *pOut++ = *pMatch++;
+        }
+    }
+
+    return pOut == pDstEnd;
+}
+
+} // namespace Diligent
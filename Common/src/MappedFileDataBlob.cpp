@@ -0,0 +1,292 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "MappedFileDataBlob.hpp"
+
+#include <limits>
+
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
+#include "Align.hpp"
+
+#if PLATFORM_WIN32
+#    include "StringTools.hpp"
+#    include "WinHPreface.h"
+#    include <Windows.h>
+#    include "WinHPostface.h"
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 1
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 1
+#else
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 0
+#endif
+
+namespace Diligent
+{
+
+#if PLATFORM_WIN32
+
+static bool MapFile(const Char* FilePath, void*& pData, size_t& Size, void*& pMappingHandle)
+{
+    const std::wstring FilePathW = WidenString(FilePath);
+
+    HANDLE hFile = CreateFileW(FilePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "'");
+        return false;
+    }
+
+    bool          Result = false;
+    LARGE_INTEGER FileSize{};
+    if (!GetFileSizeEx(hFile, &FileSize))
+    {
+        LOG_ERROR_MESSAGE("Failed to get the size of file '", FilePath, "'");
+    }
+    else if (static_cast<Uint64>(FileSize.QuadPart) > std::numeric_limits<size_t>::max())
+    {
+        LOG_ERROR_MESSAGE("File '", FilePath, "' is too large to be mapped");
+    }
+    else if (FileSize.QuadPart == 0)
+    {
+        // Empty files can't be mapped
+        Result = true;
+    }
+    else
+    {
+        // Copy-on-write mapping allows modifying the data through the blob without changing the file
+        HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (hMapping == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Failed to create file mapping for file '", FilePath, "'");
+        }
+        else
+        {
+            pData = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+            if (pData == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Failed to map view of file '", FilePath, "'");
+                CloseHandle(hMapping);
+            }
+            else
+            {
+                Size           = static_cast<size_t>(FileSize.QuadPart);
+                pMappingHandle = hMapping;
+                Result         = true;
+            }
+        }
+    }
+
+    // The mapping keeps the file open
+    CloseHandle(hFile);
+    return Result;
+}
+
+static void UnmapFile(void* pData, size_t Size, void* pMappingHandle)
+{
+    if (pData != nullptr)
+        UnmapViewOfFile(pData);
+    if (pMappingHandle != nullptr)
+        CloseHandle(pMappingHandle);
+}
+
+static bool AdviseRange(void* pData, size_t Size, MappedFileDataBlob::AccessHint Hint)
+{
+#    if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602 // Windows 8
+    if (Hint == MappedFileDataBlob::AccessHint::WillNeed)
+    {
+        WIN32_MEMORY_RANGE_ENTRY Range{pData, Size};
+        return PrefetchVirtualMemory(GetCurrentProcess(), 1, &Range, 0) != FALSE;
+    }
+#    endif
+    // There are no equivalents of other hints
+    return false;
+}
+
+#elif DILIGENT_FILE_MAPPING_SUPPORTED
+
+static bool MapFile(const Char* FilePath, void*& pData, size_t& Size, void*& pMappingHandle)
+{
+    const int fd = open(FilePath, O_RDONLY);
+    if (fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "'");
+        return false;
+    }
+
+    bool        Result = false;
+    struct stat FileStat;
+    if (fstat(fd, &FileStat) != 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the size of file '", FilePath, "'");
+    }
+    else if (static_cast<Uint64>(FileStat.st_size) > std::numeric_limits<size_t>::max())
+    {
+        LOG_ERROR_MESSAGE("File '", FilePath, "' is too large to be mapped");
+    }
+    else if (FileStat.st_size == 0)
+    {
+        // Empty files can't be mapped
+        Result = true;
+    }
+    else
+    {
+        // Private mapping allows modifying the data through the blob without changing the file
+        void* pMappedData = mmap(nullptr, static_cast<size_t>(FileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (pMappedData == MAP_FAILED)
+        {
+            LOG_ERROR_MESSAGE("Failed to map file '", FilePath, "'");
+        }
+        else
+        {
+            pData  = pMappedData;
+            Size   = static_cast<size_t>(FileStat.st_size);
+            Result = true;
+        }
+    }
+
+    // The mapping keeps a reference to the file
+    close(fd);
+    return Result;
+}
+
+static void UnmapFile(void* pData, size_t Size, void* pMappingHandle)
+{
+    if (pData != nullptr)
+        munmap(pData, Size);
+}
+
+static bool AdviseRange(void* pData, size_t Size, MappedFileDataBlob::AccessHint Hint)
+{
+    int Advice = MADV_NORMAL;
+    switch (Hint)
+    {
+        // clang-format off
+        case MappedFileDataBlob::AccessHint::Normal:     Advice = MADV_NORMAL;     break;
+        case MappedFileDataBlob::AccessHint::Sequential: Advice = MADV_SEQUENTIAL; break;
+        case MappedFileDataBlob::AccessHint::Random:     Advice = MADV_RANDOM;     break;
+        case MappedFileDataBlob::AccessHint::WillNeed:   Advice = MADV_WILLNEED;   break;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected access hint");
+    }
+
+    // The address must be aligned to the page size
+    static const size_t PageSize    = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t        Addr        = reinterpret_cast<size_t>(pData);
+    const size_t        AlignedAddr = AlignDown(Addr, PageSize);
+    return madvise(reinterpret_cast<void*>(AlignedAddr), Size + (Addr - AlignedAddr), Advice) == 0;
+}
+
+#endif
+
+constexpr INTERFACE_ID MappedFileDataBlob::IID_InternalImpl;
+
+RefCntAutoPtr<IDataBlob> MappedFileDataBlob::Create(const Char* FilePath, AccessHint Hint)
+{
+    if (FilePath == nullptr)
+    {
+        DEV_ERROR("File path must not be null");
+        return {};
+    }
+
+#if DILIGENT_FILE_MAPPING_SUPPORTED
+    void*  pData          = nullptr;
+    size_t Size           = 0;
+    void*  pMappingHandle = nullptr;
+    if (!MapFile(FilePath, pData, Size, pMappingHandle))
+        return {};
+
+    RefCntAutoPtr<MappedFileDataBlob> pBlob{MakeNewRCObj<MappedFileDataBlob>()(pData, Size, pMappingHandle)};
+    if (Hint != AccessHint::Normal)
+        pBlob->Advise(Hint);
+    return RefCntAutoPtr<IDataBlob>{pBlob};
+#else
+    // File mapping is not supported: read the whole file
+    RefCntAutoPtr<IDataBlob> pFileData;
+    FileWrapper::ReadWholeFile(FilePath, &pFileData);
+    return pFileData;
+#endif
+}
+
+MappedFileDataBlob::MappedFileDataBlob(IReferenceCounters* pRefCounters,
+                                       void*               pData,
+                                       size_t              Size,
+                                       void*               pMappingHandle) :
+    TBase{pRefCounters},
+    m_pData{pData},
+    m_Size{Size},
+    m_pMappingHandle{pMappingHandle}
+{
+}
+
+MappedFileDataBlob::~MappedFileDataBlob()
+{
+#if DILIGENT_FILE_MAPPING_SUPPORTED
+    UnmapFile(m_pData, m_Size, m_pMappingHandle);
+#endif
+}
+
+void MappedFileDataBlob::Resize(size_t NewSize)
+{
+    UNEXPECTED("Resize is not supported by mapped file data blob.");
+}
+
+bool MappedFileDataBlob::Advise(AccessHint Hint, size_t Offset, size_t Size) const
+{
+    if (Offset >= m_Size)
+    {
+        DEV_CHECK_ERR(Offset == 0, "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+        return false;
+    }
+    if (Size == 0 || Size > m_Size - Offset)
+    {
+        DEV_CHECK_ERR(Size <= m_Size - Offset, "The range [", Offset, ", ", Offset + Size, ") exceeds the data size (", m_Size, ")");
+        Size = m_Size - Offset;
+    }
+
+#if DILIGENT_FILE_MAPPING_SUPPORTED
+    return AdviseRange(static_cast<Uint8*>(m_pData) + Offset, Size, Hint);
+#else
+    return false;
+#endif
+}
+
+bool MappedFileDataBlob::Advise(IDataBlob* pDataBlob, AccessHint Hint, size_t Offset, size_t Size)
+{
+    if (pDataBlob == nullptr)
+        return false;
+
+    RefCntAutoPtr<MappedFileDataBlob> pMappedBlob{pDataBlob, IID_InternalImpl};
+    return pMappedBlob ? pMappedBlob->Advise(Hint, Offset, Size) : false;
+}
+
+} // namespace Diligent
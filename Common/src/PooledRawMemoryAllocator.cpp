@@ -0,0 +1,373 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "PooledRawMemoryAllocator.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every allocation is preceded by the header that identifies the block
+struct AllocationHeader
+{
+    // Size class of the block, or LargeAllocation
+    Uint32 SizeClass;
+
+    // Offset from the start of the block to the returned pointer
+    Uint32 Offset;
+};
+static_assert(sizeof(AllocationHeader) == 8, "Unexpected header size");
+
+constexpr Uint32 LargeAllocation = ~Uint32{0};
+
+// All blocks in the pools are aligned by this value
+constexpr size_t MinAlignment = 16;
+
+constexpr size_t MinChunkSize = size_t{64} << 10;
+
+size_t SizeClassToBlockSize(Uint32 SizeClass)
+{
+    VERIFY_EXPR(SizeClass < PooledRawMemoryAllocator::NumSizeClasses);
+    if (SizeClass < 8)
+        return (size_t{SizeClass} + 1) * 16;
+
+    const Uint32 Group = 7 + (SizeClass - 8) / 4;
+    const Uint32 Step  = (SizeClass - 8) % 4 + 1;
+    return (size_t{1} << Group) + Step * (size_t{1} << (Group - 2));
+}
+
+Uint32 BlockSizeToSizeClass(size_t Size)
+{
+    VERIFY_EXPR(Size > 0 && Size <= PooledRawMemoryAllocator::MaxPooledSize);
+    if (Size <= 128)
+        return static_cast<Uint32>((Size + 15) / 16 - 1);
+
+    // Index of the most significant bit of (Size - 1), which is 7 for the (128, 256] range.
+    const Uint32 Group = PlatformMisc::GetMSB(static_cast<Uint32>(Size - 1));
+    const size_t Step  = size_t{1} << (Group - 2);
+    return 8 + (Group - 7) * 4 + static_cast<Uint32>((Size - (size_t{1} << Group) + Step - 1) / Step) - 1;
+}
+
+// The number of blocks a thread may keep in its cache for the size class
+Uint32 GetMaxCachedBlocks(Uint32 SizeClass)
+{
+    return static_cast<Uint32>(std::min(std::max(MinChunkSize / SizeClassToBlockSize(SizeClass), size_t{4}), size_t{256}));
+}
+
+struct ThreadCache
+{
+    using FreeBlock = PooledRawMemoryAllocator::FreeBlock;
+
+    struct Bin
+    {
+        FreeBlock* pFreeList     = nullptr;
+        Uint32     NumFreeBlocks = 0;
+    };
+    Bin Bins[PooledRawMemoryAllocator::NumSizeClasses];
+
+    ~ThreadCache()
+    {
+        // Give the cached blocks back to the shared pools so that other threads can use them
+        for (Uint32 SizeClass = 0; SizeClass < PooledRawMemoryAllocator::NumSizeClasses; ++SizeClass)
+        {
+            auto& B = Bins[SizeClass];
+            if (B.NumFreeBlocks == 0)
+                continue;
+
+            FreeBlock* pLast = B.pFreeList;
+            while (pLast->pNext != nullptr)
+                pLast = pLast->pNext;
+            PooledRawMemoryAllocator::GetAllocator().ReleaseBlocks(SizeClass, B.pFreeList, pLast, B.NumFreeBlocks);
+            B = {};
+        }
+    }
+
+    void* Allocate(Uint32 SizeClass)
+    {
+        auto& B = Bins[SizeClass];
+        if (B.pFreeList == nullptr)
+        {
+            VERIFY_EXPR(B.NumFreeBlocks == 0);
+            B.pFreeList = PooledRawMemoryAllocator::GetAllocator().AcquireBlocks(SizeClass, GetMaxCachedBlocks(SizeClass) / 2, B.NumFreeBlocks);
+            if (B.pFreeList == nullptr)
+                return nullptr;
+        }
+
+        FreeBlock* pBlock = B.pFreeList;
+        B.pFreeList       = pBlock->pNext;
+        --B.NumFreeBlocks;
+        return pBlock;
+    }
+
+    void Free(void* pBlock, Uint32 SizeClass)
+    {
+        auto& B = Bins[SizeClass];
+
+        FreeBlock* pFreeBlock = static_cast<FreeBlock*>(pBlock);
+        pFreeBlock->pNext     = B.pFreeList;
+        B.pFreeList           = pFreeBlock;
+        ++B.NumFreeBlocks;
+
+        const Uint32 MaxCachedBlocks = GetMaxCachedBlocks(SizeClass);
+        if (B.NumFreeBlocks > MaxCachedBlocks)
+        {
+            // Return half of the blocks to the shared pool
+            const Uint32 NumToRelease = MaxCachedBlocks / 2;
+
+            FreeBlock* pFirst = B.pFreeList;
+            FreeBlock* pLast  = pFirst;
+            for (Uint32 i = 1; i < NumToRelease; ++i)
+                pLast = pLast->pNext;
+            B.pFreeList  = pLast->pNext;
+            pLast->pNext = nullptr;
+            B.NumFreeBlocks -= NumToRelease;
+
+            PooledRawMemoryAllocator::GetAllocator().ReleaseBlocks(SizeClass, pFirst, pLast, NumToRelease);
+        }
+    }
+};
+
+thread_local ThreadCache t_Cache;
+
+AllocationHeader& GetHeader(void* Ptr)
+{
+    return *(reinterpret_cast<AllocationHeader*>(Ptr) - 1);
+}
+
+} // namespace
+
+
+PooledRawMemoryAllocator::PooledRawMemoryAllocator()
+{
+}
+
+PooledRawMemoryAllocator& PooledRawMemoryAllocator::GetAllocator()
+{
+    // The allocator is intentionally never destroyed, see class remarks
+    static PooledRawMemoryAllocator* const pAllocator = new PooledRawMemoryAllocator{};
+    return *pAllocator;
+}
+
+size_t PooledRawMemoryAllocator::GetBlockSize(size_t Size)
+{
+    return Size > 0 && Size <= MaxPooledSize ?
+        SizeClassToBlockSize(BlockSizeToSizeClass(Size)) :
+        Size;
+}
+
+PooledRawMemoryAllocator::FreeBlock* PooledRawMemoryAllocator::AcquireBlocks(Uint32 SizeClass, Uint32 MaxCount, Uint32& Count)
+{
+    VERIFY_EXPR(MaxCount > 0);
+    auto& Pool = m_Pools[SizeClass];
+
+    {
+        std::lock_guard<Threading::SpinLock> Lock{Pool.Lock};
+        if (Pool.pFreeList != nullptr)
+        {
+            FreeBlock* pFirst = Pool.pFreeList;
+            FreeBlock* pLast  = pFirst;
+            Count             = 1;
+            while (Count < MaxCount && pLast->pNext != nullptr)
+            {
+                pLast = pLast->pNext;
+                ++Count;
+            }
+            Pool.pFreeList = pLast->pNext;
+            Pool.NumFreeBlocks -= Count;
+            pLast->pNext = nullptr;
+            return pFirst;
+        }
+    }
+
+    // The shared list is empty: allocate a new chunk and split it into blocks.
+    const size_t BlockSize = SizeClassToBlockSize(SizeClass);
+    const size_t ChunkSize = std::max(MinChunkSize, BlockSize * 8);
+    const size_t NumBlocks = ChunkSize / BlockSize;
+
+    auto* pChunk = static_cast<Uint8*>(DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(ChunkSize, MinAlignment, "Pooled allocator chunk", __FILE__, __LINE__));
+    if (pChunk == nullptr)
+    {
+        Count = 0;
+        return nullptr;
+    }
+
+    FreeBlock* pFirst = reinterpret_cast<FreeBlock*>(pChunk);
+    for (size_t i = 0; i < NumBlocks; ++i)
+    {
+        FreeBlock* pBlock = reinterpret_cast<FreeBlock*>(pChunk + i * BlockSize);
+        pBlock->pNext     = i + 1 < NumBlocks ? reinterpret_cast<FreeBlock*>(pChunk + (i + 1) * BlockSize) : nullptr;
+    }
+
+    Count = static_cast<Uint32>(std::min(size_t{MaxCount}, NumBlocks));
+    if (Count < NumBlocks)
+    {
+        // Keep the first Count blocks and put the rest into the shared list
+        FreeBlock* pLast      = reinterpret_cast<FreeBlock*>(pChunk + (Count - 1) * BlockSize);
+        FreeBlock* pRestFirst = pLast->pNext;
+        FreeBlock* pRestLast  = reinterpret_cast<FreeBlock*>(pChunk + (NumBlocks - 1) * BlockSize);
+        pLast->pNext          = nullptr;
+        ReleaseBlocks(SizeClass, pRestFirst, pRestLast, static_cast<Uint32>(NumBlocks - Count));
+    }
+
+    return pFirst;
+}
+
+void PooledRawMemoryAllocator::ReleaseBlocks(Uint32 SizeClass, FreeBlock* pFirst, FreeBlock* pLast, Uint32 Count)
+{
+    VERIFY_EXPR(pFirst != nullptr && pLast != nullptr && pLast->pNext == nullptr && Count > 0);
+    auto& Pool = m_Pools[SizeClass];
+
+    std::lock_guard<Threading::SpinLock> Lock{Pool.Lock};
+    pLast->pNext   = Pool.pFreeList;
+    Pool.pFreeList = pFirst;
+    Pool.NumFreeBlocks += Count;
+}
+
+void* PooledRawMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    return AllocateAligned(Size, MinAlignment, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void* PooledRawMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0 && Alignment > 0);
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+    Alignment = std::max(Alignment, MinAlignment);
+
+    if (m_StatsEnabled.load(std::memory_order_relaxed))
+        RecordAllocation(Size, dbgDescription);
+
+    // All blocks are aligned by at least MinAlignment, so the offset to the
+    // aligned pointer that leaves room for the header never exceeds Alignment.
+    const size_t BlockSize = Size + Alignment;
+
+    Uint32 SizeClass = LargeAllocation;
+    void*  pBlock    = nullptr;
+    if (BlockSize <= MaxPooledSize)
+    {
+        SizeClass = BlockSizeToSizeClass(BlockSize);
+        pBlock    = t_Cache.Allocate(SizeClass);
+    }
+    else
+    {
+        pBlock = DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(BlockSize, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+    }
+    if (pBlock == nullptr)
+        return nullptr;
+
+    void* Ptr = AlignUp(static_cast<Uint8*>(pBlock) + sizeof(AllocationHeader), Alignment);
+    VERIFY_EXPR(static_cast<Uint8*>(Ptr) + Size <= static_cast<Uint8*>(pBlock) + BlockSize);
+
+    auto& Header     = GetHeader(Ptr);
+    Header.SizeClass = SizeClass;
+    Header.Offset    = static_cast<Uint32>(static_cast<Uint8*>(Ptr) - static_cast<Uint8*>(pBlock));
+
+    return Ptr;
+}
+
+void PooledRawMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const auto& Header = GetHeader(Ptr);
+    void*       pBlock = static_cast<Uint8*>(Ptr) - Header.Offset;
+    if (Header.SizeClass == LargeAllocation)
+    {
+        DefaultRawMemoryAllocator::GetAllocator().FreeAligned(pBlock);
+    }
+    else
+    {
+        VERIFY(Header.SizeClass < NumSizeClasses, "Invalid size class. The memory was not allocated by this allocator or the header is corrupted.");
+        t_Cache.Free(pBlock, Header.SizeClass);
+    }
+}
+
+void PooledRawMemoryAllocator::FreeAligned(void* Ptr)
+{
+    Free(Ptr);
+}
+
+void PooledRawMemoryAllocator::RecordAllocation(size_t Size, const Char* dbgDescription)
+{
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+
+    auto& Counters = m_Stats[dbgDescription];
+    ++Counters.NumAllocations;
+    Counters.TotalSize += Size;
+}
+
+void PooledRawMemoryAllocator::EnableStats(bool Enable)
+{
+    m_StatsEnabled.store(Enable);
+}
+
+std::vector<PooledRawMemoryAllocator::DescriptionStats> PooledRawMemoryAllocator::GetStats()
+{
+    // The same description may come from different string literals
+    std::map<std::string, DescStatsCounters> MergedStats;
+    {
+        std::lock_guard<std::mutex> Lock{m_StatsMtx};
+        for (const auto& it : m_Stats)
+        {
+            auto& Counters = MergedStats[it.first != nullptr ? it.first : "<Unknown>"];
+            Counters.NumAllocations += it.second.NumAllocations;
+            Counters.TotalSize += it.second.TotalSize;
+        }
+    }
+
+    std::vector<DescriptionStats> Stats;
+    Stats.reserve(MergedStats.size());
+    for (const auto& it : MergedStats)
+    {
+        DescriptionStats DescStats;
+        DescStats.Description    = it.first;
+        DescStats.NumAllocations = it.second.NumAllocations;
+        DescStats.TotalSize      = it.second.TotalSize;
+        Stats.emplace_back(std::move(DescStats));
+    }
+    return Stats;
+}
+
+void PooledRawMemoryAllocator::ResetStats()
+{
+    std::lock_guard<std::mutex> Lock{m_StatsMtx};
+    m_Stats.clear();
+}
+
+} // namespace Diligent
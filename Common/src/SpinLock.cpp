@@ -28,6 +28,21 @@
 
 #include <thread>
 
+#if defined(__linux__)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    define DILIGENT_PARK_FUTEX 1
+#elif defined(_WIN32)
+#    include "WinHPreface.h"
+#    include <Windows.h>
+#    include "WinHPostface.h"
+#    define DILIGENT_PARK_WAIT_ON_ADDRESS 1
+#else
+#    include <array>
+#    include <condition_variable>
+#endif
+
 #if defined(_MSC_VER) && ((_M_IX86_FP >= 2) || defined(_M_X64))
 #    include <emmintrin.h>
 #    define PAUSE _mm_pause
@@ -59,4 +74,82 @@ void SpinLock::Wait() noexcept
     std::this_thread::yield();
 }
 
+
+#if !defined(DILIGENT_PARK_FUTEX) && !defined(DILIGENT_PARK_WAIT_ON_ADDRESS)
+namespace
+{
+
+// Parked threads wait on one of a fixed number of slots selected by the lock address.
+// A slot may be shared by several locks, so all its waiters are woken up.
+struct ParkingSlot
+{
+    std::mutex              Mtx;
+    std::condition_variable CV;
+};
+
+ParkingSlot& GetParkingSlot(const void* pAddress)
+{
+    static std::array<ParkingSlot, 64> Slots;
+    return Slots[(reinterpret_cast<size_t>(pAddress) / sizeof(void*)) % Slots.size()];
+}
+
+} // namespace
+#endif
+
+void AdaptiveLock::LockContended() noexcept
+{
+    // Spin with exponential backoff, which is much cheaper than
+    // parking when the lock is released shortly.
+    constexpr size_t MaxSpinCount = 128;
+    for (size_t SpinCount = 1; SpinCount <= MaxSpinCount; SpinCount *= 2)
+    {
+        for (size_t i = 0; i < SpinCount; ++i)
+            PAUSE();
+
+        StateType Expected = Unlocked;
+        if (m_State.load(std::memory_order_relaxed) == Unlocked &&
+            m_State.compare_exchange_weak(Expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+    }
+
+    // Mark the lock as contended so that the owner wakes us up. Once a thread has parked,
+    // it always acquires the lock in the contended state, as there may be other waiters.
+    while (m_State.exchange(LockedWithWaiters, std::memory_order_acquire) != Unlocked)
+    {
+        Park();
+    }
+}
+
+void AdaptiveLock::Park() noexcept
+{
+#if defined(DILIGENT_PARK_FUTEX)
+    // The call returns immediately if the state has changed
+    syscall(SYS_futex, &m_State, FUTEX_WAIT_PRIVATE, LockedWithWaiters, nullptr, nullptr, 0);
+#elif defined(DILIGENT_PARK_WAIT_ON_ADDRESS)
+    StateType CompareValue = LockedWithWaiters;
+    WaitOnAddress(&m_State, &CompareValue, sizeof(CompareValue), INFINITE);
+#else
+    ParkingSlot&                 Slot = GetParkingSlot(this);
+    std::unique_lock<std::mutex> Lock{Slot.Mtx};
+    Slot.CV.wait(Lock, [this]() { return m_State.load(std::memory_order_relaxed) != LockedWithWaiters; });
+#endif
+}
+
+void AdaptiveLock::WakeOne() noexcept
+{
+#if defined(DILIGENT_PARK_FUTEX)
+    syscall(SYS_futex, &m_State, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(DILIGENT_PARK_WAIT_ON_ADDRESS)
+    WakeByAddressSingle(&m_State);
+#else
+    ParkingSlot& Slot = GetParkingSlot(this);
+    {
+        // Lock the mutex to make sure that the waiter either has not checked
+        // the state yet or is already waiting on the condition variable.
+        std::lock_guard<std::mutex> Lock{Slot.Mtx};
+    }
+    Slot.CV.notify_all();
+#endif
+}
+
 } // namespace Threading
@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TaskGraph.hpp"
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+TaskGraph::NodeId TaskGraph::AddTask(HandlerType Handler, float fPriority)
+{
+    DEV_CHECK_ERR(!m_Executed, "Tasks can't be added to the graph that has already been executed");
+    DEV_CHECK_ERR(Handler, "Task handler must not be null");
+
+    Node NewNode;
+    NewNode.Handler   = std::move(Handler);
+    NewNode.fPriority = fPriority;
+    m_Nodes.emplace_back(std::move(NewNode));
+
+    return static_cast<NodeId>(m_Nodes.size() - 1);
+}
+
+void TaskGraph::AddDependency(NodeId Task, NodeId Prerequisite)
+{
+    DEV_CHECK_ERR(!m_Executed, "Dependencies can't be added to the graph that has already been executed");
+    if (Task >= m_Nodes.size() || Prerequisite >= m_Nodes.size())
+    {
+        UNEXPECTED("Invalid task id");
+        return;
+    }
+    DEV_CHECK_ERR(Task != Prerequisite, "A task can't depend on itself");
+
+    m_Nodes[Task].Prerequisites.push_back(Prerequisite);
+}
+
+std::vector<TaskGraph::NodeId> TaskGraph::SortNodes() const
+{
+    const size_t NumNodes = m_Nodes.size();
+
+    std::vector<Uint32>              NumPendingPrerequisites(NumNodes);
+    std::vector<std::vector<NodeId>> Dependents(NumNodes);
+    for (NodeId i = 0; i < NumNodes; ++i)
+    {
+        NumPendingPrerequisites[i] = static_cast<Uint32>(m_Nodes[i].Prerequisites.size());
+        for (NodeId Prerequisite : m_Nodes[i].Prerequisites)
+            Dependents[Prerequisite].push_back(i);
+    }
+
+    std::vector<NodeId> SortedNodes;
+    SortedNodes.reserve(NumNodes);
+    for (NodeId i = 0; i < NumNodes; ++i)
+    {
+        if (NumPendingPrerequisites[i] == 0)
+            SortedNodes.push_back(i);
+    }
+
+    // Kahn's algorithm: SortedNodes also serves as the queue of nodes whose prerequisites
+    // have all been sorted.
+    for (size_t i = 0; i < SortedNodes.size(); ++i)
+    {
+        for (NodeId Dependent : Dependents[SortedNodes[i]])
+        {
+            VERIFY_EXPR(NumPendingPrerequisites[Dependent] > 0);
+            if (--NumPendingPrerequisites[Dependent] == 0)
+                SortedNodes.push_back(Dependent);
+        }
+    }
+
+    if (SortedNodes.size() != NumNodes)
+        SortedNodes.clear();
+
+    return SortedNodes;
+}
+
+bool TaskGraph::Execute(IThreadPool* pThreadPool)
+{
+    if (m_Executed)
+    {
+        LOG_ERROR_MESSAGE("The task graph has already been executed");
+        return false;
+    }
+
+    const std::vector<NodeId> SortedNodes = SortNodes();
+    if (SortedNodes.size() != m_Nodes.size())
+    {
+        LOG_ERROR_MESSAGE("The task graph contains a cycle");
+        return false;
+    }
+
+    m_Executed = true;
+
+    if (pThreadPool == nullptr)
+    {
+        for (NodeId i : SortedNodes)
+        {
+            m_Nodes[i].Handler(0);
+            m_Nodes[i].Handler = nullptr;
+        }
+        return true;
+    }
+
+    std::vector<IAsyncTask*> Prerequisites;
+    for (NodeId i : SortedNodes)
+    {
+        Node& CurrNode = m_Nodes[i];
+
+        // Since the nodes are enqueued in topological order, all prerequisite tasks are already created
+        Prerequisites.clear();
+        for (NodeId Prerequisite : CurrNode.Prerequisites)
+        {
+            VERIFY_EXPR(m_Nodes[Prerequisite].pTask);
+            Prerequisites.push_back(m_Nodes[Prerequisite].pTask);
+        }
+
+        CurrNode.pTask = EnqueueAsyncWork(
+            pThreadPool,
+            Prerequisites.data(),
+            static_cast<Uint32>(Prerequisites.size()),
+            [Handler = std::move(CurrNode.Handler)](Uint32 ThreadId) {
+                Handler(ThreadId);
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            CurrNode.fPriority);
+    }
+
+    return true;
+}
+
+bool TaskGraph::IsFinished() const
+{
+    if (!m_Executed)
+        return false;
+
+    for (const Node& CurrNode : m_Nodes)
+    {
+        if (CurrNode.pTask && !CurrNode.pTask->IsFinished())
+            return false;
+    }
+
+    return true;
+}
+
+void TaskGraph::WaitForCompletion() const
+{
+    DEV_CHECK_ERR(m_Executed, "The task graph has not been executed");
+
+    for (const Node& CurrNode : m_Nodes)
+    {
+        if (CurrNode.pTask)
+            CurrNode.pTask->WaitForCompletion();
+    }
+}
+
+} // namespace Diligent
@@ -31,10 +31,15 @@
 #include <thread>
 #include <map>
 #include <vector>
+#include <deque>
+#include <array>
 #include <condition_variable>
+#include <unordered_map>
+#include <memory>
 #include <cfloat>
 
 #include "PlatformMisc.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -43,6 +48,200 @@ AsyncTaskBase::~AsyncTaskBase()
 {
 }
 
+namespace
+{
+
+struct QueuedTaskInfo
+{
+    RefCntAutoPtr<IAsyncTask> pTask;
+
+    // All prerequisites of the task. Prerequisites enqueued into the same thread pool are
+    // tracked by the TaskDependencyTracker and are finished by the time the task is queued.
+    // Other prerequisites (e.g. tasks from other pools) are polled when the task is dequeued.
+    std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
+};
+
+// Keeps track of the tasks enqueued into the thread pool and their dependents.
+// A task that has unfinished prerequisites in the same pool is held by the tracker
+// and is added to the run queue only when its last prerequisite is finished, so that
+// worker threads do not waste time dequeuing and re-enqueuing tasks that are not ready.
+class TaskDependencyTracker
+{
+public:
+    // Registers the task and its dependencies.
+    //
+    // Returns true if the task is ready to be queued, and false if the task is waiting for
+    // its prerequisites. In the latter case, TaskInfo is moved into the tracker.
+    bool AddTask(QueuedTaskInfo& TaskInfo, IAsyncTask** ppPrerequisites, Uint32 NumPrerequisites)
+    {
+        IAsyncTask* const pTask = TaskInfo.pTask;
+
+        std::shared_ptr<WaitingTask> pWaitingTask;
+        for (Uint32 i = 0; i < NumPrerequisites; ++i)
+        {
+            IAsyncTask* const pPrereq = ppPrerequisites[i];
+            if (pPrereq == nullptr || pPrereq == pTask)
+                continue;
+
+            Shard&                      PrereqShard = GetShard(pPrereq);
+            std::lock_guard<std::mutex> Lock{PrereqShard.Mtx};
+
+            auto it = PrereqShard.Tasks.find(pPrereq);
+            if (it == PrereqShard.Tasks.end())
+            {
+                // The prerequisite is either finished or is not managed by this pool.
+                // In the latter case it will be polled when the task is dequeued.
+                continue;
+            }
+
+            if (!pWaitingTask)
+            {
+                pWaitingTask = std::make_shared<WaitingTask>();
+                m_NumWaitingTasks.fetch_add(1);
+            }
+            pWaitingTask->NumPendingPrerequisites.fetch_add(1);
+            it->second.Dependents.emplace_back(pWaitingTask);
+        }
+
+        {
+            Shard&                      TaskShard = GetShard(pTask);
+            std::lock_guard<std::mutex> Lock{TaskShard.Mtx};
+
+            TaskEntry& Entry = TaskShard.Tasks[pTask];
+            if (pWaitingTask)
+                Entry.pWaitingTask = pWaitingTask;
+        }
+
+        if (!pWaitingTask)
+            return true;
+
+        // NB: the task info must be set before the extra reference that prevents the counter
+        //     from reaching zero is released.
+        pWaitingTask->TaskInfo = std::move(TaskInfo);
+        if (pWaitingTask->NumPendingPrerequisites.fetch_add(-1) == 1 && !pWaitingTask->Claimed.exchange(true))
+        {
+            // All prerequisites have finished in the meantime
+            TaskInfo = std::move(pWaitingTask->TaskInfo);
+            m_NumWaitingTasks.fetch_add(-1);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Removes the task from the tracker and appends the dependent tasks that became ready to ReadyTasks.
+    //
+    // This method must be called when the task is finished. It must also be called when the task
+    // is removed from the queue. In this case, the dependents will poll the task status.
+    void RemoveTask(IAsyncTask* pTask, std::vector<QueuedTaskInfo>& ReadyTasks)
+    {
+        std::vector<std::shared_ptr<WaitingTask>> Dependents;
+        {
+            Shard&                      TaskShard = GetShard(pTask);
+            std::lock_guard<std::mutex> Lock{TaskShard.Mtx};
+
+            auto it = TaskShard.Tasks.find(pTask);
+            if (it == TaskShard.Tasks.end())
+                return;
+
+            Dependents = std::move(it->second.Dependents);
+            TaskShard.Tasks.erase(it);
+        }
+
+        for (std::shared_ptr<WaitingTask>& pDependent : Dependents)
+        {
+            if (pDependent->NumPendingPrerequisites.fetch_add(-1) == 1 && !pDependent->Claimed.exchange(true))
+            {
+                ReadyTasks.emplace_back(std::move(pDependent->TaskInfo));
+                // NB: the caller must queue the ready tasks while the finished task is still counted as running,
+                //     so that WaitForAllTasks() does not miss them.
+                m_NumWaitingTasks.fetch_add(-1);
+            }
+        }
+    }
+
+    // Removes the task that is waiting for its prerequisites.
+    // Returns false if the task is not waiting.
+    bool RemoveWaitingTask(IAsyncTask* pTask, std::vector<QueuedTaskInfo>& ReadyTasks)
+    {
+        {
+            Shard&                      TaskShard = GetShard(pTask);
+            std::lock_guard<std::mutex> Lock{TaskShard.Mtx};
+
+            auto it = TaskShard.Tasks.find(pTask);
+            if (it == TaskShard.Tasks.end() || !it->second.pWaitingTask)
+                return false;
+
+            if (it->second.pWaitingTask->Claimed.exchange(true))
+                return false; // The task has already been queued
+
+            m_NumWaitingTasks.fetch_add(-1);
+            // The task info will be released when the last prerequisite is finished
+        }
+
+        RemoveTask(pTask, ReadyTasks);
+        return true;
+    }
+
+    bool IsWaiting(IAsyncTask* pTask)
+    {
+        Shard&                      TaskShard = GetShard(pTask);
+        std::lock_guard<std::mutex> Lock{TaskShard.Mtx};
+
+        auto it = TaskShard.Tasks.find(pTask);
+        return it != TaskShard.Tasks.end() && it->second.pWaitingTask && !it->second.pWaitingTask->Claimed.load();
+    }
+
+    int GetNumWaitingTasks() const
+    {
+        return m_NumWaitingTasks.load();
+    }
+
+private:
+    struct WaitingTask
+    {
+        QueuedTaskInfo TaskInfo;
+
+        // The counter is initialized with one extra reference that is released by AddTask()
+        // after all prerequisites are registered.
+        std::atomic<int> NumPendingPrerequisites{1};
+
+        // Indicates that the task has been either queued or removed.
+        std::atomic<bool> Claimed{false};
+    };
+
+    struct TaskEntry
+    {
+        // Tasks that are waiting for this task to finish
+        std::vector<std::shared_ptr<WaitingTask>> Dependents;
+
+        // Non-null if this task is waiting for its own prerequisites
+        std::shared_ptr<WaitingTask> pWaitingTask;
+    };
+
+    // The tasks are distributed between several shards to reduce the lock contention
+    struct Shard
+    {
+        std::mutex                                 Mtx;
+        std::unordered_map<IAsyncTask*, TaskEntry> Tasks;
+    };
+    static constexpr size_t NumShards = 16;
+
+    Shard& GetShard(IAsyncTask* pTask)
+    {
+        // Discard the low bits that are the same for all objects due to alignment
+        const size_t Hash = reinterpret_cast<size_t>(pTask) >> 4;
+        return m_Shards[(Hash ^ (Hash >> 8)) % NumShards];
+    }
+
+private:
+    std::array<Shard, NumShards> m_Shards;
+
+    std::atomic<int> m_NumWaitingTasks{0};
+};
+
+} // namespace
+
 class ThreadPoolImpl final : public ObjectBase<IThreadPool>
 {
 public:
@@ -52,12 +251,19 @@ public:
                    const ThreadPoolCreateInfo& PoolCI) :
         TBase{pRefCounters}
     {
+        const Uint64 CoresMask = GetThreadPoolCoresMask(PoolCI.CorePolicy);
+
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
         {
             m_WorkerThreads.emplace_back(
-                [this, PoolCI, i] //
+                [this, PoolCI, CoresMask, i] //
                 {
+                    DILIGENT_PROFILE_SET_THREAD_NAME("Diligent thread pool worker");
+
+                    if (CoresMask != 0)
+                        PlatformMisc::SetCurrentThreadAffinity(CoresMask);
+
                     if (PoolCI.OnThreadStarted)
                         PoolCI.OnThreadStarted(i);
 
@@ -130,6 +336,7 @@ public:
             bool TaskFinished = false;
             if (PrerequisitesMet)
             {
+                DILIGENT_PROFILE_ZONE("ThreadPool task");
                 TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
                 ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
                 // NB: It is essential to set the task status after the Run() method returns.
@@ -141,14 +348,24 @@ public:
                               "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
             }
 
+            // Tasks whose last prerequisite was this task
+            std::vector<QueuedTaskInfo> ReadyTasks;
+            if (TaskFinished)
+                m_DependencyTracker.RemoveTask(TaskInfo.pTask, ReadyTasks);
+
             {
                 std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
 
+                // NB: ready tasks must be queued before the running task counter is decremented,
+                //     otherwise WaitForAllTasks() may miss them.
+                for (QueuedTaskInfo& ReadyTask : ReadyTasks)
+                    m_TasksQueue.emplace(ReadyTask.pTask->GetPriority(), std::move(ReadyTask));
+
                 const auto NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
 
                 if (TaskFinished)
                 {
-                    if (m_TasksQueue.empty() && NumRunningTasks == 0)
+                    if (m_TasksQueue.empty() && NumRunningTasks == 0 && m_DependencyTracker.GetNumWaitingTasks() == 0)
                     {
                         m_TasksFinishedCond.notify_one();
                     }
@@ -167,6 +384,7 @@ public:
             {
                 m_NextTaskCond.notify_one();
             }
+            NotifyReadyTasks(ReadyTasks.size());
         }
 
         return true;
@@ -180,30 +398,36 @@ public:
         if (pTask == nullptr)
             return;
 
-        {
-            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-            DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
 
-            QueuedTaskInfo TaskInfo;
-            TaskInfo.pTask = pTask;
-            if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+        QueuedTaskInfo TaskInfo;
+        TaskInfo.pTask = pTask;
+        if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+        {
+            TaskInfo.Prerequisites.reserve(NumPrerequisites);
+            float MinPrereqPriority = +FLT_MAX;
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
             {
-                TaskInfo.Prerequisites.reserve(NumPrerequisites);
-                float MinPrereqPriority = +FLT_MAX;
-                for (Uint32 i = 0; i < NumPrerequisites; ++i)
+                if (ppPrerequisites[i] != nullptr)
                 {
-                    if (ppPrerequisites[i] != nullptr)
-                    {
-                        TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
-                        MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
-                    }
-                }
-                if (pTask->GetPriority() > MinPrereqPriority)
-                {
-                    TaskInfo.pTask->SetPriority(MinPrereqPriority);
+                    TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
+                    MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
                 }
             }
+            if (pTask->GetPriority() > MinPrereqPriority)
+            {
+                TaskInfo.pTask->SetPriority(MinPrereqPriority);
+            }
+        }
 
+        if (!m_DependencyTracker.AddTask(TaskInfo, ppPrerequisites, ppPrerequisites != nullptr ? NumPrerequisites : 0))
+        {
+            // The task will be queued when its last prerequisite is finished
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
             m_TasksQueue.emplace(pTask->GetPriority(), std::move(TaskInfo));
         }
         m_NextTaskCond.notify_one();
@@ -212,12 +436,12 @@ public:
     virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0)
+        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0 || m_DependencyTracker.GetNumWaitingTasks() > 0)
         {
             m_TasksFinishedCond.wait(lock,
                                      [this] //
                                      {
-                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0;
+                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_DependencyTracker.GetNumWaitingTasks() == 0;
                                      } //
             );
         }
@@ -243,18 +467,47 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
     {
-        std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+        // Keep the removed task alive until it is removed from the dependency tracker
+        QueuedTaskInfo RemovedTask;
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
 
-        auto it = m_TasksQueue.begin();
-        while (it != m_TasksQueue.end() && it->second.pTask != pTask)
-            ++it;
-        if (it != m_TasksQueue.end())
+            auto it = m_TasksQueue.begin();
+            while (it != m_TasksQueue.end() && it->second.pTask != pTask)
+                ++it;
+            if (it != m_TasksQueue.end())
+            {
+                RemovedTask = std::move(it->second);
+                m_TasksQueue.erase(it);
+            }
+        }
+
+        // Dependents of the removed task are queued and will poll its status
+        std::vector<QueuedTaskInfo> ReadyTasks;
+
+        bool Removed = false;
+        if (RemovedTask.pTask)
         {
-            m_TasksQueue.erase(it);
-            return true;
+            m_DependencyTracker.RemoveTask(pTask, ReadyTasks);
+            Removed = true;
+        }
+        else
+        {
+            Removed = m_DependencyTracker.RemoveWaitingTask(pTask, ReadyTasks);
         }
 
-        return false;
+        if (Removed)
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            for (QueuedTaskInfo& ReadyTask : ReadyTasks)
+                m_TasksQueue.emplace(ReadyTask.pTask->GetPriority(), std::move(ReadyTask));
+
+            if (m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_DependencyTracker.GetNumWaitingTasks() == 0)
+                m_TasksFinishedCond.notify_one();
+        }
+        NotifyReadyTasks(ReadyTasks.size());
+
+        return Removed;
     }
 
     virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
@@ -277,7 +530,9 @@ public:
 
             return true;
         }
-        return false;
+
+        // Tasks that are waiting for their prerequisites will be queued with their current priority
+        return m_DependencyTracker.IsWaiting(pTask);
     }
 
     virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
@@ -311,7 +566,7 @@ public:
     Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        return StaticCast<Uint32>(m_TasksQueue.size());
+        return StaticCast<Uint32>(m_TasksQueue.size() + m_DependencyTracker.GetNumWaitingTasks());
     }
 
     virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
@@ -326,14 +581,20 @@ public:
         VERIFY_EXPR(m_NumRunningTasks.load() == 0);
     }
 
+private:
+    void NotifyReadyTasks(size_t NumReadyTasks)
+    {
+        if (NumReadyTasks == 1)
+            m_NextTaskCond.notify_one();
+        else if (NumReadyTasks > 1)
+            m_NextTaskCond.notify_all();
+    }
+
 private:
     std::vector<std::thread> m_WorkerThreads;
 
-    struct QueuedTaskInfo
-    {
-        RefCntAutoPtr<IAsyncTask>              pTask;
-        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
-    };
+    TaskDependencyTracker m_DependencyTracker;
+
     // Priority queue
     std::mutex                                                m_TasksQueueMtx;
     std::multimap<float, QueuedTaskInfo, std::greater<float>> m_TasksQueue;
@@ -347,9 +608,578 @@ private:
     std::atomic<int> m_NumRunningTasks{0};
 };
 
+class WorkStealingThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    static constexpr Uint32 MaxPriorityBuckets = 32;
+
+    WorkStealingThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                               const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        m_NumBuckets{std::max(std::min(PoolCI.NumPriorityBuckets, Uint32{MaxPriorityBuckets}), 1u)},
+        // When the pool is created with zero threads, the application calls ProcessTask() from its own
+        // threads. We still need at least one queue in this case.
+        m_Queues(std::max(PoolCI.NumThreads, size_t{1}))
+    {
+        const Uint64 CoresMask = GetThreadPoolCoresMask(PoolCI.CorePolicy);
+
+        m_WorkerThreads.reserve(PoolCI.NumThreads);
+        for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+        {
+            m_WorkerThreads.emplace_back(
+                [this, PoolCI, CoresMask, i] //
+                {
+                    DILIGENT_PROFILE_SET_THREAD_NAME("Diligent thread pool worker");
+
+                    if (CoresMask != 0)
+                        PlatformMisc::SetCurrentThreadAffinity(CoresMask);
+
+                    if (PoolCI.OnThreadStarted)
+                        PoolCI.OnThreadStarted(i);
+
+                    while (ProcessTask(i, /*WaitForTask =*/true))
+                    {
+                    }
+
+                    if (PoolCI.OnThreadExiting)
+                        PoolCI.OnThreadExiting(i);
+                });
+        }
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE ProcessTask(Uint32 ThreadId, bool WaitForTask) override final
+    {
+        const Uint32 QueueIdx = ThreadId % GetNumQueues();
+
+        QueuedTaskInfo TaskInfo;
+        while (!PopTask(QueueIdx, TaskInfo))
+        {
+            if (!WaitForTask)
+                return !m_Stop.load() || m_NumQueuedTasks.load() > 0;
+
+            std::unique_lock<std::mutex> lock{m_SleepMtx};
+            // NB: the sleeping worker counter must be incremented before the predicate is checked.
+            //     EnqueueTask() increments the queued task counter first and then checks the number
+            //     of sleeping workers, so at least one of the two threads is guaranteed to see the
+            //     other's update.
+            m_NumSleepingWorkers.fetch_add(1);
+            m_NextTaskCond.wait(lock,
+                                [this] //
+                                {
+                                    return m_Stop.load() || m_NumQueuedTasks.load() > 0;
+                                } //
+            );
+            m_NumSleepingWorkers.fetch_add(-1);
+
+            // m_Stop must be accessed under the mutex
+            if (m_Stop.load() && m_NumQueuedTasks.load() == 0)
+                return false;
+        }
+
+        // Check prerequisites
+        bool  PrerequisitesMet  = true;
+        float MinPrereqPriority = +FLT_MAX;
+        for (auto& pPrereq : TaskInfo.Prerequisites)
+        {
+            if (auto pPrereqTask = pPrereq.Lock())
+            {
+                if (!pPrereqTask->IsFinished())
+                {
+                    PrerequisitesMet  = false;
+                    MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
+                }
+            }
+        }
+
+        bool TaskFinished = false;
+        if (PrerequisitesMet)
+        {
+            // Tasks enqueued by this task will be placed into the queue of this worker
+            CurrentWorkerScope WorkerScope{this, QueueIdx};
+
+            DILIGENT_PROFILE_ZONE("ThreadPool task");
+            TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+            ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
+            // NB: It is essential to set the task status after the Run() method returns.
+            //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
+            //     it is guaranteed that the task is not executed by any thread.
+            TaskInfo.pTask->SetStatus(ReturnStatus);
+            TaskFinished = TaskInfo.pTask->IsFinished();
+            DEV_CHECK_ERR((TaskFinished || TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
+                          "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
+        }
+
+        // NB: all tasks must be pushed to the queue before the running task counter
+        //     is decremented, otherwise WaitForAllTasks() may see all counters at zero.
+        size_t NumTasksPushed = 0;
+        if (TaskFinished)
+        {
+            // Queue the tasks whose last prerequisite was this task
+            std::vector<QueuedTaskInfo> ReadyTasks;
+            m_DependencyTracker.RemoveTask(TaskInfo.pTask, ReadyTasks);
+            for (QueuedTaskInfo& ReadyTask : ReadyTasks)
+                PushTask(QueueIdx, std::move(ReadyTask));
+            NumTasksPushed = ReadyTasks.size();
+        }
+        else
+        {
+            // If prerequisites are not met or the task requested to be re-run,
+            // re-enqueue the task with the minimum prerequisite priority.
+            if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
+                TaskInfo.pTask->SetPriority(MinPrereqPriority);
+            PushTask(QueueIdx, std::move(TaskInfo));
+            NumTasksPushed = 1;
+        }
+
+        // NB: even if this task is not finished, the task that was pushed back to the queue
+        //     may have already been processed by another worker.
+        const auto NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
+        if (NumRunningTasks == 0)
+            NotifyIfAllTasksFinished();
+        for (size_t i = 0; i < NumTasksPushed; ++i)
+            WakeSleepingWorker();
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE EnqueueTask(IAsyncTask*  pTask,
+                                                IAsyncTask** ppPrerequisites,
+                                                Uint32       NumPrerequisites) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        QueuedTaskInfo TaskInfo;
+        TaskInfo.pTask = pTask;
+        if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+        {
+            TaskInfo.Prerequisites.reserve(NumPrerequisites);
+            float MinPrereqPriority = +FLT_MAX;
+            for (Uint32 i = 0; i < NumPrerequisites; ++i)
+            {
+                if (ppPrerequisites[i] != nullptr)
+                {
+                    TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
+                    MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
+                }
+            }
+            if (pTask->GetPriority() > MinPrereqPriority)
+            {
+                TaskInfo.pTask->SetPriority(MinPrereqPriority);
+            }
+        }
+
+        if (!m_DependencyTracker.AddTask(TaskInfo, ppPrerequisites, ppPrerequisites != nullptr ? NumPrerequisites : 0))
+        {
+            // The task will be queued when its last prerequisite is finished
+            return;
+        }
+
+        // Tasks enqueued from a worker thread go to that worker's queue to improve locality.
+        // Tasks enqueued from other threads are distributed between the queues in round-robin fashion.
+        const Uint32 QueueIdx = CurrentWorker.pPool == this ?
+            CurrentWorker.QueueIdx :
+            m_NextQueueIdx.fetch_add(1) % GetNumQueues();
+        PushTask(QueueIdx, std::move(TaskInfo));
+
+        WakeSleepingWorker();
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
+    {
+        std::unique_lock<std::mutex> lock{m_SleepMtx};
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return AllTasksFinished();
+                                 } //
+        );
+    }
+
+    virtual void DILIGENT_CALL_TYPE StopThreads() override final
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_SleepMtx};
+            // NB: even if the shared variable is atomic, it must be modified under the mutex
+            //     in order to correctly publish the modification to the waiting thread.
+            m_Stop.store(true);
+        }
+        m_NextTaskCond.notify_all();
+        for (std::thread& worker : m_WorkerThreads)
+            worker.join();
+
+        m_WorkerThreads.clear();
+    }
+
+    virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
+    {
+        // Keep the removed task alive until it is removed from the dependency tracker
+        QueuedTaskInfo RemovedTask;
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            for (Uint32 Bucket = 0; Bucket < m_NumBuckets && !RemovedTask.pTask; ++Bucket)
+            {
+                auto& Tasks = Queue.Buckets[Bucket];
+                auto  it    = FindTask(Tasks, pTask);
+                if (it != Tasks.end())
+                {
+                    RemovedTask = std::move(*it);
+                    Tasks.erase(it);
+                    if (Tasks.empty())
+                        Queue.NonEmptyBuckets.fetch_and(~(1u << Bucket));
+                    m_NumQueuedTasks.fetch_add(-1);
+                }
+            }
+            if (RemovedTask.pTask)
+                break;
+        }
+
+        // Dependents of the removed task are queued and will poll its status
+        std::vector<QueuedTaskInfo> ReadyTasks;
+
+        bool Removed = false;
+        if (RemovedTask.pTask)
+        {
+            m_DependencyTracker.RemoveTask(pTask, ReadyTasks);
+            Removed = true;
+        }
+        else
+        {
+            Removed = m_DependencyTracker.RemoveWaitingTask(pTask, ReadyTasks);
+        }
+
+        for (QueuedTaskInfo& ReadyTask : ReadyTasks)
+        {
+            PushTask(m_NextQueueIdx.fetch_add(1) % GetNumQueues(), std::move(ReadyTask));
+            WakeSleepingWorker();
+        }
+
+        if (Removed)
+            NotifyIfAllTasksFinished();
+
+        return Removed;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
+    {
+        const Uint32 NewBucket = GetBucket(pTask->GetPriority());
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            for (Uint32 Bucket = 0; Bucket < m_NumBuckets; ++Bucket)
+            {
+                auto& Tasks = Queue.Buckets[Bucket];
+                auto  it    = FindTask(Tasks, pTask);
+                if (it == Tasks.end())
+                    continue;
+
+                if (Bucket != NewBucket)
+                {
+                    Queue.Buckets[NewBucket].emplace_back(std::move(*it));
+                    Queue.NonEmptyBuckets.fetch_or(1u << NewBucket);
+                    Tasks.erase(it);
+                    if (Tasks.empty())
+                        Queue.NonEmptyBuckets.fetch_and(~(1u << Bucket));
+                }
+                return true;
+            }
+        }
+
+        // Tasks that are waiting for their prerequisites will be queued with their current priority
+        return m_DependencyTracker.IsWaiting(pTask);
+    }
+
+    virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
+    {
+        std::vector<std::pair<Uint32, QueuedTaskInfo>> ReprioritizationList;
+        for (WorkerQueue& Queue : m_Queues)
+        {
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+
+            for (Uint32 Bucket = 0; Bucket < m_NumBuckets; ++Bucket)
+            {
+                auto& Tasks = Queue.Buckets[Bucket];
+                for (auto it = Tasks.begin(); it != Tasks.end();)
+                {
+                    const Uint32 NewBucket = GetBucket(it->pTask->GetPriority());
+                    if (NewBucket != Bucket)
+                    {
+                        ReprioritizationList.emplace_back(NewBucket, std::move(*it));
+                        it = Tasks.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            for (auto& it : ReprioritizationList)
+            {
+                Queue.Buckets[it.first].emplace_back(std::move(it.second));
+            }
+            ReprioritizationList.clear();
+
+            Uint32 NonEmptyBuckets = 0;
+            for (Uint32 Bucket = 0; Bucket < m_NumBuckets; ++Bucket)
+            {
+                if (!Queue.Buckets[Bucket].empty())
+                    NonEmptyBuckets |= 1u << Bucket;
+            }
+            Queue.NonEmptyBuckets.store(NonEmptyBuckets);
+        }
+    }
+
+    Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
+    {
+        return StaticCast<Uint32>(m_NumQueuedTasks.load() + m_DependencyTracker.GetNumWaitingTasks());
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
+    {
+        return m_NumRunningTasks.load();
+    }
+
+    ~WorkStealingThreadPoolImpl()
+    {
+        StopThreads();
+        VERIFY_EXPR(m_NumQueuedTasks.load() == 0);
+        VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+    }
+
+private:
+    using TaskDeque = std::deque<QueuedTaskInfo>;
+
+    // Align the queues to avoid false sharing between workers
+    struct alignas(64) WorkerQueue
+    {
+        std::mutex                                Mtx;
+        std::array<TaskDeque, MaxPriorityBuckets> Buckets;
+
+        // Bit mask of non-empty buckets. The mask is only modified while the mutex is locked,
+        // but is read without the lock to quickly find the highest-priority task.
+        std::atomic<Uint32> NonEmptyBuckets{0};
+    };
+
+    // Identifies the pool and the queue of the worker thread that is currently running a task.
+    struct CurrentWorkerInfo
+    {
+        const WorkStealingThreadPoolImpl* pPool    = nullptr;
+        Uint32                            QueueIdx = 0;
+    };
+    static thread_local CurrentWorkerInfo CurrentWorker;
+
+    class CurrentWorkerScope
+    {
+    public:
+        CurrentWorkerScope(const WorkStealingThreadPoolImpl* pPool, Uint32 QueueIdx) :
+            m_PrevWorker{CurrentWorker}
+        {
+            CurrentWorker = {pPool, QueueIdx};
+        }
+        ~CurrentWorkerScope()
+        {
+            CurrentWorker = m_PrevWorker;
+        }
+
+    private:
+        const CurrentWorkerInfo m_PrevWorker;
+    };
+
+    Uint32 GetNumQueues() const
+    {
+        return StaticCast<Uint32>(m_Queues.size());
+    }
+
+    Uint32 GetBucket(float Priority) const
+    {
+        // NB: negated comparison also handles NaNs
+        if (!(Priority >= 1.f))
+            return 0;
+        if (Priority >= static_cast<float>(m_NumBuckets - 1))
+            return m_NumBuckets - 1;
+        return static_cast<Uint32>(Priority);
+    }
+
+    static TaskDeque::iterator FindTask(TaskDeque& Tasks, IAsyncTask* pTask)
+    {
+        return std::find_if(Tasks.begin(), Tasks.end(), [pTask](const QueuedTaskInfo& Info) { return Info.pTask == pTask; });
+    }
+
+    void PushTask(Uint32 QueueIdx, QueuedTaskInfo&& TaskInfo)
+    {
+        const Uint32 Bucket = GetBucket(TaskInfo.pTask->GetPriority());
+
+        WorkerQueue&                Queue = m_Queues[QueueIdx];
+        std::lock_guard<std::mutex> lock{Queue.Mtx};
+        Queue.Buckets[Bucket].emplace_back(std::move(TaskInfo));
+        Queue.NonEmptyBuckets.fetch_or(1u << Bucket);
+        m_NumQueuedTasks.fetch_add(1);
+    }
+
+    bool TryPopTask(Uint32 QueueIdx, Uint32 Bucket, QueuedTaskInfo& TaskInfo)
+    {
+        WorkerQueue&                Queue = m_Queues[QueueIdx];
+        std::lock_guard<std::mutex> lock{Queue.Mtx};
+
+        TaskDeque& Tasks = Queue.Buckets[Bucket];
+        if (Tasks.empty())
+            return false;
+
+        TaskInfo = std::move(Tasks.front());
+        Tasks.pop_front();
+        if (Tasks.empty())
+            Queue.NonEmptyBuckets.fetch_and(~(1u << Bucket));
+
+        // NB: we must increment the running task counter before decrementing the queued
+        //     task counter, otherwise WaitForAllTasks() may miss the task.
+        m_NumRunningTasks.fetch_add(1);
+        m_NumQueuedTasks.fetch_add(-1);
+        return true;
+    }
+
+    bool PopTask(Uint32 QueueIdx, QueuedTaskInfo& TaskInfo)
+    {
+        const Uint32 NumQueues = GetNumQueues();
+        while (m_NumQueuedTasks.load() > 0)
+        {
+            // Find the queue that contains the task in the highest-priority bucket.
+            // The search starts with the worker's own queue so that it wins the ties.
+            Uint32 BestQueue  = QueueIdx;
+            Uint32 BestBucket = 0;
+            bool   Found      = false;
+            for (Uint32 i = 0; i < NumQueues; ++i)
+            {
+                const Uint32 Queue           = (QueueIdx + i) % NumQueues;
+                const Uint32 NonEmptyBuckets = m_Queues[Queue].NonEmptyBuckets.load(std::memory_order_relaxed);
+                if (NonEmptyBuckets == 0)
+                    continue;
+
+                const Uint32 Bucket = PlatformMisc::GetMSB(NonEmptyBuckets);
+                if (!Found || Bucket > BestBucket)
+                {
+                    BestQueue  = Queue;
+                    BestBucket = Bucket;
+                    Found      = true;
+                }
+            }
+
+            if (!Found)
+            {
+                // The task is being pushed to the queue by another thread
+                return false;
+            }
+
+            if (TryPopTask(BestQueue, BestBucket, TaskInfo))
+                return true;
+        }
+        return false;
+    }
+
+    void WakeSleepingWorker()
+    {
+        // Only touch the mutex if there are workers waiting for the tasks
+        if (m_NumSleepingWorkers.load() > 0)
+        {
+            {
+                // Lock the mutex to make sure that the worker either has not checked the predicate yet
+                // or is already waiting on the condition variable.
+                std::lock_guard<std::mutex> lock{m_SleepMtx};
+            }
+            m_NextTaskCond.notify_one();
+        }
+    }
+
+    bool AllTasksFinished() const
+    {
+        return m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_DependencyTracker.GetNumWaitingTasks() == 0;
+    }
+
+    void NotifyIfAllTasksFinished()
+    {
+        if (!AllTasksFinished())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock{m_SleepMtx};
+        }
+        m_TasksFinishedCond.notify_all();
+    }
+
+private:
+    const Uint32 m_NumBuckets;
+
+    std::vector<std::thread> m_WorkerThreads;
+    std::vector<WorkerQueue> m_Queues;
+
+    TaskDependencyTracker m_DependencyTracker;
+
+    std::atomic<Uint32> m_NextQueueIdx{0};
+
+    // The mutex is only used to put the idle worker threads to sleep and to wait for all tasks.
+    std::mutex              m_SleepMtx;
+    std::condition_variable m_NextTaskCond{};
+    std::condition_variable m_TasksFinishedCond{};
+    std::atomic<bool>       m_Stop{false};
+
+    std::atomic<int> m_NumSleepingWorkers{0};
+    std::atomic<int> m_NumQueuedTasks{0};
+    std::atomic<int> m_NumRunningTasks{0};
+};
+
+thread_local WorkStealingThreadPoolImpl::CurrentWorkerInfo WorkStealingThreadPoolImpl::CurrentWorker;
+
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
 {
-    return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+    switch (ThreadPoolCI.Scheduler)
+    {
+        case THREAD_POOL_SCHEDULER_PRIORITY_QUEUE:
+            return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
+
+        case THREAD_POOL_SCHEDULER_WORK_STEALING:
+            return RefCntAutoPtr<WorkStealingThreadPoolImpl>{MakeNewRCObj<WorkStealingThreadPoolImpl>()(ThreadPoolCI)};
+
+        default:
+            UNEXPECTED("Unexpected thread pool scheduler type");
+            return {};
+    }
+}
+
+Uint64 GetThreadPoolCoresMask(THREAD_POOL_CORE_POLICY Policy)
+{
+    if (Policy == THREAD_POOL_CORE_POLICY_ANY)
+        return 0;
+
+    const CPUTopology Topology = PlatformMisc::GetCPUTopology();
+    switch (Policy)
+    {
+        case THREAD_POOL_CORE_POLICY_PERFORMANCE:
+            // Restricting threads on a non-hybrid CPU is pointless
+            return Topology.IsHybrid() ? Topology.PerformanceCoresMask : 0;
+
+        case THREAD_POOL_CORE_POLICY_EFFICIENCY:
+            if (!Topology.IsHybrid() || Topology.EfficiencyCoresMask == 0)
+            {
+                LOG_INFO_MESSAGE("Efficiency cores are not available: thread pool worker threads will not be restricted");
+                return 0;
+            }
+            return Topology.EfficiencyCoresMask;
+
+        case THREAD_POOL_CORE_POLICY_PHYSICAL:
+            return Topology.NumPhysicalCores < Topology.LogicalCores.size() ? Topology.PhysicalCoresMask : 0;
+
+        default:
+            UNEXPECTED("Unexpected core policy");
+            return 0;
+    }
 }
 
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
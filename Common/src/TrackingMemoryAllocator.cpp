@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "TrackingMemoryAllocator.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <iomanip>
+
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Every allocation is preceded by the header that references the description counters
+struct AllocationHeader
+{
+    TrackingMemoryAllocator::DescCounters* pCounters;
+
+    // Requested allocation size
+    size_t Size;
+
+    // Offset from the start of the block returned by the base allocator to the returned pointer
+    size_t Offset;
+};
+
+// Keep the alignment of the blocks returned by the base allocator
+constexpr size_t HeaderAlignment = 16;
+constexpr size_t HeaderSize      = (sizeof(AllocationHeader) + HeaderAlignment - 1) / HeaderAlignment * HeaderAlignment;
+
+AllocationHeader& GetHeader(void* Ptr)
+{
+    return *(reinterpret_cast<AllocationHeader*>(Ptr) - 1);
+}
+
+struct DescCacheEntry
+{
+    UniqueIdentifier                       AllocatorId = 0;
+    const Char*                            Description = nullptr;
+    TrackingMemoryAllocator::DescCounters* pCounters   = nullptr;
+};
+
+constexpr size_t DescCacheSize = 64;
+
+thread_local DescCacheEntry t_DescCache[DescCacheSize];
+
+} // namespace
+
+
+TrackingMemoryAllocator::TrackingMemoryAllocator(IMemoryAllocator& BaseAllocator) :
+    m_BaseAllocator{BaseAllocator}
+{
+}
+
+TrackingMemoryAllocator::~TrackingMemoryAllocator()
+{
+}
+
+TrackingMemoryAllocator::DescCounters& TrackingMemoryAllocator::FindCounters(const Char* dbgDescription)
+{
+    std::lock_guard<std::mutex> Lock{m_CountersMtx};
+
+    auto& pCounters = m_Counters[dbgDescription];
+    if (!pCounters)
+        pCounters = std::make_unique<DescCounters>();
+    return *pCounters;
+}
+
+TrackingMemoryAllocator::DescCounters& TrackingMemoryAllocator::GetCounters(const Char* dbgDescription)
+{
+    // Descriptions are usually string literals, so the pointer identifies the description.
+    // Low bits of the pointer are skipped as string literals are often aligned.
+    const size_t    Slot  = (reinterpret_cast<size_t>(dbgDescription) >> 4) % DescCacheSize;
+    DescCacheEntry& Entry = t_DescCache[Slot];
+    const auto      ID    = m_ID.GetID();
+    if (Entry.AllocatorId != ID || Entry.Description != dbgDescription)
+    {
+        Entry.AllocatorId = ID;
+        Entry.Description = dbgDescription;
+        Entry.pCounters   = &FindCounters(dbgDescription);
+    }
+    return *Entry.pCounters;
+}
+
+void* TrackingMemoryAllocator::TrackAllocation(void* pBlock, size_t Offset, size_t Size, const Char* dbgDescription)
+{
+    if (pBlock == nullptr)
+        return nullptr;
+
+    DescCounters& Counters = GetCounters(dbgDescription);
+    Counters.LiveSize.fetch_add(static_cast<Int64>(Size), std::memory_order_relaxed);
+    Counters.NumLiveAllocations.fetch_add(1, std::memory_order_relaxed);
+    Counters.NumAllocations.fetch_add(1, std::memory_order_relaxed);
+    Counters.TotalSize.fetch_add(Size, std::memory_order_relaxed);
+    Counters.NumIntervalAllocations.fetch_add(1, std::memory_order_relaxed);
+    Counters.IntervalSize.fetch_add(Size, std::memory_order_relaxed);
+
+    void* Ptr        = static_cast<Uint8*>(pBlock) + Offset;
+    auto& Header     = GetHeader(Ptr);
+    Header.pCounters = &Counters;
+    Header.Size      = Size;
+    Header.Offset    = Offset;
+
+    return Ptr;
+}
+
+void* TrackingMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    void* pBlock = m_BaseAllocator.Allocate(Size + HeaderSize, dbgDescription, dbgFileName, dbgLineNumber);
+    return TrackAllocation(pBlock, HeaderSize, Size, dbgDescription);
+}
+
+void* TrackingMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+
+    // The offset keeps the returned pointer aligned and leaves room for the header
+    const size_t Offset = AlignUp(HeaderSize, Alignment);
+
+    void* pBlock = m_BaseAllocator.AllocateAligned(Size + Offset, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+    return TrackAllocation(pBlock, Offset, Size, dbgDescription);
+}
+
+void TrackingMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const auto& Header = GetHeader(Ptr);
+    VERIFY(Header.pCounters != nullptr, "The memory was not allocated by this allocator or the header is corrupted.");
+    Header.pCounters->LiveSize.fetch_sub(static_cast<Int64>(Header.Size), std::memory_order_relaxed);
+    Header.pCounters->NumLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    m_BaseAllocator.Free(static_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+void TrackingMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr == nullptr)
+        return;
+
+    const auto& Header = GetHeader(Ptr);
+    VERIFY(Header.pCounters != nullptr, "The memory was not allocated by this allocator or the header is corrupted.");
+    Header.pCounters->LiveSize.fetch_sub(static_cast<Int64>(Header.Size), std::memory_order_relaxed);
+    Header.pCounters->NumLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    m_BaseAllocator.FreeAligned(static_cast<Uint8*>(Ptr) - Header.Offset);
+}
+
+std::vector<TrackingMemoryAllocator::DescriptionStats> TrackingMemoryAllocator::GetStats() const
+{
+    // The same description may come from different string literals
+    std::map<std::string, DescriptionStats> MergedStats;
+
+    double IntervalDuration = 0;
+    {
+        std::lock_guard<std::mutex> Lock{m_CountersMtx};
+        IntervalDuration = m_IntervalTimer.GetElapsedTime();
+        for (const auto& it : m_Counters)
+        {
+            const DescCounters& Counters = *it.second;
+
+            auto& Stats = MergedStats[it.first != nullptr ? it.first : "<Unknown>"];
+            // Live counters may temporarily be negative if the memory is released by
+            // another thread while the statistics are being read
+            Stats.LiveSize += static_cast<Uint64>(std::max(Counters.LiveSize.load(std::memory_order_relaxed), Int64{0}));
+            Stats.NumLiveAllocations += static_cast<Uint64>(std::max(Counters.NumLiveAllocations.load(std::memory_order_relaxed), Int64{0}));
+            Stats.NumAllocations += Counters.NumAllocations.load(std::memory_order_relaxed);
+            Stats.TotalSize += Counters.TotalSize.load(std::memory_order_relaxed);
+            Stats.NumIntervalAllocations += Counters.NumIntervalAllocations.load(std::memory_order_relaxed);
+            Stats.IntervalSize += Counters.IntervalSize.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::vector<DescriptionStats> Stats;
+    Stats.reserve(MergedStats.size());
+    for (auto& it : MergedStats)
+    {
+        DescriptionStats& DescStats = it.second;
+        DescStats.Description       = it.first;
+        DescStats.AllocationRate    = IntervalDuration > 0 ? static_cast<double>(DescStats.NumIntervalAllocations) / IntervalDuration : 0;
+        Stats.emplace_back(std::move(DescStats));
+    }
+    return Stats;
+}
+
+void TrackingMemoryAllocator::StartInterval()
+{
+    std::lock_guard<std::mutex> Lock{m_CountersMtx};
+    for (auto& it : m_Counters)
+    {
+        it.second->NumIntervalAllocations.store(0, std::memory_order_relaxed);
+        it.second->IntervalSize.store(0, std::memory_order_relaxed);
+    }
+    m_IntervalTimer.Restart();
+}
+
+std::string TrackingMemoryAllocator::GetReport(ReportSortOrder SortOrder) const
+{
+    std::vector<DescriptionStats> Stats = GetStats();
+    std::sort(Stats.begin(), Stats.end(),
+              [SortOrder](const DescriptionStats& lhs, const DescriptionStats& rhs) //
+              {
+                  if (SortOrder == ReportSortOrder::AllocationRate && lhs.NumIntervalAllocations != rhs.NumIntervalAllocations)
+                      return lhs.NumIntervalAllocations > rhs.NumIntervalAllocations;
+                  if (lhs.LiveSize != rhs.LiveSize)
+                      return lhs.LiveSize > rhs.LiveSize;
+                  return lhs.Description < rhs.Description;
+              });
+
+    Uint64 TotalLiveSize        = 0;
+    Uint64 TotalLiveAllocations = 0;
+    for (const auto& DescStats : Stats)
+    {
+        TotalLiveSize += DescStats.LiveSize;
+        TotalLiveAllocations += DescStats.NumLiveAllocations;
+    }
+
+    std::stringstream ss;
+    ss << "Memory allocations: " << TotalLiveSize << " bytes in " << TotalLiveAllocations << " live allocations\n"
+       << std::setw(14) << "Live bytes" << std::setw(12) << "Live allocs"
+       << std::setw(14) << "Allocs" << std::setw(14) << "Interval" << std::setw(12) << "Allocs/s"
+       << "  Description\n";
+    for (const auto& DescStats : Stats)
+    {
+        ss << std::setw(14) << DescStats.LiveSize
+           << std::setw(12) << DescStats.NumLiveAllocations
+           << std::setw(14) << DescStats.NumAllocations
+           << std::setw(14) << DescStats.NumIntervalAllocations
+           << std::setw(12) << std::fixed << std::setprecision(1) << DescStats.AllocationRate
+           << "  " << DescStats.Description << '\n';
+    }
+    return ss.str();
+}
+
+} // namespace Diligent
@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BuildArchive function
+
+#include "ArchiveManifest.hpp"
+#include "../../interface/ArchiverFactory.h"
+#include "../../../../Primitives/interface/DataBlob.h"
+
+namespace Diligent
+{
+
+/// Archive build attributes
+struct ArchiveBuildAttribs
+{
+    /// Archiver factory that is used to create the serialization device and the archiver.
+    IArchiverFactory* pArchiverFactory = nullptr;
+
+    /// An optional thread pool that is used to compile shaders and pipeline states in parallel.
+    /// If null, all objects are compiled by the calling thread.
+    IThreadPool* pThreadPool = nullptr;
+
+    /// An optional semicolon-separated list of directories that is searched for shader
+    /// files before the directories listed in the manifest.
+    const char* SearchDirectories = nullptr;
+};
+
+/// Archive build statistics
+struct ArchiveBuildStats
+{
+    /// The number of shader permutations compiled.
+    Uint32 NumShaders = 0;
+
+    /// The number of pipeline state permutations created.
+    Uint32 NumPipelines = 0;
+
+    /// The number of shaders and pipeline states that failed to compile.
+    Uint32 NumErrors = 0;
+};
+
+/// Compiles all shader and pipeline state permutations described by the manifest
+/// for all requested backends and packs them into a single device object archive.
+
+/// \param [in]  Manifest  - Archive manifest, see Diligent::ArchiveManifest.
+/// \param [in]  Attribs   - Build attributes, see Diligent::ArchiveBuildAttribs.
+/// \param [out] ppArchive - Memory address where a pointer to the archive data will be written.
+/// \param [out] pStats    - Optional pointer to the build statistics.
+/// \return     true if all objects were compiled and the archive was created, and false otherwise.
+///
+/// \remarks    Every combination of permutation macro values of a shader produces a separate shader
+///             named Name[MACRO1=Value1,MACRO2=Value2]. A pipeline is created for every combination
+///             of permutation macros of its shaders and is named the same way.
+///             Shaders that are not used by any pipeline are added to the archive as standalone shaders.
+///
+///             Identical bytecode is stored in the archive only once: the archiver deduplicates
+///             device-specific shader data by its hash.
+bool BuildArchive(const ArchiveManifest&     Manifest,
+                  const ArchiveBuildAttribs& Attribs,
+                  IDataBlob**                ppArchive,
+                  ArchiveBuildStats*         pStats = nullptr);
+
+} // namespace Diligent
@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ArchiveManifest struct and manifest parsing functions
+
+#include <string>
+#include <vector>
+
+#include "../../interface/Archiver.h"
+#include "../../../GraphicsEngine/interface/PipelineState.h"
+
+namespace Diligent
+{
+
+/// Describes shaders, shader permutations and pipeline states that are packed
+/// into a device object archive by the archive builder.
+///
+/// The manifest is a text file that consists of sections. Every section starts with
+/// a header in square brackets followed by 'Key = Value' lines. Lines that start with
+/// '#' or ';' are comments. Section and key names are case-insensitive.
+///
+///     [Options]
+///     Devices           = Vulkan, D3D12
+///     SearchDirectories = shaders;shaders/include
+///
+///     [Shader: BlurCS]
+///     Type         = CS
+///     File         = Blur.csh
+///     EntryPoint   = main
+///     Language     = HLSL
+///     Macros       = TILE_SIZE=8
+///     Permutations = HORIZONTAL=0|1, QUALITY=0|1|2
+///
+///     [ComputePipeline: Blur]
+///     CS = BlurCS
+///
+///     [GraphicsPipeline: Copy]
+///     VS          = CopyVS
+///     PS          = CopyPS
+///     RTVFormats  = RGBA8_UNORM_SRGB
+///     DSVFormat   = D32_FLOAT
+///     InputLayout = FLOAT32x3, UINT8x4N
+struct ArchiveManifest
+{
+    /// A macro whose values are enumerated to produce shader permutations.
+    struct Permutation
+    {
+        std::string              Name;
+        std::vector<std::string> Values;
+    };
+
+    struct Shader
+    {
+        std::string Name;
+        SHADER_TYPE Type = SHADER_TYPE_UNKNOWN;
+        std::string FilePath;
+        std::string EntryPoint = "main";
+
+        SHADER_SOURCE_LANGUAGE SourceLanguage = SHADER_SOURCE_LANGUAGE_DEFAULT;
+        SHADER_COMPILER        Compiler       = SHADER_COMPILER_DEFAULT;
+
+        /// Macros that are defined for every permutation.
+        std::vector<std::pair<std::string, std::string>> Macros;
+
+        /// Macros whose values are enumerated. Every combination of values
+        /// produces a separate shader.
+        std::vector<Permutation> Permutations;
+
+        bool UseCombinedTextureSamplers = false;
+    };
+
+    struct Pipeline
+    {
+        std::string   Name;
+        PIPELINE_TYPE Type = PIPELINE_TYPE_GRAPHICS;
+
+        /// Shader stages and names of the shaders in the manifest.
+        std::vector<std::pair<SHADER_TYPE, std::string>> Shaders;
+
+        SHADER_RESOURCE_VARIABLE_TYPE DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+
+        // Graphics pipeline attributes
+        std::vector<TEXTURE_FORMAT> RTVFormats;
+        TEXTURE_FORMAT              DSVFormat   = TEX_FORMAT_UNKNOWN;
+        PRIMITIVE_TOPOLOGY          Topology    = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        CULL_MODE                   CullMode    = CULL_MODE_BACK;
+        bool                        DepthEnable = true;
+        std::vector<LayoutElement>  InputLayout;
+    };
+
+    /// Backends for which the archive data is produced.
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+
+    /// Semicolon-separated list of shader search directories.
+    std::string SearchDirectories;
+
+    std::vector<Shader>   Shaders;
+    std::vector<Pipeline> Pipelines;
+
+    /// Returns the shader with the given name, or null if there is no such shader.
+    const Shader* FindShader(const std::string& Name) const;
+};
+
+/// Parses the archive manifest text.
+
+/// \param [in]  Text     - Manifest text.
+/// \param [in]  Length   - Text length.
+/// \param [out] Manifest - Parsed manifest.
+/// \return     true if the manifest was parsed successfully, and false otherwise.
+///             All errors are written to the log.
+bool ParseArchiveManifest(const char* Text, size_t Length, ArchiveManifest& Manifest);
+
+/// Loads and parses the archive manifest file, see ParseArchiveManifest().
+bool LoadArchiveManifest(const char* FilePath, ArchiveManifest& Manifest);
+
+/// Macro definitions of one permutation
+using PermutationMacros = std::vector<std::pair<std::string, std::string>>;
+
+/// Enumerates all combinations of the permutation macro values.
+
+/// \remarks  The last permutation changes fastest. If there are no permutations,
+///           a single empty combination is returned.
+std::vector<PermutationMacros> EnumeratePermutations(const std::vector<ArchiveManifest::Permutation>& Permutations);
+
+/// Returns the name of the object permutation, e.g. "Blur[HORIZONTAL=1,QUALITY=2]".
+/// If there are no macros, the name is returned as is.
+std::string GetPermutationName(const std::string& Name, const PermutationMacros& Macros);
+
+} // namespace Diligent
@@ -0,0 +1,366 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ArchiveBuilder.hpp"
+
+#include <unordered_map>
+
+#include "Archiver.h"
+#include "SerializationDevice.h"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct ShaderJob
+{
+    const ArchiveManifest::Shader* pShader = nullptr;
+
+    std::string       Name;
+    PermutationMacros Macros;
+
+    RefCntAutoPtr<IShader> pSerializedShader;
+    bool                   IsUsedByPipeline = false;
+};
+
+struct PipelineJob
+{
+    const ArchiveManifest::Pipeline* pPipeline = nullptr;
+
+    std::string Name;
+
+    // Indices of the shader jobs, in the same order as pPipeline->Shaders
+    std::vector<size_t> ShaderJobs;
+
+    RefCntAutoPtr<IPipelineState> pSerializedPSO;
+};
+
+// Returns the permutations of all shaders used by the pipeline.
+// Permutations with the same name are merged.
+std::vector<ArchiveManifest::Permutation> GetPipelinePermutations(const ArchiveManifest& Manifest, const ArchiveManifest::Pipeline& Pipeline)
+{
+    std::vector<ArchiveManifest::Permutation> Permutations;
+    for (const auto& Stage : Pipeline.Shaders)
+    {
+        const auto* pShader = Manifest.FindShader(Stage.second);
+        VERIFY_EXPR(pShader != nullptr);
+        for (const auto& Perm : pShader->Permutations)
+        {
+            bool Found = false;
+            for (const auto& Existing : Permutations)
+                Found = Found || Existing.Name == Perm.Name;
+            if (!Found)
+                Permutations.push_back(Perm);
+        }
+    }
+    return Permutations;
+}
+
+RefCntAutoPtr<IShader> CreateSerializedShader(ISerializationDevice*                 pDevice,
+                                              IShaderSourceInputStreamFactory*      pSourceFactory,
+                                              const ShaderJob&                      Job,
+                                              ARCHIVE_DEVICE_DATA_FLAGS             DeviceFlags)
+{
+    const auto& Shader = *Job.pShader;
+
+    std::vector<ShaderMacro> Macros;
+    Macros.reserve(Shader.Macros.size() + Job.Macros.size());
+    for (const auto& Macro : Shader.Macros)
+        Macros.emplace_back(Macro.first.c_str(), Macro.second.c_str());
+    for (const auto& Macro : Job.Macros)
+        Macros.emplace_back(Macro.first.c_str(), Macro.second.c_str());
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc.Name                       = Job.Name.c_str();
+    ShaderCI.Desc.ShaderType                 = Shader.Type;
+    ShaderCI.Desc.UseCombinedTextureSamplers = Shader.UseCombinedTextureSamplers;
+    ShaderCI.FilePath                        = Shader.FilePath.c_str();
+    ShaderCI.EntryPoint                      = Shader.EntryPoint.c_str();
+    ShaderCI.SourceLanguage                  = Shader.SourceLanguage;
+    ShaderCI.ShaderCompiler                  = Shader.Compiler;
+    ShaderCI.pShaderSourceStreamFactory      = pSourceFactory;
+    ShaderCI.Macros                          = {Macros.data(), static_cast<Uint32>(Macros.size())};
+
+    ShaderArchiveInfo ArchiveInfo;
+    ArchiveInfo.DeviceFlags = DeviceFlags;
+
+    RefCntAutoPtr<IShader> pSerializedShader;
+    pDevice->CreateShader(ShaderCI, ArchiveInfo, &pSerializedShader);
+    return pSerializedShader;
+}
+
+RefCntAutoPtr<IPipelineState> CreateSerializedPipeline(ISerializationDevice*            pDevice,
+                                                       const PipelineJob&               Job,
+                                                       const std::vector<ShaderJob>&    ShaderJobs,
+                                                       ARCHIVE_DEVICE_DATA_FLAGS        DeviceFlags)
+{
+    const auto& Pipeline = *Job.pPipeline;
+
+    PipelineStateArchiveInfo ArchiveInfo;
+    ArchiveInfo.DeviceFlags = DeviceFlags;
+
+    RefCntAutoPtr<IPipelineState> pSerializedPSO;
+    if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+    {
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = Job.Name.c_str();
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = Pipeline.DefaultVariableType;
+        PSOCreateInfo.pCS                                        = ShaderJobs[Job.ShaderJobs[0]].pSerializedShader;
+        pDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+    }
+    else
+    {
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                               = Job.Name.c_str();
+        PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = Pipeline.DefaultVariableType;
+
+        auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+        GraphicsPipeline.NumRenderTargets = static_cast<Uint8>(Pipeline.RTVFormats.size());
+        for (size_t rt = 0; rt < Pipeline.RTVFormats.size(); ++rt)
+            GraphicsPipeline.RTVFormats[rt] = Pipeline.RTVFormats[rt];
+        GraphicsPipeline.DSVFormat                    = Pipeline.DSVFormat;
+        GraphicsPipeline.PrimitiveTopology            = Pipeline.Topology;
+        GraphicsPipeline.RasterizerDesc.CullMode      = Pipeline.CullMode;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = Pipeline.DepthEnable && Pipeline.DSVFormat != TEX_FORMAT_UNKNOWN;
+        GraphicsPipeline.InputLayout.LayoutElements   = Pipeline.InputLayout.data();
+        GraphicsPipeline.InputLayout.NumElements      = static_cast<Uint32>(Pipeline.InputLayout.size());
+
+        for (size_t s = 0; s < Pipeline.Shaders.size(); ++s)
+        {
+            IShader* pShader = ShaderJobs[Job.ShaderJobs[s]].pSerializedShader;
+            switch (Pipeline.Shaders[s].first)
+            {
+                // clang-format off
+                case SHADER_TYPE_VERTEX:        PSOCreateInfo.pVS = pShader; break;
+                case SHADER_TYPE_PIXEL:         PSOCreateInfo.pPS = pShader; break;
+                case SHADER_TYPE_GEOMETRY:      PSOCreateInfo.pGS = pShader; break;
+                case SHADER_TYPE_HULL:          PSOCreateInfo.pHS = pShader; break;
+                case SHADER_TYPE_DOMAIN:        PSOCreateInfo.pDS = pShader; break;
+                case SHADER_TYPE_AMPLIFICATION: PSOCreateInfo.pAS = pShader; break;
+                case SHADER_TYPE_MESH:          PSOCreateInfo.pMS = pShader; break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unexpected shader type");
+            }
+        }
+        if (PSOCreateInfo.pMS != nullptr)
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_MESH;
+
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+    }
+
+    return pSerializedPSO;
+}
+
+} // namespace
+
+bool BuildArchive(const ArchiveManifest&     Manifest,
+                  const ArchiveBuildAttribs& Attribs,
+                  IDataBlob**                ppArchive,
+                  ArchiveBuildStats*         pStats)
+{
+    DEV_CHECK_ERR(Attribs.pArchiverFactory != nullptr, "Archiver factory must not be null");
+    DEV_CHECK_ERR(ppArchive != nullptr && *ppArchive == nullptr, "ppArchive must not be null and must point to null");
+
+    ArchiveBuildStats Stats;
+
+    // Enumerate shader permutations
+    std::vector<ShaderJob>                  ShaderJobs;
+    std::unordered_map<std::string, size_t> ShaderNameToJob;
+    for (const auto& Shader : Manifest.Shaders)
+    {
+        for (auto& Macros : EnumeratePermutations(Shader.Permutations))
+        {
+            ShaderJob Job;
+            Job.pShader = &Shader;
+            Job.Name    = GetPermutationName(Shader.Name, Macros);
+            Job.Macros  = std::move(Macros);
+            ShaderNameToJob.emplace(Job.Name, ShaderJobs.size());
+            ShaderJobs.emplace_back(std::move(Job));
+        }
+    }
+
+    // Enumerate pipeline permutations
+    std::vector<PipelineJob> PipelineJobs;
+    for (const auto& Pipeline : Manifest.Pipelines)
+    {
+        for (const auto& Macros : EnumeratePermutations(GetPipelinePermutations(Manifest, Pipeline)))
+        {
+            PipelineJob Job;
+            Job.pPipeline = &Pipeline;
+            Job.Name      = GetPermutationName(Pipeline.Name, Macros);
+
+            for (const auto& Stage : Pipeline.Shaders)
+            {
+                const auto* pShader = Manifest.FindShader(Stage.second);
+                VERIFY_EXPR(pShader != nullptr);
+
+                // Select the shader permutation that matches the pipeline permutation
+                PermutationMacros ShaderMacros;
+                for (const auto& Perm : pShader->Permutations)
+                {
+                    for (const auto& Macro : Macros)
+                    {
+                        if (Macro.first == Perm.Name)
+                            ShaderMacros.push_back(Macro);
+                    }
+                }
+
+                const auto ShaderName = GetPermutationName(pShader->Name, ShaderMacros);
+                const auto it         = ShaderNameToJob.find(ShaderName);
+                if (it == ShaderNameToJob.end())
+                {
+                    LOG_ERROR_MESSAGE("Pipeline '", Job.Name, "' requires shader '", ShaderName,
+                                      "' that is not defined. Make sure that permutation macros with the same name have the same values in all shaders.");
+                    return false;
+                }
+                Job.ShaderJobs.push_back(it->second);
+                ShaderJobs[it->second].IsUsedByPipeline = true;
+            }
+
+            PipelineJobs.emplace_back(std::move(Job));
+        }
+    }
+
+    SerializationDeviceCreateInfo DeviceCI;
+    // Shaders are compiled in parallel by the builder
+    DeviceCI.NumAsyncShaderCompilationThreads = 0;
+
+    RefCntAutoPtr<ISerializationDevice> pDevice;
+    Attribs.pArchiverFactory->CreateSerializationDevice(DeviceCI, &pDevice);
+    if (!pDevice)
+    {
+        LOG_ERROR_MESSAGE("Failed to create serialization device");
+        return false;
+    }
+
+    std::string SearchDirectories;
+    if (Attribs.SearchDirectories != nullptr)
+        SearchDirectories = Attribs.SearchDirectories;
+    if (!Manifest.SearchDirectories.empty())
+    {
+        if (!SearchDirectories.empty())
+            SearchDirectories += ';';
+        SearchDirectories += Manifest.SearchDirectories;
+    }
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pSourceFactory;
+    Attribs.pArchiverFactory->CreateDefaultShaderSourceStreamFactory(SearchDirectories.c_str(), &pSourceFactory);
+    if (!pSourceFactory)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shader source stream factory");
+        return false;
+    }
+
+    // Serialization device and archiver methods are thread-safe, so all permutations
+    // are compiled in parallel.
+    ParallelFor(Attribs.pThreadPool, 0, static_cast<Uint32>(ShaderJobs.size()), 1,
+                [&](Uint32 Idx) {
+                    ShaderJobs[Idx].pSerializedShader = CreateSerializedShader(pDevice, pSourceFactory, ShaderJobs[Idx], Manifest.DeviceFlags);
+                });
+
+    for (const auto& Job : ShaderJobs)
+    {
+        if (!Job.pSerializedShader)
+        {
+            LOG_ERROR_MESSAGE("Failed to compile shader '", Job.Name, "'");
+            ++Stats.NumErrors;
+        }
+    }
+
+    ParallelFor(Attribs.pThreadPool, 0, static_cast<Uint32>(PipelineJobs.size()), 1,
+                [&](Uint32 Idx) {
+                    auto& Job = PipelineJobs[Idx];
+                    for (size_t ShaderJobIdx : Job.ShaderJobs)
+                    {
+                        if (!ShaderJobs[ShaderJobIdx].pSerializedShader)
+                            return;
+                    }
+                    Job.pSerializedPSO = CreateSerializedPipeline(pDevice, Job, ShaderJobs, Manifest.DeviceFlags);
+                });
+
+    RefCntAutoPtr<IArchiver> pArchiver;
+    Attribs.pArchiverFactory->CreateArchiver(pDevice, &pArchiver);
+    if (!pArchiver)
+    {
+        LOG_ERROR_MESSAGE("Failed to create archiver");
+        return false;
+    }
+
+    for (const auto& Job : ShaderJobs)
+    {
+        if (!Job.pSerializedShader)
+            continue;
+
+        ++Stats.NumShaders;
+        // Shaders used by pipelines are serialized with the pipelines
+        if (!Job.IsUsedByPipeline && !pArchiver->AddShader(Job.pSerializedShader))
+        {
+            LOG_ERROR_MESSAGE("Failed to add shader '", Job.Name, "' to the archive");
+            ++Stats.NumErrors;
+        }
+    }
+
+    for (const auto& Job : PipelineJobs)
+    {
+        if (!Job.pSerializedPSO)
+        {
+            LOG_ERROR_MESSAGE("Failed to create pipeline state '", Job.Name, "'");
+            ++Stats.NumErrors;
+            continue;
+        }
+
+        ++Stats.NumPipelines;
+        if (!pArchiver->AddPipelineState(Job.pSerializedPSO))
+        {
+            LOG_ERROR_MESSAGE("Failed to add pipeline state '", Job.Name, "' to the archive");
+            ++Stats.NumErrors;
+        }
+    }
+
+    if (pStats != nullptr)
+        *pStats = Stats;
+
+    if (Stats.NumErrors != 0)
+        return false;
+
+    if (!pArchiver->SerializeToBlob(0, ppArchive))
+    {
+        LOG_ERROR_MESSAGE("Failed to serialize the archive");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Diligent
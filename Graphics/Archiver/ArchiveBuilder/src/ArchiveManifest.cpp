@@ -0,0 +1,643 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ArchiveManifest.hpp"
+
+#include <cctype>
+
+#include "DebugUtilities.hpp"
+#include "FileWrapper.hpp"
+#include "StringTools.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+std::string Trim(const std::string& Str)
+{
+    size_t Start = 0;
+    size_t End   = Str.length();
+    while (Start < End && std::isspace(static_cast<unsigned char>(Str[Start])))
+        ++Start;
+    while (End > Start && std::isspace(static_cast<unsigned char>(Str[End - 1])))
+        --End;
+    return Str.substr(Start, End - Start);
+}
+
+// Splits the string and trims the items. Empty items are skipped.
+std::vector<std::string> Split(const std::string& Str, char Separator)
+{
+    std::vector<std::string> Items;
+
+    size_t Start = 0;
+    while (Start <= Str.length())
+    {
+        size_t End = Str.find(Separator, Start);
+        if (End == std::string::npos)
+            End = Str.length();
+
+        std::string Item = Trim(Str.substr(Start, End - Start));
+        if (!Item.empty())
+            Items.emplace_back(std::move(Item));
+
+        Start = End + 1;
+    }
+    return Items;
+}
+
+bool EqualNoCase(const std::string& Str1, const char* Str2)
+{
+    return Str1.length() == strlen(Str2) && StrCmpNoCase(Str1.c_str(), Str2) == 0;
+}
+
+template <typename EnumType>
+struct EnumName
+{
+    const char* Name;
+    EnumType    Value;
+};
+
+template <typename EnumType, size_t N>
+bool ParseEnum(const std::string& Str, const EnumName<EnumType> (&Names)[N], EnumType& Value)
+{
+    for (const auto& Name : Names)
+    {
+        if (EqualNoCase(Str, Name.Name))
+        {
+            Value = Name.Value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseBool(const std::string& Str, bool& Value)
+{
+    if (EqualNoCase(Str, "true") || Str == "1")
+        Value = true;
+    else if (EqualNoCase(Str, "false") || Str == "0")
+        Value = false;
+    else
+        return false;
+    return true;
+}
+
+static constexpr EnumName<SHADER_TYPE> ShaderTypes[] = {
+    {"VS", SHADER_TYPE_VERTEX},
+    {"PS", SHADER_TYPE_PIXEL},
+    {"GS", SHADER_TYPE_GEOMETRY},
+    {"HS", SHADER_TYPE_HULL},
+    {"DS", SHADER_TYPE_DOMAIN},
+    {"CS", SHADER_TYPE_COMPUTE},
+    {"AS", SHADER_TYPE_AMPLIFICATION},
+    {"MS", SHADER_TYPE_MESH},
+};
+
+static constexpr EnumName<SHADER_SOURCE_LANGUAGE> SourceLanguages[] = {
+    {"Default", SHADER_SOURCE_LANGUAGE_DEFAULT},
+    {"HLSL", SHADER_SOURCE_LANGUAGE_HLSL},
+    {"GLSL", SHADER_SOURCE_LANGUAGE_GLSL},
+    {"GLSL_VERBATIM", SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM},
+    {"MSL", SHADER_SOURCE_LANGUAGE_MSL},
+    {"MSL_VERBATIM", SHADER_SOURCE_LANGUAGE_MSL_VERBATIM},
+    {"WGSL", SHADER_SOURCE_LANGUAGE_WGSL},
+};
+
+static constexpr EnumName<SHADER_COMPILER> ShaderCompilers[] = {
+    {"Default", SHADER_COMPILER_DEFAULT},
+    {"GLSLANG", SHADER_COMPILER_GLSLANG},
+    {"DXC", SHADER_COMPILER_DXC},
+    {"FXC", SHADER_COMPILER_FXC},
+};
+
+static constexpr EnumName<SHADER_RESOURCE_VARIABLE_TYPE> VariableTypes[] = {
+    {"Static", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    {"Mutable", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    {"Dynamic", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+};
+
+static constexpr EnumName<PRIMITIVE_TOPOLOGY> Topologies[] = {
+    {"TRIANGLE_LIST", PRIMITIVE_TOPOLOGY_TRIANGLE_LIST},
+    {"TRIANGLE_STRIP", PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP},
+    {"POINT_LIST", PRIMITIVE_TOPOLOGY_POINT_LIST},
+    {"LINE_LIST", PRIMITIVE_TOPOLOGY_LINE_LIST},
+    {"LINE_STRIP", PRIMITIVE_TOPOLOGY_LINE_STRIP},
+};
+
+static constexpr EnumName<CULL_MODE> CullModes[] = {
+    {"NONE", CULL_MODE_NONE},
+    {"FRONT", CULL_MODE_FRONT},
+    {"BACK", CULL_MODE_BACK},
+};
+
+static constexpr EnumName<VALUE_TYPE> ValueTypes[] = {
+    {"INT8", VT_INT8},
+    {"INT16", VT_INT16},
+    {"INT32", VT_INT32},
+    {"UINT8", VT_UINT8},
+    {"UINT16", VT_UINT16},
+    {"UINT32", VT_UINT32},
+    {"FLOAT16", VT_FLOAT16},
+    {"FLOAT32", VT_FLOAT32},
+};
+
+bool ParseDeviceFlags(const std::string& Str, ARCHIVE_DEVICE_DATA_FLAGS& Flags)
+{
+    for (const auto& Device : Split(Str, ','))
+    {
+        bool Found = false;
+        for (Uint32 Bit = 1; Bit <= ARCHIVE_DEVICE_DATA_FLAG_LAST; Bit <<= 1)
+        {
+            const auto Flag = static_cast<ARCHIVE_DEVICE_DATA_FLAGS>(Bit);
+            if (EqualNoCase(Device, GetArchiveDeviceDataFlagString(Flag)))
+            {
+                Flags |= Flag;
+                Found = true;
+                break;
+            }
+        }
+        if (!Found)
+        {
+            LOG_ERROR_MESSAGE("Unknown device '", Device, "'");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParseTextureFormat(const std::string& Str, TEXTURE_FORMAT& Format)
+{
+    const std::string FullName = "TEX_FORMAT_" + Str;
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        if (EqualNoCase(FullName, GetTextureFormatAttribs(static_cast<TEXTURE_FORMAT>(Fmt)).Name))
+        {
+            Format = static_cast<TEXTURE_FORMAT>(Fmt);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parses layout element in the <Type>x<NumComponents>[N][@<BufferSlot>] format, e.g. FLOAT32x3 or UINT8x4N@1
+bool ParseLayoutElement(const std::string& Str, Uint32 InputIndex, LayoutElement& Elem)
+{
+    std::string Desc = Str;
+
+    Elem            = LayoutElement{};
+    Elem.InputIndex = InputIndex;
+
+    const auto SlotPos = Desc.find('@');
+    if (SlotPos != std::string::npos)
+    {
+        const std::string Slot = Trim(Desc.substr(SlotPos + 1));
+        if (Slot.empty() || Slot.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+        Elem.BufferSlot = static_cast<Uint32>(std::stoul(Slot));
+        Desc            = Trim(Desc.substr(0, SlotPos));
+    }
+
+    Elem.IsNormalized = !Desc.empty() && (Desc.back() == 'N' || Desc.back() == 'n');
+    if (Elem.IsNormalized)
+        Desc.pop_back();
+
+    const auto XPos = Desc.find_last_of("xX");
+    if (XPos == std::string::npos || XPos + 2 != Desc.length() || Desc[XPos + 1] < '1' || Desc[XPos + 1] > '4')
+        return false;
+    Elem.NumComponents = static_cast<Uint32>(Desc[XPos + 1] - '0');
+
+    if (!ParseEnum(Desc.substr(0, XPos), ValueTypes, Elem.ValueType))
+        return false;
+
+    return !Elem.IsNormalized || (Elem.ValueType != VT_FLOAT16 && Elem.ValueType != VT_FLOAT32);
+}
+
+class ManifestParser
+{
+public:
+    explicit ManifestParser(ArchiveManifest& Manifest) :
+        m_Manifest{Manifest}
+    {}
+
+    bool Parse(const char* Text, size_t Length)
+    {
+        size_t Pos = 0;
+        while (Pos < Length)
+        {
+            size_t LineEnd = Pos;
+            while (LineEnd < Length && Text[LineEnd] != '\n')
+                ++LineEnd;
+
+            ++m_LineNumber;
+            const std::string Line = Trim(std::string{Text + Pos, LineEnd - Pos});
+            Pos                    = LineEnd + 1;
+
+            if (Line.empty() || Line[0] == '#' || Line[0] == ';')
+                continue;
+
+            const bool Result = Line[0] == '[' ? ParseSectionHeader(Line) : ParseKeyValue(Line);
+            if (!Result)
+                return false;
+        }
+
+        return Validate();
+    }
+
+private:
+    enum class Section
+    {
+        None,
+        Options,
+        Shader,
+        Pipeline
+    };
+
+    template <typename... ArgsType>
+    bool Error(const ArgsType&... Args)
+    {
+        LOG_ERROR_MESSAGE("Archive manifest line ", m_LineNumber, ": ", Args...);
+        return false;
+    }
+
+    bool ParseSectionHeader(const std::string& Line)
+    {
+        if (Line.back() != ']')
+            return Error("missing ']' in section header");
+
+        const std::string Header   = Line.substr(1, Line.length() - 2);
+        const auto        ColonPos = Header.find(':');
+        const std::string Type     = Trim(Header.substr(0, ColonPos));
+        const std::string Name     = ColonPos != std::string::npos ? Trim(Header.substr(ColonPos + 1)) : std::string{};
+
+        if (EqualNoCase(Type, "Options"))
+        {
+            m_Section = Section::Options;
+            return true;
+        }
+
+        if (Name.empty())
+            return Error("section '", Type, "' must have a name, e.g. [", Type, ": Name]");
+
+        if (EqualNoCase(Type, "Shader"))
+        {
+            m_Section = Section::Shader;
+            m_Manifest.Shaders.emplace_back();
+            m_Manifest.Shaders.back().Name = Name;
+        }
+        else if (EqualNoCase(Type, "GraphicsPipeline") || EqualNoCase(Type, "ComputePipeline"))
+        {
+            m_Section = Section::Pipeline;
+            m_Manifest.Pipelines.emplace_back();
+            m_Manifest.Pipelines.back().Name = Name;
+            m_Manifest.Pipelines.back().Type = EqualNoCase(Type, "ComputePipeline") ? PIPELINE_TYPE_COMPUTE : PIPELINE_TYPE_GRAPHICS;
+        }
+        else
+        {
+            return Error("unknown section type '", Type, "'");
+        }
+        return true;
+    }
+
+    bool ParseKeyValue(const std::string& Line)
+    {
+        const auto EqPos = Line.find('=');
+        if (EqPos == std::string::npos)
+            return Error("expected 'Key = Value'");
+
+        const std::string Key   = Trim(Line.substr(0, EqPos));
+        const std::string Value = Trim(Line.substr(EqPos + 1));
+
+        switch (m_Section)
+        {
+            case Section::Options: return ParseOption(Key, Value);
+            case Section::Shader: return ParseShaderKey(Key, Value, m_Manifest.Shaders.back());
+            case Section::Pipeline: return ParsePipelineKey(Key, Value, m_Manifest.Pipelines.back());
+            default:
+                return Error("key '", Key, "' is defined outside of any section");
+        }
+    }
+
+    bool ParseOption(const std::string& Key, const std::string& Value)
+    {
+        if (EqualNoCase(Key, "Devices"))
+        {
+            if (!ParseDeviceFlags(Value, m_Manifest.DeviceFlags))
+                return Error("invalid device list '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "SearchDirectories"))
+        {
+            m_Manifest.SearchDirectories = Value;
+        }
+        else
+        {
+            return Error("unknown option '", Key, "'");
+        }
+        return true;
+    }
+
+    bool ParseShaderKey(const std::string& Key, const std::string& Value, ArchiveManifest::Shader& Shader)
+    {
+        if (EqualNoCase(Key, "Type"))
+        {
+            if (!ParseEnum(Value, ShaderTypes, Shader.Type))
+                return Error("unknown shader type '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "File"))
+        {
+            Shader.FilePath = Value;
+        }
+        else if (EqualNoCase(Key, "EntryPoint"))
+        {
+            Shader.EntryPoint = Value;
+        }
+        else if (EqualNoCase(Key, "Language"))
+        {
+            if (!ParseEnum(Value, SourceLanguages, Shader.SourceLanguage))
+                return Error("unknown shader language '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "Compiler"))
+        {
+            if (!ParseEnum(Value, ShaderCompilers, Shader.Compiler))
+                return Error("unknown shader compiler '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "CombinedSamplers"))
+        {
+            if (!ParseBool(Value, Shader.UseCombinedTextureSamplers))
+                return Error("invalid boolean value '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "Macros"))
+        {
+            for (const auto& Macro : Split(Value, ','))
+            {
+                const auto  EqPos = Macro.find('=');
+                std::string Name  = Trim(Macro.substr(0, EqPos));
+                std::string Def   = EqPos != std::string::npos ? Trim(Macro.substr(EqPos + 1)) : std::string{};
+                if (Name.empty())
+                    return Error("invalid macro '", Macro, "'");
+                Shader.Macros.emplace_back(std::move(Name), std::move(Def));
+            }
+        }
+        else if (EqualNoCase(Key, "Permutations"))
+        {
+            for (const auto& Perm : Split(Value, ','))
+            {
+                const auto EqPos = Perm.find('=');
+                if (EqPos == std::string::npos)
+                    return Error("permutation '", Perm, "' must be defined as NAME=Value1|Value2|...");
+
+                ArchiveManifest::Permutation Permutation;
+                Permutation.Name   = Trim(Perm.substr(0, EqPos));
+                Permutation.Values = Split(Perm.substr(EqPos + 1), '|');
+                if (Permutation.Name.empty() || Permutation.Values.empty())
+                    return Error("permutation '", Perm, "' must be defined as NAME=Value1|Value2|...");
+
+                for (const auto& Existing : Shader.Permutations)
+                {
+                    if (Existing.Name == Permutation.Name)
+                        return Error("permutation macro '", Permutation.Name, "' is defined more than once");
+                }
+                Shader.Permutations.emplace_back(std::move(Permutation));
+            }
+        }
+        else
+        {
+            return Error("unknown shader key '", Key, "'");
+        }
+        return true;
+    }
+
+    bool ParsePipelineKey(const std::string& Key, const std::string& Value, ArchiveManifest::Pipeline& Pipeline)
+    {
+        SHADER_TYPE ShaderType = SHADER_TYPE_UNKNOWN;
+        if (ParseEnum(Key, ShaderTypes, ShaderType))
+        {
+            for (const auto& Stage : Pipeline.Shaders)
+            {
+                if (Stage.first == ShaderType)
+                    return Error("shader stage '", Key, "' is defined more than once");
+            }
+            Pipeline.Shaders.emplace_back(ShaderType, Value);
+        }
+        else if (EqualNoCase(Key, "DefaultVariableType"))
+        {
+            if (!ParseEnum(Value, VariableTypes, Pipeline.DefaultVariableType))
+                return Error("unknown variable type '", Value, "'");
+        }
+        else if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+        {
+            return Error("unknown compute pipeline key '", Key, "'");
+        }
+        else if (EqualNoCase(Key, "RTVFormats"))
+        {
+            for (const auto& FmtName : Split(Value, ','))
+            {
+                TEXTURE_FORMAT Fmt = TEX_FORMAT_UNKNOWN;
+                if (!ParseTextureFormat(FmtName, Fmt))
+                    return Error("unknown texture format '", FmtName, "'");
+                Pipeline.RTVFormats.push_back(Fmt);
+            }
+            if (Pipeline.RTVFormats.size() > MAX_RENDER_TARGETS)
+                return Error("too many render targets");
+        }
+        else if (EqualNoCase(Key, "DSVFormat"))
+        {
+            if (!ParseTextureFormat(Value, Pipeline.DSVFormat))
+                return Error("unknown texture format '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "Topology"))
+        {
+            if (!ParseEnum(Value, Topologies, Pipeline.Topology))
+                return Error("unknown primitive topology '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "CullMode"))
+        {
+            if (!ParseEnum(Value, CullModes, Pipeline.CullMode))
+                return Error("unknown cull mode '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "DepthEnable"))
+        {
+            if (!ParseBool(Value, Pipeline.DepthEnable))
+                return Error("invalid boolean value '", Value, "'");
+        }
+        else if (EqualNoCase(Key, "InputLayout"))
+        {
+            for (const auto& ElemDesc : Split(Value, ','))
+            {
+                LayoutElement Elem;
+                if (!ParseLayoutElement(ElemDesc, static_cast<Uint32>(Pipeline.InputLayout.size()), Elem))
+                    return Error("invalid layout element '", ElemDesc, "'. Expected format: <Type>x<NumComponents>[N][@<BufferSlot>], e.g. FLOAT32x3 or UINT8x4N@1");
+                Pipeline.InputLayout.push_back(Elem);
+            }
+        }
+        else
+        {
+            return Error("unknown graphics pipeline key '", Key, "'");
+        }
+        return true;
+    }
+
+    bool Validate() const
+    {
+        if (m_Manifest.DeviceFlags == ARCHIVE_DEVICE_DATA_FLAG_NONE)
+        {
+            LOG_ERROR_MESSAGE("Archive manifest does not specify any devices");
+            return false;
+        }
+
+        for (size_t i = 0; i < m_Manifest.Shaders.size(); ++i)
+        {
+            const auto& Shader = m_Manifest.Shaders[i];
+            if (Shader.Type == SHADER_TYPE_UNKNOWN || Shader.FilePath.empty())
+            {
+                LOG_ERROR_MESSAGE("Shader '", Shader.Name, "' must specify the type and the file");
+                return false;
+            }
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (m_Manifest.Shaders[j].Name == Shader.Name)
+                {
+                    LOG_ERROR_MESSAGE("Shader '", Shader.Name, "' is defined more than once");
+                    return false;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < m_Manifest.Pipelines.size(); ++i)
+        {
+            const auto& Pipeline = m_Manifest.Pipelines[i];
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (m_Manifest.Pipelines[j].Name == Pipeline.Name)
+                {
+                    LOG_ERROR_MESSAGE("Pipeline '", Pipeline.Name, "' is defined more than once");
+                    return false;
+                }
+            }
+
+            for (const auto& Stage : Pipeline.Shaders)
+            {
+                const auto* pShader = m_Manifest.FindShader(Stage.second);
+                if (pShader == nullptr)
+                {
+                    LOG_ERROR_MESSAGE("Pipeline '", Pipeline.Name, "' references unknown shader '", Stage.second, "'");
+                    return false;
+                }
+                if (pShader->Type != Stage.first)
+                {
+                    LOG_ERROR_MESSAGE("Shader '", pShader->Name, "' used as ", GetShaderTypeLiteralName(Stage.first),
+                                      " in pipeline '", Pipeline.Name, "' is ", GetShaderTypeLiteralName(pShader->Type));
+                    return false;
+                }
+            }
+
+            const bool IsCompute = Pipeline.Type == PIPELINE_TYPE_COMPUTE;
+            const bool HasCS     = Pipeline.Shaders.size() == 1 && Pipeline.Shaders[0].first == SHADER_TYPE_COMPUTE;
+            if (IsCompute != HasCS)
+            {
+                LOG_ERROR_MESSAGE("Pipeline '", Pipeline.Name, "': compute pipelines must only have a compute shader, ",
+                                  "and graphics pipelines must not have one");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ArchiveManifest& m_Manifest;
+    Section          m_Section    = Section::None;
+    size_t           m_LineNumber = 0;
+};
+
+} // namespace
+
+const ArchiveManifest::Shader* ArchiveManifest::FindShader(const std::string& Name) const
+{
+    for (const auto& Shader : Shaders)
+    {
+        if (Shader.Name == Name)
+            return &Shader;
+    }
+    return nullptr;
+}
+
+bool ParseArchiveManifest(const char* Text, size_t Length, ArchiveManifest& Manifest)
+{
+    Manifest = ArchiveManifest{};
+    return ManifestParser{Manifest}.Parse(Text, Length);
+}
+
+bool LoadArchiveManifest(const char* FilePath, ArchiveManifest& Manifest)
+{
+    std::vector<Uint8> Data;
+    if (!FileWrapper::ReadWholeFile(FilePath, Data))
+        return false;
+
+    return ParseArchiveManifest(reinterpret_cast<const char*>(Data.data()), Data.size(), Manifest);
+}
+
+std::vector<PermutationMacros> EnumeratePermutations(const std::vector<ArchiveManifest::Permutation>& Permutations)
+{
+    std::vector<PermutationMacros> Combinations(1);
+    for (const auto& Perm : Permutations)
+    {
+        std::vector<PermutationMacros> NewCombinations;
+        NewCombinations.reserve(Combinations.size() * Perm.Values.size());
+        for (const auto& Combination : Combinations)
+        {
+            for (const auto& Value : Perm.Values)
+            {
+                NewCombinations.push_back(Combination);
+                NewCombinations.back().emplace_back(Perm.Name, Value);
+            }
+        }
+        Combinations = std::move(NewCombinations);
+    }
+    return Combinations;
+}
+
+std::string GetPermutationName(const std::string& Name, const PermutationMacros& Macros)
+{
+    if (Macros.empty())
+        return Name;
+
+    std::string PermName = Name;
+    PermName += '[';
+    for (size_t i = 0; i < Macros.size(); ++i)
+    {
+        if (i > 0)
+            PermName += ',';
+        PermName += Macros[i].first;
+        PermName += '=';
+        PermName += Macros[i].second;
+    }
+    PermName += ']';
+    return PermName;
+}
+
+} // namespace Diligent
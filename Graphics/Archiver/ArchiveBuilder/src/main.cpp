@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "ArchiveBuilder.hpp"
+#include "ArchiverFactoryLoader.h"
+#include "FileWrapper.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+void PrintHelp()
+{
+    std::cout << "Usage: ArchiveBuilder -m <manifest> -o <archive> [options]\n"
+                 "\n"
+                 "Options:\n"
+                 "  -m, --manifest <file>      Archive manifest file\n"
+                 "  -o, --output <file>        Output archive file\n"
+                 "  -s, --search-dirs <dirs>   Semicolon-separated shader search directories\n"
+                 "  -t, --threads <count>      Number of worker threads (default: number of cores)\n"
+                 "  -h, --help                 Print this message\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* ManifestPath = nullptr;
+    const char* OutputPath   = nullptr;
+    const char* SearchDirs   = nullptr;
+    Uint32      NumThreads   = std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto IsArg = [&](const char* Short, const char* Long) {
+            return strcmp(argv[i], Short) == 0 || strcmp(argv[i], Long) == 0;
+        };
+
+        if (IsArg("-h", "--help"))
+        {
+            PrintHelp();
+            return EXIT_SUCCESS;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Unexpected argument or missing value: " << argv[i] << "\n";
+            PrintHelp();
+            return EXIT_FAILURE;
+        }
+
+        if (IsArg("-m", "--manifest"))
+            ManifestPath = argv[++i];
+        else if (IsArg("-o", "--output"))
+            OutputPath = argv[++i];
+        else if (IsArg("-s", "--search-dirs"))
+            SearchDirs = argv[++i];
+        else if (IsArg("-t", "--threads"))
+            NumThreads = static_cast<Uint32>(std::max(atoi(argv[++i]), 0));
+        else
+        {
+            std::cerr << "Unknown argument: " << argv[i] << "\n";
+            PrintHelp();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (ManifestPath == nullptr || OutputPath == nullptr)
+    {
+        std::cerr << "Manifest and output file must be specified\n";
+        PrintHelp();
+        return EXIT_FAILURE;
+    }
+
+    ArchiveManifest Manifest;
+    if (!LoadArchiveManifest(ManifestPath, Manifest))
+        return EXIT_FAILURE;
+
+    IArchiverFactory* pArchiverFactory = nullptr;
+#if EXPLICITLY_LOAD_ARCHIVER_FACTORY_DLL
+    auto GetArchiverFactory = LoadArchiverFactory();
+    if (GetArchiverFactory != nullptr)
+    {
+        pArchiverFactory = GetArchiverFactory();
+    }
+#else
+    pArchiverFactory = GetArchiverFactory();
+#endif
+    if (pArchiverFactory == nullptr)
+    {
+        std::cerr << "Failed to load archiver factory\n";
+        return EXIT_FAILURE;
+    }
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (NumThreads > 1)
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+
+    ArchiveBuildAttribs Attribs;
+    Attribs.pArchiverFactory  = pArchiverFactory;
+    Attribs.pThreadPool       = pThreadPool;
+    Attribs.SearchDirectories = SearchDirs;
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    ArchiveBuildStats        Stats;
+    const bool               Succeeded = BuildArchive(Manifest, Attribs, &pArchive, &Stats);
+
+    std::cout << "Shaders: " << Stats.NumShaders << ", pipelines: " << Stats.NumPipelines << ", errors: " << Stats.NumErrors << "\n";
+    if (!Succeeded)
+        return EXIT_FAILURE;
+
+    if (!FileWrapper::WriteFile(OutputPath, pArchive->GetConstDataPtr(), pArchive->GetSize()))
+        return EXIT_FAILURE;
+
+    std::cout << "Archive '" << OutputPath << "' (" << pArchive->GetSize() << " bytes) was written successfully\n";
+    return EXIT_SUCCESS;
+}
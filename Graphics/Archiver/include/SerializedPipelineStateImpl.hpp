@@ -116,6 +116,10 @@ public:
         };
         std::array<std::vector<ShaderInfo>, DeviceDataCount> Shaders;
 
+        // Backend-specific data that is stored after the shader indices
+        // (e.g. serialized Direct3D12 root signature).
+        std::array<SerializedData, DeviceDataCount> DeviceData;
+
         bool DoNotPackSignatures = false;
     };
 
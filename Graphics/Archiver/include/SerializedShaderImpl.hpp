@@ -68,6 +68,7 @@ public:
     UNSUPPORTED_CONST_METHOD(void, GetBytecode, const void** ppBytecode, Uint64& Size);
 
     virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
+    virtual Float64 DILIGENT_CALL_TYPE       GetCompileTime() const override final;
     virtual IShader* DILIGENT_CALL_TYPE      GetDeviceShader(RENDER_DEVICE_TYPE Type) const override final;
 
     bool IsCompiling() const;
@@ -90,25 +90,31 @@ DILIGENT_BEGIN_INTERFACE(IArchiver, IObject)
 {
     /// Writes archive to a memory blob
 
-    /// \param [in]  ContentVersion - user-provided content version that will be stored in the archive header.
-    /// \param [out] ppBlob         - memory location where a pointer to the data blob will be stored.
+    /// \param [in]  ContentVersion  - user-provided content version that will be stored in the archive header.
+    /// \param [out] ppBlob          - memory location where a pointer to the data blob will be stored.
+    /// \param [in]  CompressShaders - whether to compress the shader data. Shader data for each device type
+    ///                               is compressed with LZ4 as a separate chunk, so that it is only decompressed
+    ///                               when the shaders for that device are loaded.
 
     /// \note
     ///     The method is *not* thread-safe and must not be called from multiple threads simultaneously.
     VIRTUAL Bool METHOD(SerializeToBlob)(THIS_
                                          Uint32      ContentVersion,
-                                         IDataBlob** ppBlob) PURE;
+                                         IDataBlob** ppBlob,
+                                         Bool        CompressShaders DEFAULT_VALUE(False)) PURE;
 
     /// Writes archive to a file stream
 
-    /// \param [in]  ContentVersion - user-provided content version that will be stored in the archive header.
-    /// \param [out] pStream        - a pointer to the stream to write the archive to.
+    /// \param [in]  ContentVersion  - user-provided content version that will be stored in the archive header.
+    /// \param [out] pStream         - a pointer to the stream to write the archive to.
+    /// \param [in]  CompressShaders - whether to compress the shader data, see IArchiver::SerializeToBlob.
 
     /// \note
     ///     The method is *not* thread-safe and must not be called from multiple threads simultaneously.
     VIRTUAL Bool METHOD(SerializeToStream)(THIS_
                                            Uint32       ContentVersion,
-                                           IFileStream* pStream) PURE;
+                                           IFileStream* pStream,
+                                           Bool         CompressShaders DEFAULT_VALUE(False)) PURE;
 
     /// Adds a shader to the archive.
 
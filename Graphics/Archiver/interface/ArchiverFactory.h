@@ -226,6 +226,11 @@ struct SerializationDeviceCreateInfo
     SerializationDeviceMtlInfo Metal;
 
     /// An optional thread pool for asynchronous shader and pipeline state compilation.
+    ///
+    /// \remarks    When a thread pool is available, a shader that is created synchronously for
+    ///             several device types is compiled for all of them in parallel. The results are
+    ///             gathered per device type, so the archive contents do not depend on the number
+    ///             of threads or the order in which the compilations finish.
     IThreadPool* pAsyncShaderCompilationThreadPool DEFAULT_INITIALIZER(nullptr);
 
     /// The maximum number of threads that can be used to compile shaders.
@@ -69,7 +69,7 @@ ArchiverImpl::~ArchiverImpl()
 {
 }
 
-Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob, Bool CompressShaders)
 {
     DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
     if (ppBlob == nullptr)
@@ -143,15 +143,21 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 
             DeviceObjectArchive::ShaderIndexArray Indices{ShaderIndices.data(), StaticCast<Uint32>(ShaderIndices.size())};
 
-            // For pipelines, device-specific data is the shader indices
-            auto& SerializedIndices = DstData.DeviceSpecific[device_type];
+            // For pipelines, device-specific data is the shader indices optionally
+            // followed by the backend-specific data
+            auto&       SerializedIndices = DstData.DeviceSpecific[device_type];
+            const auto& SrcDeviceData     = SrcData.DeviceData[device_type];
 
             Serializer<SerializerMode::Measure> MeasureSer;
             PSOSerializer<SerializerMode::Measure>::SerializeShaderIndices(MeasureSer, Indices, nullptr);
+            if (SrcDeviceData)
+                MeasureSer.Serialize(SrcDeviceData);
             SerializedIndices = MeasureSer.AllocateData(GetRawAllocator());
 
             Serializer<SerializerMode::Write> Ser{SerializedIndices};
             PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, Indices, nullptr);
+            if (SrcDeviceData)
+                Ser.Serialize(SrcDeviceData);
             VERIFY_EXPR(Ser.IsEnded());
         }
     }
@@ -235,20 +241,20 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
         }
     }
 
-    Archive.Serialize(ppBlob);
+    Archive.Serialize(ppBlob, CompressShaders);
 
     return *ppBlob != nullptr;
 }
 
 
-Bool ArchiverImpl::SerializeToStream(Uint32 ContentVersion, IFileStream* pStream)
+Bool ArchiverImpl::SerializeToStream(Uint32 ContentVersion, IFileStream* pStream, Bool CompressShaders)
 {
     DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
     if (pStream == nullptr)
         return false;
 
     RefCntAutoPtr<IDataBlob> pDataBlob;
-    if (!SerializeToBlob(ContentVersion, &pDataBlob))
+    if (!SerializeToBlob(ContentVersion, &pDataBlob, CompressShaders))
         return false;
 
     return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
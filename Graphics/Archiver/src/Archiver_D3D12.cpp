@@ -157,6 +157,30 @@ void SerializedPipelineStateImpl::PatchShadersD3D12(const CreateInfoType& Create
                                                              SignaturesCount,
                                                              RootSig,
                                                              m_pSerializationDevice->GetD3D12Properties().pDxCompiler);
+
+        // Store the serialized root signature so that the render device does not need to
+        // serialize it again when the pipeline is unpacked.
+        // Note that the serialization device does not know if the render device will enable bindless
+        // resources, so the root signature is serialized with the default flags. If the flags do not
+        // match, the render device will serialize the root signature as usual.
+        const auto               Flags        = RootSignatureD3D12::GetD3D12RootSignatureFlags(/*BindlessResourcesEnabled = */ false);
+        RefCntAutoPtr<IDataBlob> pRootSigData = RootSig.Serialize(Flags);
+
+        SerializedRootSignatureD3D12 SerializedRootSig;
+        SerializedRootSig.Hash     = RootSignatureD3D12::CalculateHash(Signatures.data(), SignaturesCount);
+        SerializedRootSig.Flags    = static_cast<Uint32>(Flags);
+        SerializedRootSig.pData    = pRootSigData->GetConstDataPtr();
+        SerializedRootSig.DataSize = pRootSigData->GetSize();
+
+        Serializer<SerializerMode::Measure> MeasureSer;
+        RootSignatureSerializerD3D12<SerializerMode::Measure>::Serialize(MeasureSer, SerializedRootSig);
+
+        auto& DeviceData = m_Data.DeviceData[static_cast<size_t>(DeviceType::Direct3D12)];
+        DeviceData       = MeasureSer.AllocateData(GetRawAllocator());
+
+        Serializer<SerializerMode::Write> Ser{DeviceData};
+        RootSignatureSerializerD3D12<SerializerMode::Write>::Serialize(Ser, SerializedRootSig);
+        VERIFY_EXPR(Ser.IsEnded());
     }
 
     VERIFY_EXPR(m_Data.Shaders[static_cast<size_t>(DeviceType::Direct3D12)].empty());
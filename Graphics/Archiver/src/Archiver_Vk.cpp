@@ -222,6 +222,9 @@ void SerializedShaderImpl::CreateShaderVk(IReferenceCounters*     pRefCounters,
         // TODO: collect all outputs.
         ppCompilerOutput == nullptr || *ppCompilerOutput == nullptr ? ppCompilerOutput : nullptr,
         m_pDevice->GetShaderCompilationThreadPool(),
+        nullptr, // pBytecodeStore
+        nullptr, // pReflectionRegistry
+        false,   // DeferSPIRVOptimization - archives always contain optimized bytecode
     };
     CreateShader<CompiledShaderVk>(DeviceType::Vulkan, pRefCounters, ShaderCI, VkShaderCI, pRenderDeviceVk);
 }
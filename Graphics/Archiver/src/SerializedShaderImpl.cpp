@@ -72,48 +72,67 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
         DeviceFlags &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
     }
 
+    // When the shader is compiled synchronously for several device types, run the
+    // per-device compilations in parallel in the shader compilation thread pool and
+    // wait for all of them below. Every backend writes its results to its own slot in
+    // m_Shaders, so the serialized data does not depend on the order in which the tasks finish.
+    const bool CompileInParallel =
+        m_pDevice->GetShaderCompilationThreadPool() != nullptr &&
+        (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0 &&
+        PlatformMisc::CountOneBits(static_cast<Uint32>(DeviceFlags)) > 1;
+
+    ShaderCreateInfo DeviceShaderCI = ShaderCI;
+    if (CompileInParallel)
+        DeviceShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
     while (DeviceFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
     {
         const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceFlags);
 
+        // The compiler output may be written by a worker thread after the next device type
+        // has been started, so in parallel mode only the first device type receives it.
+        IDataBlob** ppDeviceCompilerOutput = ppCompilerOutput;
+        if (CompileInParallel)
+            ppCompilerOutput = nullptr;
+
         static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new device data type");
         switch (Flag)
         {
 #if D3D11_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                CreateShaderD3D11(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D11(pRefCounters, DeviceShaderCI, ppDeviceCompilerOutput);
                 break;
 #endif
 
 #if D3D12_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                CreateShaderD3D12(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D12(pRefCounters, DeviceShaderCI, ppDeviceCompilerOutput);
                 break;
 #endif
 
 #if GL_SUPPORTED || GLES_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_GL:
             case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                CreateShaderGL(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppCompilerOutput);
+                CreateShaderGL(pRefCounters, DeviceShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppDeviceCompilerOutput);
                 break;
 #endif
 
 #if VULKAN_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                CreateShaderVk(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderVk(pRefCounters, DeviceShaderCI, ppDeviceCompilerOutput);
                 break;
 #endif
 
 #if METAL_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                CreateShaderMtl(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppCompilerOutput);
+                CreateShaderMtl(pRefCounters, DeviceShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppDeviceCompilerOutput);
                 break;
 #endif
 
 #if WEBGPU_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
-                CreateShaderWebGPU(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderWebGPU(pRefCounters, DeviceShaderCI, ppDeviceCompilerOutput);
                 break;
 #endif
 
@@ -126,6 +145,11 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
                 break;
         }
     }
+
+    if (CompileInParallel && GetStatus(/*WaitForCompletion = */ true) == SHADER_STATUS_FAILED)
+    {
+        LOG_ERROR_AND_THROW("Failed to compile serialized shader '", ShaderCI.Desc.Name, "'");
+    }
 }
 
 SerializedShaderImpl::~SerializedShaderImpl()
@@ -228,6 +252,21 @@ SHADER_STATUS SerializedShaderImpl::GetStatus(bool WaitForCompletion)
     return OverallStatus;
 }
 
+Float64 SerializedShaderImpl::GetCompileTime() const
+{
+    // Return the total time spent compiling the shader for all device types
+    Float64 CompileTime = 0;
+    for (const auto& pCompiledShader : m_Shaders)
+    {
+        if (!pCompiledShader)
+            continue;
+
+        if (IShader* pShader = pCompiledShader->GetDeviceShader())
+            CompileTime += pShader->GetCompileTime();
+    }
+    return CompileTime;
+}
+
 bool SerializedShaderImpl::IsCompiling() const
 {
     for (const auto& pCompiledShader : m_Shaders)
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// CPU-side block compression of texture data into BC formats
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Block compression quality
+enum class BC_COMPRESSION_QUALITY : Uint8
+{
+    /// Endpoints are computed from the block bounding box.
+    Fast,
+
+    /// Endpoints are placed along the principal axis of the block colors.
+    Normal,
+
+    /// Same as Normal, but endpoints are additionally refined by least squares
+    /// and the best of alternative block modes is selected by the error.
+    High
+};
+
+/// Attributes of the CompressBC function
+struct CompressBCAttribs
+{
+    /// Destination format.
+
+    /// \remarks    The following formats are supported:
+    ///             - BC1_UNORM, BC1_UNORM_SRGB
+    ///             - BC3_UNORM, BC3_UNORM_SRGB
+    ///             - BC4_UNORM
+    ///             - BC5_UNORM
+    ///             - BC7_UNORM, BC7_UNORM_SRGB
+    ///
+    ///             sRGB formats are encoded the same way as their UNORM counterparts:
+    ///             the source data is expected to already be in sRGB space.
+    TEXTURE_FORMAT DstFormat = TEX_FORMAT_UNKNOWN;
+
+    /// Width of the source image, in texels.
+    Uint32 Width = 0;
+
+    /// Height of the source image, in texels.
+    Uint32 Height = 0;
+
+    /// Number of 8-bit components in each source texel (1 to 4).
+
+    /// \remarks    Missing color components are read as 0 and missing alpha is read as 255.
+    Uint32 SrcNumComponents = 4;
+
+    /// Pointer to the source data.
+    const void* pSrcData = nullptr;
+
+    /// Source data row stride, in bytes.
+    size_t SrcStride = 0;
+
+    /// Pointer to the destination data.
+    void* pDstData = nullptr;
+
+    /// Destination stride between rows of 4x4 blocks, in bytes.
+
+    /// \remarks    Data and stride of a mapped upload buffer subresource
+    ///             (see IUploadBuffer::GetMappedData) can be used directly,
+    ///             so that compressed blocks are written straight to the memory
+    ///             that is copied to the GPU by the texture uploader.
+    size_t DstStride = 0;
+
+    /// Compression quality.
+    BC_COMPRESSION_QUALITY Quality = BC_COMPRESSION_QUALITY::Normal;
+
+    /// Optional thread pool.
+
+    /// \remarks    If the pool is provided, rows of blocks are compressed in parallel.
+    ///             The function returns after all blocks have been compressed.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Returns true if the format is supported by the CompressBC function.
+bool IsBCCompressionSupported(TEXTURE_FORMAT Format);
+
+/// Compresses the image into the BC format, see Diligent::CompressBCAttribs.
+
+/// \remarks    Incomplete blocks at the right and bottom image edges are
+///             padded by replicating the edge texels.
+///
+///             BC1 blocks that contain texels with alpha below 128 use the
+///             three-color mode with transparent black texels. BC7 blocks
+///             are encoded using mode 6 (single subset with combined color and alpha).
+void CompressBC(const CompressBCAttribs& Attribs);
+
+} // namespace Diligent
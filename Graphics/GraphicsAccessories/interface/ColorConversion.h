@@ -98,4 +98,33 @@ inline float4 FastSRGBAToLinear(const float4& SRGBA)
     return float4{FastGammaToLinear(SRGBA.r), FastGammaToLinear(SRGBA.g), FastGammaToLinear(SRGBA.b), SRGBA.a};
 }
 
+
+// Bulk conversion functions.
+// All functions process NumTexels tightly packed RGBA texels and use SSE2 or NEON
+// instructions when available. Source and destination arrays must not overlap.
+
+/// Converts 8-bit sRGB RGBA texels to linear 32-bit float RGBA texels.
+/// Alpha is normalized, but not gamma-converted.
+void SRGBA8ToLinearRGBA32F(const Uint8* pSrc, float* pDst, size_t NumTexels);
+
+/// Converts linear 32-bit float RGBA texels to 8-bit sRGB RGBA texels.
+/// The values are clamped to [0, 1] range. Alpha is not gamma-converted.
+/// The result may differ from the exactly rounded value by one.
+void LinearRGBA32FToSRGBA8(const float* pSrc, Uint8* pDst, size_t NumTexels);
+
+/// Converts 16-bit float RGBA texels (e.g. RGBA16_FLOAT readbacks) to 8-bit normalized RGBA texels.
+/// The values are clamped to [0, 1] range and rounded to the nearest integer.
+/// No color space conversion is performed. NaN values produce undefined results.
+void RGBA16FToRGBA8(const Uint16* pSrc, Uint8* pDst, size_t NumTexels);
+
+/// Converts 8-bit normalized RGBA texels to 16-bit float RGBA texels.
+void RGBA8ToRGBA16F(const Uint8* pSrc, Uint16* pDst, size_t NumTexels);
+
+/// Multiplies the RGB components of 8-bit RGBA texels by alpha in place.
+/// The results are rounded to the nearest integer.
+void PremultiplyAlphaRGBA8(Uint8* pData, size_t NumTexels);
+
+/// Multiplies the RGB components of 32-bit float RGBA texels by alpha in place.
+void PremultiplyAlphaRGBA32F(float* pData, size_t NumTexels);
+
 DILIGENT_END_NAMESPACE // namespace Diligent
@@ -32,7 +32,10 @@
 /// Declaration of DynamicAtlasManager class
 
 #include <map>
+#include <set>
 #include <unordered_map>
+#include <memory>
+#include <vector>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Common/interface/HashUtils.hpp"
@@ -98,7 +101,23 @@ public:
         };
     };
 
-    DynamicAtlasManager(Uint32 Width, Uint32 Height);
+    /// Region packing strategy
+    enum class PackingStrategy : Uint8
+    {
+        /// Free space is kept in a tree of rectangles that is split on allocation
+        /// and merged back when regions are released. Works best when regions of
+        /// very different sizes are frequently allocated and released.
+        Guillotine,
+
+        /// Regions are placed at the lowest position along the skyline (bottom-left rule).
+        /// Space left below placed regions as well as released regions are kept in a list
+        /// and are reused first. The skyline is reset when all regions are released.
+        /// Gives higher occupancy and faster allocation for many regions of similar
+        /// height, such as font glyphs.
+        Skyline
+    };
+
+    DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingStrategy Strategy = PackingStrategy::Guillotine);
     ~DynamicAtlasManager();
 
     // clang-format off
@@ -111,8 +130,13 @@ public:
     Region Allocate(Uint32 Width, Uint32 Height);
     void   Free(Region&& R);
 
+    /// Returns the number of free regions. In skyline mode, this is the number of
+    /// reusable rectangles plus the number of skyline segments.
     Uint32 GetFreeRegionCount() const
     {
+        if (m_Strategy == PackingStrategy::Skyline)
+            return static_cast<Uint32>(m_SkylineFreeRects.size() + m_Skyline.size());
+
         VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
         return static_cast<Uint32>(m_FreeRegionsByWidth.size());
     }
@@ -121,6 +145,8 @@ public:
     Uint32 GetHeight() const { return m_Height; }
     Uint64 GetTotalFreeArea() const { return m_TotalFreeArea; }
 
+    PackingStrategy GetPackingStrategy() const { return m_Strategy; }
+
     bool IsEmpty() const
     {
         VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
@@ -159,6 +185,84 @@ public:
 #undef CMP
 
 private:
+    // Caches freed small memory blocks so that tree nodes and container nodes are
+    // recycled instead of being allocated on the heap for every region.
+    // The pool is not thread-safe, which is fine as the manager is not thread-safe either.
+    class BlockPool
+    {
+    public:
+        BlockPool() noexcept {}
+        ~BlockPool();
+
+        // clang-format off
+        BlockPool           (const BlockPool&)  = delete;
+        BlockPool           (      BlockPool&&) = delete;
+        BlockPool& operator=(const BlockPool&)  = delete;
+        BlockPool& operator=(      BlockPool&&) = delete;
+        // clang-format on
+
+        void* Allocate(size_t Size);
+        void  Free(void* Ptr, size_t Size);
+
+    private:
+        static constexpr size_t BlockGranularity = 16;
+        static constexpr size_t MaxPooledSize    = 256;
+
+        struct FreeBlock
+        {
+            FreeBlock* pNext;
+        };
+        FreeBlock* m_FreeLists[MaxPooledSize / BlockGranularity] = {};
+    };
+
+    // STL allocator that allocates memory from the block pool.
+    // The pool is shared between the allocator copies, so that containers
+    // remain valid when the manager is moved.
+    template <typename T>
+    struct PoolAllocator
+    {
+        using value_type = T;
+
+        explicit PoolAllocator(std::shared_ptr<BlockPool> _pPool) noexcept :
+            pPool{std::move(_pPool)}
+        {}
+
+        // NB: moving the allocator must not reset the pool pointer as
+        //     some implementations allocate from moved-from containers.
+        PoolAllocator(const PoolAllocator& Other) noexcept :
+            pPool{Other.pPool}
+        {}
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& Other) noexcept :
+            pPool{Other.pPool}
+        {}
+
+        T* allocate(size_t Count)
+        {
+            return static_cast<T*>(pPool->Allocate(Count * sizeof(T)));
+        }
+
+        void deallocate(T* Ptr, size_t Count)
+        {
+            pPool->Free(Ptr, Count * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator==(const PoolAllocator<U>& rhs) const
+        {
+            return pPool == rhs.pPool;
+        }
+
+        template <typename U>
+        bool operator!=(const PoolAllocator<U>& rhs) const
+        {
+            return pPool != rhs.pPool;
+        }
+
+        std::shared_ptr<BlockPool> pPool;
+    };
+
 #if DILIGENT_DEBUG
     void DbgVerifyRegion(const Region& R) const;
     void DbgVerifyConsistency() const;
@@ -166,20 +270,28 @@ private:
     void DbgRecursiveVerifyConsistency(const Node& N, Uint32& Area) const;
 #endif
 
-    const Uint32 m_Width;
-    const Uint32 m_Height;
+    Region AllocateSkyline(Uint32 Width, Uint32 Height);
+    void   FreeSkyline(const Region& R);
+    void   ResetSkyline();
+
+    const Uint32          m_Width;
+    const Uint32          m_Height;
+    const PackingStrategy m_Strategy;
 
     Uint64 m_TotalFreeArea = 0;
 
+    std::shared_ptr<BlockPool> m_pPool;
+
     struct Node
     {
         Region R;
         bool   IsAllocated = false;
         Node*  Parent      = nullptr;
 
-        void Split(const std::initializer_list<Region>& Regions);
+        void Split(const std::initializer_list<Region>& Regions, BlockPool& Pool);
         bool CanMergeChildren() const;
-        void MergeChildren();
+        void MergeChildren(BlockPool& Pool);
+        void ReleaseChildren(BlockPool& Pool);
         bool HasChildren() const
         {
             VERIFY_EXPR(NumChildren == 0 && !Children || NumChildren != 0 && Children);
@@ -215,20 +327,34 @@ private:
         void Validate() const;
 #endif
     private:
-        Uint32                  NumChildren = 0;
-        std::unique_ptr<Node[]> Children;
+        Uint32 NumChildren = 0;
+        // Children are allocated from the block pool
+        Node* Children = nullptr;
     };
     std::unique_ptr<Node> m_Root{new Node};
 
     void RegisterNode(Node& N);
     void UnregisterNode(const Node& N);
 
+    using RegionNodePair = std::pair<const Region, Node*>;
+
     // Free regions ordered by width->height->x->y
-    std::map<Region, Node*, WidthFirstCompare> m_FreeRegionsByWidth;
+    std::map<Region, Node*, WidthFirstCompare, PoolAllocator<RegionNodePair>> m_FreeRegionsByWidth;
     // Free regions ordered by height->width->y->x
-    std::map<Region, Node*, HeightFirstCompare> m_FreeRegionsByHeight;
-    // Allocated regions
-    std::unordered_map<Region, Node*, Region::Hasher> m_AllocatedRegions;
+    std::map<Region, Node*, HeightFirstCompare, PoolAllocator<RegionNodePair>> m_FreeRegionsByHeight;
+    // Allocated regions. In skyline mode, node pointers are null.
+    std::unordered_map<Region, Node*, Region::Hasher, std::equal_to<Region>, PoolAllocator<RegionNodePair>> m_AllocatedRegions;
+
+    struct SkylineSegment
+    {
+        Uint32 x;
+        Uint32 y;
+        Uint32 width;
+    };
+    // Skyline segments ordered by x (skyline mode only)
+    std::vector<SkylineSegment> m_Skyline;
+    // Free rectangles below the skyline ordered by width->height->x->y (skyline mode only)
+    std::set<Region, WidthFirstCompare, PoolAllocator<Region>> m_SkylineFreeRects;
 };
 
 } // namespace Diligent
@@ -441,6 +441,23 @@ const char* GetQueryTypeString(QUERY_TYPE QueryType);
 
 const char* GetSurfaceTransformString(SURFACE_TRANSFORM SrfTransform);
 
+/// Returns the clip-space matrix that pre-transforms the rendered image to match the surface transform.
+
+/// \param [in] SrfTransform - Swap chain surface transform, see SwapChainDesc::PreTransform.
+///
+/// \return     The matrix that should be applied after the projection matrix, e.g.
+///             ViewProj = View * Proj * GetSurfacePretransformMatrix(SCDesc.PreTransform).
+///
+/// \remarks    When the swap chain is pre-rotated (e.g. Vulkan on Android in landscape orientation),
+///             the presentation engine does not rotate the image, and the application must render it
+///             rotated. The projection matrix should use the aspect ratio of the rotated image: for
+///             90 and 270 degree rotations, this is SCDesc.Height / SCDesc.Width.
+float4x4 GetSurfacePretransformMatrix(SURFACE_TRANSFORM SrfTransform);
+
+/// Returns true if the surface transform rotates the image by 90 or 270 degrees, so that
+/// the swap chain width and height are swapped relative to the rendered image.
+bool IsSurfaceTransformRotated90(SURFACE_TRANSFORM SrfTransform);
+
 const char* GetPipelineTypeString(PIPELINE_TYPE PipelineType);
 
 const char* GetShaderCompilerTypeString(SHADER_COMPILER Compiler);
@@ -793,6 +810,8 @@ bool IsSRGBFormat(TEXTURE_FORMAT Fmt);
 
 String GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAGS Flags);
 
+String GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAGS Flags);
+
 /// Converts texture component mapping to a string, for example:
 /// {R, G, B, A} -> "rgba"
 /// {R, G, B, 1} -> "rgb1"
@@ -31,11 +31,13 @@
 #pragma once
 
 /// \file
-/// Implementation of Diligent::ResourceReleaseQueue class
+/// Implementation of Diligent::ResourceReleaseQueue and Diligent::ShardedResourceReleaseQueue classes
 
 #include <mutex>
 #include <deque>
 #include <atomic>
+#include <new>
+#include <algorithm>
 
 #include "../../../Primitives/interface/MemoryAllocator.h"
 #include "../../../Common/interface/STDAllocator.hpp"
@@ -382,4 +384,249 @@ private:
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
 };
 
+/// Release queue that splits stale resources and resources pending release between
+/// multiple independently locked shards to reduce contention between producer threads.
+
+/// The class provides the same interface as ResourceReleaseQueue. Every thread is assigned
+/// to a shard in a round-robin fashion, so that a small number of threads never share the
+/// same lock. Each shard keeps its own stale resource list and its own release queue:
+/// * DiscardStaleResources() moves stale resources of every shard to the release queue of the same shard,
+///   so that no more than one shard lock is ever held at a time.
+/// * Purge() visits all shards and releases the resources whose fence value is completed.
+///
+/// Within a shard, the ordering is identical to ResourceReleaseQueue: a resource is never destroyed
+/// before the fence value it is associated with has been completed, and stale resources are moved to the
+/// release queue in the order they were released.
+///
+/// \tparam ResourceWrapperType -  Type of the resource wrapper used by the release queue.
+template <typename ResourceWrapperType>
+class ShardedResourceReleaseQueue
+{
+public:
+    static constexpr Uint32 DefaultNumShards = 16;
+
+    ShardedResourceReleaseQueue(IMemoryAllocator& Allocator, Uint32 NumShards = DefaultNumShards) :
+        m_Allocator{Allocator},
+        m_NumShards{(std::max)(NumShards, 1u)}
+    {
+        m_Shards = reinterpret_cast<Shard*>(m_Allocator.AllocateAligned(sizeof(Shard) * m_NumShards, alignof(Shard), "Memory for release queue shards", __FILE__, __LINE__));
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            new (m_Shards + i) Shard{Allocator};
+    }
+
+    // clang-format off
+    ShardedResourceReleaseQueue             (const ShardedResourceReleaseQueue&) = delete;
+    ShardedResourceReleaseQueue             (ShardedResourceReleaseQueue&&)      = delete;
+    ShardedResourceReleaseQueue& operator = (const ShardedResourceReleaseQueue&) = delete;
+    ShardedResourceReleaseQueue& operator = (ShardedResourceReleaseQueue&&)      = delete;
+    // clang-format on
+
+    ~ShardedResourceReleaseQueue()
+    {
+        DEV_CHECK_ERR(GetStaleResourceCount() == 0, "Not all stale objects were destroyed");
+        DEV_CHECK_ERR(GetPendingReleaseResourceCount() == 0, "Release queue is not empty");
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            m_Shards[i].~Shard();
+        m_Allocator.FreeAligned(m_Shards);
+    }
+
+    /// Creates a resource wrapper for the specific resource type
+    /// \param [in] Resource      - Resource to be released
+    /// \param [in] NumReferences - Number of references to the resource
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    static ResourceWrapperType CreateWrapper(ResourceType&& Resource, typename ResourceWrapperType::RefCounterType NumReferences)
+    {
+        return ResourceWrapperType::Create(std::move(Resource), NumReferences);
+    }
+
+    /// Moves a resource to the stale resources queue of the current thread's shard
+    /// \param [in] Resource              - Resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    void SafeReleaseResource(ResourceType&& Resource, Uint64 NextCommandListNumber)
+    {
+        SafeReleaseResource(CreateWrapper(std::move(Resource), 1), NextCommandListNumber);
+    }
+
+    /// Moves a resource wrapper to the stale resources queue of the current thread's shard
+    /// \param [in] Wrapper               - Resource wrapper containing the resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    void SafeReleaseResource(ResourceWrapperType&& Wrapper, Uint64 NextCommandListNumber)
+    {
+        Shard&                      ThreadShard = GetThreadShard();
+        std::lock_guard<std::mutex> LockGuard{ThreadShard.Mtx};
+        ThreadShard.StaleResources.emplace_back(NextCommandListNumber, std::move(Wrapper));
+    }
+
+    /// Moves a copy of the resource wrapper to the stale resources queue of the current thread's shard
+    /// \param [in] Wrapper               - Resource wrapper containing the resource to be released
+    /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
+    void SafeReleaseResource(const ResourceWrapperType& Wrapper, Uint64 NextCommandListNumber)
+    {
+        Shard&                      ThreadShard = GetThreadShard();
+        std::lock_guard<std::mutex> LockGuard{ThreadShard.Mtx};
+        ThreadShard.StaleResources.emplace_back(NextCommandListNumber, Wrapper);
+    }
+
+    /// Adds a resource directly to the release queue of the current thread's shard
+    /// \param [in] Resource    - Resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    template <typename ResourceType, typename = typename std::enable_if<std::is_object<ResourceType>::value>::type>
+    void DiscardResource(ResourceType&& Resource, Uint64 FenceValue)
+    {
+        DiscardResource(CreateWrapper(std::move(Resource), 1), FenceValue);
+    }
+
+    /// Adds a resource wrapper directly to the release queue of the current thread's shard
+    /// \param [in] Wrapper     - Resource wrapper containing the resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    void DiscardResource(ResourceWrapperType&& Wrapper, Uint64 FenceValue)
+    {
+        Shard&                      ThreadShard = GetThreadShard();
+        std::lock_guard<std::mutex> LockGuard{ThreadShard.Mtx};
+        ThreadShard.ReleaseQueue.emplace_back(FenceValue, std::move(Wrapper));
+    }
+
+    /// Adds a copy of the resource wrapper directly to the release queue of the current thread's shard
+    /// \param [in] Wrapper     - Resource wrapper containing the resource to be released.
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    void DiscardResource(const ResourceWrapperType& Wrapper, Uint64 FenceValue)
+    {
+        Shard&                      ThreadShard = GetThreadShard();
+        std::lock_guard<std::mutex> LockGuard{ThreadShard.Mtx};
+        ThreadShard.ReleaseQueue.emplace_back(FenceValue, Wrapper);
+    }
+
+    /// Adds multiple resources directly to the release queue of the current thread's shard
+    /// \param [in] FenceValue  - Fence value indicating when the resource was used last time.
+    /// \param [in] Iterator    - Iterator that returns resources to be released.
+    template <typename ResourceType, typename IteratorType>
+    void DiscardResources(Uint64 FenceValue, IteratorType Iterator)
+    {
+        Shard&                      ThreadShard = GetThreadShard();
+        std::lock_guard<std::mutex> LockGuard{ThreadShard.Mtx};
+        ResourceType                Resource;
+        while (Iterator(Resource))
+        {
+            ThreadShard.ReleaseQueue.emplace_back(FenceValue, CreateWrapper(std::move(Resource), 1));
+        }
+    }
+
+    /// Moves stale objects of all shards to the release queues
+    /// \param [in] SubmittedCmdBuffNumber - number of the last submitted command list.
+    ///                                      All resources in the stale object list whose command list number is
+    ///                                      less than or equal to this value are moved to the release queue.
+    /// \param [in] FenceValue             - Fence value associated with the resources moved to the release queue.
+    ///                                      A resource will be destroyed by Purge() method when completed fence value
+    ///                                      is greater or equal to the fence value associated with the resource
+    void DiscardStaleResources(Uint64 SubmittedCmdBuffNumber, Uint64 FenceValue)
+    {
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+        {
+            Shard&                      CurrShard = m_Shards[i];
+            std::lock_guard<std::mutex> LockGuard{CurrShard.Mtx};
+            while (!CurrShard.StaleResources.empty())
+            {
+                auto& FirstStaleObj = CurrShard.StaleResources.front();
+                if (FirstStaleObj.first <= SubmittedCmdBuffNumber)
+                {
+                    CurrShard.ReleaseQueue.emplace_back(FenceValue, std::move(FirstStaleObj.second));
+                    CurrShard.StaleResources.pop_front();
+                }
+                else
+                    break;
+            }
+        }
+    }
+
+    /// Removes all objects from the release queues whose fence value is
+    /// less than or equal to CompletedFenceValue
+    /// \param [in] CompletedFenceValue  -  Value of the fence that has been completed by the GPU
+    void Purge(Uint64 CompletedFenceValue)
+    {
+        // Released objects are moved out of the shard queues and destroyed outside of the locks, so that
+        // a resource destructor may safely release other resources through the same thread's shard.
+        typename Shard::QueueType ReleasedObjects{STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, m_Allocator, "Allocator for deque<ReleaseQueueElemType>")};
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+        {
+            Shard&                      CurrShard = m_Shards[i];
+            std::lock_guard<std::mutex> LockGuard{CurrShard.Mtx};
+            while (!CurrShard.ReleaseQueue.empty())
+            {
+                auto& FirstObj = CurrShard.ReleaseQueue.front();
+                if (FirstObj.first <= CompletedFenceValue)
+                {
+                    ReleasedObjects.emplace_back(std::move(FirstObj));
+                    CurrShard.ReleaseQueue.pop_front();
+                }
+                else
+                    break;
+            }
+        }
+    }
+
+    /// Returns the total number of stale resources in all shards
+    size_t GetStaleResourceCount() const
+    {
+        size_t Count = 0;
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+        {
+            std::lock_guard<std::mutex> LockGuard{m_Shards[i].Mtx};
+            Count += m_Shards[i].StaleResources.size();
+        }
+        return Count;
+    }
+
+    /// Returns the total number of resources pending release in all shards
+    size_t GetPendingReleaseResourceCount() const
+    {
+        size_t Count = 0;
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+        {
+            std::lock_guard<std::mutex> LockGuard{m_Shards[i].Mtx};
+            Count += m_Shards[i].ReleaseQueue.size();
+        }
+        return Count;
+    }
+
+    /// Returns the number of shards
+    Uint32 GetNumShards() const
+    {
+        return m_NumShards;
+    }
+
+private:
+    using ReleaseQueueElemType = std::pair<Uint64, ResourceWrapperType>;
+
+    // Align shards by the cache line size to avoid false sharing between locks
+    struct alignas(64) Shard
+    {
+        using QueueType = std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>>;
+
+        // clang-format off
+        Shard(IMemoryAllocator& Allocator) :
+            ReleaseQueue  {STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")},
+            StaleResources{STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")}
+        {}
+        // clang-format on
+
+        mutable std::mutex Mtx;
+        QueueType          ReleaseQueue;
+        QueueType          StaleResources;
+    };
+
+    Shard& GetThreadShard()
+    {
+        // Assign shards to threads in round-robin fashion so that
+        // a small number of threads never share the same shard.
+        static std::atomic<Uint32> NextThreadIdx{0};
+        static thread_local Uint32 ThreadIdx = NextThreadIdx.fetch_add(1);
+        return m_Shards[ThreadIdx % m_NumShards];
+    }
+
+    IMemoryAllocator& m_Allocator;
+    const Uint32      m_NumShards;
+    Shard*            m_Shards = nullptr;
+};
+
 } // namespace Diligent
@@ -0,0 +1,666 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Two-level segregated fit (TLSF) free block manager that accommodates variable-size allocation requests.
+// See M. Masmano et al., "TLSF: a New Dynamic Memory Allocator for Real-Time Systems".
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "../../../Primitives/interface/MemoryAllocator.h"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Common/interface/Align.hpp"
+#include "../../../Common/interface/STDAllocator.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+namespace Diligent
+{
+// The class is a drop-in alternative to VariableSizeAllocationsManager with bounded O(1) Allocate()
+// and Free() operations. Free blocks are kept in segregated lists: the first level splits the
+// sizes by powers of two, the second level linearly splits every power-of-two range into
+// SecondLevelCount sub-ranges. Two levels of bitmaps allow finding a non-empty list with
+// a couple of bit scans.
+//
+//   First level     |  0   |   1    |    2    |     3     |  ...
+//   Size range      | 0-31 | 32-63  | 64-127  |  128-255  |  ...
+//                          |  |  |  |
+//   Second level           32 33 34 ... 63      (32 lists per first-level range)
+//
+// Since the managed memory is not accessible to the CPU (e.g. GPU heaps or descriptor heaps),
+// block headers are kept in a separate pool that only grows when the number of blocks exceeds
+// its capacity. Allocated blocks are found by offset using an open-addressing hash table.
+//
+// Unlike VariableSizeAllocationsManager, every Free() call must release exactly one allocation
+// previously returned by Allocate(); partial releases are not supported.
+class TLSFAllocationsManager
+{
+public:
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using Allocation = VariableSizeAllocationsManager::Allocation;
+
+    struct CreateInfo
+    {
+        IMemoryAllocator& Allocator;
+        OffsetType        MaxSize                   = 0;
+        bool              DbgDisableDebugValidation = false;
+
+        // The initial number of block headers to reserve space for.
+        // No memory is allocated by Allocate() or Free() until this number is exceeded.
+        Uint32 InitialBlockCapacity = 64;
+    };
+
+    explicit TLSFAllocationsManager(const CreateInfo& CI)
+        // clang-format off
+        : m_Blocks     {STD_ALLOCATOR_RAW_MEM(BlockInfo, CI.Allocator, "Allocator for vector<BlockInfo>")}
+        , m_OffsetTable{STD_ALLOCATOR_RAW_MEM(Uint32,    CI.Allocator, "Allocator for vector<Uint32>")}
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{CI.DbgDisableDebugValidation}
+#endif
+    // clang-format on
+    {
+        for (auto& FreeListHeads : m_FreeListHeads)
+            FreeListHeads.fill(Uint32{InvalidIndex});
+        m_SLBitmaps.fill(0);
+
+        const Uint32 BlockCapacity = (std::max)(CI.InitialBlockCapacity, 4u);
+        m_Blocks.reserve(BlockCapacity);
+        // Keep the load factor of the offset table below 1/2
+        m_OffsetTable.resize(size_t{1} << (PlatformMisc::GetMSB(BlockCapacity - 1) + 2), Uint32{InvalidIndex});
+
+        if (CI.MaxSize > 0)
+            Extend(CI.MaxSize);
+    }
+
+    TLSFAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        TLSFAllocationsManager{CreateInfo{Allocator, MaxSize}}
+    {}
+
+    ~TLSFAllocationsManager()
+    {
+#ifdef DILIGENT_DEBUG
+        if (!m_Blocks.empty())
+        {
+            VERIFY(m_FreeSize == m_MaxSize, "Not all allocations have been released");
+            VERIFY(m_MaxSize == 0 || m_NumFreeBlocks == 1, "Single free block is expected");
+            VERIFY(m_NumAllocations == 0, "Not all allocations have been released");
+        }
+#endif
+    }
+
+    // clang-format off
+    TLSFAllocationsManager(TLSFAllocationsManager&& rhs) noexcept
+        : m_Blocks          {std::move(rhs.m_Blocks)     }
+        , m_OffsetTable     {std::move(rhs.m_OffsetTable)}
+        , m_FreeListHeads   {rhs.m_FreeListHeads         }
+        , m_SLBitmaps       {rhs.m_SLBitmaps             }
+        , m_FLBitmap        {rhs.m_FLBitmap              }
+        , m_FirstUnusedBlock{rhs.m_FirstUnusedBlock      }
+        , m_LastBlock       {rhs.m_LastBlock             }
+        , m_NumFreeBlocks   {rhs.m_NumFreeBlocks         }
+        , m_NumAllocations  {rhs.m_NumAllocations        }
+        , m_MaxSize         {rhs.m_MaxSize               }
+        , m_FreeSize        {rhs.m_FreeSize              }
+#ifdef DILIGENT_DEBUG
+        , m_DbgDisableDebugValidation{rhs.m_DbgDisableDebugValidation}
+#endif
+    {
+        // clang-format on
+        rhs.m_Blocks.clear();
+        rhs.m_OffsetTable.clear();
+        rhs.m_FLBitmap         = 0;
+        rhs.m_FirstUnusedBlock = InvalidIndex;
+        rhs.m_LastBlock        = InvalidIndex;
+        rhs.m_NumFreeBlocks    = 0;
+        rhs.m_NumAllocations   = 0;
+        rhs.m_MaxSize          = 0;
+        rhs.m_FreeSize         = 0;
+    }
+
+    // clang-format off
+    TLSFAllocationsManager& operator = (      TLSFAllocationsManager&&) = delete;
+    TLSFAllocationsManager             (const TLSFAllocationsManager&)  = delete;
+    TLSFAllocationsManager& operator = (const TLSFAllocationsManager&)  = delete;
+    // clang-format on
+
+    // Offset returned by Allocate() may not be aligned, but the size of the allocation
+    // is sufficient to properly align it
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
+
+        Uint32 BlockIdx = InvalidIndex;
+
+        // Try the head of the list the size maps to first: this block is the closest match,
+        // but it is not guaranteed to be large enough.
+        {
+            Uint32 FL = 0, SL = 0;
+            MapSize(Size, FL, SL);
+            const Uint32 HeadIdx = m_FreeListHeads[FL][SL];
+            if (HeadIdx != InvalidIndex && BlockFits(m_Blocks[HeadIdx], Size, Alignment))
+                BlockIdx = HeadIdx;
+        }
+
+        if (BlockIdx == InvalidIndex)
+        {
+            // Round the size up to the next list boundary, so that any block
+            // in the first non-empty list found is large enough.
+            const OffsetType SearchSize = Size + (Alignment - 1);
+            if (SearchSize > m_FreeSize)
+                return Allocation::InvalidAllocation();
+
+            Uint32 FL = 0, SL = 0;
+            MapSize(RoundUpToListBoundary(SearchSize), FL, SL);
+            if (!FindNonEmptyList(FL, SL))
+                return Allocation::InvalidAllocation();
+
+            BlockIdx = m_FreeListHeads[FL][SL];
+            VERIFY_EXPR(BlockFits(m_Blocks[BlockIdx], Size, Alignment));
+        }
+
+        RemoveFreeBlock(BlockIdx);
+
+        //     Block.Offset
+        //        |                                  |
+        //        |<-----------Block.Size----------->|
+        //        |<---AdjustedSize--->|<--Remainder->|
+        //        |                    |
+        //      Offset              Offset + AdjustedSize
+        //
+        const OffsetType Offset       = m_Blocks[BlockIdx].Offset;
+        const OffsetType AdjustedSize = Size + (AlignUp(Offset, Alignment) - Offset);
+        const OffsetType Remainder    = m_Blocks[BlockIdx].Size - AdjustedSize;
+        if (Remainder > 0)
+        {
+            const Uint32 RemainderIdx = CreateBlock(Offset + AdjustedSize, Remainder);
+            LinkAfter(BlockIdx, RemainderIdx);
+            InsertFreeBlock(RemainderIdx);
+        }
+
+        m_Blocks[BlockIdx].Size   = AdjustedSize;
+        m_Blocks[BlockIdx].IsFree = false;
+        InsertAllocation(BlockIdx);
+
+        m_FreeSize -= AdjustedSize;
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
+    void Free(Allocation&& allocation)
+    {
+        VERIFY_EXPR(allocation.IsValid());
+        Free(allocation.UnalignedOffset, allocation.Size);
+        allocation = Allocation{};
+    }
+
+    void Free(OffsetType Offset, OffsetType Size)
+    {
+        VERIFY_EXPR(Offset != Allocation::InvalidOffset && Offset + Size <= m_MaxSize);
+
+        Uint32 BlockIdx = RemoveAllocation(Offset);
+        if (BlockIdx == InvalidIndex)
+        {
+            UNEXPECTED("Allocation at offset ", Offset, " was not found. Only allocations returned by Allocate() can be released.");
+            return;
+        }
+        VERIFY(m_Blocks[BlockIdx].Size == Size, "The size of the released allocation (", Size, ") does not match the allocated size (", m_Blocks[BlockIdx].Size, ")");
+        m_FreeSize += m_Blocks[BlockIdx].Size;
+
+        // Merge with the next block
+        //
+        //   Block.Offset            NextBlock.Offset
+        //     |                          |
+        //     |<-------Block.Size------->|<-----NextBlock.Size----->|
+        //
+        const Uint32 NextIdx = m_Blocks[BlockIdx].NextPhys;
+        if (NextIdx != InvalidIndex && m_Blocks[NextIdx].IsFree)
+        {
+            RemoveFreeBlock(NextIdx);
+            m_Blocks[BlockIdx].Size += m_Blocks[NextIdx].Size;
+            Unlink(NextIdx);
+            ReleaseBlock(NextIdx);
+        }
+
+        // Merge with the previous block
+        //
+        //   PrevBlock.Offset           Block.Offset
+        //     |                          |
+        //     |<-----PrevBlock.Size----->|<-------Block.Size------->|
+        //
+        const Uint32 PrevIdx = m_Blocks[BlockIdx].PrevPhys;
+        if (PrevIdx != InvalidIndex && m_Blocks[PrevIdx].IsFree)
+        {
+            RemoveFreeBlock(PrevIdx);
+            m_Blocks[PrevIdx].Size += m_Blocks[BlockIdx].Size;
+            Unlink(BlockIdx);
+            ReleaseBlock(BlockIdx);
+            BlockIdx = PrevIdx;
+        }
+
+        m_Blocks[BlockIdx].IsFree = true;
+        InsertFreeBlock(BlockIdx);
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+    // clang-format off
+    bool IsFull() const{ return m_FreeSize==0; };
+    bool IsEmpty()const{ return m_FreeSize==m_MaxSize; };
+    OffsetType GetMaxSize() const{return m_MaxSize;}
+    OffsetType GetFreeSize()const{return m_FreeSize;}
+    OffsetType GetUsedSize()const{return m_MaxSize - m_FreeSize;}
+    // clang-format on
+
+    size_t GetNumFreeBlocks() const
+    {
+        return m_NumFreeBlocks;
+    }
+
+    // Returns the size of the largest free block.
+    // Note that the method scans the list that contains the largest blocks and is not O(1).
+    OffsetType GetMaxFreeBlockSize() const
+    {
+        if (m_FLBitmap == 0)
+            return 0;
+
+        const Uint32 FL = PlatformMisc::GetMSB(m_FLBitmap);
+        const Uint32 SL = PlatformMisc::GetMSB(m_SLBitmaps[FL]);
+
+        OffsetType MaxSize = 0;
+        for (Uint32 BlockIdx = m_FreeListHeads[FL][SL]; BlockIdx != InvalidIndex; BlockIdx = m_Blocks[BlockIdx].NextFree)
+            MaxSize = (std::max)(MaxSize, m_Blocks[BlockIdx].Size);
+        return MaxSize;
+    }
+
+    void Extend(size_t ExtraSize)
+    {
+        if (ExtraSize == 0)
+            return;
+
+        if (m_LastBlock != InvalidIndex && m_Blocks[m_LastBlock].IsFree)
+        {
+            // Extend the last block
+            RemoveFreeBlock(m_LastBlock);
+            m_Blocks[m_LastBlock].Size += ExtraSize;
+            InsertFreeBlock(m_LastBlock);
+        }
+        else
+        {
+            const Uint32 NewBlockIdx = CreateBlock(m_MaxSize, ExtraSize);
+            if (m_LastBlock != InvalidIndex)
+                LinkAfter(m_LastBlock, NewBlockIdx);
+            else
+                m_LastBlock = NewBlockIdx;
+            InsertFreeBlock(NewBlockIdx);
+        }
+
+        m_MaxSize += ExtraSize;
+        m_FreeSize += ExtraSize;
+
+#ifdef DILIGENT_DEBUG
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+private:
+    static constexpr Uint32 InvalidIndex = ~Uint32{0};
+
+    static constexpr Uint32     SecondLevelCountLog2 = 5;
+    static constexpr Uint32     SecondLevelCount     = 1u << SecondLevelCountLog2;
+    static constexpr OffsetType SmallBlockSize       = OffsetType{SecondLevelCount};
+    static constexpr Uint32     FirstLevelCount      = sizeof(OffsetType) * 8 - SecondLevelCountLog2 + 1;
+    static_assert(FirstLevelCount <= 64, "First-level bitmap is too small");
+
+    struct BlockInfo
+    {
+        OffsetType Offset = 0;
+        OffsetType Size   = 0;
+
+        // Physically adjacent blocks
+        Uint32 PrevPhys = InvalidIndex;
+        Uint32 NextPhys = InvalidIndex;
+
+        // Blocks in the same free list. NextFree is also used to link unused block headers.
+        Uint32 PrevFree = InvalidIndex;
+        Uint32 NextFree = InvalidIndex;
+
+        bool IsFree = false;
+    };
+
+    static void MapSize(OffsetType Size, Uint32& FL, Uint32& SL)
+    {
+        VERIFY_EXPR(Size > 0);
+        if (Size < SmallBlockSize)
+        {
+            // Small blocks are kept in exact-size lists
+            FL = 0;
+            SL = static_cast<Uint32>(Size);
+        }
+        else
+        {
+            const Uint32 MSB = PlatformMisc::GetMSB(Size);
+
+            FL = MSB - SecondLevelCountLog2 + 1;
+            SL = static_cast<Uint32>(Size >> (MSB - SecondLevelCountLog2)) - SecondLevelCount;
+        }
+        VERIFY_EXPR(FL < FirstLevelCount && SL < SecondLevelCount);
+    }
+
+    static OffsetType RoundUpToListBoundary(OffsetType Size)
+    {
+        if (Size < SmallBlockSize)
+            return Size;
+
+        const OffsetType Granularity = OffsetType{1} << (PlatformMisc::GetMSB(Size) - SecondLevelCountLog2);
+        return Size + (Granularity - 1);
+    }
+
+    static bool BlockFits(const BlockInfo& Block, OffsetType Size, OffsetType Alignment)
+    {
+        return AlignUp(Block.Offset, Alignment) - Block.Offset + Size <= Block.Size;
+    }
+
+    // Finds the first non-empty list that contains blocks not smaller than the ones in list (FL, SL)
+    bool FindNonEmptyList(Uint32& FL, Uint32& SL) const
+    {
+        Uint32 SLMap = m_SLBitmaps[FL] & (~Uint32{0} << SL);
+        if (SLMap == 0)
+        {
+            const Uint64 FLMap = FL + 1 < 64 ? m_FLBitmap & (~Uint64{0} << (FL + 1)) : 0;
+            if (FLMap == 0)
+                return false;
+
+            FL    = PlatformMisc::GetLSB(FLMap);
+            SLMap = m_SLBitmaps[FL];
+            VERIFY_EXPR(SLMap != 0);
+        }
+        SL = PlatformMisc::GetLSB(SLMap);
+        return true;
+    }
+
+    void InsertFreeBlock(Uint32 BlockIdx)
+    {
+        BlockInfo& Block = m_Blocks[BlockIdx];
+        VERIFY_EXPR(Block.Size > 0);
+
+        Uint32 FL = 0, SL = 0;
+        MapSize(Block.Size, FL, SL);
+
+        Uint32& HeadIdx = m_FreeListHeads[FL][SL];
+        Block.IsFree    = true;
+        Block.PrevFree  = InvalidIndex;
+        Block.NextFree  = HeadIdx;
+        if (HeadIdx != InvalidIndex)
+            m_Blocks[HeadIdx].PrevFree = BlockIdx;
+        HeadIdx = BlockIdx;
+
+        m_FLBitmap |= Uint64{1} << FL;
+        m_SLBitmaps[FL] |= 1u << SL;
+        ++m_NumFreeBlocks;
+    }
+
+    void RemoveFreeBlock(Uint32 BlockIdx)
+    {
+        BlockInfo& Block = m_Blocks[BlockIdx];
+        VERIFY_EXPR(Block.IsFree);
+
+        Uint32 FL = 0, SL = 0;
+        MapSize(Block.Size, FL, SL);
+
+        if (Block.PrevFree != InvalidIndex)
+            m_Blocks[Block.PrevFree].NextFree = Block.NextFree;
+        else
+        {
+            VERIFY_EXPR(m_FreeListHeads[FL][SL] == BlockIdx);
+            m_FreeListHeads[FL][SL] = Block.NextFree;
+            if (Block.NextFree == InvalidIndex)
+            {
+                m_SLBitmaps[FL] &= ~(1u << SL);
+                if (m_SLBitmaps[FL] == 0)
+                    m_FLBitmap &= ~(Uint64{1} << FL);
+            }
+        }
+        if (Block.NextFree != InvalidIndex)
+            m_Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+
+        Block.PrevFree = InvalidIndex;
+        Block.NextFree = InvalidIndex;
+        Block.IsFree   = false;
+        VERIFY_EXPR(m_NumFreeBlocks > 0);
+        --m_NumFreeBlocks;
+    }
+
+    Uint32 CreateBlock(OffsetType Offset, OffsetType Size)
+    {
+        Uint32 BlockIdx = m_FirstUnusedBlock;
+        if (BlockIdx != InvalidIndex)
+        {
+            m_FirstUnusedBlock = m_Blocks[BlockIdx].NextFree;
+            m_Blocks[BlockIdx] = BlockInfo{};
+        }
+        else
+        {
+            BlockIdx = static_cast<Uint32>(m_Blocks.size());
+            m_Blocks.emplace_back();
+        }
+        m_Blocks[BlockIdx].Offset = Offset;
+        m_Blocks[BlockIdx].Size   = Size;
+        return BlockIdx;
+    }
+
+    void ReleaseBlock(Uint32 BlockIdx)
+    {
+        m_Blocks[BlockIdx]          = BlockInfo{};
+        m_Blocks[BlockIdx].NextFree = m_FirstUnusedBlock;
+        m_FirstUnusedBlock          = BlockIdx;
+    }
+
+    void LinkAfter(Uint32 BlockIdx, Uint32 NewBlockIdx)
+    {
+        const Uint32 NextIdx = m_Blocks[BlockIdx].NextPhys;
+
+        m_Blocks[NewBlockIdx].PrevPhys = BlockIdx;
+        m_Blocks[NewBlockIdx].NextPhys = NextIdx;
+        m_Blocks[BlockIdx].NextPhys    = NewBlockIdx;
+        if (NextIdx != InvalidIndex)
+            m_Blocks[NextIdx].PrevPhys = NewBlockIdx;
+        else
+            m_LastBlock = NewBlockIdx;
+    }
+
+    void Unlink(Uint32 BlockIdx)
+    {
+        const Uint32 PrevIdx = m_Blocks[BlockIdx].PrevPhys;
+        const Uint32 NextIdx = m_Blocks[BlockIdx].NextPhys;
+        if (PrevIdx != InvalidIndex)
+            m_Blocks[PrevIdx].NextPhys = NextIdx;
+        if (NextIdx != InvalidIndex)
+            m_Blocks[NextIdx].PrevPhys = PrevIdx;
+        else
+            m_LastBlock = PrevIdx;
+    }
+
+    size_t GetHomeSlot(OffsetType Offset) const
+    {
+        Uint64 Hash = static_cast<Uint64>(Offset) * Uint64{0x9E3779B97F4A7C15};
+        Hash ^= Hash >> 32;
+        return static_cast<size_t>(Hash) & (m_OffsetTable.size() - 1);
+    }
+
+    void InsertAllocation(Uint32 BlockIdx)
+    {
+        if ((m_NumAllocations + 1) * 2 > m_OffsetTable.size())
+            GrowOffsetTable();
+
+        const size_t Mask = m_OffsetTable.size() - 1;
+        for (size_t Slot = GetHomeSlot(m_Blocks[BlockIdx].Offset);; Slot = (Slot + 1) & Mask)
+        {
+            if (m_OffsetTable[Slot] == InvalidIndex)
+            {
+                m_OffsetTable[Slot] = BlockIdx;
+                break;
+            }
+        }
+        ++m_NumAllocations;
+    }
+
+    // Removes the allocation from the offset table and returns the index of its block
+    Uint32 RemoveAllocation(OffsetType Offset)
+    {
+        const size_t Mask = m_OffsetTable.size() - 1;
+
+        size_t Slot = GetHomeSlot(Offset);
+        while (m_OffsetTable[Slot] != InvalidIndex && m_Blocks[m_OffsetTable[Slot]].Offset != Offset)
+            Slot = (Slot + 1) & Mask;
+
+        const Uint32 BlockIdx = m_OffsetTable[Slot];
+        if (BlockIdx == InvalidIndex)
+            return InvalidIndex;
+
+        // Shift back the entries that follow the removed one in the probe sequence
+        for (size_t NextSlot = (Slot + 1) & Mask; m_OffsetTable[NextSlot] != InvalidIndex; NextSlot = (NextSlot + 1) & Mask)
+        {
+            const size_t HomeSlot = GetHomeSlot(m_Blocks[m_OffsetTable[NextSlot]].Offset);
+            // Move the entry if its home slot is not cyclically within (Slot, NextSlot]
+            if (((NextSlot - HomeSlot) & Mask) >= ((NextSlot - Slot) & Mask))
+            {
+                m_OffsetTable[Slot] = m_OffsetTable[NextSlot];
+                Slot                = NextSlot;
+            }
+        }
+        m_OffsetTable[Slot] = InvalidIndex;
+
+        VERIFY_EXPR(m_NumAllocations > 0);
+        --m_NumAllocations;
+        return BlockIdx;
+    }
+
+    void GrowOffsetTable()
+    {
+        std::vector<Uint32, STDAllocatorRawMem<Uint32>> OldTable(m_OffsetTable.size() * 2, Uint32{InvalidIndex}, m_OffsetTable.get_allocator());
+        std::swap(OldTable, m_OffsetTable);
+
+        const size_t Mask = m_OffsetTable.size() - 1;
+        for (Uint32 BlockIdx : OldTable)
+        {
+            if (BlockIdx == InvalidIndex)
+                continue;
+
+            size_t Slot = GetHomeSlot(m_Blocks[BlockIdx].Offset);
+            while (m_OffsetTable[Slot] != InvalidIndex)
+                Slot = (Slot + 1) & Mask;
+            m_OffsetTable[Slot] = BlockIdx;
+        }
+    }
+
+#ifdef DILIGENT_DEBUG
+    void DbgVerifyList()
+    {
+        if (m_LastBlock == InvalidIndex)
+        {
+            VERIFY_EXPR(m_MaxSize == 0 && m_NumFreeBlocks == 0 && m_FLBitmap == 0);
+            return;
+        }
+
+        VERIFY_EXPR(m_Blocks[m_LastBlock].NextPhys == InvalidIndex);
+        VERIFY_EXPR(m_Blocks[m_LastBlock].Offset + m_Blocks[m_LastBlock].Size == m_MaxSize);
+
+        OffsetType TotalFreeSize  = 0;
+        size_t     NumFreeBlocks  = 0;
+        size_t     NumAllocations = 0;
+        Uint32     BlockIdx       = m_LastBlock;
+        while (true)
+        {
+            const BlockInfo& Block = m_Blocks[BlockIdx];
+            VERIFY_EXPR(Block.Size > 0);
+            if (Block.IsFree)
+            {
+                VERIFY(Block.NextPhys == InvalidIndex || !m_Blocks[Block.NextPhys].IsFree, "Unmerged adjacent free blocks detected");
+                TotalFreeSize += Block.Size;
+                ++NumFreeBlocks;
+
+                Uint32 FL = 0, SL = 0;
+                MapSize(Block.Size, FL, SL);
+                VERIFY_EXPR((m_FLBitmap & (Uint64{1} << FL)) != 0 && (m_SLBitmaps[FL] & (1u << SL)) != 0);
+                VERIFY_EXPR(Block.PrevFree != InvalidIndex || m_FreeListHeads[FL][SL] == BlockIdx);
+            }
+            else
+            {
+                ++NumAllocations;
+            }
+
+            if (Block.PrevPhys == InvalidIndex)
+            {
+                VERIFY(Block.Offset == 0, "The first block must start at offset 0");
+                break;
+            }
+            VERIFY(m_Blocks[Block.PrevPhys].Offset + m_Blocks[Block.PrevPhys].Size == Block.Offset, "Blocks are not contiguous");
+            BlockIdx = Block.PrevPhys;
+        }
+
+        VERIFY_EXPR(TotalFreeSize == m_FreeSize);
+        VERIFY_EXPR(NumFreeBlocks == m_NumFreeBlocks);
+        VERIFY_EXPR(NumAllocations == m_NumAllocations);
+    }
+#endif
+
+    std::vector<BlockInfo, STDAllocatorRawMem<BlockInfo>> m_Blocks;
+
+    // Open-addressing hash table that maps offsets of allocated blocks to block indices
+    std::vector<Uint32, STDAllocatorRawMem<Uint32>> m_OffsetTable;
+
+    std::array<std::array<Uint32, SecondLevelCount>, FirstLevelCount> m_FreeListHeads;
+    std::array<Uint32, FirstLevelCount>                               m_SLBitmaps;
+
+    Uint64 m_FLBitmap         = 0;
+    Uint32 m_FirstUnusedBlock = InvalidIndex;
+    Uint32 m_LastBlock        = InvalidIndex;
+    size_t m_NumFreeBlocks    = 0;
+    size_t m_NumAllocations   = 0;
+
+    OffsetType m_MaxSize  = 0;
+    OffsetType m_FreeSize = 0;
+#ifdef DILIGENT_DEBUG
+    bool m_DbgDisableDebugValidation = false;
+#endif
+    // When adding new members, do not forget to update move ctor
+};
+} // namespace Diligent
@@ -391,6 +391,12 @@ public:
         return !m_FreeBlocksBySize.empty() ? m_FreeBlocksBySize.rbegin()->first : 0;
     }
 
+    // Returns the offset of the free block with the lowest offset, or InvalidOffset if there are no free blocks.
+    OffsetType GetFirstFreeBlockOffset() const
+    {
+        return !m_FreeBlocksByOffset.empty() ? m_FreeBlocksByOffset.begin()->first : OffsetType{Allocation::InvalidOffset};
+    }
+
     void Extend(size_t ExtraSize)
     {
         size_t NewBlockOffset = m_MaxSize;
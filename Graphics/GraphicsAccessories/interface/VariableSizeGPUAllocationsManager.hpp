@@ -33,13 +33,20 @@
 
 #include <deque>
 #include "VariableSizeAllocationsManager.hpp"
+#include "TLSFAllocationsManager.hpp"
 
 namespace Diligent
 {
 // Class extends basic variable-size memory block allocator by deferring deallocation
-// of freed blocks until the corresponding frame is completed
-class VariableSizeGPUAllocationsManager : public VariableSizeAllocationsManager
+// of freed blocks until the corresponding frame is completed.
+// BaseAllocationsManagerType is either VariableSizeAllocationsManager or TLSFAllocationsManager.
+template <typename BaseAllocationsManagerType>
+class VariableSizeGPUAllocationsManagerBase : public BaseAllocationsManagerType
 {
+public:
+    using OffsetType = typename BaseAllocationsManagerType::OffsetType;
+    using Allocation = typename BaseAllocationsManagerType::Allocation;
+
 private:
     struct StaleAllocationAttribs
     {
@@ -52,20 +59,20 @@ private:
     };
 
 public:
-    VariableSizeGPUAllocationsManager(OffsetType MaxSize, IMemoryAllocator& Allocator) :
-        VariableSizeAllocationsManager{MaxSize, Allocator},
+    VariableSizeGPUAllocationsManagerBase(OffsetType MaxSize, IMemoryAllocator& Allocator) :
+        BaseAllocationsManagerType{MaxSize, Allocator},
         m_StaleAllocations{0, StaleAllocationAttribs(0, 0, 0), STD_ALLOCATOR_RAW_MEM(StaleAllocationAttribs, Allocator, "Allocator for deque<StaleAllocationAttribs>")}
     {}
 
-    ~VariableSizeGPUAllocationsManager()
+    ~VariableSizeGPUAllocationsManagerBase()
     {
         VERIFY(m_StaleAllocations.empty(), "Not all stale allocations released");
         VERIFY(m_StaleAllocationsSize == 0, "Not all stale allocations released");
     }
 
     // = default causes compiler error when instantiating std::vector::emplace_back() in Visual Studio 2015 (Version 14.0.23107.0 D14REL)
-    VariableSizeGPUAllocationsManager(VariableSizeGPUAllocationsManager&& rhs) noexcept :
-        VariableSizeAllocationsManager(std::move(rhs)),
+    VariableSizeGPUAllocationsManagerBase(VariableSizeGPUAllocationsManagerBase&& rhs) noexcept :
+        BaseAllocationsManagerType(std::move(rhs)),
         m_StaleAllocations(std::move(rhs.m_StaleAllocations)),
         m_StaleAllocationsSize(rhs.m_StaleAllocationsSize)
     {
@@ -73,15 +80,15 @@ public:
     }
 
     // clang-format off
-	VariableSizeGPUAllocationsManager& operator = (VariableSizeGPUAllocationsManager&& rhs) = delete;
-    VariableSizeGPUAllocationsManager(const VariableSizeGPUAllocationsManager&) = delete;
-    VariableSizeGPUAllocationsManager& operator = (const VariableSizeGPUAllocationsManager&) = delete;
+	VariableSizeGPUAllocationsManagerBase& operator = (VariableSizeGPUAllocationsManagerBase&& rhs) = delete;
+    VariableSizeGPUAllocationsManagerBase(const VariableSizeGPUAllocationsManagerBase&) = delete;
+    VariableSizeGPUAllocationsManagerBase& operator = (const VariableSizeGPUAllocationsManagerBase&) = delete;
     // clang-format on
 
-    void Free(VariableSizeAllocationsManager::Allocation&& allocation, Uint64 FenceValue)
+    void Free(Allocation&& allocation, Uint64 FenceValue)
     {
         Free(allocation.UnalignedOffset, allocation.Size, FenceValue);
-        allocation = VariableSizeAllocationsManager::Allocation{};
+        allocation = Allocation{};
     }
 
     void Free(OffsetType Offset, OffsetType Size, Uint64 FenceValue)
@@ -102,7 +109,7 @@ public:
         while (!m_StaleAllocations.empty() && m_StaleAllocations.front().FenceValue <= LastCompletedFenceValue)
         {
             auto& OldestAllocation = m_StaleAllocations.front();
-            VariableSizeAllocationsManager::Free(OldestAllocation.Offset, OldestAllocation.Size);
+            BaseAllocationsManagerType::Free(OldestAllocation.Offset, OldestAllocation.Size);
             m_StaleAllocationsSize -= OldestAllocation.Size;
             m_StaleAllocations.pop_front();
         }
@@ -114,4 +121,8 @@ private:
     std::deque<StaleAllocationAttribs, STDAllocatorRawMem<StaleAllocationAttribs>> m_StaleAllocations;
     size_t                                                                         m_StaleAllocationsSize = 0;
 };
+
+using VariableSizeGPUAllocationsManager = VariableSizeGPUAllocationsManagerBase<VariableSizeAllocationsManager>;
+using TLSFGPUAllocationsManager         = VariableSizeGPUAllocationsManagerBase<TLSFAllocationsManager>;
+
 } // namespace Diligent
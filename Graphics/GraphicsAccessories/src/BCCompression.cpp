@@ -0,0 +1,943 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BCCompression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 BlockTexels = 16;
+
+struct TexelBlock
+{
+    // Texel values, one row per channel (RGBA)
+    alignas(16) float Ch[4][BlockTexels];
+
+    // Alpha values, used to find BC1 transparent texels
+    Uint8 Alpha[BlockTexels];
+};
+
+void LoadBlock(const CompressBCAttribs& Attribs, Uint32 BlockX, Uint32 BlockY, TexelBlock& Block)
+{
+    const auto* pSrc     = static_cast<const Uint8*>(Attribs.pSrcData);
+    const auto  NumComps = Attribs.SrcNumComponents;
+    for (Uint32 y = 0; y < 4; ++y)
+    {
+        // Replicate edge texels for incomplete blocks
+        const auto  SrcY = std::min(BlockY * 4 + y, Attribs.Height - 1);
+        const auto* pRow = pSrc + SrcY * Attribs.SrcStride;
+        for (Uint32 x = 0; x < 4; ++x)
+        {
+            const auto  SrcX   = std::min(BlockX * 4 + x, Attribs.Width - 1);
+            const auto* pTexel = pRow + SrcX * NumComps;
+            const auto  i      = y * 4 + x;
+
+            const Uint8 A = NumComps >= 4 ? pTexel[3] : 255;
+            Block.Ch[0][i] = static_cast<float>(pTexel[0]);
+            Block.Ch[1][i] = NumComps >= 2 ? static_cast<float>(pTexel[1]) : 0.f;
+            Block.Ch[2][i] = NumComps >= 3 ? static_cast<float>(pTexel[2]) : 0.f;
+            Block.Ch[3][i] = static_cast<float>(A);
+            Block.Alpha[i] = A;
+        }
+    }
+}
+
+// Maps the texel position along the endpoint segment, in 1/64 units,
+// to the index of the closest palette entry.
+class PositionToIndexMap
+{
+public:
+    // Weights are the positions of palette entries, in 1/64 units.
+    template <size_t N>
+    explicit PositionToIndexMap(const float (&Weights)[N])
+    {
+        for (Uint32 t = 0; t < m_Indices.size(); ++t)
+        {
+            Uint32 BestIdx = 0;
+            for (Uint32 i = 1; i < N; ++i)
+            {
+                if (std::abs(Weights[i] - static_cast<float>(t)) < std::abs(Weights[BestIdx] - static_cast<float>(t)))
+                    BestIdx = i;
+            }
+            m_Indices[t] = static_cast<Uint8>(BestIdx);
+        }
+    }
+
+    Uint8 operator[](Uint8 t) const
+    {
+        return m_Indices[t];
+    }
+
+private:
+    std::array<Uint8, 65> m_Indices{};
+};
+
+// Palette entry weights of the second endpoint, in 1/64 units
+constexpr float BC1Weights4[] = {0, 64, 64.f / 3.f, 128.f / 3.f};
+constexpr float BC1Weights3[] = {0, 64, 32};
+constexpr float BC4Weights8[] = {0, 64, 64.f / 7.f, 128.f / 7.f, 192.f / 7.f, 256.f / 7.f, 320.f / 7.f, 384.f / 7.f};
+constexpr float BC7Weights4[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+const PositionToIndexMap BC1Indices4{BC1Weights4};
+const PositionToIndexMap BC1Indices3{BC1Weights3};
+const PositionToIndexMap BC4Indices8{BC4Weights8};
+const PositionToIndexMap BC7Indices4{BC7Weights4};
+
+// Computes the position of every texel along the segment E0->E1, in 1/64 units clamped to [0, 64].
+void ProjectTexels(const float (*Ch)[BlockTexels], Uint32 NumCh, const float* E0, const float* E1, Uint8* Pos)
+{
+    float D[4]  = {};
+    float LenSq = 0;
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        D[c] = E1[c] - E0[c];
+        LenSq += D[c] * D[c];
+    }
+    if (LenSq < 1e-6f)
+    {
+        std::memset(Pos, 0, BlockTexels);
+        return;
+    }
+    const float Scale = 64.f / LenSq;
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128 vScale = _mm_set1_ps(Scale);
+    const __m128 vZero  = _mm_setzero_ps();
+    const __m128 vMax   = _mm_set1_ps(64.f);
+    for (Uint32 i = 0; i < BlockTexels; i += 4)
+    {
+        __m128 Dot = vZero;
+        for (Uint32 c = 0; c < NumCh; ++c)
+        {
+            const __m128 Diff = _mm_sub_ps(_mm_load_ps(&Ch[c][i]), _mm_set1_ps(E0[c]));
+            Dot               = _mm_add_ps(Dot, _mm_mul_ps(Diff, _mm_set1_ps(D[c])));
+        }
+        const __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(Dot, vScale), vZero), vMax);
+
+        __m128i ti = _mm_cvtps_epi32(t);
+        ti         = _mm_packs_epi32(ti, ti);
+        ti         = _mm_packus_epi16(ti, ti);
+
+        const int Packed = _mm_cvtsi128_si32(ti);
+        std::memcpy(Pos + i, &Packed, 4);
+    }
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t vScale = vdupq_n_f32(Scale);
+    const float32x4_t vZero  = vdupq_n_f32(0.f);
+    const float32x4_t vMax   = vdupq_n_f32(64.f);
+    const float32x4_t vHalf  = vdupq_n_f32(0.5f);
+    for (Uint32 i = 0; i < BlockTexels; i += 4)
+    {
+        float32x4_t Dot = vZero;
+        for (Uint32 c = 0; c < NumCh; ++c)
+        {
+            const float32x4_t Diff = vsubq_f32(vld1q_f32(&Ch[c][i]), vdupq_n_f32(E0[c]));
+            Dot                    = vmlaq_f32(Dot, Diff, vdupq_n_f32(D[c]));
+        }
+        const float32x4_t t = vminq_f32(vmaxq_f32(vmulq_f32(Dot, vScale), vZero), vMax);
+
+        Int32 ti[4];
+        vst1q_s32(ti, vcvtq_s32_f32(vaddq_f32(t, vHalf)));
+        for (Uint32 j = 0; j < 4; ++j)
+            Pos[i + j] = static_cast<Uint8>(ti[j]);
+    }
+#else
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        float Dot = 0;
+        for (Uint32 c = 0; c < NumCh; ++c)
+            Dot += (Ch[c][i] - E0[c]) * D[c];
+        const float t = std::min(std::max(Dot * Scale, 0.f), 64.f);
+        Pos[i]        = static_cast<Uint8>(t + 0.5f);
+    }
+#endif
+}
+
+// Finds the closest palette entry for every texel and returns the total squared error.
+float SelectClosestIndices(const float (*Ch)[BlockTexels], Uint32 NumCh, const float (*Palette)[4], Uint32 PaletteSize, Uint8* Indices)
+{
+    float TotalError = 0;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        float BestError = FLT_MAX;
+        for (Uint32 p = 0; p < PaletteSize; ++p)
+        {
+            float Error = 0;
+            for (Uint32 c = 0; c < NumCh; ++c)
+            {
+                const float d = Ch[c][i] - Palette[p][c];
+                Error += d * d;
+            }
+            if (Error < BestError)
+            {
+                BestError  = Error;
+                Indices[i] = static_cast<Uint8>(p);
+            }
+        }
+        TotalError += BestError;
+    }
+    return TotalError;
+}
+
+// Computes endpoints from the bounding box of the texels.
+void ComputeBoundingBoxEndpoints(const float (*Ch)[BlockTexels], Uint32 NumCh, float* E0, float* E1)
+{
+    float  Mean[4]   = {};
+    Uint32 RefCh     = 0;
+    float  RefRange  = -1;
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        E0[c] = E1[c] = Ch[c][0];
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+        {
+            E0[c] = std::min(E0[c], Ch[c][i]);
+            E1[c] = std::max(E1[c], Ch[c][i]);
+            Mean[c] += Ch[c][i];
+        }
+        Mean[c] /= static_cast<float>(BlockTexels);
+        if (E1[c] - E0[c] > RefRange)
+        {
+            RefRange = E1[c] - E0[c];
+            RefCh    = c;
+        }
+    }
+
+    // Select the diagonal of the box that follows the texel distribution:
+    // flip channels that are anti-correlated with the channel of the largest range.
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        if (c == RefCh)
+            continue;
+
+        float Cov = 0;
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+            Cov += (Ch[RefCh][i] - Mean[RefCh]) * (Ch[c][i] - Mean[c]);
+        if (Cov < 0)
+            std::swap(E0[c], E1[c]);
+    }
+
+    // Inset the box to reduce the average error
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        const float Inset = (E1[c] - E0[c]) / 16.f;
+        E0[c] += Inset;
+        E1[c] -= Inset;
+    }
+}
+
+// Computes endpoints as the extreme projections of the texels onto their principal axis.
+void ComputePrincipalAxisEndpoints(const float (*Ch)[BlockTexels], Uint32 NumCh, float* E0, float* E1)
+{
+    float Mean[4] = {};
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+            Mean[c] += Ch[c][i];
+        Mean[c] /= static_cast<float>(BlockTexels);
+    }
+
+    float Cov[4][4] = {};
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        for (Uint32 a = 0; a < NumCh; ++a)
+        {
+            for (Uint32 b = a; b < NumCh; ++b)
+                Cov[a][b] += (Ch[a][i] - Mean[a]) * (Ch[b][i] - Mean[b]);
+        }
+    }
+    for (Uint32 a = 0; a < NumCh; ++a)
+    {
+        for (Uint32 b = 0; b < a; ++b)
+            Cov[a][b] = Cov[b][a];
+    }
+
+    // Power iteration starting from the covariance row of the largest variance
+    Uint32 MaxVarCh = 0;
+    for (Uint32 c = 1; c < NumCh; ++c)
+    {
+        if (Cov[c][c] > Cov[MaxVarCh][MaxVarCh])
+            MaxVarCh = c;
+    }
+    float Axis[4] = {};
+    for (Uint32 c = 0; c < NumCh; ++c)
+        Axis[c] = Cov[MaxVarCh][c];
+
+    for (Uint32 Iter = 0; Iter < 8; ++Iter)
+    {
+        float NewAxis[4] = {};
+        float MaxComp    = 0;
+        for (Uint32 a = 0; a < NumCh; ++a)
+        {
+            for (Uint32 b = 0; b < NumCh; ++b)
+                NewAxis[a] += Cov[a][b] * Axis[b];
+            MaxComp = std::max(MaxComp, std::abs(NewAxis[a]));
+        }
+        if (MaxComp < 1e-6f)
+            break;
+        for (Uint32 c = 0; c < NumCh; ++c)
+            Axis[c] = NewAxis[c] / MaxComp;
+    }
+
+    float LenSq = 0;
+    for (Uint32 c = 0; c < NumCh; ++c)
+        LenSq += Axis[c] * Axis[c];
+    if (LenSq < 1e-6f)
+    {
+        // All texels are the same
+        for (Uint32 c = 0; c < NumCh; ++c)
+            E0[c] = E1[c] = Mean[c];
+        return;
+    }
+    const float InvLen = 1.f / std::sqrt(LenSq);
+    for (Uint32 c = 0; c < NumCh; ++c)
+        Axis[c] *= InvLen;
+
+    float MinT = FLT_MAX;
+    float MaxT = -FLT_MAX;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        float t = 0;
+        for (Uint32 c = 0; c < NumCh; ++c)
+            t += (Ch[c][i] - Mean[c]) * Axis[c];
+        MinT = std::min(MinT, t);
+        MaxT = std::max(MaxT, t);
+    }
+
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        E0[c] = std::min(std::max(Mean[c] + MinT * Axis[c], 0.f), 255.f);
+        E1[c] = std::min(std::max(Mean[c] + MaxT * Axis[c], 0.f), 255.f);
+    }
+}
+
+void ComputeEndpoints(const float (*Ch)[BlockTexels], Uint32 NumCh, BC_COMPRESSION_QUALITY Quality, float* E0, float* E1)
+{
+    if (Quality == BC_COMPRESSION_QUALITY::Fast)
+        ComputeBoundingBoxEndpoints(Ch, NumCh, E0, E1);
+    else
+        ComputePrincipalAxisEndpoints(Ch, NumCh, E0, E1);
+}
+
+// Refines the endpoints by least squares, given the weight of E1 for every texel.
+// Returns false if the system is degenerate.
+bool RefineEndpoints(const float (*Ch)[BlockTexels], Uint32 NumCh, const float* Weights, float* E0, float* E1)
+{
+    float AA = 0, BB = 0, AB = 0;
+    float AX[4] = {};
+    float BX[4] = {};
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        const float b = Weights[i];
+        const float a = 1.f - b;
+        AA += a * a;
+        BB += b * b;
+        AB += a * b;
+        for (Uint32 c = 0; c < NumCh; ++c)
+        {
+            AX[c] += a * Ch[c][i];
+            BX[c] += b * Ch[c][i];
+        }
+    }
+
+    const float Det = AA * BB - AB * AB;
+    if (std::abs(Det) < 1e-6f)
+        return false;
+
+    const float InvDet = 1.f / Det;
+    for (Uint32 c = 0; c < NumCh; ++c)
+    {
+        E0[c] = std::min(std::max((AX[c] * BB - BX[c] * AB) * InvDet, 0.f), 255.f);
+        E1[c] = std::min(std::max((BX[c] * AA - AX[c] * AB) * InvDet, 0.f), 255.f);
+    }
+    return true;
+}
+
+
+// BC1
+
+Uint16 QuantizeRGB565(const float* C)
+{
+    const auto R = static_cast<Uint32>(std::min(std::max(C[0], 0.f), 255.f) * (31.f / 255.f) + 0.5f);
+    const auto G = static_cast<Uint32>(std::min(std::max(C[1], 0.f), 255.f) * (63.f / 255.f) + 0.5f);
+    const auto B = static_cast<Uint32>(std::min(std::max(C[2], 0.f), 255.f) * (31.f / 255.f) + 0.5f);
+    return static_cast<Uint16>((R << 11) | (G << 5) | B);
+}
+
+void ExpandRGB565(Uint16 C, float* Color)
+{
+    const Uint32 R = (C >> 11) & 0x1F;
+    const Uint32 G = (C >> 5) & 0x3F;
+    const Uint32 B = C & 0x1F;
+
+    Color[0] = static_cast<float>((R << 3) | (R >> 2));
+    Color[1] = static_cast<float>((G << 2) | (G >> 4));
+    Color[2] = static_cast<float>((B << 3) | (B >> 2));
+    Color[3] = 255;
+}
+
+// Computes the texel indices for the given BC1 endpoints.
+// Returns the total squared error when Exact is true, and zero otherwise.
+float ComputeBC1Indices(const float (*Ch)[BlockTexels], Uint16 C0, Uint16 C1, bool ThreeColorMode, bool Exact, Uint8* Indices)
+{
+    float Palette[4][4];
+    ExpandRGB565(C0, Palette[0]);
+    ExpandRGB565(C1, Palette[1]);
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        if (ThreeColorMode)
+        {
+            Palette[2][c] = (Palette[0][c] + Palette[1][c]) / 2.f;
+        }
+        else
+        {
+            Palette[2][c] = (2.f * Palette[0][c] + Palette[1][c]) / 3.f;
+            Palette[3][c] = (Palette[0][c] + 2.f * Palette[1][c]) / 3.f;
+        }
+    }
+
+    if (Exact)
+        return SelectClosestIndices(Ch, 3, Palette, ThreeColorMode ? 3 : 4, Indices);
+
+    Uint8 Pos[BlockTexels];
+    ProjectTexels(Ch, 3, Palette[0], Palette[1], Pos);
+
+    const auto& PosToIdx = ThreeColorMode ? BC1Indices3 : BC1Indices4;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+        Indices[i] = PosToIdx[Pos[i]];
+    return 0;
+}
+
+void EncodeBC1Block(const TexelBlock& Block, bool AllowTransparent, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    bool   IsTransparent[BlockTexels] = {};
+    Uint32 NumTransparent             = 0;
+    if (AllowTransparent)
+    {
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+        {
+            IsTransparent[i] = Block.Alpha[i] < 128;
+            NumTransparent += IsTransparent[i] ? 1 : 0;
+        }
+    }
+
+    if (NumTransparent == BlockTexels)
+    {
+        // Transparent black block in three-color mode
+        std::memset(pDst, 0, 4);
+        std::memset(pDst + 4, 0xFF, 4);
+        return;
+    }
+
+    const bool ThreeColorMode = NumTransparent != 0;
+
+    // Endpoints are fitted to opaque texels only. The block is refilled by
+    // repeating opaque texels so that all functions can process 16 texels.
+    alignas(16) float FitCh[4][BlockTexels];
+    if (ThreeColorMode)
+    {
+        Uint32 NumOpaque = 0;
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+        {
+            if (IsTransparent[i])
+                continue;
+            for (Uint32 c = 0; c < 3; ++c)
+                FitCh[c][NumOpaque] = Block.Ch[c][i];
+            ++NumOpaque;
+        }
+        for (Uint32 i = NumOpaque; i < BlockTexels; ++i)
+        {
+            for (Uint32 c = 0; c < 3; ++c)
+                FitCh[c][i] = FitCh[c][i % NumOpaque];
+        }
+    }
+    const float(*Ch)[BlockTexels] = ThreeColorMode ? FitCh : Block.Ch;
+
+    float E0[4], E1[4];
+    ComputeEndpoints(Ch, 3, Quality, E0, E1);
+    Uint16 C0 = QuantizeRGB565(E0);
+    Uint16 C1 = QuantizeRGB565(E1);
+
+    Uint8 Indices[BlockTexels];
+    if (Quality == BC_COMPRESSION_QUALITY::High)
+    {
+        const auto& Weights = ThreeColorMode ? BC1Weights3 : BC1Weights4;
+
+        float BestError = ComputeBC1Indices(Ch, C0, C1, ThreeColorMode, true, Indices);
+        for (Uint32 Iter = 0; Iter < 2 && BestError > 0; ++Iter)
+        {
+            float TexelWeights[BlockTexels];
+            for (Uint32 i = 0; i < BlockTexels; ++i)
+                TexelWeights[i] = Weights[Indices[i]] / 64.f;
+            if (!RefineEndpoints(Ch, 3, TexelWeights, E0, E1))
+                break;
+
+            const auto NewC0 = QuantizeRGB565(E0);
+            const auto NewC1 = QuantizeRGB565(E1);
+            if (NewC0 == C0 && NewC1 == C1)
+                break;
+
+            Uint8       NewIndices[BlockTexels];
+            const float Error = ComputeBC1Indices(Ch, NewC0, NewC1, ThreeColorMode, true, NewIndices);
+            if (Error >= BestError)
+                break;
+
+            BestError = Error;
+            C0        = NewC0;
+            C1        = NewC1;
+            std::memcpy(Indices, NewIndices, sizeof(Indices));
+        }
+    }
+
+    // Four-color mode requires C0 > C1, three-color mode requires C0 <= C1.
+    // When C0 == C1, all texels get index 0 in either mode.
+    if (ThreeColorMode ? C0 > C1 : C0 < C1)
+        std::swap(C0, C1);
+
+    ComputeBC1Indices(Block.Ch, C0, C1, ThreeColorMode, Quality == BC_COMPRESSION_QUALITY::High, Indices);
+
+    Uint32 IndexBits = 0;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        const Uint32 Idx = IsTransparent[i] ? 3 : Indices[i];
+        IndexBits |= Idx << (i * 2);
+    }
+
+    pDst[0] = static_cast<Uint8>(C0 & 0xFF);
+    pDst[1] = static_cast<Uint8>(C0 >> 8);
+    pDst[2] = static_cast<Uint8>(C1 & 0xFF);
+    pDst[3] = static_cast<Uint8>(C1 >> 8);
+    for (Uint32 b = 0; b < 4; ++b)
+        pDst[4 + b] = static_cast<Uint8>(IndexBits >> (b * 8));
+}
+
+
+// BC4
+
+// Computes the palette of the BC4 block. Eight-value mode is used when A0 > A1.
+void ComputeBC4Palette(Uint8 A0, Uint8 A1, float (*Palette)[4])
+{
+    const float a0 = static_cast<float>(A0);
+    const float a1 = static_cast<float>(A1);
+
+    Palette[0][0] = a0;
+    Palette[1][0] = a1;
+    if (A0 > A1)
+    {
+        for (Uint32 i = 2; i < 8; ++i)
+            Palette[i][0] = (static_cast<float>(8 - i) * a0 + static_cast<float>(i - 1) * a1) / 7.f;
+    }
+    else
+    {
+        for (Uint32 i = 2; i < 6; ++i)
+            Palette[i][0] = (static_cast<float>(6 - i) * a0 + static_cast<float>(i - 1) * a1) / 5.f;
+        Palette[6][0] = 0;
+        Palette[7][0] = 255;
+    }
+}
+
+void WriteBC4Block(Uint8 A0, Uint8 A1, const Uint8* Indices, Uint8* pDst)
+{
+    Uint64 IndexBits = 0;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+        IndexBits |= Uint64{Indices[i]} << (i * 3);
+
+    pDst[0] = A0;
+    pDst[1] = A1;
+    for (Uint32 b = 0; b < 6; ++b)
+        pDst[2 + b] = static_cast<Uint8>(IndexBits >> (b * 8));
+}
+
+void EncodeBC4Block(const float (&Values)[BlockTexels], BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    const float(*Ch)[BlockTexels] = &Values;
+
+    float MinVal = Values[0];
+    float MaxVal = Values[0];
+    for (Uint32 i = 1; i < BlockTexels; ++i)
+    {
+        MinVal = std::min(MinVal, Values[i]);
+        MaxVal = std::max(MaxVal, Values[i]);
+    }
+
+    Uint8 Indices[BlockTexels] = {};
+    if (MinVal == MaxVal)
+    {
+        const auto A = static_cast<Uint8>(MinVal);
+        WriteBC4Block(A, A, Indices, pDst);
+        return;
+    }
+
+    // Eight-value mode: A0 > A1
+    Uint8 A0 = static_cast<Uint8>(MaxVal);
+    Uint8 A1 = static_cast<Uint8>(MinVal);
+    if (Quality != BC_COMPRESSION_QUALITY::High)
+    {
+        const float E0[] = {MaxVal};
+        const float E1[] = {MinVal};
+
+        Uint8 Pos[BlockTexels];
+        ProjectTexels(Ch, 1, E0, E1, Pos);
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+            Indices[i] = BC4Indices8[Pos[i]];
+        WriteBC4Block(A0, A1, Indices, pDst);
+        return;
+    }
+
+    float Palette[8][4];
+    ComputeBC4Palette(A0, A1, Palette);
+    float BestError = SelectClosestIndices(Ch, 1, Palette, 8, Indices);
+
+    // Refine eight-value endpoints
+    for (Uint32 Iter = 0; Iter < 2 && BestError > 0; ++Iter)
+    {
+        float TexelWeights[BlockTexels];
+        for (Uint32 i = 0; i < BlockTexels; ++i)
+            TexelWeights[i] = BC4Weights8[Indices[i]] / 64.f;
+
+        float E0[1], E1[1];
+        if (!RefineEndpoints(Ch, 1, TexelWeights, E0, E1))
+            break;
+
+        const auto NewA0 = static_cast<Uint8>(E0[0] + 0.5f);
+        const auto NewA1 = static_cast<Uint8>(E1[0] + 0.5f);
+        if (NewA0 <= NewA1 || (NewA0 == A0 && NewA1 == A1))
+            break;
+
+        Uint8 NewIndices[BlockTexels];
+        ComputeBC4Palette(NewA0, NewA1, Palette);
+        const float Error = SelectClosestIndices(Ch, 1, Palette, 8, NewIndices);
+        if (Error >= BestError)
+            break;
+
+        BestError = Error;
+        A0        = NewA0;
+        A1        = NewA1;
+        std::memcpy(Indices, NewIndices, sizeof(Indices));
+    }
+
+    // Six-value mode (A0 <= A1) with explicit 0 and 255 values.
+    // Endpoints are fitted to the values that are not 0 or 255.
+    float MinMid = 255;
+    float MaxMid = 0;
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+    {
+        if (Values[i] > 0 && Values[i] < 255)
+        {
+            MinMid = std::min(MinMid, Values[i]);
+            MaxMid = std::max(MaxMid, Values[i]);
+        }
+    }
+    if (MinMid > MaxMid)
+        MinMid = MaxMid = 0;
+
+    const auto SixA0 = static_cast<Uint8>(MinMid);
+    const auto SixA1 = static_cast<Uint8>(MaxMid);
+    Uint8      SixIndices[BlockTexels];
+    ComputeBC4Palette(SixA0, SixA1, Palette);
+    if (SelectClosestIndices(Ch, 1, Palette, 8, SixIndices) < BestError)
+    {
+        A0 = SixA0;
+        A1 = SixA1;
+        std::memcpy(Indices, SixIndices, sizeof(Indices));
+    }
+
+    WriteBC4Block(A0, A1, Indices, pDst);
+}
+
+
+// BC7
+
+class BlockBitWriter
+{
+public:
+    explicit BlockBitWriter(Uint8* pDst) :
+        m_pDst{pDst}
+    {
+        std::memset(m_pDst, 0, 16);
+    }
+
+    void Write(Uint32 Value, Uint32 NumBits)
+    {
+        for (Uint32 b = 0; b < NumBits; ++b, ++m_Pos)
+        {
+            if (Value & (1u << b))
+                m_pDst[m_Pos >> 3] |= static_cast<Uint8>(1u << (m_Pos & 7u));
+        }
+    }
+
+private:
+    Uint8* const m_pDst;
+    Uint32       m_Pos = 0;
+};
+
+struct BC7Endpoint
+{
+    Uint8 Q[4]; // 7-bit components
+    Uint8 P;    // P-bit
+
+    void Expand(float* Color) const
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            Color[c] = static_cast<float>((Q[c] << 1) | P);
+    }
+};
+
+// Quantizes the endpoint to 7-bit components with a shared P-bit
+BC7Endpoint QuantizeBC7Endpoint(const float* E)
+{
+    BC7Endpoint Best{};
+    float       BestError = FLT_MAX;
+    for (Uint8 P = 0; P < 2; ++P)
+    {
+        BC7Endpoint Ep{};
+        Ep.P        = P;
+        float Error = 0;
+        for (Uint32 c = 0; c < 4; ++c)
+        {
+            const float Q = std::min(std::max((E[c] - P) * 0.5f + 0.5f, 0.f), 127.f);
+            Ep.Q[c]       = static_cast<Uint8>(Q);
+
+            const float d = static_cast<float>((Ep.Q[c] << 1) | P) - E[c];
+            Error += d * d;
+        }
+        if (Error < BestError)
+        {
+            BestError = Error;
+            Best      = Ep;
+        }
+    }
+    return Best;
+}
+
+// Computes the texel indices for the given mode 6 endpoints.
+// Returns the total squared error when Exact is true, and zero otherwise.
+float ComputeBC7Indices(const float (*Ch)[BlockTexels], const BC7Endpoint& Ep0, const BC7Endpoint& Ep1, bool Exact, Uint8* Indices)
+{
+    float E0[4], E1[4];
+    Ep0.Expand(E0);
+    Ep1.Expand(E1);
+
+    if (Exact)
+    {
+        float Palette[16][4];
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            const auto W = static_cast<Uint32>(BC7Weights4[i]);
+            for (Uint32 c = 0; c < 4; ++c)
+            {
+                const auto e0 = static_cast<Uint32>(E0[c]);
+                const auto e1 = static_cast<Uint32>(E1[c]);
+                Palette[i][c] = static_cast<float>(((64 - W) * e0 + W * e1 + 32) >> 6);
+            }
+        }
+        return SelectClosestIndices(Ch, 4, Palette, 16, Indices);
+    }
+
+    Uint8 Pos[BlockTexels];
+    ProjectTexels(Ch, 4, E0, E1, Pos);
+    for (Uint32 i = 0; i < BlockTexels; ++i)
+        Indices[i] = BC7Indices4[Pos[i]];
+    return 0;
+}
+
+void EncodeBC7Block(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    float E0[4], E1[4];
+    ComputeEndpoints(Block.Ch, 4, Quality, E0, E1);
+    auto Ep0 = QuantizeBC7Endpoint(E0);
+    auto Ep1 = QuantizeBC7Endpoint(E1);
+
+    Uint8 Indices[BlockTexels];
+    if (Quality == BC_COMPRESSION_QUALITY::High)
+    {
+        float BestError = ComputeBC7Indices(Block.Ch, Ep0, Ep1, true, Indices);
+        for (Uint32 Iter = 0; Iter < 2 && BestError > 0; ++Iter)
+        {
+            float TexelWeights[BlockTexels];
+            for (Uint32 i = 0; i < BlockTexels; ++i)
+                TexelWeights[i] = BC7Weights4[Indices[i]] / 64.f;
+            if (!RefineEndpoints(Block.Ch, 4, TexelWeights, E0, E1))
+                break;
+
+            const auto NewEp0 = QuantizeBC7Endpoint(E0);
+            const auto NewEp1 = QuantizeBC7Endpoint(E1);
+
+            Uint8       NewIndices[BlockTexels];
+            const float Error = ComputeBC7Indices(Block.Ch, NewEp0, NewEp1, true, NewIndices);
+            if (Error >= BestError)
+                break;
+
+            BestError = Error;
+            Ep0       = NewEp0;
+            Ep1       = NewEp1;
+            std::memcpy(Indices, NewIndices, sizeof(Indices));
+        }
+    }
+    else
+    {
+        ComputeBC7Indices(Block.Ch, Ep0, Ep1, false, Indices);
+    }
+
+    // The most significant bit of the first index is implicitly zero
+    if (Indices[0] >= 8)
+    {
+        std::swap(Ep0, Ep1);
+        for (auto& Idx : Indices)
+            Idx = static_cast<Uint8>(15 - Idx);
+    }
+
+    BlockBitWriter Writer{pDst};
+    Writer.Write(1u << 6, 7); // Mode 6
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        Writer.Write(Ep0.Q[c], 7);
+        Writer.Write(Ep1.Q[c], 7);
+    }
+    Writer.Write(Ep0.P, 1);
+    Writer.Write(Ep1.P, 1);
+    Writer.Write(Indices[0], 3);
+    for (Uint32 i = 1; i < BlockTexels; ++i)
+        Writer.Write(Indices[i], 4);
+}
+
+
+using EncodeBlockType = void (*)(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst);
+
+void EncodeBC1(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    EncodeBC1Block(Block, true, Quality, pDst);
+}
+
+void EncodeBC3(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    EncodeBC4Block(Block.Ch[3], Quality, pDst);
+    EncodeBC1Block(Block, false, Quality, pDst + 8);
+}
+
+void EncodeBC4(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    EncodeBC4Block(Block.Ch[0], Quality, pDst);
+}
+
+void EncodeBC5(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    EncodeBC4Block(Block.Ch[0], Quality, pDst);
+    EncodeBC4Block(Block.Ch[1], Quality, pDst + 8);
+}
+
+void EncodeBC7(const TexelBlock& Block, BC_COMPRESSION_QUALITY Quality, Uint8* pDst)
+{
+    EncodeBC7Block(Block, Quality, pDst);
+}
+
+EncodeBlockType GetBlockEncoder(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            return EncodeBC1;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            return EncodeBC3;
+
+        case TEX_FORMAT_BC4_UNORM:
+            return EncodeBC4;
+
+        case TEX_FORMAT_BC5_UNORM:
+            return EncodeBC5;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return EncodeBC7;
+
+        default:
+            return nullptr;
+    }
+}
+
+} // namespace
+
+bool IsBCCompressionSupported(TEXTURE_FORMAT Format)
+{
+    return GetBlockEncoder(Format) != nullptr;
+}
+
+void CompressBC(const CompressBCAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.Width != 0, "Width must not be zero");
+    DEV_CHECK_ERR(Attribs.Height != 0, "Height must not be zero");
+    DEV_CHECK_ERR(Attribs.SrcNumComponents >= 1 && Attribs.SrcNumComponents <= 4, "Invalid number of source components (", Attribs.SrcNumComponents, ")");
+    DEV_CHECK_ERR(Attribs.pSrcData != nullptr, "Source data must not be null");
+    DEV_CHECK_ERR(Attribs.SrcStride >= size_t{Attribs.Width} * Attribs.SrcNumComponents, "Source stride is too small");
+    DEV_CHECK_ERR(Attribs.pDstData != nullptr, "Destination data must not be null");
+
+    const auto EncodeBlock = GetBlockEncoder(Attribs.DstFormat);
+    if (EncodeBlock == nullptr)
+    {
+        UNSUPPORTED("Texture format ", GetTextureFormatAttribs(Attribs.DstFormat).Name, " is not supported by the BC compressor");
+        return;
+    }
+
+    const auto& FmtAttribs   = GetTextureFormatAttribs(Attribs.DstFormat);
+    const auto  BlockSize    = Uint32{FmtAttribs.ComponentSize};
+    const auto  NumBlocksX   = (Attribs.Width + 3) / 4;
+    const auto  NumBlocksY   = (Attribs.Height + 3) / 4;
+    DEV_CHECK_ERR(Attribs.DstStride >= size_t{NumBlocksX} * BlockSize, "Destination stride is too small");
+
+    auto* const pDst = static_cast<Uint8*>(Attribs.pDstData);
+    // Process at least 256 blocks per task to keep the scheduling overhead low
+    const Uint32 BlockRowsPerTask = std::max(256u / NumBlocksX, 1u);
+    ParallelFor(Attribs.pThreadPool, 0, NumBlocksY, BlockRowsPerTask,
+                [&](Uint32 BlockY) {
+                    auto* pDstRow = pDst + BlockY * Attribs.DstStride;
+
+                    TexelBlock Block;
+                    for (Uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+                    {
+                        LoadBlock(Attribs, BlockX, BlockY, Block);
+                        EncodeBlock(Block, Attribs.Quality, pDstRow + BlockX * BlockSize);
+                    }
+                });
+}
+
+} // namespace Diligent
@@ -27,7 +27,10 @@
 
 #include <array>
 #include <algorithm>
+#include <cstring>
+
 #include "ColorConversion.h"
+#include "Intrinsics.hpp"
 
 namespace Diligent
 {
@@ -77,6 +80,109 @@ private:
     };
 };
 
+// Converts linear values to 8-bit gamma values.
+// The table is indexed by the linear value in [0, 1] range quantized to 12 bits.
+class LinearToSRGB8Map
+{
+public:
+    static constexpr Uint32 NumBits = 12;
+    static constexpr Uint32 Size    = 1u << NumBits;
+
+    Uint8 operator[](Uint32 Idx) const
+    {
+        return m_ToSRGB8[Idx];
+    }
+
+private:
+    const std::array<Uint8, Size> m_ToSRGB8{
+        []() {
+            std::array<Uint8, Size> ToSRGB8;
+            for (Uint32 i = 0; i < Size; ++i)
+            {
+                // Use the center of the interval
+                const float Linear = (static_cast<float>(i) + 0.5f) / static_cast<float>(Size);
+                ToSRGB8[i]         = static_cast<Uint8>(std::min(LinearToGamma(Linear) * 255.f + 0.5f, 255.f));
+            }
+            return ToSRGB8;
+        }(),
+    };
+};
+
+// Converts finite positive values in half-float range. Small values are flushed to zero.
+Uint16 FloatToHalf(float f)
+{
+    Uint32 x;
+    memcpy(&x, &f, sizeof(x));
+
+    const Uint32 Sign = (x >> 16) & 0x8000u;
+    const Int32  Exp  = static_cast<Int32>((x >> 23) & 0xFFu) - 127 + 15;
+    const Uint32 Mant = x & 0x7FFFFFu;
+    if (Exp <= 0)
+        return static_cast<Uint16>(Sign);
+    if (Exp >= 31)
+        return static_cast<Uint16>(Sign | 0x7C00u);
+
+    Uint32 h = Sign | (static_cast<Uint32>(Exp) << 10u) | (Mant >> 13u);
+    // Round to nearest even
+    const Uint32 Rem = Mant & 0x1FFFu;
+    if (Rem > 0x1000u || (Rem == 0x1000u && (h & 1u) != 0))
+        ++h;
+    return static_cast<Uint16>(h);
+}
+
+// Converts half to float by shifting the exponent and mantissa into place and rescaling the exponent.
+// This handles normal and denormal values. Infinities and NaNs are converted to large finite values.
+float HalfToFloat(Uint16 h)
+{
+    const Uint32 Bits = (Uint32{h} & 0x7FFFu) << 13u;
+
+    float f;
+    memcpy(&f, &Bits, sizeof(f));
+    f *= 5.192296858534828e+33f; // 2^112
+    return (h & 0x8000u) != 0 ? -f : f;
+}
+
+class UNorm8ToHalfMap
+{
+public:
+    Uint16 operator[](Uint8 x) const
+    {
+        return m_ToHalf[x];
+    }
+
+private:
+    const std::array<Uint16, 256> m_ToHalf{
+        []() {
+            std::array<Uint16, 256> ToHalf;
+            for (Uint32 i = 0; i < ToHalf.size(); ++i)
+            {
+                ToHalf[i] = FloatToHalf(static_cast<float>(i) / 255.f);
+            }
+            return ToHalf;
+        }(),
+    };
+};
+
+inline Uint32 LinearToSRGB8Index(float x)
+{
+    // NB: std::max(0.f, NaN) returns 0
+    x = std::min(std::max(0.f, x), 1.f);
+    return std::min(static_cast<Uint32>(x * static_cast<float>(LinearToSRGB8Map::Size)), LinearToSRGB8Map::Size - 1);
+}
+
+inline Uint8 UNormFloatToUint8(float x)
+{
+    x = std::min(std::max(0.f, x), 1.f);
+    return static_cast<Uint8>(x * 255.f + 0.5f);
+}
+
+inline Uint8 PremultiplyUint8(Uint32 c, Uint32 a)
+{
+    // Exact round(c * a / 255)
+    const Uint32 t = c * a + 128;
+    return static_cast<Uint8>((t + (t >> 8)) >> 8);
+}
+
 } // namespace
 
 float LinearToGamma(Uint8 x)
@@ -91,4 +197,250 @@ float GammaToLinear(Uint8 x)
     return map[x];
 }
 
+
+void SRGBA8ToLinearRGBA32F(const Uint8* pSrc, float* pDst, size_t NumTexels)
+{
+    // The conversion is table-based, so there is no benefit from SIMD
+    static const GammaToLinearMap ToLinear;
+    for (size_t i = 0; i < NumTexels; ++i, pSrc += 4, pDst += 4)
+    {
+        pDst[0] = ToLinear[pSrc[0]];
+        pDst[1] = ToLinear[pSrc[1]];
+        pDst[2] = ToLinear[pSrc[2]];
+        pDst[3] = static_cast<float>(pSrc[3]) * (1.f / 255.f);
+    }
+}
+
+void LinearRGBA32FToSRGBA8(const float* pSrc, Uint8* pDst, size_t NumTexels)
+{
+    static const LinearToSRGB8Map ToSRGB8;
+
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128  Zero   = _mm_setzero_ps();
+        const __m128  One    = _mm_set1_ps(1.f);
+        const __m128  Scale  = _mm_setr_ps(static_cast<float>(LinearToSRGB8Map::Size), static_cast<float>(LinearToSRGB8Map::Size), static_cast<float>(LinearToSRGB8Map::Size), 255.f);
+        const __m128  Bias   = _mm_setr_ps(0.f, 0.f, 0.f, 0.5f);
+        const __m128i MaxIdx = _mm_setr_epi32(LinearToSRGB8Map::Size - 1, LinearToSRGB8Map::Size - 1, LinearToSRGB8Map::Size - 1, 255);
+        for (; i < NumTexels; ++i, pSrc += 4, pDst += 4)
+        {
+            __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(pSrc), Zero), One);
+            v        = _mm_add_ps(_mm_mul_ps(v, Scale), Bias);
+
+            // Compare as signed integers - the values are never negative
+            __m128i Idx = _mm_cvttps_epi32(v);
+            Idx         = _mm_or_si128(_mm_and_si128(_mm_cmplt_epi32(Idx, MaxIdx), Idx), _mm_andnot_si128(_mm_cmplt_epi32(Idx, MaxIdx), MaxIdx));
+
+            alignas(16) Int32 Indices[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(Indices), Idx);
+            pDst[0] = ToSRGB8[Indices[0]];
+            pDst[1] = ToSRGB8[Indices[1]];
+            pDst[2] = ToSRGB8[Indices[2]];
+            pDst[3] = static_cast<Uint8>(Indices[3]);
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    {
+        constexpr float  S         = static_cast<float>(LinearToSRGB8Map::Size);
+        constexpr Uint32 M         = LinearToSRGB8Map::Size - 1;
+        const float      fScale[]  = {S, S, S, 255.f};
+        const float      fBias[]   = {0.f, 0.f, 0.f, 0.5f};
+        const Uint32     uMaxIdx[] = {M, M, M, 255};
+
+        const float32x4_t Zero   = vdupq_n_f32(0.f);
+        const float32x4_t One    = vdupq_n_f32(1.f);
+        const float32x4_t Scale  = vld1q_f32(fScale);
+        const float32x4_t Bias   = vld1q_f32(fBias);
+        const uint32x4_t  MaxIdx = vld1q_u32(uMaxIdx);
+        for (; i < NumTexels; ++i, pSrc += 4, pDst += 4)
+        {
+            float32x4_t v = vminq_f32(vmaxq_f32(vld1q_f32(pSrc), Zero), One);
+            v             = vaddq_f32(vmulq_f32(v, Scale), Bias);
+
+            const uint32x4_t Idx = vminq_u32(vcvtq_u32_f32(v), MaxIdx);
+            pDst[0]              = ToSRGB8[vgetq_lane_u32(Idx, 0)];
+            pDst[1]              = ToSRGB8[vgetq_lane_u32(Idx, 1)];
+            pDst[2]              = ToSRGB8[vgetq_lane_u32(Idx, 2)];
+            pDst[3]              = static_cast<Uint8>(vgetq_lane_u32(Idx, 3));
+        }
+    }
+#endif
+    for (; i < NumTexels; ++i, pSrc += 4, pDst += 4)
+    {
+        pDst[0] = ToSRGB8[LinearToSRGB8Index(pSrc[0])];
+        pDst[1] = ToSRGB8[LinearToSRGB8Index(pSrc[1])];
+        pDst[2] = ToSRGB8[LinearToSRGB8Index(pSrc[2])];
+        pDst[3] = UNormFloatToUint8(pSrc[3]);
+    }
+}
+
+void RGBA16FToRGBA8(const Uint16* pSrc, Uint8* pDst, size_t NumTexels)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        // Same conversion as in HalfToFloat()
+        auto HalfToFloat4 = [](__m128i h) {
+            const __m128i Bits = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+            const __m128i Sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+            const __m128  f    = _mm_mul_ps(_mm_castsi128_ps(Bits), _mm_set1_ps(5.192296858534828e+33f));
+            return _mm_or_ps(f, _mm_castsi128_ps(Sign));
+        };
+        auto ToUNorm8 = [](__m128 f) {
+            f = _mm_min_ps(_mm_max_ps(f, _mm_setzero_ps()), _mm_set1_ps(1.f));
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(f, _mm_set1_ps(255.f)), _mm_set1_ps(0.5f)));
+        };
+
+        const __m128i Zero = _mm_setzero_si128();
+        // Process four texels at a time
+        for (; i + 4 <= NumTexels; i += 4, pSrc += 16, pDst += 16)
+        {
+            const __m128i h01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+            const __m128i h23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 8));
+
+            const __m128i t0 = ToUNorm8(HalfToFloat4(_mm_unpacklo_epi16(h01, Zero)));
+            const __m128i t1 = ToUNorm8(HalfToFloat4(_mm_unpackhi_epi16(h01, Zero)));
+            const __m128i t2 = ToUNorm8(HalfToFloat4(_mm_unpacklo_epi16(h23, Zero)));
+            const __m128i t3 = ToUNorm8(HalfToFloat4(_mm_unpackhi_epi16(h23, Zero)));
+
+            const __m128i Res = _mm_packus_epi16(_mm_packs_epi32(t0, t1), _mm_packs_epi32(t2, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), Res);
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    {
+        auto HalfToFloat4 = [](uint32x4_t h) {
+            const uint32x4_t  Bits = vshlq_n_u32(vandq_u32(h, vdupq_n_u32(0x7FFF)), 13);
+            const uint32x4_t  Sign = vshlq_n_u32(vandq_u32(h, vdupq_n_u32(0x8000)), 16);
+            const float32x4_t f    = vmulq_n_f32(vreinterpretq_f32_u32(Bits), 5.192296858534828e+33f);
+            return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(f), Sign));
+        };
+        auto ToUNorm8 = [](float32x4_t f) {
+            f = vminq_f32(vmaxq_f32(f, vdupq_n_f32(0.f)), vdupq_n_f32(1.f));
+            return vmovn_u32(vcvtq_u32_f32(vaddq_f32(vmulq_n_f32(f, 255.f), vdupq_n_f32(0.5f))));
+        };
+
+        for (; i + 4 <= NumTexels; i += 4, pSrc += 16, pDst += 16)
+        {
+            const uint16x8_t h01 = vld1q_u16(pSrc);
+            const uint16x8_t h23 = vld1q_u16(pSrc + 8);
+
+            const uint16x4_t t0 = ToUNorm8(HalfToFloat4(vmovl_u16(vget_low_u16(h01))));
+            const uint16x4_t t1 = ToUNorm8(HalfToFloat4(vmovl_u16(vget_high_u16(h01))));
+            const uint16x4_t t2 = ToUNorm8(HalfToFloat4(vmovl_u16(vget_low_u16(h23))));
+            const uint16x4_t t3 = ToUNorm8(HalfToFloat4(vmovl_u16(vget_high_u16(h23))));
+
+            vst1q_u8(pDst, vcombine_u8(vmovn_u16(vcombine_u16(t0, t1)), vmovn_u16(vcombine_u16(t2, t3))));
+        }
+    }
+#endif
+    for (; i < NumTexels; ++i, pSrc += 4, pDst += 4)
+    {
+        for (Uint32 c = 0; c < 4; ++c)
+            pDst[c] = UNormFloatToUint8(HalfToFloat(pSrc[c]));
+    }
+}
+
+void RGBA8ToRGBA16F(const Uint8* pSrc, Uint16* pDst, size_t NumTexels)
+{
+    // The conversion is table-based, so there is no benefit from SIMD
+    static const UNorm8ToHalfMap ToHalf;
+    for (size_t i = 0; i < NumTexels * 4; ++i)
+        pDst[i] = ToHalf[pSrc[i]];
+}
+
+void PremultiplyAlphaRGBA8(Uint8* pData, size_t NumTexels)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128i Zero      = _mm_setzero_si128();
+        const __m128i Bias      = _mm_set1_epi16(128);
+        const __m128i AlphaMask = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+
+        // Premultiplies two texels stored as 16-bit values
+        auto Premultiply2Texels = [&](__m128i c) {
+            __m128i a = _mm_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3));
+            a         = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+
+            // The same rounding as in PremultiplyUint8(). All values fit into unsigned 16 bits.
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(c, a), Bias);
+            t         = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+            // Keep the original alpha
+            return _mm_or_si128(_mm_andnot_si128(AlphaMask, t), _mm_and_si128(AlphaMask, c));
+        };
+
+        for (; i + 4 <= NumTexels; i += 4, pData += 16)
+        {
+            const __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
+            const __m128i lo = Premultiply2Texels(_mm_unpacklo_epi8(v, Zero));
+            const __m128i hi = Premultiply2Texels(_mm_unpackhi_epi8(v, Zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pData), _mm_packus_epi16(lo, hi));
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    {
+        const uint16x8_t Bias = vdupq_n_u16(128);
+
+        auto Premultiply8 = [Bias](uint8x8_t c, uint8x8_t a) {
+            // The same rounding as in PremultiplyUint8()
+            const uint16x8_t t = vaddq_u16(vmull_u8(c, a), Bias);
+            return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+        };
+
+        for (; i + 8 <= NumTexels; i += 8, pData += 32)
+        {
+            uint8x8x4_t v = vld4_u8(pData);
+            v.val[0]      = Premultiply8(v.val[0], v.val[3]);
+            v.val[1]      = Premultiply8(v.val[1], v.val[3]);
+            v.val[2]      = Premultiply8(v.val[2], v.val[3]);
+            vst4_u8(pData, v);
+        }
+    }
+#endif
+    for (; i < NumTexels; ++i, pData += 4)
+    {
+        const Uint32 a = pData[3];
+        pData[0]       = PremultiplyUint8(pData[0], a);
+        pData[1]       = PremultiplyUint8(pData[1], a);
+        pData[2]       = PremultiplyUint8(pData[2], a);
+    }
+}
+
+void PremultiplyAlphaRGBA32F(float* pData, size_t NumTexels)
+{
+    size_t i = 0;
+#if DILIGENT_SSE2_ENABLED
+    {
+        const __m128 AlphaMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+        for (; i < NumTexels; ++i, pData += 4)
+        {
+            const __m128 v = _mm_loadu_ps(pData);
+            const __m128 a = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+            // Keep the original alpha
+            const __m128 Res = _mm_or_ps(_mm_andnot_ps(AlphaMask, _mm_mul_ps(v, a)), _mm_and_ps(AlphaMask, v));
+            _mm_storeu_ps(pData, Res);
+        }
+    }
+#elif DILIGENT_NEON_ENABLED
+    {
+        for (; i < NumTexels; ++i, pData += 4)
+        {
+            const float32x4_t v = vld1q_f32(pData);
+            const float       a = vgetq_lane_f32(v, 3);
+            vst1q_f32(pData, vsetq_lane_f32(a, vmulq_n_f32(v, a), 3));
+        }
+    }
+#endif
+    for (; i < NumTexels; ++i, pData += 4)
+    {
+        const float a = pData[3];
+        pData[0] *= a;
+        pData[1] *= a;
+        pData[2] *= a;
+    }
+}
+
 } // namespace Diligent
@@ -28,6 +28,7 @@
 #include "DynamicAtlasManager.hpp"
 
 #include <climits>
+#include <algorithm>
 
 #include "AdvancedMath.hpp"
 
@@ -36,6 +37,55 @@ namespace Diligent
 
 static const DynamicAtlasManager::Region InvalidRegion{UINT_MAX, UINT_MAX, 0, 0};
 
+DynamicAtlasManager::BlockPool::~BlockPool()
+{
+    for (auto*& pBlock : m_FreeLists)
+    {
+        while (pBlock != nullptr)
+        {
+            auto* pNext = pBlock->pNext;
+            ::operator delete(pBlock);
+            pBlock = pNext;
+        }
+    }
+}
+
+void* DynamicAtlasManager::BlockPool::Allocate(size_t Size)
+{
+    VERIFY_EXPR(Size > 0);
+    if (Size > MaxPooledSize)
+        return ::operator new(Size);
+
+    auto& pFreeBlock = m_FreeLists[(Size - 1) / BlockGranularity];
+    if (pFreeBlock != nullptr)
+    {
+        auto* pBlock = pFreeBlock;
+        pFreeBlock   = pBlock->pNext;
+        return pBlock;
+    }
+
+    // Allocate the block of the full bucket size so that it can be reused by any request from the same bucket
+    return ::operator new(((Size - 1) / BlockGranularity + 1) * BlockGranularity);
+}
+
+void DynamicAtlasManager::BlockPool::Free(void* Ptr, size_t Size)
+{
+    if (Ptr == nullptr)
+        return;
+
+    if (Size > MaxPooledSize)
+    {
+        ::operator delete(Ptr);
+        return;
+    }
+
+    auto& pFreeBlock = m_FreeLists[(Size - 1) / BlockGranularity];
+
+    auto* pBlock  = static_cast<FreeBlock*>(Ptr);
+    pBlock->pNext = pFreeBlock;
+    pFreeBlock    = pBlock;
+}
+
 #if DILIGENT_DEBUG
 void DynamicAtlasManager::Node::Validate() const
 {
@@ -71,13 +121,17 @@ void DynamicAtlasManager::Node::Validate() const
 }
 #endif
 
-void DynamicAtlasManager::Node::Split(const std::initializer_list<Region>& Regions)
+void DynamicAtlasManager::Node::Split(const std::initializer_list<Region>& Regions, BlockPool& Pool)
 {
     VERIFY(Regions.size() >= 2, "There must be at least two regions");
     VERIFY(!HasChildren(), "This node already has children and can't be split");
     VERIFY(!IsAllocated, "Allocated region can't be split");
 
-    Children.reset(new Node[Regions.size()]);
+    static_assert(std::is_trivially_destructible<Node>::value, "Node must be trivially destructible as destructors are never called");
+    Children = static_cast<Node*>(Pool.Allocate(sizeof(Node) * Regions.size()));
+    for (size_t i = 0; i < Regions.size(); ++i)
+        new (Children + i) Node{};
+
     NumChildren = 0;
     for (const auto& ChildR : Regions)
     {
@@ -101,22 +155,42 @@ bool DynamicAtlasManager::Node::CanMergeChildren() const
     return CanMerge;
 }
 
-void DynamicAtlasManager::Node::MergeChildren()
+void DynamicAtlasManager::Node::MergeChildren(BlockPool& Pool)
 {
     VERIFY_EXPR(HasChildren());
     VERIFY_EXPR(CanMergeChildren());
-    Children.reset();
+    Pool.Free(Children, sizeof(Node) * NumChildren);
+    Children    = nullptr;
+    NumChildren = 0;
+}
+
+void DynamicAtlasManager::Node::ReleaseChildren(BlockPool& Pool)
+{
+    for (Uint32 i = 0; i < NumChildren; ++i)
+        Children[i].ReleaseChildren(Pool);
+
+    Pool.Free(Children, sizeof(Node) * NumChildren);
+    Children    = nullptr;
     NumChildren = 0;
 }
 
 
-DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height) :
+DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingStrategy Strategy) :
     m_Width{Width},
     m_Height{Height},
-    m_TotalFreeArea{Uint64{Width} * Uint64{Height}}
+    m_Strategy{Strategy},
+    m_TotalFreeArea{Uint64{Width} * Uint64{Height}},
+    m_pPool{std::make_shared<BlockPool>()},
+    m_FreeRegionsByWidth{WidthFirstCompare{}, PoolAllocator<RegionNodePair>{m_pPool}},
+    m_FreeRegionsByHeight{HeightFirstCompare{}, PoolAllocator<RegionNodePair>{m_pPool}},
+    m_AllocatedRegions{0, Region::Hasher{}, std::equal_to<Region>{}, PoolAllocator<RegionNodePair>{m_pPool}},
+    m_SkylineFreeRects{WidthFirstCompare{}, PoolAllocator<Region>{m_pPool}}
 {
     m_Root->R = Region{0, 0, Width, Height};
-    RegisterNode(*m_Root);
+    if (m_Strategy == PackingStrategy::Skyline)
+        ResetSkyline();
+    else
+        RegisterNode(*m_Root);
 }
 
 
@@ -128,10 +202,18 @@ DynamicAtlasManager::~DynamicAtlasManager()
         DbgVerifyConsistency();
 #endif
 
+        if (m_Strategy == PackingStrategy::Skyline)
+        {
+            DEV_CHECK_ERR(m_AllocatedRegions.empty(), "There must be no allocated regions");
+            return;
+        }
+
         DEV_CHECK_ERR(!m_Root->IsAllocated && !m_Root->HasChildren(), "Root node is expected to be free and have no children");
         VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
         DEV_CHECK_ERR(m_FreeRegionsByWidth.size() == 1, "There expected to be a single free region");
         DEV_CHECK_ERR(m_AllocatedRegions.empty(), "There must be no allocated regions");
+
+        m_Root->ReleaseChildren(*m_pPool);
     }
     else
     {
@@ -184,6 +266,9 @@ void DynamicAtlasManager::UnregisterNode(const Node& N)
 
 DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 Height)
 {
+    if (m_Strategy == PackingStrategy::Skyline)
+        return AllocateSkyline(Width, Height);
+
     auto it_w = m_FreeRegionsByWidth.lower_bound(Region{0, 0, Width, 0});
     while (it_w != m_FreeRegionsByWidth.end() && it_w->first.height < Height)
         ++it_w;
@@ -240,7 +325,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                     Region{R.x + Width, R.y,          R.width - Width, R.height         }, // A
                     Region{R.x,         R.y + Height, Width,           R.height - Height}  // B
                     // clang-format on
-                });
+                },
+                *m_pPool);
         }
         else
         {
@@ -261,7 +347,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                     Region{R.x,         R.y + Height, R.width,         R.height - Height}, // A
                     Region{R.x + Width, R.y,          R.width - Width, Height           }  // B
                     // clang-format on
-                });
+                },
+                *m_pPool);
         }
     }
     else if (R.width > Width)
@@ -277,7 +364,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                 Region{R.x,         R.y, Width,           Height  }, // R
                 Region{R.x + Width, R.y, R.width - Width, R.height}  // A
                 // clang-format on
-            });
+            },
+            *m_pPool);
     }
     else if (R.height > Height)
     {
@@ -295,7 +383,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                 Region{R.x,          R.y,   Width, Height           }, // R
                 Region{R.x, R.y + Height, R.width, R.height - Height}  // A
                 // clang-format on
-            });
+            },
+            *m_pPool);
     }
 
     R.width  = Width;
@@ -333,6 +422,13 @@ void DynamicAtlasManager::Free(Region&& R)
     DbgVerifyRegion(R);
 #endif
 
+    if (m_Strategy == PackingStrategy::Skyline)
+    {
+        FreeSkyline(R);
+        R = InvalidRegion;
+        return;
+    }
+
     auto node_it = m_AllocatedRegions.find(R);
     if (node_it == m_AllocatedRegions.end())
     {
@@ -354,7 +450,7 @@ void DynamicAtlasManager::Free(Region&& R)
                            {
                                UnregisterNode(Child);
                            });
-        N->MergeChildren();
+        N->MergeChildren(*m_pPool);
         RegisterNode(*N);
 
         N = N->Parent;
@@ -370,6 +466,171 @@ void DynamicAtlasManager::Free(Region&& R)
 }
 
 
+void DynamicAtlasManager::ResetSkyline()
+{
+    VERIFY_EXPR(m_AllocatedRegions.empty());
+    m_Skyline.clear();
+    m_Skyline.push_back({0, 0, m_Width});
+    m_SkylineFreeRects.clear();
+    m_TotalFreeArea = Uint64{m_Width} * Uint64{m_Height};
+}
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateSkyline(Uint32 Width, Uint32 Height)
+{
+    VERIFY_EXPR(Width > 0 && Height > 0);
+    if (Width > m_Width || Height > m_Height)
+        return Region{};
+
+    Region R;
+
+    // Reuse the narrowest free rectangle below the skyline that fits the region
+    auto free_it = m_SkylineFreeRects.lower_bound(Region{0, 0, Width, 0});
+    while (free_it != m_SkylineFreeRects.end() && free_it->height < Height)
+        ++free_it;
+
+    if (free_it != m_SkylineFreeRects.end())
+    {
+        const auto SrcR = *free_it;
+        VERIFY_EXPR(SrcR.width >= Width && SrcR.height >= Height);
+        m_SkylineFreeRects.erase(free_it);
+
+        R = Region{SrcR.x, SrcR.y, Width, Height};
+
+        // Split the remaining space so that the larger of the two leftover rectangles is maximized
+        Region A, B;
+        if (SrcR.width - Width > SrcR.height - Height)
+        {
+            A = Region{SrcR.x + Width, SrcR.y, SrcR.width - Width, SrcR.height};
+            B = Region{SrcR.x, SrcR.y + Height, Width, SrcR.height - Height};
+        }
+        else
+        {
+            A = Region{SrcR.x, SrcR.y + Height, SrcR.width, SrcR.height - Height};
+            B = Region{SrcR.x + Width, SrcR.y, SrcR.width - Width, Height};
+        }
+        if (!A.IsEmpty())
+            m_SkylineFreeRects.insert(A);
+        if (!B.IsEmpty())
+            m_SkylineFreeRects.insert(B);
+    }
+    else
+    {
+        // Find the position that results in the lowest top edge (bottom-left rule).
+        // Ties are resolved by the smallest area wasted below the region.
+        const auto NumSegments = m_Skyline.size();
+
+        size_t BestSegment = NumSegments;
+        Uint32 BestY       = 0;
+        Uint32 BestTop     = UINT_MAX;
+        Uint64 BestWaste   = ~Uint64{0};
+        for (size_t i = 0; i < NumSegments && m_Skyline[i].x + Width <= m_Width; ++i)
+        {
+            const auto Left  = m_Skyline[i].x;
+            const auto Right = Left + Width;
+
+            // The region rests on the highest segment it spans
+            Uint32 y = 0;
+            for (size_t j = i; j < NumSegments && m_Skyline[j].x < Right; ++j)
+                y = std::max(y, m_Skyline[j].y);
+            if (y + Height > m_Height || y + Height > BestTop)
+                continue;
+
+            Uint64 Waste = 0;
+            for (size_t j = i; j < NumSegments && m_Skyline[j].x < Right; ++j)
+            {
+                const auto& Seg = m_Skyline[j];
+                Waste += Uint64{y - Seg.y} * Uint64{std::min(Seg.x + Seg.width, Right) - Seg.x};
+            }
+
+            if (y + Height < BestTop || Waste < BestWaste)
+            {
+                BestSegment = i;
+                BestY       = y;
+                BestTop     = y + Height;
+                BestWaste   = Waste;
+            }
+        }
+
+        if (BestSegment == NumSegments)
+            return Region{};
+
+        R = Region{m_Skyline[BestSegment].x, BestY, Width, Height};
+
+        const auto Right = R.x + Width;
+
+        // Keep the space below the region for future allocations and
+        // remove or trim the segments covered by the region
+        auto SegIdx = BestSegment;
+        for (; SegIdx < NumSegments && m_Skyline[SegIdx].x < Right; ++SegIdx)
+        {
+            auto&      Seg      = m_Skyline[SegIdx];
+            const auto SegRight = Seg.x + Seg.width;
+            if (Seg.y < BestY)
+                m_SkylineFreeRects.insert(Region{Seg.x, Seg.y, std::min(SegRight, Right) - Seg.x, BestY - Seg.y});
+
+            if (SegRight > Right)
+            {
+                // Partially covered segment
+                Seg.width = SegRight - Right;
+                Seg.x     = Right;
+                break;
+            }
+        }
+        m_Skyline.erase(m_Skyline.begin() + BestSegment, m_Skyline.begin() + SegIdx);
+        m_Skyline.insert(m_Skyline.begin() + BestSegment, SkylineSegment{R.x, BestTop, Width});
+
+        // Merge the new segment with its neighbors at the same height
+        if (BestSegment + 1 < m_Skyline.size() && m_Skyline[BestSegment + 1].y == BestTop)
+        {
+            m_Skyline[BestSegment].width += m_Skyline[BestSegment + 1].width;
+            m_Skyline.erase(m_Skyline.begin() + BestSegment + 1);
+        }
+        if (BestSegment > 0 && m_Skyline[BestSegment - 1].y == BestTop)
+        {
+            m_Skyline[BestSegment - 1].width += m_Skyline[BestSegment].width;
+            m_Skyline.erase(m_Skyline.begin() + BestSegment);
+        }
+    }
+
+    VERIFY(m_AllocatedRegions.find(R) == m_AllocatedRegions.end(), "New region should not be present in allocated regions hash map");
+    m_AllocatedRegions.emplace(R, nullptr);
+
+    VERIFY_EXPR(m_TotalFreeArea >= Uint64{R.width} * Uint64{R.height});
+    m_TotalFreeArea -= Uint64{R.width} * Uint64{R.height};
+
+#if DILIGENT_DEBUG
+    DbgVerifyConsistency();
+#endif
+
+    return R;
+}
+
+void DynamicAtlasManager::FreeSkyline(const Region& R)
+{
+    if (m_AllocatedRegions.erase(R) == 0)
+    {
+        UNEXPECTED("Unable to find region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height, ") among allocated regions. Have you ever allocated it?");
+        return;
+    }
+
+    m_TotalFreeArea += Uint64{R.width} * Uint64{R.height};
+
+    if (m_AllocatedRegions.empty())
+    {
+        // All regions have been released - start from scratch
+        ResetSkyline();
+    }
+    else
+    {
+        m_SkylineFreeRects.insert(R);
+    }
+
+#if DILIGENT_DEBUG
+    DbgVerifyConsistency();
+#endif
+}
+
+
 #if DILIGENT_DEBUG
 
 void DynamicAtlasManager::DbgVerifyRegion(const Region& R) const
@@ -419,6 +680,24 @@ void DynamicAtlasManager::DbgRecursiveVerifyConsistency(const Node& N, Uint32& A
 
 void DynamicAtlasManager::DbgVerifyConsistency() const
 {
+    if (m_Strategy == PackingStrategy::Skyline)
+    {
+        Uint32 x = 0;
+        for (const auto& Seg : m_Skyline)
+        {
+            VERIFY(Seg.x == x && Seg.width > 0, "Skyline segments must cover the atlas width without gaps");
+            VERIFY(Seg.y <= m_Height, "Skyline segment height (", Seg.y, ") exceeds atlas height (", m_Height, ").");
+            x += Seg.width;
+        }
+        VERIFY(x == m_Width, "Skyline does not cover entire atlas width");
+
+        Uint64 AllocatedArea = 0;
+        for (const auto& it : m_AllocatedRegions)
+            AllocatedArea += Uint64{it.first.width} * Uint64{it.first.height};
+        VERIFY_EXPR(AllocatedArea + m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height});
+        return;
+    }
+
     VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
     Uint32 Area = 0;
 
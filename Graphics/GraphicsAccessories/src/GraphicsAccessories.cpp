@@ -1497,6 +1497,70 @@ const char* GetSurfaceTransformString(SURFACE_TRANSFORM SrfTransform)
     // clang-format on
 }
 
+float4x4 GetSurfacePretransformMatrix(SURFACE_TRANSFORM SrfTransform)
+{
+    // The application applies the surface transform itself, so that the presentation engine
+    // does not need to: rotations are clockwise, mirroring is applied before the rotation.
+    // Clip-space Y axis points up.
+    // (x' y' z' w') = (x y z w) * Matrix
+    // clang-format off
+    static const float4x4 Rotate90
+    {
+        0, -1, 0, 0,
+        1,  0, 0, 0,
+        0,  0, 1, 0,
+        0,  0, 0, 1
+    };
+    static const float4x4 Rotate180
+    {
+        -1,  0, 0, 0,
+         0, -1, 0, 0,
+         0,  0, 1, 0,
+         0,  0, 0, 1
+    };
+    static const float4x4 Rotate270
+    {
+         0, 1, 0, 0,
+        -1, 0, 0, 0,
+         0, 0, 1, 0,
+         0, 0, 0, 1
+    };
+    static const float4x4 Mirror
+    {
+        -1, 0, 0, 0,
+         0, 1, 0, 0,
+         0, 0, 1, 0,
+         0, 0, 0, 1
+    };
+    // clang-format on
+
+    switch (SrfTransform)
+    {
+        case SURFACE_TRANSFORM_ROTATE_90: return Rotate90;
+        case SURFACE_TRANSFORM_ROTATE_180: return Rotate180;
+        case SURFACE_TRANSFORM_ROTATE_270: return Rotate270;
+        case SURFACE_TRANSFORM_HORIZONTAL_MIRROR: return Mirror;
+        case SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90: return Mirror * Rotate90;
+        case SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_180: return Mirror * Rotate180;
+        case SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270: return Mirror * Rotate270;
+
+        case SURFACE_TRANSFORM_OPTIMAL:
+            UNEXPECTED("SURFACE_TRANSFORM_OPTIMAL is only valid when creating or resizing the swap chain. Use the transform from the swap chain description.");
+            return float4x4::Identity();
+
+        default:
+            return float4x4::Identity();
+    }
+}
+
+bool IsSurfaceTransformRotated90(SURFACE_TRANSFORM SrfTransform)
+{
+    return (SrfTransform == SURFACE_TRANSFORM_ROTATE_90 ||
+            SrfTransform == SURFACE_TRANSFORM_ROTATE_270 ||
+            SrfTransform == SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90 ||
+            SrfTransform == SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270);
+}
+
 const char* GetPipelineTypeString(PIPELINE_TYPE PipelineType)
 {
     static_assert(PIPELINE_TYPE_LAST == 4, "Please update this function to handle the new pipeline type");
@@ -1634,7 +1698,7 @@ String GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAGS Flags, bool GetFul
 
         auto Flag = ExtractLSB(Flags);
 
-        static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 4), "Please update the switch below to handle the new pipeline resource flag.");
+        static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 5), "Please update the switch below to handle the new pipeline resource flag.");
         switch (Flag)
         {
             case PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS:
@@ -1657,6 +1721,10 @@ String GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAGS Flags, bool GetFul
                 Str.append(GetFullName ? "PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT" : "GENERAL_INPUT_ATTACHMENT");
                 break;
 
+            case PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS:
+                Str.append(GetFullName ? "PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS" : "INLINE_CONSTANTS");
+                break;
+
             default:
                 UNEXPECTED("Unexpected pipeline resource flag");
         }
@@ -1805,7 +1873,7 @@ PIPELINE_RESOURCE_FLAGS GetValidPipelineResourceFlags(SHADER_RESOURCE_TYPE Resou
     switch (ResourceType)
     {
         case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
-            return PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY;
+            return PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY | PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS;
 
         case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
             return PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER | PIPELINE_RESOURCE_FLAG_RUNTIME_ARRAY;
@@ -2726,6 +2794,37 @@ String GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAGS Flags)
     return Result;
 }
 
+String GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAGS Flags)
+{
+    if (Flags == PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+        return "NONE";
+
+    String Result;
+    while (Flags != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        auto Bit = ExtractLSB(Flags);
+
+        if (!Result.empty())
+            Result += " | ";
+
+        static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x10, "Please update the switch below to handle the new pipeline dynamic state flag");
+        switch (Bit)
+        {
+            // clang-format off
+            case PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE:          Result += "CULL_MODE";          break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE:         Result += "FRONT_FACE";         break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY: Result += "PRIMITIVE_TOPOLOGY"; break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH:              Result += "DEPTH";              break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_STENCIL:            Result += "STENCIL";            break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected pipeline dynamic state flag");
+                Result += "Unknown";
+        }
+    }
+    return Result;
+}
+
 String GetTextureComponentMappingString(const TextureComponentMapping& Mapping)
 {
     static_assert(TEXTURE_COMPONENT_SWIZZLE_IDENTITY == 0, "TEXTURE_COMPONENT_SWIZZLE_IDENTITY == 0 is assumed below");
@@ -32,13 +32,28 @@ namespace Diligent;
 
 public partial class IDeviceContext
 {
+    // Larger batches are marshalled through a heap buffer to avoid overflowing the stack.
+    private const int MaxStackAllocCount = 128;
+
     public unsafe Span<T> MapBuffer<T>(IBuffer buffer, MapType mapTypes, MapFlags mapFlags) where T : unmanaged
     {
         var data = new Span<byte>(MapBuffer(buffer, mapTypes, mapFlags).ToPointer(), (int)buffer.GetDesc().Size);
         return MemoryMarshal.Cast<byte, T>(data);
     }
 
-    public unsafe void SetVertexBuffers(uint startSlot, IBuffer[] buffers, ulong[] offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
+    /// <summary>Maps the buffer and returns a span over the first <paramref name="count"/> elements of the mapped memory.</summary>
+    /// <remarks>Unlike the overload that maps the entire buffer, this method does not query the buffer description.</remarks>
+    public unsafe Span<T> MapBuffer<T>(IBuffer buffer, MapType mapTypes, MapFlags mapFlags, int count) where T : unmanaged
+    {
+        return new Span<T>(MapBuffer(buffer, mapTypes, mapFlags).ToPointer(), count);
+    }
+
+    public void SetVertexBuffers(uint startSlot, IBuffer[] buffers, ulong[] offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
+    {
+        SetVertexBuffers(startSlot, new ReadOnlySpan<IBuffer>(buffers), new ReadOnlySpan<ulong>(offsets), stateTransitionMode, flags);
+    }
+
+    public unsafe void SetVertexBuffers(uint startSlot, ReadOnlySpan<IBuffer> buffers, ReadOnlySpan<ulong> offsets, ResourceStateTransitionMode stateTransitionMode, SetVertexBuffersFlags flags = SetVertexBuffersFlags.None)
     {
         var ppBuffers = stackalloc IntPtr[buffers.Length];
         for (var i = 0; i < buffers.Length; i++)
@@ -46,16 +61,50 @@ public partial class IDeviceContext
 
         fixed (ulong* pOffsets = offsets)
             SetVertexBuffers(startSlot, (uint)buffers.Length, ppBuffers, pOffsets, stateTransitionMode, flags);
-        GC.KeepAlive(buffers);
+        for (var i = 0; i < buffers.Length; i++)
+            GC.KeepAlive(buffers[i]);
+    }
+
+    public void SetRenderTargets(ITextureView[] renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
+    {
+        SetRenderTargets(new ReadOnlySpan<ITextureView>(renderTargetViews), depthStencilView, mode);
     }
 
-    public unsafe void SetRenderTargets(ITextureView[] renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
+    public unsafe void SetRenderTargets(ReadOnlySpan<ITextureView> renderTargetViews, ITextureView depthStencilView, ResourceStateTransitionMode mode)
     {
-        var ppRTVs = stackalloc IntPtr[renderTargetViews?.Length ?? 0];
-        for (var i = 0; i < renderTargetViews?.Length; i++)
+        var ppRTVs = stackalloc IntPtr[renderTargetViews.Length];
+        for (var i = 0; i < renderTargetViews.Length; i++)
             ppRTVs[i] = renderTargetViews[i]?.NativePointer ?? IntPtr.Zero;
-        SetRenderTargets((uint)(renderTargetViews?.Length ?? 0), ppRTVs, depthStencilView, mode);
-        GC.KeepAlive(renderTargetViews);
+        SetRenderTargets((uint)renderTargetViews.Length, ppRTVs, depthStencilView, mode);
+        for (var i = 0; i < renderTargetViews.Length; i++)
+            GC.KeepAlive(renderTargetViews[i]);
+    }
+
+    public void SetViewports(Viewport[] viewports, uint width, uint height)
+    {
+        SetViewports(new ReadOnlySpan<Viewport>(viewports), width, height);
+    }
+
+    public unsafe void SetViewports(ReadOnlySpan<Viewport> viewports, uint width, uint height)
+    {
+        fixed (Viewport* pViewports = viewports)
+            SetViewports((uint)viewports.Length, pViewports, width, height);
+    }
+
+    public void SetScissorRects(Rect[] rects, uint width, uint height)
+    {
+        SetScissorRects(new ReadOnlySpan<Rect>(rects), width, height);
+    }
+
+    public unsafe void SetScissorRects(ReadOnlySpan<Rect> rects, uint width, uint height)
+    {
+        fixed (Rect* pRects = rects)
+            SetScissorRects((uint)rects.Length, pRects, width, height);
+    }
+
+    public void UpdateBuffer<T>(IBuffer buffer, ulong offset, T[] data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
+    {
+        UpdateBuffer(buffer, offset, new ReadOnlySpan<T>(data), stateTransitionMode);
     }
 
     public unsafe void UpdateBuffer<T>(IBuffer buffer, ulong offset, ReadOnlySpan<T> data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
@@ -64,12 +113,48 @@ public partial class IDeviceContext
             UpdateBuffer(buffer, offset, (ulong)(Unsafe.SizeOf<T>() * data.Length), new(dataPtr), stateTransitionMode);
     }
 
-    public unsafe void ExecuteCommandLists(ICommandList[] commandLists)
+    public unsafe void UpdateBuffer<T>(IBuffer buffer, ulong offset, in T data, ResourceStateTransitionMode stateTransitionMode) where T : unmanaged
+    {
+        fixed (T* dataPtr = &Unsafe.AsRef(in data))
+            UpdateBuffer(buffer, offset, (ulong)Unsafe.SizeOf<T>(), new(dataPtr), stateTransitionMode);
+    }
+
+    public void TransitionResourceStates(StateTransitionDesc[] resourceBarriers)
+    {
+        TransitionResourceStates(new ReadOnlySpan<StateTransitionDesc>(resourceBarriers));
+    }
+
+    public unsafe void TransitionResourceStates(ReadOnlySpan<StateTransitionDesc> resourceBarriers)
+    {
+        // StateTransitionDesc references managed resource objects, so each barrier still has to be
+        // converted to its native layout, but no intermediate managed array is allocated.
+        Span<StateTransitionDesc.__Native> barriersNative = resourceBarriers.Length <= MaxStackAllocCount ?
+            stackalloc StateTransitionDesc.__Native[resourceBarriers.Length] :
+            new StateTransitionDesc.__Native[resourceBarriers.Length];
+
+        for (var i = 0; i < resourceBarriers.Length; i++)
+            resourceBarriers[i].__MarshalTo(ref barriersNative[i]);
+
+        fixed (StateTransitionDesc.__Native* pBarriers = barriersNative)
+            TransitionResourceStates((uint)resourceBarriers.Length, pBarriers);
+
+        // Reading the barriers after the call also keeps the resources they reference alive.
+        for (var i = 0; i < resourceBarriers.Length; i++)
+            resourceBarriers[i].__MarshalFree(ref barriersNative[i]);
+    }
+
+    public void ExecuteCommandLists(ICommandList[] commandLists)
+    {
+        ExecuteCommandLists(new ReadOnlySpan<ICommandList>(commandLists));
+    }
+
+    public unsafe void ExecuteCommandLists(ReadOnlySpan<ICommandList> commandLists)
     {
         var ppCmdLists = stackalloc IntPtr[commandLists.Length];
         for (var i = 0; i < commandLists.Length; i++)
             ppCmdLists[i] = commandLists[i].NativePointer;
         ExecuteCommandLists((uint)commandLists.Length, ppCmdLists);
-        GC.KeepAlive(commandLists);
+        for (var i = 0; i < commandLists.Length; i++)
+            GC.KeepAlive(commandLists[i]);
     }
 }
@@ -30,13 +30,19 @@ namespace Diligent;
 
 public partial class IResourceMapping
 {
-    public unsafe void AddResourceArray(string name, uint startIndex, IDeviceObject[] objects, bool isUnique)
+    public void AddResourceArray(string name, uint startIndex, IDeviceObject[] objects, bool isUnique)
+    {
+        AddResourceArray(name, startIndex, new ReadOnlySpan<IDeviceObject>(objects), isUnique);
+    }
+
+    public unsafe void AddResourceArray(string name, uint startIndex, ReadOnlySpan<IDeviceObject> objects, bool isUnique)
     {
         var ppObjects = stackalloc IntPtr[objects.Length];
         for (var i = 0; i < objects.Length; i++)
             ppObjects[i] = objects[i].NativePointer;
 
         AddResourceArray(name, startIndex, ppObjects, (uint)objects.Length, isUnique);
-        GC.KeepAlive(objects);
+        for (var i = 0; i < objects.Length; i++)
+            GC.KeepAlive(objects[i]);
     }
 }
@@ -30,13 +30,19 @@ namespace Diligent;
 
 public partial class IShaderResourceVariable
 {
-    public unsafe void SetArray(IDeviceObject[] objects, uint firstElement, SetShaderResourceFlags flags)
+    public void SetArray(IDeviceObject[] objects, uint firstElement, SetShaderResourceFlags flags)
+    {
+        SetArray(new ReadOnlySpan<IDeviceObject>(objects), firstElement, flags);
+    }
+
+    public unsafe void SetArray(ReadOnlySpan<IDeviceObject> objects, uint firstElement, SetShaderResourceFlags flags)
     {
         var ppObjects = stackalloc IntPtr[objects.Length];
         for (var i = 0; i < objects.Length; i++)
-            ppObjects[i] = objects[i].NativePointer;
+            ppObjects[i] = objects[i]?.NativePointer ?? IntPtr.Zero;
 
         SetArray(ppObjects, firstElement, (uint)objects.Length, flags);
-        GC.KeepAlive(objects);
+        for (var i = 0; i < objects.Length; i++)
+            GC.KeepAlive(objects[i]);
     }
 }
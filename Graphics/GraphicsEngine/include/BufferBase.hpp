@@ -38,6 +38,7 @@
 #include "GraphicsAccessories.hpp"
 #include "STDAllocator.hpp"
 #include "FormatString.hpp"
+#include "ResourceViewCache.hpp"
 
 namespace Diligent
 {
@@ -101,6 +102,19 @@ public:
                       "No bits in the immediate context mask (0x", std::hex, this->m_Desc.ImmediateContextMask,
                       ") correspond to one of ", this->GetDevice()->GetCommandQueueCount(), " available software command queues");
         this->m_Desc.ImmediateContextMask &= DeviceQueuesMask;
+
+        // Sparse buffers do not own memory
+        if (this->m_Desc.Usage != USAGE_SPARSE)
+            m_MemoryStatsSize = this->m_Desc.Size;
+        this->GetDevice()->GetBufferCounter().Add(m_MemoryStatsSize);
+
+        if ((this->m_Desc.MiscFlags & MISC_BUFFER_FLAG_CACHE_VIEWS) != 0)
+            m_pViewCache = std::make_unique<ResourceViewCache<BufferViewDesc, IBufferView>>();
+    }
+
+    ~BufferBase()
+    {
+        this->GetDevice()->GetBufferCounter().Remove(m_MemoryStatsSize);
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Buffer, TDeviceObjectBase)
@@ -117,7 +131,17 @@ public:
         else
             UNEXPECTED("Unexpected buffer view type");
 
-        CreateViewInternal(ViewDesc, ppView, false);
+        if (m_pViewCache)
+        {
+            m_pViewCache->GetOrCreate(ViewDesc, ppView,
+                                      [this](const BufferViewDesc& Desc, IBufferView** ppNewView) {
+                                          CreateViewInternal(Desc, ppNewView, false);
+                                      });
+        }
+        else
+        {
+            CreateViewInternal(ViewDesc, ppView, false);
+        }
     }
 
 
@@ -261,11 +285,17 @@ protected:
 
     MEMORY_PROPERTIES m_MemoryProperties = MEMORY_PROPERTY_UNKNOWN;
 
+    // The buffer size reported by IRenderDevice::GetMemoryStats()
+    Uint64 m_MemoryStatsSize = 0;
+
     /// Default UAV addressing the entire buffer
     std::unique_ptr<BufferViewImplType, STDDeleter<BufferViewImplType, TBuffViewObjAllocator>> m_pDefaultUAV;
 
     /// Default SRV addressing the entire buffer
     std::unique_ptr<BufferViewImplType, STDDeleter<BufferViewImplType, TBuffViewObjAllocator>> m_pDefaultSRV;
+
+    /// Cache of the views created by CreateView(), see MISC_BUFFER_FLAG_CACHE_VIEWS
+    std::unique_ptr<ResourceViewCache<BufferViewDesc, IBufferView>> m_pViewCache;
 };
 
 } // namespace Diligent
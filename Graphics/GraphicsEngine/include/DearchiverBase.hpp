@@ -35,6 +35,7 @@
 #include <mutex>
 
 #include "Dearchiver.h"
+#include "EngineFactory.h"
 #include "RenderDevice.h"
 #include "Shader.h"
 
@@ -43,20 +44,26 @@
 #include "RefCntAutoPtr.hpp"
 #include "DeviceObjectArchive.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
 
-struct DearchiverCreateInfo;
-
 /// Class implementing base functionality of the dearchiver
 class DearchiverBase : public ObjectBase<IDearchiver>
 {
 public:
     using TObjectBase = ObjectBase<IDearchiver>;
 
-    DearchiverBase(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
-        TObjectBase{pRefCounters}
+    // DevType is the archive device type of the backend. It is used to load the shader
+    // data of the archives on the thread pool. If the type is Count, the data is loaded on demand.
+    DearchiverBase(IReferenceCounters*             pRefCounters,
+                   const DearchiverCreateInfo&     CI,
+                   DeviceObjectArchive::DeviceType DevType = DeviceObjectArchive::DeviceType::Count) noexcept :
+        TObjectBase{pRefCounters},
+        m_pThreadPool{CI.pThreadPool},
+        m_CompressShaders{CI.CompressShaders},
+        m_DeviceType{DevType}
     {
     }
 
@@ -73,6 +80,12 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual void DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                                         Uint32                         NumPipelines,
+                                                         IPipelineState**               ppPSOs,
+                                                         bool                           Asynchronous) override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -102,6 +115,14 @@ protected:
     virtual RefCntAutoPtr<IShader> UnpackShader(const ShaderCreateInfo& ShaderCI,
                                                 IRenderDevice*          pDevice);
 
+    // Unpacks backend-specific pipeline data that is stored after the shader indices.
+    // The data is unpacked before the pipeline state is created.
+    virtual bool UnpackPSODeviceData(const SerializedData& Data,
+                                     IRenderDevice*        pDevice)
+    {
+        return true;
+    }
+
 protected:
     using ResourceType         = DeviceObjectArchive::ResourceType;
     using DeviceType           = DeviceObjectArchive::DeviceType;
@@ -191,9 +212,19 @@ private:
         ArchiveData& operator=(      ArchiveData&&) = delete;
         // clang-format on
 
+        ~ArchiveData()
+        {
+            // The task references the archive
+            if (pLoadShadersTask)
+                pLoadShadersTask->WaitForCompletion();
+        }
+
         std::unique_ptr<const DeviceObjectArchive> pObjArchive;
 
         std::array<ShaderCacheData, static_cast<size_t>(DeviceType::Count)> CachedShaders;
+
+        // The task that loads the shaders for the dearchiver's device type
+        RefCntAutoPtr<IAsyncTask> pLoadShadersTask;
     };
 
     template <typename CreateInfoType>
@@ -208,7 +239,14 @@ private:
                           IRenderDevice*           pDevice);
 
     template <typename CreateInfoType>
-    void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
+    void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO, PSO_CREATE_FLAGS CreateFlags);
+
+    void UnpackPipelineStateInternal(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO, PSO_CREATE_FLAGS CreateFlags);
+
+    // Unpacks the render pass and explicit resource signatures used by the pipeline
+    // and adds strong references to them to the Objects array.
+    template <typename CreateInfoType>
+    void UnpackPSODependencies(const PipelineStateUnpackInfo& UnpackInfo, std::vector<RefCntAutoPtr<IDeviceObject>>& Objects);
 
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
@@ -219,6 +257,11 @@ private:
     std::unordered_map<NamedResourceKey, size_t, NamedResourceKey::Hasher> m_ResNameToArchiveIdx;
 
     std::vector<ArchiveData> m_Archives;
+
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+
+    const bool       m_CompressShaders;
+    const DeviceType m_DeviceType;
 };
 
 
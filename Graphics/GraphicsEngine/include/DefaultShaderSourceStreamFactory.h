@@ -38,4 +38,27 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory);
 
+/// Shader source file metadata that can be used to detect file changes without reading the file.
+struct ShaderSourceFileInfo
+{
+    /// File size, in bytes.
+    Uint64 Size DEFAULT_INITIALIZER(0);
+
+    /// Last modification time, in seconds since the epoch.
+    Uint64 ModificationTime DEFAULT_INITIALIZER(0);
+};
+
+/// Gets the metadata of the file that the shader source stream factory would open for the given name.
+
+/// \param [in]  pFactory - Shader source stream factory.
+/// \param [in]  Name     - File name, as it would be passed to IShaderSourceInputStreamFactory::CreateInputStream.
+/// \param [out] Info     - File metadata.
+/// \return      true if the metadata was retrieved, and false otherwise.
+///
+/// \remarks     Only factories created by CreateDefaultShaderSourceStreamFactory are supported.
+///              The function returns false for all other factories.
+bool GetShaderSourceFileInfo(IShaderSourceInputStreamFactory* pFactory,
+                             const Char*                      Name,
+                             ShaderSourceFileInfo&            Info);
+
 DILIGENT_END_NAMESPACE // namespace Diligent
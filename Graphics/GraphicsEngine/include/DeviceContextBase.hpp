@@ -34,6 +34,7 @@
 #include <array>
 #include <functional>
 #include <vector>
+#include <chrono>
 
 #include "PrivateConstants.h"
 #include "DeviceContext.h"
@@ -49,6 +50,22 @@
 #include "BasicMath.hpp"
 #include "PlatformMisc.hpp"
 #include "Align.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "EngineMemory.h"
+
+// When DILIGENT_NO_CONTEXT_STATS is defined, device contexts do not collect command and primitive
+// statistics, and IDeviceContext::GetStats() always returns zeros. This removes the remaining
+// per-command bookkeeping from the release-mode path, where validation is already compiled out.
+#ifdef DILIGENT_NO_CONTEXT_STATS
+#    define DILIGENT_UPDATE_CONTEXT_STATS(...) static_cast<void>(0)
+#    define DILIGENT_CONTEXT_CPU_TIME_SCOPE(Category) static_cast<void>(0)
+#else
+#    define DILIGENT_UPDATE_CONTEXT_STATS(...) __VA_ARGS__
+// Measures the CPU time spent until the end of the current scope and adds it to
+// DeviceContextStats::CPUTime.Category, see IDeviceContext::EnableCPUTimeStats.
+#    define DILIGENT_CONTEXT_CPU_TIME_SCOPE(Category) \
+        const CPUTimeScope _CPUTimeScope { m_CPUTimeScopeActive, m_CPUTimeStatsEnabled ? &m_Stats.CPUTime.Category : nullptr }
+#endif
 
 namespace Diligent
 {
@@ -281,6 +298,13 @@ public:
         return m_FrameNumber;
     }
 
+    /// Implementation of IDeviceContext::AllocateFrameMemory.
+    virtual void* DILIGENT_CALL_TYPE AllocateFrameMemory(size_t Size, size_t Alignment) override final
+    {
+        DEV_CHECK_ERR(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+        return m_FrameAllocator.Allocate(Size, Alignment);
+    }
+
     /// Implementation of IDeviceContext::SetUserData.
     virtual void DILIGENT_CALL_TYPE SetUserData(IObject* pUserData) override final
     {
@@ -315,6 +339,13 @@ public:
         return m_Stats;
     }
 
+    virtual void DILIGENT_CALL_TYPE EnableCPUTimeStats(Bool Enable) override final
+    {
+#ifndef DILIGENT_NO_CONTEXT_STATS
+        m_CPUTimeStatsEnabled = Enable;
+#endif
+    }
+
     /// Returns currently bound pipeline state and blend factors
     inline void GetPipelineState(IPipelineState** ppPSO, float* BlendFactors, Uint32& StencilRef);
 
@@ -465,6 +496,8 @@ protected:
 
     inline bool SetStencilRef(Uint32 StencilRef, int Dummy);
 
+    inline bool SetDynamicRenderState(const DynamicRenderState& State, int Dummy);
+
     inline void SetPipelineState(RefCntAutoPtr<PipelineStateImplType> pPipelineState, int /*Dummy*/);
 
     /// Clears all cached resources
@@ -483,16 +516,34 @@ protected:
 
     void ClearRenderTarget(ITextureView* pView);
 
+    void InvalidateAttachments(Uint32 NumViews, ITextureView* const* ppViews, int);
+
     void BeginQuery(IQuery* pQuery, int);
 
     void EndQuery(IQuery* pQuery, int);
 
+    void ResolveQueries(IQuery* const* ppQueries, Uint32 NumQueries, IBuffer* pDstBuffer, Uint64 DstOffset, int);
+
+    void BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs, int);
+    void EndConditionalRendering(int);
+
     void EnqueueSignal(IFence* pFence, Uint64 Value, int);
     void DeviceWaitForFence(IFence* pFence, Uint64 Value, int);
 
     void EndFrame()
     {
         ++m_FrameNumber;
+        // Keep the pages to avoid heap allocations in the next frame
+        m_FrameAllocator.Discard();
+    }
+
+    /// Allocates a value-initialized array from the frame allocator.
+    /// The array remains valid until the end of the frame.
+    template <typename T>
+    T* AllocateFrameArray(size_t Count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "Destructors of objects in the frame allocator are never called");
+        return Count > 0 ? m_FrameAllocator.ConstructArray<T>(Count) : nullptr;
     }
 
     void PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount);
@@ -520,6 +571,12 @@ protected:
     {
         DEV_CHECK_ERR(IsDeferred(), "FinishCommandList() is only allowed for deferred contexts.");
         DEV_CHECK_ERR(IsRecordingDeferredCommands(), "This context is not recording commands. Call Begin() before finishing the recording.");
+        DEV_CHECK_ERR(!m_IsConditionalRenderingActive, "Finishing command list with active conditional rendering. Call EndConditionalRendering() first.");
+#ifdef DILIGENT_DEVELOPMENT
+        DEV_CHECK_ERR(m_DvpPendingSplitBarriers.empty(), "Finishing command list with ", m_DvpPendingSplitBarriers.size(),
+                      " split barrier(s) that have not been ended. Split barriers must be ended in the same command list.");
+        m_DvpPendingSplitBarriers.clear();
+#endif
         m_DstImmediateContextId = INVALID_CONTEXT_ID;
         m_Desc.QueueType        = COMMAND_QUEUE_TYPE_UNKNOWN;
         for (size_t i = 0; i < _countof(m_Desc.TextureCopyGranularity); ++i)
@@ -531,7 +588,7 @@ protected:
     void DvpVerifyDispatchTileArguments(const DispatchTileAttribs& Attribs) const;
 
     void DvpVerifyRenderTargets() const;
-    void DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier) const;
+    void DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier);
     void DvpVerifyTextureState(const TextureImplType&   Texture, RESOURCE_STATE RequiredState, const char* OperationName) const;
     void DvpVerifyBufferState (const BufferImplType&    Buffer,  RESOURCE_STATE RequiredState, const char* OperationName) const;
     void DvpVerifyBLASState   (const BottomLevelASType& BLAS,    RESOURCE_STATE RequiredState, const char* OperationName) const;
@@ -547,7 +604,7 @@ protected:
     void DvpVerifyDispatchTileArguments(const DispatchTileAttribs& Attribs) const {}
 
     void DvpVerifyRenderTargets()const {}
-    void DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier)const {}
+    void DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier) {}
     void DvpVerifyTextureState(const TextureImplType&   Texture, RESOURCE_STATE RequiredState, const char* OperationName) const {}
     void DvpVerifyBufferState (const BufferImplType&    Buffer,  RESOURCE_STATE RequiredState, const char* OperationName) const {}
     void DvpVerifyBLASState   (const BottomLevelASType& BLAS,    RESOURCE_STATE RequiredState, const char* OperationName) const {}
@@ -619,6 +676,9 @@ protected:
     /// Current blend factors
     Float32 m_BlendFactors[4] = {-1, -1, -1, -1};
 
+    /// Current dynamic render state
+    DynamicRenderState m_DynamicRenderState;
+
     /// Current viewports
     Viewport m_Viewports[MAX_VIEWPORTS];
     /// Number of current viewports
@@ -663,8 +723,14 @@ protected:
     /// Render pass attachments transition mode.
     RESOURCE_STATE_TRANSITION_MODE m_RenderPassAttachmentsTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
 
+    /// Indicates if conditional rendering is active, see IDeviceContext::BeginConditionalRendering.
+    bool m_IsConditionalRenderingActive = false;
+
     Uint64 m_FrameNumber = 0;
 
+    /// Transient per-frame memory, see IDeviceContext::AllocateFrameMemory.
+    DynamicLinearAllocator m_FrameAllocator{GetRawAllocator(), 64 << 10};
+
     RefCntAutoPtr<IObject> m_pUserData;
 
     // Must go before m_Desc!
@@ -681,6 +747,51 @@ protected:
 
     DeviceContextStats m_Stats;
 
+#ifndef DILIGENT_NO_CONTEXT_STATS
+    // Adds the time elapsed between construction and destruction to the CPU time counter.
+    // Nested scopes (e.g. Flush called by FinishFrame) are ignored so that the time is only
+    // accounted for once.
+    class CPUTimeScope
+    {
+    public:
+        CPUTimeScope(bool& ScopeActive, Uint64* pCounter) noexcept :
+            m_pCounter{pCounter != nullptr && !ScopeActive ? pCounter : nullptr},
+            m_ScopeActive{ScopeActive}
+        {
+            if (m_pCounter != nullptr)
+            {
+                m_ScopeActive = true;
+                m_StartTime   = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~CPUTimeScope()
+        {
+            if (m_pCounter != nullptr)
+            {
+                const auto ElapsedTime = std::chrono::steady_clock::now() - m_StartTime;
+                *m_pCounter += static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(ElapsedTime).count());
+                m_ScopeActive = false;
+            }
+        }
+
+        // clang-format off
+        CPUTimeScope           (const CPUTimeScope&) = delete;
+        CPUTimeScope           (CPUTimeScope&&)      = delete;
+        CPUTimeScope& operator=(const CPUTimeScope&) = delete;
+        CPUTimeScope& operator=(CPUTimeScope&&)      = delete;
+        // clang-format on
+
+    private:
+        Uint64* const                         m_pCounter;
+        bool&                                 m_ScopeActive;
+        std::chrono::steady_clock::time_point m_StartTime;
+    };
+
+    bool m_CPUTimeStatsEnabled = false;
+    bool m_CPUTimeScopeActive  = false;
+#endif
+
     std::vector<Uint8> m_ScratchSpace;
 
 #ifdef DILIGENT_DEBUG
@@ -694,6 +805,9 @@ protected:
 #endif
 #ifdef DILIGENT_DEVELOPMENT
     int m_DvpDebugGroupCount = 0;
+
+    // New states of the split barriers that have been begun, but not yet ended, for every resource
+    std::unordered_map<const IDeviceObject*, RESOURCE_STATE> m_DvpPendingSplitBarriers;
 #endif
 };
 
@@ -762,7 +876,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetVertexBuffers(
     while (m_NumVertexStreams > 0 && !m_VertexStreams[m_NumVertexStreams - 1].pBuffer)
         m_VertexStreams[m_NumVertexStreams--] = VertexStreamInfo<BufferImplType>{};
 
-    ++m_Stats.CommandCounters.SetVertexBuffers;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetVertexBuffers);
 }
 
 template <typename ImplementationTraits>
@@ -776,7 +890,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetPipelineState(
     DEV_CHECK_ERR(pPipelineState->GetStatus() == PIPELINE_STATE_STATUS_READY, "PSO '", pPipelineState->GetDesc().Name, "' is not ready. Use GetStatus() to check the pipeline status.");
 
     m_pPipelineState = std::move(pPipelineState);
-    ++m_Stats.CommandCounters.SetPipelineState;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetPipelineState);
 }
 
 template <typename ImplementationTraits>
@@ -792,7 +906,26 @@ inline void DeviceContextBase<ImplementationTraits>::CommitShaderResources(
 
     DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "pShaderResourceBinding must not be null");
 
-    ++m_Stats.CommandCounters.CommitShaderResources;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.CommitShaderResources);
+
+    if (pShaderResourceBinding == nullptr)
+        return;
+
+    // Upload inline constants before the backend reads the dynamic buffer allocations
+    const auto& ResourceCache = ClassPtrCast<ShaderResourceBindingImplType>(pShaderResourceBinding)->GetResourceCache();
+    for (const auto& InlineConstants : ResourceCache.GetInlineConstants())
+    {
+        if (InlineConstants.Constants.empty())
+            continue;
+
+        PVoid pMappedData = nullptr;
+        this->MapBuffer(InlineConstants.pBuffer, MAP_WRITE, MAP_FLAG_DISCARD, pMappedData);
+        if (pMappedData != nullptr)
+        {
+            memcpy(pMappedData, InlineConstants.Constants.data(), InlineConstants.Constants.size() * sizeof(Uint32));
+            this->UnmapBuffer(InlineConstants.pBuffer, MAP_WRITE);
+        }
+    }
 }
 
 template <typename ImplementationTraits>
@@ -827,7 +960,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetIndexBuffer(
     }
 #endif
 
-    ++m_Stats.CommandCounters.SetIndexBuffer;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetIndexBuffer);
 }
 
 
@@ -863,7 +996,7 @@ inline bool DeviceContextBase<ImplementationTraits>::SetBlendFactors(const float
         m_BlendFactors[f] = BlendFactors[f];
     }
     if (FactorsDiffer)
-        ++m_Stats.CommandCounters.SetBlendFactors;
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetBlendFactors);
 
     return FactorsDiffer;
 }
@@ -876,7 +1009,24 @@ inline bool DeviceContextBase<ImplementationTraits>::SetStencilRef(Uint32 Stenci
     if (m_StencilRef != StencilRef)
     {
         m_StencilRef = StencilRef;
-        ++m_Stats.CommandCounters.SetStencilRef;
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetStencilRef);
+        return true;
+    }
+    return false;
+}
+
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::SetDynamicRenderState(const DynamicRenderState& State, int)
+{
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "SetDynamicRenderState");
+    DEV_CHECK_ERR(m_pDevice->GetDeviceInfo().Features.DynamicRenderState, "IDeviceContext::SetDynamicRenderState: DynamicRenderState feature must be enabled");
+    DEV_CHECK_ERR(State.CullMode > CULL_MODE_UNDEFINED && State.CullMode < CULL_MODE_NUM_MODES, "IDeviceContext::SetDynamicRenderState: invalid cull mode");
+    DEV_CHECK_ERR(State.PrimitiveTopology > PRIMITIVE_TOPOLOGY_UNDEFINED && State.PrimitiveTopology < PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES,
+                  "IDeviceContext::SetDynamicRenderState: invalid primitive topology");
+
+    if (m_DynamicRenderState != State)
+    {
+        m_DynamicRenderState = State;
         return true;
     }
     return false;
@@ -921,7 +1071,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetViewports(
         DEV_CHECK_ERR(m_Viewports[vp].MaxDepth >= m_Viewports[vp].MinDepth, "Incorrect viewport depth range [", m_Viewports[vp].MinDepth, ", ", m_Viewports[vp].MaxDepth, "]");
     }
 
-    ++m_Stats.CommandCounters.SetViewports;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetViewports);
 }
 
 template <typename ImplementationTraits>
@@ -965,7 +1115,7 @@ inline void DeviceContextBase<ImplementationTraits>::SetScissorRects(
         DEV_CHECK_ERR(m_ScissorRects[sr].top <= m_ScissorRects[sr].bottom, "Incorrect vertical bounds for a scissor rect [", m_ScissorRects[sr].top, ", ", m_ScissorRects[sr].bottom, ")");
     }
 
-    ++m_Stats.CommandCounters.SetScissorRects;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetScissorRects);
 }
 
 template <typename ImplementationTraits>
@@ -1162,7 +1312,7 @@ inline bool DeviceContextBase<ImplementationTraits>::SetRenderTargets(const SetR
 #endif
 
     if (bBindRenderTargets)
-        ++m_Stats.CommandCounters.SetRenderTargets;
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.SetRenderTargets);
 
     return bBindRenderTargets;
 }
@@ -1300,6 +1450,8 @@ inline void DeviceContextBase<ImplementationTraits>::ClearStateCache()
     for (int i = 0; i < 4; ++i)
         m_BlendFactors[i] = -1;
 
+    m_DynamicRenderState = DynamicRenderState{};
+
     for (Uint32 vp = 0; vp < m_NumViewports; ++vp)
         m_Viewports[vp] = Viewport();
     m_NumViewports = 0;
@@ -1428,6 +1580,8 @@ inline void DeviceContextBase<ImplementationTraits>::BeginRenderPass(const Begin
 
     VerifyBeginRenderPassAttribs(Attribs);
 
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BeginRenderPass);
+
     // Reset current render targets (in Vulkan backend, this may end current render pass).
     ResetRenderTargets();
 
@@ -1530,6 +1684,8 @@ inline void DeviceContextBase<ImplementationTraits>::EndRenderPass()
     VERIFY(m_pActiveRenderPass->GetDesc().SubpassCount == m_SubpassIndex + 1,
            "Ending render pass at subpass ", m_SubpassIndex, " before reaching the final subpass");
 
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.EndRenderPass);
+
     UpdateAttachmentStates(m_SubpassIndex + 1);
 
     m_pActiveRenderPass.Release();
@@ -1578,7 +1734,7 @@ inline void DeviceContextBase<ImplementationTraits>::ClearDepthStencil(ITextureV
     }
 #endif
 
-    ++m_Stats.CommandCounters.ClearDepthStencil;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.ClearDepthStencil);
 }
 
 template <typename ImplementationTraits>
@@ -1623,7 +1779,28 @@ inline void DeviceContextBase<ImplementationTraits>::ClearRenderTarget(ITextureV
     }
 #endif
 
-    ++m_Stats.CommandCounters.ClearRenderTarget;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.ClearRenderTarget);
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::InvalidateAttachments(Uint32 NumViews, ITextureView* const* ppViews, int)
+{
+    DEV_CHECK_ERR(NumViews == 0 || ppViews != nullptr, "IDeviceContext::InvalidateAttachments: ppViews must not be null when NumViews is not zero");
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_GRAPHICS, "InvalidateAttachments");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "InvalidateAttachments command must be used outside of render pass.");
+
+#ifdef DILIGENT_DEVELOPMENT
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        DEV_CHECK_ERR(ppViews[i] != nullptr, "IDeviceContext::InvalidateAttachments: view at index ", i, " is null");
+        const auto& ViewDesc = ppViews[i]->GetDesc();
+        DEV_CHECK_ERR(ViewDesc.ViewType == TEXTURE_VIEW_RENDER_TARGET || ViewDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL,
+                      "IDeviceContext::InvalidateAttachments: the type (", GetTexViewTypeLiteralName(ViewDesc.ViewType), ") of texture view '",
+                      ViewDesc.Name, "' is invalid: render target or depth-stencil view is expected.");
+    }
+#endif
+
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.InvalidateAttachments);
 }
 
 template <typename ImplementationTraits>
@@ -1640,7 +1817,7 @@ inline void DeviceContextBase<ImplementationTraits>::BeginQuery(IQuery* pQuery,
 
     ClassPtrCast<QueryImplType>(pQuery)->OnBeginQuery(static_cast<DeviceContextImplType*>(this));
 
-    ++m_Stats.CommandCounters.BeginQuery;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BeginQuery);
 }
 
 template <typename ImplementationTraits>
@@ -1655,6 +1832,77 @@ inline void DeviceContextBase<ImplementationTraits>::EndQuery(IQuery* pQuery, in
     ClassPtrCast<QueryImplType>(pQuery)->OnEndQuery(static_cast<DeviceContextImplType*>(this));
 }
 
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::ResolveQueries(IQuery* const* ppQueries, Uint32 NumQueries, IBuffer* pDstBuffer, Uint64 DstOffset, int)
+{
+    DEV_CHECK_ERR(NumQueries == 0 || ppQueries != nullptr, "IDeviceContext::ResolveQueries: ppQueries must not be null");
+    DEV_CHECK_ERR(pDstBuffer != nullptr, "IDeviceContext::ResolveQueries: pDstBuffer must not be null");
+    DEV_CHECK_ERR((DstOffset % sizeof(Uint64)) == 0, "IDeviceContext::ResolveQueries: DstOffset (", DstOffset, ") must be a multiple of 8");
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_COMPUTE, "ResolveQueries");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "ResolveQueries command must be used outside of render pass.");
+
+#ifdef DILIGENT_DEVELOPMENT
+    if (pDstBuffer != nullptr)
+    {
+        const auto& BuffDesc = pDstBuffer->GetDesc();
+        DEV_CHECK_ERR(DstOffset + Uint64{NumQueries} * sizeof(Uint64) <= BuffDesc.Size,
+                      "IDeviceContext::ResolveQueries: query results (", NumQueries, " x 8 bytes at offset ", DstOffset,
+                      ") do not fit into buffer '", BuffDesc.Name, "' of size ", BuffDesc.Size);
+    }
+    for (Uint32 i = 0; i < NumQueries && ppQueries != nullptr; ++i)
+    {
+        DEV_CHECK_ERR(ppQueries[i] != nullptr, "IDeviceContext::ResolveQueries: query ", i, " is null");
+        if (ppQueries[i] != nullptr)
+            ClassPtrCast<QueryImplType>(ppQueries[i])->CheckResolveQuery(static_cast<DeviceContextImplType*>(this));
+    }
+#endif
+
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.ResolveQueries);
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs, int)
+{
+    DEV_CHECK_ERR(m_pDevice->GetFeatures().ConditionalRendering, "IDeviceContext::BeginConditionalRendering: conditional rendering is not supported by this device");
+    DVP_CHECK_QUEUE_TYPE_COMPATIBILITY(COMMAND_QUEUE_TYPE_COMPUTE, "BeginConditionalRendering");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "BeginConditionalRendering command must be used outside of render pass.");
+    DEV_CHECK_ERR(!m_IsConditionalRenderingActive, "IDeviceContext::BeginConditionalRendering: conditional rendering is already active. Nested conditional rendering is not allowed.");
+    DEV_CHECK_ERR((Attribs.pBuffer != nullptr) != (Attribs.pQuery != nullptr), "IDeviceContext::BeginConditionalRendering: exactly one of pBuffer or pQuery must not be null");
+
+#ifdef DILIGENT_DEVELOPMENT
+    if (Attribs.pBuffer != nullptr)
+    {
+        const auto& BuffDesc = Attribs.pBuffer->GetDesc();
+        DEV_CHECK_ERR((BuffDesc.BindFlags & BIND_INDIRECT_DRAW_ARGS) != 0,
+                      "IDeviceContext::BeginConditionalRendering: predicate buffer '", BuffDesc.Name, "' was not created with BIND_INDIRECT_DRAW_ARGS flag");
+        DEV_CHECK_ERR((Attribs.Offset % sizeof(Uint64)) == 0, "IDeviceContext::BeginConditionalRendering: Offset (", Attribs.Offset, ") must be a multiple of 8");
+        DEV_CHECK_ERR(Attribs.Offset + sizeof(Uint64) <= BuffDesc.Size,
+                      "IDeviceContext::BeginConditionalRendering: predicate value at offset ", Attribs.Offset,
+                      " does not fit into buffer '", BuffDesc.Name, "' of size ", BuffDesc.Size);
+    }
+    if (Attribs.pQuery != nullptr)
+    {
+        const auto& QueryDesc = Attribs.pQuery->GetDesc();
+        DEV_CHECK_ERR(QueryDesc.Type == QUERY_TYPE_OCCLUSION || QueryDesc.Type == QUERY_TYPE_BINARY_OCCLUSION,
+                      "IDeviceContext::BeginConditionalRendering: query '", QueryDesc.Name, "' is ", GetQueryTypeString(QueryDesc.Type),
+                      " query. Only occlusion and binary occlusion queries can be used as predicates");
+    }
+#endif
+
+    m_IsConditionalRenderingActive = true;
+
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BeginConditionalRendering);
+}
+
+template <typename ImplementationTraits>
+inline void DeviceContextBase<ImplementationTraits>::EndConditionalRendering(int)
+{
+    DEV_CHECK_ERR(m_IsConditionalRenderingActive, "IDeviceContext::EndConditionalRendering: there is no active conditional rendering");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "EndConditionalRendering command must be used outside of render pass.");
+
+    m_IsConditionalRenderingActive = false;
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::EnqueueSignal(IFence* pFence, Uint64 Value, int)
 {
@@ -1690,7 +1938,7 @@ inline void DeviceContextBase<ImplementationTraits>::UpdateBuffer(
     }
 #endif
 
-    ++m_Stats.CommandCounters.UpdateBuffer;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.UpdateBuffer);
 }
 
 template <typename ImplementationTraits>
@@ -1716,7 +1964,7 @@ inline void DeviceContextBase<ImplementationTraits>::CopyBuffer(
     }
 #endif
 
-    ++m_Stats.CommandCounters.CopyBuffer;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.CopyBuffer);
 }
 
 template <typename ImplementationTraits>
@@ -1776,7 +2024,7 @@ inline void DeviceContextBase<ImplementationTraits>::MapBuffer(
         DEV_CHECK_ERR(MapType == MAP_WRITE, "MAP_FLAG_DISCARD is only valid when mapping buffer for writing");
     }
 
-    ++m_Stats.CommandCounters.MapBuffer;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.MapBuffer);
 }
 
 template <typename ImplementationTraits>
@@ -1809,7 +2057,7 @@ inline void DeviceContextBase<ImplementationTraits>::UpdateTexture(
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "UpdateTexture command must be used outside of render pass.");
 
     ValidateUpdateTextureParams(pTexture->GetDesc(), MipLevel, Slice, DstBox, SubresData);
-    ++m_Stats.CommandCounters.UpdateTexture;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.UpdateTexture);
 }
 
 template <typename ImplementationTraits>
@@ -1821,7 +2069,7 @@ inline void DeviceContextBase<ImplementationTraits>::CopyTexture(const CopyTextu
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "CopyTexture command must be used outside of render pass.");
 
     ValidateCopyTextureParams(CopyAttribs);
-    ++m_Stats.CommandCounters.CopyTexture;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.CopyTexture);
 }
 
 template <typename ImplementationTraits>
@@ -1836,7 +2084,7 @@ inline void DeviceContextBase<ImplementationTraits>::MapTextureSubresource(
 {
     DEV_CHECK_ERR(pTexture, "pTexture must not be null");
     ValidateMapTextureParams(pTexture->GetDesc(), MipLevel, ArraySlice, MapType, MapFlags, pMapRegion);
-    ++m_Stats.CommandCounters.MapTextureSubresource;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.MapTextureSubresource);
 }
 
 template <typename ImplementationTraits>
@@ -1865,7 +2113,7 @@ inline void DeviceContextBase<ImplementationTraits>::GenerateMips(ITextureView*
                       "' was not created with TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION flag and can't be used to generate mipmaps.");
     }
 #endif
-    ++m_Stats.CommandCounters.GenerateMips;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.GenerateMips);
 }
 
 
@@ -1885,7 +2133,7 @@ void DeviceContextBase<ImplementationTraits>::ResolveTextureSubresource(
 
     VerifyResolveTextureSubresourceAttribs(ResolveAttribs, SrcTexDesc, DstTexDesc);
 #endif
-    ++m_Stats.CommandCounters.ResolveTextureSubresource;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.ResolveTextureSubresource);
 }
 
 
@@ -1897,7 +2145,7 @@ void DeviceContextBase<ImplementationTraits>::BuildBLAS(const BuildBLASAttribs&
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::BuildBLAS command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyBuildBLASAttribs(Attribs, m_pDevice), "BuildBLASAttribs are invalid");
 
-    ++m_Stats.CommandCounters.BuildBLAS;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BuildBLAS);
 }
 
 template <typename ImplementationTraits>
@@ -1908,7 +2156,7 @@ void DeviceContextBase<ImplementationTraits>::BuildTLAS(const BuildTLASAttribs&
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::BuildTLAS command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyBuildTLASAttribs(Attribs, m_pDevice->GetAdapterInfo().RayTracing), "BuildTLASAttribs are invalid");
 
-    ++m_Stats.CommandCounters.BuildTLAS;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BuildTLAS);
 }
 
 template <typename ImplementationTraits>
@@ -1919,7 +2167,7 @@ void DeviceContextBase<ImplementationTraits>::CopyBLAS(const CopyBLASAttribs& At
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::CopyBLAS command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyCopyBLASAttribs(m_pDevice, Attribs), "CopyBLASAttribs are invalid");
 
-    ++m_Stats.CommandCounters.CopyBLAS;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.CopyBLAS);
 }
 
 template <typename ImplementationTraits>
@@ -1931,7 +2179,7 @@ void DeviceContextBase<ImplementationTraits>::CopyTLAS(const CopyTLASAttribs& At
     DEV_CHECK_ERR(VerifyCopyTLASAttribs(Attribs), "CopyTLASAttribs are invalid");
     DEV_CHECK_ERR(ClassPtrCast<TopLevelASType>(Attribs.pSrc)->ValidateContent(), "IDeviceContext::CopyTLAS: pSrc acceleration structure is not valid");
 
-    ++m_Stats.CommandCounters.CopyTLAS;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.CopyTLAS);
 }
 
 template <typename ImplementationTraits>
@@ -1942,7 +2190,7 @@ void DeviceContextBase<ImplementationTraits>::WriteBLASCompactedSize(const Write
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::WriteBLASCompactedSize: command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyWriteBLASCompactedSizeAttribs(m_pDevice, Attribs), "WriteBLASCompactedSizeAttribs are invalid");
 
-    ++m_Stats.CommandCounters.WriteBLASCompactedSize;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.WriteBLASCompactedSize);
 }
 
 template <typename ImplementationTraits>
@@ -1953,7 +2201,7 @@ void DeviceContextBase<ImplementationTraits>::WriteTLASCompactedSize(const Write
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "IDeviceContext::WriteTLASCompactedSize: command must be performed outside of render pass");
     DEV_CHECK_ERR(VerifyWriteTLASCompactedSizeAttribs(m_pDevice, Attribs), "WriteTLASCompactedSizeAttribs are invalid");
 
-    ++m_Stats.CommandCounters.WriteTLASCompactedSize;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.WriteTLASCompactedSize);
 }
 
 template <typename ImplementationTraits>
@@ -1994,7 +2242,7 @@ void DeviceContextBase<ImplementationTraits>::TraceRays(const TraceRaysAttribs&
                   "IDeviceContext::TraceRays command arguments are invalid: the dimension must not exceed the ",
                   RTProps.MaxRayGenThreads, " threads");
 
-    ++m_Stats.CommandCounters.TraceRays;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.TraceRays);
 }
 
 template <typename ImplementationTraits>
@@ -2035,7 +2283,7 @@ void DeviceContextBase<ImplementationTraits>::TraceRaysIndirect(const TraceRaysI
            "SBT '", pSBTImpl->GetDesc().Name, "' internal buffer is expected to be in RESOURCE_STATE_RAY_TRACING, but current state is ",
            GetResourceStateString(pSBTImpl->GetInternalBuffer()->GetState()));
 
-    ++m_Stats.CommandCounters.TraceRaysIndirect;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.TraceRaysIndirect);
 }
 
 template <typename ImplementationTraits>
@@ -2053,7 +2301,7 @@ void DeviceContextBase<ImplementationTraits>::UpdateSBT(IShaderBindingTable* pSB
                       "IDeviceContext::UpdateSBT command arguments are invalid: pUpdateIndirectBufferAttribs->pAttribsBuffer must not be null");
     }
 
-    ++m_Stats.CommandCounters.UpdateSBT;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.UpdateSBT);
 }
 
 template <typename ImplementationTraits>
@@ -2123,7 +2371,7 @@ void DeviceContextBase<ImplementationTraits>::BindSparseResourceMemory(const Bin
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Can not bind sparse memory inside an active render pass.");
     DEV_CHECK_ERR(VerifyBindSparseResourceMemoryAttribs(m_pDevice, Attribs), "BindSparseResourceMemoryAttribs are invalid");
 
-    ++m_Stats.CommandCounters.BindSparseResourceMemory;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.BindSparseResourceMemory);
 }
 
 template <typename ImplementationTraits>
@@ -2232,12 +2480,14 @@ inline void DeviceContextBase<ImplementationTraits>::Draw(const DrawAttribs& Att
         DEV_CHECK_ERR(VerifyDrawAttribs(Attribs), "DrawAttribs are invalid");
     }
 #endif
+#ifndef DILIGENT_NO_CONTEXT_STATS
     if (m_pPipelineState)
     {
         const auto Topology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
         m_Stats.PrimitiveCounts[Topology] += GetPrimitiveCount(Topology, Attribs.NumVertices);
     }
-    ++m_Stats.CommandCounters.Draw;
+#endif
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.Draw);
 }
 
 template <typename ImplementationTraits>
@@ -2259,12 +2509,14 @@ inline void DeviceContextBase<ImplementationTraits>::DrawIndexed(const DrawIndex
         DEV_CHECK_ERR(VerifyDrawIndexedAttribs(Attribs), "DrawIndexedAttribs are invalid");
     }
 #endif
+#ifndef DILIGENT_NO_CONTEXT_STATS
     if (m_pPipelineState)
     {
         const auto Topology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
         m_Stats.PrimitiveCounts[Topology] += GetPrimitiveCount(Topology, Attribs.NumIndices);
     }
-    ++m_Stats.CommandCounters.DrawIndexed;
+#endif
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DrawIndexed);
 }
 
 template <typename ImplementationTraits>
@@ -2286,7 +2538,7 @@ inline void DeviceContextBase<ImplementationTraits>::DrawMesh(const DrawMeshAttr
         DEV_CHECK_ERR(VerifyDrawMeshAttribs(m_pDevice->GetAdapterInfo().MeshShader, Attribs), "DrawMeshAttribs are invalid");
     }
 #endif
-    ++m_Stats.CommandCounters.DrawMesh;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DrawMesh);
 }
 
 template <typename ImplementationTraits>
@@ -2314,7 +2566,7 @@ inline void DeviceContextBase<ImplementationTraits>::DrawIndirect(const DrawIndi
         DEV_CHECK_ERR(VerifyDrawIndirectAttribs(Attribs), "DrawIndirectAttribs are invalid");
     }
 #endif
-    ++m_Stats.CommandCounters.DrawIndirect;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DrawIndirect);
 }
 
 
@@ -2345,7 +2597,7 @@ inline void DeviceContextBase<ImplementationTraits>::DrawIndexedIndirect(const D
         DEV_CHECK_ERR(VerifyDrawIndexedIndirectAttribs(Attribs), "DrawIndexedIndirectAttribs are invalid");
     }
 #endif
-    ++m_Stats.CommandCounters.DrawIndexedIndirect;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DrawIndexedIndirect);
 }
 
 template <typename ImplementationTraits>
@@ -2371,7 +2623,7 @@ inline void DeviceContextBase<ImplementationTraits>::DrawMeshIndirect(const Draw
         DEV_CHECK_ERR(VerifyDrawMeshIndirectAttribs(Attribs, DrawMeshIndirectCommandStride), "DrawMeshIndirectAttribs are invalid");
     }
 #endif
-    ++m_Stats.CommandCounters.DrawMeshIndirect;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DrawMeshIndirect);
 }
 
 template <typename ImplementationTraits>
@@ -2390,16 +2642,18 @@ inline void DeviceContextBase<ImplementationTraits>::MultiDraw(const MultiDrawAt
         DEV_CHECK_ERR(VerifyMultiDrawAttribs(Attribs), "MultiDrawAttribs are invalid");
     }
 #endif
+#ifndef DILIGENT_NO_CONTEXT_STATS
     if (m_pPipelineState)
     {
         const auto Topology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
         for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             m_Stats.PrimitiveCounts[Topology] += GetPrimitiveCount(Topology, Attribs.pDrawItems[i].NumVertices);
     }
+#endif
     if (m_NativeMultiDrawSupported)
-        ++m_Stats.CommandCounters.MultiDraw;
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.MultiDraw);
     else
-        m_Stats.CommandCounters.Draw += Attribs.DrawCount;
+        DILIGENT_UPDATE_CONTEXT_STATS(m_Stats.CommandCounters.Draw += Attribs.DrawCount);
 }
 
 template <typename ImplementationTraits>
@@ -2421,16 +2675,18 @@ inline void DeviceContextBase<ImplementationTraits>::MultiDrawIndexed(const Mult
         DEV_CHECK_ERR(VerifyMultiDrawIndexedAttribs(Attribs), "MultiDrawIndexedAttribs are invalid");
     }
 #endif
+#ifndef DILIGENT_NO_CONTEXT_STATS
     if (m_pPipelineState)
     {
         const auto Topology = m_pPipelineState->GetGraphicsPipelineDesc().PrimitiveTopology;
         for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
             m_Stats.PrimitiveCounts[Topology] += GetPrimitiveCount(Topology, Attribs.pDrawItems[i].NumIndices);
     }
+#endif
     if (m_NativeMultiDrawSupported)
-        ++m_Stats.CommandCounters.MultiDrawIndexed;
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.MultiDrawIndexed);
     else
-        m_Stats.CommandCounters.DrawIndexed += Attribs.DrawCount;
+        DILIGENT_UPDATE_CONTEXT_STATS(m_Stats.CommandCounters.DrawIndexed += Attribs.DrawCount);
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -2542,7 +2798,7 @@ inline void DeviceContextBase<ImplementationTraits>::DispatchCompute(const Dispa
 
     DEV_CHECK_ERR(VerifyDispatchComputeAttribs(Attribs), "DispatchComputeAttribs attribs");
 
-    ++m_Stats.CommandCounters.DispatchCompute;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DispatchCompute);
 }
 
 template <typename ImplementationTraits>
@@ -2558,7 +2814,7 @@ inline void DeviceContextBase<ImplementationTraits>::DispatchComputeIndirect(con
 
     DEV_CHECK_ERR(VerifyDispatchComputeIndirectAttribs(Attribs), "DispatchComputeIndirectAttribs are invalid");
 
-    ++m_Stats.CommandCounters.DispatchComputeIndirect;
+    DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.CommandCounters.DispatchComputeIndirect);
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -2573,9 +2829,42 @@ inline void DeviceContextBase<ImplementationTraits>::DvpVerifyDispatchTileArgume
 }
 
 template <typename ImplementationTraits>
-void DeviceContextBase<ImplementationTraits>::DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier) const
+void DeviceContextBase<ImplementationTraits>::DvpVerifyStateTransitionDesc(const StateTransitionDesc& Barrier)
 {
     DEV_CHECK_ERR(VerifyStateTransitionDesc(m_pDevice, Barrier, GetExecutionCtxId(), this->m_Desc), "StateTransitionDesc are invalid");
+
+    if (Barrier.pResource == nullptr || (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING) != 0)
+        return;
+
+    // Every begin-split barrier must be followed by a matching end-split barrier, and the resource
+    // must not be transitioned in between.
+    auto it = m_DvpPendingSplitBarriers.find(Barrier.pResource);
+    switch (Barrier.TransitionType)
+    {
+        case STATE_TRANSITION_TYPE_BEGIN:
+            DEV_CHECK_ERR(it == m_DvpPendingSplitBarriers.end(), "Resource '", Barrier.pResource->GetDesc().Name,
+                          "' already has a split barrier that has not been ended.");
+            m_DvpPendingSplitBarriers.emplace(Barrier.pResource, Barrier.NewState);
+            break;
+
+        case STATE_TRANSITION_TYPE_END:
+            if (it != m_DvpPendingSplitBarriers.end())
+            {
+                DEV_CHECK_ERR(it->second == Barrier.NewState, "New state (", GetResourceStateString(Barrier.NewState),
+                              ") of the end-split barrier for resource '", Barrier.pResource->GetDesc().Name,
+                              "' does not match the new state (", GetResourceStateString(it->second), ") of the begin-split barrier.");
+                m_DvpPendingSplitBarriers.erase(it);
+            }
+            else
+            {
+                DEV_ERROR("End-split barrier for resource '", Barrier.pResource->GetDesc().Name, "' does not have a matching begin-split barrier.");
+            }
+            break;
+
+        default:
+            DEV_CHECK_ERR(it == m_DvpPendingSplitBarriers.end(), "Resource '", Barrier.pResource->GetDesc().Name,
+                          "' is transitioned while its split barrier has not been ended.");
+    }
 }
 
 template <typename ImplementationTraits>
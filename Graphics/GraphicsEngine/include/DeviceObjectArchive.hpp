@@ -32,6 +32,8 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <atomic>
+#include <mutex>
 
 #include "GraphicsTypes.h"
 #include "FileStream.h"
@@ -52,6 +54,8 @@
 //
 //     |  Shader Data  | =  |  OpenGL shaders | D3D11 shaders | ...  | Metal-iOS shaders |
 //
+//         | Device shaders | = | Uncompressed Size | Section Size | NumShaders | Shader0 | Shader1 | ... |
+//
 // The header contains general information such as:
 // - Magic number
 // - Archive version
@@ -63,7 +67,13 @@
 // - Common data (e.g. a resource description)
 // - Device-specific data (e.g. shader indices)
 //
-// Shader data contains an array of shaders for each device type
+// Shader data contains an array of shaders for each device type.
+// Every device's shaders are stored in a size-prefixed section that is skipped
+// when the archive is deserialized and is only parsed when the shaders for that
+// device are first requested. This way, an archive that targets multiple devices
+// never touches the shader data of devices other than the one in use.
+// A section may be LZ4-compressed, in which case the uncompressed size is non-zero
+// and the section is decompressed when it is parsed.
 //
 //
 // For pipelines, device-specific data is the array of shader indices in the
@@ -75,6 +85,9 @@
 //                                                                 |               |
 //                                                                 V               V
 // | GL Shader 0 | GL Shader 1 |  ... | D3D11 Shader 0 | D3D11 Shader 1 | D3D11 Shader 2 | ...
+//
+// The shader index array may be followed by size-prefixed backend-specific data,
+// e.g. the serialized root signature for Direct3D12.
 
 namespace Diligent
 {
@@ -128,7 +141,7 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 13;
 
     struct ArchiveHeader
     {
@@ -243,8 +256,11 @@ public:
     void Merge(const DeviceObjectArchive& Src) noexcept(false);
 
     bool Deserialize(const CreateInfo& CI) noexcept;
-    void Serialize(IFileStream* pStream) const;
-    void Serialize(IDataBlob** ppDataBlob) const;
+
+    /// Serializes the archive. If CompressShaders is true, shader sections are
+    /// compressed with LZ4, unless compression does not reduce their size.
+    void Serialize(IFileStream* pStream, bool CompressShaders = false) const;
+    void Serialize(IDataBlob** ppDataBlob, bool CompressShaders = false) const;
 
     std::string ToString() const;
 
@@ -280,14 +296,21 @@ public:
         return m_NamedResources[NamedResourceKey{Type, Name, MakeCopy}];
     }
 
-    auto& GetDeviceShaders(DeviceType Type) noexcept
+    std::vector<SerializedData>& GetDeviceShaders(DeviceType Type) noexcept
     {
+        LoadDeviceShadersIfPending(Type);
         return m_DeviceShaders[static_cast<size_t>(Type)];
     }
 
-    const auto& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
+    const std::vector<SerializedData>& GetDeviceShaders(DeviceType Type) const noexcept
     {
-        const auto& DeviceShaders = m_DeviceShaders[static_cast<size_t>(Type)];
+        LoadDeviceShadersIfPending(Type);
+        return m_DeviceShaders[static_cast<size_t>(Type)];
+    }
+
+    const SerializedData& GetSerializedShader(DeviceType Type, size_t Idx) const noexcept
+    {
+        const auto& DeviceShaders = GetDeviceShaders(Type);
         if (Idx < DeviceShaders.size())
             return DeviceShaders[Idx];
 
@@ -295,6 +318,13 @@ public:
         return NullData;
     }
 
+    /// Returns true if the shader section for the given device type has been parsed
+    /// or there is nothing to parse.
+    bool AreDeviceShadersLoaded(DeviceType Type) const noexcept
+    {
+        return !m_DeviceShadersPending[static_cast<size_t>(Type)].load(std::memory_order_acquire);
+    }
+
     const auto& GetNamedResources() const
     {
         return m_NamedResources;
@@ -302,12 +332,41 @@ public:
 
     void Clear() noexcept;
 
+private:
+    void LoadDeviceShadersIfPending(DeviceType Type) const noexcept
+    {
+        if (!AreDeviceShadersLoaded(Type))
+            LoadDeviceShaders(Type);
+    }
+
+    void LoadDeviceShaders(DeviceType Type) const noexcept;
+
+    // Discards the pending shader section, if any, without parsing it.
+    void DiscardDeviceShaderSection(DeviceType Type) noexcept;
+
 private:
     // Named resources
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
 
-    // Shaders
-    std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
+    // Shaders. The arrays are populated on demand from m_DeviceShaderSections by
+    // LoadDeviceShaders(), which is why they are mutable.
+    mutable std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> m_DeviceShaders;
+
+    // Raw shader sections that reference the archive data and have not been parsed yet.
+    mutable std::array<SerializedData, static_cast<size_t>(DeviceType::Count)> m_DeviceShaderSections;
+
+    // Uncompressed sizes of the shader sections, or zero if the sections are not compressed.
+    std::array<Uint32, static_cast<size_t>(DeviceType::Count)> m_ShaderSectionUncompressedSizes{};
+
+    // Decompressed shader sections. Shaders loaded from compressed sections reference this data.
+    mutable std::array<SerializedData, static_cast<size_t>(DeviceType::Count)> m_DecompressedShaderSections;
+
+    // Indicates that the shader section for the device has not been parsed yet.
+    // Zero-initialized: nothing is pending in an empty archive.
+    mutable std::array<std::atomic<bool>, static_cast<size_t>(DeviceType::Count)> m_DeviceShadersPending{};
+
+    // Serializes parsing of shader sections from multiple threads.
+    mutable std::mutex m_DeviceShadersMtx;
 
     // Strong reference to the original data blob.
     // Resources will not make copies and reference this data.
@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::FenceCallbackThread class
+
+#include <memory>
+
+#include "RenderDevice.h"
+#include "Fence.h"
+
+namespace Diligent
+{
+
+/// Invokes fence completion callbacks registered with IFence::RegisterCompletionCallback().
+
+/// The thread is owned by the render device and is started when the first callback is registered.
+/// It waits for any of the pending fence values using IRenderDevice::WaitForFences() and invokes
+/// the callbacks whose values have been reached.
+class FenceCallbackThread
+{
+public:
+    /// \param pDevice - Render device that owns the thread. The thread does not keep a strong reference to the device.
+    explicit FenceCallbackThread(IRenderDevice* pDevice);
+    ~FenceCallbackThread();
+
+    // clang-format off
+    FenceCallbackThread           (const FenceCallbackThread&)  = delete;
+    FenceCallbackThread           (      FenceCallbackThread&&) = delete;
+    FenceCallbackThread& operator=(const FenceCallbackThread&)  = delete;
+    FenceCallbackThread& operator=(      FenceCallbackThread&&) = delete;
+    // clang-format on
+
+    /// Registers the callback. The thread keeps a strong reference to the fence until the callback is invoked.
+    void RegisterCallback(IFence* pFence, Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData);
+
+private:
+    // The state is shared with the thread so that it remains valid if the last reference
+    // to the device is released by the thread itself (when a fence is released after its
+    // callback is invoked).
+    struct State;
+    static void ThreadFunc(std::shared_ptr<State> pState);
+
+    std::shared_ptr<State> m_pState;
+};
+
+} // namespace Diligent
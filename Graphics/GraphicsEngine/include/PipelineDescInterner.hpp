@@ -0,0 +1,235 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the Diligent::PipelineDescInterner class
+
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+
+#include "PipelineState.h"
+#include "FixedLinearAllocator.hpp"
+#include "EngineMemory.h"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Device-wide storage of the pipeline description data that is shared between pipeline states.
+
+/// Every pipeline state keeps a copy of the arrays and strings referenced by its description.
+/// Applications that create many pipelines typically use a small number of distinct input
+/// and resource layouts, so the interner keeps a single copy of every distinct layout that is
+/// referenced by all pipelines that use it. The data is released when the last pipeline that
+/// references it is destroyed.
+///
+/// The class is thread-safe.
+class PipelineDescInterner
+{
+public:
+    /// Interned resource layout: variables, immutable samplers and their names.
+    struct ResourceLayoutData
+    {
+        PipelineResourceLayoutDesc Desc;
+        FixedLinearAllocator       Memory{GetRawAllocator()};
+    };
+
+    /// Interned input layout: layout elements with resolved offsets, their semantics, and buffer strides.
+    struct InputLayoutData
+    {
+        InputLayoutDesc      Desc;
+        const Uint32*        pStrides        = nullptr;
+        Uint32               BufferSlotsUsed = 0;
+        FixedLinearAllocator Memory{GetRawAllocator()};
+    };
+
+    /// Returns the shared copy of the resource layout.
+
+    /// \remarks    Immutable sampler names are ignored when the layouts are compared,
+    ///             so the returned layout may use the sampler names of another pipeline.
+    std::shared_ptr<const ResourceLayoutData> InternResourceLayout(const PipelineResourceLayoutDesc& Layout)
+    {
+        return Intern(m_ResourceLayouts, Layout, [](const PipelineResourceLayoutDesc& Layout) {
+            auto  pData  = std::make_shared<ResourceLayoutData>();
+            auto& Memory = pData->Memory;
+
+            Memory.AddSpace<ShaderResourceVariableDesc>(Layout.NumVariables);
+            for (Uint32 i = 0; i < Layout.NumVariables; ++i)
+                Memory.AddSpaceForString(Layout.Variables[i].Name);
+            Memory.AddSpace<ImmutableSamplerDesc>(Layout.NumImmutableSamplers);
+            for (Uint32 i = 0; i < Layout.NumImmutableSamplers; ++i)
+            {
+                Memory.AddSpaceForString(Layout.ImmutableSamplers[i].SamplerOrTextureName);
+                Memory.AddSpaceForString(Layout.ImmutableSamplers[i].Desc.Name);
+            }
+
+            static_assert(std::is_trivially_destructible<ShaderResourceVariableDesc>::value, "ShaderResourceVariableDesc must be trivially destructible");
+            static_assert(std::is_trivially_destructible<ImmutableSamplerDesc>::value, "ImmutableSamplerDesc must be trivially destructible");
+
+            Memory.Reserve();
+
+            pData->Desc = Layout;
+            if (Layout.NumVariables > 0)
+            {
+                auto* const Variables = Memory.CopyConstructArray<ShaderResourceVariableDesc>(Layout.Variables, Layout.NumVariables);
+                for (Uint32 i = 0; i < Layout.NumVariables; ++i)
+                    Variables[i].Name = Memory.CopyString(Layout.Variables[i].Name);
+                pData->Desc.Variables = Variables;
+            }
+            else
+            {
+                pData->Desc.Variables = nullptr;
+            }
+
+            if (Layout.NumImmutableSamplers > 0)
+            {
+                auto* const ImmutableSamplers = Memory.CopyConstructArray<ImmutableSamplerDesc>(Layout.ImmutableSamplers, Layout.NumImmutableSamplers);
+                for (Uint32 i = 0; i < Layout.NumImmutableSamplers; ++i)
+                {
+                    ImmutableSamplers[i].SamplerOrTextureName = Memory.CopyString(Layout.ImmutableSamplers[i].SamplerOrTextureName);
+                    ImmutableSamplers[i].Desc.Name            = Memory.CopyString(Layout.ImmutableSamplers[i].Desc.Name);
+                }
+                pData->Desc.ImmutableSamplers = ImmutableSamplers;
+            }
+            else
+            {
+                pData->Desc.ImmutableSamplers = nullptr;
+            }
+
+            return pData;
+        });
+    }
+
+    /// Returns the shared copy of the input layout.
+
+    /// \param [in] Layout          - Input layout with resolved offsets, see ResolveInputLayoutAutoOffsetsAndStrides().
+    /// \param [in] pStrides        - Buffer strides.
+    /// \param [in] BufferSlotsUsed - The number of elements in pStrides array.
+    ///
+    /// \remarks    The strides are fully defined by the resolved layout elements, so they are not
+    ///             used to look up the existing data.
+    std::shared_ptr<const InputLayoutData> InternInputLayout(const InputLayoutDesc& Layout, const Uint32* pStrides, Uint32 BufferSlotsUsed)
+    {
+        return Intern(m_InputLayouts, Layout, [pStrides, BufferSlotsUsed](const InputLayoutDesc& Layout) {
+            auto  pData  = std::make_shared<InputLayoutData>();
+            auto& Memory = pData->Memory;
+
+            Memory.AddSpace<LayoutElement>(Layout.NumElements);
+            for (Uint32 i = 0; i < Layout.NumElements; ++i)
+                Memory.AddSpaceForString(Layout.LayoutElements[i].HLSLSemantic);
+            Memory.AddSpace<Uint32>(BufferSlotsUsed);
+
+            static_assert(std::is_trivially_destructible<LayoutElement>::value, "LayoutElement must be trivially destructible");
+
+            Memory.Reserve();
+
+            auto* const pElements = Memory.CopyConstructArray<LayoutElement>(Layout.LayoutElements, Layout.NumElements);
+            for (Uint32 i = 0; i < Layout.NumElements; ++i)
+                pElements[i].HLSLSemantic = Memory.CopyString(Layout.LayoutElements[i].HLSLSemantic);
+
+            pData->Desc.LayoutElements = pElements;
+            pData->Desc.NumElements    = Layout.NumElements;
+            pData->pStrides            = Memory.CopyConstructArray<Uint32>(pStrides, BufferSlotsUsed);
+            pData->BufferSlotsUsed     = BufferSlotsUsed;
+
+            return pData;
+        });
+    }
+
+    /// Returns the total size of the interned data that is referenced by at least one pipeline, in bytes.
+    Uint64 GetMemorySize() const
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        return GetMemorySize(m_ResourceLayouts) + GetMemorySize(m_InputLayouts);
+    }
+
+private:
+    template <typename DataType>
+    using DataMap = std::unordered_multimap<size_t, std::weak_ptr<const DataType>>;
+
+    template <typename DataType, typename DescType, typename CreateDataFuncType>
+    std::shared_ptr<const DataType> Intern(DataMap<DataType>& Map, const DescType& Desc, CreateDataFuncType&& CreateData)
+    {
+        const size_t Hash = std::hash<DescType>{}(Desc);
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto Range = Map.equal_range(Hash);
+        for (auto it = Range.first; it != Range.second; ++it)
+        {
+            if (auto pData = it->second.lock())
+            {
+                if (pData->Desc == Desc)
+                    return pData;
+            }
+        }
+
+        // Purge expired entries when the map grows. The threshold is doubled after every purge
+        // so that the amortized cost is constant.
+        if (Map.size() >= m_PurgeThreshold)
+        {
+            for (auto it = Map.begin(); it != Map.end();)
+            {
+                if (it->second.expired())
+                    it = Map.erase(it);
+                else
+                    ++it;
+            }
+            m_PurgeThreshold = std::max(Map.size() * 2, MinPurgeThreshold);
+        }
+
+        std::shared_ptr<const DataType> pData = CreateData(Desc);
+        Map.emplace(Hash, pData);
+        return pData;
+    }
+
+    template <typename DataType>
+    static Uint64 GetMemorySize(const DataMap<DataType>& Map)
+    {
+        Uint64 Size = 0;
+        for (const auto& it : Map)
+        {
+            if (auto pData = it.second.lock())
+                Size += sizeof(DataType) + pData->Memory.GetReservedSize();
+        }
+        return Size;
+    }
+
+private:
+    static constexpr size_t MinPurgeThreshold = 64;
+
+    mutable std::mutex m_Mtx;
+
+    DataMap<ResourceLayoutData> m_ResourceLayouts;
+    DataMap<InputLayoutData>    m_InputLayouts;
+
+    size_t m_PurgeThreshold = MinPurgeThreshold;
+};
+
+} // namespace Diligent
@@ -37,6 +37,7 @@
 #include <functional>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
 
 #include "PrivateConstants.h"
 #include "PipelineResourceSignature.h"
@@ -670,9 +671,22 @@ public:
 
     /// Finds a resource with the given name in the specified shader stage and returns its
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
+    /// The lookup uses the hashed name index built when the signature is initialized.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        VERIFY_EXPR(ResourceName != nullptr);
+
+        // Resources with the same name may be defined in different shader stages.
+        // Return the lowest index to match the result of Diligent::FindResource().
+        Uint32     ResIndex = InvalidPipelineResourceIndex;
+        const auto Range    = m_ResourceNameIndex.equal_range(ResourceName);
+        for (auto it = Range.first; it != Range.second; ++it)
+        {
+            const Uint32 Idx = it->second;
+            if ((this->m_Desc.Resources[Idx].ShaderStages & ShaderStage) != 0)
+                ResIndex = std::min(ResIndex, Idx);
+        }
+        return ResIndex;
     }
 
     /// Finds an immutable with the given name in the specified shader stage and returns its
@@ -828,6 +842,11 @@ protected:
         }
 #endif
 
+        // Keys reference the names in m_Desc.Resources[], which live as long as the signature.
+        m_ResourceNameIndex.reserve(this->m_Desc.NumResources);
+        for (Uint32 r = 0; r < this->m_Desc.NumResources; ++r)
+            m_ResourceNameIndex.emplace(this->m_Desc.Resources[r].Name, r);
+
         // Objects will be constructed by the specific implementation
         static_assert(std::is_trivially_destructible<PipelineResourceAttribsType>::value,
                       "PipelineResourceAttribsType objects must be constructed to be properly destructed in case an exception is thrown");
@@ -968,6 +987,8 @@ protected:
     {
         VERIFY(!m_IsDestructed, "This object has already been destructed");
 
+        m_ResourceNameIndex.clear();
+
         this->m_Desc.Resources             = nullptr;
         this->m_Desc.ImmutableSamplers     = nullptr;
         this->m_Desc.CombinedSamplerSuffix = nullptr;
@@ -1077,6 +1098,10 @@ protected:
     // Resource offsets (e.g. index of the first resource), for each variable type.
     std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1> m_ResourceOffsets = {};
 
+    // Hashed index that maps resource names to resource indices in m_Desc.Resources[].
+    // Resources with the same name in different shader stages have separate entries.
+    std::unordered_multimap<HashMapStringKey, Uint32, HashMapStringKey::Hasher> m_ResourceNameIndex;
+
     // Shader stages that have resources.
     SHADER_TYPE m_ShaderStages = SHADER_TYPE_UNKNOWN;
 
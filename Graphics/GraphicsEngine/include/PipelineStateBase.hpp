@@ -43,6 +43,7 @@
 #include "EngineMemory.h"
 #include "GraphicsAccessories.hpp"
 #include "FixedLinearAllocator.hpp"
+#include "PipelineDescInterner.hpp"
 #include "HashUtils.hpp"
 #include "PipelineResourceSignatureBase.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -477,6 +478,15 @@ public:
             GetRawAllocator().Free(m_pPipelineDataRawMem);
             m_pPipelineDataRawMem = nullptr;
         }
+
+        m_pResourceLayoutData.reset();
+        m_pInputLayoutData.reset();
+
+        if (m_MemoryStatsSize != 0)
+        {
+            this->GetDevice()->GetPipelineStateCounter().Remove(m_MemoryStatsSize);
+            m_MemoryStatsSize = 0;
+        }
 #if DILIGENT_DEBUG
         m_IsDestructed = true;
 #endif
@@ -772,31 +782,13 @@ protected:
                                      FixedLinearAllocator&                  MemPool) noexcept
     {
         MemPool.AddSpace<GraphicsPipelineData>();
-        ReserveResourceLayout(CreateInfo.PSODesc.ResourceLayout, MemPool);
         ReserveResourceSignatures(CreateInfo, MemPool);
-
-        const auto& InputLayout = CreateInfo.GraphicsPipeline.InputLayout;
-        if (InputLayout.NumElements > 0)
-        {
-            Uint32 BufferSlotsUsed = 0;
-            MemPool.AddSpace<LayoutElement>(InputLayout.NumElements);
-            for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
-            {
-                auto& LayoutElem = InputLayout.LayoutElements[i];
-                MemPool.AddSpaceForString(LayoutElem.HLSLSemantic);
-                BufferSlotsUsed = std::max(BufferSlotsUsed, LayoutElem.BufferSlot + 1);
-            }
-
-            MemPool.AddSpace<Uint32>(BufferSlotsUsed);
-        }
-
-        static_assert(std::is_trivially_destructible<decltype(*InputLayout.LayoutElements)>::value, "Add destructor for this object to Destruct()");
+        // Input and resource layouts are stored in the device-wide PipelineDescInterner
     }
 
     void ReserveSpaceForPipelineDesc(const ComputePipelineStateCreateInfo& CreateInfo,
                                      FixedLinearAllocator&                 MemPool) noexcept
     {
-        ReserveResourceLayout(CreateInfo.PSODesc.ResourceLayout, MemPool);
         ReserveResourceSignatures(CreateInfo, MemPool);
     }
 
@@ -827,7 +819,6 @@ protected:
             MemPool.AddSpaceForString(CreateInfo.pProceduralHitShaders[i].Name);
         }
 
-        ReserveResourceLayout(CreateInfo.PSODesc.ResourceLayout, MemPool);
         ReserveResourceSignatures(CreateInfo, MemPool);
     }
 
@@ -835,7 +826,6 @@ protected:
                                      FixedLinearAllocator&              MemPool) noexcept
     {
         MemPool.AddSpace<TilePipelineData>();
-        ReserveResourceLayout(CreateInfo.PSODesc.ResourceLayout, MemPool);
         ReserveResourceSignatures(CreateInfo, MemPool);
     }
 
@@ -938,8 +928,9 @@ protected:
         GraphicsPipeline = CreateInfo.GraphicsPipeline;
         CorrectGraphicsPipelineDesc(GraphicsPipeline, this->GetDevice()->GetDeviceInfo().Features);
 
-        CopyResourceLayout(CreateInfo.PSODesc.ResourceLayout, this->m_Desc.ResourceLayout, MemPool);
+        InternResourceLayout(CreateInfo.PSODesc.ResourceLayout);
         CopyResourceSignatures(CreateInfo, MemPool);
+        AddToMemoryStats(MemPool);
 
         pRenderPass = GraphicsPipeline.pRenderPass;
         if (pRenderPass)
@@ -970,26 +961,30 @@ protected:
             }
         }
 
-        const auto&    InputLayout     = GraphicsPipeline.InputLayout;
-        LayoutElement* pLayoutElements = nullptr;
+        const auto& InputLayout = GraphicsPipeline.InputLayout;
         if (InputLayout.NumElements > 0)
         {
-            pLayoutElements = MemPool.ConstructArray<LayoutElement>(InputLayout.NumElements);
-            for (size_t Elem = 0; Elem < InputLayout.NumElements; ++Elem)
-            {
-                const auto& SrcElem   = InputLayout.LayoutElements[Elem];
-                pLayoutElements[Elem] = SrcElem;
-                VERIFY_EXPR(SrcElem.HLSLSemantic != nullptr);
-                pLayoutElements[Elem].HLSLSemantic = MemPool.CopyString(SrcElem.HLSLSemantic);
-            }
+            std::vector<LayoutElement> LayoutElements{InputLayout.LayoutElements, InputLayout.LayoutElements + InputLayout.NumElements};
+#ifdef DILIGENT_DEBUG
+            for (const auto& Elem : LayoutElements)
+                VERIFY_EXPR(Elem.HLSLSemantic != nullptr);
+#endif
 
             // Correct description and compute offsets and tight strides
-            const auto Strides = ResolveInputLayoutAutoOffsetsAndStrides(pLayoutElements, InputLayout.NumElements);
-            BufferSlotsUsed    = static_cast<Uint8>(Strides.size());
+            const auto Strides = ResolveInputLayoutAutoOffsetsAndStrides(LayoutElements.data(), InputLayout.NumElements);
+
+            m_pInputLayoutData = this->GetDevice()->GetPipelineDescInterner().InternInputLayout(
+                InputLayoutDesc{LayoutElements.data(), InputLayout.NumElements}, Strides.data(), static_cast<Uint32>(Strides.size()));
+
+            BufferSlotsUsed = static_cast<Uint8>(m_pInputLayoutData->BufferSlotsUsed);
+            pStrides        = m_pInputLayoutData->pStrides;
 
-            pStrides = MemPool.CopyConstructArray<Uint32>(Strides.data(), BufferSlotsUsed);
+            GraphicsPipeline.InputLayout = m_pInputLayoutData->Desc;
+        }
+        else
+        {
+            GraphicsPipeline.InputLayout.LayoutElements = nullptr;
         }
-        GraphicsPipeline.InputLayout.LayoutElements = pLayoutElements;
     }
 
     void InitializePipelineDesc(const ComputePipelineStateCreateInfo& CreateInfo,
@@ -997,8 +992,9 @@ protected:
     {
         m_pPipelineDataRawMem = MemPool.ReleaseOwnership();
 
-        CopyResourceLayout(CreateInfo.PSODesc.ResourceLayout, this->m_Desc.ResourceLayout, MemPool);
+        InternResourceLayout(CreateInfo.PSODesc.ResourceLayout);
         CopyResourceSignatures(CreateInfo, MemPool);
+        AddToMemoryStats(MemPool);
     }
 
     void InitializePipelineDesc(const RayTracingPipelineStateCreateInfo& CreateInfo,
@@ -1024,8 +1020,9 @@ protected:
         TNameToGroupIndexMap& NameToGroupIndex = this->m_pRayTracingPipelineData->NameToGroupIndex;
         CopyRTShaderGroupNames(NameToGroupIndex, CreateInfo, MemPool);
 
-        CopyResourceLayout(CreateInfo.PSODesc.ResourceLayout, this->m_Desc.ResourceLayout, MemPool);
+        InternResourceLayout(CreateInfo.PSODesc.ResourceLayout);
         CopyResourceSignatures(CreateInfo, MemPool);
+        AddToMemoryStats(MemPool);
     }
 
     void InitializePipelineDesc(const TilePipelineStateCreateInfo& CreateInfo,
@@ -1037,8 +1034,9 @@ protected:
 
         this->m_pTilePipelineData->Desc = CreateInfo.TilePipeline;
 
-        CopyResourceLayout(CreateInfo.PSODesc.ResourceLayout, this->m_Desc.ResourceLayout, MemPool);
+        InternResourceLayout(CreateInfo.PSODesc.ResourceLayout);
         CopyResourceSignatures(CreateInfo, MemPool);
+        AddToMemoryStats(MemPool);
     }
 
     // Resource attribution properties
@@ -1144,71 +1142,43 @@ private:
                       ". Use GetStatus() to check the pipeline state status.");
     }
 
-    static void ReserveResourceLayout(const PipelineResourceLayoutDesc& SrcLayout, FixedLinearAllocator& MemPool) noexcept
+    void InternResourceLayout(const PipelineResourceLayoutDesc& SrcLayout)
     {
-        if (SrcLayout.Variables != nullptr)
+        PipelineResourceLayoutDesc& DstLayout = this->m_Desc.ResourceLayout;
+        if (SrcLayout.NumVariables == 0 && SrcLayout.NumImmutableSamplers == 0)
         {
-            MemPool.AddSpace<ShaderResourceVariableDesc>(SrcLayout.NumVariables);
-            for (Uint32 i = 0; i < SrcLayout.NumVariables; ++i)
-            {
-                VERIFY(SrcLayout.Variables[i].Name != nullptr, "Variable name can't be null");
-                MemPool.AddSpaceForString(SrcLayout.Variables[i].Name);
-            }
+            DstLayout.Variables         = nullptr;
+            DstLayout.ImmutableSamplers = nullptr;
+            return;
         }
 
-        if (SrcLayout.ImmutableSamplers != nullptr)
+#ifdef DILIGENT_DEVELOPMENT
+        for (Uint32 i = 0; i < SrcLayout.NumImmutableSamplers; ++i)
         {
-            MemPool.AddSpace<ImmutableSamplerDesc>(SrcLayout.NumImmutableSamplers);
-            for (Uint32 i = 0; i < SrcLayout.NumImmutableSamplers; ++i)
+            const auto& SrcSmplr    = SrcLayout.ImmutableSamplers[i];
+            const auto& BorderColor = SrcSmplr.Desc.BorderColor;
+            if (!((BorderColor[0] == 0 && BorderColor[1] == 0 && BorderColor[2] == 0 && BorderColor[3] == 0) ||
+                  (BorderColor[0] == 0 && BorderColor[1] == 0 && BorderColor[2] == 0 && BorderColor[3] == 1) ||
+                  (BorderColor[0] == 1 && BorderColor[1] == 1 && BorderColor[2] == 1 && BorderColor[3] == 1)))
             {
-                VERIFY(SrcLayout.ImmutableSamplers[i].SamplerOrTextureName != nullptr, "Immutable sampler or texture name can't be null");
-                MemPool.AddSpaceForString(SrcLayout.ImmutableSamplers[i].SamplerOrTextureName);
+                LOG_WARNING_MESSAGE("Immutable sampler for variable \"", SrcSmplr.SamplerOrTextureName, "\" specifies border color (",
+                                    BorderColor[0], ", ", BorderColor[1], ", ", BorderColor[2], ", ", BorderColor[3],
+                                    "). D3D12 static samplers only allow transparent black (0,0,0,0), opaque black (0,0,0,1) or opaque white (1,1,1,1) as border colors");
             }
         }
+#endif
 
-        static_assert(std::is_trivially_destructible<decltype(*SrcLayout.Variables)>::value, "Add destructor for this object to Destruct()");
-        static_assert(std::is_trivially_destructible<decltype(*SrcLayout.ImmutableSamplers)>::value, "Add destructor for this object to Destruct()");
+        m_pResourceLayoutData = this->GetDevice()->GetPipelineDescInterner().InternResourceLayout(SrcLayout);
+
+        DstLayout = m_pResourceLayoutData->Desc;
     }
 
-    static void CopyResourceLayout(const PipelineResourceLayoutDesc& SrcLayout, PipelineResourceLayoutDesc& DstLayout, FixedLinearAllocator& MemPool)
+    void AddToMemoryStats(const FixedLinearAllocator& MemPool)
     {
-        if (SrcLayout.Variables != nullptr)
-        {
-            auto* const Variables = MemPool.ConstructArray<ShaderResourceVariableDesc>(SrcLayout.NumVariables);
-            DstLayout.Variables   = Variables;
-            for (Uint32 i = 0; i < SrcLayout.NumVariables; ++i)
-            {
-                const auto& SrcVar = SrcLayout.Variables[i];
-                Variables[i]       = SrcVar;
-                Variables[i].Name  = MemPool.CopyString(SrcVar.Name);
-            }
-        }
-
-        if (SrcLayout.ImmutableSamplers != nullptr)
-        {
-            auto* const ImmutableSamplers = MemPool.ConstructArray<ImmutableSamplerDesc>(SrcLayout.NumImmutableSamplers);
-            DstLayout.ImmutableSamplers   = ImmutableSamplers;
-            for (Uint32 i = 0; i < SrcLayout.NumImmutableSamplers; ++i)
-            {
-                const auto& SrcSmplr = SrcLayout.ImmutableSamplers[i];
-#ifdef DILIGENT_DEVELOPMENT
-                {
-                    const auto& BorderColor = SrcSmplr.Desc.BorderColor;
-                    if (!((BorderColor[0] == 0 && BorderColor[1] == 0 && BorderColor[2] == 0 && BorderColor[3] == 0) ||
-                          (BorderColor[0] == 0 && BorderColor[1] == 0 && BorderColor[2] == 0 && BorderColor[3] == 1) ||
-                          (BorderColor[0] == 1 && BorderColor[1] == 1 && BorderColor[2] == 1 && BorderColor[3] == 1)))
-                    {
-                        LOG_WARNING_MESSAGE("Immutable sampler for variable \"", SrcSmplr.SamplerOrTextureName, "\" specifies border color (",
-                                            BorderColor[0], ", ", BorderColor[1], ", ", BorderColor[2], ", ", BorderColor[3],
-                                            "). D3D12 static samplers only allow transparent black (0,0,0,0), opaque black (0,0,0,1) or opaque white (1,1,1,1) as border colors");
-                    }
-                }
-#endif
-
-                ImmutableSamplers[i]                      = SrcSmplr;
-                ImmutableSamplers[i].SamplerOrTextureName = MemPool.CopyString(SrcSmplr.SamplerOrTextureName);
-            }
-        }
+        VERIFY(m_MemoryStatsSize == 0, "Memory stats have already been updated");
+        // Count at least the object itself so that every pipeline is reflected in the stats
+        m_MemoryStatsSize = sizeof(PipelineStateImplType) + MemPool.GetReservedSize();
+        this->GetDevice()->GetPipelineStateCounter().Add(m_MemoryStatsSize);
     }
 
     void ReserveResourceSignatures(const PipelineStateCreateInfo& CreateInfo, FixedLinearAllocator& MemPool)
@@ -1305,8 +1275,8 @@ protected:
 
         RefCntAutoPtr<IRenderPass> pRenderPass; ///< Strong reference to the render pass object
 
-        Uint32* pStrides        = nullptr;
-        Uint8   BufferSlotsUsed = 0;
+        const Uint32* pStrides        = nullptr;
+        Uint8         BufferSlotsUsed = 0;
     };
 
     struct RayTracingPipelineData
@@ -1334,6 +1304,13 @@ protected:
         TilePipelineDesc Desc;
     };
 
+    // Layouts shared with other pipelines, see PipelineDescInterner
+    std::shared_ptr<const PipelineDescInterner::ResourceLayoutData> m_pResourceLayoutData;
+    std::shared_ptr<const PipelineDescInterner::InputLayoutData>    m_pInputLayoutData;
+
+    // The pipeline size reported by IRenderDevice::GetMemoryStats()
+    Uint64 m_MemoryStatsSize = 0;
+
     union
     {
         GraphicsPipelineData*   m_pGraphicsPipelineData;
@@ -34,6 +34,7 @@
 #include "DeviceObjectBase.hpp"
 #include "GraphicsTypes.h"
 #include "RefCntAutoPtr.hpp"
+#include "GraphicsAccessories.hpp"
 
 namespace Diligent
 {
@@ -166,6 +167,20 @@ public:
         return m_State;
     }
 
+    void CheckResolveQuery(const DeviceContextImplType* pContext) const
+    {
+        DEV_CHECK_ERR(m_State == QueryState::Ended,
+                      "Attempting to resolve query '", this->m_Desc.Name, "' that has not been ended.");
+        DEV_CHECK_ERR(m_pContext == pContext,
+                      "Query '", this->m_Desc.Name, "' has been ended by another context.");
+        DEV_CHECK_ERR(this->m_Desc.Type == QUERY_TYPE_OCCLUSION ||
+                          this->m_Desc.Type == QUERY_TYPE_BINARY_OCCLUSION ||
+                          this->m_Desc.Type == QUERY_TYPE_TIMESTAMP,
+                      "Query '", this->m_Desc.Name, "' has type ", GetQueryTypeString(this->m_Desc.Type),
+                      ". Only occlusion, binary occlusion and timestamp queries can be resolved into a buffer.");
+        (void)pContext;
+    }
+
     void CheckQueryDataPtr(void* pData, Uint32 DataSize)
     {
         DEV_CHECK_ERR(m_State == QueryState::Ended,
@@ -31,6 +31,7 @@
 /// Implementation of the Diligent::RenderDeviceBase template class and related structures
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 
 #include "RenderDevice.h"
@@ -48,6 +49,7 @@
 #include "STDAllocator.hpp"
 #include "IndexWrapper.hpp"
 #include "ThreadPool.hpp"
+#include "PipelineDescInterner.hpp"
 
 namespace Diligent
 {
@@ -121,6 +123,8 @@ public:
     ///
     /// \remarks Render device uses fixed block allocators (see FixedBlockMemoryAllocator) to allocate memory for
     ///          device objects. The object sizes from EngineImplTraits are used to initialize the allocators.
+    ///          Allocators for texture views, buffer views and shader resource bindings that are frequently
+    ///          created from multiple threads use thread caches to reduce the lock contention.
     RenderDeviceBase(IReferenceCounters*        pRefCounters,
                      IMemoryAllocator&          RawMemAllocator,
                      IEngineFactory*            pEngineFactory,
@@ -130,6 +134,7 @@ public:
         TObjectBase           {pRefCounters},
         m_pEngineFactory      {pEngineFactory},
         m_ValidationFlags     {EngineCI.ValidationFlags},
+        m_DeduplicatePipelineStates{EngineCI.EnablePipelineStateDeduplication != False},
         m_AdapterInfo         {AdapterInfo},
         m_TextureFormatsInfo  (TEX_FORMAT_NUM_FORMATS, TextureFormatInfoExt(), STD_ALLOCATOR_RAW_MEM(TextureFormatInfoExt, RawMemAllocator, "Allocator for vector<TextureFormatInfoExt>")),
         m_TexFmtInfoInitFlags (TEX_FORMAT_NUM_FORMATS, false, STD_ALLOCATOR_RAW_MEM(bool, RawMemAllocator, "Allocator for vector<bool>")),
@@ -137,13 +142,13 @@ public:
         m_wpDeferredContexts  (EngineCI.NumDeferredContexts, RefCntWeakPtr<DeviceContextImplType>(), STD_ALLOCATOR_RAW_MEM(RefCntWeakPtr<DeviceContextImplType>, RawMemAllocator, "Allocator for vector<RefCntWeakPtr<DeviceContextImplType>>")),
         m_RawMemAllocator     {RawMemAllocator},
         m_TexObjAllocator     {RawMemAllocator, sizeof(TextureImplType),                   16},
-        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32},
+        m_TexViewObjAllocator {RawMemAllocator, sizeof(TextureViewImplType),               32, 8},
         m_BufObjAllocator     {RawMemAllocator, sizeof(BufferImplType),                    16},
-        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32},
+        m_BuffViewObjAllocator{RawMemAllocator, sizeof(BufferViewImplType),                32, 8},
         m_ShaderObjAllocator  {RawMemAllocator, sizeof(ShaderImplType),                    16},
         m_SamplerObjAllocator {RawMemAllocator, sizeof(SamplerImplType),                   32},
         m_PSOAllocator        {RawMemAllocator, sizeof(PipelineStateImplType),             16},
-        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64},
+        m_SRBAllocator        {RawMemAllocator, sizeof(ShaderResourceBindingImplType),     64, 16},
         m_ResMappingAllocator {RawMemAllocator, sizeof(ResourceMappingImpl),                8},
         m_FenceAllocator      {RawMemAllocator, sizeof(FenceImplType),                     16},
         m_QueryAllocator      {RawMemAllocator, sizeof(QueryImplType),                     16},
@@ -292,6 +297,29 @@ public:
         UNSUPPORTED("Tile pipeline is not supported by this device. Please check DeviceFeatures.TileShaders feature.");
     }
 
+    /// Base implementation of IRenderDevice::WaitForFences().
+
+    /// When waiting for all fences without a timeout, the method waits for each fence in turn.
+    /// Otherwise, it polls fence values until the wait condition is satisfied or the timeout expires.
+    virtual Bool DILIGENT_CALL_TYPE WaitForFences(IFence* const* ppFences,
+                                                  const Uint64*  pValues,
+                                                  Uint32         NumFences,
+                                                  Bool           WaitAll,
+                                                  Uint64         Timeout) override
+    {
+        DvpVerifyWaitForFencesArguments(ppFences, pValues, NumFences);
+
+        if (WaitAll && Timeout == ~Uint64{0})
+        {
+            for (Uint32 i = 0; i < NumFences; ++i)
+                ppFences[i]->Wait(pValues[i]);
+            return true;
+        }
+
+        return PollFences(ppFences, pValues, NumFences, WaitAll, Timeout,
+                          []() { std::this_thread::sleep_for(std::chrono::microseconds{1}); });
+    }
+
     /// Set weak reference to the immediate context
     void SetImmediateContext(size_t Ctx, DeviceContextImplType* pImmediateContext)
     {
@@ -343,9 +371,95 @@ public:
         return m_pShaderCompilationThreadPool;
     }
 
+    /// Base implementation of IRenderDevice::GetMemoryStats() that reports resource totals.
+    /// Backends that manage memory themselves override the method to add heap statistics.
+    virtual void DILIGENT_CALL_TYPE GetMemoryStats(DeviceMemoryStats& Stats) override
+    {
+        Stats                   = {};
+        Stats.NumBuffers        = m_BufferCounter.Count.load();
+        Stats.NumTextures       = m_TextureCounter.Count.load();
+        Stats.BufferMemorySize  = m_BufferCounter.Size.load();
+        Stats.TextureMemorySize = m_TextureCounter.Size.load();
+
+        Stats.NumPipelineStates            = m_PipelineStateCounter.Count.load();
+        Stats.PipelineStateMemorySize      = m_PipelineStateCounter.Size.load();
+        Stats.SharedPipelineDescMemorySize = m_PipelineDescInterner.GetMemorySize();
+    }
+
+    /// Tracks the number and total size of resources of one type for GetMemoryStats().
+    struct ResourceCounter
+    {
+        std::atomic<Uint32> Count{0};
+        std::atomic<Uint64> Size{0};
+
+        void Add(Uint64 ResourceSize)
+        {
+            Count.fetch_add(1);
+            Size.fetch_add(ResourceSize);
+        }
+
+        void Remove(Uint64 ResourceSize)
+        {
+            VERIFY_EXPR(Count.load() > 0 && Size.load() >= ResourceSize);
+            Count.fetch_sub(1);
+            Size.fetch_sub(ResourceSize);
+        }
+    };
+
+    ResourceCounter& GetBufferCounter() { return m_BufferCounter; }
+    ResourceCounter& GetTextureCounter() { return m_TextureCounter; }
+    ResourceCounter& GetPipelineStateCounter() { return m_PipelineStateCounter; }
+
+    PipelineDescInterner& GetPipelineDescInterner() { return m_PipelineDescInterner; }
+
 protected:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) = 0;
 
+    void DvpVerifyWaitForFencesArguments(IFence* const* ppFences, const Uint64* pValues, Uint32 NumFences) const
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        DEV_CHECK_ERR(NumFences == 0 || (ppFences != nullptr && pValues != nullptr), "IRenderDevice::WaitForFences: ppFences and pValues must not be null");
+        for (Uint32 i = 0; i < NumFences && ppFences != nullptr; ++i)
+            DEV_CHECK_ERR(ppFences[i] != nullptr, "IRenderDevice::WaitForFences: fence ", i, " is null");
+#endif
+    }
+
+    /// Polls fence values until one or all fences reach their values or the timeout expires.
+    /// IdleFunc is called between polls.
+    template <typename IdleFuncType>
+    static bool PollFences(IFence* const* ppFences,
+                           const Uint64*  pValues,
+                           Uint32         NumFences,
+                           bool           WaitAll,
+                           Uint64         Timeout,
+                           IdleFuncType   IdleFunc)
+    {
+        if (NumFences == 0)
+            return true;
+
+        const auto StartTime = std::chrono::steady_clock::now();
+        while (true)
+        {
+            Uint32 NumCompleted = 0;
+            for (Uint32 i = 0; i < NumFences; ++i)
+            {
+                if (ppFences[i]->GetCompletedValue() >= pValues[i])
+                    ++NumCompleted;
+            }
+            if (WaitAll ? NumCompleted == NumFences : NumCompleted > 0)
+                return true;
+
+            if (Timeout != ~Uint64{0})
+            {
+                const auto ElapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime).count();
+                if (static_cast<Uint64>(ElapsedNs) >= Timeout)
+                    return false;
+            }
+
+            IdleFunc();
+        }
+    }
+
     void InitShaderCompilationThreadPool(IThreadPool* pShaderCompilationThreadPool, Uint32 NumThreads)
     {
         if (!m_DeviceInfo.Features.AsyncShaderCompilation)
@@ -433,11 +547,55 @@ protected:
         CreateDeviceObject("Pipeline State", PSOCreateInfo.PSODesc, ppPipelineState,
                            [&]() //
                            {
-                               auto* pPipelineStateImpl = NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo, ExtraArgs...);
-                               pPipelineStateImpl->QueryInterface(IID_PipelineState, reinterpret_cast<IObject**>(ppPipelineState));
+                               auto pPSO = CreatePipelineStateObject(PSOCreateInfo, ExtraArgs...);
+                               *ppPipelineState = pPSO.Detach();
                            });
     }
 
+    template <typename PSOCreateInfoType>
+    RefCntAutoPtr<IPipelineState> CreatePipelineStateObject(const PSOCreateInfoType& PSOCreateInfo)
+    {
+        const auto CreatePSO = [&]() {
+            return RefCntAutoPtr<IPipelineState>{NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo)};
+        };
+
+        // Bytecode hashing requires all shaders to be compiled, so pipelines
+        // whose shaders are still compiling are never deduplicated.
+        if (!m_DeduplicatePipelineStates || GetPipelineStateCreateInfoShadersStatus(PSOCreateInfo) != SHADER_STATUS_READY)
+            return CreatePSO();
+
+        const size_t Hash = StdHasher<PSOCreateInfoType>{}(PSOCreateInfo);
+
+        bool IsNewPSO = false;
+        auto pPSO     = m_PSORegistry.Get(Hash,
+                                      [&]() {
+                                          IsNewPSO = true;
+                                          return CreatePSO();
+                                      });
+        if (pPSO && !IsNewPSO)
+        {
+            // Guard against hash collisions. Only compare the members that the pipeline
+            // does not modify during initialization.
+            const PipelineStateDesc& Desc = pPSO->GetDesc();
+            if (Desc.PipelineType != PSOCreateInfo.PSODesc.PipelineType || Desc.ResourceLayout != PSOCreateInfo.PSODesc.ResourceLayout)
+            {
+                LOG_WARNING_MESSAGE("Pipeline state '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : ""),
+                                    "' has the same content hash as pipeline state '", (Desc.Name ? Desc.Name : ""),
+                                    "', but a different description. A new pipeline state will be created.");
+                return CreatePSO();
+            }
+        }
+
+        return pPSO;
+    }
+
+    // Pipelines created with extra arguments (e.g. device-internal pipelines or archiver pipelines) are never deduplicated.
+    template <typename PSOCreateInfoType, typename FirstExtraArgType, typename... RestExtraArgsType>
+    RefCntAutoPtr<IPipelineState> CreatePipelineStateObject(const PSOCreateInfoType& PSOCreateInfo, const FirstExtraArgType& FirstExtraArg, const RestExtraArgsType&... RestExtraArgs)
+    {
+        return RefCntAutoPtr<IPipelineState>{NEW_RC_OBJ(m_PSOAllocator, "Pipeline State instance", PipelineStateImplType)(static_cast<RenderDeviceImplType*>(this), PSOCreateInfo, FirstExtraArg, RestExtraArgs...)};
+    }
+
     template <typename... ExtraArgsType>
     void CreateBufferImpl(IBuffer** ppBuffer, const BufferDesc& BuffDesc, const ExtraArgsType&... ExtraArgs)
     {
@@ -489,6 +647,23 @@ protected:
                            });
     }
 
+    /// Creates a sampler that is not shared through the samplers registry.
+
+    /// Device-internal samplers must be created with this method: they do not keep a strong
+    /// reference to the device, so sharing them with the application could leave it holding
+    /// a sampler that outlives the device, while an application sampler stored by the device
+    /// would create a reference cycle.
+    template <typename... ExtraArgsType>
+    void CreateUnsharedSamplerImpl(ISampler** ppSampler, const SamplerDesc& SamplerDesc, const ExtraArgsType&... ExtraArgs)
+    {
+        CreateDeviceObject("Sampler", SamplerDesc, ppSampler,
+                           [&]() //
+                           {
+                               auto* pSamplerImpl = NEW_RC_OBJ(m_SamplerObjAllocator, "Sampler instance", SamplerImplType)(static_cast<RenderDeviceImplType*>(this), SamplerDesc, ExtraArgs...);
+                               pSamplerImpl->QueryInterface(IID_Sampler, reinterpret_cast<IObject**>(ppSampler));
+                           });
+    }
+
     template <typename... ExtraArgsType>
     void CreateFenceImpl(IFence** ppFence, const FenceDesc& Desc, const ExtraArgsType&... ExtraArgs)
     {
@@ -600,13 +775,24 @@ protected:
     RefCntAutoPtr<IEngineFactory> m_pEngineFactory;
 
     const VALIDATION_FLAGS m_ValidationFlags;
+    const bool             m_DeduplicatePipelineStates;
     GraphicsAdapterInfo    m_AdapterInfo;
     RenderDeviceInfo       m_DeviceInfo;
 
+    // Resource counters must be declared before any member that may hold resources
+    // so that they are destroyed last.
+    ResourceCounter m_BufferCounter;
+    ResourceCounter m_TextureCounter;
+    ResourceCounter m_PipelineStateCounter;
+
+    // Pipelines hold strong references to the interned data, so it may outlive the interner.
+    PipelineDescInterner m_PipelineDescInterner;
+
     // All state object registries hold raw pointers.
     // This is safe because every object unregisters itself
     // when it is deleted.
     ObjectsRegistry<SamplerDesc, RefCntAutoPtr<ISampler>>                       m_SamplersRegistry; ///< Sampler state registry
+    ObjectsRegistry<size_t, RefCntAutoPtr<IPipelineState>>                      m_PSORegistry;      ///< Deduplicated pipeline state registry, keyed by content hash
     std::vector<TextureFormatInfoExt, STDAllocatorRawMem<TextureFormatInfoExt>> m_TextureFormatsInfo;
     std::vector<bool, STDAllocatorRawMem<bool>>                                 m_TexFmtInfoInitFlags;
 
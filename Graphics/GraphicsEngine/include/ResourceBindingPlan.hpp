@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ResourceBindingPlan class
+
+#include <vector>
+
+#include "ResourceMapping.h"
+
+namespace Diligent
+{
+
+/// Caches resources resolved from a resource mapping for a fixed sequence of shader variables.
+
+/// IShaderResourceBinding::BindResources() and IPipelineResourceSignature::BindStaticResources()
+/// look up every variable in the resource mapping by name. When the same mapping is bound
+/// repeatedly, the plan lets the variable manager do the lookups only once: the first pass
+/// records the resolved objects in a flat array in variable order, and subsequent passes
+/// read them back as long as the mapping has not been modified (see ResourceMappingImpl::GetStateId()).
+///
+/// Usage:
+///
+///     Plan.Begin(pResourceMapping);
+///     for (each variable, always in the same order)
+///         IDeviceObject* const* ppObjects = Plan.Resolve(Name, ArraySize);
+///     Plan.End();
+///
+/// The plan stores raw pointers. This is safe because they are only read while the mapping
+/// reports the same state id, which means the mapping is alive and still holds strong references
+/// to all of them. Mappings that are not created by the engine are resolved on every pass.
+class ResourceBindingPlan
+{
+public:
+    /// Starts a binding pass for the given resource mapping.
+    /// If the mapping has changed since the plan was recorded, the plan is discarded.
+    void Begin(IResourceMapping* pResourceMapping);
+
+    /// Returns ArraySize objects (some of which may be null) that the mapping contains for the
+    /// variable with the given name. The pointer is valid until the next call to Resolve().
+    IDeviceObject* const* Resolve(const Char* Name, Uint32 ArraySize);
+
+    /// Finishes the binding pass. If the plan was recorded in this pass, it becomes valid.
+    void End();
+
+    /// Discards the recorded plan.
+    void Invalidate();
+
+    bool IsValid() const { return m_IsValid; }
+
+private:
+    IResourceMapping* m_pResourceMapping = nullptr;
+
+    // State id of the mapping the plan was recorded for, or zero if the mapping
+    // is not a ResourceMappingImpl and the plan can't be cached.
+    Uint64 m_StateId = 0;
+
+    // Current position in m_Objects during the binding pass.
+    size_t m_Offset = 0;
+
+    bool m_IsValid = false;
+
+    std::vector<IDeviceObject*> m_Objects;
+};
+
+} // namespace Diligent
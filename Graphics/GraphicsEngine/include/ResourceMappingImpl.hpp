@@ -31,6 +31,7 @@
 /// Declaration of the Diligent::ResourceMappingImpl class
 
 #include <unordered_map>
+#include <atomic>
 
 #include "ResourceMapping.h"
 #include "ObjectBase.hpp"
@@ -49,16 +50,21 @@ class ResourceMappingImpl : public ObjectBase<IResourceMapping>
 public:
     typedef ObjectBase<IResourceMapping> TObjectBase;
 
+    // {6C1AC2E1-3B0E-4F3B-9D53-0E1A5D5C1B7E}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x6c1ac2e1, 0x3b0e, 0x4f3b, {0x9d, 0x53, 0xe, 0x1a, 0x5d, 0x5c, 0x1b, 0x7e}};
+
     /// \param pRefCounters - reference counters object that controls the lifetime of this resource mapping
     /// \param RawMemAllocator - raw memory allocator that is used by the m_HashTable member
     ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
         TObjectBase{pRefCounters},
-        m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")}
+        m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")},
+        m_StateId{GenerateStateId()}
     {}
 
     ~ResourceMappingImpl();
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ResourceMapping, TObjectBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_ResourceMapping, IID_InternalImpl, TObjectBase)
 
     /// Implementation of IResourceMapping::AddResource()
     virtual void DILIGENT_CALL_TYPE AddResource(const Char*    Name,
@@ -82,7 +88,20 @@ public:
     /// Returns number of resources in the resource mapping.
     virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
 
+    /// Returns the identifier of the current contents of the resource mapping.
+
+    /// The identifier is unique across all resource mappings and changes every time
+    /// a resource is added, replaced or removed. If two calls return the same value,
+    /// the mapping has not been modified in between, so resources resolved from it
+    /// (see ResourceBindingPlan) are still valid.
+    Uint64 GetStateId() const
+    {
+        return m_StateId.load(std::memory_order_acquire);
+    }
+
 private:
+    static Uint64 GenerateStateId();
+
     struct ResMappingHashKey : public HashMapStringKey
     {
         using TBase = HashMapStringKey;
@@ -122,7 +141,7 @@ private:
         const Uint32 ArrayIndex;
     };
 
-    Threading::SpinLock m_Lock;
+    Threading::AdaptiveLock m_Lock;
 
     using HashTableElem = std::pair<const ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>;
     std::unordered_map<ResMappingHashKey,
@@ -131,6 +150,8 @@ private:
                        std::equal_to<ResMappingHashKey>,
                        STDAllocatorRawMem<HashTableElem>>
         m_HashTable;
+
+    std::atomic<Uint64> m_StateId;
 };
 
 } // namespace Diligent
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the Diligent::ResourceViewCache template class
+
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+
+#include "RefCntAutoPtr.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Cache of the views of a single texture or buffer, keyed by the view description.
+
+/// \tparam ViewDescType  - View description type (TextureViewDesc or BufferViewDesc).
+/// \tparam ViewInterface - View interface type (ITextureView or IBufferView).
+///
+/// The cache holds weak references to the views, so a view is released as soon as the
+/// application releases the last strong reference. Since views keep strong references
+/// to their resources, holding strong references here would create reference cycles.
+template <typename ViewDescType, typename ViewInterface>
+class ResourceViewCache
+{
+public:
+    /// Returns the cached view with the same description or creates a new one.
+
+    /// \param [in]  ViewDesc   - View description. The name is ignored when looking up
+    ///                           the cache, so the returned view may have a different name.
+    /// \param [out] ppView     - Address of the memory location where the pointer to the view
+    ///                           will be written.
+    /// \param [in]  CreateView - Function that creates a new view: void(const ViewDescType&, ViewInterface**).
+    template <typename CreateViewFuncType>
+    void GetOrCreate(const ViewDescType& ViewDesc, ViewInterface** ppView, CreateViewFuncType&& CreateView)
+    {
+        // The name pointer is not owned by the cache, so it is not stored in the key.
+        ViewDescType Key = ViewDesc;
+        Key.Name         = nullptr;
+
+        // The lock is held while the view is created, so that concurrent requests for the same
+        // description do not create duplicate views.
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Views.find(Key);
+        if (it != m_Views.end())
+        {
+            if (RefCntAutoPtr<ViewInterface> pView = it->second.Lock())
+            {
+                *ppView = pView.Detach();
+                return;
+            }
+        }
+
+        CreateView(ViewDesc, ppView);
+        if (*ppView == nullptr)
+            return;
+
+        if (it != m_Views.end())
+        {
+            it->second = RefCntWeakPtr<ViewInterface>{*ppView};
+        }
+        else
+        {
+            m_Views.emplace(Key, RefCntWeakPtr<ViewInterface>{*ppView});
+            if (m_Views.size() >= m_PurgeThreshold)
+                PurgeExpired();
+        }
+    }
+
+    size_t GetSize() const
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        return m_Views.size();
+    }
+
+private:
+    // Removes the entries of the views that have been released. The threshold grows
+    // with the number of live views, so the purge cost is amortized over insertions.
+    void PurgeExpired()
+    {
+        for (auto it = m_Views.begin(); it != m_Views.end();)
+        {
+            if (!it->second.IsValid())
+                it = m_Views.erase(it);
+            else
+                ++it;
+        }
+        m_PurgeThreshold = std::max(m_Views.size() * 2, MinPurgeThreshold);
+    }
+
+private:
+    static constexpr size_t MinPurgeThreshold = 16;
+
+    mutable std::mutex                                           m_Mtx;
+    std::unordered_map<ViewDescType, RefCntWeakPtr<ViewInterface>> m_Views;
+    size_t                                                       m_PurgeThreshold = MinPurgeThreshold;
+};
+
+} // namespace Diligent
@@ -166,6 +166,11 @@ public:
         return m_Status.load();
     }
 
+    virtual Float64 DILIGENT_CALL_TYPE GetCompileTime() const override
+    {
+        return m_CompileTime.load();
+    }
+
     bool IsCompiling() const
     {
         return m_Status.load() <= SHADER_STATUS_COMPILING;
@@ -182,6 +187,10 @@ protected:
     const std::string m_CombinedSamplerSuffix;
 
     std::atomic<SHADER_STATUS> m_Status{SHADER_STATUS_UNINITIALIZED};
+
+    // Time, in seconds, spent compiling the shader source.
+    // Must be set by the compiling task before the status is updated.
+    std::atomic<Float64> m_CompileTime{0};
 };
 
 } // namespace Diligent
@@ -31,6 +31,8 @@
 /// Implementation of the Diligent::ShaderBindingTableBase template class
 
 #include <unordered_map>
+#include <vector>
+#include <algorithm>
 #include <cstring>
 
 #include "ShaderBindingTable.h"
@@ -108,6 +110,10 @@ public:
         this->m_MissShadersRecord.clear();
         this->m_CallableShadersRecord.clear();
         this->m_HitGroupsRecord.clear();
+        this->m_RayGenDirty.SetAll();
+        this->m_MissDirty.SetAll();
+        this->m_CallableDirty.SetAll();
+        this->m_HitGroupsDirty.SetAll();
         this->m_Changed = true;
         this->m_pPSO    = nullptr;
 
@@ -135,6 +141,7 @@ public:
         this->m_DbgHitGroupBindings.clear();
 #endif
         this->m_HitGroupsRecord.clear();
+        this->m_HitGroupsDirty.SetAll();
         this->m_Changed = true;
     }
 
@@ -149,6 +156,7 @@ public:
 
         const Uint32 GroupSize = this->GetDevice()->GetAdapterInfo().RayTracing.ShaderGroupHandleSize;
         std::memcpy(this->m_RayGenShaderRecord.data() + GroupSize, pData, DataSize);
+        this->m_RayGenDirty.Add(0, this->m_ShaderRecordStride);
         this->m_Changed = true;
     }
 
@@ -165,6 +173,7 @@ public:
 
         this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_MissShadersRecord.data() + Offset, Stride);
         std::memcpy(this->m_MissShadersRecord.data() + Offset + GroupSize, pData, DataSize);
+        this->m_MissDirty.Add(Offset, Offset + Stride);
         this->m_Changed = true;
     }
 
@@ -185,6 +194,7 @@ public:
 
         this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_HitGroupsRecord.data() + Offset, Stride);
         std::memcpy(this->m_HitGroupsRecord.data() + Offset + GroupSize, pData, DataSize);
+        this->m_HitGroupsDirty.Add(Offset, Offset + Stride);
         this->m_Changed = true;
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -227,6 +237,7 @@ public:
 
         this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_HitGroupsRecord.data() + Offset, Stride);
         std::memcpy(this->m_HitGroupsRecord.data() + Offset + GroupSize, pData, DataSize);
+        this->m_HitGroupsDirty.Add(Offset, Offset + Stride);
         this->m_Changed = true;
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -243,53 +254,22 @@ public:
                                                     const void*  pData,
                                                     Uint32       DataSize) override final
     {
-        VERIFY_EXPR((pData == nullptr) == (DataSize == 0));
-        VERIFY_EXPR((pData == nullptr) || (DataSize == this->m_ShaderRecordSize));
         VERIFY_EXPR(pTLAS != nullptr);
-
         auto* const pTLASImpl = ClassPtrCast<TopLevelASImplType>(pTLAS);
-        const auto  Info      = pTLASImpl->GetBuildInfo();
-        const auto  Desc      = pTLASImpl->GetInstanceDesc(pInstanceName);
-
-        VERIFY_EXPR(Info.BindingMode == HIT_GROUP_BINDING_MODE_PER_GEOMETRY ||
-                    Info.BindingMode == HIT_GROUP_BINDING_MODE_PER_INSTANCE);
-        VERIFY_EXPR(RayOffsetInHitGroupIndex < Info.HitGroupStride);
-        VERIFY_EXPR(Desc.ContributionToHitGroupIndex != INVALID_INDEX);
-        VERIFY_EXPR(Desc.pBLAS != nullptr);
-
-        const Uint32 InstanceOffset = Desc.ContributionToHitGroupIndex;
-        Uint32       GeometryCount  = 0;
-
-        switch (Info.BindingMode)
-        {
-            // clang-format off
-            case HIT_GROUP_BINDING_MODE_PER_GEOMETRY:     GeometryCount = Desc.pBLAS->GetActualGeometryCount(); break;
-            case HIT_GROUP_BINDING_MODE_PER_INSTANCE:     GeometryCount = 1;                                    break;
-            default:                                      UNEXPECTED("unknown binding mode");
-                // clang-format on
-        }
-
-        const Uint32 BeginIndex = InstanceOffset;
-        const size_t EndIndex   = InstanceOffset + size_t{GeometryCount} * size_t{Info.HitGroupStride};
-        const Uint32 GroupSize  = this->GetDevice()->GetAdapterInfo().RayTracing.ShaderGroupHandleSize;
-        const size_t Stride     = this->m_ShaderRecordStride;
-
-        this->m_HitGroupsRecord.resize(std::max(this->m_HitGroupsRecord.size(), EndIndex * Stride), Uint8{EmptyElem});
-        this->m_Changed = true;
-
-        for (Uint32 i = 0; i < GeometryCount; ++i)
-        {
-            Uint32 Index  = BeginIndex + i * Info.HitGroupStride + RayOffsetInHitGroupIndex;
-            size_t Offset = Index * Stride;
-            this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_HitGroupsRecord.data() + Offset, Stride);
+        BindHitGroupForInstanceImpl(pTLASImpl, pTLASImpl->GetInstanceDesc(pInstanceName), RayOffsetInHitGroupIndex, pShaderGroupName, pData, DataSize);
+    }
 
-            std::memcpy(this->m_HitGroupsRecord.data() + Offset + GroupSize, pData, DataSize);
 
-#ifdef DILIGENT_DEVELOPMENT
-            VERIFY_EXPR(Index >= Info.FirstContributionToHitGroupIndex && Index <= Info.LastContributionToHitGroupIndex);
-            OnBindHitGroup(pTLASImpl, Index);
-#endif
-        }
+    void DILIGENT_CALL_TYPE BindHitGroupForInstanceByIndex(ITopLevelAS* pTLAS,
+                                                           Uint32       InstanceIndex,
+                                                           Uint32       RayOffsetInHitGroupIndex,
+                                                           const char*  pShaderGroupName,
+                                                           const void*  pData,
+                                                           Uint32       DataSize) override final
+    {
+        VERIFY_EXPR(pTLAS != nullptr);
+        auto* const pTLASImpl = ClassPtrCast<TopLevelASImplType>(pTLAS);
+        BindHitGroupForInstanceImpl(pTLASImpl, pTLASImpl->GetInstanceDescByIndex(InstanceIndex), RayOffsetInHitGroupIndex, pShaderGroupName, pData, DataSize);
     }
 
 
@@ -313,6 +293,7 @@ public:
         const Uint32 GroupSize = this->GetDevice()->GetAdapterInfo().RayTracing.ShaderGroupHandleSize;
         const size_t Stride    = this->m_ShaderRecordStride;
         this->m_HitGroupsRecord.resize(std::max(this->m_HitGroupsRecord.size(), (size_t{Info.LastContributionToHitGroupIndex} + 1) * Stride), Uint8{EmptyElem});
+        this->m_HitGroupsDirty.Add((RayOffsetInHitGroupIndex + Info.FirstContributionToHitGroupIndex) * Stride, (size_t{Info.LastContributionToHitGroupIndex} + 1) * Stride);
         this->m_Changed = true;
 
         for (Uint32 Index = RayOffsetInHitGroupIndex + Info.FirstContributionToHitGroupIndex;
@@ -344,6 +325,7 @@ public:
 
         this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_CallableShadersRecord.data() + Offset, this->m_ShaderRecordStride);
         std::memcpy(this->m_CallableShadersRecord.data() + Offset + GroupSize, pData, DataSize);
+        this->m_CallableDirty.Add(Offset, Offset + this->m_ShaderRecordStride);
         this->m_Changed = true;
     }
 
@@ -437,17 +419,26 @@ public:
 
 protected:
     struct BindingTable
+    {
+        Uint32 Size   = 0;
+        Uint32 Offset = 0;
+        Uint32 Stride = 0;
+    };
+
+    // Range of the internal buffer that must be updated with the shader record data
+    struct BufferUpdateRange
     {
         const void* pData  = nullptr;
-        Uint32      Size   = 0;
         Uint32      Offset = 0;
-        Uint32      Stride = 0;
+        Uint32      Size   = 0;
     };
-    void GetData(BufferImplType*& pSBTBuffer,
-                 BindingTable&    RaygenShaderBindingTable,
-                 BindingTable&    MissShaderBindingTable,
-                 BindingTable&    HitShaderBindingTable,
-                 BindingTable&    CallableShaderBindingTable)
+
+    void GetData(BufferImplType*&                pSBTBuffer,
+                 BindingTable&                   RaygenShaderBindingTable,
+                 BindingTable&                   MissShaderBindingTable,
+                 BindingTable&                   HitShaderBindingTable,
+                 BindingTable&                   CallableShaderBindingTable,
+                 std::vector<BufferUpdateRange>& UpdateRanges)
     {
         const auto ShaderGroupBaseAlignment = this->GetDevice()->GetAdapterInfo().RayTracing.ShaderGroupBaseAlignment;
 
@@ -461,6 +452,11 @@ protected:
         const Uint32 CallableShadersOffset = AlignToLarger(HitGroupOffset + m_HitGroupsRecord.size());
         const Uint32 BufSize               = AlignToLarger(CallableShadersOffset + m_CallableShadersRecord.size());
 
+        // All records must be uploaded when the buffer is recreated or tables are moved
+        bool FullUpdate = (MissShaderOffset != m_UploadedMissOffset ||
+                           HitGroupOffset != m_UploadedHitGroupOffset ||
+                           CallableShadersOffset != m_UploadedCallableOffset);
+
         // Recreate buffer
         if (m_pBuffer == nullptr || m_pBuffer->GetDesc().Size < BufSize)
         {
@@ -475,6 +471,7 @@ protected:
 
             this->GetDevice()->CreateBuffer(BuffDesc, nullptr, m_pBuffer.template DblPtr<IBuffer>());
             VERIFY_EXPR(m_pBuffer != nullptr);
+            FullUpdate = true;
         }
 
         if (m_pBuffer == nullptr)
@@ -484,7 +481,6 @@ protected:
 
         if (!m_RayGenShaderRecord.empty())
         {
-            RaygenShaderBindingTable.pData  = m_Changed ? m_RayGenShaderRecord.data() : nullptr;
             RaygenShaderBindingTable.Offset = RayGenOffset;
             RaygenShaderBindingTable.Size   = static_cast<Uint32>(m_RayGenShaderRecord.size());
             RaygenShaderBindingTable.Stride = this->m_ShaderRecordStride;
@@ -492,7 +488,6 @@ protected:
 
         if (!m_MissShadersRecord.empty())
         {
-            MissShaderBindingTable.pData  = m_Changed ? m_MissShadersRecord.data() : nullptr;
             MissShaderBindingTable.Offset = MissShaderOffset;
             MissShaderBindingTable.Size   = static_cast<Uint32>(m_MissShadersRecord.size());
             MissShaderBindingTable.Stride = this->m_ShaderRecordStride;
@@ -500,7 +495,6 @@ protected:
 
         if (!m_HitGroupsRecord.empty())
         {
-            HitShaderBindingTable.pData  = m_Changed ? m_HitGroupsRecord.data() : nullptr;
             HitShaderBindingTable.Offset = HitGroupOffset;
             HitShaderBindingTable.Size   = static_cast<Uint32>(m_HitGroupsRecord.size());
             HitShaderBindingTable.Stride = this->m_ShaderRecordStride;
@@ -508,21 +502,124 @@ protected:
 
         if (!m_CallableShadersRecord.empty())
         {
-            CallableShaderBindingTable.pData  = m_Changed ? m_CallableShadersRecord.data() : nullptr;
             CallableShaderBindingTable.Offset = CallableShadersOffset;
             CallableShaderBindingTable.Size   = static_cast<Uint32>(m_CallableShadersRecord.size());
             CallableShaderBindingTable.Stride = this->m_ShaderRecordStride;
         }
 
+        if (m_Changed || FullUpdate)
+        {
+            m_RayGenDirty.GetUpdateRanges(m_RayGenShaderRecord, RayGenOffset, FullUpdate, UpdateRanges);
+            m_MissDirty.GetUpdateRanges(m_MissShadersRecord, MissShaderOffset, FullUpdate, UpdateRanges);
+            m_HitGroupsDirty.GetUpdateRanges(m_HitGroupsRecord, HitGroupOffset, FullUpdate, UpdateRanges);
+            m_CallableDirty.GetUpdateRanges(m_CallableShadersRecord, CallableShadersOffset, FullUpdate, UpdateRanges);
+        }
+
+        m_UploadedMissOffset     = MissShaderOffset;
+        m_UploadedHitGroupOffset = HitGroupOffset;
+        m_UploadedCallableOffset = CallableShadersOffset;
+
         m_Changed = false;
     }
 
 protected:
+    // Tracks the shader records that have been modified since the last update of the internal buffer
+    struct DirtyRangeList
+    {
+        // Byte ranges [first, second) within the table
+        std::vector<std::pair<size_t, size_t>> Ranges;
+
+        // Size of the table data in the internal buffer
+        size_t UploadedSize = 0;
+
+        // Whether the entire table must be updated
+        bool All = true;
+
+        void Add(size_t Begin, size_t End)
+        {
+            if (All)
+                return;
+
+            // Records are often bound in order, so merge with the last range right away
+            if (!Ranges.empty() && Begin <= Ranges.back().second && End >= Ranges.back().first)
+            {
+                Ranges.back().first  = std::min(Ranges.back().first, Begin);
+                Ranges.back().second = std::max(Ranges.back().second, End);
+                return;
+            }
+            Ranges.emplace_back(Begin, End);
+        }
+
+        void SetAll()
+        {
+            All = true;
+            Ranges.clear();
+        }
+
+        void GetUpdateRanges(const std::vector<Uint8>&       Data,
+                             Uint32                          TableOffset,
+                             bool                            FullUpdate,
+                             std::vector<BufferUpdateRange>& UpdateRanges)
+        {
+            if (FullUpdate || All)
+            {
+                if (!Data.empty())
+                    UpdateRanges.push_back({Data.data(), TableOffset, static_cast<Uint32>(Data.size())});
+            }
+            else
+            {
+                // Records that were added to the table by resizing are not uploaded yet
+                if (Data.size() > UploadedSize)
+                    Ranges.emplace_back(UploadedSize, Data.size());
+
+                std::sort(Ranges.begin(), Ranges.end());
+
+                // Ranges separated by small gaps are merged to reduce the number of copy commands
+                constexpr size_t MaxGap = 1024;
+
+                const size_t FirstUpdate = UpdateRanges.size();
+                for (const auto& Range : Ranges)
+                {
+                    const size_t Begin = std::min(Range.first, Data.size());
+                    const size_t End   = std::min(Range.second, Data.size());
+                    if (Begin >= End)
+                        continue;
+
+                    if (UpdateRanges.size() > FirstUpdate)
+                    {
+                        auto&        Last    = UpdateRanges.back();
+                        const size_t LastEnd = Last.Offset - TableOffset + Last.Size;
+                        if (Begin <= LastEnd + MaxGap)
+                        {
+                            Last.Size = static_cast<Uint32>(std::max(LastEnd, End) - (Last.Offset - TableOffset));
+                            continue;
+                        }
+                    }
+                    UpdateRanges.push_back({Data.data() + Begin, static_cast<Uint32>(TableOffset + Begin), static_cast<Uint32>(End - Begin)});
+                }
+            }
+
+            Ranges.clear();
+            All          = false;
+            UploadedSize = Data.size();
+        }
+    };
+
     std::vector<Uint8> m_RayGenShaderRecord;
     std::vector<Uint8> m_MissShadersRecord;
     std::vector<Uint8> m_CallableShadersRecord;
     std::vector<Uint8> m_HitGroupsRecord;
 
+    DirtyRangeList m_RayGenDirty;
+    DirtyRangeList m_MissDirty;
+    DirtyRangeList m_CallableDirty;
+    DirtyRangeList m_HitGroupsDirty;
+
+    // Table offsets in the internal buffer at the time of the last update
+    Uint32 m_UploadedMissOffset     = ~0u;
+    Uint32 m_UploadedHitGroupOffset = ~0u;
+    Uint32 m_UploadedCallableOffset = ~0u;
+
     RefCntAutoPtr<PipelineStateImplType> m_pPSO;
     RefCntAutoPtr<BufferImplType>        m_pBuffer;
 
@@ -539,6 +636,60 @@ protected:
 #endif
 
 private:
+    void BindHitGroupForInstanceImpl(TopLevelASImplType*     pTLASImpl,
+                                     const TLASInstanceDesc& Desc,
+                                     Uint32                  RayOffsetInHitGroupIndex,
+                                     const char*             pShaderGroupName,
+                                     const void*             pData,
+                                     Uint32                  DataSize)
+    {
+        VERIFY_EXPR((pData == nullptr) == (DataSize == 0));
+        VERIFY_EXPR((pData == nullptr) || (DataSize == this->m_ShaderRecordSize));
+
+        const auto Info = pTLASImpl->GetBuildInfo();
+
+        VERIFY_EXPR(Info.BindingMode == HIT_GROUP_BINDING_MODE_PER_GEOMETRY ||
+                    Info.BindingMode == HIT_GROUP_BINDING_MODE_PER_INSTANCE);
+        VERIFY_EXPR(RayOffsetInHitGroupIndex < Info.HitGroupStride);
+        VERIFY_EXPR(Desc.ContributionToHitGroupIndex != INVALID_INDEX);
+        VERIFY_EXPR(Desc.pBLAS != nullptr);
+
+        const Uint32 InstanceOffset = Desc.ContributionToHitGroupIndex;
+        Uint32       GeometryCount  = 0;
+
+        switch (Info.BindingMode)
+        {
+            // clang-format off
+            case HIT_GROUP_BINDING_MODE_PER_GEOMETRY:     GeometryCount = Desc.pBLAS->GetActualGeometryCount(); break;
+            case HIT_GROUP_BINDING_MODE_PER_INSTANCE:     GeometryCount = 1;                                    break;
+            default:                                      UNEXPECTED("unknown binding mode");
+                // clang-format on
+        }
+
+        const Uint32 BeginIndex = InstanceOffset;
+        const size_t EndIndex   = InstanceOffset + size_t{GeometryCount} * size_t{Info.HitGroupStride};
+        const Uint32 GroupSize  = this->GetDevice()->GetAdapterInfo().RayTracing.ShaderGroupHandleSize;
+        const size_t Stride     = this->m_ShaderRecordStride;
+
+        this->m_HitGroupsRecord.resize(std::max(this->m_HitGroupsRecord.size(), EndIndex * Stride), Uint8{EmptyElem});
+        this->m_HitGroupsDirty.Add((size_t{BeginIndex} + RayOffsetInHitGroupIndex) * Stride, EndIndex * Stride);
+        this->m_Changed = true;
+
+        for (Uint32 i = 0; i < GeometryCount; ++i)
+        {
+            Uint32 Index  = BeginIndex + i * Info.HitGroupStride + RayOffsetInHitGroupIndex;
+            size_t Offset = Index * Stride;
+            this->m_pPSO->CopyShaderHandle(pShaderGroupName, this->m_HitGroupsRecord.data() + Offset, Stride);
+
+            std::memcpy(this->m_HitGroupsRecord.data() + Offset + GroupSize, pData, DataSize);
+
+#ifdef DILIGENT_DEVELOPMENT
+            VERIFY_EXPR(Index >= Info.FirstContributionToHitGroupIndex && Index <= Info.LastContributionToHitGroupIndex);
+            OnBindHitGroup(pTLASImpl, Index);
+#endif
+        }
+    }
+
 #ifdef DILIGENT_DEVELOPMENT
     struct HitGroupBinding
     {
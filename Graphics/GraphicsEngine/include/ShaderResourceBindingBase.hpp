@@ -235,6 +235,27 @@ public:
         return m_pShaderVarMgrs[MgrInd].GetVariable(Index);
     }
 
+    /// Implementation of IShaderResourceBinding::SetVariables().
+    virtual void DILIGENT_CALL_TYPE SetVariables(const ShaderVariableUpdate* pUpdates, Uint32 NumUpdates) override final
+    {
+        DEV_CHECK_ERR(pUpdates != nullptr || NumUpdates == 0, "pUpdates must not be null when NumUpdates is not zero");
+
+        m_ShaderResourceCache.BeginBulkUpdate();
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+        {
+            const ShaderVariableUpdate& Update = pUpdates[i];
+
+            IShaderResourceVariable* const pVar = Update.Name != nullptr ?
+                GetVariableByName(Update.ShaderType, Update.Name) :
+                GetVariableByIndex(Update.ShaderType, Update.VariableIndex);
+            if (pVar == nullptr)
+                continue;
+
+            pVar->SetArray(Update.ppObjects, Update.FirstElement, Update.NumElements, Update.Flags);
+        }
+        m_ShaderResourceCache.EndBulkUpdate();
+    }
+
     /// Implementation of IShaderResourceBinding::BindResources().
     virtual void DILIGENT_CALL_TYPE BindResources(SHADER_TYPE                 ShaderStages,
                                                   IResourceMapping*           pResMapping,
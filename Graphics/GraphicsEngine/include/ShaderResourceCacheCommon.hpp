@@ -31,8 +31,11 @@
 /// Definition of the common share resource cache constants
 
 #include <atomic>
+#include <vector>
 
 #include "BasicTypes.h"
+#include "Buffer.h"
+#include "RefCntAutoPtr.hpp"
 
 namespace Diligent
 {
@@ -50,6 +53,42 @@ enum class ResourceCacheContentType : Uint8
 class ShaderResourceCacheBase
 {
 public:
+    // Called by IShaderResourceBinding::SetVariables() before and after a batch of resource updates.
+    // Backends that can combine descriptor writes hide these methods.
+    void BeginBulkUpdate() {}
+    void EndBulkUpdate() {}
+
+    // Constants set through IShaderResourceVariable::SetInlineConstants() and the dynamic
+    // buffer that is bound to the variable. The constants are uploaded when the SRB is committed.
+    struct InlineConstantsData
+    {
+        Uint32                 ResIndex = ~0u;
+        RefCntAutoPtr<IBuffer> pBuffer;
+        std::vector<Uint32>    Constants;
+    };
+
+    InlineConstantsData* FindInlineConstants(Uint32 ResIndex)
+    {
+        for (auto& Data : m_InlineConstants)
+        {
+            if (Data.ResIndex == ResIndex)
+                return &Data;
+        }
+        return nullptr;
+    }
+
+    InlineConstantsData& AddInlineConstants(Uint32 ResIndex, RefCntAutoPtr<IBuffer> pBuffer)
+    {
+        VERIFY(FindInlineConstants(ResIndex) == nullptr, "Inline constants for resource ", ResIndex, " have already been added");
+        m_InlineConstants.emplace_back();
+        auto& Data    = m_InlineConstants.back();
+        Data.ResIndex = ResIndex;
+        Data.pBuffer  = std::move(pBuffer);
+        return Data;
+    }
+
+    const std::vector<InlineConstantsData>& GetInlineConstants() const { return m_InlineConstants; }
+
 #ifdef DILIGENT_DEVELOPMENT
     uint32_t DvpGetRevision() const
     {
@@ -68,6 +107,9 @@ protected:
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<uint32_t> m_DvpRevision{0};
 #endif
+
+private:
+    std::vector<InlineConstantsData> m_InlineConstants;
 };
 
 } // namespace Diligent
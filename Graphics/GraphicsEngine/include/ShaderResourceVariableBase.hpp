@@ -31,12 +31,14 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
 #include "StringTools.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ShaderResourceCacheCommon.hpp"
+#include "ResourceBindingPlan.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
 
@@ -712,6 +714,55 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         static_cast<ThisImplType*>(this)->SetDynamicOffset(ArrayIndex, Offset);
     }
 
+    virtual void DILIGENT_CALL_TYPE SetInlineConstants(const void* pConstants,
+                                                       Uint32      FirstConstant,
+                                                       Uint32      NumConstants) override final
+    {
+        const auto& Desc = GetDesc();
+        if ((Desc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) == 0)
+        {
+            DEV_ERROR("SetInlineConstants() is only allowed for variables created with PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag. '",
+                      Desc.Name, "' is not such a variable.");
+            return;
+        }
+        if (FirstConstant + NumConstants > MAX_INLINE_CONSTANTS)
+        {
+            DEV_ERROR("Inline constant range (", FirstConstant, " .. ", FirstConstant + NumConstants - 1, ") of variable '", Desc.Name,
+                      "' exceeds the maximum number of inline constants (", MAX_INLINE_CONSTANTS, ").");
+            return;
+        }
+        DEV_CHECK_ERR(pConstants != nullptr || NumConstants == 0, "pConstants must not be null");
+        VERIFY(Desc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_STATIC, "Static inline constants should've been rejected by ValidatePipelineResourceSignatureDesc()");
+
+        auto& ResourceCache = m_ParentManager.GetResourceCache();
+        auto* pData         = ResourceCache.FindInlineConstants(m_ResIndex);
+        if (pData == nullptr)
+        {
+            // The buffer is created and bound when the constants are set for the first time
+            BufferDesc BuffDesc;
+            BuffDesc.Name           = "Inline constants buffer";
+            BuffDesc.Size           = MAX_INLINE_CONSTANTS * sizeof(Uint32);
+            BuffDesc.Usage          = USAGE_DYNAMIC;
+            BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+            BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+            RefCntAutoPtr<IBuffer> pBuffer;
+            m_ParentManager.GetSignature()->GetDevice()->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+            if (!pBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create inline constants buffer for variable '", Desc.Name, "'.");
+                return;
+            }
+            static_cast<ThisImplType*>(this)->BindResource(BindResourceInfo{pBuffer, SET_SHADER_RESOURCE_FLAG_NONE});
+            pData = &ResourceCache.AddInlineConstants(m_ResIndex, std::move(pBuffer));
+        }
+
+        if (pData->Constants.size() < FirstConstant + NumConstants)
+            pData->Constants.resize(FirstConstant + NumConstants);
+        if (NumConstants > 0)
+            memcpy(&pData->Constants[FirstConstant], pConstants, NumConstants * sizeof(Uint32));
+    }
+
 
     virtual SHADER_RESOURCE_VARIABLE_TYPE DILIGENT_CALL_TYPE GetType() const override final
     {
@@ -731,11 +782,15 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
         return m_ParentManager.GetVariableIndex(*static_cast<const ThisImplType*>(this));
     }
 
-    void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+    // Binds resources resolved from the resource mapping through the binding plan.
+    void BindResources(ResourceBindingPlan& Plan, BIND_SHADER_RESOURCES_FLAGS Flags)
     {
         auto* const pThis   = static_cast<ThisImplType*>(this);
         const auto& ResDesc = pThis->GetDesc();
 
+        // Resolve the variable even if it is skipped to keep the plan layout independent of the flags.
+        IDeviceObject* const* ppObjects = Plan.Resolve(ResDesc.Name, ResDesc.ArraySize);
+
         if ((Flags & (1u << ResDesc.VarType)) == 0)
             return;
 
@@ -744,7 +799,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
             if ((Flags & BIND_SHADER_RESOURCES_KEEP_EXISTING) != 0 && pThis->Get(ArrInd) != nullptr)
                 continue;
 
-            if (auto* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+            if (auto* pObj = ppObjects[ArrInd])
             {
                 const auto SetResFlags = (Flags & BIND_SHADER_RESOURCES_ALLOW_OVERWRITE) != 0 ?
                     SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE :
@@ -804,6 +859,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -815,10 +872,15 @@ protected:
 template <class EngineImplTraits, typename VariableType>
 class ShaderVariableManagerBase
 {
-protected:
+public:
     using ShaderResourceCacheType       = typename EngineImplTraits::ShaderResourceCacheImplType;
     using PipelineResourceSignatureType = typename EngineImplTraits::PipelineResourceSignatureImplType;
-    using ThisImplType                  = typename EngineImplTraits::ShaderVariableManagerImplType;
+
+    ShaderResourceCacheType&             GetResourceCache() const { return m_ResourceCache; }
+    const PipelineResourceSignatureType* GetSignature() const { return m_pSignature; }
+
+protected:
+    using ThisImplType = typename EngineImplTraits::ShaderVariableManagerImplType;
 
     ShaderVariableManagerBase(IObject&                 Owner,
                               ShaderResourceCacheType& ResourceCache) noexcept :
@@ -831,10 +893,11 @@ protected:
         VERIFY(m_pVariables == nullptr, "Destroy() has not been called. The shader variable memory will leak.");
     }
 
-    void Initialize(const PipelineResourceSignatureType& Signature, IMemoryAllocator& Allocator, size_t Size)
+    void Initialize(const PipelineResourceSignatureType& Signature, IMemoryAllocator& Allocator, size_t Size, SHADER_TYPE ShaderType)
     {
         VERIFY_EXPR(m_pSignature == nullptr);
         m_pSignature = &Signature;
+        m_ShaderType = ShaderType;
 
         if (Size > 0)
         {
@@ -867,10 +930,12 @@ protected:
         if ((Flags & BIND_SHADER_RESOURCES_UPDATE_ALL) == 0)
             Flags |= BIND_SHADER_RESOURCES_UPDATE_ALL;
 
+        m_BindingPlan.Begin(pResourceMapping);
         for (Uint32 v = 0; v < static_cast<ThisImplType*>(this)->m_NumVariables; ++v)
         {
-            m_pVariables[v].BindResources(pResourceMapping, Flags);
+            m_pVariables[v].BindResources(m_BindingPlan, Flags);
         }
+        m_BindingPlan.End();
     }
 
     void CheckResources(IResourceMapping*                    pResourceMapping,
@@ -892,6 +957,26 @@ protected:
 
 
 protected:
+    // Returns the index of the resource with the given name in the signature, or ~0u
+    // if there is no such resource in the shader stage of this manager.
+    Uint32 FindResourceIndex(const Char* Name) const
+    {
+        return m_pSignature != nullptr ? m_pSignature->FindResource(m_ShaderType, Name) : ~0u;
+    }
+
+    // Finds the variable that references the resource with the given index.
+    // Variables are created in the order of signature resources, so the array is sorted by resource index.
+    template <typename VarType>
+    static VarType* FindVariableByResIndex(VarType* pVariables, Uint32 NumVariables, Uint32 ResIndex)
+    {
+        VarType* const pEnd = pVariables + NumVariables;
+        VarType* const pVar = std::lower_bound(pVariables, pEnd, ResIndex,
+                                               [](const VarType& Var, Uint32 Idx) {
+                                                   return Var.GetResIndex() < Idx;
+                                               });
+        return (pVar != pEnd && pVar->GetResIndex() == ResIndex) ? pVar : nullptr;
+    }
+
     IObject& m_Owner;
 
     // Variable manager is owned by either Pipeline Resource Signature (in which case m_ResourceCache references
@@ -907,6 +992,12 @@ protected:
     // shader resource bindings reside in continuous memory. If allocation granularity == 1, raw allocator is used.
     VariableType* m_pVariables = nullptr;
 
+    // Shader stage of the variables in this manager.
+    SHADER_TYPE m_ShaderType = SHADER_TYPE_UNKNOWN;
+
+    // Resources resolved from the last resource mapping passed to BindResources().
+    ResourceBindingPlan m_BindingPlan;
+
 private:
 #ifdef DILIGENT_DEBUG
     // Memory allocator that was used to allocate memory for m_pVariables (for debug purposes only).
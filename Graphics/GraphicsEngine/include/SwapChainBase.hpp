@@ -30,6 +30,8 @@
 /// \file
 /// Implementation of the Diligent::SwapChainBase template class
 
+#include <algorithm>
+
 #include "RenderDevice.h"
 #include "DeviceContext.h"
 #include "SwapChain.h"
@@ -95,7 +97,33 @@ public:
     virtual void DILIGENT_CALL_TYPE SetMaximumFrameLatency(Uint32 MaxLatency) override
     {}
 
+    /// Implementation of ISwapChain::GetStats()
+    virtual const SwapChainStats& DILIGENT_CALL_TYPE GetStats() const override final
+    {
+        return m_Stats;
+    }
+
 protected:
+    /// Returns the maximum number of frames that the application is allowed to queue for presentation.
+    Uint32 GetMaxFrameLatency() const
+    {
+        return m_SwapChainDesc.MaxFrameLatency != 0 ? m_SwapChainDesc.MaxFrameLatency : m_SwapChainDesc.BufferCount;
+    }
+
+    /// Adds the measured latency of a presented frame, in seconds, to the swap chain statistics.
+    void AddFrameLatencySample(double Latency)
+    {
+        // Smoothing factor of the exponential moving average
+        constexpr double AvgLatencyWeight = 0.1;
+
+        m_Stats.LastFrameLatency = Latency;
+        m_Stats.AvgFrameLatency  = m_Stats.NumLatencySamples > 0 ?
+            m_Stats.AvgFrameLatency + (Latency - m_Stats.AvgFrameLatency) * AvgLatencyWeight :
+            Latency;
+        m_Stats.MaxFrameLatency = std::max(m_Stats.MaxFrameLatency, Latency);
+        ++m_Stats.NumLatencySamples;
+    }
+
     bool Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform, Int32 Dummy = 0 /*To be different from virtual function*/)
     {
         if (NewWidth != 0 && NewHeight != 0 &&
@@ -125,6 +153,9 @@ protected:
 
     /// Desired surface pre-transformation.
     SURFACE_TRANSFORM m_DesiredPreTransform = SURFACE_TRANSFORM_OPTIMAL;
+
+    /// Swap chain statistics
+    SwapChainStats m_Stats;
 };
 
 } // namespace Diligent
@@ -32,6 +32,8 @@
 
 #include <memory>
 #include <array>
+#include <atomic>
+#include <mutex>
 
 #include "Texture.h"
 #include "GraphicsTypes.h"
@@ -40,6 +42,7 @@
 #include "STDAllocator.hpp"
 #include "FormatString.hpp"
 #include "PlatformMisc.hpp"
+#include "ResourceViewCache.hpp"
 
 namespace Diligent
 {
@@ -140,6 +143,14 @@ public:
 
         if ((this->m_Desc.BindFlags & BIND_INPUT_ATTACHMENT) != 0)
             this->m_Desc.BindFlags |= BIND_SHADER_RESOURCE;
+
+        // Sparse textures do not own memory
+        if (this->m_Desc.Usage != USAGE_SPARSE)
+            m_MemoryStatsSize = GetStagingTextureDataSize(this->m_Desc, 1) * std::max(this->m_Desc.SampleCount, Uint32{1});
+        this->GetDevice()->GetTextureCounter().Add(m_MemoryStatsSize);
+
+        if ((this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_CACHE_VIEWS) != 0)
+            m_pViewCache = std::make_unique<ResourceViewCache<TextureViewDesc, ITextureView>>();
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_Texture, TDeviceObjectBase)
@@ -160,25 +171,38 @@ public:
         else
             UNEXPECTED("Unexpected texture view type.");
 
-        CreateViewInternal(ViewDesc, ppView, false);
+        if (m_pViewCache)
+        {
+            m_pViewCache->GetOrCreate(ViewDesc, ppView,
+                                      [this](const TextureViewDesc& Desc, ITextureView** ppNewView) {
+                                          CreateViewInternal(Desc, ppNewView, false);
+                                      });
+        }
+        else
+        {
+            CreateViewInternal(ViewDesc, ppView, false);
+        }
     }
 
     ~TextureBase()
     {
         DestroyDefaultViews();
+        this->GetDevice()->GetTextureCounter().Remove(m_MemoryStatsSize);
     }
 
 
-    /// Creates default texture views.
+    /// Initializes default texture views.
 
     ///
-    /// - Creates default shader resource view addressing the entire texture if Diligent::BIND_SHADER_RESOURCE flag is set.
-    /// - Creates default render target view addressing the most detailed mip level if Diligent::BIND_RENDER_TARGET flag is set.
-    /// - Creates default depth-stencil view addressing the most detailed mip level if Diligent::BIND_DEPTH_STENCIL flag is set.
-    /// - Creates default unordered access view addressing the entire texture if Diligent::BIND_UNORDERED_ACCESS flag is set.
-    /// - Creates default shading rate view addressing the most detailed mip if Diligent::BIND_SHADING_RATE flag is set.
+    /// - Default shader resource view addresses the entire texture if Diligent::BIND_SHADER_RESOURCE flag is set.
+    /// - Default render target view addresses the most detailed mip level if Diligent::BIND_RENDER_TARGET flag is set.
+    /// - Default depth-stencil view addresses the most detailed mip level if Diligent::BIND_DEPTH_STENCIL flag is set.
+    /// - Default unordered access view addresses the entire texture if Diligent::BIND_UNORDERED_ACCESS flag is set.
+    /// - Default shading rate view addresses the most detailed mip if Diligent::BIND_SHADING_RATE flag is set.
     ///
-    /// The function calls CreateViewInternal().
+    /// Unless the texture is created with Diligent::MISC_TEXTURE_FLAG_EAGER_DEFAULT_VIEWS flag,
+    /// the views are created by the first GetDefaultView() call for the corresponding view type.
+    /// The views are created by CreateViewInternal().
     void CreateDefaultViews()
     {
         VERIFY(m_pDefaultViews == nullptr, "Default views have already been initialized");
@@ -199,86 +223,27 @@ public:
             m_pDefaultViews = ALLOCATE(GetRawAllocator(), "Default texture view array", TextureViewImplType*, NumDefaultViews);
             memset(m_pDefaultViews, 0, sizeof(TextureViewImplType*) * NumDefaultViews);
         }
-        auto** ppDefaultViews = GetDefaultViewsArrayPtr();
 
         Uint8 ViewIdx = 0;
-
-        auto CreateDefaultView = [&](TEXTURE_VIEW_TYPE ViewType) //
-        {
-            TextureViewDesc ViewDesc;
-            ViewDesc.ViewType = ViewType;
-
-            std::string ViewName;
-            switch (ViewType)
-            {
-                case TEXTURE_VIEW_SHADER_RESOURCE:
-                    if ((this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS) != 0)
-                        ViewDesc.Flags |= TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION;
-                    ViewName = "Default SRV of texture '";
-                    break;
-
-                case TEXTURE_VIEW_RENDER_TARGET:
-                    ViewName = "Default RTV of texture '";
-                    break;
-
-                case TEXTURE_VIEW_DEPTH_STENCIL:
-                    ViewName = "Default DSV of texture '";
-                    break;
-
-                case TEXTURE_VIEW_UNORDERED_ACCESS:
-                    ViewDesc.AccessFlags = UAV_ACCESS_FLAG_READ_WRITE;
-
-                    ViewName = "Default UAV of texture '";
-                    break;
-
-                case TEXTURE_VIEW_SHADING_RATE:
-                    ViewDesc.AccessFlags = UAV_ACCESS_FLAG_READ_WRITE;
-
-                    ViewName = "Default VRS view of texture '";
-                    break;
-
-                default:
-                    UNEXPECTED("Unexpected texture type");
-            }
-            ViewName += this->m_Desc.Name;
-            ViewName += '\'';
-            ViewDesc.Name = ViewName.c_str();
-
-            VERIFY_EXPR(ViewIdx < NumDefaultViews);
-            auto& pView = ppDefaultViews[ViewIdx];
-            CreateViewInternal(ViewDesc, reinterpret_cast<ITextureView**>(&pView), true);
-            DEV_CHECK_ERR(pView != nullptr, "Failed to create default view for texture '", this->m_Desc.Name, "'.");
-            DEV_CHECK_ERR(pView->GetDesc().ViewType == ViewType, "Unexpected view type.");
-
-            m_ViewIndices[ViewType] = ViewIdx++;
-        };
-
-        if (this->m_Desc.BindFlags & BIND_SHADER_RESOURCE)
-        {
-            CreateDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
-        }
-
-        if (this->m_Desc.BindFlags & BIND_RENDER_TARGET)
-        {
-            CreateDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-        }
-
-        if (this->m_Desc.BindFlags & BIND_DEPTH_STENCIL)
-        {
-            CreateDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
-        }
-
-        if (this->m_Desc.BindFlags & BIND_UNORDERED_ACCESS)
+        for (TEXTURE_VIEW_TYPE ViewType : {TEXTURE_VIEW_SHADER_RESOURCE,
+                                           TEXTURE_VIEW_RENDER_TARGET,
+                                           TEXTURE_VIEW_DEPTH_STENCIL,
+                                           TEXTURE_VIEW_UNORDERED_ACCESS,
+                                           TEXTURE_VIEW_SHADING_RATE})
         {
-            CreateDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS);
+            if ((this->m_Desc.BindFlags & GetDefaultViewBindFlag(ViewType)) != 0)
+                m_ViewIndices[ViewType] = ViewIdx++;
         }
+        VERIFY_EXPR(ViewIdx == NumDefaultViews);
 
-        if (this->m_Desc.BindFlags & BIND_SHADING_RATE)
+        if ((this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_EAGER_DEFAULT_VIEWS) != 0)
         {
-            CreateDefaultView(TEXTURE_VIEW_SHADING_RATE);
+            for (Uint8 ViewType = 0; ViewType < TEXTURE_VIEW_NUM_VIEWS; ++ViewType)
+            {
+                if (m_ViewIndices[ViewType] != InvalidViewIndex)
+                    CreateDefaultView(static_cast<TEXTURE_VIEW_TYPE>(ViewType));
+            }
         }
-
-        VERIFY_EXPR(ViewIdx == NumDefaultViews);
     }
 
     virtual void DILIGENT_CALL_TYPE SetState(RESOURCE_STATE State) override final
@@ -312,11 +277,18 @@ public:
     /// Implementation of ITexture::GetDefaultView().
     virtual ITextureView* DILIGENT_CALL_TYPE GetDefaultView(TEXTURE_VIEW_TYPE ViewType) override
     {
-        auto ViewIdx = m_ViewIndices[ViewType];
+        const auto ViewIdx = m_ViewIndices[ViewType];
         if (ViewIdx == InvalidViewIndex)
             return nullptr;
 
         VERIFY_EXPR(ViewIdx < GetNumDefaultViews());
+        if ((m_InitializedDefaultViews.load(std::memory_order_acquire) & (1u << ViewIdx)) == 0)
+        {
+            std::lock_guard<std::mutex> Lock{m_DefaultViewsMtx};
+            if ((m_InitializedDefaultViews.load(std::memory_order_relaxed) & (1u << ViewIdx)) == 0)
+                CreateDefaultView(ViewType);
+        }
+
         auto** ppDefaultViews = GetDefaultViewsArrayPtr();
         return ppDefaultViews[ViewIdx];
     }
@@ -331,6 +303,75 @@ public:
     }
 
 protected:
+    static BIND_FLAGS GetDefaultViewBindFlag(TEXTURE_VIEW_TYPE ViewType)
+    {
+        switch (ViewType)
+        {
+            case TEXTURE_VIEW_SHADER_RESOURCE: return BIND_SHADER_RESOURCE;
+            case TEXTURE_VIEW_RENDER_TARGET: return BIND_RENDER_TARGET;
+            case TEXTURE_VIEW_DEPTH_STENCIL: return BIND_DEPTH_STENCIL;
+            case TEXTURE_VIEW_UNORDERED_ACCESS: return BIND_UNORDERED_ACCESS;
+            case TEXTURE_VIEW_SHADING_RATE: return BIND_SHADING_RATE;
+            default: return BIND_NONE;
+        }
+    }
+
+    // Creates the default view of the given type. Must be called either from CreateDefaultViews()
+    // or with m_DefaultViewsMtx locked.
+    void CreateDefaultView(TEXTURE_VIEW_TYPE ViewType)
+    {
+        const auto ViewIdx = m_ViewIndices[ViewType];
+        VERIFY_EXPR(ViewIdx < GetNumDefaultViews());
+
+        TextureViewDesc ViewDesc;
+        ViewDesc.ViewType = ViewType;
+
+        std::string ViewName;
+        switch (ViewType)
+        {
+            case TEXTURE_VIEW_SHADER_RESOURCE:
+                if ((this->m_Desc.MiscFlags & MISC_TEXTURE_FLAG_GENERATE_MIPS) != 0)
+                    ViewDesc.Flags |= TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION;
+                ViewName = "Default SRV of texture '";
+                break;
+
+            case TEXTURE_VIEW_RENDER_TARGET:
+                ViewName = "Default RTV of texture '";
+                break;
+
+            case TEXTURE_VIEW_DEPTH_STENCIL:
+                ViewName = "Default DSV of texture '";
+                break;
+
+            case TEXTURE_VIEW_UNORDERED_ACCESS:
+                ViewDesc.AccessFlags = UAV_ACCESS_FLAG_READ_WRITE;
+
+                ViewName = "Default UAV of texture '";
+                break;
+
+            case TEXTURE_VIEW_SHADING_RATE:
+                ViewDesc.AccessFlags = UAV_ACCESS_FLAG_READ_WRITE;
+
+                ViewName = "Default VRS view of texture '";
+                break;
+
+            default:
+                UNEXPECTED("Unexpected texture type");
+        }
+        ViewName += this->m_Desc.Name;
+        ViewName += '\'';
+        ViewDesc.Name = ViewName.c_str();
+
+        auto& pView = GetDefaultViewsArrayPtr()[ViewIdx];
+        VERIFY(pView == nullptr, "Default view has already been created");
+        CreateViewInternal(ViewDesc, reinterpret_cast<ITextureView**>(&pView), true);
+        DEV_CHECK_ERR(pView != nullptr, "Failed to create default view for texture '", this->m_Desc.Name, "'.");
+        DEV_CHECK_ERR(pView == nullptr || pView->GetDesc().ViewType == ViewType, "Unexpected view type.");
+
+        // Mark the view as initialized even if the creation failed to avoid repeated attempts
+        m_InitializedDefaultViews.fetch_or(static_cast<Uint8>(1u << ViewIdx), std::memory_order_release);
+    }
+
     void DestroyDefaultViews()
     {
         if (m_pDefaultViews == nullptr)
@@ -393,9 +434,20 @@ protected:
     static constexpr Uint8                    InvalidViewIndex = 0xFFu;
     std::array<Uint8, TEXTURE_VIEW_NUM_VIEWS> m_ViewIndices{};
 
+    // Bit mask of the default views that have been created, indexed by m_ViewIndices
+    std::atomic<Uint8> m_InitializedDefaultViews{0};
+    // Protects the lazy creation of default views in GetDefaultView()
+    std::mutex m_DefaultViewsMtx;
+
     RESOURCE_STATE m_State = RESOURCE_STATE_UNKNOWN;
 
+    // The texture size reported by IRenderDevice::GetMemoryStats()
+    Uint64 m_MemoryStatsSize = 0;
+
     std::unique_ptr<SparseTextureProperties> m_pSparseProps;
+
+    // Cache of the views created by CreateView(), see MISC_TEXTURE_FLAG_CACHE_VIEWS
+    std::unique_ptr<ResourceViewCache<TextureViewDesc, ITextureView>> m_pViewCache;
 };
 
 } // namespace Diligent
@@ -31,6 +31,8 @@
 /// Implementation of the Diligent::TopLevelASBase template class
 
 #include <unordered_map>
+#include <vector>
+#include <string>
 #include <atomic>
 
 #include "TopLevelAS.h"
@@ -64,8 +66,9 @@ private:
 
     struct InstanceDesc
     {
+        // Instance name in the string pool, or null if the instance is unnamed
+        const char*                          Name                        = nullptr;
         Uint32                               ContributionToHitGroupIndex = 0;
-        Uint32                               InstanceIndex               = 0;
         RefCntAutoPtr<BottomLevelASImplType> pBLAS;
 #ifdef DILIGENT_DEVELOPMENT
         Uint32 dvpVersion = 0;
@@ -108,34 +111,45 @@ public:
         {
             ClearInstanceData();
 
-            size_t StringPoolSize = 0;
-            for (Uint32 i = 0; i < InstanceCount; ++i)
+            // Either all instances are named, or none of them are.
+            // Unnamed instances are identified by their index and are not added to the hash map.
+            const bool IsNamed = InstanceCount > 0 && pInstances[0].InstanceName != nullptr;
+            if (IsNamed)
             {
-                VERIFY_EXPR(pInstances[i].InstanceName != nullptr);
-                StringPoolSize += StringPool::GetRequiredReserveSize(pInstances[i].InstanceName);
+                size_t StringPoolSize = 0;
+                for (Uint32 i = 0; i < InstanceCount; ++i)
+                {
+                    VERIFY_EXPR(pInstances[i].InstanceName != nullptr);
+                    StringPoolSize += StringPool::GetRequiredReserveSize(pInstances[i].InstanceName);
+                }
+                this->m_StringPool.Reserve(StringPoolSize, GetRawAllocator());
+                this->m_InstanceNameToIndex.reserve(InstanceCount);
             }
-
-            this->m_StringPool.Reserve(StringPoolSize, GetRawAllocator());
+            this->m_Instances.resize(InstanceCount);
 
             Uint32 InstanceOffset = BaseContributionToHitGroupIndex;
 
             for (Uint32 i = 0; i < InstanceCount; ++i)
             {
-                const auto&  Inst     = pInstances[i];
-                const char*  NameCopy = this->m_StringPool.CopyString(Inst.InstanceName);
-                InstanceDesc Desc     = {};
+                const auto& Inst = pInstances[i];
+                auto&       Desc = this->m_Instances[i];
 
                 Desc.pBLAS                       = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
                 Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-                Desc.InstanceIndex               = i;
                 CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
 
 #ifdef DILIGENT_DEVELOPMENT
                 Desc.dvpVersion = Desc.pBLAS->DvpGetVersion();
 #endif
-                bool IsUniqueName = this->m_Instances.emplace(NameCopy, Desc).second;
-                if (!IsUniqueName)
-                    LOG_ERROR_AND_THROW("Instance name must be unique!");
+                if (IsNamed)
+                {
+                    VERIFY(Inst.InstanceName != nullptr, "Either all instances must be named, or none of them");
+                    Desc.Name = this->m_StringPool.CopyString(Inst.InstanceName);
+
+                    bool IsUniqueName = this->m_InstanceNameToIndex.emplace(Desc.Name, i).second;
+                    if (!IsUniqueName)
+                        LOG_ERROR_AND_THROW("Instance name must be unique!");
+                }
             }
 
             VERIFY_EXPR(this->m_StringPool.GetRemainingSize() == 0);
@@ -163,13 +177,21 @@ public:
         }
     }
 
+    /// Updates the instances of the previous build.
+
+    /// Named instances are matched by name. Unnamed instances are matched by index:
+    /// pInstances[i] updates the instance FirstInstanceIndex + i. If only a subrange of
+    /// instances is updated, instances with TLAS_INSTANCE_OFFSET_AUTO keep their hit group
+    /// contributions, and the hit group layout of the TLAS remains unchanged.
     bool UpdateInstances(const TLASBuildInstanceData* pInstances,
                          const Uint32                 InstanceCount,
+                         const Uint32                 FirstInstanceIndex,
                          const Uint32                 BaseContributionToHitGroupIndex,
                          const Uint32                 HitGroupStride,
                          const HIT_GROUP_BINDING_MODE BindingMode) noexcept
     {
-        VERIFY_EXPR(this->m_BuildInfo.InstanceCount == InstanceCount);
+        VERIFY_EXPR(FirstInstanceIndex + InstanceCount <= this->m_BuildInfo.InstanceCount);
+        const bool IsPartialUpdate = FirstInstanceIndex != 0 || InstanceCount != this->m_BuildInfo.InstanceCount;
 #ifdef DILIGENT_DEVELOPMENT
         bool Changed = false;
 #endif
@@ -177,23 +199,24 @@ public:
 
         for (Uint32 i = 0; i < InstanceCount; ++i)
         {
-            const auto& Inst = pInstances[i];
-            auto        Iter = this->m_Instances.find(Inst.InstanceName);
-
-            if (Iter == this->m_Instances.end())
+            const auto&  Inst      = pInstances[i];
+            const Uint32 InstIndex = FindInstanceIndex(Inst, FirstInstanceIndex + i);
+            if (InstIndex == INVALID_INDEX)
             {
                 UNEXPECTED("Failed to find instance with name '", Inst.InstanceName, "' in instances from the previous build");
                 return false;
             }
 
-            auto&      Desc      = Iter->second;
+            auto&      Desc      = this->m_Instances[InstIndex];
             const auto PrevIndex = Desc.ContributionToHitGroupIndex;
             const auto pPrevBLAS = Desc.pBLAS;
 
             Desc.pBLAS                       = ClassPtrCast<BottomLevelASImplType>(Inst.pBLAS);
             Desc.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-            //Desc.InstanceIndex             = i; // keep Desc.InstanceIndex unmodified
-            CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
+            if (IsPartialUpdate && Desc.ContributionToHitGroupIndex == TLAS_INSTANCE_OFFSET_AUTO)
+                Desc.ContributionToHitGroupIndex = PrevIndex;
+            else
+                CalculateHitGroupIndex(Desc, InstanceOffset, HitGroupStride, BindingMode);
 
 #ifdef DILIGENT_DEVELOPMENT
             Changed         = Changed || (pPrevBLAS != Desc.pBLAS);
@@ -202,6 +225,17 @@ public:
 #endif
         }
 
+        if (IsPartialUpdate)
+        {
+            VERIFY(this->m_BuildInfo.HitGroupStride == HitGroupStride && this->m_BuildInfo.BindingMode == BindingMode,
+                   "Partial update must not change the hit group binding");
+#ifdef DILIGENT_DEVELOPMENT
+            if (Changed)
+                this->m_DvpVersion.fetch_add(1);
+#endif
+            return true;
+        }
+
         InstanceOffset = InstanceOffset + (BindingMode == HIT_GROUP_BINDING_MODE_PER_TLAS ? HitGroupStride : 0) - 1;
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -226,11 +260,17 @@ public:
 
         this->m_StringPool.Reserve(Src.m_StringPool.GetReservedSize(), GetRawAllocator());
         this->m_BuildInfo = Src.m_BuildInfo;
+        this->m_Instances = Src.m_Instances;
+        this->m_InstanceNameToIndex.reserve(Src.m_InstanceNameToIndex.size());
 
-        for (auto& SrcInst : Src.m_Instances)
+        for (Uint32 i = 0; i < this->m_Instances.size(); ++i)
         {
-            const char* NameCopy = this->m_StringPool.CopyString(SrcInst.first.GetStr());
-            this->m_Instances.emplace(NameCopy, SrcInst.second);
+            auto& Inst = this->m_Instances[i];
+            if (Inst.Name != nullptr)
+            {
+                Inst.Name = this->m_StringPool.CopyString(Inst.Name);
+                this->m_InstanceNameToIndex.emplace(Inst.Name, i);
+            }
         }
 
         VERIFY_EXPR(this->m_StringPool.GetRemainingSize() == 0);
@@ -240,28 +280,54 @@ public:
 #endif
     }
 
+    /// Returns the index of the instance that is identified by Inst. Named instances are
+    /// looked up by name; for unnamed instances, DefaultIndex is returned.
+    Uint32 FindInstanceIndex(const TLASBuildInstanceData& Inst, Uint32 DefaultIndex) const
+    {
+        if (Inst.InstanceName == nullptr)
+            return DefaultIndex < this->m_Instances.size() ? DefaultIndex : INVALID_INDEX;
+
+        auto Iter = this->m_InstanceNameToIndex.find(Inst.InstanceName);
+        return Iter != this->m_InstanceNameToIndex.end() ? Iter->second : INVALID_INDEX;
+    }
+
+    Uint32 GetInstanceContributionToHitGroupIndex(Uint32 InstanceIndex) const
+    {
+        VERIFY_EXPR(InstanceIndex < this->m_Instances.size());
+        return this->m_Instances[InstanceIndex].ContributionToHitGroupIndex;
+    }
+
     /// Implementation of ITopLevelAS::GetInstanceDesc().
     virtual TLASInstanceDesc DILIGENT_CALL_TYPE GetInstanceDesc(const char* Name) const override final
     {
         VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
 
-        TLASInstanceDesc Result = {};
+        auto Iter = this->m_InstanceNameToIndex.find(Name);
+        if (Iter == this->m_InstanceNameToIndex.end())
+        {
+            LOG_ERROR_MESSAGE("Can't find instance with the specified name ('", Name, "')");
+            return GetInstanceDescByIndex(INVALID_INDEX);
+        }
+
+        return GetInstanceDescByIndex(Iter->second);
+    }
 
-        auto Iter = this->m_Instances.find(Name);
-        if (Iter != this->m_Instances.end())
+    /// Implementation of ITopLevelAS::GetInstanceDescByIndex().
+    virtual TLASInstanceDesc DILIGENT_CALL_TYPE GetInstanceDescByIndex(Uint32 InstanceIndex) const override final
+    {
+        TLASInstanceDesc Result = {};
+        if (InstanceIndex < this->m_Instances.size())
         {
-            const auto& Inst                   = Iter->second;
+            const auto& Inst                   = this->m_Instances[InstanceIndex];
             Result.ContributionToHitGroupIndex = Inst.ContributionToHitGroupIndex;
-            Result.InstanceIndex               = Inst.InstanceIndex;
+            Result.InstanceIndex               = InstanceIndex;
             Result.pBLAS                       = Inst.pBLAS;
         }
         else
         {
             Result.ContributionToHitGroupIndex = INVALID_INDEX;
             Result.InstanceIndex               = INVALID_INDEX;
-            LOG_ERROR_MESSAGE("Can't find instance with the specified name ('", Name, "')");
         }
-
         return Result;
     }
 
@@ -315,20 +381,20 @@ public:
         }
 
         // Validate instances
-        for (const auto& NameAndInst : this->m_Instances)
+        for (Uint32 i = 0; i < this->m_Instances.size(); ++i)
         {
-            const InstanceDesc& Inst = NameAndInst.second;
+            const InstanceDesc& Inst = this->m_Instances[i];
 
             if (Inst.dvpVersion != Inst.pBLAS->DvpGetVersion())
             {
-                LOG_ERROR_MESSAGE("Instance with name '", NameAndInst.first.GetStr(), "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
+                LOG_ERROR_MESSAGE("Instance ", GetInstanceDisplayName(i), " contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
                                   "' that was changed after TLAS build, you must rebuild TLAS");
                 result = false;
             }
 
             if (Inst.pBLAS->IsInKnownState() && Inst.pBLAS->GetState() != RESOURCE_STATE_BUILD_AS_READ)
             {
-                LOG_ERROR_MESSAGE("Instance with name '", NameAndInst.first.GetStr(), "' contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
+                LOG_ERROR_MESSAGE("Instance ", GetInstanceDisplayName(i), " contains BLAS with name '", Inst.pBLAS->GetDesc().Name,
                                   "' that must be in BUILD_AS_READ state, but current state is ",
                                   GetResourceStateFlagString(Inst.pBLAS->GetState()));
                 result = false;
@@ -341,12 +407,20 @@ public:
     {
         return this->m_DvpVersion.load();
     }
+
+private:
+    std::string GetInstanceDisplayName(Uint32 InstanceIndex) const
+    {
+        const char* Name = this->m_Instances[InstanceIndex].Name;
+        return Name != nullptr ? std::string{"with name '"} + Name + "'" : std::string{"with index "} + std::to_string(InstanceIndex);
+    }
 #endif // DILIGENT_DEVELOPMENT
 
 private:
     void ClearInstanceData()
     {
         this->m_Instances.clear();
+        this->m_InstanceNameToIndex.clear();
         this->m_StringPool.Clear();
 
         this->m_BuildInfo.BindingMode                      = HIT_GROUP_BINDING_MODE_LAST;
@@ -387,7 +461,10 @@ protected:
     TLASBuildInfo      m_BuildInfo;
     ScratchBufferSizes m_ScratchSize;
 
-    std::unordered_map<HashMapStringKey, InstanceDesc> m_Instances;
+    // Instances in the order of the instance buffer
+    std::vector<InstanceDesc> m_Instances;
+    // Maps instance names to indices. Empty if instances are unnamed.
+    std::unordered_map<HashMapStringKey, Uint32> m_InstanceNameToIndex;
 
     StringPool m_StringPool;
 
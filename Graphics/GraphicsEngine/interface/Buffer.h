@@ -78,6 +78,40 @@ DILIGENT_TYPED_ENUM(MISC_BUFFER_FLAGS, Uint8)
     /// For a sparse buffer, allow binding the same memory region in different buffer ranges
     /// or in different sparse buffers.
     MISC_BUFFER_FLAG_SPARSE_ALIASING = 1u << 0,
+
+    /// A dynamic buffer may stay mapped while the GPU accesses its contents.
+
+    /// Direct3D12 and Vulkan dynamic buffers always allow this.
+    /// In OpenGL, the buffer storage is created with glBufferStorage and mapped once with
+    /// GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT. If buffer storage is not supported,
+    /// the flag is removed from the buffer description. Other backends ignore the flag.
+    ///
+    /// \remarks   In OpenGL, mapping a persistently mapped buffer with MAP_FLAG_DISCARD waits
+    ///            until the GPU finishes all commands that were issued before the buffer was
+    ///            last unmapped, since the data can't be moved to a new memory location.
+    MISC_BUFFER_FLAG_PERSISTENT_MAP = 1u << 1,
+
+    /// A default buffer is frequently updated with IDeviceContext::UpdateBuffer and the
+    /// data may be written to the buffer memory directly by the CPU.
+
+    /// In Vulkan, the buffer is placed in device-local host-visible memory when the device
+    /// exposes such memory in a large heap (resizable BAR or unified memory architecture).
+    /// In Direct3D12, the buffer is placed in the D3D12_HEAP_TYPE_GPU_UPLOAD heap when the
+    /// device supports it. UpdateBuffer then copies the data to the buffer memory immediately
+    /// instead of staging it in the upload heap and recording a GPU copy. If no suitable memory
+    /// is available, the flag is removed from the buffer description. Other backends
+    /// ignore the flag.
+    ///
+    /// \remarks   Since the data is written when UpdateBuffer is called, the application
+    ///            must make sure that the updated region is not accessed by the GPU commands
+    ///            that have been recorded but not yet completed, similar to MAP_FLAG_NO_OVERWRITE.
+    MISC_BUFFER_FLAG_DIRECT_UPDATES = 1u << 2,
+
+    /// IBuffer::CreateView() returns the existing view if a view with the same
+    /// description (ignoring the name) has been created before and is still alive.
+
+    /// \note  The buffer holds weak references to the views, see MISC_TEXTURE_FLAG_CACHE_VIEWS.
+    MISC_BUFFER_FLAG_CACHE_VIEWS = 1u << 3,
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_BUFFER_FLAGS)
 
@@ -62,6 +62,10 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 /// Bit shift for the the shading X-axis rate.
 #define DILIGENT_SHADING_RATE_X_SHIFT 2
 
+/// The maximum number of 32-bit inline constants in one constant buffer.
+/// D3D12 root signature is limited to 64 DWORDs.
+#define DILIGENT_MAX_INLINE_CONSTANTS 64
+
 static DILIGENT_CONSTEXPR Uint32 MAX_BUFFER_SLOTS        = DILIGENT_MAX_BUFFER_SLOTS;
 static DILIGENT_CONSTEXPR Uint32 MAX_RENDER_TARGETS      = DILIGENT_MAX_RENDER_TARGETS;
 static DILIGENT_CONSTEXPR Uint32 MAX_VIEWPORTS           = DILIGENT_MAX_VIEWPORTS;
@@ -71,5 +75,6 @@ static DILIGENT_CONSTEXPR Uint32 DEFAULT_ADAPTER_ID      = DILIGENT_DEFAULT_ADAP
 static DILIGENT_CONSTEXPR Uint8  DEFAULT_QUEUE_ID        = DILIGENT_DEFAULT_QUEUE_ID;
 static DILIGENT_CONSTEXPR Uint32 MAX_SHADING_RATES       = DILIGENT_MAX_SHADING_RATES;
 static DILIGENT_CONSTEXPR Uint32 SHADING_RATE_X_SHIFT    = DILIGENT_SHADING_RATE_X_SHIFT;
+static DILIGENT_CONSTEXPR Uint32 MAX_INLINE_CONSTANTS    = DILIGENT_MAX_INLINE_CONSTANTS;
 
 DILIGENT_END_NAMESPACE // namespace Diligent
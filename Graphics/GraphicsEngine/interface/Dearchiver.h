@@ -233,6 +233,11 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
     ///             to the pArchive data blob. It will be kept alive until the dearchiver object
     ///             is released or the Reset() method is called.
     ///
+    /// \note       To avoid reading the entire archive into memory, load it from a data blob
+    ///             backed by a memory-mapped file (see Diligent::MappedFileDataBlob) without
+    ///             making a copy. Only the parts of the archive that are unpacked will then be
+    ///             paged in.
+    ///
     /// \warning    If the archive was loaded without making a copy, the application
     ///             must not modify its contents while it is in use by the dearchiver.
     /// 
@@ -271,6 +276,34 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks multiple pipeline state objects from the device object archive.
+
+    /// \param [in]  pUnpackInfos - A pointer to the array of NumPipelines pipeline state unpack infos,
+    ///                             see Diligent::PipelineStateUnpackInfo.
+    /// \param [in]  NumPipelines - The number of pipeline states to unpack.
+    /// \param [out] ppPSOs       - A pointer to the array of NumPipelines elements where pointers to the
+    ///                             unpacked pipeline state objects will be stored.
+    ///                             The function calls AddRef() for every object, so that each PSO will have
+    ///                             one reference. If a pipeline state fails to unpack, the corresponding
+    ///                             element is set to null.
+    /// \param [in]  Asynchronous - Whether to create pipeline states asynchronously
+    ///                             (see Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS). In this case, the method
+    ///                             returns without waiting for the pipelines to be compiled, and the application
+    ///                             should use IPipelineState::GetStatus() to check if they are ready.
+    ///
+    /// \remarks    Resource signatures and render passes used by the pipelines are unpacked once
+    ///             and shared by all pipeline states in the batch. Pipeline states are then unpacked
+    ///             in parallel using the thread pool specified by DearchiverCreateInfo::pThreadPool or,
+    ///             if it is null, by the shader compilation thread pool of the device.
+    ///             If no thread pool is available, the pipelines are unpacked sequentially.
+    ///
+    ///             This method is thread-safe.
+    VIRTUAL void METHOD(UnpackPipelineStates)(THIS_
+                                              const PipelineStateUnpackInfo* pUnpackInfos,
+                                              Uint32                         NumPipelines,
+                                              IPipelineState**               ppPSOs,
+                                              Bool                           Asynchronous DEFAULT_VALUE(False)) PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -328,6 +361,7 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
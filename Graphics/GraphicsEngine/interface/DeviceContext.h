@@ -1071,6 +1071,48 @@ struct Rect
 typedef struct Rect Rect;
 
 
+/// Describes the dynamic render state.
+
+/// This structure is used by IDeviceContext::SetDynamicRenderState().
+/// Only the states marked as dynamic by GraphicsPipelineDesc::DynamicStateFlags of
+/// the bound pipeline are used, other members are ignored.
+struct DynamicRenderState
+{
+    /// Cull mode, see RasterizerStateDesc::CullMode.
+    /// Used if the pipeline was created with Diligent::PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE.
+    CULL_MODE             CullMode              DEFAULT_INITIALIZER(CULL_MODE_BACK);
+
+    /// Front face orientation, see RasterizerStateDesc::FrontCounterClockwise.
+    /// Used if the pipeline was created with Diligent::PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE.
+    Bool                  FrontCounterClockwise DEFAULT_INITIALIZER(False);
+
+    /// Primitive topology, see GraphicsPipelineDesc::PrimitiveTopology.
+    /// Used if the pipeline was created with Diligent::PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY.
+    PRIMITIVE_TOPOLOGY    PrimitiveTopology     DEFAULT_INITIALIZER(PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+
+    /// Depth-stencil state.
+    /// Depth members are used if the pipeline was created with Diligent::PIPELINE_DYNAMIC_STATE_FLAG_DEPTH.
+    /// Stencil members are used if the pipeline was created with Diligent::PIPELINE_DYNAMIC_STATE_FLAG_STENCIL.
+    DepthStencilStateDesc DepthStencilDesc;
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr bool operator == (const DynamicRenderState& RHS) const
+    {
+        return CullMode              == RHS.CullMode              &&
+               FrontCounterClockwise == RHS.FrontCounterClockwise &&
+               PrimitiveTopology     == RHS.PrimitiveTopology     &&
+               DepthStencilDesc      == RHS.DepthStencilDesc;
+    }
+
+    constexpr bool operator != (const DynamicRenderState& RHS) const
+    {
+        return !(*this == RHS);
+    }
+#endif
+};
+typedef struct DynamicRenderState DynamicRenderState;
+
+
 /// Defines copy texture command attributes.
 
 /// This structure is used by IDeviceContext::CopyTexture().
@@ -1212,6 +1254,58 @@ struct BeginRenderPassAttribs
 typedef struct BeginRenderPassAttribs BeginRenderPassAttribs;
 
 
+/// Conditional rendering flags that are used in IDeviceContext::BeginConditionalRendering().
+DILIGENT_TYPED_ENUM(CONDITIONAL_RENDERING_FLAGS, Uint8)
+{
+    /// No flags.
+    CONDITIONAL_RENDERING_FLAG_NONE     = 0,
+
+    /// Invert the predicate: commands are discarded when the predicate value is non-zero.
+    CONDITIONAL_RENDERING_FLAG_INVERTED = 1u << 0,
+
+    CONDITIONAL_RENDERING_FLAG_LAST = CONDITIONAL_RENDERING_FLAG_INVERTED
+};
+DEFINE_FLAG_ENUM_OPERATORS(CONDITIONAL_RENDERING_FLAGS)
+
+
+/// BeginConditionalRendering command attributes.
+
+/// This structure is used by IDeviceContext::BeginConditionalRendering().
+///
+/// Exactly one of pBuffer or pQuery must be specified:
+/// - Direct3D12 and Vulkan only support buffer predicates.
+/// - OpenGL only supports occlusion query predicates.
+struct BeginConditionalRenderingAttribs
+{
+    /// Buffer that contains the predicate value.
+
+    /// The buffer must be created with BIND_INDIRECT_DRAW_ARGS flag.
+    /// Commands are discarded when the value at Offset is zero.
+    /// Direct3D12 reads 64-bit value while Vulkan reads 32-bit value, so
+    /// the application should write 64-bit values, for example by
+    /// resolving query results with IDeviceContext::ResolveQueries().
+    IBuffer* pBuffer DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset to the predicate value in the buffer. Must be a multiple of 8.
+    Uint64 Offset DEFAULT_INITIALIZER(0);
+
+    /// Occlusion or binary occlusion query whose result is used as the predicate.
+
+    /// The query must have ended before the conditional rendering begins.
+    /// Commands are discarded when no samples have passed.
+    IQuery* pQuery DEFAULT_INITIALIZER(nullptr);
+
+    /// Conditional rendering flags, see Diligent::CONDITIONAL_RENDERING_FLAGS.
+    CONDITIONAL_RENDERING_FLAGS Flags DEFAULT_INITIALIZER(CONDITIONAL_RENDERING_FLAG_NONE);
+
+    /// State transition mode for the predicate buffer, see Diligent::RESOURCE_STATE_TRANSITION_MODE.
+
+    /// The buffer is used in RESOURCE_STATE_INDIRECT_ARGUMENT state.
+    RESOURCE_STATE_TRANSITION_MODE BufferTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+};
+typedef struct BeginConditionalRenderingAttribs BeginConditionalRenderingAttribs;
+
+
 /// TLAS instance flags that are used in IDeviceContext::BuildTLAS().
 DILIGENT_TYPED_ENUM(RAYTRACING_INSTANCE_FLAGS, Uint8)
 {
@@ -1415,6 +1509,9 @@ struct BuildBLASAttribs
     /// The buffer that is used for acceleration structure building.
     /// Must be created with BIND_RAY_TRACING.
     /// Call IBottomLevelAS::GetScratchBufferSizes().Build to get the minimal size for the scratch buffer.
+    /// If null, the device context allocates transient scratch space from an internal pool
+    /// that is recycled when the GPU completes the frame. In this case, ScratchBufferOffset
+    /// and ScratchBufferTransitionMode are ignored.
     IBuffer*                        pScratchBuffer              DEFAULT_INITIALIZER(nullptr);
 
     /// Offset from the beginning of the buffer.
@@ -1500,6 +1597,12 @@ typedef struct InstanceMatrix InstanceMatrix;
 struct TLASBuildInstanceData
 {
     /// Instance name that is used to map an instance to a hit group in shader binding table.
+
+    /// The name can be null. Either all instances in BuildTLASAttribs::pInstances must be named,
+    /// or none of them. Unnamed instances are identified by their index in the pInstances array,
+    /// which avoids the cost of storing and hashing the names for large dynamic scenes.
+    /// Use IShaderBindingTable::BindHitGroupForInstanceByIndex() and ITopLevelAS::GetInstanceDescByIndex()
+    /// to access unnamed instances.
     const Char*               InstanceName    DEFAULT_INITIALIZER(nullptr);
 
     /// Bottom-level AS that represents instance geometry.
@@ -1563,7 +1666,8 @@ struct BuildTLASAttribs
 
     /// The number of instances.
     /// Must be less than or equal to TopLevelASDesc::MaxInstanceCount.
-    /// If Update is true then count must be the same as used to build TLAS.
+    /// If Update is true then count must be the same as used to build TLAS,
+    /// unless a range of unnamed instances is updated (see FirstInstanceToUpdate).
     Uint32                          InstanceCount                 DEFAULT_INITIALIZER(0);
 
     /// The buffer that will be used to store instance data during AS building.
@@ -1599,6 +1703,9 @@ struct BuildTLASAttribs
     /// Must be created with BIND_RAY_TRACING.
     /// Call ITopLevelAS::GetScratchBufferSizes().Build to get the minimal size for the scratch buffer.
     /// Access to the TLAS must be externally synchronized.
+    /// If null, the device context allocates transient scratch space from an internal pool
+    /// that is recycled when the GPU completes the frame. In this case, ScratchBufferOffset
+    /// and ScratchBufferTransitionMode are ignored.
     IBuffer*                        pScratchBuffer                DEFAULT_INITIALIZER(nullptr);
 
     /// Offset from the beginning of the buffer.
@@ -1613,6 +1720,21 @@ struct BuildTLASAttribs
     /// pTLAS must be created with RAYTRACING_BUILD_AS_ALLOW_UPDATE flag.
     /// An update will be faster than building an acceleration structure from scratch.
     Bool                            Update                        DEFAULT_INITIALIZER(False);
+
+    /// Index of the first instance to update.
+
+    /// Only used if Update is true and instances in pInstances are unnamed (see TLASBuildInstanceData::InstanceName).
+    /// In this case, pInstances[i] updates the instance with index FirstInstanceToUpdate + i, and
+    /// FirstInstanceToUpdate + InstanceCount must not exceed the instance count of the previous build.
+    /// Only the updated range is written to the instance buffer, so pInstanceBuffer and InstanceBufferOffset
+    /// must be the same as in the previous build or update, and the buffer must contain the data of the
+    /// remaining instances.
+    ///
+    /// When only a range of instances is updated, instances with TLAS_INSTANCE_OFFSET_AUTO keep their
+    /// hit group locations, so BindingMode, HitGroupStride and BaseContributionToHitGroupIndex must be the same
+    /// as in the previous build, and in HIT_GROUP_BINDING_MODE_PER_GEOMETRY mode the geometry count
+    /// of the instance BLAS must not change.
+    Uint32                          FirstInstanceToUpdate         DEFAULT_INITIALIZER(0);
 };
 typedef struct BuildTLASAttribs BuildTLASAttribs;
 
@@ -2253,6 +2375,9 @@ struct DeviceContextCommandCounters
     /// The total number of ClearDepthStencil calls.
     Uint32 ClearDepthStencil DEFAULT_INITIALIZER(0);
 
+    /// The total number of InvalidateAttachments calls.
+    Uint32 InvalidateAttachments DEFAULT_INITIALIZER(0);
+
     /// The total number of Draw calls.
     Uint32 Draw DEFAULT_INITIALIZER(0);
 
@@ -2334,6 +2459,12 @@ struct DeviceContextCommandCounters
     /// The total number of BeginQuery calls.
     Uint32 BeginQuery DEFAULT_INITIALIZER(0);
 
+    /// The total number of ResolveQueries calls.
+    Uint32 ResolveQueries DEFAULT_INITIALIZER(0);
+
+    /// The total number of BeginConditionalRendering calls.
+    Uint32 BeginConditionalRendering DEFAULT_INITIALIZER(0);
+
     /// The total number of GenerateMips calls.
     Uint32 GenerateMips DEFAULT_INITIALIZER(0);
 
@@ -2342,9 +2473,103 @@ struct DeviceContextCommandCounters
 
     /// The total number of BindSparseResourceMemory calls.
     Uint32 BindSparseResourceMemory DEFAULT_INITIALIZER(0);
+
+    /// The total number of BeginRenderPass calls.
+    Uint32 BeginRenderPass DEFAULT_INITIALIZER(0);
+
+    /// The total number of EndRenderPass calls.
+    Uint32 EndRenderPass DEFAULT_INITIALIZER(0);
 };
 typedef struct DeviceContextCommandCounters DeviceContextCommandCounters;
 
+/// Redundant state filtering counters.
+
+/// \remarks   The counters are only collected by the OpenGL backend, which shadows
+///            the context state to skip the API calls that do not change it.
+struct DeviceContextStateFilterCounters
+{
+    /// The total number of object bindings (programs, program pipelines, vertex array objects,
+    /// framebuffers, textures, samplers, images, uniform and storage buffers) issued to the API.
+    Uint32 BindingsIssued DEFAULT_INITIALIZER(0);
+
+    /// The total number of object bindings that were skipped because the object was already bound.
+    Uint32 BindingsSkipped DEFAULT_INITIALIZER(0);
+
+    /// The total number of times all resources of a shader resource cache were bound.
+    Uint32 ResourceCachesBound DEFAULT_INITIALIZER(0);
+
+    /// The total number of times binding all resources of a shader resource cache was skipped
+    /// because the same resources were bound to the same units by the previous commit.
+    Uint32 ResourceCachesSkipped DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextStateFilterCounters DeviceContextStateFilterCounters;
+
+/// Resource state transition counters.
+
+/// \remarks   The counters are only collected by the Direct3D12 and Vulkan backends.
+///            Transitions are not recorded immediately, but are accumulated and flushed
+///            as a single barrier command before the next command that accesses resources.
+struct DeviceContextBarrierCounters
+{
+    /// The total number of resource state transitions that required a barrier.
+    Uint32 Transitions DEFAULT_INITIALIZER(0);
+
+    /// The total number of resource state transitions that were skipped because the resource
+    /// was already in the required state.
+    ///
+    /// \remarks   When a resource in a read-only state is transitioned to another read-only
+    ///            state, the states are combined, so that subsequent transitions to any of them
+    ///            are skipped.
+    Uint32 TransitionsSkipped DEFAULT_INITIALIZER(0);
+
+    /// The total number of barrier commands (vkCmdPipelineBarrier, ID3D12GraphicsCommandList::ResourceBarrier, etc.)
+    /// that resource state transitions were flushed with.
+    Uint32 BarrierBatches DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextBarrierCounters DeviceContextBarrierCounters;
+
+/// Dynamic allocation counters.
+
+/// \remarks   The counters are only collected by the Direct3D12 and Vulkan backends.
+struct DeviceContextAllocationCounters
+{
+    /// The total number of dynamic descriptor sets allocated by the context.
+
+    /// \remarks  In Vulkan backend, this is the number of descriptor sets allocated from
+    ///           the dynamic descriptor pools. In Direct3D12 backend, this is the number of
+    ///           descriptor ranges allocated from the dynamic part of the GPU-visible descriptor heaps.
+    Uint32 DescriptorSets DEFAULT_INITIALIZER(0);
+
+    /// The total size, in bytes, of the memory allocated from the dynamic upload heap
+    /// (dynamic buffers, UpdateBuffer, UpdateTexture, MapTextureSubresource, etc.).
+    Uint64 DynamicHeapBytes DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextAllocationCounters DeviceContextAllocationCounters;
+
+/// CPU time, in nanoseconds, spent by the device context in each command category.
+
+/// \remarks   CPU time is only measured after it has been enabled by IDeviceContext::EnableCPUTimeStats.
+///            Commands that are called from other commands (e.g. Flush called by FinishFrame)
+///            are only accounted for once in the category of the outermost command.
+struct DeviceContextCPUTimeStats
+{
+    /// Time spent in draw and dispatch commands (Draw*, MultiDraw*, DrawMesh*, DispatchCompute*).
+    Uint64 Draw DEFAULT_INITIALIZER(0);
+
+    /// Time spent in CommitShaderResources.
+    Uint64 Commit DEFAULT_INITIALIZER(0);
+
+    /// Time spent in TransitionResourceStates.
+    Uint64 Transition DEFAULT_INITIALIZER(0);
+
+    /// Time spent in MapBuffer, UnmapBuffer, MapTextureSubresource and UnmapTextureSubresource.
+    Uint64 Map DEFAULT_INITIALIZER(0);
+
+    /// Time spent in Flush and ExecuteCommandLists.
+    Uint64 Submit DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextCPUTimeStats DeviceContextCPUTimeStats;
+
 /// Device context statistics.
 struct DeviceContextStats
 {
@@ -2354,6 +2579,18 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// Redundant state filtering counters, see Diligent::DeviceContextStateFilterCounters.
+    DeviceContextStateFilterCounters StateFilterCounters DEFAULT_INITIALIZER({});
+
+    /// Resource state transition counters, see Diligent::DeviceContextBarrierCounters.
+    DeviceContextBarrierCounters BarrierCounters DEFAULT_INITIALIZER({});
+
+    /// Dynamic allocation counters, see Diligent::DeviceContextAllocationCounters.
+    DeviceContextAllocationCounters AllocationCounters DEFAULT_INITIALIZER({});
+
+    /// CPU time statistics, see Diligent::DeviceContextCPUTimeStats.
+    DeviceContextCPUTimeStats CPUTime DEFAULT_INITIALIZER({});
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
@@ -2498,6 +2735,21 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                          const float* pBlendFactors DEFAULT_VALUE(nullptr)) PURE;
 
 
+    /// Sets the dynamic render state.
+
+    /// \param [in] State - Dynamic render state, see Diligent::DynamicRenderState.
+    ///
+    /// \remarks The states are only applied by pipelines that were created with the
+    ///          corresponding GraphicsPipelineDesc::DynamicStateFlags. The state is retained
+    ///          by the context and is applied again when such pipeline is bound.
+    ///
+    /// \remarks This method requires DeviceFeatures::DynamicRenderState feature.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(SetDynamicRenderState)(THIS_
+                                               const DynamicRenderState REF State) PURE;
+
+
     /// Binds vertex buffers to the pipeline.
 
     /// \param [in] StartSlot           - The first input slot for binding. The first vertex buffer is
@@ -2979,6 +3231,37 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                            RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) PURE;
 
 
+    /// Informs the engine that the contents of the render target and depth-stencil views are no longer needed.
+
+    /// \param [in] NumViews - The number of views in ppViews array.
+    /// \param [in] ppViews  - An array of render target (Diligent::TEXTURE_VIEW_RENDER_TARGET) and
+    ///                        depth-stencil (Diligent::TEXTURE_VIEW_DEPTH_STENCIL) views to invalidate.
+    ///
+    /// \remarks The contents of the views become undefined, which allows the backends to avoid
+    ///          loading and storing them:
+    ///          - In Vulkan backend, views that are bound by IDeviceContext::SetRenderTargets()
+    ///            are not loaded when the render pass for the bound render targets is begun.
+    ///            Views that are not bound as well as views of the render pass that is already running are ignored.
+    ///          - In Direct3D12 backend, the command maps to ID3D12GraphicsCommandList::DiscardResource.
+    ///          - In Direct3D11 backend, the command maps to ID3D11DeviceContext1::DiscardView.
+    ///          - In OpenGL backend, the command maps to glInvalidateFramebuffer for the views
+    ///            that are bound to the context. Other views are ignored.
+    ///          - In WebGPU backend, bound views are cleared when the render pass is begun as WebGPU
+    ///            has no load operation that leaves the contents undefined. Other views are ignored.
+    ///
+    ///          Unlike other backends, Vulkan and WebGPU backends also defer ClearRenderTarget and ClearDepthStencil
+    ///          commands for the bound views until the render pass is begun, so that the clear is performed by the
+    ///          attachment load operation. The best way to start rendering to a render target is thus to bind it
+    ///          and to either clear or invalidate it before issuing any draw commands.
+    ///
+    ///          The command must not be used inside an explicit render pass, see IDeviceContext::BeginRenderPass.
+    ///
+    /// \remarks Supported contexts: graphics.
+    VIRTUAL void METHOD(InvalidateAttachments)(THIS_
+                                               Uint32               NumViews,
+                                               ITextureView* const* ppViews) PURE;
+
+
     /// Finishes recording commands and generates a command list.
 
     /// \param [out] ppCommandList - Memory location where pointer to the recorded command list will be written.
@@ -2990,7 +3273,11 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
 
     /// \param [in] NumCommandLists - The number of command lists to execute.
     /// \param [in] ppCommandLists  - Pointer to the array of NumCommandLists command lists to execute.
-    /// \remarks After a command list is executed, it is no longer valid and must be released.
+    /// \remarks In Direct3D11 backend, command lists are not consumed by the execution and the same command
+    ///          list may be executed multiple times, which can be used to replay static content.
+    ///          In other backends, after a command list is executed, it is no longer valid and must be released,
+    ///          unless it was recorded with IDeviceContextD3D12::BeginReusableCommandList() (Direct3D12 bundles)
+    ///          or IDeviceContextVk::BeginReusableCommandList() (Vulkan reusable secondary command buffers).
     VIRTUAL void METHOD(ExecuteCommandLists)(THIS_
                                              Uint32               NumCommandLists,
                                              ICommandList* const* ppCommandLists) PURE;
@@ -3094,6 +3381,74 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
                                   IQuery* pQuery) PURE;
 
 
+    /// Copies the results of multiple queries into a GPU buffer.
+
+    /// \param [in] ppQueries               - An array of NumQueries queries whose results to resolve.
+    /// \param [in] NumQueries              - The number of queries in ppQueries array.
+    /// \param [in] pDstBuffer              - Destination buffer.
+    /// \param [in] DstOffset               - Offset in bytes from the beginning of the destination buffer
+    ///                                       where the result of the first query will be written.
+    ///                                       Must be a multiple of 8.
+    /// \param [in] DstBufferTransitionMode - State transition mode for the destination buffer
+    ///                                       (see Diligent::RESOURCE_STATE_TRANSITION_MODE).
+    ///
+    /// \remarks   The result of the i-th query is written to the buffer as a 64-bit unsigned integer
+    ///            at offset DstOffset + i * 8:
+    ///            - Occlusion query: the number of samples that passed the depth and stencil tests.
+    ///            - Binary occlusion query: zero if no samples passed the tests, and non-zero otherwise.
+    ///            - Timestamp query: the counter value, see Diligent::QueryDataTimestamp.
+    ///
+    ///            Pipeline statistics and duration queries are not supported.
+    ///            All queries must have been ended by this context, and the method must be called
+    ///            outside of the query scope. The results are resolved on the GPU and never read back
+    ///            by the CPU, so the buffer may be used for predication or as an indirect draw
+    ///            arguments buffer in subsequent commands. IQuery::GetData() may still be called
+    ///            for the resolved queries.
+    ///
+    ///            The method is supported in Direct3D12, Vulkan and OpenGL (requires GL4.4 or
+    ///            GL_ARB_query_buffer_object) backends.
+    ///
+    ///            In Direct3D12 and Vulkan, the destination buffer will be transitioned to
+    ///            RESOURCE_STATE_COPY_DEST state if DstBufferTransitionMode is
+    ///            RESOURCE_STATE_TRANSITION_MODE_TRANSITION.
+    ///
+    /// \remarks Supported contexts: graphics, compute.
+    VIRTUAL void METHOD(ResolveQueries)(THIS_
+                                        IQuery* const*                 ppQueries,
+                                        Uint32                         NumQueries,
+                                        IBuffer*                       pDstBuffer,
+                                        Uint64                         DstOffset,
+                                        RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) PURE;
+
+
+    /// Begins conditional rendering.
+
+    /// \param [in] Attribs - Conditional rendering attributes, see Diligent::BeginConditionalRenderingAttribs.
+    ///
+    /// \remarks   While conditional rendering is active, draw commands as well as other commands
+    ///            that are subject to predication by the underlying API are discarded when the
+    ///            predicate value is zero (or non-zero if CONDITIONAL_RENDERING_FLAG_INVERTED flag is set).
+    ///            The exact set of affected commands is backend-specific: in Direct3D12, dispatch,
+    ///            copy and clear commands are also predicated, while in OpenGL only draw commands are.
+    ///
+    ///            Conditional rendering scopes must not be nested and must be ended by
+    ///            IDeviceContext::EndConditionalRendering() before the context is flushed or
+    ///            the command list is finished.
+    ///
+    ///            The method requires DeviceFeatures::ConditionalRendering feature.
+    ///            Direct3D12 and Vulkan use buffer predicates, OpenGL uses occlusion query predicates.
+    ///
+    /// \remarks Supported contexts: graphics, compute.
+    VIRTUAL void METHOD(BeginConditionalRendering)(THIS_
+                                                   const BeginConditionalRenderingAttribs REF Attribs) PURE;
+
+
+    /// Ends conditional rendering that was started by IDeviceContext::BeginConditionalRendering().
+
+    /// \remarks Supported contexts: graphics, compute.
+    VIRTUAL void METHOD(EndConditionalRendering)(THIS) PURE;
+
+
     /// Submits all pending commands in the context for execution to the command queue.
 
     /// \remarks    Only immediate contexts can be flushed.\n
@@ -3275,6 +3630,25 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     VIRTUAL Uint64 METHOD(GetFrameNumber)(THIS) CONST PURE;
 
 
+    /// Allocates transient CPU memory that remains valid until the next call to FinishFrame().
+
+    /// \param [in] Size      - Allocation size, in bytes.
+    /// \param [in] Alignment - Allocation alignment. Must be a power of two.
+    ///
+    /// \return     Pointer to the allocated memory, or null if Size is zero.
+    ///
+    /// \remarks    The memory is allocated from the per-context linear allocator that
+    ///             the engine also uses for temporary storage in its command recording paths.
+    ///             Allocator pages are reused after every FinishFrame() call, so in the
+    ///             steady state no heap allocations are performed.
+    ///
+    ///             The memory must not be released by the application.
+    ///             Like other context methods, this method is not thread-safe.
+    VIRTUAL void* METHOD(AllocateFrameMemory)(THIS_
+                                              size_t Size,
+                                              size_t Alignment DEFAULT_VALUE(16)) PURE;
+
+
     /// Transitions resource states.
 
     /// \param [in] BarrierCount      - Number of barriers in pResourceBarriers array
@@ -3576,7 +3950,21 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContext, IObject)
     VIRTUAL void METHOD(ClearStats)(THIS) PURE;
 
     /// Returns the device context statistics, see Diligent::DeviceContextStats.
+
+    /// \remarks If the engine is built with DILIGENT_NO_CONTEXT_STATS CMake option,
+    ///          statistics are not collected and all counters are zero.
     VIRTUAL const DeviceContextStats REF METHOD(GetStats)(THIS) CONST PURE;
+
+    /// Enables or disables measuring CPU time spent in device context commands.
+
+    /// \param [in] Enable - Whether to measure CPU time.
+    ///
+    /// \remarks CPU time is reported by DeviceContextStats::CPUTime and is not measured by default,
+    ///          as querying the timer adds overhead to every measured command.
+    ///          If the engine is built with DILIGENT_NO_CONTEXT_STATS CMake option,
+    ///          this method has no effect.
+    VIRTUAL void METHOD(EnableCPUTimeStats)(THIS_
+                                            Bool Enable) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -3593,6 +3981,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_CommitShaderResources(This, ...)         CALL_IFACE_METHOD(DeviceContext, CommitShaderResources,     This, __VA_ARGS__)
 #    define IDeviceContext_SetStencilRef(This, ...)                 CALL_IFACE_METHOD(DeviceContext, SetStencilRef,             This, __VA_ARGS__)
 #    define IDeviceContext_SetBlendFactors(This, ...)               CALL_IFACE_METHOD(DeviceContext, SetBlendFactors,           This, __VA_ARGS__)
+#    define IDeviceContext_SetDynamicRenderState(This, ...)         CALL_IFACE_METHOD(DeviceContext, SetDynamicRenderState,     This, __VA_ARGS__)
 #    define IDeviceContext_SetVertexBuffers(This, ...)              CALL_IFACE_METHOD(DeviceContext, SetVertexBuffers,          This, __VA_ARGS__)
 #    define IDeviceContext_InvalidateState(This)                    CALL_IFACE_METHOD(DeviceContext, InvalidateState,           This)
 #    define IDeviceContext_SetIndexBuffer(This, ...)                CALL_IFACE_METHOD(DeviceContext, SetIndexBuffer,            This, __VA_ARGS__)
@@ -3615,6 +4004,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_GetTileSize(This, ...)                   CALL_IFACE_METHOD(DeviceContext, GetTileSize,               This, __VA_ARGS__)
 #    define IDeviceContext_ClearDepthStencil(This, ...)             CALL_IFACE_METHOD(DeviceContext, ClearDepthStencil,         This, __VA_ARGS__)
 #    define IDeviceContext_ClearRenderTarget(This, ...)             CALL_IFACE_METHOD(DeviceContext, ClearRenderTarget,         This, __VA_ARGS__)
+#    define IDeviceContext_InvalidateAttachments(This, ...)         CALL_IFACE_METHOD(DeviceContext, InvalidateAttachments,     This, __VA_ARGS__)
 #    define IDeviceContext_FinishCommandList(This, ...)             CALL_IFACE_METHOD(DeviceContext, FinishCommandList,         This, __VA_ARGS__)
 #    define IDeviceContext_ExecuteCommandLists(This, ...)           CALL_IFACE_METHOD(DeviceContext, ExecuteCommandLists,       This, __VA_ARGS__)
 #    define IDeviceContext_EnqueueSignal(This, ...)                 CALL_IFACE_METHOD(DeviceContext, EnqueueSignal,             This, __VA_ARGS__)
@@ -3622,6 +4012,9 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_WaitForIdle(This)                        CALL_IFACE_METHOD(DeviceContext, WaitForIdle,               This)
 #    define IDeviceContext_BeginQuery(This, ...)                    CALL_IFACE_METHOD(DeviceContext, BeginQuery,                This, __VA_ARGS__)
 #    define IDeviceContext_EndQuery(This, ...)                      CALL_IFACE_METHOD(DeviceContext, EndQuery,                  This, __VA_ARGS__)
+#    define IDeviceContext_ResolveQueries(This, ...)                CALL_IFACE_METHOD(DeviceContext, ResolveQueries,            This, __VA_ARGS__)
+#    define IDeviceContext_BeginConditionalRendering(This, ...)     CALL_IFACE_METHOD(DeviceContext, BeginConditionalRendering, This, __VA_ARGS__)
+#    define IDeviceContext_EndConditionalRendering(This)            CALL_IFACE_METHOD(DeviceContext, EndConditionalRendering,   This)
 #    define IDeviceContext_Flush(This)                              CALL_IFACE_METHOD(DeviceContext, Flush,                     This)
 #    define IDeviceContext_UpdateBuffer(This, ...)                  CALL_IFACE_METHOD(DeviceContext, UpdateBuffer,              This, __VA_ARGS__)
 #    define IDeviceContext_CopyBuffer(This, ...)                    CALL_IFACE_METHOD(DeviceContext, CopyBuffer,                This, __VA_ARGS__)
@@ -3634,6 +4027,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_GenerateMips(This, ...)                  CALL_IFACE_METHOD(DeviceContext, GenerateMips,              This, __VA_ARGS__)
 #    define IDeviceContext_FinishFrame(This)                        CALL_IFACE_METHOD(DeviceContext, FinishFrame,               This)
 #    define IDeviceContext_GetFrameNumber(This)                     CALL_IFACE_METHOD(DeviceContext, GetFrameNumber,            This)
+#    define IDeviceContext_AllocateFrameMemory(This, ...)           CALL_IFACE_METHOD(DeviceContext, AllocateFrameMemory,       This, __VA_ARGS__)
 #    define IDeviceContext_TransitionResourceStates(This, ...)      CALL_IFACE_METHOD(DeviceContext, TransitionResourceStates,  This, __VA_ARGS__)
 #    define IDeviceContext_ResolveTextureSubresource(This, ...)     CALL_IFACE_METHOD(DeviceContext, ResolveTextureSubresource, This, __VA_ARGS__)
 #    define IDeviceContext_BuildBLAS(This, ...)                     CALL_IFACE_METHOD(DeviceContext, BuildBLAS,                 This, __VA_ARGS__)
@@ -3656,6 +4050,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContext_BindSparseResourceMemory(This, ...)      CALL_IFACE_METHOD(DeviceContext, BindSparseResourceMemory,  This, __VA_ARGS__)
 #    define IDeviceContext_ClearStats(This)                         CALL_IFACE_METHOD(DeviceContext, ClearStats,                This)
 #    define IDeviceContext_GetStats(This)                           CALL_IFACE_METHOD(DeviceContext, GetStats,                  This)
+#    define IDeviceContext_EnableCPUTimeStats(This, ...)            CALL_IFACE_METHOD(DeviceContext, EnableCPUTimeStats,        This, __VA_ARGS__)
 
 // clang-format on
 
@@ -63,7 +63,19 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactory =
 /// Dearchiver create information
 struct DearchiverCreateInfo
 {
-    void* pDummy DEFAULT_INITIALIZER(nullptr);
+    /// An optional thread pool that is used to load the shader data of the archives.
+
+    /// \remarks   When the pool is provided, IDearchiver::LoadArchive enqueues a task that
+    ///             parses and, if necessary, decompresses the shaders for the dearchiver's
+    ///             device type, so that they are ready by the time the first object is unpacked.
+    ///             Otherwise, the shaders are loaded when the first shader is unpacked.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to compress the shader data in the archive produced by IDearchiver::Store.
+
+    /// \remarks   Shader data for each device type is compressed with LZ4 as a separate
+    ///             chunk, so it is only decompressed when the shaders for that device are loaded.
+    Bool CompressShaders DEFAULT_INITIALIZER(False);
 };
 typedef struct DearchiverCreateInfo DearchiverCreateInfo;
 
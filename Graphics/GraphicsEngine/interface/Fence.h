@@ -71,6 +71,15 @@ struct FenceDesc DILIGENT_DERIVE(DeviceObjectAttribs)
 };
 typedef struct FenceDesc FenceDesc;
 
+struct IFence;
+
+/// Fence completion callback, see IFence::RegisterCompletionCallback().
+
+/// \param [in] pFence    - The fence that reached the value.
+/// \param [in] Value     - The value the callback was registered for.
+/// \param [in] pUserData - User data pointer that was passed to IFence::RegisterCompletionCallback().
+typedef void(DILIGENT_CALL_TYPE* FenceCompletionCallbackType)(struct IFence* pFence, Uint64 Value, void* pUserData);
+
 // clang-format off
 
 #define DILIGENT_INTERFACE_NAME IFence
@@ -125,6 +134,23 @@ DILIGENT_BEGIN_INTERFACE(IFence, IDeviceObject)
     /// \note  The method blocks the execution of the calling thread until the wait is complete.
     VIRTUAL void METHOD(Wait)(THIS_
                               Uint64 Value) PURE;
+
+
+    /// Registers a callback that is invoked when the fence reaches or exceeds the specified value.
+
+    /// \param [in] Value     - The value that the fence is waiting for to reach.
+    /// \param [in] Callback  - Callback function, see Diligent::FenceCompletionCallbackType.
+    /// \param [in] pUserData - User data pointer that is passed to the callback.
+    ///
+    /// \remarks  The callback is invoked from a waiter thread owned by the render device, so
+    ///           it must be thread-safe and should return quickly. Callbacks of different fences
+    ///           may be invoked in any order. The fence is kept alive until its callbacks are invoked.
+    ///
+    ///           The method is supported in Direct3D12 and Vulkan backends only.
+    VIRTUAL void METHOD(RegisterCompletionCallback)(THIS_
+                                                    Uint64                      Value,
+                                                    FenceCompletionCallbackType Callback,
+                                                    void*                       pUserData) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -136,9 +162,10 @@ DILIGENT_END_INTERFACE
 
 #    define IFence_GetDesc(This) (const struct FenceDesc*)IDeviceObject_GetDesc(This)
 
-#    define IFence_GetCompletedValue(This) CALL_IFACE_METHOD(Fence, GetCompletedValue, This)
-#    define IFence_Signal(This, ...)       CALL_IFACE_METHOD(Fence, Signal,            This, __VA_ARGS__)
-#    define IFence_Wait(This, ...)         CALL_IFACE_METHOD(Fence, Wait,              This, __VA_ARGS__)
+#    define IFence_GetCompletedValue(This)               CALL_IFACE_METHOD(Fence, GetCompletedValue,          This)
+#    define IFence_Signal(This, ...)                     CALL_IFACE_METHOD(Fence, Signal,                     This, __VA_ARGS__)
+#    define IFence_Wait(This, ...)                       CALL_IFACE_METHOD(Fence, Wait,                       This, __VA_ARGS__)
+#    define IFence_RegisterCompletionCallback(This, ...) CALL_IFACE_METHOD(Fence, RegisterCompletionCallback, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -1514,6 +1514,39 @@ struct SwapChainDesc
     /// for the primary swap chain, the engine releases stale resources.
     Bool  IsPrimary                     DEFAULT_INITIALIZER(true);
 
+    /// The maximum number of frames that the application is allowed to queue for presentation.
+
+    /// Zero means that the maximum frame latency matches the number of buffers in the swap chain.
+    /// The value can be changed later by ISwapChain::SetMaximumFrameLatency().
+    Uint32 MaxFrameLatency              DEFAULT_INITIALIZER(0);
+
+    /// Enables low-latency frame pacing.
+
+    /// By default, the swap chain waits for the presentation engine to accept the frame
+    /// right before presenting it. When this member is true, the swap chain instead waits at
+    /// the end of ISwapChain::Present() until the presentation engine is ready to accept the next
+    /// frame, so that an application that samples the input after Present() returns minimizes
+    /// the input-to-present latency.
+    ///
+    /// \remarks Direct3D11 and Direct3D12 backends use the DXGI frame latency waitable object.
+    ///          Vulkan backend uses VK_KHR_present_id and VK_KHR_present_wait extensions and
+    ///          ignores this member if the extensions are not supported by the device.
+    ///          Other backends ignore this member.
+    Bool  LowLatency                    DEFAULT_INITIALIZER(False);
+
+    /// Offloads presentation to a dedicated thread owned by the render device.
+
+    /// When this member is true, ISwapChain::Present() flushes the immediate context and
+    /// returns right away, while the present operation, frame latency wait and acquisition of
+    /// the next back buffer run on the present thread. The render thread blocks only when it
+    /// needs the next back buffer, i.e. in ISwapChain::GetCurrentBackBufferRTV() or in
+    /// the next call to Present() or Resize(). An application can thus record commands that
+    /// do not use the back buffer (e.g. shadow maps) while the driver presents the frame.
+    ///
+    /// \remarks Only Vulkan backend supports asynchronous presentation.
+    ///          Other backends ignore this member.
+    Bool  AsyncPresent                  DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr SwapChainDesc() noexcept
     {
@@ -1854,6 +1887,38 @@ struct DeviceFeatures
     /// Indicates if device supports formatted buffers.
     DEVICE_FEATURE_STATE FormattedBuffers       DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates if device supports dynamic render states.
+    ///
+    /// \remarks    When this feature is enabled, graphics pipelines can be created with
+    ///             GraphicsPipelineDesc::DynamicStateFlags, and the corresponding states
+    ///             (cull mode, front face, primitive topology, depth and stencil state) can be set
+    ///             by IDeviceContext::SetDynamicRenderState() without creating a new pipeline.
+    ///
+    ///             In Vulkan, this feature requires VK_EXT_extended_dynamic_state extension.
+    DEVICE_FEATURE_STATE DynamicRenderState     DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports conditional rendering.
+    ///
+    /// \remarks    When this feature is enabled, draw and dispatch commands can be
+    ///             discarded on the GPU based on a predicate value, see
+    ///             IDeviceContext::BeginConditionalRendering().
+    ///
+    ///             In Direct3D12 and Vulkan, the predicate is read from a buffer.
+    ///             Vulkan requires VK_EXT_conditional_rendering extension.
+    ///             In OpenGL, the predicate is the result of an occlusion query.
+    DEVICE_FEATURE_STATE ConditionalRendering   DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates if device supports pipelines built from shader objects.
+    ///
+    /// \remarks    When this feature is enabled, graphics and mesh pipelines can be created with
+    ///             PSO_CREATE_FLAG_SHADER_OBJECTS flag. Such pipelines do not compile the
+    ///             fixed-function state: shader stages are compiled independently and shared by all
+    ///             pipelines that use the same shaders and resource signatures, while all render
+    ///             states are set dynamically when the pipeline is bound.
+    ///
+    ///             In Vulkan, this feature requires VK_EXT_shader_object extension.
+    DEVICE_FEATURE_STATE ShaderObjects          DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeatures() noexcept {}
 
@@ -1904,11 +1969,14 @@ struct DeviceFeatures
 	Handler(TextureSubresourceViews)		   \
 	Handler(NativeMultiDraw)                   \
     Handler(AsyncShaderCompilation)			   \
-	Handler(FormattedBuffers)
+	Handler(FormattedBuffers)                  \
+    Handler(DynamicRenderState)                \
+    Handler(ConditionalRendering)              \
+    Handler(ShaderObjects)
 
     explicit constexpr DeviceFeatures(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 47, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 50, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -2349,6 +2417,12 @@ struct MeshShaderProperties
     /// The total maximum number of mesh shader groups per draw command.
     Uint32 MaxThreadGroupTotalCount DEFAULT_INITIALIZER(0);
 
+    /// The maximum number of vertices that a mesh shader thread group can output.
+    Uint32 MaxOutputVertices        DEFAULT_INITIALIZER(0);
+
+    /// The maximum number of primitives that a mesh shader thread group can output.
+    Uint32 MaxOutputPrimitives      DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     /// Comparison operator tests if two structures are equivalent
 
@@ -2361,7 +2435,9 @@ struct MeshShaderProperties
         return MaxThreadGroupCountX     == RHS.MaxThreadGroupCountX &&
                MaxThreadGroupCountY     == RHS.MaxThreadGroupCountY &&
                MaxThreadGroupCountZ     == RHS.MaxThreadGroupCountZ &&
-               MaxThreadGroupTotalCount == RHS.MaxThreadGroupTotalCount;
+               MaxThreadGroupTotalCount == RHS.MaxThreadGroupTotalCount &&
+               MaxOutputVertices        == RHS.MaxOutputVertices        &&
+               MaxOutputPrimitives      == RHS.MaxOutputPrimitives;
     }
 #endif
 };
@@ -3284,6 +3360,13 @@ struct GraphicsAdapterInfo
     /// Number of video outputs this adapter has (if available).
     Uint32 NumOutputs       DEFAULT_INITIALIZER(0);
 
+    /// Number of physical GPUs (nodes) linked together in this adapter.
+
+    /// In Direct3D12, this is the node count of the device. In Vulkan, this is the number
+    /// of physical devices in the device group that contains the adapter.
+    /// The engine currently executes all commands and places all resources on the first node.
+    Uint32 NumNodes         DEFAULT_INITIALIZER(1);
+
     /// Device memory information, see Diligent::AdapterMemoryInfo.
     AdapterMemoryInfo Memory;
 
@@ -3352,6 +3435,7 @@ struct GraphicsAdapterInfo
                VendorId        == RHS.VendorId        &&
                DeviceId        == RHS.DeviceId        &&
                NumOutputs      == RHS.NumOutputs      &&
+               NumNodes        == RHS.NumNodes        &&
                Memory          == RHS.Memory          &&
                RayTracing      == RHS.RayTracing      &&
                WaveOp          == RHS.WaveOp          &&
@@ -3475,7 +3559,11 @@ struct EngineCreateInfo
     VALIDATION_FLAGS    ValidationFlags             DEFAULT_INITIALIZER(VALIDATION_FLAG_NONE);
 
     /// Pointer to the raw memory allocator that will be used for all memory allocation/deallocation
-    /// operations in the engine
+    /// operations in the engine.
+    ///
+    /// \remarks    If null, the default allocator that forwards to malloc is used.
+    ///             Diligent::PooledRawMemoryAllocator::GetAllocator() returns the built-in
+    ///             size-classed allocator with per-thread caches that may be used instead.
     struct IMemoryAllocator* pRawMemAllocator       DEFAULT_INITIALIZER(nullptr);
 
     /// An optional thread pool for asynchronous shader and pipeline state compilation.
@@ -3501,8 +3589,39 @@ struct EngineCreateInfo
     ///             function.
     Uint32 NumAsyncShaderCompilationThreads DEFAULT_INITIALIZER(0xFFFFFFFFu);
 
+    /// Whether to deduplicate pipeline states with identical content.
+
+    /// \remarks   When this option is enabled, the render device hashes the pipeline state create info
+    ///             (pipeline description, resource signatures, and shader bytecode) and returns the existing
+    ///             pipeline state object if one with the same content is still alive, instead of creating
+    ///             a new one. The device only keeps weak references to the pipelines.
+    ///
+    ///             Pipelines are only deduplicated when all shaders are ready at the time of
+    ///             the creation call. The name of the returned pipeline is the name of the
+    ///             pipeline that was created first.
+    Bool EnablePipelineStateDeduplication DEFAULT_INITIALIZER(False);
+
+    /// Whether to cache compiled shader bytecode.
+
+    /// \remarks   When this option is enabled, the engine computes the key of every shader created
+    ///             from source code from its preprocessed source, macros, compiler, compile options,
+    ///             and the compilation target, and looks up the bytecode in a process-shared store
+    ///             before compiling the shader. If the bytecode is found, compilation is skipped.
+    ///             Compiler output is not available for shaders loaded from the cache.
+    ///
+    ///             Currently only supported in Vulkan backend.
+    Bool EnableShaderBytecodeCache DEFAULT_INITIALIZER(False);
+
     // The structure must be 8-byte aligned
-    Uint32 Padding DEFAULT_INITIALIZER(0);
+    Bool Padding[2] DEFAULT_INITIALIZER({});
+
+    /// An optional directory where the shader bytecode cache is stored on disk.
+
+    /// \remarks   If EnableShaderBytecodeCache is true and the directory is not null, compiled shaders
+    ///             are written to this directory and are reused by subsequent runs of the application.
+    ///             If the directory is null, the bytecode is only shared in memory between devices of
+    ///             the same process.
+    const Char* pShaderBytecodeCacheDir DEFAULT_INITIALIZER(nullptr);
 
 #if DILIGENT_CPP_INTERFACE
     EngineCreateInfo() noexcept
@@ -3541,10 +3660,34 @@ DILIGENT_TYPED_ENUM(WEBGL_POWER_PREFERENCE, Uint8)
 	WEBGL_POWER_PREFERENCE_HIGH_PERFORMANCE
 };
 
+/// WebGL context proxying mode.
+DILIGENT_TYPED_ENUM(WEBGL_CONTEXT_PROXY_MODE, Uint8)
+{
+    /// Use the default mode set by emscripten_webgl_init_context_attributes().
+    WEBGL_CONTEXT_PROXY_MODE_DEFAULT = 0,
+
+    /// Never proxy the context. Creating the context from a pthread fails
+    /// unless the canvas has been transferred to that thread.
+    WEBGL_CONTEXT_PROXY_MODE_DISALLOW,
+
+    /// Proxy the context to the main browser thread only if the canvas
+    /// has not been transferred to the calling thread.
+    WEBGL_CONTEXT_PROXY_MODE_FALLBACK,
+
+    /// Always proxy the context to the main browser thread.
+    WEBGL_CONTEXT_PROXY_MODE_ALWAYS
+};
+
 /// WebGL context attributes.
 ///
 /// \remarks    This struct is used to set the members of the EmscriptenWebGLContextAttributes
 ///             structure that is passed to emscripten_webgl_create_context().
+///
+///             To render from a pthread, transfer the canvas to that thread as an OffscreenCanvas
+///             (link with -sOFFSCREENCANVAS_SUPPORT and use -sOFFSCREENCANVASES_TO_PTHREAD or
+///             emscripten_pthread_attr_settransferredcanvases()), and create the engine on that thread.
+///             If the thread does not return to the browser event loop between frames, set
+///             ExplicitSwapControl to true so that ISwapChain::Present() presents the frame.
 struct WebGLContextAttribs
 {
     /// If true, request alpha channel for the context and enable blending of
@@ -3574,6 +3717,27 @@ struct WebGLContextAttribs
     ///
     /// \remarks    This corresponds to the powerPreference member of the EmscriptenWebGLContextAttributes struct.
     WEBGL_POWER_PREFERENCE PowerPreference DEFAULT_INITIALIZER(WEBGL_POWER_PREFERENCE_DEFAULT);
+
+    /// Specifies whether the context is proxied to the main browser thread when it is created from a pthread.
+    ///
+    /// \remarks    This corresponds to the proxyContextToMainThread member of the EmscriptenWebGLContextAttributes struct.
+    ///             Proxying requires linking with -sOFFSCREEN_FRAMEBUFFER. Every GL call of a proxied
+    ///             context is a synchronous call to the main thread, so transferring the canvas is preferred.
+    WEBGL_CONTEXT_PROXY_MODE ProxyContextToMainThread DEFAULT_INITIALIZER(WEBGL_CONTEXT_PROXY_MODE_DEFAULT);
+
+    /// If true, render to an offscreen framebuffer that is copied to the canvas when the frame is presented.
+    ///
+    /// \remarks    This corresponds to the renderViaOffscreenBackBuffer member of the EmscriptenWebGLContextAttributes struct.
+    ///             Requires linking with -sOFFSCREEN_FRAMEBUFFER.
+    Bool RenderViaOffscreenBackBuffer DEFAULT_INITIALIZER(false);
+
+    /// If true, frames are only presented by ISwapChain::Present(), which calls emscripten_webgl_commit_frame().
+    /// If false, the browser presents the frame when the rendering thread returns to the event loop.
+    ///
+    /// \remarks    This corresponds to the explicitSwapControl member of the EmscriptenWebGLContextAttributes struct.
+    ///             Explicit swap control requires either a canvas transferred to the rendering thread
+    ///             or RenderViaOffscreenBackBuffer.
+    Bool ExplicitSwapControl DEFAULT_INITIALIZER(false);
 };
 typedef struct WebGLContextAttribs WebGLContextAttribs;
 #endif
@@ -3607,6 +3771,38 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// The size of the dynamic heap (the persistently mapped ring buffer that is used
+    /// to suballocate memory for dynamic uniform buffers).
+    ///
+    /// \remarks    The dynamic heap requires OpenGL 4.4 (or GL_ARB_buffer_storage) or
+    ///             GL_EXT_buffer_storage on OpenGLES. Each time a dynamic uniform buffer is
+    ///             mapped with MAP_FLAG_DISCARD, the engine allocates a new chunk of memory
+    ///             from the heap. The memory is recycled once the GPU has finished the frame
+    ///             in which it was allocated. If the heap is exhausted, the buffer is mapped
+    ///             through its own storage as usual.
+    ///             Set this member to zero to disable the dynamic heap.
+    Uint32 DynamicHeapSize DEFAULT_INITIALIZER(8 << 20);
+
+    /// Whether to create a worker OpenGL context that shares objects with the main context.
+    ///
+    /// \remarks    When the worker context is created, the engine runs a background thread
+    ///             that compiles shaders and links programs for objects created with
+    ///             SHADER_COMPILE_FLAG_ASYNCHRONOUS and PSO_CREATE_FLAG_ASYNCHRONOUS flags,
+    ///             and the AsyncShaderCompilation feature is supported even if the driver does
+    ///             not support GL_KHR_parallel_shader_compile. Results of the worker are
+    ///             synchronized with the main context through fence sync objects.
+    ///             The worker context is supported on Windows (WGL), Linux (GLX) and Android (EGL).
+    Bool EnableWorkerContext DEFAULT_INITIALIZER(false);
+
+    /// The maximum number of vertex array objects that are cached for each GL context.
+    ///
+    /// \remarks    The limit only applies when separate vertex attribute formats (GL4.3 or GLES3.1)
+    ///             are not supported. In this case, a VAO is created for every combination of the
+    ///             pipeline state and bound vertex and index buffers, and the least recently used
+    ///             objects are released when the limit is reached.
+    ///             Set this member to zero to disable the limit.
+    Uint32 VAOCacheSize DEFAULT_INITIALIZER(1024);
+
 #if PLATFORM_EMSCRIPTEN
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -3830,6 +4026,50 @@ struct EngineD3D12CreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// By default, the engine will search for "dxcompiler.dll".
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Whether to enable bindless access to shader resources through the descriptor heaps.
+
+    /// \remarks    When this option is enabled and the device supports shader model 6.6 and
+    ///             resource binding tier 3, every shader resource view, unordered access view and
+    ///             sampler gets a descriptor at a stable index in the shader-visible descriptor heap
+    ///             when it is created. The index is returned by ITextureViewD3D12::GetDescriptorHeapIndex(),
+    ///             IBufferViewD3D12::GetDescriptorHeapIndex() and ISamplerD3D12::GetDescriptorHeapIndex().
+    ///             Root signatures are created with the CBV_SRV_UAV_HEAP_DIRECTLY_INDEXED and
+    ///             SAMPLER_HEAP_DIRECTLY_INDEXED flags, so that shaders can access the resources
+    ///             through ResourceDescriptorHeap[] and SamplerDescriptorHeap[] using indices passed
+    ///             in a constant buffer. No descriptors need to be copied when shader resources are committed.
+    ///
+    ///             Bindless descriptors are allocated from the static part of the GPU descriptor heap,
+    ///             so GPUDescriptorHeapSize must be large enough to accommodate all views and samplers.
+    Bool EnableBindlessResources DEFAULT_INITIALIZER(False);
+
+    /// Size of the resource heap pages that buffers and textures are suballocated from.
+
+    /// \remarks    Instead of creating every resource with its own implicit heap, the engine
+    ///             allocates large ID3D12Heap pages and creates placed resources in them.
+    ///             This avoids the overhead of heap creation for every resource. Small textures
+    ///             use 4 KB placement alignment where the device allows it.
+    ///
+    ///             Render targets, depth-stencil buffers, multisampled textures, sparse resources and
+    ///             resources whose size exceeds PlacedResourceSizeThreshold are always created as
+    ///             committed resources.
+    ///
+    ///             Note that unlike committed resources, the contents of placed resources
+    ///             are undefined when they are created.
+    ///
+    ///             Zero value disables placed resources.
+    Uint32 ResourceHeapPageSize DEFAULT_INITIALIZER(64 << 20);
+
+    /// Amount of resource heap memory reserved by the engine.
+    /// The engine does not pre-allocate the memory, but rather keeps empty
+    /// pages when resources are released.
+    Uint32 ResourceHeapReserveSize DEFAULT_INITIALIZER(256 << 20);
+
+    /// Maximum size of a resource that is suballocated from a resource heap page.
+
+    /// \remarks    Larger resources are created as committed resources. The threshold
+    ///             can't exceed ResourceHeapPageSize.
+    Uint32 PlacedResourceSizeThreshold DEFAULT_INITIALIZER(4 << 20);
+
 #if DILIGENT_CPP_INTERFACE
     EngineD3D12CreateInfo() noexcept :
         EngineD3D12CreateInfo{EngineCreateInfo{}}
@@ -3991,6 +4231,16 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// pages when resources are released.
     Uint32 HostVisibleMemoryReserveSize     DEFAULT_INITIALIZER(256 << 20);
 
+    /// Minimum size of a resource that is given its own device memory object.
+    ///
+    /// \remarks   Textures and buffers whose memory size is equal to or greater than this value
+    ///            are not suballocated from memory pages, but get a dedicated allocation.
+    ///            This avoids wasting most of a page or creating oversized pages for large
+    ///            resources such as render targets. Resources for which the driver prefers or
+    ///            requires a dedicated allocation (VK_KHR_dedicated_allocation) always get one.
+    ///            Zero value disables size-based dedicated allocations.
+    Uint32 DedicatedAllocationThreshold     DEFAULT_INITIALIZER(16 << 20);
+
     /// Page size of the upload heap that is allocated by immediate/deferred
     /// contexts from the global memory manager to perform lock-free dynamic
     /// suballocations.
@@ -4088,6 +4338,33 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Whether to use push descriptors (VK_KHR_push_descriptor) for dynamic shader variables.
+
+    /// \remarks    When this option is enabled and the device supports the extension, the descriptor set
+    ///             for the dynamic variables of the pipeline resource signature with binding index 0 is
+    ///             laid out as a push descriptor set. Committing shader resources then records
+    ///             vkCmdPushDescriptorSetKHR with the descriptors that changed since the last push
+    ///             instead of allocating and writing a new descriptor set.
+    ///             Vulkan only allows one push descriptor set per pipeline layout, so signatures
+    ///             with other binding indices use regular descriptor sets.
+    ///             The option is ignored when the device uses descriptor buffers.
+    Bool UsePushDescriptors DEFAULT_INITIALIZER(False);
+
+    /// Whether to defer SPIR-V performance optimization to the shader compilation thread pool.
+
+    /// \remarks    When this option is enabled, shaders compiled with glslang are only legalized,
+    ///             so that they are created as quickly as possible. When a graphics or compute
+    ///             pipeline that uses such shaders is created, the pipeline is first built from the
+    ///             unoptimized bytecode, while the bytecode is optimized in the background. Once the
+    ///             optimized pipeline is ready, it transparently replaces the original one, so that
+    ///             the following draw and dispatch commands use the optimized version.
+    ///             If shader bytecode cache is enabled, the optimized bytecode is added to the cache.
+    ///
+    ///             The option is ignored when there is no shader compilation thread pool
+    ///             (see EngineCreateInfo::NumAsyncShaderCompilationThreads). Shaders compiled with DXC
+    ///             and ray tracing pipelines are not affected.
+    Bool DeferSPIRVOptimization DEFAULT_INITIALIZER(False);
+
 #if DILIGENT_CPP_INTERFACE
     EngineVkCreateInfo() noexcept :
         EngineVkCreateInfo{EngineCreateInfo{}}
@@ -4153,6 +4430,16 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     ///  	        IDeviceContext::UpdateTexture(), or to map dynamic textures.
     Uint32 UploadHeapPageSize  DEFAULT_INITIALIZER(8 << 20);
 
+    /// Whether to write upload data directly to mapped upload heap pages.
+    ///
+    /// \remarks    By default, the data is written to a CPU-side copy of each upload heap page
+    ///             and is uploaded with wgpuQueueWriteBuffer(), which makes one more copy
+    ///             internally. When this flag is set, upload heap pages are created as
+    ///             mapped-at-creation staging buffers that are written directly, and are
+    ///             mapped again with wgpuBufferMapAsync() after they have been used by the GPU.
+    ///             This saves a copy on native implementations, but may be slower in browsers.
+    Bool UseMappedUploadPages  DEFAULT_INITIALIZER(False);
+
     /// The size of the dynamic heap (the buffer that is used to suballocate memory for dynamic resources).
     ///
     /// \remarks    The dynamic heap is used to allocate memory for dynamic
@@ -4167,6 +4454,17 @@ struct EngineWebGPUCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// the global dynamic heap to perform lock-free dynamic suballocations.
     Uint32 DynamicHeapPageSize DEFAULT_INITIALIZER(256 << 10);
 
+    /// The maximum number of bind groups that are kept in each bind group cache.
+    ///
+    /// \remarks    Every pipeline resource signature keeps a cache of bind groups for each
+    ///             of its bind group layouts. When a shader resource binding references a combination
+    ///             of resources that has been used before, the existing bind group is reused
+    ///             instead of creating a new one. Bind groups that are in use are never evicted;
+    ///             unused bind groups are released in least-recently-used order when the cache
+    ///             exceeds this size.
+    ///             If zero, bind groups are not cached.
+    Uint32 BindGroupCacheSize  DEFAULT_INITIALIZER(64);
+
     /// Query pool size for each query type.
     Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES]
 #if DILIGENT_CPP_INTERFACE
@@ -4779,15 +5077,21 @@ DILIGENT_TYPED_ENUM(STATE_TRANSITION_TYPE, Uint8)
     /// Perform state transition immediately.
     STATE_TRANSITION_TYPE_IMMEDIATE = 0,
 
-    /// Begin split barrier. This mode only has effect in Direct3D12 backend, and corresponds to
+    /// Begin split barrier. In Direct3D12 backend, this mode corresponds to
     /// [D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY](https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/ne-d3d12-d3d12_resource_barrier_flags)
     /// flag. See https://docs.microsoft.com/en-us/windows/desktop/direct3d12/using-resource-barriers-to-synchronize-resource-states-in-direct3d-12#split-barriers.
+    /// In Vulkan backend, the begin-split barrier sets an event (vkCmdSetEvent) that the end-split barrier waits for.
     /// In other backends, begin-split barriers are ignored.
+    ///
+    /// \remarks   Split barriers are only supported for textures and buffers. Every begin-split barrier
+    ///            must be followed by a matching end-split barrier with the same new state in the same
+    ///            command list, and the resource must not be transitioned in between.
     STATE_TRANSITION_TYPE_BEGIN,
 
-    /// End split barrier. This mode only has effect in Direct3D12 backend, and corresponds to
+    /// End split barrier. In Direct3D12 backend, this mode corresponds to
     /// [D3D12_RESOURCE_BARRIER_FLAG_END_ONLY](https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/ne-d3d12-d3d12_resource_barrier_flags)
     /// flag. See https://docs.microsoft.com/en-us/windows/desktop/direct3d12/using-resource-barriers-to-synchronize-resource-states-in-direct3d-12#split-barriers.
+    /// In Vulkan backend, the end-split barrier waits for the event set by the begin-split barrier (vkCmdWaitEvents).
     /// In other backends, this mode is similar to STATE_TRANSITION_TYPE_IMMEDIATE.
     STATE_TRANSITION_TYPE_END
 };
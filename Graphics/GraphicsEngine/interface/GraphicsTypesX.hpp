@@ -1537,6 +1537,12 @@ struct GraphicsPipelineStateCreateInfoX : PipelineStateCreateInfoX<GraphicsPipel
         return *this;
     }
 
+    GraphicsPipelineStateCreateInfoX& SetDynamicStateFlags(PIPELINE_DYNAMIC_STATE_FLAGS DynamicStateFlags) noexcept
+    {
+        GraphicsPipeline.DynamicStateFlags = DynamicStateFlags;
+        return *this;
+    }
+
     GraphicsPipelineStateCreateInfoX& AddRenderTarget(TEXTURE_FORMAT RTVFormat) noexcept
     {
         VERIFY_EXPR(GraphicsPipeline.NumRenderTargets < MAX_RENDER_TARGETS);
@@ -129,7 +129,17 @@ DILIGENT_TYPED_ENUM(PIPELINE_RESOURCE_FLAGS, Uint8)
     /// \note This flag is only valid in Vulkan.
     PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT = 1u << 4,
 
-    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT
+    /// Indicates that the constant buffer is set with inline constants through
+    /// IShaderResourceVariable::SetInlineConstants() rather than by binding a buffer.
+    /// Applies to SHADER_RESOURCE_TYPE_CONSTANT_BUFFER resources.
+    ///
+    /// \remarks   The engine allocates a dynamic buffer of MAX_INLINE_CONSTANTS 32-bit values
+    ///            for every shader resource binding and uploads the constants when the SRB is committed.
+    ///            The resource array size must be 1 and the variable type must not be static.
+    ///            The flag can't be combined with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS.
+    PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS   = 1u << 5,
+
+    PIPELINE_RESOURCE_FLAG_LAST               = PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_RESOURCE_FLAGS);
 
@@ -195,6 +195,44 @@ DILIGENT_TYPED_ENUM(PIPELINE_SHADING_RATE_FLAGS, Uint8)
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_SHADING_RATE_FLAGS);
 
+
+/// Pipeline state dynamic state flags.
+
+/// The flags indicate which states of the graphics pipeline are not baked into the pipeline
+/// and are instead set by IDeviceContext::SetDynamicRenderState().
+/// Dynamic states require DeviceFeatures::DynamicRenderState feature.
+DILIGENT_TYPED_ENUM(PIPELINE_DYNAMIC_STATE_FLAGS, Uint8)
+{
+    /// All states are defined by the pipeline description.
+    PIPELINE_DYNAMIC_STATE_FLAG_NONE               = 0,
+
+    /// RasterizerDesc.CullMode is ignored and DynamicRenderState::CullMode is used instead.
+    PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE          = 1u << 0u,
+
+    /// RasterizerDesc.FrontCounterClockwise is ignored and DynamicRenderState::FrontCounterClockwise is used instead.
+    PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE         = 1u << 1u,
+
+    /// DynamicRenderState::PrimitiveTopology is used instead of GraphicsPipelineDesc::PrimitiveTopology.
+    /// The topology must be of the same type (point, line, triangle) as the pipeline topology.
+    /// Patch list topologies must match the pipeline topology exactly.
+    /// This flag is not allowed in mesh pipelines.
+    PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY = 1u << 2u,
+
+    /// DepthStencilDesc.DepthEnable, DepthWriteEnable and DepthFunc are ignored, and the
+    /// corresponding members of DynamicRenderState::DepthStencilDesc are used instead.
+    PIPELINE_DYNAMIC_STATE_FLAG_DEPTH              = 1u << 3u,
+
+    /// DepthStencilDesc.StencilEnable, StencilReadMask, StencilWriteMask, FrontFace and BackFace
+    /// are ignored, and the corresponding members of DynamicRenderState::DepthStencilDesc are used instead.
+    PIPELINE_DYNAMIC_STATE_FLAG_STENCIL            = 1u << 4u,
+
+    PIPELINE_DYNAMIC_STATE_FLAG_LAST               = PIPELINE_DYNAMIC_STATE_FLAG_STENCIL,
+
+    /// All supported states are dynamic.
+    PIPELINE_DYNAMIC_STATE_FLAG_ALL                = (PIPELINE_DYNAMIC_STATE_FLAG_LAST << 1u) - 1u
+};
+DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_DYNAMIC_STATE_FLAGS);
+
 /// Pipeline layout description
 struct PipelineResourceLayoutDesc
 {
@@ -316,6 +354,10 @@ struct GraphicsPipelineDesc
     /// Shading rate flags that specify which type of the shading rate will be used with this pipeline.
     PIPELINE_SHADING_RATE_FLAGS ShadingRateFlags DEFAULT_INITIALIZER(PIPELINE_SHADING_RATE_FLAG_NONE);
 
+    /// Dynamic state flags that specify which states of this pipeline are set by
+    /// IDeviceContext::SetDynamicRenderState(), see Diligent::PIPELINE_DYNAMIC_STATE_FLAGS.
+    PIPELINE_DYNAMIC_STATE_FLAGS DynamicStateFlags DEFAULT_INITIALIZER(PIPELINE_DYNAMIC_STATE_FLAG_NONE);
+
     /// Render target formats.
     /// All formats must be TEX_FORMAT_UNKNOWN when pRenderPass is not null.
     TEXTURE_FORMAT RTVFormats[DILIGENT_MAX_RENDER_TARGETS] DEFAULT_INITIALIZER({});
@@ -353,6 +395,7 @@ struct GraphicsPipelineDesc
               NumRenderTargets  == Rhs.NumRenderTargets  &&
               SubpassIndex      == Rhs.SubpassIndex      &&
               ShadingRateFlags  == Rhs.ShadingRateFlags  &&
+              DynamicStateFlags == Rhs.DynamicStateFlags &&
               DSVFormat         == Rhs.DSVFormat         &&
               ReadOnlyDSV       == Rhs.ReadOnlyDSV    &&
               SmplDesc          == Rhs.SmplDesc          &&
@@ -661,7 +704,17 @@ DILIGENT_TYPED_ENUM(PSO_CREATE_FLAGS, Uint32)
     ///             the flag is ignored and the pipeline is created synchronously.
     PSO_CREATE_FLAG_ASYNCHRONOUS                      = 1u << 3u,
 
-    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_ASYNCHRONOUS
+    /// Build the graphics pipeline from shader objects.
+
+    /// \remarks    The flag requires DeviceFeatures::ShaderObjects feature and may only
+    ///             be used with graphics and mesh pipelines that do not use explicit render passes.
+    ///             Shader stages are compiled independently of the fixed-function state and are
+    ///             shared by all pipelines with the same shaders and resource signatures, so creating
+    ///             a pipeline that only differs from an existing one by render states does not
+    ///             compile any shaders. All render states are set dynamically when the pipeline is bound.
+    PSO_CREATE_FLAG_SHADER_OBJECTS                    = 1u << 4u,
+
+    PSO_CREATE_FLAG_LAST = PSO_CREATE_FLAG_SHADER_OBJECTS
 };
 DEFINE_FLAG_ENUM_OPERATORS(PSO_CREATE_FLAGS);
 
@@ -72,6 +72,8 @@ struct PipelineStateCacheDesc DILIGENT_DERIVE(DeviceObjectAttribs)
     ///       and loading PSOs from it on another.
     ///       Vulkan PSO cache depends on the GPU device, driver version and other parameters,
     ///       so the cache must be generated and used on the same device.
+    ///       OpenGL PSO cache contains linked program binaries and is only valid
+    ///       for the same GPU and driver version.
     PSO_CACHE_MODE Mode DEFAULT_INITIALIZER(PSO_CACHE_MODE_LOAD_STORE);
 
     /// PSO cache flags, see Diligent::PSO_CACHE_FLAGS.
@@ -91,6 +93,20 @@ struct PipelineStateCacheCreateInfo
 
     /// The size of data pointed to by pCacheData
     Uint32      CacheDataSize DEFAULT_INITIALIZER(0);
+
+    /// Path to the file that backs the cache, or null.
+
+    /// \remarks    This member is only used by Direct3D12 backend and is ignored by other backends.
+    ///             When the path is not null, pCacheData is ignored, and the pipeline library is
+    ///             loaded from the memory-mapped file. The file is validated against the adapter
+    ///             and is ignored if it was created on a different device. New pipelines are written
+    ///             back to the file as they are stored in the cache and when the cache is destroyed.
+    ///             The updated file is written next to the original one and replaces it when the cache
+    ///             is created next time.
+    ///
+    ///             GetPipelineStateCacheFilePath() from GraphicsTools returns the path next to the
+    ///             render state cache file.
+    const Char* FilePath      DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct PipelineStateCacheCreateInfo PipelineStateCacheCreateInfo;
 
@@ -60,6 +60,97 @@
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
+// clang-format off
+
+/// Memory heap statistics, see Diligent::DeviceMemoryStats.
+struct MemoryHeapStats
+{
+    /// The total size of memory allocated from the driver, in bytes.
+    Uint64 CommittedSize     DEFAULT_INITIALIZER(0);
+
+    /// The size of the committed memory that is used by resources, in bytes.
+    Uint64 UsedSize          DEFAULT_INITIALIZER(0);
+
+    /// The peak committed size, in bytes.
+    Uint64 PeakCommittedSize DEFAULT_INITIALIZER(0);
+
+    /// The peak used size, in bytes.
+    Uint64 PeakUsedSize      DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryHeapStats MemoryHeapStats;
+
+/// Descriptor heap statistics, see Diligent::DeviceMemoryStats.
+struct DescriptorHeapStats
+{
+    /// The number of allocated descriptors or descriptor sets.
+    Uint32 AllocatedCount DEFAULT_INITIALIZER(0);
+
+    /// The heap capacity. For heaps that grow on demand, this is
+    /// the capacity of the currently allocated pools.
+    Uint32 Capacity       DEFAULT_INITIALIZER(0);
+};
+typedef struct DescriptorHeapStats DescriptorHeapStats;
+
+/// Render device memory statistics, see IRenderDevice::GetMemoryStats().
+
+/// \remarks Resource totals are tracked by all backends and are estimated from
+///          the resource descriptions, not from the actual driver allocations.
+///          Heap statistics are only reported by backends that manage the memory
+///          themselves and are zero in other backends:
+///          - DeviceLocalMemory is reported by Direct3D12 and Vulkan backends. In Direct3D12 backend,
+///            it includes all heap pages used for placed resources.
+///          - HostVisibleMemory is reported by Vulkan backend.
+///          - DynamicMemory is reported by Vulkan backend.
+///          - ResourceDescriptors are reported by Direct3D12 (shader-visible CBV/SRV/UAV heap)
+///            and Vulkan (descriptor sets allocated from the main pool) backends.
+///          - SamplerDescriptors are reported by Direct3D12 backend (shader-visible sampler heap).
+struct DeviceMemoryStats
+{
+    /// The number of buffers.
+    Uint32 NumBuffers         DEFAULT_INITIALIZER(0);
+
+    /// The number of textures.
+    Uint32 NumTextures        DEFAULT_INITIALIZER(0);
+
+    /// The total size of all buffers, in bytes. Sparse buffers are not included.
+    Uint64 BufferMemorySize   DEFAULT_INITIALIZER(0);
+
+    /// The total size of all textures, in bytes. Sparse textures are not included.
+    Uint64 TextureMemorySize  DEFAULT_INITIALIZER(0);
+
+    /// Device-local memory allocated by the engine's memory manager.
+    MemoryHeapStats DeviceLocalMemory;
+
+    /// Host-visible memory allocated by the engine's memory manager.
+    MemoryHeapStats HostVisibleMemory;
+
+    /// Memory of the dynamic ring buffer that is used for dynamic resources and uploads.
+    MemoryHeapStats DynamicMemory;
+
+    /// Resource descriptor heap occupancy.
+    DescriptorHeapStats ResourceDescriptors;
+
+    /// Sampler descriptor heap occupancy.
+    DescriptorHeapStats SamplerDescriptors;
+
+    /// The number of pipeline states.
+    Uint32 NumPipelineStates            DEFAULT_INITIALIZER(0);
+
+    /// The total CPU memory used by the pipeline state objects and their descriptions, in bytes.
+
+    /// Input and resource layouts are shared between pipelines and are not included,
+    /// see SharedPipelineDescMemorySize. Backend-specific objects (e.g. root signatures,
+    /// shader bytecode) are not included either.
+    Uint64 PipelineStateMemorySize      DEFAULT_INITIALIZER(0);
+
+    /// The CPU memory used by the input and resource layouts that are shared between
+    /// pipeline states, in bytes.
+    Uint64 SharedPipelineDescMemorySize DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceMemoryStats DeviceMemoryStats;
+
+// clang-format on
+
 // {F0E9B607-AE33-4B2B-B1AF-A8B2C3104022}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDevice =
     {0xf0e9b607, 0xae33, 0x4b2b, {0xb1, 0xaf, 0xa8, 0xb2, 0xc3, 0x10, 0x40, 0x22}};
@@ -394,6 +485,31 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     VIRTUAL void METHOD(IdleGPU)(THIS) PURE;
 
 
+    /// Waits until one or all fences reach or exceed the specified values, on the host.
+
+    /// \param [in] ppFences  - An array of NumFences fences to wait for.
+    /// \param [in] pValues   - An array of NumFences values. The i-th fence is waited for to reach pValues[i].
+    /// \param [in] NumFences - The number of fences.
+    /// \param [in] WaitAll   - If true, the method waits for all fences to reach their values.
+    ///                         Otherwise, the method returns when any of the fences reaches its value.
+    /// \param [in] Timeout   - Timeout in nanoseconds. Use ~Uint64{0} to wait indefinitely.
+    ///
+    /// \return    true if the wait condition has been satisfied, and false if the timeout has expired.
+    ///
+    /// \remarks   In Direct3D12 backend, the method uses ID3D12Device1::SetEventOnMultipleFenceCompletion.
+    ///            In Vulkan backend, the method uses vkWaitSemaphores if all fences are timeline semaphores
+    ///            (NativeFence feature is enabled). In other cases, fence values are polled.
+    ///
+    ///            All fences must have been created by this device, and the commands that signal
+    ///            them must have been submitted for execution (see IDeviceContext::Flush()).
+    VIRTUAL Bool METHOD(WaitForFences)(THIS_
+                                       IFence* const* ppFences,
+                                       const Uint64*  pValues,
+                                       Uint32         NumFences,
+                                       Bool           WaitAll,
+                                       Uint64         Timeout) PURE;
+
+
     /// Returns engine factory this device was created from.
     /// \remarks This method does not increment the reference counter of the returned interface,
     ///          so an application should not call Release().
@@ -405,6 +521,16 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     ///          so an application should not call Release().
     VIRTUAL IThreadPool* METHOD(GetShaderCompilationThreadPool)(THIS) CONST PURE;
 
+
+    /// Returns the device memory statistics, see Diligent::DeviceMemoryStats.
+
+    /// \param [out] Stats - Memory statistics.
+    ///
+    /// \remarks The method only reads internal counters and is cheap enough
+    ///          to be called every frame.
+    VIRTUAL void METHOD(GetMemoryStats)(THIS_
+                                        DeviceMemoryStats REF Stats) PURE;
+
 #if DILIGENT_CPP_INTERFACE
     /// Overloaded alias for CreateGraphicsPipelineState.
     void CreatePipelineState(const GraphicsPipelineStateCreateInfo& CI, IPipelineState** ppPipelineState)
@@ -459,8 +585,10 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_GetSparseTextureFormatInfo(This, ...)      CALL_IFACE_METHOD(RenderDevice, GetSparseTextureFormatInfo,      This, __VA_ARGS__)
 #    define IRenderDevice_ReleaseStaleResources(This, ...)           CALL_IFACE_METHOD(RenderDevice, ReleaseStaleResources,           This, __VA_ARGS__)
 #    define IRenderDevice_IdleGPU(This)                              CALL_IFACE_METHOD(RenderDevice, IdleGPU,                         This)
+#    define IRenderDevice_WaitForFences(This, ...)                   CALL_IFACE_METHOD(RenderDevice, WaitForFences,                   This, __VA_ARGS__)
 #    define IRenderDevice_GetEngineFactory(This)                     CALL_IFACE_METHOD(RenderDevice, GetEngineFactory,                This)
 #    define IRenderDevice_GetShaderCompilationThreadPool(This)       CALL_IFACE_METHOD(RenderDevice, GetShaderCompilationThreadPool,  This)
+#    define IRenderDevice_GetMemoryStats(This, ...)                  CALL_IFACE_METHOD(RenderDevice, GetMemoryStats,                  This, __VA_ARGS__)
 // clang-format on
 
 #endif
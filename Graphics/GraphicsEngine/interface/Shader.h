@@ -1051,6 +1051,14 @@ DILIGENT_BEGIN_INTERFACE(IShader, IDeviceObject)
     /// \return     The shader status.
     VIRTUAL SHADER_STATUS METHOD(GetStatus)(THIS_
                                             bool WaitForCompletion DEFAULT_VALUE(false)) PURE;
+
+    /// Returns the time, in seconds, it took to compile the shader source.
+    ///
+    /// \remarks The time is zero if the shader was created from bytecode, was found
+    ///          in the bytecode cache, or if its compilation has not finished yet.
+    ///          For OpenGL, this is the time spent in glCompileShader, which may
+    ///          not include the time the driver defers until the status is queried.
+    VIRTUAL Float64 METHOD(GetCompileTime)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -1067,6 +1075,7 @@ DILIGENT_END_INTERFACE
 #    define IShader_GetConstantBufferDesc(This, ...) CALL_IFACE_METHOD(Shader, GetConstantBufferDesc,  This, __VA_ARGS__)
 #    define IShader_GetBytecode(This, ...)           CALL_IFACE_METHOD(Shader, GetBytecode,      This, __VA_ARGS__)
 #    define IShader_GetStatus(This, ...)             CALL_IFACE_METHOD(Shader, GetStatus,        This, __VA_ARGS__)
+#    define IShader_GetCompileTime(This)             CALL_IFACE_METHOD(Shader, GetCompileTime,   This)
 
 // clang-format on
 
@@ -242,6 +242,35 @@ DILIGENT_BEGIN_INTERFACE(IShaderBindingTable, IDeviceObject)
                                                  Uint32       DataSize         DEFAULT_INITIALIZER(0)) PURE;
 
 
+    /// Binds a hit group for all geometries in the instance with the specified index.
+
+    /// \param [in] pTLAS                    - Top-level AS that contains the given instance.
+    /// \param [in] InstanceIndex            - Instance index, for which to bind the hit group. This is the index of
+    ///                                        the instance in BuildTLASAttribs::pInstances array that was used to build the TLAS.
+    /// \param [in] RayOffsetInHitGroupIndex - Ray offset in the shader binding table (aka ray type). This offset will
+    ///                                        correspond to 'RayContributionToHitGroupIndex' argument of TraceRay() function
+    ///                                        in HLSL, and 'sbtRecordOffset' argument of traceRay() function in GLSL.
+    ///                                        Must be less than HitShadersPerInstance.
+    /// \param [in] pShaderGroupName         - Hit group name that was specified in RayTracingTriangleHitShaderGroup::Name or
+    ///                                        RayTracingProceduralHitShaderGroup::Name when the pipeline state was created.
+    ///                                        Can be null to make the shader group inactive.
+    /// \param [in] pData                    - Shader record data, can be null.
+    /// \param [in] DataSize                 - Shader record data size, should be equal to RayTracingPipelineDesc::ShaderRecordSize.
+    ///
+    /// \remarks This method is the only way to bind hit groups for unnamed instances (see TLASBuildInstanceData::InstanceName).
+    ///
+    /// \note Access to the SBT and TLAS must be externally synchronized.
+    ///       The function does not modify the data used by IDeviceContext::TraceRays() and
+    ///       IDeviceContext::TraceRaysIndirect() commands, so they can run in parallel.
+    VIRTUAL void METHOD(BindHitGroupForInstanceByIndex)(THIS_
+                                                        ITopLevelAS* pTLAS,
+                                                        Uint32       InstanceIndex,
+                                                        Uint32       RayOffsetInHitGroupIndex,
+                                                        const Char*  pShaderGroupName,
+                                                        const void*  pData            DEFAULT_INITIALIZER(nullptr),
+                                                        Uint32       DataSize         DEFAULT_INITIALIZER(0)) PURE;
+
+
     /// Binds a hit group for all instances in the given top-level AS.
 
     /// \param [in] pTLAS                    - Top-level AS, for which to bind the hit group.
@@ -295,16 +324,17 @@ DILIGENT_END_INTERFACE
 
 #    define IShaderBindingTable_GetDesc(This) (const struct ShaderBindingTableDesc*)IDeviceObject_GetDesc(This)
 
-#    define IShaderBindingTable_Verify(This, ...)                  CALL_IFACE_METHOD(ShaderBindingTable, Verify,                  This, __VA_ARGS__)
-#    define IShaderBindingTable_Reset(This, ...)                   CALL_IFACE_METHOD(ShaderBindingTable, Reset,                   This, __VA_ARGS__)
-#    define IShaderBindingTable_ResetHitGroups(This)               CALL_IFACE_METHOD(ShaderBindingTable, ResetHitGroups,          This)
-#    define IShaderBindingTable_BindRayGenShader(This, ...)        CALL_IFACE_METHOD(ShaderBindingTable, BindRayGenShader,        This, __VA_ARGS__)
-#    define IShaderBindingTable_BindMissShader(This, ...)          CALL_IFACE_METHOD(ShaderBindingTable, BindMissShader,          This, __VA_ARGS__)
-#    define IShaderBindingTable_BindHitGroupByIndex(This, ...)     CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupByIndex,     This, __VA_ARGS__)
-#    define IShaderBindingTable_BindHitGroupForGeometry(This, ...) CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForGeometry, This, __VA_ARGS__)
-#    define IShaderBindingTable_BindHitGroupForInstance(This, ...) CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForInstance, This, __VA_ARGS__)
-#    define IShaderBindingTable_BindHitGroupForTLAS(This, ...)     CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForTLAS,     This, __VA_ARGS__)
-#    define IShaderBindingTable_BindCallableShader(This, ...)      CALL_IFACE_METHOD(ShaderBindingTable, BindCallableShader,      This, __VA_ARGS__)
+#    define IShaderBindingTable_Verify(This, ...)                         CALL_IFACE_METHOD(ShaderBindingTable, Verify,                         This, __VA_ARGS__)
+#    define IShaderBindingTable_Reset(This, ...)                          CALL_IFACE_METHOD(ShaderBindingTable, Reset,                          This, __VA_ARGS__)
+#    define IShaderBindingTable_ResetHitGroups(This)                      CALL_IFACE_METHOD(ShaderBindingTable, ResetHitGroups,                 This)
+#    define IShaderBindingTable_BindRayGenShader(This, ...)               CALL_IFACE_METHOD(ShaderBindingTable, BindRayGenShader,               This, __VA_ARGS__)
+#    define IShaderBindingTable_BindMissShader(This, ...)                 CALL_IFACE_METHOD(ShaderBindingTable, BindMissShader,                 This, __VA_ARGS__)
+#    define IShaderBindingTable_BindHitGroupByIndex(This, ...)            CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupByIndex,            This, __VA_ARGS__)
+#    define IShaderBindingTable_BindHitGroupForGeometry(This, ...)        CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForGeometry,        This, __VA_ARGS__)
+#    define IShaderBindingTable_BindHitGroupForInstance(This, ...)        CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForInstance,        This, __VA_ARGS__)
+#    define IShaderBindingTable_BindHitGroupForInstanceByIndex(This, ...) CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForInstanceByIndex, This, __VA_ARGS__)
+#    define IShaderBindingTable_BindHitGroupForTLAS(This, ...)            CALL_IFACE_METHOD(ShaderBindingTable, BindHitGroupForTLAS,            This, __VA_ARGS__)
+#    define IShaderBindingTable_BindCallableShader(This, ...)             CALL_IFACE_METHOD(ShaderBindingTable, BindCallableShader,             This, __VA_ARGS__)
 
 // clang-format on
 
@@ -40,6 +40,71 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct IPipelineState;
 struct IPipelineResourceSignature;
 
+/// Describes a single variable update performed by IShaderResourceBinding::SetVariables().
+struct ShaderVariableUpdate
+{
+    // clang-format off
+
+    /// Type of the shader stage the variable is defined in.
+    /// Must be one of Diligent::SHADER_TYPE.
+    SHADER_TYPE ShaderType          DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Variable name. If null, the variable is identified by VariableIndex.
+    const Char* Name                DEFAULT_INITIALIZER(nullptr);
+
+    /// Variable index, see IShaderResourceVariable::GetIndex().
+    /// This member is ignored if Name is not null.
+    Uint32 VariableIndex            DEFAULT_INITIALIZER(0);
+
+    /// The first array element to set.
+    Uint32 FirstElement             DEFAULT_INITIALIZER(0);
+
+    /// The number of objects in ppObjects array.
+    Uint32 NumElements              DEFAULT_INITIALIZER(1);
+
+    /// A pointer to the array of objects to bind to the variable.
+    IDeviceObject* const* ppObjects DEFAULT_INITIALIZER(nullptr);
+
+    /// Flags, see Diligent::SET_SHADER_RESOURCE_FLAGS.
+    SET_SHADER_RESOURCE_FLAGS Flags DEFAULT_INITIALIZER(SET_SHADER_RESOURCE_FLAG_NONE);
+
+#if DILIGENT_CPP_INTERFACE
+    constexpr ShaderVariableUpdate() noexcept {}
+
+    /// Initializes the structure members to set a single object to the variable with the given name.
+    constexpr ShaderVariableUpdate(SHADER_TYPE               _ShaderType,
+                                   const Char*               _Name,
+                                   IDeviceObject* const*     _ppObjects,
+                                   Uint32                    _NumElements  = 1,
+                                   Uint32                    _FirstElement = 0,
+                                   SET_SHADER_RESOURCE_FLAGS _Flags        = SET_SHADER_RESOURCE_FLAG_NONE) noexcept :
+        ShaderType  {_ShaderType  },
+        Name        {_Name        },
+        FirstElement{_FirstElement},
+        NumElements {_NumElements },
+        ppObjects   {_ppObjects   },
+        Flags       {_Flags       }
+    {}
+
+    /// Initializes the structure members to set objects to the variable with the given index.
+    constexpr ShaderVariableUpdate(SHADER_TYPE               _ShaderType,
+                                   Uint32                    _VariableIndex,
+                                   IDeviceObject* const*     _ppObjects,
+                                   Uint32                    _NumElements  = 1,
+                                   Uint32                    _FirstElement = 0,
+                                   SET_SHADER_RESOURCE_FLAGS _Flags        = SET_SHADER_RESOURCE_FLAG_NONE) noexcept :
+        ShaderType   {_ShaderType   },
+        VariableIndex{_VariableIndex},
+        FirstElement {_FirstElement },
+        NumElements  {_NumElements  },
+        ppObjects    {_ppObjects    },
+        Flags        {_Flags        }
+    {}
+#endif
+    // clang-format on
+};
+typedef struct ShaderVariableUpdate ShaderVariableUpdate;
+
 // {061F8774-9A09-48E8-8411-B5BD20560104}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_ShaderResourceBinding =
     {0x61f8774, 0x9a09, 0x48e8, {0x84, 0x11, 0xb5, 0xbd, 0x20, 0x56, 0x1, 0x4}};
@@ -145,12 +210,31 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
     ///
     /// \note   This operation may potentially be expensive. If the variable will be used often, it is
     ///         recommended to store and reuse the pointer as it never changes.
+    ///
+    /// \remark The variable index is the same in all SRBs created from the same resource signature.
+    ///         An index resolved once from the variable name (see IShaderResourceVariable::GetIndex)
+    ///         can thus be used to access the variable in every such SRB without a name lookup.
     VIRTUAL IShaderResourceVariable* METHOD(GetVariableByIndex)(THIS_
                                                                 SHADER_TYPE ShaderType,
                                                                 Uint32      Index) PURE;
 
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
+
+
+    /// Sets resources for multiple variables in one call.
+
+    /// \param [in] pUpdates   - A pointer to the array of variable updates, see Diligent::ShaderVariableUpdate.
+    /// \param [in] NumUpdates - The number of elements in pUpdates array.
+    ///
+    /// \remarks The result is the same as calling IShaderResourceVariable::SetArray() for every
+    ///          update in the array, but the resource cache is updated in one pass, and backends
+    ///          combine descriptor writes where possible (e.g. the Vulkan backend issues a single
+    ///          vkUpdateDescriptorSets call for all updates).
+    ///          Updates that reference variables that do not exist are skipped.
+    VIRTUAL void METHOD(SetVariables)(THIS_
+                                      const ShaderVariableUpdate* pUpdates,
+                                      Uint32                      NumUpdates) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -167,6 +251,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
+#    define IShaderResourceBinding_SetVariables(This, ...)            CALL_IFACE_METHOD(ShaderResourceBinding, SetVariables,                 This, __VA_ARGS__)
 
 // clang-format on
 
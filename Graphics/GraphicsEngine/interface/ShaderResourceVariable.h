@@ -250,6 +250,26 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceVariable, IObject)
                                          Uint32 ArrayIndex DEFAULT_VALUE(0)) PURE;
 
 
+    /// Sets the inline constants of the constant buffer variable
+
+    /// \param [in] pConstants    - a pointer to the 32-bit constant values.
+    /// \param [in] FirstConstant - index of the first 32-bit constant to set.
+    /// \param [in] NumConstants  - the number of 32-bit constants to set.
+    ///
+    /// \remarks This method is only allowed for variables created with
+    ///          PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS flag. FirstConstant + NumConstants
+    ///          must not exceed MAX_INLINE_CONSTANTS.
+    ///
+    ///          The constants are written to the GPU when the SRB is committed, so the SRB
+    ///          must be committed again after the constants are changed. Like other dynamic
+    ///          buffers, the SRB must also be committed at least once in every frame it is used.
+    ///          Constants that were not set are undefined.
+    VIRTUAL void METHOD(SetInlineConstants)(THIS_
+                                            const void* pConstants,
+                                            Uint32      FirstConstant,
+                                            Uint32      NumConstants) PURE;
+
+
     /// Returns the shader resource variable type
     VIRTUAL SHADER_RESOURCE_VARIABLE_TYPE METHOD(GetType)(THIS) CONST PURE;
 
@@ -281,11 +301,12 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceVariable_Set(This, ...)             CALL_IFACE_METHOD(ShaderResourceVariable, Set,             This, __VA_ARGS__)
 #    define IShaderResourceVariable_SetArray(This, ...)        CALL_IFACE_METHOD(ShaderResourceVariable, SetArray,        This, __VA_ARGS__)
 #    define IShaderResourceVariable_SetBufferRange(This, ...)  CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferRange,  This, __VA_ARGS__)
-#    define IShaderResourceVariable_SetBufferOffset(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferOffset, This, __VA_ARGS__)
-#    define IShaderResourceVariable_GetType(This)              CALL_IFACE_METHOD(ShaderResourceVariable, GetType,         This)
-#    define IShaderResourceVariable_GetResourceDesc(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, GetResourceDesc, This, __VA_ARGS__)
-#    define IShaderResourceVariable_GetIndex(This)             CALL_IFACE_METHOD(ShaderResourceVariable, GetIndex,        This)
-#    define IShaderResourceVariable_Get(This, ...)             CALL_IFACE_METHOD(ShaderResourceVariable, Get,             This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetBufferOffset(This, ...)    CALL_IFACE_METHOD(ShaderResourceVariable, SetBufferOffset,    This, __VA_ARGS__)
+#    define IShaderResourceVariable_SetInlineConstants(This, ...) CALL_IFACE_METHOD(ShaderResourceVariable, SetInlineConstants, This, __VA_ARGS__)
+#    define IShaderResourceVariable_GetType(This)                 CALL_IFACE_METHOD(ShaderResourceVariable, GetType,            This)
+#    define IShaderResourceVariable_GetResourceDesc(This, ...)    CALL_IFACE_METHOD(ShaderResourceVariable, GetResourceDesc,    This, __VA_ARGS__)
+#    define IShaderResourceVariable_GetIndex(This)                CALL_IFACE_METHOD(ShaderResourceVariable, GetIndex,           This)
+#    define IShaderResourceVariable_Get(This, ...)                CALL_IFACE_METHOD(ShaderResourceVariable, Get,                This, __VA_ARGS__)
 
 // clang-format on
 
@@ -41,6 +41,32 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_SwapChain =
     {0x1c703b77, 0x6607, 0x4eec, {0xb1, 0xfe, 0x15, 0xc8, 0x2d, 0x3b, 0x41, 0x30}};
 
+/// Swap chain statistics.
+
+/// Frame latency is the time between the moment when ISwapChain::Present() returns control to the
+/// application for a frame and the moment when this frame is presented. It approximates the
+/// input-to-present latency of an application that samples the input at the start of each frame.
+///
+/// \remarks Latency is measured by Direct3D11 and Direct3D12 swap chains when the
+///          presentation statistics are available, and by Vulkan swap chains when
+///          VK_KHR_present_wait extension is supported. Other swap chains do not
+///          measure the latency and all members are zero.
+struct SwapChainStats
+{
+    /// The number of frames for which the latency was measured.
+    Uint64 NumLatencySamples  DEFAULT_INITIALIZER(0);
+
+    /// The latency of the most recently measured frame, in seconds.
+    Float64 LastFrameLatency  DEFAULT_INITIALIZER(0);
+
+    /// The exponential moving average of the frame latency, in seconds.
+    Float64 AvgFrameLatency   DEFAULT_INITIALIZER(0);
+
+    /// The maximum measured frame latency, in seconds.
+    Float64 MaxFrameLatency   DEFAULT_INITIALIZER(0);
+};
+typedef struct SwapChainStats SwapChainStats;
+
 #define DILIGENT_INTERFACE_NAME ISwapChain
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -91,7 +117,8 @@ DILIGENT_BEGIN_INTERFACE(ISwapChain, IObject)
 
     /// Sets the maximum number of frames that the swap chain is allowed to queue for rendering.
 
-    /// This value is only relevant for D3D11 and D3D12 backends and ignored for others.
+    /// This value is only relevant for D3D11, D3D12 and Vulkan backends and ignored for others.
+    /// Vulkan backend only limits the frame latency when VK_KHR_present_wait extension is supported.
     /// By default it matches the number of buffers in the swap chain. For example, for a 2-buffer
     /// swap chain, the CPU can enqueue frames 0 and 1, but Present command of frame 2
     /// will block until frame 0 is presented. If in the example above the maximum frame latency is set
@@ -116,6 +143,9 @@ DILIGENT_BEGIN_INTERFACE(ISwapChain, IObject)
     /// The method does *NOT* increment the reference counter of the returned object,
     /// so Release() must not be called.
     VIRTUAL ITextureView* METHOD(GetDepthBufferDSV)(THIS) PURE;
+
+    /// Returns the swap chain statistics, see Diligent::SwapChainStats.
+    VIRTUAL const SwapChainStats REF METHOD(GetStats)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -133,6 +163,7 @@ DILIGENT_END_INTERFACE
 #    define ISwapChain_SetMaximumFrameLatency(This, ...) CALL_IFACE_METHOD(SwapChain, SetMaximumFrameLatency,  This, __VA_ARGS__)
 #    define ISwapChain_GetCurrentBackBufferRTV(This)     CALL_IFACE_METHOD(SwapChain, GetCurrentBackBufferRTV, This)
 #    define ISwapChain_GetDepthBufferDSV(This)           CALL_IFACE_METHOD(SwapChain, GetDepthBufferDSV,       This)
+#    define ISwapChain_GetStats(This)                    CALL_IFACE_METHOD(SwapChain, GetStats,                This)
 
 // clang-format on
 
@@ -72,7 +72,35 @@ DILIGENT_TYPED_ENUM(MISC_TEXTURE_FLAGS, Uint8)
     /// Requires SHADING_RATE_CAP_FLAG_SUBSAMPLED_RENDER_TARGET capability.
     /// 
     /// \note  Copy operations are not supported for subsampled textures.
-    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3
+    MISC_TEXTURE_FLAG_SUBSAMPLED      = 1u << 3,
+
+    /// The contents of the render target or depth-stencil texture are only needed while it is
+    /// bound with IDeviceContext::SetRenderTargets() and are not preserved between
+    /// render pass instances that the engine begins for the bound render targets.
+
+    /// \note  Tile-based GPUs then neither load the texture contents into the tile memory
+    ///        nor write them back to memory. The contents are undefined after the render targets
+    ///        are changed as well as after any command that interrupts rendering, such as a copy,
+    ///        a dispatch or a resource state transition. The flag is honored by Vulkan and WebGPU
+    ///        backends and is ignored by other backends.
+    MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT = 1u << 4,
+
+    /// ITexture::CreateView() returns the existing view if a view with the same
+    /// description (ignoring the name) has been created before and is still alive.
+
+    /// \note  The texture holds weak references to the views, so the views are released as usual.
+    ///        Since the views are shared, the returned view may have a different name.
+    ///        The flag is useful when the same views are requested many times, for example
+    ///        by a material system, as it saves view creation time and descriptor heap space.
+    MISC_TEXTURE_FLAG_CACHE_VIEWS = 1u << 5,
+
+    /// Create all default views when the texture is created.
+
+    /// By default, every default view is created by the first ITexture::GetDefaultView()
+    /// call for its view type, so that the views that are never used do not take
+    /// descriptor heap space. Use this flag to move the view creation cost to the
+    /// texture creation.
+    MISC_TEXTURE_FLAG_EAGER_DEFAULT_VIEWS = 1u << 6
 };
 DEFINE_FLAG_ENUM_OPERATORS(MISC_TEXTURE_FLAGS)
 
@@ -457,6 +485,10 @@ DILIGENT_BEGIN_INTERFACE(ITexture, IDeviceObject)
     ///
     /// \note The function does not increase the reference counter for the returned interface, so
     ///       Release() must *NOT* be called.
+    ///
+    /// \remarks Unless the texture was created with MISC_TEXTURE_FLAG_EAGER_DEFAULT_VIEWS flag,
+    ///          the view is created by the first call of this method for the view type.
+    ///          The method is thread-safe.
     VIRTUAL ITextureView* METHOD(GetDefaultView)(THIS_
                                                  TEXTURE_VIEW_TYPE ViewType) PURE;
 
@@ -175,6 +175,21 @@ DILIGENT_BEGIN_INTERFACE(ITopLevelAS, IDeviceObject)
                                                      const Char* Name) CONST PURE;
 
 
+    /// Returns instance description that can be used in shader binding table.
+
+    /// \param [in] InstanceIndex - Instance index, which is the index of the instance in
+    ///                             BuildTLASAttribs::pInstances array that was used to build the TLAS.
+    /// \return TLASInstanceDesc object, see Diligent::TLASInstanceDesc.
+    ///         If instance does not exist then TLASInstanceDesc::ContributionToHitGroupIndex
+    ///         and TLASInstanceDesc::InstanceIndex are set to INVALID_INDEX.
+    ///
+    /// \remarks This method works for both named and unnamed instances (see TLASBuildInstanceData::InstanceName).
+    ///
+    /// \note Access to the TLAS must be externally synchronized.
+    VIRTUAL TLASInstanceDesc METHOD(GetInstanceDescByIndex)(THIS_
+                                                            Uint32 InstanceIndex) CONST PURE;
+
+
     /// Returns TLAS state after the last build or update operation.
 
     /// \return TLASBuildInfo object, see Diligent::TLASBuildInfo.
@@ -220,12 +235,13 @@ DILIGENT_END_INTERFACE
 
 #    define ITopLevelAS_GetDesc(This) (const struct TopLevelASDesc*)IDeviceObject_GetDesc(This)
 
-#    define ITopLevelAS_GetInstanceDesc(This, ...)  CALL_IFACE_METHOD(TopLevelAS, GetInstanceDesc,       This, __VA_ARGS__)
-#    define ITopLevelAS_GetBuildInfo(This)          CALL_IFACE_METHOD(TopLevelAS, GetBuildInfo,          This)
-#    define ITopLevelAS_GetScratchBufferSizes(This) CALL_IFACE_METHOD(TopLevelAS, GetScratchBufferSizes, This)
-#    define ITopLevelAS_GetNativeHandle(This)       CALL_IFACE_METHOD(TopLevelAS, GetNativeHandle,       This)
-#    define ITopLevelAS_SetState(This, ...)         CALL_IFACE_METHOD(TopLevelAS, SetState,              This, __VA_ARGS__)
-#    define ITopLevelAS_GetState(This)              CALL_IFACE_METHOD(TopLevelAS, GetState,              This)
+#    define ITopLevelAS_GetInstanceDesc(This, ...)        CALL_IFACE_METHOD(TopLevelAS, GetInstanceDesc,        This, __VA_ARGS__)
+#    define ITopLevelAS_GetInstanceDescByIndex(This, ...) CALL_IFACE_METHOD(TopLevelAS, GetInstanceDescByIndex, This, __VA_ARGS__)
+#    define ITopLevelAS_GetBuildInfo(This)                CALL_IFACE_METHOD(TopLevelAS, GetBuildInfo,           This)
+#    define ITopLevelAS_GetScratchBufferSizes(This)       CALL_IFACE_METHOD(TopLevelAS, GetScratchBufferSizes,  This)
+#    define ITopLevelAS_GetNativeHandle(This)             CALL_IFACE_METHOD(TopLevelAS, GetNativeHandle,        This)
+#    define ITopLevelAS_SetState(This, ...)               CALL_IFACE_METHOD(TopLevelAS, SetState,               This, __VA_ARGS__)
+#    define ITopLevelAS_GetState(This)                    CALL_IFACE_METHOD(TopLevelAS, GetState,               This)
 
 // clang-format on
 
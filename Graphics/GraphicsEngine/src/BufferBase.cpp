@@ -164,6 +164,11 @@ void ValidateBufferDesc(const BufferDesc& Desc, const IRenderDevice* pDevice) no
         VERIFY_BUFFER((Desc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING) == 0,
                       "MiscFlags must not have MISC_BUFFER_FLAG_SPARSE_ALIASING if usage is not USAGE_SPARSE");
     }
+
+    VERIFY_BUFFER((Desc.MiscFlags & MISC_BUFFER_FLAG_PERSISTENT_MAP) == 0 || Desc.Usage == USAGE_DYNAMIC,
+                  "MiscFlags must not have MISC_BUFFER_FLAG_PERSISTENT_MAP if usage is not USAGE_DYNAMIC");
+    VERIFY_BUFFER((Desc.MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) == 0 || Desc.Usage == USAGE_DEFAULT,
+                  "MiscFlags must not have MISC_BUFFER_FLAG_DIRECT_UPDATES if usage is not USAGE_DEFAULT");
 }
 
 void ValidateBufferInitData(const BufferDesc& Desc, const BufferData* pBuffData) noexcept(false)
@@ -27,6 +27,7 @@
 #include "DearchiverBase.hpp"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -426,7 +427,20 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
             LOG_ERROR_MESSAGE("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
             return false;
         }
-        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+
+        if (!Ser.IsEnded())
+        {
+            // Backend-specific pipeline data
+            SerializedData DeviceData;
+            if (!Ser.Serialize(DeviceData))
+            {
+                LOG_ERROR_MESSAGE("Failed to deserialize PSO device data. Archive file may be corrupted or invalid.");
+                return false;
+            }
+            if (!UnpackPSODeviceData(DeviceData, pDevice))
+                return false;
+        }
+        VERIFY(Ser.IsEnded(), "No other data besides shader indices and device data is expected");
     }
 
     auto& ShaderCache = Archive.CachedShaders[static_cast<size_t>(DevType)];
@@ -591,7 +605,8 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
 
 template <typename CreateInfoType>
 void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
-                                             IPipelineState**               ppPSO)
+                                             IPipelineState**               ppPSO,
+                                             PSO_CREATE_FLAGS               CreateFlags)
 {
     VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
 
@@ -638,6 +653,7 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
     PSO.CreateInfo.PSODesc.SRBAllocationGranularity = UnpackInfo.SRBAllocationGranularity;
     PSO.CreateInfo.PSODesc.ImmediateContextMask     = UnpackInfo.ImmediateContextMask;
     PSO.CreateInfo.pPSOCache                        = UnpackInfo.pCache;
+    PSO.CreateInfo.Flags |= CreateFlags;
 
     if (!ModifyPipelineStateCreateInfo(PSO.CreateInfo, UnpackInfo))
         return;
@@ -691,35 +707,48 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
         }
     }
 
-    m_Archives.emplace_back(std::move(pObjArchive));
+    if (m_pThreadPool && m_DeviceType != DeviceType::Count && !pObjArchive->AreDeviceShadersLoaded(m_DeviceType))
+    {
+        // Parse and decompress the shaders in the background so that they are
+        // ready by the time the first object is unpacked.
+        const DeviceObjectArchive* pArchive = pObjArchive.get();
+        const DeviceType           DevType  = m_DeviceType;
+
+        ArchiveData Archive{std::move(pObjArchive)};
+        Archive.pLoadShadersTask = EnqueueAsyncWork(m_pThreadPool,
+                                                    [pArchive, DevType](Uint32 ThreadId) {
+                                                        pArchive->GetDeviceShaders(DevType);
+                                                        return ASYNC_TASK_STATUS_COMPLETE;
+                                                    });
+        m_Archives.emplace_back(std::move(Archive));
+    }
+    else
+    {
+        m_Archives.emplace_back(std::move(pObjArchive));
+    }
 
     return true;
 }
 
-void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO)
+void DearchiverBase::UnpackPipelineStateInternal(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO, PSO_CREATE_FLAGS CreateFlags)
 {
-    if (!VerifyPipelineStateUnpackInfo(UnpackInfo, ppPSO))
-        return;
-
-    *ppPSO = nullptr;
-
     switch (UnpackInfo.PipelineType)
     {
         case PIPELINE_TYPE_GRAPHICS:
         case PIPELINE_TYPE_MESH:
-            UnpackPipelineStateImpl<GraphicsPipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<GraphicsPipelineStateCreateInfo>(UnpackInfo, ppPSO, CreateFlags);
             break;
 
         case PIPELINE_TYPE_COMPUTE:
-            UnpackPipelineStateImpl<ComputePipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<ComputePipelineStateCreateInfo>(UnpackInfo, ppPSO, CreateFlags);
             break;
 
         case PIPELINE_TYPE_RAY_TRACING:
-            UnpackPipelineStateImpl<RayTracingPipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<RayTracingPipelineStateCreateInfo>(UnpackInfo, ppPSO, CreateFlags);
             break;
 
         case PIPELINE_TYPE_TILE:
-            UnpackPipelineStateImpl<TilePipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<TilePipelineStateCreateInfo>(UnpackInfo, ppPSO, CreateFlags);
             break;
 
         case PIPELINE_TYPE_INVALID:
@@ -729,6 +758,115 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO)
+{
+    DILIGENT_PROFILE_FUNCTION();
+
+    if (!VerifyPipelineStateUnpackInfo(UnpackInfo, ppPSO))
+        return;
+
+    *ppPSO = nullptr;
+
+    UnpackPipelineStateInternal(UnpackInfo, ppPSO, PSO_CREATE_FLAG_NONE);
+}
+
+template <typename CreateInfoType>
+void DearchiverBase::UnpackPSODependencies(const PipelineStateUnpackInfo&             UnpackInfo,
+                                           std::vector<RefCntAutoPtr<IDeviceObject>>& Objects)
+{
+    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
+
+    auto* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
+    if (pArchiveData == nullptr)
+        return;
+
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
+        return;
+
+    UnpackPSORenderPass(PSO, UnpackInfo.pDevice);
+
+    // Implicit signatures are not shared between pipelines
+    if ((PSO.InternalCI.Flags & PSO_CREATE_INTERNAL_FLAG_IMPLICIT_SIGNATURE0) == 0)
+        UnpackPSOSignatures(PSO, UnpackInfo.pDevice);
+
+    for (auto& pObj : PSO.Objects)
+        Objects.emplace_back(std::move(pObj));
+}
+
+void DearchiverBase::UnpackPipelineStates(const PipelineStateUnpackInfo* pUnpackInfos,
+                                          Uint32                         NumPipelines,
+                                          IPipelineState**               ppPSOs,
+                                          bool                           Asynchronous)
+{
+    DILIGENT_PROFILE_FUNCTION();
+
+    if (NumPipelines == 0)
+        return;
+
+    if (pUnpackInfos == nullptr || ppPSOs == nullptr)
+    {
+        LOG_ERROR_MESSAGE("pUnpackInfos and ppPSOs must not be null");
+        return;
+    }
+
+    std::vector<bool> IsValid(NumPipelines);
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        IsValid[i] = VerifyPipelineStateUnpackInfo(pUnpackInfos[i], &ppPSOs[i]);
+        ppPSOs[i]  = nullptr;
+    }
+
+    // Unpack render passes and resource signatures first. Since they are shared by many
+    // pipelines, unpacking them in parallel would create the same objects multiple times.
+    // Keep strong references until all pipelines are unpacked so that the objects are
+    // found in the cache.
+    std::vector<RefCntAutoPtr<IDeviceObject>> SharedObjects;
+    for (Uint32 i = 0; i < NumPipelines; ++i)
+    {
+        if (!IsValid[i])
+            continue;
+
+        const auto& UnpackInfo = pUnpackInfos[i];
+        switch (UnpackInfo.PipelineType)
+        {
+            case PIPELINE_TYPE_GRAPHICS:
+            case PIPELINE_TYPE_MESH:
+                UnpackPSODependencies<GraphicsPipelineStateCreateInfo>(UnpackInfo, SharedObjects);
+                break;
+
+            case PIPELINE_TYPE_COMPUTE:
+                UnpackPSODependencies<ComputePipelineStateCreateInfo>(UnpackInfo, SharedObjects);
+                break;
+
+            case PIPELINE_TYPE_RAY_TRACING:
+                UnpackPSODependencies<RayTracingPipelineStateCreateInfo>(UnpackInfo, SharedObjects);
+                break;
+
+            case PIPELINE_TYPE_TILE:
+                UnpackPSODependencies<TilePipelineStateCreateInfo>(UnpackInfo, SharedObjects);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    const PSO_CREATE_FLAGS CreateFlags = Asynchronous ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+
+    auto UnpackPSO = [&](Uint32 i) {
+        if (IsValid[i])
+            UnpackPipelineStateInternal(pUnpackInfos[i], &ppPSOs[i], CreateFlags);
+    };
+
+    IThreadPool* pThreadPool = m_pThreadPool;
+    if (pThreadPool == nullptr && pUnpackInfos[0].pDevice != nullptr)
+        pThreadPool = pUnpackInfos[0].pDevice->GetShaderCompilationThreadPool();
+
+    // If there is no thread pool, the pipelines are unpacked by this thread
+    ParallelFor(pThreadPool, 0, NumPipelines, 1, UnpackPSO);
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -751,6 +889,8 @@ static bool ModifyShaderDesc(ShaderDesc&             Desc,
 void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
                                   IShader**               ppShader)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     if (!VerifShaderUnpackInfo(UnpackInfo, ppShader))
         return;
 
@@ -810,6 +950,8 @@ void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
 void DearchiverBase::UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                              IPipelineResourceSignature**       ppSignature)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     if (!VerifyResourceSignatureUnpackInfo(DeArchiveInfo, ppSignature))
         return;
 
@@ -876,7 +1018,7 @@ bool DearchiverBase::Store(IDataBlob** ppArchive) const
                 MergedArchive.Merge(*Archive.pObjArchive);
         }
 
-        MergedArchive.Serialize(ppArchive);
+        MergedArchive.Serialize(ppArchive, m_CompressShaders);
         return *ppArchive != nullptr;
     }
     catch (...)
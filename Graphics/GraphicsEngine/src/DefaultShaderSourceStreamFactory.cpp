@@ -32,6 +32,11 @@
 #include "EngineMemory.h"
 #include "BasicFileStream.hpp"
 
+#if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+#    include <sys/types.h>
+#endif
+#include <sys/stat.h>
+
 namespace Diligent
 {
 
@@ -46,12 +51,20 @@ public:
                                                        CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
                                                        IFileStream**                           ppStream) override final;
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>)
+    // F50B633B-ECF5-49E5-A3D8-7E8B921EF323
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0xf50b633b, 0xecf5, 0x49e5, {0xa3, 0xd8, 0x7e, 0x8b, 0x92, 0x1e, 0xf3, 0x23}};
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_IShaderSourceInputStreamFactory, IID_InternalImpl, ObjectBase<IShaderSourceInputStreamFactory>)
+
+    bool GetFileInfo(const Char* Name, ShaderSourceFileInfo& Info) const;
 
 private:
     std::vector<String> m_SearchDirectories;
 };
 
+constexpr INTERFACE_ID DefaultShaderSourceStreamFactory::IID_InternalImpl;
+
 DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories) :
     ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters)
 {
@@ -120,6 +133,41 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
     }
 }
 
+static bool GetFileInfo(const char* Path, ShaderSourceFileInfo& Info)
+{
+#if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
+    struct _stat64 FileStat;
+    if (_stat64(Path, &FileStat) != 0)
+        return false;
+#else
+    struct stat FileStat;
+    if (stat(Path, &FileStat) != 0)
+        return false;
+#endif
+    if ((FileStat.st_mode & S_IFMT) != S_IFREG)
+        return false;
+
+    Info.Size             = static_cast<Uint64>(FileStat.st_size);
+    Info.ModificationTime = static_cast<Uint64>(FileStat.st_mtime);
+    return true;
+}
+
+bool DefaultShaderSourceStreamFactory::GetFileInfo(const Char* Name, ShaderSourceFileInfo& Info) const
+{
+    // Files are looked up in the same order as in CreateInputStream2
+    if (FileSystem::IsPathAbsolute(Name))
+        return Diligent::GetFileInfo(Name, Info);
+
+    for (const auto& SearchDir : m_SearchDirectories)
+    {
+        const auto FullPath = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
+        if (Diligent::GetFileInfo(FullPath.c_str(), Info))
+            return true;
+    }
+
+    return false;
+}
+
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
 {
@@ -132,4 +180,18 @@ void CreateDefaultShaderSourceStreamFactory(const Char*                       Se
     pStreamFactory->QueryInterface(IID_IShaderSourceInputStreamFactory, reinterpret_cast<IObject**>(ppShaderSourceStreamFactory));
 }
 
+bool GetShaderSourceFileInfo(IShaderSourceInputStreamFactory* pFactory,
+                             const Char*                      Name,
+                             ShaderSourceFileInfo&            Info)
+{
+    if (pFactory == nullptr || Name == nullptr)
+        return false;
+
+    RefCntAutoPtr<DefaultShaderSourceStreamFactory> pDefaultFactory{pFactory, DefaultShaderSourceStreamFactory::IID_InternalImpl};
+    if (!pDefaultFactory)
+        return false;
+
+    return pDefaultFactory->GetFileInfo(Name, Info);
+}
+
 } // namespace Diligent
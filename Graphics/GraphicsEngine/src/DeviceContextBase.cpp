@@ -609,7 +609,6 @@ bool VerifyBuildBLASAttribs(const BuildBLASAttribs& Attribs, const IRenderDevice
     const auto  DeviceType = pDevice->GetDeviceInfo().Type;
 
     CHECK_BUILD_BLAS_ATTRIBS(Attribs.pBLAS != nullptr, "pBLAS must not be null.");
-    CHECK_BUILD_BLAS_ATTRIBS(Attribs.pScratchBuffer != nullptr, "pScratchBuffer must not be null.");
     CHECK_BUILD_BLAS_ATTRIBS((Attribs.BoxDataCount != 0) ^ (Attribs.TriangleDataCount != 0), "exactly one of TriangleDataCount and BoxDataCount must be non-zero.");
     CHECK_BUILD_BLAS_ATTRIBS(Attribs.pBoxData != nullptr || Attribs.BoxDataCount == 0, "BoxDataCount is ", Attribs.BoxDataCount, ", but pBoxData is null.");
     CHECK_BUILD_BLAS_ATTRIBS(Attribs.pTriangleData != nullptr || Attribs.TriangleDataCount == 0, "TriangleDataCount is ", Attribs.TriangleDataCount, ", but pTriangleData is null.");
@@ -775,28 +774,32 @@ bool VerifyBuildBLASAttribs(const BuildBLASAttribs& Attribs, const IRenderDevice
                                  "pBoxData[", i, "].pBoxBuffer was not created with BIND_RAY_TRACING flag.");
     }
 
-    const auto& ScratchDesc = Attribs.pScratchBuffer->GetDesc();
+    // Null scratch buffer means that the context allocates the scratch space
+    if (Attribs.pScratchBuffer != nullptr)
+    {
+        const auto& ScratchDesc = Attribs.pScratchBuffer->GetDesc();
 
-    CHECK_BUILD_BLAS_ATTRIBS(Attribs.ScratchBufferOffset <= ScratchDesc.Size,
-                             "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") is greater than the buffer size (", ScratchDesc.Size, ").");
+        CHECK_BUILD_BLAS_ATTRIBS(Attribs.ScratchBufferOffset <= ScratchDesc.Size,
+                                 "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") is greater than the buffer size (", ScratchDesc.Size, ").");
 
-    CHECK_BUILD_BLAS_ATTRIBS(Attribs.ScratchBufferOffset % RTProps.ScratchBufferAlignment == 0,
-                             "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") must be aligned by ", RTProps.ScratchBufferAlignment,
-                             " (RayTracingProperties::ScratchBufferAlignment).");
+        CHECK_BUILD_BLAS_ATTRIBS(Attribs.ScratchBufferOffset % RTProps.ScratchBufferAlignment == 0,
+                                 "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") must be aligned by ", RTProps.ScratchBufferAlignment,
+                                 " (RayTracingProperties::ScratchBufferAlignment).");
 
-    if (Attribs.Update)
-    {
-        CHECK_BUILD_BLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pBLAS->GetScratchBufferSizes().Update,
-                                 "pScratchBuffer size is too small, use pBLAS->GetScratchBufferSizes().Update to get the required size for the scratch buffer.");
-    }
-    else
-    {
-        CHECK_BUILD_BLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pBLAS->GetScratchBufferSizes().Build,
-                                 "pScratchBuffer size is too small, use pBLAS->GetScratchBufferSizes().Build to get the required size for the scratch buffer.");
-    }
+        if (Attribs.Update)
+        {
+            CHECK_BUILD_BLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pBLAS->GetScratchBufferSizes().Update,
+                                     "pScratchBuffer size is too small, use pBLAS->GetScratchBufferSizes().Update to get the required size for the scratch buffer.");
+        }
+        else
+        {
+            CHECK_BUILD_BLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pBLAS->GetScratchBufferSizes().Build,
+                                     "pScratchBuffer size is too small, use pBLAS->GetScratchBufferSizes().Build to get the required size for the scratch buffer.");
+        }
 
-    CHECK_BUILD_BLAS_ATTRIBS((ScratchDesc.BindFlags & BIND_RAY_TRACING) == BIND_RAY_TRACING,
-                             "pScratchBuffer was not created with BIND_RAY_TRACING flag.");
+        CHECK_BUILD_BLAS_ATTRIBS((ScratchDesc.BindFlags & BIND_RAY_TRACING) == BIND_RAY_TRACING,
+                                 "pScratchBuffer was not created with BIND_RAY_TRACING flag.");
+    }
 
 #undef CHECK_BUILD_BLAS_ATTRIBS
 
@@ -809,7 +812,6 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
 #define CHECK_BUILD_TLAS_ATTRIBS(Expr, ...) CHECK_PARAMETER(Expr, "Build TLAS attribs are invalid: ", __VA_ARGS__)
 
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pTLAS != nullptr, "pTLAS must not be null.");
-    CHECK_BUILD_TLAS_ATTRIBS(Attribs.pScratchBuffer != nullptr, "pScratchBuffer must not be null.");
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstances != nullptr, "pInstances must not be null.");
     CHECK_BUILD_TLAS_ATTRIBS(Attribs.pInstanceBuffer != nullptr, "pInstanceBuffer must not be null.");
 
@@ -827,13 +829,34 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
         CHECK_BUILD_TLAS_ATTRIBS((TLASDesc.Flags & RAYTRACING_BUILD_AS_ALLOW_UPDATE) == RAYTRACING_BUILD_AS_ALLOW_UPDATE,
                                  "Update is true, but TLAS created without RAYTRACING_BUILD_AS_ALLOW_UPDATE flag.");
 
-        const Uint32 PrevInstanceCount = Attribs.pTLAS->GetBuildInfo().InstanceCount;
-        CHECK_BUILD_TLAS_ATTRIBS(PrevInstanceCount == Attribs.InstanceCount,
-                                 "Update is true, but InstanceCount (", Attribs.InstanceCount, ") does not match the previous value (", PrevInstanceCount, ").");
+        const auto& PrevBuildInfo = Attribs.pTLAS->GetBuildInfo();
+        if (Attribs.InstanceCount > 0 && Attribs.pInstances[0].InstanceName == nullptr)
+        {
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.FirstInstanceToUpdate + Attribs.InstanceCount <= PrevBuildInfo.InstanceCount,
+                                     "Update is true, but FirstInstanceToUpdate (", Attribs.FirstInstanceToUpdate, ") + InstanceCount (", Attribs.InstanceCount,
+                                     ") exceeds the instance count of the previous build (", PrevBuildInfo.InstanceCount, ").");
+
+            if (Attribs.FirstInstanceToUpdate != 0 || Attribs.InstanceCount != PrevBuildInfo.InstanceCount)
+            {
+                CHECK_BUILD_TLAS_ATTRIBS(Attribs.BindingMode == PrevBuildInfo.BindingMode &&
+                                             Attribs.HitGroupStride == PrevBuildInfo.HitGroupStride &&
+                                             (Attribs.BindingMode == HIT_GROUP_BINDING_MODE_USER_DEFINED ||
+                                              Attribs.BaseContributionToHitGroupIndex == PrevBuildInfo.FirstContributionToHitGroupIndex),
+                                         "BindingMode, HitGroupStride and BaseContributionToHitGroupIndex must not change when a range of instances is updated.");
+            }
+        }
+        else
+        {
+            CHECK_BUILD_TLAS_ATTRIBS(Attribs.FirstInstanceToUpdate == 0, "FirstInstanceToUpdate must be 0 when instances are named.");
+            CHECK_BUILD_TLAS_ATTRIBS(PrevBuildInfo.InstanceCount == Attribs.InstanceCount,
+                                     "Update is true, but InstanceCount (", Attribs.InstanceCount, ") does not match the previous value (", PrevBuildInfo.InstanceCount, ").");
+        }
     }
 
+    const bool  IsNamed           = Attribs.InstanceCount > 0 && Attribs.pInstances[0].InstanceName != nullptr;
+    const bool  IsPartialUpdate   = Attribs.Update && !IsNamed && (Attribs.FirstInstanceToUpdate != 0 || Attribs.InstanceCount != Attribs.pTLAS->GetBuildInfo().InstanceCount);
     const auto& InstDesc          = Attribs.pInstanceBuffer->GetDesc();
-    const auto  InstDataSize      = size_t{Attribs.InstanceCount} * size_t{TLAS_INSTANCE_DATA_SIZE};
+    const auto  InstDataSize      = size_t{Attribs.Update ? Attribs.pTLAS->GetBuildInfo().InstanceCount : Attribs.InstanceCount} * size_t{TLAS_INSTANCE_DATA_SIZE};
     Uint32      AutoOffsetCounter = 0;
 
     // Calculate instance data size
@@ -848,15 +871,24 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
                    (Inst.ContributionToHitGroupIndex & ~BitMask) == 0,
                "Only the lower 24 bits are used.");
 
-        CHECK_BUILD_TLAS_ATTRIBS(Inst.InstanceName != nullptr, "pInstances[", i, "].InstanceName must not be null.");
+        CHECK_BUILD_TLAS_ATTRIBS((Inst.InstanceName != nullptr) == IsNamed,
+                                 "pInstances[", i, "].InstanceName is ", (IsNamed ? "null" : "not null"), ", but either all instances must be named or none of them.");
         CHECK_BUILD_TLAS_ATTRIBS(Inst.pBLAS != nullptr, "pInstances[", i, "].pBLAS must not be null.");
 
-        if (Attribs.Update)
+        if (Attribs.Update && IsNamed)
         {
             const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDesc(Inst.InstanceName);
             CHECK_BUILD_TLAS_ATTRIBS(IDesc.InstanceIndex != INVALID_INDEX, "Update is true, but pInstances[", i, "].InstanceName does not exists.");
         }
 
+        if (IsPartialUpdate && Attribs.BindingMode == HIT_GROUP_BINDING_MODE_PER_GEOMETRY)
+        {
+            const TLASInstanceDesc IDesc = Attribs.pTLAS->GetInstanceDescByIndex(Attribs.FirstInstanceToUpdate + i);
+            CHECK_BUILD_TLAS_ATTRIBS(IDesc.pBLAS != nullptr && IDesc.pBLAS->GetActualGeometryCount() == Inst.pBLAS->GetActualGeometryCount(),
+                                     "pInstances[", i, "].pBLAS has a different geometry count than the BLAS of instance ", Attribs.FirstInstanceToUpdate + i,
+                                     ". The geometry count must not change when a range of instances is updated in HIT_GROUP_BINDING_MODE_PER_GEOMETRY mode.");
+        }
+
         if (Inst.ContributionToHitGroupIndex == TLAS_INSTANCE_OFFSET_AUTO)
             ++AutoOffsetCounter;
 
@@ -883,28 +915,32 @@ bool VerifyBuildTLASAttribs(const BuildTLASAttribs& Attribs, const RayTracingPro
     CHECK_BUILD_TLAS_ATTRIBS((InstDesc.BindFlags & BIND_RAY_TRACING) == BIND_RAY_TRACING,
                              "pInstanceBuffer was not created with BIND_RAY_TRACING flag.");
 
-    const auto& ScratchDesc = Attribs.pScratchBuffer->GetDesc();
+    // Null scratch buffer means that the context allocates the scratch space
+    if (Attribs.pScratchBuffer != nullptr)
+    {
+        const auto& ScratchDesc = Attribs.pScratchBuffer->GetDesc();
 
-    CHECK_BUILD_TLAS_ATTRIBS(Attribs.ScratchBufferOffset <= ScratchDesc.Size,
-                             "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") is greater than the buffer size (", ScratchDesc.Size, ").");
+        CHECK_BUILD_TLAS_ATTRIBS(Attribs.ScratchBufferOffset <= ScratchDesc.Size,
+                                 "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") is greater than the buffer size (", ScratchDesc.Size, ").");
 
-    CHECK_BUILD_TLAS_ATTRIBS(Attribs.ScratchBufferOffset % RTProps.ScratchBufferAlignment == 0,
-                             "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") must be aligned by ", RTProps.ScratchBufferAlignment,
-                             " (RayTracingProperties::ScratchBufferAlignment).");
+        CHECK_BUILD_TLAS_ATTRIBS(Attribs.ScratchBufferOffset % RTProps.ScratchBufferAlignment == 0,
+                                 "ScratchBufferOffset (", Attribs.ScratchBufferOffset, ") must be aligned by ", RTProps.ScratchBufferAlignment,
+                                 " (RayTracingProperties::ScratchBufferAlignment).");
 
-    if (Attribs.Update)
-    {
-        CHECK_BUILD_TLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pTLAS->GetScratchBufferSizes().Update,
-                                 "pScratchBuffer size is too small, use pTLAS->GetScratchBufferSizes().Update to get the required size for scratch buffer.");
-    }
-    else
-    {
-        CHECK_BUILD_TLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pTLAS->GetScratchBufferSizes().Build,
-                                 "pScratchBuffer size is too small, use pTLAS->GetScratchBufferSizes().Build to get the required size for scratch buffer.");
-    }
+        if (Attribs.Update)
+        {
+            CHECK_BUILD_TLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pTLAS->GetScratchBufferSizes().Update,
+                                     "pScratchBuffer size is too small, use pTLAS->GetScratchBufferSizes().Update to get the required size for scratch buffer.");
+        }
+        else
+        {
+            CHECK_BUILD_TLAS_ATTRIBS(ScratchDesc.Size - Attribs.ScratchBufferOffset >= Attribs.pTLAS->GetScratchBufferSizes().Build,
+                                     "pScratchBuffer size is too small, use pTLAS->GetScratchBufferSizes().Build to get the required size for scratch buffer.");
+        }
 
-    CHECK_BUILD_TLAS_ATTRIBS((ScratchDesc.BindFlags & BIND_RAY_TRACING) == BIND_RAY_TRACING,
-                             "pScratchBuffer was not created with BIND_RAY_TRACING flag.");
+        CHECK_BUILD_TLAS_ATTRIBS((ScratchDesc.BindFlags & BIND_RAY_TRACING) == BIND_RAY_TRACING,
+                                 "pScratchBuffer was not created with BIND_RAY_TRACING flag.");
+    }
 #undef CHECK_BUILD_TLAS_ATTRIBS
 
     return true;
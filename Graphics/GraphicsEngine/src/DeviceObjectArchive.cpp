@@ -28,11 +28,14 @@
 
 #include <algorithm>
 #include <sstream>
+#include <limits>
+#include <cstring>
 
 #include "Shader.h"
 #include "EngineMemory.h"
 #include "DataBlobImpl.hpp"
 #include "PSOSerializer.hpp"
+#include "LZ4Compression.hpp"
 
 namespace Diligent
 {
@@ -73,6 +76,27 @@ DeviceObjectArchive::ArchiveHeader::ArchiveHeader() noexcept
 namespace
 {
 
+const char* ArchiveDeviceTypeToString(Uint32 dev)
+{
+    using DeviceType = DeviceObjectArchive::DeviceType;
+    static_assert(static_cast<Uint32>(DeviceType::Count) == 7, "Please handle the new archive device type below");
+    switch (static_cast<DeviceType>(dev))
+    {
+            // clang-format off
+        case DeviceType::OpenGL:      return "OpenGL";
+        case DeviceType::Direct3D11:  return "Direct3D11";
+        case DeviceType::Direct3D12:  return "Direct3D12";
+        case DeviceType::Vulkan:      return "Vulkan";
+        case DeviceType::Metal_MacOS: return "Metal for MacOS";
+        case DeviceType::Metal_iOS:   return "Metal for iOS";
+        case DeviceType::WebGPU:      return "WebGPU";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected device type");
+            return "unknown";
+    }
+}
+
 template <SerializerMode Mode>
 struct ArchiveSerializer
 {
@@ -144,6 +168,187 @@ bool ArchiveSerializer<SerializerMode::Read>::SerializeShaders(ShadersVector& Sh
     return true;
 }
 
+// Shader section as it is stored in the archive
+struct ShaderSectionData
+{
+    // Zero if the section is not compressed
+    Uint32 UncompressedSize = 0;
+
+    SerializedData Data;
+};
+
+// Packs the shaders into a single size-prefixed section that can be skipped by the reader.
+ShaderSectionData PackShaderSection(const std::vector<SerializedData>& Shaders, bool Compress)
+{
+    ShaderSectionData Section;
+
+    // Empty section indicates that there are no shaders for the device
+    if (Shaders.empty())
+        return Section;
+
+    Serializer<SerializerMode::Measure> SectionMeasurer;
+    ArchiveSerializer<SerializerMode::Measure>{SectionMeasurer}.SerializeShaders(Shaders);
+
+    // The section is 8-byte aligned in the archive, so shader alignment within the
+    // section matches the alignment the section reader will see.
+    Section.Data = SectionMeasurer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> SectionWriter{Section.Data};
+    if (!ArchiveSerializer<SerializerMode::Write>{SectionWriter}.SerializeShaders(Shaders))
+    {
+        UNEXPECTED("Failed to serialize shaders");
+        return {};
+    }
+    VERIFY_EXPR(SectionWriter.IsEnded());
+
+    if (Compress && Section.Data.Size() <= std::numeric_limits<Uint32>::max())
+    {
+        SerializedData Compressed{GetLZ4CompressedSizeBound(Section.Data.Size()), GetRawAllocator()};
+
+        const size_t CompressedSize = CompressLZ4(Section.Data.Ptr(), Section.Data.Size(), Compressed.Ptr(), Compressed.Size());
+        // Keep the section uncompressed if compression does not pay off
+        if (CompressedSize != 0 && CompressedSize < Section.Data.Size())
+        {
+            Section.UncompressedSize = static_cast<Uint32>(Section.Data.Size());
+            Section.Data             = SerializedData{CompressedSize, GetRawAllocator()};
+            std::memcpy(Section.Data.Ptr(), Compressed.Ptr(), CompressedSize);
+        }
+    }
+
+    return Section;
+}
+
+// References shader data in a hash map that identifies shaders by their content.
+struct ShaderDataRef
+{
+    const SerializedData* pData = nullptr;
+
+    bool operator==(const ShaderDataRef& Other) const noexcept
+    {
+        return *pData == *Other.pData;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const ShaderDataRef& Ref) const
+        {
+            return Ref.pData->GetHash();
+        }
+    };
+};
+
+// Appends shaders from SrcShaders to DstShaders skipping the shaders whose byte code is
+// already present in DstShaders. If pAllocator is null, DstShaders reference the source data.
+// Returns the table that maps source shader indices to the indices in DstShaders.
+std::vector<Uint32> AppendUniqueShaders(const std::vector<SerializedData>& SrcShaders,
+                                        std::vector<SerializedData>&       DstShaders,
+                                        IMemoryAllocator*                  pAllocator,
+                                        size_t&                            DuplicateSize)
+{
+    std::vector<Uint32> Remap;
+    if (SrcShaders.empty())
+        return Remap;
+
+    // Reserve space so that references to the destination shaders remain valid
+    DstShaders.reserve(DstShaders.size() + SrcShaders.size());
+
+    std::unordered_map<ShaderDataRef, Uint32, ShaderDataRef::Hasher> ShaderToIdx;
+    for (size_t i = 0; i < DstShaders.size(); ++i)
+        ShaderToIdx.emplace(ShaderDataRef{&DstShaders[i]}, static_cast<Uint32>(i));
+
+    Remap.reserve(SrcShaders.size());
+    for (const auto& SrcShader : SrcShaders)
+    {
+        auto it = ShaderToIdx.find(ShaderDataRef{&SrcShader});
+        if (it == ShaderToIdx.end())
+        {
+            if (pAllocator != nullptr)
+                DstShaders.emplace_back(SrcShader.MakeCopy(*pAllocator));
+            else
+                DstShaders.emplace_back(SrcShader.Ptr(), SrcShader.Size());
+            it = ShaderToIdx.emplace(ShaderDataRef{&DstShaders.back()}, static_cast<Uint32>(DstShaders.size() - 1)).first;
+        }
+        else
+        {
+            DuplicateSize += SrcShader.Size();
+        }
+        Remap.push_back(it->second);
+    }
+
+    return Remap;
+}
+
+bool IsPipelineResource(DeviceObjectArchive::ResourceType ResType)
+{
+    using ResourceType = DeviceObjectArchive::ResourceType;
+    return (ResType == ResourceType::GraphicsPipeline ||
+            ResType == ResourceType::ComputePipeline ||
+            ResType == ResourceType::RayTracingPipeline ||
+            ResType == ResourceType::TilePipeline);
+}
+
+// Replaces shader indices in the device-specific data of a standalone shader or a pipeline
+// using the remap table. The data is modified in place; backend-specific pipeline data that
+// follows the shader indices is left intact.
+bool RemapShaderIndices(DeviceObjectArchive::ResourceType ResType,
+                        SerializedData&                   DeviceData,
+                        const std::vector<Uint32>&        Remap,
+                        DynamicLinearAllocator&           Allocator)
+{
+    if (!DeviceData)
+        return true;
+
+    if (ResType == DeviceObjectArchive::ResourceType::StandaloneShader)
+    {
+        // For shaders, device-specific data is the serialized shader bytecode index
+        Uint32 ShaderIndex = 0;
+        {
+            Serializer<SerializerMode::Read> Ser{DeviceData};
+            if (!Ser(ShaderIndex) || ShaderIndex >= Remap.size())
+                return false;
+            VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
+        }
+
+        ShaderIndex = Remap[ShaderIndex];
+
+        Serializer<SerializerMode::Write> Ser{DeviceData};
+        Ser(ShaderIndex);
+        VERIFY_EXPR(Ser.IsEnded());
+    }
+    else if (IsPipelineResource(ResType))
+    {
+        // For pipelines, device-specific data is the shader index array
+        DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+        {
+            Serializer<SerializerMode::Read> Ser{DeviceData};
+            if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &Allocator))
+                return false;
+        }
+
+        std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
+        for (auto& Idx : NewIndices)
+        {
+            if (Idx >= Remap.size())
+                return false;
+            Idx = Remap[Idx];
+        }
+
+        Serializer<SerializerMode::Write> Ser{DeviceData};
+        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, DeviceObjectArchive::ShaderIndexArray{NewIndices.data(), ShaderIndices.Count}, nullptr);
+    }
+
+    return true;
+}
+
+void LogRemovedDuplicateShaders(Uint32 dev, size_t NumDuplicates, size_t DuplicateSize)
+{
+    if (NumDuplicates > 0)
+    {
+        LOG_INFO_MESSAGE("Device object archive: removed ", NumDuplicates, " duplicate ", ArchiveDeviceTypeToString(dev),
+                         " shader(s), ", DuplicateSize, " bytes saved.");
+    }
+}
+
 } // namespace
 
 DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
@@ -154,7 +359,12 @@ DeviceObjectArchive::DeviceObjectArchive(Uint32 ContentVersion) noexcept :
 void DeviceObjectArchive::Clear() noexcept
 {
     m_NamedResources.clear();
-    m_DeviceShaders = {};
+    m_DeviceShaders        = {};
+    m_DeviceShaderSections = {};
+    m_ShaderSectionUncompressedSizes.fill(0);
+    m_DecompressedShaderSections = {};
+    for (auto& Pending : m_DeviceShadersPending)
+        Pending.store(false);
     m_pArchiveData.Release();
     m_ContentVersion = 0;
 }
@@ -227,16 +437,65 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
         CHECK_ARCHIVE(ArchiveReader.SerializeResourceData(ResData), "Failed to read data of resource '", Name, "'.");
     }
 
-    for (std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    // Shader sections are not parsed until the shaders for the device are requested.
+    for (size_t dev = 0; dev < m_DeviceShaderSections.size(); ++dev)
     {
-        CHECK_ARCHIVE(ArchiveReader.SerializeShaders(Shaders), "Failed to read shader data from the device object archive.");
+        SerializedData& Section = m_DeviceShaderSections[dev];
+        CHECK_ARCHIVE(Reader(m_ShaderSectionUncompressedSizes[dev]) && Reader.Serialize(Section), "Failed to read shader data from the device object archive.");
+        m_DeviceShadersPending[dev].store(Section.Size() > 0);
     }
 #undef CHECK_ARCHIVE
 
     return true;
 }
 
-void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+void DeviceObjectArchive::LoadDeviceShaders(DeviceType Type) const noexcept
+{
+    const size_t dev = static_cast<size_t>(Type);
+
+    std::lock_guard<std::mutex> Lock{m_DeviceShadersMtx};
+    if (!m_DeviceShadersPending[dev].load(std::memory_order_acquire))
+        return; // Another thread has loaded the shaders
+
+    auto& Shaders = m_DeviceShaders[dev];
+    VERIFY_EXPR(Shaders.empty());
+
+    const SerializedData* pSection = &m_DeviceShaderSections[dev];
+    if (const Uint32 UncompressedSize = m_ShaderSectionUncompressedSizes[dev])
+    {
+        // Loaded shaders reference the decompressed data, so it is kept alive
+        auto& Decompressed = m_DecompressedShaderSections[dev];
+        Decompressed       = SerializedData{UncompressedSize, GetRawAllocator()};
+        if (!DecompressLZ4(pSection->Ptr(), pSection->Size(), Decompressed.Ptr(), Decompressed.Size()))
+        {
+            LOG_ERROR_MESSAGE("Failed to decompress ", ArchiveDeviceTypeToString(static_cast<Uint32>(dev)), " shader data. The archive may be corrupted.");
+            Decompressed = {};
+        }
+        pSection = &Decompressed;
+    }
+
+    Serializer<SerializerMode::Read> SectionReader{*pSection};
+    if (!ArchiveSerializer<SerializerMode::Read>{SectionReader}.SerializeShaders(Shaders) || !SectionReader.IsEnded())
+    {
+        LOG_ERROR_MESSAGE("Failed to read ", ArchiveDeviceTypeToString(static_cast<Uint32>(dev)), " shader data from the device object archive.");
+        Shaders.clear();
+    }
+
+    m_DeviceShaderSections[dev] = {};
+    m_DeviceShadersPending[dev].store(false, std::memory_order_release);
+}
+
+void DeviceObjectArchive::DiscardDeviceShaderSection(DeviceType Type) noexcept
+{
+    const size_t dev = static_cast<size_t>(Type);
+
+    std::lock_guard<std::mutex> Lock{m_DeviceShadersMtx};
+    m_DeviceShaderSections[dev]           = {};
+    m_ShaderSectionUncompressedSizes[dev] = 0;
+    m_DeviceShadersPending[dev].store(false, std::memory_order_release);
+}
+
+void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob, bool CompressShaders) const
 {
     if (ppDataBlob == nullptr)
     {
@@ -245,7 +504,61 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
     }
     DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
-    auto SerializeThis = [this](auto& Ser) {
+    // Byte-identical shaders are only written once. Shader indices of the resources
+    // that reference removed duplicates are remapped in temporary copies.
+    std::array<std::vector<SerializedData>, static_cast<size_t>(DeviceType::Count)> UniqueShaders;
+    std::unordered_map<const ResourceData*, ResourceData>                           RemappedResources;
+    {
+        DynamicLinearAllocator Allocator{GetRawAllocator(), 512};
+        for (Uint32 dev = 0; dev < UniqueShaders.size(); ++dev)
+        {
+            const auto& Shaders       = GetDeviceShaders(static_cast<DeviceType>(dev));
+            size_t      DuplicateSize = 0;
+            const auto  Remap         = AppendUniqueShaders(Shaders, UniqueShaders[dev], nullptr, DuplicateSize);
+            if (UniqueShaders[dev].size() == Shaders.size())
+                continue;
+
+            bool RemapSucceeded = true;
+            for (const auto& res_it : m_NamedResources)
+            {
+                const auto  ResType = res_it.first.GetType();
+                const auto& SrcData = res_it.second.DeviceSpecific[dev];
+                if (!SrcData || (ResType != ResourceType::StandaloneShader && !IsPipelineResource(ResType)))
+                    continue;
+
+                auto it = RemappedResources.find(&res_it.second);
+                if (it == RemappedResources.end())
+                    it = RemappedResources.emplace(&res_it.second, res_it.second.MakeCopy(GetRawAllocator())).first;
+
+                if (!RemapShaderIndices(ResType, it->second.DeviceSpecific[dev], Remap, Allocator))
+                {
+                    LOG_ERROR_MESSAGE("Failed to remap shader indices of resource '", res_it.first.GetName(), "'. Archive data may be corrupted or invalid.");
+                    RemapSucceeded = false;
+                    break;
+                }
+            }
+
+            if (!RemapSucceeded)
+            {
+                // Keep all shaders and restore the original indices for this device
+                UniqueShaders[dev].clear();
+                for (const auto& Shader : Shaders)
+                    UniqueShaders[dev].emplace_back(Shader.Ptr(), Shader.Size());
+                for (auto& remapped_it : RemappedResources)
+                    remapped_it.second.DeviceSpecific[dev] = remapped_it.first->DeviceSpecific[dev].MakeCopy(GetRawAllocator());
+                continue;
+            }
+
+            LogRemovedDuplicateShaders(dev, Shaders.size() - UniqueShaders[dev].size(), DuplicateSize);
+        }
+    }
+
+    // Shader sections are packed up front as their size is not known until they are compressed
+    std::array<ShaderSectionData, static_cast<size_t>(DeviceType::Count)> ShaderSections;
+    for (size_t dev = 0; dev < ShaderSections.size(); ++dev)
+        ShaderSections[dev] = PackShaderSection(UniqueShaders[dev], CompressShaders);
+
+    auto SerializeThis = [&](auto& Ser) {
         constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
         const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
 
@@ -267,13 +580,14 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
             res = Ser(ResType, Name);
             VERIFY(res, "Failed to serialize resource type and name");
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
+            const auto remapped_it = RemappedResources.find(&res_it.second);
+            res                    = ArchiveSer.SerializeResourceData(remapped_it != RemappedResources.end() ? remapped_it->second : res_it.second);
             VERIFY(res, "Failed to serialize resource data");
         }
 
-        for (auto& Shaders : m_DeviceShaders)
+        for (const auto& Section : ShaderSections)
         {
-            res = ArchiveSer.SerializeShaders(Shaders);
+            res = Ser(Section.UncompressedSize) && Ser.Serialize(Section.Data);
             VERIFY(res, "Failed to serialize shaders");
         }
     };
@@ -294,27 +608,6 @@ void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
 namespace
 {
 
-const char* ArchiveDeviceTypeToString(Uint32 dev)
-{
-    using DeviceType = DeviceObjectArchive::DeviceType;
-    static_assert(static_cast<Uint32>(DeviceType::Count) == 7, "Please handle the new archive device type below");
-    switch (static_cast<DeviceType>(dev))
-    {
-            // clang-format off
-        case DeviceType::OpenGL:      return "OpenGL";
-        case DeviceType::Direct3D11:  return "Direct3D11";
-        case DeviceType::Direct3D12:  return "Direct3D12";
-        case DeviceType::Vulkan:      return "Vulkan";
-        case DeviceType::Metal_MacOS: return "Metal for MacOS";
-        case DeviceType::Metal_iOS:   return "Metal for iOS";
-        case DeviceType::WebGPU:      return "WebGPU";
-        // clang-format on
-        default:
-            UNEXPECTED("Unexpected device type");
-            return "unknown";
-    }
-}
-
 const char* ResourceTypeToString(DeviceObjectArchive::ResourceType Type)
 {
     using ResourceType = DeviceObjectArchive::ResourceType;
@@ -467,9 +760,9 @@ std::string DeviceObjectArchive::ToString() const
     //       [1] 'Test PS' 7380 bytes
     {
         bool HasShaders = false;
-        for (const auto& Shaders : m_DeviceShaders)
+        for (Uint32 dev = 0; dev < m_DeviceShaders.size(); ++dev)
         {
-            if (!Shaders.empty())
+            if (!GetDeviceShaders(static_cast<DeviceType>(dev)).empty())
                 HasShaders = true;
         }
 
@@ -482,7 +775,7 @@ std::string DeviceObjectArchive::ToString() const
 
             for (Uint32 dev = 0; dev < m_DeviceShaders.size(); ++dev)
             {
-                const auto& Shaders = m_DeviceShaders[dev];
+                const auto& Shaders = GetDeviceShaders(static_cast<DeviceType>(dev));
                 if (Shaders.empty())
                     continue;
                 Output << Ident1 << ArchiveDeviceTypeToString(dev) << '(' << Shaders.size() << ")\n";
@@ -528,7 +821,9 @@ void DeviceObjectArchive::RemoveDeviceData(DeviceType Dev) noexcept(false)
     for (auto& res_it : m_NamedResources)
         res_it.second.DeviceSpecific[static_cast<size_t>(Dev)] = {};
 
+    DiscardDeviceShaderSection(Dev);
     m_DeviceShaders[static_cast<size_t>(Dev)].clear();
+    m_DecompressedShaderSections[static_cast<size_t>(Dev)] = {};
 }
 
 void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false)
@@ -549,12 +844,26 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
         DstData = SrcData.MakeCopy(Allocator);
     }
 
-    // Copy all shaders to make sure PSO shader indices are correct
-    const auto& SrcShaders = Src.m_DeviceShaders[static_cast<size_t>(Dev)];
-    auto&       DstShaders = m_DeviceShaders[static_cast<size_t>(Dev)];
+    // Copy shaders. Byte-identical shaders are only copied once.
+    const auto& SrcShaders = Src.GetDeviceShaders(Dev);
+    DiscardDeviceShaderSection(Dev);
+    auto& DstShaders = m_DeviceShaders[static_cast<size_t>(Dev)];
     DstShaders.clear();
-    for (const auto& SrcShader : SrcShaders)
-        DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+    m_DecompressedShaderSections[static_cast<size_t>(Dev)] = {};
+
+    size_t     DuplicateSize = 0;
+    const auto Remap         = AppendUniqueShaders(SrcShaders, DstShaders, &Allocator, DuplicateSize);
+    if (DstShaders.size() == SrcShaders.size())
+        return;
+
+    // Update shader indices
+    DynamicLinearAllocator DynAllocator{Allocator, 512};
+    for (auto& res_it : m_NamedResources)
+    {
+        if (!RemapShaderIndices(res_it.first.GetType(), res_it.second.DeviceSpecific[static_cast<size_t>(Dev)], Remap, DynAllocator))
+            LOG_ERROR_AND_THROW("Failed to remap shader indices of resource '", res_it.first.GetName(), "'. Archive file may be corrupted or invalid.");
+    }
+    LogRemovedDuplicateShaders(static_cast<Uint32>(Dev), SrcShaders.size() - DstShaders.size(), DuplicateSize);
 }
 
 void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
@@ -567,18 +876,17 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     auto&                  Allocator = GetRawAllocator();
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
-    // Copy shaders
-    std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
+    // Copy shaders. Shaders whose byte code is already present in the archive are not copied.
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> ShaderRemap;
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
-        const auto& SrcShaders = Src.m_DeviceShaders[i];
-        auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
-        if (SrcShaders.empty())
-            continue;
-        DstShaders.reserve(DstShaders.size() + SrcShaders.size());
-        for (const auto& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        const auto& SrcShaders    = Src.GetDeviceShaders(static_cast<DeviceType>(i));
+        auto&       DstShaders    = GetDeviceShaders(static_cast<DeviceType>(i));
+        const auto  NumDstShaders = DstShaders.size();
+        size_t      DuplicateSize = 0;
+
+        ShaderRemap[i] = AppendUniqueShaders(SrcShaders, DstShaders, &Allocator, DuplicateSize);
+        LogRemovedDuplicateShaders(static_cast<Uint32>(i), NumDstShaders + SrcShaders.size() - DstShaders.size(), DuplicateSize);
     }
 
     // Copy named resources
@@ -597,78 +905,20 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
             continue;
         }
 
-        const auto IsStandaloneShader = (ResType == ResourceType::StandaloneShader);
-        const auto IsPipeline =
-            (ResType == ResourceType::GraphicsPipeline ||
-             ResType == ResourceType::ComputePipeline ||
-             ResType == ResourceType::RayTracingPipeline ||
-             ResType == ResourceType::TilePipeline);
-
         // Update shader indices
-        if (IsStandaloneShader || IsPipeline)
+        for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
         {
-            for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
-            {
-                const auto BaseIdx = ShaderBaseIndices[i];
-
-                auto& DeviceData = it_inserted.first->second.DeviceSpecific[i];
-                if (!DeviceData)
-                    continue;
-
-                if (IsStandaloneShader)
-                {
-                    // For shaders, device-specific data is the serialized shader bytecode index
-                    Uint32 ShaderIndex = 0;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!Ser(ShaderIndex))
-                            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
-                    }
-
-                    ShaderIndex += BaseIdx;
-
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        Ser(ShaderIndex);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
-                else if (IsPipeline)
-                {
-                    // For pipelines, device-specific data is the shader index array
-                    ShaderIndexArray ShaderIndices;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &DynAllocator))
-                            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
-                    }
-
-                    std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
-                    for (auto& Idx : NewIndices)
-                        Idx += BaseIdx;
-
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndexArray{NewIndices.data(), ShaderIndices.Count}, nullptr);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
-                else
-                {
-                    UNEXPECTED("Unexpected resource type");
-                }
-            }
+            if (!RemapShaderIndices(ResType, it_inserted.first->second.DeviceSpecific[i], ShaderRemap[i], DynAllocator))
+                LOG_ERROR_AND_THROW("Failed to update shader indices of resource '", ResName, "'. Archive file may be corrupted or invalid.");
         }
     }
 }
 
-void DeviceObjectArchive::Serialize(IFileStream* pStream) const
+void DeviceObjectArchive::Serialize(IFileStream* pStream, bool CompressShaders) const
 {
     DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
     RefCntAutoPtr<IDataBlob> pDataBlob;
-    Serialize(&pDataBlob);
+    Serialize(&pDataBlob, CompressShaders);
     VERIFY_EXPR(pDataBlob);
     pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
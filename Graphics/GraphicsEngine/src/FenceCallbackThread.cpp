@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FenceCallbackThread.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+#include "RefCntAutoPtr.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+struct FenceCallbackThread::State
+{
+    explicit State(IRenderDevice* _pDevice) :
+        pDevice{_pDevice}
+    {}
+
+    struct PendingCallback
+    {
+        RefCntAutoPtr<IFence>       pFence;
+        Uint64                      Value     = 0;
+        FenceCompletionCallbackType Callback  = nullptr;
+        void*                       pUserData = nullptr;
+    };
+
+    IRenderDevice* const pDevice;
+
+    std::mutex                   Mtx;
+    std::condition_variable      CondVar;
+    std::vector<PendingCallback> NewCallbacks;
+    bool                         Stop = false;
+
+    std::thread Thread;
+};
+
+FenceCallbackThread::FenceCallbackThread(IRenderDevice* pDevice) :
+    m_pState{std::make_shared<State>(pDevice)}
+{
+}
+
+FenceCallbackThread::~FenceCallbackThread()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        m_pState->Stop = true;
+    }
+    m_pState->CondVar.notify_one();
+
+    if (m_pState->Thread.joinable())
+    {
+        if (m_pState->Thread.get_id() == std::this_thread::get_id())
+        {
+            // The device is being destroyed by the callback thread itself.
+            // The thread will exit as soon as it returns to the main loop.
+            m_pState->Thread.detach();
+        }
+        else
+        {
+            m_pState->Thread.join();
+        }
+    }
+}
+
+void FenceCallbackThread::RegisterCallback(IFence* pFence, Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    DEV_CHECK_ERR(pFence != nullptr, "Fence must not be null");
+    DEV_CHECK_ERR(Callback != nullptr, "Callback must not be null");
+    if (pFence == nullptr || Callback == nullptr)
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        if (!m_pState->Thread.joinable())
+            m_pState->Thread = std::thread{ThreadFunc, m_pState};
+        m_pState->NewCallbacks.push_back({RefCntAutoPtr<IFence>{pFence}, Value, Callback, pUserData});
+    }
+    m_pState->CondVar.notify_one();
+}
+
+void FenceCallbackThread::ThreadFunc(std::shared_ptr<State> pState)
+{
+    // The maximum time the thread waits for the fences before it checks for new callbacks
+    static constexpr Uint64 MaxWaitTimeNs = 1000000;
+
+    std::vector<State::PendingCallback> Pending;
+    std::vector<IFence*>                Fences;
+    std::vector<Uint64>                 Values;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock{pState->Mtx};
+            pState->CondVar.wait(Lock, [&]() { return pState->Stop || !pState->NewCallbacks.empty() || !Pending.empty(); });
+            if (pState->Stop)
+                break;
+
+            for (auto& NewCallback : pState->NewCallbacks)
+                Pending.emplace_back(std::move(NewCallback));
+            pState->NewCallbacks.clear();
+        }
+
+        Fences.clear();
+        Values.clear();
+        for (const auto& Callback : Pending)
+        {
+            Fences.push_back(Callback.pFence);
+            Values.push_back(Callback.Value);
+        }
+        pState->pDevice->WaitForFences(Fences.data(), Values.data(), static_cast<Uint32>(Fences.size()), /*WaitAll = */ false, MaxWaitTimeNs);
+
+        for (auto& Callback : Pending)
+        {
+            if (Callback.pFence->GetCompletedValue() >= Callback.Value)
+            {
+                Callback.Callback(Callback.pFence, Callback.Value, Callback.pUserData);
+                Callback.Callback = nullptr;
+            }
+        }
+
+        // Releasing the fence may release the last reference to the device, in which case
+        // the thread is detached and the state is kept alive by pState until the thread exits.
+        Pending.erase(std::remove_if(Pending.begin(), Pending.end(),
+                                     [](const State::PendingCallback& Callback) { return Callback.Callback == nullptr; }),
+                      Pending.end());
+    }
+}
+
+} // namespace Diligent
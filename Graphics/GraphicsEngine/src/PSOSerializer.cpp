@@ -185,6 +185,7 @@ bool PSOSerializer<Mode>::SerializeCreateInfo(
                CreateInfo.GraphicsPipeline.NumRenderTargets,
                CreateInfo.GraphicsPipeline.SubpassIndex,
                CreateInfo.GraphicsPipeline.ShadingRateFlags,
+               CreateInfo.GraphicsPipeline.DynamicStateFlags,
                CreateInfo.GraphicsPipeline.RTVFormats,
                CreateInfo.GraphicsPipeline.DSVFormat,
                CreateInfo.GraphicsPipeline.ReadOnlyDSV,
@@ -141,6 +141,19 @@ void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc&
             }
         }
 
+        if ((Res.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+        {
+            if (Res.ArraySize != 1)
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].ArraySize (", Res.ArraySize, ") must be 1 for inline constants.");
+
+            if (Res.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].VarType must not be STATIC for inline constants.");
+
+            if ((Res.Flags & PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS) != 0)
+                LOG_PRS_ERROR_AND_THROW("Desc.Resources[", i, "].Flags contain both INLINE_CONSTANTS and NO_DYNAMIC_BUFFERS flags. "
+                                        "Inline constants are uploaded into a dynamic buffer.");
+        }
+
         if ((Res.Flags & PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT) != 0 &&
             DeviceInfo.Type != RENDER_DEVICE_TYPE_UNDEFINED && // May be UNDEFINED for serialized signature
             !DeviceInfo.IsVulkanDevice())
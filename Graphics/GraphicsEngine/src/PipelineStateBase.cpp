@@ -669,6 +669,27 @@ void ValidateGraphicsPipelineCreateInfo(const GraphicsPipelineStateCreateInfo& C
         if (!Features.VariableRateShading)
             LOG_PSO_ERROR_AND_THROW("ShadingRateFlags (", GetPipelineShadingRateFlagsString(CreateInfo.GraphicsPipeline.ShadingRateFlags), ") require VariableRateShading feature");
     }
+
+    if (CreateInfo.GraphicsPipeline.DynamicStateFlags != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        if (!Features.DynamicRenderState)
+            LOG_PSO_ERROR_AND_THROW("DynamicStateFlags (", GetPipelineDynamicStateFlagsString(CreateInfo.GraphicsPipeline.DynamicStateFlags), ") require DynamicRenderState feature");
+
+        if ((CreateInfo.GraphicsPipeline.DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY) != 0 && PSODesc.PipelineType == PIPELINE_TYPE_MESH)
+            LOG_PSO_ERROR_AND_THROW("PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY is not allowed in mesh pipelines.");
+    }
+
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) != 0)
+    {
+        if (!Features.ShaderObjects)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS requires ShaderObjects feature");
+
+        if (GraphicsPipeline.pRenderPass != nullptr)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS can't be used with explicit render passes.");
+
+        if ((GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0)
+            LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS can't be used with texture-based shading rate.");
+    }
 }
 
 void ValidateComputePipelineCreateInfo(const ComputePipelineStateCreateInfo& CreateInfo,
@@ -681,6 +702,9 @@ void ValidateComputePipelineCreateInfo(const ComputePipelineStateCreateInfo& Cre
     if (PSODesc.PipelineType != PIPELINE_TYPE_COMPUTE)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be COMPUTE.");
 
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) != 0)
+        LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS is only allowed in graphics and mesh pipelines.");
+
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
@@ -699,6 +723,9 @@ void ValidateRayTracingPipelineCreateInfo(const IRenderDevice*
     if (PSODesc.PipelineType != PIPELINE_TYPE_RAY_TRACING)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be RAY_TRACING.");
 
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) != 0)
+        LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS is only allowed in graphics and mesh pipelines.");
+
     if (!DeviceInfo.Features.RayTracing || (RTProps.CapFlags & RAY_TRACING_CAP_FLAG_STANDALONE_SHADERS) == 0)
         LOG_PSO_ERROR_AND_THROW("Standalone ray tracing shaders are not supported");
 
@@ -790,6 +817,9 @@ void ValidateTilePipelineCreateInfo(const TilePipelineStateCreateInfo& CreateInf
     if (PSODesc.PipelineType != PIPELINE_TYPE_TILE)
         LOG_PSO_ERROR_AND_THROW("Pipeline type must be TILE.");
 
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) != 0)
+        LOG_PSO_ERROR_AND_THROW("PSO_CREATE_FLAG_SHADER_OBJECTS is only allowed in graphics and mesh pipelines.");
+
     ValidatePipelineResourceSignatures(CreateInfo, pDevice);
     ValidatePipelineResourceLayoutDesc(PSODesc, Features);
 
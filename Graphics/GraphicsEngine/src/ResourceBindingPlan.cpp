@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ResourceBindingPlan.hpp"
+#include "ResourceMappingImpl.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+static Uint64 GetResourceMappingStateId(IResourceMapping* pResourceMapping)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMappingImpl{pResourceMapping, ResourceMappingImpl::IID_InternalImpl};
+    return pMappingImpl ? pMappingImpl->GetStateId() : 0;
+}
+
+void ResourceBindingPlan::Begin(IResourceMapping* pResourceMapping)
+{
+    VERIFY_EXPR(pResourceMapping != nullptr);
+    VERIFY(m_pResourceMapping == nullptr, "Begin() has already been called. Did you forget to call End()?");
+
+    m_pResourceMapping = pResourceMapping;
+    m_Offset           = 0;
+
+    // The id must be read before any resources are resolved so that
+    // modifications made during the pass invalidate the plan.
+    const Uint64 StateId = GetResourceMappingStateId(pResourceMapping);
+    if (StateId == 0 || StateId != m_StateId)
+    {
+        m_IsValid = false;
+        m_StateId = StateId;
+        m_Objects.clear();
+    }
+}
+
+IDeviceObject* const* ResourceBindingPlan::Resolve(const Char* Name, Uint32 ArraySize)
+{
+    VERIFY(m_pResourceMapping != nullptr, "Begin() has not been called");
+
+    const size_t Offset = m_Offset;
+    m_Offset += ArraySize;
+
+    if (m_IsValid)
+    {
+        VERIFY(m_Offset <= m_Objects.size(), "Variables must be resolved in the same order as when the plan was recorded");
+        return m_Objects.data() + Offset;
+    }
+
+    VERIFY_EXPR(m_Objects.size() == Offset);
+    m_Objects.resize(m_Offset);
+    for (Uint32 ArrInd = 0; ArrInd < ArraySize; ++ArrInd)
+        m_Objects[Offset + ArrInd] = m_pResourceMapping->GetResource(Name, ArrInd);
+
+    return m_Objects.data() + Offset;
+}
+
+void ResourceBindingPlan::End()
+{
+    VERIFY(m_pResourceMapping != nullptr, "Begin() has not been called");
+    VERIFY(!m_IsValid || m_Offset == m_Objects.size(), "The number of resolved resources does not match the recorded plan");
+
+    if (m_StateId != 0)
+        m_IsValid = true;
+    else
+        m_Objects.clear();
+
+    m_pResourceMapping = nullptr;
+}
+
+void ResourceBindingPlan::Invalidate()
+{
+    VERIFY(m_pResourceMapping == nullptr, "Plan can't be invalidated during the binding pass");
+    m_IsValid = false;
+    m_StateId = 0;
+    m_Objects.clear();
+}
+
+} // namespace Diligent
@@ -35,18 +35,28 @@ ResourceMappingImpl::~ResourceMappingImpl()
 {
 }
 
+Uint64 ResourceMappingImpl::GenerateStateId()
+{
+    static std::atomic<Uint64> GlobalCounter{0};
+    return GlobalCounter.fetch_add(1) + 1;
+}
+
 void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex, IDeviceObject* const* ppObjects, Uint32 NumElements, bool bIsUnique)
 {
     if (Name == nullptr || *Name == 0)
         return;
 
-    Threading::SpinLockGuard Guard{m_Lock};
+    Threading::AdaptiveLockGuard Guard{m_Lock};
+
+    bool Modified = false;
     for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
     {
         auto* pObject = ppObjects[Elem];
 
         // Try to construct new element in place
         auto Elems = m_HashTable.emplace(ResMappingHashKey{Name, true /*Make copy*/, StartIndex + Elem}, pObject);
+        if (Elems.second)
+            Modified = true;
         // If there is already element with the same name, replace it
         if (!Elems.second && Elems.first->second != pObject)
         {
@@ -59,8 +69,12 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
                     "New resource will be used\n.");
             }
             Elems.first->second = pObject;
+            Modified            = true;
         }
     }
+
+    if (Modified)
+        m_StateId.store(GenerateStateId(), std::memory_order_release);
 }
 
 void ResourceMappingImpl::AddResource(const Char* Name, IDeviceObject* pObject, bool bIsUnique)
@@ -73,10 +87,11 @@ void ResourceMappingImpl::RemoveResourceByName(const Char* Name, Uint32 ArrayInd
     if (*Name == 0)
         return;
 
-    Threading::SpinLockGuard Guard{m_Lock};
+    Threading::AdaptiveLockGuard Guard{m_Lock};
     // Remove object with the given name
     // Name will be implicitly converted to HashMapStringKey without making a copy
-    m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex});
+    if (m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex}) > 0)
+        m_StateId.store(GenerateStateId(), std::memory_order_release);
 }
 
 IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIndex)
@@ -87,7 +102,7 @@ IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIn
         return nullptr;
     }
 
-    Threading::SpinLockGuard Guard{m_Lock};
+    Threading::AdaptiveLockGuard Guard{m_Lock};
 
     // Find an object with the requested name
     auto It = m_HashTable.find(ResMappingHashKey{Name, false, ArrayIndex});
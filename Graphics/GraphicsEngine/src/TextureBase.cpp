@@ -167,6 +167,9 @@ void ValidateTextureDesc(const TextureDesc& Desc, const IRenderDevice* pDevice)
             LOG_TEXTURE_ERROR_AND_THROW("Memoryless attachment is not compatible with mipmap generation.");
     }
 
+    if ((Desc.MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT) != 0 && (Desc.BindFlags & (BIND_RENDER_TARGET | BIND_DEPTH_STENCIL)) == 0)
+        LOG_TEXTURE_ERROR_AND_THROW("MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT requires BIND_RENDER_TARGET or BIND_DEPTH_STENCIL flag.");
+
     if (Desc.Usage == USAGE_STAGING)
     {
         if (Desc.BindFlags != 0)
@@ -81,6 +81,9 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetDynamicRenderState() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE SetDynamicRenderState(const DynamicRenderState& State) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -153,6 +156,9 @@ public:
     /// Implementation of IDeviceContext::ClearRenderTarget() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateAttachments() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateAttachments(Uint32 NumViews, ITextureView* const* ppViews) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -235,6 +241,19 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::ResolveQueries() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE ResolveQueries(IQuery* const*                 ppQueries,
+                                                   Uint32                         NumQueries,
+                                                   IBuffer*                       pDstBuffer,
+                                                   Uint64                         DstOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginConditionalRendering() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::EndConditionalRendering() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE EndConditionalRendering() override final;
+
     /// Implementation of IDeviceContext::Flush() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -299,7 +318,9 @@ public:
     /// in the cache. The function does not release cached vertex and
     /// index buffers, input layout, depth-stencil, rasterizer, and blend
     /// states.
-    void ReleaseCommittedShaderResources();
+    /// If UnbindD3D11Resources is false, the resources are only removed from the cache,
+    /// which is used when the D3D11 context has already been reset to its default state.
+    void ReleaseCommittedShaderResources(bool UnbindD3D11Resources = true);
 
     /// Unbinds all render targets. Used when resizing the swap chain.
     virtual void ResetRenderTargets() override final;
@@ -310,6 +331,10 @@ public:
     bool ResizeTilePool(ID3D11Buffer* pBuffer, UINT NewSize);
 
 private:
+    /// Resets the cached committed state. If UnbindD3D11Objects is false, no D3D11 calls are made,
+    /// which is used after FinishCommandList and ExecuteCommandList reset the D3D11 context state.
+    void ResetCommittedState(bool UnbindD3D11Objects);
+
     /// Commits d3d11 index buffer to d3d11 device context.
     void CommitD3D11IndexBuffer(VALUE_TYPE IndexType);
 
@@ -428,14 +453,30 @@ private:
         Bind
     };
 
-    // Binds all shader resource cache resources
+    // Slot ranges of constant buffers, SRVs and samplers that were updated in m_CommittedRes,
+    // but have not yet been set in the D3D11 context. Ranges from all SRBs are merged so that
+    // every resource type is set with at most one call per shader stage.
+    struct PendingBindRanges
+    {
+        ShaderResourceCacheD3D11::MinMaxSlot CBs[NumShaderTypes];
+        ShaderResourceCacheD3D11::MinMaxSlot SRVs[NumShaderTypes];
+        ShaderResourceCacheD3D11::MinMaxSlot Samplers[NumShaderTypes];
+    };
+
+    // Updates committed resources from the shader resource cache. UAVs are bound immediately,
+    // all other resources are added to the pending ranges.
     void BindCacheResources(const ShaderResourceCacheD3D11&    ResourceCache,
                             const D3D11ShaderResourceCounters& BaseBindings,
-                            PixelShaderUAVBindMode&            PsUavBindMode);
+                            PixelShaderUAVBindMode&            PsUavBindMode,
+                            PendingBindRanges&                 Ranges);
 
-    // Binds constant buffers with dynamic offsets only
+    // Updates constant buffers with dynamic offsets only
     void BindDynamicCBs(const ShaderResourceCacheD3D11&    ResourceCache,
-                        const D3D11ShaderResourceCounters& BaseBindings);
+                        const D3D11ShaderResourceCounters& BaseBindings,
+                        PendingBindRanges&                 Ranges);
+
+    // Sets the pending ranges in the D3D11 context
+    void CommitPendingBindRanges(const PendingBindRanges& Ranges);
 
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources();
@@ -45,6 +45,12 @@ public:
         CComPtr<ID3D11Query> pd3d11Query;
         bool                 IsEnded = false;
 
+        // The disjoint query is shared by all timestamp queries recorded in the same frame.
+        // Its data is read once and cached, so that resolving many timestamp queries
+        // does not result in repeated GetData calls for the same disjoint query.
+        bool   IsResolved = false;
+        UINT64 Frequency  = 0; // Zero if the counter was disjoint
+
         DisjointQueryWrapper(DisjointQueryPool&     _Pool,
                              CComPtr<ID3D11Query>&& _pd3d11Query) :
             Pool(_Pool),
@@ -59,6 +65,27 @@ public:
 
         DisjointQueryWrapper(DisjointQueryWrapper&&) = default;
 
+        /// Reads the disjoint query data if it is available. Never waits for the GPU.
+
+        /// \return    true if the data is available, and false otherwise.
+        bool Resolve(ID3D11DeviceContext* pd3d11Ctx)
+        {
+            if (IsResolved)
+                return true;
+
+            if (!IsEnded)
+                return false;
+
+            D3D11_QUERY_DATA_TIMESTAMP_DISJOINT DisjointQueryData;
+            if (pd3d11Ctx->GetData(pd3d11Query, &DisjointQueryData, sizeof(DisjointQueryData), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+                return false;
+
+            // The timestamp returned by ID3D11DeviceContext::GetData for a timestamp query is only reliable if Disjoint is FALSE.
+            Frequency  = DisjointQueryData.Disjoint ? 0 : DisjointQueryData.Frequency;
+            IsResolved = true;
+            return true;
+        }
+
         DisjointQueryWrapper(const DisjointQueryWrapper&) = delete;
         DisjointQueryWrapper& operator=(const DisjointQueryWrapper&) = delete;
         DisjointQueryWrapper& operator=(DisjointQueryWrapper&&) = delete;
@@ -76,12 +103,14 @@ public:
         {
             pd3d11Query = CreateQuery(pd3d11Device);
         }
+        ++m_NumQueriesRequested;
         return std::shared_ptr<DisjointQueryWrapper>{new DisjointQueryWrapper{*this, std::move(pd3d11Query)}};
     }
 
     ~DisjointQueryPool()
     {
-        LOG_INFO_MESSAGE("Disjoint query pool: created ", m_NumQueriesCreated, (m_NumQueriesCreated == 1 ? " query" : " queries"));
+        LOG_INFO_MESSAGE("Disjoint query pool: created ", m_NumQueriesCreated, (m_NumQueriesCreated == 1 ? " query" : " queries"),
+                         " for ", m_NumQueriesRequested, (m_NumQueriesRequested == 1 ? " frame" : " frames"));
     }
 
 private:
@@ -97,7 +126,8 @@ private:
     }
     std::vector<CComPtr<ID3D11Query>> m_AvailableQueries;
 
-    Uint32 m_NumQueriesCreated = 0;
+    Uint32 m_NumQueriesCreated   = 0;
+    Uint32 m_NumQueriesRequested = 0;
 };
 
 } // namespace Diligent
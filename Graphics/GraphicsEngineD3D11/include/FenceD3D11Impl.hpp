@@ -63,6 +63,9 @@ public:
     /// Implementation of IFence::Wait() in Direct3D11 backend.
     virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
 
+    /// Implementation of IFence::RegisterCompletionCallback() in Direct3D11 backend.
+    virtual void DILIGENT_CALL_TYPE RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData) override final;
+
     void AddPendingQuery(CComPtr<ID3D11DeviceContext1> pCtx, CComPtr<ID3D11Query> pQuery, Uint64 Value)
     {
         m_PendingQueries.emplace_back(std::move(pCtx), std::move(pQuery), Value);
@@ -337,6 +337,13 @@ public:
             MaxSlot = Slot;
         }
 
+        // Extends the range to include the other range, which may come from a different cache
+        void Merge(const MinMaxSlot& Other)
+        {
+            MinSlot = std::min(MinSlot, Other.MinSlot);
+            MaxSlot = std::max(MaxSlot, Other.MaxSlot);
+        }
+
         explicit operator bool() const
         {
             return MinSlot <= MaxSlot;
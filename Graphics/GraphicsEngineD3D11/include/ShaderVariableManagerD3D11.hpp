@@ -46,6 +46,8 @@ class ShaderVariableManagerD3D11 : ShaderVariableManagerBase<EngineD3D11ImplTrai
 {
 public:
     using TBase = ShaderVariableManagerBase<EngineD3D11ImplTraits, void>;
+    using TBase::GetResourceCache;
+    using TBase::GetSignature;
     ShaderVariableManagerD3D11(IObject&                  Owner,
                                ShaderResourceCacheD3D11& ResourceCache) noexcept :
         TBase{Owner, ResourceCache}
@@ -255,7 +257,7 @@ private:
     }
 
     template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(const Char* Name) const;
+    IShaderResourceVariable* GetResourceByResIndex(Uint32 ResIndex) const;
 
     template <typename THandleCB,
               typename THandleTexSRV,
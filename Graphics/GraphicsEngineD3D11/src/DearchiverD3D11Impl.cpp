@@ -35,7 +35,7 @@ namespace Diligent
 
 DearchiverD3D11Impl::DearchiverD3D11Impl(IReferenceCounters*         pRefCounters,
                                          const DearchiverCreateInfo& CI) noexcept :
-    TDearchiverBase{pRefCounters, CI}
+    TDearchiverBase{pRefCounters, CI, DeviceType::Direct3D11}
 {
 }
 
@@ -218,6 +218,8 @@ void DeviceContextD3D11Impl::TransitionShaderResources(IShaderResourceBinding* p
 
 void DeviceContextD3D11Impl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Commit);
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     auto* const pShaderResBindingD3D11 = ClassPtrCast<ShaderResourceBindingD3D11Impl>(pShaderResourceBinding);
@@ -245,7 +247,8 @@ void DeviceContextD3D11Impl::CommitShaderResources(IShaderResourceBinding* pShad
 
 void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&    ResourceCache,
                                                 const D3D11ShaderResourceCounters& BaseBindings,
-                                                PixelShaderUAVBindMode&            PsUavBindMode)
+                                                PixelShaderUAVBindMode&            PsUavBindMode,
+                                                PendingBindRanges&                 Ranges)
 {
     for (SHADER_TYPE ActiveStages = m_BindInfo.ActiveStages; ActiveStages != SHADER_TYPE_UNKNOWN;)
     {
@@ -259,19 +262,9 @@ void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&
             auto* NumConstants   = m_CommittedRes.CBNumConstants[ShaderInd];
             if (auto Slots = ResourceCache.BindCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings))
             {
-                auto SetCB1Method = SetCB1Methods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetCB1Method)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1,
-                                                       d3d11CBs + Slots.MinSlot,
-                                                       FirstConstants + Slots.MinSlot,
-                                                       NumConstants + Slots.MinSlot);
+                Ranges.CBs[ShaderInd].Merge(Slots);
                 m_CommittedRes.NumCBs[ShaderInd] = std::max(m_CommittedRes.NumCBs[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedCBs(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetSRVCount(ShaderInd) > 0)
@@ -280,16 +273,9 @@ void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&
             auto* d3d11SRVRes = m_CommittedRes.d3d11SRVResources[ShaderInd];
             if (auto Slots = ResourceCache.BindResourceViews<D3D11_RESOURCE_RANGE_SRV>(ShaderInd, d3d11SRVs, d3d11SRVRes, BaseBindings))
             {
-                auto SetSRVMethod = SetSRVMethods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetSRVMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, d3d11SRVs + Slots.MinSlot);
+                Ranges.SRVs[ShaderInd].Merge(Slots);
                 m_CommittedRes.NumSRVs[ShaderInd] = std::max(m_CommittedRes.NumSRVs[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedSRVs(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetSamplerCount(ShaderInd) > 0)
@@ -297,16 +283,9 @@ void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&
             auto* d3d11Samplers = m_CommittedRes.d3d11Samplers[ShaderInd];
             if (auto Slots = ResourceCache.BindResources<D3D11_RESOURCE_RANGE_SAMPLER>(ShaderInd, d3d11Samplers, BaseBindings))
             {
-                auto SetSamplerMethod = SetSamplerMethods[ShaderInd];
-                (m_pd3d11DeviceContext->*SetSamplerMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, d3d11Samplers + Slots.MinSlot);
+                Ranges.Samplers[ShaderInd].Merge(Slots);
                 m_CommittedRes.NumSamplers[ShaderInd] = std::max(m_CommittedRes.NumSamplers[ShaderInd], static_cast<Uint8>(Slots.MaxSlot + 1));
             }
-#ifdef DILIGENT_DEVELOPMENT
-            if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
-            {
-                DvpVerifyCommittedSamplers(ShaderType);
-            }
-#endif
         }
 
         if (ResourceCache.GetUAVCount(ShaderInd) > 0)
@@ -370,7 +349,8 @@ void DeviceContextD3D11Impl::BindCacheResources(const ShaderResourceCacheD3D11&
 }
 
 void DeviceContextD3D11Impl::BindDynamicCBs(const ShaderResourceCacheD3D11&    ResourceCache,
-                                            const D3D11ShaderResourceCounters& BaseBindings)
+                                            const D3D11ShaderResourceCounters& BaseBindings,
+                                            PendingBindRanges&                 Ranges)
 {
     for (SHADER_TYPE ActiveStages = m_BindInfo.ActiveStages; ActiveStages != SHADER_TYPE_UNKNOWN;)
     {
@@ -384,22 +364,52 @@ void DeviceContextD3D11Impl::BindDynamicCBs(const ShaderResourceCacheD3D11&    R
         auto* d3d11CBs       = m_CommittedRes.d3d11CBs[ShaderInd];
         auto* FirstConstants = m_CommittedRes.CBFirstConstants[ShaderInd];
         auto* NumConstants   = m_CommittedRes.CBNumConstants[ShaderInd];
-        auto  SetCB1Method   = SetCB1Methods[ShaderInd];
+        auto& CBRange        = Ranges.CBs[ShaderInd];
 
         ResourceCache.BindDynamicCBs(ShaderInd, d3d11CBs, FirstConstants, NumConstants, BaseBindings,
-                                     [&](Uint32 Slot) //
+                                     [&CBRange](Uint32 Slot) //
                                      {
-                                         (m_pd3d11DeviceContext->*SetCB1Method)(Slot, 1, d3d11CBs + Slot, FirstConstants + Slot, NumConstants + Slot);
+                                         CBRange.Merge({Slot, Slot});
                                      });
+    }
+}
 
-#ifdef DILIGENT_DEVELOPMENT
-        if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
+void DeviceContextD3D11Impl::CommitPendingBindRanges(const PendingBindRanges& Ranges)
+{
+    for (SHADER_TYPE ActiveStages = m_BindInfo.ActiveStages; ActiveStages != SHADER_TYPE_UNKNOWN;)
+    {
+        const auto ShaderInd = ExtractFirstShaderStageIndex(ActiveStages);
+
+        if (const auto& Slots = Ranges.CBs[ShaderInd])
         {
-            const auto ShaderType = GetShaderTypeFromIndex(ShaderInd);
-            DvpVerifyCommittedCBs(ShaderType);
+            auto SetCB1Method = SetCB1Methods[ShaderInd];
+            (m_pd3d11DeviceContext->*SetCB1Method)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1,
+                                                   m_CommittedRes.d3d11CBs[ShaderInd] + Slots.MinSlot,
+                                                   m_CommittedRes.CBFirstConstants[ShaderInd] + Slots.MinSlot,
+                                                   m_CommittedRes.CBNumConstants[ShaderInd] + Slots.MinSlot);
         }
-#endif
+
+        if (const auto& Slots = Ranges.SRVs[ShaderInd])
+        {
+            auto SetSRVMethod = SetSRVMethods[ShaderInd];
+            (m_pd3d11DeviceContext->*SetSRVMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, m_CommittedRes.d3d11SRVs[ShaderInd] + Slots.MinSlot);
+        }
+
+        if (const auto& Slots = Ranges.Samplers[ShaderInd])
+        {
+            auto SetSamplerMethod = SetSamplerMethods[ShaderInd];
+            (m_pd3d11DeviceContext->*SetSamplerMethod)(Slots.MinSlot, Slots.MaxSlot - Slots.MinSlot + 1, m_CommittedRes.d3d11Samplers[ShaderInd] + Slots.MinSlot);
+        }
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
+    {
+        DvpVerifyCommittedCBs(m_BindInfo.ActiveStages);
+        DvpVerifyCommittedSRVs(m_BindInfo.ActiveStages);
+        DvpVerifyCommittedSamplers(m_BindInfo.ActiveStages);
     }
+#endif
 }
 
 
@@ -411,6 +421,7 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
         PixelShaderUAVBindMode::Clear :
         PixelShaderUAVBindMode::Keep;
 
+    PendingBindRanges Ranges;
     while (BindSRBMask != 0)
     {
         auto SignBit = ExtractLSB(BindSRBMask);
@@ -426,7 +437,7 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
         if (m_BindInfo.StaleSRBMask & SignBit)
         {
             // Bind all cache resources
-            BindCacheResources(*pResourceCache, BaseBindings, PsUavBindMode);
+            BindCacheResources(*pResourceCache, BaseBindings, PsUavBindMode, Ranges);
         }
         else
         {
@@ -441,11 +452,13 @@ void DeviceContextD3D11Impl::BindShaderResources(Uint32 BindSRBMask)
                 if (PsUavBindMode != PixelShaderUAVBindMode::Bind)
                     PsUavBindMode = PixelShaderUAVBindMode::Keep;
             }
-            BindDynamicCBs(*pResourceCache, BaseBindings);
+            BindDynamicCBs(*pResourceCache, BaseBindings, Ranges);
         }
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
 
+    CommitPendingBindRanges(Ranges);
+
     if (PsUavBindMode == PixelShaderUAVBindMode::Bind)
     {
         // Pixel shader UAVs cannot be set independently; they all need to be set at the same time.
@@ -528,6 +541,11 @@ void DeviceContextD3D11Impl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+void DeviceContextD3D11Impl::SetDynamicRenderState(const DynamicRenderState& State)
+{
+    UNSUPPORTED("SetDynamicRenderState is not supported in DirectX 11");
+}
+
 void DeviceContextD3D11Impl::CommitD3D11IndexBuffer(VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pIndexBuffer, "Index buffer is not set up for indexed draw command");
@@ -686,6 +704,8 @@ void DeviceContextD3D11Impl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE
 
 void DeviceContextD3D11Impl::Draw(const DrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::Draw(Attribs, 0);
 
     PrepareForDraw(Attribs.Flags);
@@ -701,6 +721,8 @@ void DeviceContextD3D11Impl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
     PrepareForDraw(Attribs.Flags);
@@ -731,6 +753,8 @@ void DeviceContextD3D11Impl::MultiDraw(const MultiDrawAttribs& Attribs)
 
 void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -746,6 +770,8 @@ void DeviceContextD3D11Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 
 void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -770,6 +796,8 @@ void DeviceContextD3D11Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Att
 
 void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndirect(Attribs, 0);
     DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
 
@@ -807,6 +835,8 @@ void DeviceContextD3D11Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 
 void DeviceContextD3D11Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
     DEV_CHECK_ERR(Attribs.pCounterBuffer == nullptr, "Direct3D11 does not support indirect counter buffer");
 
@@ -853,6 +883,8 @@ void DeviceContextD3D11Impl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Att
 
 void DeviceContextD3D11Impl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
@@ -883,6 +915,8 @@ void DeviceContextD3D11Impl::DispatchCompute(const DispatchComputeAttribs& Attri
 
 void DeviceContextD3D11Impl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
     if (Uint32 BindSRBMask = m_BindInfo.GetCommitMask())
@@ -961,8 +995,24 @@ void DeviceContextD3D11Impl::ClearRenderTarget(ITextureView* pView, const void*
     m_pd3d11DeviceContext->ClearRenderTargetView(pd3d11RTV, static_cast<const float*>(RGBA));
 }
 
+void DeviceContextD3D11Impl::InvalidateAttachments(Uint32 NumViews, ITextureView* const* ppViews)
+{
+    TDeviceContextBase::InvalidateAttachments(NumViews, ppViews, 0);
+
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        auto* pViewD3D11 = ClassPtrCast<TextureViewD3D11Impl>(ppViews[i]);
+        if (pViewD3D11 == nullptr || pViewD3D11->GetDesc().ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL)
+            continue;
+
+        m_pd3d11DeviceContext->DiscardView(pViewD3D11->GetD3D11View());
+    }
+}
+
 void DeviceContextD3D11Impl::Flush()
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
     m_pd3d11DeviceContext->Flush();
 }
@@ -1014,6 +1064,8 @@ void DeviceContextD3D11Impl::CopyBuffer(IBuffer*                       pSrcBuffe
 
 void DeviceContextD3D11Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
 
     auto*     pBufferD3D11  = ClassPtrCast<BufferD3D11Impl>(pBuffer);
@@ -1033,6 +1085,8 @@ void DeviceContextD3D11Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_F
 
 void DeviceContextD3D11Impl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     auto* pBufferD3D11 = ClassPtrCast<BufferD3D11Impl>(pBuffer);
     m_pd3d11DeviceContext->Unmap(pBufferD3D11->m_pd3d11Buffer, 0);
@@ -1117,6 +1171,8 @@ void DeviceContextD3D11Impl::MapTextureSubresource(ITexture*                 pTe
                                                    const Box*                pMapRegion,
                                                    MappedTextureSubresource& MappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
 
     auto*       pTexD3D11     = ClassPtrCast<TextureBaseD3D11>(pTexture);
@@ -1143,6 +1199,8 @@ void DeviceContextD3D11Impl::MapTextureSubresource(ITexture*                 pTe
 
 void DeviceContextD3D11Impl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
 
     auto*       pTexD3D11   = ClassPtrCast<TextureBaseD3D11>(pTexture);
@@ -1794,7 +1852,8 @@ void ReleaseCommittedShaderResourcesHelper(TD3D11ResourceType     CommittedD3D11
     if (NumCommittedResources > 0)
     {
         memset(CommittedD3D11Res, 0, NumCommittedResources * sizeof(CommittedD3D11Res[0]));
-        SetD3D11ResourcesHelper(pDeviceCtx, SetD3D11ResMethod, 0, NumCommittedResources, CommittedD3D11Res);
+        if (pDeviceCtx != nullptr)
+            SetD3D11ResourcesHelper(pDeviceCtx, SetD3D11ResMethod, 0, NumCommittedResources, CommittedD3D11Res);
     }
 }
 
@@ -1805,29 +1864,34 @@ void ReleaseCommittedPSUAVs(ID3D11UnorderedAccessView* CommittedD3D11UAVs[],
     if (NumCommittedResources > 0)
     {
         memset(CommittedD3D11UAVs, 0, NumCommittedResources * sizeof(CommittedD3D11UAVs[0]));
-        pDeviceCtx->OMSetRenderTargetsAndUnorderedAccessViews(
-            D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr,
-            0, 0, nullptr, nullptr);
+        if (pDeviceCtx != nullptr)
+        {
+            pDeviceCtx->OMSetRenderTargetsAndUnorderedAccessViews(
+                D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL, nullptr, nullptr,
+                0, 0, nullptr, nullptr);
+        }
     }
 }
 
-void DeviceContextD3D11Impl::ReleaseCommittedShaderResources()
+void DeviceContextD3D11Impl::ReleaseCommittedShaderResources(bool UnbindD3D11Resources)
 {
     // Make sure all resources are committed next time
     m_BindInfo.MakeAllStale();
 
+    // When the D3D11 context has already been reset to the default state, only the shadow state is cleared
+    ID3D11DeviceContext* pd3d11Ctx = UnbindD3D11Resources ? m_pd3d11DeviceContext.p : nullptr;
     for (int ShaderType = 0; ShaderType < NumShaderTypes; ++ShaderType)
     {
         // clang-format off
-        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11CBs[ShaderType],      m_CommittedRes.NumCBs[ShaderType],      SetCBMethods[ShaderType],      m_pd3d11DeviceContext);
-        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11SRVs[ShaderType],     m_CommittedRes.NumSRVs[ShaderType],     SetSRVMethods[ShaderType],     m_pd3d11DeviceContext);
-        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11Samplers[ShaderType], m_CommittedRes.NumSamplers[ShaderType], SetSamplerMethods[ShaderType], m_pd3d11DeviceContext);
+        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11CBs[ShaderType],      m_CommittedRes.NumCBs[ShaderType],      SetCBMethods[ShaderType],      pd3d11Ctx);
+        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11SRVs[ShaderType],     m_CommittedRes.NumSRVs[ShaderType],     SetSRVMethods[ShaderType],     pd3d11Ctx);
+        ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11Samplers[ShaderType], m_CommittedRes.NumSamplers[ShaderType], SetSamplerMethods[ShaderType], pd3d11Ctx);
         // clang-format on
 
         if (ShaderType == PSInd)
-            ReleaseCommittedPSUAVs(m_CommittedRes.d3d11UAVs[ShaderType], m_CommittedRes.NumUAVs[ShaderType], m_pd3d11DeviceContext);
+            ReleaseCommittedPSUAVs(m_CommittedRes.d3d11UAVs[ShaderType], m_CommittedRes.NumUAVs[ShaderType], pd3d11Ctx);
         else
-            ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11UAVs[ShaderType], m_CommittedRes.NumUAVs[ShaderType], SetUAVMethods[ShaderType], m_pd3d11DeviceContext);
+            ReleaseCommittedShaderResourcesHelper(m_CommittedRes.d3d11UAVs[ShaderType], m_CommittedRes.NumUAVs[ShaderType], SetUAVMethods[ShaderType], pd3d11Ctx);
 
         memset(m_CommittedRes.d3d11SRVResources[ShaderType], 0, sizeof(m_CommittedRes.d3d11SRVResources[ShaderType][0]) * m_CommittedRes.NumSRVs[ShaderType]);
         memset(m_CommittedRes.d3d11UAVResources[ShaderType], 0, sizeof(m_CommittedRes.d3d11UAVResources[ShaderType][0]) * m_CommittedRes.NumUAVs[ShaderType]);
@@ -1873,8 +1937,9 @@ void DeviceContextD3D11Impl::FinishCommandList(ICommandList** ppCommandList)
     CommandListD3D11Impl* pCmdListD3D11(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D11Impl instance", CommandListD3D11Impl)(m_pDevice, this, pd3d11CmdList));
     pCmdListD3D11->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
-    // Device context is now in default state
-    InvalidateState();
+    // The deferred context is now in default state, so only the shadow state
+    // needs to be reset to keep the redundant binding checks accurate.
+    ResetCommittedState(false);
 
 #ifdef DILIGENT_DEVELOPMENT
     if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
@@ -1897,6 +1962,8 @@ void DeviceContextD3D11Impl::FinishCommandList(ICommandList** ppCommandList)
 void DeviceContextD3D11Impl::ExecuteCommandLists(Uint32               NumCommandLists,
                                                  ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
 
     if (NumCommandLists == 0)
@@ -1905,6 +1972,8 @@ void DeviceContextD3D11Impl::ExecuteCommandLists(Uint32               NumCommand
 
     for (Uint32 i = 0; i < NumCommandLists; ++i)
     {
+        // D3D11 command lists are not consumed by the execution, so the same command list
+        // may be executed any number of times, e.g. to replay static content every frame.
         auto* pCmdListD3D11 = ClassPtrCast<CommandListD3D11Impl>(ppCommandLists[i]);
         auto* pd3d11CmdList = pCmdListD3D11->GetD3D11CommandList();
         m_pd3d11DeviceContext->ExecuteCommandList(pd3d11CmdList,
@@ -1917,8 +1986,9 @@ void DeviceContextD3D11Impl::ExecuteCommandLists(Uint32               NumCommand
         );
     }
 
-    // Device context is now in default state
-    InvalidateState();
+    // Device context is now in default state, so only the shadow state
+    // needs to be reset to keep the redundant binding checks accurate.
+    ResetCommittedState(false);
 
 #ifdef DILIGENT_DEVELOPMENT
     if (m_D3D11ValidationFlags & D3D11_VALIDATION_FLAG_VERIFY_COMMITTED_RESOURCE_RELEVANCE)
@@ -2025,6 +2095,25 @@ void DeviceContextD3D11Impl::EndQuery(IQuery* pQuery)
     m_pd3d11DeviceContext->End(pQueryD3D11Impl->GetD3D11Query(QueryType == QUERY_TYPE_DURATION ? 1 : 0));
 }
 
+void DeviceContextD3D11Impl::ResolveQueries(IQuery* const*                 ppQueries,
+                                            Uint32                         NumQueries,
+                                            IBuffer*                       pDstBuffer,
+                                            Uint64                         DstOffset,
+                                            RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    UNSUPPORTED("ResolveQueries is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs)
+{
+    UNSUPPORTED("Conditional rendering is not supported in DirectX 11");
+}
+
+void DeviceContextD3D11Impl::EndConditionalRendering()
+{
+    UNSUPPORTED("Conditional rendering is not supported in DirectX 11");
+}
+
 void DeviceContextD3D11Impl::ClearStateCache()
 {
     TDeviceContextBase::ClearStateCache();
@@ -2058,20 +2147,28 @@ void DeviceContextD3D11Impl::ClearStateCache()
 }
 
 void DeviceContextD3D11Impl::InvalidateState()
+{
+    ResetCommittedState(true);
+}
+
+void DeviceContextD3D11Impl::ResetCommittedState(bool UnbindD3D11Objects)
 {
     TDeviceContextBase::InvalidateState();
 
-    ReleaseCommittedShaderResources();
+    ReleaseCommittedShaderResources(UnbindD3D11Objects);
     for (int ShaderType = 0; ShaderType < NumShaderTypes; ++ShaderType)
         m_CommittedD3DShaders[ShaderType].Release();
-    m_pd3d11DeviceContext->VSSetShader(nullptr, nullptr, 0);
-    m_pd3d11DeviceContext->GSSetShader(nullptr, nullptr, 0);
-    m_pd3d11DeviceContext->PSSetShader(nullptr, nullptr, 0);
-    m_pd3d11DeviceContext->HSSetShader(nullptr, nullptr, 0);
-    m_pd3d11DeviceContext->DSSetShader(nullptr, nullptr, 0);
-    m_pd3d11DeviceContext->CSSetShader(nullptr, nullptr, 0);
-    ID3D11RenderTargetView* d3d11NullRTV[] = {nullptr};
-    m_pd3d11DeviceContext->OMSetRenderTargets(1, d3d11NullRTV, nullptr);
+    if (UnbindD3D11Objects)
+    {
+        m_pd3d11DeviceContext->VSSetShader(nullptr, nullptr, 0);
+        m_pd3d11DeviceContext->GSSetShader(nullptr, nullptr, 0);
+        m_pd3d11DeviceContext->PSSetShader(nullptr, nullptr, 0);
+        m_pd3d11DeviceContext->HSSetShader(nullptr, nullptr, 0);
+        m_pd3d11DeviceContext->DSSetShader(nullptr, nullptr, 0);
+        m_pd3d11DeviceContext->CSSetShader(nullptr, nullptr, 0);
+        ID3D11RenderTargetView* d3d11NullRTV[] = {nullptr};
+        m_pd3d11DeviceContext->OMSetRenderTargets(1, d3d11NullRTV, nullptr);
+    }
 
     if (m_NumCommittedD3D11VBs > 0)
     {
@@ -2081,7 +2178,8 @@ void DeviceContextD3D11Impl::InvalidateState()
             m_CommittedD3D11VBStrides[vb]     = 0;
             m_CommittedD3D11VBOffsets[vb]     = 0;
         }
-        m_pd3d11DeviceContext->IASetVertexBuffers(0, m_NumCommittedD3D11VBs, m_CommittedD3D11VertexBuffers, m_CommittedD3D11VBStrides, m_CommittedD3D11VBOffsets);
+        if (UnbindD3D11Objects)
+            m_pd3d11DeviceContext->IASetVertexBuffers(0, m_NumCommittedD3D11VBs, m_CommittedD3D11VertexBuffers, m_CommittedD3D11VBStrides, m_CommittedD3D11VBOffsets);
         m_NumCommittedD3D11VBs = 0;
     }
 
@@ -2089,13 +2187,15 @@ void DeviceContextD3D11Impl::InvalidateState()
 
     if (m_CommittedD3D11InputLayout != nullptr)
     {
-        m_pd3d11DeviceContext->IASetInputLayout(nullptr);
+        if (UnbindD3D11Objects)
+            m_pd3d11DeviceContext->IASetInputLayout(nullptr);
         m_CommittedD3D11InputLayout = nullptr;
     }
 
     if (m_CommittedD3D11IndexBuffer)
     {
-        m_pd3d11DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_R32_UINT, 0);
+        if (UnbindD3D11Objects)
+            m_pd3d11DeviceContext->IASetIndexBuffer(nullptr, DXGI_FORMAT_R32_UINT, 0);
         m_CommittedD3D11IndexBuffer.Release();
     }
 
@@ -2153,6 +2253,8 @@ static void AliasingBarrier(ID3D11DeviceContext* pd3d11Ctx, IDeviceObject* pReso
 
 void DeviceContextD3D11Impl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Transition);
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 
     for (Uint32 i = 0; i < BarrierCount; ++i)
@@ -101,4 +101,9 @@ void FenceD3D11Impl::Signal(Uint64 Value)
     DEV_ERROR("Signal() is not supported in Direct3D11 backend");
 }
 
+void FenceD3D11Impl::RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    DEV_ERROR("RegisterCompletionCallback() is not supported in Direct3D11 backend");
+}
+
 } // namespace Diligent
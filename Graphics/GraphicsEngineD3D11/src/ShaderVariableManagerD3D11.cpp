@@ -41,6 +41,7 @@
 #include "ShaderD3D11Impl.hpp"
 #include "ShaderResourceVariableBase.hpp"
 #include "PipelineResourceSignatureD3D11Impl.hpp"
+#include "RenderDeviceD3D11Impl.hpp"
 
 namespace Diligent
 {
@@ -191,7 +192,7 @@ void ShaderVariableManagerD3D11::Initialize(const PipelineResourceSignatureD3D11
     // clang-format on
 
     VERIFY_EXPR(m_MemorySize == GetRequiredMemorySize(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType));
-    TBase::Initialize(Signature, Allocator, m_MemorySize);
+    TBase::Initialize(Signature, Allocator, m_MemorySize, ShaderType);
 
     // clang-format off
     VERIFY_EXPR(ResCounters.NumCBs     == GetNumCBs()     );
@@ -503,62 +504,64 @@ void ShaderVariableManagerD3D11::BindResources(IResourceMapping* pResourceMappin
     if ((Flags & BIND_SHADER_RESOURCES_UPDATE_ALL) == 0)
         Flags |= BIND_SHADER_RESOURCES_UPDATE_ALL;
 
+    m_BindingPlan.Begin(pResourceMapping);
     HandleResources(
         [&](ConstBuffBindInfo& cb) {
-            cb.BindResources(pResourceMapping, Flags);
+            cb.BindResources(m_BindingPlan, Flags);
         },
         [&](TexSRVBindInfo& ts) {
-            ts.BindResources(pResourceMapping, Flags);
+            ts.BindResources(m_BindingPlan, Flags);
         },
         [&](TexUAVBindInfo& uav) {
-            uav.BindResources(pResourceMapping, Flags);
+            uav.BindResources(m_BindingPlan, Flags);
         },
         [&](BuffSRVBindInfo& srv) {
-            srv.BindResources(pResourceMapping, Flags);
+            srv.BindResources(m_BindingPlan, Flags);
         },
         [&](BuffUAVBindInfo& uav) {
-            uav.BindResources(pResourceMapping, Flags);
+            uav.BindResources(m_BindingPlan, Flags);
         },
         [&](SamplerBindInfo& sam) {
-            sam.BindResources(pResourceMapping, Flags);
+            sam.BindResources(m_BindingPlan, Flags);
         });
+    m_BindingPlan.End();
 }
 
 template <typename ResourceType>
-IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByName(const Char* Name) const
+IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByResIndex(Uint32 ResIndex) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        auto& Resource = GetResource<ResourceType>(res);
-        if (strcmp(Resource.GetDesc().Name, Name) == 0)
-            return &Resource;
-    }
+    const Uint32 NumResources = GetNumResources<ResourceType>();
+    if (NumResources == 0)
+        return nullptr;
 
-    return nullptr;
+    return FindVariableByResIndex(&GetResource<ResourceType>(0), NumResources, ResIndex);
 }
 
 IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariable(const Char* Name) const
 {
-    if (auto* pCB = GetResourceByName<ConstBuffBindInfo>(Name))
+    const Uint32 ResIndex = FindResourceIndex(Name);
+    if (ResIndex == InvalidPipelineResourceIndex)
+        return nullptr;
+
+    if (auto* pCB = GetResourceByResIndex<ConstBuffBindInfo>(ResIndex))
         return pCB;
 
-    if (auto* pTexSRV = GetResourceByName<TexSRVBindInfo>(Name))
+    if (auto* pTexSRV = GetResourceByResIndex<TexSRVBindInfo>(ResIndex))
         return pTexSRV;
 
-    if (auto* pTexUAV = GetResourceByName<TexUAVBindInfo>(Name))
+    if (auto* pTexUAV = GetResourceByResIndex<TexUAVBindInfo>(ResIndex))
         return pTexUAV;
 
-    if (auto* pBuffSRV = GetResourceByName<BuffSRVBindInfo>(Name))
+    if (auto* pBuffSRV = GetResourceByResIndex<BuffSRVBindInfo>(ResIndex))
         return pBuffSRV;
 
-    if (auto* pBuffUAV = GetResourceByName<BuffUAVBindInfo>(Name))
+    if (auto* pBuffUAV = GetResourceByResIndex<BuffUAVBindInfo>(ResIndex))
         return pBuffUAV;
 
     if (!m_pSignature->IsUsingCombinedSamplers())
     {
         // Immutable samplers are never initialized as variables
-        if (auto* pSampler = GetResourceByName<SamplerBindInfo>(Name))
+        if (auto* pSampler = GetResourceByResIndex<SamplerBindInfo>(ResIndex))
             return pSampler;
     }
 
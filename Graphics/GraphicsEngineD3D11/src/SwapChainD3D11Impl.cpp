@@ -147,12 +147,7 @@ void SwapChainD3D11Impl::Present(Uint32 SyncInterval)
         // as this can explicitly be done by the user
     }
 
-    // In contrast to MSDN sample, we wait for the frame as late as possible - right
-    // before presenting.
-    // https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains#step-4-wait-before-rendering-each-frame
-    WaitForFrame();
-
-    m_pSwapChain->Present(SyncInterval, 0);
+    PresentAndWait(SyncInterval);
 }
 
 void SwapChainD3D11Impl::UpdateSwapChain(bool CreateNew)
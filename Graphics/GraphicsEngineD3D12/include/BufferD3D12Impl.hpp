@@ -36,6 +36,7 @@
 #include "D3D12ResourceBase.hpp"
 #include "D3D12DynamicHeap.hpp"
 #include "DescriptorHeap.hpp"
+#include "D3D12MemoryManager.hpp"
 #include "IndexWrapper.hpp"
 
 namespace Diligent
@@ -127,6 +128,12 @@ private:
 
     DescriptorHeapAllocation m_CBVDescriptorAllocation;
 
+    // Memory of a placed resource suballocated from a resource heap page
+    D3D12MemoryAllocation m_MemoryAllocation;
+
+    // CPU address of the persistently mapped buffer in the GPU upload heap, see MISC_BUFFER_FLAG_DIRECT_UPDATES.
+    void* m_pDirectUpdateCPUAddress = nullptr;
+
     // Align the struct size to the cache line size to avoid false sharing
     static constexpr size_t CacheLineSize = 64;
     struct alignas(CacheLineSize) CtxDynamicData : D3D12DynamicAllocation
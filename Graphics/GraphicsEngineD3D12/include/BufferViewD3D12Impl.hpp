@@ -60,9 +60,15 @@ public:
         return m_DescriptorHandle.GetCpuHandle();
     }
 
+    /// Implementation of IBufferViewD3D12::GetDescriptorHeapIndex().
+    virtual Uint32 DILIGENT_CALL_TYPE GetDescriptorHeapIndex() const override final;
+
 protected:
     // Allocation in a CPU-only descriptor heap
     DescriptorHeapAllocation m_DescriptorHandle;
+
+    // Descriptor at a stable index in the shader-visible heap (only when bindless resources are enabled)
+    DescriptorHeapAllocation m_BindlessDescriptor;
 };
 
 } // namespace Diligent
@@ -80,7 +80,11 @@ public:
     // Submit the command buffer and reset it.  This is encouraged to keep the GPU busy and reduce latency.
     // Taking too long to build command lists and submit them can idle the GPU.
     ID3D12GraphicsCommandList* Close(CComPtr<ID3D12CommandAllocator>& pAllocator);
-    void                       Reset(CommandListManager& CmdListManager);
+    // ExpectedNumCommands is the estimated size of the new command list, see CommandListManager::RequestAllocator().
+    void Reset(CommandListManager& CmdListManager, Uint32 ExpectedNumCommands = 0);
+
+    // Returns the approximate number of commands recorded into the command list since it was reset.
+    Uint32 GetNumRecordedCommands() const { return m_NumRecordedCommands; }
 
     class GraphicsContext&  AsGraphicsContext();
     class GraphicsContext1& AsGraphicsContext1();
@@ -138,13 +142,51 @@ public:
 
     void FlushResourceBarriers()
     {
+        // Almost every command that does actual work flushes the barriers first,
+        // so the number of flushes is a good estimate of the command list size.
+        ++m_NumRecordedCommands;
+
         if (!m_PendingResourceBarriers.empty())
         {
+            DEV_CHECK_ERR(GetCommandListType() != D3D12_COMMAND_LIST_TYPE_BUNDLE,
+                          "Resource barriers can't be recorded into a bundle. Transition all resources to the required states before executing the bundle.");
             m_pCommandList->ResourceBarrier(static_cast<UINT>(m_PendingResourceBarriers.size()), m_PendingResourceBarriers.data());
             m_PendingResourceBarriers.clear();
+            if (m_pBarrierCounters != nullptr)
+                ++m_pBarrierCounters->BarrierBatches;
         }
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        if (HasPendingEnhancedBarriers())
+            FlushEnhancedBarriers();
+#endif
     }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    // Returns true if resource state transitions in this context are performed
+    // using enhanced barriers (ID3D12GraphicsCommandList7::Barrier).
+    bool UseEnhancedBarriers() const { return m_UseEnhancedBarriers; }
+
+    // Enhanced barriers are accumulated and submitted as barrier groups by a single
+    // ID3D12GraphicsCommandList7::Barrier call when the barriers are flushed.
+    void BufferBarrier(const D3D12_BUFFER_BARRIER& Barrier);
+    void TextureBarrier(const D3D12_TEXTURE_BARRIER& Barrier);
+
+    // All global barriers recorded between two flushes are merged into a single barrier.
+    void GlobalBarrier(const D3D12_GLOBAL_BARRIER& Barrier);
+#else
+    constexpr bool UseEnhancedBarriers() const { return false; }
+#endif
+
+    // Sets the counters that are updated when resource state transitions are recorded and flushed.
+    // The pointer is cleared when the context is reset.
+    void SetBarrierCounters(DeviceContextBarrierCounters* pCounters) { m_pBarrierCounters = pCounters; }
+
+    DeviceContextBarrierCounters* GetBarrierCounters() const { return m_pBarrierCounters; }
+
+    // Sets the counters that are updated when dynamic descriptors are allocated.
+    // The pointer is cleared when the context is reset.
+    void SetAllocationCounters(DeviceContextAllocationCounters* pCounters) { m_pAllocationCounters = pCounters; }
+
 
     struct ShaderDescriptorHeaps
     {
@@ -184,13 +226,23 @@ public:
 
     DescriptorHeapAllocation AllocateDynamicGPUVisibleDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE Type, UINT Count = 1)
     {
+        DEV_CHECK_ERR(GetCommandListType() != D3D12_COMMAND_LIST_TYPE_BUNDLE,
+                      "Dynamic descriptors are released at the end of the frame and can't be used by bundles. "
+                      "Bundles must not use dynamic shader variables.");
         VERIFY(m_DynamicGPUDescriptorAllocators != nullptr, "Dynamic GPU descriptor allocators have not been initialized. Did you forget to call SetDynamicGPUDescriptorAllocators() after resetting the context?");
         VERIFY(Type >= D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV && Type <= D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, "Invalid heap type");
+        if (m_pAllocationCounters != nullptr)
+            ++m_pAllocationCounters->DescriptorSets;
         return m_DynamicGPUDescriptorAllocators[Type].Allocate(Count);
     }
 
     void ResourceBarrier(const D3D12_RESOURCE_BARRIER& Barrier)
     {
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        // Legacy and enhanced barriers must be executed in the order they were recorded
+        if (HasPendingEnhancedBarriers())
+            FlushEnhancedBarriers();
+#endif
         m_PendingResourceBarriers.emplace_back(Barrier);
     }
 
@@ -228,6 +280,11 @@ public:
         m_pCommandList->ResolveQueryData(pQueryHeap, Type, StartIndex, NumQueries, pDestinationBuffer, AlignedDestinationBufferOffset);
     }
 
+    void SetPredication(ID3D12Resource* pBuffer, UINT64 AlignedBufferOffset, D3D12_PREDICATION_OP Operation)
+    {
+        m_pCommandList->SetPredication(pBuffer, AlignedBufferOffset, Operation);
+    }
+
     void DiscardResource(ID3D12Resource* pResource, const D3D12_DISCARD_REGION* pRegion)
     {
         m_pCommandList->DiscardResource(pResource, pRegion);
@@ -261,15 +318,36 @@ protected:
 
     std::vector<D3D12_RESOURCE_BARRIER, STDAllocatorRawMem<D3D12_RESOURCE_BARRIER>> m_PendingResourceBarriers;
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    bool HasPendingEnhancedBarriers() const
+    {
+        return m_HasPendingGlobalBarrier || !m_PendingBufferBarriers.empty() || !m_PendingTextureBarriers.empty();
+    }
+    void FlushEnhancedBarriers();
+
+    std::vector<D3D12_BUFFER_BARRIER, STDAllocatorRawMem<D3D12_BUFFER_BARRIER>>   m_PendingBufferBarriers;
+    std::vector<D3D12_TEXTURE_BARRIER, STDAllocatorRawMem<D3D12_TEXTURE_BARRIER>> m_PendingTextureBarriers;
+
+    D3D12_GLOBAL_BARRIER m_PendingGlobalBarrier{};
+    bool                 m_HasPendingGlobalBarrier = false;
+
+    bool m_UseEnhancedBarriers = false;
+#endif
+
     ShaderDescriptorHeaps m_BoundDescriptorHeaps;
 
     DynamicSuballocationsManager* m_DynamicGPUDescriptorAllocators = nullptr;
 
+    DeviceContextBarrierCounters*    m_pBarrierCounters    = nullptr;
+    DeviceContextAllocationCounters* m_pAllocationCounters = nullptr;
+
     String m_ID;
 
     D3D12_PRIMITIVE_TOPOLOGY m_PrimitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
 
     Uint32 m_MaxInterfaceVer = 0;
+
+    Uint32 m_NumRecordedCommands = 0;
 };
 
 class ComputeContext : public CommandContext
@@ -364,6 +442,19 @@ public:
         FlushResourceBarriers();
         m_pCommandList->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
     }
+
+    void ExecuteBundle(ID3D12GraphicsCommandList* pBundle)
+    {
+        FlushResourceBarriers();
+        m_pCommandList->ExecuteBundle(pBundle);
+
+        // The pipeline state, root signature and primitive topology set by the bundle
+        // are inherited by the command list.
+        m_pCurPipelineState         = nullptr;
+        m_pCurGraphicsRootSignature = nullptr;
+        m_pCurComputeRootSignature  = nullptr;
+        m_PrimitiveTopology         = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    }
 };
 
 class GraphicsContext1 : public GraphicsContext
@@ -30,6 +30,8 @@
 /// \file
 /// Declaration of Diligent::CommandListD3D12Impl class
 
+#include <atomic>
+
 #include "EngineD3D12ImplTraits.hpp"
 #include "CommandListBase.hpp"
 
@@ -60,9 +62,33 @@ public:
         VERIFY_EXPR(m_pCmdContext);
     }
 
+    // Creates a reusable command list from a closed bundle (see IDeviceContextD3D12::BeginReusableCommandList).
+    CommandListD3D12Impl(IReferenceCounters*                           pRefCounters,
+                         RenderDeviceD3D12Impl*                        pDevice,
+                         DeviceContextD3D12Impl*                       pDeferredCtx,
+                         RenderDeviceD3D12Impl::PooledCommandContext&& pBundleContext,
+                         CComPtr<ID3D12CommandAllocator>&&             pBundleAllocator) :
+        // clang-format off
+        TCommandListBase
+        {
+            pRefCounters,
+            pDevice,
+            pDeferredCtx
+        },
+        m_pCmdContext     {std::move(pBundleContext)  },
+        m_pBundleAllocator{std::move(pBundleAllocator)}
+    // clang-format on
+    {
+        VERIFY_EXPR(m_pCmdContext && m_pCmdContext->GetCommandListType() == D3D12_COMMAND_LIST_TYPE_BUNDLE);
+    }
+
     ~CommandListD3D12Impl()
     {
-        if (m_pCmdContext != nullptr)
+        if (IsBundle())
+        {
+            m_pDevice->ReleaseBundleContext(std::move(m_pCmdContext), std::move(m_pBundleAllocator), m_ExecutedQueueMask.load());
+        }
+        else if (m_pCmdContext != nullptr)
         {
             LOG_WARNING_MESSAGE("Destroying command list that has not been executed");
             m_pDevice->DisposeCommandContext(std::move(m_pCmdContext));
@@ -79,9 +105,26 @@ public:
         return std::move(m_pCmdContext);
     }
 
+    bool IsBundle() const { return m_pBundleAllocator != nullptr; }
+
+    // Returns the bundle to execute by the command list of the immediate context with the given queue.
+    // Unlike regular command lists, bundles are not consumed and may be executed any number of times.
+    ID3D12GraphicsCommandList* GetBundle(SoftwareQueueIndex CmdQueue)
+    {
+        VERIFY_EXPR(IsBundle());
+        m_ExecutedQueueMask.fetch_or(Uint64{1} << Uint64{CmdQueue});
+        return m_pCmdContext->GetCommandList();
+    }
+
 private:
     RefCntAutoPtr<DeviceContextD3D12Impl>       m_pDeferredCtx;
     RenderDeviceD3D12Impl::PooledCommandContext m_pCmdContext;
+
+    // Bundle allocator is kept alive until the bundle is released
+    CComPtr<ID3D12CommandAllocator> m_pBundleAllocator;
+
+    // Queues that have executed the bundle
+    std::atomic<Uint64> m_ExecutedQueueMask{0};
 };
 
 } // namespace Diligent
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <mutex>
 #include <atomic>
 #include <stdint.h>
@@ -38,6 +39,10 @@ namespace Diligent
 
 class RenderDeviceD3D12Impl;
 
+// Command allocators never release the memory they used, even when they are reset.
+// To avoid reusing large allocators for small command lists, free allocators are bucketed
+// by the number of commands that were recorded with them, and every bucket is split into
+// several pools so that threads recording deferred contexts do not contend for the same mutex.
 class CommandListManager
 {
 public:
@@ -54,12 +59,18 @@ public:
     // Returns the maximum supported interface version
     void CreateNewCommandList(ID3D12GraphicsCommandList** ppList, ID3D12CommandAllocator** ppAllocator, Uint32& IfaceVersion);
 
-    void RequestAllocator(ID3D12CommandAllocator** ppAllocator);
-    void ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
+    // Requests an allocator from the pool of the calling thread.
+    // ExpectedNumCommands is the estimated number of commands that will be recorded with the allocator,
+    // typically the number of commands in the previous command list recorded by the same context.
+    void RequestAllocator(ID3D12CommandAllocator** ppAllocator, Uint32 ExpectedNumCommands = 0);
+
+    // Schedules the allocator to be returned to the pool when the GPU finishes the command list.
+    // NumRecordedCommands is the number of commands recorded with the allocator, see CommandContext::GetNumRecordedCommands().
+    void ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, Uint32 NumRecordedCommands, SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     // Returns allocator to the list of available allocators. The GPU must have finished using the
-    // allocator
-    void FreeAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator);
+    // allocator. Allocators that are repeatedly used for much smaller command lists are released.
+    void FreeAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, Uint32 NumRecordedCommands);
 
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatorCounter() const
@@ -73,15 +84,59 @@ public:
         return m_CmdListType;
     }
 
+    // Returns true if the device supports enhanced barriers (ID3D12GraphicsCommandList7::Barrier)
+    bool IsEnhancedBarriersSupported() const;
+
+    // Allocator size buckets: fewer than 512 commands, fewer than 8192 commands, and larger.
+    static constexpr Uint32 NumSizeBuckets = 3;
+
+    static Uint32 GetSizeBucket(Uint32 NumCommands)
+    {
+        return NumCommands < 512 ? 0 : (NumCommands < 8192 ? 1 : 2);
+    }
+
 private:
-    std::mutex                                                                                        m_AllocatorMutex;
-    std::vector<CComPtr<ID3D12CommandAllocator>, STDAllocatorRawMem<CComPtr<ID3D12CommandAllocator>>> m_FreeAllocators;
+    // Bookkeeping data stored as the private data of every allocator
+    struct AllocatorInfo
+    {
+        // The maximum number of commands ever recorded with the allocator
+        Uint32 HighWaterMark = 0;
+
+        // The number of consecutive command lists that belonged to a smaller size bucket
+        Uint32 NumOversizedUses = 0;
+
+        // The index of the pool the allocator belongs to
+        Uint32 PoolIndex = 0;
+    };
+    static const GUID AllocatorInfoGUID;
+
+    static AllocatorInfo GetAllocatorInfo(ID3D12CommandAllocator* pAllocator);
+    static void          SetAllocatorInfo(ID3D12CommandAllocator* pAllocator, const AllocatorInfo& Info);
+
+    static Uint32 GetThreadPoolIndex();
+
+    // An allocator is released after it has been used for this number of consecutive smaller command lists
+    static constexpr Uint32 MaxOversizedUses = 8;
+
+    // The maximum number of free allocators kept in the largest size bucket of each pool
+    static constexpr size_t MaxFreeLargeAllocators = 2;
+
+    static constexpr Uint32 NumThreadPools = 4;
+
+    struct AllocatorPool
+    {
+        std::mutex Mtx;
+
+        std::array<std::vector<CComPtr<ID3D12CommandAllocator>>, NumSizeBuckets> FreeAllocators;
+    };
+    std::array<AllocatorPool, NumThreadPools> m_Pools;
 
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
     const D3D12_COMMAND_LIST_TYPE m_CmdListType;
 
-    std::atomic<Int32> m_NumAllocators{0}; // For logging only
+    std::atomic<Int32> m_NumAllocators{0};        // For logging only
+    std::atomic<Int32> m_NumTrimmedAllocators{0}; // For logging only
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatorCounter{0};
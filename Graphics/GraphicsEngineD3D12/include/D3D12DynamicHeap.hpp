@@ -31,6 +31,8 @@
 #include <map>
 #include <deque>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 namespace Diligent
 {
@@ -76,13 +78,14 @@ struct D3D12DynamicAllocation
 class D3D12DynamicPage
 {
 public:
-    D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size);
+    D3D12DynamicPage() noexcept {}
+    D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size, D3D12_HEAP_TYPE HeapType = D3D12_HEAP_TYPE_UPLOAD);
 
     // clang-format off
     D3D12DynamicPage            (const D3D12DynamicPage&)  = delete;
     D3D12DynamicPage            (      D3D12DynamicPage&&) = default;
     D3D12DynamicPage& operator= (const D3D12DynamicPage&)  = delete;
-    D3D12DynamicPage& operator= (      D3D12DynamicPage&&) = delete;
+    D3D12DynamicPage& operator= (      D3D12DynamicPage&&) = default;
     // clang-format on
 
     void* GetCPUAddress(Uint64 Offset)
@@ -119,6 +122,13 @@ private:
 };
 
 
+// Dynamic memory manager keeps pages that are not used by any dynamic heap.
+//
+// Page sizes requested by dynamic heaps are always PageSize * 2^k. Pages of the first NumSizeClasses
+// sizes are kept in per-size-class lock-free free lists, so that contexts that overflow their current
+// page do not contend for a mutex. Free lists are LIFO: the most recently released page, which is the
+// most likely to still be resident in the CPU caches and TLB, is reused first. Pages of other sizes are
+// rare and are kept in a separate list protected by a mutex.
 class D3D12DynamicMemoryManager
 {
 public:
@@ -139,7 +149,9 @@ public:
 
     void Destroy();
 
-    D3D12DynamicPage AllocatePage(Uint64 SizeInBytes);
+    // If pIsRecycled is not null, it is set to true if the page was taken from the free lists,
+    // and to false if a new page was created.
+    D3D12DynamicPage AllocatePage(Uint64 SizeInBytes, bool* pIsRecycled = nullptr);
 
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedPageCounter() const
@@ -148,12 +160,84 @@ public:
     }
 #endif
 
+    struct Statistics
+    {
+        // The total number of AllocatePage() calls
+        Uint64 NumPagesRequested = 0;
+
+        // The number of requests served by the free lists
+        Uint64 NumPagesRecycled = 0;
+
+        // The number of requests that created a new page
+        Uint64 NumPagesCreated = 0;
+
+        // The number of released pages that were destroyed because the free lists ran out of nodes
+        Uint64 NumPagesDiscarded = 0;
+    };
+    Statistics GetStatistics() const;
+
 private:
+    static constexpr Uint32 NumSizeClasses = 8;
+
+    static constexpr Uint32 NodeChunkSizeLog2 = 6;
+    static constexpr Uint32 NodeChunkSize     = 1u << NodeChunkSizeLog2;
+    static constexpr Uint32 MaxNodeChunks     = 256;
+    static constexpr Uint32 InvalidNode       = ~0u;
+
+    struct PageNode
+    {
+        D3D12DynamicPage    Page;
+        std::atomic<Uint32> Next{InvalidNode};
+    };
+
+    static Uint64 PackFreeListHead(Uint32 Tag, Uint32 Node)
+    {
+        return (static_cast<Uint64>(Tag) << 32u) | Uint64{Node};
+    }
+
+    // Returns the size class of the page of the given size, or NumSizeClasses
+    // if the size is not PageSize * 2^k for any k < NumSizeClasses.
+    Uint32 GetSizeClass(Uint64 Size) const;
+
+    PageNode& GetNode(Uint32 NodeIdx) const;
+    Uint32    PopNode(std::atomic<Uint64>& Head);
+    void      PushNode(std::atomic<Uint64>& Head, Uint32 NodeIdx);
+    Uint32    AllocateNode();
+
+    // Returns the page to the free lists. Returns false if the page could not be stored.
+    bool             FreePage(D3D12DynamicPage&& Page);
+    D3D12DynamicPage PopPage(Uint32 SizeClass);
+
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
-    std::mutex m_AvailablePagesMtx;
-    using AvailablePagesMapElemType = std::pair<const Uint64, D3D12DynamicPage>;
-    std::multimap<Uint64, D3D12DynamicPage, std::less<Uint64>, STDAllocatorRawMem<AvailablePagesMapElemType>> m_AvailablePages;
+    const Uint64 m_PageSize;
+
+    // D3D12_HEAP_TYPE_GPU_UPLOAD when supported, so that the GPU reads dynamic data
+    // from the video memory rather than over PCIe; D3D12_HEAP_TYPE_UPLOAD otherwise.
+    const D3D12_HEAP_TYPE m_PageHeapType;
+
+    // Heads of per-size-class free lists. The upper 32 bits contain the tag
+    // that is incremented on every update to protect against the ABA problem.
+    std::atomic<Uint64> m_FreePages[NumSizeClasses];
+
+    // Head of the list of unused nodes
+    std::atomic<Uint64> m_FreeNodes{PackFreeListHead(0, InvalidNode)};
+
+    // Node chunks are only appended and are never released until the manager is destroyed,
+    // so the free lists can access them without synchronization.
+    std::atomic<PageNode*>      m_NodeChunks[MaxNodeChunks];
+    std::atomic<Uint32>         m_NumNodeChunks{0};
+    std::mutex                  m_NodeChunksMtx;
+    std::unique_ptr<PageNode[]> m_NodeChunkStorage[MaxNodeChunks];
+
+    // Pages whose size does not fall into any size class
+    std::mutex                                                          m_OtherPagesMtx;
+    std::vector<D3D12DynamicPage, STDAllocatorRawMem<D3D12DynamicPage>> m_OtherPages;
+
+    std::atomic<Uint64> m_NumPagesRequested{0};
+    std::atomic<Uint64> m_NumPagesRecycled{0};
+    std::atomic<Uint64> m_NumPagesCreated{0};
+    std::atomic<Uint64> m_NumPagesDiscarded{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedPageCounter{0};
@@ -203,6 +287,17 @@ private:
     Uint64 m_PeakAllocatedSize = 0;
     Uint64 m_PeakUsedSize      = 0;
     Uint64 m_PeakAlignedSize   = 0;
+
+    // Per-frame page telemetry. Counters are reset by ReleaseAllocatedPages().
+    Uint32 m_CurrPagesRequested  = 0;
+    Uint32 m_CurrPagesRecycled   = 0;
+    Uint32 m_CurrPagesCreated    = 0;
+    Uint32 m_PeakPagesRequested  = 0;
+    Uint32 m_PeakPagesCreated    = 0;
+    Uint64 m_NumFrames           = 0;
+    Uint64 m_TotalPagesRequested = 0;
+    Uint64 m_TotalPagesRecycled  = 0;
+    Uint64 m_TotalPagesCreated   = 0;
 };
 
 } // namespace Diligent
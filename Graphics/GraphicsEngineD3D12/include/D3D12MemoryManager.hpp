@@ -0,0 +1,255 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::D3D12MemoryManager class
+
+#include <mutex>
+#include <unordered_map>
+#include <atomic>
+
+#include "MemoryAllocator.h"
+#include "VariableSizeAllocationsManager.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+class D3D12MemoryPage;
+class D3D12MemoryManager;
+
+// Memory suballocated from a resource heap page. The allocation is used to create a placed resource.
+struct D3D12MemoryAllocation
+{
+    D3D12MemoryAllocation() noexcept {}
+
+    // clang-format off
+    D3D12MemoryAllocation            (const D3D12MemoryAllocation&) = delete;
+    D3D12MemoryAllocation& operator= (const D3D12MemoryAllocation&) = delete;
+
+    D3D12MemoryAllocation(D3D12MemoryPage* _Page, Uint64 _UnalignedOffset, Uint64 _Size)noexcept :
+        Page           {_Page           },
+        UnalignedOffset{_UnalignedOffset},
+        Size           {_Size           }
+    {}
+
+    D3D12MemoryAllocation(D3D12MemoryAllocation&& rhs)noexcept :
+        Page           {rhs.Page           },
+        UnalignedOffset{rhs.UnalignedOffset},
+        Size           {rhs.Size           }
+    {
+        rhs.Page            = nullptr;
+        rhs.UnalignedOffset = 0;
+        rhs.Size            = 0;
+    }
+
+    D3D12MemoryAllocation& operator= (D3D12MemoryAllocation&& rhs)noexcept
+    {
+        Page            = rhs.Page;
+        UnalignedOffset = rhs.UnalignedOffset;
+        Size            = rhs.Size;
+
+        rhs.Page            = nullptr;
+        rhs.UnalignedOffset = 0;
+        rhs.Size            = 0;
+
+        return *this;
+    }
+    // clang-format on
+
+    bool IsValid() const
+    {
+        return Page != nullptr;
+    }
+    explicit operator bool() const
+    {
+        return IsValid();
+    }
+
+    // Destructor immediately returns the allocation to the parent page.
+    // The allocation must not be in use by the GPU.
+    ~D3D12MemoryAllocation();
+
+    D3D12MemoryPage* Page            = nullptr; // Memory page that contains this allocation
+    Uint64           UnalignedOffset = 0;       // Unaligned offset from the start of the heap
+    Uint64           Size            = 0;       // Reserved size of this allocation
+};
+
+// Memory page wraps a single ID3D12Heap object that placed resources are suballocated from
+class D3D12MemoryPage
+{
+public:
+    D3D12MemoryPage(D3D12MemoryManager& ParentMemoryMgr,
+                    Uint64              PageSize,
+                    D3D12_HEAP_TYPE     HeapType,
+                    D3D12_HEAP_FLAGS    HeapFlags);
+    ~D3D12MemoryPage();
+
+    // clang-format off
+    D3D12MemoryPage(D3D12MemoryPage&& rhs)noexcept :
+        m_ParentMemoryMgr{rhs.m_ParentMemoryMgr         },
+        m_AllocationMgr  {std::move(rhs.m_AllocationMgr)},
+        m_pd3d12Heap     {std::move(rhs.m_pd3d12Heap)   },
+        m_HeapType       {rhs.m_HeapType                }
+    {
+    }
+
+    D3D12MemoryPage            (const D3D12MemoryPage&) = delete;
+    D3D12MemoryPage& operator= (D3D12MemoryPage&)       = delete;
+    D3D12MemoryPage& operator= (D3D12MemoryPage&& rhs)  = delete;
+
+    bool   IsEmpty()     const { return m_AllocationMgr.IsEmpty();     }
+    bool   IsFull()      const { return m_AllocationMgr.IsFull();      }
+    Uint64 GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
+    Uint64 GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    // clang-format on
+
+    D3D12MemoryAllocation Allocate(Uint64 Size, Uint64 Alignment);
+
+    ID3D12Heap*     GetD3D12Heap() const { return m_pd3d12Heap; }
+    D3D12_HEAP_TYPE GetHeapType() const { return m_HeapType; }
+
+private:
+    using AllocationsMgrOffsetType = VariableSizeAllocationsManager::OffsetType;
+
+    friend struct D3D12MemoryAllocation;
+
+    // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
+    void Free(D3D12MemoryAllocation&& Allocation);
+
+    D3D12MemoryManager&            m_ParentMemoryMgr;
+    std::mutex                     m_Mutex;
+    VariableSizeAllocationsManager m_AllocationMgr;
+    CComPtr<ID3D12Heap>            m_pd3d12Heap;
+    const D3D12_HEAP_TYPE          m_HeapType;
+};
+
+// D3D12 memory manager suballocates placed resources from large ID3D12Heap pages instead
+// of creating every resource with its own implicit heap by CreateCommittedResource().
+// This avoids the kernel-mode overhead of heap creation for every resource and allows small
+// textures to use 4 KB placement alignment.
+//
+// Pages are separated by the heap type and the resource category (buffers, non-RT/DS textures),
+// which makes the manager compatible with resource heap tier 1.
+class D3D12MemoryManager
+{
+public:
+    D3D12MemoryManager(ID3D12Device*     pd3d12Device,
+                       IMemoryAllocator& Allocator,
+                       Uint64            PageSize,
+                       Uint64            ReserveSize,
+                       Uint64            MaxPlacedResourceSize);
+    ~D3D12MemoryManager();
+
+    // clang-format off
+    D3D12MemoryManager            (const D3D12MemoryManager&)  = delete;
+    D3D12MemoryManager            (      D3D12MemoryManager&&) = delete;
+    D3D12MemoryManager& operator= (const D3D12MemoryManager&)  = delete;
+    D3D12MemoryManager& operator= (      D3D12MemoryManager&&) = delete;
+    // clang-format on
+
+    // Returns true if placed resources are enabled.
+    bool IsEnabled() const { return m_PageSize != 0; }
+
+    // Creates a placed resource in one of the pages.
+    // If the resource is not eligible for suballocation (e.g. it is too large, is multisampled, or is a render
+    // target or a depth-stencil texture), or if the allocation fails, the function returns an invalid allocation
+    // and the caller is expected to create a committed resource instead.
+    D3D12MemoryAllocation CreatePlacedResource(D3D12_HEAP_TYPE          HeapType,
+                                               D3D12_RESOURCE_DESC&     d3d12ResDesc,
+                                               D3D12_RESOURCE_STATES    InitialState,
+                                               const D3D12_CLEAR_VALUE* pClearValue,
+                                               CComPtr<ID3D12Resource>& pd3d12Resource);
+
+    D3D12MemoryAllocation Allocate(Uint64 Size, Uint64 Alignment, D3D12_HEAP_TYPE HeapType, D3D12_HEAP_FLAGS HeapFlags);
+
+    // Releases empty pages when the total allocated size exceeds the reserve size
+    void ShrinkMemory();
+
+    struct Statistics
+    {
+        Uint64 CurrUsedSize      = 0;
+        Uint64 PeakUsedSize      = 0;
+        Uint64 CurrAllocatedSize = 0;
+        Uint64 PeakAllocatedSize = 0;
+        Uint32 NumPages          = 0;
+    };
+    Statistics GetStatistics();
+
+private:
+    friend class D3D12MemoryPage;
+
+    void OnFreeAllocation(Uint64 Size);
+
+    CComPtr<ID3D12Device> m_pd3d12Device;
+    IMemoryAllocator&     m_Allocator;
+
+    struct MemoryPageIndex
+    {
+        const D3D12_HEAP_TYPE  HeapType;
+        const D3D12_HEAP_FLAGS HeapFlags;
+
+        // clang-format off
+        MemoryPageIndex(D3D12_HEAP_TYPE  _HeapType,
+                        D3D12_HEAP_FLAGS _HeapFlags) :
+            HeapType {_HeapType },
+            HeapFlags{_HeapFlags}
+        {}
+
+        bool operator == (const MemoryPageIndex& rhs)const
+        {
+            return HeapType  == rhs.HeapType &&
+                   HeapFlags == rhs.HeapFlags;
+        }
+        // clang-format on
+
+        struct Hasher
+        {
+            size_t operator()(const MemoryPageIndex& PageIndex) const
+            {
+                return ComputeHash(static_cast<Uint32>(PageIndex.HeapType), static_cast<Uint32>(PageIndex.HeapFlags));
+            }
+        };
+    };
+
+    std::mutex m_PagesMtx;
+    // Allocations keep pointers to their pages, which remain valid as the multimap is node-based
+    std::unordered_multimap<MemoryPageIndex, D3D12MemoryPage, MemoryPageIndex::Hasher> m_Pages;
+
+    const Uint64 m_PageSize;
+    const Uint64 m_ReserveSize;
+    const Uint64 m_MaxPlacedResourceSize;
+
+    std::atomic<Int64> m_CurrUsedSize{0};
+    // Protected by m_PagesMtx
+    Uint64 m_PeakUsedSize      = 0;
+    Uint64 m_CurrAllocatedSize = 0;
+    Uint64 m_PeakAllocatedSize = 0;
+};
+
+} // namespace Diligent
@@ -44,6 +44,8 @@ public:
 
 protected:
     RefCntAutoPtr<IPipelineResourceSignature> UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo, bool IsImplicit) override final;
+
+    bool UnpackPSODeviceData(const SerializedData& Data, IRenderDevice* pDevice) override final;
 };
 
 } // namespace Diligent
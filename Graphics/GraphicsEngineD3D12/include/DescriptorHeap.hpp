@@ -36,6 +36,7 @@
 #include <string>
 #include <unordered_set>
 #include <atomic>
+#include <memory>
 
 #include "VariableSizeAllocationsManager.hpp"
 
@@ -317,6 +318,10 @@ public:
     size_t GetMaxAllocatedSize()       const { return m_MaxAllocatedSize;               }
     // clang-format on
 
+    // Returns the number of allocated descriptors.
+    // Unlike GetNumAvailableDescriptors(), the method is thread-safe.
+    Uint32 GetNumAllocatedDescriptors();
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 DvpGetAllocationsCounter() const
     {
@@ -386,6 +391,11 @@ private:
 // Render device contains four CPUDescriptorHeap object instances (one for each D3D12 heap type). The heaps are accessed
 // when a texture or a buffer view is created.
 //
+// Single-descriptor requests, which make up the vast majority of all allocations, are served by a lock-free
+// fast path: descriptors are allocated from the pool in slabs of SlabSize handles, and individual slots are
+// pushed to and popped from a lock-free free list that is shared by all slabs. The mutex is only
+// taken when a new slab is created or when a multi-descriptor range is requested.
+//
 class CPUDescriptorHeap final : public IDescriptorAllocator
 {
 public:
@@ -413,12 +423,69 @@ public:
     int32_t DvpGetTotalAllocationCount();
 #endif
 
+    struct Statistics
+    {
+        // The number of single-descriptor allocations served by the lock-free fast path
+        Uint64 FastPathAllocations = 0;
+
+        // The number of allocations that required taking the heap pool mutex
+        Uint64 SlowPathAllocations = 0;
+
+        // The number of slabs allocated by the fast path
+        Uint32 SlabCount = 0;
+    };
+    Statistics GetStatistics() const;
+
 private:
     void FreeAllocation(DescriptorHeapAllocation&& Allocation);
 
+    DescriptorHeapAllocation AllocateFromPool(Uint32 Count);
+    DescriptorHeapAllocation AllocateFromSlab();
+    bool                     CreateSlab();
+    void                     PushFreeSlots(Uint32 FirstSlot, Uint32 LastSlot);
+
+    static constexpr Uint32 SlabSizeLog2 = 6;
+    static constexpr Uint32 SlabSize     = 1u << SlabSizeLog2;
+    static constexpr Uint32 MaxSlabs     = 256;
+    // Allocation manager ids starting at this value identify slabs rather than the pool managers
+    static constexpr Uint16 SlabIdBase  = 0x8000;
+    static constexpr Uint32 InvalidSlot = ~0u;
+
+    struct Slab
+    {
+        // Descriptor range allocated from one of the pool managers
+        DescriptorHeapAllocation Range;
+
+        // Next free slot index for every slot in the slab (global slot indices)
+        std::atomic<Uint32> NextFree[SlabSize];
+    };
+
+    static Uint64 PackFreeListHead(Uint32 Tag, Uint32 Slot)
+    {
+        return (static_cast<Uint64>(Tag) << 32u) | Uint64{Slot};
+    }
+
     IMemoryAllocator&      m_MemAllocator;
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
+    // Head of the lock-free free list of slab slots. The upper 32 bits contain the tag
+    // that is incremented on every update to protect against the ABA problem.
+    std::atomic<Uint64> m_FreeSlotsHead{PackFreeListHead(0, InvalidSlot)};
+
+    // Slabs are only appended and are never released until the heap is destroyed,
+    // so the fast path can access them without synchronization.
+    std::atomic<Slab*>    m_Slabs[MaxSlabs];
+    std::atomic<Uint32>   m_SlabCount{0};
+    std::mutex            m_SlabMutex;
+    std::unique_ptr<Slab> m_SlabStorage[MaxSlabs];
+
+    std::atomic<Uint64> m_FastPathAllocations{0};
+    std::atomic<Uint64> m_SlowPathAllocations{0};
+#ifdef DILIGENT_DEVELOPMENT
+    // The number of live allocations served by the slabs
+    std::atomic<Int32> m_DvpSlabAllocationsCounter{0};
+#endif
+
     // Pool of descriptor heap managers
     std::mutex                                                                                        m_HeapPoolMutex;
     std::vector<DescriptorHeapAllocationManager, STDAllocatorRawMem<DescriptorHeapAllocationManager>> m_HeapPool;
@@ -507,6 +574,18 @@ public:
     const D3D12_DESCRIPTOR_HEAP_DESC& GetHeapDesc() const { return m_HeapDesc; }
     Uint32                            GetMaxStaticDescriptors() const { return m_HeapAllocationManager.GetMaxDescriptors(); }
     Uint32                            GetMaxDynamicDescriptors() const { return m_DynamicAllocationsManager.GetMaxDescriptors(); }
+    Uint32                            GetNumAllocatedStaticDescriptors() { return m_HeapAllocationManager.GetNumAllocatedDescriptors(); }
+    ID3D12DescriptorHeap*             GetD3D12DescriptorHeap() const { return m_pd3d12DescriptorHeap; }
+
+    // Returns the index of the first descriptor of the allocation in the heap, i.e. the
+    // index that SM6.6 shaders use to access the descriptor through ResourceDescriptorHeap[]
+    // or SamplerDescriptorHeap[].
+    Uint32 GetDescriptorHeapIndex(const DescriptorHeapAllocation& Allocation) const
+    {
+        VERIFY_EXPR(!Allocation.IsNull() && Allocation.GetDescriptorHeap() == m_pd3d12DescriptorHeap);
+        const auto HeapStart = m_pd3d12DescriptorHeap->GetGPUDescriptorHandleForHeapStart();
+        return static_cast<Uint32>((Allocation.GetGpuHandle().ptr - HeapStart.ptr) / m_DescriptorSize);
+    }
 
 #ifdef DILIGENT_DEVELOPMENT
     int32_t DvpGetTotalAllocationCount() const
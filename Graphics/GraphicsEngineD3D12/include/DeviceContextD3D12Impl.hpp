@@ -88,6 +88,9 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetDynamicRenderState() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE SetDynamicRenderState(const DynamicRenderState& State) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -165,6 +168,10 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateAttachments() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateAttachments(Uint32               NumViews,
+                                                          ITextureView* const* ppViews) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -247,6 +254,19 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::ResolveQueries() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE ResolveQueries(IQuery* const*                 ppQueries,
+                                                   Uint32                         NumQueries,
+                                                   IBuffer*                       pDstBuffer,
+                                                   Uint64                         DstOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginConditionalRendering() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::EndConditionalRendering() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE EndConditionalRendering() override final;
+
     /// Implementation of IDeviceContext::Flush() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -295,6 +315,13 @@ public:
     /// Implementation of IDeviceContextD3D12::ID3D12GraphicsCommandList() in Direct3D12 backend.
     virtual ID3D12GraphicsCommandList* DILIGENT_CALL_TYPE GetD3D12CommandList() override final;
 
+    /// Implementation of IDeviceContextD3D12::ExecuteIndirect() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE ExecuteIndirect(const ExecuteIndirectAttribsD3D12& Attribs) override final;
+
+    /// Implementation of IDeviceContextD3D12::BeginReusableCommandList() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE BeginReusableCommandList(Uint32                         ImmediateContextId,
+                                                             const SetRenderTargetsAttribs& Attribs) override final;
+
     /// Implementation of IDeviceContext::SetShadingRate() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE SetShadingRate(SHADING_RATE          BaseRate,
                                                    SHADING_RATE_COMBINER PrimitiveCombiner,
@@ -374,6 +401,10 @@ private:
 
     __forceinline void RequestCommandContext();
 
+    // Executes bundles recorded by BeginReusableCommandList() with the bound render targets
+    void ExecuteBundles(Uint32               NumCommandLists,
+                        ICommandList* const* ppCommandLists);
+
     __forceinline void TransitionOrVerifyBufferState(CommandContext&                CmdCtx,
                                                      BufferD3D12Impl&               Buffer,
                                                      RESOURCE_STATE_TRANSITION_MODE TransitionMode,
@@ -449,6 +480,12 @@ private:
     }
     std::unique_ptr<CommandContext, STDDeleterRawMem<CommandContext>> m_CurrCmdCtx;
 
+    // The number of commands recorded into the last submitted or finished command list
+    Uint32 m_LastCmdListSize = 0;
+
+    // Indicates that the deferred context records a bundle (see BeginReusableCommandList)
+    bool m_IsRecordingBundle = false;
+
     struct State
     {
         size_t NumCommands = 0;
@@ -479,6 +516,9 @@ private:
     CComPtr<ID3D12CommandSignature>                             m_pDrawMeshIndirectSignature;
     CComPtr<ID3D12CommandSignature>                             m_pTraceRaysIndirectSignature;
 
+    // Atomic counters used by the single-pass mip generator
+    CComPtr<ID3D12Resource> m_pMipGenCounters;
+
     D3D12DynamicHeap m_DynamicHeap;
 
     // Every context must use its own allocator that maintains individual list of retired descriptor heaps to
@@ -48,6 +48,31 @@ struct PRSSerializerD3D12 : PRSSerializer<Mode>
                                       DynamicLinearAllocator*      Allocator);
 };
 
+// Serialized root signature that is stored in the Direct3D12-specific pipeline data
+// after the shader indices.
+struct SerializedRootSignatureD3D12
+{
+    // Root signature hash, see RootSignatureD3D12::CalculateHash().
+    Uint64 Hash = 0;
+
+    // D3D12_ROOT_SIGNATURE_FLAGS the root signature was serialized with.
+    Uint32 Flags = 0;
+
+    // Data produced by D3D12SerializeRootSignature.
+    const void* pData    = nullptr;
+    size_t      DataSize = 0;
+};
+
+template <SerializerMode Mode>
+struct RootSignatureSerializerD3D12
+{
+    template <typename T>
+    using ConstQual = typename Serializer<Mode>::template ConstQual<T>;
+
+    static bool Serialize(Serializer<Mode>&                        Ser,
+                          ConstQual<SerializedRootSignatureD3D12>& RootSig);
+};
+
 DECL_TRIVIALLY_SERIALIZABLE(PipelineResourceAttribsD3D12);
 DECL_TRIVIALLY_SERIALIZABLE(ImmutableSamplerAttribsD3D12);
 
@@ -58,6 +58,9 @@ public:
     /// Implementation of IFenceD3D12::Wait() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
 
+    /// Implementation of IFence::RegisterCompletionCallback() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData) override final;
+
     /// Implementation of IFenceD3D12::GetD3D12Fence().
     virtual ID3D12Fence* DILIGENT_CALL_TYPE GetD3D12Fence() override final { return m_pd3d12Fence; }
 
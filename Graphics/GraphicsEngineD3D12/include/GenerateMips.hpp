@@ -48,6 +48,7 @@
 /// \file
 /// Implementation of mipmap generation routines
 
+#include <mutex>
 
 namespace Diligent
 {
@@ -57,12 +58,46 @@ class GenerateMipsHelper
 public:
     GenerateMipsHelper(ID3D12Device* pd3d12Device);
 
-    void GenerateMips(ID3D12Device* pd3d12Device, class TextureViewD3D12Impl* pTexView, class CommandContext& Ctx) const;
+    // pSPDCounters is the buffer with the atomic counters used by the single-pass downsampler.
+    // Every device context keeps its own buffer, which is created on first use.
+    void GenerateMips(class RenderDeviceD3D12Impl& Device,
+                      class TextureViewD3D12Impl*  pTexView,
+                      class CommandContext&        Ctx,
+                      CComPtr<ID3D12Resource>&     pSPDCounters) const;
 
 private:
+    void GenerateMipsMultiPass(ID3D12Device*         pd3d12Device,
+                               TextureViewD3D12Impl* pTexView,
+                               CommandContext&       Ctx,
+                               RESOURCE_STATE        OriginalState,
+                               RESOURCE_STATE        FinalState) const;
+
+    // Generates all mips of the view with a single dispatch
+    void GenerateMipsSinglePass(ID3D12Device*         pd3d12Device,
+                                TextureViewD3D12Impl* pTexView,
+                                CommandContext&       Ctx,
+                                ID3D12Resource*       pSPDCounters,
+                                RESOURCE_STATE        OriginalState,
+                                RESOURCE_STATE        FinalState) const;
+
+    // Returns true if the single-pass downsampler can process the view
+    bool IsSinglePassSupported(RenderDeviceD3D12Impl& Device, TextureViewD3D12Impl* pTexView) const;
+
+    void InitializeSinglePass(RenderDeviceD3D12Impl& Device) const;
+
+    static CComPtr<ID3D12Resource> CreateSPDCounterBuffer(ID3D12Device* pd3d12Device);
+
     CComPtr<ID3D12RootSignature> m_pGenerateMipsRS;
     CComPtr<ID3D12PipelineState> m_pGenerateMipsLinearPSO[4];
     CComPtr<ID3D12PipelineState> m_pGenerateMipsGammaPSO[4];
+
+    // Single-pass downsampler objects are created on first use, as the shaders
+    // are compiled at run time by DXC. If initialization fails, the pointers
+    // remain null and the multi-pass path is always used.
+    mutable std::once_flag               m_SPDInitFlag;
+    mutable CComPtr<ID3D12RootSignature> m_pSPDRS;
+    mutable CComPtr<ID3D12PipelineState> m_pSPDLinearPSO;
+    mutable CComPtr<ID3D12PipelineState> m_pSPDGammaPSO;
 };
 
 } // namespace Diligent
@@ -29,6 +29,10 @@
 /// \file
 /// Declaration of Diligent::PipelineStateCacheD3D12Impl class
 
+#include <mutex>
+#include <atomic>
+#include <string>
+
 #include "EngineD3D12ImplTraits.hpp"
 #include "PipelineStateCacheBase.hpp"
 
@@ -57,7 +61,31 @@ public:
     bool StorePipeline(const wchar_t* Name, ID3D12DeviceChild* pPSO);
 
 private:
+    void InitFromFile(const char* FilePath);
+    bool CreateLibrary(RefCntAutoPtr<IDataBlob> pData, size_t DataOffset);
+
+    RefCntAutoPtr<IDataBlob> SerializeLibrary();
+    void                     WriteToFile();
+
     CComPtr<ID3D12PipelineLibrary> m_pLibrary;
+
+    // Serialized library the pipeline library was created from.
+    // D3D12 requires the data to remain valid for the lifetime of the library.
+    RefCntAutoPtr<IDataBlob> m_pLibraryData;
+
+    // Serializes StorePipeline() calls with the library serialization
+    std::mutex m_LibraryMtx;
+
+    // Path to the file that backs the cache (empty if the cache is not file-backed)
+    std::string m_FilePath;
+    // Serializes file writes
+    std::mutex m_FileMtx;
+
+    // The number of pipelines stored in the library since it was last written to the file
+    std::atomic<Uint32> m_NumUnsavedPipelines{0};
+
+    // The library is written to the file every time this number of new pipelines is stored
+    static constexpr Uint32 FileWriteThreshold = 32;
 };
 
 } // namespace Diligent
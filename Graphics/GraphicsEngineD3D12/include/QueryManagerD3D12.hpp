@@ -69,6 +69,7 @@ public:
 
     void BeginQuery(CommandContext& Ctx, QUERY_TYPE Type, Uint32 Index) const;
     void EndQuery(CommandContext& Ctx, QUERY_TYPE Type, Uint32 Index) const;
+    void ResolveQueryData(CommandContext& Ctx, QUERY_TYPE Type, Uint32 StartIndex, Uint32 NumQueries, ID3D12Resource* pd3d12DstBuffer, Uint64 DstOffset) const;
     void ReadQueryData(QUERY_TYPE Type, Uint32 Index, void* pDataPtr, Uint32 DataSize) const;
 
     SoftwareQueueIndex GetCommandQueueId() const
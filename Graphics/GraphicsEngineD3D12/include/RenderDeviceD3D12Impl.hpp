@@ -42,6 +42,7 @@
 #include "CommandListManager.hpp"
 #include "CommandContext.hpp"
 #include "D3D12DynamicHeap.hpp"
+#include "D3D12MemoryManager.hpp"
 #include "GenerateMips.hpp"
 #include "DXCompiler.hpp"
 #include "RootSignature.hpp"
@@ -200,6 +201,22 @@ public:
                                                               RESOURCE_STATE        InitialState,
                                                               ITopLevelAS**         ppTLAS) override final;
 
+    /// Implementation of IRenderDeviceD3D12::CreateIndirectCommandSignature().
+    virtual void DILIGENT_CALL_TYPE CreateIndirectCommandSignature(const IndirectCommandSignatureDescD3D12& Desc,
+                                                                   ID3D12CommandSignature**                 ppSignature) override final;
+
+    // Information about the command signature created by CreateIndirectCommandSignature(),
+    // stored as the private data of the D3D12 object.
+    struct IndirectCommandSignatureInfo
+    {
+        PIPELINE_TYPE PipelineType         = PIPELINE_TYPE_GRAPHICS;
+        bool          IsIndexed            = false;
+        bool          ChangesVertexBuffers = false;
+        bool          ChangesIndexBuffer   = false;
+        bool          ChangesRootViews     = false;
+    };
+    static const GUID IndirectCommandSignatureInfoGUID;
+
     void CreateRootSignature(const RefCntAutoPtr<class PipelineResourceSignatureD3D12Impl>* ppSignatures, Uint32 SignatureCount, size_t Hash, RootSignatureD3D12** ppRootSig);
 
     RootSignatureCacheD3D12& GetRootSignatureCache() { return m_RootSignatureCache; }
@@ -210,13 +227,30 @@ public:
     /// Implementation of IRenderDevice::IdleGPU() in Direct3D12 backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
+    /// Implementation of IRenderDevice::GetMemoryStats() in Direct3D12 backend.
+    virtual void DILIGENT_CALL_TYPE GetMemoryStats(DeviceMemoryStats& Stats) override final;
+
+    /// Implementation of IRenderDevice::WaitForFences() in Direct3D12 backend.
+    virtual Bool DILIGENT_CALL_TYPE WaitForFences(IFence* const* ppFences,
+                                                  const Uint64*  pValues,
+                                                  Uint32         NumFences,
+                                                  Bool           WaitAll,
+                                                  Uint64         Timeout) override final;
+
     D3D12_COMMAND_LIST_TYPE GetCommandQueueType(SoftwareQueueIndex CmdQueueInd) const
     {
         return GetCommandQueue(CmdQueueInd).GetD3D12CommandQueueDesc().Type;
     }
 
     using PooledCommandContext = std::unique_ptr<CommandContext, STDDeleterRawMem<CommandContext>>;
-    PooledCommandContext AllocateCommandContext(SoftwareQueueIndex CommandQueueId, const Char* ID = "");
+    PooledCommandContext AllocateCommandContext(SoftwareQueueIndex CommandQueueId, const Char* ID = "", Uint32 ExpectedNumCommands = 0);
+
+    // Allocates a context that records a bundle (D3D12_COMMAND_LIST_TYPE_BUNDLE)
+    PooledCommandContext AllocateBundleContext(const Char* ID = "");
+
+    // Releases the context of a closed bundle together with its allocator once all commands lists
+    // submitted to the queues in QueueMask that may have executed the bundle are complete.
+    void ReleaseBundleContext(PooledCommandContext&& Ctx, CComPtr<ID3D12CommandAllocator>&& pAllocator, Uint64 QueueMask);
 
     void CloseAndExecuteTransientCommandContext(SoftwareQueueIndex CommandQueueId, PooledCommandContext&& Ctx);
 
@@ -239,6 +273,7 @@ public:
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
 
     D3D12DynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
+    D3D12MemoryManager&        GetMemoryManager() { return m_MemoryMgr; }
 
     GPUDescriptorHeap& GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE Type)
     {
@@ -275,20 +310,53 @@ public:
         return m_pNVApiHeap;
     }
 
+    bool IsEnhancedBarriersSupported() const
+    {
+        return m_IsEnhancedBarriersSupported;
+    }
+
+    // Returns true if the device supports D3D12_HEAP_TYPE_GPU_UPLOAD heaps (resizable BAR).
+    bool IsGPUUploadHeapSupported() const
+    {
+        return m_IsGPUUploadHeapSupported;
+    }
+
+    bool IsBindlessResourcesEnabled() const
+    {
+        return m_IsBindlessResourcesEnabled;
+    }
+
+    // Allocates a descriptor at a stable index in the shader-visible heap and copies the
+    // CPU descriptor into it. Returns null allocation if bindless resources are not enabled.
+    DescriptorHeapAllocation AllocateBindlessDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE Type, D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptor);
+
+    // Returns the index of the bindless descriptor in the shader-visible heap, or ~0u if the allocation is null.
+    Uint32 GetBindlessDescriptorIndex(D3D12_DESCRIPTOR_HEAP_TYPE Type, const DescriptorHeapAllocation& Allocation) const
+    {
+        VERIFY_EXPR(Type == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV || Type == D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+        return !Allocation.IsNull() ? m_GPUDescriptorHeaps[Type].GetDescriptorHeapIndex(Allocation) : ~0u;
+    }
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     void         FreeCommandContext(PooledCommandContext&& Ctx);
 
+    PooledCommandContext AllocateCommandContext(CommandListManager& CmdListMngr, const Char* ID, Uint32 ExpectedNumCommands);
+
     CommandListManager& GetCmdListManager(SoftwareQueueIndex CommandQueueId);
     CommandListManager& GetCmdListManager(D3D12_COMMAND_LIST_TYPE CmdListType);
 
     CComPtr<ID3D12Device> m_pd3d12Device;
 
+    // Must be initialized before the dynamic memory manager that creates pages in its constructor
+    const bool m_IsGPUUploadHeapSupported;
+
     CPUDescriptorHeap m_CPUDescriptorHeaps[D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES];
     GPUDescriptorHeap m_GPUDescriptorHeaps[2]; // D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV == 0
                                                // D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER	 == 1
 
     CommandListManager m_CmdListManagers[3]; // 0 - direct, 1 - compute, 2 - copy
+    CommandListManager m_BundleCmdListManager;
 
     std::mutex                                                             m_ContextPoolMutex;
     std::unordered_multimap<D3D12_COMMAND_LIST_TYPE, PooledCommandContext> m_ContextPool;
@@ -298,6 +366,9 @@ private:
 
     D3D12DynamicMemoryManager m_DynamicMemoryManager;
 
+    // Resource heap pages that placed buffers and textures are suballocated from
+    D3D12MemoryManager m_MemoryMgr;
+
     // Note: mips generator must be released after the device has been idled
     GenerateMipsHelper m_MipsGenerator;
 
@@ -312,7 +383,9 @@ private:
     // Dummy heap required by NvAPI_D3D12_CreateReservedResource.
     CComPtr<ID3D12Heap> m_pNVApiHeap;
 
-    bool m_IsPSOCacheSupported = false;
+    bool m_IsPSOCacheSupported         = false;
+    bool m_IsEnhancedBarriersSupported = false;
+    bool m_IsBindlessResourcesEnabled  = false;
 
 #ifdef DILIGENT_DEVELOPMENT
     Uint32 m_MaxD3D12DeviceVersion = 0;
@@ -52,6 +52,7 @@
 #include <memory>
 
 #include "PrivateConstants.h"
+#include "DataBlob.h"
 #include "ShaderResources.hpp"
 #include "ObjectBase.hpp"
 #include "ResourceBindingMap.hpp"
@@ -110,6 +111,14 @@ public:
 
     bool IsCompatibleWith(const RefCntAutoPtr<PipelineResourceSignatureD3D12Impl> ppSignatures[], Uint32 SignatureCount) const noexcept;
 
+    /// Computes the root signature hash from the hashes of the pipeline resource signatures.
+    static size_t CalculateHash(const RefCntAutoPtr<PipelineResourceSignatureD3D12Impl> ppSignatures[], Uint32 SignatureCount);
+
+    static D3D12_ROOT_SIGNATURE_FLAGS GetD3D12RootSignatureFlags(bool BindlessResourcesEnabled);
+
+    /// Builds the d3d12 root signature description and serializes it using the given flags.
+    RefCntAutoPtr<IDataBlob> Serialize(D3D12_ROOT_SIGNATURE_FLAGS Flags) const noexcept(false);
+
 private:
     // The number of pipeline resource signatures used to initialize this root signature.
     const Uint32 m_SignatureCount;
@@ -165,6 +174,11 @@ private:
 
 
 /// Root signature cache that deduplicates RootSignatureD3D12 objects.
+///
+/// The cache also keeps serialized root signatures keyed by the root signature hash and flags.
+/// The serialized data is either produced when the root signature is first created, or loaded
+/// from the device object archive, which lets the root signature creation skip rebuilding
+/// the d3d12 description and calling D3D12SerializeRootSignature.
 class RootSignatureCacheD3D12
 {
 public:
@@ -183,11 +197,20 @@ public:
 
     void OnDestroyRootSig(RootSignatureD3D12* pRootSig);
 
+    RefCntAutoPtr<IDataBlob> FindSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags);
+
+    void AddSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags, IDataBlob* pData);
+    void AddSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags, const void* pData, size_t DataSize);
+
 private:
     RenderDeviceD3D12Impl& m_DeviceD3D12Impl;
 
     std::mutex                                                         m_RootSigCacheMtx;
     std::unordered_multimap<size_t, RefCntWeakPtr<RootSignatureD3D12>> m_RootSigCache;
+
+    std::mutex                                           m_SerializedRootSigsMtx;
+    std::unordered_map<size_t, RefCntAutoPtr<IDataBlob>> m_SerializedRootSigs;
+    Uint32                                               m_NumSerializedRootSigHits = 0;
 };
 
 } // namespace Diligent
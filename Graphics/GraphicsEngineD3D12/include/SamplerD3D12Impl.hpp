@@ -53,10 +53,16 @@ public:
     /// Implementation of ISamplerD3D12::GetCPUDescriptorHandle().
     virtual D3D12_CPU_DESCRIPTOR_HANDLE DILIGENT_CALL_TYPE GetCPUDescriptorHandle() override { return m_Descriptor.GetCpuHandle(); }
 
+    /// Implementation of ISamplerD3D12::GetDescriptorHeapIndex().
+    virtual Uint32 DILIGENT_CALL_TYPE GetDescriptorHeapIndex() const override final;
+
 private:
     friend class ShaderD3D12Impl;
     /// D3D12 sampler
     DescriptorHeapAllocation m_Descriptor;
+
+    // Descriptor at a stable index in the shader-visible heap (only when bindless resources are enabled)
+    DescriptorHeapAllocation m_BindlessDescriptor;
 };
 
 } // namespace Diligent
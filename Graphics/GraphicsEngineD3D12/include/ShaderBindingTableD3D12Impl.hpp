@@ -54,12 +54,14 @@ public:
 
     virtual const D3D12_DISPATCH_RAYS_DESC& DILIGENT_CALL_TYPE GetD3D12BindingTable() const override final { return m_d3d12DispatchDesc; }
 
-    using BindingTable = TShaderBindingTableBase::BindingTable;
-    void GetData(BufferD3D12Impl*& pSBTBufferD3D12,
-                 BindingTable&     RayGenShaderRecord,
-                 BindingTable&     MissShaderTable,
-                 BindingTable&     HitGroupTable,
-                 BindingTable&     CallableShaderTable);
+    using BindingTable      = TShaderBindingTableBase::BindingTable;
+    using BufferUpdateRange = TShaderBindingTableBase::BufferUpdateRange;
+    void GetData(BufferD3D12Impl*&               pSBTBufferD3D12,
+                 BindingTable&                   RayGenShaderRecord,
+                 BindingTable&                   MissShaderTable,
+                 BindingTable&                   HitGroupTable,
+                 BindingTable&                   CallableShaderTable,
+                 std::vector<BufferUpdateRange>& UpdateRanges);
 
 private:
     D3D12_DISPATCH_RAYS_DESC m_d3d12DispatchDesc = {};
@@ -75,6 +75,8 @@ class ShaderVariableManagerD3D12 : public ShaderVariableManagerBase<EngineD3D12I
 {
 public:
     using TBase = ShaderVariableManagerBase<EngineD3D12ImplTraits, ShaderVariableD3D12Impl>;
+    using TBase::GetResourceCache;
+    using TBase::GetSignature;
     ShaderVariableManagerD3D12(IObject&                  Owner,
                                ShaderResourceCacheD3D12& ResourceCache) noexcept :
         TBase{Owner, ResourceCache}
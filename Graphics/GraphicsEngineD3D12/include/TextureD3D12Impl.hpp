@@ -101,6 +101,9 @@ protected:
     void InitSparseProperties();
 
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT* m_StagingFootprints = nullptr;
+
+    // Memory of a placed resource suballocated from a resource heap page
+    D3D12MemoryAllocation m_MemoryAllocation;
 };
 
 } // namespace Diligent
@@ -61,6 +61,9 @@ public:
         return m_Descriptor.GetCpuHandle();
     }
 
+    /// Implementation of ITextureViewD3D12::GetDescriptorHeapIndex().
+    virtual Uint32 DILIGENT_CALL_TYPE GetDescriptorHeapIndex() const override final;
+
     D3D12_CPU_DESCRIPTOR_HANDLE GetMipLevelUAV(Uint32 Mip)
     {
         VERIFY_EXPR((m_Desc.Flags & TEXTURE_VIEW_FLAG_ALLOW_MIP_MAP_GENERATION) != 0 && m_MipGenerationDescriptors != nullptr && Mip < m_Desc.NumMipLevels);
@@ -81,6 +84,9 @@ protected:
     // [0] == texture array SRV used for mipmap generation
     // [1] == mip level UAVs used for mipmap generation
     DescriptorHeapAllocation* m_MipGenerationDescriptors = nullptr;
+
+    // Descriptor at a stable index in the shader-visible heap (only when bindless resources are enabled)
+    DescriptorHeapAllocation m_BindlessDescriptor;
 };
 
 } // namespace Diligent
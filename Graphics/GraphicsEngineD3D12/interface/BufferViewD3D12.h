@@ -50,6 +50,16 @@ DILIGENT_BEGIN_INTERFACE(IBufferViewD3D12, IBufferView)
 {
     /// Returns CPU descriptor handle of the buffer view.
     VIRTUAL D3D12_CPU_DESCRIPTOR_HANDLE METHOD(GetCPUDescriptorHandle)(THIS) PURE;
+
+    /// Returns the index of the buffer view descriptor in the shader-visible CBV/SRV/UAV descriptor heap.
+
+    /// \remarks    The index is stable for the lifetime of the object and can be used to access
+    ///             the buffer view through ResourceDescriptorHeap[] in shader model 6.6 shaders.
+    ///             Descriptor heap indices are only available when EngineD3D12CreateInfo::EnableBindlessResources
+    ///             is set to true and the device supports shader model 6.6 with resource binding tier 3.
+    ///             Only shader resource and unordered access views have descriptor heap indices.
+    ///             If the index is not available, the method returns ~0u.
+    VIRTUAL Uint32 METHOD(GetDescriptorHeapIndex)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -58,6 +68,7 @@ DILIGENT_END_INTERFACE
 #if DILIGENT_C_INTERFACE
 
 #    define IBufferViewD3D12_GetCPUDescriptorHandle(This) CALL_IFACE_METHOD(BufferViewD3D12, GetCPUDescriptorHandle, This)
+#    define IBufferViewD3D12_GetDescriptorHeapIndex(This)  CALL_IFACE_METHOD(BufferViewD3D12, GetDescriptorHeapIndex, This)
 
 #endif
 
@@ -39,6 +39,51 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextD3D12 =
     {0xdde9e3ab, 0x5109, 0x4026, {0x92, 0xb7, 0xf5, 0xe7, 0xec, 0x83, 0xe2, 0x1e}};
 
+// clang-format off
+
+/// Defines the attributes of the IDeviceContextD3D12::ExecuteIndirect() command.
+struct ExecuteIndirectAttribsD3D12
+{
+    /// Command signature created by IRenderDeviceD3D12::CreateIndirectCommandSignature().
+    ID3D12CommandSignature* pSignature DEFAULT_INITIALIZER(nullptr);
+
+    /// A pointer to the buffer, from which the command arguments will be read.
+    IBuffer* pArgsBuffer               DEFAULT_INITIALIZER(nullptr);
+
+    /// Offset from the beginning of the buffer to the location of the first command arguments.
+    Uint64 ArgsOffset                  DEFAULT_INITIALIZER(0);
+
+    /// The number of commands to execute. When the pCounterBuffer is not null, this member
+    /// defines the maximum number of commands that will be executed.
+    Uint32 MaxCommandCount             DEFAULT_INITIALIZER(1);
+
+    /// The type of the elements in the index buffer bound to the context.
+
+    /// \remarks    This member is only used for indexed draw signatures that
+    ///             do not change the index buffer. Allowed values: VT_UINT16 and VT_UINT32.
+    VALUE_TYPE IndexType               DEFAULT_INITIALIZER(VT_UNDEFINED);
+
+    /// Additional flags, see Diligent::DRAW_FLAGS.
+    DRAW_FLAGS Flags                   DEFAULT_INITIALIZER(DRAW_FLAG_NONE);
+
+    /// State transition mode for the arguments buffer.
+    RESOURCE_STATE_TRANSITION_MODE ArgsBufferStateTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+
+    /// A pointer to the optional buffer, from which Uint32 value with the command count will be read.
+    IBuffer* pCounterBuffer            DEFAULT_INITIALIZER(nullptr);
+
+    /// When pCounterBuffer is not null, an offset from the beginning of the buffer to the
+    /// location of the command counter.
+    Uint64 CounterOffset               DEFAULT_INITIALIZER(0);
+
+    /// When counter buffer is not null, state transition mode for the count buffer.
+    RESOURCE_STATE_TRANSITION_MODE CounterBufferStateTransitionMode DEFAULT_INITIALIZER(RESOURCE_STATE_TRANSITION_MODE_NONE);
+};
+typedef struct ExecuteIndirectAttribsD3D12 ExecuteIndirectAttribsD3D12;
+
+// clang-format on
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextD3D12
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -85,6 +130,52 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextD3D12, IDeviceContext)
     ///           calling IDeviceContext::InvalidateState() and then manually restore all required states via
     ///           appropriate Diligent API calls.
     VIRTUAL ID3D12GraphicsCommandList* METHOD(GetD3D12CommandList)(THIS) PURE;
+
+    /// Executes indirect commands using a custom command signature
+
+    /// \param [in] Attribs - Command attributes, see Diligent::ExecuteIndirectAttribsD3D12.
+    ///
+    /// \remarks  The command uses the currently bound pipeline state and shader resources.
+    ///           Vertex buffers, index buffer and constant buffers that are changed by the command signature
+    ///           are restored by the engine before the next draw or dispatch command.
+    ///           Vertex buffer slots that are changed by the signature may be left unbound (null)
+    ///           in the device context.
+    ///
+    ///           Buffers whose GPU virtual addresses are written into the arguments buffer must be
+    ///           transitioned to the required states by the application.
+    VIRTUAL void METHOD(ExecuteIndirect)(THIS_
+                                         const ExecuteIndirectAttribsD3D12 REF Attribs) PURE;
+
+    /// Begins recording a reusable command list that is executed as a Direct3D12 bundle.
+
+    /// \param [in] ImmediateContextId - the ID of the immediate context where the command list will be executed.
+    ///                                  The context must use a graphics queue.
+    /// \param [in] Attribs            - render targets that the command list will render into. The same
+    ///                                  render targets must be bound to the immediate context when the
+    ///                                  command list is executed.
+    ///
+    /// \remarks  This method can only be called for deferred contexts and is used instead of IDeviceContext::Begin().
+    ///           Unlike regular command lists, the command list returned by IDeviceContext::FinishCommandList()
+    ///           is not consumed by IDeviceContext::ExecuteCommandLists() and can be executed any number of times
+    ///           in any frame until it is released.
+    ///
+    ///           A bundle inherits render targets, viewports and scissor rectangles from the immediate context,
+    ///           so these states can't be changed while recording the command list. Only draw and dispatch commands
+    ///           as well as pipeline, vertex and index buffer, shader resource, stencil reference and blend factor
+    ///           changes may be recorded. Clears, copies, queries, render passes, resource state transitions,
+    ///           dynamic buffers, buffer and texture updates and dynamic shader variables are not allowed as
+    ///           the memory they use is only valid in the current frame.
+    ///           All resources must be transitioned to the required states beforehand:
+    ///           RESOURCE_STATE_TRANSITION_MODE_TRANSITION is not allowed.
+    ///
+    ///           The command list is executed with IDeviceContext::ExecuteCommandLists() after the render targets have
+    ///           been bound to the immediate context with IDeviceContext::SetRenderTargets(). All command lists in one
+    ///           ExecuteCommandLists() call must be recorded with this method. Explicit render passes
+    ///           (IDeviceContext::BeginRenderPass()) are not supported. Similar to regular command lists, executing
+    ///           the lists invalidates the immediate context state.
+    VIRTUAL void METHOD(BeginReusableCommandList)(THIS_
+                                                  Uint32                            ImmediateContextId,
+                                                  const SetRenderTargetsAttribs REF Attribs) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -94,9 +185,11 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextD3D12_TransitionTextureState(This, ...) CALL_IFACE_METHOD(DeviceContextD3D12, TransitionTextureState,This, __VA_ARGS__)
-#    define IDeviceContextD3D12_TransitionBufferState(This, ...)  CALL_IFACE_METHOD(DeviceContextD3D12, TransitionBufferState, This, __VA_ARGS__)
-#    define IDeviceContextD3D12_GetD3D12CommandList(This)         CALL_IFACE_METHOD(DeviceContextD3D12, GetD3D12CommandList,   This)
+#    define IDeviceContextD3D12_TransitionTextureState(This, ...)   CALL_IFACE_METHOD(DeviceContextD3D12, TransitionTextureState,   This, __VA_ARGS__)
+#    define IDeviceContextD3D12_TransitionBufferState(This, ...)    CALL_IFACE_METHOD(DeviceContextD3D12, TransitionBufferState,    This, __VA_ARGS__)
+#    define IDeviceContextD3D12_GetD3D12CommandList(This)           CALL_IFACE_METHOD(DeviceContextD3D12, GetD3D12CommandList,      This)
+#    define IDeviceContextD3D12_ExecuteIndirect(This, ...)          CALL_IFACE_METHOD(DeviceContextD3D12, ExecuteIndirect,          This, __VA_ARGS__)
+#    define IDeviceContextD3D12_BeginReusableCommandList(This, ...) CALL_IFACE_METHOD(DeviceContextD3D12, BeginReusableCommandList, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -38,6 +38,61 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceD3D12 =
     {0xc7987c98, 0x87fe, 0x4309, {0xae, 0x88, 0xe9, 0x8f, 0x4, 0x4b, 0x0, 0xf6}};
 
+/// Describes a single argument of an indirect command signature, see IRenderDeviceD3D12::CreateIndirectCommandSignature().
+struct IndirectArgumentDescD3D12
+{
+    /// Argument type.
+
+    /// \remarks    The following types are supported:
+    ///             - D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED,
+    ///               D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH, D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH -
+    ///               the command itself. Exactly one such argument must be present, and it must be the last one.
+    ///             - D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW - changes the vertex buffer in the
+    ///               VertexBufferSlot slot (D3D12_VERTEX_BUFFER_VIEW).
+    ///             - D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW - changes the index buffer (D3D12_INDEX_BUFFER_VIEW).
+    ///             - D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW - changes the GPU virtual address
+    ///               of the constant buffer identified by ShaderStages and Name (D3D12_GPU_VIRTUAL_ADDRESS).
+    ///               The buffer must be bound as a root view, i.e. it must not be an array and
+    ///               must not be declared with PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag.
+    D3D12_INDIRECT_ARGUMENT_TYPE Type DEFAULT_INITIALIZER(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW);
+
+    /// Vertex buffer slot for D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW argument.
+    Uint32 VertexBufferSlot DEFAULT_INITIALIZER(0);
+
+    /// Shader stages of the constant buffer for D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW argument.
+    SHADER_TYPE ShaderStages DEFAULT_INITIALIZER(SHADER_TYPE_UNKNOWN);
+
+    /// Name of the constant buffer for D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW argument.
+    const Char* Name DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct IndirectArgumentDescD3D12 IndirectArgumentDescD3D12;
+
+
+/// Indirect command signature description, see IRenderDeviceD3D12::CreateIndirectCommandSignature().
+struct IndirectCommandSignatureDescD3D12
+{
+    /// A pointer to the array of NumArguments argument descriptions.
+    const IndirectArgumentDescD3D12* pArguments DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of elements in pArguments array.
+    Uint32 NumArguments DEFAULT_INITIALIZER(0);
+
+    /// The size of each command in the arguments buffer, in bytes.
+
+    /// \remarks    If zero, the tightly packed size of all arguments is used.
+    Uint32 ByteStride DEFAULT_INITIALIZER(0);
+
+    /// Pipeline state the signature will be used with.
+
+    /// \remarks    The pipeline is required if the signature contains
+    ///             D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW arguments.
+    ///             The signature may then only be used with pipelines that share the same
+    ///             root signature (i.e. created with the same resource signatures).
+    IPipelineState* pPipeline DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct IndirectCommandSignatureDescD3D12 IndirectCommandSignatureDescD3D12;
+
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceD3D12
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -117,6 +172,22 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceD3D12, IRenderDevice)
                                                    const TopLevelASDesc REF Desc,
                                                    RESOURCE_STATE           InitialState,
                                                    ITopLevelAS**            ppTLAS) PURE;
+
+    /// Creates an indirect command signature that can be used with IDeviceContextD3D12::ExecuteIndirect().
+
+    /// \param [in]  Desc         - Command signature description, see Diligent::IndirectCommandSignatureDescD3D12.
+    /// \param [out] ppSignature  - Address of the memory location where the pointer to the
+    ///                             command signature will be stored.
+    ///                             The function calls AddRef(), so that the new object will contain
+    ///                             one reference.
+    ///
+    /// \remarks    Unlike the fixed signatures used by IDeviceContext::DrawIndirect() and other indirect
+    ///             commands, custom signatures may also change vertex and index buffers and constant
+    ///             buffer addresses for every command, which allows the GPU to drive a large number of
+    ///             draw calls with different resources without a CPU round trip.
+    VIRTUAL void METHOD(CreateIndirectCommandSignature)(THIS_
+                                                        const IndirectCommandSignatureDescD3D12 REF Desc,
+                                                        ID3D12CommandSignature**                    ppSignature) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -126,11 +197,12 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IRenderDeviceD3D12_GetD3D12Device(This)                    CALL_IFACE_METHOD(RenderDeviceD3D12, GetD3D12Device,               This)
-#    define IRenderDeviceD3D12_CreateTextureFromD3DResource(This, ...) CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTextureFromD3DResource, This, __VA_ARGS__)
-#    define IRenderDeviceD3D12_CreateBufferFromD3DResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBufferFromD3DResource,  This, __VA_ARGS__)
-#    define IRenderDeviceD3D12_CreateBLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBLASFromD3DResource,    This, __VA_ARGS__)
-#    define IRenderDeviceD3D12_CreateTLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTLASFromD3DResource,    This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_GetD3D12Device(This)                      CALL_IFACE_METHOD(RenderDeviceD3D12, GetD3D12Device,                 This)
+#    define IRenderDeviceD3D12_CreateTextureFromD3DResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTextureFromD3DResource,   This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_CreateBufferFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBufferFromD3DResource,    This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_CreateBLASFromD3DResource(This, ...)      CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBLASFromD3DResource,      This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_CreateTLASFromD3DResource(This, ...)      CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTLASFromD3DResource,      This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_CreateIndirectCommandSignature(This, ...) CALL_IFACE_METHOD(RenderDeviceD3D12, CreateIndirectCommandSignature, This, __VA_ARGS__)
 
 // clang-format on
 
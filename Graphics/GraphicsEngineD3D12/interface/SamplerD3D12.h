@@ -53,6 +53,15 @@ DILIGENT_BEGIN_INTERFACE(ISamplerD3D12, ISampler)
     /// The method does *NOT* increment the reference counter of the returned object,
     /// so Release() must not be called.
     VIRTUAL D3D12_CPU_DESCRIPTOR_HANDLE METHOD(GetCPUDescriptorHandle)(THIS) PURE;
+
+    /// Returns the index of the sampler descriptor in the shader-visible sampler descriptor heap.
+
+    /// \remarks    The index is stable for the lifetime of the object and can be used to access
+    ///             the sampler through SamplerDescriptorHeap[] in shader model 6.6 shaders.
+    ///             Descriptor heap indices are only available when EngineD3D12CreateInfo::EnableBindlessResources
+    ///             is set to true and the device supports shader model 6.6 with resource binding tier 3.
+    ///             If the index is not available, the method returns ~0u.
+    VIRTUAL Uint32 METHOD(GetDescriptorHeapIndex)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -61,6 +70,7 @@ DILIGENT_END_INTERFACE
 #if DILIGENT_C_INTERFACE
 
 #    define ISamplerD3D12_GetCPUDescriptorHandle(This) CALL_IFACE_METHOD(SamplerD3D12, GetCPUDescriptorHandle, This)
+#    define ISamplerD3D12_GetDescriptorHeapIndex(This)  CALL_IFACE_METHOD(SamplerD3D12, GetDescriptorHeapIndex, This)
 
 #endif
 
@@ -0,0 +1,246 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Single-pass mip generation for square power-of-two textures.
+//
+// Every thread group reduces a 64x64 tile of the source mip to mips 1-6. The tile is
+// processed by 256 threads that are mapped to 2x2 quads, so that the first reductions
+// are performed with quad wave operations and only the last three levels go through
+// the group shared memory. The last group to finish its tile (which is detected with an
+// atomic counter) reads mip 6 back and produces mips 7-12 in the same way.
+//
+// The shader requires shader model 6.0 and must be compiled with DXC.
+
+#ifndef CONVERT_TO_SRGB
+#   define CONVERT_TO_SRGB 0
+#endif
+
+Texture2DArray<float4>                    SrcTex         : register(t0);
+RWTexture2DArray<float4>                  OutMips[12]    : register(u0);  // Mips 1-12; mip 6 is only written through OutMip6
+globallycoherent RWTexture2DArray<float4> OutMip6        : register(u12); // Alias of mip 6 that is read by the last group
+globallycoherent RWStructuredBuffer<uint> AtomicCounters : register(u13); // One counter per array slice
+SamplerState                              BilinearClamp  : register(s0);
+
+cbuffer CB : register(b0)
+{
+    uint  SrcMipLevel;   // Texture level of source mip
+    uint  NumMipLevels;  // Number of OutMips to write: [1, 12]
+    uint  NumWorkGroups; // Number of groups per array slice
+    float InvSrcSize;    // 1.0 / SrcMip.Dimensions
+}
+
+groupshared float gs_R[64];
+groupshared float gs_G[64];
+groupshared float gs_B[64];
+groupshared float gs_A[64];
+groupshared uint  gs_Counter;
+
+void StoreColor(uint2 XY, float4 Color)
+{
+    uint Index = XY.y * 8u + XY.x;
+    gs_R[Index] = Color.r;
+    gs_G[Index] = Color.g;
+    gs_B[Index] = Color.b;
+    gs_A[Index] = Color.a;
+}
+
+float4 LoadColor(uint2 XY)
+{
+    uint Index = XY.y * 8u + XY.x;
+    return float4(gs_R[Index], gs_G[Index], gs_B[Index], gs_A[Index]);
+}
+
+float3 LinearToSRGB(float3 x)
+{
+    // Cheaper approximation of the sRGB curve, same as in GenerateMipsCS.hlsli
+    float3 Lo = 12.92 * x;
+    float3 Hi = 1.13005 * sqrt(abs(x - 0.00228)) - 0.13448 * x + 0.005719;
+    return lerp(Hi, Lo, float3(x < 0.0031308));
+}
+
+float3 SRGBToLinear(float3 x)
+{
+    float3 Lo = x / 12.92;
+    float3 Hi = pow((abs(x) + 0.055) / 1.055, 2.4);
+    return lerp(Hi, Lo, float3(x < 0.04045));
+}
+
+float4 PackColor(float4 Linear)
+{
+#if CONVERT_TO_SRGB
+    return float4(LinearToSRGB(Linear.rgb), Linear.a);
+#else
+    return Linear;
+#endif
+}
+
+float4 UnpackColor(float4 Color)
+{
+#if CONVERT_TO_SRGB
+    return float4(SRGBToLinear(Color.rgb), Color.a);
+#else
+    return Color;
+#endif
+}
+
+// Mip is 1-based
+void StoreMip(uint Mip, uint2 Coord, uint Slice, float4 Color)
+{
+    if (Mip > NumMipLevels)
+        return;
+
+    if (Mip == 6u)
+        OutMip6[uint3(Coord, Slice)] = PackColor(Color);
+    else
+        OutMips[Mip - 1u][uint3(Coord, Slice)] = PackColor(Color);
+}
+
+// Maps lanes 0-63 to an 8x8 block in Morton order, so that
+// every four consecutive lanes form a 2x2 quad.
+uint2 RemapLane(uint Lane)
+{
+    return uint2((Lane & 1u) | ((Lane >> 1u) & 2u) | ((Lane >> 2u) & 4u),
+                 ((Lane >> 1u) & 1u) | ((Lane >> 2u) & 2u) | ((Lane >> 3u) & 4u));
+}
+
+float4 ReduceQuad(float4 Color)
+{
+    float4 ColorX = QuadReadAcrossX(Color);
+    float4 ColorY = QuadReadAcrossY(Color);
+    float4 ColorD = QuadReadAcrossDiagonal(Color);
+    return (Color + ColorX + ColorY + ColorD) * 0.25;
+}
+
+uint2 GetThreadXY(uint GI)
+{
+    // 256 threads form a 16x16 block made of four 8x8 Morton-ordered quadrants
+    return RemapLane(GI & 63u) + 8u * uint2((GI >> 6u) & 1u, GI >> 7u);
+}
+
+// Reduces the 32x32 block of mip FirstMip, whose 2x2 sub-block for the current thread
+// is given by Color[], down to 1x1 and writes mips FirstMip through FirstMip + 5.
+void DownsampleTile(uint GI, uint2 Tile, uint FirstMip, uint Slice, float4 Color[4])
+{
+    uint2 XY = GetThreadXY(GI);
+
+    StoreMip(FirstMip, Tile * 32u + XY * 2u + uint2(0u, 0u), Slice, Color[0]);
+    StoreMip(FirstMip, Tile * 32u + XY * 2u + uint2(1u, 0u), Slice, Color[1]);
+    StoreMip(FirstMip, Tile * 32u + XY * 2u + uint2(0u, 1u), Slice, Color[2]);
+    StoreMip(FirstMip, Tile * 32u + XY * 2u + uint2(1u, 1u), Slice, Color[3]);
+
+    // 16x16
+    float4 Avg = (Color[0] + Color[1] + Color[2] + Color[3]) * 0.25;
+    StoreMip(FirstMip + 1u, Tile * 16u + XY, Slice, Avg);
+
+    // 8x8
+    Avg = ReduceQuad(Avg);
+    if ((GI & 3u) == 0u)
+    {
+        StoreMip(FirstMip + 2u, Tile * 8u + XY / 2u, Slice, Avg);
+        StoreColor(XY / 2u, Avg);
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    // 4x4. Only whole quads are active, so quad operations are well-defined.
+    XY = RemapLane(GI);
+    if (GI < 64u)
+        Avg = ReduceQuad(LoadColor(XY));
+    GroupMemoryBarrierWithGroupSync();
+    if (GI < 64u && (GI & 3u) == 0u)
+    {
+        StoreMip(FirstMip + 3u, Tile * 4u + XY / 2u, Slice, Avg);
+        StoreColor(XY / 2u, Avg);
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    // 2x2
+    if (GI < 16u)
+        Avg = ReduceQuad(LoadColor(XY));
+    GroupMemoryBarrierWithGroupSync();
+    if (GI < 16u && (GI & 3u) == 0u)
+    {
+        StoreMip(FirstMip + 4u, Tile * 2u + XY / 2u, Slice, Avg);
+        StoreColor(XY / 2u, Avg);
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    // 1x1
+    if (GI < 4u)
+    {
+        Avg = ReduceQuad(LoadColor(XY));
+        if (GI == 0u)
+            StoreMip(FirstMip + 5u, Tile, Slice, Avg);
+    }
+}
+
+float4 LoadMip6(uint2 Coord, uint Slice)
+{
+    return UnpackColor(OutMip6[uint3(Coord, Slice)]);
+}
+
+[numthreads(256, 1, 1)]
+void main(uint GI : SV_GroupIndex, uint3 GroupId : SV_GroupID)
+{
+    uint  Slice = GroupId.z;
+    uint2 XY    = GetThreadXY(GI);
+
+    // Every mip 1 texel is the bilinear sample at the center of the 2x2 source block
+    float4 Color[4];
+    [unroll]
+    for (uint i = 0u; i < 4u; ++i)
+    {
+        uint2  Coord = GroupId.xy * 64u + XY * 4u + uint2(i & 1u, i >> 1u) * 2u;
+        float2 UV    = (float2(Coord) + 1.0) * InvSrcSize;
+        Color[i]     = SrcTex.SampleLevel(BilinearClamp, float3(UV, Slice), SrcMipLevel);
+    }
+    DownsampleTile(GI, GroupId.xy, 1u, Slice, Color);
+
+    if (NumMipLevels <= 6u)
+        return;
+
+    // Make mip 6 visible to other groups before incrementing the counter
+    DeviceMemoryBarrierWithGroupSync();
+    if (GI == 0u)
+        InterlockedAdd(AtomicCounters[Slice], 1u, gs_Counter);
+    GroupMemoryBarrierWithGroupSync();
+
+    if (gs_Counter != NumWorkGroups - 1u)
+        return;
+
+    // This is the last group for this slice. Reset the counter for the next dispatch.
+    if (GI == 0u)
+        AtomicCounters[Slice] = 0u;
+
+    // Mip 6 is at most 64x64, so a single tile covers it entirely
+    [unroll]
+    for (uint j = 0u; j < 4u; ++j)
+    {
+        uint2 Coord = XY * 4u + uint2(j & 1u, j >> 1u) * 2u;
+        Color[j] = (LoadMip6(Coord, Slice) + LoadMip6(Coord + uint2(1u, 0u), Slice) +
+                    LoadMip6(Coord + uint2(0u, 1u), Slice) + LoadMip6(Coord + uint2(1u, 1u), Slice)) * 0.25;
+    }
+    DownsampleTile(GI, uint2(0u, 0u), 7u, Slice, Color);
+}
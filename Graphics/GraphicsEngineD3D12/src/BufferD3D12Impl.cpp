@@ -137,6 +137,18 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
             else
                 HeapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
 
+            if ((m_Desc.MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) != 0)
+            {
+#ifdef D3D12_H_HAS_GPU_UPLOAD_HEAP
+                // GPU upload heap memory resides in the video memory and is directly accessible by the CPU
+                if (pRenderDeviceD3D12->IsGPUUploadHeapSupported())
+                    HeapProps.Type = D3D12_HEAP_TYPE_GPU_UPLOAD;
+                else
+#endif
+                    m_Desc.MiscFlags &= ~MISC_BUFFER_FLAG_DIRECT_UPDATES;
+            }
+            const bool UseDirectUpdates = (m_Desc.MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) != 0;
+
             if (HeapProps.Type == D3D12_HEAP_TYPE_READBACK)
                 SetState(RESOURCE_STATE_COPY_DEST);
             else if (HeapProps.Type == D3D12_HEAP_TYPE_UPLOAD)
@@ -150,7 +162,7 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
                 std::min(pBuffData->DataSize, d3d12BuffDesc.Width) :
                 0;
 
-            if (InitialDataSize > 0)
+            if (InitialDataSize > 0 && !UseDirectUpdates)
                 SetState(RESOURCE_STATE_COPY_DEST);
 
             if (!IsInKnownState())
@@ -173,18 +185,37 @@ BufferD3D12Impl::BufferD3D12Impl(IReferenceCounters*        pRefCounters,
                 D3D12_HEAP_FLAG_CREATE_NOT_ZEROED :
                 D3D12_HEAP_FLAG_NONE;
 
-            auto hr = pd3d12Device->CreateCommittedResource(
-                &HeapProps, d3d12HeapFlags, &d3d12BuffDesc, d3d12State,
-                nullptr, // pOptimizedClearValue
-                __uuidof(m_pd3d12Resource),
-                reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&m_pd3d12Resource)));
-            if (FAILED(hr))
-                LOG_ERROR_AND_THROW("Failed to create D3D12 buffer");
+            // Try to suballocate the buffer from a resource heap page first
+            m_MemoryAllocation = pRenderDeviceD3D12->GetMemoryManager().CreatePlacedResource(HeapProps.Type, d3d12BuffDesc, d3d12State,
+                                                                                             nullptr, // pOptimizedClearValue
+                                                                                             m_pd3d12Resource);
+
+            HRESULT hr = S_OK;
+            if (!m_MemoryAllocation)
+            {
+                hr = pd3d12Device->CreateCommittedResource(
+                    &HeapProps, d3d12HeapFlags, &d3d12BuffDesc, d3d12State,
+                    nullptr, // pOptimizedClearValue
+                    __uuidof(m_pd3d12Resource),
+                    reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&m_pd3d12Resource)));
+                if (FAILED(hr))
+                    LOG_ERROR_AND_THROW("Failed to create D3D12 buffer");
+            }
 
             if (*m_Desc.Name != 0)
                 m_pd3d12Resource->SetName(WidenString(m_Desc.Name).c_str());
 
-            if (InitialDataSize > 0)
+            if (UseDirectUpdates)
+            {
+                // The buffer stays mapped for its entire lifetime
+                hr = m_pd3d12Resource->Map(0, nullptr, &m_pDirectUpdateCPUAddress);
+                if (FAILED(hr))
+                    LOG_ERROR_AND_THROW("Failed to map GPU upload heap buffer");
+
+                if (InitialDataSize > 0)
+                    memcpy(m_pDirectUpdateCPUAddress, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
+            }
+            else if (InitialDataSize > 0)
             {
                 D3D12_HEAP_PROPERTIES UploadHeapProps{};
                 UploadHeapProps.Type                 = D3D12_HEAP_TYPE_UPLOAD;
@@ -341,6 +372,9 @@ BufferD3D12Impl::~BufferD3D12Impl()
 {
     // D3D12 object can only be destroyed when it is no longer used by the GPU
     GetDevice()->SafeReleaseDeviceObject(std::move(m_pd3d12Resource), m_Desc.ImmediateContextMask);
+    // The memory must be released after the placed resource
+    if (m_MemoryAllocation)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
 }
 
 void BufferD3D12Impl::CreateViewInternal(const BufferViewDesc& OrigViewDesc, IBufferView** ppView, bool bIsDefaultView)
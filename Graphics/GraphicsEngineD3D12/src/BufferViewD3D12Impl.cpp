@@ -53,10 +53,17 @@ BufferViewD3D12Impl::BufferViewD3D12Impl(IReferenceCounters*        pRefCounters
     m_DescriptorHandle{std::move(HandleAlloc)}
 // clang-format on
 {
+    if (m_Desc.ViewType == BUFFER_VIEW_SHADER_RESOURCE || m_Desc.ViewType == BUFFER_VIEW_UNORDERED_ACCESS)
+        m_BindlessDescriptor = pDevice->AllocateBindlessDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, m_DescriptorHandle.GetCpuHandle());
 }
 
 BufferViewD3D12Impl::~BufferViewD3D12Impl()
 {
 }
 
+Uint32 BufferViewD3D12Impl::GetDescriptorHeapIndex() const
+{
+    return GetDevice()->GetBindlessDescriptorIndex(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, m_BindlessDescriptor);
+}
+
 } // namespace Diligent
@@ -55,10 +55,31 @@ namespace Diligent
 {
 
 CommandContext::CommandContext(CommandListManager& CmdListManager) :
+    // clang-format off
     m_PendingResourceBarriers(STD_ALLOCATOR_RAW_MEM(D3D12_RESOURCE_BARRIER, GetRawAllocator(), "Allocator for vector<D3D12_RESOURCE_BARRIER>"))
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+  , m_PendingBufferBarriers  (STD_ALLOCATOR_RAW_MEM(D3D12_BUFFER_BARRIER,   GetRawAllocator(), "Allocator for vector<D3D12_BUFFER_BARRIER>"))
+  , m_PendingTextureBarriers (STD_ALLOCATOR_RAW_MEM(D3D12_TEXTURE_BARRIER,  GetRawAllocator(), "Allocator for vector<D3D12_TEXTURE_BARRIER>"))
+#endif
+// clang-format on
 {
     m_PendingResourceBarriers.reserve(32);
     CmdListManager.CreateNewCommandList(&m_pCommandList, &m_pCurrentAllocator, m_MaxInterfaceVer);
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    // Compute and copy queues only support a subset of barrier layouts, so the legacy
+    // resource barriers are used there. Legacy and enhanced barriers interoperate through
+    // the layouts implied by the legacy resource states.
+    m_UseEnhancedBarriers =
+        m_MaxInterfaceVer >= 7 &&
+        CmdListManager.GetCommandListType() == D3D12_COMMAND_LIST_TYPE_DIRECT &&
+        CmdListManager.IsEnhancedBarriersSupported();
+    if (m_UseEnhancedBarriers)
+    {
+        m_PendingBufferBarriers.reserve(16);
+        m_PendingTextureBarriers.reserve(16);
+    }
+#endif
 }
 
 CommandContext::~CommandContext(void)
@@ -66,7 +87,7 @@ CommandContext::~CommandContext(void)
     DEV_CHECK_ERR(m_pCurrentAllocator == nullptr, "Command allocator must be released prior to destroying the command context");
 }
 
-void CommandContext::Reset(CommandListManager& CmdListManager)
+void CommandContext::Reset(CommandListManager& CmdListManager, Uint32 ExpectedNumCommands)
 {
     // We only call Reset() on previously freed contexts. The command list persists, but we need to
     // request a new allocator
@@ -74,7 +95,7 @@ void CommandContext::Reset(CommandListManager& CmdListManager)
     VERIFY_EXPR(m_pCommandList->GetType() == CmdListManager.GetCommandListType());
     if (!m_pCurrentAllocator)
     {
-        CmdListManager.RequestAllocator(&m_pCurrentAllocator);
+        CmdListManager.RequestAllocator(&m_pCurrentAllocator, ExpectedNumCommands);
         // Unlike ID3D12CommandAllocator::Reset, ID3D12GraphicsCommandList::Reset can be called while the
         // command list is still being executed. A typical pattern is to submit a command list and then
         // immediately reset it to reuse the allocated memory for another command list.
@@ -85,11 +106,21 @@ void CommandContext::Reset(CommandListManager& CmdListManager)
     m_pCurGraphicsRootSignature = nullptr;
     m_pCurComputeRootSignature  = nullptr;
     m_PendingResourceBarriers.clear();
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    m_PendingBufferBarriers.clear();
+    m_PendingTextureBarriers.clear();
+    m_PendingGlobalBarrier    = D3D12_GLOBAL_BARRIER{};
+    m_HasPendingGlobalBarrier = false;
+#endif
     m_BoundDescriptorHeaps = ShaderDescriptorHeaps{};
 
     m_DynamicGPUDescriptorAllocators = nullptr;
+    m_pBarrierCounters               = nullptr;
+    m_pAllocationCounters            = nullptr;
 
     m_PrimitiveTopology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+    m_NumRecordedCommands = 0;
 #if 0
     BindDescriptorHeaps();
 #endif
@@ -178,6 +209,16 @@ public:
     void AddD3D12ResourceBarriers(TopLevelASD3D12Impl& TLAS, D3D12_RESOURCE_BARRIER& d3d12Barrier);
     void AddD3D12ResourceBarriers(BottomLevelASD3D12Impl& BLAS, D3D12_RESOURCE_BARRIER& d3d12Barrier);
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+    template <typename BarrierType>
+    void InitEnhancedBarrierSyncAndAccess(BarrierType& d3d12Barrier, RESOURCE_STATE NewState) const;
+
+    void AddD3D12EnhancedBarriers(TextureD3D12Impl& Tex, RESOURCE_STATE NewState);
+    void AddD3D12EnhancedBarriers(BufferD3D12Impl& Buff, RESOURCE_STATE NewState);
+    void AddD3D12EnhancedBarriers(TopLevelASD3D12Impl& TLAS, RESOURCE_STATE NewState);
+    void AddD3D12EnhancedBarriers(BottomLevelASD3D12Impl& BLAS, RESOURCE_STATE NewState);
+#endif
+
     template <typename ResourceType>
     void operator()(ResourceType& Resource);
 
@@ -372,6 +413,106 @@ void StateTransitionHelper::AddD3D12ResourceBarriers(BottomLevelASD3D12Impl& BLA
         m_RequireUAVBarrier = true;
 }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+template <typename BarrierType>
+void StateTransitionHelper::InitEnhancedBarrierSyncAndAccess(BarrierType& d3d12Barrier, RESOURCE_STATE NewState) const
+{
+    d3d12Barrier.SyncBefore   = ResourceStateFlagsToD3D12BarrierSync(m_OldState);
+    d3d12Barrier.SyncAfter    = ResourceStateFlagsToD3D12BarrierSync(NewState);
+    d3d12Barrier.AccessBefore = ResourceStateFlagsToD3D12BarrierAccess(m_OldState);
+    d3d12Barrier.AccessAfter  = ResourceStateFlagsToD3D12BarrierAccess(NewState);
+
+    // Split barriers: the begin half waits for the prior work and the end half blocks
+    // the subsequent work. Both halves must specify the same access and layout transition.
+    if (m_Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        d3d12Barrier.SyncAfter = D3D12_BARRIER_SYNC_SPLIT;
+    else if (m_Barrier.TransitionType == STATE_TRANSITION_TYPE_END)
+        d3d12Barrier.SyncBefore = D3D12_BARRIER_SYNC_SPLIT;
+}
+
+void StateTransitionHelper::AddD3D12EnhancedBarriers(TextureD3D12Impl& Tex, RESOURCE_STATE NewState)
+{
+    const auto LayoutBefore = ResourceStateFlagsToD3D12BarrierLayout(m_OldState);
+    const auto LayoutAfter  = ResourceStateFlagsToD3D12BarrierLayout(NewState);
+
+    // Read-to-read transitions do not require synchronization unless the layout changes
+    const bool IsReadToRead =
+        (m_OldState & RESOURCE_STATE_GENERIC_READ) == m_OldState &&
+        (NewState & RESOURCE_STATE_GENERIC_READ) == NewState;
+    if (IsReadToRead && LayoutBefore == LayoutAfter)
+        return;
+
+    const auto& TexDesc = Tex.GetDesc();
+    VERIFY(m_Barrier.FirstMipLevel < TexDesc.MipLevels, "First mip level is out of range");
+    VERIFY(m_Barrier.MipLevelsCount == REMAINING_MIP_LEVELS || m_Barrier.FirstMipLevel + m_Barrier.MipLevelsCount <= TexDesc.MipLevels,
+           "Invalid mip level range");
+    VERIFY(m_Barrier.FirstArraySlice < TexDesc.GetArraySize(), "First array slice is out of range");
+    VERIFY(m_Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES || m_Barrier.FirstArraySlice + m_Barrier.ArraySliceCount <= TexDesc.GetArraySize(),
+           "Invalid array slice range");
+
+    D3D12_TEXTURE_BARRIER d3d12Barrier{};
+    InitEnhancedBarrierSyncAndAccess(d3d12Barrier, NewState);
+    d3d12Barrier.LayoutBefore = LayoutBefore;
+    d3d12Barrier.LayoutAfter  = LayoutAfter;
+    d3d12Barrier.pResource    = m_pd3d12Resource;
+    d3d12Barrier.Flags        = D3D12_TEXTURE_BARRIER_FLAG_NONE;
+
+    const Uint32 EndMip   = m_Barrier.MipLevelsCount == REMAINING_MIP_LEVELS ? TexDesc.MipLevels : m_Barrier.FirstMipLevel + m_Barrier.MipLevelsCount;
+    const Uint32 EndSlice = m_Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES ? TexDesc.GetArraySize() : m_Barrier.FirstArraySlice + m_Barrier.ArraySliceCount;
+    if (m_Barrier.FirstMipLevel == 0 && EndMip == TexDesc.MipLevels &&
+        m_Barrier.FirstArraySlice == 0 && EndSlice == TexDesc.GetArraySize())
+    {
+        // All subresources
+        d3d12Barrier.Subresources.IndexOrFirstMipLevel = 0xFFFFFFFFu;
+        d3d12Barrier.Subresources.NumMipLevels         = 0;
+    }
+    else
+    {
+        // Unlike legacy barriers, a single enhanced barrier covers the entire subresource range
+        const auto& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+
+        d3d12Barrier.Subresources.IndexOrFirstMipLevel = m_Barrier.FirstMipLevel;
+        d3d12Barrier.Subresources.NumMipLevels         = EndMip - m_Barrier.FirstMipLevel;
+        d3d12Barrier.Subresources.FirstArraySlice      = m_Barrier.FirstArraySlice;
+        d3d12Barrier.Subresources.NumArraySlices       = EndSlice - m_Barrier.FirstArraySlice;
+        d3d12Barrier.Subresources.FirstPlane           = 0;
+        d3d12Barrier.Subresources.NumPlanes            = FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ? 2 : 1;
+    }
+
+    DiscardIfAppropriate(TexDesc, ResourceStateFlagsToD3D12ResourceStates(m_OldState) & m_ResStateMask, EndMip, EndSlice);
+    m_CmdCtx.TextureBarrier(d3d12Barrier);
+    DiscardIfAppropriate(TexDesc, ResourceStateFlagsToD3D12ResourceStates(NewState) & m_ResStateMask, EndMip, EndSlice);
+}
+
+void StateTransitionHelper::AddD3D12EnhancedBarriers(BufferD3D12Impl& Buff, RESOURCE_STATE NewState)
+{
+    // Buffers have no layout, so read-to-read transitions never require a barrier
+    if ((m_OldState & RESOURCE_STATE_GENERIC_READ) == m_OldState &&
+        (NewState & RESOURCE_STATE_GENERIC_READ) == NewState)
+        return;
+
+    D3D12_BUFFER_BARRIER d3d12Barrier{};
+    InitEnhancedBarrierSyncAndAccess(d3d12Barrier, NewState);
+    d3d12Barrier.pResource = m_pd3d12Resource;
+    d3d12Barrier.Offset    = 0;
+    d3d12Barrier.Size      = UINT64_MAX;
+    m_CmdCtx.BufferBarrier(d3d12Barrier);
+}
+
+void StateTransitionHelper::AddD3D12EnhancedBarriers(TopLevelASD3D12Impl& TLAS, RESOURCE_STATE /*NewState*/)
+{
+    // Acceleration structures are synchronized with the global barrier, same as UAV barriers
+    D3D12_RESOURCE_BARRIER d3d12Barrier{};
+    AddD3D12ResourceBarriers(TLAS, d3d12Barrier);
+}
+
+void StateTransitionHelper::AddD3D12EnhancedBarriers(BottomLevelASD3D12Impl& BLAS, RESOURCE_STATE /*NewState*/)
+{
+    D3D12_RESOURCE_BARRIER d3d12Barrier{};
+    AddD3D12ResourceBarriers(BLAS, d3d12Barrier);
+}
+#endif
+
 template <typename ResourceType>
 void StateTransitionHelper::operator()(ResourceType& Resource)
 {
@@ -398,7 +539,16 @@ void StateTransitionHelper::operator()(ResourceType& Resource)
         (m_Barrier.NewState == RESOURCE_STATE_UNORDERED_ACCESS || m_Barrier.NewState == RESOURCE_STATE_BUILD_AS_WRITE);
 
     // Check if required state is already set
-    if ((m_OldState & m_Barrier.NewState) != m_Barrier.NewState)
+    const bool StateChanged = (m_OldState & m_Barrier.NewState) != m_Barrier.NewState;
+    if (DeviceContextBarrierCounters* pCounters = m_CmdCtx.GetBarrierCounters())
+    {
+        if (StateChanged || m_RequireUAVBarrier)
+            ++pCounters->Transitions;
+        else
+            ++pCounters->TransitionsSkipped;
+    }
+
+    if (StateChanged)
     {
         auto NewState = m_Barrier.NewState;
         // If both old state and new state are read-only states, combine the two
@@ -406,15 +556,24 @@ void StateTransitionHelper::operator()(ResourceType& Resource)
             (NewState & RESOURCE_STATE_GENERIC_READ) == NewState)
             NewState |= m_OldState;
 
-        D3D12_RESOURCE_BARRIER d3d12Barrier;
-        d3d12Barrier.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        d3d12Barrier.Flags                  = TransitionTypeToD3D12ResourceBarrierFlag(m_Barrier.TransitionType);
-        d3d12Barrier.Transition.pResource   = m_pd3d12Resource;
-        d3d12Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        d3d12Barrier.Transition.StateBefore = ResourceStateFlagsToD3D12ResourceStates(m_OldState) & m_ResStateMask;
-        d3d12Barrier.Transition.StateAfter  = ResourceStateFlagsToD3D12ResourceStates(NewState) & m_ResStateMask;
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        if (m_CmdCtx.UseEnhancedBarriers())
+        {
+            AddD3D12EnhancedBarriers(Resource, NewState);
+        }
+        else
+#endif
+        {
+            D3D12_RESOURCE_BARRIER d3d12Barrier;
+            d3d12Barrier.Type                   = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            d3d12Barrier.Flags                  = TransitionTypeToD3D12ResourceBarrierFlag(m_Barrier.TransitionType);
+            d3d12Barrier.Transition.pResource   = m_pd3d12Resource;
+            d3d12Barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            d3d12Barrier.Transition.StateBefore = ResourceStateFlagsToD3D12ResourceStates(m_OldState) & m_ResStateMask;
+            d3d12Barrier.Transition.StateAfter  = ResourceStateFlagsToD3D12ResourceStates(NewState) & m_ResStateMask;
 
-        AddD3D12ResourceBarriers(Resource, d3d12Barrier);
+            AddD3D12ResourceBarriers(Resource, d3d12Barrier);
+        }
 
         if ((m_Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
         {
@@ -430,9 +589,29 @@ void StateTransitionHelper::operator()(ResourceType& Resource)
         // must complete before any future UAV accesses (reads or writes) can begin.
 
         DEV_CHECK_ERR(m_Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE, "UAV barriers must not be split");
-        D3D12_RESOURCE_BARRIER d3d12Barrier{D3D12_RESOURCE_BARRIER_TYPE_UAV, D3D12_RESOURCE_BARRIER_FLAG_NONE, {}};
-        d3d12Barrier.UAV.pResource = m_pd3d12Resource;
-        m_CmdCtx.ResourceBarrier(d3d12Barrier);
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        if (m_CmdCtx.UseEnhancedBarriers())
+        {
+            // With enhanced barriers, UAV barriers for all resources recorded between two flushes
+            // are merged into a single global barrier. No synchronization is needed if the
+            // resource has not been accessed before.
+            if (m_OldState != RESOURCE_STATE_UNDEFINED)
+            {
+                D3D12_GLOBAL_BARRIER d3d12Barrier{};
+                d3d12Barrier.SyncBefore   = ResourceStateFlagsToD3D12BarrierSync(m_OldState);
+                d3d12Barrier.SyncAfter    = ResourceStateFlagsToD3D12BarrierSync(m_Barrier.NewState);
+                d3d12Barrier.AccessBefore = ResourceStateFlagsToD3D12BarrierAccess(m_OldState);
+                d3d12Barrier.AccessAfter  = ResourceStateFlagsToD3D12BarrierAccess(m_Barrier.NewState);
+                m_CmdCtx.GlobalBarrier(d3d12Barrier);
+            }
+        }
+        else
+#endif
+        {
+            D3D12_RESOURCE_BARRIER d3d12Barrier{D3D12_RESOURCE_BARRIER_TYPE_UAV, D3D12_RESOURCE_BARRIER_FLAG_NONE, {}};
+            d3d12Barrier.UAV.pResource = m_pd3d12Resource;
+            m_CmdCtx.ResourceBarrier(d3d12Barrier);
+        }
     }
 }
 
@@ -464,18 +643,94 @@ void CommandContext::TransitionResource(TopLevelASD3D12Impl& TLAS, const StateTr
 
 void CommandContext::InsertAliasBarrier(D3D12ResourceBase& Before, D3D12ResourceBase& After, bool FlushImmediate)
 {
-    m_PendingResourceBarriers.emplace_back();
-    D3D12_RESOURCE_BARRIER& BarrierDesc = m_PendingResourceBarriers.back();
-
+    D3D12_RESOURCE_BARRIER BarrierDesc;
     BarrierDesc.Type                     = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
     BarrierDesc.Flags                    = D3D12_RESOURCE_BARRIER_FLAG_NONE;
     BarrierDesc.Aliasing.pResourceBefore = Before.GetD3D12Resource();
     BarrierDesc.Aliasing.pResourceAfter  = After.GetD3D12Resource();
+    ResourceBarrier(BarrierDesc);
 
     if (FlushImmediate)
         FlushResourceBarriers();
 }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+void CommandContext::BufferBarrier(const D3D12_BUFFER_BARRIER& Barrier)
+{
+    VERIFY(m_UseEnhancedBarriers, "Enhanced barriers are not enabled in this context");
+    // Legacy and enhanced barriers must be executed in the order they were recorded
+    if (!m_PendingResourceBarriers.empty())
+        FlushResourceBarriers();
+    m_PendingBufferBarriers.emplace_back(Barrier);
+}
+
+void CommandContext::TextureBarrier(const D3D12_TEXTURE_BARRIER& Barrier)
+{
+    VERIFY(m_UseEnhancedBarriers, "Enhanced barriers are not enabled in this context");
+    if (!m_PendingResourceBarriers.empty())
+        FlushResourceBarriers();
+    m_PendingTextureBarriers.emplace_back(Barrier);
+}
+
+void CommandContext::GlobalBarrier(const D3D12_GLOBAL_BARRIER& Barrier)
+{
+    VERIFY(m_UseEnhancedBarriers, "Enhanced barriers are not enabled in this context");
+    VERIFY((Barrier.AccessBefore & D3D12_BARRIER_ACCESS_NO_ACCESS) == 0 && (Barrier.AccessAfter & D3D12_BARRIER_ACCESS_NO_ACCESS) == 0,
+           "D3D12_BARRIER_ACCESS_NO_ACCESS can't be merged with other global barriers");
+    if (!m_PendingResourceBarriers.empty())
+        FlushResourceBarriers();
+
+    // Merging global barriers only widens the synchronization scope, which is always safe.
+    m_PendingGlobalBarrier.SyncBefore |= Barrier.SyncBefore;
+    m_PendingGlobalBarrier.SyncAfter |= Barrier.SyncAfter;
+    m_PendingGlobalBarrier.AccessBefore |= Barrier.AccessBefore;
+    m_PendingGlobalBarrier.AccessAfter |= Barrier.AccessAfter;
+    m_HasPendingGlobalBarrier = true;
+}
+
+void CommandContext::FlushEnhancedBarriers()
+{
+    VERIFY_EXPR(m_UseEnhancedBarriers);
+    VERIFY(m_PendingResourceBarriers.empty(), "Legacy barriers must be flushed before enhanced barriers");
+
+    D3D12_BARRIER_GROUP BarrierGroups[3];
+    UINT                NumGroups = 0;
+    if (m_HasPendingGlobalBarrier)
+    {
+        auto& Group           = BarrierGroups[NumGroups++];
+        Group.Type            = D3D12_BARRIER_TYPE_GLOBAL;
+        Group.NumBarriers     = 1;
+        Group.pGlobalBarriers = &m_PendingGlobalBarrier;
+    }
+    if (!m_PendingBufferBarriers.empty())
+    {
+        auto& Group           = BarrierGroups[NumGroups++];
+        Group.Type            = D3D12_BARRIER_TYPE_BUFFER;
+        Group.NumBarriers     = static_cast<UINT32>(m_PendingBufferBarriers.size());
+        Group.pBufferBarriers = m_PendingBufferBarriers.data();
+    }
+    if (!m_PendingTextureBarriers.empty())
+    {
+        auto& Group            = BarrierGroups[NumGroups++];
+        Group.Type             = D3D12_BARRIER_TYPE_TEXTURE;
+        Group.NumBarriers      = static_cast<UINT32>(m_PendingTextureBarriers.size());
+        Group.pTextureBarriers = m_PendingTextureBarriers.data();
+    }
+
+    if (NumGroups > 0)
+    {
+        static_cast<ID3D12GraphicsCommandList7*>(m_pCommandList.p)->Barrier(NumGroups, BarrierGroups);
+        if (m_pBarrierCounters != nullptr)
+            ++m_pBarrierCounters->BarrierBatches;
+    }
+
+    m_PendingBufferBarriers.clear();
+    m_PendingTextureBarriers.clear();
+    m_PendingGlobalBarrier    = D3D12_GLOBAL_BARRIER{};
+    m_HasPendingGlobalBarrier = false;
+}
+#endif
+
 #ifdef DILIGENT_USE_PIX
 inline UINT ConvertColor(const float* pColor)
 {
@@ -29,12 +29,18 @@
 #include "CommandListManager.hpp"
 #include "RenderDeviceD3D12Impl.hpp"
 
+#include <thread>
+#include <functional>
+
 namespace Diligent
 {
 
+// {0E2C3B9A-64D1-4F6B-A3F2-7D58E1C94B26}
+const GUID CommandListManager::AllocatorInfoGUID =
+    {0x0e2c3b9a, 0x64d1, 0x4f6b, {0xa3, 0xf2, 0x7d, 0x58, 0xe1, 0xc9, 0x4b, 0x26}};
+
 CommandListManager::CommandListManager(RenderDeviceD3D12Impl& DeviceD3D12Impl, D3D12_COMMAND_LIST_TYPE ListType) :
     // clang-format off
-    m_FreeAllocators (STD_ALLOCATOR_RAW_MEM(CComPtr<ID3D12CommandAllocator>, GetRawAllocator(), "Allocator for vector<CComPtr<ID3D12CommandAllocator>>")),
     m_DeviceD3D12Impl{DeviceD3D12Impl},
     m_CmdListType    {ListType}
 // clang-format on
@@ -44,7 +50,32 @@ CommandListManager::CommandListManager(RenderDeviceD3D12Impl& DeviceD3D12Impl, D
 CommandListManager::~CommandListManager()
 {
     DEV_CHECK_ERR(m_AllocatorCounter == 0, m_AllocatorCounter, " allocator(s) have not been returned to the manager. This will cause a crash if these allocators are referenced by release queues and later returned via FreeAllocator()");
-    LOG_INFO_MESSAGE("Command list manager: created ", m_FreeAllocators.size(), " allocators");
+    LOG_INFO_MESSAGE("Command list manager: created ", m_NumAllocators.load(), " allocators, released ", m_NumTrimmedAllocators.load(), " oversized allocators");
+}
+
+CommandListManager::AllocatorInfo CommandListManager::GetAllocatorInfo(ID3D12CommandAllocator* pAllocator)
+{
+    AllocatorInfo Info;
+
+    UINT DataSize = sizeof(Info);
+    if (FAILED(pAllocator->GetPrivateData(AllocatorInfoGUID, &DataSize, &Info)) || DataSize != sizeof(Info))
+    {
+        UNEXPECTED("Command allocator was not created by the command list manager");
+        Info = {};
+    }
+    return Info;
+}
+
+void CommandListManager::SetAllocatorInfo(ID3D12CommandAllocator* pAllocator, const AllocatorInfo& Info)
+{
+    auto hr = pAllocator->SetPrivateData(AllocatorInfoGUID, sizeof(Info), &Info);
+    DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to set command allocator private data");
+    (void)hr;
+}
+
+Uint32 CommandListManager::GetThreadPoolIndex()
+{
+    return static_cast<Uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id()) % NumThreadPools);
 }
 
 void CommandListManager::CreateNewCommandList(ID3D12GraphicsCommandList** List, ID3D12CommandAllocator** Allocator, Uint32& IfaceVersion)
@@ -54,6 +85,9 @@ void CommandListManager::CreateNewCommandList(ID3D12GraphicsCommandList** List,
 
     const IID CmdListIIDs[] =
         {
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+            __uuidof(ID3D12GraphicsCommandList7),
+#endif
 #ifdef D3D12_H_HAS_MESH_SHADER
             __uuidof(ID3D12GraphicsCommandList6),
             __uuidof(ID3D12GraphicsCommandList5),
@@ -81,47 +115,79 @@ void CommandListManager::CreateNewCommandList(ID3D12GraphicsCommandList** List,
 }
 
 
-void CommandListManager::RequestAllocator(ID3D12CommandAllocator** ppAllocator)
+bool CommandListManager::IsEnhancedBarriersSupported() const
 {
-    std::lock_guard<std::mutex> LockGuard{m_AllocatorMutex};
+    return m_DeviceD3D12Impl.IsEnhancedBarriersSupported();
+}
 
+void CommandListManager::RequestAllocator(ID3D12CommandAllocator** ppAllocator, Uint32 ExpectedNumCommands)
+{
     VERIFY((*ppAllocator) == nullptr, "Allocator pointer is not null");
     (*ppAllocator) = nullptr;
 
-    if (!m_FreeAllocators.empty())
+    const auto PoolIdx = GetThreadPoolIndex();
+    const auto Bucket  = GetSizeBucket(ExpectedNumCommands);
     {
-        *ppAllocator = m_FreeAllocators.back().Detach();
-        auto hr      = (*ppAllocator)->Reset();
-        DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to reset command allocator");
-        m_FreeAllocators.pop_back();
+        auto& Pool = m_Pools[PoolIdx];
+
+        std::lock_guard<std::mutex> LockGuard{Pool.Mtx};
+
+        auto TryBucket = [&](Uint32 b) {
+            auto& FreeAllocators = Pool.FreeAllocators[b];
+            if (FreeAllocators.empty())
+                return false;
+
+            *ppAllocator = FreeAllocators.back().Detach();
+            FreeAllocators.pop_back();
+            return true;
+        };
+
+        // Prefer allocators of the expected size. Smaller allocators will grow as needed, while
+        // allocators from much larger buckets would waste their memory on a small command list.
+        bool Found = TryBucket(Bucket);
+        for (Uint32 b = Bucket; b > 0 && !Found; --b)
+            Found = TryBucket(b - 1);
+        if (!Found && Bucket + 1 < NumSizeBuckets)
+            Found = TryBucket(Bucket + 1);
     }
 
-    // If no allocators were ready to be reused, create a new one
-    if ((*ppAllocator) == nullptr)
+    if ((*ppAllocator) != nullptr)
+    {
+        auto hr = (*ppAllocator)->Reset();
+        DEV_CHECK_ERR(SUCCEEDED(hr), "Failed to reset command allocator");
+    }
+    else
     {
+        // If no allocators were ready to be reused, create a new one
         auto* pd3d12Device = m_DeviceD3D12Impl.GetD3D12Device();
         auto  hr           = pd3d12Device->CreateCommandAllocator(m_CmdListType, __uuidof(*ppAllocator), reinterpret_cast<void**>(ppAllocator));
         VERIFY(SUCCEEDED(hr), "Failed to create command allocator");
         wchar_t AllocatorName[32];
         swprintf(AllocatorName, _countof(AllocatorName), L"Cmd list allocator %ld", m_NumAllocators.fetch_add(1));
         (*ppAllocator)->SetName(AllocatorName);
+
+        AllocatorInfo Info;
+        Info.PoolIndex = PoolIdx;
+        SetAllocatorInfo(*ppAllocator, Info);
     }
 #ifdef DILIGENT_DEVELOPMENT
     m_AllocatorCounter.fetch_add(1);
 #endif
 }
 
-void CommandListManager::ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
+void CommandListManager::ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, Uint32 NumRecordedCommands, SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
 {
     struct StaleAllocator
     {
         CComPtr<ID3D12CommandAllocator> Allocator;
         CommandListManager*             Mgr;
+        Uint32                          NumCommands;
 
         // clang-format off
-        StaleAllocator(CComPtr<ID3D12CommandAllocator>&& _Allocator, CommandListManager& _Mgr)noexcept :
-            Allocator {std::move(_Allocator)},
-            Mgr       {&_Mgr                }
+        StaleAllocator(CComPtr<ID3D12CommandAllocator>&& _Allocator, CommandListManager& _Mgr, Uint32 _NumCommands)noexcept :
+            Allocator  {std::move(_Allocator)},
+            Mgr        {&_Mgr                },
+            NumCommands{_NumCommands         }
         {
         }
 
@@ -130,8 +196,9 @@ void CommandListManager::ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allo
         StaleAllocator& operator= (      StaleAllocator&&) = delete;
 
         StaleAllocator(StaleAllocator&& rhs)noexcept :
-            Allocator {std::move(rhs.Allocator)},
-            Mgr       {rhs.Mgr                 }
+            Allocator  {std::move(rhs.Allocator)},
+            Mgr        {rhs.Mgr                 },
+            NumCommands{rhs.NumCommands         }
         {
             rhs.Mgr       = nullptr;
         }
@@ -140,16 +207,52 @@ void CommandListManager::ReleaseAllocator(CComPtr<ID3D12CommandAllocator>&& Allo
         ~StaleAllocator()
         {
             if (Mgr != nullptr)
-                Mgr->FreeAllocator(std::move(Allocator));
+                Mgr->FreeAllocator(std::move(Allocator), NumCommands);
         }
     };
-    m_DeviceD3D12Impl.GetReleaseQueue(CmdQueue).DiscardResource(StaleAllocator{std::move(Allocator), *this}, FenceValue);
+    m_DeviceD3D12Impl.GetReleaseQueue(CmdQueue).DiscardResource(StaleAllocator{std::move(Allocator), *this, NumRecordedCommands}, FenceValue);
 }
 
-void CommandListManager::FreeAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator)
+void CommandListManager::FreeAllocator(CComPtr<ID3D12CommandAllocator>&& Allocator, Uint32 NumRecordedCommands)
 {
-    std::lock_guard<std::mutex> LockGuard(m_AllocatorMutex);
-    m_FreeAllocators.emplace_back(std::move(Allocator));
+    auto Info = GetAllocatorInfo(Allocator);
+
+    const auto UsedBucket = GetSizeBucket(NumRecordedCommands);
+
+    Info.HighWaterMark    = std::max(Info.HighWaterMark, NumRecordedCommands);
+    const auto SizeBucket = GetSizeBucket(Info.HighWaterMark);
+
+    // The allocator keeps the memory of the largest command list ever recorded with it.
+    // If it keeps being used for smaller lists, release it so that its memory is returned to the system.
+    Info.NumOversizedUses = UsedBucket < SizeBucket ? Info.NumOversizedUses + 1 : 0;
+
+    bool Release = Info.NumOversizedUses >= MaxOversizedUses;
+    if (!Release)
+    {
+        VERIFY_EXPR(Info.PoolIndex < NumThreadPools);
+        auto& Pool = m_Pools[Info.PoolIndex];
+
+        std::lock_guard<std::mutex> LockGuard{Pool.Mtx};
+
+        auto& FreeAllocators = Pool.FreeAllocators[SizeBucket];
+        if (SizeBucket == NumSizeBuckets - 1 && FreeAllocators.size() >= MaxFreeLargeAllocators)
+        {
+            // Do not keep too many large allocators that are only used occasionally (e.g. for bulk uploads)
+            Release = true;
+        }
+        else
+        {
+            SetAllocatorInfo(Allocator, Info);
+            FreeAllocators.emplace_back(std::move(Allocator));
+        }
+    }
+
+    if (Release)
+    {
+        m_NumTrimmedAllocators.fetch_add(1);
+        Allocator.Release();
+    }
+
 #ifdef DILIGENT_DEVELOPMENT
     m_AllocatorCounter.fetch_add(-1);
 #endif
@@ -33,6 +33,7 @@
 
 #include "CommandQueueD3D12Impl.hpp"
 #include "NVApiLoader.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -61,6 +62,8 @@ CommandQueueD3D12Impl::~CommandQueueD3D12Impl()
 Uint64 CommandQueueD3D12Impl::Submit(Uint32                    NumCommandLists,
                                      ID3D12CommandList* const* ppCommandLists)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     std::lock_guard<std::mutex> Lock{m_QueueMtx};
 
     // Increment the value before submitting the list
@@ -32,7 +32,7 @@
 namespace Diligent
 {
 
-D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size)
+D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size, D3D12_HEAP_TYPE HeapType)
 {
     D3D12_HEAP_PROPERTIES HeapProps;
     HeapProps.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
@@ -52,7 +52,7 @@ D3D12DynamicPage::D3D12DynamicPage(ID3D12Device* pd3d12Device, Uint64 Size)
     ResourceDesc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 
     D3D12_RESOURCE_STATES DefaultUsage = D3D12_RESOURCE_STATE_GENERIC_READ;
-    HeapProps.Type                     = D3D12_HEAP_TYPE_UPLOAD;
+    HeapProps.Type                     = HeapType;
     ResourceDesc.Flags                 = D3D12_RESOURCE_FLAG_NONE;
     DefaultUsage                       = D3D12_RESOURCE_STATE_GENERIC_READ;
     ResourceDesc.Width                 = Size;
@@ -80,34 +80,194 @@ D3D12DynamicMemoryManager::D3D12DynamicMemoryManager(IMemoryAllocator&      Allo
                                                      Uint32                 NumPagesToReserve,
                                                      Uint64                 PageSize) :
     m_DeviceD3D12Impl{DeviceD3D12Impl},
-    m_AvailablePages(STD_ALLOCATOR_RAW_MEM(AvailablePagesMapElemType, Allocator, "Allocator for multimap<AvailablePagesMapElemType>"))
+    m_PageSize{PageSize},
+#ifdef D3D12_H_HAS_GPU_UPLOAD_HEAP
+    m_PageHeapType{DeviceD3D12Impl.IsGPUUploadHeapSupported() ? D3D12_HEAP_TYPE_GPU_UPLOAD : D3D12_HEAP_TYPE_UPLOAD},
+#else
+    m_PageHeapType{D3D12_HEAP_TYPE_UPLOAD},
+#endif
+    m_OtherPages(STD_ALLOCATOR_RAW_MEM(D3D12DynamicPage, Allocator, "Allocator for vector<D3D12DynamicPage>"))
 {
+    VERIFY_EXPR(m_PageSize > 0);
+    for (auto& Head : m_FreePages)
+        Head.store(PackFreeListHead(0, InvalidNode));
+    for (auto& pChunk : m_NodeChunks)
+        pChunk.store(nullptr);
+
     for (Uint32 i = 0; i < NumPagesToReserve; ++i)
     {
-        D3D12DynamicPage Page(m_DeviceD3D12Impl.GetD3D12Device(), PageSize);
-        auto             Size = Page.GetSize();
-        m_AvailablePages.emplace(Size, std::move(Page));
+        D3D12DynamicPage Page(m_DeviceD3D12Impl.GetD3D12Device(), PageSize, m_PageHeapType);
+        if (Page.IsValid())
+            FreePage(std::move(Page));
+    }
+}
+
+Uint32 D3D12DynamicMemoryManager::GetSizeClass(Uint64 Size) const
+{
+    for (Uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+    {
+        const auto ClassSize = m_PageSize << SizeClass;
+        if (ClassSize == Size)
+            return SizeClass;
+        if (ClassSize > Size)
+            break;
+    }
+    return NumSizeClasses;
+}
+
+D3D12DynamicMemoryManager::PageNode& D3D12DynamicMemoryManager::GetNode(Uint32 NodeIdx) const
+{
+    // Chunks are published before their nodes are added to any list and are never released
+    // while the manager is alive, so it is safe to access them without the lock.
+    auto* pChunk = m_NodeChunks[NodeIdx >> NodeChunkSizeLog2].load(std::memory_order_acquire);
+    VERIFY_EXPR(pChunk != nullptr);
+    return pChunk[NodeIdx & (NodeChunkSize - 1)];
+}
+
+Uint32 D3D12DynamicMemoryManager::PopNode(std::atomic<Uint64>& Head)
+{
+    auto OldHead = Head.load(std::memory_order_acquire);
+    for (;;)
+    {
+        const auto NodeIdx = static_cast<Uint32>(OldHead & 0xFFFFFFFFu);
+        if (NodeIdx == InvalidNode)
+            return InvalidNode;
+
+        // The node may be concurrently popped by another thread, in which case the value
+        // we read is stale, but the tag will make the compare-exchange below fail.
+        const auto NextIdx = GetNode(NodeIdx).Next.load(std::memory_order_relaxed);
+        const auto Tag     = static_cast<Uint32>(OldHead >> 32u);
+        if (Head.compare_exchange_weak(OldHead, PackFreeListHead(Tag + 1, NextIdx), std::memory_order_acquire, std::memory_order_acquire))
+            return NodeIdx;
+    }
+}
+
+void D3D12DynamicMemoryManager::PushNode(std::atomic<Uint64>& Head, Uint32 NodeIdx)
+{
+    auto& Node    = GetNode(NodeIdx);
+    auto  OldHead = Head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Node.Next.store(static_cast<Uint32>(OldHead & 0xFFFFFFFFu), std::memory_order_relaxed);
+        const auto Tag = static_cast<Uint32>(OldHead >> 32u);
+        if (Head.compare_exchange_weak(OldHead, PackFreeListHead(Tag + 1, NodeIdx), std::memory_order_release, std::memory_order_relaxed))
+            return;
     }
 }
 
-D3D12DynamicPage D3D12DynamicMemoryManager::AllocatePage(Uint64 SizeInBytes)
+Uint32 D3D12DynamicMemoryManager::AllocateNode()
+{
+    auto NodeIdx = PopNode(m_FreeNodes);
+    if (NodeIdx != InvalidNode)
+        return NodeIdx;
+
+    std::lock_guard<std::mutex> Lock{m_NodeChunksMtx};
+
+    // Other thread may have added a new chunk while we were waiting for the lock
+    NodeIdx = PopNode(m_FreeNodes);
+    if (NodeIdx != InvalidNode)
+        return NodeIdx;
+
+    const auto ChunkIdx = m_NumNodeChunks.load();
+    if (ChunkIdx >= MaxNodeChunks)
+        return InvalidNode;
+
+    m_NodeChunkStorage[ChunkIdx].reset(new PageNode[NodeChunkSize]);
+    m_NodeChunks[ChunkIdx].store(m_NodeChunkStorage[ChunkIdx].get(), std::memory_order_release);
+    m_NumNodeChunks.store(ChunkIdx + 1);
+
+    // Keep the first node and add the remaining ones to the free list
+    const auto FirstNode = ChunkIdx << NodeChunkSizeLog2;
+    for (Uint32 i = 1; i < NodeChunkSize; ++i)
+        PushNode(m_FreeNodes, FirstNode + i);
+
+    return FirstNode;
+}
+
+bool D3D12DynamicMemoryManager::FreePage(D3D12DynamicPage&& Page)
+{
+    VERIFY_EXPR(Page.IsValid());
+    const auto SizeClass = GetSizeClass(Page.GetSize());
+    if (SizeClass >= NumSizeClasses)
+    {
+        std::lock_guard<std::mutex> Lock{m_OtherPagesMtx};
+        m_OtherPages.emplace_back(std::move(Page));
+        return true;
+    }
+
+    const auto NodeIdx = AllocateNode();
+    if (NodeIdx == InvalidNode)
+        return false;
+
+    GetNode(NodeIdx).Page = std::move(Page);
+    PushNode(m_FreePages[SizeClass], NodeIdx);
+    return true;
+}
+
+D3D12DynamicPage D3D12DynamicMemoryManager::PopPage(Uint32 SizeClass)
+{
+    VERIFY_EXPR(SizeClass < NumSizeClasses);
+    const auto NodeIdx = PopNode(m_FreePages[SizeClass]);
+    if (NodeIdx == InvalidNode)
+        return {};
+
+    auto&            Node = GetNode(NodeIdx);
+    D3D12DynamicPage Page{std::move(Node.Page)};
+    PushNode(m_FreeNodes, NodeIdx);
+    return Page;
+}
+
+D3D12DynamicPage D3D12DynamicMemoryManager::AllocatePage(Uint64 SizeInBytes, bool* pIsRecycled)
 {
-    std::lock_guard<std::mutex> AvailablePagesLock{m_AvailablePagesMtx};
 #ifdef DILIGENT_DEVELOPMENT
     ++m_AllocatedPageCounter;
 #endif
-    auto PageIt = m_AvailablePages.lower_bound(SizeInBytes); // Returns an iterator pointing to the first element that is not less than key
-    if (PageIt != m_AvailablePages.end())
+    m_NumPagesRequested.fetch_add(1);
+
+    // Find the smallest size class that can hold the requested size and take
+    // the page from this class or, if there are no free pages, from larger classes.
+    Uint32 SizeClass = 0;
+    while (SizeClass < NumSizeClasses && (m_PageSize << SizeClass) < SizeInBytes)
+        ++SizeClass;
+
+    for (; SizeClass < NumSizeClasses; ++SizeClass)
     {
-        VERIFY_EXPR(PageIt->first >= SizeInBytes);
-        D3D12DynamicPage Page(std::move(PageIt->second));
-        m_AvailablePages.erase(PageIt);
-        return Page;
+        auto Page = PopPage(SizeClass);
+        if (Page.IsValid())
+        {
+            VERIFY_EXPR(Page.GetSize() >= SizeInBytes);
+            m_NumPagesRecycled.fetch_add(1);
+            if (pIsRecycled != nullptr)
+                *pIsRecycled = true;
+            return Page;
+        }
     }
-    else
+
     {
-        return D3D12DynamicPage{m_DeviceD3D12Impl.GetD3D12Device(), SizeInBytes};
+        std::lock_guard<std::mutex> Lock{m_OtherPagesMtx};
+
+        auto BestIt = m_OtherPages.end();
+        for (auto it = m_OtherPages.begin(); it != m_OtherPages.end(); ++it)
+        {
+            const auto Size = it->GetSize();
+            if (Size >= SizeInBytes && (BestIt == m_OtherPages.end() || Size < BestIt->GetSize()))
+                BestIt = it;
+        }
+        if (BestIt != m_OtherPages.end())
+        {
+            D3D12DynamicPage Page{std::move(*BestIt)};
+            m_OtherPages.erase(BestIt);
+            m_NumPagesRecycled.fetch_add(1);
+            if (pIsRecycled != nullptr)
+                *pIsRecycled = true;
+            return Page;
+        }
     }
+
+    m_NumPagesCreated.fetch_add(1);
+    if (pIsRecycled != nullptr)
+        *pIsRecycled = false;
+    return D3D12DynamicPage{m_DeviceD3D12Impl.GetD3D12Device(), SizeInBytes, m_PageHeapType};
 }
 
 void D3D12DynamicMemoryManager::ReleasePages(std::vector<D3D12DynamicPage>& Pages, Uint64 QueueMask)
@@ -140,12 +300,14 @@ void D3D12DynamicMemoryManager::ReleasePages(std::vector<D3D12DynamicPage>& Page
         {
             if (Mgr != nullptr)
             {
-                std::lock_guard<std::mutex> Lock{Mgr->m_AvailablePagesMtx};
 #ifdef DILIGENT_DEVELOPMENT
                 --Mgr->m_AllocatedPageCounter;
 #endif
-                auto PageSize = Page.GetSize();
-                Mgr->m_AvailablePages.emplace(PageSize, std::move(Page));
+                if (!Mgr->FreePage(std::move(Page)))
+                {
+                    // All nodes are in use - let the page be destroyed
+                    Mgr->m_NumPagesDiscarded.fetch_add(1);
+                }
             }
         }
     };
@@ -155,24 +317,58 @@ void D3D12DynamicMemoryManager::ReleasePages(std::vector<D3D12DynamicPage>& Page
     }
 }
 
+D3D12DynamicMemoryManager::Statistics D3D12DynamicMemoryManager::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumPagesRequested = m_NumPagesRequested.load();
+    Stats.NumPagesRecycled  = m_NumPagesRecycled.load();
+    Stats.NumPagesCreated   = m_NumPagesCreated.load();
+    Stats.NumPagesDiscarded = m_NumPagesDiscarded.load();
+    return Stats;
+}
+
 void D3D12DynamicMemoryManager::Destroy()
 {
     DEV_CHECK_ERR(m_AllocatedPageCounter == 0, m_AllocatedPageCounter, " page(s) have not been returned to the manager.");
     Uint64 TotalAllocatedSize = 0;
-    for (const auto& Page : m_AvailablePages)
-        TotalAllocatedSize += Page.second.GetSize();
+    Uint32 NumPages           = 0;
+    for (Uint32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+    {
+        for (auto Page = PopPage(SizeClass); Page.IsValid(); Page = PopPage(SizeClass))
+        {
+            TotalAllocatedSize += Page.GetSize();
+            ++NumPages;
+        }
+    }
+    for (const auto& Page : m_OtherPages)
+    {
+        TotalAllocatedSize += Page.GetSize();
+        ++NumPages;
+    }
 
+    const auto Stats = GetStatistics();
     LOG_INFO_MESSAGE("Dynamic memory manager usage stats:\n"
                      "                       Total allocated memory: ",
-                     FormatMemorySize(TotalAllocatedSize, 2));
+                     FormatMemorySize(TotalAllocatedSize, 2), " (", NumPages, (NumPages == 1 ? " page)" : " pages)"),
+                     "\n                       Pages requested/recycled/created: ",
+                     Stats.NumPagesRequested, " / ", Stats.NumPagesRecycled, " / ", Stats.NumPagesCreated,
+                     ". Discarded pages: ", Stats.NumPagesDiscarded);
+
+    m_OtherPages.clear();
 
-    m_AvailablePages.clear();
+    m_FreeNodes.store(PackFreeListHead(0, InvalidNode));
+    const auto NumNodeChunks = m_NumNodeChunks.exchange(0);
+    for (Uint32 i = 0; i < NumNodeChunks; ++i)
+    {
+        m_NodeChunks[i].store(nullptr);
+        m_NodeChunkStorage[i].reset();
+    }
 }
 
 D3D12DynamicMemoryManager::~D3D12DynamicMemoryManager()
 {
     DEV_CHECK_ERR(m_AllocatedPageCounter == 0, m_AllocatedPageCounter, " page(s) have not been released. If there are outstanding references to the pages in release queues, the app will crash when the page is returned to the manager.");
-    VERIFY(m_AvailablePages.empty(), "Not all pages are destroyed. Dynamic memory manager must be explicitly destroyed with Destroy() method");
+    VERIFY(m_NumNodeChunks.load() == 0 && m_OtherPages.empty(), "Not all pages are destroyed. Dynamic memory manager must be explicitly destroyed with Destroy() method");
 }
 
 
@@ -189,7 +385,10 @@ D3D12DynamicHeap::~D3D12DynamicHeap()
                      FormatMemorySize(m_PeakAllocatedSize, 2, m_PeakAllocatedSize),
                      " (", PeakAllocatedPages, (PeakAllocatedPages == 1 ? " page)" : " pages)"),
                      ". Peak efficiency (used/aligned): ", std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(m_PeakAlignedSize, Uint64{1})) * 100.0, '%',
-                     ". Peak utilization (used/allocated): ", std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(m_PeakAllocatedSize, Uint64{1})) * 100.0, '%');
+                     ". Peak utilization (used/allocated): ", std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(m_PeakAllocatedSize, Uint64{1})) * 100.0, '%',
+                     "\n                       Peak pages requested/created per frame: ", m_PeakPagesRequested, " / ", m_PeakPagesCreated,
+                     ". Total pages requested/recycled/created: ", m_TotalPagesRequested, " / ", m_TotalPagesRecycled, " / ", m_TotalPagesCreated,
+                     " in ", m_NumFrames, (m_NumFrames == 1 ? " frame" : " frames"));
 }
 
 D3D12DynamicAllocation D3D12DynamicHeap::Allocate(Uint64 SizeInBytes, Uint64 Alignment, Uint64 DvpCtxFrameNumber)
@@ -203,7 +402,14 @@ D3D12DynamicAllocation D3D12DynamicHeap::Allocate(Uint64 SizeInBytes, Uint64 Ali
         while (NewPageSize < SizeInBytes)
             NewPageSize *= 2;
 
-        auto NewPage = m_GlobalDynamicMemMgr.AllocatePage(NewPageSize);
+        bool IsRecycled = false;
+        auto NewPage    = m_GlobalDynamicMemMgr.AllocatePage(NewPageSize, &IsRecycled);
+        ++m_CurrPagesRequested;
+        if (IsRecycled)
+            ++m_CurrPagesRecycled;
+        else
+            ++m_CurrPagesCreated;
+
         if (NewPage.IsValid())
         {
             m_CurrOffset    = 0;
@@ -254,6 +460,19 @@ void D3D12DynamicHeap::ReleaseAllocatedPages(Uint64 QueueMask)
     m_GlobalDynamicMemMgr.ReleasePages(m_AllocatedPages, QueueMask);
     m_AllocatedPages.clear();
 
+    if (m_CurrPagesRequested > 0)
+    {
+        m_PeakPagesRequested = std::max(m_PeakPagesRequested, m_CurrPagesRequested);
+        m_PeakPagesCreated   = std::max(m_PeakPagesCreated, m_CurrPagesCreated);
+        m_TotalPagesRequested += m_CurrPagesRequested;
+        m_TotalPagesRecycled += m_CurrPagesRecycled;
+        m_TotalPagesCreated += m_CurrPagesCreated;
+    }
+    ++m_NumFrames;
+    m_CurrPagesRequested = 0;
+    m_CurrPagesRecycled  = 0;
+    m_CurrPagesCreated   = 0;
+
     m_CurrOffset        = InvalidOffset;
     m_AvailableSize     = 0;
     m_CurrAllocatedSize = 0;
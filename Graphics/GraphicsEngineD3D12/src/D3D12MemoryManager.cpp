@@ -0,0 +1,303 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "D3D12MemoryManager.hpp"
+
+#include "Align.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+D3D12MemoryAllocation::~D3D12MemoryAllocation()
+{
+    if (Page != nullptr)
+    {
+        Page->Free(std::move(*this));
+    }
+}
+
+D3D12MemoryPage::D3D12MemoryPage(D3D12MemoryManager& ParentMemoryMgr,
+                                 Uint64              PageSize,
+                                 D3D12_HEAP_TYPE     HeapType,
+                                 D3D12_HEAP_FLAGS    HeapFlags) :
+    // clang-format off
+    m_ParentMemoryMgr{ParentMemoryMgr},
+    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_HeapType       {HeapType}
+// clang-format on
+{
+    VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
+           "PageSize (", PageSize, ") exceeds maximum allowed value ",
+           std::numeric_limits<AllocationsMgrOffsetType>::max());
+
+    D3D12_HEAP_DESC HeapDesc{};
+    HeapDesc.SizeInBytes                     = PageSize;
+    HeapDesc.Properties.Type                 = HeapType;
+    HeapDesc.Properties.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    HeapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    HeapDesc.Properties.CreationNodeMask     = 1;
+    HeapDesc.Properties.VisibleNodeMask      = 1;
+    HeapDesc.Alignment                       = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    // Memory is reused by different resources, so there is no point in zeroing the heap
+    HeapDesc.Flags = HeapFlags | D3D12_HEAP_FLAG_CREATE_NOT_ZEROED;
+
+    auto hr = ParentMemoryMgr.m_pd3d12Device->CreateHeap(&HeapDesc, __uuidof(m_pd3d12Heap),
+                                                         reinterpret_cast<void**>(static_cast<ID3D12Heap**>(&m_pd3d12Heap)));
+    CHECK_D3D_RESULT_THROW(hr, "Failed to create D3D12 resource heap");
+
+    m_pd3d12Heap->SetName(L"Resource heap page");
+}
+
+D3D12MemoryPage::~D3D12MemoryPage()
+{
+    VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+}
+
+D3D12MemoryAllocation D3D12MemoryPage::Allocate(Uint64 Size, Uint64 Alignment)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    VERIFY(Size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
+           "Allocation size (", Size, ") exceeds maximum allowed value ",
+           std::numeric_limits<AllocationsMgrOffsetType>::max());
+    auto Allocation = m_AllocationMgr.Allocate(static_cast<AllocationsMgrOffsetType>(Size), static_cast<AllocationsMgrOffsetType>(Alignment));
+    if (Allocation.IsValid())
+    {
+        // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
+        // to accommodate requested alignment
+        VERIFY_EXPR(AlignUp(Uint64{Allocation.UnalignedOffset}, Alignment) - Allocation.UnalignedOffset + Size <= Allocation.Size);
+        return D3D12MemoryAllocation{this, Allocation.UnalignedOffset, Allocation.Size};
+    }
+    else
+    {
+        return D3D12MemoryAllocation{};
+    }
+}
+
+void D3D12MemoryPage::Free(D3D12MemoryAllocation&& Allocation)
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size);
+    Allocation = D3D12MemoryAllocation{};
+}
+
+
+D3D12MemoryManager::D3D12MemoryManager(ID3D12Device*     pd3d12Device,
+                                       IMemoryAllocator& Allocator,
+                                       Uint64            PageSize,
+                                       Uint64            ReserveSize,
+                                       Uint64            MaxPlacedResourceSize) :
+    // clang-format off
+    m_pd3d12Device         {pd3d12Device},
+    m_Allocator            {Allocator   },
+    m_PageSize             {AlignUp(PageSize, Uint64{D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT})},
+    m_ReserveSize          {ReserveSize },
+    m_MaxPlacedResourceSize{std::min(MaxPlacedResourceSize, m_PageSize)}
+// clang-format on
+{
+}
+
+D3D12MemoryManager::~D3D12MemoryManager()
+{
+    if (m_PageSize != 0)
+    {
+        auto PeakPages = m_PeakAllocatedSize / m_PageSize;
+        LOG_INFO_MESSAGE("D3D12MemoryManager stats: peak used/allocated memory size: ",
+                         FormatMemorySize(m_PeakUsedSize, 2, m_PeakAllocatedSize), " / ",
+                         FormatMemorySize(m_PeakAllocatedSize, 2, m_PeakAllocatedSize),
+                         " (", PeakPages, (PeakPages == 1 ? " page)" : " pages)"));
+    }
+
+    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
+        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    VERIFY(m_CurrUsedSize == 0, "Not all allocations have been released");
+}
+
+D3D12MemoryAllocation D3D12MemoryManager::CreatePlacedResource(D3D12_HEAP_TYPE          HeapType,
+                                                               D3D12_RESOURCE_DESC&     d3d12ResDesc,
+                                                               D3D12_RESOURCE_STATES    InitialState,
+                                                               const D3D12_CLEAR_VALUE* pClearValue,
+                                                               CComPtr<ID3D12Resource>& pd3d12Resource)
+{
+    VERIFY_EXPR(!pd3d12Resource);
+    if (!IsEnabled())
+        return {};
+
+    D3D12_HEAP_FLAGS HeapFlags = D3D12_HEAP_FLAG_NONE;
+    if (d3d12ResDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+    {
+        HeapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+    }
+    else
+    {
+        // Placed render targets and depth-stencil buffers must be initialized with a clear, discard or
+        // copy operation before they are used, which the engine can't guarantee. Multisampled textures
+        // require 4 MB alignment. Such resources are always committed.
+        if ((d3d12ResDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0 ||
+            d3d12ResDesc.SampleDesc.Count > 1 ||
+            HeapType != D3D12_HEAP_TYPE_DEFAULT)
+            return {};
+
+        HeapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+    }
+
+    const auto OrigAlignment = d3d12ResDesc.Alignment;
+
+    D3D12_RESOURCE_ALLOCATION_INFO AllocInfo{};
+    if (d3d12ResDesc.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER && OrigAlignment == 0)
+    {
+        // Small textures can use 4 KB alignment. If the texture is too large, the device
+        // returns the default 64 KB alignment and the size must be queried again.
+        d3d12ResDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+        AllocInfo              = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12ResDesc);
+        if (AllocInfo.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT)
+        {
+            d3d12ResDesc.Alignment = OrigAlignment;
+            AllocInfo              = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12ResDesc);
+        }
+    }
+    else
+    {
+        AllocInfo = m_pd3d12Device->GetResourceAllocationInfo(0, 1, &d3d12ResDesc);
+    }
+
+    // SizeInBytes is UINT64_MAX if the resource description is invalid
+    if (AllocInfo.SizeInBytes == ~Uint64{0} || AllocInfo.SizeInBytes > m_MaxPlacedResourceSize)
+    {
+        d3d12ResDesc.Alignment = OrigAlignment;
+        return {};
+    }
+
+    auto Allocation = Allocate(AllocInfo.SizeInBytes, AllocInfo.Alignment, HeapType, HeapFlags);
+    if (!Allocation)
+    {
+        d3d12ResDesc.Alignment = OrigAlignment;
+        return {};
+    }
+
+    const auto HeapOffset = AlignUp(Allocation.UnalignedOffset, Uint64{AllocInfo.Alignment});
+
+    auto hr = m_pd3d12Device->CreatePlacedResource(Allocation.Page->GetD3D12Heap(), HeapOffset, &d3d12ResDesc, InitialState, pClearValue,
+                                                   __uuidof(pd3d12Resource),
+                                                   reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&pd3d12Resource)));
+    if (FAILED(hr))
+    {
+        LOG_WARNING_MESSAGE("Failed to create placed resource. A committed resource will be created instead.");
+        d3d12ResDesc.Alignment = OrigAlignment;
+        // The memory has never been used by the GPU, so the allocation can be released immediately
+        return {};
+    }
+
+    return Allocation;
+}
+
+D3D12MemoryAllocation D3D12MemoryManager::Allocate(Uint64 Size, Uint64 Alignment, D3D12_HEAP_TYPE HeapType, D3D12_HEAP_FLAGS HeapFlags)
+{
+    D3D12MemoryAllocation Allocation;
+
+    MemoryPageIndex PageIdx{HeapType, HeapFlags};
+
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    auto range = m_Pages.equal_range(PageIdx);
+    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    {
+        Allocation = page_it->second.Allocate(Size, Alignment);
+        if (Allocation.Page != nullptr)
+            break;
+    }
+
+    if (Allocation.Page == nullptr)
+    {
+        auto PageSize = m_PageSize;
+        while (PageSize < Size)
+            PageSize *= 2;
+
+        auto it = m_Pages.emplace(PageIdx, D3D12MemoryPage{*this, PageSize, HeapType, HeapFlags});
+
+        m_CurrAllocatedSize += PageSize;
+        m_PeakAllocatedSize = std::max(m_PeakAllocatedSize, m_CurrAllocatedSize);
+        LOG_INFO_MESSAGE("D3D12MemoryManager: created new resource heap page (", FormatMemorySize(PageSize, 2),
+                         "). Current allocated size: ", FormatMemorySize(m_CurrAllocatedSize, 2));
+
+        Allocation = it->second.Allocate(Size, Alignment);
+        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate memory from a new resource heap page");
+    }
+
+    if (Allocation.Page != nullptr)
+    {
+        m_CurrUsedSize.fetch_add(static_cast<Int64>(Allocation.Size));
+        m_PeakUsedSize = std::max(m_PeakUsedSize, static_cast<Uint64>(m_CurrUsedSize.load()));
+    }
+
+    return Allocation;
+}
+
+void D3D12MemoryManager::ShrinkMemory()
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    if (m_CurrAllocatedSize <= m_ReserveSize)
+        return;
+
+    auto it = m_Pages.begin();
+    while (it != m_Pages.end() && m_CurrAllocatedSize > m_ReserveSize)
+    {
+        auto curr_it = it;
+        ++it;
+        auto& Page = curr_it->second;
+        if (!Page.IsEmpty())
+            continue;
+
+        auto PageSize = Page.GetPageSize();
+        m_CurrAllocatedSize -= PageSize;
+        LOG_INFO_MESSAGE("D3D12MemoryManager: destroying resource heap page (", FormatMemorySize(PageSize, 2),
+                         "). Current allocated size: ", FormatMemorySize(m_CurrAllocatedSize, 2));
+        m_Pages.erase(curr_it);
+    }
+}
+
+D3D12MemoryManager::Statistics D3D12MemoryManager::GetStatistics()
+{
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    Statistics Stats;
+    Stats.CurrUsedSize      = static_cast<Uint64>(m_CurrUsedSize.load());
+    Stats.PeakUsedSize      = m_PeakUsedSize;
+    Stats.CurrAllocatedSize = m_CurrAllocatedSize;
+    Stats.PeakAllocatedSize = m_PeakAllocatedSize;
+    Stats.NumPages          = static_cast<Uint32>(m_Pages.size());
+    return Stats;
+}
+
+void D3D12MemoryManager::OnFreeAllocation(Uint64 Size)
+{
+    m_CurrUsedSize.fetch_sub(static_cast<Int64>(Size));
+}
+
+} // namespace Diligent
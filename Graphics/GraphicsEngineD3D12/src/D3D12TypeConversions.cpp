@@ -479,6 +479,172 @@ D3D12_RESOURCE_STATES GetSupportedD3D12ResourceStatesForCommandList(D3D12_COMMAN
     }
 }
 
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+static D3D12_BARRIER_SYNC ResourceStateFlagToD3D12BarrierSync(RESOURCE_STATE StateFlag)
+{
+    static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
+    VERIFY(IsPowerOfTwo(StateFlag), "Only single bit must be set");
+    switch (StateFlag)
+    {
+        // clang-format off
+        case RESOURCE_STATE_UNDEFINED:         return D3D12_BARRIER_SYNC_NONE;
+        case RESOURCE_STATE_VERTEX_BUFFER:     return D3D12_BARRIER_SYNC_VERTEX_SHADING;
+        case RESOURCE_STATE_CONSTANT_BUFFER:   return D3D12_BARRIER_SYNC_ALL_SHADING;
+        case RESOURCE_STATE_INDEX_BUFFER:      return D3D12_BARRIER_SYNC_INDEX_INPUT;
+        case RESOURCE_STATE_RENDER_TARGET:     return D3D12_BARRIER_SYNC_RENDER_TARGET;
+        case RESOURCE_STATE_UNORDERED_ACCESS:  return D3D12_BARRIER_SYNC_ALL_SHADING;
+        case RESOURCE_STATE_DEPTH_WRITE:       return D3D12_BARRIER_SYNC_DEPTH_STENCIL;
+        case RESOURCE_STATE_DEPTH_READ:        return D3D12_BARRIER_SYNC_DEPTH_STENCIL;
+        case RESOURCE_STATE_SHADER_RESOURCE:   return D3D12_BARRIER_SYNC_ALL_SHADING;
+        case RESOURCE_STATE_STREAM_OUT:        return D3D12_BARRIER_SYNC_VERTEX_SHADING;
+        case RESOURCE_STATE_INDIRECT_ARGUMENT: return D3D12_BARRIER_SYNC_EXECUTE_INDIRECT;
+        case RESOURCE_STATE_COPY_DEST:         return D3D12_BARRIER_SYNC_COPY;
+        case RESOURCE_STATE_COPY_SOURCE:       return D3D12_BARRIER_SYNC_COPY;
+        case RESOURCE_STATE_RESOLVE_DEST:      return D3D12_BARRIER_SYNC_RESOLVE;
+        case RESOURCE_STATE_RESOLVE_SOURCE:    return D3D12_BARRIER_SYNC_RESOLVE;
+        case RESOURCE_STATE_INPUT_ATTACHMENT:  return D3D12_BARRIER_SYNC_PIXEL_SHADING;
+        case RESOURCE_STATE_PRESENT:           return D3D12_BARRIER_SYNC_ALL;
+        case RESOURCE_STATE_BUILD_AS_READ:     return D3D12_BARRIER_SYNC_BUILD_RAYTRACING_ACCELERATION_STRUCTURE | D3D12_BARRIER_SYNC_COPY_RAYTRACING_ACCELERATION_STRUCTURE;
+        case RESOURCE_STATE_BUILD_AS_WRITE:    return D3D12_BARRIER_SYNC_BUILD_RAYTRACING_ACCELERATION_STRUCTURE | D3D12_BARRIER_SYNC_COPY_RAYTRACING_ACCELERATION_STRUCTURE;
+        case RESOURCE_STATE_RAY_TRACING:       return D3D12_BARRIER_SYNC_RAYTRACING;
+        case RESOURCE_STATE_COMMON:            return D3D12_BARRIER_SYNC_ALL;
+        case RESOURCE_STATE_SHADING_RATE:      return D3D12_BARRIER_SYNC_PIXEL_SHADING;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected resource state flag");
+            return D3D12_BARRIER_SYNC_NONE;
+    }
+}
+
+static D3D12_BARRIER_ACCESS ResourceStateFlagToD3D12BarrierAccess(RESOURCE_STATE StateFlag)
+{
+    static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
+    VERIFY(IsPowerOfTwo(StateFlag), "Only single bit must be set");
+    switch (StateFlag)
+    {
+        // clang-format off
+        case RESOURCE_STATE_UNDEFINED:         return D3D12_BARRIER_ACCESS_NO_ACCESS;
+        case RESOURCE_STATE_VERTEX_BUFFER:     return D3D12_BARRIER_ACCESS_VERTEX_BUFFER;
+        case RESOURCE_STATE_CONSTANT_BUFFER:   return D3D12_BARRIER_ACCESS_CONSTANT_BUFFER;
+        case RESOURCE_STATE_INDEX_BUFFER:      return D3D12_BARRIER_ACCESS_INDEX_BUFFER;
+        case RESOURCE_STATE_RENDER_TARGET:     return D3D12_BARRIER_ACCESS_RENDER_TARGET;
+        case RESOURCE_STATE_UNORDERED_ACCESS:  return D3D12_BARRIER_ACCESS_UNORDERED_ACCESS;
+        case RESOURCE_STATE_DEPTH_WRITE:       return D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE;
+        case RESOURCE_STATE_DEPTH_READ:        return D3D12_BARRIER_ACCESS_DEPTH_STENCIL_READ;
+        case RESOURCE_STATE_SHADER_RESOURCE:   return D3D12_BARRIER_ACCESS_SHADER_RESOURCE;
+        case RESOURCE_STATE_STREAM_OUT:        return D3D12_BARRIER_ACCESS_STREAM_OUTPUT;
+        case RESOURCE_STATE_INDIRECT_ARGUMENT: return D3D12_BARRIER_ACCESS_INDIRECT_ARGUMENT;
+        case RESOURCE_STATE_COPY_DEST:         return D3D12_BARRIER_ACCESS_COPY_DEST;
+        case RESOURCE_STATE_COPY_SOURCE:       return D3D12_BARRIER_ACCESS_COPY_SOURCE;
+        case RESOURCE_STATE_RESOLVE_DEST:      return D3D12_BARRIER_ACCESS_RESOLVE_DEST;
+        case RESOURCE_STATE_RESOLVE_SOURCE:    return D3D12_BARRIER_ACCESS_RESOLVE_SOURCE;
+        case RESOURCE_STATE_INPUT_ATTACHMENT:  return D3D12_BARRIER_ACCESS_SHADER_RESOURCE;
+        case RESOURCE_STATE_PRESENT:           return D3D12_BARRIER_ACCESS_COMMON;
+        case RESOURCE_STATE_BUILD_AS_READ:     return D3D12_BARRIER_ACCESS_RAYTRACING_ACCELERATION_STRUCTURE_READ;
+        case RESOURCE_STATE_BUILD_AS_WRITE:    return D3D12_BARRIER_ACCESS_RAYTRACING_ACCELERATION_STRUCTURE_WRITE;
+        case RESOURCE_STATE_RAY_TRACING:       return D3D12_BARRIER_ACCESS_RAYTRACING_ACCELERATION_STRUCTURE_READ;
+        case RESOURCE_STATE_COMMON:            return D3D12_BARRIER_ACCESS_COMMON;
+        case RESOURCE_STATE_SHADING_RATE:      return D3D12_BARRIER_ACCESS_SHADING_RATE_SOURCE;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected resource state flag");
+            return D3D12_BARRIER_ACCESS_NO_ACCESS;
+    }
+}
+
+D3D12_BARRIER_SYNC ResourceStateFlagsToD3D12BarrierSync(RESOURCE_STATE StateFlags)
+{
+    VERIFY(StateFlags < (RESOURCE_STATE_MAX_BIT << 1), "Resource state flags are out of range");
+    D3D12_BARRIER_SYNC d3d12Sync = D3D12_BARRIER_SYNC_NONE;
+    Uint32             Bits      = StateFlags;
+    while (Bits != 0)
+    {
+        auto lsb = PlatformMisc::GetLSB(Bits);
+        d3d12Sync |= ResourceStateFlagToD3D12BarrierSync(static_cast<RESOURCE_STATE>(1u << lsb));
+        Bits &= ~(1u << lsb);
+    }
+    return d3d12Sync;
+}
+
+D3D12_BARRIER_ACCESS ResourceStateFlagsToD3D12BarrierAccess(RESOURCE_STATE StateFlags)
+{
+    VERIFY(StateFlags < (RESOURCE_STATE_MAX_BIT << 1), "Resource state flags are out of range");
+    // D3D12_BARRIER_ACCESS_NO_ACCESS must not be combined with any other access bits
+    if (StateFlags == RESOURCE_STATE_UNDEFINED)
+        return D3D12_BARRIER_ACCESS_NO_ACCESS;
+
+    D3D12_BARRIER_ACCESS d3d12Access = D3D12_BARRIER_ACCESS_COMMON;
+    Uint32               Bits        = StateFlags & ~RESOURCE_STATE_UNDEFINED;
+    while (Bits != 0)
+    {
+        auto lsb = PlatformMisc::GetLSB(Bits);
+        d3d12Access |= ResourceStateFlagToD3D12BarrierAccess(static_cast<RESOURCE_STATE>(1u << lsb));
+        Bits &= ~(1u << lsb);
+    }
+    return d3d12Access;
+}
+
+D3D12_BARRIER_LAYOUT ResourceStateFlagsToD3D12BarrierLayout(RESOURCE_STATE StateFlags)
+{
+    static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
+    if (!IsPowerOfTwo(StateFlags))
+    {
+        // Combination of read-only states. Depth-stencil read layout allows shader resource access,
+        // all other read-only combinations map to the generic read layout.
+        constexpr RESOURCE_STATE ReadOnlyStates =
+            RESOURCE_STATE_GENERIC_READ |
+            RESOURCE_STATE_DEPTH_READ |
+            RESOURCE_STATE_RESOLVE_SOURCE |
+            RESOURCE_STATE_INPUT_ATTACHMENT;
+        if ((StateFlags & ReadOnlyStates) != StateFlags)
+        {
+            UNEXPECTED("Combined resource states (", GetResourceStateString(StateFlags), ") must only contain read-only states");
+            return D3D12_BARRIER_LAYOUT_COMMON;
+        }
+
+        if ((StateFlags & RESOURCE_STATE_DEPTH_READ) != 0 && (StateFlags & ~(RESOURCE_STATE_DEPTH_READ | RESOURCE_STATE_SHADER_RESOURCE)) == 0)
+            return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ;
+
+        return D3D12_BARRIER_LAYOUT_GENERIC_READ;
+    }
+
+    switch (StateFlags)
+    {
+        // clang-format off
+        case RESOURCE_STATE_UNDEFINED:         return D3D12_BARRIER_LAYOUT_UNDEFINED;
+        case RESOURCE_STATE_RENDER_TARGET:     return D3D12_BARRIER_LAYOUT_RENDER_TARGET;
+        case RESOURCE_STATE_UNORDERED_ACCESS:  return D3D12_BARRIER_LAYOUT_UNORDERED_ACCESS;
+        case RESOURCE_STATE_DEPTH_WRITE:       return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_WRITE;
+        case RESOURCE_STATE_DEPTH_READ:        return D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ;
+        case RESOURCE_STATE_SHADER_RESOURCE:   return D3D12_BARRIER_LAYOUT_SHADER_RESOURCE;
+        case RESOURCE_STATE_COPY_DEST:         return D3D12_BARRIER_LAYOUT_COPY_DEST;
+        case RESOURCE_STATE_COPY_SOURCE:       return D3D12_BARRIER_LAYOUT_COPY_SOURCE;
+        case RESOURCE_STATE_RESOLVE_DEST:      return D3D12_BARRIER_LAYOUT_RESOLVE_DEST;
+        case RESOURCE_STATE_RESOLVE_SOURCE:    return D3D12_BARRIER_LAYOUT_RESOLVE_SOURCE;
+        case RESOURCE_STATE_INPUT_ATTACHMENT:  return D3D12_BARRIER_LAYOUT_SHADER_RESOURCE;
+        case RESOURCE_STATE_PRESENT:           return D3D12_BARRIER_LAYOUT_PRESENT;
+        case RESOURCE_STATE_COMMON:            return D3D12_BARRIER_LAYOUT_COMMON;
+        case RESOURCE_STATE_SHADING_RATE:      return D3D12_BARRIER_LAYOUT_SHADING_RATE_SOURCE;
+        // clang-format on
+
+        case RESOURCE_STATE_VERTEX_BUFFER:
+        case RESOURCE_STATE_CONSTANT_BUFFER:
+        case RESOURCE_STATE_INDEX_BUFFER:
+        case RESOURCE_STATE_STREAM_OUT:
+        case RESOURCE_STATE_INDIRECT_ARGUMENT:
+        case RESOURCE_STATE_BUILD_AS_READ:
+        case RESOURCE_STATE_BUILD_AS_WRITE:
+        case RESOURCE_STATE_RAY_TRACING:
+            UNEXPECTED("Resource state ", GetResourceStateString(StateFlags), " is not a valid texture state");
+            return D3D12_BARRIER_LAYOUT_COMMON;
+
+        default:
+            UNEXPECTED("Unexpected resource state flag");
+            return D3D12_BARRIER_LAYOUT_COMMON;
+    }
+}
+#endif
+
 static RESOURCE_STATE D3D12ResourceStateToResourceStateFlags(D3D12_RESOURCE_STATES state)
 {
     static_assert(RESOURCE_STATE_MAX_BIT == (1u << 21), "This function must be updated to handle new resource state flag");
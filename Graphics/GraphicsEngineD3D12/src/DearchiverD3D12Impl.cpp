@@ -34,7 +34,7 @@ namespace Diligent
 {
 
 DearchiverD3D12Impl::DearchiverD3D12Impl(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
-    TDearchiverBase{pRefCounters, CI}
+    TDearchiverBase{pRefCounters, CI, DeviceType::Direct3D12}
 {
 }
 
@@ -43,4 +43,31 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverD3D12Impl::UnpackResourceSig
     return DearchiverBase::UnpackResourceSignatureImpl<RenderDeviceD3D12Impl, PRSSerializerD3D12<SerializerMode::Read>>(DeArchiveInfo, IsImplicit);
 }
 
+bool DearchiverD3D12Impl::UnpackPSODeviceData(const SerializedData& Data, IRenderDevice* pDevice)
+{
+    SerializedRootSignatureD3D12 RootSig;
+
+    Serializer<SerializerMode::Read> Ser{Data};
+    if (!RootSignatureSerializerD3D12<SerializerMode::Read>::Serialize(Ser, RootSig))
+    {
+        LOG_ERROR_MESSAGE("Failed to deserialize root signature. Archive file may be corrupted or invalid.");
+        return false;
+    }
+    VERIFY(Ser.IsEnded(), "No other data besides the root signature is expected");
+
+    // Make the serialized root signature available to the cache so that the pipeline
+    // that is about to be created does not need to serialize the root signature again.
+    // If the signatures are modified by the application, the hash will not match and the
+    // root signature will be serialized as usual.
+    if (RootSig.pData != nullptr && RootSig.DataSize > 0)
+    {
+        auto* pDeviceD3D12 = ClassPtrCast<RenderDeviceD3D12Impl>(pDevice);
+        pDeviceD3D12->GetRootSignatureCache().AddSerializedRootSig(static_cast<size_t>(RootSig.Hash),
+                                                                   static_cast<D3D12_ROOT_SIGNATURE_FLAGS>(RootSig.Flags),
+                                                                   RootSig.pData, RootSig.DataSize);
+    }
+
+    return true;
+}
+
 } // namespace Diligent
@@ -233,6 +233,12 @@ DescriptorHeapAllocation DescriptorHeapAllocationManager::Allocate(uint32_t Coun
     return DescriptorHeapAllocation{m_ParentAllocator, m_pd3d12DescriptorHeap, CPUHandle, GPUHandle, Count, static_cast<Uint16>(m_ThisManagerId)};
 }
 
+Uint32 DescriptorHeapAllocationManager::GetNumAllocatedDescriptors()
+{
+    std::lock_guard<std::mutex> LockGuard{m_FreeBlockManagerMutex};
+    return m_NumDescriptorsInAllocation - static_cast<Uint32>(m_FreeBlockManager.GetFreeSize());
+}
+
 void DescriptorHeapAllocationManager::FreeAllocation(DescriptorHeapAllocation&& Allocation)
 {
     VERIFY(Allocation.GetAllocationManagerId() == m_ThisManagerId, "Invalid descriptor heap manager Id");
@@ -277,6 +283,9 @@ CPUDescriptorHeap::CPUDescriptorHeap(IMemoryAllocator&           Allocator,
     m_DescriptorSize{DeviceD3D12Impl.GetD3D12Device()->GetDescriptorHandleIncrementSize(Type)}
 // clang-format on
 {
+    for (auto& pSlab : m_Slabs)
+        pSlab.store(nullptr);
+
     // Create one pool
     m_HeapPool.emplace_back(m_MemAllocator, m_DeviceD3D12Impl, *this, 0, m_HeapDesc);
     m_AvailableHeaps.insert(0);
@@ -284,6 +293,19 @@ CPUDescriptorHeap::CPUDescriptorHeap(IMemoryAllocator&           Allocator,
 
 CPUDescriptorHeap::~CPUDescriptorHeap()
 {
+#ifdef DILIGENT_DEVELOPMENT
+    DEV_CHECK_ERR(m_DvpSlabAllocationsCounter == 0, m_DvpSlabAllocationsCounter, " slab allocations have not been released");
+#endif
+
+    // Return slab ranges to the pool managers
+    const auto SlabCount = m_SlabCount.load();
+    for (Uint32 i = 0; i < SlabCount; ++i)
+    {
+        FreeAllocation(std::move(m_SlabStorage[i]->Range));
+        m_Slabs[i].store(nullptr);
+        m_SlabStorage[i].reset();
+    }
+
     DEV_CHECK_ERR(m_CurrentSize == 0, "Not all allocations released");
 
     DEV_CHECK_ERR(m_AvailableHeaps.size() == m_HeapPool.size(), "Not all descriptor heap pools are released");
@@ -296,7 +318,9 @@ CPUDescriptorHeap::~CPUDescriptorHeap()
 
     LOG_INFO_MESSAGE(std::setw(38), std::left, GetD3D12DescriptorHeapTypeLiteralName(m_HeapDesc.Type), " CPU heap allocated pool count: ", m_HeapPool.size(),
                      ". Max descriptors: ", m_MaxSize, '/', TotalDescriptors,
-                     " (", std::fixed, std::setprecision(2), m_MaxSize * 100.0 / std::max(TotalDescriptors, 1u), "%).");
+                     " (", std::fixed, std::setprecision(2), m_MaxSize * 100.0 / std::max(TotalDescriptors, 1u), "%).",
+                     " Fast path allocations: ", m_FastPathAllocations.load(), '/', m_FastPathAllocations.load() + m_SlowPathAllocations.load(),
+                     ", slab count: ", SlabCount, '.');
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -307,11 +331,126 @@ int32_t CPUDescriptorHeap::DvpGetTotalAllocationCount()
     std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
     for (auto& Heap : m_HeapPool)
         AllocationCount += Heap.DvpGetAllocationsCounter();
+
+    // Slab ranges are owned by the heap itself and are released by the destructor.
+    // Count live allocations in the slabs instead.
+    AllocationCount -= static_cast<int32_t>(m_SlabCount.load());
+    AllocationCount += m_DvpSlabAllocationsCounter.load();
     return AllocationCount;
 }
 #endif
 
+CPUDescriptorHeap::Statistics CPUDescriptorHeap::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.FastPathAllocations = m_FastPathAllocations.load();
+    Stats.SlowPathAllocations = m_SlowPathAllocations.load();
+    Stats.SlabCount           = m_SlabCount.load();
+    return Stats;
+}
+
 DescriptorHeapAllocation CPUDescriptorHeap::Allocate(uint32_t Count)
+{
+    if (Count == 1)
+    {
+        auto Allocation = AllocateFromSlab();
+        if (!Allocation.IsNull())
+        {
+            m_FastPathAllocations.fetch_add(1, std::memory_order_relaxed);
+            return Allocation;
+        }
+    }
+
+    m_SlowPathAllocations.fetch_add(1, std::memory_order_relaxed);
+    return AllocateFromPool(Count);
+}
+
+DescriptorHeapAllocation CPUDescriptorHeap::AllocateFromSlab()
+{
+    auto Head = m_FreeSlotsHead.load(std::memory_order_acquire);
+    while (true)
+    {
+        const auto Slot = static_cast<Uint32>(Head & 0xFFFFFFFFu);
+        if (Slot == InvalidSlot)
+        {
+            // The free list is empty - create a new slab and try again
+            if (!CreateSlab())
+                return DescriptorHeapAllocation{};
+
+            Head = m_FreeSlotsHead.load(std::memory_order_acquire);
+            continue;
+        }
+
+        // Slabs are published before their slots are added to the free list and are never released
+        // while the heap is alive, so the pointer is always valid here.
+        const auto* pSlab = m_Slabs[Slot >> SlabSizeLog2].load(std::memory_order_acquire);
+        VERIFY_EXPR(pSlab != nullptr);
+        const auto SlotOffset = Slot & (SlabSize - 1);
+
+        // The value may be stale if another thread pops this slot concurrently, but in this
+        // case the tag will have changed and the compare-exchange below will fail.
+        const auto NextSlot = pSlab->NextFree[SlotOffset].load(std::memory_order_relaxed);
+        const auto Tag      = static_cast<Uint32>(Head >> 32u);
+        if (m_FreeSlotsHead.compare_exchange_weak(Head, PackFreeListHead(Tag + 1, NextSlot), std::memory_order_acquire, std::memory_order_acquire))
+        {
+#ifdef DILIGENT_DEVELOPMENT
+            m_DvpSlabAllocationsCounter.fetch_add(1);
+#endif
+            const auto& Range     = pSlab->Range;
+            auto        GPUHandle = Range.GetGpuHandle();
+            if (GPUHandle.ptr != 0)
+                GPUHandle = Range.GetGpuHandle(SlotOffset);
+            return DescriptorHeapAllocation{*this, Range.GetDescriptorHeap(), Range.GetCpuHandle(SlotOffset), GPUHandle, 1, static_cast<Uint16>(SlabIdBase + (Slot >> SlabSizeLog2))};
+        }
+    }
+}
+
+bool CPUDescriptorHeap::CreateSlab()
+{
+    std::lock_guard<std::mutex> LockGuard(m_SlabMutex);
+
+    // Another thread may have created a new slab or released a slot while we were waiting for the mutex
+    if (static_cast<Uint32>(m_FreeSlotsHead.load(std::memory_order_acquire) & 0xFFFFFFFFu) != InvalidSlot)
+        return true;
+
+    const auto SlabIdx = m_SlabCount.load();
+    if (SlabIdx >= MaxSlabs)
+        return false;
+
+    auto Range = AllocateFromPool(SlabSize);
+    if (Range.IsNull())
+        return false;
+
+    std::unique_ptr<Slab> pSlab{new Slab{}};
+    pSlab->Range = std::move(Range);
+
+    // Link all slots of the new slab together
+    const auto FirstSlot = SlabIdx << SlabSizeLog2;
+    for (Uint32 i = 0; i < SlabSize; ++i)
+        pSlab->NextFree[i].store(i + 1 < SlabSize ? FirstSlot + i + 1 : InvalidSlot, std::memory_order_relaxed);
+
+    m_Slabs[SlabIdx].store(pSlab.get(), std::memory_order_release);
+    m_SlabStorage[SlabIdx] = std::move(pSlab);
+    m_SlabCount.store(SlabIdx + 1);
+
+    PushFreeSlots(FirstSlot, FirstSlot + SlabSize - 1);
+    return true;
+}
+
+void CPUDescriptorHeap::PushFreeSlots(Uint32 FirstSlot, Uint32 LastSlot)
+{
+    auto* pLastSlab = m_Slabs[LastSlot >> SlabSizeLog2].load(std::memory_order_acquire);
+    VERIFY_EXPR(pLastSlab != nullptr);
+    auto& LastSlotNext = pLastSlab->NextFree[LastSlot & (SlabSize - 1)];
+
+    auto Head = m_FreeSlotsHead.load(std::memory_order_relaxed);
+    do
+    {
+        LastSlotNext.store(static_cast<Uint32>(Head & 0xFFFFFFFFu), std::memory_order_relaxed);
+    } while (!m_FreeSlotsHead.compare_exchange_weak(Head, PackFreeListHead(static_cast<Uint32>(Head >> 32u) + 1, FirstSlot), std::memory_order_release, std::memory_order_relaxed));
+}
+
+DescriptorHeapAllocation CPUDescriptorHeap::AllocateFromPool(Uint32 Count)
 {
     std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
     // Note that every DescriptorHeapAllocationManager object instance is itself
@@ -349,6 +488,7 @@ DescriptorHeapAllocation CPUDescriptorHeap::Allocate(uint32_t Count)
         m_HeapDesc.NumDescriptors = std::max(m_HeapDesc.NumDescriptors, static_cast<UINT>(Count));
         // Create a new descriptor heap manager. Note that this constructor creates a new D3D12 descriptor
         // heap and references the entire heap. Pool index is used as manager ID
+        VERIFY(m_HeapPool.size() < SlabIdBase, "Pool index is too large and will be confused with a slab id");
         m_HeapPool.emplace_back(m_MemAllocator, m_DeviceD3D12Impl, *this, m_HeapPool.size(), m_HeapDesc);
         auto NewHeapIt = m_AvailableHeaps.insert(m_HeapPool.size() - 1);
         VERIFY_EXPR(NewHeapIt.second);
@@ -401,8 +541,27 @@ void CPUDescriptorHeap::Free(DescriptorHeapAllocation&& Allocation, Uint64 CmdQu
 
 void CPUDescriptorHeap::FreeAllocation(DescriptorHeapAllocation&& Allocation)
 {
+    auto ManagerId = Allocation.GetAllocationManagerId();
+    if (ManagerId >= SlabIdBase)
+    {
+        // Fast path: return the slot to the lock-free free list
+        const Uint32 SlabIdx = ManagerId - SlabIdBase;
+        VERIFY_EXPR(SlabIdx < m_SlabCount.load());
+        const auto* pSlab = m_Slabs[SlabIdx].load(std::memory_order_acquire);
+        VERIFY_EXPR(pSlab != nullptr && Allocation.GetNumHandles() == 1);
+        const auto SlotOffset = static_cast<Uint32>((Allocation.GetCpuHandle().ptr - pSlab->Range.GetCpuHandle().ptr) / m_DescriptorSize);
+        VERIFY_EXPR(SlotOffset < SlabSize);
+        Allocation.Reset();
+
+        const auto Slot = (SlabIdx << SlabSizeLog2) + SlotOffset;
+        PushFreeSlots(Slot, Slot);
+#ifdef DILIGENT_DEVELOPMENT
+        m_DvpSlabAllocationsCounter.fetch_sub(1);
+#endif
+        return;
+    }
+
     std::lock_guard<std::mutex> LockGuard(m_HeapPoolMutex);
-    auto                        ManagerId = Allocation.GetAllocationManagerId();
     m_CurrentSize -= static_cast<Uint32>(Allocation.GetNumHandles());
     m_HeapPool[ManagerId].FreeAllocation(std::move(Allocation));
     // Return the manager to the pool of available managers
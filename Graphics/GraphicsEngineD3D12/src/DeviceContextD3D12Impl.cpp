@@ -48,6 +48,8 @@
 #include "D3D12DynamicHeap.hpp"
 #include "QueryManagerD3D12.hpp"
 #include "DXGITypeConversions.hpp"
+#include "SmallVector.hpp"
+#include "CPUProfiler.hpp"
 
 #include "D3D12TileMappingHelper.hpp"
 
@@ -299,6 +301,16 @@ void DeviceContextD3D12Impl::SetPipelineState(IPipelineState* pPipelineState)
     auto& RootInfo      = GetRootTableInfo(PSODesc.PipelineType);
     auto* pd3d12RootSig = m_pPipelineState->GetD3D12RootSignature();
 
+    if (m_pDevice->IsBindlessResourcesEnabled())
+    {
+        // Shaders may access any descriptor in the shader-visible heaps through ResourceDescriptorHeap[]
+        // and SamplerDescriptorHeap[], so the heaps must be bound before the root signature is set.
+        CmdCtx.SetDescriptorHeaps(CommandContext::ShaderDescriptorHeaps{
+            m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV).GetD3D12DescriptorHeap(),
+            m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER).GetD3D12DescriptorHeap(),
+        });
+    }
+
     if (RootInfo.pd3d12RootSig != pd3d12RootSig)
     {
         RootInfo.pd3d12RootSig = pd3d12RootSig;
@@ -437,6 +449,9 @@ void DeviceContextD3D12Impl::TransitionShaderResources(IShaderResourceBinding* p
 
 void DeviceContextD3D12Impl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Commit);
+    DILIGENT_PROFILE_FUNCTION();
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     auto* pResBindingD3D12Impl = ClassPtrCast<ShaderResourceBindingD3D12Impl>(pShaderResourceBinding);
@@ -505,6 +520,11 @@ void DeviceContextD3D12Impl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+void DeviceContextD3D12Impl::SetDynamicRenderState(const DynamicRenderState& State)
+{
+    UNSUPPORTED("SetDynamicRenderState is not supported in DirectX 12");
+}
+
 void DeviceContextD3D12Impl::CommitD3D12IndexBuffer(GraphicsContext& GraphCtx, VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pIndexBuffer != nullptr, "Index buffer is not set up for indexed draw command");
@@ -667,6 +687,8 @@ void DeviceContextD3D12Impl::PrepareForIndexedDraw(GraphicsContext& GraphCtx, DR
 
 void DeviceContextD3D12Impl::Draw(const DrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::Draw(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -680,6 +702,8 @@ void DeviceContextD3D12Impl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -700,6 +724,8 @@ void DeviceContextD3D12Impl::MultiDraw(const MultiDrawAttribs& Attribs)
 
 void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -713,6 +739,8 @@ void DeviceContextD3D12Impl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 
 void DeviceContextD3D12Impl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -755,6 +783,8 @@ void DeviceContextD3D12Impl::PrepareIndirectAttribsBuffer(CommandContext&
 
 void DeviceContextD3D12Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndirect(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -791,6 +821,8 @@ void DeviceContextD3D12Impl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 
 void DeviceContextD3D12Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -828,6 +860,8 @@ void DeviceContextD3D12Impl::DrawIndexedIndirect(const DrawIndexedIndirectAttrib
 
 void DeviceContextD3D12Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawMesh(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext6();
@@ -842,6 +876,8 @@ void DeviceContextD3D12Impl::DrawMesh(const DrawMeshAttribs& Attribs)
 
 void DeviceContextD3D12Impl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawMeshIndirect(Attribs, 0);
 
     auto& GraphCtx = GetCmdContext().AsGraphicsContext();
@@ -899,6 +935,8 @@ void DeviceContextD3D12Impl::PrepareForDispatchRays(GraphicsContext& GraphCtx)
 
 void DeviceContextD3D12Impl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
     auto& ComputeCtx = GetCmdContext().AsComputeContext();
@@ -912,6 +950,8 @@ void DeviceContextD3D12Impl::DispatchCompute(const DispatchComputeAttribs& Attri
 
 void DeviceContextD3D12Impl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
     auto& ComputeCtx = GetCmdContext().AsComputeContext();
@@ -926,6 +966,90 @@ void DeviceContextD3D12Impl::DispatchComputeIndirect(const DispatchComputeIndire
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::ExecuteIndirect(const ExecuteIndirectAttribsD3D12& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.pSignature != nullptr, "Command signature must not be null");
+    DEV_CHECK_ERR(m_pPipelineState, "No pipeline state is bound");
+    if (Attribs.pSignature == nullptr || !m_pPipelineState)
+        return;
+
+    const auto PipelineType = m_pPipelineState->GetDesc().PipelineType;
+
+    RenderDeviceD3D12Impl::IndirectCommandSignatureInfo SignatureInfo;
+
+    UINT InfoSize = sizeof(SignatureInfo);
+    if (FAILED(Attribs.pSignature->GetPrivateData(RenderDeviceD3D12Impl::IndirectCommandSignatureInfoGUID, &InfoSize, &SignatureInfo)) ||
+        InfoSize != sizeof(SignatureInfo))
+    {
+        // The signature was not created by the engine, so assume that it may change all states
+        SignatureInfo.PipelineType         = PipelineType;
+        SignatureInfo.IsIndexed            = Attribs.IndexType != VT_UNDEFINED;
+        SignatureInfo.ChangesVertexBuffers = true;
+        SignatureInfo.ChangesIndexBuffer   = !SignatureInfo.IsIndexed;
+        SignatureInfo.ChangesRootViews     = true;
+    }
+
+    DEV_CHECK_ERR(SignatureInfo.PipelineType == PipelineType,
+                  "Command signature is not compatible with the type of pipeline '", m_pPipelineState->GetDesc().Name, "'");
+    DEV_CHECK_ERR(PipelineType != PIPELINE_TYPE_RAY_TRACING && PipelineType != PIPELINE_TYPE_TILE,
+                  "Indirect commands are not supported for ray tracing and tile pipelines");
+
+    CommandContext* pCmdCtx = nullptr;
+    if (PipelineType == PIPELINE_TYPE_COMPUTE)
+    {
+        auto& ComputeCtx = GetCmdContext().AsComputeContext();
+        PrepareForDispatchCompute(ComputeCtx);
+        pCmdCtx = &ComputeCtx;
+    }
+    else
+    {
+        auto& GraphCtx = GetCmdContext().AsGraphicsContext();
+        // The index buffer bound to the context is only used if the signature does not change it
+        if (SignatureInfo.IsIndexed && !SignatureInfo.ChangesIndexBuffer)
+            PrepareForIndexedDraw(GraphCtx, Attribs.Flags, Attribs.IndexType);
+        else
+            PrepareForDraw(GraphCtx, Attribs.Flags);
+        pCmdCtx = &GraphCtx;
+    }
+
+    ID3D12Resource* pd3d12ArgsBuff          = nullptr;
+    Uint64          BuffDataStartByteOffset = 0;
+    PrepareIndirectAttribsBuffer(*pCmdCtx, Attribs.pArgsBuffer, Attribs.ArgsBufferStateTransitionMode, pd3d12ArgsBuff, BuffDataStartByteOffset,
+                                 "Indirect commands (DeviceContextD3D12Impl::ExecuteIndirect)");
+
+    ID3D12Resource* pd3d12CountBuff              = nullptr;
+    Uint64          CountBuffDataStartByteOffset = 0;
+    if (Attribs.pCounterBuffer != nullptr)
+    {
+        PrepareIndirectAttribsBuffer(*pCmdCtx, Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, pd3d12CountBuff, CountBuffDataStartByteOffset,
+                                     "Counter buffer (DeviceContextD3D12Impl::ExecuteIndirect)");
+    }
+
+    if (Attribs.MaxCommandCount > 0)
+    {
+        pCmdCtx->ExecuteIndirect(Attribs.pSignature,
+                                 Attribs.MaxCommandCount,
+                                 pd3d12ArgsBuff,
+                                 Attribs.ArgsOffset + BuffDataStartByteOffset,
+                                 pd3d12CountBuff,
+                                 pd3d12CountBuff != nullptr ? Attribs.CounterOffset + CountBuffDataStartByteOffset : 0);
+
+        // Bindings changed by the command signature are left in an undefined state,
+        // so they must be committed again by the next command.
+        if (SignatureInfo.ChangesVertexBuffers)
+            m_State.bCommittedD3D12VBsUpToDate = false;
+        if (SignatureInfo.ChangesIndexBuffer)
+        {
+            m_State.CommittedD3D12IndexBuffer.Release();
+            m_State.bCommittedD3D12IBUpToDate = false;
+        }
+        if (SignatureInfo.ChangesRootViews)
+            GetRootTableInfo(PipelineType).MakeAllStale();
+    }
+
+    ++m_State.NumCommands;
+}
+
 void DeviceContextD3D12Impl::ClearDepthStencil(ITextureView*                  pView,
                                                CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
                                                float                          fDepth,
@@ -933,6 +1057,7 @@ void DeviceContextD3D12Impl::ClearDepthStencil(ITextureView*                  pV
                                                RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Direct3D12 does not allow depth-stencil clears inside a render pass");
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow depth-stencil clears in a bundle");
 
     TDeviceContextBase::ClearDepthStencil(pView);
 
@@ -954,6 +1079,7 @@ void DeviceContextD3D12Impl::ClearDepthStencil(ITextureView*                  pV
 void DeviceContextD3D12Impl::ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Direct3D12 does not allow render target clears inside a render pass");
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow render target clears in a bundle");
 
     TDeviceContextBase::ClearRenderTarget(pView);
 
@@ -985,24 +1111,80 @@ void DeviceContextD3D12Impl::ClearRenderTarget(ITextureView* pView, const void*
     ++m_State.NumCommands;
 }
 
+void DeviceContextD3D12Impl::InvalidateAttachments(Uint32               NumViews,
+                                                   ITextureView* const* ppViews)
+{
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow discarding resources in a bundle");
+
+    TDeviceContextBase::InvalidateAttachments(NumViews, ppViews, 0);
+
+    auto& CmdCtx = GetCmdContext();
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        auto* pViewD3D12 = ClassPtrCast<TextureViewD3D12Impl>(ppViews[i]);
+        if (pViewD3D12 == nullptr)
+            continue;
+
+        const auto& ViewDesc = pViewD3D12->GetDesc();
+        if (ViewDesc.ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL)
+            continue;
+
+        auto*       pTextureD3D12 = pViewD3D12->GetTexture<TextureD3D12Impl>();
+        const auto& TexDesc       = pTextureD3D12->GetDesc();
+
+        // On a direct command list, the discarded subresources must be in the render target
+        // or depth write state for resources with the corresponding flags.
+        const auto RequiredState = ViewDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL ? RESOURCE_STATE_DEPTH_WRITE : RESOURCE_STATE_RENDER_TARGET;
+        if (pTextureD3D12->IsInKnownState() && !pTextureD3D12->CheckState(RequiredState))
+            CmdCtx.TransitionResource(*pTextureD3D12, RequiredState);
+        CmdCtx.FlushResourceBarriers();
+
+        const auto NumPlanes = ViewDesc.ViewType == TEXTURE_VIEW_DEPTH_STENCIL && GetTextureFormatAttribs(TexDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL ? 2u : 1u;
+
+        // Depth slices of a 3D texture are not separate subresources
+        const Uint32 FirstSlice = TexDesc.IsArray() ? ViewDesc.FirstArraySlice : 0;
+        const Uint32 EndSlice   = TexDesc.IsArray() ? ViewDesc.FirstArraySlice + ViewDesc.NumArraySlices : 1;
+
+        D3D12_DISCARD_REGION Region{};
+        Region.NumSubresources = 1;
+        for (Uint32 plane = 0; plane < NumPlanes; ++plane)
+        {
+            for (Uint32 slice = FirstSlice; slice < EndSlice; ++slice)
+            {
+                Region.FirstSubresource = D3D12CalcSubresource(ViewDesc.MostDetailedMip, slice, plane, TexDesc.MipLevels, TexDesc.GetArraySize());
+                CmdCtx.DiscardResource(pTextureD3D12->GetD3D12Resource(), &Region);
+            }
+        }
+        ++m_State.NumCommands;
+    }
+}
+
 void DeviceContextD3D12Impl::RequestCommandContext()
 {
-    m_CurrCmdCtx = m_pDevice->AllocateCommandContext(GetCommandQueueId(), "Command list");
+    // Command lists recorded by the same context usually have similar sizes, so the size of the
+    // previous list is used to select a command allocator of the matching size.
+    m_CurrCmdCtx = m_pDevice->AllocateCommandContext(GetCommandQueueId(), "Command list", m_LastCmdListSize);
     m_CurrCmdCtx->SetDynamicGPUDescriptorAllocators(m_DynamicGPUDescriptorAllocator);
+    DILIGENT_UPDATE_CONTEXT_STATS(m_CurrCmdCtx->SetBarrierCounters(&m_Stats.BarrierCounters));
+    DILIGENT_UPDATE_CONTEXT_STATS(m_CurrCmdCtx->SetAllocationCounters(&m_Stats.AllocationCounters));
 }
 
 void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
                                    Uint32               NumCommandLists,
                                    ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+    DILIGENT_PROFILE_FUNCTION();
+
     VERIFY(!IsDeferred() || NumCommandLists == 0 && ppCommandLists == nullptr, "Only immediate context can execute command lists");
 
     DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
                   "Flushing device context that has ", m_ActiveQueriesCounter,
                   " active queries. Direct3D12 requires that queries are begun and ended in the same command list");
+    DEV_CHECK_ERR(!m_IsConditionalRenderingActive,
+                  "Flushing device context with active conditional rendering. Direct3D12 requires that predication is set and reset in the same command list");
 
-    // TODO: use small_vector
-    std::vector<RenderDeviceD3D12Impl::PooledCommandContext> Contexts;
+    SmallVector<RenderDeviceD3D12Impl::PooledCommandContext, 8> Contexts;
     Contexts.reserve(size_t{NumCommandLists} + 1);
 
     // First, execute current context
@@ -1010,7 +1192,10 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     {
         VERIFY(!IsDeferred(), "Deferred contexts cannot execute command lists directly");
         if (m_State.NumCommands != 0)
+        {
+            m_LastCmdListSize = m_CurrCmdCtx->GetNumRecordedCommands();
             Contexts.emplace_back(std::move(m_CurrCmdCtx));
+        }
         else if (!RequestNewCmdCtx) // Reuse existing context instead of disposing and creating new one.
             m_pDevice->DisposeCommandContext(std::move(m_CurrCmdCtx));
     }
@@ -1019,6 +1204,7 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
     for (Uint32 i = 0; i < NumCommandLists; ++i)
     {
         auto* const pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(!pCmdListD3D12->IsBundle(), "Reusable and regular command lists can't be executed by the same ExecuteCommandLists() call");
 
         RefCntAutoPtr<DeviceContextD3D12Impl> pDeferredCtx;
         Contexts.emplace_back(pCmdListD3D12->Close(pDeferredCtx));
@@ -1068,6 +1254,8 @@ void DeviceContextD3D12Impl::Flush(bool                 RequestNewCmdCtx,
 
 void DeviceContextD3D12Impl::Flush()
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
 
@@ -1174,6 +1362,10 @@ void DeviceContextD3D12Impl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOf
 
 void DeviceContextD3D12Impl::CommitViewports()
 {
+    // Bundles inherit viewports from the command list that executes them
+    if (m_IsRecordingBundle)
+        return;
+
     static_assert(MAX_VIEWPORTS >= D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE, "MaxViewports constant must be greater than D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE");
     D3D12_VIEWPORT d3d12Viewports[MAX_VIEWPORTS]; // Do not waste time initializing array to zero
 
@@ -1230,6 +1422,10 @@ static constexpr RECT MaxD3D12TexSizeRects[D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT
 
 void DeviceContextD3D12Impl::CommitScissorRects(GraphicsContext& GraphCtx, bool ScissorEnable)
 {
+    // Bundles inherit scissor rectangles from the command list that executes them
+    if (m_IsRecordingBundle)
+        return;
+
     if (ScissorEnable)
     {
         // Commit currently set scissor rectangles
@@ -1278,6 +1474,11 @@ void DeviceContextD3D12Impl::CommitRenderTargets(RESOURCE_STATE_TRANSITION_MODE
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "This method must not be called inside a render pass");
 
+    // Bundles inherit render targets from the command list that executes them.
+    // Render target states are verified when the bundle is executed.
+    if (m_IsRecordingBundle)
+        return;
+
     const Uint32 MaxD3D12RTs      = D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT;
     Uint32       NumRenderTargets = m_NumBoundRenderTargets;
     VERIFY(NumRenderTargets <= MaxD3D12RTs, "D3D12 only allows 8 simultaneous render targets");
@@ -1603,6 +1804,8 @@ void DeviceContextD3D12Impl::CommitSubpassRenderTargets()
 
 void DeviceContextD3D12Impl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Render passes can't be begun in a bundle");
+
     TDeviceContextBase::BeginRenderPass(Attribs);
 
     m_AttachmentClearValues.resize(Attribs.ClearValueCount);
@@ -1634,6 +1837,10 @@ void DeviceContextD3D12Impl::EndRenderPass()
 
 D3D12DynamicAllocation DeviceContextD3D12Impl::AllocateDynamicSpace(Uint64 NumBytes, Uint32 Alignment)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle,
+                  "Dynamic memory is released at the end of the frame and can't be used by bundles. "
+                  "Dynamic buffers as well as buffer and texture updates are not allowed in a bundle.");
+    DILIGENT_UPDATE_CONTEXT_STATS(m_Stats.AllocationCounters.DynamicHeapBytes += NumBytes);
     return m_DynamicHeap.Allocate(NumBytes, Alignment, GetFrameNumber());
 }
 
@@ -1665,8 +1872,14 @@ void DeviceContextD3D12Impl::UpdateBuffer(IBuffer*                       pBuffer
     // be resource barrier issues in the cmd list in the device context
     auto* pBuffD3D12 = ClassPtrCast<BufferD3D12Impl>(pBuffer);
     VERIFY(pBuffD3D12->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
+    if (pBuffD3D12->m_pDirectUpdateCPUAddress != nullptr)
+    {
+        // The buffer resides in the GPU upload heap and is written directly
+        memcpy(reinterpret_cast<Uint8*>(pBuffD3D12->m_pDirectUpdateCPUAddress) + Offset, pData, StaticCast<size_t>(Size));
+        return;
+    }
     constexpr size_t DefaultAlignment = 16;
-    auto             TmpSpace         = m_DynamicHeap.Allocate(Size, DefaultAlignment, GetFrameNumber());
+    auto             TmpSpace         = AllocateDynamicSpace(Size, DefaultAlignment);
     memcpy(TmpSpace.CPUAddress, pData, StaticCast<size_t>(Size));
     UpdateBufferRegion(pBuffD3D12, TmpSpace, Offset, Size, StateTransitionMode);
 }
@@ -1679,6 +1892,8 @@ void DeviceContextD3D12Impl::CopyBuffer(IBuffer*                       pSrcBuffe
                                         Uint64                         Size,
                                         RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow copy commands in a bundle");
+
     TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
 
     auto* pSrcBuffD3D12 = ClassPtrCast<BufferD3D12Impl>(pSrcBuffer);
@@ -1703,6 +1918,8 @@ void DeviceContextD3D12Impl::CopyBuffer(IBuffer*                       pSrcBuffe
 
 void DeviceContextD3D12Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
     auto*       pBufferD3D12   = ClassPtrCast<BufferD3D12Impl>(pBuffer);
     const auto& BuffDesc       = pBufferD3D12->GetDesc();
@@ -1779,6 +1996,8 @@ void DeviceContextD3D12Impl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_F
 
 void DeviceContextD3D12Impl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     auto*       pBufferD3D12   = ClassPtrCast<BufferD3D12Impl>(pBuffer);
     const auto& BuffDesc       = pBufferD3D12->GetDesc();
@@ -1859,7 +2078,7 @@ void DeviceContextD3D12Impl::UpdateTexture(ITexture*                      pTextu
     }
     else
     {
-        CopyTextureRegion(SubresData.pSrcBuffer, 0, SubresData.Stride, SubresData.DepthStride,
+        CopyTextureRegion(SubresData.pSrcBuffer, SubresData.SrcOffset, SubresData.Stride, SubresData.DepthStride,
                           *pTexD3D12, DstSubResIndex, *pBox,
                           SrcBufferTransitionMode, TextureTransitionMode);
     }
@@ -1867,6 +2086,8 @@ void DeviceContextD3D12Impl::UpdateTexture(ITexture*                      pTextu
 
 void DeviceContextD3D12Impl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow copy commands in a bundle");
+
     TDeviceContextBase::CopyTexture(CopyAttribs);
 
     auto* pSrcTexD3D12 = ClassPtrCast<TextureD3D12Impl>(CopyAttribs.pSrcTexture);
@@ -2164,6 +2385,8 @@ void DeviceContextD3D12Impl::MapTextureSubresource(ITexture*                 pTe
                                                    const Box*                pMapRegion,
                                                    MappedTextureSubresource& MappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
 
     auto&       TextureD3D12 = *ClassPtrCast<TextureD3D12Impl>(pTexture);
@@ -2248,6 +2471,8 @@ void DeviceContextD3D12Impl::MapTextureSubresource(ITexture*                 pTe
 
 void DeviceContextD3D12Impl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
 
     TextureD3D12Impl& TextureD3D12 = *ClassPtrCast<TextureD3D12Impl>(pTexture);
@@ -2312,7 +2537,7 @@ void DeviceContextD3D12Impl::GenerateMips(ITextureView* pTexView)
     auto& Ctx = GetCmdContext();
 
     const auto& MipsGenerator = m_pDevice->GetMipsGenerator();
-    MipsGenerator.GenerateMips(m_pDevice->GetD3D12Device(), ClassPtrCast<TextureViewD3D12Impl>(pTexView), Ctx);
+    MipsGenerator.GenerateMips(*m_pDevice, ClassPtrCast<TextureViewD3D12Impl>(pTexView), Ctx, m_pMipGenCounters);
     ++m_State.NumCommands;
 
     // Invalidate compute resources as they were set by the mips generator
@@ -2362,7 +2587,25 @@ void DeviceContextD3D12Impl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    CommandListD3D12Impl* pCmdListD3D12(NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx)));
+    CommandListD3D12Impl* pCmdListD3D12 = nullptr;
+    if (m_IsRecordingBundle)
+    {
+        DEV_CHECK_ERR(m_ActiveQueriesCounter == 0, "Direct3D12 does not allow queries in a bundle");
+
+        // Bundles are closed here as they are never submitted to a queue
+        CComPtr<ID3D12CommandAllocator> pBundleAllocator;
+        m_CurrCmdCtx->Close(pBundleAllocator);
+        pCmdListD3D12 = NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx), std::move(pBundleAllocator));
+
+        // The size of the bundle is not representative of regular command lists
+        m_IsRecordingBundle = false;
+    }
+    else
+    {
+        m_LastCmdListSize = m_CurrCmdCtx ? m_CurrCmdCtx->GetNumRecordedCommands() : 0;
+
+        pCmdListD3D12 = NEW_RC_OBJ(m_CmdListAllocator, "CommandListD3D12Impl instance", CommandListD3D12Impl)(m_pDevice, this, std::move(m_CurrCmdCtx));
+    }
     pCmdListD3D12->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     // We can't request new cmd context because we don't know the command queue type
@@ -2378,17 +2621,107 @@ void DeviceContextD3D12Impl::FinishCommandList(ICommandList** ppCommandList)
 void DeviceContextD3D12Impl::ExecuteCommandLists(Uint32               NumCommandLists,
                                                  ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
 
     if (NumCommandLists == 0)
         return;
     DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
 
+    const auto* pFirstCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[0]);
+    if (pFirstCmdListD3D12 != nullptr && pFirstCmdListD3D12->IsBundle())
+    {
+        ExecuteBundles(NumCommandLists, ppCommandLists);
+        return;
+    }
+
     Flush(true, NumCommandLists, ppCommandLists);
 
     InvalidateState();
 }
 
+void DeviceContextD3D12Impl::ExecuteBundles(Uint32               NumCommandLists,
+                                            ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
+                  "Reusable command lists can't be executed inside an explicit render pass. "
+                  "Bind render targets with SetRenderTargets() instead.");
+    DEV_CHECK_ERR(m_NumBoundRenderTargets != 0 || m_pBoundDepthStencil,
+                  "Reusable command lists must be executed with the render targets bound by SetRenderTargets()");
+
+    auto& GraphicsCtx = GetCmdContext().AsGraphicsContext();
+
+    // Bundles inherit render targets, viewports, scissor rectangles and descriptor heaps
+    // from the command list. These states may not have been committed yet if no
+    // pipeline state has been set since the last flush.
+    CommitRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    CommitViewports();
+    CommitScissorRects(GraphicsCtx, m_NumScissorRects != 0);
+    GraphicsCtx.SetStencilRef(m_StencilRef);
+    GraphicsCtx.SetBlendFactor(m_BlendFactors);
+    // Bundles bind both heaps (see BeginReusableCommandList)
+    GraphicsCtx.SetDescriptorHeaps(CommandContext::ShaderDescriptorHeaps{
+        m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV).GetD3D12DescriptorHeap(),
+        m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER).GetD3D12DescriptorHeap(),
+    });
+
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        auto* pCmdListD3D12 = ClassPtrCast<CommandListD3D12Impl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListD3D12 != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListD3D12->IsBundle(), "Reusable and regular command lists can't be executed by the same ExecuteCommandLists() call");
+        DEV_CHECK_ERR(pCmdListD3D12->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListD3D12->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+
+        GraphicsCtx.ExecuteBundle(pCmdListD3D12->GetBundle(GetCommandQueueId()));
+    }
+    ++m_State.NumCommands;
+
+    // The pipeline state, root arguments, vertex and index buffers set by the bundles
+    // are inherited by the command list, so the context state is undefined.
+    const auto NumCommands = m_State.NumCommands;
+    TDeviceContextBase::InvalidateState();
+    m_State             = {};
+    m_State.NumCommands = NumCommands;
+    m_GraphicsResources = {};
+    m_ComputeResources  = {};
+}
+
+void DeviceContextD3D12Impl::BeginReusableCommandList(Uint32 ImmediateContextId, const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Reusable command lists can only be recorded by deferred contexts");
+    DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "ImmediateContextId is out of range");
+    DEV_CHECK_ERR(Attribs.StateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                  "Render targets can't be transitioned in a reusable command list. "
+                  "Transition the render targets in the immediate context before executing the command list.");
+
+    const SoftwareQueueIndex CommandQueueId{ImmediateContextId};
+    const auto               d3d12CmdListType = m_pDevice->GetCommandQueueType(CommandQueueId);
+    DEV_CHECK_ERR(d3d12CmdListType == D3D12_COMMAND_LIST_TYPE_DIRECT, "Bundles can only be executed by graphics queues");
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, D3D12CommandListTypeToCmdQueueType(d3d12CmdListType));
+
+    m_IsRecordingBundle = true;
+
+    m_CurrCmdCtx = m_pDevice->AllocateBundleContext("Bundle");
+    DILIGENT_UPDATE_CONTEXT_STATS(m_CurrCmdCtx->SetBarrierCounters(&m_Stats.BarrierCounters));
+    DILIGENT_UPDATE_CONTEXT_STATS(m_CurrCmdCtx->SetAllocationCounters(&m_Stats.AllocationCounters));
+    m_QueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
+
+    // Descriptor heaps set by a bundle must match the heaps of the command list that executes it.
+    // Bind both heaps so that the bundle never sets a different combination.
+    m_CurrCmdCtx->SetDescriptorHeaps(CommandContext::ShaderDescriptorHeaps{
+        m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV).GetD3D12DescriptorHeap(),
+        m_pDevice->GetGPUDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER).GetD3D12DescriptorHeap(),
+    });
+    ++m_State.NumCommands;
+
+    // Render targets are only bound in the context to validate pipeline states and are not committed to the bundle
+    SetRenderTargetsAttribs RTAttribs{Attribs};
+    if (RTAttribs.StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+        RTAttribs.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_VERIFY;
+    SetRenderTargetsExt(RTAttribs);
+}
+
 void DeviceContextD3D12Impl::EnqueueSignal(IFence* pFence, Uint64 Value)
 {
     TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
@@ -2410,6 +2743,8 @@ void DeviceContextD3D12Impl::WaitForIdle()
 
 void DeviceContextD3D12Impl::BeginQuery(IQuery* pQuery)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow queries in a bundle");
+
     TDeviceContextBase::BeginQuery(pQuery, 0);
 
     auto*      pQueryD3D12Impl = ClassPtrCast<QueryD3D12Impl>(pQuery);
@@ -2428,6 +2763,8 @@ void DeviceContextD3D12Impl::BeginQuery(IQuery* pQuery)
 
 void DeviceContextD3D12Impl::EndQuery(IQuery* pQuery)
 {
+    DEV_CHECK_ERR(!m_IsRecordingBundle, "Direct3D12 does not allow queries in a bundle");
+
     TDeviceContextBase::EndQuery(pQuery, 0);
 
     auto*      pQueryD3D12Impl = ClassPtrCast<QueryD3D12Impl>(pQuery);
@@ -2444,6 +2781,76 @@ void DeviceContextD3D12Impl::EndQuery(IQuery* pQuery)
     QueryMgr.EndQuery(Ctx, QueryType, Idx);
 }
 
+void DeviceContextD3D12Impl::ResolveQueries(IQuery* const*                 ppQueries,
+                                            Uint32                         NumQueries,
+                                            IBuffer*                       pDstBuffer,
+                                            Uint64                         DstOffset,
+                                            RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::ResolveQueries(ppQueries, NumQueries, pDstBuffer, DstOffset, 0);
+    if (NumQueries == 0)
+        return;
+
+    auto* pDstBuffD3D12 = ClassPtrCast<BufferD3D12Impl>(pDstBuffer);
+    VERIFY(pDstBuffD3D12->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be query resolve destinations");
+
+    auto& CmdCtx = GetCmdContext();
+    TransitionOrVerifyBufferState(CmdCtx, *pDstBuffD3D12, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Resolving queries (DeviceContextD3D12Impl::ResolveQueries)");
+
+    Uint64 DstDataStartByteOffset;
+    auto*  pd3d12DstBuff = pDstBuffD3D12->GetD3D12Buffer(DstDataStartByteOffset, this);
+    VERIFY(DstDataStartByteOffset == 0, "Dst buffer must not be suballocated");
+    CmdCtx.FlushResourceBarriers();
+
+    auto& QueryMgr = GetQueryManager();
+    // Queries of the same type with consecutive heap indices are resolved by a single command
+    for (Uint32 i = 0; i < NumQueries;)
+    {
+        const auto QueryType  = ppQueries[i]->GetDesc().Type;
+        const auto StartIndex = ClassPtrCast<QueryD3D12Impl>(ppQueries[i])->GetQueryHeapIndex(0);
+
+        Uint32 Count = 1;
+        while (i + Count < NumQueries &&
+               ppQueries[i + Count]->GetDesc().Type == QueryType &&
+               ClassPtrCast<QueryD3D12Impl>(ppQueries[i + Count])->GetQueryHeapIndex(0) == StartIndex + Count)
+            ++Count;
+
+        QueryMgr.ResolveQueryData(CmdCtx, QueryType, StartIndex, Count, pd3d12DstBuff, DstDataStartByteOffset + DstOffset + Uint64{i} * sizeof(Uint64));
+        ++m_State.NumCommands;
+        i += Count;
+    }
+}
+
+void DeviceContextD3D12Impl::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs)
+{
+    TDeviceContextBase::BeginConditionalRendering(Attribs, 0);
+    DEV_CHECK_ERR(Attribs.pBuffer != nullptr, "Direct3D12 only supports buffer predicates");
+
+    auto* pBuffD3D12 = ClassPtrCast<BufferD3D12Impl>(Attribs.pBuffer);
+
+    auto& CmdCtx = GetCmdContext();
+    TransitionOrVerifyBufferState(CmdCtx, *pBuffD3D12, Attribs.BufferTransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT, "Beginning conditional rendering (DeviceContextD3D12Impl::BeginConditionalRendering)");
+
+    Uint64 DataStartByteOffset;
+    auto*  pd3d12Buff = pBuffD3D12->GetD3D12Buffer(DataStartByteOffset, this);
+    CmdCtx.FlushResourceBarriers();
+
+    // D3D12_PREDICATION_OP_EQUAL_ZERO discards commands when the value is zero
+    const auto Operation = (Attribs.Flags & CONDITIONAL_RENDERING_FLAG_INVERTED) != 0 ?
+        D3D12_PREDICATION_OP_NOT_EQUAL_ZERO :
+        D3D12_PREDICATION_OP_EQUAL_ZERO;
+    CmdCtx.SetPredication(pd3d12Buff, DataStartByteOffset + Attribs.Offset, Operation);
+    ++m_State.NumCommands;
+}
+
+void DeviceContextD3D12Impl::EndConditionalRendering()
+{
+    TDeviceContextBase::EndConditionalRendering(0);
+
+    GetCmdContext().SetPredication(nullptr, 0, D3D12_PREDICATION_OP_EQUAL_ZERO);
+    ++m_State.NumCommands;
+}
+
 static void AliasingBarrier(CommandContext& CmdCtx, IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter)
 {
     bool UseNVApi         = false;
@@ -2487,6 +2894,8 @@ static void AliasingBarrier(CommandContext& CmdCtx, IDeviceObject* pResourceBefo
 
 void DeviceContextD3D12Impl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Transition);
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 
     auto& CmdCtx = GetCmdContext();
@@ -2657,22 +3066,30 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
 {
     TDeviceContextBase::BuildBLAS(Attribs, 0);
 
-    auto* const pBLASD3D12    = ClassPtrCast<BottomLevelASD3D12Impl>(Attribs.pBLAS);
-    auto* const pScratchD3D12 = ClassPtrCast<BufferD3D12Impl>(Attribs.pScratchBuffer);
-    const auto& BLASDesc      = pBLASD3D12->GetDesc();
+    auto* const pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Attribs.pBLAS);
+    const auto& BLASDesc   = pBLASD3D12->GetDesc();
+
+    RESOURCE_STATE_TRANSITION_MODE ScratchTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+
+    const auto Scratch = GetASBuildScratchSpace(Attribs, pBLASD3D12->GetScratchBufferSizes(), ScratchTransitionMode);
+    if (Scratch.pBuffer == nullptr)
+        return;
+    auto* const pScratchD3D12 = ClassPtrCast<BufferD3D12Impl>(Scratch.pBuffer);
 
     auto&       CmdCtx = GetCmdContext();
     const char* OpName = "Build BottomLevelAS (DeviceContextD3D12Impl::BuildBLAS)";
     TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
-    TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+    TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, ScratchTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
 
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC    d3d12BuildASDesc   = {};
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& d3d12BuildASInputs = d3d12BuildASDesc.Inputs;
-    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>           Geometries;
+    D3D12_RAYTRACING_GEOMETRY_DESC*                       Geometries         = nullptr;
+    Uint32                                                GeometryCount      = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        Geometries.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        Geometries    = AllocateFrameArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -2744,7 +3161,8 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        Geometries.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        Geometries    = AllocateFrameArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -2780,11 +3198,11 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     d3d12BuildASInputs.Type           = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
     d3d12BuildASInputs.Flags          = BuildASFlagsToD3D12ASBuildFlags(BLASDesc.Flags);
     d3d12BuildASInputs.DescsLayout    = D3D12_ELEMENTS_LAYOUT_ARRAY;
-    d3d12BuildASInputs.NumDescs       = static_cast<UINT>(Geometries.size());
-    d3d12BuildASInputs.pGeometryDescs = Geometries.data();
+    d3d12BuildASInputs.NumDescs       = GeometryCount;
+    d3d12BuildASInputs.pGeometryDescs = Geometries;
 
     d3d12BuildASDesc.DestAccelerationStructureData    = pBLASD3D12->GetGPUAddress();
-    d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Attribs.ScratchBufferOffset;
+    d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Scratch.Offset;
     d3d12BuildASDesc.SourceAccelerationStructureData  = 0;
 
     if (Attribs.Update)
@@ -2811,17 +3229,23 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
     static_assert(TLAS_INSTANCE_DATA_SIZE == sizeof(D3D12_RAYTRACING_INSTANCE_DESC), "Value in TLAS_INSTANCE_DATA_SIZE doesn't match the actual instance description size");
 
     auto* pTLASD3D12      = ClassPtrCast<TopLevelASD3D12Impl>(Attribs.pTLAS);
-    auto* pScratchD3D12   = ClassPtrCast<BufferD3D12Impl>(Attribs.pScratchBuffer);
     auto* pInstancesD3D12 = ClassPtrCast<BufferD3D12Impl>(Attribs.pInstanceBuffer);
 
+    RESOURCE_STATE_TRANSITION_MODE ScratchTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+
+    const auto Scratch = GetASBuildScratchSpace(Attribs, pTLASD3D12->GetScratchBufferSizes(), ScratchTransitionMode);
+    if (Scratch.pBuffer == nullptr)
+        return;
+    auto* pScratchD3D12 = ClassPtrCast<BufferD3D12Impl>(Scratch.pBuffer);
+
     auto&       CmdCtx = GetCmdContext();
     const char* OpName = "Build TopLevelAS (DeviceContextD3D12Impl::BuildTLAS)";
     TransitionOrVerifyTLASState(CmdCtx, *pTLASD3D12, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
-    TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
+    TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, ScratchTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
 
     if (Attribs.Update)
     {
-        if (!pTLASD3D12->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASD3D12->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.FirstInstanceToUpdate, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
             return;
     }
     else
@@ -2832,35 +3256,39 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
 
     // copy instance data into instance buffer
     {
+        // Only the updated range of the instances is written to the instance buffer
+        const Uint32 FirstInstance = Attribs.Update ? Attribs.FirstInstanceToUpdate : 0;
+        const Uint64 DstOffset     = Attribs.InstanceBufferOffset + Uint64{FirstInstance} * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
+
         size_t Size     = Attribs.InstanceCount * sizeof(D3D12_RAYTRACING_INSTANCE_DESC);
-        auto   TmpSpace = m_DynamicHeap.Allocate(Size, 16, m_FrameNumber);
+        auto   TmpSpace = AllocateDynamicSpace(Size, 16);
 
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
-            const auto& Inst     = Attribs.pInstances[i];
-            const auto  InstDesc = pTLASD3D12->GetInstanceDesc(Inst.InstanceName);
-
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+            const auto& Inst = Attribs.pInstances[i];
+            // Instances are stored in the order they were given when the TLAS was built
+            const Uint32 InstIndex = Attribs.Update ? pTLASD3D12->FindInstanceIndex(Inst, FirstInstance + i) : i;
+            if (InstIndex < FirstInstance || InstIndex - FirstInstance >= Attribs.InstanceCount)
             {
-                UNEXPECTED("Failed to find instance by name");
+                UNEXPECTED("Failed to find instance");
                 return;
             }
 
-            auto& d3d12Inst  = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
+            auto& d3d12Inst  = static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(TmpSpace.CPUAddress)[InstIndex - FirstInstance];
             auto* pBLASD3D12 = ClassPtrCast<BottomLevelASD3D12Impl>(Inst.pBLAS);
 
             static_assert(sizeof(d3d12Inst.Transform) == sizeof(Inst.Transform), "size mismatch");
             std::memcpy(&d3d12Inst.Transform, Inst.Transform.data, sizeof(d3d12Inst.Transform));
 
             d3d12Inst.InstanceID                          = Inst.CustomId;
-            d3d12Inst.InstanceContributionToHitGroupIndex = InstDesc.ContributionToHitGroupIndex;
+            d3d12Inst.InstanceContributionToHitGroupIndex = pTLASD3D12->GetInstanceContributionToHitGroupIndex(InstIndex);
             d3d12Inst.InstanceMask                        = Inst.Mask;
             d3d12Inst.Flags                               = InstanceFlagsToD3D12RTInstanceFlags(Inst.Flags);
             d3d12Inst.AccelerationStructure               = pBLASD3D12->GetGPUAddress();
 
             TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
         }
-        UpdateBufferRegion(pInstancesD3D12, TmpSpace, Attribs.InstanceBufferOffset, Size, Attribs.InstanceBufferTransitionMode);
+        UpdateBufferRegion(pInstancesD3D12, TmpSpace, DstOffset, Size, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(CmdCtx, *pInstancesD3D12, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
 
@@ -2870,11 +3298,11 @@ void DeviceContextD3D12Impl::BuildTLAS(const BuildTLASAttribs& Attribs)
     d3d12BuildASInputs.Type          = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
     d3d12BuildASInputs.Flags         = BuildASFlagsToD3D12ASBuildFlags(pTLASD3D12->GetDesc().Flags);
     d3d12BuildASInputs.DescsLayout   = D3D12_ELEMENTS_LAYOUT_ARRAY;
-    d3d12BuildASInputs.NumDescs      = Attribs.InstanceCount;
+    d3d12BuildASInputs.NumDescs      = pTLASD3D12->GetBuildInfo().InstanceCount;
     d3d12BuildASInputs.InstanceDescs = pInstancesD3D12->GetGPUAddress() + Attribs.InstanceBufferOffset;
 
     d3d12BuildASDesc.DestAccelerationStructureData    = pTLASD3D12->GetGPUAddress();
-    d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Attribs.ScratchBufferOffset;
+    d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Scratch.Offset;
     d3d12BuildASDesc.SourceAccelerationStructureData  = 0;
 
     if (Attribs.Update)
@@ -3035,24 +3463,16 @@ void DeviceContextD3D12Impl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIn
     ShaderBindingTableD3D12Impl::BindingTable HitGroupTable       = {};
     ShaderBindingTableD3D12Impl::BindingTable CallableShaderTable = {};
 
-    pSBTD3D12->GetData(pSBTBufferD3D12, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable);
+    std::vector<ShaderBindingTableD3D12Impl::BufferUpdateRange> UpdateRanges;
+    pSBTD3D12->GetData(pSBTBufferD3D12, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable, UpdateRanges);
 
-    if (RayGenShaderRecord.pData || MissShaderTable.pData || HitGroupTable.pData || CallableShaderTable.pData)
+    if (!UpdateRanges.empty())
     {
         TransitionOrVerifyBufferState(CmdCtx, *pSBTBufferD3D12, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_COPY_DEST, OpName);
 
-        // Buffer ranges do not intersect, so we don't need to add barriers between them
-        if (RayGenShaderRecord.pData)
-            UpdateBuffer(pSBTBufferD3D12, RayGenShaderRecord.Offset, RayGenShaderRecord.Size, RayGenShaderRecord.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (MissShaderTable.pData)
-            UpdateBuffer(pSBTBufferD3D12, MissShaderTable.Offset, MissShaderTable.Size, MissShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (HitGroupTable.pData)
-            UpdateBuffer(pSBTBufferD3D12, HitGroupTable.Offset, HitGroupTable.Size, HitGroupTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (CallableShaderTable.pData)
-            UpdateBuffer(pSBTBufferD3D12, CallableShaderTable.Offset, CallableShaderTable.Size, CallableShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        // Only the modified records are uploaded. Buffer ranges do not intersect, so we don't need to add barriers between them.
+        for (const auto& Range : UpdateRanges)
+            UpdateBuffer(pSBTBufferD3D12, Range.Offset, Range.Size, Range.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
 
         TransitionOrVerifyBufferState(CmdCtx, *pSBTBufferD3D12, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_RAY_TRACING, OpName);
     }
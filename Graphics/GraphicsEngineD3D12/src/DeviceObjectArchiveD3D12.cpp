@@ -46,4 +46,20 @@ template struct PRSSerializerD3D12<SerializerMode::Read>;
 template struct PRSSerializerD3D12<SerializerMode::Write>;
 template struct PRSSerializerD3D12<SerializerMode::Measure>;
 
+template <SerializerMode Mode>
+bool RootSignatureSerializerD3D12<Mode>::Serialize(
+    Serializer<Mode>&                        Ser,
+    ConstQual<SerializedRootSignatureD3D12>& RootSig)
+{
+    ASSERT_SIZEOF64(RootSig, 32, "Did you add a new member to SerializedRootSignatureD3D12? Please add serialization here.");
+    if (!Ser(RootSig.Hash, RootSig.Flags))
+        return false;
+
+    return Ser.SerializeBytes(RootSig.pData, RootSig.DataSize);
+}
+
+template struct RootSignatureSerializerD3D12<SerializerMode::Read>;
+template struct RootSignatureSerializerD3D12<SerializerMode::Write>;
+template struct RootSignatureSerializerD3D12<SerializerMode::Measure>;
+
 } // namespace Diligent
@@ -719,6 +719,9 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
         }
     }
 
+    // Linked adapters expose multiple nodes that share one device
+    AdapterInfo.NumNodes = d3d12Device->GetNodeCount();
+
     // Set queue info
     {
         AdapterInfo.NumQueues = 3;
@@ -745,6 +748,7 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
         Features.VertexPipelineUAVWritesAndAtomics = DEVICE_FEATURE_STATE_ENABLED;
         Features.NativeFence                       = DEVICE_FEATURE_STATE_OPTIONAL; // can be disabled
         Features.TextureComponentSwizzle           = DEVICE_FEATURE_STATE_ENABLED;
+        Features.ConditionalRendering              = DEVICE_FEATURE_STATE_ENABLED; // ID3D12GraphicsCommandList::SetPredication
 
         // Check if mesh shader is supported.
         bool MeshShadersSupported = false;
@@ -771,7 +775,9 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
             MeshProps.MaxThreadGroupCountY     = 65536;
             MeshProps.MaxThreadGroupCountZ     = 65536;
             MeshProps.MaxThreadGroupTotalCount = 1u << 22u;
-            ASSERT_SIZEOF(MeshProps, 16, "Did you add a new member to MeshShaderProperties? Please initialize it here.");
+            MeshProps.MaxOutputVertices        = 256; // from specs: https://microsoft.github.io/DirectX-Specs/d3d/MeshShader.html#setmeshoutputcounts
+            MeshProps.MaxOutputPrimitives      = 256;
+            ASSERT_SIZEOF(MeshProps, 24, "Did you add a new member to MeshShaderProperties? Please initialize it here.");
         }
 
         Features.ShaderResourceRuntimeArrays = DEVICE_FEATURE_STATE_ENABLED;
@@ -1067,7 +1073,7 @@ GraphicsAdapterInfo EngineFactoryD3D12Impl::GetGraphicsAdapterInfo(void*
         ASSERT_SIZEOF(DrawCommandProps, 12, "Did you add a new member to DrawCommandProperties? Please initialize it here.");
     }
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
     return AdapterInfo;
 }
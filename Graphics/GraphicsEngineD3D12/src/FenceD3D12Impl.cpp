@@ -106,4 +106,9 @@ void FenceD3D12Impl::Wait(Uint64 Value)
     }
 }
 
+void FenceD3D12Impl::RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    m_pDevice->GetFenceCallbackThread().RegisterCallback(this, Value, Callback, pUserData);
+}
+
 } // namespace Diligent
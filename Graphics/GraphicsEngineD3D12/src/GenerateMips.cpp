@@ -47,11 +47,14 @@
 #include "GenerateMips.hpp"
 
 #include "d3dx12_win.h"
+#include "dxc/dxcapi.h"
 
 #include "RenderDeviceD3D12Impl.hpp"
 #include "CommandContext.hpp"
 #include "TextureViewD3D12Impl.hpp"
 #include "TextureD3D12Impl.hpp"
+#include "DXGITypeConversions.hpp"
+#include "Align.hpp"
 
 #include "GenerateMips/GenerateMipsLinearCS.h"
 #include "GenerateMips/GenerateMipsLinearOddCS.h"
@@ -64,6 +67,20 @@
 
 namespace Diligent
 {
+
+static const char g_GenerateMipsSPDCS[] =
+    {
+#include "GenerateMips/GenerateMipsSPDCS_inc.h"
+};
+
+// Each single-pass downsampler group reduces a 64x64 tile of the source mip to 1x1,
+// and the last group reduces the resulting at most 64x64 mip, which limits the
+// source size to 4096x4096 and the number of generated mips to 12.
+static constexpr Uint32 SPDTileSize       = 64;
+static constexpr Uint32 SPDMaxMips        = 12;
+static constexpr Uint32 SPDMaxTextureSize = 1u << SPDMaxMips;
+static constexpr Uint32 SPDMaxArraySlices = D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION;
+
 GenerateMipsHelper::GenerateMipsHelper(ID3D12Device* pd3d12Device)
 {
     CD3DX12_ROOT_PARAMETER Params[3];
@@ -115,10 +132,190 @@ GenerateMipsHelper::GenerateMipsHelper(ID3D12Device* pd3d12Device)
     CreatePSO(m_pGenerateMipsGammaPSO[3], g_pGenerateMipsGammaOddCS);
 }
 
-void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D12Impl* pTexView, CommandContext& Ctx) const
+void GenerateMipsHelper::InitializeSinglePass(RenderDeviceD3D12Impl& Device) const
+{
+    auto* pDxCompiler = Device.GetDxCompiler();
+    if (pDxCompiler == nullptr || !pDxCompiler->IsLoaded())
+        return;
+
+    if (Device.GetDeviceInfo().MaxShaderVersion.HLSL < ShaderVersion{6, 0})
+        return;
+
+    auto* pd3d12Device = Device.GetD3D12Device();
+
+    CD3DX12_ROOT_PARAMETER Params[4];
+    Params[0].InitAsConstants(4, 0);
+    CD3DX12_DESCRIPTOR_RANGE SRVRange(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0);
+    Params[1].InitAsDescriptorTable(1, &SRVRange);
+    // Mips 1-12 and the globally coherent alias of mip 6
+    CD3DX12_DESCRIPTOR_RANGE UAVRange(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, SPDMaxMips + 1, 0);
+    Params[2].InitAsDescriptorTable(1, &UAVRange);
+    // Atomic counters
+    Params[3].InitAsUnorderedAccessView(SPDMaxMips + 1);
+    CD3DX12_STATIC_SAMPLER_DESC SamplerLinearClampDesc(
+        0, D3D12_FILTER_MIN_MAG_MIP_LINEAR, D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
+    CD3DX12_ROOT_SIGNATURE_DESC RootSigDesc;
+    RootSigDesc.NumParameters     = _countof(Params);
+    RootSigDesc.pParameters       = Params;
+    RootSigDesc.NumStaticSamplers = 1;
+    RootSigDesc.pStaticSamplers   = &SamplerLinearClampDesc;
+    RootSigDesc.Flags             = D3D12_ROOT_SIGNATURE_FLAG_NONE;
+
+    CComPtr<ID3DBlob> signature;
+    CComPtr<ID3DBlob> error;
+
+    HRESULT hr = D3D12SerializeRootSignature(&RootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
+    if (FAILED(hr))
+    {
+        LOG_WARNING_MESSAGE("Failed to serialize the root signature for single-pass mipmap generation. Multi-pass generation will be used.");
+        return;
+    }
+
+    CComPtr<ID3D12RootSignature> pRootSig;
+    hr = pd3d12Device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), __uuidof(pRootSig), reinterpret_cast<void**>(static_cast<ID3D12RootSignature**>(&pRootSig)));
+    if (FAILED(hr))
+    {
+        LOG_WARNING_MESSAGE("Failed to create the root signature for single-pass mipmap generation. Multi-pass generation will be used.");
+        return;
+    }
+
+    auto CreatePSO = [&](bool ConvertToSRGB) {
+        CComPtr<ID3D12PipelineState> pPSO;
+
+        DxcDefine Defines[] = {{L"CONVERT_TO_SRGB", ConvertToSRGB ? L"1" : L"0"}};
+
+        CComPtr<IDxcBlob> pBytecode;
+        CComPtr<IDxcBlob> pCompilerOutput;
+
+        IDXCompiler::CompileAttribs CA;
+        CA.Source           = g_GenerateMipsSPDCS;
+        CA.SourceLength     = static_cast<Uint32>(sizeof(g_GenerateMipsSPDCS) - 1);
+        CA.EntryPoint       = L"main";
+        CA.Profile          = L"cs_6_0";
+        CA.pDefines         = Defines;
+        CA.DefinesCount     = _countof(Defines);
+        CA.ppBlobOut        = &pBytecode;
+        CA.ppCompilerOutput = &pCompilerOutput;
+        if (!pDxCompiler->Compile(CA))
+        {
+            const char* CompilerMsg = pCompilerOutput ? static_cast<const char*>(pCompilerOutput->GetBufferPointer()) : nullptr;
+            LOG_WARNING_MESSAGE("Failed to compile single-pass mipmap generation shader. Multi-pass generation will be used.\n",
+                                (CompilerMsg != nullptr ? CompilerMsg : "<no compiler log available>"));
+            return pPSO;
+        }
+
+        D3D12_COMPUTE_PIPELINE_STATE_DESC PSODesc = {};
+
+        PSODesc.pRootSignature     = pRootSig;
+        PSODesc.CS.pShaderBytecode = pBytecode->GetBufferPointer();
+        PSODesc.CS.BytecodeLength  = pBytecode->GetBufferSize();
+        PSODesc.NodeMask           = 0;
+        PSODesc.Flags              = D3D12_PIPELINE_STATE_FLAG_NONE;
+
+        hr = pd3d12Device->CreateComputePipelineState(&PSODesc, __uuidof(pPSO), reinterpret_cast<void**>(static_cast<ID3D12PipelineState**>(&pPSO)));
+        if (FAILED(hr))
+        {
+            LOG_WARNING_MESSAGE("Failed to create single-pass mipmap generation pipeline state. Multi-pass generation will be used.");
+            return pPSO;
+        }
+        pPSO->SetName(L"Generate mips single-pass PSO");
+        return pPSO;
+    };
+
+    auto pLinearPSO = CreatePSO(false);
+    auto pGammaPSO  = CreatePSO(true);
+    if (!pLinearPSO || !pGammaPSO)
+        return;
+
+    m_pSPDRS        = std::move(pRootSig);
+    m_pSPDLinearPSO = std::move(pLinearPSO);
+    m_pSPDGammaPSO  = std::move(pGammaPSO);
+}
+
+CComPtr<ID3D12Resource> GenerateMipsHelper::CreateSPDCounterBuffer(ID3D12Device* pd3d12Device)
+{
+    D3D12_HEAP_PROPERTIES HeapProps{};
+    HeapProps.Type                 = D3D12_HEAP_TYPE_DEFAULT;
+    HeapProps.CPUPageProperty      = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    HeapProps.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    HeapProps.CreationNodeMask     = 1;
+    HeapProps.VisibleNodeMask      = 1;
+
+    D3D12_RESOURCE_DESC BuffDesc{};
+    BuffDesc.Dimension          = D3D12_RESOURCE_DIMENSION_BUFFER;
+    BuffDesc.Width              = SPDMaxArraySlices * sizeof(Uint32);
+    BuffDesc.Height             = 1;
+    BuffDesc.DepthOrArraySize   = 1;
+    BuffDesc.MipLevels          = 1;
+    BuffDesc.Format             = DXGI_FORMAT_UNKNOWN;
+    BuffDesc.SampleDesc.Count   = 1;
+    BuffDesc.SampleDesc.Quality = 0;
+    BuffDesc.Layout             = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    BuffDesc.Flags              = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+
+    // Committed resources in the default heap are zero-initialized, and the shader
+    // resets every counter it uses, so the buffer never needs to be cleared.
+    CComPtr<ID3D12Resource> pBuffer;
+
+    auto hr = pd3d12Device->CreateCommittedResource(&HeapProps, D3D12_HEAP_FLAG_NONE, &BuffDesc, D3D12_RESOURCE_STATE_COMMON, nullptr,
+                                                    __uuidof(pBuffer), reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&pBuffer)));
+    if (FAILED(hr))
+    {
+        LOG_WARNING_MESSAGE("Failed to create the atomic counter buffer for single-pass mipmap generation. Multi-pass generation will be used.");
+        return {};
+    }
+    pBuffer->SetName(L"Generate mips atomic counters");
+    return pBuffer;
+}
+
+bool GenerateMipsHelper::IsSinglePassSupported(RenderDeviceD3D12Impl& Device, TextureViewD3D12Impl* pTexView) const
+{
+    const auto& TexDesc  = pTexView->GetTexture()->GetDesc();
+    const auto& ViewDesc = pTexView->GetDesc();
+
+    if (TexDesc.Type != RESOURCE_DIM_TEX_2D &&
+        TexDesc.Type != RESOURCE_DIM_TEX_2D_ARRAY &&
+        TexDesc.Type != RESOURCE_DIM_TEX_CUBE &&
+        TexDesc.Type != RESOURCE_DIM_TEX_CUBE_ARRAY)
+        return false;
+
+    // The shader relies on 2:1 reduction at every level
+    const Uint32 SrcWidth  = std::max(TexDesc.Width >> ViewDesc.MostDetailedMip, 1u);
+    const Uint32 SrcHeight = std::max(TexDesc.Height >> ViewDesc.MostDetailedMip, 1u);
+    if (SrcWidth != SrcHeight || !IsPowerOfTwo(SrcWidth) || SrcWidth > SPDMaxTextureSize)
+        return false;
+
+    if (ViewDesc.NumMipLevels < 2 || ViewDesc.NumArraySlices > SPDMaxArraySlices)
+        return false;
+
+    const auto& WaveOpProps = Device.GetAdapterInfo().WaveOp;
+    if ((WaveOpProps.SupportedStages & SHADER_TYPE_COMPUTE) == 0 || (WaveOpProps.Features & WAVE_FEATURE_QUAD) == 0)
+        return false;
+
+    std::call_once(m_SPDInitFlag, [&]() { InitializeSinglePass(Device); });
+    if (!m_pSPDRS)
+        return false;
+
+    if (ViewDesc.NumMipLevels > 1 + 6)
+    {
+        // Mip 6 is read back through a typed UAV by the last group
+        TEXTURE_FORMAT UAVFormat = TexDesc.Format;
+        if (UAVFormat == TEX_FORMAT_RGBA8_UNORM_SRGB)
+            UAVFormat = TEX_FORMAT_RGBA8_UNORM;
+        else if (UAVFormat == TEX_FORMAT_BGRA8_UNORM_SRGB)
+            UAVFormat = TEX_FORMAT_BGRA8_UNORM;
+
+        D3D12_FEATURE_DATA_FORMAT_SUPPORT FormatSupport = {TexFormatToDXGI_Format(UAVFormat), {}, {}};
+        if (FAILED(Device.GetD3D12Device()->CheckFeatureSupport(D3D12_FEATURE_FORMAT_SUPPORT, &FormatSupport, sizeof(FormatSupport))) ||
+            (FormatSupport.Support2 & D3D12_FORMAT_SUPPORT2_UAV_TYPED_LOAD) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+void GenerateMipsHelper::GenerateMips(RenderDeviceD3D12Impl& Device, TextureViewD3D12Impl* pTexView, CommandContext& Ctx, CComPtr<ID3D12Resource>& pSPDCounters) const
 {
-    auto& ComputeCtx = Ctx.AsComputeContext();
-    ComputeCtx.SetComputeRootSignature(m_pGenerateMipsRS);
     auto*       pTexD3D12 = pTexView->GetTexture<TextureD3D12Impl>();
     const auto& TexDesc   = pTexD3D12->GetDesc();
     const auto& ViewDesc  = pTexView->GetDesc();
@@ -130,8 +327,6 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
         TexDesc.ArraySize == ViewDesc.NumArraySlices;
     bool IsAllMips = ViewDesc.NumMipLevels == TexDesc.MipLevels;
 
-    auto SRVDescriptorHandle = pTexView->GetTexArraySRV();
-
     if (!pTexD3D12->IsInKnownState())
     {
         LOG_ERROR_MESSAGE("Unable to generate mips for texture '", TexDesc.Name, "' because the texture state is unknown");
@@ -152,6 +347,145 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
     // Otherwise we will transition affected subresources back to original layout.
     const auto FinalState = (IsAllSlices && IsAllMips) ? RESOURCE_STATE_SHADER_RESOURCE : OriginalState;
 
+    bool UseSinglePass = IsSinglePassSupported(Device, pTexView);
+    if (UseSinglePass && !pSPDCounters)
+    {
+        pSPDCounters  = CreateSPDCounterBuffer(Device.GetD3D12Device());
+        UseSinglePass = pSPDCounters != nullptr;
+    }
+
+    if (UseSinglePass)
+        GenerateMipsSinglePass(Device.GetD3D12Device(), pTexView, Ctx, pSPDCounters, OriginalState, FinalState);
+    else
+        GenerateMipsMultiPass(Device.GetD3D12Device(), pTexView, Ctx, OriginalState, FinalState);
+
+    // Set state
+    pTexD3D12->SetState(FinalState);
+}
+
+void GenerateMipsHelper::GenerateMipsSinglePass(ID3D12Device*         pd3d12Device,
+                                                TextureViewD3D12Impl* pTexView,
+                                                CommandContext&       Ctx,
+                                                ID3D12Resource*       pSPDCounters,
+                                                RESOURCE_STATE        OriginalState,
+                                                RESOURCE_STATE        FinalState) const
+{
+    auto*       pTexD3D12 = pTexView->GetTexture<TextureD3D12Impl>();
+    const auto& TexDesc   = pTexD3D12->GetDesc();
+    const auto& ViewDesc  = pTexView->GetDesc();
+
+    const Uint32 NumDstMips = ViewDesc.NumMipLevels - 1;
+    VERIFY_EXPR(NumDstMips > 0 && NumDstMips <= SPDMaxMips);
+
+    const Uint32 SrcSize   = std::max(TexDesc.Width >> ViewDesc.MostDetailedMip, 1u);
+    const Uint32 NumGroups = (SrcSize + SPDTileSize - 1) / SPDTileSize;
+
+    auto& ComputeCtx = Ctx.AsComputeContext();
+    ComputeCtx.SetComputeRootSignature(m_pSPDRS);
+
+    const bool IsSRGB = TexDesc.Format == TEX_FORMAT_RGBA8_UNORM_SRGB || TexDesc.Format == TEX_FORMAT_BGRA8_UNORM_SRGB;
+    ComputeCtx.SetPipelineState(IsSRGB ? m_pSPDGammaPSO : m_pSPDLinearPSO);
+
+    // SRV, mips 1-12 and the alias of mip 6
+    constexpr Uint32 NumDescriptors = 1 + SPDMaxMips + 1;
+
+    auto DescriptorAlloc = Ctx.AllocateDynamicGPUVisibleDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, NumDescriptors);
+
+    CommandContext::ShaderDescriptorHeaps Heaps{DescriptorAlloc.GetDescriptorHeap(), nullptr};
+    ComputeCtx.SetDescriptorHeaps(Heaps);
+    Ctx.GetCommandList()->SetComputeRootDescriptorTable(1, DescriptorAlloc.GetGpuHandle(0));
+    Ctx.GetCommandList()->SetComputeRootDescriptorTable(2, DescriptorAlloc.GetGpuHandle(1));
+    Ctx.GetCommandList()->SetComputeRootUnorderedAccessView(3, pSPDCounters->GetGPUVirtualAddress());
+
+    struct RootCBData
+    {
+        Uint32 SrcMipLevel;   // Texture level of source mip
+        Uint32 NumMipLevels;  // Number of OutMips to write: [1, 12]
+        Uint32 NumWorkGroups; // Number of groups per array slice
+        float  InvSrcSize;    // 1.0 / SrcMip.Dimensions
+    };
+    RootCBData CBData{
+        0, // Mip levels are relative to the view's most detailed mip
+        NumDstMips,
+        NumGroups * NumGroups,
+        1.0f / static_cast<float>(SrcSize)};
+
+    Ctx.GetCommandList()->SetComputeRoot32BitConstants(0, 4, &CBData, 0);
+
+    D3D12_CPU_DESCRIPTOR_HANDLE DstDescriptorRange                  = DescriptorAlloc.GetCpuHandle();
+    UINT                        DstRangeSize                        = NumDescriptors;
+    D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRanges[NumDescriptors] = {};
+    UINT                        SrcRangeSizes[NumDescriptors]       = {};
+
+    SrcDescriptorRanges[0] = pTexView->GetTexArraySRV();
+    // All descriptors in the table must be initialized, so unused slots are populated with the
+    // handle of the last mip. The shader never writes mips beyond NumMipLevels.
+    for (Uint32 u = 0; u < SPDMaxMips; ++u)
+        SrcDescriptorRanges[1 + u] = pTexView->GetMipLevelUAV(std::min(u + 1, NumDstMips));
+    SrcDescriptorRanges[1 + SPDMaxMips] = pTexView->GetMipLevelUAV(std::min(6u, NumDstMips));
+    for (Uint32 i = 0; i < NumDescriptors; ++i)
+        SrcRangeSizes[i] = 1;
+
+    pd3d12Device->CopyDescriptors(1, &DstDescriptorRange, &DstRangeSize, NumDescriptors, SrcDescriptorRanges, SrcRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    // Transition the source mip level to the shader resource state
+    StateTransitionDesc SrcMipBarrier{pTexD3D12, OriginalState, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_NONE};
+    SrcMipBarrier.FirstMipLevel   = ViewDesc.MostDetailedMip;
+    SrcMipBarrier.MipLevelsCount  = 1;
+    SrcMipBarrier.FirstArraySlice = ViewDesc.FirstArraySlice;
+    SrcMipBarrier.ArraySliceCount = ViewDesc.NumArraySlices;
+    if (SrcMipBarrier.OldState != SrcMipBarrier.NewState)
+    {
+        Ctx.TransitionResource(*pTexD3D12, SrcMipBarrier);
+    }
+
+    // Transition all dst mip levels to UAV state
+    StateTransitionDesc DstMipsBarrier{pTexD3D12, OriginalState, RESOURCE_STATE_UNORDERED_ACCESS, STATE_TRANSITION_FLAG_NONE};
+    DstMipsBarrier.FirstMipLevel   = ViewDesc.MostDetailedMip + 1;
+    DstMipsBarrier.MipLevelsCount  = NumDstMips;
+    DstMipsBarrier.FirstArraySlice = ViewDesc.FirstArraySlice;
+    DstMipsBarrier.ArraySliceCount = ViewDesc.NumArraySlices;
+    if (DstMipsBarrier.OldState != DstMipsBarrier.NewState)
+    {
+        Ctx.TransitionResource(*pTexD3D12, DstMipsBarrier);
+    }
+
+    // The counters are reset by the previous dispatch, which must complete first
+    D3D12_RESOURCE_BARRIER CountersBarrier{D3D12_RESOURCE_BARRIER_TYPE_UAV, D3D12_RESOURCE_BARRIER_FLAG_NONE, {}};
+    CountersBarrier.UAV.pResource = pSPDCounters;
+    Ctx.ResourceBarrier(CountersBarrier);
+
+    ComputeCtx.Dispatch(NumGroups, NumGroups, ViewDesc.NumArraySlices);
+
+    if (SrcMipBarrier.NewState != FinalState)
+    {
+        SrcMipBarrier.OldState = SrcMipBarrier.NewState;
+        SrcMipBarrier.NewState = FinalState;
+        Ctx.TransitionResource(*pTexD3D12, SrcMipBarrier);
+    }
+
+    if (DstMipsBarrier.NewState != FinalState)
+    {
+        DstMipsBarrier.OldState = DstMipsBarrier.NewState;
+        DstMipsBarrier.NewState = FinalState;
+        Ctx.TransitionResource(*pTexD3D12, DstMipsBarrier);
+    }
+}
+
+void GenerateMipsHelper::GenerateMipsMultiPass(ID3D12Device*         pd3d12Device,
+                                               TextureViewD3D12Impl* pTexView,
+                                               CommandContext&       Ctx,
+                                               RESOURCE_STATE        OriginalState,
+                                               RESOURCE_STATE        FinalState) const
+{
+    auto& ComputeCtx = Ctx.AsComputeContext();
+    ComputeCtx.SetComputeRootSignature(m_pGenerateMipsRS);
+    auto*       pTexD3D12 = pTexView->GetTexture<TextureD3D12Impl>();
+    const auto& TexDesc   = pTexD3D12->GetDesc();
+    const auto& ViewDesc  = pTexView->GetDesc();
+
+    auto SRVDescriptorHandle = pTexView->GetTexArraySRV();
+
     auto BottomMip = ViewDesc.NumMipLevels - 1;
     for (uint32_t TopMip = 0; TopMip < BottomMip;)
     {
@@ -273,8 +607,5 @@ void GenerateMipsHelper::GenerateMips(ID3D12Device* pd3d12Device, TextureViewD3D
 
         TopMip += NumMips;
     }
-
-    // Set state
-    pTexD3D12->SetState(FinalState);
 }
 } // namespace Diligent
@@ -28,11 +28,49 @@
 #include "PipelineStateCacheD3D12Impl.hpp"
 #include "RenderDeviceD3D12Impl.hpp"
 #include "DataBlobImpl.hpp"
+#include "MappedFileDataBlob.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
 #include "StringTools.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Header of the file that backs the pipeline library. D3D12 validates the driver version when the
+// library is created, but the library must also be rejected if it was created on a different adapter.
+struct PipelineLibraryFileHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x4C505344; // "DSPL"
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic    = ExpectedMagic;
+    Uint32 Version  = ExpectedVersion;
+    Uint32 VendorId = 0;
+    Uint32 DeviceId = 0;
+    Uint64 DataSize = 0;
+};
+static_assert(sizeof(PipelineLibraryFileHeader) == 24, "Unexpected sizeof(PipelineLibraryFileHeader)");
+
+PipelineLibraryFileHeader GetPipelineLibraryFileHeader(const RenderDeviceD3D12Impl& Device, Uint64 DataSize)
+{
+    const auto& AdapterInfo = Device.GetAdapterInfo();
+
+    PipelineLibraryFileHeader Header;
+    Header.VendorId = AdapterInfo.VendorId;
+    Header.DeviceId = AdapterInfo.DeviceId;
+    Header.DataSize = DataSize;
+    return Header;
+}
+
+// The backing file may be mapped while the library is alive, so the updated library is
+// written to a separate file that replaces the original one when the cache is created next time.
+constexpr char PendingFileSuffix[] = ".pending";
+
+} // namespace
+
 PipelineStateCacheD3D12Impl::PipelineStateCacheD3D12Impl(IReferenceCounters*                 pRefCounters,
                                                          RenderDeviceD3D12Impl*              pRenderDeviceD3D12,
                                                          const PipelineStateCacheCreateInfo& CreateInfo) :
@@ -46,15 +84,95 @@ PipelineStateCacheD3D12Impl::PipelineStateCacheD3D12Impl(IReferenceCounters*
     }
 // clang-format on
 {
-    auto hr = pRenderDeviceD3D12->GetD3D12Device1()->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pLibrary));
-    if (FAILED(hr))
-        LOG_ERROR_AND_THROW("Failed to create D3D12 pipeline library");
+    if (CreateInfo.FilePath != nullptr && CreateInfo.FilePath[0] != '\0')
+    {
+        m_FilePath = CreateInfo.FilePath;
+        InitFromFile(m_FilePath.c_str());
+    }
+    else if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize > 0 && (m_Desc.Mode & PSO_CACHE_MODE_LOAD) != 0)
+    {
+        // The data must remain valid for the lifetime of the library, so make a copy
+        CreateLibrary(DataBlobImpl::Create(CreateInfo.CacheDataSize, CreateInfo.pCacheData), 0);
+    }
+
+    if (!m_pLibrary)
+    {
+        auto hr = pRenderDeviceD3D12->GetD3D12Device1()->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pLibrary));
+        if (FAILED(hr))
+            LOG_ERROR_AND_THROW("Failed to create D3D12 pipeline library");
+    }
 }
 
 PipelineStateCacheD3D12Impl::~PipelineStateCacheD3D12Impl()
 {
+    if (m_NumUnsavedPipelines.load() > 0)
+        WriteToFile();
+
     // D3D12 object can only be destroyed when it is no longer used by the GPU
     GetDevice()->SafeReleaseDeviceObject(std::move(m_pLibrary), ~Uint64{0});
+    // The library data must be released after the library
+    if (m_pLibraryData)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_pLibraryData), ~Uint64{0});
+}
+
+void PipelineStateCacheD3D12Impl::InitFromFile(const char* FilePath)
+{
+    const auto PendingFilePath = m_FilePath + PendingFileSuffix;
+    if (FileSystem::FileExists(PendingFilePath.c_str()))
+    {
+        // Replace the file with the one written when the cache was used last time
+        if (!MoveFileExW(WidenString(PendingFilePath).c_str(), WidenString(FilePath).c_str(), MOVEFILE_REPLACE_EXISTING))
+            LOG_WARNING_MESSAGE("Failed to replace pipeline library file '", FilePath, "' with '", PendingFilePath, "'");
+    }
+
+    if ((m_Desc.Mode & PSO_CACHE_MODE_LOAD) == 0 || !FileSystem::FileExists(FilePath))
+        return;
+
+    auto pFileData = MappedFileDataBlob::Create(FilePath, MappedFileDataBlob::AccessHint::WillNeed);
+    if (!pFileData)
+        return;
+
+    PipelineLibraryFileHeader Header;
+    if (pFileData->GetSize() > sizeof(Header))
+        memcpy(&Header, pFileData->GetConstDataPtr(), sizeof(Header));
+
+    const auto ExpectedHeader = GetPipelineLibraryFileHeader(*GetDevice(), pFileData->GetSize() - sizeof(Header));
+    if (pFileData->GetSize() <= sizeof(Header) ||
+        Header.Magic != ExpectedHeader.Magic ||
+        Header.Version != ExpectedHeader.Version ||
+        Header.DataSize != ExpectedHeader.DataSize)
+    {
+        LOG_WARNING_MESSAGE("Pipeline library file '", FilePath, "' is corrupted and will be ignored");
+        return;
+    }
+
+    if (Header.VendorId != ExpectedHeader.VendorId || Header.DeviceId != ExpectedHeader.DeviceId)
+    {
+        LOG_INFO_MESSAGE("Pipeline library file '", FilePath, "' was created on a different adapter and will be ignored");
+        return;
+    }
+
+    if (CreateLibrary(std::move(pFileData), sizeof(Header)) && (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+        LOG_INFO_MESSAGE("Loaded D3D12 pipeline library from file '", FilePath, "' (", FormatMemorySize(Header.DataSize), ")");
+}
+
+bool PipelineStateCacheD3D12Impl::CreateLibrary(RefCntAutoPtr<IDataBlob> pData, size_t DataOffset)
+{
+    VERIFY_EXPR(pData && pData->GetSize() > DataOffset);
+
+    auto hr = GetDevice()->GetD3D12Device1()->CreatePipelineLibrary(pData->GetConstDataPtr(DataOffset), pData->GetSize() - DataOffset, IID_PPV_ARGS(&m_pLibrary));
+    if (FAILED(hr))
+    {
+        // D3D12_ERROR_DRIVER_VERSION_MISMATCH and D3D12_ERROR_ADAPTER_NOT_FOUND are returned for
+        // the libraries created by a different driver or on a different adapter.
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("Failed to create D3D12 pipeline library from the cache data. An empty library will be created.");
+        m_pLibrary.Release();
+        return false;
+    }
+
+    m_pLibraryData = std::move(pData);
+    return true;
 }
 
 CComPtr<ID3D12DeviceChild> PipelineStateCacheD3D12Impl::LoadComputePipeline(const wchar_t* Name, const D3D12_COMPUTE_PIPELINE_STATE_DESC& Desc)
@@ -99,17 +217,28 @@ bool PipelineStateCacheD3D12Impl::StorePipeline(const wchar_t* Name, ID3D12Devic
     if ((m_Desc.Mode & PSO_CACHE_MODE_STORE) == 0)
         return false;
 
-    auto hr = m_pLibrary->StorePipeline(Name, static_cast<ID3D12PipelineState*>(pPSO));
+    HRESULT hr = E_FAIL;
+    {
+        std::lock_guard<std::mutex> Lock{m_LibraryMtx};
+        hr = m_pLibrary->StorePipeline(Name, static_cast<ID3D12PipelineState*>(pPSO));
+    }
     if (FAILED(hr) && (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
         LOG_ERROR_MESSAGE("Failed to add pipeline '", NarrowString(Name), "' to the library");
 
+    // Pipelines are often created in background threads. Periodically writing the library to the file
+    // makes the new pipelines available to the next run even if the cache is not released properly.
+    if (SUCCEEDED(hr) && !m_FilePath.empty())
+    {
+        if (m_NumUnsavedPipelines.fetch_add(1) + 1 >= FileWriteThreshold)
+            WriteToFile();
+    }
+
     return SUCCEEDED(hr);
 }
 
-void PipelineStateCacheD3D12Impl::GetData(IDataBlob** ppBlob)
+RefCntAutoPtr<IDataBlob> PipelineStateCacheD3D12Impl::SerializeLibrary()
 {
-    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
-    *ppBlob = nullptr;
+    std::lock_guard<std::mutex> Lock{m_LibraryMtx};
 
     auto pDataBlob = DataBlobImpl::Create(m_pLibrary->GetSerializedSize());
 
@@ -117,9 +246,48 @@ void PipelineStateCacheD3D12Impl::GetData(IDataBlob** ppBlob)
     if (FAILED(hr))
     {
         LOG_ERROR_MESSAGE("Failed to serialize D3D12 pipeline library");
+        return {};
+    }
+
+    return pDataBlob;
+}
+
+void PipelineStateCacheD3D12Impl::WriteToFile()
+{
+    if (m_FilePath.empty() || (m_Desc.Mode & PSO_CACHE_MODE_STORE) == 0)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_FileMtx};
+
+    m_NumUnsavedPipelines.store(0);
+
+    auto pData = SerializeLibrary();
+    if (!pData)
+        return;
+
+    const auto Header          = GetPipelineLibraryFileHeader(*GetDevice(), pData->GetSize());
+    const auto PendingFilePath = m_FilePath + PendingFileSuffix;
+
+    FileWrapper File{PendingFilePath.c_str(), EFileAccessMode::Overwrite};
+    if (!File || !File->Write(&Header, sizeof(Header)) || !File->Write(pData->GetConstDataPtr(), pData->GetSize()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write D3D12 pipeline library to file '", PendingFilePath, "'");
         return;
     }
 
+    if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+        LOG_INFO_MESSAGE("Saved D3D12 pipeline library to file '", PendingFilePath, "' (", FormatMemorySize(pData->GetSize()), ")");
+}
+
+void PipelineStateCacheD3D12Impl::GetData(IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    *ppBlob = nullptr;
+
+    auto pDataBlob = SerializeLibrary();
+    if (!pDataBlob)
+        return;
+
     *ppBlob = pDataBlob.Detach();
 }
 
@@ -54,6 +54,7 @@
 
 #include "DXBCUtils.hpp"
 #include "DXCompiler.hpp"
+#include "CPUProfiler.hpp"
 #include "dxc/dxcapi.h"
 
 namespace Diligent
@@ -674,6 +675,8 @@ void PipelineStateD3D12Impl::InitInternalObjects(const PSOCreateInfoType& Create
 
 void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     const auto WName = WidenString(m_Desc.Name);
 
     TShaderStages ShaderStages;
@@ -877,6 +880,8 @@ void PipelineStateD3D12Impl::InitializePipeline(const GraphicsPipelineStateCreat
 
 void PipelineStateD3D12Impl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     TShaderStages ShaderStages;
     InitInternalObjects(CreateInfo, ShaderStages);
 
@@ -928,6 +933,8 @@ void PipelineStateD3D12Impl::InitializePipeline(const ComputePipelineStateCreate
 
 void PipelineStateD3D12Impl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     LocalRootSignatureD3D12 LocalRootSig{CreateInfo.pShaderRecordName, CreateInfo.RayTracingPipeline.ShaderRecordSize};
     TShaderStages           ShaderStages;
     InitInternalObjects(CreateInfo, ShaderStages, &LocalRootSig);
@@ -30,6 +30,7 @@
 #include "QueryManagerD3D12.hpp"
 
 #include <algorithm>
+#include <functional>
 
 #include "D3D12TypeConversions.hpp"
 #include "GraphicsAccessories.hpp"
@@ -82,9 +83,11 @@ void QueryManagerD3D12::QueryHeapInfo::Init(ID3D12Device*                pd3d12D
     m_ResolveBufferBaseOffset = CurrResolveBufferOffset;
     CurrResolveBufferOffset += m_AlignedQueryDataSize * m_QueryCount;
 
+    // Available queries are sorted in descending order, so that the lowest indices are
+    // allocated first and queries tend to occupy contiguous ranges of the heap.
     m_AvailableQueries.resize(m_QueryCount);
     for (Uint32 i = 0; i < m_QueryCount; ++i)
-        m_AvailableQueries[i] = i;
+        m_AvailableQueries[i] = m_QueryCount - 1 - i;
 }
 
 Uint32 QueryManagerD3D12::QueryHeapInfo::Allocate()
@@ -109,7 +112,7 @@ void QueryManagerD3D12::QueryHeapInfo::Release(Uint32 Index)
     std::lock_guard<std::mutex> Lock{m_AvailableQueriesMtx};
     VERIFY(std::find(m_AvailableQueries.begin(), m_AvailableQueries.end(), Index) == m_AvailableQueries.end(),
            "Index ", Index, " already present in available queries list");
-    m_AvailableQueries.push_back(Index);
+    m_AvailableQueries.insert(std::lower_bound(m_AvailableQueries.begin(), m_AvailableQueries.end(), Index, std::greater<Uint32>{}), Index);
 }
 
 QueryManagerD3D12::QueryHeapInfo::~QueryHeapInfo()
@@ -263,6 +266,16 @@ void QueryManagerD3D12::EndQuery(CommandContext& Ctx, QUERY_TYPE Type, Uint32 In
     Ctx.ResolveQueryData(HeapInfo.GetD3D12QueryHeap(), d3d12QueryType, Index, 1, m_pd3d12ResolveBuffer, HeapInfo.GetResolveBufferOffset(Index));
 }
 
+void QueryManagerD3D12::ResolveQueryData(CommandContext& Ctx, QUERY_TYPE Type, Uint32 StartIndex, Uint32 NumQueries, ID3D12Resource* pd3d12DstBuffer, Uint64 DstOffset) const
+{
+    const auto& HeapInfo = m_Heaps[Type];
+    VERIFY_EXPR(HeapInfo.GetType() == Type);
+    VERIFY(StartIndex + NumQueries <= HeapInfo.GetQueryCount(), "Query range [", StartIndex, ", ", StartIndex + NumQueries, ") is out of range");
+    VERIFY((DstOffset % 8) == 0, "Destination offset must be 8-byte aligned");
+
+    Ctx.ResolveQueryData(HeapInfo.GetD3D12QueryHeap(), QueryTypeToD3D12QueryType(Type), StartIndex, NumQueries, pd3d12DstBuffer, DstOffset);
+}
+
 void QueryManagerD3D12::ReadQueryData(QUERY_TYPE Type, Uint32 Index, void* pDataPtr, Uint32 DataSize) const
 {
     const auto& HeapInfo = m_Heaps[Type];
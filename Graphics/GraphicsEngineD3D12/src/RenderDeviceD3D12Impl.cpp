@@ -30,6 +30,7 @@
 #include "RenderDeviceD3D12Impl.hpp"
 
 #include <vector>
+#include <algorithm>
 
 #include "WinHPreface.h"
 #include <dxgi1_4.h>
@@ -57,6 +58,8 @@
 #include "D3D12TypeConversions.hpp"
 #include "DXGITypeConversions.hpp"
 #include "QueryManagerD3D12.hpp"
+#include "D3D12Utils.h"
+#include "SmallVector.hpp"
 
 
 namespace Diligent
@@ -121,8 +124,64 @@ CComPtr<ID3D12Heap> CreateDummyNVApiHeap(ID3D12Device* pd3d12Device)
     return pNVApiHeap;
 }
 
+bool CheckGPUUploadHeapSupport(ID3D12Device* pd3d12Device)
+{
+#ifdef D3D12_H_HAS_GPU_UPLOAD_HEAP
+    // GPU upload heaps expose the whole VRAM to the CPU and require resizable BAR
+    D3D12_FEATURE_DATA_D3D12_OPTIONS16 d3d12Features16{};
+    if (SUCCEEDED(pd3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &d3d12Features16, sizeof(d3d12Features16))) &&
+        d3d12Features16.GPUUploadHeapSupported != FALSE)
+    {
+        LOG_INFO_MESSAGE("GPU upload heaps are supported and will be used for dynamic memory and directly updated buffers");
+        return true;
+    }
+#endif
+    return false;
+}
+
+// Returns the root parameter index of the constant buffer that is changed by the indirect argument
+Uint32 GetIndirectArgumentRootIndex(const PipelineStateD3D12Impl& PSO, const IndirectArgumentDescD3D12& Arg)
+{
+    if (Arg.Name == nullptr || Arg.Name[0] == '\0')
+    {
+        LOG_ERROR_MESSAGE("Constant buffer name of the indirect argument must not be null or empty");
+        return ~0u;
+    }
+
+    const auto& RootSig = PSO.GetRootSignature();
+    for (Uint32 s = 0; s < RootSig.GetSignatureCount(); ++s)
+    {
+        const auto* pSignature = RootSig.GetResourceSignature(s);
+        if (pSignature == nullptr)
+            continue;
+
+        const auto ResIndex = pSignature->FindResource(Arg.ShaderStages, Arg.Name);
+        if (ResIndex == InvalidPipelineResourceIndex)
+            continue;
+
+        const auto& ResDesc = pSignature->GetResourceDesc(ResIndex);
+        const auto& Attribs = pSignature->GetResourceAttribs(ResIndex);
+        if (ResDesc.ResourceType != SHADER_RESOURCE_TYPE_CONSTANT_BUFFER || Attribs.GetD3D12RootParamType() != D3D12_ROOT_PARAMETER_TYPE_CBV)
+        {
+            LOG_ERROR_MESSAGE("Resource '", Arg.Name, "' in pipeline '", PSO.GetDesc().Name,
+                              "' is not a constant buffer bound as a root view. Only non-array constant buffers "
+                              "without PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS flag can be changed by indirect commands.");
+            return ~0u;
+        }
+
+        return RootSig.GetBaseRootIndex(s) + Attribs.SRBRootIndex;
+    }
+
+    LOG_ERROR_MESSAGE("Constant buffer '", Arg.Name, "' is not found in pipeline '", PSO.GetDesc().Name, "'");
+    return ~0u;
+}
+
 } // namespace
 
+// {5D5A4A62-8B0C-4F0A-9D8B-3C1E6F27A9B4}
+const GUID RenderDeviceD3D12Impl::IndirectCommandSignatureInfoGUID =
+    {0x5d5a4a62, 0x8b0c, 0x4f0a, {0x9d, 0x8b, 0x3c, 0x1e, 0x6f, 0x27, 0xa9, 0xb4}};
+
 RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCounters,
                                              IMemoryAllocator&            RawMemAllocator,
                                              IEngineFactory*              pEngineFactory,
@@ -143,6 +202,7 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
         AdapterInfo
     },
     m_pd3d12Device   {pd3d12Device},
+    m_IsGPUUploadHeapSupported{CheckGPUUploadHeapSupport(pd3d12Device)},
     m_CPUDescriptorHeaps
     {
         {RawMemAllocator, *this, EngineCI.CPUDescriptorHeapAllocationSize[0], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, D3D12_DESCRIPTOR_HEAP_FLAG_NONE},
@@ -161,7 +221,9 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
         {*this, D3D12_COMMAND_LIST_TYPE_COMPUTE},
         {*this, D3D12_COMMAND_LIST_TYPE_COPY}
     },
+    m_BundleCmdListManager  {*this, D3D12_COMMAND_LIST_TYPE_BUNDLE},
     m_DynamicMemoryManager  {GetRawAllocator(), *this, EngineCI.NumDynamicHeapPagesToReserve, EngineCI.DynamicHeapPageSize},
+    m_MemoryMgr             {pd3d12Device, GetRawAllocator(), EngineCI.ResourceHeapPageSize, EngineCI.ResourceHeapReserveSize, EngineCI.PlacedResourceSizeThreshold},
     m_MipsGenerator         {pd3d12Device},
     m_pDxCompiler           {CreateDXCompiler(DXCompilerTarget::Direct3D12, 0, EngineCI.pDxCompilerPath)},
     m_RootSignatureAllocator{GetRawAllocator(), sizeof(RootSignatureD3D12), 128},
@@ -266,6 +328,35 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
             }
         }
 
+        if (EngineCI.EnableBindlessResources)
+        {
+            // Directly indexed descriptor heaps require shader model 6.6 and resource binding tier 3
+            const auto& MaxHLSLVersion = m_DeviceInfo.MaxShaderVersion.HLSL;
+
+            D3D12_FEATURE_DATA_D3D12_OPTIONS d3d12Features{};
+            m_pd3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &d3d12Features, sizeof(d3d12Features));
+
+            if (MaxHLSLVersion < ShaderVersion{6, 6})
+                LOG_WARNING_MESSAGE("Bindless resources require shader model 6.6, but the device only supports shader model ", Uint32{MaxHLSLVersion.Major}, '_', Uint32{MaxHLSLVersion.Minor}, ". Bindless resources will be disabled.");
+            else if (d3d12Features.ResourceBindingTier < D3D12_RESOURCE_BINDING_TIER_3)
+                LOG_WARNING_MESSAGE("Bindless resources require resource binding tier 3. Bindless resources will be disabled.");
+            else
+                m_IsBindlessResourcesEnabled = true;
+        }
+
+#ifdef D3D12_H_HAS_ENHANCED_BARRIERS
+        // Check enhanced barriers support
+        {
+            D3D12_FEATURE_DATA_D3D12_OPTIONS12 d3d12Features12{};
+            if (SUCCEEDED(m_pd3d12Device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS12, &d3d12Features12, sizeof(d3d12Features12))))
+            {
+                m_IsEnhancedBarriersSupported = d3d12Features12.EnhancedBarriersSupported != FALSE;
+                if (m_IsEnhancedBarriersSupported)
+                    LOG_INFO_MESSAGE("Enhanced barriers are supported and will be used for resource state transitions in direct command lists");
+            }
+        }
+#endif
+
         InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
     }
     catch (...)
@@ -275,6 +366,25 @@ RenderDeviceD3D12Impl::RenderDeviceD3D12Impl(IReferenceCounters*          pRefCo
     }
 }
 
+DescriptorHeapAllocation RenderDeviceD3D12Impl::AllocateBindlessDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE Type, D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptor)
+{
+    VERIFY_EXPR(Type == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV || Type == D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
+    if (!m_IsBindlessResourcesEnabled || SrcDescriptor.ptr == 0)
+        return {};
+
+    auto Allocation = m_GPUDescriptorHeaps[Type].Allocate(1);
+    if (Allocation.IsNull())
+    {
+        LOG_ERROR_MESSAGE("Failed to allocate bindless descriptor in the shader-visible ", GetD3D12DescriptorHeapTypeLiteralName(Type),
+                          " heap. Increase GPUDescriptorHeapSize[", Uint32{Type}, "] in EngineD3D12CreateInfo.");
+        return {};
+    }
+
+    // The descriptor is copied once, so it is never copied in the per-draw path
+    m_pd3d12Device->CopyDescriptorsSimple(1, Allocation.GetCpuHandle(), SrcDescriptor, Type);
+    return Allocation;
+}
+
 CommandListManager& RenderDeviceD3D12Impl::GetCmdListManager(SoftwareQueueIndex CommandQueueId)
 {
     return GetCmdListManager(GetCommandQueueType(CommandQueueId));
@@ -282,6 +392,9 @@ CommandListManager& RenderDeviceD3D12Impl::GetCmdListManager(SoftwareQueueIndex
 
 CommandListManager& RenderDeviceD3D12Impl::GetCmdListManager(D3D12_COMMAND_LIST_TYPE CmdListType)
 {
+    if (CmdListType == D3D12_COMMAND_LIST_TYPE_BUNDLE)
+        return m_BundleCmdListManager;
+
     return m_CmdListManagers[D3D12CommandListTypeToQueueId(CmdListType)];
 }
 
@@ -307,6 +420,7 @@ RenderDeviceD3D12Impl::~RenderDeviceD3D12Impl()
 
     for (auto& CmdListMngr : m_CmdListManagers)
         DEV_CHECK_ERR(CmdListMngr.GetAllocatorCounter() == 0, "All allocators must have been returned to the manager at this point.");
+    DEV_CHECK_ERR(m_BundleCmdListManager.GetAllocatorCounter() == 0, "All bundle allocators must have been returned to the manager at this point.");
     DEV_CHECK_ERR(m_AllocatedCtxCounter == 0, "All contexts must have been released.");
 
     m_ContextPool.clear();
@@ -320,7 +434,7 @@ void RenderDeviceD3D12Impl::DisposeCommandContext(PooledCommandContext&& Ctx)
     // Since allocator has not been used, we cmd list manager can put it directly into the free allocator list
 
     auto& CmdListMngr = GetCmdListManager(Ctx->GetCommandListType());
-    CmdListMngr.FreeAllocator(std::move(pAllocator));
+    CmdListMngr.FreeAllocator(std::move(pAllocator), Ctx->GetNumRecordedCommands());
     FreeCommandContext(std::move(Ctx));
 }
 
@@ -350,7 +464,7 @@ void RenderDeviceD3D12Impl::CloseAndExecuteTransientCommandContext(SoftwareQueue
                        {
                            FenceValue = pCmdQueue->Submit(1, &pCmdList);
                        });
-    CmdListMngr.ReleaseAllocator(std::move(pAllocator), CommandQueueId, FenceValue);
+    CmdListMngr.ReleaseAllocator(std::move(pAllocator), Ctx->GetNumRecordedCommands(), CommandQueueId, FenceValue);
     FreeCommandContext(std::move(Ctx));
 }
 
@@ -363,9 +477,8 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
 {
     VERIFY_EXPR(NumContexts > 0 && pContexts != 0);
 
-    // TODO: use small_vector
-    std::vector<ID3D12CommandList*>              d3d12CmdLists;
-    std::vector<CComPtr<ID3D12CommandAllocator>> CmdAllocators;
+    SmallVector<ID3D12CommandList*, 8>              d3d12CmdLists;
+    SmallVector<CComPtr<ID3D12CommandAllocator>, 8> CmdAllocators;
     d3d12CmdLists.reserve(NumContexts);
     CmdAllocators.reserve(NumContexts);
 
@@ -410,10 +523,11 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
 
     for (Uint32 i = 0; i < NumContexts; ++i)
     {
-        CmdListMngr.ReleaseAllocator(std::move(CmdAllocators[i]), CommandQueueId, FenceValue);
+        CmdListMngr.ReleaseAllocator(std::move(CmdAllocators[i]), pContexts[i]->GetNumRecordedCommands(), CommandQueueId, FenceValue);
         FreeCommandContext(std::move(pContexts[i]));
     }
 
+    m_MemoryMgr.ShrinkMemory();
     PurgeReleaseQueue(CommandQueueId);
 
     return FenceValue;
@@ -449,6 +563,71 @@ void RenderDeviceD3D12Impl::IdleGPU()
     ReleaseStaleResources();
 }
 
+void RenderDeviceD3D12Impl::GetMemoryStats(DeviceMemoryStats& Stats)
+{
+    TRenderDeviceBase::GetMemoryStats(Stats);
+
+    // The memory manager does not track heap types separately, so all pages are reported as device-local
+    const D3D12MemoryManager::Statistics MemMgrStats = m_MemoryMgr.GetStatistics();
+    Stats.DeviceLocalMemory.CommittedSize     = MemMgrStats.CurrAllocatedSize;
+    Stats.DeviceLocalMemory.UsedSize          = MemMgrStats.CurrUsedSize;
+    Stats.DeviceLocalMemory.PeakCommittedSize = MemMgrStats.PeakAllocatedSize;
+    Stats.DeviceLocalMemory.PeakUsedSize      = MemMgrStats.PeakUsedSize;
+
+    auto GetDescriptorHeapStats = [this](D3D12_DESCRIPTOR_HEAP_TYPE Type, DescriptorHeapStats& HeapStats) //
+    {
+        GPUDescriptorHeap& Heap  = m_GPUDescriptorHeaps[Type];
+        HeapStats.AllocatedCount = Heap.GetNumAllocatedStaticDescriptors();
+        HeapStats.Capacity       = Heap.GetMaxStaticDescriptors();
+    };
+    GetDescriptorHeapStats(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, Stats.ResourceDescriptors);
+    GetDescriptorHeapStats(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, Stats.SamplerDescriptors);
+}
+
+Bool RenderDeviceD3D12Impl::WaitForFences(IFence* const* ppFences,
+                                          const Uint64*  pValues,
+                                          Uint32         NumFences,
+                                          Bool           WaitAll,
+                                          Uint64         Timeout)
+{
+    DvpVerifyWaitForFencesArguments(ppFences, pValues, NumFences);
+    if (NumFences == 0)
+        return True;
+
+    CComPtr<ID3D12Device1> pd3d12Device1;
+    if (FAILED(m_pd3d12Device->QueryInterface(IID_PPV_ARGS(&pd3d12Device1))))
+        return TRenderDeviceBase::WaitForFences(ppFences, pValues, NumFences, WaitAll, Timeout);
+
+    std::vector<ID3D12Fence*> d3d12Fences(NumFences);
+    for (Uint32 i = 0; i < NumFences; ++i)
+        d3d12Fences[i] = ClassPtrCast<FenceD3D12Impl>(ppFences[i])->GetD3D12Fence();
+
+    HANDLE hEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+    if (hEvent == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to create an event to wait for fences");
+        return False;
+    }
+
+    const auto Flags = WaitAll ? D3D12_MULTIPLE_FENCE_WAIT_FLAG_ALL : D3D12_MULTIPLE_FENCE_WAIT_FLAG_ANY;
+    bool       Res   = false;
+    if (SUCCEEDED(pd3d12Device1->SetEventOnMultipleFenceCompletion(d3d12Fences.data(), pValues, NumFences, Flags, hEvent)))
+    {
+        // Convert nanoseconds to milliseconds rounding up, so that a small non-zero timeout does not become zero
+        const DWORD TimeoutMs = Timeout == ~Uint64{0} ?
+            INFINITE :
+            static_cast<DWORD>(std::min<Uint64>((Timeout + 999999) / 1000000, INFINITE - 1));
+        Res = WaitForSingleObject(hEvent, TimeoutMs) == WAIT_OBJECT_0;
+    }
+    else
+    {
+        LOG_ERROR_MESSAGE("Failed to set event on multiple fence completion");
+    }
+    CloseHandle(hEvent);
+
+    return Res ? True : False;
+}
+
 void RenderDeviceD3D12Impl::FlushStaleResources(SoftwareQueueIndex CommandQueueId)
 {
     // Submit empty command list to the queue. This will effectively signal the fence and
@@ -458,13 +637,73 @@ void RenderDeviceD3D12Impl::FlushStaleResources(SoftwareQueueIndex CommandQueueI
 
 void RenderDeviceD3D12Impl::ReleaseStaleResources(bool ForceRelease)
 {
+    m_MemoryMgr.ShrinkMemory();
     PurgeReleaseQueues(ForceRelease);
 }
 
 
-RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateCommandContext(SoftwareQueueIndex CommandQueueId, const Char* ID)
+RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateCommandContext(SoftwareQueueIndex CommandQueueId, const Char* ID, Uint32 ExpectedNumCommands)
+{
+    return AllocateCommandContext(GetCmdListManager(CommandQueueId), ID, ExpectedNumCommands);
+}
+
+RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateBundleContext(const Char* ID)
+{
+    return AllocateCommandContext(m_BundleCmdListManager, ID, 0);
+}
+
+void RenderDeviceD3D12Impl::ReleaseBundleContext(PooledCommandContext&& Ctx, CComPtr<ID3D12CommandAllocator>&& pAllocator, Uint64 QueueMask)
+{
+    VERIFY_EXPR(Ctx && Ctx->GetCommandListType() == D3D12_COMMAND_LIST_TYPE_BUNDLE);
+
+    class StaleBundle
+    {
+    public:
+        // clang-format off
+        StaleBundle(RenderDeviceD3D12Impl&            _Device,
+                    PooledCommandContext&&            _Ctx,
+                    CComPtr<ID3D12CommandAllocator>&& _pAllocator) noexcept :
+            pDevice   {&_Device              },
+            Ctx       {std::move(_Ctx)       },
+            pAllocator{std::move(_pAllocator)}
+        {}
+
+        StaleBundle             (const StaleBundle&)  = delete;
+        StaleBundle& operator = (const StaleBundle&)  = delete;
+        StaleBundle& operator = (      StaleBundle&&) = delete;
+
+        StaleBundle(StaleBundle&& rhs) noexcept :
+            pDevice   {rhs.pDevice              },
+            Ctx       {std::move(rhs.Ctx)       },
+            pAllocator{std::move(rhs.pAllocator)}
+        {
+            rhs.pDevice = nullptr;
+        }
+        // clang-format on
+
+        ~StaleBundle()
+        {
+            if (pDevice != nullptr && Ctx)
+            {
+                pDevice->m_BundleCmdListManager.FreeAllocator(std::move(pAllocator), Ctx->GetNumRecordedCommands());
+                pDevice->FreeCommandContext(std::move(Ctx));
+            }
+        }
+
+    private:
+        RenderDeviceD3D12Impl*          pDevice = nullptr;
+        PooledCommandContext            Ctx;
+        CComPtr<ID3D12CommandAllocator> pAllocator;
+    };
+
+    StaleBundle Bundle{*this, std::move(Ctx), std::move(pAllocator)};
+    // A bundle that has never been executed can be released immediately
+    if (QueueMask != 0)
+        SafeReleaseDeviceObject(std::move(Bundle), QueueMask);
+}
+
+RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateCommandContext(CommandListManager& CmdListMngr, const Char* ID, Uint32 ExpectedNumCommands)
 {
-    auto& CmdListMngr = GetCmdListManager(CommandQueueId);
     {
         std::lock_guard<std::mutex> Guard{m_ContextPoolMutex};
 
@@ -473,7 +712,7 @@ RenderDeviceD3D12Impl::PooledCommandContext RenderDeviceD3D12Impl::AllocateComma
         {
             PooledCommandContext Ctx = std::move(pool_it->second);
             m_ContextPool.erase(pool_it);
-            Ctx->Reset(CmdListMngr);
+            Ctx->Reset(CmdListMngr, ExpectedNumCommands);
             Ctx->SetID(ID);
 #ifdef DILIGENT_DEVELOPMENT
             m_AllocatedCtxCounter.fetch_add(1);
@@ -653,6 +892,161 @@ void RenderDeviceD3D12Impl::CreateTLASFromD3DResource(ID3D12Resource*       pd3d
     CreateTLASImpl(ppTLAS, Desc, InitialState, pd3d12TLAS);
 }
 
+void RenderDeviceD3D12Impl::CreateIndirectCommandSignature(const IndirectCommandSignatureDescD3D12& Desc,
+                                                           ID3D12CommandSignature**                 ppSignature)
+{
+    DEV_CHECK_ERR(ppSignature != nullptr, "ppSignature must not be null");
+    if (ppSignature == nullptr)
+        return;
+
+    DEV_CHECK_ERR(*ppSignature == nullptr, "Overwriting reference to existing object may cause memory leaks");
+    *ppSignature = nullptr;
+
+    if (Desc.NumArguments == 0 || Desc.pArguments == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Indirect command signature must have at least one argument");
+        return;
+    }
+
+    const auto* pPSO = ClassPtrCast<const PipelineStateD3D12Impl>(Desc.pPipeline);
+
+    IndirectCommandSignatureInfo Info;
+
+    std::vector<D3D12_INDIRECT_ARGUMENT_DESC> d3d12Args(Desc.NumArguments);
+
+    Uint32 PackedStride = 0;
+    bool   HasCommand   = false;
+    for (Uint32 i = 0; i < Desc.NumArguments; ++i)
+    {
+        const auto& Arg      = Desc.pArguments[i];
+        auto&       d3d12Arg = d3d12Args[i];
+        d3d12Arg.Type        = Arg.Type;
+
+        const bool IsLast = i + 1 == Desc.NumArguments;
+        switch (Arg.Type)
+        {
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW:
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED:
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH:
+#ifdef D3D12_H_HAS_MESH_SHADER
+            case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH:
+#endif
+                if (!IsLast)
+                {
+                    LOG_ERROR_MESSAGE("Argument ", i, " of the indirect command signature is a draw or dispatch command. Only the last argument can be a command.");
+                    return;
+                }
+                HasCommand     = true;
+                Info.IsIndexed = Arg.Type == D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+                if (Arg.Type == D3D12_INDIRECT_ARGUMENT_TYPE_DRAW)
+                {
+                    Info.PipelineType = PIPELINE_TYPE_GRAPHICS;
+                    PackedStride += sizeof(D3D12_DRAW_ARGUMENTS);
+                }
+                else if (Arg.Type == D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED)
+                {
+                    Info.PipelineType = PIPELINE_TYPE_GRAPHICS;
+                    PackedStride += sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
+                }
+                else if (Arg.Type == D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH)
+                {
+                    Info.PipelineType = PIPELINE_TYPE_COMPUTE;
+                    PackedStride += sizeof(D3D12_DISPATCH_ARGUMENTS);
+                }
+                else
+                {
+                    Info.PipelineType = PIPELINE_TYPE_MESH;
+                    PackedStride += sizeof(UINT) * 3;
+                }
+                break;
+
+            case D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW:
+                if (Arg.VertexBufferSlot >= MAX_BUFFER_SLOTS)
+                {
+                    LOG_ERROR_MESSAGE("Vertex buffer slot (", Arg.VertexBufferSlot, ") of indirect argument ", i, " exceeds the maximum allowed value (", MAX_BUFFER_SLOTS - 1, ")");
+                    return;
+                }
+                d3d12Arg.VertexBuffer.Slot = Arg.VertexBufferSlot;
+                Info.ChangesVertexBuffers  = true;
+                PackedStride += sizeof(D3D12_VERTEX_BUFFER_VIEW);
+                break;
+
+            case D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW:
+                Info.ChangesIndexBuffer = true;
+                PackedStride += sizeof(D3D12_INDEX_BUFFER_VIEW);
+                break;
+
+            case D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW:
+            {
+                if (pPSO == nullptr)
+                {
+                    LOG_ERROR_MESSAGE("Pipeline state must not be null when indirect command signature changes constant buffers");
+                    return;
+                }
+                const auto RootIndex = GetIndirectArgumentRootIndex(*pPSO, Arg);
+                if (RootIndex == ~0u)
+                    return;
+
+                d3d12Arg.ConstantBufferView.RootParameterIndex = RootIndex;
+                Info.ChangesRootViews                          = true;
+                PackedStride += sizeof(D3D12_GPU_VIRTUAL_ADDRESS);
+                break;
+            }
+
+            default:
+                LOG_ERROR_MESSAGE("Indirect argument type ", Arg.Type, " is not supported");
+                return;
+        }
+    }
+
+    if (!HasCommand)
+    {
+        LOG_ERROR_MESSAGE("The last argument of the indirect command signature must be a draw or dispatch command");
+        return;
+    }
+
+    if (Info.ChangesIndexBuffer && !Info.IsIndexed)
+    {
+        LOG_ERROR_MESSAGE("Only indexed draw command signatures can change the index buffer");
+        return;
+    }
+    if ((Info.ChangesVertexBuffers || Info.ChangesIndexBuffer) && Info.PipelineType != PIPELINE_TYPE_GRAPHICS)
+    {
+        LOG_ERROR_MESSAGE("Only draw command signatures can change vertex and index buffers");
+        return;
+    }
+
+    const Uint32 ByteStride = Desc.ByteStride != 0 ? Desc.ByteStride : PackedStride;
+    if (ByteStride < PackedStride || (ByteStride % 4) != 0)
+    {
+        LOG_ERROR_MESSAGE("Indirect command signature byte stride (", ByteStride, ") must be a multiple of 4 and must be at least ", PackedStride, " bytes");
+        return;
+    }
+
+    D3D12_COMMAND_SIGNATURE_DESC d3d12SignatureDesc{};
+    d3d12SignatureDesc.ByteStride       = ByteStride;
+    d3d12SignatureDesc.NumArgumentDescs = Desc.NumArguments;
+    d3d12SignatureDesc.pArgumentDescs   = d3d12Args.data();
+    d3d12SignatureDesc.NodeMask         = 0;
+
+    // The root signature is required only when the command signature changes root arguments
+    ID3D12RootSignature* pd3d12RootSig = Info.ChangesRootViews ? pPSO->GetD3D12RootSignature() : nullptr;
+
+    CComPtr<ID3D12CommandSignature> pd3d12Signature;
+
+    auto hr = m_pd3d12Device->CreateCommandSignature(&d3d12SignatureDesc, pd3d12RootSig, IID_PPV_ARGS(&pd3d12Signature));
+    if (FAILED(hr))
+    {
+        LOG_ERROR_MESSAGE("Failed to create indirect command signature");
+        return;
+    }
+
+    hr = pd3d12Signature->SetPrivateData(IndirectCommandSignatureInfoGUID, sizeof(Info), &Info);
+    VERIFY(SUCCEEDED(hr), "Failed to set command signature private data");
+
+    *ppSignature = pd3d12Signature.Detach();
+}
+
 void RenderDeviceD3D12Impl::CreateTLAS(const TopLevelASDesc& Desc,
                                        ITopLevelAS**         ppTLAS)
 {
@@ -34,6 +34,7 @@
 #include "CommandContext.hpp"
 #include "D3D12TypeConversions.hpp"
 #include "HashUtils.hpp"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
@@ -61,6 +62,108 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
         }
     }
 
+    // The total number of root parameters in all resource signatures.
+    Uint32 TotalParams       = 0;
+    Uint32 BaseRegisterSpace = 0;
+    for (Uint32 s = 0; s < m_SignatureCount; ++s)
+    {
+        auto& SignInfo = m_ResourceSignatures[s];
+
+        SignInfo.BaseRegisterSpace = BaseRegisterSpace;
+
+        const PipelineResourceSignatureD3D12Impl* const pSignature = SignInfo.pSignature;
+        if (pSignature == nullptr)
+            continue;
+
+        const auto& RootParams = pSignature->GetRootParams();
+
+        SignInfo.BaseRootIndex = TotalParams;
+        TotalParams += RootParams.GetNumRootTables() + RootParams.GetNumRootViews();
+
+        Uint32 MaxSpaceUsed = 0;
+        for (Uint32 rt = 0; rt < RootParams.GetNumRootTables(); ++rt)
+        {
+            const auto& d3d12SrcTbl = RootParams.GetRootTable(rt).d3d12RootParam.DescriptorTable;
+            for (Uint32 r = 0; r < d3d12SrcTbl.NumDescriptorRanges; ++r)
+                MaxSpaceUsed = std::max(MaxSpaceUsed, d3d12SrcTbl.pDescriptorRanges[r].RegisterSpace);
+        }
+
+        for (Uint32 rv = 0; rv < RootParams.GetNumRootViews(); ++rv)
+        {
+            const auto& d3d12SrcParam = RootParams.GetRootView(rv).d3d12RootParam;
+            MaxSpaceUsed              = std::max(MaxSpaceUsed, d3d12SrcParam.Descriptor.RegisterSpace);
+        }
+
+        BaseRegisterSpace += MaxSpaceUsed + 1;
+    }
+    m_TotalSpacesUsed = BaseRegisterSpace;
+
+    if (pDeviceD3D12Impl)
+    {
+        m_pCache = &pDeviceD3D12Impl->GetRootSignatureCache();
+
+        const auto Flags = GetD3D12RootSignatureFlags(pDeviceD3D12Impl->IsBindlessResourcesEnabled());
+
+        // Reuse the serialized root signature if it has been loaded from the archive or
+        // serialized before. This way we do not need to rebuild the description.
+        auto pSerializedRootSig = m_pCache->FindSerializedRootSig(m_Hash, Flags);
+        if (!pSerializedRootSig)
+        {
+            pSerializedRootSig = Serialize(Flags);
+            m_pCache->AddSerializedRootSig(m_Hash, Flags, pSerializedRootSig);
+        }
+#ifdef DILIGENT_DEBUG
+        else
+        {
+            auto pRefRootSig = Serialize(Flags);
+            VERIFY(pRefRootSig->GetSize() == pSerializedRootSig->GetSize() &&
+                       memcmp(pRefRootSig->GetConstDataPtr(), pSerializedRootSig->GetConstDataPtr(), pRefRootSig->GetSize()) == 0,
+                   "Cached serialized root signature does not match the root signature description. This may indicate a hash collision "
+                   "or an archive that was created by an incompatible version of the engine.");
+        }
+#endif
+
+        auto* pd3d12Device = pDeviceD3D12Impl->GetD3D12Device();
+
+        auto hr = pd3d12Device->CreateRootSignature(0, pSerializedRootSig->GetConstDataPtr(), pSerializedRootSig->GetSize(), __uuidof(m_pd3d12RootSignature), reinterpret_cast<void**>(static_cast<ID3D12RootSignature**>(&m_pd3d12RootSignature)));
+        CHECK_D3D_RESULT_THROW(hr, "Failed to create root signature");
+    }
+}
+
+size_t RootSignatureD3D12::CalculateHash(const RefCntAutoPtr<PipelineResourceSignatureD3D12Impl> ppSignatures[], Uint32 SignatureCount)
+{
+    size_t Hash = 0;
+    if (SignatureCount > 0)
+    {
+        HashCombine(Hash, SignatureCount);
+        for (Uint32 i = 0; i < SignatureCount; ++i)
+        {
+            if (ppSignatures[i] != nullptr)
+            {
+                VERIFY(ppSignatures[i]->GetDesc().BindingIndex == i, "Signature placed at another binding index");
+                HashCombine(Hash, ppSignatures[i]->GetHash());
+            }
+            else
+                HashCombine(Hash, 0);
+        }
+    }
+    return Hash;
+}
+
+D3D12_ROOT_SIGNATURE_FLAGS RootSignatureD3D12::GetD3D12RootSignatureFlags(bool BindlessResourcesEnabled)
+{
+    auto Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+    if (BindlessResourcesEnabled)
+    {
+        // Header may not have constants for D3D12_ROOT_SIGNATURE_FLAG_CBV_SRV_UAV_HEAP_DIRECTLY_INDEXED (0x400)
+        // and D3D12_ROOT_SIGNATURE_FLAG_SAMPLER_HEAP_DIRECTLY_INDEXED (0x800).
+        Flags |= static_cast<D3D12_ROOT_SIGNATURE_FLAGS>(0x400 | 0x800);
+    }
+    return Flags;
+}
+
+RefCntAutoPtr<IDataBlob> RootSignatureD3D12::Serialize(D3D12_ROOT_SIGNATURE_FLAGS Flags) const noexcept(false)
+{
     // The total number of root parameters in all resource signatures.
     Uint32 TotalParams = 0;
     // The total number of static samplers, accounting for array size, in all resource signatures.
@@ -69,15 +172,12 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
     Uint32 TotalDescriptorRanges = 0;
     for (Uint32 s = 0; s < m_SignatureCount; ++s)
     {
-        auto& SignInfo = m_ResourceSignatures[s];
-
-        const PipelineResourceSignatureD3D12Impl* const pSignature = SignInfo.pSignature;
+        const PipelineResourceSignatureD3D12Impl* const pSignature = m_ResourceSignatures[s].pSignature;
         if (pSignature == nullptr)
             continue;
 
         const auto& RootParams = pSignature->GetRootParams();
 
-        SignInfo.BaseRootIndex = TotalParams;
         TotalParams += RootParams.GetNumRootTables() + RootParams.GetNumRootViews();
 
         for (Uint32 rt = 0; rt < RootParams.GetNumRootTables(); ++rt)
@@ -112,20 +212,17 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
 
     auto descr_range_it = d3d12DescrRanges.begin();
 
-    Uint32 BaseRegisterSpace = 0;
     for (Uint32 sig = 0; sig < m_SignatureCount; ++sig)
     {
-        auto& SignInfo = m_ResourceSignatures[sig];
-
-        SignInfo.BaseRegisterSpace = BaseRegisterSpace;
+        const auto& SignInfo = m_ResourceSignatures[sig];
 
         const PipelineResourceSignatureD3D12Impl* const pSignature = SignInfo.pSignature;
         if (pSignature == nullptr)
             continue;
 
-        const auto& RootParams = pSignature->GetRootParams();
+        const auto& RootParams        = pSignature->GetRootParams();
+        const auto  BaseRegisterSpace = SignInfo.BaseRegisterSpace;
 
-        Uint32 MaxSpaceUsed = 0;
         for (Uint32 rt = 0; rt < RootParams.GetNumRootTables(); ++rt)
         {
             const auto& RootTable     = RootParams.GetRootTable(rt);
@@ -144,7 +241,6 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
             d3d12DstTbl.pDescriptorRanges = &*descr_range_it;
             for (Uint32 r = 0; r < d3d12SrcTbl.NumDescriptorRanges; ++r, ++descr_range_it)
             {
-                MaxSpaceUsed = std::max(MaxSpaceUsed, descr_range_it->RegisterSpace);
                 descr_range_it->RegisterSpace += BaseRegisterSpace;
             }
         }
@@ -159,8 +255,6 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
                     d3d12SrcParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_UAV),
                    "Root CBV, SRV or UAV is expected");
 
-            MaxSpaceUsed = std::max(MaxSpaceUsed, d3d12SrcParam.Descriptor.RegisterSpace);
-
             d3d12Parameters[RootIndex] = d3d12SrcParam;
             // Offset register space value by the base register space of the current resource signature.
             d3d12Parameters[RootIndex].Descriptor.RegisterSpace += BaseRegisterSpace;
@@ -196,10 +290,7 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
                 );
             }
         }
-
-        BaseRegisterSpace += MaxSpaceUsed + 1;
     }
-    m_TotalSpacesUsed = BaseRegisterSpace;
 
 #ifdef DILIGENT_DEBUG
     for (size_t i = 0; i < d3d12Parameters.size(); ++i)
@@ -211,7 +302,7 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
     VERIFY_EXPR(descr_range_it == d3d12DescrRanges.end());
 
     D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc{};
-    rootSignatureDesc.Flags         = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+    rootSignatureDesc.Flags         = Flags;
     rootSignatureDesc.NumParameters = static_cast<UINT>(d3d12Parameters.size());
     rootSignatureDesc.pParameters   = !d3d12Parameters.empty() ? d3d12Parameters.data() : nullptr;
 
@@ -223,25 +314,17 @@ RootSignatureD3D12::RootSignatureD3D12(IReferenceCounters*
         VERIFY_EXPR(d3d12StaticSamplers.size() == TotalImmutableSamplers);
     }
 
-    if (pDeviceD3D12Impl)
-    {
-        CComPtr<ID3DBlob> signature;
-        CComPtr<ID3DBlob> error;
-
-        HRESULT hr = D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
-        if (error)
-        {
-            LOG_ERROR_MESSAGE("Error: ", (const char*)error->GetBufferPointer());
-        }
-        CHECK_D3D_RESULT_THROW(hr, "Failed to serialize root signature");
-
-        m_pCache = &pDeviceD3D12Impl->GetRootSignatureCache();
-
-        auto* pd3d12Device = pDeviceD3D12Impl->GetD3D12Device();
+    CComPtr<ID3DBlob> signature;
+    CComPtr<ID3DBlob> error;
 
-        hr = pd3d12Device->CreateRootSignature(0, signature->GetBufferPointer(), signature->GetBufferSize(), __uuidof(m_pd3d12RootSignature), reinterpret_cast<void**>(static_cast<ID3D12RootSignature**>(&m_pd3d12RootSignature)));
-        CHECK_D3D_RESULT_THROW(hr, "Failed to create root signature");
+    HRESULT hr = D3D12SerializeRootSignature(&rootSignatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
+    if (error)
+    {
+        LOG_ERROR_MESSAGE("Error: ", (const char*)error->GetBufferPointer());
     }
+    CHECK_D3D_RESULT_THROW(hr, "Failed to serialize root signature");
+
+    return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(signature->GetBufferSize(), signature->GetBufferPointer())};
 }
 
 RootSignatureD3D12::~RootSignatureD3D12()
@@ -329,25 +412,17 @@ RootSignatureCacheD3D12::~RootSignatureCacheD3D12()
 {
     std::lock_guard<std::mutex> Lock{m_RootSigCacheMtx};
     VERIFY(m_RootSigCache.empty(), "All pipeline resource signatures must be released before the cache is destroyed.");
+
+    if (!m_SerializedRootSigs.empty())
+    {
+        LOG_INFO_MESSAGE("Root signature cache stats: ", m_SerializedRootSigs.size(), " serialized root signature(s), ",
+                         m_NumSerializedRootSigHits, " reused without serialization.");
+    }
 }
 
 RefCntAutoPtr<RootSignatureD3D12> RootSignatureCacheD3D12::GetRootSig(const RefCntAutoPtr<PipelineResourceSignatureD3D12Impl>* ppSignatures, Uint32 SignatureCount)
 {
-    size_t Hash = 0;
-    if (SignatureCount > 0)
-    {
-        HashCombine(Hash, SignatureCount);
-        for (Uint32 i = 0; i < SignatureCount; ++i)
-        {
-            if (ppSignatures[i] != nullptr)
-            {
-                VERIFY(ppSignatures[i]->GetDesc().BindingIndex == i, "Signature placed at another binding index");
-                HashCombine(Hash, ppSignatures[i]->GetHash());
-            }
-            else
-                HashCombine(Hash, 0);
-        }
-    }
+    const auto Hash = RootSignatureD3D12::CalculateHash(ppSignatures, SignatureCount);
 
     std::lock_guard<std::mutex> Lock{m_RootSigCacheMtx};
 
@@ -382,4 +457,37 @@ void RootSignatureCacheD3D12::OnDestroyRootSig(RootSignatureD3D12* pRootSig)
     }
 }
 
+RefCntAutoPtr<IDataBlob> RootSignatureCacheD3D12::FindSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags)
+{
+    std::lock_guard<std::mutex> Lock{m_SerializedRootSigsMtx};
+
+    auto it = m_SerializedRootSigs.find(ComputeHash(Hash, static_cast<Uint32>(Flags)));
+    if (it == m_SerializedRootSigs.end())
+        return {};
+
+    ++m_NumSerializedRootSigHits;
+    return it->second;
+}
+
+void RootSignatureCacheD3D12::AddSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags, IDataBlob* pData)
+{
+    DEV_CHECK_ERR(pData != nullptr && pData->GetSize() > 0, "Serialized root signature must not be empty");
+    if (pData == nullptr || pData->GetSize() == 0)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_SerializedRootSigsMtx};
+    m_SerializedRootSigs.emplace(ComputeHash(Hash, static_cast<Uint32>(Flags)), pData);
+}
+
+void RootSignatureCacheD3D12::AddSerializedRootSig(size_t Hash, D3D12_ROOT_SIGNATURE_FLAGS Flags, const void* pData, size_t DataSize)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_SerializedRootSigsMtx};
+        if (m_SerializedRootSigs.find(ComputeHash(Hash, static_cast<Uint32>(Flags))) != m_SerializedRootSigs.end())
+            return;
+    }
+
+    AddSerializedRootSig(Hash, Flags, DataBlobImpl::Create(DataSize, pData));
+}
+
 } // namespace Diligent
@@ -57,10 +57,17 @@ SamplerD3D12Impl::SamplerD3D12Impl(IReferenceCounters*    pRefCounters,
 
     m_Descriptor = pRenderDeviceD3D12->AllocateDescriptors(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
     pd3d12Device->CreateSampler(&D3D12SamplerDesc, m_Descriptor.GetCpuHandle());
+
+    m_BindlessDescriptor = pRenderDeviceD3D12->AllocateBindlessDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, m_Descriptor.GetCpuHandle());
 }
 
 SamplerD3D12Impl::~SamplerD3D12Impl()
 {
 }
 
+Uint32 SamplerD3D12Impl::GetDescriptorHeapIndex() const
+{
+    return GetDevice()->GetBindlessDescriptorIndex(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, m_BindlessDescriptor);
+}
+
 } // namespace Diligent
@@ -54,13 +54,14 @@ ShaderBindingTableD3D12Impl::~ShaderBindingTableD3D12Impl()
 {
 }
 
-void ShaderBindingTableD3D12Impl::GetData(BufferD3D12Impl*& pSBTBufferD3D12,
-                                          BindingTable&     RayGenShaderRecord,
-                                          BindingTable&     MissShaderTable,
-                                          BindingTable&     HitGroupTable,
-                                          BindingTable&     CallableShaderTable)
+void ShaderBindingTableD3D12Impl::GetData(BufferD3D12Impl*&               pSBTBufferD3D12,
+                                          BindingTable&                   RayGenShaderRecord,
+                                          BindingTable&                   MissShaderTable,
+                                          BindingTable&                   HitGroupTable,
+                                          BindingTable&                   CallableShaderTable,
+                                          std::vector<BufferUpdateRange>& UpdateRanges)
 {
-    TShaderBindingTableBase::GetData(pSBTBufferD3D12, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable);
+    TShaderBindingTableBase::GetData(pSBTBufferD3D12, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable, UpdateRanges);
 
     m_d3d12DispatchDesc.RayGenerationShaderRecord.StartAddress = pSBTBufferD3D12->GetGPUAddress() + RayGenShaderRecord.Offset;
     m_d3d12DispatchDesc.RayGenerationShaderRecord.SizeInBytes  = RayGenShaderRecord.Size;
@@ -149,12 +149,7 @@ void SwapChainD3D12Impl::Present(Uint32 SyncInterval)
 
     pImmediateCtxD3D12->Flush();
 
-    // In contrast to MSDN sample, we wait for the frame as late as possible - right
-    // before presenting.
-    // https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains#step-4-wait-before-rendering-each-frame
-    WaitForFrame();
-
-    auto hr = m_pSwapChain->Present(SyncInterval, 0);
+    auto hr = PresentAndWait(SyncInterval);
     VERIFY(SUCCEEDED(hr), "Present failed");
 
     if (m_SwapChainDesc.IsPrimary)
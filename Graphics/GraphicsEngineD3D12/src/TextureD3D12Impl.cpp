@@ -239,11 +239,18 @@ TextureD3D12Impl::TextureD3D12Impl(IReferenceCounters*        pRefCounters,
             D3D12_HEAP_FLAG_CREATE_NOT_ZEROED :
             D3D12_HEAP_FLAG_NONE;
 
-        auto hr = pd3d12Device->CreateCommittedResource(
-            &HeapProps, d3d12HeapFlags, &d3d12TexDesc, d3d12State, pClearValue, __uuidof(m_pd3d12Resource),
-            reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&m_pd3d12Resource)));
-        if (FAILED(hr))
-            LOG_ERROR_AND_THROW("Failed to create D3D12 texture");
+        // Try to suballocate the texture from a resource heap page first
+        m_MemoryAllocation = pRenderDeviceD3D12->GetMemoryManager().CreatePlacedResource(HeapProps.Type, d3d12TexDesc, d3d12State, pClearValue, m_pd3d12Resource);
+
+        HRESULT hr = S_OK;
+        if (!m_MemoryAllocation)
+        {
+            hr = pd3d12Device->CreateCommittedResource(
+                &HeapProps, d3d12HeapFlags, &d3d12TexDesc, d3d12State, pClearValue, __uuidof(m_pd3d12Resource),
+                reinterpret_cast<void**>(static_cast<ID3D12Resource**>(&m_pd3d12Resource)));
+            if (FAILED(hr))
+                LOG_ERROR_AND_THROW("Failed to create D3D12 texture");
+        }
 
         if (*m_Desc.Name != 0)
             m_pd3d12Resource->SetName(WidenString(m_Desc.Name).c_str());
@@ -630,6 +637,9 @@ TextureD3D12Impl::~TextureD3D12Impl()
 {
     // D3D12 object can only be destroyed when it is no longer used by the GPU
     GetDevice()->SafeReleaseDeviceObject(std::move(m_pd3d12Resource), m_Desc.ImmediateContextMask);
+    // The memory must be released after the placed resource
+    if (m_MemoryAllocation)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_MemoryAllocation), m_Desc.ImmediateContextMask);
     if (m_StagingFootprints != nullptr)
     {
         FREE(GetRawAllocator(), m_StagingFootprints);
@@ -60,6 +60,9 @@ TextureViewD3D12Impl::TextureViewD3D12Impl(IReferenceCounters*        pRefCounte
         new (&m_MipGenerationDescriptors[0]) DescriptorHeapAllocation{std::move(TexArraySRVDescriptor)};
         new (&m_MipGenerationDescriptors[1]) DescriptorHeapAllocation{std::move(MipLevelUAVDescriptors)};
     }
+
+    if (m_Desc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE || m_Desc.ViewType == TEXTURE_VIEW_UNORDERED_ACCESS)
+        m_BindlessDescriptor = pDevice->AllocateBindlessDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, m_Descriptor.GetCpuHandle());
 }
 
 TextureViewD3D12Impl::~TextureViewD3D12Impl()
@@ -74,4 +77,9 @@ TextureViewD3D12Impl::~TextureViewD3D12Impl()
     }
 }
 
+Uint32 TextureViewD3D12Impl::GetDescriptorHeapIndex() const
+{
+    return GetDevice()->GetBindlessDescriptorIndex(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, m_BindlessDescriptor);
+}
+
 } // namespace Diligent
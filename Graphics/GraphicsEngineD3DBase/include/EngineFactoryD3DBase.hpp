@@ -230,6 +230,9 @@ public:
             Features.NativeMultiDraw               = DEVICE_FEATURE_STATE_DISABLED;
             Features.AsyncShaderCompilation        = DEVICE_FEATURE_STATE_ENABLED;
             Features.FormattedBuffers              = DEVICE_FEATURE_STATE_ENABLED;
+            Features.DynamicRenderState            = DEVICE_FEATURE_STATE_DISABLED;
+            Features.ConditionalRendering          = DEVICE_FEATURE_STATE_DISABLED;
+            Features.ShaderObjects                 = DEVICE_FEATURE_STATE_DISABLED;
         }
 
         // Set memory properties
@@ -39,6 +39,7 @@
 #include "ShaderBase.hpp"
 #include "ThreadPool.h"
 #include "RefCntAutoPtr.hpp"
+#include "Timer.hpp"
 
 /// \file
 /// Base implementation of a D3D shader
@@ -190,7 +191,11 @@ private:
                     IDataBlob**             ppCompilerOutput,
                     InitResourcesFuncType   InitResources) noexcept(false)
     {
+        Timer CompileTimer;
         m_pShaderByteCode = CompileD3DBytecode(ShaderCI, ShaderModel, pDxCompiler, ppCompilerOutput);
+        if (ShaderCI.ByteCode == nullptr)
+            this->m_CompileTime.store(CompileTimer.GetElapsedTime());
+
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
             m_pShaderResources = InitResources(this->m_Desc, m_pShaderByteCode);
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <deque>
 #include <VersionHelpers.h>
 #include "SwapChainBase.hpp"
 #include "DXGITypeConversions.hpp"
@@ -54,7 +55,7 @@ public:
         TBase{pRefCounters, pDevice, pDeviceContext, SCDesc},
         m_FSDesc           {FSDesc},
         m_Window           {Window},
-        m_MaxFrameLatency  {SCDesc.BufferCount}
+        m_MaxFrameLatency  {SCDesc.MaxFrameLatency != 0 ? SCDesc.MaxFrameLatency : SCDesc.BufferCount}
     // clang-format on
     {
         if (m_DesiredPreTransform != SURFACE_TRANSFORM_OPTIMAL &&
@@ -66,6 +67,10 @@ public:
         }
         m_DesiredPreTransform        = SURFACE_TRANSFORM_OPTIMAL;
         m_SwapChainDesc.PreTransform = SURFACE_TRANSFORM_IDENTITY;
+
+        LARGE_INTEGER QPCFrequency;
+        QueryPerformanceFrequency(&QPCFrequency);
+        m_QPCFrequency = QPCFrequency.QuadPart;
     }
 
     ~SwapChainD3DBase()
@@ -277,6 +282,32 @@ protected:
             m_FrameLatencyWaitableObject = NULL;
             SetDXGIDeviceMaximumFrameLatency();
         }
+
+        // Present counts start from zero for the new swap chain
+        m_PendingFrames.clear();
+        OnFrameStarted();
+    }
+
+    // Presents the frame, paces the frame rate and updates the latency statistics
+    HRESULT PresentAndWait(Uint32 SyncInterval)
+    {
+        // In contrast to MSDN sample, by default we wait for the frame as late as possible - right
+        // before presenting. In low-latency mode, we wait after presenting the frame so that the
+        // application starts the next frame only when the swap chain is ready to accept it.
+        // https://docs.microsoft.com/en-us/windows/uwp/gaming/reduce-latency-with-dxgi-1-3-swap-chains#step-4-wait-before-rendering-each-frame
+        if (!m_SwapChainDesc.LowLatency)
+            WaitForFrame();
+
+        const auto hr = m_pSwapChain->Present(SyncInterval, 0);
+        if (SUCCEEDED(hr))
+            UpdateLatencyStats();
+
+        if (m_SwapChainDesc.LowLatency)
+            WaitForFrame();
+
+        OnFrameStarted();
+
+        return hr;
     }
 
     void WaitForFrame()
@@ -333,7 +364,8 @@ protected:
         if (m_MaxFrameLatency == MaxLatency)
             return;
 
-        m_MaxFrameLatency = MaxLatency;
+        m_MaxFrameLatency               = MaxLatency;
+        m_SwapChainDesc.MaxFrameLatency = MaxLatency;
 
         if (m_FrameLatencyWaitableObject != NULL)
         {
@@ -362,6 +394,49 @@ protected:
 
     virtual void SetDXGIDeviceMaximumFrameLatency() {}
 
+    // Records the time when the application starts the next frame
+    void OnFrameStarted()
+    {
+        LARGE_INTEGER Counter;
+        QueryPerformanceCounter(&Counter);
+        m_FrameStartQPC = Counter.QuadPart;
+    }
+
+    void UpdateLatencyStats()
+    {
+        // Frames whose presentation statistics have not been retrieved yet.
+        // We don't need to keep more frames than can possibly be queued.
+        constexpr size_t MaxPendingFrames = 16;
+
+        UINT PresentCount = 0;
+        if (FAILED(m_pSwapChain->GetLastPresentCount(&PresentCount)))
+            return;
+
+        m_PendingFrames.push_back({PresentCount, m_FrameStartQPC});
+        if (m_PendingFrames.size() > MaxPendingFrames)
+            m_PendingFrames.pop_front();
+
+        // Statistics are only available for flip model swap chains and full-screen swap chains.
+        // The call fails with DXGI_ERROR_FRAME_STATISTICS_DISJOINT when the statistics are not
+        // available, e.g. before the first frame is displayed.
+        DXGI_FRAME_STATISTICS FrameStats{};
+        if (FAILED(m_pSwapChain->GetFrameStatistics(&FrameStats)))
+            return;
+
+        // FrameStats.PresentCount is the present count of the most recently displayed frame.
+        // Frames that were presented before it are no longer reported and are discarded.
+        while (!m_PendingFrames.empty() && m_PendingFrames.front().PresentCount < FrameStats.PresentCount)
+            m_PendingFrames.pop_front();
+
+        if (!m_PendingFrames.empty() && m_PendingFrames.front().PresentCount == FrameStats.PresentCount)
+        {
+            const auto StartQPC = m_PendingFrames.front().StartQPC;
+            m_PendingFrames.pop_front();
+            if (FrameStats.SyncQPCTime.QuadPart >= StartQPC && m_QPCFrequency > 0)
+                this->AddFrameLatencySample(static_cast<double>(FrameStats.SyncQPCTime.QuadPart - StartQPC) / static_cast<double>(m_QPCFrequency));
+        }
+    }
+
     using TBase::m_pRenderDevice;
     using TBase::m_SwapChainDesc;
     using TBase::m_DesiredPreTransform;
@@ -373,6 +448,16 @@ protected:
     HANDLE m_FrameLatencyWaitableObject = NULL;
 
     Uint32 m_MaxFrameLatency = 0;
+
+    struct PendingFrameInfo
+    {
+        UINT     PresentCount;
+        LONGLONG StartQPC;
+    };
+    std::deque<PendingFrameInfo> m_PendingFrames;
+
+    LONGLONG m_FrameStartQPC = 0;
+    LONGLONG m_QPCFrequency  = 0;
 };
 
 } // namespace Diligent
@@ -28,6 +28,9 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
+#include <vector>
+#include <algorithm>
 
 #include "BasicTypes.h"
 #include "ReferenceCounters.h"
@@ -35,6 +38,7 @@
 #include "DeviceContextBase.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "IndexWrapper.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -88,6 +92,8 @@ protected:
     // Should be called at the end of FinishFrame()
     void EndFrame()
     {
+        ReleaseASScratchPages();
+
         if (this->IsDeferred())
         {
             // For deferred context, reset submitted cmd queue mask
@@ -100,12 +106,130 @@ protected:
         TBase::EndFrame();
     }
 
+    struct ASScratchAllocation
+    {
+        IBuffer* pBuffer = nullptr;
+        Uint64   Offset  = 0;
+    };
+
+    // Returns the scratch space for a BLAS or TLAS build: the range of the buffer provided by the application,
+    // or transient space allocated by the context if Attribs.pScratchBuffer is null.
+    template <typename BuildASAttribsType>
+    ASScratchAllocation GetASBuildScratchSpace(const BuildASAttribsType&       Attribs,
+                                               const ScratchBufferSizes&       Sizes,
+                                               RESOURCE_STATE_TRANSITION_MODE& TransitionMode)
+    {
+        if (Attribs.pScratchBuffer != nullptr)
+        {
+            TransitionMode = Attribs.ScratchBufferTransitionMode;
+            return {Attribs.pScratchBuffer, Attribs.ScratchBufferOffset};
+        }
+
+        // The state of transient pages is always tracked by the context
+        TransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+        return AllocateASScratchSpace(Attribs.Update ? Sizes.Update : Sizes.Build);
+    }
+
     void UpdateSubmittedBuffersCmdQueueMask(Uint32 QueueId)
     {
         m_SubmittedBuffersCmdQueueMask.fetch_or(Uint64{1} << Uint64{QueueId});
     }
 
 private:
+    // Allocates transient scratch space for an acceleration structure build when the application
+    // does not provide a scratch buffer. The space remains valid until the end of the frame.
+    // Pages are suballocated linearly. Immediate contexts recycle the pages once the
+    // GPU has completed the frame, similar to dynamic heap pages.
+    ASScratchAllocation AllocateASScratchSpace(Uint64 Size)
+    {
+        const Uint64 Alignment = std::max(Uint64{this->m_pDevice->GetAdapterInfo().RayTracing.ScratchBufferAlignment}, Uint64{1});
+
+        if (m_ASScratch.pCurrPage)
+        {
+            const auto Offset = AlignUp(m_ASScratch.CurrOffset, Alignment);
+            if (Offset + Size <= m_ASScratch.pCurrPage->GetDesc().Size)
+            {
+                m_ASScratch.CurrOffset = Offset + Size;
+                return {m_ASScratch.pCurrPage, Offset};
+            }
+            m_ASScratch.UsedPages.emplace_back(std::move(m_ASScratch.pCurrPage));
+        }
+
+        m_ASScratch.pCurrPage  = AcquireASScratchPage(Size);
+        m_ASScratch.CurrOffset = Size;
+        // Null buffer indicates an error
+        return {m_ASScratch.pCurrPage, 0};
+    }
+
+    RefCntAutoPtr<IBuffer> AcquireASScratchPage(Uint64 Size)
+    {
+        if (!this->IsDeferred())
+        {
+            const auto CompletedFenceValue = this->m_pDevice->GetCompletedFenceValue(this->GetCommandQueueId());
+            for (auto it = m_ASScratch.StalePages.begin(); it != m_ASScratch.StalePages.end() && it->first <= CompletedFenceValue; ++it)
+            {
+                if (it->second->GetDesc().Size >= Size)
+                {
+                    auto pPage = std::move(it->second);
+                    m_ASScratch.StalePages.erase(it);
+                    return pPage;
+                }
+            }
+        }
+
+        BufferDesc PageDesc;
+        PageDesc.Name      = "Acceleration structure scratch page";
+        PageDesc.Usage     = USAGE_DEFAULT;
+        PageDesc.BindFlags = BIND_RAY_TRACING;
+        PageDesc.Size      = std::max(Size, Uint64{ASScratchPageSize});
+        // For deferred contexts, this is the immediate context set by Begin()
+        PageDesc.ImmediateContextMask = Uint64{1} << this->GetExecutionCtxId();
+
+        RefCntAutoPtr<IBuffer> pPage;
+        this->m_pDevice->CreateBuffer(PageDesc, nullptr, &pPage);
+        if (!pPage)
+            LOG_ERROR_MESSAGE("Failed to create acceleration structure scratch page of size ", PageDesc.Size);
+        return pPage;
+    }
+
+    void ReleaseASScratchPages()
+    {
+        if (m_ASScratch.pCurrPage)
+            m_ASScratch.UsedPages.emplace_back(std::move(m_ASScratch.pCurrPage));
+        m_ASScratch.CurrOffset = 0;
+
+        if (m_ASScratch.UsedPages.empty())
+            return;
+
+        // Commands of the immediate context have been submitted before FinishFrame(), so
+        // the pages may be reused once the next fence value is reached.
+        const Uint64 FenceValue = !this->IsDeferred() ? this->m_pDevice->GetNextFenceValue(this->GetCommandQueueId()) : 0;
+        for (auto& pPage : m_ASScratch.UsedPages)
+        {
+            // Deferred contexts do not know when their commands are executed, and pages that are larger
+            // than the default size are not worth keeping. Such pages are simply released: the buffer
+            // defers the destruction of the underlying resource until the GPU is done with it.
+            if (!this->IsDeferred() && pPage->GetDesc().Size <= ASScratchPageSize)
+                m_ASScratch.StalePages.emplace_back(FenceValue, std::move(pPage));
+        }
+        m_ASScratch.UsedPages.clear();
+    }
+
+    static constexpr Uint64 ASScratchPageSize = Uint64{8} << 20;
+
+    struct ASScratchPool
+    {
+        RefCntAutoPtr<IBuffer> pCurrPage;
+        Uint64                 CurrOffset = 0;
+
+        // Pages that were filled during the current frame
+        std::vector<RefCntAutoPtr<IBuffer>> UsedPages;
+
+        // Pages used by the previous frames, ordered by fence value
+        std::deque<std::pair<Uint64, RefCntAutoPtr<IBuffer>>> StalePages;
+    };
+    ASScratchPool m_ASScratch;
+
     // This mask indicates which command queues command buffers from this context were submitted to.
     // For immediate context, this will always be 1 << GetCommandQueueId().
     // For deferred contexts, this will accumulate bits of the queues to which command buffers
@@ -41,6 +41,7 @@
 #include "ResourceReleaseQueue.hpp"
 #include "EngineMemory.h"
 #include "IndexWrapper.hpp"
+#include "FenceCallbackThread.hpp"
 
 namespace Diligent
 {
@@ -61,6 +62,7 @@ public:
                             const EngineCreateInfo&    EngineCI,
                             const GraphicsAdapterInfo& AdapterInfo) :
         TBase{pRefCounters, RawMemAllocator, pEngineFactory, EngineCI, AdapterInfo},
+        m_FenceCallbackThread{this},
         m_CmdQueueCount{CmdQueueCount}
     {
         VERIFY(m_CmdQueueCount < MAX_COMMAND_QUEUES, "The number of command queue is greater than maximum allowed value (", MAX_COMMAND_QUEUES, ")");
@@ -235,7 +237,7 @@ public:
         return CmdBuffInfo;
     }
 
-    ResourceReleaseQueue<DynamicStaleResourceWrapper>& GetReleaseQueue(SoftwareQueueIndex QueueInd)
+    ShardedResourceReleaseQueue<DynamicStaleResourceWrapper>& GetReleaseQueue(SoftwareQueueIndex QueueInd)
     {
         VERIFY_EXPR(QueueInd < m_CmdQueueCount);
         return m_CommandQueues[QueueInd].ReleaseQueue;
@@ -281,6 +283,11 @@ public:
         Queue.Mtx.unlock();
     }
 
+    FenceCallbackThread& GetFenceCallbackThread()
+    {
+        return m_FenceCallbackThread;
+    }
+
 protected:
     void DestroyCommandQueues()
     {
@@ -314,11 +321,14 @@ protected:
         CommandQueue& operator = (      CommandQueue&&) = delete;
         // clang-format on
 
-        std::mutex                                        Mtx; // Protects access to the CmdQueue.
-        std::atomic<Uint64>                               NextCmdBufferNumber{0};
-        RefCntAutoPtr<CommandQueueType>                   CmdQueue;
-        ResourceReleaseQueue<DynamicStaleResourceWrapper> ReleaseQueue;
+        std::mutex                                               Mtx; // Protects access to the CmdQueue.
+        std::atomic<Uint64>                                      NextCmdBufferNumber{0};
+        RefCntAutoPtr<CommandQueueType>                          CmdQueue;
+        ShardedResourceReleaseQueue<DynamicStaleResourceWrapper> ReleaseQueue;
     };
+    // Invokes fence completion callbacks, see IFence::RegisterCompletionCallback().
+    FenceCallbackThread m_FenceCallbackThread;
+
     const size_t  m_CmdQueueCount = 0;
     CommandQueue* m_CommandQueues = nullptr;
 };
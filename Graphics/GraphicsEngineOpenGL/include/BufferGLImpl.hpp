@@ -35,6 +35,7 @@
 #include "GLObjectWrapper.hpp"
 #include "AsyncWritableResource.hpp"
 #include "GLContextState.hpp"
+#include "GLDynamicHeap.hpp"
 
 namespace Diligent
 {
@@ -76,6 +77,19 @@ public:
 
     const GLObjectWrappers::GLBufferObj& GetGLHandle() const { return m_GlBuffer; }
 
+    /// Returns true if the buffer is suballocated from the dynamic heap when it is mapped with MAP_FLAG_DISCARD.
+    bool IsDynamicHeapBacked() const { return m_pDynamicHeap != nullptr; }
+
+    /// Returns the GL buffer object that holds the current buffer contents: the dynamic heap buffer
+    /// if the buffer was last mapped from the heap, and the buffer's own object otherwise.
+    const GLObjectWrappers::GLBufferObj& GetActiveGLHandle() const
+    {
+        return m_DynamicAllocation ? m_pDynamicHeap->GetGLBuffer() : m_GlBuffer;
+    }
+
+    /// Returns the offset of the buffer contents in the object returned by GetActiveGLHandle().
+    Uint64 GetActiveOffset() const { return m_DynamicAllocation.Offset; }
+
     /// Implementation of IBufferGL::GetGLBufferHandle().
     virtual GLuint DILIGENT_CALL_TYPE GetGLBufferHandle() const override final { return GetGLHandle(); }
 
@@ -95,6 +109,15 @@ private:
     const Uint32                  m_BindTarget;
     const GLenum                  m_GLUsageHint;
 
+    // Dynamic uniform buffers are suballocated from the device's dynamic heap if it is available.
+    GLDynamicHeap* const      m_pDynamicHeap;
+    GLDynamicHeap::Allocation m_DynamicAllocation;
+
+    // CPU address of the persistently mapped storage, see MISC_BUFFER_FLAG_PERSISTENT_MAP.
+    Uint8* m_pPersistentData = nullptr;
+    // Fence inserted when the persistently mapped buffer was last unmapped.
+    GLObjectWrappers::GLSyncObj m_PersistentMapFence;
+
 #if PLATFORM_EMSCRIPTEN
     struct MappedData
     {
@@ -43,6 +43,7 @@
 
 #include "GLContextState.hpp"
 #include "GLObjectWrapper.hpp"
+#include "GLPixelUnpackRing.hpp"
 
 namespace Diligent
 {
@@ -79,6 +80,9 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetDynamicRenderState() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE SetDynamicRenderState(const DynamicRenderState& State) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -157,6 +161,10 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateAttachments() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateAttachments(Uint32               NumViews,
+                                                          ITextureView* const* ppViews) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -239,6 +247,19 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::ResolveQueries() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE ResolveQueries(IQuery* const*                 ppQueries,
+                                                   Uint32                         NumQueries,
+                                                   IBuffer*                       pDstBuffer,
+                                                   Uint64                         DstOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginConditionalRendering() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::EndConditionalRendering() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE EndConditionalRendering() override final;
+
     /// Implementation of IDeviceContext::Flush() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -320,6 +341,9 @@ private:
     __forceinline void PrepareForIndexedDraw(VALUE_TYPE IndexType, Uint32 FirstIndexLocation, GLenum& GLIndexType, size_t& FirstIndexByteOffset);
     __forceinline void PrepareForIndirectDraw(IBuffer* pAttribsBuffer);
     __forceinline void PrepareForIndirectDrawCount(IBuffer* pCountBuffer);
+    // Allocates a transient indirect command buffer from the dynamic heap and binds it to
+    // GL_DRAW_INDIRECT_BUFFER. Returns null if native multi-draw indirect is not available.
+    void* AllocateTransientDrawCommands(size_t Size, Uint32 FirstInstanceLocation, size_t& Offset);
     __forceinline void PostDraw();
 
     using TBindings = PipelineResourceSignatureGLImpl::TBindings;
@@ -348,6 +372,18 @@ private:
         }
     } m_BindInfo;
 
+    // Resource caches bound by BindProgramResources(). If the GL unit bindings have not changed
+    // since then, the same cache does not need to be bound again to the same units.
+    struct BoundResourceCacheInfo
+    {
+        Uint64    Revision     = 0;
+        TBindings BaseBindings = {};
+    };
+    std::array<BoundResourceCacheInfo, MAX_RESOURCE_SIGNATURES> m_BoundResourceCaches{};
+
+    // Resource bindings version of the context state after the last BindProgramResources() call
+    Uint32 m_ResourceBindingsVersion = 0;
+
     MEMORY_BARRIER m_CommittedResourcesTentativeBarriers = MEMORY_BARRIER_NONE;
 
     std::vector<class TextureBaseGL*> m_BoundWritableTextures;
@@ -360,6 +396,9 @@ private:
     GLObjectWrappers::GLFrameBufferObj m_DefaultFBO;
 
     std::vector<OptimizedClearValue> m_AttachmentClearValues;
+
+    // Large texture updates from CPU memory are staged through this ring, see UpdateTexture()
+    GLPixelUnpackRing m_PixelUnpackRing;
 };
 
 } // namespace Diligent
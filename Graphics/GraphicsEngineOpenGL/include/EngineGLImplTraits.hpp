@@ -44,6 +44,7 @@
 #include "RenderPass.h"
 #include "Framebuffer.h"
 #include "PipelineResourceSignature.h"
+#include "PipelineStateCache.h"
 #include "DeviceContextGL.h"
 #include "BaseInterfacesGL.h"
 
@@ -69,8 +70,7 @@ class TopLevelASGLImpl;
 class ShaderBindingTableGLImpl;
 class PipelineResourceSignatureGLImpl;
 class DeviceMemoryGLImpl;
-class PipelineStateCacheGlImpl
-{};
+class PipelineStateCacheGLImpl;
 
 class FixedBlockMemoryAllocator;
 
@@ -106,6 +106,7 @@ struct EngineGLImplTraits
     using RenderPassInterface                = IRenderPass;
     using FramebufferInterface               = IFramebuffer;
     using PipelineResourceSignatureInterface = IPipelineResourceSignature;
+    using PipelineStateCacheInterface        = IPipelineStateCache;
 
     using RenderDeviceImplType              = RenderDeviceGLImpl;
     using DeviceContextImplType             = DeviceContextGLImpl;
@@ -126,7 +127,7 @@ struct EngineGLImplTraits
     using ShaderBindingTableImplType        = ShaderBindingTableGLImpl;
     using PipelineResourceSignatureImplType = PipelineResourceSignatureGLImpl;
     using DeviceMemoryImplType              = DeviceMemoryGLImpl;
-    using PipelineStateCacheImplType        = PipelineStateCacheGlImpl;
+    using PipelineStateCacheImplType        = PipelineStateCacheGLImpl;
 
     using BuffViewObjAllocatorType = FixedBlockMemoryAllocator;
     using TexViewObjAllocatorType  = FixedBlockMemoryAllocator;
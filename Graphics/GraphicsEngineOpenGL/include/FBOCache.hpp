@@ -105,7 +105,7 @@ private:
 
 
     friend class RenderDeviceGLImpl;
-    Threading::SpinLock                                                                      m_CacheLock;
+    Threading::AdaptiveLock                                                                  m_CacheLock;
     std::unordered_map<FBOCacheKey, GLObjectWrappers::GLFrameBufferObj, FBOCacheKeyHashFunc> m_Cache;
 
     // Multimap that sets up correspondence between unique texture id and all
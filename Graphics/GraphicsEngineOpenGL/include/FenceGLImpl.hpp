@@ -62,6 +62,9 @@ public:
     /// Implementation of IFence::Wait() in OpenGL backend.
     virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
 
+    /// Implementation of IFence::RegisterCompletionCallback() in OpenGL backend.
+    virtual void DILIGENT_CALL_TYPE RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData) override final;
+
     void AddPendingFence(GLObjectWrappers::GLSyncObj&& Fence, Uint64 Value)
     {
         m_PendingFences.emplace_back(Value, std::move(Fence));
@@ -57,6 +57,14 @@ public:
 
     NativeGLContextType GetCurrentNativeGLContext();
 
+    /// Creates a context that shares objects with the main context and
+    /// can be made current on a worker thread.
+    bool CreateWorkerContext();
+    /// Binds the worker context to the calling thread, or unbinds it if Bind is false.
+    bool BindWorkerContext(bool Bind);
+    /// Destroys the worker context. The context must not be current on any thread.
+    void DestroyWorkerContext();
+
     int32_t GetScreenWidth() const { return screen_width_; }
     int32_t GetScreenHeight() const { return screen_height_; }
 
@@ -68,6 +76,10 @@ private:
     EGLContext     context_ = EGL_NO_CONTEXT;
     EGLConfig      config_;
 
+    //Worker context that shares objects with the main context
+    EGLContext worker_context_ = EGL_NO_CONTEXT;
+    EGLSurface worker_surface_ = EGL_NO_SURFACE;
+
     EGLint egl_major_version_ = 0;
     EGLint egl_minor_version_ = 0;
 
@@ -46,6 +46,11 @@ public:
     void                Suspend();
     NativeGLContextType GetCurrentNativeGLContext();
 
+    // Worker contexts are not supported on this platform
+    bool CreateWorkerContext() { return false; }
+    bool BindWorkerContext(bool Bind) { return false; }
+    void DestroyWorkerContext() {}
+
 private:
     NativeGLContextType m_GLContext = {};
     bool                m_IsCreated = false;
@@ -41,6 +41,11 @@ public:
               const struct SwapChainDesc*      pSCDesc);
 
     NativeGLContextType GetCurrentNativeGLContext();
+
+    // Worker contexts are not supported on this platform
+    bool CreateWorkerContext() { return false; }
+    bool BindWorkerContext(bool Bind) { return false; }
+    void DestroyWorkerContext() {}
 };
 
 } // namespace Diligent
@@ -44,9 +44,21 @@ public:
 
     NativeGLContextType GetCurrentNativeGLContext();
 
+    /// Creates a context that shares objects with the main context and
+    /// can be made current on a worker thread.
+    bool CreateWorkerContext();
+    /// Binds the worker context to the calling thread, or unbinds it if Bind is false.
+    bool BindWorkerContext(bool Bind);
+    /// Destroys the worker context. The context must not be current on any thread.
+    void DestroyWorkerContext();
+
 private:
     Uint32 m_WindowId = 0;
     void*  m_pDisplay = nullptr;
+
+    GLXContext m_Context       = nullptr;
+    GLXContext m_WorkerContext = nullptr;
+    GLXPbuffer m_WorkerPbuffer = 0;
 };
 
 } // namespace Diligent
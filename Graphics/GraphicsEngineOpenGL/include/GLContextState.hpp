@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "GraphicsTypes.h"
+#include "DeviceContext.h"
 #include "GLObjectWrapper.hpp"
 #include "UniqueIdentifier.hpp"
 #include "GLContext.hpp"
@@ -42,7 +43,7 @@ namespace Diligent
 class GLContextState
 {
 public:
-    GLContextState(class RenderDeviceGLImpl* pDeviceGL);
+    GLContextState(class RenderDeviceGLImpl* pDeviceGL, DeviceContextStateFilterCounters* pCounters = nullptr);
 
     // clang-format off
 
@@ -111,6 +112,11 @@ public:
 
     GLContext::NativeGLContextType GetCurrentGLContext() const { return m_CurrentGLContext; }
 
+    // Returns the version of texture, sampler, image, uniform and storage buffer unit bindings.
+    // The version changes every time any of these bindings changes or the state is invalidated,
+    // so if it is the same as before, the resources bound to the units are the same too.
+    Uint32 GetResourceBindingsVersion() const { return m_ResourceBindingsVersion; }
+
     struct ContextCaps
     {
         bool  IsFillModeSelectionSupported = true;
@@ -135,6 +141,17 @@ public:
                                   GLenum     filter);
 
 private:
+    void CountBinding(bool Issued)
+    {
+        if (m_pCounters != nullptr)
+        {
+            if (Issued)
+                ++m_pCounters->BindingsIssued;
+            else
+                ++m_pCounters->BindingsSkipped;
+        }
+    }
+
     // It is unsafe to use GL handle to keep track of bound objects
     // When an object is released, GL is free to reuse its handle for
     // the new created objects.
@@ -312,6 +329,10 @@ private:
     Int32             m_NumPatchVertices = -1;
 
     GLContext::NativeGLContextType m_CurrentGLContext = {};
+
+    DeviceContextStateFilterCounters* const m_pCounters;
+
+    Uint32 m_ResourceBindingsVersion = 0;
 };
 
 } // namespace Diligent
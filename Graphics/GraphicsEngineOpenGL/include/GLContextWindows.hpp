@@ -44,9 +44,20 @@ public:
 
     NativeGLContextType GetCurrentNativeGLContext();
 
+    /// Creates a context that shares objects with the main context and
+    /// can be made current on a worker thread.
+    bool CreateWorkerContext();
+    /// Binds the worker context to the calling thread, or unbinds it if Bind is false.
+    bool BindWorkerContext(bool Bind);
+    /// Destroys the worker context. The context must not be current on any thread.
+    void DestroyWorkerContext();
+
 private:
     HGLRC m_Context                     = NULL;
     HDC   m_WindowHandleToDeviceContext = NULL;
+
+    HGLRC m_WorkerContext = NULL;
+    HDC   m_WorkerDC      = NULL;
 };
 
 } // namespace Diligent
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLDynamicHeap class
+
+#include <deque>
+#include <utility>
+
+#include "MemoryAllocator.h"
+#include "GLObjectWrapper.hpp"
+#include "RingBuffer.hpp"
+
+namespace Diligent
+{
+
+/// Persistently mapped ring buffer that dynamic uniform buffers are suballocated from.
+
+/// The heap is a single buffer object created with glBufferStorage() and mapped once with
+/// GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT. Mapping a dynamic buffer only bumps the ring
+/// buffer head and does not involve the driver. At the end of every frame, the heap inserts
+/// a fence into the command stream; the memory allocated in the frame is recycled once the
+/// fence is signaled.
+///
+/// The class is not thread-safe and must only be used by the immediate context.
+class GLDynamicHeap
+{
+public:
+    GLDynamicHeap(IMemoryAllocator& Allocator, Uint32 Size, Uint32 Alignment) noexcept(false);
+    ~GLDynamicHeap();
+
+    // clang-format off
+    GLDynamicHeap             (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap             (      GLDynamicHeap&&) = delete;
+    GLDynamicHeap& operator = (const GLDynamicHeap&)  = delete;
+    GLDynamicHeap& operator = (      GLDynamicHeap&&) = delete;
+    // clang-format on
+
+    struct Allocation
+    {
+        Uint64 Offset      = 0;
+        Uint8* pCPUAddress = nullptr;
+
+        explicit operator bool() const
+        {
+            return pCPUAddress != nullptr;
+        }
+    };
+
+    /// Allocates Size bytes from the heap. Returns an empty allocation if the heap is exhausted.
+    Allocation Allocate(Uint64 Size);
+
+    /// Inserts the end-of-frame fence and recycles the memory of all completed frames.
+    void FinishFrame();
+
+    const GLObjectWrappers::GLBufferObj& GetGLBuffer() const { return m_GLBuffer; }
+
+private:
+    void ReleaseCompletedFrames();
+
+    GLObjectWrappers::GLBufferObj m_GLBuffer;
+
+    Uint8* m_pCPUAddress = nullptr;
+
+    const Uint32 m_Alignment;
+
+    RingBuffer m_RingBuffer;
+
+    // Fences of the frames whose memory has not been recycled yet
+    std::deque<std::pair<Uint64, GLObjectWrappers::GLSyncObj>> m_PendingFrames;
+
+    Uint64 m_FrameNumber = 1;
+
+    bool m_CurrFrameHasAllocations = false;
+
+    size_t m_PeakUsedSize      = 0;
+    Uint32 m_FailedAllocations = 0;
+};
+
+} // namespace Diligent
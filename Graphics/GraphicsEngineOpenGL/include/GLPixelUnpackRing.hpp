@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLPixelUnpackRing class
+
+#include <array>
+
+#include "Buffer.h"
+#include "RefCntAutoPtr.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceGLImpl;
+class GLContextState;
+
+/// Ring of pixel unpack buffers that texture data in CPU memory is uploaded through.
+
+/// glTexSubImage*() called with a pointer to CPU memory copies the data synchronously, which stalls
+/// the render thread for large uploads. Instead, the data is copied into the next buffer of the ring
+/// and the texture is updated from that buffer, so that the transfer is performed by the GPU.
+/// Every buffer is protected by a fence inserted after the texture update. If the fence of the
+/// next buffer has not been signaled yet, the buffer is orphaned by mapping it with
+/// GL_MAP_INVALIDATE_BUFFER_BIT, which lets the driver allocate new storage instead of waiting.
+///
+/// The class is not thread-safe and must only be used by the immediate context.
+class GLPixelUnpackRing
+{
+public:
+    /// The number of buffers in the ring
+    static constexpr Uint32 NumBuffers = 4;
+
+    /// Uploads smaller than this size are performed directly from CPU memory
+    static constexpr Uint64 MinUploadSize = Uint64{16} << 10;
+
+    explicit GLPixelUnpackRing(RenderDeviceGLImpl* pDevice) noexcept;
+    ~GLPixelUnpackRing();
+
+    // clang-format off
+    GLPixelUnpackRing             (const GLPixelUnpackRing&)  = delete;
+    GLPixelUnpackRing             (      GLPixelUnpackRing&&) = delete;
+    GLPixelUnpackRing& operator = (const GLPixelUnpackRing&)  = delete;
+    GLPixelUnpackRing& operator = (      GLPixelUnpackRing&&) = delete;
+    // clang-format on
+
+    /// Copies Size bytes from pData to the beginning of the next buffer in the ring.
+
+    /// \return     The buffer that contains the data, or null if the buffer could not be created.
+    ///
+    /// \remarks    Every successful call must be followed by EndUpload() after all
+    ///             commands that read the buffer have been issued.
+    IBuffer* BeginUpload(GLContextState& CtxState, const void* pData, Uint64 Size);
+
+    /// Inserts the fence that protects the buffer returned by the last BeginUpload() call.
+    void EndUpload();
+
+private:
+    RenderDeviceGLImpl* const m_pDevice;
+
+    struct BufferInfo
+    {
+        RefCntAutoPtr<IBuffer>      pBuffer;
+        GLObjectWrappers::GLSyncObj Fence;
+    };
+    std::array<BufferInfo, NumBuffers> m_Buffers;
+
+    Uint32 m_CurrBuffer  = 0;
+    bool   m_IsUploading = false;
+
+    Uint32 m_NumUploads         = 0;
+    Uint32 m_NumOrphanedUploads = 0;
+    Uint64 m_TotalUploadSize    = 0;
+};
+
+} // namespace Diligent
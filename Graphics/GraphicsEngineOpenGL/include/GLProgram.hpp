@@ -32,6 +32,9 @@
 #include "GLObjectWrapper.hpp"
 #include "ShaderResourcesGL.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
+#include "GLWorkerThread.hpp"
+#include "RefCntAutoPtr.hpp"
 
 namespace Diligent
 {
@@ -42,9 +45,11 @@ class GLContextState;
 class GLProgram
 {
 public:
-    GLProgram(ShaderGLImpl* const* ppShaders,
-              Uint32               NumShaders,
-              bool                 IsSeparableProgram) noexcept;
+    GLProgram(ShaderGLImpl* const*      ppShaders,
+              Uint32                    NumShaders,
+              bool                      IsSeparableProgram,
+              PipelineStateCacheGLImpl* pPSOCache     = nullptr,
+              GLWorkerThread*           pWorkerThread = nullptr) noexcept;
     ~GLProgram();
 
     const GLObjectWrappers::GLProgramObj& GetGLHandle() const { return m_GLProg; }
@@ -82,6 +87,14 @@ private:
     std::vector<const ShaderGLImpl*> m_AttachedShaders;
     std::string                      m_InfoLog;
 
+    // Cache to store the program binary in once the program is linked
+    RefCntAutoPtr<PipelineStateCacheGLImpl> m_pPSOCache;
+    // Hash of the program shader sources that identifies the program binary in the cache
+    Uint64 m_BinaryKey = 0;
+
+    // Pending link task when the program is linked by the worker thread
+    GLWorkerThread::TaskFuture m_LinkTask;
+
     LinkStatus m_LinkStatus      = LinkStatus::Undefined;
     bool       m_BindingsApplied = false;
 
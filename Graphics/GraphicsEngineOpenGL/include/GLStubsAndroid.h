@@ -1231,6 +1231,28 @@ void UnsupportedGLFunctionStub( const T &Name )
     typedef void (GL_APIENTRY* PFNGLSHADERSTORAGEBLOCKBINDINGPROC) (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding);
     extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC glShaderStorageBlockBinding;
 
+    #define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+
+    #define LOAD_GL_BIND_VERTEX_BUFFER
+    typedef void (GL_APIENTRY* PFNGLBINDVERTEXBUFFERPROC) (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+    extern PFNGLBINDVERTEXBUFFERPROC glBindVertexBuffer;
+
+    #define LOAD_GL_VERTEX_ATTRIB_FORMAT
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBFORMATPROC) (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+    extern PFNGLVERTEXATTRIBFORMATPROC glVertexAttribFormat;
+
+    #define LOAD_GL_VERTEX_ATTRIB_I_FORMAT
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBIFORMATPROC) (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset);
+    extern PFNGLVERTEXATTRIBIFORMATPROC glVertexAttribIFormat;
+
+    #define LOAD_GL_VERTEX_ATTRIB_BINDING
+    typedef void (GL_APIENTRY* PFNGLVERTEXATTRIBBINDINGPROC) (GLuint attribindex, GLuint bindingindex);
+    extern PFNGLVERTEXATTRIBBINDINGPROC glVertexAttribBinding;
+
+    #define LOAD_GL_VERTEX_BINDING_DIVISOR
+    typedef void (GL_APIENTRY* PFNGLVERTEXBINDINGDIVISORPROC) (GLuint bindingindex, GLuint divisor);
+    extern PFNGLVERTEXBINDINGDIVISORPROC glVertexBindingDivisor;
+
 #endif //GL_ES_VERSION_3_1
 
 // GL_OES_texture_buffer or GL_EXT_texture_buffer or 3.2
@@ -1380,6 +1402,11 @@ extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC glMultiDrawElementsIndirect;
 typedef void (GL_APIENTRYP PFNGLCLIPCONTROLPROC) (GLenum origin, GLenum depth);
 extern PFNGLCLIPCONTROLPROC glClipControl;
 
+// GL_EXT_buffer_storage
+#define LOAD_GL_BUFFER_STORAGE
+typedef void (GL_APIENTRYP PFNGLBUFFERSTORAGEPROC) (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+extern PFNGLBUFFERSTORAGEPROC glBufferStorage;
+
 #ifndef GL_ES_VERSION_3_2
 
     typedef void (GL_APIENTRY* GLDEBUGPROC) (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam);
@@ -657,6 +657,10 @@
 #    define GL_DOUBLE_VEC4 0x8FFE
 #endif
 
+#ifndef GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET
+#    define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+#endif
+
 
 // Define unsupported GL function stubs
 // We need a Variatic Template to turn off the warning about unused variables
@@ -689,7 +693,15 @@ static void (*glTextureView)(GLuint texture, GLenum target, GLuint origtexture,
 #define glTexStorage3DMultisample(...) UnsupportedGLFunctionStub("glTexStorage3DMultisample", __VA_ARGS__)
 #define glGetTexLevelParameteriv(...)  UnsupportedGLFunctionStub("glGetTexLevelParameteriv", __VA_ARGS__)
 #define glClipControl(...)             UnsupportedGLFunctionStub("glClipControl", __VA_ARGS__)
+#define glBufferStorage(...)           UnsupportedGLFunctionStub("glBufferStorage", __VA_ARGS__)
 #define glDepthRangeIndexed(...)       UnsupportedGLFunctionStub("glDepthRangeIndexed", __VA_ARGS__)
+#define glGetProgramBinary(...)        UnsupportedGLFunctionStub("glGetProgramBinary", __VA_ARGS__)
+#define glProgramBinary(...)           UnsupportedGLFunctionStub("glProgramBinary", __VA_ARGS__)
+#define glBindVertexBuffer(...)        UnsupportedGLFunctionStub("glBindVertexBuffer", __VA_ARGS__)
+#define glVertexAttribFormat(...)      UnsupportedGLFunctionStub("glVertexAttribFormat", __VA_ARGS__)
+#define glVertexAttribIFormat(...)     UnsupportedGLFunctionStub("glVertexAttribIFormat", __VA_ARGS__)
+#define glVertexAttribBinding(...)     UnsupportedGLFunctionStub("glVertexAttribBinding", __VA_ARGS__)
+#define glVertexBindingDivisor(...)    UnsupportedGLFunctionStub("glVertexBindingDivisor", __VA_ARGS__)
 static void (*glPolygonMode)(GLenum face, GLenum mode) = nullptr;
 #define glEnablei(...)                UnsupportedGLFunctionStub("glEnablei")
 #define glBlendFuncSeparatei(...)     UnsupportedGLFunctionStub("glBlendFuncSeparatei", __VA_ARGS__)
@@ -655,8 +655,18 @@ static void (*glPolygonMode)(GLenum face, GLenum mode) = nullptr;
 #define glFramebufferTexture1D(...)   UnsupportedGLFunctionStub("glFramebufferTexture1D")
 #define glCopyTexSubImage1D(...)      UnsupportedGLFunctionStub("glCopyTexSubImage1D")
 #define glClipControl(...)            UnsupportedGLFunctionStub("glClipControl")
+#define glBufferStorage(...)          UnsupportedGLFunctionStub("glBufferStorage")
+#define glBindVertexBuffer(...)       UnsupportedGLFunctionStub("glBindVertexBuffer")
+#define glVertexAttribFormat(...)     UnsupportedGLFunctionStub("glVertexAttribFormat")
+#define glVertexAttribIFormat(...)    UnsupportedGLFunctionStub("glVertexAttribIFormat")
+#define glVertexAttribBinding(...)    UnsupportedGLFunctionStub("glVertexAttribBinding")
+#define glVertexBindingDivisor(...)   UnsupportedGLFunctionStub("glVertexBindingDivisor")
 static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64* params) = nullptr;
 
+#ifndef GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET
+#    define GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET 0x82D9
+#endif
+
 #ifndef GL_BUFFER
 #    define GL_BUFFER 0x82E0
 #endif
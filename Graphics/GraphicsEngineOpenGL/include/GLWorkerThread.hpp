@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GLWorkerThread class
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <deque>
+
+#include "GLContext.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+/// Background thread that executes GL commands in a worker context that shares objects with the main context.
+
+/// The worker is used to compile shaders and link programs when the driver does not support
+/// GL_KHR_parallel_shader_compile. GL commands issued by the calling context before a task is
+/// enqueued are visible to the task, and commands issued by the task are made visible to the
+/// calling context by WaitForTask(). In both directions, synchronization is done with fence sync objects.
+class GLWorkerThread
+{
+public:
+    /// Creates the worker context and starts the thread.
+    /// Throws an exception if the worker context can't be created.
+    explicit GLWorkerThread(GLContext& Context) noexcept(false);
+    ~GLWorkerThread();
+
+    // clang-format off
+    GLWorkerThread           (const GLWorkerThread&)  = delete;
+    GLWorkerThread           (      GLWorkerThread&&) = delete;
+    GLWorkerThread& operator=(const GLWorkerThread&)  = delete;
+    GLWorkerThread& operator=(      GLWorkerThread&&) = delete;
+    // clang-format on
+
+    /// The future holds the fence that is signaled when the task's GL commands are complete.
+    using TaskFuture = std::future<GLObjectWrappers::GLSyncObj>;
+
+    /// Enqueues the task to be executed by the worker thread.
+    /// This method must be called by the thread that owns the main GL context.
+    TaskFuture EnqueueTask(std::function<void()> Task);
+
+    /// Returns true if the task has been executed by the worker thread.
+    static bool IsTaskComplete(const TaskFuture& Task);
+
+    /// Waits until the task is executed by the worker thread and makes the
+    /// results of its GL commands visible to the current context.
+    static void WaitForTask(TaskFuture& Task);
+
+private:
+    void WorkerThreadProc(std::promise<bool>& InitPromise);
+
+    GLContext& m_Context;
+
+    std::mutex                                                    m_QueueMtx;
+    std::condition_variable                                       m_QueueCV;
+    std::deque<std::packaged_task<GLObjectWrappers::GLSyncObj()>> m_Queue;
+    bool                                                          m_Stop = false;
+
+    std::thread m_Thread;
+};
+
+} // namespace Diligent
@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateCacheGLImpl class
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "EngineGLImplTraits.hpp"
+#include "PipelineStateCacheBase.hpp"
+#include "GLObjectWrapper.hpp"
+
+namespace Diligent
+{
+
+/// Pipeline state cache implementation in OpenGL backend.
+
+/// OpenGL has no pipeline cache objects, so the cache stores linked program binaries
+/// (see glGetProgramBinary) keyed by the hash of the program's shader sources. The cache data
+/// is only valid for the driver it was created with: the vendor, renderer and version strings
+/// are written to the data header, and data created by a different driver is ignored.
+class PipelineStateCacheGLImpl final : public PipelineStateCacheBase<EngineGLImplTraits>
+{
+public:
+    using TPipelineStateCacheBase = PipelineStateCacheBase<EngineGLImplTraits>;
+
+    PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                             RenderDeviceGLImpl*                 pDeviceGL,
+                             const PipelineStateCacheCreateInfo& CreateInfo);
+    ~PipelineStateCacheGLImpl();
+
+    /// Implementation of IPipelineStateCache::GetData().
+    virtual void DILIGENT_CALL_TYPE GetData(IDataBlob** ppBlob) override final;
+
+    /// Tries to load the program binary with the given key into the program object.
+    /// Returns true if the binary was found and the program was successfully linked.
+    /// If the binary is rejected by the driver, it is removed from the cache, and
+    /// the program must be linked from the shaders.
+    bool LoadProgram(const GLObjectWrappers::GLProgramObj& GLProg, Uint64 Key);
+
+    /// Retrieves the binary of the successfully linked program and stores it in the cache.
+    void StoreProgram(const GLObjectWrappers::GLProgramObj& GLProg, Uint64 Key);
+
+private:
+    void InitFromData(const void* pData, size_t DataSize);
+
+    struct ProgramBinary
+    {
+        GLenum             Format = 0;
+        std::vector<Uint8> Data;
+    };
+
+    // Vendor, renderer and version strings of the driver
+    const std::string m_DriverInfo;
+
+    std::mutex                                m_ProgramsMtx;
+    std::unordered_map<Uint64, ProgramBinary> m_Programs;
+};
+
+} // namespace Diligent
@@ -126,7 +126,7 @@ private:
     using SharedGLProgramPtr         = std::shared_ptr<GLProgram>;
     SharedGLProgramPtr* m_GLPrograms = nullptr; // [m_NumPrograms]
 
-    Threading::SpinLock m_ProgPipelineLock;
+    Threading::AdaptiveLock m_ProgPipelineLock;
 
     std::vector<std::pair<GLContext::NativeGLContextType, GLObjectWrappers::GLPipelineObj>> m_GLProgPipelines;
 
@@ -40,6 +40,9 @@
 namespace Diligent
 {
 
+class GLDynamicHeap;
+class GLWorkerThread;
+
 /// Render device implementation in OpenGL backend.
 // RenderDeviceGLESImpl is inherited from RenderDeviceGLImpl
 class RenderDeviceGLImpl : public RenderDeviceBase<EngineGLImplTraits>
@@ -210,6 +213,7 @@ public:
         GLint MaxTextureUnits;
         GLint MaxStorageBlock;
         GLint MaxImagesUnits;
+        GLint MaxVertexAttribRelativeOffset;
     };
     const GLDeviceLimits& GetDeviceLimits() const { return m_DeviceLimits; }
 
@@ -217,9 +221,25 @@ public:
     {
         bool FramebufferSRGB  = false;
         bool SemalessCubemaps = false;
+        bool BufferStorage    = false;
+        bool ProgramBinary    = false;
+        // GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile
+        bool ParallelShaderCompile = false;
+        // glVertexAttribFormat/glBindVertexBuffer (GL4.3, GL_ARB_vertex_attrib_binding or GLES3.1)
+        bool VertexAttribBinding = false;
+        // Writing query results into a buffer bound to GL_QUERY_BUFFER (GL4.4 or GL_ARB_query_buffer_object)
+        bool QueryBuffer = false;
+        // GL_QUERY_WAIT_INVERTED conditional render mode (GL4.5 or GL_ARB_conditional_render_inverted)
+        bool ConditionalRenderInverted = false;
     };
     const GLDeviceCaps& GetGLCaps() const { return m_GLCaps; }
 
+    /// Returns the dynamic heap, or null if persistent buffer mapping is not supported or the heap is disabled.
+    GLDynamicHeap* GetDynamicHeap() const { return m_pDynamicHeap.get(); }
+
+    /// Returns the worker thread that owns the background GL context, or null if the worker context is disabled.
+    GLWorkerThread* GetWorkerThread() const { return m_pWorkerThread.get(); }
+
 protected:
     friend class DeviceContextGLImpl;
     friend class TextureBaseGL;
@@ -235,14 +255,20 @@ protected:
 
     std::unordered_set<String> m_ExtensionStrings;
 
-    Threading::SpinLock                                          m_VAOCacheLock;
+    Threading::AdaptiveLock                                      m_VAOCacheLock;
     std::unordered_map<GLContext::NativeGLContextType, VAOCache> m_VAOCache;
+    const Uint32                                                 m_VAOCacheSize;
 
-    Threading::SpinLock                                          m_FBOCacheLock;
+    Threading::AdaptiveLock                                      m_FBOCacheLock;
     std::unordered_map<GLContext::NativeGLContextType, FBOCache> m_FBOCache;
 
     GLProgramCache m_ProgramCache;
 
+    std::unique_ptr<GLDynamicHeap> m_pDynamicHeap;
+
+    // Must be destroyed before m_GLContext as it releases the worker context
+    std::unique_ptr<GLWorkerThread> m_pWorkerThread;
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     bool         CheckExtension(const Char* ExtensionString) const;
@@ -76,6 +76,10 @@ public:
 
     SHADER_SOURCE_LANGUAGE GetSourceLanguage() const { return m_SourceLanguage; }
 
+    /// Returns the hash of the full GLSL source string. Unlike the unique ID, the hash
+    /// is stable between runs and is used to look up program binaries in the PSO cache.
+    size_t GetSourceHash() const { return m_SourceHash; }
+
     virtual void DILIGENT_CALL_TYPE GetBytecode(const void** ppData,
                                                 Uint64&      DataSize) const override final
     {
@@ -92,6 +96,7 @@ private:
 private:
     SHADER_SOURCE_LANGUAGE                   m_SourceLanguage = SHADER_SOURCE_LANGUAGE_DEFAULT;
     std::string                              m_GLSLSourceString;
+    size_t                                   m_SourceHash = 0;
     GLObjectWrappers::GLShaderObj            m_GLShaderObj;
     std::shared_ptr<const ShaderResourcesGL> m_pShaderResources;
 
@@ -71,12 +71,13 @@ public:
         Uint32 RangeSize     = 0;
         Uint32 DynamicOffset = 0;
 
-        // In OpenGL dynamic buffers are only those that are not bound as a whole and
-        // can use a dynamic offset, irrespective of the variable type or whether the
-        // buffer is USAGE_DYNAMIC or not.
+        // In OpenGL dynamic buffers are those that are not bound as a whole and
+        // can use a dynamic offset, irrespective of the variable type, as well as
+        // USAGE_DYNAMIC buffers whose contents move within the dynamic heap every
+        // time they are mapped.
         bool IsDynamic() const
         {
-            return pBuffer && RangeSize < pBuffer->GetDesc().Size;
+            return pBuffer && (RangeSize < pBuffer->GetDesc().Size || pBuffer->IsDynamicHeapBacked());
         }
     };
 
@@ -345,11 +346,24 @@ public:
         return m_DynamicUBOMask != 0 || m_DynamicSSBOMask != 0;
     }
 
+    // Returns the revision of the cache contents. The revision changes every time any resource
+    // in the cache changes, and no two caches ever share the same revision, so if it is the same
+    // as before, the cache contains the same resources.
+    Uint64 GetContentRevision() const { return m_ContentRevision; }
+
 #ifdef DILIGENT_DEBUG
     void DbgVerifyDynamicBufferMasks() const;
 #endif
 
 private:
+    void UpdateRevision()
+    {
+        ShaderResourceCacheBase::UpdateRevision();
+        m_ContentRevision = GenerateContentRevision();
+    }
+
+    static Uint64 GenerateContentRevision();
+
     CachedUB& GetUB(Uint32 CacheOffset)
     {
         return const_cast<CachedUB&>(const_cast<const ShaderResourceCacheGL*>(this)->GetConstUB(CacheOffset));
@@ -392,6 +406,8 @@ private:
     // Indicates what types of resources are stored in the cache
     const ResourceCacheContentType m_ContentType;
 
+    Uint64 m_ContentRevision = GenerateContentRevision();
+
 #ifdef DILIGENT_DEVELOPMENT
     bool m_bStaticResourcesInitialized = false;
 #endif
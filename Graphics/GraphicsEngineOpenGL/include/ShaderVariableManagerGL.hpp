@@ -69,6 +69,8 @@ class ShaderVariableManagerGL : ShaderVariableManagerBase<EngineGLImplTraits, vo
 {
 public:
     using TBase = ShaderVariableManagerBase<EngineGLImplTraits, void>;
+    using TBase::GetResourceCache;
+    using TBase::GetSignature;
     ShaderVariableManagerGL(IObject& Owner, ShaderResourceCacheGL& ResourceCache) noexcept :
         TBase{Owner, ResourceCache}
     {}
@@ -252,7 +254,7 @@ private:
     }
 
     template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(const Char* Name) const;
+    IShaderResourceVariable* GetResourceByResIndex(Uint32 ResIndex) const;
 
     template <typename THandleUB,
               typename THandleTexture,
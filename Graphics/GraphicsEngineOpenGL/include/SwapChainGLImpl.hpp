@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "SwapChainGL.h"
 #include "SwapChainGLBase.hpp"
 #include "GLObjectWrapper.hpp"
@@ -63,6 +65,13 @@ public:
 
     /// Implementation of ISwapChainGL::GetDefaultFBO().
     virtual GLuint DILIGENT_CALL_TYPE GetDefaultFBO() const override final { return 0; }
+
+private:
+#if PLATFORM_EMSCRIPTEN
+    // Empty if the engine is attached to an existing context
+    std::string m_CanvasId;
+    bool        m_ExplicitSwapControl = false;
+#endif
 };
 
 } // namespace Diligent
@@ -29,6 +29,7 @@
 
 #include <cstring>
 #include <vector>
+#include <list>
 #include <unordered_map>
 
 #include "GraphicsTypes.h"
@@ -47,7 +48,20 @@ class BufferGLImpl;
 class VAOCache
 {
 public:
-    VAOCache();
+    struct CreateInfo
+    {
+        // Whether separate vertex attribute formats are supported (glVertexAttribFormat, glBindVertexBuffer).
+        // In this case, a single VAO is created for every pipeline and buffers are bound to it at draw time.
+        bool UseVertexAttribBinding = false;
+
+        // GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET. Pipelines with larger relative offsets use buffer-specific VAOs.
+        Uint32 MaxRelativeOffset = 0;
+
+        // The maximum number of buffer-specific VAOs. When the limit is reached, the least
+        // recently used VAOs are released. Zero means no limit.
+        Uint32 MaxSize = 0;
+    };
+    explicit VAOCache(const CreateInfo& CI);
     ~VAOCache();
 
     // clang-format off
@@ -123,12 +137,53 @@ private:
     // Clears stale entries from m_PSOToKey and m_BuffToKey when a VAO is removed from m_Cache
     void ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys);
 
-    Threading::SpinLock                                                                    m_CacheLock;
-    std::unordered_map<VAOHashKey, GLObjectWrappers::GLVertexArrayObj, VAOHashKey::Hasher> m_Cache;
+    // Removes the VAO from m_Cache and m_LRUList
+    void EraseVAO(const VAOHashKey& Key);
+
+    // Returns the VAO with separate vertex attribute formats for the pipeline, with the
+    // buffers from the attribs bound to it, or null if the pipeline layout can't be expressed
+    // with separate formats.
+    const GLObjectWrappers::GLVertexArrayObj* GetLayoutVAO(const VAOAttribs& Attribs, class GLContextState& GLState);
+
+    const CreateInfo m_CI;
+
+    Threading::AdaptiveLock m_CacheLock;
+
+    struct CachedVAO
+    {
+        GLObjectWrappers::GLVertexArrayObj VAO;
+
+        // Position of the key in m_LRUList
+        std::list<const VAOHashKey*>::iterator LRUIt;
+    };
+    std::unordered_map<VAOHashKey, CachedVAO, VAOHashKey::Hasher> m_Cache;
+
+    // Keys of m_Cache, from the most to the least recently used
+    std::list<const VAOHashKey*> m_LRUList;
 
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_PSOToKey;
     std::unordered_map<UniqueIdentifier, std::vector<VAOHashKey>> m_BuffToKey;
 
+    // VAO with separate vertex attribute formats. The layout is set once, and only
+    // buffer bindings that differ from the currently bound ones are changed at draw time.
+    struct LayoutVAO
+    {
+        // Null if the pipeline layout can't be expressed with separate formats
+        GLObjectWrappers::GLVertexArrayObj VAO{false};
+
+        UniqueIdentifier IndexBufferUId = -1;
+
+        VAOHashKey::StreamAttribs Streams[MAX_BUFFER_SLOTS];
+
+        LayoutVAO()
+        {
+            for (auto& Stream : Streams)
+                Stream = {-1, 0};
+        }
+    };
+    // Layout VAOs, indexed by the PSO unique ID
+    std::unordered_map<UniqueIdentifier, LayoutVAO> m_LayoutVAOs;
+
     // Any draw command fails if no VAO is bound. We will use this empty
     // VAO for draw commands with null input layout, such as these that
     // only use VertexID as input.
@@ -69,6 +69,17 @@ static GLenum GetBufferBindTarget(const BufferDesc& Desc)
 
     return Target;
 }
+
+static GLDynamicHeap* GetBufferDynamicHeap(const RenderDeviceGLImpl* pDeviceGL, const BufferDesc& Desc)
+{
+    // Only uniform buffers are suballocated from the heap: they are the only buffers
+    // bound with an explicit range through the resource cache, see ShaderResourceCacheGL.
+    if (Desc.Usage == USAGE_DYNAMIC && Desc.BindFlags == BIND_UNIFORM_BUFFER)
+        return pDeviceGL->GetDynamicHeap();
+    else
+        return nullptr;
+}
+
 BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
                            FixedBlockMemoryAllocator& BuffViewObjMemAllocator,
                            RenderDeviceGLImpl*        pDeviceGL,
@@ -87,7 +98,8 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
     },
     m_GlBuffer    {true                          }, // Create buffer immediately
     m_BindTarget  {GetBufferBindTarget(BuffDesc) },
-    m_GLUsageHint {UsageToGLUsage(BuffDesc)}
+    m_GLUsageHint {UsageToGLUsage(BuffDesc)},
+    m_pDynamicHeap{GetBufferDynamicHeap(pDeviceGL, BuffDesc)}
 // clang-format on
 {
     ValidateBufferInitData(BuffDesc, pBuffData);
@@ -144,8 +156,33 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
 
     // All buffer bind targets (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER etc.) relate to the same
     // kind of objects. As a result they are all equivalent from a transfer point of view.
-    glBufferData(m_BindTarget, StaticCast<GLsizeiptr>(BuffDesc.Size), pData, m_GLUsageHint);
-    DEV_CHECK_GL_ERROR("glBufferData() failed");
+    if ((m_Desc.MiscFlags & MISC_BUFFER_FLAG_PERSISTENT_MAP) != 0 && m_pDynamicHeap == nullptr)
+    {
+        if (pDeviceGL->GetGLCaps().BufferStorage)
+        {
+            // Immutable storage that stays mapped for the lifetime of the buffer
+            constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(m_BindTarget, StaticCast<GLsizeiptr>(BuffDesc.Size), pData, StorageFlags);
+            CHECK_GL_ERROR_AND_THROW("Failed to allocate persistent storage for buffer '", m_Desc.Name, "'");
+
+            m_pPersistentData = static_cast<Uint8*>(glMapBufferRange(m_BindTarget, 0, StaticCast<GLsizeiptr>(BuffDesc.Size), StorageFlags));
+            CHECK_GL_ERROR_AND_THROW("Failed to persistently map buffer '", m_Desc.Name, "'");
+            if (m_pPersistentData == nullptr)
+                LOG_ERROR_AND_THROW("Persistent mapping of buffer '", m_Desc.Name, "' returned null pointer");
+        }
+        else
+        {
+            LOG_WARNING_MESSAGE_ONCE("Persistent buffer mapping is not supported by this device: glBufferStorage is not available.");
+            m_Desc.MiscFlags &= ~MISC_BUFFER_FLAG_PERSISTENT_MAP;
+        }
+    }
+    // Dynamic uniform buffers suballocated from the dynamic heap are already persistently mapped
+
+    if (m_pPersistentData == nullptr)
+    {
+        glBufferData(m_BindTarget, StaticCast<GLsizeiptr>(BuffDesc.Size), pData, m_GLUsageHint);
+        DEV_CHECK_GL_ERROR("glBufferData() failed");
+    }
     GLState.BindBuffer(m_BindTarget, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
 
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
@@ -201,7 +238,8 @@ BufferGLImpl::BufferGLImpl(IReferenceCounters*        pRefCounters,
     // Attach to external buffer handle
     m_GlBuffer    {true, GLObjectWrappers::GLBufferObjCreateReleaseHelper(GLHandle)},
     m_BindTarget  {GetBufferBindTarget(m_Desc)},
-    m_GLUsageHint {UsageToGLUsage(BuffDesc)   }
+    m_GLUsageHint {UsageToGLUsage(BuffDesc)   },
+    m_pDynamicHeap{nullptr                    } // External buffers always use their own storage
 // clang-format on
 {
     m_MemoryProperties = MEMORY_PROPERTY_HOST_COHERENT;
@@ -251,9 +289,13 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
     // Neither target is used for anything else by OpenGL, and so you can safely bind buffers to them for
     // the purposes of copying or staging data without disturbing OpenGL state or needing to keep track of
     // what was bound to the target before your copy.
+    // Contents of dynamic buffers may live in the dynamic heap
+    SrcOffset += SrcBufferGL.GetActiveOffset();
+    DstOffset += GetActiveOffset();
+
     constexpr bool ResetVAO = false; // No need to reset VAO for READ/WRITE targets
-    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, m_GlBuffer, ResetVAO);
-    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.m_GlBuffer, ResetVAO);
+    CtxState.BindBuffer(GL_COPY_WRITE_BUFFER, GetActiveGLHandle(), ResetVAO);
+    CtxState.BindBuffer(GL_COPY_READ_BUFFER, SrcBufferGL.GetActiveGLHandle(), ResetVAO);
     glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, StaticCast<GLintptr>(SrcOffset), StaticCast<GLintptr>(DstOffset), StaticCast<GLsizeiptr>(Size));
     DEV_CHECK_GL_ERROR("glCopyBufferSubData() failed");
     CtxState.BindBuffer(GL_COPY_READ_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
@@ -262,6 +304,42 @@ void BufferGLImpl::CopyData(GLContextState& CtxState, BufferGLImpl& SrcBufferGL,
 
 void BufferGLImpl::Map(GLContextState& CtxState, MAP_TYPE MapType, Uint32 MapFlags, PVoid& pMappedData)
 {
+    if (m_pPersistentData != nullptr)
+    {
+        VERIFY(MapType == MAP_WRITE, "Persistently mapped buffers can only be mapped for writing");
+        if ((MapFlags & MAP_FLAG_DISCARD) != 0 && m_PersistentMapFence)
+        {
+            // The contents are overwritten in place, so wait until the GPU finishes
+            // all commands issued before the buffer was last unmapped.
+            auto res = glClientWaitSync(m_PersistentMapFence, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+            VERIFY_EXPR(res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED);
+            (void)res;
+            m_PersistentMapFence.Release();
+        }
+        pMappedData = m_pPersistentData;
+        return;
+    }
+
+    if (m_pDynamicHeap != nullptr && MapType == MAP_WRITE)
+    {
+        if (MapFlags & MAP_FLAG_DISCARD)
+        {
+            m_DynamicAllocation = m_pDynamicHeap->Allocate(m_Desc.Size);
+            if (!m_DynamicAllocation)
+            {
+                LOG_WARNING_MESSAGE_ONCE("Dynamic heap is exhausted. Falling back to mapping dynamic buffers through their own storage. "
+                                         "Consider increasing EngineGLCreateInfo::DynamicHeapSize.");
+            }
+        }
+
+        // With MAP_FLAG_NO_OVERWRITE, the buffer is mapped from wherever its contents currently are.
+        if (m_DynamicAllocation)
+        {
+            pMappedData = m_DynamicAllocation.pCPUAddress;
+            return;
+        }
+    }
+
     MapRange(CtxState, MapType, MapFlags, 0, m_Desc.Size, pMappedData);
 }
 
@@ -377,6 +455,21 @@ void BufferGLImpl::MapRange(GLContextState& CtxState, MAP_TYPE MapType, Uint32 M
 
 void BufferGLImpl::Unmap(GLContextState& CtxState)
 {
+    if (m_DynamicAllocation)
+    {
+        // Dynamic heap memory is coherent and stays mapped
+        return;
+    }
+
+    if (m_pPersistentData != nullptr)
+    {
+        // The storage stays mapped. The fence marks the last command that may use
+        // the current contents, see Map().
+        m_PersistentMapFence = GLObjectWrappers::GLSyncObj{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)};
+        DEV_CHECK_GL_ERROR("glFenceSync() failed");
+        return;
+    }
+
     constexpr bool ResetVAO = true;
     CtxState.BindBuffer(m_BindTarget, m_GlBuffer, ResetVAO);
     auto Result = glUnmapBuffer(m_BindTarget);
@@ -34,7 +34,7 @@ namespace Diligent
 {
 
 DearchiverGLImpl::DearchiverGLImpl(IReferenceCounters* pRefCounters, const DearchiverCreateInfo& CI) noexcept :
-    TDearchiverBase{pRefCounters, CI}
+    TDearchiverBase{pRefCounters, CI, DeviceType::OpenGL}
 {
 }
 
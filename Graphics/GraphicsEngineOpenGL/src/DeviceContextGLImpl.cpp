@@ -51,6 +51,7 @@
 #include "ShaderResourceBindingGLImpl.hpp"
 
 #include "GLTypeConversions.hpp"
+#include "GLDynamicHeap.hpp"
 #include "VAOCache.hpp"
 #include "GraphicsAccessories.hpp"
 
@@ -68,8 +69,13 @@ DeviceContextGLImpl::DeviceContextGLImpl(IReferenceCounters*      pRefCounters,
         pDeviceGL,
         Desc
     },
-    m_ContextState{pDeviceGL},
-    m_DefaultFBO  {false    }
+#ifdef DILIGENT_NO_CONTEXT_STATS
+    m_ContextState{pDeviceGL, nullptr},
+#else
+    m_ContextState{pDeviceGL, &m_Stats.StateFilterCounters},
+#endif
+    m_DefaultFBO  {false},
+    m_PixelUnpackRing{pDeviceGL}
 // clang-format on
 {
     m_BoundWritableTextures.reserve(16);
@@ -176,6 +182,8 @@ void DeviceContextGLImpl::TransitionShaderResources(IShaderResourceBinding* pSha
 
 void DeviceContextGLImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Commit);
+
     DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0);
 
     auto* const pShaderResBindingGL = ClassPtrCast<ShaderResourceBindingGLImpl>(pShaderResourceBinding);
@@ -205,6 +213,11 @@ void DeviceContextGLImpl::SetBlendFactors(const float* pBlendFactors)
     }
 }
 
+void DeviceContextGLImpl::SetDynamicRenderState(const DynamicRenderState& State)
+{
+    UNSUPPORTED("SetDynamicRenderState is not supported in OpenGL");
+}
+
 void DeviceContextGLImpl::SetVertexBuffers(Uint32                         StartSlot,
                                            Uint32                         NumBuffersSet,
                                            IBuffer* const*                ppBuffers,
@@ -688,6 +701,13 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
 
     m_CommittedResourcesTentativeBarriers = MEMORY_BARRIER_NONE;
 
+    // Resource caches bound by the previous call are only known to be still bound
+    // if no unit bindings have changed since then.
+    const Uint32 InitialBindingsVersion = m_ContextState.GetResourceBindingsVersion();
+    if (InitialBindingsVersion != m_ResourceBindingsVersion)
+        m_BoundResourceCaches.fill({});
+
+    const Uint32 ProcessedSRBMask = BindSRBMask;
     while (BindSRBMask != 0)
     {
         auto SignBit = ExtractLSB(BindSRBMask);
@@ -701,7 +721,22 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
         const auto* pResourceCache = m_BindInfo.ResourceCaches[sign];
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at index ", sign, " is null");
         if (m_BindInfo.StaleSRBMask & SignBit)
-            pResourceCache->BindResources(GetContextState(), BaseBindings, m_BoundWritableTextures, m_BoundWritableBuffers);
+        {
+            auto& BoundCache = m_BoundResourceCaches[sign];
+            if (BoundCache.Revision == pResourceCache->GetContentRevision() && BoundCache.BaseBindings == BaseBindings)
+            {
+                // The same resources are still bound to the same units, so only buffers with dynamic offsets may need to be updated
+                pResourceCache->BindDynamicBuffers(GetContextState(), BaseBindings);
+                DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.StateFilterCounters.ResourceCachesSkipped);
+            }
+            else
+            {
+                pResourceCache->BindResources(GetContextState(), BaseBindings, m_BoundWritableTextures, m_BoundWritableBuffers);
+                BoundCache.Revision     = pResourceCache->GetContentRevision();
+                BoundCache.BaseBindings = BaseBindings;
+                DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.StateFilterCounters.ResourceCachesBound);
+            }
+        }
         else
         {
             VERIFY((m_BindInfo.DynamicSRBMask & SignBit) != 0,
@@ -714,6 +749,23 @@ void DeviceContextGLImpl::BindProgramResources(Uint32 BindSRBMask)
     }
     m_BindInfo.StaleSRBMask &= ~m_BindInfo.ActiveSRBMask;
 
+    if (!m_BoundWritableTextures.empty() || !m_BoundWritableBuffers.empty())
+    {
+        // Writable resources set pending memory barriers that are executed when the resources
+        // are bound next time, so no cache may be skipped.
+        m_BoundResourceCaches.fill({});
+    }
+    else if (m_ContextState.GetResourceBindingsVersion() != InitialBindingsVersion)
+    {
+        // Caches that were not processed by this call may have been overwritten
+        for (Uint32 sign = 0; sign < m_BoundResourceCaches.size(); ++sign)
+        {
+            if ((ProcessedSRBMask & (1u << sign)) == 0)
+                m_BoundResourceCaches[sign] = {};
+        }
+    }
+    m_ResourceBindingsVersion = m_ContextState.GetResourceBindingsVersion();
+
 
 #if GL_ARB_shader_image_load_store
     // Go through the list of textures bound as AUVs and set the required memory barriers
@@ -856,6 +908,8 @@ inline void DrawArrays(GLenum  GlTopology,
 
 void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::Draw(Attribs, 0);
 
     GLenum GlTopology;
@@ -873,6 +927,57 @@ void DeviceContextGLImpl::Draw(const DrawAttribs& Attribs)
     PostDraw();
 }
 
+// Layouts of the commands read by glMultiDrawArraysIndirect and glMultiDrawElementsIndirect
+struct DrawArraysIndirectCommand
+{
+    GLuint Count;
+    GLuint InstanceCount;
+    GLuint First;
+    GLuint BaseInstance;
+};
+static_assert(sizeof(DrawArraysIndirectCommand) == 16, "Unexpected size of DrawArraysIndirectCommand");
+
+struct DrawElementsIndirectCommand
+{
+    GLuint Count;
+    GLuint InstanceCount;
+    GLuint FirstIndex;
+    GLint  BaseVertex;
+    GLuint BaseInstance;
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "Unexpected size of DrawElementsIndirectCommand");
+
+void* DeviceContextGLImpl::AllocateTransientDrawCommands(size_t Size, Uint32 FirstInstanceLocation, size_t& Offset)
+{
+#if GL_ARB_multi_draw_indirect
+    const auto DrawCommandCaps = m_pDevice->GetAdapterInfo().DrawCommand.CapFlags;
+    if ((DrawCommandCaps & DRAW_COMMAND_CAP_FLAG_NATIVE_MULTI_DRAW_INDIRECT) == 0)
+        return nullptr;
+
+    // baseInstance member of the indirect command is reserved and must be zero if first instance is not supported
+    if (FirstInstanceLocation != 0 && (DrawCommandCaps & DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE) == 0)
+        return nullptr;
+
+    auto* pDynamicHeap = m_pDevice->GetDynamicHeap();
+    if (pDynamicHeap == nullptr)
+        return nullptr;
+
+    // The heap memory is coherently mapped, so the commands written by the CPU are visible
+    // to the draw call without an explicit flush.
+    const auto Allocation = pDynamicHeap->Allocate(Size);
+    if (!Allocation)
+        return nullptr;
+
+    constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+    m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, pDynamicHeap->GetGLBuffer(), ResetVAO);
+
+    Offset = StaticCast<size_t>(Allocation.Offset);
+    return Allocation.pCPUAddress;
+#else
+    return nullptr;
+#endif
+}
+
 inline void MultiDrawArrays(GLenum         GlTopology,
                             GLsizei        DrawCount,
                             const GLsizei* NumVertices,
@@ -894,6 +999,8 @@ inline void MultiDrawArrays(GLenum         GlTopology,
 
 void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
     GLenum GlTopology;
@@ -901,7 +1008,46 @@ void DeviceContextGLImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 
     if (Attribs.NumInstances > 0)
     {
-        if (m_NativeMultiDrawSupported)
+        const bool IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+
+        // Instanced draws can't be issued with glMultiDrawArrays, and without native multi-draw
+        // the only alternative is a separate draw call per item. In both cases, try to pack the
+        // draws into a transient indirect buffer and issue them with a single call.
+        DrawArraysIndirectCommand* pCommands     = nullptr;
+        size_t                     CommandOffset = 0;
+        if (IsInstanced || !m_NativeMultiDrawSupported)
+        {
+            pCommands = static_cast<DrawArraysIndirectCommand*>(
+                AllocateTransientDrawCommands(sizeof(DrawArraysIndirectCommand) * Attribs.DrawCount, Attribs.FirstInstanceLocation, CommandOffset));
+        }
+
+        if (pCommands != nullptr)
+        {
+#if GL_ARB_multi_draw_indirect
+            GLsizei DrawCount = 0;
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& DrawItem = Attribs.pDrawItems[i];
+                if (DrawItem.NumVertices > 0)
+                {
+                    auto& Cmd{pCommands[DrawCount++]};
+                    Cmd.Count         = DrawItem.NumVertices;
+                    Cmd.InstanceCount = Attribs.NumInstances;
+                    Cmd.First         = DrawItem.StartVertexLocation;
+                    Cmd.BaseInstance  = Attribs.FirstInstanceLocation;
+                }
+            }
+            if (DrawCount > 0)
+            {
+                glMultiDrawArraysIndirect(GlTopology, reinterpret_cast<const void*>(CommandOffset), DrawCount, 0);
+                DEV_CHECK_GL_ERROR("glMultiDrawArraysIndirect() failed");
+            }
+
+            constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+            m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+#endif
+        }
+        else if (m_NativeMultiDrawSupported && !IsInstanced)
         {
             size_t NumVerticesDataSize = AlignUp(sizeof(GLsizei) * Attribs.DrawCount, sizeof(void*));
             size_t StartVertexDataSize = AlignUp(sizeof(GLint) * Attribs.DrawCount, sizeof(void*));
@@ -988,6 +1134,8 @@ inline void DrawElements(GLenum  GlTopology,
 
 void DeviceContextGLImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
     GLenum GlTopology;
@@ -1042,6 +1190,8 @@ inline void MultiDrawElements(GLenum   GlTopology,
 
 void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
     GLenum GlTopology;
@@ -1052,8 +1202,49 @@ void DeviceContextGLImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 
     if (Attribs.NumInstances > 0)
     {
-        const size_t IndexSize = GetValueSize(Attribs.IndexType);
-        if (m_NativeMultiDrawSupported)
+        const size_t IndexSize   = GetValueSize(Attribs.IndexType);
+        const bool   IsInstanced = Attribs.NumInstances > 1 || Attribs.FirstInstanceLocation != 0;
+
+        DrawElementsIndirectCommand* pCommands     = nullptr;
+        size_t                       CommandOffset = 0;
+        if (IsInstanced || !m_NativeMultiDrawSupported)
+        {
+            pCommands = static_cast<DrawElementsIndirectCommand*>(
+                AllocateTransientDrawCommands(sizeof(DrawElementsIndirectCommand) * Attribs.DrawCount, Attribs.FirstInstanceLocation, CommandOffset));
+        }
+
+        if (pCommands != nullptr)
+        {
+#if GL_ARB_multi_draw_indirect
+            // Indirect commands address indices relative to the start of the index buffer
+            VERIFY(FirstIndexByteOffset % IndexSize == 0, "Index buffer offset (", FirstIndexByteOffset, ") is not a multiple of the index size (", IndexSize, ")");
+            const auto FirstIndexBase = StaticCast<GLuint>(FirstIndexByteOffset / IndexSize);
+
+            GLsizei DrawCount = 0;
+            for (Uint32 i = 0; i < Attribs.DrawCount; ++i)
+            {
+                const auto& DrawItem = Attribs.pDrawItems[i];
+                if (DrawItem.NumIndices > 0)
+                {
+                    auto& Cmd{pCommands[DrawCount++]};
+                    Cmd.Count         = DrawItem.NumIndices;
+                    Cmd.InstanceCount = Attribs.NumInstances;
+                    Cmd.FirstIndex    = FirstIndexBase + DrawItem.FirstIndexLocation;
+                    Cmd.BaseVertex    = static_cast<GLint>(DrawItem.BaseVertex);
+                    Cmd.BaseInstance  = Attribs.FirstInstanceLocation;
+                }
+            }
+            if (DrawCount > 0)
+            {
+                glMultiDrawElementsIndirect(GlTopology, GLIndexType, reinterpret_cast<const void*>(CommandOffset), DrawCount, 0);
+                DEV_CHECK_GL_ERROR("glMultiDrawElementsIndirect() failed");
+            }
+
+            constexpr bool ResetVAO = false; // GL_DRAW_INDIRECT_BUFFER does not affect VAO
+            m_ContextState.BindBuffer(GL_DRAW_INDIRECT_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+#endif
+        }
+        else if (m_NativeMultiDrawSupported && !IsInstanced)
         {
             const size_t IndexDataSize      = AlignUp(sizeof(GLsizei) * Attribs.DrawCount, sizeof(void*));
             const size_t OffsetDataSize     = AlignUp(sizeof(void*) * Attribs.DrawCount, sizeof(void*));
@@ -1154,6 +1345,8 @@ void DeviceContextGLImpl::PrepareForIndirectDrawCount(IBuffer* pCountBuffer)
 
 void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndirect(Attribs, 0);
 
     GLenum GlTopology;
@@ -1228,6 +1421,8 @@ void DeviceContextGLImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 
 void DeviceContextGLImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
 
     GLenum GlTopology;
@@ -1320,6 +1515,8 @@ void DeviceContextGLImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
 
 void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
 #if GL_ARB_compute_shader
@@ -1350,6 +1547,8 @@ void DeviceContextGLImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 
 void DeviceContextGLImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
 #if GL_ARB_compute_shader
@@ -1497,8 +1696,71 @@ void DeviceContextGLImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
     m_ContextState.EnableScissorTest(ScissorTestEnabled);
 }
 
+void DeviceContextGLImpl::InvalidateAttachments(Uint32               NumViews,
+                                                ITextureView* const* ppViews)
+{
+    TDeviceContextBase::InvalidateAttachments(NumViews, ppViews, 0);
+
+    if (glInvalidateFramebuffer == nullptr)
+        return;
+
+    // Only attachments of the currently bound framebuffer can be invalidated
+    Uint32 RTMask       = 0;
+    bool   InvalidateDS = false;
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        if (ppViews[i] == nullptr)
+            continue;
+
+        if (ppViews[i] == m_pBoundDepthStencil)
+        {
+            InvalidateDS = m_pBoundDepthStencil->GetDesc().ViewType != TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL;
+            continue;
+        }
+
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+        {
+            if (m_pBoundRenderTargets[rt] == ppViews[i])
+                RTMask |= 1u << rt;
+        }
+    }
+
+    // Attachments of the window-system-provided framebuffer are identified differently
+    const bool IsWindowFBO = m_IsDefaultFBOBound && m_pSwapChain && m_pSwapChain->GetDefaultFBO() == 0;
+
+    std::array<GLenum, MAX_RENDER_TARGETS + 2> Attachments;
+    GLsizei                                    NumAttachments = 0;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if (RTMask & (1u << rt))
+            Attachments[NumAttachments++] = IsWindowFBO ? GL_COLOR : GL_COLOR_ATTACHMENT0 + rt;
+    }
+    if (InvalidateDS)
+    {
+        const bool HasStencil = GetTextureFormatAttribs(m_pBoundDepthStencil->GetDesc().Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL;
+        if (IsWindowFBO)
+        {
+            Attachments[NumAttachments++] = GL_DEPTH;
+            if (HasStencil)
+                Attachments[NumAttachments++] = GL_STENCIL;
+        }
+        else
+        {
+            Attachments[NumAttachments++] = HasStencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        }
+    }
+
+    if (NumAttachments > 0)
+    {
+        glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, NumAttachments, Attachments.data());
+        DEV_CHECK_GL_ERROR("glInvalidateFramebuffer() failed");
+    }
+}
+
 void DeviceContextGLImpl::Flush()
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
 
     glFlush();
@@ -1508,6 +1770,9 @@ void DeviceContextGLImpl::Flush()
 
 void DeviceContextGLImpl::FinishFrame()
 {
+    if (auto* pDynamicHeap = m_pDevice->GetDynamicHeap())
+        pDynamicHeap->FinishFrame();
+
     TDeviceContextBase::EndFrame();
 }
 
@@ -1519,6 +1784,8 @@ void DeviceContextGLImpl::FinishCommandList(ICommandList** ppCommandList)
 void DeviceContextGLImpl::ExecuteCommandLists(Uint32               NumCommandLists,
                                               ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     LOG_ERROR("Deferred contexts are not supported in OpenGL mode");
 }
 
@@ -1653,6 +1920,88 @@ void DeviceContextGLImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextGLImpl::ResolveQueries(IQuery* const*                 ppQueries,
+                                         Uint32                         NumQueries,
+                                         IBuffer*                       pDstBuffer,
+                                         Uint64                         DstOffset,
+                                         RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::ResolveQueries(ppQueries, NumQueries, pDstBuffer, DstOffset, 0);
+    if (NumQueries == 0)
+        return;
+
+#if GL_QUERY_BUFFER
+    if (!m_pDevice->GetGLCaps().QueryBuffer || glGetQueryObjectui64v == nullptr)
+    {
+        LOG_ERROR_MESSAGE_ONCE("Resolving queries into a buffer requires GL4.4 or GL_ARB_query_buffer_object");
+        return;
+    }
+
+    auto* pDstBufferGL = ClassPtrCast<BufferGLImpl>(pDstBuffer);
+    DEV_CHECK_ERR(pDstBufferGL->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be query resolve destinations");
+    pDstBufferGL->BufferMemoryBarrier(
+        MEMORY_BARRIER_BUFFER_UPDATE, // Query results are written by the GL server similar to glBufferSubData
+        m_ContextState);
+
+    // When a buffer is bound to GL_QUERY_BUFFER, the params argument of glGetQueryObject*
+    // is treated as an offset into the buffer and the result is written on the GPU
+    // without stalling the CPU.
+    constexpr bool ResetVAO = false;
+    m_ContextState.BindBuffer(GL_QUERY_BUFFER, pDstBufferGL->GetActiveGLHandle(), ResetVAO);
+    const auto BaseOffset = DstOffset + pDstBufferGL->GetActiveOffset();
+    for (Uint32 i = 0; i < NumQueries; ++i)
+    {
+        const auto GlQuery = ClassPtrCast<QueryGLImpl>(ppQueries[i])->GetGlQueryHandle();
+        glGetQueryObjectui64v(GlQuery, GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(static_cast<size_t>(BaseOffset + Uint64{i} * sizeof(Uint64))));
+        DEV_CHECK_GL_ERROR("Failed to resolve query result");
+    }
+    m_ContextState.BindBuffer(GL_QUERY_BUFFER, GLObjectWrappers::GLBufferObj::Null(), ResetVAO);
+#else
+    LOG_ERROR_MESSAGE_ONCE("Resolving queries into a buffer is not supported on this platform");
+#endif
+}
+
+void DeviceContextGLImpl::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs)
+{
+    TDeviceContextBase::BeginConditionalRendering(Attribs, 0);
+
+#if GL_QUERY_WAIT
+    // glBeginConditionalRender can only use the result of a query object
+    DEV_CHECK_ERR(Attribs.pQuery != nullptr, "OpenGL only supports occlusion query predicates");
+    if (Attribs.pQuery == nullptr)
+        return;
+
+    GLenum Mode = GL_QUERY_WAIT;
+    if ((Attribs.Flags & CONDITIONAL_RENDERING_FLAG_INVERTED) != 0)
+    {
+#    ifdef GL_QUERY_WAIT_INVERTED
+        if (m_pDevice->GetGLCaps().ConditionalRenderInverted)
+            Mode = GL_QUERY_WAIT_INVERTED;
+        else
+#    endif
+        {
+            LOG_ERROR_MESSAGE_ONCE("Inverted conditional rendering requires GL4.5 or GL_ARB_conditional_render_inverted");
+        }
+    }
+
+    const auto GlQuery = ClassPtrCast<QueryGLImpl>(Attribs.pQuery)->GetGlQueryHandle();
+    glBeginConditionalRender(GlQuery, Mode);
+    DEV_CHECK_GL_ERROR("Failed to begin conditional rendering");
+#else
+    LOG_ERROR_MESSAGE_ONCE("Conditional rendering is not supported on this platform");
+#endif
+}
+
+void DeviceContextGLImpl::EndConditionalRendering()
+{
+    TDeviceContextBase::EndConditionalRendering(0);
+
+#if GL_QUERY_WAIT
+    glEndConditionalRender();
+    DEV_CHECK_GL_ERROR("Failed to end conditional rendering");
+#endif
+}
+
 bool DeviceContextGLImpl::UpdateCurrentGLContext()
 {
     auto NativeGLContext = m_pDevice->m_GLContext.GetCurrentNativeGLContext();
@@ -1699,6 +2048,8 @@ void DeviceContextGLImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
 
 void DeviceContextGLImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
     auto* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
     pBufferGL->Map(m_ContextState, MapType, MapFlags, pMappedData);
@@ -1706,11 +2057,34 @@ void DeviceContextGLImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 
 void DeviceContextGLImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     auto* pBufferGL = ClassPtrCast<BufferGLImpl>(pBuffer);
     pBufferGL->Unmap(m_ContextState);
 }
 
+// Returns the number of bytes glTex(Sub)Image*() reads from the source data when updating the given region
+static Uint64 GetUpdateTextureDataSize(const TextureDesc& TexDesc, const Box& DstBox, const TextureSubResData& SubresData)
+{
+    const auto& FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+
+    Uint64 NumRows = DstBox.Height();
+    Uint64 RowSize = Uint64{DstBox.Width()} * Uint64{FmtAttribs.GetElementSize()};
+    if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+    {
+        // The image size of compressed updates is computed from the stride, see Texture2D_GL::UpdateData()
+        NumRows = (NumRows + FmtAttribs.BlockHeight - 1) / FmtAttribs.BlockHeight;
+        RowSize = SubresData.Stride;
+    }
+
+    const Uint64 NumSlices = DstBox.Depth();
+    if (NumRows == 0 || RowSize == 0 || NumSlices == 0)
+        return 0;
+
+    return (NumSlices - 1) * SubresData.DepthStride + (NumRows - 1) * SubresData.Stride + RowSize;
+}
+
 void DeviceContextGLImpl::UpdateTexture(ITexture*                      pTexture,
                                         Uint32                         MipLevel,
                                         Uint32                         Slice,
@@ -1721,6 +2095,24 @@ void DeviceContextGLImpl::UpdateTexture(ITexture*                      pTexture,
 {
     TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
     auto* pTexGL = ClassPtrCast<TextureBaseGL>(pTexture);
+
+    if (SubresData.pSrcBuffer == nullptr && SubresData.pData != nullptr)
+    {
+        // Large uploads from CPU memory are staged through the pixel unpack ring, so that
+        // glTexSubImage*() does not copy the data synchronously.
+        const auto DataSize = GetUpdateTextureDataSize(pTexGL->GetDesc(), DstBox, SubresData);
+        if (DataSize >= GLPixelUnpackRing::MinUploadSize)
+        {
+            if (auto* pUnpackBuffer = m_PixelUnpackRing.BeginUpload(m_ContextState, SubresData.pData, DataSize))
+            {
+                TextureSubResData BufferData{pUnpackBuffer, 0, SubresData.Stride, SubresData.DepthStride};
+                pTexGL->UpdateData(m_ContextState, MipLevel, Slice, DstBox, BufferData);
+                m_PixelUnpackRing.EndUpload();
+                return;
+            }
+        }
+    }
+
     pTexGL->UpdateData(m_ContextState, MipLevel, Slice, DstBox, SubresData);
 }
 
@@ -1847,6 +2239,8 @@ void DeviceContextGLImpl::MapTextureSubresource(ITexture*                 pTextu
                                                 const Box*                pMapRegion,
                                                 MappedTextureSubresource& MappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
     auto*       pTexGL  = ClassPtrCast<TextureBaseGL>(pTexture);
     const auto& TexDesc = pTexGL->GetDesc();
@@ -1870,6 +2264,8 @@ void DeviceContextGLImpl::MapTextureSubresource(ITexture*                 pTextu
 
 void DeviceContextGLImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
     auto*       pTexGL  = ClassPtrCast<TextureBaseGL>(pTexture);
     const auto& TexDesc = pTexGL->GetDesc();
@@ -1897,6 +2293,8 @@ void DeviceContextGLImpl::GenerateMips(ITextureView* pTexView)
 
 void DeviceContextGLImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Transition);
+
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 }
 
@@ -103,7 +103,7 @@ FBOCache::~FBOCache()
 
 void FBOCache::OnReleaseTexture(ITexture* pTexture)
 {
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     auto* pTexGL = ClassPtrCast<TextureBaseGL>(pTexture);
     // Find all FBOs that this texture used in
@@ -117,7 +117,7 @@ void FBOCache::OnReleaseTexture(ITexture* pTexture)
 
 void FBOCache::Clear()
 {
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     m_Cache.clear();
     m_TexIdToKey.clear();
@@ -294,7 +294,7 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32             Nu
     }
 
     // Lock the cache
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
@@ -326,7 +326,7 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(Uint32 Width, Uint32
     Key.Height = Height;
 
     // Lock the cache
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
@@ -380,7 +380,7 @@ const GLObjectWrappers::GLFrameBufferObj& FBOCache::GetFBO(TextureBaseGL*
     RTV0.NumArraySlices  = 1;
 
     // Lock the cache
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     // Try to find FBO in the map
     auto fbo_it = m_Cache.find(Key);
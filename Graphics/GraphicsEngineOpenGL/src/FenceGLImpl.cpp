@@ -124,4 +124,9 @@ void FenceGLImpl::Wait(Uint64 Value)
     return HostWait(Value, false);
 }
 
+void FenceGLImpl::RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    DEV_ERROR("RegisterCompletionCallback() is not supported in OpenGL backend");
+}
+
 } // namespace Diligent
@@ -225,6 +225,90 @@ GLContext::NativeGLContextType GLContext::GetCurrentNativeGLContext()
     return eglGetCurrentContext();
 }
 
+bool GLContext::CreateWorkerContext()
+{
+    VERIFY(worker_context_ == EGL_NO_CONTEXT, "Worker context has already been created");
+
+    EGLContext share_context = context_ != EGL_NO_CONTEXT ? context_ : eglGetCurrentContext();
+    if (display_ == EGL_NO_DISPLAY || share_context == EGL_NO_CONTEXT)
+    {
+        LOG_WARNING_MESSAGE("Unable to create worker EGL context: no main context");
+        return false;
+    }
+
+    // The worker context must use the same config as the main context
+    EGLint config_id = 0;
+    eglQueryContext(display_, share_context, EGL_CONFIG_ID, &config_id);
+    const EGLint config_attribs[] = {EGL_CONFIG_ID, config_id, EGL_NONE};
+
+    EGLConfig worker_config = nullptr;
+    EGLint    num_configs   = 0;
+    if (!eglChooseConfig(display_, config_attribs, &worker_config, 1, &num_configs) || num_configs == 0)
+    {
+        LOG_WARNING_MESSAGE("Unable to create worker EGL context: failed to find the config of the main context");
+        return false;
+    }
+
+    // clang-format off
+    const EGLint context_attribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION, major_version_,
+        EGL_CONTEXT_MINOR_VERSION, minor_version_,
+        EGL_NONE
+    };
+    // clang-format on
+    worker_context_ = eglCreateContext(display_, worker_config, share_context, context_attribs);
+    if (worker_context_ == EGL_NO_CONTEXT)
+    {
+        LOG_WARNING_MESSAGE("Failed to create worker EGL context");
+        return false;
+    }
+
+    // Not all drivers support surfaceless contexts, so use a tiny pbuffer surface.
+    // If the config does not support pbuffers, try to go surfaceless.
+    const EGLint pbuffer_attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    worker_surface_ = eglCreatePbufferSurface(display_, worker_config, pbuffer_attribs);
+    if (worker_surface_ == EGL_NO_SURFACE)
+    {
+        const char* extensions = eglQueryString(display_, EGL_EXTENSIONS);
+        if (extensions == nullptr || strstr(extensions, "EGL_KHR_surfaceless_context") == nullptr)
+        {
+            LOG_WARNING_MESSAGE("Unable to create worker EGL context: pbuffer surfaces and surfaceless contexts are not supported");
+            DestroyWorkerContext();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool GLContext::BindWorkerContext(bool Bind)
+{
+    if (Bind)
+    {
+        VERIFY_EXPR(worker_context_ != EGL_NO_CONTEXT);
+        return eglMakeCurrent(display_, worker_surface_, worker_surface_, worker_context_) == EGL_TRUE;
+    }
+    else
+    {
+        return eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE;
+    }
+}
+
+void GLContext::DestroyWorkerContext()
+{
+    if (worker_surface_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_, worker_surface_);
+        worker_surface_ = EGL_NO_SURFACE;
+    }
+    if (worker_context_ != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(display_, worker_context_);
+        worker_context_ = EGL_NO_CONTEXT;
+    }
+}
+
 void GLContext::InitGLES()
 {
     if (gles_initialized_)
@@ -360,6 +444,8 @@ void GLContext::SwapBuffers(int SwapInterval)
 
 void GLContext::Terminate()
 {
+    DestroyWorkerContext();
+
     if (context_ != EGL_NO_CONTEXT)
     {
         eglDestroyContext(display_, context_);
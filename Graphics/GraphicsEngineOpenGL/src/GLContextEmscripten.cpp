@@ -91,6 +91,19 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs, RENDER_DEVICE_TYPE&
             default: UNEXPECTED("Unknown power preference");
         }
 
+        switch (InitAttribs.WebGLAttribs.ProxyContextToMainThread)
+        {
+            // clang-format off
+            case WEBGL_CONTEXT_PROXY_MODE_DEFAULT:                                                                                 break;
+            case WEBGL_CONTEXT_PROXY_MODE_DISALLOW: ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_DISALLOW; break;
+            case WEBGL_CONTEXT_PROXY_MODE_FALLBACK: ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_FALLBACK; break;
+            case WEBGL_CONTEXT_PROXY_MODE_ALWAYS:   ContextAttributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_ALWAYS;   break;
+            // clang-format on
+            default: UNEXPECTED("Unknown context proxy mode");
+        }
+        ContextAttributes.renderViaOffscreenBackBuffer = InitAttribs.WebGLAttribs.RenderViaOffscreenBackBuffer;
+        ContextAttributes.explicitSwapControl          = InitAttribs.WebGLAttribs.ExplicitSwapControl;
+
         m_GLContext = emscripten_webgl_create_context(InitAttribs.Window.pCanvasId, &ContextAttributes);
         if (m_GLContext == 0)
         {
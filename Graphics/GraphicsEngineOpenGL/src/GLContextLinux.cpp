@@ -46,6 +46,7 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs,
     {
         LOG_ERROR_AND_THROW("No current GL context found!");
     }
+    m_Context = CurrentCtx;
 
     // Initialize GLEW
     GLenum err = glewInit();
@@ -68,6 +69,7 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs,
 
 GLContext::~GLContext()
 {
+    DestroyWorkerContext();
 }
 
 void GLContext::SwapBuffers(int SwapInterval)
@@ -101,4 +103,91 @@ GLContext::NativeGLContextType GLContext::GetCurrentNativeGLContext()
     return glXGetCurrentContext();
 }
 
+bool GLContext::CreateWorkerContext()
+{
+    VERIFY(m_WorkerContext == nullptr, "Worker context has already been created");
+
+    if (m_pDisplay == nullptr)
+        m_pDisplay = glXGetCurrentDisplay();
+
+    auto* display = reinterpret_cast<Display*>(m_pDisplay);
+    if (display == nullptr || glXCreateContextAttribsARB == nullptr)
+    {
+        LOG_WARNING_MESSAGE("Unable to create worker GL context: GLX_ARB_create_context is not supported");
+        return false;
+    }
+
+    // The worker context must use the same frame buffer configuration as the main context
+    int FBConfigId = 0;
+    glXQueryContext(display, m_Context, GLX_FBCONFIG_ID, &FBConfigId);
+    const int ConfigAttribs[] = {GLX_FBCONFIG_ID, FBConfigId, 0};
+
+    int          NumConfigs = 0;
+    GLXFBConfig* pConfigs   = glXChooseFBConfig(display, DefaultScreen(display), ConfigAttribs, &NumConfigs);
+    if (pConfigs == nullptr || NumConfigs == 0)
+    {
+        LOG_WARNING_MESSAGE("Unable to create worker GL context: failed to find the frame buffer configuration of the main context");
+        return false;
+    }
+
+    GLint MajorVersion = 0, MinorVersion = 0, ProfileMask = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &MinorVersion);
+    glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &ProfileMask);
+
+    const int ContextAttribs[] =
+        {
+            GLX_CONTEXT_MAJOR_VERSION_ARB, MajorVersion,
+            GLX_CONTEXT_MINOR_VERSION_ARB, MinorVersion,
+            GLX_CONTEXT_PROFILE_MASK_ARB, ProfileMask != 0 ? ProfileMask : GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+            0 //
+        };
+    m_WorkerContext = glXCreateContextAttribsARB(display, pConfigs[0], m_Context, /*direct = */ 1, ContextAttribs);
+
+    // Pbuffer is only used to make the context current
+    const int PbufferAttribs[] = {GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, 0};
+    if (m_WorkerContext != nullptr)
+        m_WorkerPbuffer = glXCreatePbuffer(display, pConfigs[0], PbufferAttribs);
+
+    XFree(pConfigs);
+
+    if (m_WorkerContext == nullptr || m_WorkerPbuffer == 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to create worker GL context");
+        DestroyWorkerContext();
+        return false;
+    }
+
+    return true;
+}
+
+bool GLContext::BindWorkerContext(bool Bind)
+{
+    auto* display = reinterpret_cast<Display*>(m_pDisplay);
+    if (Bind)
+    {
+        VERIFY_EXPR(m_WorkerContext != nullptr);
+        return glXMakeContextCurrent(display, m_WorkerPbuffer, m_WorkerPbuffer, m_WorkerContext) != 0;
+    }
+    else
+    {
+        return glXMakeContextCurrent(display, 0, 0, nullptr) != 0;
+    }
+}
+
+void GLContext::DestroyWorkerContext()
+{
+    auto* display = reinterpret_cast<Display*>(m_pDisplay);
+    if (m_WorkerPbuffer != 0)
+    {
+        glXDestroyPbuffer(display, m_WorkerPbuffer);
+        m_WorkerPbuffer = 0;
+    }
+    if (m_WorkerContext != nullptr)
+    {
+        glXDestroyContext(display, m_WorkerContext);
+        m_WorkerContext = nullptr;
+    }
+}
+
 } // namespace Diligent
@@ -42,7 +42,8 @@ using namespace GLObjectWrappers;
 namespace Diligent
 {
 
-GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL)
+GLContextState::GLContextState(RenderDeviceGLImpl* pDeviceGL, DeviceContextStateFilterCounters* pCounters) :
+    m_pCounters{pCounters}
 {
     const auto& AdapterInfo             = pDeviceGL->GetAdapterInfo();
     m_Caps.IsFillModeSelectionSupported = AdapterInfo.Features.WireframeFill;
@@ -119,6 +120,8 @@ void GLContextState::Invalidate()
 
     m_iActiveTexture   = -1;
     m_NumPatchVertices = -1;
+
+    ++m_ResourceBindingsVersion;
 }
 
 template <typename ObjectType>
@@ -142,18 +145,21 @@ bool UpdateBoundObject(UniqueIdentifier& CurrentObjectID, const ObjectType& NewO
 
 void GLContextState::SetProgram(const GLProgramObj& GLProgram)
 {
-    GLuint GLProgHandle = 0;
-    if (UpdateBoundObject(m_GLProgId, GLProgram, GLProgHandle))
+    GLuint     GLProgHandle = 0;
+    const bool Changed      = UpdateBoundObject(m_GLProgId, GLProgram, GLProgHandle);
+    if (Changed)
     {
         glUseProgram(GLProgHandle);
         DEV_CHECK_GL_ERROR("Failed to set GL program");
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::SetPipeline(const GLPipelineObj& GLPipeline)
 {
-    GLuint GLPipelineHandle = 0;
-    if (UpdateBoundObject(m_GLPipelineId, GLPipeline, GLPipelineHandle))
+    GLuint     GLPipelineHandle = 0;
+    const bool Changed          = UpdateBoundObject(m_GLPipelineId, GLPipeline, GLPipelineHandle);
+    if (Changed)
     {
         if (m_Caps.IsProgramPipelineSupported)
         {
@@ -165,22 +171,26 @@ void GLContextState::SetPipeline(const GLPipelineObj& GLPipeline)
             UNSUPPORTED("SetPipeline is not supported");
         }
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::BindVAO(const GLVertexArrayObj& VAO)
 {
-    GLuint VAOHandle = 0;
-    if (UpdateBoundObject(m_VAOId, VAO, VAOHandle))
+    GLuint     VAOHandle = 0;
+    const bool Changed   = UpdateBoundObject(m_VAOId, VAO, VAOHandle);
+    if (Changed)
     {
         glBindVertexArray(VAOHandle);
         DEV_CHECK_GL_ERROR("Failed to set VAO");
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
 {
-    GLuint FBOHandle = 0;
-    if (UpdateBoundObject(m_FBOId, FBO, FBOHandle))
+    GLuint     FBOHandle = 0;
+    const bool Changed   = UpdateBoundObject(m_FBOId, FBO, FBOHandle);
+    if (Changed)
     {
         // Even though the write mask only applies to writes to a framebuffer, the mask state is NOT
         // Framebuffer state. So it is NOT part of a Framebuffer Object or the Default Framebuffer.
@@ -194,6 +204,7 @@ void GLContextState::BindFBO(const GLFrameBufferObj& FBO)
         glBindFramebuffer(GL_READ_FRAMEBUFFER, FBOHandle);
         DEV_CHECK_GL_ERROR("Failed to bind FBO as read framebuffer");
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::SetActiveTexture(Int32 Index)
@@ -230,7 +241,8 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
 
     BoundTextureInfo  NewTex{TexObj ? TexObj.GetUniqueID() : 0, BindTarget};
     BoundTextureInfo& BoundTex = m_BoundTextures[Index];
-    if (BoundTex != NewTex)
+    const bool        Changed  = BoundTex != NewTex;
+    if (Changed)
     {
         // Unbind texture from the previous target.
         // This is necessary as at least on NVidia, having different textures bound to
@@ -244,7 +256,9 @@ void GLContextState::BindTexture(Int32 Index, GLenum BindTarget, const GLObjectW
         DEV_CHECK_GL_ERROR("Failed to bind texture to target ", BindTarget, " slot ", Index, ".");
 
         BoundTex = NewTex;
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSamplerObj& GLSampler)
@@ -252,12 +266,15 @@ void GLContextState::BindSampler(Uint32 Index, const GLObjectWrappers::GLSampler
     if (static_cast<size_t>(Index) >= m_BoundSamplers.size())
         m_BoundSamplers.resize(size_t{Index} + 1, -1);
 
-    GLuint GLSamplerHandle = 0;
-    if (UpdateBoundObject(m_BoundSamplers[Index], GLSampler, GLSamplerHandle))
+    GLuint     GLSamplerHandle = 0;
+    const bool Changed         = UpdateBoundObject(m_BoundSamplers[Index], GLSampler, GLSamplerHandle);
+    if (Changed)
     {
         glBindSampler(Index, GLSamplerHandle);
         DEV_CHECK_GL_ERROR("Failed to bind sampler to slot ", Index);
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::BindImage(Uint32             Index,
@@ -281,12 +298,15 @@ void GLContextState::BindImage(Uint32             Index,
         };
     if (Index >= m_BoundImages.size())
         m_BoundImages.resize(size_t{Index} + 1);
-    if (m_BoundImages[Index] != NewImageInfo)
+    const bool Changed = m_BoundImages[Index] != NewImageInfo;
+    if (Changed)
     {
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, MipLevel, IsLayered, Layer, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
@@ -307,12 +327,15 @@ void GLContextState::BindImage(Uint32 Index, BufferViewGLImpl* pBuffView, GLenum
         };
     if (Index >= m_BoundImages.size())
         m_BoundImages.resize(size_t{Index} + 1);
-    if (m_BoundImages[Index] != NewImageInfo)
+    const bool Changed = m_BoundImages[Index] != NewImageInfo;
+    if (Changed)
     {
         m_BoundImages[Index] = NewImageInfo;
         glBindImageTexture(Index, NewImageInfo.GLHandle, 0, GL_FALSE, 0, Access, Format);
         DEV_CHECK_GL_ERROR("glBindImageTexture() failed");
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
@@ -360,7 +383,8 @@ void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBu
     if (Index >= static_cast<Int32>(m_BoundUniformBuffers.size()))
         m_BoundUniformBuffers.resize(static_cast<size_t>(Index) + 1);
 
-    if (m_BoundUniformBuffers[Index] != NewUBOInfo)
+    const bool Changed = m_BoundUniformBuffers[Index] != NewUBOInfo;
+    if (Changed)
     {
         m_BoundUniformBuffers[Index] = NewUBOInfo;
         GLuint GLBufferHandle        = Buff;
@@ -368,7 +392,9 @@ void GLContextState::BindUniformBuffer(Int32 Index, const GLObjectWrappers::GLBu
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_UNIFORM_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind uniform buffer to slot ", Index);
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 }
 
 void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBufferObj& Buff, GLintptr Offset, GLsizeiptr Size)
@@ -378,7 +404,8 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
     if (Index >= static_cast<Int32>(m_BoundStorageBlocks.size()))
         m_BoundStorageBlocks.resize(static_cast<size_t>(Index) + 1);
 
-    if (m_BoundStorageBlocks[Index] != NewSSBOInfo)
+    const bool Changed = m_BoundStorageBlocks[Index] != NewSSBOInfo;
+    if (Changed)
     {
         m_BoundStorageBlocks[Index] = NewSSBOInfo;
         GLuint GLBufferHandle       = Buff;
@@ -386,7 +413,9 @@ void GLContextState::BindStorageBlock(Int32 Index, const GLObjectWrappers::GLBuf
         // buffer to the generic buffer binding point specified by target.
         glBindBufferRange(GL_SHADER_STORAGE_BUFFER, Index, GLBufferHandle, Offset, Size);
         DEV_CHECK_GL_ERROR("Failed to bind shader storage block to slot ", Index);
+        ++m_ResourceBindingsVersion;
     }
+    CountBinding(Changed);
 #else
     UNSUPPORTED("GL_ARB_shader_image_load_store is not supported");
 #endif
@@ -206,6 +206,8 @@ GLContext::GLContext(const EngineGLCreateInfo& InitAttribs,
 
 GLContext::~GLContext()
 {
+    DestroyWorkerContext();
+
     // Do not destroy context if it was created by the app.
     if (m_Context)
     {
@@ -238,4 +240,63 @@ GLContext::NativeGLContextType GLContext::GetCurrentNativeGLContext()
     return wglGetCurrentContext();
 }
 
+bool GLContext::CreateWorkerContext()
+{
+    VERIFY(m_WorkerContext == NULL, "Worker context has already been created");
+
+    HGLRC ShareContext = m_Context != NULL ? m_Context : wglGetCurrentContext();
+    m_WorkerDC         = m_WindowHandleToDeviceContext != NULL ? m_WindowHandleToDeviceContext : wglGetCurrentDC();
+    if (ShareContext == NULL || m_WorkerDC == NULL || wglCreateContextAttribsARB == nullptr)
+    {
+        LOG_WARNING_MESSAGE("Unable to create worker GL context: WGL_ARB_create_context is not supported");
+        return false;
+    }
+
+    GLint MajorVersion = 0, MinorVersion = 0, ProfileMask = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &MajorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &MinorVersion);
+    glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &ProfileMask);
+
+    int attribs[] =
+        {
+            WGL_CONTEXT_MAJOR_VERSION_ARB, MajorVersion,
+            WGL_CONTEXT_MINOR_VERSION_ARB, MinorVersion,
+            WGL_CONTEXT_PROFILE_MASK_ARB, ProfileMask != 0 ? ProfileMask : WGL_CONTEXT_CORE_PROFILE_BIT_ARB,
+            0, 0 //
+        };
+
+    // The worker context uses the device context of the main window, so it has
+    // the same pixel format. It is never used for rendering to the window.
+    m_WorkerContext = wglCreateContextAttribsARB(m_WorkerDC, ShareContext, attribs);
+    if (m_WorkerContext == NULL)
+    {
+        LOG_WARNING_MESSAGE("Failed to create worker GL context");
+        return false;
+    }
+
+    return true;
+}
+
+bool GLContext::BindWorkerContext(bool Bind)
+{
+    if (Bind)
+    {
+        VERIFY_EXPR(m_WorkerContext != NULL);
+        return wglMakeCurrent(m_WorkerDC, m_WorkerContext) != FALSE;
+    }
+    else
+    {
+        return wglMakeCurrent(NULL, NULL) != FALSE;
+    }
+}
+
+void GLContext::DestroyWorkerContext()
+{
+    if (m_WorkerContext != NULL)
+    {
+        wglDeleteContext(m_WorkerContext);
+        m_WorkerContext = NULL;
+    }
+}
+
 } // namespace Diligent
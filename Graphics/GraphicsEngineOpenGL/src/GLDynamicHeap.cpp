@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLDynamicHeap.hpp"
+
+#include <iomanip>
+
+#include "Align.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+GLDynamicHeap::GLDynamicHeap(IMemoryAllocator& Allocator, Uint32 Size, Uint32 Alignment) noexcept(false) :
+    // clang-format off
+    m_GLBuffer   {true},
+    m_Alignment  {std::max(Alignment, Uint32{16})},
+    m_RingBuffer {Size, Allocator}
+// clang-format on
+{
+    VERIFY(IsPowerOfTwo(m_Alignment), "Alignment (", m_Alignment, ") must be a power of two");
+
+    // The heap is created before the immediate context and its GL state cache, so the buffer
+    // is bound directly. GL_COPY_WRITE_BUFFER is reset to zero afterwards, which is the state
+    // the cache expects.
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_GLBuffer);
+    CHECK_GL_ERROR_AND_THROW("Failed to bind dynamic heap buffer");
+
+    constexpr GLbitfield StorageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(Size), nullptr, StorageFlags);
+    CHECK_GL_ERROR_AND_THROW("Failed to allocate dynamic heap storage");
+
+    m_pCPUAddress = static_cast<Uint8*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, static_cast<GLsizeiptr>(Size), StorageFlags));
+    CHECK_GL_ERROR_AND_THROW("Failed to map dynamic heap buffer");
+
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    if (m_pCPUAddress == nullptr)
+        LOG_ERROR_AND_THROW("Persistent mapping of the dynamic heap buffer returned null pointer");
+
+    m_GLBuffer.SetName("Dynamic heap");
+
+    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+}
+
+GLDynamicHeap::~GLDynamicHeap()
+{
+    // The buffer is never used after the heap is destroyed, so all memory can be released.
+    m_RingBuffer.FinishCurrentFrame(m_FrameNumber);
+    m_RingBuffer.ReleaseCompletedFrames(m_FrameNumber);
+
+    // Deleting the buffer object implicitly unmaps it.
+
+    const auto Size = m_RingBuffer.GetMaxSize();
+    LOG_INFO_MESSAGE("Dynamic heap usage stats:\n"
+                     "                       Total size: ",
+                     FormatMemorySize(Size, 2),
+                     ". Peak used size: ", FormatMemorySize(m_PeakUsedSize, 2, Size),
+                     ". Peak utilization: ",
+                     std::fixed, std::setprecision(1), static_cast<double>(m_PeakUsedSize) / static_cast<double>(std::max(Size, size_t{1})) * 100.0, '%',
+                     ". Failed allocations: ", m_FailedAllocations);
+}
+
+GLDynamicHeap::Allocation GLDynamicHeap::Allocate(Uint64 Size)
+{
+    VERIFY_EXPR(Size > 0);
+
+    auto Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), m_Alignment);
+    if (Offset == RingBuffer::InvalidOffset)
+    {
+        // The GPU may have finished more frames since the last call to FinishFrame()
+        ReleaseCompletedFrames();
+        Offset = m_RingBuffer.Allocate(StaticCast<RingBuffer::OffsetType>(Size), m_Alignment);
+    }
+
+    if (Offset == RingBuffer::InvalidOffset)
+    {
+        ++m_FailedAllocations;
+        return {};
+    }
+
+    m_CurrFrameHasAllocations = true;
+    m_PeakUsedSize            = std::max(m_PeakUsedSize, m_RingBuffer.GetUsedSize());
+
+    return {Offset, m_pCPUAddress + Offset};
+}
+
+void GLDynamicHeap::FinishFrame()
+{
+    if (m_CurrFrameHasAllocations)
+    {
+        GLObjectWrappers::GLSyncObj Fence{glFenceSync(
+            GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+            0                              // Flags, must be 0
+            )};
+        DEV_CHECK_GL_ERROR("Failed to create dynamic heap fence");
+
+        m_RingBuffer.FinishCurrentFrame(m_FrameNumber);
+        m_PendingFrames.emplace_back(m_FrameNumber, std::move(Fence));
+        ++m_FrameNumber;
+        m_CurrFrameHasAllocations = false;
+    }
+
+    ReleaseCompletedFrames();
+}
+
+void GLDynamicHeap::ReleaseCompletedFrames()
+{
+    Uint64 CompletedFrame = 0;
+    while (!m_PendingFrames.empty())
+    {
+        auto res =
+            glClientWaitSync(m_PendingFrames.front().second,
+                             0, // Can be SYNC_FLUSH_COMMANDS_BIT
+                             0  // Timeout in nanoseconds
+            );
+        if (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED)
+            break;
+
+        CompletedFrame = m_PendingFrames.front().first;
+        m_PendingFrames.pop_front();
+    }
+
+    if (CompletedFrame != 0)
+        m_RingBuffer.ReleaseCompletedFrames(CompletedFrame);
+}
+
+} // namespace Diligent
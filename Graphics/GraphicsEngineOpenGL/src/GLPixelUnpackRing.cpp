@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "GLPixelUnpackRing.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceGLImpl.hpp"
+#include "BufferGLImpl.hpp"
+#include "GLContextState.hpp"
+#include "Align.hpp"
+#include "FormatString.hpp"
+
+namespace Diligent
+{
+
+GLPixelUnpackRing::GLPixelUnpackRing(RenderDeviceGLImpl* pDevice) noexcept :
+    m_pDevice{pDevice}
+{
+}
+
+GLPixelUnpackRing::~GLPixelUnpackRing()
+{
+    VERIFY(!m_IsUploading, "Upload has not been ended");
+
+    if (m_NumUploads != 0)
+    {
+        LOG_INFO_MESSAGE("Pixel unpack ring usage stats:\n"
+                         "                       Uploads: ",
+                         m_NumUploads, ". Total size: ", FormatMemorySize(m_TotalUploadSize, 2),
+                         ". Orphaned buffers: ", m_NumOrphanedUploads);
+    }
+}
+
+IBuffer* GLPixelUnpackRing::BeginUpload(GLContextState& CtxState, const void* pData, Uint64 Size)
+{
+    VERIFY(!m_IsUploading, "Previous upload has not been ended");
+    VERIFY_EXPR(pData != nullptr && Size > 0);
+
+    auto& Buff = m_Buffers[m_CurrBuffer];
+
+    bool IsInUse = false;
+    if (Buff.Fence)
+    {
+        auto res = glClientWaitSync(Buff.Fence,
+                                    0, // Can be SYNC_FLUSH_COMMANDS_BIT
+                                    0  // Timeout in nanoseconds
+        );
+        IsInUse = (res != GL_ALREADY_SIGNALED && res != GL_CONDITION_SATISFIED);
+        if (!IsInUse)
+            Buff.Fence.Release();
+    }
+
+    if (!Buff.pBuffer || Buff.pBuffer->GetDesc().Size < Size)
+    {
+        BufferDesc Desc;
+        Desc.Name = "Pixel unpack ring buffer";
+        // Staging buffers with CPU write access are bound to GL_PIXEL_UNPACK_BUFFER
+        Desc.Usage          = USAGE_STAGING;
+        Desc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        Desc.Size           = AlignUp(Size, Uint64{64} << 10);
+
+        Buff.pBuffer.Release();
+        Buff.Fence.Release();
+        m_pDevice->CreateBuffer(Desc, nullptr, &Buff.pBuffer);
+        if (!Buff.pBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create pixel unpack buffer of size ", FormatMemorySize(Desc.Size, 2));
+            return nullptr;
+        }
+        IsInUse = false;
+    }
+
+    // If the GPU may still be reading the buffer, orphan its storage: GL_MAP_INVALIDATE_BUFFER_BIT
+    // lets the driver allocate new memory instead of waiting. Otherwise, map without synchronization.
+    const auto MapFlags = IsInUse ? MAP_FLAG_DISCARD : MAP_FLAG_NO_OVERWRITE;
+    if (IsInUse)
+        ++m_NumOrphanedUploads;
+
+    auto* pBufferGL = ClassPtrCast<BufferGLImpl>(Buff.pBuffer.RawPtr());
+
+    PVoid pMappedData = nullptr;
+    pBufferGL->MapRange(CtxState, MAP_WRITE, MapFlags, 0, Size, pMappedData);
+    if (pMappedData == nullptr)
+        return nullptr;
+
+    memcpy(pMappedData, pData, StaticCast<size_t>(Size));
+    pBufferGL->Unmap(CtxState);
+
+    ++m_NumUploads;
+    m_TotalUploadSize += Size;
+    m_IsUploading = true;
+
+    return Buff.pBuffer;
+}
+
+void GLPixelUnpackRing::EndUpload()
+{
+    VERIFY(m_IsUploading, "There is no upload in progress");
+
+    auto& Buff = m_Buffers[m_CurrBuffer];
+    Buff.Fence = GLObjectWrappers::GLSyncObj{glFenceSync(
+        GL_SYNC_GPU_COMMANDS_COMPLETE, // Condition must always be GL_SYNC_GPU_COMMANDS_COMPLETE
+        0                              // Flags, must be 0
+        )};
+    DEV_CHECK_GL_ERROR("Failed to create pixel unpack buffer fence");
+
+    m_CurrBuffer  = (m_CurrBuffer + 1) % NumBuffers;
+    m_IsUploading = false;
+}
+
+} // namespace Diligent
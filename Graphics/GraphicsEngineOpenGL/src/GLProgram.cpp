@@ -29,13 +29,16 @@
 #include "GLProgram.hpp"
 #include "ShaderGLImpl.hpp"
 #include "RenderDeviceGLImpl.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
 
-GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
-                     Uint32               NumShaders,
-                     bool                 IsSeparableProgram) noexcept :
+GLProgram::GLProgram(ShaderGLImpl* const*      ppShaders,
+                     Uint32                    NumShaders,
+                     bool                      IsSeparableProgram,
+                     PipelineStateCacheGLImpl* pPSOCache,
+                     GLWorkerThread*           pWorkerThread) noexcept :
     m_AttachedShaders{ppShaders, ppShaders + NumShaders}
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
@@ -47,6 +50,29 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
         DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
     }
 
+    if (pPSOCache != nullptr)
+    {
+        // Unlike shader unique IDs, source hashes are stable between runs
+        size_t Hash = ComputeHash(IsSeparableProgram, NumShaders);
+        for (Uint32 i = 0; i < NumShaders; ++i)
+            HashCombine(Hash, ppShaders[i]->GetSourceHash());
+        m_BinaryKey = Hash;
+
+        if (pPSOCache->LoadProgram(m_GLProg, m_BinaryKey))
+        {
+            // The program has been restored from the binary - no need to link it.
+            m_AttachedShaders.clear();
+            m_LinkStatus = LinkStatus::Succeeded;
+            return;
+        }
+
+        // If the binary was not found or was rejected by the driver, link the program from the shaders
+        // and store its binary in the cache.
+        m_pPSOCache = pPSOCache;
+        glProgramParameteri(m_GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) failed");
+    }
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         auto* pCurrShader = ppShaders[i];
@@ -64,8 +90,21 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
     //compatible program on the other side of the interface. If a mismatch
     //between programs occurs, no GL error will be generated, but some or all
     //of the inputs on the interface will be undefined.
-    glLinkProgram(m_GLProg);
-    DEV_CHECK_GL_ERROR("glLinkProgram() failed");
+    if (pWorkerThread != nullptr)
+    {
+        // The program object must not be used by this context until the task is complete
+        m_LinkTask = pWorkerThread->EnqueueTask([GLProg = static_cast<GLuint>(m_GLProg)]() {
+            glLinkProgram(GLProg);
+            // Block the worker until the linking is complete
+            GLint IsLinked = GL_FALSE;
+            glGetProgramiv(GLProg, GL_LINK_STATUS, &IsLinked);
+        });
+    }
+    else
+    {
+        glLinkProgram(m_GLProg);
+        DEV_CHECK_GL_ERROR("glLinkProgram() failed");
+    }
 
     // Note: according to the spec, shaders can be detached immediately after glLinkProgram call.
     //       However, on NVidia GPUs this completely disables the GL_KHR_parallel_shader_compile
@@ -77,6 +116,9 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
 
 GLProgram::~GLProgram()
 {
+    // Do not release the program while the worker thread is linking it
+    if (m_LinkTask.valid())
+        m_LinkTask.get();
 }
 
 GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
@@ -85,7 +127,14 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     if (m_LinkStatus != LinkStatus::InProgress)
         return m_LinkStatus;
 
-    if (!WaitForCompletion)
+    if (m_LinkTask.valid())
+    {
+        if (!WaitForCompletion && !GLWorkerThread::IsTaskComplete(m_LinkTask))
+            return LinkStatus::InProgress;
+
+        GLWorkerThread::WaitForTask(m_LinkTask);
+    }
+    else if (!WaitForCompletion)
     {
         GLint LinkingComplete = GL_FALSE;
         glGetProgramiv(m_GLProg, GL_COMPLETION_STATUS_KHR, &LinkingComplete);
@@ -101,6 +150,8 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
     if (IsLinked)
     {
         m_LinkStatus = LinkStatus::Succeeded;
+        if (m_pPSOCache)
+            m_pPSOCache->StoreProgram(m_GLProg, m_BinaryKey);
     }
     else
     {
@@ -131,6 +182,7 @@ GLProgram::LinkStatus GLProgram::GetLinkStatus(bool WaitForCompletion) noexcept
 
     std::vector<const ShaderGLImpl*> Null{};
     m_AttachedShaders.swap(Null);
+    m_pPSOCache.Release();
 
     return m_LinkStatus;
 }
@@ -197,6 +197,26 @@
     DECLARE_GL_FUNCTION_NO_STUB( glShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding )
 #endif
 
+#ifdef LOAD_GL_BIND_VERTEX_BUFFER
+    DECLARE_GL_FUNCTION( glBindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_FORMAT
+    DECLARE_GL_FUNCTION( glVertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_I_FORMAT
+    DECLARE_GL_FUNCTION( glVertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_BINDING
+    DECLARE_GL_FUNCTION( glVertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, GLuint attribindex, GLuint bindingindex )
+#endif
+
+#ifdef LOAD_GL_VERTEX_BINDING_DIVISOR
+    DECLARE_GL_FUNCTION( glVertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, GLuint bindingindex, GLuint divisor )
+#endif
+
 #ifdef LOAD_GL_TEX_STORAGE_3D_MULTISAMPLE
     DECLARE_GL_FUNCTION( glTexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
 #endif
@@ -261,6 +281,10 @@
     DECLARE_GL_FUNCTION_NO_STUB( glClipControl, PFNGLCLIPCONTROLPROC)
 #endif
 
+#ifdef LOAD_GL_BUFFER_STORAGE
+    DECLARE_GL_FUNCTION_NO_STUB( glBufferStorage, PFNGLBUFFERSTORAGEPROC)
+#endif
+
 #ifdef LOAD_GL_MULTIDRAW_ARRAYS_INDIRECT
     DECLARE_GL_FUNCTION( glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride)
 #endif
@@ -456,6 +480,26 @@ void LoadGLFunctions()
     //LOAD_GL_FUNCTION_NO_STUB(glShaderStorageBlockBinding, "glShaderStorageBlockBinding")
 #endif
 
+#ifdef LOAD_GL_BIND_VERTEX_BUFFER
+    LOAD_GL_FUNCTION2(glBindVertexBuffer, {{"glBindVertexBuffer", {3,1}}} )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_FORMAT
+    LOAD_GL_FUNCTION2(glVertexAttribFormat, {{"glVertexAttribFormat", {3,1}}} )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_I_FORMAT
+    LOAD_GL_FUNCTION2(glVertexAttribIFormat, {{"glVertexAttribIFormat", {3,1}}} )
+#endif
+
+#ifdef LOAD_GL_VERTEX_ATTRIB_BINDING
+    LOAD_GL_FUNCTION2(glVertexAttribBinding, {{"glVertexAttribBinding", {3,1}}} )
+#endif
+
+#ifdef LOAD_GL_VERTEX_BINDING_DIVISOR
+    LOAD_GL_FUNCTION2(glVertexBindingDivisor, {{"glVertexBindingDivisor", {3,1}}} )
+#endif
+
 #ifdef LOAD_GL_TEX_STORAGE_3D_MULTISAMPLE
     LOAD_GL_FUNCTION2(glTexStorage3DMultisample, {{"glTexStorage3DMultisample", {3,2}}, {"glTexStorage3DMultisampleOES", {3,1}}} )
 #endif
@@ -520,6 +564,10 @@ void LoadGLFunctions()
     LOAD_GL_FUNCTION_NO_STUB(glClipControl, {{"glClipControlEXT", {3,0}}} );
 #endif
 
+#ifdef LOAD_GL_BUFFER_STORAGE
+    LOAD_GL_FUNCTION_NO_STUB(glBufferStorage, {{"glBufferStorageEXT", {3,1}}} );
+#endif
+
 #ifdef LOAD_GL_MULTIDRAW_ARRAYS_INDIRECT
     LOAD_GL_FUNCTION_NO_STUB(glMultiDrawArraysIndirect, {{"glMultiDrawArraysIndirectEXT", {3,1}}} );
 #endif
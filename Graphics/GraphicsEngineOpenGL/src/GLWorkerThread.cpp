@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GLWorkerThread.hpp"
+
+namespace Diligent
+{
+
+GLWorkerThread::GLWorkerThread(GLContext& Context) noexcept(false) :
+    m_Context{Context}
+{
+    if (!m_Context.CreateWorkerContext())
+        LOG_ERROR_AND_THROW("Failed to create worker GL context");
+
+    std::promise<bool> InitPromise;
+    std::future<bool>  InitFuture = InitPromise.get_future();
+
+    m_Thread = std::thread{[this, &InitPromise]() {
+        WorkerThreadProc(InitPromise);
+    }};
+
+    if (!InitFuture.get())
+    {
+        m_Thread.join();
+        m_Context.DestroyWorkerContext();
+        LOG_ERROR_AND_THROW("Failed to make worker GL context current");
+    }
+
+    LOG_INFO_MESSAGE("Started GL worker thread");
+}
+
+GLWorkerThread::~GLWorkerThread()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMtx};
+        m_Stop = true;
+    }
+    m_QueueCV.notify_one();
+    m_Thread.join();
+
+    m_Context.DestroyWorkerContext();
+}
+
+void GLWorkerThread::WorkerThreadProc(std::promise<bool>& InitPromise)
+{
+    if (!m_Context.BindWorkerContext(true))
+    {
+        InitPromise.set_value(false);
+        return;
+    }
+    InitPromise.set_value(true);
+
+    while (true)
+    {
+        std::packaged_task<GLObjectWrappers::GLSyncObj()> Task;
+        {
+            std::unique_lock<std::mutex> Lock{m_QueueMtx};
+            m_QueueCV.wait(Lock, [this]() { return m_Stop || !m_Queue.empty(); });
+            // Pending tasks are always executed so that no one waits for them forever
+            if (m_Queue.empty())
+                break;
+
+            Task = std::move(m_Queue.front());
+            m_Queue.pop_front();
+        }
+        Task();
+    }
+
+    m_Context.BindWorkerContext(false);
+}
+
+GLWorkerThread::TaskFuture GLWorkerThread::EnqueueTask(std::function<void()> Task)
+{
+    // Make all previous commands of the calling context visible to the worker
+    GLsync Ready = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    DEV_CHECK_GL_ERROR("Failed to create gl fence");
+    glFlush();
+
+    std::packaged_task<GLObjectWrappers::GLSyncObj()> PackagedTask{
+        [Task = std::move(Task), Ready]() {
+            glWaitSync(Ready, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(Ready);
+
+            Task();
+
+            // Signal completion of the task's commands to the waiting context. The fence
+            // must be flushed, otherwise the waiting context may never see it signaled.
+            GLObjectWrappers::GLSyncObj Done{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)};
+            glFlush();
+            return Done;
+        }};
+
+    TaskFuture Future = PackagedTask.get_future();
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMtx};
+        VERIFY(!m_Stop, "Enqueueing a task after the worker thread has been stopped");
+        m_Queue.emplace_back(std::move(PackagedTask));
+    }
+    m_QueueCV.notify_one();
+
+    return Future;
+}
+
+bool GLWorkerThread::IsTaskComplete(const TaskFuture& Task)
+{
+    VERIFY_EXPR(Task.valid());
+    return Task.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+}
+
+void GLWorkerThread::WaitForTask(TaskFuture& Task)
+{
+    VERIFY_EXPR(Task.valid());
+    GLObjectWrappers::GLSyncObj Done = Task.get();
+    if (Done)
+        glWaitSync(Done, 0, GL_TIMEOUT_IGNORED);
+}
+
+} // namespace Diligent
@@ -0,0 +1,251 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "PipelineStateCacheGLImpl.hpp"
+#include "RenderDeviceGLImpl.hpp"
+#include "DataBlobImpl.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct CacheDataHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x424C4744; // 'DGLB'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic          = ExpectedMagic;
+    Uint32 Version        = ExpectedVersion;
+    Uint32 DriverInfoSize = 0;
+    Uint32 NumPrograms    = 0;
+};
+
+struct ProgramBinaryHeader
+{
+    Uint64 Key    = 0;
+    Uint32 Format = 0;
+    Uint32 Size   = 0;
+};
+
+std::string GetDriverInfo()
+{
+    std::string DriverInfo;
+    for (GLenum Name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        if (const auto* Str = reinterpret_cast<const char*>(glGetString(Name)))
+            DriverInfo += Str;
+        DriverInfo += '\n';
+    }
+    return DriverInfo;
+}
+
+} // namespace
+
+PipelineStateCacheGLImpl::PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                                                   RenderDeviceGLImpl*                 pDeviceGL,
+                                                   const PipelineStateCacheCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateCacheBase
+    {
+        pRefCounters,
+        pDeviceGL,
+        CreateInfo,
+        false
+    },
+    m_DriverInfo{GetDriverInfo()}
+// clang-format on
+{
+    if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize > 0)
+        InitFromData(CreateInfo.pCacheData, CreateInfo.CacheDataSize);
+}
+
+PipelineStateCacheGLImpl::~PipelineStateCacheGLImpl()
+{
+}
+
+void PipelineStateCacheGLImpl::InitFromData(const void* pData, size_t DataSize)
+{
+    const Uint8* pCurr = static_cast<const Uint8*>(pData);
+    const Uint8* pEnd  = pCurr + DataSize;
+
+    auto Read = [&pCurr, pEnd](void* pDst, size_t Size) {
+        if (pCurr + Size > pEnd)
+            return false;
+        std::memcpy(pDst, pCurr, Size);
+        pCurr += Size;
+        return true;
+    };
+
+    CacheDataHeader Header;
+    if (!Read(&Header, sizeof(Header)) ||
+        Header.Magic != CacheDataHeader::ExpectedMagic ||
+        Header.Version != CacheDataHeader::ExpectedVersion)
+    {
+        LOG_WARNING_MESSAGE("Pipeline state cache data is not valid and will be ignored.");
+        return;
+    }
+
+    if (pCurr + Header.DriverInfoSize > pEnd ||
+        m_DriverInfo.compare(0, std::string::npos, reinterpret_cast<const char*>(pCurr), Header.DriverInfoSize) != 0)
+    {
+        // Program binaries are not portable between drivers
+        LOG_INFO_MESSAGE("Pipeline state cache data was created by a different driver and will be ignored.");
+        return;
+    }
+    pCurr += Header.DriverInfoSize;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+    for (Uint32 i = 0; i < Header.NumPrograms; ++i)
+    {
+        ProgramBinaryHeader ProgHeader;
+        if (!Read(&ProgHeader, sizeof(ProgHeader)))
+            break;
+
+        ProgramBinary Binary;
+        Binary.Format = ProgHeader.Format;
+        Binary.Data.resize(ProgHeader.Size);
+        if (!Read(Binary.Data.data(), Binary.Data.size()))
+            break;
+
+        m_Programs.emplace(ProgHeader.Key, std::move(Binary));
+    }
+
+    if (m_Programs.size() != Header.NumPrograms)
+        LOG_WARNING_MESSAGE("Pipeline state cache data is truncated: only ", m_Programs.size(), " of ", Header.NumPrograms, " programs were loaded.");
+}
+
+bool PipelineStateCacheGLImpl::LoadProgram(const GLObjectWrappers::GLProgramObj& GLProg, Uint64 Key)
+{
+    if ((m_Desc.Mode & PSO_CACHE_MODE_LOAD) == 0)
+        return false;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+    auto it = m_Programs.find(Key);
+    if (it == m_Programs.end())
+    {
+        if (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE)
+            LOG_INFO_MESSAGE("Program binary ", Key, " was not found in the pipeline state cache '", m_Desc.Name, "'.");
+        return false;
+    }
+
+    const ProgramBinary& Binary = it->second;
+    glProgramBinary(GLProg, Binary.Format, Binary.Data.data(), static_cast<GLsizei>(Binary.Data.size()));
+
+    GLint IsLinked = GL_FALSE;
+    glGetProgramiv(GLProg, GL_LINK_STATUS, &IsLinked);
+    // The driver may reject the binary, e.g. after an update. Clear the error so that
+    // it is not attributed to subsequent GL calls.
+    glGetError();
+
+    if (!IsLinked)
+    {
+        if (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE)
+            LOG_INFO_MESSAGE("Program binary ", Key, " was rejected by the driver and will be recreated.");
+        m_Programs.erase(it);
+        return false;
+    }
+
+    return true;
+}
+
+void PipelineStateCacheGLImpl::StoreProgram(const GLObjectWrappers::GLProgramObj& GLProg, Uint64 Key)
+{
+    if ((m_Desc.Mode & PSO_CACHE_MODE_STORE) == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+        if (m_Programs.find(Key) != m_Programs.end())
+            return;
+    }
+
+    GLint BinaryLength = 0;
+    glGetProgramiv(GLProg, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    DEV_CHECK_GL_ERROR("glGetProgramiv(GL_PROGRAM_BINARY_LENGTH) failed");
+    if (BinaryLength <= 0)
+        return;
+
+    ProgramBinary Binary;
+    Binary.Data.resize(static_cast<size_t>(BinaryLength));
+
+    GLsizei Length = 0;
+    glGetProgramBinary(GLProg, BinaryLength, &Length, &Binary.Format, Binary.Data.data());
+    if (glGetError() != GL_NO_ERROR || Length <= 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to retrieve program binary");
+        return;
+    }
+    Binary.Data.resize(static_cast<size_t>(Length));
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+    m_Programs.emplace(Key, std::move(Binary));
+}
+
+void PipelineStateCacheGLImpl::GetData(IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    *ppBlob = nullptr;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+    size_t DataSize = sizeof(CacheDataHeader) + m_DriverInfo.length();
+    for (const auto& it : m_Programs)
+        DataSize += sizeof(ProgramBinaryHeader) + it.second.Data.size();
+
+    auto  pDataBlob = DataBlobImpl::Create(DataSize);
+    auto* pDst      = pDataBlob->GetDataPtr<Uint8>();
+
+    auto Write = [&pDst](const void* pSrc, size_t Size) {
+        std::memcpy(pDst, pSrc, Size);
+        pDst += Size;
+    };
+
+    CacheDataHeader Header;
+    Header.DriverInfoSize = static_cast<Uint32>(m_DriverInfo.length());
+    Header.NumPrograms    = static_cast<Uint32>(m_Programs.size());
+    Write(&Header, sizeof(Header));
+    Write(m_DriverInfo.data(), m_DriverInfo.length());
+
+    for (const auto& it : m_Programs)
+    {
+        ProgramBinaryHeader ProgHeader;
+        ProgHeader.Key    = it.first;
+        ProgHeader.Format = it.second.Format;
+        ProgHeader.Size   = static_cast<Uint32>(it.second.Data.size());
+        Write(&ProgHeader, sizeof(ProgHeader));
+        Write(it.second.Data.data(), it.second.Data.size());
+    }
+    VERIFY_EXPR(pDst == pDataBlob->GetDataPtr<Uint8>() + DataSize);
+
+    *ppBlob = pDataBlob.Detach();
+}
+
+} // namespace Diligent
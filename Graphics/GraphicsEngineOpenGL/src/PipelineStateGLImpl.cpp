@@ -35,6 +35,7 @@
 #include "DeviceContextGLImpl.hpp"
 #include "ShaderResourceBindingGLImpl.hpp"
 #include "GLTypeConversions.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 
 #include "EngineMemory.h"
 #include "Align.hpp"
@@ -386,6 +387,8 @@ private:
         // Create programs
 
         // Linking programs may be epxensive, so we cache programs keyed by shader IDs and resource signature IDs or resource layout.
+        // Asynchronous pipelines are linked by the worker thread, if there is one.
+        GLWorkerThread* const pWorkerThread = m_CreateAsynchronously ? m_Pipeline.GetDevice()->GetWorkerThread() : nullptr;
         if (m_Pipeline.m_IsProgramPipelineSupported)
         {
             for (size_t i = 0; i < m_Shaders.size(); ++i)
@@ -399,6 +402,8 @@ private:
                         m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                         m_CreateInfo.ppResourceSignatures,
                         m_CreateInfo.ResourceSignaturesCount,
+                        ClassPtrCast<PipelineStateCacheGLImpl>(m_CreateInfo.pPSOCache),
+                        pWorkerThread,
                     };
                     m_Pipeline.m_GLPrograms[i]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                     m_Pipeline.m_ShaderTypes[i] = m_Shaders[i]->GetDesc().ShaderType;
@@ -416,6 +421,8 @@ private:
                     m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                     m_CreateInfo.ppResourceSignatures,
                     m_CreateInfo.ResourceSignaturesCount,
+                    ClassPtrCast<PipelineStateCacheGLImpl>(m_CreateInfo.pPSOCache),
+                    pWorkerThread,
                 };
                 m_Pipeline.m_GLPrograms[0]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                 m_Pipeline.m_ShaderTypes[0] = ActiveStages;
@@ -626,7 +633,7 @@ void PipelineStateGLImpl::CommitProgram(GLContextState& State)
 
 GLObjectWrappers::GLPipelineObj& PipelineStateGLImpl::GetGLProgramPipeline(GLContext::NativeGLContextType Context)
 {
-    Threading::SpinLockGuard Guard{m_ProgPipelineLock};
+    Threading::AdaptiveLockGuard Guard{m_ProgPipelineLock};
     for (auto& ctx_pipeline : m_GLProgPipelines)
     {
         if (ctx_pipeline.first == Context)
@@ -49,6 +49,9 @@
 #include "PipelineResourceSignatureGLImpl.hpp"
 
 #include "GLTypeConversions.hpp"
+#include "GLDynamicHeap.hpp"
+#include "GLWorkerThread.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 #include "VAOCache.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
@@ -174,7 +177,8 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
         GraphicsAdapterInfo{} // Adapter properties can only be queried after GL context is initialized
     },
     // Device caps must be filled in before the constructor of Pipeline Cache is called!
-    m_GLContext{EngineCI, m_DeviceInfo.Type, m_DeviceInfo.APIVersion, pSCDesc}
+    m_GLContext{EngineCI, m_DeviceInfo.Type, m_DeviceInfo.APIVersion, pSCDesc},
+    m_VAOCacheSize{EngineCI.VAOCacheSize}
 // clang-format on
 {
     VerifyEngineGLCreateInfo(EngineCI);
@@ -258,6 +262,21 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 
     InitAdapterInfo();
 
+    m_GLCaps.ParallelShaderCompile = m_AdapterInfo.Features.AsyncShaderCompilation != DEVICE_FEATURE_STATE_DISABLED;
+    if (EngineCI.EnableWorkerContext)
+    {
+        try
+        {
+            m_pWorkerThread = std::make_unique<GLWorkerThread>(m_GLContext);
+            // Shaders and programs can be compiled asynchronously by the worker thread
+            m_AdapterInfo.Features.AsyncShaderCompilation = DEVICE_FEATURE_STATE_OPTIONAL;
+        }
+        catch (const std::runtime_error&)
+        {
+            LOG_WARNING_MESSAGE("Failed to create the worker GL context. Asynchronous shader compilation will only be available if it is supported by the driver.");
+        }
+    }
+
     // Enable requested device features
     m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
     if (m_AdapterInfo.Features.SeparablePrograms && !EngineCI.Features.SeparablePrograms)
@@ -331,6 +350,12 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
             CHECK_GL_ERROR("glGetIntegerv(GL_MAX_IMAGE_UNITS) failed");
 #endif
         }
+
+        if (m_GLCaps.VertexAttribBinding)
+        {
+            glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET, &m_DeviceLimits.MaxVertexAttribRelativeOffset);
+            CHECK_GL_ERROR("glGetIntegerv(GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET) failed");
+        }
     }
 
     if (m_DeviceInfo.Type == RENDER_DEVICE_TYPE_GL)
@@ -343,11 +368,23 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
 #endif
 
 #if GL_KHR_parallel_shader_compile
-    if (m_DeviceInfo.Features.AsyncShaderCompilation)
+    if (m_DeviceInfo.Features.AsyncShaderCompilation && m_GLCaps.ParallelShaderCompile)
     {
         glMaxShaderCompilerThreadsKHR(EngineCI.NumAsyncShaderCompilationThreads);
     }
 #endif
+
+    if (m_GLCaps.BufferStorage && EngineCI.DynamicHeapSize > 0)
+    {
+        try
+        {
+            m_pDynamicHeap = std::make_unique<GLDynamicHeap>(RawMemAllocator, EngineCI.DynamicHeapSize, m_AdapterInfo.Buffer.ConstantBufferOffsetAlignment);
+        }
+        catch (const std::runtime_error&)
+        {
+            LOG_WARNING_MESSAGE("Failed to create the dynamic heap. Dynamic uniform buffers will be mapped through their own storage.");
+        }
+    }
 }
 
 RenderDeviceGLImpl::~RenderDeviceGLImpl()
@@ -537,7 +574,11 @@ void RenderDeviceGLImpl::CreateDummyTexture(const TextureDesc& TexDesc, RESOURCE
 
 void RenderDeviceGLImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler, bool bIsDeviceInternal)
 {
-    CreateSamplerImpl(ppSampler, SamplerDesc, bIsDeviceInternal);
+    // Device-internal samplers are never shared with the application (see CreateUnsharedSamplerImpl).
+    if (bIsDeviceInternal)
+        CreateUnsharedSamplerImpl(ppSampler, SamplerDesc, bIsDeviceInternal);
+    else
+        CreateSamplerImpl(ppSampler, SamplerDesc, bIsDeviceInternal);
 }
 
 void RenderDeviceGLImpl::CreateSampler(const SamplerDesc& SamplerDesc, ISampler** ppSampler)
@@ -557,12 +598,12 @@ void RenderDeviceGLImpl::CreateComputePipelineState(const ComputePipelineStateCr
 
 void RenderDeviceGLImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
 {
-    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo, false);
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
 }
 
 void RenderDeviceGLImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
 {
-    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo, false);
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
 }
 
 void RenderDeviceGLImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo, IPipelineState** ppPipelineState)
@@ -646,7 +687,13 @@ void RenderDeviceGLImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& Create
 void RenderDeviceGLImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
                                                   IPipelineStateCache**               ppPSOCache)
 {
-    *ppPSOCache = nullptr;
+    if (m_GLCaps.ProgramBinary)
+        CreatePipelineStateCacheImpl(ppPSOCache, CreateInfo);
+    else
+    {
+        LOG_INFO_MESSAGE("Pipeline state cache is not supported as the device does not support program binaries");
+        *ppPSOCache = nullptr;
+    }
 }
 
 SparseTextureFormatInfo RenderDeviceGLImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
@@ -859,6 +906,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(NativeMultiDraw,               IsGL46OrAbove || CheckExtension("GL_ARB_shader_draw_parameters")); // Requirements for gl_DrawID
             ENABLE_FEATURE(AsyncShaderCompilation,        CheckExtension("GL_KHR_parallel_shader_compile"));
             ENABLE_FEATURE(FormattedBuffers,              IsGL40OrAbove);
+            ENABLE_FEATURE(ConditionalRendering,          true);    // Present since 3.0
             // clang-format on
 
             TexProps.MaxTexture1DDimension      = MaxTextureSize;
@@ -888,6 +936,13 @@ void RenderDeviceGLImpl::InitAdapterInfo()
 
             m_GLCaps.FramebufferSRGB  = IsGL40OrAbove || CheckExtension("GL_ARB_framebuffer_sRGB");
             m_GLCaps.SemalessCubemaps = IsGL40OrAbove || CheckExtension("GL_ARB_seamless_cube_map");
+            m_GLCaps.BufferStorage    = GLVersion >= Version{4, 4} || CheckExtension("GL_ARB_buffer_storage");
+            m_GLCaps.ProgramBinary    = GLVersion >= Version{4, 1} || CheckExtension("GL_ARB_get_program_binary");
+
+            m_GLCaps.VertexAttribBinding = GLVersion >= Version{4, 3} || CheckExtension("GL_ARB_vertex_attrib_binding");
+            m_GLCaps.QueryBuffer         = GLVersion >= Version{4, 4} || CheckExtension("GL_ARB_query_buffer_object");
+
+            m_GLCaps.ConditionalRenderInverted = GLVersion >= Version{4, 5} || CheckExtension("GL_ARB_conditional_render_inverted");
         }
         else
         {
@@ -940,6 +995,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
             ENABLE_FEATURE(NativeMultiDraw,           strstr(Extensions, "multi_draw"));
             ENABLE_FEATURE(AsyncShaderCompilation,    strstr(Extensions, "parallel_shader_compile"));
             ENABLE_FEATURE(FormattedBuffers,          IsGLES32OrAbove);
+            ENABLE_FEATURE(ConditionalRendering,      false);
             // clang-format on
 
             TexProps.MaxTexture1DDimension      = 0; // Not supported in GLES 3.2
@@ -968,6 +1024,31 @@ void RenderDeviceGLImpl::InitAdapterInfo()
 
             m_GLCaps.FramebufferSRGB  = strstr(Extensions, "sRGB_write_control");
             m_GLCaps.SemalessCubemaps = false;
+#if PLATFORM_ANDROID
+            m_GLCaps.BufferStorage = strstr(Extensions, "buffer_storage") && glBufferStorage != nullptr;
+#else
+            m_GLCaps.BufferStorage = false;
+#endif
+#if PLATFORM_EMSCRIPTEN
+            // Program binaries are not available in WebGL
+            m_GLCaps.ProgramBinary = false;
+#else
+            m_GLCaps.ProgramBinary = true; // Core in GLES3.0
+#endif
+#if PLATFORM_ANDROID
+            m_GLCaps.VertexAttribBinding = IsGLES31OrAbove;
+#else
+            m_GLCaps.VertexAttribBinding = false;
+#endif
+        }
+
+        if (m_GLCaps.ProgramBinary)
+        {
+            // Drivers are allowed to support zero binary formats
+            GLint NumProgramBinaryFormats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumProgramBinaryFormats);
+            CHECK_GL_ERROR("glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS)");
+            m_GLCaps.ProgramBinary = NumProgramBinaryFormats > 0;
         }
 
 #ifdef GL_KHR_shader_subgroup
@@ -1115,7 +1196,7 @@ void RenderDeviceGLImpl::InitAdapterInfo()
         m_AdapterInfo.Queues[0].TextureCopyGranularity[2] = 1;
     }
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 }
 
 void RenderDeviceGLImpl::FlagSupportedTexFormats()
@@ -1671,33 +1752,43 @@ void RenderDeviceGLImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
 
 FBOCache& RenderDeviceGLImpl::GetFBOCache(GLContext::NativeGLContextType Context)
 {
-    Threading::SpinLockGuard FBOCacheGuard{m_FBOCacheLock};
+    Threading::AdaptiveLockGuard FBOCacheGuard{m_FBOCacheLock};
     return m_FBOCache[Context];
 }
 
 void RenderDeviceGLImpl::OnReleaseTexture(ITexture* pTexture)
 {
-    Threading::SpinLockGuard FBOCacheGuard{m_FBOCacheLock};
+    Threading::AdaptiveLockGuard FBOCacheGuard{m_FBOCacheLock};
     for (auto& FBOCacheIt : m_FBOCache)
         FBOCacheIt.second.OnReleaseTexture(pTexture);
 }
 
 VAOCache& RenderDeviceGLImpl::GetVAOCache(GLContext::NativeGLContextType Context)
 {
-    Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
-    return m_VAOCache[Context];
+    Threading::AdaptiveLockGuard VAOCacheGuard{m_VAOCacheLock};
+    auto it = m_VAOCache.find(Context);
+    if (it == m_VAOCache.end())
+    {
+        const VAOCache::CreateInfo CacheCI{
+            m_GLCaps.VertexAttribBinding,
+            static_cast<Uint32>(m_DeviceLimits.MaxVertexAttribRelativeOffset),
+            m_VAOCacheSize,
+        };
+        it = m_VAOCache.emplace(std::piecewise_construct, std::forward_as_tuple(Context), std::forward_as_tuple(CacheCI)).first;
+    }
+    return it->second;
 }
 
 void RenderDeviceGLImpl::OnDestroyPSO(PipelineStateGLImpl& PSO)
 {
-    Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
+    Threading::AdaptiveLockGuard VAOCacheGuard{m_VAOCacheLock};
     for (auto& VAOCacheIt : m_VAOCache)
         VAOCacheIt.second.OnDestroyPSO(PSO);
 }
 
 void RenderDeviceGLImpl::OnDestroyBuffer(BufferGLImpl& Buffer)
 {
-    Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
+    Threading::AdaptiveLockGuard VAOCacheGuard{m_VAOCacheLock};
     for (auto& VAOCacheIt : m_VAOCache)
         VAOCacheIt.second.OnDestroyBuffer(Buffer);
 }
@@ -1706,7 +1797,7 @@ void RenderDeviceGLImpl::OnDestroyBuffer(BufferGLImpl& Buffer)
 void RenderDeviceGLImpl::PurgeContextCaches(GLContext::NativeGLContextType Context)
 {
     {
-        Threading::SpinLockGuard FBOCacheGuard{m_FBOCacheLock};
+        Threading::AdaptiveLockGuard FBOCacheGuard{m_FBOCacheLock};
 
         auto it = m_FBOCache.find(Context);
         if (it != m_FBOCache.end())
@@ -1716,7 +1807,7 @@ void RenderDeviceGLImpl::PurgeContextCaches(GLContext::NativeGLContextType Conte
         }
     }
     {
-        Threading::SpinLockGuard VAOCacheGuard{m_VAOCacheLock};
+        Threading::AdaptiveLockGuard VAOCacheGuard{m_VAOCacheLock};
 
         auto it = m_VAOCache.find(Context);
         if (it != m_VAOCache.end())
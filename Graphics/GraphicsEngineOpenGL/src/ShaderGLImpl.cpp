@@ -38,6 +38,9 @@
 #include "ShaderToolsCommon.hpp"
 #include "GLTypeConversions.hpp"
 #include "GLProgram.hpp"
+#include "GLWorkerThread.hpp"
+#include "HashUtils.hpp"
+#include "Timer.hpp"
 
 using namespace Diligent;
 
@@ -55,9 +58,17 @@ public:
         m_Shader{Shader},
         m_LoadConstantBufferReflection{ShaderCI.LoadConstantBufferReflection},
         m_CreateAsynchronously{(ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) != 0 && Shader.GetDevice()->GetDeviceInfo().Features.AsyncShaderCompilation},
-        m_ppCompilerOutput{GLShaderCI.ppCompilerOutput}
+        m_ppCompilerOutput{GLShaderCI.ppCompilerOutput},
+        m_pWorkerThread{m_CreateAsynchronously ? Shader.GetDevice()->GetWorkerThread() : nullptr}
     {}
 
+    ~ShaderBuilder()
+    {
+        // The worker thread references the shader object, so the task must complete before the shader is destroyed
+        if (m_CompileTask.valid())
+            m_CompileTask.get();
+    }
+
     bool Tick(bool WaitForCompletion)
     {
         VERIFY(m_State != State::Complete && m_State != State::Failed, "The shader is already in final state, this method should not be called");
@@ -93,7 +104,20 @@ private:
     {
         VERIFY_EXPR(m_State == State::Default);
 
-        m_Shader.CompileShader();
+        if (m_pWorkerThread != nullptr)
+        {
+            ShaderGLImpl& Shader = m_Shader;
+            m_CompileTask        = m_pWorkerThread->EnqueueTask([&Shader]() {
+                Shader.CompileShader();
+                // Block the worker until the compilation is complete
+                GLint Compiled = GL_FALSE;
+                glGetShaderiv(Shader.m_GLShaderObj, GL_COMPILE_STATUS, &Compiled);
+            });
+        }
+        else
+        {
+            m_Shader.CompileShader();
+        }
         m_State = State::Compiling;
     }
 
@@ -102,7 +126,15 @@ private:
         VERIFY_EXPR(m_State == State::Compiling);
 
         GLint CompilationComplete = GL_FALSE;
-        if (!WaitForCompletion)
+        if (m_CompileTask.valid())
+        {
+            if (WaitForCompletion || GLWorkerThread::IsTaskComplete(m_CompileTask))
+            {
+                GLWorkerThread::WaitForTask(m_CompileTask);
+                CompilationComplete = GL_TRUE;
+            }
+        }
+        else if (!WaitForCompletion)
         {
             VERIFY_EXPR(m_CreateAsynchronously);
             glGetShaderiv(m_Shader.m_GLShaderObj, GL_COMPLETION_STATUS_KHR, &CompilationComplete);
@@ -131,7 +163,7 @@ private:
             if (!m_Program)
             {
                 ShaderGLImpl* const ThisShader[]{&m_Shader};
-                m_Program = std::make_unique<GLProgram>(ThisShader, 1, /*IsSeparableProgram = */ true);
+                m_Program = std::make_unique<GLProgram>(ThisShader, 1, /*IsSeparableProgram = */ true, /*pPSOCache = */ nullptr, m_pWorkerThread);
             }
 
             const GLProgram::LinkStatus LinkStatus = m_Program->GetLinkStatus(WaitForCompletion);
@@ -184,6 +216,10 @@ private:
     const bool        m_CreateAsynchronously;
     IDataBlob** const m_ppCompilerOutput;
 
+    // Worker thread that compiles the shader when it is created asynchronously
+    GLWorkerThread* const      m_pWorkerThread;
+    GLWorkerThread::TaskFuture m_CompileTask;
+
     // Temporary program object used to load shader resources
     std::unique_ptr<GLProgram> m_Program;
 
@@ -251,6 +287,8 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
         AppendShaderSourceLanguageDefinition(m_GLSLSourceString, ShaderCI.SourceLanguage);
     }
 
+    m_SourceHash = ComputeHash(m_Desc.ShaderType, ComputeHashRaw(m_GLSLSourceString.data(), m_GLSLSourceString.length()));
+
     if (pDeviceGL == nullptr)
         return;
 
@@ -287,10 +325,12 @@ void ShaderGLImpl::CompileShader() noexcept
     ShaderStrings[0] = m_GLSLSourceString.c_str();
     Lengths[0]       = static_cast<GLint>(m_GLSLSourceString.length());
 
+    Timer CompileTimer;
     // Provide source strings (the strings will be saved in internal OpenGL memory)
     glShaderSource(m_GLShaderObj, static_cast<GLsizei>(ShaderStrings.size()), ShaderStrings.data(), Lengths.data());
     // When the shader is compiled, it will be compiled as if all of the given strings were concatenated end-to-end.
     glCompileShader(m_GLShaderObj);
+    m_CompileTime.store(CompileTimer.GetElapsedTime());
 }
 
 bool ShaderGLImpl::GetCompileStatus(IDataBlob** ppCompilerOutput, bool ThrowOnError) noexcept(false)
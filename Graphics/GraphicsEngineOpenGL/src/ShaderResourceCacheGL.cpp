@@ -27,6 +27,9 @@
 
 #include "pch.h"
 #include "ShaderResourceCacheGL.hpp"
+
+#include <atomic>
+
 #include "RenderDeviceGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
 #include "GLTypeConversions.hpp"
@@ -35,6 +38,12 @@
 namespace Diligent
 {
 
+Uint64 ShaderResourceCacheGL::GenerateContentRevision()
+{
+    static std::atomic<Uint64> NextRevision{1};
+    return NextRevision.fetch_add(1);
+}
+
 size_t ShaderResourceCacheGL::GetRequiredMemorySize(const TResourceCount& ResCount)
 {
     static_assert(std::is_same<TResourceCount, PipelineResourceSignatureGLImpl::TBindings>::value,
@@ -136,7 +145,9 @@ void ShaderResourceCacheGL::BindResources(GLContextState&              GLState,
                                            // will reflect data written by shaders prior to the barrier
             GLState);
 
-        GLState.BindUniformBuffer(binding, UB.pBuffer->GetGLHandle(), static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset), UB.RangeSize);
+        GLState.BindUniformBuffer(binding, UB.pBuffer->GetActiveGLHandle(),
+                                  StaticCast<GLintptr>(UB.pBuffer->GetActiveOffset() + UB.BaseOffset + UB.DynamicOffset),
+                                  UB.RangeSize);
     }
 
     for (Uint32 s = 0, binding = BaseBindings[BINDING_RANGE_TEXTURE]; s < GetTextureCount(); ++s, ++binding)
@@ -311,8 +322,8 @@ void ShaderResourceCacheGL::BindDynamicBuffers(GLContextState&              GLSt
         const auto  UBOIdx = PlatformMisc::GetLSB(UBOBit);
         const auto& UB     = GetConstUB(UBOIdx);
         VERIFY_EXPR(UB.IsDynamic());
-        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetGLHandle(),
-                                  static_cast<GLintptr>(UB.BaseOffset) + static_cast<GLintptr>(UB.DynamicOffset),
+        GLState.BindUniformBuffer(BaseUBOBinding + UBOIdx, UB.pBuffer->GetActiveGLHandle(),
+                                  StaticCast<GLintptr>(UB.pBuffer->GetActiveOffset() + UB.BaseOffset + UB.DynamicOffset),
                                   UB.RangeSize);
     }
 
@@ -95,6 +95,12 @@ SwapChainGLImpl::SwapChainGLImpl(IReferenceCounters*       pRefCounters,
     m_SwapChainDesc.Width  = 1024;
     m_SwapChainDesc.Height = 768;
 #elif PLATFORM_EMSCRIPTEN
+    if (InitAttribs.Window.pCanvasId != nullptr)
+    {
+        m_CanvasId            = InitAttribs.Window.pCanvasId;
+        m_ExplicitSwapControl = InitAttribs.WebGLAttribs.ExplicitSwapControl;
+    }
+
     int32_t CanvasWidth  = 0;
     int32_t CanvasHeight = 0;
     emscripten_get_canvas_element_size(InitAttribs.Window.pCanvasId, &CanvasWidth, &CanvasHeight);
@@ -122,7 +128,18 @@ void SwapChainGLImpl::Present(Uint32 SyncInterval)
 #elif PLATFORM_MACOS
     LOG_ERROR("Swap buffers operation must be performed by the app on MacOS");
 #elif PLATFORM_EMSCRIPTEN
-    LOG_INFO_MESSAGE_ONCE("Swap buffers operation should be performed by the app on the Web");
+    if (m_ExplicitSwapControl)
+    {
+        // With explicit swap control, the browser does not present the frame when the thread
+        // returns to the event loop, which allows rendering from a worker that never yields.
+        auto EmResult = emscripten_webgl_commit_frame();
+        if (EmResult != EMSCRIPTEN_RESULT_SUCCESS)
+            LOG_ERROR_MESSAGE("Failed to commit WebGL frame: emscripten_webgl_commit_frame() returned ", EmResult);
+    }
+    else
+    {
+        LOG_INFO_MESSAGE_ONCE("Swap buffers operation should be performed by the app on the Web");
+    }
 #else
 #    error Unsupported platform
 #endif
@@ -133,6 +150,7 @@ void SwapChainGLImpl::Present(Uint32 SyncInterval)
         auto* pDeviceCtxGl = pDeviceContext.RawPtr<DeviceContextGLImpl>();
         auto* pBackBuffer  = ClassPtrCast<TextureBaseGL>(m_pRenderTargetView->GetTexture());
         pDeviceCtxGl->UnbindTextureFromFramebuffer(pBackBuffer, false);
+        pDeviceCtxGl->FinishFrame();
     }
 }
 
@@ -170,6 +188,27 @@ void SwapChainGLImpl::Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFOR
                                 "). This may be the result of calling Resize before the rotation has taken the effect.");
         }
     }
+#elif PLATFORM_EMSCRIPTEN
+    if (!m_CanvasId.empty())
+    {
+        int32_t CanvasWidth  = 0;
+        int32_t CanvasHeight = 0;
+        emscripten_get_canvas_element_size(m_CanvasId.c_str(), &CanvasWidth, &CanvasHeight);
+        if (NewWidth == 0)
+            NewWidth = static_cast<Uint32>(CanvasWidth);
+        if (NewHeight == 0)
+            NewHeight = static_cast<Uint32>(CanvasHeight);
+
+        // The size of an OffscreenCanvas can only be changed by the thread that owns it, so the
+        // application cannot resize it from the main thread when rendering happens in a worker.
+        // For a canvas owned by the main thread, the call is proxied.
+        if (NewWidth != static_cast<Uint32>(CanvasWidth) || NewHeight != static_cast<Uint32>(CanvasHeight))
+        {
+            auto EmResult = emscripten_set_canvas_element_size(m_CanvasId.c_str(), static_cast<int>(NewWidth), static_cast<int>(NewHeight));
+            if (EmResult != EMSCRIPTEN_RESULT_SUCCESS)
+                LOG_ERROR_MESSAGE("Failed to resize canvas '", m_CanvasId, "': emscripten_set_canvas_element_size() returned ", EmResult);
+        }
+    }
 #endif
 
     TSwapChainGLBase::Resize(NewWidth, NewHeight, NewPreTransform, 0);
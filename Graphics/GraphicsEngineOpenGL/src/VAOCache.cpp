@@ -44,7 +44,8 @@
 namespace Diligent
 {
 
-VAOCache::VAOCache() :
+VAOCache::VAOCache(const CreateInfo& CI) :
+    m_CI{CI},
     m_EmptyVAO{true}
 {
     m_Cache.max_load_factor(0.5f);
@@ -57,6 +58,18 @@ VAOCache::~VAOCache()
     VERIFY(m_Cache.empty(), "VAO cache is not empty. Are there any unreleased objects?");
     VERIFY(m_PSOToKey.empty(), "PSOToKey hash is not empty");
     VERIFY(m_BuffToKey.empty(), "BuffToKey hash is not empty");
+    VERIFY(m_LRUList.empty(), "LRU list is not empty");
+    VERIFY(m_LayoutVAOs.empty(), "Layout VAO cache is not empty. Are there any unreleased pipeline states?");
+}
+
+void VAOCache::EraseVAO(const VAOHashKey& Key)
+{
+    auto it = m_Cache.find(Key);
+    if (it != m_Cache.end())
+    {
+        m_LRUList.erase(it->second.LRUIt);
+        m_Cache.erase(it);
+    }
 }
 
 void VAOCache::OnDestroyBuffer(const BufferGLImpl& Buffer)
@@ -64,7 +77,7 @@ void VAOCache::OnDestroyBuffer(const BufferGLImpl& Buffer)
     // Collect all stale keys that use this buffer.
     std::vector<VAOHashKey> StaleKeys;
 
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     const auto it = m_BuffToKey.find(Buffer.GetUniqueID());
     if (it != m_BuffToKey.end())
@@ -72,7 +85,7 @@ void VAOCache::OnDestroyBuffer(const BufferGLImpl& Buffer)
         for (const auto& Key : it->second)
         {
             StaleKeys.push_back(Key);
-            m_Cache.erase(Key);
+            EraseVAO(Key);
         }
         m_BuffToKey.erase(it);
     }
@@ -87,7 +100,7 @@ void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
     // Collect all stale keys that use this PSO.
     std::vector<VAOHashKey> StaleKeys;
 
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     const auto it = m_PSOToKey.find(PSO.GetUniqueID());
     if (it != m_PSOToKey.end())
@@ -95,10 +108,11 @@ void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
         for (const auto& Key : it->second)
         {
             StaleKeys.push_back(Key);
-            m_Cache.erase(Key);
+            EraseVAO(Key);
         }
         m_PSOToKey.erase(it);
     }
+    m_LayoutVAOs.erase(PSO.GetUniqueID());
 
     // Clear stale entries in m_PSOToKey and m_BuffToKey that refer to dead VAOs
     // to avoid memory leaks.
@@ -107,11 +121,13 @@ void VAOCache::OnDestroyPSO(const PipelineStateGLImpl& PSO)
 
 void VAOCache::Clear()
 {
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     m_Cache.clear();
+    m_LRUList.clear();
     m_PSOToKey.clear();
     m_BuffToKey.clear();
+    m_LayoutVAOs.clear();
 }
 
 void VAOCache::ClearStaleKeys(const std::vector<VAOHashKey>& StaleKeys)
@@ -239,11 +255,97 @@ bool VAOCache::VAOHashKey::operator==(const VAOHashKey& Key) const noexcept
     return true;
 }
 
+const GLObjectWrappers::GLVertexArrayObj* VAOCache::GetLayoutVAO(const VAOAttribs& Attribs, GLContextState& GLState)
+{
+    const auto& InputLayout = Attribs.PSO.GetGraphicsPipelineDesc().InputLayout;
+    const auto* LayoutElems = InputLayout.LayoutElements;
+
+    auto LayoutIt = m_LayoutVAOs.find(Attribs.PSO.GetUniqueID());
+    if (LayoutIt == m_LayoutVAOs.end())
+    {
+        LayoutIt = m_LayoutVAOs.emplace(Attribs.PSO.GetUniqueID(), LayoutVAO{}).first;
+
+        bool IsLayoutSupported = true;
+        for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+        {
+            if (LayoutElems[i].RelativeOffset > m_CI.MaxRelativeOffset)
+                IsLayoutSupported = false;
+        }
+
+        if (IsLayoutSupported)
+        {
+            GLObjectWrappers::GLVertexArrayObj NewVAO{true};
+            GLState.BindVAO(NewVAO);
+
+            for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+            {
+                const auto& LayoutElem = LayoutElems[i];
+                const auto  BuffSlot   = LayoutElem.BufferSlot;
+
+                const auto GlType = TypeToGLType(LayoutElem.ValueType);
+                if (!LayoutElem.IsNormalized &&
+                    (LayoutElem.ValueType == VT_INT8 ||
+                     LayoutElem.ValueType == VT_INT16 ||
+                     LayoutElem.ValueType == VT_INT32 ||
+                     LayoutElem.ValueType == VT_UINT8 ||
+                     LayoutElem.ValueType == VT_UINT16 ||
+                     LayoutElem.ValueType == VT_UINT32))
+                    glVertexAttribIFormat(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.RelativeOffset);
+                else
+                    glVertexAttribFormat(LayoutElem.InputIndex, LayoutElem.NumComponents, GlType, LayoutElem.IsNormalized, LayoutElem.RelativeOffset);
+                glVertexAttribBinding(LayoutElem.InputIndex, BuffSlot);
+
+                if (LayoutElem.Frequency == INPUT_ELEMENT_FREQUENCY_PER_INSTANCE)
+                {
+                    // Note that the divisor is the property of the binding, not the attribute
+                    glVertexBindingDivisor(BuffSlot, LayoutElem.InstanceDataStepRate);
+                }
+                glEnableVertexAttribArray(LayoutElem.InputIndex);
+            }
+            DEV_CHECK_GL_ERROR("Failed to initialize VAO with separate vertex attribute formats");
+
+            LayoutIt->second.VAO = std::move(NewVAO);
+        }
+    }
+
+    auto& Layout = LayoutIt->second;
+    if (!Layout.VAO)
+        return nullptr;
+
+    GLState.BindVAO(Layout.VAO);
+
+    // Only rebind buffers that changed since the last time the VAO was used.
+    // Note that the VAO keeps the storage of released buffers alive until they are replaced.
+    for (Uint32 i = 0; i < InputLayout.NumElements; ++i)
+    {
+        const auto  BuffSlot   = LayoutElems[i].BufferSlot;
+        const auto& CurrStream = Attribs.VertexStreams[BuffSlot];
+        DEV_CHECK_ERR(BuffSlot < Attribs.NumVertexStreams && CurrStream.pBuffer, "VAO requires buffer at slot ", BuffSlot, ", but none is bound in the context.");
+
+        const VAOHashKey::StreamAttribs NewStream{CurrStream.pBuffer->GetUniqueID(), CurrStream.Offset};
+        if (Layout.Streams[BuffSlot] != NewStream)
+        {
+            glBindVertexBuffer(BuffSlot, CurrStream.pBuffer->m_GlBuffer, StaticCast<GLintptr>(CurrStream.Offset), Attribs.PSO.GetBufferStride(BuffSlot));
+            DEV_CHECK_GL_ERROR("Failed to bind vertex buffer to slot ", BuffSlot);
+            Layout.Streams[BuffSlot] = NewStream;
+        }
+    }
+
+    if (Attribs.pIndexBuffer && Layout.IndexBufferUId != Attribs.pIndexBuffer->GetUniqueID())
+    {
+        constexpr bool ResetVAO = false;
+        GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
+        Layout.IndexBufferUId = Attribs.pIndexBuffer->GetUniqueID();
+    }
+
+    return &Layout.VAO;
+}
+
 const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Attribs,
                                                            GLContextState&   GLState)
 {
     // Lock the cache
-    Threading::SpinLockGuard CacheGuard{m_CacheLock};
+    Threading::AdaptiveLockGuard CacheGuard{m_CacheLock};
 
     // Construct the key
     VAOHashKey Key{Attribs};
@@ -275,11 +377,19 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
             GLState);
     }
 
+    if (m_CI.UseVertexAttribBinding)
+    {
+        if (const auto* pVAO = GetLayoutVAO(Attribs, GLState))
+            return *pVAO;
+    }
+
     // Try to find VAO in the map
     auto It = m_Cache.find(Key);
     if (It != m_Cache.end())
     {
-        return It->second;
+        // Move the VAO to the front of the LRU list
+        m_LRUList.splice(m_LRUList.begin(), m_LRUList, It->second.LRUIt);
+        return It->second.VAO;
     }
     else
     {
@@ -334,9 +444,11 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
             GLState.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, Attribs.pIndexBuffer->m_GlBuffer, ResetVAO);
         }
 
-        auto NewElems = m_Cache.emplace(std::make_pair(Key, std::move(NewVAO)));
+        auto NewElems = m_Cache.emplace(Key, CachedVAO{std::move(NewVAO), {}});
         // New element must be actually inserted
         VERIFY(NewElems.second, "New element was not inserted into the cache");
+        m_LRUList.push_front(&NewElems.first->first);
+        NewElems.first->second.LRUIt = m_LRUList.begin();
         VERIFY_EXPR(Key.PsoUId == Attribs.PSO.GetUniqueID());
         m_PSOToKey[Key.PsoUId].push_back(Key);
 
@@ -361,7 +473,21 @@ const GLObjectWrappers::GLVertexArrayObj& VAOCache::GetVAO(const VAOAttribs& Att
 
             m_BuffToKey[Key.Streams[Slot].BufferUId].push_back(Key);
         }
-        return NewElems.first->second;
+
+        if (m_CI.MaxSize != 0 && m_Cache.size() > m_CI.MaxSize)
+        {
+            // Release the least recently used VAOs. The new VAO is at the front of the list,
+            // so it is never released.
+            std::vector<VAOHashKey> StaleKeys;
+            while (m_Cache.size() > m_CI.MaxSize)
+            {
+                StaleKeys.push_back(*m_LRUList.back());
+                EraseVAO(StaleKeys.back());
+            }
+            ClearStaleKeys(StaleKeys);
+        }
+
+        return NewElems.first->second.VAO;
     }
 }
 
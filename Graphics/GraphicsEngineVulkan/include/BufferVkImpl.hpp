@@ -122,7 +122,7 @@ public:
 
     void* GetCPUAddress()
     {
-        VERIFY_EXPR(m_Desc.Usage == USAGE_STAGING || m_Desc.Usage == USAGE_UNIFIED);
+        VERIFY_EXPR(m_Desc.Usage == USAGE_STAGING || m_Desc.Usage == USAGE_UNIFIED || (m_Desc.MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) != 0);
         return reinterpret_cast<Uint8*>(m_MemoryAllocation.Page->GetCPUMemory()) + m_BufferMemoryAlignedOffset;
     }
 
@@ -133,8 +133,9 @@ private:
 
     VulkanUtilities::BufferViewWrapper CreateView(struct BufferViewDesc& ViewDesc);
 
-    Uint32       m_DynamicOffsetAlignment    = 0;
-    VkDeviceSize m_BufferMemoryAlignedOffset = 0;
+    Uint32          m_DynamicOffsetAlignment    = 0;
+    VkDeviceSize    m_BufferMemoryAlignedOffset = 0;
+    VkDeviceAddress m_VkDeviceAddress           = 0;
 
     // TODO (assiduous): move dynamic allocations to device context.
     static constexpr size_t CacheLineSize = 64;
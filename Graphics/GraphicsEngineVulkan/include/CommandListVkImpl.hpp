@@ -30,9 +30,12 @@
 /// \file
 /// Declaration of Diligent::CommandListVkImpl class
 
+#include <atomic>
+
 #include "EngineVkImplTraits.hpp"
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "CommandListBase.hpp"
+#include "DeviceContextVkImpl.hpp"
 
 namespace Diligent
 {
@@ -46,18 +49,32 @@ public:
     CommandListVkImpl(IReferenceCounters*  pRefCounters,
                       RenderDeviceVkImpl*  pDevice,
                       DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+                      VkCommandBuffer      vkCmdBuff,
+                      bool                 IsSecondary  = false,
+                      VkRenderPass         vkRenderPass = VK_NULL_HANDLE,
+                      VulkanUtilities::VulkanCommandBufferPool* pReusableCmdPool = nullptr) :
         // clang-format off
-        TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
-        m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        TCommandListBase  {pRefCounters, pDevice, pDeferredCtx},
+        m_pDeferredCtx    {pDeferredCtx    },
+        m_vkCmdBuff       {vkCmdBuff       },
+        m_vkRenderPass    {vkRenderPass    },
+        m_IsSecondary     {IsSecondary     },
+        m_pReusableCmdPool{pReusableCmdPool}
     // clang-format on
     {
+        VERIFY(!IsReusable() || IsSecondary, "Only secondary command lists can be reusable");
     }
 
     ~CommandListVkImpl()
     {
-        VERIFY(m_vkCmdBuff == VK_NULL_HANDLE && !m_pDeferredCtx, "Destroying command list that was never executed");
+        if (IsReusable())
+        {
+            m_pDeferredCtx.RawPtr<DeviceContextVkImpl>()->DisposeReusableVkCmdBuffer(m_vkCmdBuff, *m_pReusableCmdPool, m_ExecutedQueueMask.load());
+        }
+        else
+        {
+            VERIFY(m_vkCmdBuff == VK_NULL_HANDLE && !m_pDeferredCtx, "Destroying command list that was never executed");
+        }
     }
 
     void Close(RefCntAutoPtr<IDeviceContext>& outDeferredCtx, VkCommandBuffer& outVkCmdBuff)
@@ -67,9 +84,35 @@ public:
         m_vkCmdBuff    = VK_NULL_HANDLE;
     }
 
+    // Secondary command lists are recorded by IDeviceContextVk::BeginSecondaryCommandList()
+    bool IsSecondary() const { return m_IsSecondary; }
+
+    // Implicit render pass the secondary command list was recorded in, or null for dynamic rendering
+    VkRenderPass GetVkRenderPass() const { return m_vkRenderPass; }
+
+    // Reusable command lists are recorded by IDeviceContextVk::BeginReusableCommandList()
+    bool IsReusable() const { return m_pReusableCmdPool != nullptr; }
+
+    // Returns the command buffer of a reusable command list to execute by the primary command buffer of the
+    // immediate context with the given queue. Unlike other command lists, reusable lists are not consumed.
+    VkCommandBuffer GetReusableVkCmdBuffer(SoftwareQueueIndex CmdQueue)
+    {
+        VERIFY_EXPR(IsReusable());
+        m_ExecutedQueueMask.fetch_or(Uint64{1} << Uint64{CmdQueue});
+        return m_vkCmdBuff;
+    }
+
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+    const VkRenderPass            m_vkRenderPass;
+    const bool                    m_IsSecondary;
+
+    // The pool the command buffer of a reusable command list is returned to
+    VulkanUtilities::VulkanCommandBufferPool* const m_pReusableCmdPool;
+
+    // Queues that have executed the reusable command list
+    std::atomic<Uint64> m_ExecutedQueueMask{0};
 };
 
 } // namespace Diligent
@@ -145,19 +145,38 @@ public:
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence)
     {
         VERIFY_EXPR(pFence->GetDesc().Type == FENCE_TYPE_CPU_WAIT_ONLY);
-        VERIFY_EXPR(!pFence->IsTimelineSemaphore());
-        m_pFence = std::move(pFence);
+        VERIFY_EXPR(pFence->IsTimelineSemaphore() == m_SupportedTimelineSemaphore);
+        m_pFence           = std::move(pFence);
+        m_vkFenceSemaphore = m_pFence->IsTimelineSemaphore() ? m_pFence->GetVkSemaphore() : VK_NULL_HANDLE;
     }
 
+    /// Returns the sync point of the last submission.
+    /// When the queue fence is a timeline semaphore, sync points are not created and null is returned.
+    /// All fences are timeline semaphores in this case and never need a sync point.
     SyncPointVkPtr GetLastSyncPoint()
     {
         Threading::SpinLockGuard Guard{m_LastSyncPointLock};
         return m_LastSyncPoint;
     }
 
+    /// Enqueues the command buffer for execution without submitting it to the Vulkan queue.
+    /// Pending command buffers are submitted together with the next submission to this queue
+    /// in a single vkQueueSubmit call and share its fence. Any operation that
+    /// requires the previous work to be submitted (present, sparse binding, signaling external
+    /// fences and semaphores, waiting for idle) submits the pending command buffers first.
+    /// Returns the fence value associated with the command buffer.
+    Uint64 EnqueueCmdBuffer(VkCommandBuffer vkCmdBuffer);
+
 private:
     SyncPointVkPtr CreateSyncPoint(Uint64 dbgValue);
 
+    // Submits pending command buffers followed by the given submit info (if not null)
+    // with a single vkQueueSubmit call. m_QueueMutex must be locked.
+    Uint64 InternalSubmit(const VkSubmitInfo* pInSubmitInfo);
+
+    // Submits pending command buffers, if any. m_QueueMutex must be locked.
+    void FlushPendingCmdBuffers();
+
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
     std::shared_ptr<VulkanUtilities::VulkanLogicalDevice> m_LogicalDevice;
@@ -174,6 +193,11 @@ private:
     // are guaranteed to be finished by the GPU
     RefCntAutoPtr<FenceVkImpl> m_pFence;
 
+    // Timeline semaphore of m_pFence that is signaled with the fence value by every submission.
+    // Null if timeline semaphores are not supported, in which case every submission creates
+    // a sync point with a binary fence.
+    VkSemaphore m_vkFenceSemaphore = VK_NULL_HANDLE;
+
     // A value that will be signaled by the command queue next
     std::atomic<Uint64> m_NextFenceValue{1};
 
@@ -182,6 +206,15 @@ private:
 
     // Array used to merge semaphores from SubmitInfo and from SyncPointVk
     std::vector<VkSemaphore> m_TempSignalSemaphores;
+    std::vector<Uint64>      m_TempSignalSemaphoreValues;
+
+    // Command buffers enqueued by EnqueueCmdBuffer() that have not been submitted yet,
+    // and their fence values. Protected by m_QueueMutex.
+    std::vector<VkCommandBuffer> m_PendingCmdBuffers;
+    std::vector<Uint64>          m_PendingFenceValues;
+
+    // The maximum number of pending command buffers after which they are submitted immediately
+    static constexpr size_t MaxPendingCmdBuffers = 32;
 
     // Protects access to the m_LastSyncPoint
     Threading::SpinLock m_LastSyncPointLock;
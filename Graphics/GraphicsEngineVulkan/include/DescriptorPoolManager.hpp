@@ -153,6 +153,10 @@ public:
 
     RenderDeviceVkImpl& GetDeviceVkImpl() { return m_DeviceVkImpl; }
 
+    // Returns the maximum number of descriptor sets that can be allocated from the pools
+    // currently owned by the manager.
+    Uint32 GetPoolCapacity();
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedPoolCounter() const
     {
@@ -204,28 +208,22 @@ public:
         }
     // clang-format on
     {
-#ifdef DILIGENT_DEVELOPMENT
         m_AllocatedSetCounter = 0;
-#endif
     }
 
     ~DescriptorSetAllocator();
 
     DescriptorSetAllocation Allocate(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "");
 
-#ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedDescriptorSetCounter() const
     {
         return m_AllocatedSetCounter.load();
     }
-#endif
 
 private:
     void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask);
 
-#ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedSetCounter;
-#endif
 };
 
 
@@ -43,6 +43,7 @@
 #include "QueryVkImpl.hpp"
 #include "FramebufferVkImpl.hpp"
 #include "RenderPassVkImpl.hpp"
+#include "RenderPassCache.hpp"
 #include "BottomLevelASVkImpl.hpp"
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
@@ -97,6 +98,9 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetDynamicRenderState() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetDynamicRenderState(const DynamicRenderState& State) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                                      Uint32                         NumBuffersSet,
@@ -176,6 +180,10 @@ public:
                                                       const void*                    RGBA,
                                                       RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateAttachments() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE InvalidateAttachments(Uint32               NumViews,
+                                                          ITextureView* const* ppViews) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                                  Uint64                         Offset,
@@ -247,6 +255,19 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::ResolveQueries() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE ResolveQueries(IQuery* const*                 ppQueries,
+                                                   Uint32                         NumQueries,
+                                                   IBuffer*                       pDstBuffer,
+                                                   Uint64                         DstOffset,
+                                                   RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginConditionalRendering() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::EndConditionalRendering() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE EndConditionalRendering() override final;
+
     /// Implementation of IDeviceContext::Flush() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -297,11 +318,13 @@ public:
     // Transitions texture subresources from OldState to NewState, and optionally updates
     // internal texture state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal texture state is used as old state.
+    // If vkSplitBarrierEvent is not null, the transition ends the split barrier begun with this event.
     void TransitionTextureState(TextureVkImpl&           TextureVk,
                                 RESOURCE_STATE           OldState,
                                 RESOURCE_STATE           NewState,
                                 STATE_TRANSITION_FLAGS   Flags,
-                                VkImageSubresourceRange* pSubresRange = nullptr);
+                                VkImageSubresourceRange* pSubresRange        = nullptr,
+                                VkEvent                  vkSplitBarrierEvent = VK_NULL_HANDLE);
 
     /// Implementation of IDeviceContextVk::TransitionImageLayout().
     virtual void DILIGENT_CALL_TYPE TransitionImageLayout(ITexture* pTexture, VkImageLayout NewLayout) override final;
@@ -310,10 +333,12 @@ public:
     // Transitions buffer state from OldState to NewState, and optionally updates
     // internal buffer state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal buffer state is used as old state.
+    // If vkSplitBarrierEvent is not null, the transition ends the split barrier begun with this event.
     void TransitionBufferState(BufferVkImpl&  BufferVk,
                                RESOURCE_STATE OldState,
                                RESOURCE_STATE NewState,
-                               bool           UpdateBufferState);
+                               bool           UpdateBufferState,
+                               VkEvent        vkSplitBarrierEvent = VK_NULL_HANDLE);
 
     /// Implementation of IDeviceContextVk::BufferMemoryBarrier().
     virtual void DILIGENT_CALL_TYPE BufferMemoryBarrier(IBuffer* pBuffer, VkAccessFlags NewAccessFlags) override final;
@@ -321,6 +346,18 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::BeginSecondaryCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryCommandList(Uint32                         ImmediateContextId,
+                                                              const SetRenderTargetsAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContextVk::BeginReusableCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginReusableCommandList(Uint32                         ImmediateContextId,
+                                                             const SetRenderTargetsAttribs& Attribs) override final;
+
+    // Returns the command buffer of a reusable command list to the pool once all primary command buffers
+    // submitted to the queues in QueueMask are complete. This method may be called from any thread.
+    void DisposeReusableVkCmdBuffer(VkCommandBuffer vkCmdBuff, VulkanUtilities::VulkanCommandBufferPool& Pool, Uint64 QueueMask);
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -397,6 +434,10 @@ public:
     {
         // Descriptor pools are externally synchronized, meaning that the application must not allocate
         // and/or free descriptor sets from the same pool in multiple threads simultaneously (13.2.3)
+        DEV_CHECK_ERR(!m_IsReusableCmdList,
+                      "Dynamic descriptor sets are released at the end of the frame and can't be used by reusable command lists. "
+                      "Reusable command lists must not use dynamic shader variables.");
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.AllocationCounters.DescriptorSets);
         return m_DynamicDescrSetAllocator.Allocate(SetLayout, DebugName);
     }
 
@@ -409,13 +450,25 @@ public:
 private:
     void               TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
     __forceinline void CommitRenderPassAndFramebuffer(bool VerifyStates);
+    // Begins the render pass for the bound render targets to perform the deferred attachment clears.
+    void FlushPendingClears();
+    // Returns true if the render pass for the bound render targets is running in the command buffer.
+    bool IsRenderingToBoundTargets() const;
+    void SetDynamicRenderingLoadOps(Uint32 ClearMask, Uint32 DiscardMask);
     void               CommitVkVertexBuffers();
     void               CommitViewports();
     void               CommitScissorRects();
+    void               CommitDynamicRenderState();
+    void               CommitShaderObjectStates();
 
     void Flush(Uint32               NumCommandLists,
                ICommandList* const* ppCommandLists);
 
+    // Sets the event that the end half of the split barrier will wait for.
+    void BeginSplitBarrier(const StateTransitionDesc& Barrier);
+    // Releases split barriers that were begun in the current command buffer but never ended.
+    void ReleasePendingSplitBarriers();
+
     __forceinline void TransitionOrVerifyBufferState(BufferVkImpl&                  Buffer,
                                                      RESOURCE_STATE_TRANSITION_MODE TransitionMode,
                                                      RESOURCE_STATE                 RequiredState,
@@ -440,7 +493,7 @@ private:
 
     void AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter);
 
-    __forceinline void EnsureVkCmdBuffer()
+    __forceinline void EnsureVkCmdBuffer(bool FlushClears = true)
     {
         VERIFY_EXPR(m_CmdPool != nullptr);
 
@@ -449,12 +502,31 @@ private:
         m_State.NumCommands = m_State.NumCommands != 0 ? m_State.NumCommands : 1;
         if (m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE)
         {
-            auto vkCmdBuff = m_CmdPool->GetCommandBuffer();
-            m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
+            if (m_IsSecondaryCmdList)
+            {
+                BeginSecondaryVkCmdBuffer();
+            }
+            else
+            {
+                auto vkCmdBuff = m_CmdPool->GetCommandBuffer();
+                m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
+            }
         }
+
+        // Deferred clears must be performed before any command that is not
+        // part of the render pass for the bound render targets.
+        if (FlushClears && m_PendingClears.Mask != 0)
+            FlushPendingClears();
     }
 
-    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
+    // Begins the secondary command buffer that continues the render pass instance defined by the bound render targets
+    void BeginSecondaryVkCmdBuffer();
+
+    // Executes secondary command lists in the render pass instance defined by the bound render targets
+    void ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                      ICommandList* const* ppCommandLists);
+
+    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, bool IsSecondary = false);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -483,11 +555,13 @@ private:
 
     void DvpLogRenderPass_PSOMismatch();
 
-    void CreateASCompactedSizeQueryPool();
+    VkQueryPool GetASCompactedSizeQueryPool();
+    VkBuffer    GetDummyVertexBuffer();
 
     void PrepareCommandPool(SoftwareQueueIndex CommandQueueId);
 
     void ChooseRenderPassAndFramebuffer();
+    void PrepareDynamicRenderingInfo();
 
     VulkanUtilities::VulkanCommandBuffer m_CommandBuffer;
 
@@ -540,6 +614,10 @@ private:
         // Pipeline layout of the currently bound pipeline
         VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
 
+        // Descriptors last pushed to the dynamic set of the signature at binding index 0
+        // when push descriptors are used (see PipelineResourceSignatureVkImpl::UsesPushDescriptors()).
+        PipelineResourceSignatureVkImpl::PushDescriptorState PushDescriptors;
+
         ResourceBindInfo()
         {}
     };
@@ -547,6 +625,7 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -568,8 +647,84 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Dynamic rendering attachments that match currently bound render targets.
+    /// When VK_KHR_dynamic_rendering is enabled, they are used instead of the implicit
+    /// render pass and framebuffer, which are then null.
+    struct DynamicRenderingInfo
+    {
+        std::array<VkRenderingAttachmentInfoKHR, MAX_RENDER_TARGETS> ColorAttachments{};
+
+        VkRenderingAttachmentInfoKHR DepthAttachment{};
+        VkRenderingAttachmentInfoKHR StencilAttachment{};
+
+        VkRenderingInfoKHR RenderingInfo{};
+
+        /// Indicates that RenderingInfo matches currently bound render targets.
+        /// The rendering may or may not be currently begun in the command buffer.
+        bool IsValid = false;
+    };
+    DynamicRenderingInfo m_DynamicRendering;
+
+    /// Key of the implicit render pass that matches currently bound render targets.
+    RenderPassCache::RenderPassCacheKey m_RenderPassKey;
+
+    /// Clears of the bound render targets that are deferred until the render pass is begun,
+    /// so that they are performed by VK_ATTACHMENT_LOAD_OP_CLEAR instead of loading
+    /// the attachment contents and clearing them with vkCmdClearAttachments.
+    struct PendingClearsInfo
+    {
+        void SetColor(Uint32 RTIndex, const VkClearColorValue& Color)
+        {
+            Colors[RTIndex] = Color;
+            Mask |= 1u << RTIndex;
+        }
+
+        void SetDepthStencil(CLEAR_DEPTH_STENCIL_FLAGS ClearFlags, float Depth, Uint8 Stencil)
+        {
+            if (ClearFlags & CLEAR_DEPTH_FLAG)
+            {
+                DepthStencil.depth = Depth;
+                Mask |= RenderPassCache::RenderPassCacheKey::DepthAttachmentBit;
+            }
+            if (ClearFlags & CLEAR_STENCIL_FLAG)
+            {
+                DepthStencil.stencil = Stencil;
+                Mask |= RenderPassCache::RenderPassCacheKey::StencilAttachmentBit;
+            }
+        }
+
+        std::array<VkClearColorValue, MAX_RENDER_TARGETS> Colors{};
+        VkClearDepthStencilValue                          DepthStencil{};
+
+        /// Attachments to clear, see RenderPassCache::RenderPassCacheKey::ClearMask.
+        Uint32 Mask = 0;
+    };
+    PendingClearsInfo m_PendingClears;
+
+    /// Bound attachments whose contents are not loaded when the render pass is begun next time,
+    /// see IDeviceContext::InvalidateAttachments().
+    Uint32 m_InvalidatedAttachments = 0;
+
+    /// Bound attachments created with MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT flag that are never loaded or stored.
+    Uint32 m_TransientAttachments = 0;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
+    // Indicates that the deferred context records a secondary command list (see BeginSecondaryCommandList)
+    bool m_IsSecondaryCmdList = false;
+
+    // Indicates that the secondary command list is reusable (see BeginReusableCommandList)
+    bool m_IsReusableCmdList = false;
+
+    // Secondary command buffers executed by the immediate context that will be recycled
+    // when the primary command buffer is submitted by the next Flush().
+    struct PendingSecondaryCmdBuffer
+    {
+        RefCntAutoPtr<IDeviceContext> pDeferredCtx;
+        VkCommandBuffer               vkCmdBuff = VK_NULL_HANDLE;
+    };
+    std::vector<PendingSecondaryCmdBuffer> m_PendingSecondaryCmdBuffers;
+
     // Semaphores are not owned by the command context
     std::vector<RefCntAutoPtr<ManagedSemaphore>>          m_WaitManagedSemaphores;
     std::vector<RefCntAutoPtr<ManagedSemaphore>>          m_SignalManagedSemaphores;
@@ -625,7 +780,8 @@ private:
     VulkanDynamicHeap             m_DynamicHeap;
     DynamicDescriptorSetAllocator m_DynamicDescrSetAllocator;
 
-    // In Vulkan we can't bind null vertex buffer, so we have to create a dummy VB
+    // In Vulkan we can't bind null vertex buffer, so we have to use a dummy VB.
+    // The buffer is created on first use.
     RefCntAutoPtr<BufferVkImpl> m_DummyVB;
 
     QueryManagerVk* m_pQueryMgr            = nullptr;
@@ -634,6 +790,17 @@ private:
     std::vector<VkClearValue> m_vkClearValues;
 
     VulkanUtilities::QueryPoolWrapper m_ASQueryPool;
+
+    // Split barriers begun with STATE_TRANSITION_TYPE_BEGIN and not yet ended.
+    // The begin half sets the event, the end half waits for it.
+    struct PendingSplitBarrier
+    {
+        RefCntAutoPtr<IDeviceObject>  pResource;
+        RESOURCE_STATE                OldState = RESOURCE_STATE_UNKNOWN;
+        RESOURCE_STATE                NewState = RESOURCE_STATE_UNKNOWN;
+        VulkanUtilities::EventWrapper Event;
+    };
+    std::unordered_map<IDeviceObject*, PendingSplitBarrier> m_PendingSplitBarriers;
 };
 
 } // namespace Diligent
@@ -70,6 +70,9 @@ public:
     /// Implementation of IFence::Wait() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
 
+    /// Implementation of IFence::RegisterCompletionCallback() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData) override final;
+
     /// Implementation of IFenceVk::GetVkSemaphore().
     virtual VkSemaphore DILIGENT_CALL_TYPE GetVkSemaphore() override final { return m_TimelineSemaphore; }
 
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCache class
+
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+#include <string>
+
+#include "GraphicsTypes.h"
+#include "GraphicsTypesX.hpp"
+#include "HashUtils.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class PipelineResourceSignatureVkImpl;
+
+/// Cache of graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+
+/// Graphics pipelines are split into vertex input interface, pre-rasterization shaders,
+/// fragment shader and fragment output interface libraries. Pipelines that share
+/// one of the parts reuse the library that was compiled for the first of them.
+class PipelineLibraryCache
+{
+public:
+    PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    PipelineLibraryCache             (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache             (PipelineLibraryCache&&)      = delete;
+    PipelineLibraryCache& operator = (const PipelineLibraryCache&) = delete;
+    PipelineLibraryCache& operator = (PipelineLibraryCache&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCache();
+
+    // This structure is used as the key to find pipeline library
+    struct LibraryKey
+    {
+        // Pipeline part compiled into the library, one of VkGraphicsPipelineLibraryFlagBitsEXT.
+        VkGraphicsPipelineLibraryFlagsEXT Part = 0;
+
+        // Fixed-function state. Only the members that are used by the library part are set,
+        // all other members keep their default values. Desc.InputLayout is always empty,
+        // the input layout is kept in the InputLayout member.
+        GraphicsPipelineDesc Desc;
+        InputLayoutDescX     InputLayout;
+
+        // Resource signatures that define the pipeline layout of the shader parts
+        std::vector<RefCntAutoPtr<PipelineResourceSignatureVkImpl>> Signatures;
+
+        struct ShaderInfo
+        {
+            VkShaderStageFlagBits Stage = VK_SHADER_STAGE_FLAG_BITS_MAX_ENUM;
+            std::string           EntryPoint;
+            std::vector<uint32_t> SPIRV;
+
+            bool operator==(const ShaderInfo& rhs) const noexcept
+            {
+                return Stage == rhs.Stage && EntryPoint == rhs.EntryPoint && SPIRV == rhs.SPIRV;
+            }
+        };
+        // Shaders of the pre-rasterization and fragment shader parts
+        std::vector<ShaderInfo> Shaders;
+
+        bool operator==(const LibraryKey& rhs) const noexcept;
+
+        size_t GetHash() const noexcept;
+
+    private:
+        mutable size_t Hash = 0;
+    };
+
+    // Returns the library for the given key. If there is no such library in the cache,
+    // calls CreateLibrary() to create a new one.
+    template <typename CreateLibraryHandlerType>
+    VkPipeline GetLibrary(LibraryKey&& Key, CreateLibraryHandlerType&& CreateLibrary) noexcept(false)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+
+            auto it = m_Cache.find(Key);
+            if (it != m_Cache.end())
+                return it->second;
+        }
+
+        // Do not hold the lock while the library is being compiled
+        VulkanUtilities::PipelineWrapper Library = CreateLibrary();
+
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        // If another thread has created the same library in the meantime, the new one is discarded.
+        // This is safe as the library has not been used yet.
+        auto it_inserted = m_Cache.emplace(std::move(Key), std::move(Library));
+        return it_inserted.first->second;
+    }
+
+    void Destroy();
+
+private:
+    struct LibraryKeyHash
+    {
+        std::size_t operator()(const LibraryKey& Key) const
+        {
+            return Key.GetHash();
+        }
+    };
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    std::mutex                                                                       m_Mutex;
+    std::unordered_map<LibraryKey, VulkanUtilities::PipelineWrapper, LibraryKeyHash> m_Cache;
+};
+
+} // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -51,6 +52,11 @@ namespace Diligent
 struct SPIRVShaderResourceAttribs;
 class DeviceContextVkImpl;
 
+namespace VulkanUtilities
+{
+class VulkanCommandBuffer;
+}
+
 struct ImmutableSamplerAttribsVk
 {
     Uint32 DescrSet     = ~0u;
@@ -123,6 +129,9 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns true if the dynamic descriptor set is a push descriptor set (VK_KHR_push_descriptor)
+    bool UsesPushDescriptors() const { return m_UsePushDescriptors; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -134,6 +143,44 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Descriptors that were last pushed to the push descriptor set
+    struct PushDescriptorState
+    {
+        // Pipeline layout the descriptors were pushed with. Push descriptors must be
+        // pushed again in full when the layout changes.
+        VkPipelineLayout vkLayout = VK_NULL_HANDLE;
+
+        // Handles, offsets and ranges of the pushed descriptors, indexed by the resource cache offset
+        std::vector<std::array<Uint64, 3>> Descriptors;
+
+        void Invalidate() { vkLayout = VK_NULL_HANDLE; }
+    };
+
+    // Pushes the dynamic resources from ResourceCache that differ from the ones in State
+    // to the push descriptor set with index SetIndex in the pipeline layout vkLayout.
+    void PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                              DeviceContextIndex                    CtxId,
+                              VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint                   BindPoint,
+                              VkPipelineLayout                      vkLayout,
+                              Uint32                                SetIndex,
+                              PushDescriptorState&                  State) const;
+
+    // Returns the size of the descriptor set with the given index in the descriptor buffer.
+    // Only valid when the device uses descriptor buffers (VK_EXT_descriptor_buffer).
+    VkDeviceSize GetDescriptorBufferSetSize(Uint32 SetIndex) const
+    {
+        VERIFY_EXPR(SetIndex < MAX_DESCRIPTOR_SETS);
+        return m_DescriptorBufferSetSizes[SetIndex];
+    }
+
+    // Writes descriptors of all resources in the descriptor set SetIndex of ResourceCache
+    // to the descriptor buffer memory pointed to by pDstData.
+    void WriteDescriptorBufferSet(const ShaderResourceCacheVk& ResourceCache,
+                                  Uint32                       SetIndex,
+                                  DeviceContextIndex           CtxId,
+                                  Uint8*                       pDstData) const;
+
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
     bool DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
@@ -177,6 +224,15 @@ private:
     void Destruct();
 
     void CreateSetLayouts(bool IsSerialized);
+    void CreateDynamicSetUpdateTemplate();
+
+    // The size of the stack buffer that holds the descriptor update template data. Dynamic sets
+    // that require more space are updated through vkUpdateDescriptorSets.
+    static constexpr size_t DynamicSetTemplateDataBufferSize = 4096;
+
+    // Writes descriptors of the dynamic resources in SetResources to pData using the layout of
+    // m_DynamicSetUpdateTemplate. Returns false if any resource is null.
+    bool WriteDynamicSetTemplateData(const ShaderResourceCacheVk::DescriptorSet& SetResources, Uint8* pData) const;
 
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
@@ -193,6 +249,32 @@ private:
     // The total number storage buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
+
+    // Whether the dynamic descriptor set is a push descriptor set. Buffers in this set are not counted
+    // in m_DynamicUniformBufferCount and m_DynamicStorageBufferCount as their offsets are pushed directly.
+    bool m_UsePushDescriptors = false;
+
+    // Descriptor update template that writes all dynamic resources with a single call.
+    // Only initialized when neither push descriptors nor descriptor buffers are used.
+    VulkanUtilities::DescrUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+
+    // The size of the data consumed by m_DynamicSetUpdateTemplate
+    Uint32 m_DynamicSetUpdateTemplateDataSize = 0;
+
+    // The members below are only initialized when the device uses descriptor buffers.
+
+    // Descriptor set layout sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
+    std::array<VkDeviceSize, MAX_DESCRIPTOR_SETS> m_DescriptorBufferSetSizes = {};
+
+    // Binding offset in the descriptor set layout of each resource in m_Desc.Resources
+    std::vector<VkDeviceSize> m_DescriptorBufferResourceOffsets;
+
+    // Immutable sampler assigned to each resource in m_Desc.Resources, or VK_NULL_HANDLE.
+    // With descriptor buffers, immutable samplers are not written automatically.
+    std::vector<VkSampler> m_DescriptorBufferResourceSamplers;
+
+    // Binding offset of each immutable sampler that is not assigned to any resource, or ~0.
+    std::vector<VkDeviceSize> m_DescriptorBufferImmutableSamplerOffsets;
 };
 
 template <> Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>() const;
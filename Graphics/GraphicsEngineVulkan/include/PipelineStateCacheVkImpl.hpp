@@ -29,6 +29,9 @@
 /// \file
 /// Declaration of Diligent::PipelineStateCacheVkImpl class
 
+#include <mutex>
+#include <vector>
+
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateCacheBase.hpp"
 
@@ -55,10 +58,60 @@ public:
     virtual void DILIGENT_CALL_TYPE GetData(IDataBlob** ppBlob) override final;
 
     /// Implementation of IPipelineStateCacheVk::GetVkPipelineCache().
+    /// The returned cache is the one that per-thread caches are merged into.
+    /// It is not used to create pipelines internally.
     virtual VkPipelineCache DILIGENT_CALL_TYPE GetVkPipelineCache() const override final { return m_PipelineStateCache; }
 
+    // Many drivers lock the pipeline cache for the duration of pipeline creation, which serializes
+    // pipeline compilation on multiple threads. To avoid this, every pipeline is created with a cache
+    // that is exclusively owned by the creating thread. Thread caches are taken from a pool and are
+    // periodically merged into the main cache, which is returned by GetVkPipelineCache() and GetData().
+    class ThreadCache
+    {
+    public:
+        // pCache may be null, in which case the cache handle is VK_NULL_HANDLE.
+        explicit ThreadCache(IPipelineStateCache* pCache);
+        ~ThreadCache();
+
+        // clang-format off
+        ThreadCache           (const ThreadCache&)  = delete;
+        ThreadCache           (      ThreadCache&&) = delete;
+        ThreadCache& operator=(const ThreadCache&)  = delete;
+        ThreadCache& operator=(      ThreadCache&&) = delete;
+        // clang-format on
+
+        operator VkPipelineCache() const { return m_Cache.vkCache; }
+
+    private:
+        RefCntAutoPtr<PipelineStateCacheVkImpl> m_pOwner;
+
+        struct PooledCache
+        {
+            VulkanUtilities::PipelineCacheWrapper vkCache;
+
+            // The number of pipelines created with the cache since it was last merged
+            Uint32 NumPipelines = 0;
+        } m_Cache;
+
+        friend PipelineStateCacheVkImpl;
+    };
+
 private:
+    using PooledCache = ThreadCache::PooledCache;
+
+    PooledCache AcquireThreadCache();
+    void        ReleaseThreadCache(PooledCache&& Cache);
+
+    // Merges thread caches into the main cache. m_PoolMtx must be locked.
+    void MergeThreadCaches(const VkPipelineCache* pCaches, Uint32 NumCaches);
+
+    // The number of pipelines created with a thread cache after which it is merged into the main cache
+    static constexpr Uint32 MergeInterval = 32;
+
     VulkanUtilities::PipelineCacheWrapper m_PipelineStateCache;
+
+    std::mutex               m_PoolMtx;
+    std::vector<PooledCache> m_ThreadCachePool;
 };
 
 } // namespace Diligent
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -69,10 +70,56 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+
+    /// \remarks   When a graphics pipeline is linked from pipeline libraries, or when SPIR-V
+    ///             optimization is deferred (see EngineVkCreateInfo::DeferSPIRVOptimization),
+    ///             the optimized pipeline is returned as soon as its background compilation is complete.
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        return m_OptimizedPipelineReady.load() ? m_OptimizedPipeline : m_Pipeline;
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
+    /// Returns true if the graphics pipeline was created for dynamic rendering
+    /// (VK_KHR_dynamic_rendering) rather than for its implicit render pass.
+    bool UsesDynamicRendering() const { return m_UseDynamicRendering; }
+
+    // Shader objects and render states of the pipeline created with PSO_CREATE_FLAG_SHADER_OBJECTS.
+    // The states are set dynamically by DeviceContextVkImpl when the pipeline is bound.
+    struct ShaderObjectData
+    {
+        // All graphics stages supported by the device. Stages that are not used by
+        // the pipeline have null shaders as every stage must be bound before drawing.
+        std::vector<VkShaderStageFlagBits> Stages;
+        // Shader objects are owned by the device's shader object cache
+        std::vector<VkShaderEXT> Shaders;
+
+        std::vector<VkVertexInputBindingDescription2EXT>   VertexBindings;
+        std::vector<VkVertexInputAttributeDescription2EXT> VertexAttributes;
+
+        VkPipelineRasterizationStateCreateInfo RasterizerState{};
+        VkPipelineDepthStencilStateCreateInfo  DepthStencilState{};
+
+        VkPrimitiveTopology Topology               = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        uint32_t            PatchControlPoints     = 0;
+        VkBool32            PrimitiveRestartEnable = VK_FALSE;
+
+        // Color blend states for every render target
+        std::vector<VkBool32>                ColorBlendEnables;
+        std::vector<VkColorBlendEquationEXT> ColorBlendEquations;
+        std::vector<VkColorComponentFlags>   ColorWriteMasks;
+    };
+
+    /// Returns true if the pipeline is built from shader objects (PSO_CREATE_FLAG_SHADER_OBJECTS).
+    bool UsesShaderObjects() const { return m_pShaderObjectData != nullptr; }
+
+    const ShaderObjectData& GetShaderObjectData() const
+    {
+        VERIFY_EXPR(m_pShaderObjectData != nullptr);
+        return *m_pShaderObjectData;
+    }
+
     struct ShaderStageInfo
     {
         ShaderStageInfo() {}
@@ -133,6 +180,13 @@ private:
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
 
+    // Enqueues the task that optimizes the bytecode of shaders whose optimization was deferred
+    // and builds m_OptimizedPipeline from it. Returns false if no task was enqueued.
+    bool EnqueueOptimizeSPIRVTask(const TShaderStages& ShaderStages, IPipelineStateCache* pPSOCache);
+
+    // Creates shader objects for all shader stages and initializes m_pShaderObjectData
+    void InitShaderObjects(const TShaderStages& ShaderStages) noexcept(false);
+
     // TPipelineStateBase::Construct needs access to InitializePipeline
     friend TPipelineStateBase;
 
@@ -141,6 +195,17 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Graphics pipeline linked from pipeline libraries with link-time optimizations, or the pipeline
+    // built from the bytecode optimized in the background when SPIR-V optimization is deferred.
+    // It is compiled in the background and replaces m_Pipeline once ready.
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<bool>                m_OptimizedPipelineReady{false};
+    RefCntAutoPtr<IAsyncTask>        m_pOptimizePipelineTask;
+
+    bool m_UseDynamicRendering = false;
+
+    std::unique_ptr<ShaderObjectData> m_pShaderObjectData;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
@@ -60,7 +60,9 @@ public:
     static constexpr Uint32 InvalidIndex = static_cast<Uint32>(-1);
 
     Uint32 AllocateQuery(QUERY_TYPE Type);
-    void   DiscardQuery(QUERY_TYPE Type, Uint32 Index);
+
+    // FenceValue is the command queue fence value after which the query is no longer used by the GPU.
+    void DiscardQuery(QUERY_TYPE Type, Uint32 Index, Uint64 FenceValue);
 
     VkQueryPool GetQueryPool(QUERY_TYPE Type) const
     {
@@ -72,8 +74,15 @@ public:
         return m_CounterFrequency;
     }
 
+    // Resets stale queries and makes them available for allocation.
+    // When host query reset is enabled, queries are reset on the host once the GPU is done with them
+    // (their fence value is not greater than CompletedFenceValue), and no commands are recorded.
+    // Otherwise, reset commands are recorded into the command buffer.
+    // Contiguous ranges of stale queries are reset by a single command.
+    // Returns the number of commands recorded into the command buffer.
     Uint32 ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
-                             VulkanUtilities::VulkanCommandBuffer&       CmdBuff);
+                             VulkanUtilities::VulkanCommandBuffer&       CmdBuff,
+                             Uint64                                      CompletedFenceValue);
 
     SoftwareQueueIndex GetCommandQueueId() const
     {
@@ -99,8 +108,10 @@ private:
         // clang-format on
 
         Uint32 Allocate();
-        void   Discard(Uint32 Index);
-        Uint32 ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, VulkanUtilities::VulkanCommandBuffer& CmdBuff);
+        void   Discard(Uint32 Index, Uint64 FenceValue);
+        Uint32 ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                 VulkanUtilities::VulkanCommandBuffer&       CmdBuff,
+                                 Uint64                                      CompletedFenceValue);
 
         QUERY_TYPE GetType() const
         {
@@ -130,9 +141,19 @@ private:
         Uint32     m_QueryCount          = 0;
         Uint32     m_MaxAllocatedQueries = 0;
 
-        std::mutex          m_QueriesMtx;
-        std::vector<Uint32> m_AvailableQueries;
-        std::vector<Uint32> m_StaleQueries;
+        struct StaleQuery
+        {
+            Uint32 Index;
+            Uint64 FenceValue;
+        };
+
+        std::mutex m_QueriesMtx;
+        // Available queries are sorted in descending order, so that the lowest indices
+        // are allocated first and allocated queries tend to form contiguous ranges.
+        std::vector<Uint32>     m_AvailableQueries;
+        std::vector<StaleQuery> m_StaleQueries;
+        // Scratch space for stale queries that are reset by ResetStaleQueries()
+        std::vector<Uint32> m_QueriesToReset;
     };
 
     const SoftwareQueueIndex m_CommandQueueId;
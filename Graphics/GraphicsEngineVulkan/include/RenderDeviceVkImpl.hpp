@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -51,8 +52,13 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCache.hpp"
+#include "ShaderObjectCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "ShaderBytecodeStore.hpp"
+#include "ShaderVkImpl.hpp"
+#include "SmallVector.hpp"
 
 namespace Diligent
 {
@@ -201,9 +207,27 @@ public:
                                                                   const FenceDesc& Desc,
                                                                   IFence**         ppFence) override final;
 
+    /// Implementation of IRenderDeviceVk::GetMemoryBudget().
+    virtual void DILIGENT_CALL_TYPE GetMemoryBudget(MemoryBudgetVk& Budget) override final;
+
+    /// Implementation of IRenderDeviceVk::SetMemoryBudgetCallback().
+    virtual void DILIGENT_CALL_TYPE SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback,
+                                                            void*                      pUserData,
+                                                            float                      Threshold) override final;
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
+    /// Implementation of IRenderDevice::GetMemoryStats() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE GetMemoryStats(DeviceMemoryStats& Stats) override final;
+
+    /// Implementation of IRenderDevice::WaitForFences() in Vulkan backend.
+    virtual Bool DILIGENT_CALL_TYPE WaitForFences(IFence* const* ppFences,
+                                                  const Uint64*  pValues,
+                                                  Uint32         NumFences,
+                                                  Bool           WaitAll,
+                                                  Uint64         Timeout) override final;
+
     // pImmediateCtx parameter is only used to make sure the command buffer is submitted from the immediate context
     // The method returns fence value associated with the submitted command buffer
     Uint64 ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueId, const VkSubmitInfo& SubmitInfo, std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences);
@@ -230,22 +254,69 @@ public:
 
     std::shared_ptr<const VulkanUtilities::VulkanInstance> GetVulkanInstance() const { return m_VulkanInstance; }
 
+    // Returns the single-thread pool that runs asynchronous swap chain presents (SwapChainDesc::AsyncPresent).
+    // The pool is created on first use.
+    IThreadPool* GetPresentThreadPool();
+
     const VulkanUtilities::VulkanPhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
     const VulkanUtilities::VulkanLogicalDevice&  GetLogicalDevice() const { return *m_LogicalVkDevice; }
 
-    FramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
-    RenderPassCache&  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
+    // Returns true if shader resource descriptors are written into the dynamic heap buffer
+    // (VK_EXT_descriptor_buffer) instead of being allocated from descriptor pools.
+    bool UseDescriptorBuffers() const
+    {
+        return m_LogicalVkDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE;
+    }
+
+    // Returns true if dynamic variables of the resource signature with binding index 0
+    // are committed with push descriptors (VK_KHR_push_descriptor).
+    bool UsePushDescriptors() const
+    {
+        return m_LogicalVkDevice->GetEnabledExtFeatures().PushDescriptor;
+    }
+
+    // Returns true if SPIR-V performance optimization is performed by the shader compilation
+    // thread pool after shaders and pipelines have been created.
+    bool DeferSPIRVOptimization() const
+    {
+#if !DILIGENT_NO_HLSL
+        return m_DeferSPIRVOptimization && m_pShaderCompilationThreadPool;
+#else
+        // SPIRV-Tools are not available
+        return false;
+#endif
+    }
+
+    // Returns true if graphics pipelines are linked from pipeline libraries (VK_EXT_graphics_pipeline_library).
+    bool UseGraphicsPipelineLibrary() const
+    {
+        return m_LogicalVkDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE;
+    }
+
+    FramebufferCache&     GetFramebufferCache() { return m_FramebufferCache; }
+    RenderPassCache&      GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
+    PipelineLibraryCache& GetPipelineLibraryCache() { return m_PipelineLibraryCache; }
+    ShaderObjectCache&    GetShaderObjectCache() { return m_ShaderObjectCache; }
+
+    using DedicatedAllocationInfo = VulkanUtilities::VulkanMemoryManager::DedicatedAllocationInfo;
 
-    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
+    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(const VkMemoryRequirements&    MemReqs,
+                                                           VkMemoryPropertyFlags          MemoryProperties,
+                                                           VkMemoryAllocateFlags          AllocateFlags = 0,
+                                                           const DedicatedAllocationInfo* pDedicated    = nullptr)
     {
-        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
+        return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags, pDedicated);
     }
-    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, VkMemoryAllocateFlags AllocateFlags = 0)
+    VulkanUtilities::VulkanMemoryAllocation AllocateMemory(VkDeviceSize                   Size,
+                                                           VkDeviceSize                   Alignment,
+                                                           uint32_t                       MemoryTypeIndex,
+                                                           VkMemoryAllocateFlags          AllocateFlags = 0,
+                                                           const DedicatedAllocationInfo* pDedicated    = nullptr)
     {
         const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
         VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
-        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
+        return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags, pDedicated);
     }
     VulkanUtilities::VulkanMemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
@@ -265,8 +336,10 @@ public:
         const Uint32 MaxRayGenThreads;
     };
 
-    // TODO: use small_vector
-    std::vector<uint32_t> ConvertCmdQueueIdsToQueueFamilies(Uint64 CommandQueueMask) const;
+    // The number of distinct queue families is small, so the indices are stored in place.
+    using QueueFamilyIndicesArray = SmallVector<uint32_t, 4>;
+
+    QueueFamilyIndicesArray ConvertCmdQueueIdsToQueueFamilies(Uint64 CommandQueueMask) const;
 
     HardwareQueueIndex GetQueueFamilyIndex(SoftwareQueueIndex CmdQueueInd) const;
 
@@ -297,6 +370,8 @@ private:
 
     FramebufferCache       m_FramebufferCache;
     RenderPassCache        m_ImplicitRenderPassCache;
+    PipelineLibraryCache   m_PipelineLibraryCache;
+    ShaderObjectCache      m_ShaderObjectCache;
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
@@ -313,6 +388,21 @@ private:
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // Process-shared shader bytecode store, null if shader bytecode cache is disabled
+    std::shared_ptr<ShaderBytecodeStore> m_pShaderBytecodeStore;
+
+    // Whether SPIR-V performance optimization is deferred to the shader compilation thread pool
+    const bool m_DeferSPIRVOptimization;
+
+    // Reflection data shared between shaders with identical SPIR-V bytecode
+    ShaderVkImpl::ReflectionRegistryType m_ShaderReflectionRegistry;
+
+    // Task that builds glslang built-in symbol tables on the shader compilation thread pool
+    RefCntAutoPtr<IAsyncTask> m_pGlslangWarmUpTask;
+
+    std::mutex                 m_PresentThreadPoolMtx;
+    RefCntAutoPtr<IThreadPool> m_pPresentThreadPool;
 };
 
 } // namespace Diligent
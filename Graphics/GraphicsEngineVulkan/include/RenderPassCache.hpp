@@ -83,6 +83,11 @@ public:
             for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
                 RTVFormats[rt] = _RTVFormats[rt];
         }
+        // Bits of the attachment op masks: bit i corresponds to render target i,
+        // followed by the depth and stencil aspects of the depth-stencil attachment.
+        static constexpr Uint32 DepthAttachmentBit   = 1u << MAX_RENDER_TARGETS;
+        static constexpr Uint32 StencilAttachmentBit = 1u << (MAX_RENDER_TARGETS + 1);
+
         Uint8          NumRenderTargets               = 0;
         Uint8          SampleCount                    = 0;
         bool           EnableVRS                      = false;
@@ -90,6 +95,15 @@ public:
         TEXTURE_FORMAT DSVFormat                      = TEX_FORMAT_UNKNOWN;
         TEXTURE_FORMAT RTVFormats[MAX_RENDER_TARGETS] = {};
 
+        // Attachments that use ATTACHMENT_LOAD_OP_CLEAR instead of ATTACHMENT_LOAD_OP_LOAD.
+        Uint16 ClearMask = 0;
+        // Attachments that use ATTACHMENT_LOAD_OP_DISCARD instead of ATTACHMENT_LOAD_OP_LOAD.
+        Uint16 DiscardLoadMask = 0;
+        // Attachments that use ATTACHMENT_STORE_OP_DISCARD instead of ATTACHMENT_STORE_OP_STORE.
+        // Load and store ops do not affect render pass compatibility, so passes that only
+        // differ in these masks can be used with the same pipelines and framebuffers.
+        Uint16 DiscardStoreMask = 0;
+
         bool operator==(const RenderPassCacheKey& rhs) const noexcept
         {
             // clang-format off
@@ -98,7 +112,10 @@ public:
                 SampleCount      != rhs.SampleCount      ||
                 EnableVRS        != rhs.EnableVRS        ||
                 DSVFormat        != rhs.DSVFormat        ||
-                ReadOnlyDSV      != rhs.ReadOnlyDSV)
+                ReadOnlyDSV      != rhs.ReadOnlyDSV      ||
+                ClearMask        != rhs.ClearMask        ||
+                DiscardLoadMask  != rhs.DiscardLoadMask  ||
+                DiscardStoreMask != rhs.DiscardStoreMask)
             {
                 return false;
             }
@@ -115,9 +132,8 @@ public:
         {
             if (Hash == 0)
             {
-                Hash = ComputeHash(NumRenderTargets, SampleCount, DSVFormat, EnableVRS, ReadOnlyDSV);
-                for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-                    HashCombine(Hash, RTVFormats[rt]);
+                Hash = ComputeHash(NumRenderTargets, SampleCount, DSVFormat, EnableVRS, ReadOnlyDSV, ClearMask, DiscardLoadMask, DiscardStoreMask,
+                                   ComputeHashRaw(RTVFormats, sizeof(RTVFormats[0]) * NumRenderTargets));
             }
             return Hash;
         }
@@ -54,12 +54,14 @@ public:
 
     virtual const BindingTableVk& DILIGENT_CALL_TYPE GetVkBindingTable() const override final { return m_VkBindingTable; }
 
-    using BindingTable = TShaderBindingTableBase::BindingTable;
-    void GetData(BufferVkImpl*& pSBTBufferVk,
-                 BindingTable&  RayGenShaderRecord,
-                 BindingTable&  MissShaderTable,
-                 BindingTable&  HitGroupTable,
-                 BindingTable&  CallableShaderTable);
+    using BindingTable      = TShaderBindingTableBase::BindingTable;
+    using BufferUpdateRange = TShaderBindingTableBase::BufferUpdateRange;
+    void GetData(BufferVkImpl*&                  pSBTBufferVk,
+                 BindingTable&                   RayGenShaderRecord,
+                 BindingTable&                   MissShaderTable,
+                 BindingTable&                   HitGroupTable,
+                 BindingTable&                   CallableShaderTable,
+                 std::vector<BufferUpdateRange>& UpdateRanges);
 
 private:
     BindingTableVk m_VkBindingTable = {};
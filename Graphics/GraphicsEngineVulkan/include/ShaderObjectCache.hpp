@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderObjectCache class
+
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+#include <string>
+
+#include "HashUtils.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class PipelineResourceSignatureVkImpl;
+
+/// Cache of shader objects (VK_EXT_shader_object).
+
+/// Shader objects are compiled independently of the fixed-function state, so pipelines
+/// that use the same shader with compatible resource signatures share one shader object.
+class ShaderObjectCache
+{
+public:
+    ShaderObjectCache(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    ShaderObjectCache             (const ShaderObjectCache&) = delete;
+    ShaderObjectCache             (ShaderObjectCache&&)      = delete;
+    ShaderObjectCache& operator = (const ShaderObjectCache&) = delete;
+    ShaderObjectCache& operator = (ShaderObjectCache&&)      = delete;
+    // clang-format on
+
+    ~ShaderObjectCache();
+
+    // This structure is used as the key to find shader object
+    struct ShaderKey
+    {
+        VkShaderStageFlagBits  Stage     = VK_SHADER_STAGE_FLAG_BITS_MAX_ENUM;
+        VkShaderStageFlags     NextStage = 0;
+        VkShaderCreateFlagsEXT Flags     = 0;
+        std::string            EntryPoint;
+        std::vector<uint32_t>  SPIRV;
+
+        // Resource signatures that define the descriptor set layouts of the shader
+        std::vector<RefCntAutoPtr<PipelineResourceSignatureVkImpl>> Signatures;
+
+        bool operator==(const ShaderKey& rhs) const noexcept;
+
+        size_t GetHash() const noexcept;
+
+    private:
+        mutable size_t Hash = 0;
+    };
+
+    // Returns the shader object for the given key. If there is no such object in the cache,
+    // calls CreateShader() to create a new one.
+    template <typename CreateShaderHandlerType>
+    VkShaderEXT GetShader(ShaderKey&& Key, CreateShaderHandlerType&& CreateShader) noexcept(false)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+
+            auto it = m_Cache.find(Key);
+            if (it != m_Cache.end())
+                return it->second;
+        }
+
+        // Do not hold the lock while the shader is being compiled
+        VulkanUtilities::ShaderObjectWrapper Shader = CreateShader();
+
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        // If another thread has created the same shader in the meantime, the new one is discarded.
+        // This is safe as the shader has not been used yet.
+        auto it_inserted = m_Cache.emplace(std::move(Key), std::move(Shader));
+        return it_inserted.first->second;
+    }
+
+    void Destroy();
+
+private:
+    struct ShaderKeyHash
+    {
+        std::size_t operator()(const ShaderKey& Key) const
+        {
+            return Key.GetHash();
+        }
+    };
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    std::mutex                                                                         m_Mutex;
+    std::unordered_map<ShaderKey, VulkanUtilities::ShaderObjectWrapper, ShaderKeyHash> m_Cache;
+};
+
+} // namespace Diligent
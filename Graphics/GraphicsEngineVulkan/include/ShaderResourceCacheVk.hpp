@@ -68,7 +68,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -245,6 +245,11 @@ public:
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
 
+    // Defers descriptor writes made by SetResource() until EndBulkUpdate(),
+    // which submits all of them with a single vkUpdateDescriptorSets call.
+    void BeginBulkUpdate();
+    void EndBulkUpdate();
+
 
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
@@ -260,9 +265,12 @@ public:
     template <bool VerifyOnly>
     void TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
 
+    // Writes dynamic buffer offsets of the first NumSets descriptor sets to Offsets starting at StartInd.
+    // This allows excluding push descriptor sets, whose offsets are pushed along with the descriptors.
     __forceinline Uint32 GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
                                                  std::vector<uint32_t>& Offsets,
-                                                 Uint32                 StartInd) const;
+                                                 Uint32                 StartInd,
+                                                 Uint32                 NumSets) const;
 
 private:
     Resource* GetFirstResourcePtr()
@@ -282,6 +290,10 @@ private:
 
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    // Descriptor writes deferred between BeginBulkUpdate() and EndBulkUpdate()
+    struct PendingDescriptorWrites;
+    std::unique_ptr<PendingDescriptorWrites> m_pPendingWrites;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
@@ -319,8 +331,11 @@ __forceinline auto ShaderResourceCacheVk::Resource::GetDescriptorWriteInfo<Descr
 
 __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
                                                                     std::vector<uint32_t>& Offsets,
-                                                                    Uint32                 StartInd) const
+                                                                    Uint32                 StartInd,
+                                                                    Uint32                 NumSets) const
 {
+    VERIFY_EXPR(NumSets <= m_NumSets);
+
     // If any of the sets being bound include dynamic uniform or storage buffers, then
     // pDynamicOffsets includes one element for each array element in each dynamic descriptor
     // type binding in each set. Values are taken from pDynamicOffsets in an order such that
@@ -333,7 +348,7 @@ __forceinline Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContex
     // (DescriptorType::StorageBufferDynamic and DescriptorType::StorageBufferDynamic_ReadOnly) for every shader stage,
     // followed by all other resources.
     Uint32 OffsetInd = StartInd;
-    for (Uint32 set = 0; set < m_NumSets; ++set)
+    for (Uint32 set = 0; set < NumSets; ++set)
     {
         const auto& DescrSet = GetDescriptorSet(set);
         const auto  SetSize  = DescrSet.GetSize();
@@ -76,6 +76,8 @@ class ShaderVariableManagerVk : ShaderVariableManagerBase<EngineVkImplTraits, Sh
 {
 public:
     using TBase = ShaderVariableManagerBase<EngineVkImplTraits, ShaderVariableVkImpl>;
+    using TBase::GetResourceCache;
+    using TBase::GetSignature;
     ShaderVariableManagerVk(IObject&               Owner,
                             ShaderResourceCacheVk& ResourceCache) noexcept :
         TBase{Owner, ResourceCache}
@@ -35,10 +35,12 @@
 #include "SPIRVShaderResources.hpp"
 #include "ThreadPool.h"
 #include "RefCntAutoPtr.hpp"
+#include "ObjectsRegistry.hpp"
 
 namespace Diligent
 {
 class IDXCompiler;
+class ShaderBytecodeStore;
 
 /// Shader object object implementation in Vulkan backend.
 class ShaderVkImpl final : public ShaderBase<EngineVkImplTraits>
@@ -49,6 +51,47 @@ public:
     static constexpr INTERFACE_ID IID_InternalImpl =
         {0x17523656, 0x19a6, 0x4874, {0x8c, 0x48, 0x74, 0xf5, 0xb7, 0x2, 0x31, 0x1}};
 
+    /// Reflection data that is shared between shaders with identical SPIR-V bytecode.
+    struct SharedReflection
+    {
+        std::shared_ptr<const SPIRVShaderResources> pResources;
+        std::string                                 EntryPoint;
+    };
+
+    /// The key of the reflection data in the reflection registry.
+    struct ReflectionKey
+    {
+        size_t      SPIRVHash                    = 0;
+        size_t      SPIRVSize                    = 0;
+        SHADER_TYPE ShaderType                   = SHADER_TYPE_UNKNOWN;
+        bool        LoadShaderStageInputs        = false;
+        bool        LoadConstantBufferReflection = false;
+        std::string ShaderName;
+        std::string CombinedSamplerSuffix;
+
+        bool operator==(const ReflectionKey& RHS) const noexcept
+        {
+            // clang-format off
+            return SPIRVHash                    == RHS.SPIRVHash                    &&
+                   SPIRVSize                    == RHS.SPIRVSize                    &&
+                   ShaderType                   == RHS.ShaderType                   &&
+                   LoadShaderStageInputs        == RHS.LoadShaderStageInputs        &&
+                   LoadConstantBufferReflection == RHS.LoadConstantBufferReflection &&
+                   ShaderName                   == RHS.ShaderName                   &&
+                   CombinedSamplerSuffix        == RHS.CombinedSamplerSuffix;
+            // clang-format on
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const ReflectionKey& Key) const noexcept;
+        };
+    };
+
+    /// Registry of shader reflection data. It allows shaders with identical SPIR-V bytecode, e.g. the same
+    /// shader unpacked from an archive for multiple pipelines, to skip SPIRV-Cross parsing.
+    using ReflectionRegistryType = ObjectsRegistry<ReflectionKey, std::shared_ptr<const SharedReflection>, ReflectionKey::Hasher>;
+
     struct CreateInfo
     {
         IDXCompiler* const         pDXCompiler;
@@ -58,6 +101,9 @@ public:
         const bool                 HasSpirv14;
         IDataBlob** const          ppCompilerOutput;
         IThreadPool* const         pCompilationThreadPool;
+        ShaderBytecodeStore* const    pBytecodeStore;
+        ReflectionRegistryType* const pReflectionRegistry;
+        const bool                    DeferSPIRVOptimization;
     };
     ShaderVkImpl(IReferenceCounters*     pRefCounters,
                  RenderDeviceVkImpl*     pRenderDeviceVk,
@@ -110,6 +156,14 @@ public:
         Size        = m_SPIRV.size() * sizeof(m_SPIRV[0]);
     }
 
+    // Returns true if the shader bytecode was only legalized and performance
+    // optimization is deferred to the pipeline state, see EngineVkCreateInfo::DeferSPIRVOptimization.
+    bool IsSPIRVOptimizationDeferred() const
+    {
+        DEV_CHECK_ERR(!IsCompiling(), "Shader byte code is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+        return m_SPIRVOptimizationDeferred;
+    }
+
 private:
     void Initialize(const ShaderCreateInfo& ShaderCI,
                     const CreateInfo&       VkShaderCI) noexcept(false);
@@ -119,6 +173,11 @@ private:
 
     std::string           m_EntryPoint;
     std::vector<uint32_t> m_SPIRV;
+
+    bool m_SPIRVOptimizationDeferred = false;
+
+    // Task that adds the optimized bytecode to the bytecode store when optimization is deferred
+    RefCntAutoPtr<IAsyncTask> m_pStoreOptimizedSPIRVTask;
 };
 
 } // namespace Diligent
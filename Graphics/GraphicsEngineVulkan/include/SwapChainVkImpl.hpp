@@ -30,12 +30,17 @@
 /// \file
 /// Declaration of Diligent::SwapChainVkImpl class
 
+#include <deque>
+#include <chrono>
+
 #include "EngineVkImplTraits.hpp"
 #include "SwapChainVk.h"
 #include "SwapChainBase.hpp"
+#include "IndexWrapper.hpp"
 #include "VulkanUtilities/VulkanInstance.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "ManagedVulkanObject.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -67,6 +72,9 @@ public:
     /// Implementation of ISwapChain::SetWindowedMode() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE SetWindowedMode() override final;
 
+    /// Implementation of ISwapChain::SetMaximumFrameLatency() in Vulkan backend.
+    virtual void DILIGENT_CALL_TYPE SetMaximumFrameLatency(Uint32 MaxLatency) override final;
+
     /// Implementation of ISwapChainVk::GetVkSurface().
     virtual VkSurfaceKHR DILIGENT_CALL_TYPE GetVkSurface() override final { return m_VkSurface; }
 
@@ -76,6 +84,10 @@ public:
     /// Implementation of ISwapChain::GetCurrentBackBufferRTV() in Vulkan backend.
     virtual ITextureViewVk* DILIGENT_CALL_TYPE GetCurrentBackBufferRTV() override final
     {
+        // The next back buffer is acquired by the asynchronous present
+        if (m_pAsyncPresentTask)
+            FinishAsyncPresent();
+
         VERIFY_EXPR(m_BackBufferIndex < m_SwapChainDesc.BufferCount);
         return m_pBackBufferRTV[m_BackBufferIndex];
     }
@@ -88,9 +100,17 @@ private:
     void     CreateVulkanSwapChain();
     void     InitBuffersAndViews();
     VkResult AcquireNextImage(DeviceContextVkImpl* pDeviceCtxVk);
+    VkResult AcquireVkImage();
+    void     OnImageAcquired(DeviceContextVkImpl* pDeviceCtxVk);
+    VkResult PresentVkImage(SoftwareQueueIndex CmdQueueId);
+    void     RecreateAndAcquireNextImage(DeviceContextVkImpl* pImmediateCtxVk);
+    // Waits for the asynchronous present to complete and finalizes the image acquisition
+    void     FinishAsyncPresent();
     void     RecreateVulkanSwapchain(DeviceContextVkImpl* pImmediateCtxVk);
     void     WaitForImageAcquiredFences();
     void     ReleaseSwapChainResources(DeviceContextVkImpl* pImmediateCtxVk, bool DestroyVkSwapChain);
+    bool     IsPresentWaitEnabled() const;
+    void     WaitForPresent();
 
     const NativeWindow m_Window;
 
@@ -127,6 +147,26 @@ private:
     uint32_t m_BackBufferIndex = 0;
     bool     m_IsMinimized     = false;
     bool     m_VSyncEnabled    = true;
+
+    // Present id of the most recently presented frame (VK_KHR_present_id)
+    Uint64 m_PresentId = 0;
+
+    struct PendingPresentInfo
+    {
+        Uint64                                PresentId;
+        std::chrono::steady_clock::time_point StartTime;
+    };
+    // Frames presented by the current Vulkan swap chain that have not been displayed yet
+    std::deque<PendingPresentInfo> m_PendingPresents;
+
+    // Time when the application started the current frame
+    std::chrono::steady_clock::time_point m_FrameStartTime = std::chrono::steady_clock::now();
+
+    // Asynchronous present task (SwapChainDesc::AsyncPresent) and the results of the operations it performed.
+    // While the task is running, the swap chain state is only accessed by the present thread.
+    RefCntAutoPtr<IAsyncTask> m_pAsyncPresentTask;
+    VkResult                  m_AsyncPresentResult = VK_SUCCESS;
+    VkResult                  m_AsyncAcquireResult = VK_SUCCESS;
 };
 
 } // namespace Diligent
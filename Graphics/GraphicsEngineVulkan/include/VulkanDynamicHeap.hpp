@@ -144,10 +144,20 @@ public:
 
     VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
     Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+
+    // Device address of the heap buffer. Only available when descriptor buffers are used.
+    VkDeviceAddress GetVkDeviceAddress() const {return m_VkDeviceAddress;}
+
+    // Usage the heap buffer is created with when it also serves as the descriptor buffer
+    static constexpr VkBufferUsageFlags DescriptorBufferUsage =
+        VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+        VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
     // clang-format on
 
     void Destroy();
 
+    OffsetType GetPeakUsedSize() const { return m_TotalPeakSize; }
+
     static constexpr const Uint32 MasterBlockAlignment = 1024;
     MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
 
@@ -156,6 +166,7 @@ private:
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_VkDeviceAddress = 0;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
@@ -51,7 +51,7 @@ public:
                                        const VkImageSubresourceRange& Subresource)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdClearColorImage() must be called outside of render pass (17.1)");
+        VERIFY(!m_State.IsInsideRenderPass(), "vkCmdClearColorImage() must be called outside of render pass (17.1)");
         VERIFY(Subresource.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT, "The aspectMask of all image subresource ranges must only include VK_IMAGE_ASPECT_COLOR_BIT (17.1)");
 
         FlushBarriers();
@@ -69,7 +69,7 @@ public:
                                               const VkImageSubresourceRange&  Subresource)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdClearDepthStencilImage() must be called outside of render pass (17.1)");
+        VERIFY(!m_State.IsInsideRenderPass(), "vkCmdClearDepthStencilImage() must be called outside of render pass (17.1)");
         // clang-format off
         VERIFY((Subresource.aspectMask &  (VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) != 0 &&
                (Subresource.aspectMask & ~(VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT)) == 0,
@@ -89,7 +89,7 @@ public:
     __forceinline void ClearAttachment(const VkClearAttachment& Attachment, const VkClearRect& ClearRect)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdClearAttachments() must be called inside render pass (17.2)");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdClearAttachments() must be called inside render pass (17.2)");
 
         vkCmdClearAttachments(
             m_VkCmdBuffer,
@@ -104,8 +104,8 @@ public:
     __forceinline void Draw(uint32_t VertexCount, uint32_t InstanceCount, uint32_t FirstVertex, uint32_t FirstInstance)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDraw() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDraw() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDraw(m_VkCmdBuffer, VertexCount, InstanceCount, FirstVertex, FirstInstance);
     }
@@ -113,8 +113,8 @@ public:
     __forceinline void DrawIndexed(uint32_t IndexCount, uint32_t InstanceCount, uint32_t FirstIndex, int32_t VertexOffset, uint32_t FirstInstance)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndexed() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndexed() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
         vkCmdDrawIndexed(m_VkCmdBuffer, IndexCount, InstanceCount, FirstIndex, VertexOffset, FirstInstance);
@@ -123,8 +123,8 @@ public:
     __forceinline void DrawIndirect(VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawIndirect(m_VkCmdBuffer, Buffer, Offset, DrawCount, Stride);
     }
@@ -132,8 +132,8 @@ public:
     __forceinline void DrawIndexedIndirect(VkBuffer Buffer, VkDeviceSize Offset, uint32_t DrawCount, uint32_t Stride)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
         vkCmdDrawIndexedIndirect(m_VkCmdBuffer, Buffer, Offset, DrawCount, Stride);
@@ -143,8 +143,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirectCountKHR() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndirectCountKHR() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawIndirectCountKHR(m_VkCmdBuffer, Buffer, Offset, CountBuffer, CountBufferOffset, MaxDrawCount, Stride);
 #else
@@ -156,8 +156,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndirect() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndirect() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
         vkCmdDrawIndexedIndirectCountKHR(m_VkCmdBuffer, Buffer, Offset, CountBuffer, CountBufferOffset, MaxDrawCount, Stride);
@@ -170,8 +170,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksEXT() must be called inside render pass");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawMeshTasksEXT() must be called inside render pass");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawMeshTasksEXT(m_VkCmdBuffer, TaskCountX, TaskCountY, TaskCountZ);
 #else
@@ -183,8 +183,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksIndirectEXT() must be called inside render pass");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawMeshTasksIndirectEXT() must be called inside render pass");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawMeshTasksIndirectEXT(m_VkCmdBuffer, Buffer, Offset, DrawCount, Stride);
 #else
@@ -196,8 +196,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawMeshTasksIndirectCountEXT() must be called inside render pass");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawMeshTasksIndirectCountEXT() must be called inside render pass");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawMeshTasksIndirectCountEXT(m_VkCmdBuffer, Buffer, Offset, CountBuffer, CountBufferOffset, MaxDrawCount, Stride);
 #else
@@ -212,8 +212,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDraw() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDraw() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
 
         vkCmdDrawMultiEXT(m_VkCmdBuffer, DrawCount, pVertexInfo, InstanceCount, FirstInstance, sizeof(VkMultiDrawInfoEXT));
 #else
@@ -228,8 +228,8 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "vkCmdDrawIndexed() must be called inside render pass (19.3)");
-        VERIFY(m_State.GraphicsPipeline != VK_NULL_HANDLE, "No graphics pipeline bound");
+        VERIFY(m_State.IsInsideRenderPass(), "vkCmdDrawIndexed() must be called inside render pass (19.3)");
+        VERIFY(m_State.HasGraphicsShaders(), "No graphics pipeline or shader objects bound");
         VERIFY(m_State.IndexBuffer != VK_NULL_HANDLE, "No index buffer bound");
 
         // NULL or a pointer to the value added to the vertex index before indexing into the vertex buffer.
@@ -244,7 +244,7 @@ public:
     __forceinline void Dispatch(uint32_t GroupCountX, uint32_t GroupCountY, uint32_t GroupCountZ)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatch() must be called outside of render pass (27)");
+        VERIFY(!m_State.IsInsideRenderPass(), "vkCmdDispatch() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
         FlushBarriers();
@@ -254,7 +254,7 @@ public:
     __forceinline void DispatchIndirect(VkBuffer Buffer, VkDeviceSize Offset)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "vkCmdDispatchIndirect() must be called outside of render pass (27)");
+        VERIFY(!m_State.IsInsideRenderPass(), "vkCmdDispatchIndirect() must be called outside of render pass (27)");
         VERIFY(m_State.ComputePipeline != VK_NULL_HANDLE, "No compute pipeline bound");
 
         FlushBarriers();
@@ -266,10 +266,11 @@ public:
                                        uint32_t            FramebufferWidth,
                                        uint32_t            FramebufferHeight,
                                        uint32_t            ClearValueCount = 0,
-                                       const VkClearValue* pClearValues    = nullptr)
+                                       const VkClearValue* pClearValues    = nullptr,
+                                       VkSubpassContents   Contents        = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
+        VERIFY(!m_State.IsInsideRenderPass(), "Current pass has not been ended");
 
         if (m_State.RenderPass != RenderPass || m_State.Framebuffer != Framebuffer)
         {
@@ -290,11 +291,11 @@ public:
                                                       // corresponding to cleared attachments are used. Other elements of pClearValues are
                                                       // ignored (7.4)
 
-            vkCmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo,
-                                 VK_SUBPASS_CONTENTS_INLINE // the contents of the subpass will be recorded inline in the
-                                                            // primary command buffer, and secondary command buffers must not
-                                                            // be executed within the subpass
-            );
+            // VK_SUBPASS_CONTENTS_INLINE specifies that the contents of the subpass will be recorded inline in the
+            // primary command buffer, and secondary command buffers must not be executed within the subpass.
+            // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS specifies that the contents are recorded in secondary
+            // command buffers, and vkCmdExecuteCommands is the only valid command in the subpass.
+            vkCmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo, Contents);
             m_State.RenderPass        = RenderPass;
             m_State.Framebuffer       = Framebuffer;
             m_State.FramebufferWidth  = FramebufferWidth;
@@ -302,11 +303,64 @@ public:
         }
     }
 
+    __forceinline void BeginRendering(const VkRenderingInfoKHR& RenderingInfo)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(!m_State.IsInsideRenderPass(), "Current pass has not been ended");
+
+        FlushBarriers();
+        vkCmdBeginRenderingKHR(m_VkCmdBuffer, &RenderingInfo);
+        m_State.DynamicRendering  = true;
+        m_State.FramebufferWidth  = RenderingInfo.renderArea.extent.width;
+        m_State.FramebufferHeight = RenderingInfo.renderArea.extent.height;
+#else
+        UNSUPPORTED("Dynamic rendering is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    // Marks the secondary command buffer as being inside the render pass instance it continues.
+    // RenderPass and Framebuffer must be null when the render pass instance is begun with dynamic rendering.
+    __forceinline void SetInheritedRenderPass(VkRenderPass  RenderPass,
+                                              VkFramebuffer Framebuffer,
+                                              uint32_t      FramebufferWidth,
+                                              uint32_t      FramebufferHeight)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(!m_State.IsInsideRenderPass(), "Current pass has not been ended");
+
+        m_State.RenderPass          = RenderPass;
+        m_State.Framebuffer         = Framebuffer;
+        m_State.DynamicRendering    = RenderPass == VK_NULL_HANDLE;
+        m_State.FramebufferWidth    = FramebufferWidth;
+        m_State.FramebufferHeight   = FramebufferHeight;
+        m_State.InheritedRenderPass = true;
+    }
+
+    // Ends the active render pass instance regardless of whether it was begun
+    // with BeginRenderPass() or BeginRendering().
     __forceinline void EndRenderPass()
     {
-        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
+        VERIFY(m_State.IsInsideRenderPass(), "Render pass has not been started");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        vkCmdEndRenderPass(m_VkCmdBuffer);
+        if (m_State.InheritedRenderPass)
+        {
+            LOG_ERROR_MESSAGE("Secondary command buffers can't end the render pass instance they continue. "
+                              "Resource state transitions, copies, dispatches and other commands that must be "
+                              "recorded outside of a render pass are not allowed in secondary command lists.");
+            return;
+        }
+        if (m_State.DynamicRendering)
+        {
+#if DILIGENT_USE_VOLK
+            vkCmdEndRenderingKHR(m_VkCmdBuffer);
+#endif
+            m_State.DynamicRendering = false;
+        }
+        else
+        {
+            vkCmdEndRenderPass(m_VkCmdBuffer);
+        }
         m_State.RenderPass        = VK_NULL_HANDLE;
         m_State.Framebuffer       = VK_NULL_HANDLE;
         m_State.FramebufferWidth  = 0;
@@ -323,24 +377,51 @@ public:
     __forceinline void NextSubpass()
     {
         VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
+        VERIFY(!m_State.DynamicRendering, "Subpasses are not supported with dynamic rendering");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         vkCmdNextSubpass(m_VkCmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
     }
 
+    // Executes secondary command buffers. Inside a render pass instance, the pass must have been
+    // begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS or, for dynamic rendering,
+    // with VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR flag.
+    __forceinline void ExecuteCommands(uint32_t CommandBufferCount, const VkCommandBuffer* pCommandBuffers)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(CommandBufferCount > 0 && pCommandBuffers != nullptr);
+        VERIFY(!m_State.InheritedRenderPass, "Secondary command buffers can't be executed from secondary command buffers");
+
+        FlushBarriers();
+        vkCmdExecuteCommands(m_VkCmdBuffer, CommandBufferCount, pCommandBuffers);
+    }
+
     __forceinline void EndCommandBuffer()
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Render pass has not been ended");
+        VERIFY(!m_State.IsInsideRenderPass(), "Render pass has not been ended");
         FlushBarriers();
         vkEndCommandBuffer(m_VkCmdBuffer);
     }
 
+    // Forgets the cached pipelines, index buffer and other bindings without resetting the command buffer.
+    // Must be called after executing secondary command buffers as they leave the state undefined.
+    __forceinline void InvalidateState()
+    {
+        VERIFY(!m_State.IsInsideRenderPass(), "Invalidating state inside a render pass");
+        // Queries that are active outside of render pass are not affected
+        const auto OutsidePassQueries = m_State.OutsidePassQueries;
+
+        m_State                    = {};
+        m_State.OutsidePassQueries = OutsidePassQueries;
+    }
+
     __forceinline void Reset()
     {
         m_VkCmdBuffer = VK_NULL_HANDLE;
         m_State       = {};
         m_Barrier     = {};
         m_ImageBarriers.clear();
+        m_ImageBarriers2.clear();
     }
 
     __forceinline void BindComputePipeline(VkPipeline ComputePipeline)
@@ -361,10 +442,25 @@ public:
         if (m_State.GraphicsPipeline != GraphicsPipeline)
         {
             vkCmdBindPipeline(m_VkCmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, GraphicsPipeline);
-            m_State.GraphicsPipeline = GraphicsPipeline;
+            m_State.GraphicsPipeline     = GraphicsPipeline;
+            m_State.GraphicsShadersBound = false;
         }
     }
 
+    __forceinline void BindShaders(uint32_t StageCount, const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdBindShadersEXT(m_VkCmdBuffer, StageCount, pStages, pShaders);
+        // Binding shader objects disturbs the graphics pipeline binding,
+        // so the pipeline must be bound again the next time it is used.
+        m_State.GraphicsPipeline     = VK_NULL_HANDLE;
+        m_State.GraphicsShadersBound = true;
+#else
+        UNSUPPORTED("BindShaders is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void BindRayTracingPipeline(VkPipeline RayTracingPipeline)
     {
         // 9.8
@@ -400,6 +496,273 @@ public:
         vkCmdSetBlendConstants(m_VkCmdBuffer, BlendConstants);
     }
 
+    __forceinline void SetStencilCompareMask(uint32_t CompareMask)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilCompareMask(m_VkCmdBuffer, VK_STENCIL_FRONT_AND_BACK, CompareMask);
+    }
+
+    __forceinline void SetStencilWriteMask(uint32_t WriteMask)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilWriteMask(m_VkCmdBuffer, VK_STENCIL_FRONT_AND_BACK, WriteMask);
+    }
+
+    __forceinline void SetCullMode(VkCullModeFlags CullMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetCullModeEXT(m_VkCmdBuffer, CullMode);
+#else
+        UNSUPPORTED("SetCullMode is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetFrontFace(VkFrontFace FrontFace)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetFrontFaceEXT(m_VkCmdBuffer, FrontFace);
+#else
+        UNSUPPORTED("SetFrontFace is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveTopology(VkPrimitiveTopology Topology)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology);
+#else
+        UNSUPPORTED("SetPrimitiveTopology is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthTestEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthTestEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetDepthTestEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthWriteEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthWriteEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetDepthWriteEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthCompareOp(VkCompareOp CompareOp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthCompareOpEXT(m_VkCmdBuffer, CompareOp);
+#else
+        UNSUPPORTED("SetDepthCompareOp is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilTestEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilTestEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetStencilTestEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilOp(VkStencilFaceFlags FaceMask, const VkStencilOpState& OpState)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetStencilOpEXT(m_VkCmdBuffer, FaceMask, OpState.failOp, OpState.passOp, OpState.depthFailOp, OpState.compareOp);
+#else
+        UNSUPPORTED("SetStencilOp is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetViewportsWithCount(uint32_t ViewportCount, const VkViewport* pViewports)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetViewportWithCountEXT(m_VkCmdBuffer, ViewportCount, pViewports);
+#else
+        UNSUPPORTED("SetViewportsWithCount is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetScissorRectsWithCount(uint32_t ScissorCount, const VkRect2D* pScissors)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetScissorWithCountEXT(m_VkCmdBuffer, ScissorCount, pScissors);
+#else
+        UNSUPPORTED("SetScissorRectsWithCount is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetRasterizerDiscardEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetRasterizerDiscardEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetRasterizerDiscardEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPolygonMode(VkPolygonMode PolygonMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPolygonModeEXT(m_VkCmdBuffer, PolygonMode);
+#else
+        UNSUPPORTED("SetPolygonMode is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetRasterizationSamples(VkSampleCountFlagBits Samples)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetRasterizationSamplesEXT(m_VkCmdBuffer, Samples);
+#else
+        UNSUPPORTED("SetRasterizationSamples is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetSampleMask(VkSampleCountFlagBits Samples, const VkSampleMask* pSampleMask)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetSampleMaskEXT(m_VkCmdBuffer, Samples, pSampleMask);
+#else
+        UNSUPPORTED("SetSampleMask is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetAlphaToCoverageEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetAlphaToCoverageEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetAlphaToCoverageEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthBiasEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthBiasEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetDepthBiasEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthBias(float ConstantFactor, float Clamp, float SlopeFactor)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthBias(m_VkCmdBuffer, ConstantFactor, Clamp, SlopeFactor);
+    }
+
+    __forceinline void SetLineWidth(float LineWidth)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetLineWidth(m_VkCmdBuffer, LineWidth);
+    }
+
+    __forceinline void SetDepthClampEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthClampEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetDepthClampEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthBoundsTestEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDepthBoundsTestEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetDepthBoundsTestEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveRestartEnable(VkBool32 Enable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPrimitiveRestartEnableEXT(m_VkCmdBuffer, Enable);
+#else
+        UNSUPPORTED("SetPrimitiveRestartEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPatchControlPoints(uint32_t PatchControlPoints)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetPatchControlPointsEXT(m_VkCmdBuffer, PatchControlPoints);
+#else
+        UNSUPPORTED("SetPatchControlPoints is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetVertexInput(uint32_t                                     BindingCount,
+                                      const VkVertexInputBindingDescription2EXT*   pBindings,
+                                      uint32_t                                     AttributeCount,
+                                      const VkVertexInputAttributeDescription2EXT* pAttributes)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetVertexInputEXT(m_VkCmdBuffer, BindingCount, pBindings, AttributeCount, pAttributes);
+#else
+        UNSUPPORTED("SetVertexInput is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorBlendEnable(uint32_t AttachmentCount, const VkBool32* pEnables)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorBlendEnableEXT(m_VkCmdBuffer, 0, AttachmentCount, pEnables);
+#else
+        UNSUPPORTED("SetColorBlendEnable is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorBlendEquation(uint32_t AttachmentCount, const VkColorBlendEquationEXT* pEquations)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorBlendEquationEXT(m_VkCmdBuffer, 0, AttachmentCount, pEquations);
+#else
+        UNSUPPORTED("SetColorBlendEquation is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetColorWriteMask(uint32_t AttachmentCount, const VkColorComponentFlags* pWriteMasks)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetColorWriteMaskEXT(m_VkCmdBuffer, 0, AttachmentCount, pWriteMasks);
+#else
+        UNSUPPORTED("SetColorWriteMask is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void BindIndexBuffer(VkBuffer Buffer, VkDeviceSize Offset, VkIndexType IndexType)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
@@ -434,6 +797,28 @@ public:
                        VkPipelineStageFlags SrcStages,
                        VkPipelineStageFlags DestStages);
 
+    // Begins a split barrier: the event is signaled once all previously recorded
+    // commands have completed the given pipeline stages.
+    void SetEvent(VkEvent Event, VkPipelineStageFlags StageMask);
+
+    // Ends a split barrier begun by SetEvent(): waits for the event and makes memory
+    // written by SrcStages available to DstStages. SrcStages must match the stage mask
+    // the event was set with.
+    void WaitEventMemoryBarrier(VkEvent              Event,
+                                VkAccessFlags        srcAccessMask,
+                                VkAccessFlags        dstAccessMask,
+                                VkPipelineStageFlags SrcStages,
+                                VkPipelineStageFlags DstStages);
+
+    // Same as WaitEventMemoryBarrier(), but also transitions the image layout.
+    void WaitEventImageLayout(VkEvent                        Event,
+                              VkImage                        Image,
+                              VkImageLayout                  OldLayout,
+                              VkImageLayout                  NewLayout,
+                              const VkImageSubresourceRange& SubresRange,
+                              VkPipelineStageFlags           SrcStages,
+                              VkPipelineStageFlags           DstStages);
+
     __forceinline void BindDescriptorSets(VkPipelineBindPoint    pipelineBindPoint,
                                           VkPipelineLayout       layout,
                                           uint32_t               firstSet,
@@ -446,13 +831,61 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("Push descriptors are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "No descriptor buffer is bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
                                   const VkBufferCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy buffer operation must be performed outside of render pass.
             EndRenderPass();
@@ -469,7 +902,7 @@ public:
                                  const VkImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -485,7 +918,7 @@ public:
                                          const VkBufferImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -501,7 +934,7 @@ public:
                                          const VkBufferImageCopy* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy operations must be performed outside of render pass.
             EndRenderPass();
@@ -519,7 +952,7 @@ public:
                                  VkFilter           filter)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Blit must be performed outside of render pass.
             EndRenderPass();
@@ -536,7 +969,7 @@ public:
                                     const VkImageResolve* pRegions)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Resolve must be performed outside of render pass.
             EndRenderPass();
@@ -566,7 +999,7 @@ public:
 
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         vkCmdBeginQuery(m_VkCmdBuffer, queryPool, query, flags);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
             m_State.InsidePassQueries |= queryFlag;
         else
             m_State.OutsidePassQueries |= queryFlag;
@@ -578,7 +1011,7 @@ public:
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         vkCmdEndQuery(m_VkCmdBuffer, queryPool, query);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             VERIFY((m_State.InsidePassQueries & queryFlag) != 0, "No active inside-pass queries found.");
             m_State.InsidePassQueries &= ~queryFlag;
@@ -603,7 +1036,7 @@ public:
                                       uint32_t    queryCount)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Query pool reset must be performed outside of render pass (17.2).
             EndRenderPass();
@@ -621,7 +1054,7 @@ public:
                                             VkQueryResultFlags flags)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy query results must be performed outside of render pass (17.2).
             EndRenderPass();
@@ -631,13 +1064,53 @@ public:
                                   dstBuffer, dstOffset, stride, flags);
     }
 
+    __forceinline void BeginConditionalRendering(VkBuffer                        buffer,
+                                                 VkDeviceSize                    offset,
+                                                 VkConditionalRenderingFlagsEXT flags)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.IsInsideRenderPass())
+        {
+            // Conditional rendering that is begun inside a render pass must end in the same subpass.
+            // Since render passes may be implicitly ended at any time, always begin it outside.
+            EndRenderPass();
+        }
+        FlushBarriers();
+
+        VkConditionalRenderingBeginInfoEXT BeginInfo{};
+        BeginInfo.sType  = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
+        BeginInfo.pNext  = nullptr;
+        BeginInfo.buffer = buffer;
+        BeginInfo.offset = offset;
+        BeginInfo.flags  = flags;
+        vkCmdBeginConditionalRenderingEXT(m_VkCmdBuffer, &BeginInfo);
+#else
+        UNSUPPORTED("Conditional rendering is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void EndConditionalRendering()
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.IsInsideRenderPass())
+        {
+            EndRenderPass();
+        }
+        vkCmdEndConditionalRenderingEXT(m_VkCmdBuffer);
+#else
+        UNSUPPORTED("Conditional rendering is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void BuildAccelerationStructure(uint32_t                                               infoCount,
                                                   const VkAccelerationStructureBuildGeometryInfoKHR*     pInfos,
                                                   const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos)
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Build AS operations must be performed outside of render pass.
             EndRenderPass();
@@ -653,7 +1126,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Copy AS operations must be performed outside of render pass.
             EndRenderPass();
@@ -669,7 +1142,7 @@ public:
     {
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             // Write AS properties operations must be performed outside of render pass.
             EndRenderPass();
@@ -692,7 +1165,7 @@ public:
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RayTracingPipeline != VK_NULL_HANDLE, "No ray tracing pipeline bound");
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             EndRenderPass();
         }
@@ -712,7 +1185,7 @@ public:
 #if DILIGENT_USE_VOLK
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RayTracingPipeline != VK_NULL_HANDLE, "No ray tracing pipeline bound");
-        if (m_State.RenderPass != VK_NULL_HANDLE)
+        if (m_State.IsInsideRenderPass())
         {
             EndRenderPass();
         }
@@ -776,6 +1249,16 @@ public:
 
     void FlushBarriers();
 
+    // Enables recording barriers with vkCmdPipelineBarrier2KHR (VK_KHR_synchronization2).
+    // Image barriers then keep their own stage masks instead of sharing the stage masks
+    // of the whole batch, and redundant layout transitions within the batch are merged.
+    void SetUseSynchronization2(bool UseSync2);
+
+    bool UsesSynchronization2() const { return m_UseSync2; }
+
+    // Sets the counter that is incremented every time a pipeline barrier command is recorded.
+    void SetBarrierCounter(uint32_t* pCounter) { m_pBarrierCounter = pCounter; }
+
     __forceinline void SetVkCmdBuffer(VkCommandBuffer VkCmdBuffer, VkPipelineStageFlags StageMask, VkAccessFlags AccessMask)
     {
         m_VkCmdBuffer                 = VkCmdBuffer;
@@ -801,11 +1284,48 @@ public:
         uint32_t      FramebufferHeight  = 0;
         uint32_t      InsidePassQueries  = 0;
         uint32_t      OutsidePassQueries = 0;
+        bool          DynamicRendering   = false; // Render pass instance was begun with vkCmdBeginRenderingKHR
+
+        // Secondary command buffer continues the render pass instance begun in the primary command buffer
+        bool InheritedRenderPass = false;
+
+        VkDeviceAddress DescriptorBufferAddress = 0; // Descriptor buffer bound with vkCmdBindDescriptorBuffersEXT
+
+        // Graphics shader objects are bound with vkCmdBindShadersEXT
+        bool GraphicsShadersBound = false;
+
+        // Returns true if either a graphics pipeline or graphics shader objects are bound
+        bool HasGraphicsShaders() const
+        {
+            return GraphicsPipeline != VK_NULL_HANDLE || GraphicsShadersBound;
+        }
+
+        // Returns true if a render pass instance is active, either begun with
+        // vkCmdBeginRenderPass or with vkCmdBeginRenderingKHR.
+        bool IsInsideRenderPass() const
+        {
+            return RenderPass != VK_NULL_HANDLE || DynamicRendering;
+        }
     };
 
     const StateCache& GetState() const { return m_State; }
 
 private:
+    void TransitionImageLayout2(VkImage                        Image,
+                                VkImageLayout                  OldLayout,
+                                VkImageLayout                  NewLayout,
+                                const VkImageSubresourceRange& SubresRange,
+                                VkPipelineStageFlags           SrcStages,
+                                VkPipelineStageFlags           DestStages);
+
+    void FlushBarriers2();
+
+    void WaitEvent(VkEvent                     Event,
+                   VkPipelineStageFlags        SrcStages,
+                   VkPipelineStageFlags        DstStages,
+                   const VkMemoryBarrier*      pMemBarrier,
+                   const VkImageMemoryBarrier* pImgBarrier);
+
     struct PipelineBarrier
     {
         VkPipelineStageFlags MemorySrcStages = 0;
@@ -825,6 +1345,13 @@ private:
     PipelineBarrier m_Barrier;
 
     std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+    // Image barriers recorded when VK_KHR_synchronization2 is used
+    std::vector<VkImageMemoryBarrier2KHR> m_ImageBarriers2;
+
+    bool m_UseSync2 = false;
+
+    uint32_t* m_pBarrierCounter = nullptr;
 };
 
 } // namespace VulkanUtilities
@@ -54,9 +54,17 @@ public:
 
     ~VulkanCommandBufferPool();
 
-    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
-    // The GPU must have finished with the command buffer being returned to the pool
-    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer);
+    // Returns a command buffer in the recording state. If pInheritanceInfo is not null, a secondary
+    // command buffer that continues the render pass described by the inheritance info is returned.
+    // UsageFlags are the flags the command buffer is begun with.
+    // This method must only be called by the thread that owns the pool.
+    VkCommandBuffer GetCommandBuffer(const char*                           DebugName        = "",
+                                     const VkCommandBufferInheritanceInfo* pInheritanceInfo = nullptr,
+                                     VkCommandBufferUsageFlags             UsageFlags       = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+    // The GPU must have finished with the command buffer being returned to the pool.
+    // This method may be called from any thread.
+    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, bool IsSecondary = false);
 
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_SupportedAccessMask; }
@@ -67,8 +75,24 @@ private:
 
     CommandPoolWrapper m_CmdPool;
 
-    std::mutex                  m_Mutex;
-    std::deque<VkCommandBuffer> m_CmdBuffers;
+    enum CMD_BUFFER_LEVEL : size_t
+    {
+        CMD_BUFFER_LEVEL_PRIMARY = 0,
+        CMD_BUFFER_LEVEL_SECONDARY,
+        CMD_BUFFER_LEVEL_COUNT
+    };
+
+    // Command buffers that are ready to be reused. Only accessed by the owning thread,
+    // so no synchronization is required.
+    std::deque<VkCommandBuffer> m_ReadyCmdBuffers[CMD_BUFFER_LEVEL_COUNT];
+
+    // Command buffers returned to the pool by release queues. The owning thread swaps this list
+    // with the ready list when the latter is exhausted, so the mutex is only taken once per batch
+    // of recycled buffers rather than once per buffer.
+    std::mutex                  m_RecycledCmdBuffersMtx;
+    std::deque<VkCommandBuffer> m_RecycledCmdBuffers[CMD_BUFFER_LEVEL_COUNT];
+    std::atomic<uint32_t>       m_NumRecycledCmdBuffers[CMD_BUFFER_LEVEL_COUNT] = {};
+
     const VkPipelineStageFlags  m_SupportedStagesMask;
     const VkAccessFlags         m_SupportedAccessMask;
 
@@ -59,7 +59,9 @@ enum class VulkanHandleTypeId : uint32_t
     Event,
     QueryPool,
     AccelerationStructureKHR,
-    PipelineCache
+    PipelineCache,
+    DescriptorUpdateTemplate,
+    ShaderEXT
 };
 
 template <typename VulkanObjectType, VulkanHandleTypeId>
@@ -82,9 +84,12 @@ using FramebufferWrapper         = DEFINE_VULKAN_OBJECT_WRAPPER(Framebuffer);
 using DescriptorPoolWrapper      = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorPool);
 using DescriptorSetLayoutWrapper = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorSetLayout);
 using SemaphoreWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(Semaphore);
+using EventWrapper               = DEFINE_VULKAN_OBJECT_WRAPPER(Event);
 using QueryPoolWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(QueryPool);
 using AccelStructWrapper         = DEFINE_VULKAN_OBJECT_WRAPPER(AccelerationStructureKHR);
 using PipelineCacheWrapper       = DEFINE_VULKAN_OBJECT_WRAPPER(PipelineCache);
+using DescrUpdateTemplateWrapper = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorUpdateTemplate);
+using ShaderObjectWrapper        = DEFINE_VULKAN_OBJECT_WRAPPER(ShaderEXT);
 #undef DEFINE_VULKAN_OBJECT_WRAPPER
 
 class VulkanLogicalDevice : public std::enable_shared_from_this<VulkanLogicalDevice>
@@ -149,6 +154,7 @@ public:
 
     SemaphoreWrapper    CreateSemaphore(const VkSemaphoreCreateInfo& SemaphoreCI, const char* DebugName = "") const;
     SemaphoreWrapper    CreateTimelineSemaphore(uint64_t InitialValue, const char* DebugName = "") const;
+    EventWrapper        CreateEvent(const VkEventCreateInfo& EventCI, const char* DebugName = "") const;
     QueryPoolWrapper    CreateQueryPool(const VkQueryPoolCreateInfo& QueryPoolCI, const char* DebugName = "") const;
     AccelStructWrapper  CreateAccelStruct(const VkAccelerationStructureCreateInfoKHR& CI, const char* DebugName = "") const;
 
@@ -157,6 +163,12 @@ public:
 
     PipelineCacheWrapper CreatePipelineCache(const VkPipelineCacheCreateInfo &CI, const char* DebugName = "") const;
 
+    VkResult MergePipelineCaches(VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) const;
+
+    DescrUpdateTemplateWrapper CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName = "") const;
+
+    ShaderObjectWrapper CreateShaderObject(const VkShaderCreateInfoEXT& ShaderCI, const char* DebugName = "") const;
+
     void ReleaseVulkanObject(CommandPoolWrapper&&  CmdPool) const;
     void ReleaseVulkanObject(BufferWrapper&&       Buffer) const;
     void ReleaseVulkanObject(BufferViewWrapper&&   BufferView) const;
@@ -173,16 +185,23 @@ public:
     void ReleaseVulkanObject(DescriptorPoolWrapper&& DescriptorPool) const;
     void ReleaseVulkanObject(DescriptorSetLayoutWrapper&& DescriptorSetLayout) const;
     void ReleaseVulkanObject(SemaphoreWrapper&&     Semaphore) const;
+    void ReleaseVulkanObject(EventWrapper&&         Event) const;
     void ReleaseVulkanObject(QueryPoolWrapper&&     QueryPool) const;
     void ReleaseVulkanObject(AccelStructWrapper&&   AccelStruct) const;
     void ReleaseVulkanObject(PipelineCacheWrapper&& PSOCache) const;
+    void ReleaseVulkanObject(DescrUpdateTemplateWrapper&& UpdateTemplate) const;
+    void ReleaseVulkanObject(ShaderObjectWrapper&&  ShaderObject) const;
 
     void FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const;
     void FreeCommandBuffer(VkCommandPool Pool, VkCommandBuffer CmdBuffer) const;
 
     VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer) const;
     VkMemoryRequirements GetImageMemoryRequirements (VkImage  vkImage ) const;
+    // Also returns whether the driver prefers or requires a dedicated allocation (VK_KHR_dedicated_allocation)
+    VkMemoryRequirements GetBufferMemoryRequirements(VkBuffer vkBuffer, bool& PrefersDedicatedAllocation) const;
+    VkMemoryRequirements GetImageMemoryRequirements (VkImage  vkImage,  bool& PrefersDedicatedAllocation) const;
     VkDeviceAddress      GetAccelerationStructureDeviceAddress(VkAccelerationStructureKHR AS) const;
+    VkDeviceAddress      GetBufferDeviceAddress(VkBuffer vkBuffer) const;
 
     VkResult BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
     VkResult BindImageMemory (VkImage image,   VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
@@ -210,6 +229,16 @@ public:
                               uint32_t                    descriptorCopyCount,
                               const VkCopyDescriptorSet*  pDescriptorCopies) const;
 
+    // Requires Vulkan 1.1
+    void UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                         const void*                pData) const;
+
+    // VK_EXT_descriptor_buffer
+    VkDeviceSize GetDescriptorSetLayoutSize(VkDescriptorSetLayout vkLayout) const;
+    VkDeviceSize GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout vkLayout, uint32_t Binding) const;
+    void         GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t DataSize, void* pDescriptor) const;
+
     VkResult ResetCommandPool(VkCommandPool           vkCmdPool,
                               VkCommandPoolResetFlags flags = 0) const;
 
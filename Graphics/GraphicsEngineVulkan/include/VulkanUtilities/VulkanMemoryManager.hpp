@@ -30,8 +30,10 @@
 #include <mutex>
 #include <array>
 #include <unordered_map>
+#include <list>
 #include <atomic>
 #include <string>
+#include <functional>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
@@ -104,11 +106,14 @@ struct VulkanMemoryAllocation
 class VulkanMemoryPage
 {
 public:
-    VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                     VkDeviceSize          PageSize,
-                     uint32_t              MemoryTypeIndex,
-                     bool                  IsHostVisible,
-                     VkMemoryAllocateFlags AllocateFlags);
+    // pDedicatedInfo is only used for dedicated pages when VK_KHR_dedicated_allocation is enabled
+    VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                     VkDeviceSize                         PageSize,
+                     uint32_t                             MemoryTypeIndex,
+                     bool                                 IsHostVisible,
+                     VkMemoryAllocateFlags                AllocateFlags,
+                     bool                                 IsDedicated    = false,
+                     const VkMemoryDedicatedAllocateInfo* pDedicatedInfo = nullptr);
     ~VulkanMemoryPage();
 
     // clang-format off
@@ -116,7 +121,9 @@ public:
         m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
         m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
         m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
+        m_CPUMemory       {rhs.m_CPUMemory               },
+        m_MemoryTypeIndex {rhs.m_MemoryTypeIndex         },
+        m_IsDedicated     {rhs.m_IsDedicated             }
     {
         rhs.m_CPUMemory = nullptr;
     }
@@ -129,6 +136,8 @@ public:
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
     VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    bool     IsDedicated()        const { return m_IsDedicated;     }
+    uint32_t GetMemoryTypeIndex() const { return m_MemoryTypeIndex; }
 
     // clang-format on
 
@@ -150,6 +159,9 @@ private:
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+    const uint32_t                           m_MemoryTypeIndex;
+    // Dedicated page holds a single resource and is not used for suballocations
+    const bool m_IsDedicated;
 };
 
 class VulkanMemoryManager
@@ -163,15 +175,17 @@ public:
                         VkDeviceSize                 DeviceLocalPageSize,
                         VkDeviceSize                 HostVisiblePageSize,
                         VkDeviceSize                 DeviceLocalReserveSize,
-                        VkDeviceSize                 HostVisibleReserveSize) :
-        m_MgrName               {std::move(MgrName)    },
-        m_LogicalDevice         {LogicalDevice         },
-        m_PhysicalDevice        {PhysicalDevice        },
-        m_Allocator             {Allocator             },
-        m_DeviceLocalPageSize   {DeviceLocalPageSize   },
-        m_HostVisiblePageSize   {HostVisiblePageSize   },
-        m_DeviceLocalReserveSize{DeviceLocalReserveSize},
-        m_HostVisibleReserveSize{HostVisibleReserveSize}
+                        VkDeviceSize                 HostVisibleReserveSize,
+                        VkDeviceSize                 DedicatedAllocationThreshold = 0) :
+        m_MgrName                     {std::move(MgrName)          },
+        m_LogicalDevice               {LogicalDevice               },
+        m_PhysicalDevice              {PhysicalDevice              },
+        m_Allocator                   {Allocator                   },
+        m_DeviceLocalPageSize         {DeviceLocalPageSize         },
+        m_HostVisiblePageSize         {HostVisiblePageSize         },
+        m_DeviceLocalReserveSize      {DeviceLocalReserveSize      },
+        m_HostVisibleReserveSize      {HostVisibleReserveSize      },
+        m_DedicatedAllocationThreshold{DedicatedAllocationThreshold}
     {}
 
 
@@ -179,25 +193,32 @@ public:
     // constructor is not labeled with noexcept, which makes all
     // std containers use copy instead of move
     VulkanMemoryManager(VulkanMemoryManager&& rhs)noexcept :
-        m_MgrName         {std::move(rhs.m_MgrName)},
-        m_LogicalDevice   {rhs.m_LogicalDevice     },
-        m_PhysicalDevice  {rhs.m_PhysicalDevice    },
-        m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
-
-        m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
-        m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
-        m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
-        m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
+        m_MgrName         {std::move(rhs.m_MgrName)       },
+        m_LogicalDevice   {rhs.m_LogicalDevice            },
+        m_PhysicalDevice  {rhs.m_PhysicalDevice           },
+        m_Allocator       {rhs.m_Allocator                },
+        m_Pages           {std::move(rhs.m_Pages)         },
+        m_DedicatedPages  {std::move(rhs.m_DedicatedPages)},
+
+        m_DeviceLocalPageSize          {rhs.m_DeviceLocalPageSize         },
+        m_HostVisiblePageSize          {rhs.m_HostVisiblePageSize         },
+        m_DeviceLocalReserveSize       {rhs.m_DeviceLocalReserveSize      },
+        m_HostVisibleReserveSize       {rhs.m_HostVisibleReserveSize      },
+        m_DedicatedAllocationThreshold {rhs.m_DedicatedAllocationThreshold},
 
         //m_CurrUsedSize      {rhs.m_CurrUsedSize},
         m_PeakUsedSize      {rhs.m_PeakUsedSize     },
         m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize},
+        m_HeapAllocatedSize {rhs.m_HeapAllocatedSize},
+
+        m_BudgetCallback  {std::move(rhs.m_BudgetCallback)},
+        m_BudgetThreshold {rhs.m_BudgetThreshold          }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
             m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
+        m_NumReleasedDedicatedPages.store(rhs.m_NumReleasedDedicatedPages.load());
     }
 
     ~VulkanMemoryManager();
@@ -208,10 +229,49 @@ public:
     VulkanMemoryManager& operator= (VulkanMemoryManager&&)      = delete;
     // clang-format on
 
-    VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
-    VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
+    // Resource that may be given a dedicated memory allocation
+    struct DedicatedAllocationInfo
+    {
+        VkImage  vkImage  = VK_NULL_HANDLE;
+        VkBuffer vkBuffer = VK_NULL_HANDLE;
+
+        // Whether the driver prefers or requires a dedicated allocation for the resource
+        bool PrefersDedicatedAllocation = false;
+    };
+
+    // If pDedicated is not null, the resource gets a dedicated allocation when the driver prefers it
+    // or when its size is not less than the dedicated allocation threshold.
+    VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo* pDedicated = nullptr);
+    VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo* pDedicated = nullptr);
     void                   ShrinkMemory();
 
+    // The callback is called with the heap index when a new page is created and the heap usage,
+    // including the new page, exceeds Threshold * HeapBudget. The callback is called without any
+    // internal locks held, so it may release or allocate memory.
+    // Heap budget is only known when VK_EXT_memory_budget extension is enabled.
+    using BudgetCallbackType = std::function<void(uint32_t HeapIndex)>;
+    void SetBudgetCallback(BudgetCallbackType Callback, float Threshold);
+
+    // Returns the total size of the pages allocated from the given memory heap.
+    VkDeviceSize GetHeapAllocatedSize(uint32_t HeapIndex);
+
+    // Returns the index of a device-local, host-visible and host-coherent memory type compatible
+    // with MemoryTypeBits that resides in a heap large enough to hold arbitrary resources, which is
+    // the case with resizable BAR or on unified memory architectures. Resources placed in such
+    // memory can be written by the CPU directly.
+    // Returns InvalidMemoryTypeIndex if there is no such memory type.
+    uint32_t GetDirectWriteMemoryTypeIndex(uint32_t MemoryTypeBits) const;
+
+    struct PageStats
+    {
+        VkDeviceSize AllocatedSize     = 0;
+        VkDeviceSize UsedSize          = 0;
+        VkDeviceSize PeakAllocatedSize = 0;
+        VkDeviceSize PeakUsedSize      = 0;
+    };
+    // Returns the statistics of host-visible (HostVisible == true) or device-local pages.
+    PageStats GetPageStats(bool HostVisible);
+
 protected:
     friend class VulkanMemoryPage;
 
@@ -259,12 +319,29 @@ protected:
     };
     std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
 
+    // Dedicated pages are released by ShrinkMemory() as soon as they become empty.
+    // std::list is used as allocations keep pointers to their pages.
+    std::list<VulkanMemoryPage> m_DedicatedPages;
+
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
+    const VkDeviceSize m_DedicatedAllocationThreshold;
+
+    VulkanMemoryAllocation AllocateDedicated(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo& Dedicated);
+
+    // Queries the budget of the heap and reduces PageSize down to MinPageSize if the page does not fit into the budget.
+    // Returns true if the heap usage, including the new page, exceeds the budget callback threshold.
+    // Must be called with m_PagesMtx locked.
+    bool CheckHeapBudget(uint32_t HeapIndex, VkDeviceSize MinPageSize, VkDeviceSize& PageSize);
+
+    void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible, bool IsDedicatedPage);
 
-    void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
+    uint32_t GetHeapIndex(uint32_t MemoryTypeIndex) const
+    {
+        return m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+    }
 
     // 0 == Device local, 1 == Host-visible
     std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
@@ -272,6 +349,16 @@ protected:
     std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
     std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
 
+    // Allocated size of each memory heap, protected by m_PagesMtx
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> m_HeapAllocatedSize = {};
+
+    // Protected by m_PagesMtx
+    BudgetCallbackType m_BudgetCallback;
+    float              m_BudgetThreshold = 1.f;
+
+    // The number of dedicated pages that became empty and have not been released yet
+    std::atomic<uint32_t> m_NumReleasedDedicatedPages{0};
+
     // If adding new member, do not forget to update move ctor
 };
 
@@ -48,25 +48,34 @@ public:
 
     struct ExtensionFeatures
     {
-        VkPhysicalDeviceMeshShaderFeaturesEXT             MeshShader             = {};
-        VkPhysicalDevice16BitStorageFeaturesKHR           Storage16Bit           = {};
-        VkPhysicalDevice8BitStorageFeaturesKHR            Storage8Bit            = {};
-        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR      ShaderFloat16Int8      = {};
-        VkPhysicalDeviceAccelerationStructureFeaturesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelineFeaturesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceRayQueryFeaturesKHR               RayQuery               = {};
-        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR    BufferDeviceAddress    = {};
-        VkPhysicalDeviceDescriptorIndexingFeaturesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetFeaturesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceHostQueryResetFeatures            HostQueryReset         = {};
-        VkPhysicalDeviceFragmentShadingRateFeaturesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapFeaturesEXT     FragmentDensityMap     = {}; // Only for desktop devices
-        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT    FragmentDensityMap2    = {}; // Only for mobile devices
-        VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
-        VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
-        VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
+        VkPhysicalDeviceMeshShaderFeaturesEXT              MeshShader              = {};
+        VkPhysicalDevice16BitStorageFeaturesKHR            Storage16Bit            = {};
+        VkPhysicalDevice8BitStorageFeaturesKHR             Storage8Bit             = {};
+        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR       ShaderFloat16Int8       = {};
+        VkPhysicalDeviceAccelerationStructureFeaturesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelineFeaturesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceRayQueryFeaturesKHR                RayQuery                = {};
+        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR     BufferDeviceAddress     = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetFeaturesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceHostQueryResetFeatures             HostQueryReset          = {};
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapFeaturesEXT      FragmentDensityMap      = {}; // Only for desktop devices
+        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT     FragmentDensityMap2     = {}; // Only for mobile devices
+        VkPhysicalDeviceMultiviewFeaturesKHR               Multiview               = {}; // Required for RenderPass2
+        VkPhysicalDeviceMultiDrawFeaturesEXT               MultiDraw               = {};
+        VkPhysicalDeviceShaderDrawParametersFeatures       ShaderDrawParameters    = {};
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR        DynamicRendering        = {};
+        VkPhysicalDeviceSynchronization2FeaturesKHR        Synchronization2        = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT        DescriptorBuffer        = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT    ExtendedDynamicState    = {};
+        VkPhysicalDevicePresentIdFeaturesKHR               PresentId               = {};
+        VkPhysicalDevicePresentWaitFeaturesKHR             PresentWait             = {};
+        VkPhysicalDeviceConditionalRenderingFeaturesEXT    ConditionalRendering    = {};
+        VkPhysicalDeviceShaderObjectFeaturesEXT            ShaderObject            = {};
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
         bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
@@ -74,24 +83,30 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool PushDescriptor       = false;
+        bool MemoryBudget         = false;
+        bool DedicatedAllocation  = false;
     };
 
     struct ExtensionProperties
     {
-        VkPhysicalDeviceMeshShaderPropertiesEXT             MeshShader             = {};
-        VkPhysicalDeviceAccelerationStructurePropertiesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelinePropertiesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceDescriptorIndexingPropertiesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetPropertiesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceSubgroupProperties                  Subgroup               = {};
-        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphorePropertiesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceFragmentShadingRatePropertiesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapPropertiesEXT     FragmentDensityMap     = {};
-        VkPhysicalDeviceMultiviewPropertiesKHR              Multiview              = {};
-        VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
-        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
-        VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
+        VkPhysicalDeviceMeshShaderPropertiesEXT              MeshShader              = {};
+        VkPhysicalDeviceAccelerationStructurePropertiesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetPropertiesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceSubgroupProperties                   Subgroup                = {};
+        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphorePropertiesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapPropertiesEXT      FragmentDensityMap      = {};
+        VkPhysicalDeviceMultiviewPropertiesKHR               Multiview               = {};
+        VkPhysicalDeviceMaintenance3Properties               Maintenance3            = {};
+        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT     FragmentDensityMap2     = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT               MultiDraw               = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT        DescriptorBuffer        = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR          PushDescriptor          = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GraphicsPipelineLibrary = {};
     };
 
 public:
@@ -115,12 +130,17 @@ public:
 
     VkPhysicalDevice                            GetVkDeviceHandle() const { return m_VkDevice; }
     uint32_t                                    GetVkVersion() const { return m_VkVersion; }
+    uint32_t                                    GetDeviceGroupSize() const { return m_DeviceGroupSize; }
     const VkPhysicalDeviceProperties&           GetProperties() const { return m_Properties; }
     const VkPhysicalDeviceFeatures&             GetFeatures() const { return m_Features; }
     const ExtensionFeatures&                    GetExtFeatures() const { return m_ExtFeatures; }
     const ExtensionProperties&                  GetExtProperties() const { return m_ExtProperties; }
     const VkPhysicalDeviceMemoryProperties&     GetMemoryProperties() const { return m_MemoryProperties; }
     VkFormatProperties                          GetPhysicalDeviceFormatProperties(VkFormat imageFormat) const;
+
+    // Queries current memory budget and usage of each heap from VK_EXT_memory_budget extension.
+    // Returns false if the extension is not supported.
+    bool GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
     const std::vector<VkQueueFamilyProperties>& GetQueueProperties() const { return m_QueueFamilyProperties; }
 
 private:
@@ -128,9 +148,10 @@ private:
 
     const VkPhysicalDevice               m_VkDevice;
     uint32_t                             m_VkVersion        = 0;
-    VkPhysicalDeviceProperties           m_Properties       = {};
-    VkPhysicalDeviceFeatures             m_Features         = {};
-    VkPhysicalDeviceMemoryProperties     m_MemoryProperties = {};
+    uint32_t                             m_DeviceGroupSize  = 1; // The number of physical devices in the device group
+    VkPhysicalDeviceProperties       m_Properties       = {};
+    VkPhysicalDeviceFeatures         m_Features         = {};
+    VkPhysicalDeviceMemoryProperties m_MemoryProperties = {};
     ExtensionFeatures                    m_ExtFeatures      = {};
     ExtensionProperties                  m_ExtProperties    = {};
     std::vector<VkQueueFamilyProperties> m_QueueFamilyProperties;
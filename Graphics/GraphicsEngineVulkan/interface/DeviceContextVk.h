@@ -84,6 +84,54 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     ///           calling IDeviceContext::InvalidateState() and then manually restore all required states via
     ///           appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Begins recording a command list inside the render pass instance defined by the render targets
+
+    /// \param [in] ImmediateContextId - the ID of the immediate context where the command list will be executed.
+    /// \param [in] Attribs            - render targets that the command list will render into. The same
+    ///                                  render targets must be bound to the immediate context when the
+    ///                                  command list is executed.
+    ///
+    /// \remarks  This method can only be called for deferred contexts and is used instead of IDeviceContext::Begin().
+    ///           The commands are recorded into a Vulkan secondary command buffer that continues the render pass
+    ///           instance of the immediate context, so that multiple threads can record one pass in parallel
+    ///           without splitting it into several render pass instances.
+    ///
+    ///           While recording the command list, render targets can't be changed and only commands that are
+    ///           allowed inside a render pass (draws, clears of bound render targets, state changes) may be used.
+    ///           All resources must be transitioned to the required states beforehand:
+    ///           RESOURCE_STATE_TRANSITION_MODE_TRANSITION is not allowed.
+    ///
+    ///           The command list is finished with IDeviceContext::FinishCommandList() and executed with
+    ///           IDeviceContext::ExecuteCommandLists() after the render targets have been bound to the immediate
+    ///           context with IDeviceContext::SetRenderTargets(). All command lists in one ExecuteCommandLists() call
+    ///           must be recorded with this method, and they are executed in a single render pass instance.
+    ///           Explicit render passes (IDeviceContext::BeginRenderPass()) are not supported.
+    ///           Similar to regular command lists, executing the lists invalidates the immediate context state.
+    VIRTUAL void METHOD(BeginSecondaryCommandList)(THIS_
+                                                   Uint32                            ImmediateContextId,
+                                                   const SetRenderTargetsAttribs REF Attribs) PURE;
+
+    /// Begins recording a reusable secondary command list.
+
+    /// \param [in] ImmediateContextId - the ID of the immediate context where the command list will be executed.
+    /// \param [in] Attribs            - render targets that the command list will render into. Render targets
+    ///                                  with the same formats must be bound to the immediate context when the
+    ///                                  command list is executed.
+    ///
+    /// \remarks  This method is similar to BeginSecondaryCommandList(), but the command list returned by
+    ///           IDeviceContext::FinishCommandList() is not consumed by IDeviceContext::ExecuteCommandLists()
+    ///           and can be executed any number of times in any frame until it is released. The command buffer
+    ///           is recorded without VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT and may be executed by several
+    ///           primary command buffers that are pending at the same time.
+    ///
+    ///           In addition to the restrictions of secondary command lists, reusable command lists must not use
+    ///           memory that is only valid in the current frame: dynamic buffers, buffer and texture updates,
+    ///           and dynamic shader variables are not allowed. Queries are not allowed either.
+    ///           Reusable and one-time secondary command lists can be executed by the same ExecuteCommandLists() call.
+    VIRTUAL void METHOD(BeginReusableCommandList)(THIS_
+                                                  Uint32                            ImmediateContextId,
+                                                  const SetRenderTargetsAttribs REF Attribs) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +141,10 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)     CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,     This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)       CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,       This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryCommandList(This, ...) CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryCommandList, This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginReusableCommandList(This, ...)  CALL_IFACE_METHOD(DeviceContextVk, BeginReusableCommandList,  This, __VA_ARGS__)
 
 // clang-format on
 
@@ -45,6 +45,56 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     IRenderDeviceInclusiveMethods;      \
     IRenderDeviceVkMethods RenderDeviceVk
 
+/// Maximum number of Vulkan memory heaps, matches VK_MAX_MEMORY_HEAPS.
+#define DILIGENT_MAX_VK_MEMORY_HEAPS 16
+
+/// Memory budget of a Vulkan memory heap, see Diligent::IRenderDeviceVk::GetMemoryBudget().
+struct MemoryHeapBudgetVk
+{
+    /// Heap size, see VkMemoryHeap::size.
+    Uint64 Size                DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory the process can use in this heap before
+    /// allocations fail or the driver starts paging resources.
+    /// If VK_EXT_memory_budget extension is not enabled, this is the heap size.
+    Uint64 Budget              DEFAULT_INITIALIZER(0);
+
+    /// Estimated memory usage of the process in this heap.
+    /// If VK_EXT_memory_budget extension is not enabled, this is the size
+    /// of the memory pages allocated by the engine from this heap.
+    Uint64 Usage               DEFAULT_INITIALIZER(0);
+
+    /// Size of the memory pages allocated by the engine from this heap.
+    Uint64 EngineAllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// Indicates if the heap is device-local (VK_MEMORY_HEAP_DEVICE_LOCAL_BIT).
+    Bool   IsDeviceLocal       DEFAULT_INITIALIZER(False);
+};
+typedef struct MemoryHeapBudgetVk MemoryHeapBudgetVk;
+
+/// Memory budget of all Vulkan memory heaps, see Diligent::IRenderDeviceVk::GetMemoryBudget().
+struct MemoryBudgetVk
+{
+    /// The number of valid elements in the Heaps array.
+    Uint32             HeapCount                           DEFAULT_INITIALIZER(0);
+
+    /// Indicates if the budget and usage are reported by VK_EXT_memory_budget extension.
+    Bool               IsBudgetSupported                   DEFAULT_INITIALIZER(False);
+
+    /// Budget of each memory heap. Heap index matches VkMemoryType::heapIndex.
+    MemoryHeapBudgetVk Heaps[DILIGENT_MAX_VK_MEMORY_HEAPS] DEFAULT_INITIALIZER({});
+};
+typedef struct MemoryBudgetVk MemoryBudgetVk;
+
+/// Memory budget callback, see Diligent::IRenderDeviceVk::SetMemoryBudgetCallback().
+
+/// \param [in] HeapIndex  - Index of the memory heap whose usage is approaching the budget.
+/// \param [in] pBudget    - Pointer to the current budget of the heap.
+/// \param [in] pUserData  - User data pointer provided to SetMemoryBudgetCallback().
+typedef void(DILIGENT_CALL_TYPE* MemoryBudgetCallbackVkType)(Uint32                    HeapIndex,
+                                                             const MemoryHeapBudgetVk* pBudget,
+                                                             void*                     pUserData);
+
 // clang-format off
 
 /// Exposes Vulkan-specific functionality of a render device.
@@ -157,6 +207,39 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                        VkSemaphore         vkTimelineSemaphore,
                                                        const FenceDesc REF Desc,
                                                        IFence**            ppFence) PURE;
+
+    /// Returns the memory budget of all Vulkan memory heaps
+
+    /// \param [out] Budget - Memory budget of each memory heap.
+    ///
+    /// \remarks   When VK_EXT_memory_budget extension is supported, the budget and usage
+    ///            are queried from the driver and account for the memory used by other
+    ///            processes. Otherwise, the budget is the heap size and the usage is the
+    ///            size of the memory pages allocated by the engine.
+    VIRTUAL void METHOD(GetMemoryBudget)(THIS_
+                                         MemoryBudgetVk REF Budget) PURE;
+
+    /// Sets the callback that is called when the memory usage of a heap approaches its budget
+
+    /// \param [in] Callback  - Callback function, or null to remove the callback.
+    /// \param [in] pUserData - User data pointer that is passed to the callback.
+    /// \param [in] Threshold - Fraction of the heap budget, in (0, 1] range, at which the
+    ///                         callback is called.
+    ///
+    /// \remarks   The callback is called from the thread that allocates a new memory page
+    ///            when the heap usage, including the new page, exceeds Threshold * Budget.
+    ///            The application may use it to evict resources before the driver starts
+    ///            paging memory. No internal locks are held when the callback is called.
+    ///
+    ///            When the usage exceeds the budget, the engine allocates memory pages
+    ///            only as large as required by the allocation and releases unused reserved
+    ///            pages.
+    ///
+    ///            The callback is only called when VK_EXT_memory_budget extension is supported.
+    VIRTUAL void METHOD(SetMemoryBudgetCallback)(THIS_
+                                                 MemoryBudgetCallbackVkType Callback,
+                                                 void*                      pUserData,
+                                                 float                      Threshold) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -174,6 +257,8 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryBudget(This, ...)                CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryBudget,                This, __VA_ARGS__)
+#    define IRenderDeviceVk_SetMemoryBudgetCallback(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, SetMemoryBudgetCallback,        This, __VA_ARGS__)
 
 // clang-format on
 
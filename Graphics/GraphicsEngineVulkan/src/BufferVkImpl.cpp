@@ -130,6 +130,9 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             case BIND_INDIRECT_DRAW_ARGS:
             {
                 VkBuffCI.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+                // Indirect argument buffers may also be used as predicates for conditional rendering
+                if (pRenderDeviceVk->GetFeatures().ConditionalRendering)
+                    VkBuffCI.usage |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
                 break;
             }
             case BIND_UNIFORM_BUFFER:
@@ -169,7 +172,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
     const auto QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
         GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
-        std::vector<uint32_t>{};
+        RenderDeviceVkImpl::QueueFamilyIndicesArray{};
     if (QueueFamilyIndices.size() > 1)
     {
         // If sharingMode is VK_SHARING_MODE_CONCURRENT, queueFamilyIndexCount must be greater than 1
@@ -189,6 +192,21 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    if (pRenderDeviceVk->UseDescriptorBuffers())
+    {
+        constexpr VkBufferUsageFlags DescriptorUsage =
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+
+        // Descriptors written into descriptor buffers reference the buffer by its device address.
+        // Note that this must be done after RequiresBackingBuffer is computed as dynamic buffers
+        // that are suballocated in the dynamic heap don't need their own backing buffer.
+        if ((VkBuffCI.usage & DescriptorUsage) != 0)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -197,6 +215,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             (m_Desc.MiscFlags & MISC_BUFFER_FLAG_SPARSE_ALIASING ? VK_BUFFER_CREATE_SPARSE_ALIASED_BIT : 0);
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
 
         SetState(RESOURCE_STATE_UNDEFINED);
     }
@@ -220,6 +240,7 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         {
             constexpr VkAccessFlags AccessFlags =
                 VK_ACCESS_INDIRECT_COMMAND_READ_BIT |
+                VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT |
                 VK_ACCESS_INDEX_READ_BIT |
                 VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
                 VK_ACCESS_UNIFORM_READ_BIT |
@@ -238,7 +259,10 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
 
-        VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer);
+        RenderDeviceVkImpl::DedicatedAllocationInfo DedicatedInfo;
+        DedicatedInfo.vkBuffer = m_VulkanBuffer;
+
+        VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer, DedicatedInfo.PrefersDedicatedAllocation);
 
         static constexpr auto InvalidMemoryTypeIndex = VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex;
 
@@ -247,8 +271,21 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             VkMemoryPropertyFlags vkMemoryFlags = 0;
             switch (m_Desc.Usage)
             {
-                case USAGE_IMMUTABLE:
                 case USAGE_DEFAULT:
+                    vkMemoryFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+                    if ((m_Desc.MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) != 0)
+                    {
+                        // Place the buffer in device-local host-visible memory so that
+                        // updates can be written directly by the CPU
+                        MemoryTypeIndex = pRenderDeviceVk->GetGlobalMemoryManager().GetDirectWriteMemoryTypeIndex(MemReqs.memoryTypeBits);
+                        if (MemoryTypeIndex != InvalidMemoryTypeIndex)
+                            vkMemoryFlags |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+                        else
+                            m_Desc.MiscFlags &= ~MISC_BUFFER_FLAG_DIRECT_UPDATES;
+                    }
+                    break;
+
+                case USAGE_IMMUTABLE:
                 case USAGE_DYNAMIC: // Dynamic buffer with SRV or UAV bind flag
                     vkMemoryFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
                     break;
@@ -316,7 +353,10 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         VERIFY(IsPowerOfTwo(RequiredAlignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        // Dedicated allocation size must match the buffer memory requirements, so it can't be used
+        // when the size is aligned to the non-coherent atom size.
+        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags,
+                                                             AlignToNonCoherentAtomSize ? nullptr : &DedicatedInfo);
         if (!m_MemoryAllocation)
             LOG_ERROR_AND_THROW("Failed to allocate memory for buffer '", m_Desc.Name, "'.");
 
@@ -326,6 +366,9 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         auto err    = LogicalDevice.BindBufferMemory(m_VulkanBuffer, Memory, m_BufferMemoryAlignedOffset);
         CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
 #ifdef DILIGENT_DEBUG
@@ -568,22 +611,14 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
-    constexpr auto DeviceAddressFlags = BIND_RAY_TRACING;
-
-    if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
+    if (m_VkDeviceAddress != 0)
     {
-#if DILIGENT_USE_VOLK
-        VkBufferDeviceAddressInfoKHR BufferInfo = {};
-
-        BufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
-        BufferInfo.buffer      = m_VulkanBuffer;
-        VkDeviceAddress Result = vkGetBufferDeviceAddressKHR(m_pDevice->GetLogicalDevice().GetVkDevice(), &BufferInfo);
-        VERIFY_EXPR(Result > 0);
-        return Result;
-#else
-        UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
-        return VkDeviceAddress{};
-#endif
+        return m_VkDeviceAddress;
+    }
+    else if (m_VulkanBuffer == VK_NULL_HANDLE && m_Desc.Usage == USAGE_DYNAMIC && m_pDevice->UseDescriptorBuffers())
+    {
+        // Dynamic buffers without a backing buffer are suballocated in the dynamic heap
+        return m_pDevice->GetDynamicMemoryManager().GetVkDeviceAddress();
     }
     else
     {
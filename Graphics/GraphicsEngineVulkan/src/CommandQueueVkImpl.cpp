@@ -31,6 +31,7 @@
 #include "CommandQueueVkImpl.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "VulkanUtilities/VulkanDebug.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -61,6 +62,9 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
         VulkanUtilities::SetQueueName(m_LogicalDevice->GetVkDevice(), m_VkQueue, CreateInfo.Name);
 
     m_TempSignalSemaphores.reserve(16);
+    m_TempSignalSemaphoreValues.reserve(16);
+    m_PendingCmdBuffers.reserve(MaxPendingCmdBuffers);
+    m_PendingFenceValues.reserve(MaxPendingCmdBuffers);
 }
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
@@ -70,6 +74,8 @@ CommandQueueVkImpl::~CommandQueueVkImpl()
     if (m_pFence)
         m_pFence->ImmediatelyReleaseResources();
 
+    VERIFY(m_PendingCmdBuffers.empty(), "There are command buffers that have not been submitted to the queue. WaitForIdle() must be called before the queue is destroyed.");
+
     m_pFence.Release();
     m_LastSyncPoint.reset();
 
@@ -149,56 +155,136 @@ __forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue
 
 Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    return InternalSubmit(&InSubmitInfo);
+}
 
-    // Increment the value before submitting the buffer to be overly safe
-    const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
+Uint64 CommandQueueVkImpl::InternalSubmit(const VkSubmitInfo* pInSubmitInfo)
+{
+    VERIFY_EXPR(pInSubmitInfo != nullptr || !m_PendingCmdBuffers.empty());
+    VERIFY_EXPR(m_PendingCmdBuffers.size() == m_PendingFenceValues.size());
+    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
 
-    auto NewSyncPoint = CreateSyncPoint(FenceValue);
+    // Increment the value before submitting the buffer to be overly safe.
+    // When only pending command buffers are submitted, the fence value of the last one is signaled.
+    const uint64_t FenceValue = pInSubmitInfo != nullptr ? m_NextFenceValue.fetch_add(1) : m_PendingFenceValues.back();
 
+    // With the timeline semaphore, the fence value is signaled directly and no sync point is needed
+    SyncPointVkPtr NewSyncPoint;
     m_TempSignalSemaphores.clear();
-    NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+    if (m_vkFenceSemaphore == VK_NULL_HANDLE)
+    {
+        NewSyncPoint = CreateSyncPoint(FenceValue);
+        NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+    }
 
-#ifdef DILIGENT_DEBUG
-    const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(InSubmitInfo.pNext);
-    for (; pStruct != nullptr;)
+    VkSubmitInfo SubmitInfo{};
+    SubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    if (pInSubmitInfo != nullptr)
     {
-        if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+#ifdef DILIGENT_DEBUG
+        const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(pInSubmitInfo->pNext);
+        for (; pStruct != nullptr;)
         {
-            VERIFY(m_TempSignalSemaphores.empty(), "Can not append semaphores when timeline semaphores are used");
-            break;
+            if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            {
+                VERIFY(m_TempSignalSemaphores.empty(), "Can not append semaphores when timeline semaphores are used");
+                break;
+            }
+            pStruct = pStruct->pNext;
         }
-        pStruct = pStruct->pNext;
-    }
 #endif
 
-    for (uint32_t s = 0; s < InSubmitInfo.signalSemaphoreCount; ++s)
-        m_TempSignalSemaphores.push_back(InSubmitInfo.pSignalSemaphores[s]);
+        for (uint32_t s = 0; s < pInSubmitInfo->signalSemaphoreCount; ++s)
+            m_TempSignalSemaphores.push_back(pInSubmitInfo->pSignalSemaphores[s]);
 
-    VkSubmitInfo SubmitInfo         = InSubmitInfo;
+        SubmitInfo = *pInSubmitInfo;
+    }
     SubmitInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
     SubmitInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
 
-    const uint32_t SubmitCount =
-        (SubmitInfo.waitSemaphoreCount != 0 ||
-         SubmitInfo.commandBufferCount != 0 ||
-         SubmitInfo.signalSemaphoreCount != 0) ?
-        1 :
-        0;
+    // Pending command buffers go first to preserve the submission order.
+    // Semaphores are signaled by the last batch and, according to the
+    // semaphore signal operation rules, cover all previous batches as well.
+    VkSubmitInfo SubmitInfos[3]{};
+    uint32_t     SubmitCount = 0;
+    if (!m_PendingCmdBuffers.empty())
+    {
+        auto& PendingInfo              = SubmitInfos[SubmitCount++];
+        PendingInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        PendingInfo.commandBufferCount = static_cast<uint32_t>(m_PendingCmdBuffers.size());
+        PendingInfo.pCommandBuffers    = m_PendingCmdBuffers.data();
+    }
+    if (SubmitInfo.waitSemaphoreCount != 0 ||
+        SubmitInfo.commandBufferCount != 0 ||
+        SubmitInfo.signalSemaphoreCount != 0)
+    {
+        SubmitInfos[SubmitCount++] = SubmitInfo;
+    }
+
+    VkTimelineSemaphoreSubmitInfo FenceSignalInfo{};
+    if (m_vkFenceSemaphore != VK_NULL_HANDLE)
+    {
+        // Signal the fence value in a separate batch, so that the timeline info of the
+        // submitted batch does not need to be merged. The value is reached when all
+        // previous batches have completed, including those of pending command buffers.
+        FenceSignalInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        FenceSignalInfo.signalSemaphoreValueCount = 1;
+        FenceSignalInfo.pSignalSemaphoreValues    = &FenceValue;
+
+        auto& SignalInfo                = SubmitInfos[SubmitCount++];
+        SignalInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        SignalInfo.pNext                = &FenceSignalInfo;
+        SignalInfo.signalSemaphoreCount = 1;
+        SignalInfo.pSignalSemaphores    = &m_vkFenceSemaphore;
+    }
 
-    auto err = vkQueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->GetFence());
+    auto err = vkQueueSubmit(m_VkQueue, SubmitCount, SubmitInfos, NewSyncPoint ? NewSyncPoint->GetFence() : VK_NULL_HANDLE);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
-    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
-
-    // Update the last sync point
+    if (NewSyncPoint)
     {
-        Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
-        m_LastSyncPoint = std::move(NewSyncPoint);
+        // All pending command buffers share the fence of the new sync point
+        for (auto PendingValue : m_PendingFenceValues)
+            m_pFence->AddPendingSyncPoint(m_CommandQueueId, PendingValue, NewSyncPoint);
+        if (pInSubmitInfo != nullptr)
+            m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+
+        // Update the last sync point
+        {
+            Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
+            m_LastSyncPoint = std::move(NewSyncPoint);
+        }
     }
 
+    m_PendingCmdBuffers.clear();
+    m_PendingFenceValues.clear();
+
+    return FenceValue;
+}
+
+void CommandQueueVkImpl::FlushPendingCmdBuffers()
+{
+    if (!m_PendingCmdBuffers.empty())
+        InternalSubmit(nullptr);
+}
+
+Uint64 CommandQueueVkImpl::EnqueueCmdBuffer(VkCommandBuffer vkCmdBuffer)
+{
+    VERIFY_EXPR(vkCmdBuffer != VK_NULL_HANDLE);
+
+    std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+
+    const Uint64 FenceValue = m_NextFenceValue.fetch_add(1);
+    m_PendingCmdBuffers.push_back(vkCmdBuffer);
+    m_PendingFenceValues.push_back(FenceValue);
+
+    if (m_PendingCmdBuffers.size() >= MaxPendingCmdBuffers)
+        InternalSubmit(nullptr);
+
     return FenceValue;
 }
 
@@ -225,12 +311,17 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
+    FlushPendingCmdBuffers();
+
     // Update last completed fence value to unlock all waiting events.
     const auto FenceValue = m_NextFenceValue.fetch_add(1);
 
     vkQueueWaitIdle(m_VkQueue);
-    // For some reason after idling the queue not all fences are signaled
-    m_pFence->Wait(UINT64_MAX);
+    if (m_vkFenceSemaphore == VK_NULL_HANDLE)
+    {
+        // For some reason after idling the queue not all fences are signaled
+        m_pFence->Wait(UINT64_MAX);
+    }
     m_pFence->Reset(FenceValue);
 
     return FenceValue;
@@ -247,6 +338,8 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
+    FlushPendingCmdBuffers();
+
     auto err = vkQueueSubmit(m_VkQueue, 0, nullptr, vkFence);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit fence signal command to the command queue");
     (void)err;
@@ -255,6 +348,7 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 void CommandQueueVkImpl::EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    FlushPendingCmdBuffers();
     InternalSignalSemaphore(vkTimelineSemaphore, Value);
 }
 
@@ -287,6 +381,7 @@ void CommandQueueVkImpl::InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore
 VkResult CommandQueueVkImpl::Present(const VkPresentInfoKHR& PresentInfo)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    FlushPendingCmdBuffers();
     return vkQueuePresentKHR(m_VkQueue, &PresentInfo);
 }
 
@@ -294,13 +389,18 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
+    FlushPendingCmdBuffers();
+
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
-    auto NewSyncPoint = CreateSyncPoint(FenceValue);
-
+    SyncPointVkPtr NewSyncPoint;
     m_TempSignalSemaphores.clear();
-    NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+    if (m_vkFenceSemaphore == VK_NULL_HANDLE)
+    {
+        NewSyncPoint = CreateSyncPoint(FenceValue);
+        NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+    }
 
 #ifdef DILIGENT_DEBUG
     const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(InBindInfo.pNext);
@@ -309,6 +409,7 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
         if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
         {
             VERIFY(m_TempSignalSemaphores.empty(), "Can not append semaphores when timeline semaphores are used");
+            VERIFY(pStruct == InBindInfo.pNext, "Timeline semaphore submit info must be the first structure in the pNext chain");
             break;
         }
         pStruct = pStruct->pNext;
@@ -318,21 +419,55 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
     for (uint32_t s = 0; s < InBindInfo.signalSemaphoreCount; ++s)
         m_TempSignalSemaphores.push_back(InBindInfo.pSignalSemaphores[s]);
 
-    VkBindSparseInfo BindInfo     = InBindInfo;
+    VkBindSparseInfo BindInfo = InBindInfo;
+
+    // Sparse binding operations are not ordered with respect to other batches,
+    // so the fence value must be signaled by the same batch.
+    VkTimelineSemaphoreSubmitInfo TimelineInfo{};
+    if (m_vkFenceSemaphore != VK_NULL_HANDLE)
+    {
+        const auto* pInTimelineInfo = static_cast<const VkTimelineSemaphoreSubmitInfo*>(InBindInfo.pNext);
+        if (pInTimelineInfo != nullptr && pInTimelineInfo->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+        {
+            TimelineInfo = *pInTimelineInfo;
+        }
+        else
+        {
+            TimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            TimelineInfo.pNext = InBindInfo.pNext;
+        }
+
+        // Values for binary semaphores are ignored
+        m_TempSignalSemaphoreValues.clear();
+        if (TimelineInfo.signalSemaphoreValueCount != 0)
+            m_TempSignalSemaphoreValues.assign(TimelineInfo.pSignalSemaphoreValues, TimelineInfo.pSignalSemaphoreValues + TimelineInfo.signalSemaphoreValueCount);
+        m_TempSignalSemaphoreValues.resize(InBindInfo.signalSemaphoreCount, 0);
+
+        m_TempSignalSemaphores.push_back(m_vkFenceSemaphore);
+        m_TempSignalSemaphoreValues.push_back(FenceValue);
+
+        TimelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(m_TempSignalSemaphoreValues.size());
+        TimelineInfo.pSignalSemaphoreValues    = m_TempSignalSemaphoreValues.data();
+        BindInfo.pNext                         = &TimelineInfo;
+    }
+
     BindInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
     BindInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
 
-    auto err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint->GetFence());
+    auto err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint ? NewSyncPoint->GetFence() : VK_NULL_HANDLE);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
     (void)err;
 
-    VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
-    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
-
-    // Update the last sync point
+    if (NewSyncPoint)
     {
-        Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
-        m_LastSyncPoint = std::move(NewSyncPoint);
+        VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
+        m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+
+        // Update the last sync point
+        {
+            Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
+            m_LastSyncPoint = std::move(NewSyncPoint);
+        }
     }
 
     return FenceValue;
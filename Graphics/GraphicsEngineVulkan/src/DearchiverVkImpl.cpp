@@ -35,7 +35,7 @@ namespace Diligent
 
 DearchiverVkImpl::DearchiverVkImpl(IReferenceCounters*         pRefCounters,
                                    const DearchiverCreateInfo& CI) noexcept :
-    TDearchiverBase{pRefCounters, CI}
+    TDearchiverBase{pRefCounters, CI, DeviceType::Vulkan}
 {
 }
 
@@ -161,6 +161,12 @@ void DescriptorPoolManager::DisposePool(VulkanUtilities::DescriptorPoolWrapper&&
     m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorPoolDeleter{*this, std::move(Pool)}, QueueMask);
 }
 
+Uint32 DescriptorPoolManager::GetPoolCapacity()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return static_cast<Uint32>(m_Pools.size()) * m_MaxSets;
+}
+
 void DescriptorPoolManager::FreePool(VulkanUtilities::DescriptorPoolWrapper&& Pool)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
@@ -215,9 +221,7 @@ DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask
                 std::swap(*it, m_Pools.front());
             }
 
-#ifdef DILIGENT_DEVELOPMENT
             ++m_AllocatedSetCounter;
-#endif
             return {Set, Pool, CommandQueueMask, *this};
         }
     }
@@ -230,9 +234,7 @@ DescriptorSetAllocation DescriptorSetAllocator::Allocate(Uint64 CommandQueueMask
     auto  Set     = AllocateDescriptorSet(LogicalDevice, NewPool, SetLayout, DebugName);
     DEV_CHECK_ERR(Set != VK_NULL_HANDLE, "Failed to allocate descriptor set");
 
-#ifdef DILIGENT_DEVELOPMENT
     ++m_AllocatedSetCounter;
-#endif
 
     return {Set, NewPool, CommandQueueMask, *this};
 }
@@ -272,9 +274,7 @@ void DescriptorSetAllocator::FreeDescriptorSet(VkDescriptorSet Set, VkDescriptor
             {
                 std::lock_guard<std::mutex> Lock{Allocator->m_Mutex};
                 Allocator->m_DeviceVkImpl.GetLogicalDevice().FreeDescriptorSet(Pool, Set);
-#ifdef DILIGENT_DEVELOPMENT
                 --Allocator->m_AllocatedSetCounter;
-#endif
             }
         }
 
@@ -46,6 +46,8 @@
 #include "GenerateMipsVkHelper.hpp"
 #include "QueryManagerVk.hpp"
 #include "CommandQueueVkImpl.hpp"
+#include "SmallVector.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -101,28 +103,20 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*       pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetUseSynchronization2(pDeviceVkImpl->GetLogicalDevice().GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE);
+    DILIGENT_UPDATE_CONTEXT_STATS(m_CommandBuffer.SetBarrierCounter(&m_Stats.BarrierCounters.BarrierBatches));
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
         m_pQueryMgr = &pDeviceVkImpl->GetQueryMgr(GetCommandQueueId());
         EnsureVkCmdBuffer();
-        m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer);
+        m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer, m_pDevice->GetCompletedFenceValue(GetCommandQueueId()));
     }
 
-    BufferDesc DummyVBDesc;
-    DummyVBDesc.Name      = "Dummy vertex buffer";
-    DummyVBDesc.BindFlags = BIND_VERTEX_BUFFER;
-    DummyVBDesc.Usage     = USAGE_DEFAULT;
-    DummyVBDesc.Size      = 32;
-    RefCntAutoPtr<IBuffer> pDummyVB;
-    m_pDevice->CreateBuffer(DummyVBDesc, nullptr, &pDummyVB);
-    m_DummyVB = pDummyVB.RawPtr<BufferVkImpl>();
-
     m_vkClearValues.reserve(16);
 
     m_DynamicBufferOffsets.reserve(64);
-
-    CreateASCompactedSizeQueryPool();
 }
 
 DeviceContextVkImpl::~DeviceContextVkImpl()
@@ -212,57 +206,78 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+namespace
 {
-    VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-    VERIFY_EXPR(m_CmdPool != nullptr);
-    class CmdBufferRecycler
-    {
-    public:
-        // clang-format off
-        CmdBufferRecycler(VkCommandBuffer                           _vkCmdBuff,
-                         VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
-            vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
-        {
-            VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
-        }
 
-        CmdBufferRecycler             (const CmdBufferRecycler&)  = delete;
-        CmdBufferRecycler& operator = (const CmdBufferRecycler&)  = delete;
-        CmdBufferRecycler& operator = (      CmdBufferRecycler&&) = delete;
+// Returns the command buffer to the pool when the release queue discards it
+class CmdBufferRecycler
+{
+public:
+    // clang-format off
+    CmdBufferRecycler(VkCommandBuffer                           _vkCmdBuff,
+                      VulkanUtilities::VulkanCommandBufferPool& _Pool,
+                      bool                                      _IsSecondary) noexcept :
+        vkCmdBuff   {_vkCmdBuff  },
+        Pool        {&_Pool      },
+        IsSecondary {_IsSecondary}
+    {
+        VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
+    }
 
-        CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
-            vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
-        {
-            rhs.vkCmdBuff = VK_NULL_HANDLE;
-            rhs.Pool      = nullptr;
-        }
-        // clang-format on
+    CmdBufferRecycler             (const CmdBufferRecycler&)  = delete;
+    CmdBufferRecycler& operator = (const CmdBufferRecycler&)  = delete;
+    CmdBufferRecycler& operator = (      CmdBufferRecycler&&) = delete;
+
+    CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
+        vkCmdBuff   {rhs.vkCmdBuff  },
+        Pool        {rhs.Pool       },
+        IsSecondary {rhs.IsSecondary}
+    {
+        rhs.vkCmdBuff = VK_NULL_HANDLE;
+        rhs.Pool      = nullptr;
+    }
+    // clang-format on
 
-        ~CmdBufferRecycler()
+    ~CmdBufferRecycler()
+    {
+        if (Pool != nullptr)
         {
-            if (Pool != nullptr)
-            {
-                Pool->RecycleCommandBuffer(std::move(vkCmdBuff));
-            }
+            Pool->RecycleCommandBuffer(std::move(vkCmdBuff), IsSecondary);
         }
+    }
 
-    private:
-        VkCommandBuffer                           vkCmdBuff = VK_NULL_HANDLE;
-        VulkanUtilities::VulkanCommandBufferPool* Pool      = nullptr;
-    };
+private:
+    VkCommandBuffer                           vkCmdBuff   = VK_NULL_HANDLE;
+    VulkanUtilities::VulkanCommandBufferPool* Pool        = nullptr;
+    bool                                      IsSecondary = false;
+};
+
+} // namespace
+
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, bool IsSecondary)
+{
+    VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
+    VERIFY_EXPR(m_CmdPool != nullptr);
 
     // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool, IsSecondary}, FenceValue);
+}
+
+void DeviceContextVkImpl::DisposeReusableVkCmdBuffer(VkCommandBuffer vkCmdBuff, VulkanUtilities::VulkanCommandBufferPool& Pool, Uint64 QueueMask)
+{
+    CmdBufferRecycler Recycler{vkCmdBuff, Pool, /*IsSecondary = */ true};
+    // A command buffer that has never been executed is returned to the pool immediately.
+    // Otherwise, it may still be referenced by primary command buffers that have not been
+    // submitted yet or are being executed, so it goes through the stale objects queues.
+    if (QueueMask != 0)
+        m_pDevice->SafeReleaseDeviceObject(std::move(Recycler), QueueMask);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
 {
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Disposing command buffer with unfinished render pass");
+    VERIFY(!m_CommandBuffer.GetState().IsInsideRenderPass(), "Disposing command buffer with unfinished render pass");
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
@@ -301,10 +316,17 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         // We also need to update scissor rect if ScissorEnable state was disabled in previous pipeline
         if (OldPSODesc.IsAnyGraphicsPipeline())
             CommitScissor = !m_pPipelineState->GetGraphicsPipelineDesc().RasterizerDesc.ScissorEnable;
+        // Shader objects set viewports and scissor rects together with their counts, which is a
+        // different state than the one used by pipelines, so all states are committed when switching.
+        if (pPipelineStateVk && pPipelineStateVk->UsesShaderObjects() != m_pPipelineState->UsesShaderObjects())
+        {
+            CommitStates  = true;
+            CommitScissor = true;
+        }
     }
 
     TDeviceContextBase::SetPipelineState(std::move(pPipelineStateVk), 0 /*Dummy*/);
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
 
     auto vkPipeline = m_pPipelineState->GetVkPipeline();
 
@@ -315,15 +337,36 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         case PIPELINE_TYPE_MESH:
         {
             auto& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
-            m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
+            if (m_pPipelineState->UsesShaderObjects())
+            {
+                const auto& ShaderObjects = m_pPipelineState->GetShaderObjectData();
+                m_CommandBuffer.BindShaders(static_cast<uint32_t>(ShaderObjects.Stages.size()), ShaderObjects.Stages.data(), ShaderObjects.Shaders.data());
+                CommitShaderObjectStates();
+            }
+            else
+            {
+                m_CommandBuffer.BindGraphicsPipeline(vkPipeline);
+            }
 
             if (CommitStates)
             {
                 m_CommandBuffer.SetStencilReference(m_StencilRef);
                 m_CommandBuffer.SetBlendConstants(m_BlendFactors);
+            }
+            // Shader objects have no static scissor state, so the viewports are always committed
+            // to set the scissor rects that cover them when the scissor test is disabled.
+            if (CommitStates || m_pPipelineState->UsesShaderObjects())
+            {
                 CommitViewports();
             }
 
+            // Dynamic states become undefined when a pipeline that does not use them is bound,
+            // so they are always committed when a pipeline with dynamic states is set.
+            if (GraphicsPipeline.DynamicStateFlags != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+            {
+                CommitDynamicRenderState();
+            }
+
             if (GraphicsPipeline.RasterizerDesc.ScissorEnable && (CommitStates || CommitScissor))
             {
                 CommitScissorRects();
@@ -421,15 +464,65 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const auto FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const auto LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
 
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
     // Bind all descriptor sets in a single BindDescriptorSets call
-    uint32_t   DynamicOffsetCount = 0;
-    uint32_t   TotalSetCount      = 0;
-    const auto FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
-    for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
+    uint32_t DynamicOffsetCount = 0;
+    uint32_t TotalSetCount      = 0;
+    uint32_t FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+
+    Uint32 sign = FirstSign;
+    if (sign == 0 && m_pPipelineState->GetResourceSignature(0)->UsesPushDescriptors())
+    {
+        // Only the signature at binding index 0 may use push descriptors. Its static/mutable set (if any)
+        // is bound as usual, while its dynamic set is pushed directly into the command buffer.
+        const auto* pSignature     = m_pPipelineState->GetResourceSignature(0);
+        const auto* pResourceCache = BindInfo.ResourceCaches[0];
+        auto&       SetInfo        = BindInfo.SetInfo[0];
+        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index 0 is null");
+        VERIFY_EXPR(SetInfo.BaseInd == 0);
+
+        const bool HasStaticSet = pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE);
+        if (HasStaticSet)
+        {
+            VERIFY_EXPR(SetInfo.vkSets[0] != VK_NULL_HANDLE);
+            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
+            if (SetInfo.DynamicOffsetCount > 0)
+            {
+                // Offsets of the dynamic buffers in the push descriptor set are baked into the descriptors
+                auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, DynamicOffsetCount, 1);
+                VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
+                DynamicOffsetCount += SetInfo.DynamicOffsetCount;
+            }
+            // Bind the static set before pushing the descriptors to make sure the push set is not disturbed
+            m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                               m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+        }
+
+        pSignature->PushDynamicResources(*pResourceCache, GetContextId(), m_CommandBuffer, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout,
+                                         HasStaticSet ? 1 : 0, BindInfo.PushDescriptors);
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+
+        // Remaining sets are bound starting after the push set
+        DynamicOffsetCount = 0;
+        TotalSetCount      = 0;
+        FirstSetToBind     = pSignature->GetNumDescriptorSets();
+        ++sign;
+    }
+
+    for (; sign <= LastSign; ++sign)
     {
         auto& SetInfo = BindInfo.SetInfo[sign];
         VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || (CommitSRBMask & (1u << sign)) == 0,
@@ -458,7 +551,7 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
             VERIFY(m_DynamicBufferOffsets.size() >= size_t{DynamicOffsetCount} + size_t{SetInfo.DynamicOffsetCount},
                    "m_DynamicBufferOffsets must've been resized by SetPipelineState() to have enough space");
 
-            auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, DynamicOffsetCount);
+            auto NumOffsetsWritten = pResourceCache->GetDynamicBufferOffsets(GetContextId(), m_DynamicBufferOffsets, DynamicOffsetCount, pResourceCache->GetNumDescriptorSets());
             VERIFY_EXPR(NumOffsetsWritten == SetInfo.DynamicOffsetCount);
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
         }
@@ -476,9 +569,61 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
     // applied via these sets are no longer valid.
     // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
+    if (TotalSetCount > 0)
+    {
+        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                           m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    const auto FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
+    const auto LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
+    VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
+
+    // Descriptors of all sets are written to the dynamic heap, which is the only descriptor buffer
+    // bound to the command buffer. Since the heap buffer can never change, it only needs to be bound once.
+    auto&        DynamicMemMgr   = m_pDevice->GetDynamicMemoryManager();
+    const Uint32 OffsetAlignment = static_cast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+    m_CommandBuffer.BindDescriptorBuffer(DynamicMemMgr.GetVkDeviceAddress(), VulkanDynamicMemoryManager::DescriptorBufferUsage);
+
     VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-    m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
-                                       m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
+    {
+        const auto* pResourceCache = BindInfo.ResourceCaches[sign];
+        if ((BindInfo.ActiveSRBMask & (1u << sign)) == 0 || pResourceCache == nullptr || pResourceCache->GetNumDescriptorSets() == 0)
+        {
+            VERIFY((CommitSRBMask & (1u << sign)) == 0, "Empty SRBs should not be marked as stale by CommitShaderResources()");
+            continue;
+        }
+
+        const auto* pSignature = m_pPipelineState->GetResourceSignature(sign);
+        auto&       SetInfo    = BindInfo.SetInfo[sign];
+        const auto  NumSets    = pResourceCache->GetNumDescriptorSets();
+        VERIFY_EXPR(pSignature != nullptr && pSignature->GetNumDescriptorSets() == NumSets);
+
+        // All descriptor sets use the same descriptor buffer with index 0
+        std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE>     BufferIndices = {};
+        std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> Offsets       = {};
+        for (Uint32 s = 0; s < NumSets; ++s)
+        {
+            // Static and mutable descriptors are written along with the dynamic ones as the descriptor
+            // memory is suballocated in the dynamic heap and is only valid until the end of the frame.
+            auto DynAlloc = AllocateDynamicSpace(pSignature->GetDescriptorBufferSetSize(s), OffsetAlignment);
+            pSignature->WriteDescriptorBufferSet(*pResourceCache, s, GetContextId(), DynamicMemMgr.GetCPUAddress() + DynAlloc.AlignedOffset);
+            Offsets[s] = DynAlloc.AlignedOffset;
+        }
+
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), Offsets.data());
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
@@ -504,7 +649,8 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
         const auto  DSCount = pSign->GetNumDescriptorSets();
         for (Uint32 s = 0; s < DSCount; ++s)
         {
-            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
+            const bool IsPushSet = pSign->UsesPushDescriptors() && s == DSCount - 1;
+            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE || m_pDevice->UseDescriptorBuffers() || IsPushSet,
                           "descriptor set with index ", s, " is not bound for resource signature '",
                           pSign->GetDesc().Name, "', binding index ", i, ".");
         }
@@ -534,6 +680,9 @@ void DeviceContextVkImpl::TransitionShaderResources(IShaderResourceBinding* pSha
 
 void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Commit);
+    DILIGENT_PROFILE_FUNCTION();
+
     TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     auto* pResBindingVkImpl = ClassPtrCast<ShaderResourceBindingVkImpl>(pShaderResourceBinding);
@@ -569,6 +718,14 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     // are set by SetPipelineState().
     SetInfo.vkSets = {};
 
+    // With descriptor buffers, descriptors are written when the resources are committed
+    // to the command buffer by CommitDescriptorBuffers().
+    if (m_pDevice->UseDescriptorBuffers())
+        return;
+
+    // With push descriptors, dynamic resources are pushed by CommitDescriptorSets().
+    const bool UsePushDescriptors = pSignature->UsesPushDescriptors();
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -583,6 +740,13 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     {
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
+        if (UsePushDescriptors)
+        {
+            // Leave the set null: there is no descriptor set object to allocate
+            ++DSIndex;
+            VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+            return;
+        }
 
         const auto vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
 
@@ -612,7 +776,7 @@ void DeviceContextVkImpl::SetStencilRef(Uint32 StencilRef)
 {
     if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
     {
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*FlushClears = */ false);
         m_CommandBuffer.SetStencilReference(m_StencilRef);
     }
 }
@@ -621,11 +785,169 @@ void DeviceContextVkImpl::SetBlendFactors(const float* pBlendFactors)
 {
     if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
     {
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*FlushClears = */ false);
         m_CommandBuffer.SetBlendConstants(m_BlendFactors);
     }
 }
 
+void DeviceContextVkImpl::SetDynamicRenderState(const DynamicRenderState& State)
+{
+    if (TDeviceContextBase::SetDynamicRenderState(State, 0))
+    {
+        // If no pipeline with dynamic states is currently bound, the state will be
+        // committed by SetPipelineState() when such pipeline is set.
+        if (m_pPipelineState &&
+            m_pPipelineState->GetDesc().IsAnyGraphicsPipeline() &&
+            m_pPipelineState->GetGraphicsPipelineDesc().DynamicStateFlags != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+        {
+            EnsureVkCmdBuffer(/*FlushClears = */ false);
+            CommitDynamicRenderState();
+        }
+    }
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+// Returns the topology class (21.1.2). Unless dynamicPrimitiveTopologyUnrestricted is supported,
+// the dynamic topology must be of the same class as the pipeline topology.
+static Uint32 GetVkPrimitiveTopologyClass(VkPrimitiveTopology Topology)
+{
+    switch (Topology)
+    {
+        case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+            return 0;
+
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return 1;
+
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_WITH_ADJACENCY:
+            return 2;
+
+        case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+            return 3;
+
+        default:
+            UNEXPECTED("Unexpected primitive topology");
+            return ~0u;
+    }
+}
+#endif
+
+void DeviceContextVkImpl::CommitDynamicRenderState()
+{
+    VERIFY_EXPR(m_pPipelineState && m_pPipelineState->GetDesc().IsAnyGraphicsPipeline());
+
+    const auto& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
+    const auto  Flags            = GraphicsPipeline.DynamicStateFlags;
+
+    if (Flags & PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE)
+        m_CommandBuffer.SetCullMode(CullModeToVkCullMode(m_DynamicRenderState.CullMode));
+
+    if (Flags & PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE)
+        m_CommandBuffer.SetFrontFace(m_DynamicRenderState.FrontCounterClockwise ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+
+    if (Flags & PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY)
+    {
+        VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        uint32_t            PatchControlPoints = 0;
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(m_DynamicRenderState.PrimitiveTopology, vkTopology, PatchControlPoints);
+#ifdef DILIGENT_DEVELOPMENT
+        {
+            VkPrimitiveTopology vkPSOTopology         = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            uint32_t            PSOPatchControlPoints = 0;
+            PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(GraphicsPipeline.PrimitiveTopology, vkPSOTopology, PSOPatchControlPoints);
+            DEV_CHECK_ERR(GetVkPrimitiveTopologyClass(vkTopology) == GetVkPrimitiveTopologyClass(vkPSOTopology) && PatchControlPoints == PSOPatchControlPoints,
+                          "Dynamic primitive topology (", Uint32{m_DynamicRenderState.PrimitiveTopology},
+                          ") is not compatible with the topology (", Uint32{GraphicsPipeline.PrimitiveTopology},
+                          ") of pipeline '", m_pPipelineState->GetDesc().Name, "'. The topologies must be of the same type.");
+        }
+#endif
+        m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+    }
+
+    if (Flags & (PIPELINE_DYNAMIC_STATE_FLAG_DEPTH | PIPELINE_DYNAMIC_STATE_FLAG_STENCIL))
+    {
+        const VkPipelineDepthStencilStateCreateInfo DSStateCI = DepthStencilStateDesc_To_VkDepthStencilStateCI(m_DynamicRenderState.DepthStencilDesc);
+        if (Flags & PIPELINE_DYNAMIC_STATE_FLAG_DEPTH)
+        {
+            m_CommandBuffer.SetDepthTestEnable(DSStateCI.depthTestEnable);
+            m_CommandBuffer.SetDepthWriteEnable(DSStateCI.depthWriteEnable);
+            m_CommandBuffer.SetDepthCompareOp(DSStateCI.depthCompareOp);
+        }
+        if (Flags & PIPELINE_DYNAMIC_STATE_FLAG_STENCIL)
+        {
+            m_CommandBuffer.SetStencilTestEnable(DSStateCI.stencilTestEnable);
+            m_CommandBuffer.SetStencilOp(VK_STENCIL_FACE_FRONT_BIT, DSStateCI.front);
+            m_CommandBuffer.SetStencilOp(VK_STENCIL_FACE_BACK_BIT, DSStateCI.back);
+            m_CommandBuffer.SetStencilCompareMask(DSStateCI.front.compareMask);
+            m_CommandBuffer.SetStencilWriteMask(DSStateCI.front.writeMask);
+        }
+    }
+}
+
+void DeviceContextVkImpl::CommitShaderObjectStates()
+{
+    VERIFY_EXPR(m_pPipelineState && m_pPipelineState->UsesShaderObjects());
+
+    const auto& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
+    const auto& ShaderObjects    = m_pPipelineState->GetShaderObjectData();
+    const auto& Features         = m_pDevice->GetFeatures();
+
+    // Shader objects have no fixed-function state, so all states that a graphics pipeline
+    // would have compiled are set dynamically. States that are controlled by
+    // DynamicStateFlags are then overridden by CommitDynamicRenderState().
+    const auto& RSState = ShaderObjects.RasterizerState;
+    m_CommandBuffer.SetRasterizerDiscardEnable(RSState.rasterizerDiscardEnable);
+    m_CommandBuffer.SetPolygonMode(RSState.polygonMode);
+    m_CommandBuffer.SetCullMode(RSState.cullMode);
+    m_CommandBuffer.SetFrontFace(RSState.frontFace);
+    m_CommandBuffer.SetDepthBiasEnable(RSState.depthBiasEnable);
+    m_CommandBuffer.SetDepthBias(RSState.depthBiasConstantFactor, RSState.depthBiasClamp, RSState.depthBiasSlopeFactor);
+    m_CommandBuffer.SetLineWidth(RSState.lineWidth);
+    if (Features.DepthClamp)
+        m_CommandBuffer.SetDepthClampEnable(RSState.depthClampEnable);
+
+    const auto     Samples       = static_cast<VkSampleCountFlagBits>(GraphicsPipeline.SmplDesc.Count);
+    const uint32_t SampleMask[2] = {GraphicsPipeline.SampleMask, 0}; // Vulkan spec allows up to 64 samples
+    m_CommandBuffer.SetRasterizationSamples(Samples);
+    m_CommandBuffer.SetSampleMask(Samples, SampleMask);
+    m_CommandBuffer.SetAlphaToCoverageEnable(GraphicsPipeline.BlendDesc.AlphaToCoverageEnable ? VK_TRUE : VK_FALSE);
+
+    const auto& DSState = ShaderObjects.DepthStencilState;
+    m_CommandBuffer.SetDepthTestEnable(DSState.depthTestEnable);
+    m_CommandBuffer.SetDepthWriteEnable(DSState.depthWriteEnable);
+    m_CommandBuffer.SetDepthCompareOp(DSState.depthCompareOp);
+    m_CommandBuffer.SetDepthBoundsTestEnable(DSState.depthBoundsTestEnable);
+    m_CommandBuffer.SetStencilTestEnable(DSState.stencilTestEnable);
+    m_CommandBuffer.SetStencilOp(VK_STENCIL_FACE_FRONT_BIT, DSState.front);
+    m_CommandBuffer.SetStencilOp(VK_STENCIL_FACE_BACK_BIT, DSState.back);
+    m_CommandBuffer.SetStencilCompareMask(DSState.front.compareMask);
+    m_CommandBuffer.SetStencilWriteMask(DSState.front.writeMask);
+
+    if (m_pPipelineState->GetDesc().PipelineType != PIPELINE_TYPE_MESH)
+    {
+        m_CommandBuffer.SetVertexInput(static_cast<uint32_t>(ShaderObjects.VertexBindings.size()), ShaderObjects.VertexBindings.data(),
+                                       static_cast<uint32_t>(ShaderObjects.VertexAttributes.size()), ShaderObjects.VertexAttributes.data());
+        m_CommandBuffer.SetPrimitiveTopology(ShaderObjects.Topology);
+        m_CommandBuffer.SetPrimitiveRestartEnable(ShaderObjects.PrimitiveRestartEnable);
+        if (Features.Tessellation && ShaderObjects.PatchControlPoints != 0)
+            m_CommandBuffer.SetPatchControlPoints(ShaderObjects.PatchControlPoints);
+    }
+
+    if (const auto NumAttachments = static_cast<uint32_t>(ShaderObjects.ColorBlendEnables.size()))
+    {
+        m_CommandBuffer.SetColorBlendEnable(NumAttachments, ShaderObjects.ColorBlendEnables.data());
+        m_CommandBuffer.SetColorBlendEquation(NumAttachments, ShaderObjects.ColorBlendEquations.data());
+        m_CommandBuffer.SetColorWriteMask(NumAttachments, ShaderObjects.ColorWriteMasks.data());
+    }
+}
+
 void DeviceContextVkImpl::CommitVkVertexBuffers()
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -658,7 +980,7 @@ void DeviceContextVkImpl::CommitVkVertexBuffers()
         else
         {
             // We can't bind null vertex buffer in Vulkan and have to use a dummy one
-            vkVertexBuffers[slot] = m_DummyVB->GetVkBuffer();
+            vkVertexBuffers[slot] = GetDummyVertexBuffer();
             Offsets[slot]         = 0;
         }
     }
@@ -727,7 +1049,7 @@ void DeviceContextVkImpl::DvpLogRenderPass_PSOMismatch()
 
 void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 {
-    if (m_vkFramebuffer == VK_NULL_HANDLE && m_State.NullRenderTargets)
+    if (m_vkFramebuffer == VK_NULL_HANDLE && !m_DynamicRendering.IsValid && m_State.NullRenderTargets)
     {
         DEV_CHECK_ERR(m_FramebufferWidth > 0 && m_FramebufferHeight > 0,
                       "Framebuffer width/height is zero. Call SetViewports to set the framebuffer sizes when no render targets are set.");
@@ -738,11 +1060,11 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
         DvpVerifyRenderTargets();
 
-    VERIFY(m_vkRenderPass != VK_NULL_HANDLE, "No render pass is active while executing draw command");
-    VERIFY(m_vkFramebuffer != VK_NULL_HANDLE, "No framebuffer is bound while executing draw command");
+    VERIFY(m_vkRenderPass != VK_NULL_HANDLE || m_DynamicRendering.IsValid, "No render pass is active while executing draw command");
+    VERIFY(m_vkFramebuffer != VK_NULL_HANDLE || m_DynamicRendering.IsValid, "No framebuffer is bound while executing draw command");
 #endif
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
 
     if (!m_State.CommittedVBsUpToDate && m_pPipelineState->GetNumBufferSlotsUsed() > 0)
     {
@@ -778,7 +1100,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if (m_pPipelineState->GetGraphicsPipelineDesc().pRenderPass == nullptr)
     {
 #ifdef DILIGENT_DEVELOPMENT
-        if (m_pPipelineState->GetRenderPass()->GetVkRenderPass() != m_vkRenderPass)
+        if (m_pPipelineState->UsesDynamicRendering() != m_DynamicRendering.IsValid ||
+            (!m_DynamicRendering.IsValid && m_pPipelineState->GetRenderPass()->GetVkRenderPass() != m_vkRenderPass))
         {
             // Note that different Vulkan render passes may still be compatible,
             // so we should only verify implicit render passes
@@ -825,6 +1148,8 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::Draw(Attribs, 0);
 
     PrepareForDraw(Attribs.Flags);
@@ -838,6 +1163,8 @@ void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 
 void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
     PrepareForDraw(Attribs.Flags);
@@ -881,6 +1208,8 @@ void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -894,6 +1223,8 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 
 void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
     PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
@@ -937,6 +1268,8 @@ void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 
 void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndirect(Attribs, 0);
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -972,6 +1305,8 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -1007,6 +1342,8 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
 
 void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawMesh(Attribs, 0);
 
     PrepareForDraw(Attribs.Flags);
@@ -1020,6 +1357,8 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 
 void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawMeshIndirect(Attribs, 0);
 
     // We must prepare indirect draw attribs buffer first because state transitions must
@@ -1059,7 +1398,7 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
     EnsureVkCmdBuffer();
 
     // Dispatch commands must be executed outside of render pass
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_CommandBuffer.GetState().IsInsideRenderPass())
         m_CommandBuffer.EndRenderPass();
 
     auto& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
@@ -1092,6 +1431,8 @@ void DeviceContextVkImpl::PrepareForRayTracing()
 
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
     PrepareForDispatchCompute();
@@ -1105,6 +1446,8 @@ void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 
 void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
     PrepareForDispatchCompute();
@@ -1151,7 +1494,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
 
     auto* pVkDSV = ClassPtrCast<ITextureViewVk>(pView);
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
 
     const auto& ViewDesc = pVkDSV->GetDesc();
     VERIFY(ViewDesc.TextureDim != RESOURCE_DIM_TEX_3D, "Depth-stencil view of a 3D texture should've been created as 2D texture array view");
@@ -1160,9 +1503,19 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
     VERIFY(m_pActiveRenderPass == nullptr || ClearAsAttachment,
            "DSV was not found in the framebuffer. This is unexpected because TDeviceContextBase::ClearDepthStencil "
            "checks if the DSV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
-    if (ClearAsAttachment)
+    if (ClearAsAttachment && m_pActiveRenderPass == nullptr && !IsRenderingToBoundTargets() &&
+        ViewDesc.ViewType != TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRendering.IsValid);
+
+        // Defer the clear until the render pass is begun so that it is performed by the attachment load operation
+        TransitionRenderTargets(StateTransitionMode);
+        m_PendingClears.SetDepthStencil(ClearFlags, fDepth, Stencil);
+        m_InvalidatedAttachments &= ~m_PendingClears.Mask;
+    }
+    else if (ClearAsAttachment)
+    {
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRendering.IsValid);
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1194,7 +1547,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
     else
     {
         // End render pass to clear the buffer with vkCmdClearDepthStencilImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.GetState().IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkDSV->GetTexture();
@@ -1256,7 +1609,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
     if (RGBA == nullptr)
         RGBA = Zero;
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
 
     const auto& ViewDesc = pVkRTV->GetDesc();
     VERIFY(ViewDesc.TextureDim != RESOURCE_DIM_TEX_3D, "Render target view of a 3D texture should've been created as 2D texture array view");
@@ -1278,9 +1631,18 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
            "Render target was not found in the framebuffer. This is unexpected because TDeviceContextBase::ClearRenderTarget "
            "checks if the RTV is bound as a framebuffer attachment and triggers an assert otherwise (in development mode).");
 
-    if (attachmentIndex != InvalidAttachmentIndex)
+    if (attachmentIndex != InvalidAttachmentIndex && m_pActiveRenderPass == nullptr && !IsRenderingToBoundTargets())
+    {
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRendering.IsValid);
+
+        // Defer the clear until the render pass is begun so that it is performed by the attachment load operation
+        TransitionRenderTargets(StateTransitionMode);
+        m_PendingClears.SetColor(attachmentIndex, ClearValueToVkClearValue(RGBA, ViewDesc.Format));
+        m_InvalidatedAttachments &= ~m_PendingClears.Mask;
+    }
+    else if (attachmentIndex != InvalidAttachmentIndex)
     {
-        VERIFY_EXPR(m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRendering.IsValid);
         if (m_pActiveRenderPass == nullptr)
         {
             // Render pass may not be currently committed
@@ -1314,7 +1676,7 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
         VERIFY(m_pActiveRenderPass == nullptr, "This branch should never execute inside a render pass.");
 
         // End current render pass and clear the image with vkCmdClearColorImage
-        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        if (m_CommandBuffer.GetState().IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         auto* pTexture   = pVkRTV->GetTexture();
@@ -1341,6 +1703,46 @@ void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGB
     ++m_State.NumCommands;
 }
 
+void DeviceContextVkImpl::InvalidateAttachments(Uint32               NumViews,
+                                                ITextureView* const* ppViews)
+{
+    TDeviceContextBase::InvalidateAttachments(NumViews, ppViews, 0);
+
+    // The load operations of the running render pass can't be changed. Ending the render pass would
+    // only add a store operation, so the views are ignored.
+    if (IsRenderingToBoundTargets())
+        return;
+
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        if (ppViews[i] == nullptr)
+            continue;
+
+        Uint32 AttachmentMask = 0;
+        if (ppViews[i] == m_pBoundDepthStencil)
+        {
+            AttachmentMask = RenderPassCache::RenderPassCacheKey::DepthAttachmentBit | RenderPassCache::RenderPassCacheKey::StencilAttachmentBit;
+        }
+        else
+        {
+            for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+            {
+                if (m_pBoundRenderTargets[rt] == ppViews[i])
+                {
+                    AttachmentMask = 1u << rt;
+                    break;
+                }
+            }
+        }
+
+        // Vulkan has no command that discards the image contents outside of a render pass,
+        // so views that are not bound are ignored.
+        m_InvalidatedAttachments |= AttachmentMask;
+        // Pending clears of the invalidated attachments are not needed anymore
+        m_PendingClears.Mask &= ~AttachmentMask;
+    }
+}
+
 void DeviceContextVkImpl::FinishFrame()
 {
 #ifdef DILIGENT_DEBUG
@@ -1410,24 +1812,36 @@ void DeviceContextVkImpl::FinishFrame()
 
 void DeviceContextVkImpl::Flush()
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     Flush(0, nullptr);
 }
 
 void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
                                 ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+    DILIGENT_PROFILE_FUNCTION();
+
     DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
 
     DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
                   "Flushing device context that has ", m_ActiveQueriesCounter,
                   " active queries. Vulkan requires that queries are begun and ended in the same command buffer.");
+    DEV_CHECK_ERR(!m_IsConditionalRenderingActive,
+                  "Flushing device context with active conditional rendering. Vulkan requires that conditional rendering is begun and ended in the same command buffer.");
 
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
                   "Flushing device context inside an active render pass.");
 
-    // TODO: replace with small_vector
-    std::vector<VkCommandBuffer>               vkCmdBuffs;
-    std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs;
+    // Deferred clears must be recorded into the command buffer that is about to be submitted
+    if (m_PendingClears.Mask != 0)
+        FlushPendingClears();
+
+    ReleasePendingSplitBarriers();
+
+    SmallVector<VkCommandBuffer, 8>               vkCmdBuffs;
+    SmallVector<RefCntAutoPtr<IDeviceContext>, 8> DeferredCtxs;
     vkCmdBuffs.reserve(size_t{NumCommandLists} + 1);
     DeferredCtxs.reserve(size_t{NumCommandLists} + 1);
 
@@ -1439,12 +1853,13 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
             VERIFY_EXPR(!IsDeferred());
             // Note that vkCmdResetQueryPool must be called outside of a render pass,
             // so it is better to reset all queries at once at the end of the command buffer.
-            m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer);
+            // With host query reset, no commands are recorded.
+            m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer, m_pDevice->GetCompletedFenceValue(GetCommandQueueId()));
         }
 
         if (m_State.NumCommands != 0)
         {
-            if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+            if (m_CommandBuffer.GetState().IsInsideRenderPass())
             {
                 m_CommandBuffer.EndRenderPass();
             }
@@ -1597,6 +2012,16 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
+    // Secondary command buffers executed by the primary command buffer can be recycled
+    // once the primary command buffer has been completed by the GPU.
+    for (auto& SecondaryCmdBuff : m_PendingSecondaryCmdBuffers)
+    {
+        auto pDeferredCtxVkImpl = SecondaryCmdBuff.pDeferredCtx.RawPtr<DeviceContextVkImpl>();
+        pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), SecondaryCmdBuff.vkCmdBuff, SubmittedFenceValue, /*IsSecondary = */ true);
+    }
+    m_PendingSecondaryCmdBuffers.clear();
+
     m_State    = {};
     m_BindInfo = {};
     m_CommandBuffer.Reset();
@@ -1636,7 +2061,13 @@ void DeviceContextVkImpl::InvalidateState()
     m_vkRenderPass  = VK_NULL_HANDLE;
     m_vkFramebuffer = VK_NULL_HANDLE;
 
-    VERIFY(m_CommandBuffer.GetState().RenderPass == VK_NULL_HANDLE, "Invalidating context with unfinished render pass");
+    m_DynamicRendering.IsValid = false;
+
+    m_PendingClears.Mask     = 0;
+    m_InvalidatedAttachments = 0;
+    m_TransientAttachments   = 0;
+
+    VERIFY(!m_CommandBuffer.GetState().IsInsideRenderPass(), "Invalidating context with unfinished render pass");
     m_CommandBuffer.Reset();
 }
 
@@ -1693,9 +2124,32 @@ void DeviceContextVkImpl::CommitViewports()
         VkViewports[vp].y      = VkViewports[vp].y + VkViewports[vp].height;
         VkViewports[vp].height = -VkViewports[vp].height;
     }
-    EnsureVkCmdBuffer();
-    // TODO: reinterpret_cast m_Viewports to VkViewports?
-    m_CommandBuffer.SetViewports(0, m_NumViewports, VkViewports);
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
+    if (m_pPipelineState && m_pPipelineState->UsesShaderObjects())
+    {
+        // Shader objects do not define the number of viewports, so it is set together with the viewports
+        m_CommandBuffer.SetViewportsWithCount(m_NumViewports, VkViewports);
+
+        // The number of scissor rects must match the number of viewports. When the scissor test is disabled,
+        // the rects cover the maximum viewport size, which is what CreateGraphicsPipeline() does for pipelines.
+        if (!m_pPipelineState->GetGraphicsPipelineDesc().RasterizerDesc.ScissorEnable)
+        {
+            const auto& Limits = m_pDevice->GetPhysicalDevice().GetProperties().limits;
+
+            VkRect2D VkScissorRects[MAX_VIEWPORTS];
+            for (Uint32 sr = 0; sr < m_NumViewports; ++sr)
+            {
+                VkScissorRects[sr].offset = {0, 0};
+                VkScissorRects[sr].extent = {Limits.maxViewportDimensions[0], Limits.maxViewportDimensions[1]};
+            }
+            m_CommandBuffer.SetScissorRectsWithCount(m_NumViewports, VkScissorRects);
+        }
+    }
+    else
+    {
+        // TODO: reinterpret_cast m_Viewports to VkViewports?
+        m_CommandBuffer.SetViewports(0, m_NumViewports, VkViewports);
+    }
 }
 
 void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
@@ -1712,7 +2166,8 @@ void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pVie
         if (m_FramebufferWidth != VPWidth || m_FramebufferHeight != VPHeight)
         {
             // We need to bind another framebuffer since the size has changed
-            m_vkFramebuffer = VK_NULL_HANDLE;
+            m_vkFramebuffer            = VK_NULL_HANDLE;
+            m_DynamicRendering.IsValid = false;
         }
         m_FramebufferWidth   = VPWidth;
         m_FramebufferHeight  = VPHeight;
@@ -1743,9 +2198,18 @@ void DeviceContextVkImpl::CommitScissorRects()
         VkScissorRects[sr].extent = {static_cast<uint32_t>(SrcRect.right - SrcRect.left), static_cast<uint32_t>(SrcRect.bottom - SrcRect.top)};
     }
 
-    EnsureVkCmdBuffer();
-    // TODO: reinterpret_cast m_Viewports to m_Viewports?
-    m_CommandBuffer.SetScissorRects(0, m_NumScissorRects, VkScissorRects);
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
+    if (m_pPipelineState->UsesShaderObjects())
+    {
+        DEV_CHECK_ERR(m_NumScissorRects == m_NumViewports, "The number of scissor rects (", m_NumScissorRects,
+                      ") must match the number of viewports (", m_NumViewports, ") when shader objects are used");
+        m_CommandBuffer.SetScissorRectsWithCount(m_NumScissorRects, VkScissorRects);
+    }
+    else
+    {
+        // TODO: reinterpret_cast m_Viewports to m_Viewports?
+        m_CommandBuffer.SetScissorRects(0, m_NumScissorRects, VkScissorRects);
+    }
 }
 
 
@@ -1816,9 +2280,41 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
     VERIFY(m_pActiveRenderPass == nullptr, "This method must not be called inside an active render pass.");
 
     const auto& CmdBufferState = m_CommandBuffer.GetState();
-    if (CmdBufferState.Framebuffer != m_vkFramebuffer)
+    if (m_DynamicRendering.IsValid)
+    {
+        // Any active dynamic rendering matches the current render targets as
+        // PrepareDynamicRenderingInfo() ends the rendering when they change.
+        if (!CmdBufferState.DynamicRendering)
+        {
+            if (CmdBufferState.IsInsideRenderPass())
+                m_CommandBuffer.EndRenderPass();
+
+#ifdef DILIGENT_DEVELOPMENT
+            if (VerifyStates)
+            {
+                TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            }
+#endif
+            const Uint32 ClearMask   = m_PendingClears.Mask;
+            const Uint32 DiscardMask = m_InvalidatedAttachments & ~ClearMask;
+            if (ClearMask != 0 || DiscardMask != 0)
+            {
+                SetDynamicRenderingLoadOps(ClearMask, DiscardMask);
+                m_CommandBuffer.BeginRendering(m_DynamicRendering.RenderingInfo);
+                // Restore the load operations for the next time the rendering is begun
+                SetDynamicRenderingLoadOps(0, 0);
+            }
+            else
+            {
+                m_CommandBuffer.BeginRendering(m_DynamicRendering.RenderingInfo);
+            }
+            m_PendingClears.Mask     = 0;
+            m_InvalidatedAttachments = 0;
+        }
+    }
+    else if (CmdBufferState.Framebuffer != m_vkFramebuffer)
     {
-        if (CmdBufferState.RenderPass != VK_NULL_HANDLE)
+        if (CmdBufferState.IsInsideRenderPass())
             m_CommandBuffer.EndRenderPass();
 
         if (m_vkFramebuffer != VK_NULL_HANDLE)
@@ -1830,13 +2326,150 @@ void DeviceContextVkImpl::CommitRenderPassAndFramebuffer(bool VerifyStates)
                 TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
             }
 #endif
-            m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+            // Load and store operations do not affect render pass compatibility, so the render pass
+            // that clears or discards the attachments is compatible with m_vkRenderPass used by the
+            // pipelines and the framebuffer (8.2).
+            VkRenderPass vkRenderPass    = m_vkRenderPass;
+            Uint32       ClearValueCount = 0;
+
+            const Uint32 ClearMask       = m_PendingClears.Mask;
+            const Uint32 DiscardLoadMask = (m_InvalidatedAttachments | m_TransientAttachments) & ~ClearMask;
+            if (ClearMask != 0 || DiscardLoadMask != 0 || m_TransientAttachments != 0)
+            {
+                RenderPassCache::RenderPassCacheKey RenderPassKey{
+                    m_RenderPassKey.NumRenderTargets,
+                    m_RenderPassKey.SampleCount,
+                    m_RenderPassKey.RTVFormats,
+                    m_RenderPassKey.DSVFormat,
+                    m_RenderPassKey.EnableVRS,
+                    m_RenderPassKey.ReadOnlyDSV,
+                };
+                RenderPassKey.ClearMask        = static_cast<Uint16>(ClearMask);
+                RenderPassKey.DiscardLoadMask  = static_cast<Uint16>(DiscardLoadMask);
+                RenderPassKey.DiscardStoreMask = static_cast<Uint16>(m_TransientAttachments);
+                if (auto* pRenderPass = m_pDevice->GetImplicitRenderPassCache().GetRenderPass(RenderPassKey))
+                    vkRenderPass = pRenderPass->GetVkRenderPass();
+                else
+                    UNEXPECTED("Unable to get render pass for the currently bound render targets");
+
+                if (ClearMask != 0)
+                {
+                    // Clear values are indexed by the attachment index, see GetImplicitRenderPassDesc()
+                    m_vkClearValues.resize(MAX_RENDER_TARGETS + 1);
+                    if (m_pBoundDepthStencil)
+                        m_vkClearValues[ClearValueCount++].depthStencil = m_PendingClears.DepthStencil;
+                    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+                    {
+                        if (m_pBoundRenderTargets[rt])
+                            m_vkClearValues[ClearValueCount++].color = m_PendingClears.Colors[rt];
+                    }
+                }
+            }
+
+            m_CommandBuffer.BeginRenderPass(vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight,
+                                            ClearValueCount, ClearValueCount != 0 ? m_vkClearValues.data() : nullptr);
+            m_PendingClears.Mask     = 0;
+            m_InvalidatedAttachments = 0;
         }
     }
 }
 
+void DeviceContextVkImpl::FlushPendingClears()
+{
+    VERIFY_EXPR(m_PendingClears.Mask != 0 && m_pActiveRenderPass == nullptr);
+    VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE);
+
+    // The render pass is ended by the command that needs to be recorded outside of it,
+    // or is continued if the command can be recorded inside the render pass.
+    CommitRenderPassAndFramebuffer(false);
+    VERIFY_EXPR(m_PendingClears.Mask == 0);
+}
+
+bool DeviceContextVkImpl::IsRenderingToBoundTargets() const
+{
+    // Secondary command lists continue the render pass instance begun by the primary command buffer
+    if (m_IsSecondaryCmdList)
+        return true;
+
+    const auto& CmdBufferState = m_CommandBuffer.GetState();
+    if (m_DynamicRendering.IsValid)
+    {
+        // Any active dynamic rendering matches the current render targets as
+        // PrepareDynamicRenderingInfo() ends the rendering when they change.
+        return CmdBufferState.DynamicRendering;
+    }
+    else
+    {
+        return m_vkFramebuffer != VK_NULL_HANDLE && CmdBufferState.Framebuffer == m_vkFramebuffer;
+    }
+}
+
+void DeviceContextVkImpl::SetDynamicRenderingLoadOps(Uint32 ClearMask, Uint32 DiscardMask)
+{
+    // Transient attachments are never loaded
+    DiscardMask |= m_TransientAttachments & ~ClearMask;
+
+    const auto GetLoadOp = [ClearMask, DiscardMask](Uint32 AttachmentBit) {
+        if (ClearMask & AttachmentBit)
+            return VK_ATTACHMENT_LOAD_OP_CLEAR;
+        else if (DiscardMask & AttachmentBit)
+            return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        else
+            return VK_ATTACHMENT_LOAD_OP_LOAD;
+    };
+
+    auto& DynRendering = m_DynamicRendering;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        VkRenderingAttachmentInfoKHR& ColorAttachment = DynRendering.ColorAttachments[rt];
+
+        ColorAttachment.loadOp = GetLoadOp(1u << rt);
+        if (ColorAttachment.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR)
+            ColorAttachment.clearValue.color = m_PendingClears.Colors[rt];
+    }
+
+    if (m_pBoundDepthStencil)
+    {
+        DynRendering.DepthAttachment.loadOp = GetLoadOp(RenderPassCache::RenderPassCacheKey::DepthAttachmentBit);
+        if (DynRendering.DepthAttachment.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR)
+            DynRendering.DepthAttachment.clearValue.depthStencil = m_PendingClears.DepthStencil;
+
+        DynRendering.StencilAttachment.loadOp = GetLoadOp(RenderPassCache::RenderPassCacheKey::StencilAttachmentBit);
+        if (DynRendering.StencilAttachment.loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR)
+            DynRendering.StencilAttachment.clearValue.depthStencil = m_PendingClears.DepthStencil;
+    }
+}
+
 void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
 {
+    VERIFY(m_PendingClears.Mask == 0, "Pending clears must be flushed before the render targets are changed");
+    m_InvalidatedAttachments = 0;
+    m_TransientAttachments   = 0;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if (auto* pRTVVk = m_pBoundRenderTargets[rt].RawPtr())
+        {
+            if (pRTVVk->GetTexture()->GetDesc().MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT)
+                m_TransientAttachments |= 1u << rt;
+        }
+    }
+    if (m_pBoundDepthStencil &&
+        m_pBoundDepthStencil->GetDesc().ViewType != TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL &&
+        (m_pBoundDepthStencil->GetTexture()->GetDesc().MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT) != 0)
+    {
+        m_TransientAttachments |= RenderPassCache::RenderPassCacheKey::DepthAttachmentBit | RenderPassCache::RenderPassCacheKey::StencilAttachmentBit;
+    }
+
+    // Dynamic rendering does not need render pass and framebuffer objects, which avoids
+    // cache lookups and object creation. Fragment shading rate attachments are not supported
+    // with dynamic rendering (see CreateGraphicsPipeline in PipelineStateVkImpl.cpp).
+    if (m_pDevice->GetLogicalDevice().GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE && !m_pBoundShadingRateMap)
+    {
+        PrepareDynamicRenderingInfo();
+        return;
+    }
+    m_DynamicRendering.IsValid = false;
+
     FramebufferCache::FramebufferCacheKey FBKey;
     RenderPassCache::RenderPassCacheKey   RenderPassKey;
     if (m_pBoundDepthStencil)
@@ -1892,6 +2525,7 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
     auto& FBCache = m_pDevice->GetFramebufferCache();
     auto& RPCache = m_pDevice->GetImplicitRenderPassCache();
 
+    m_RenderPassKey = RenderPassKey;
     if (auto* pRenderPass = RPCache.GetRenderPass(RenderPassKey))
     {
         m_vkRenderPass         = pRenderPass->GetVkRenderPass();
@@ -1907,9 +2541,98 @@ void DeviceContextVkImpl::ChooseRenderPassAndFramebuffer()
     }
 }
 
+void DeviceContextVkImpl::PrepareDynamicRenderingInfo()
+{
+    // Render targets have changed, so the active rendering can't be continued
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().DynamicRendering)
+        m_CommandBuffer.EndRenderPass();
+
+    m_vkRenderPass  = VK_NULL_HANDLE;
+    m_vkFramebuffer = VK_NULL_HANDLE;
+
+    auto& DynRendering = m_DynamicRendering;
+
+    // Attachments are loaded and stored similar to implicit render passes (see RenderPassCache::GetRenderPass).
+    // Load operations are set by SetDynamicRenderingLoadOps().
+    const auto GetStoreOp = [this](Uint32 AttachmentBit) {
+        return (m_TransientAttachments & AttachmentBit) ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+    };
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        VkRenderingAttachmentInfoKHR& ColorAttachment = DynRendering.ColorAttachments[rt];
+
+        ColorAttachment       = {};
+        ColorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        if (auto* pRTVVk = m_pBoundRenderTargets[rt].RawPtr())
+        {
+            ColorAttachment.imageView   = pRTVVk->GetVulkanImageView();
+            ColorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+        // Writes to the attachment are discarded if imageView is null
+        ColorAttachment.resolveMode = VK_RESOLVE_MODE_NONE;
+        ColorAttachment.storeOp     = GetStoreOp(1u << rt);
+    }
+
+    DynRendering.DepthAttachment         = {};
+    DynRendering.DepthAttachment.sType   = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    DynRendering.StencilAttachment       = {};
+    DynRendering.StencilAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+
+    bool HasStencil = false;
+    if (m_pBoundDepthStencil)
+    {
+        const auto& DSVDesc = m_pBoundDepthStencil->GetDesc();
+
+        DynRendering.DepthAttachment.imageView   = m_pBoundDepthStencil->GetVulkanImageView();
+        DynRendering.DepthAttachment.imageLayout = DSVDesc.ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL ?
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        DynRendering.DepthAttachment.resolveMode = VK_RESOLVE_MODE_NONE;
+        DynRendering.DepthAttachment.storeOp     = GetStoreOp(RenderPassCache::RenderPassCacheKey::DepthAttachmentBit);
+
+        // Stencil attachment must use the same image view as the depth attachment
+        HasStencil = GetTextureFormatAttribs(DSVDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL;
+        if (HasStencil)
+            DynRendering.StencilAttachment = DynRendering.DepthAttachment;
+    }
+    SetDynamicRenderingLoadOps(0, 0);
+
+    VkRenderingInfoKHR& RenderingInfo = DynRendering.RenderingInfo;
+
+    RenderingInfo       = {};
+    RenderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+    RenderingInfo.flags = 0;
+    // m_FramebufferWidth, m_FramebufferHeight are scaled to the proper mip level
+    RenderingInfo.renderArea           = {{0, 0}, {m_FramebufferWidth, m_FramebufferHeight}};
+    RenderingInfo.layerCount           = m_FramebufferSlices;
+    RenderingInfo.viewMask             = 0;
+    RenderingInfo.colorAttachmentCount = m_NumBoundRenderTargets;
+    RenderingInfo.pColorAttachments    = m_NumBoundRenderTargets > 0 ? DynRendering.ColorAttachments.data() : nullptr;
+    RenderingInfo.pDepthAttachment     = m_pBoundDepthStencil ? &DynRendering.DepthAttachment : nullptr;
+    RenderingInfo.pStencilAttachment   = HasStencil ? &DynRendering.StencilAttachment : nullptr;
+
+    DynRendering.IsValid = true;
+}
+
 void DeviceContextVkImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
 {
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+    DEV_CHECK_ERR(!m_IsSecondaryCmdList || m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE,
+                  "Render targets can't be changed while recording a secondary command list");
+
+    if (m_PendingClears.Mask != 0)
+    {
+        bool RTChanged =
+            Attribs.NumRenderTargets != m_NumBoundRenderTargets ||
+            Attribs.pDepthStencil != m_pBoundDepthStencil ||
+            Attribs.pShadingRateMap != m_pBoundShadingRateMap;
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets && !RTChanged; ++rt)
+            RTChanged = m_pBoundRenderTargets[rt] != Attribs.ppRenderTargets[rt];
+
+        // Clears of the current render targets must be performed before they are unbound
+        if (RTChanged)
+            FlushPendingClears();
+    }
 
     if (TDeviceContextBase::SetRenderTargets(Attribs))
     {
@@ -1928,22 +2651,33 @@ void DeviceContextVkImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Att
 
 void DeviceContextVkImpl::ResetRenderTargets()
 {
+    // Clears of the current render targets must be performed before they are unbound
+    if (m_PendingClears.Mask != 0)
+        FlushPendingClears();
+    m_InvalidatedAttachments = 0;
+    m_TransientAttachments   = 0;
+
     TDeviceContextBase::ResetRenderTargets();
     m_vkRenderPass  = VK_NULL_HANDLE;
     m_vkFramebuffer = VK_NULL_HANDLE;
-    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+
+    m_DynamicRendering.IsValid = false;
+    if (m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().IsInsideRenderPass())
         m_CommandBuffer.EndRenderPass();
     m_State.ShadingRateIsSet = false;
 }
 
 void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
+    DEV_CHECK_ERR(!m_IsSecondaryCmdList, "Render passes can't be begun while recording a secondary command list");
+
     TDeviceContextBase::BeginRenderPass(Attribs);
 
     VERIFY_EXPR(m_pActiveRenderPass != nullptr);
     VERIFY_EXPR(m_pBoundFramebuffer != nullptr);
     VERIFY_EXPR(m_vkRenderPass == VK_NULL_HANDLE);
     VERIFY_EXPR(m_vkFramebuffer == VK_NULL_HANDLE);
+    VERIFY_EXPR(!m_DynamicRendering.IsValid);
 
     m_vkRenderPass  = m_pActiveRenderPass->GetVkRenderPass();
     m_vkFramebuffer = m_pBoundFramebuffer->GetVkFramebuffer();
@@ -2035,6 +2769,16 @@ void DeviceContextVkImpl::UpdateBuffer(IBuffer*                       pBuffer,
 
     DEV_CHECK_ERR(pBuffVk->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers must be updated via Map()");
 
+    if ((pBuffVk->GetDesc().MiscFlags & MISC_BUFFER_FLAG_DIRECT_UPDATES) != 0)
+    {
+        // The buffer resides in device-local host-coherent memory, so the data is written directly.
+        // Host writes are made visible to the device when the command buffer is submitted (7.9).
+        DEV_CHECK_ERR(Offset + Size <= pBuffVk->GetDesc().Size,
+                      "Update region is out of buffer bounds which will result in an undefined behavior");
+        memcpy(reinterpret_cast<Uint8*>(pBuffVk->GetCPUAddress()) + Offset, pData, StaticCast<size_t>(Size));
+        return;
+    }
+
     constexpr size_t Alignment = 4;
     // Source buffer offset must be multiple of 4 (18.4)
     auto TmpSpace = m_UploadHeap.Allocate(Size, Alignment);
@@ -2075,6 +2819,8 @@ void DeviceContextVkImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
 
 void DeviceContextVkImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
     auto* const pBufferVk = ClassPtrCast<BufferVkImpl>(pBuffer);
     const auto& BuffDesc  = pBufferVk->GetDesc();
@@ -2152,6 +2898,8 @@ void DeviceContextVkImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 
 void DeviceContextVkImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
     auto* const pBufferVk = ClassPtrCast<BufferVkImpl>(pBuffer);
     const auto& BuffDesc  = pBufferVk->GetDesc();
@@ -2204,7 +2952,45 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
 
     if (SubresData.pSrcBuffer != nullptr)
     {
-        UNSUPPORTED("Copying buffer to texture is not implemented");
+        auto* pSrcBufferVk = ClassPtrCast<BufferVkImpl>(SubresData.pSrcBuffer);
+#ifdef DILIGENT_DEVELOPMENT
+        if (pSrcBufferVk->GetDesc().Usage == USAGE_DYNAMIC)
+            pSrcBufferVk->DvpVerifyDynamicAllocation(this);
+#endif
+
+        const auto& FmtAttribs = GetTextureFormatAttribs(pTexVk->GetDesc().Format);
+        // Buffer row length is specified in texels, not bytes (18.4)
+        Uint32 RowStrideInTexels = 0;
+        if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+        {
+            DEV_CHECK_ERR((SubresData.Stride % FmtAttribs.ComponentSize) == 0,
+                          "Source buffer stride (", SubresData.Stride, ") must be a multiple of the compressed block size (", Uint32{FmtAttribs.ComponentSize}, ")");
+            DEV_CHECK_ERR((SubresData.SrcOffset % FmtAttribs.ComponentSize) == 0,
+                          "Source buffer offset (", SubresData.SrcOffset, ") must be a multiple of the compressed block size (", Uint32{FmtAttribs.ComponentSize}, ") (18.4)");
+            RowStrideInTexels = StaticCast<Uint32>(SubresData.Stride / FmtAttribs.ComponentSize * FmtAttribs.BlockWidth);
+        }
+        else
+        {
+            const Uint32 TexelSize = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+            DEV_CHECK_ERR((SubresData.Stride % TexelSize) == 0,
+                          "Source buffer stride (", SubresData.Stride, ") must be a multiple of the texel size (", TexelSize, ")");
+            RowStrideInTexels = StaticCast<Uint32>(SubresData.Stride / TexelSize);
+        }
+        DEV_CHECK_ERR((SubresData.SrcOffset % 4) == 0, "Source buffer offset (", SubresData.SrcOffset, ") must be a multiple of 4 (18.4)");
+        DEV_CHECK_ERR(DstBox.Depth() == 1 || SubresData.DepthStride == 0 || SubresData.DepthStride == SubresData.Stride * ((DstBox.Height() + FmtAttribs.BlockHeight - 1) / FmtAttribs.BlockHeight),
+                      "Source buffer depth stride (", SubresData.DepthStride, ") must be equal to the stride times the number of rows in the update region");
+
+        EnsureVkCmdBuffer();
+        TransitionOrVerifyBufferState(*pSrcBufferVk, SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT,
+                                      "Using buffer as copy source (DeviceContextVkImpl::UpdateTexture)");
+        CopyBufferToTexture(pSrcBufferVk->GetVkBuffer(),
+                            SubresData.SrcOffset + pSrcBufferVk->GetDynamicOffset(GetContextId(), this),
+                            RowStrideInTexels,
+                            *pTexVk,
+                            DstBox,
+                            MipLevel,
+                            Slice,
+                            TextureStateTransitionMode);
     }
     else
     {
@@ -2553,6 +3339,8 @@ void DeviceContextVkImpl::MapTextureSubresource(ITexture*                 pTextu
                                                 const Box*                pMapRegion,
                                                 MappedTextureSubresource& MappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
 
     TextureVkImpl& TextureVk  = *ClassPtrCast<TextureVkImpl>(pTexture);
@@ -2655,6 +3443,8 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
                                                   Uint32    MipLevel,
                                                   Uint32    ArraySlice)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
 
     TextureVkImpl& TextureVk = *ClassPtrCast<TextureVkImpl>(pTexture);
@@ -2704,7 +3494,13 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    if (m_PendingClears.Mask != 0)
+        FlushPendingClears();
+
+    ReleasePendingSplitBarriers();
+
+    // The render pass instance of a secondary command list is ended by the primary command buffer
+    if (m_CommandBuffer.GetState().IsInsideRenderPass() && !m_CommandBuffer.GetState().InheritedRenderPass)
     {
         m_CommandBuffer.EndRenderPass();
     }
@@ -2714,9 +3510,11 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, m_IsSecondaryCmdList, m_vkRenderPass, m_IsReusableCmdList ? m_CmdPool : nullptr)};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
+    m_IsSecondaryCmdList = false;
+    m_IsReusableCmdList  = false;
     m_CommandBuffer.Reset();
     m_State          = ContextState{};
     m_pPipelineState = nullptr;
@@ -2730,17 +3528,100 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
 void DeviceContextVkImpl::ExecuteCommandLists(Uint32               NumCommandLists,
                                               ICommandList* const* ppCommandLists)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
 
     if (NumCommandLists == 0)
         return;
     DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
 
+    const auto* pFirstCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[0]);
+    if (pFirstCmdListVk != nullptr && pFirstCmdListVk->IsSecondary())
+    {
+        ExecuteSecondaryCommandLists(NumCommandLists, ppCommandLists);
+        return;
+    }
+
     Flush(NumCommandLists, ppCommandLists);
 
     InvalidateState();
 }
 
+void DeviceContextVkImpl::ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                                       ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
+                  "Secondary command lists can't be executed inside an explicit render pass. "
+                  "Bind render targets with SetRenderTargets() instead.");
+    DEV_CHECK_ERR(m_DynamicRendering.IsValid || m_vkFramebuffer != VK_NULL_HANDLE,
+                  "Secondary command lists must be executed with the render targets bound by SetRenderTargets()");
+
+    EnsureVkCmdBuffer();
+
+    // The render pass instance must be begun again with the contents provided by secondary command buffers
+    if (m_CommandBuffer.GetState().IsInsideRenderPass())
+        m_CommandBuffer.EndRenderPass();
+
+#ifdef DILIGENT_DEVELOPMENT
+    TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+#endif
+
+    if (m_DynamicRendering.IsValid)
+    {
+        VkRenderingInfoKHR RenderingInfo{m_DynamicRendering.RenderingInfo};
+        RenderingInfo.flags |= VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR;
+        m_CommandBuffer.BeginRendering(RenderingInfo);
+    }
+    else
+    {
+        m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight,
+                                        0, nullptr, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    }
+
+    VkCommandBuffer* vkCmdBuffs = AllocateFrameArray<VkCommandBuffer>(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        auto* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListVk->IsSecondary(), "Secondary and regular command lists can't be executed by the same ExecuteCommandLists() call");
+        DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        DEV_CHECK_ERR(pCmdListVk->GetVkRenderPass() == m_vkRenderPass,
+                      "Secondary command list was recorded with render targets that are not compatible with the render targets bound to the context");
+
+        if (pCmdListVk->IsReusable())
+        {
+            // Reusable command lists own their command buffers
+            vkCmdBuffs[i] = pCmdListVk->GetReusableVkCmdBuffer(GetCommandQueueId());
+            continue;
+        }
+
+        PendingSecondaryCmdBuffer SecondaryCmdBuff;
+        pCmdListVk->Close(SecondaryCmdBuff.pDeferredCtx, SecondaryCmdBuff.vkCmdBuff);
+        VERIFY(SecondaryCmdBuff.vkCmdBuff != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(SecondaryCmdBuff.pDeferredCtx != nullptr);
+        vkCmdBuffs[i] = SecondaryCmdBuff.vkCmdBuff;
+        m_PendingSecondaryCmdBuffers.emplace_back(std::move(SecondaryCmdBuff));
+    }
+
+    m_CommandBuffer.ExecuteCommands(NumCommandLists, vkCmdBuffs);
+    m_CommandBuffer.EndRenderPass();
+    ++m_State.NumCommands;
+
+    // Secondary command buffers leave the state of the primary command buffer undefined
+    const auto NumCommands = m_State.NumCommands;
+    TDeviceContextBase::InvalidateState();
+    m_State             = {};
+    m_State.NumCommands = NumCommands;
+    m_BindInfo          = {};
+    m_vkRenderPass      = VK_NULL_HANDLE;
+    m_vkFramebuffer     = VK_NULL_HANDLE;
+
+    m_DynamicRendering.IsValid = false;
+
+    m_CommandBuffer.InvalidateState();
+}
+
 void DeviceContextVkImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
 {
     TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
@@ -2762,6 +3643,8 @@ void DeviceContextVkImpl::WaitForIdle()
 
 void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 {
+    DEV_CHECK_ERR(!m_IsReusableCmdList, "Queries are not allowed in reusable command lists");
+
     TDeviceContextBase::BeginQuery(pQuery, 0);
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
@@ -2810,6 +3693,8 @@ void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 
 void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
 {
+    DEV_CHECK_ERR(!m_IsReusableCmdList, "Queries are not allowed in reusable command lists");
+
     TDeviceContextBase::EndQuery(pQuery, 0);
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
@@ -2838,12 +3723,12 @@ void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
                "No query flag is set which indicates there was no matching BeginQuery call or there was an error while beginning the query.");
         if (CmdBuffState.OutsidePassQueries & (1 << QueryType))
         {
-            if (m_CommandBuffer.GetState().RenderPass)
+            if (m_CommandBuffer.GetState().IsInsideRenderPass())
                 m_CommandBuffer.EndRenderPass();
         }
         else
         {
-            if (!m_CommandBuffer.GetState().RenderPass)
+            if (!m_CommandBuffer.GetState().IsInsideRenderPass())
                 LOG_ERROR_MESSAGE("The query was started inside render pass, but is being ended outside of render pass. "
                                   "Vulkan requires that a query must either begin and end inside the same "
                                   "subpass of a render pass instance, or must both begin and end outside of a render pass "
@@ -2855,6 +3740,83 @@ void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextVkImpl::ResolveQueries(IQuery* const*                 ppQueries,
+                                         Uint32                         NumQueries,
+                                         IBuffer*                       pDstBuffer,
+                                         Uint64                         DstOffset,
+                                         RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::ResolveQueries(ppQueries, NumQueries, pDstBuffer, DstOffset, 0);
+    if (NumQueries == 0)
+        return;
+
+    VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
+    DEV_CHECK_ERR(m_pQueryMgr != nullptr, "Query manager is null, which indicates that this deferred context is not in a recording state");
+
+    auto* pDstBuffVk = ClassPtrCast<BufferVkImpl>(pDstBuffer);
+    DEV_CHECK_ERR(pDstBuffVk->GetDesc().Usage != USAGE_DYNAMIC, "Dynamic buffers cannot be query resolve destinations");
+
+    EnsureVkCmdBuffer();
+    TransitionOrVerifyBufferState(*pDstBuffVk, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, "Resolving queries (DeviceContextVkImpl::ResolveQueries)");
+    VERIFY(pDstBuffVk->m_VulkanBuffer != VK_NULL_HANDLE, "Query resolve destination buffer must not be suballocated");
+
+    // Queries of the same type with consecutive pool indices are copied by a single command
+    for (Uint32 i = 0; i < NumQueries;)
+    {
+        const auto QueryType   = ppQueries[i]->GetDesc().Type;
+        const auto vkQueryPool = m_pQueryMgr->GetQueryPool(QueryType);
+        const auto FirstIndex  = ClassPtrCast<QueryVkImpl>(ppQueries[i])->GetQueryPoolIndex(0);
+        VERIFY(vkQueryPool != VK_NULL_HANDLE, "Query pool is not initialized for query type");
+
+        Uint32 Count = 1;
+        while (i + Count < NumQueries &&
+               ppQueries[i + Count]->GetDesc().Type == QueryType &&
+               ClassPtrCast<QueryVkImpl>(ppQueries[i + Count])->GetQueryPoolIndex(0) == FirstIndex + Count)
+            ++Count;
+
+        // Query results are written as 64-bit values with no availability, so the command waits
+        // for the results to become available on the device timeline.
+        m_CommandBuffer.CopyQueryPoolResults(vkQueryPool, FirstIndex, Count, pDstBuffVk->GetVkBuffer(),
+                                             DstOffset + Uint64{i} * sizeof(Uint64), sizeof(Uint64),
+                                             VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        ++m_State.NumCommands;
+        i += Count;
+    }
+}
+
+void DeviceContextVkImpl::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs)
+{
+    TDeviceContextBase::BeginConditionalRendering(Attribs, 0);
+    DEV_CHECK_ERR(Attribs.pBuffer != nullptr, "Vulkan only supports buffer predicates");
+
+    auto* pBuffVk = ClassPtrCast<BufferVkImpl>(Attribs.pBuffer);
+#ifdef DILIGENT_DEVELOPMENT
+    if (pBuffVk->GetDesc().Usage == USAGE_DYNAMIC)
+        pBuffVk->DvpVerifyDynamicAllocation(this);
+#endif
+
+    EnsureVkCmdBuffer();
+    TransitionOrVerifyBufferState(*pBuffVk, Attribs.BufferTransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT,
+                                  VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT, "Beginning conditional rendering (DeviceContextVkImpl::BeginConditionalRendering)");
+
+    // Vulkan discards commands when the 32-bit value is zero, which matches the lower
+    // half of the 64-bit predicate on little-endian devices.
+    const VkConditionalRenderingFlagsEXT vkFlags = (Attribs.Flags & CONDITIONAL_RENDERING_FLAG_INVERTED) != 0 ?
+        VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT :
+        0;
+    m_CommandBuffer.BeginConditionalRendering(pBuffVk->GetVkBuffer(), pBuffVk->GetDynamicOffset(GetContextId(), this) + Attribs.Offset, vkFlags);
+    ++m_State.NumCommands;
+}
+
+void DeviceContextVkImpl::EndConditionalRendering()
+{
+    TDeviceContextBase::EndConditionalRendering(0);
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.EndConditionalRendering();
+    ++m_State.NumCommands;
+}
+
 
 void DeviceContextVkImpl::TransitionImageLayout(ITexture* pTexture, VkImageLayout NewLayout)
 {
@@ -2893,7 +3855,8 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
                                                  RESOURCE_STATE           OldState,
                                                  RESOURCE_STATE           NewState,
                                                  STATE_TRANSITION_FLAGS   Flags,
-                                                 VkImageSubresourceRange* pSubresRange /* = nullptr*/)
+                                                 VkImageSubresourceRange* pSubresRange /* = nullptr*/,
+                                                 VkEvent                  vkSplitBarrierEvent /* = VK_NULL_HANDLE*/)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
     if (OldState == RESOURCE_STATE_UNKNOWN)
@@ -2963,12 +3926,20 @@ void DeviceContextVkImpl::TransitionTextureState(TextureVkImpl&           Textur
 
     if (((OldState & NewState) != NewState) || OldLayout != NewLayout || AfterWrite)
     {
-        m_CommandBuffer.TransitionImageLayout(vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
+        if (vkSplitBarrierEvent != VK_NULL_HANDLE)
+            m_CommandBuffer.WaitEventImageLayout(vkSplitBarrierEvent, vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
+        else
+            m_CommandBuffer.TransitionImageLayout(vkImg, OldLayout, NewLayout, *pSubresRange, OldStages, NewStages);
         if ((Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0)
         {
             TextureVk.SetState(NewState);
             VERIFY_EXPR(TextureVk.GetLayout() == NewLayout);
         }
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.Transitions);
+    }
+    else
+    {
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.TransitionsSkipped);
     }
 }
 
@@ -3018,7 +3989,119 @@ VkCommandBuffer DeviceContextVkImpl::GetVkCommandBuffer()
     return m_CommandBuffer.GetVkCmdBuffer();
 }
 
-void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
+void DeviceContextVkImpl::BeginSecondaryCommandList(Uint32 ImmediateContextId, const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Secondary command lists can only be recorded by deferred contexts");
+    DEV_CHECK_ERR(Attribs.StateTransitionMode != RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                  "Render targets can't be transitioned in a secondary command list as it is recorded inside a render pass. "
+                  "Transition the render targets in the immediate context before executing the command list.");
+
+    Begin(ImmediateContextId);
+    VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE);
+
+    // The secondary command buffer is begun when the render targets are known
+    m_IsSecondaryCmdList = true;
+
+    SetRenderTargetsAttribs RTAttribs{Attribs};
+    if (RTAttribs.StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+        RTAttribs.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_VERIFY;
+    SetRenderTargetsExt(RTAttribs);
+
+    EnsureVkCmdBuffer();
+}
+
+void DeviceContextVkImpl::BeginReusableCommandList(Uint32 ImmediateContextId, const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(!IsRecordingDeferredCommands(), "This context is already recording commands. Call FinishCommandList() before beginning new recording.");
+
+    // The command buffer is begun without VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT (see BeginSecondaryVkCmdBuffer)
+    m_IsReusableCmdList = true;
+    BeginSecondaryCommandList(ImmediateContextId, Attribs);
+}
+
+void DeviceContextVkImpl::BeginSecondaryVkCmdBuffer()
+{
+    VERIFY_EXPR(IsDeferred() && m_IsSecondaryCmdList);
+    DEV_CHECK_ERR(m_DynamicRendering.IsValid || m_vkRenderPass != VK_NULL_HANDLE,
+                  "Render targets must be set before recording commands into a secondary command list");
+
+    VkCommandBufferInheritanceInfo InheritanceInfo{};
+    InheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+
+    VkCommandBufferInheritanceRenderingInfoKHR RenderingInheritanceInfo{};
+    std::array<VkFormat, MAX_RENDER_TARGETS>   ColorFormats{};
+    if (m_DynamicRendering.IsValid)
+    {
+        Uint32 SampleCount = 0;
+        for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+        {
+            if (auto* pRTVVk = m_pBoundRenderTargets[rt].RawPtr())
+            {
+                ColorFormats[rt] = TexFormatToVkFormat(pRTVVk->GetDesc().Format);
+                SampleCount      = pRTVVk->GetTexture()->GetDesc().SampleCount;
+            }
+            else
+            {
+                ColorFormats[rt] = VK_FORMAT_UNDEFINED;
+            }
+        }
+
+        // Formats must match the attachments of VkRenderingInfo the render pass instance is begun with
+        // (see PrepareDynamicRenderingInfo())
+        RenderingInheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+        RenderingInheritanceInfo.flags                   = m_DynamicRendering.RenderingInfo.flags;
+        RenderingInheritanceInfo.viewMask                = m_DynamicRendering.RenderingInfo.viewMask;
+        RenderingInheritanceInfo.colorAttachmentCount    = m_NumBoundRenderTargets;
+        RenderingInheritanceInfo.pColorAttachmentFormats = m_NumBoundRenderTargets > 0 ? ColorFormats.data() : nullptr;
+        RenderingInheritanceInfo.depthAttachmentFormat   = VK_FORMAT_UNDEFINED;
+        RenderingInheritanceInfo.stencilAttachmentFormat = VK_FORMAT_UNDEFINED;
+        if (m_pBoundDepthStencil)
+        {
+            const auto& DSVDesc = m_pBoundDepthStencil->GetDesc();
+            const auto  DSVFmt  = TexFormatToVkFormat(DSVDesc.Format);
+
+            RenderingInheritanceInfo.depthAttachmentFormat = DSVFmt;
+            if (GetTextureFormatAttribs(DSVDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+                RenderingInheritanceInfo.stencilAttachmentFormat = DSVFmt;
+
+            SampleCount = m_pBoundDepthStencil->GetTexture()->GetDesc().SampleCount;
+        }
+        if (SampleCount == 0)
+            SampleCount = m_FramebufferSamples;
+        RenderingInheritanceInfo.rasterizationSamples = static_cast<VkSampleCountFlagBits>(SampleCount);
+
+        InheritanceInfo.pNext       = &RenderingInheritanceInfo;
+        InheritanceInfo.renderPass  = VK_NULL_HANDLE;
+        InheritanceInfo.framebuffer = VK_NULL_HANDLE;
+    }
+    else
+    {
+        InheritanceInfo.pNext      = nullptr;
+        InheritanceInfo.renderPass = m_vkRenderPass;
+        // The framebuffer is optional, but may help the driver to optimize the command buffer.
+        // Reusable command lists may be executed with any compatible framebuffer, so it is not specified.
+        InheritanceInfo.framebuffer = m_IsReusableCmdList ? VK_NULL_HANDLE : m_vkFramebuffer;
+    }
+    InheritanceInfo.subpass              = 0;
+    InheritanceInfo.occlusionQueryEnable = VK_FALSE;
+    InheritanceInfo.queryFlags           = 0;
+    InheritanceInfo.pipelineStatistics   = 0;
+
+    // Reusable command buffers may be executed by several primary command buffers that are pending at the same time
+    const VkCommandBufferUsageFlags UsageFlags = m_IsReusableCmdList ?
+        VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT :
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    auto vkCmdBuff = m_CmdPool->GetCommandBuffer("", &InheritanceInfo, UsageFlags);
+    m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
+    m_CommandBuffer.SetInheritedRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+}
+
+void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl&  BufferVk,
+                                                RESOURCE_STATE OldState,
+                                                RESOURCE_STATE NewState,
+                                                bool           UpdateBufferState,
+                                                VkEvent        vkSplitBarrierEvent /* = VK_NULL_HANDLE*/)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
     if (OldState == RESOURCE_STATE_UNKNOWN)
@@ -3048,6 +4131,13 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
 
     if (((OldState & NewState) != NewState) || AfterWrite)
     {
+        // If both old state and new state are read-only states, combine the two, so that
+        // alternating between them (e.g. vertex buffer and shader resource) does not
+        // require a barrier every time.
+        if ((OldState & RESOURCE_STATE_GENERIC_READ) == OldState &&
+            (NewState & RESOURCE_STATE_GENERIC_READ) == NewState)
+            NewState |= OldState;
+
         DEV_CHECK_ERR(BufferVk.m_VulkanBuffer != VK_NULL_HANDLE, "Cannot transition suballocated buffer");
         VERIFY_EXPR(BufferVk.GetDynamicOffset(GetContextId(), this) == 0);
 
@@ -3056,11 +4146,19 @@ void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE
         auto NewAccessFlags = ResourceStateFlagsToVkAccessFlags(NewState);
         auto OldStages      = ResourceStateFlagsToVkPipelineStageFlags(OldState);
         auto NewStages      = ResourceStateFlagsToVkPipelineStageFlags(NewState);
-        m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        if (vkSplitBarrierEvent != VK_NULL_HANDLE)
+            m_CommandBuffer.WaitEventMemoryBarrier(vkSplitBarrierEvent, OldAccessFlags, NewAccessFlags, OldStages, NewStages);
+        else
+            m_CommandBuffer.MemoryBarrier(OldAccessFlags, NewAccessFlags, OldStages, NewStages);
         if (UpdateBufferState)
         {
             BufferVk.SetState(NewState);
         }
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.Transitions);
+    }
+    else
+    {
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.TransitionsSkipped);
     }
 }
 
@@ -3130,6 +4228,11 @@ void DeviceContextVkImpl::TransitionBLASState(BottomLevelASVkImpl& BLAS,
         {
             BLAS.SetState(NewState);
         }
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.Transitions);
+    }
+    else
+    {
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.TransitionsSkipped);
     }
 }
 
@@ -3176,6 +4279,11 @@ void DeviceContextVkImpl::TransitionTLASState(TopLevelASVkImpl& TLAS,
         {
             TLAS.SetState(NewState);
         }
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.Transitions);
+    }
+    else
+    {
+        DILIGENT_UPDATE_CONTEXT_STATS(++m_Stats.BarrierCounters.TransitionsSkipped);
     }
 }
 
@@ -3228,9 +4336,14 @@ void DeviceContextVkImpl::TransitionOrVerifyTLASState(TopLevelASVkImpl&
 
 VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment)
 {
+    DEV_CHECK_ERR(!m_IsReusableCmdList,
+                  "Dynamic memory is released at the end of the frame and can't be used by reusable command lists. "
+                  "Dynamic buffers as well as buffer and texture updates are not allowed in a reusable command list.");
     DEV_CHECK_ERR(SizeInBytes < std::numeric_limits<Uint32>::max(),
                   "Dynamic allocation size must be less than 2^32");
 
+    DILIGENT_UPDATE_CONTEXT_STATS(m_Stats.AllocationCounters.DynamicHeapBytes += SizeInBytes);
+
     auto DynAlloc = m_DynamicHeap.Allocate(static_cast<Uint32>(SizeInBytes), Alignment);
 #ifdef DILIGENT_DEVELOPMENT
     DynAlloc.dvpFrameNumber = GetFrameNumber();
@@ -3240,6 +4353,8 @@ VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInB
 
 void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Transition);
+
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
 
     if (BarrierCount == 0)
@@ -3255,8 +4370,8 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
 #endif
         if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
         {
-            // Skip begin-split barriers
             VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            BeginSplitBarrier(Barrier);
             continue;
         }
         if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
@@ -3267,6 +4382,33 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
         {
             VERIFY(Barrier.TransitionType == STATE_TRANSITION_TYPE_IMMEDIATE || Barrier.TransitionType == STATE_TRANSITION_TYPE_END, "Unexpected barrier type");
 
+            // The end half of the split barrier waits for the event set by the begin half.
+            // If there is no matching begin-split barrier, the transition is performed immediately.
+            VulkanUtilities::EventWrapper SplitBarrierEvent;
+            RESOURCE_STATE                OldState = Barrier.OldState;
+            if (Barrier.TransitionType == STATE_TRANSITION_TYPE_END)
+            {
+                auto it = m_PendingSplitBarriers.find(Barrier.pResource);
+                if (it != m_PendingSplitBarriers.end())
+                {
+                    DEV_CHECK_ERR(it->second.NewState == Barrier.NewState, "New state ", GetResourceStateString(Barrier.NewState),
+                                  " of the end-split barrier does not match the new state ", GetResourceStateString(it->second.NewState),
+                                  " of the begin-split barrier");
+                    DEV_CHECK_ERR(OldState == RESOURCE_STATE_UNKNOWN || OldState == it->second.OldState, "Old state ", GetResourceStateString(OldState),
+                                  " of the end-split barrier does not match the old state ", GetResourceStateString(it->second.OldState),
+                                  " of the begin-split barrier");
+                    // The wait must use the same source stages as the event was set with
+                    OldState          = it->second.OldState;
+                    SplitBarrierEvent = std::move(it->second.Event);
+                    m_PendingSplitBarriers.erase(it);
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("End-split barrier for resource '", Barrier.pResource->GetDesc().Name,
+                                      "' does not have a matching begin-split barrier recorded in the same command buffer. The transition will be performed immediately.");
+                }
+            }
+
             if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
             {
                 VkImageSubresourceRange SubResRange;
@@ -3275,11 +4417,11 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
                 SubResRange.levelCount     = (Barrier.MipLevelsCount == REMAINING_MIP_LEVELS) ? VK_REMAINING_MIP_LEVELS : Barrier.MipLevelsCount;
                 SubResRange.baseArrayLayer = Barrier.FirstArraySlice;
                 SubResRange.layerCount     = (Barrier.ArraySliceCount == REMAINING_ARRAY_SLICES) ? VK_REMAINING_ARRAY_LAYERS : Barrier.ArraySliceCount;
-                TransitionTextureState(*pTexture, Barrier.OldState, Barrier.NewState, Barrier.Flags, &SubResRange);
+                TransitionTextureState(*pTexture, OldState, Barrier.NewState, Barrier.Flags, &SubResRange, SplitBarrierEvent);
             }
             else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
             {
-                TransitionBufferState(*pBuffer, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+                TransitionBufferState(*pBuffer, OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0, SplitBarrierEvent);
             }
             else if (RefCntAutoPtr<BottomLevelASVkImpl> pBottomLevelAS{Barrier.pResource, IID_BottomLevelAS})
             {
@@ -3293,10 +4435,68 @@ void DeviceContextVkImpl::TransitionResourceStates(Uint32 BarrierCount, const St
             {
                 UNEXPECTED("unsupported resource type");
             }
+
+            if (SplitBarrierEvent != VK_NULL_HANDLE)
+                m_pDevice->SafeReleaseDeviceObject(std::move(SplitBarrierEvent), Uint64{1} << GetExecutionCtxId());
         }
     }
 }
 
+void DeviceContextVkImpl::BeginSplitBarrier(const StateTransitionDesc& Barrier)
+{
+    RESOURCE_STATE OldState = Barrier.OldState;
+    if (OldState == RESOURCE_STATE_UNKNOWN)
+    {
+        if (RefCntAutoPtr<TextureVkImpl> pTexture{Barrier.pResource, IID_TextureVk})
+            OldState = pTexture->IsInKnownState() ? pTexture->GetState() : RESOURCE_STATE_UNKNOWN;
+        else if (RefCntAutoPtr<BufferVkImpl> pBuffer{Barrier.pResource, IID_BufferVk})
+            OldState = pBuffer->IsInKnownState() ? pBuffer->GetState() : RESOURCE_STATE_UNKNOWN;
+        else
+            UNEXPECTED("Split barriers are only supported for textures and buffers");
+
+        if (OldState == RESOURCE_STATE_UNKNOWN)
+        {
+            LOG_ERROR_MESSAGE("Failed to begin split barrier for resource '", Barrier.pResource->GetDesc().Name,
+                              "' because the resource state is unknown and is not explicitly specified");
+            return;
+        }
+    }
+
+    if (m_PendingSplitBarriers.find(Barrier.pResource) != m_PendingSplitBarriers.end())
+    {
+        LOG_ERROR_MESSAGE("Resource '", Barrier.pResource->GetDesc().Name, "' already has a pending split barrier");
+        return;
+    }
+
+    VkEventCreateInfo EventCI{};
+    EventCI.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+    EventCI.pNext = nullptr;
+    EventCI.flags = 0;
+
+    PendingSplitBarrier SplitBarrier;
+    SplitBarrier.pResource = Barrier.pResource;
+    SplitBarrier.OldState  = OldState;
+    SplitBarrier.NewState  = Barrier.NewState;
+    SplitBarrier.Event     = m_pDevice->GetLogicalDevice().CreateEvent(EventCI, "Split barrier event");
+
+    // The end half of the barrier must wait for the same stages that the event is set for, so
+    // the event is set after all commands that access the resource in the old state.
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.SetEvent(SplitBarrier.Event, ResourceStateFlagsToVkPipelineStageFlags(OldState));
+    ++m_State.NumCommands;
+
+    m_PendingSplitBarriers.emplace(Barrier.pResource, std::move(SplitBarrier));
+}
+
+void DeviceContextVkImpl::ReleasePendingSplitBarriers()
+{
+    DEV_CHECK_ERR(m_PendingSplitBarriers.empty(), "There are ", m_PendingSplitBarriers.size(),
+                  " split barriers that have not been ended. Split barriers must be ended in the same command buffer they were begun.");
+    for (auto& it : m_PendingSplitBarriers)
+        m_pDevice->SafeReleaseDeviceObject(std::move(it.second.Event), Uint64{1} << GetExecutionCtxId());
+    m_PendingSplitBarriers.clear();
+}
+
 void DeviceContextVkImpl::AliasingBarrier(IDeviceObject* pResourceBefore, IDeviceObject* pResourceAfter)
 {
     auto GetResourceBindFlags = [](IDeviceObject* pResource) //
@@ -3387,24 +4587,32 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
 {
     TDeviceContextBase::BuildBLAS(Attribs, 0);
 
-    auto* pBLASVk    = ClassPtrCast<BottomLevelASVkImpl>(Attribs.pBLAS);
-    auto* pScratchVk = ClassPtrCast<BufferVkImpl>(Attribs.pScratchBuffer);
-    auto& BLASDesc   = pBLASVk->GetDesc();
+    auto* pBLASVk  = ClassPtrCast<BottomLevelASVkImpl>(Attribs.pBLAS);
+    auto& BLASDesc = pBLASVk->GetDesc();
+
+    RESOURCE_STATE_TRANSITION_MODE ScratchTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+
+    const auto Scratch = GetASBuildScratchSpace(Attribs, pBLASVk->GetScratchBufferSizes(), ScratchTransitionMode);
+    if (Scratch.pBuffer == nullptr)
+        return;
+    auto* pScratchVk = ClassPtrCast<BufferVkImpl>(Scratch.pBuffer);
 
     EnsureVkCmdBuffer();
 
     const char* OpName = "Build BottomLevelAS (DeviceContextVkImpl::BuildBLAS)";
     TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
-    TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
+    TransitionOrVerifyBufferState(*pScratchVk, ScratchTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
-    VkAccelerationStructureBuildGeometryInfoKHR           vkASBuildInfo = {};
-    std::vector<VkAccelerationStructureBuildRangeInfoKHR> vkRanges;
-    std::vector<VkAccelerationStructureGeometryKHR>       vkGeometries;
+    VkAccelerationStructureBuildGeometryInfoKHR vkASBuildInfo = {};
+    VkAccelerationStructureBuildRangeInfoKHR*   vkRanges      = nullptr;
+    VkAccelerationStructureGeometryKHR*         vkGeometries  = nullptr;
+    Uint32                                      GeometryCount = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        vkGeometries.resize(Attribs.TriangleDataCount);
-        vkRanges.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        vkGeometries  = AllocateFrameArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = AllocateFrameArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -3488,8 +4696,9 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        vkGeometries.resize(Attribs.BoxDataCount);
-        vkRanges.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        vkGeometries  = AllocateFrameArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = AllocateFrameArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -3531,7 +4740,7 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
         }
     }
 
-    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges.data();
+    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges;
 
     vkASBuildInfo.sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
     vkASBuildInfo.type                      = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;                 // type must be compatible with create info
@@ -3539,10 +4748,10 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     vkASBuildInfo.mode                      = Attribs.Update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
     vkASBuildInfo.srcAccelerationStructure  = Attribs.Update ? pBLASVk->GetVkBLAS() : VK_NULL_HANDLE;
     vkASBuildInfo.dstAccelerationStructure  = pBLASVk->GetVkBLAS();
-    vkASBuildInfo.geometryCount             = static_cast<uint32_t>(vkGeometries.size());
-    vkASBuildInfo.pGeometries               = vkGeometries.data();
+    vkASBuildInfo.geometryCount             = GeometryCount;
+    vkASBuildInfo.pGeometries               = vkGeometries;
     vkASBuildInfo.ppGeometries              = nullptr;
-    vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Attribs.ScratchBufferOffset;
+    vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Scratch.Offset;
 
     const auto& ASLimits = m_pDevice->GetPhysicalDevice().GetExtProperties().AccelStruct;
     VERIFY(vkASBuildInfo.scratchData.deviceAddress % ASLimits.minAccelerationStructureScratchOffsetAlignment == 0, "Scratch buffer start address is not properly aligned");
@@ -3563,19 +4772,25 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     static_assert(TLAS_INSTANCE_DATA_SIZE == sizeof(VkAccelerationStructureInstanceKHR), "Value in TLAS_INSTANCE_DATA_SIZE doesn't match the actual instance description size");
 
     auto* pTLASVk      = ClassPtrCast<TopLevelASVkImpl>(Attribs.pTLAS);
-    auto* pScratchVk   = ClassPtrCast<BufferVkImpl>(Attribs.pScratchBuffer);
     auto* pInstancesVk = ClassPtrCast<BufferVkImpl>(Attribs.pInstanceBuffer);
     auto& TLASDesc     = pTLASVk->GetDesc();
 
+    RESOURCE_STATE_TRANSITION_MODE ScratchTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+
+    const auto Scratch = GetASBuildScratchSpace(Attribs, pTLASVk->GetScratchBufferSizes(), ScratchTransitionMode);
+    if (Scratch.pBuffer == nullptr)
+        return;
+    auto* pScratchVk = ClassPtrCast<BufferVkImpl>(Scratch.pBuffer);
+
     EnsureVkCmdBuffer();
 
     const char* OpName = "Build TopLevelAS (DeviceContextVkImpl::BuildTLAS)";
     TransitionOrVerifyTLASState(*pTLASVk, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
-    TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
+    TransitionOrVerifyBufferState(*pScratchVk, ScratchTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
     if (Attribs.Update)
     {
-        if (!pTLASVk->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
+        if (!pTLASVk->UpdateInstances(Attribs.pInstances, Attribs.InstanceCount, Attribs.FirstInstanceToUpdate, Attribs.BaseContributionToHitGroupIndex, Attribs.HitGroupStride, Attribs.BindingMode))
             return;
     }
     else
@@ -3586,28 +4801,32 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
 
     // copy instance data into instance buffer
     {
+        // Only the updated range of the instances is written to the instance buffer
+        const Uint32 FirstInstance = Attribs.Update ? Attribs.FirstInstanceToUpdate : 0;
+        const Uint64 DstOffset     = Attribs.InstanceBufferOffset + Uint64{FirstInstance} * sizeof(VkAccelerationStructureInstanceKHR);
+
         size_t Size     = Attribs.InstanceCount * sizeof(VkAccelerationStructureInstanceKHR);
         auto   TmpSpace = m_UploadHeap.Allocate(Size, 16);
 
         for (Uint32 i = 0; i < Attribs.InstanceCount; ++i)
         {
-            const auto& Inst     = Attribs.pInstances[i];
-            const auto  InstDesc = pTLASVk->GetInstanceDesc(Inst.InstanceName);
-
-            if (InstDesc.InstanceIndex >= Attribs.InstanceCount)
+            const auto& Inst = Attribs.pInstances[i];
+            // Instances are stored in the order they were given when the TLAS was built
+            const Uint32 InstIndex = Attribs.Update ? pTLASVk->FindInstanceIndex(Inst, FirstInstance + i) : i;
+            if (InstIndex < FirstInstance || InstIndex - FirstInstance >= Attribs.InstanceCount)
             {
-                UNEXPECTED("Failed to find instance by name");
+                UNEXPECTED("Failed to find instance");
                 return;
             }
 
-            auto& vkASInst = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress)[InstDesc.InstanceIndex];
+            auto& vkASInst = static_cast<VkAccelerationStructureInstanceKHR*>(TmpSpace.CPUAddress)[InstIndex - FirstInstance];
             auto* pBLASVk  = ClassPtrCast<BottomLevelASVkImpl>(Inst.pBLAS);
 
             static_assert(sizeof(vkASInst.transform) == sizeof(Inst.Transform), "size mismatch");
             std::memcpy(&vkASInst.transform, Inst.Transform.data, sizeof(vkASInst.transform));
 
             vkASInst.instanceCustomIndex                    = Inst.CustomId;
-            vkASInst.instanceShaderBindingTableRecordOffset = InstDesc.ContributionToHitGroupIndex;
+            vkASInst.instanceShaderBindingTableRecordOffset = pTLASVk->GetInstanceContributionToHitGroupIndex(InstIndex);
             vkASInst.mask                                   = Inst.Mask;
             vkASInst.flags                                  = InstanceFlagsToVkGeometryInstanceFlags(Inst.Flags);
             vkASInst.accelerationStructureReference         = pBLASVk->GetVkDeviceAddress();
@@ -3615,7 +4834,7 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
             TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
         }
 
-        UpdateBufferRegion(pInstancesVk, Attribs.InstanceBufferOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
+        UpdateBufferRegion(pInstancesVk, DstOffset, Size, TmpSpace.vkBuffer, TmpSpace.AlignedOffset, Attribs.InstanceBufferTransitionMode);
     }
     TransitionOrVerifyBufferState(*pInstancesVk, Attribs.InstanceBufferTransitionMode, RESOURCE_STATE_BUILD_AS_READ, VK_ACCESS_SHADER_READ_BIT, OpName);
 
@@ -3624,7 +4843,7 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     VkAccelerationStructureBuildRangeInfoKHR const* vkRangePtr    = &vkRange;
     VkAccelerationStructureGeometryKHR              vkASGeometry  = {};
 
-    vkRange.primitiveCount = Attribs.InstanceCount;
+    vkRange.primitiveCount = pTLASVk->GetBuildInfo().InstanceCount;
 
     vkASGeometry.sType        = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
     vkASGeometry.pNext        = nullptr;
@@ -3649,7 +4868,7 @@ void DeviceContextVkImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
     vkASBuildInfo.geometryCount             = 1;
     vkASBuildInfo.pGeometries               = &vkASGeometry;
     vkASBuildInfo.ppGeometries              = nullptr;
-    vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Attribs.ScratchBufferOffset;
+    vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Scratch.Offset;
 
     const auto& ASLimits = m_pDevice->GetPhysicalDevice().GetExtProperties().AccelStruct;
     VERIFY(vkASBuildInfo.scratchData.deviceAddress % ASLimits.minAccelerationStructureScratchOffsetAlignment == 0, "Scratch buffer start address is not properly aligned");
@@ -3733,9 +4952,10 @@ void DeviceContextVkImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAtt
     TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
     TransitionOrVerifyBufferState(*pDestBuffVk, Attribs.BufferTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, OpName);
 
-    m_CommandBuffer.ResetQueryPool(m_ASQueryPool, QueryIndex, 1);
-    m_CommandBuffer.WriteAccelerationStructuresProperties(pBLASVk->GetVkBLAS(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, m_ASQueryPool, QueryIndex);
-    m_CommandBuffer.CopyQueryPoolResults(m_ASQueryPool, QueryIndex, 1, pDestBuffVk->GetVkBuffer(), Attribs.DestBufferOffset, sizeof(Uint64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    const VkQueryPool vkASQueryPool = GetASCompactedSizeQueryPool();
+    m_CommandBuffer.ResetQueryPool(vkASQueryPool, QueryIndex, 1);
+    m_CommandBuffer.WriteAccelerationStructuresProperties(pBLASVk->GetVkBLAS(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, vkASQueryPool, QueryIndex);
+    m_CommandBuffer.CopyQueryPoolResults(vkASQueryPool, QueryIndex, 1, pDestBuffVk->GetVkBuffer(), Attribs.DestBufferOffset, sizeof(Uint64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
     ++m_State.NumCommands;
 }
 
@@ -3753,16 +4973,20 @@ void DeviceContextVkImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAtt
     TransitionOrVerifyTLASState(*pTLASVk, Attribs.TLASTransitionMode, RESOURCE_STATE_BUILD_AS_READ, OpName);
     TransitionOrVerifyBufferState(*pDestBuffVk, Attribs.BufferTransitionMode, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, OpName);
 
-    m_CommandBuffer.ResetQueryPool(m_ASQueryPool, QueryIndex, 1);
-    m_CommandBuffer.WriteAccelerationStructuresProperties(pTLASVk->GetVkTLAS(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, m_ASQueryPool, QueryIndex);
-    m_CommandBuffer.CopyQueryPoolResults(m_ASQueryPool, QueryIndex, 1, pDestBuffVk->GetVkBuffer(), Attribs.DestBufferOffset, sizeof(Uint64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    const VkQueryPool vkASQueryPool = GetASCompactedSizeQueryPool();
+    m_CommandBuffer.ResetQueryPool(vkASQueryPool, QueryIndex, 1);
+    m_CommandBuffer.WriteAccelerationStructuresProperties(pTLASVk->GetVkTLAS(), VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR, vkASQueryPool, QueryIndex);
+    m_CommandBuffer.CopyQueryPoolResults(vkASQueryPool, QueryIndex, 1, pDestBuffVk->GetVkBuffer(), Attribs.DestBufferOffset, sizeof(Uint64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
     ++m_State.NumCommands;
 }
 
-void DeviceContextVkImpl::CreateASCompactedSizeQueryPool()
+VkQueryPool DeviceContextVkImpl::GetASCompactedSizeQueryPool()
 {
-    if (m_pDevice->GetFeatures().RayTracing == DEVICE_FEATURE_STATE_ENABLED)
+    // The pool is created on first use as most applications never query compacted AS size
+    if (m_ASQueryPool == VK_NULL_HANDLE)
     {
+        VERIFY_EXPR(m_pDevice->GetFeatures().RayTracing == DEVICE_FEATURE_STATE_ENABLED);
+
         const auto&           LogicalDevice = m_pDevice->GetLogicalDevice();
         VkQueryPoolCreateInfo Info          = {};
 
@@ -3772,6 +4996,24 @@ void DeviceContextVkImpl::CreateASCompactedSizeQueryPool()
 
         m_ASQueryPool = LogicalDevice.CreateQueryPool(Info, "AS Compacted Size Query");
     }
+    return m_ASQueryPool;
+}
+
+VkBuffer DeviceContextVkImpl::GetDummyVertexBuffer()
+{
+    // The buffer is created on first use as null vertex buffers are rarely bound
+    if (!m_DummyVB)
+    {
+        BufferDesc DummyVBDesc;
+        DummyVBDesc.Name      = "Dummy vertex buffer";
+        DummyVBDesc.BindFlags = BIND_VERTEX_BUFFER;
+        DummyVBDesc.Usage     = USAGE_DEFAULT;
+        DummyVBDesc.Size      = 32;
+        RefCntAutoPtr<IBuffer> pDummyVB;
+        m_pDevice->CreateBuffer(DummyVBDesc, nullptr, &pDummyVB);
+        m_DummyVB = pDummyVB.RawPtr<BufferVkImpl>();
+    }
+    return m_DummyVB->GetVkBuffer();
 }
 
 void DeviceContextVkImpl::TraceRays(const TraceRaysAttribs& Attribs)
@@ -3815,26 +5057,18 @@ void DeviceContextVkImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndir
     ShaderBindingTableVkImpl::BindingTable HitGroupTable       = {};
     ShaderBindingTableVkImpl::BindingTable CallableShaderTable = {};
 
-    pSBTVk->GetData(pSBTBufferVk, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable);
+    std::vector<ShaderBindingTableVkImpl::BufferUpdateRange> UpdateRanges;
+    pSBTVk->GetData(pSBTBufferVk, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable, UpdateRanges);
 
     const char* OpName = "Update shader binding table (DeviceContextVkImpl::UpdateSBT)";
 
-    if (RayGenShaderRecord.pData || MissShaderTable.pData || HitGroupTable.pData || CallableShaderTable.pData)
+    if (!UpdateRanges.empty())
     {
         TransitionOrVerifyBufferState(*pSBTBufferVk, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_COPY_DEST, VK_ACCESS_TRANSFER_WRITE_BIT, OpName);
 
-        // Buffer ranges do not intersect, so we don't need to add barriers between them
-        if (RayGenShaderRecord.pData)
-            UpdateBuffer(pSBTBufferVk, RayGenShaderRecord.Offset, RayGenShaderRecord.Size, RayGenShaderRecord.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (MissShaderTable.pData)
-            UpdateBuffer(pSBTBufferVk, MissShaderTable.Offset, MissShaderTable.Size, MissShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (HitGroupTable.pData)
-            UpdateBuffer(pSBTBufferVk, HitGroupTable.Offset, HitGroupTable.Size, HitGroupTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-
-        if (CallableShaderTable.pData)
-            UpdateBuffer(pSBTBufferVk, CallableShaderTable.Offset, CallableShaderTable.Size, CallableShaderTable.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        // Only the modified records are uploaded. Buffer ranges do not intersect, so we don't need to add barriers between them.
+        for (const auto& Range : UpdateRanges)
+            UpdateBuffer(pSBTBufferVk, Range.Offset, Range.Size, Range.pData, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
 
         TransitionOrVerifyBufferState(*pSBTBufferVk, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_RAY_TRACING, VK_ACCESS_SHADER_READ_BIT, OpName);
     }
@@ -3856,7 +5090,7 @@ void DeviceContextVkImpl::BeginDebugGroup(const Char* Name, const float* pColor)
     if (pColor != nullptr)
         memcpy(Info.color, pColor, sizeof(Info.color));
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
     m_CommandBuffer.BeginDebugUtilsLabel(Info);
 }
 
@@ -3864,7 +5098,7 @@ void DeviceContextVkImpl::EndDebugGroup()
 {
     TDeviceContextBase::EndDebugGroup(0);
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
     m_CommandBuffer.EndDebugUtilsLabel();
 }
 
@@ -3879,7 +5113,7 @@ void DeviceContextVkImpl::InsertDebugLabel(const Char* Label, const float* pColo
     if (pColor != nullptr)
         memcpy(Info.color, pColor, sizeof(Info.color));
 
-    EnsureVkCmdBuffer();
+    EnsureVkCmdBuffer(/*FlushClears = */ false);
     m_CommandBuffer.InsertDebugUtilsLabel(Info);
 }
 
@@ -3896,7 +5130,7 @@ void DeviceContextVkImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COM
                 ShadingRateCombinerToVkFragmentShadingRateCombinerOp(TextureCombiner) //
             };
 
-        EnsureVkCmdBuffer();
+        EnsureVkCmdBuffer(/*FlushClears = */ false);
         m_CommandBuffer.SetFragmentShadingRate(ShadingRateToVkFragmentSize(BaseRate), CombinerOps);
         m_State.ShadingRateIsSet = true;
     }
@@ -41,6 +41,7 @@
 #include "EngineFactoryBase.hpp"
 #include "VulkanTypeConversions.hpp"
 #include "DearchiverVkImpl.hpp"
+#include "CPUProfiler.hpp"
 
 #if PLATFORM_ANDROID
 #    include "FileSystem.hpp"
@@ -155,6 +156,7 @@ GraphicsAdapterInfo GetPhysicalDeviceGraphicsAdapterInfo(const VulkanUtilities::
         AdapterInfo.VendorId   = vkDeviceProps.vendorID;
         AdapterInfo.DeviceId   = vkDeviceProps.deviceID;
         AdapterInfo.NumOutputs = 0;
+        AdapterInfo.NumNodes   = PhysicalDevice.GetDeviceGroupSize();
     }
 
     // Label all enabled features as optional
@@ -266,7 +268,9 @@ GraphicsAdapterInfo GetPhysicalDeviceGraphicsAdapterInfo(const VulkanUtilities::
         MeshProps.MaxThreadGroupCountY     = vkDeviceExtProps.MeshShader.maxMeshWorkGroupCount[1];
         MeshProps.MaxThreadGroupCountZ     = vkDeviceExtProps.MeshShader.maxMeshWorkGroupCount[2];
         MeshProps.MaxThreadGroupTotalCount = vkDeviceExtProps.MeshShader.maxMeshWorkGroupTotalCount;
-        ASSERT_SIZEOF(MeshProps, 16, "Did you add a new member to MeshShaderProperties? Please initialize it here.");
+        MeshProps.MaxOutputVertices        = vkDeviceExtProps.MeshShader.maxMeshOutputVertices;
+        MeshProps.MaxOutputPrimitives      = vkDeviceExtProps.MeshShader.maxMeshOutputPrimitives;
+        ASSERT_SIZEOF(MeshProps, 24, "Did you add a new member to MeshShaderProperties? Please initialize it here.");
     }
 
     // Compute shader properties
@@ -645,6 +649,8 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
 
     SetRawAllocator(EngineCI.pRawMemAllocator);
 
+    DILIGENT_PROFILE_FUNCTION();
+
     try
     {
         const auto GraphicsAPIVersion = EngineCI.GraphicsAPIVersion == Version{0, 0} ?
@@ -1072,7 +1078,10 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.TimelineSemaphore.pNext;
             }
 
-            if (EnabledFeatures.TransferQueueTimestampQueries != DEVICE_FEATURE_STATE_DISABLED)
+            // Host query reset is required for transfer queue timestamp queries. It is also enabled whenever
+            // it is available so that the query manager never records reset commands into command buffers.
+            if (EnabledFeatures.TransferQueueTimestampQueries != DEVICE_FEATURE_STATE_DISABLED ||
+                DeviceExtFeatures.HostQueryReset.hostQueryReset != VK_FALSE)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME));
                 DeviceExtensions.push_back(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
@@ -1162,6 +1171,180 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.ShaderDrawParameters.pNext;
             }
 
+            if (EnabledFeatures.DynamicRenderState != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+
+                EnabledExtFeats.ExtendedDynamicState = DeviceExtFeatures.ExtendedDynamicState;
+
+                *NextExt = &EnabledExtFeats.ExtendedDynamicState;
+                NextExt  = &EnabledExtFeats.ExtendedDynamicState.pNext;
+            }
+
+            if (EnabledFeatures.ConditionalRendering != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+
+                EnabledExtFeats.ConditionalRendering = DeviceExtFeatures.ConditionalRendering;
+                // Conditional rendering is never inherited by secondary command buffers
+                EnabledExtFeats.ConditionalRendering.inheritedConditionalRendering = VK_FALSE;
+
+                *NextExt = &EnabledExtFeats.ConditionalRendering;
+                NextExt  = &EnabledExtFeats.ConditionalRendering.pNext;
+            }
+
+#if DILIGENT_USE_VOLK
+            // Dynamic rendering is used in place of implicit render passes and framebuffers.
+            // The extension depends on VK_KHR_depth_stencil_resolve and VK_KHR_create_renderpass2,
+            // so only enable it on Vulkan 1.2+ devices where these extensions are core.
+            if (DeviceExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE && PhysicalDevice->GetVkVersion() >= VK_API_VERSION_1_2)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+
+                EnabledExtFeats.DynamicRendering = DeviceExtFeatures.DynamicRendering;
+
+                *NextExt = &EnabledExtFeats.DynamicRendering;
+                NextExt  = &EnabledExtFeats.DynamicRendering.pNext;
+            }
+
+            // Synchronization2 is used to record all pending barriers with a single vkCmdPipelineBarrier2KHR
+            // call that keeps per-barrier stage and access masks.
+            if (DeviceExtFeatures.Synchronization2.synchronization2 != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+                EnabledExtFeats.Synchronization2 = DeviceExtFeatures.Synchronization2;
+
+                *NextExt = &EnabledExtFeats.Synchronization2;
+                NextExt  = &EnabledExtFeats.Synchronization2.pNext;
+            }
+
+            // Descriptor buffers replace descriptor set allocation and vkUpdateDescriptorSets: descriptors
+            // are written directly into the dynamic heap buffer. The extension requires buffer device address,
+            // synchronization2 and descriptor indexing, so only enable it on Vulkan 1.2+ devices.
+            // The whole dynamic heap buffer must be addressable as both resource and sampler descriptor buffer.
+            {
+                const auto& DescrBufferProps = PhysicalDevice->GetExtProperties().DescriptorBuffer;
+                const auto  DynamicHeapSize  = VkDeviceSize{EngineCI.DynamicHeapSize};
+                if (DeviceExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE &&
+                    DeviceExtFeatures.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE &&
+                    EnabledExtFeats.Synchronization2.synchronization2 != VK_FALSE &&
+                    PhysicalDevice->GetVkVersion() >= VK_API_VERSION_1_2 &&
+                    DescrBufferProps.combinedImageSamplerDescriptorSingleArray != VK_FALSE &&
+                    DynamicHeapSize <= DescrBufferProps.maxResourceDescriptorBufferRange &&
+                    DynamicHeapSize <= DescrBufferProps.maxSamplerDescriptorBufferRange &&
+                    DynamicHeapSize <= DescrBufferProps.resourceDescriptorBufferAddressSpaceSize &&
+                    DynamicHeapSize <= DescrBufferProps.samplerDescriptorBufferAddressSpaceSize)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                    if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                    {
+                        // Buffer device address has not been enabled by ray tracing
+                        VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME));
+                        DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+                        EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                        *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                        NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                    }
+
+                    EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                    // disable unused features
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay  = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors = VK_FALSE;
+
+                    *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                    NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+                }
+            }
+
+            // Push descriptors are only used for dynamic variables when requested by the application.
+            // Descriptor buffers do not allocate descriptor sets, so push descriptors are not needed with them.
+            if (EngineCI.UsePushDescriptors &&
+                DeviceExtFeatures.PushDescriptor &&
+                EnabledExtFeats.DescriptorBuffer.descriptorBuffer == VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+                EnabledExtFeats.PushDescriptor = true;
+            }
+
+            // Memory budget lets the memory manager take the heap budget into account when allocating new pages.
+            if (DeviceExtFeatures.MemoryBudget)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+                EnabledExtFeats.MemoryBudget = true;
+            }
+
+            // Dedicated allocations are used for resources for which the driver prefers them.
+            if (DeviceExtFeatures.DedicatedAllocation)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
+                EnabledExtFeats.DedicatedAllocation = true;
+            }
+
+            // Graphics pipeline libraries let pipelines that share shaders or fixed-function state reuse
+            // the previously compiled parts. Libraries are only used for pipelines created for dynamic rendering.
+            if (DeviceExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE &&
+                EnabledExtFeats.DynamicRendering.dynamicRendering != VK_FALSE)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            // Shader objects can only be used with dynamic rendering
+            if (EnabledFeatures.ShaderObjects != DEVICE_FEATURE_STATE_DISABLED)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME));
+                VERIFY_EXPR(EnabledExtFeats.DynamicRendering.dynamicRendering != VK_FALSE);
+                DeviceExtensions.push_back(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+
+                EnabledExtFeats.ShaderObject = DeviceExtFeatures.ShaderObject;
+
+                *NextExt = &EnabledExtFeats.ShaderObject;
+                NextExt  = &EnabledExtFeats.ShaderObject.pNext;
+            }
+
+            // Present id and present wait let swap chains pace the frames and measure the frame latency.
+            if (DeviceExtFeatures.PresentId.presentId != VK_FALSE &&
+                DeviceExtFeatures.PresentWait.presentWait != VK_FALSE &&
+                Instance->IsExtensionEnabled(VK_KHR_SURFACE_EXTENSION_NAME))
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PRESENT_ID_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PRESENT_WAIT_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
+                EnabledExtFeats.PresentId   = DeviceExtFeatures.PresentId;
+                EnabledExtFeats.PresentWait = DeviceExtFeatures.PresentWait;
+
+                *NextExt = &EnabledExtFeats.PresentId;
+                NextExt  = &EnabledExtFeats.PresentId.pNext;
+
+                *NextExt = &EnabledExtFeats.PresentWait;
+                NextExt  = &EnabledExtFeats.PresentWait.pNext;
+            }
+#endif
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -1171,7 +1354,7 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 LOG_ERROR_MESSAGE("Can not enable extended device features when VK_KHR_get_physical_device_properties2 extension is not supported by device");
         }
 
-        ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+        ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
         for (Uint32 i = 0; i < EngineCI.DeviceExtensionCount; ++i)
         {
@@ -1293,16 +1476,18 @@ void EngineFactoryVkImpl::AttachToVulkanDevice(std::shared_ptr<VulkanUtilities::
     {
         auto& RawMemAllocator = GetRawAllocator();
 
-        RenderDeviceVkImpl* pRenderDeviceVk{
-            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceVkImpl instance", RenderDeviceVkImpl)(
-                RawMemAllocator, this, EngineCI, AdapterInfo, CommandQueueCount, ppCommandQueues, Instance, std::move(PhysicalDevice), LogicalDevice) //
-        };
+        RenderDeviceVkImpl* pRenderDeviceVk = nullptr;
+        {
+            DILIGENT_PROFILE_ZONE("Create RenderDeviceVkImpl");
+            pRenderDeviceVk = NEW_RC_OBJ(RawMemAllocator, "RenderDeviceVkImpl instance", RenderDeviceVkImpl)(
+                RawMemAllocator, this, EngineCI, AdapterInfo, CommandQueueCount, ppCommandQueues, Instance, std::move(PhysicalDevice), LogicalDevice);
+        }
         pRenderDeviceVk->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
 
         if (m_OnRenderDeviceCreated != nullptr)
             m_OnRenderDeviceCreated(pRenderDeviceVk);
 
-
+        DILIGENT_PROFILE_ZONE("Create DeviceContextVkImpl instances");
 
         for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
         {
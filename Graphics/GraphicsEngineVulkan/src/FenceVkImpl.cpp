@@ -49,8 +49,10 @@ FenceVkImpl::FenceVkImpl(IReferenceCounters* pRefCounters,
     }
 // clang-format on
 {
-    if (m_Desc.Type == FENCE_TYPE_GENERAL &&
-        pRenderDeviceVkImpl->GetFeatures().NativeFence)
+    // All fences, including CPU-wait-only and internal command queue fences, use timeline semaphores
+    // when they are available. Command queues do not create sync points in this mode, so a fence
+    // emulated with binary fences would never be signaled.
+    if (pRenderDeviceVkImpl->GetFeatures().NativeFence)
     {
         const auto& LogicalDevice = pRenderDeviceVkImpl->GetLogicalDevice();
         m_TimelineSemaphore       = LogicalDevice.CreateTimelineSemaphore(0, m_Desc.Name);
@@ -177,7 +179,23 @@ void FenceVkImpl::Reset(Uint64 Value)
 {
     if (IsTimelineSemaphore())
     {
-        DEV_ERROR("Reset() is not supported for timeline semaphore");
+        // Timeline semaphore can't be reset, but it can be advanced on the host.
+        // The caller must guarantee that there are no pending signal operations.
+        const auto CompletedValue = GetCompletedValue();
+        DEV_CHECK_ERR(Value >= CompletedValue, "Resetting fence '", m_Desc.Name, "' to the value (", Value, ") that is smaller than the last completed value (", CompletedValue, ")");
+        if (Value > CompletedValue)
+        {
+            VkSemaphoreSignalInfo SignalInfo{};
+            SignalInfo.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+            SignalInfo.pNext     = nullptr;
+            SignalInfo.semaphore = m_TimelineSemaphore;
+            SignalInfo.value     = Value;
+
+            const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
+            auto        err           = LogicalDevice.SignalSemaphore(SignalInfo);
+            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to signal timeline semaphore");
+            (void)err;
+        }
     }
     else
     {
@@ -311,4 +329,9 @@ void FenceVkImpl::AddPendingSyncPoint(SoftwareQueueIndex CommandQueueId, Uint64
     m_SyncPoints.push_back({Value, std::move(SyncPoint)});
 }
 
+void FenceVkImpl::RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    m_pDevice->GetFenceCallbackThread().RegisterCallback(this, Value, Callback, pUserData);
+}
+
 } // namespace Diligent
@@ -62,9 +62,8 @@ size_t FramebufferCache::FramebufferCacheKey::GetHash() const
 {
     if (Hash == 0)
     {
-        Hash = ComputeHash(Pass, NumRenderTargets, DSV, ShadingRate, CommandQueueMask);
-        for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
-            HashCombine(Hash, RTVs[rt]);
+        Hash = ComputeHash(Pass, NumRenderTargets, DSV, ShadingRate, CommandQueueMask,
+                           ComputeHashRaw(RTVs, sizeof(RTVs[0]) * NumRenderTargets));
     }
     return Hash;
 }
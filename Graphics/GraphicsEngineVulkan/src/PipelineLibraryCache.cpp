@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineLibraryCache.hpp"
+
+#include "RenderDeviceVkImpl.hpp"
+#include "PipelineResourceSignatureVkImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineLibraryCache::PipelineLibraryCache(RenderDeviceVkImpl& DeviceVk) noexcept :
+    m_DeviceVkImpl{DeviceVk}
+{}
+
+PipelineLibraryCache::~PipelineLibraryCache()
+{
+    // Pipeline library cache is part of the render device, so we can't release
+    // resource signatures from here as their destructors will attempt to
+    // call SafeReleaseDeviceObject.
+    VERIFY(m_Cache.empty(), "Pipeline library cache is not empty. Did you call Destroy?");
+}
+
+void PipelineLibraryCache::Destroy()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    for (auto& it : m_Cache)
+    {
+        m_DeviceVkImpl.SafeReleaseDeviceObject(std::move(it.second), ~Uint64{0});
+    }
+    m_Cache.clear();
+}
+
+bool PipelineLibraryCache::LibraryKey::operator==(const LibraryKey& rhs) const noexcept
+{
+    // clang-format off
+    if (GetHash()         != rhs.GetHash()         ||
+        Part              != rhs.Part              ||
+        Signatures.size() != rhs.Signatures.size() ||
+        Shaders.size()    != rhs.Shaders.size()    ||
+        Desc              != rhs.Desc              ||
+        InputLayout       != rhs.InputLayout)
+    {
+        return false;
+    }
+    // clang-format on
+
+    for (size_t i = 0; i < Signatures.size(); ++i)
+    {
+        if (!PipelineResourceSignatureVkImpl::SignaturesCompatible(Signatures[i], rhs.Signatures[i]))
+            return false;
+    }
+
+    return Shaders == rhs.Shaders;
+}
+
+size_t PipelineLibraryCache::LibraryKey::GetHash() const noexcept
+{
+    if (Hash == 0)
+    {
+        VERIFY(Desc.InputLayout.NumElements == 0, "Input layout must be kept in the InputLayout member");
+        Hash = ComputeHash(Part, Desc, InputLayout.Get());
+        for (const auto& pSignature : Signatures)
+            HashCombine(Hash, pSignature != nullptr ? pSignature->GetHash() : size_t{0});
+        for (const auto& Shader : Shaders)
+        {
+            HashCombine(Hash, Shader.Stage, Shader.EntryPoint);
+            HashCombine(Hash, ComputeHashRaw(Shader.SPIRV.data(), Shader.SPIRV.size() * sizeof(uint32_t)));
+        }
+    }
+    return Hash;
+}
+
+} // namespace Diligent
@@ -32,9 +32,12 @@
 #include "RenderDeviceVkImpl.hpp"
 #include "SamplerVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
+#include "BufferViewVkImpl.hpp"
+#include "TopLevelASVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "VulkanUtilities/VulkanCommandBuffer.hpp"
 #include "SPIRVShaderResources.hpp"
 
 namespace Diligent
@@ -248,6 +251,16 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
+    // Descriptor set layouts used with descriptor buffers can't contain dynamic descriptors.
+    // Dynamic offsets are instead added to the buffer addresses when the descriptors are written.
+    const bool UseDescriptorBuffers = HasDevice() && GetDevice()->UseDescriptorBuffers();
+    if (UseDescriptorBuffers)
+    {
+        m_DescriptorBufferResourceOffsets.resize(m_Desc.NumResources, 0);
+        m_DescriptorBufferResourceSamplers.resize(m_Desc.NumResources, VK_NULL_HANDLE);
+        m_DescriptorBufferImmutableSamplerOffsets.resize(m_Desc.NumImmutableSamplers, ~VkDeviceSize{0});
+    }
+
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
     for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
     {
@@ -285,6 +298,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
                 pVkImmutableSamplers = TempAllocator.ConstructArray<VkSampler>(ResDesc.ArraySize, pSamplerVk ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE);
 
                 ImmutableSamplerWithResource[SrcImmutableSamplerInd] = true;
+
+                if (UseDescriptorBuffers)
+                    m_DescriptorBufferResourceSamplers[i] = pVkImmutableSamplers[0];
             }
         }
 
@@ -330,6 +346,13 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
         vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        if (UseDescriptorBuffers)
+        {
+            if (vkSetLayoutBinding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+                vkSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            else if (vkSetLayoutBinding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+                vkSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
@@ -424,6 +447,34 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
     }
 
+    // Vulkan only allows one push descriptor set in a pipeline layout. Resource signatures used by a pipeline
+    // always have distinct binding indices, so only the signature with binding index 0 may use push descriptors.
+    if (HasDevice() && GetDevice()->UsePushDescriptors() && m_Desc.BindingIndex == 0 &&
+        DSMapping[DESCRIPTOR_SET_ID_DYNAMIC] < MAX_DESCRIPTOR_SETS)
+    {
+        Uint32 PushDescriptorCount = 0;
+        for (const auto& vkSetLayoutBinding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+            PushDescriptorCount += vkSetLayoutBinding.descriptorCount;
+
+        m_UsePushDescriptors = PushDescriptorCount <= GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+    }
+
+    if (m_UsePushDescriptors)
+    {
+        // Push descriptor set layouts can't contain dynamic uniform or storage buffers.
+        // Dynamic offsets are instead added to the buffer offsets when the descriptors are pushed.
+        for (auto& vkSetLayoutBinding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+        {
+            if (vkSetLayoutBinding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+                vkSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            else if (vkSetLayoutBinding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+                vkSetLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        }
+
+        m_DynamicUniformBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_UB_STAT_VAR]);
+        m_DynamicStorageBufferCount = static_cast<Uint16>(CacheGroupSizes[CACHE_GROUP_DYN_SB_STAT_VAR]);
+    }
+
     Uint32 NumSets = 0;
     if (DSMapping[DESCRIPTOR_SET_ID_STATIC_MUTABLE] < MAX_DESCRIPTOR_SETS)
     {
@@ -453,7 +504,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = UseDescriptorBuffers ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
@@ -467,12 +518,139 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
-            m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
+            if (m_UsePushDescriptors)
+            {
+                SetLayoutCI.flags = (i == DESCRIPTOR_SET_ID_DYNAMIC) ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+            }
+            m_VkDescrSetLayouts[i] = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (UseDescriptorBuffers)
+        {
+            for (size_t SetId = 0; SetId < DESCRIPTOR_SET_ID_NUM_SETS; ++SetId)
+            {
+                if (DSMapping[SetId] < MAX_DESCRIPTOR_SETS)
+                    m_DescriptorBufferSetSizes[DSMapping[SetId]] = LogicalDevice.GetDescriptorSetLayoutSize(m_VkDescrSetLayouts[SetId]);
+            }
+
+            for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+            {
+                const auto SetId = VarTypeToDescriptorSetId(m_Desc.Resources[r].VarType);
+                m_DescriptorBufferResourceOffsets[r] =
+                    LogicalDevice.GetDescriptorSetLayoutBindingOffset(m_VkDescrSetLayouts[SetId], m_pResourceAttribs[r].BindingIndex);
+            }
+
+            for (Uint32 s = 0; s < m_Desc.NumImmutableSamplers; ++s)
+            {
+                if (ImmutableSamplerWithResource[s])
+                    continue;
+
+                const auto& ImtblSampAttribs = m_pImmutableSamplerAttribs[s];
+                const auto  SetId            = DSMapping[DESCRIPTOR_SET_ID_STATIC_MUTABLE] == ImtblSampAttribs.DescrSet ? DESCRIPTOR_SET_ID_STATIC_MUTABLE : DESCRIPTOR_SET_ID_DYNAMIC;
+                m_DescriptorBufferImmutableSamplerOffsets[s] =
+                    LogicalDevice.GetDescriptorSetLayoutBindingOffset(m_VkDescrSetLayouts[SetId], ImtblSampAttribs.BindingIndex);
+            }
+        }
+        else if (!m_UsePushDescriptors && m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC])
+        {
+            CreateDynamicSetUpdateTemplate();
+        }
     }
 }
 
+namespace
+{
+
+// Returns the size of the template data element for the given descriptor type,
+// or 0 if the type can't be written by the descriptor update template.
+size_t GetTemplateDataStride(DescriptorType DescrType)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DescrType)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            return sizeof(VkDescriptorBufferInfo);
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            return sizeof(VkBufferView);
+
+        case DescriptorType::Sampler:
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            return sizeof(VkDescriptorImageInfo);
+
+        default:
+            // Acceleration structures require VkWriteDescriptorSetAccelerationStructureKHR
+            // and are always written through vkUpdateDescriptorSets.
+            return 0;
+    }
+}
+
+} // namespace
+
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    // Descriptor update templates are core in Vulkan 1.1
+    if (GetDevice()->GetPhysicalDevice().GetVkVersion() < VK_API_VERSION_1_1)
+        return;
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+
+    size_t DataSize = 0;
+
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr      = GetResourceAttribs(ResIdx);
+        const DescriptorType               DescrType = Attr.GetDescriptorType();
+
+        // Immutable samplers are permanently bound into the set layout (13.2.1)
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        const size_t Stride = GetTemplateDataStride(DescrType);
+        if (Stride == 0)
+            return;
+
+        VkDescriptorUpdateTemplateEntry Entry{};
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = DataSize;
+        Entry.stride          = Stride;
+        Entries.push_back(Entry);
+
+        DataSize += Stride * Attr.ArraySize;
+        if (DataSize > DynamicSetTemplateDataBufferSize)
+            return;
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_DynamicSetUpdateTemplate         = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI);
+    m_DynamicSetUpdateTemplateDataSize = StaticCast<Uint32>(DataSize);
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
@@ -486,6 +664,9 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
@@ -514,6 +695,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    // With descriptor buffers, descriptors are written to the dynamic heap when resources are committed
+    if (GetDevice()->UseDescriptorBuffers())
+        return;
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -612,6 +797,22 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    if (m_DynamicSetUpdateTemplate)
+    {
+        VERIFY_EXPR(m_DynamicSetUpdateTemplateDataSize <= DynamicSetTemplateDataBufferSize);
+
+        // Do not zero-initialize the buffer!
+        alignas(8) Uint8 TemplateData[DynamicSetTemplateDataBufferSize];
+
+        const ShaderResourceCacheVk::DescriptorSet& SetResources = ResourceCache.GetDescriptorSet(GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>());
+        if (WriteDynamicSetTemplateData(SetResources, TemplateData))
+        {
+            GetDevice()->GetLogicalDevice().UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, TemplateData);
+            return;
+        }
+        // Some resources are null - fall back to vkUpdateDescriptorSets that skips them
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -796,6 +997,490 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
 }
 
+bool PipelineResourceSignatureVkImpl::WriteDynamicSetTemplateData(const ShaderResourceCacheVk::DescriptorSet& SetResources, Uint8* pData) const
+{
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    size_t Offset = 0;
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr        = GetResourceAttribs(ResIdx);
+        const Uint32                       CacheOffset = Attr.CacheOffset(CacheType);
+        const DescriptorType               DescrType   = Attr.GetDescriptorType();
+
+        // Must be consistent with CreateDynamicSetUpdateTemplate()
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        for (Uint32 ArrElem = 0; ArrElem < Attr.ArraySize; ++ArrElem)
+        {
+            const ShaderResourceCacheVk::Resource& CachedRes = SetResources.GetResource(CacheOffset + ArrElem);
+            if (!CachedRes)
+                return false;
+
+            auto WriteElement = [&](auto DescrType) //
+            {
+                const auto Info = CachedRes.GetDescriptorWriteInfo<DescrType>();
+                memcpy(pData + Offset, &Info, sizeof(Info));
+                Offset += sizeof(Info);
+            };
+
+            static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+            switch (DescrType)
+            {
+                case DescriptorType::UniformBuffer:
+                case DescriptorType::UniformBufferDynamic:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::UniformBuffer>{});
+                    break;
+
+                case DescriptorType::StorageBuffer:
+                case DescriptorType::StorageBufferDynamic:
+                case DescriptorType::StorageBuffer_ReadOnly:
+                case DescriptorType::StorageBufferDynamic_ReadOnly:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::StorageBuffer>{});
+                    break;
+
+                case DescriptorType::UniformTexelBuffer:
+                case DescriptorType::StorageTexelBuffer:
+                case DescriptorType::StorageTexelBuffer_ReadOnly:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::UniformTexelBuffer>{});
+                    break;
+
+                case DescriptorType::CombinedImageSampler:
+                case DescriptorType::SeparateImage:
+                case DescriptorType::StorageImage:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::SeparateImage>{});
+                    break;
+
+                case DescriptorType::InputAttachment:
+                case DescriptorType::InputAttachment_General:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::InputAttachment>{});
+                    break;
+
+                case DescriptorType::Sampler:
+                    WriteElement(std::integral_constant<DescriptorType, DescriptorType::Sampler>{});
+                    break;
+
+                default:
+                    UNEXPECTED("Unexpected resource type: such resources must not be written through the update template");
+                    return false;
+            }
+        }
+    }
+    VERIFY_EXPR(Offset == m_DynamicSetUpdateTemplateDataSize);
+
+    return true;
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&          ResourceCache,
+                                                           DeviceContextIndex                    CtxId,
+                                                           VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint                   BindPoint,
+                                                           VkPipelineLayout                      vkLayout,
+                                                           Uint32                                SetIndex,
+                                                           PushDescriptorState&                  State) const
+{
+    VERIFY(m_UsePushDescriptors, "This signature does not use push descriptors");
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+#ifdef DILIGENT_DEBUG
+    static constexpr size_t WriteBatchSize = 2;
+#else
+    static constexpr size_t WriteBatchSize = 32;
+#endif
+
+    // Do not zero-initialize arrays!
+    std::array<VkDescriptorImageInfo, WriteBatchSize>                        DescrImgInfoArr;
+    std::array<VkDescriptorBufferInfo, WriteBatchSize>                       DescrBuffInfoArr;
+    std::array<VkBufferView, WriteBatchSize>                                 DescrBuffViewArr;
+    std::array<VkWriteDescriptorSetAccelerationStructureKHR, WriteBatchSize> DescrAccelStructArr;
+    std::array<VkWriteDescriptorSet, WriteBatchSize>                         WriteDescrSetArr;
+
+    Uint32 WriteCount = 0;
+
+    const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+    const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
+    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    if (State.vkLayout != vkLayout)
+    {
+        // The layout has changed, so all descriptors must be pushed again
+        State.vkLayout = vkLayout;
+        State.Descriptors.clear();
+    }
+    State.Descriptors.resize(SetResources.GetSize());
+
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const ResourceAttribs& Attr = GetResourceAttribs(ResIdx);
+        VERIFY_EXPR(Attr.DescrSet == DynamicSetIdx);
+
+        const DescriptorType DescrType = Attr.GetDescriptorType();
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue; // Immutable samplers are permanently bound into the set layout
+
+        for (Uint32 ArrElem = 0; ArrElem < Attr.ArraySize; ++ArrElem)
+        {
+            const Uint32                           CacheOffset = Attr.CacheOffset(CacheType) + ArrElem;
+            const ShaderResourceCacheVk::Resource& Res         = SetResources.GetResource(CacheOffset);
+            if (Res.IsNull())
+                continue;
+
+            VkWriteDescriptorSet& WriteDescrSet = WriteDescrSetArr[WriteCount];
+            WriteDescrSet.sType                 = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            WriteDescrSet.pNext                 = nullptr;
+            WriteDescrSet.dstSet                = VK_NULL_HANDLE; // Ignored for push descriptors
+            WriteDescrSet.dstBinding            = Attr.BindingIndex;
+            WriteDescrSet.dstArrayElement       = ArrElem;
+            WriteDescrSet.descriptorCount       = 1;
+            WriteDescrSet.descriptorType        = DescriptorTypeToVkDescriptorType(DescrType);
+            WriteDescrSet.pImageInfo            = nullptr;
+            WriteDescrSet.pBufferInfo           = nullptr;
+            WriteDescrSet.pTexelBufferView      = nullptr;
+
+            std::array<Uint64, 3> Key;
+
+            static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+            switch (DescrType)
+            {
+                case DescriptorType::UniformBuffer:
+                case DescriptorType::UniformBufferDynamic:
+                case DescriptorType::StorageBuffer:
+                case DescriptorType::StorageBufferDynamic:
+                case DescriptorType::StorageBuffer_ReadOnly:
+                case DescriptorType::StorageBufferDynamic_ReadOnly:
+                {
+                    const bool IsUniform = DescrType == DescriptorType::UniformBuffer || DescrType == DescriptorType::UniformBufferDynamic;
+
+                    VkDescriptorBufferInfo& DescrBuffInfo = DescrBuffInfoArr[WriteCount];
+                    DescrBuffInfo                         = IsUniform ? Res.GetUniformBufferDescriptorWriteInfo() : Res.GetStorageBufferDescriptorWriteInfo();
+
+                    // Push descriptor sets can't contain dynamic descriptors, so apply the dynamic offset directly
+                    const BufferVkImpl* pBuffVk = IsUniform ?
+                        Res.pObject.ConstPtr<BufferVkImpl>() :
+                        Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+                    DescrBuffInfo.offset += Res.BufferDynamicOffset + pBuffVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+
+                    WriteDescrSet.descriptorType = IsUniform ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                    WriteDescrSet.pBufferInfo    = &DescrBuffInfo;
+
+                    Key = {BitCast<Uint64>(DescrBuffInfo.buffer), DescrBuffInfo.offset, DescrBuffInfo.range};
+                    break;
+                }
+
+                case DescriptorType::UniformTexelBuffer:
+                case DescriptorType::StorageTexelBuffer:
+                case DescriptorType::StorageTexelBuffer_ReadOnly:
+                {
+                    VkBufferView& DescrBuffView    = DescrBuffViewArr[WriteCount];
+                    DescrBuffView                  = Res.GetBufferViewWriteInfo();
+                    WriteDescrSet.pTexelBufferView = &DescrBuffView;
+
+                    Key = {BitCast<Uint64>(DescrBuffView), 0, 0};
+                    break;
+                }
+
+                case DescriptorType::CombinedImageSampler:
+                case DescriptorType::SeparateImage:
+                case DescriptorType::StorageImage:
+                case DescriptorType::InputAttachment:
+                case DescriptorType::InputAttachment_General:
+                case DescriptorType::Sampler:
+                {
+                    VkDescriptorImageInfo& DescrImgInfo = DescrImgInfoArr[WriteCount];
+                    if (DescrType == DescriptorType::Sampler)
+                        DescrImgInfo = Res.GetSamplerDescriptorWriteInfo();
+                    else if (DescrType == DescriptorType::InputAttachment || DescrType == DescriptorType::InputAttachment_General)
+                        DescrImgInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+                    else
+                        DescrImgInfo = Res.GetImageDescriptorWriteInfo();
+                    WriteDescrSet.pImageInfo = &DescrImgInfo;
+
+                    Key = {BitCast<Uint64>(DescrImgInfo.imageView), BitCast<Uint64>(DescrImgInfo.sampler), static_cast<Uint64>(DescrImgInfo.imageLayout)};
+                    break;
+                }
+
+                case DescriptorType::AccelerationStructure:
+                {
+                    VkWriteDescriptorSetAccelerationStructureKHR& DescrAccelStruct = DescrAccelStructArr[WriteCount];
+                    DescrAccelStruct                                               = Res.GetAccelerationStructureWriteInfo();
+                    WriteDescrSet.pNext                                            = &DescrAccelStruct;
+
+                    Key = {BitCast<Uint64>(*DescrAccelStruct.pAccelerationStructures), 0, 0};
+                    break;
+                }
+
+                default:
+                    UNEXPECTED("Unexpected resource type");
+                    continue;
+            }
+
+            // Only push the descriptors that changed since the last push
+            std::array<Uint64, 3>& PushedKey = State.Descriptors[CacheOffset];
+            if (PushedKey == Key)
+                continue;
+            PushedKey = Key;
+
+            if (++WriteCount == WriteBatchSize)
+            {
+                CmdBuffer.PushDescriptorSet(BindPoint, vkLayout, SetIndex, WriteCount, WriteDescrSetArr.data());
+                WriteCount = 0;
+            }
+        }
+    }
+
+    if (WriteCount > 0)
+        CmdBuffer.PushDescriptorSet(BindPoint, vkLayout, SetIndex, WriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::WriteDescriptorBufferSet(const ShaderResourceCacheVk& ResourceCache,
+                                                               Uint32                       SetIndex,
+                                                               DeviceContextIndex           CtxId,
+                                                               Uint8*                       pDstData) const
+{
+    VERIFY(GetDevice()->UseDescriptorBuffers(), "Descriptor buffers are not enabled");
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    VERIFY_EXPR(SetIndex < GetNumDescriptorSets());
+    VERIFY_EXPR(pDstData != nullptr);
+
+    const VulkanUtilities::VulkanLogicalDevice&          LogicalDevice = GetDevice()->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props         = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    const bool                                           RobustAccess  = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    const ShaderResourceCacheVk::DescriptorSet& SetResources = ResourceCache.GetDescriptorSet(SetIndex);
+
+    // Descriptors of null resources are left zeroed. They are never accessed by shaders.
+    memset(pDstData, 0, StaticCast<size_t>(m_DescriptorBufferSetSizes[SetIndex]));
+
+    constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
+
+    for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+    {
+        const ResourceAttribs& Attr = GetResourceAttribs(r);
+        if (Attr.DescrSet != SetIndex)
+            continue;
+
+        const DescriptorType DescrType      = Attr.GetDescriptorType();
+        const VkSampler      vkImtblSampler = m_DescriptorBufferResourceSamplers[r];
+
+        VkDescriptorGetInfoEXT DescrInfo{};
+        DescrInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescrInfo.type  = DescriptorTypeToVkDescriptorType(DescrType);
+
+        size_t DescrSize = 0;
+        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+        switch (DescrType)
+        {
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+                DescrInfo.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                DescrSize      = RobustAccess ? Props.robustUniformBufferDescriptorSize : Props.uniformBufferDescriptorSize;
+                break;
+
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+                DescrInfo.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                DescrSize      = RobustAccess ? Props.robustStorageBufferDescriptorSize : Props.storageBufferDescriptorSize;
+                break;
+
+            case DescriptorType::UniformTexelBuffer:
+                DescrSize = RobustAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize;
+                break;
+
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+                DescrSize = RobustAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize;
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+                DescrSize = Props.combinedImageSamplerDescriptorSize;
+                break;
+
+            case DescriptorType::SeparateImage:
+                DescrSize = Props.sampledImageDescriptorSize;
+                break;
+
+            case DescriptorType::StorageImage:
+                DescrSize = Props.storageImageDescriptorSize;
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                DescrSize = Props.inputAttachmentDescriptorSize;
+                break;
+
+            case DescriptorType::Sampler:
+                DescrSize = Props.samplerDescriptorSize;
+                break;
+
+            case DescriptorType::AccelerationStructure:
+                DescrSize = Props.accelerationStructureDescriptorSize;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+                continue;
+        }
+
+        for (Uint32 ArrElem = 0; ArrElem < Attr.ArraySize; ++ArrElem)
+        {
+            const ShaderResourceCacheVk::Resource& Res = SetResources.GetResource(Attr.CacheOffset(CacheType) + ArrElem);
+
+            Uint8* const pDstDescriptor = pDstData + m_DescriptorBufferResourceOffsets[r] + size_t{ArrElem} * DescrSize;
+
+            VkDescriptorAddressInfoEXT AddressInfo{};
+            AddressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+
+            VkDescriptorImageInfo ImageInfo{};
+
+            switch (DescrType)
+            {
+                case DescriptorType::UniformBuffer:
+                case DescriptorType::UniformBufferDynamic:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    const BufferVkImpl* pBuffVk = Res.pObject.ConstPtr<BufferVkImpl>();
+                    // Dynamic offsets can't be used with descriptor buffers, so they are added to the buffer address.
+                    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + Res.BufferBaseOffset + Res.BufferDynamicOffset +
+                        pBuffVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+                    AddressInfo.range = Res.BufferRangeSize;
+
+                    DescrInfo.data.pUniformBuffer = &AddressInfo;
+                    break;
+                }
+
+                case DescriptorType::StorageBuffer:
+                case DescriptorType::StorageBufferDynamic:
+                case DescriptorType::StorageBuffer_ReadOnly:
+                case DescriptorType::StorageBufferDynamic_ReadOnly:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    const BufferVkImpl* pBuffVk = Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+                    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + Res.BufferBaseOffset + Res.BufferDynamicOffset +
+                        pBuffVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+                    AddressInfo.range = Res.BufferRangeSize;
+
+                    DescrInfo.data.pStorageBuffer = &AddressInfo;
+                    break;
+                }
+
+                case DescriptorType::UniformTexelBuffer:
+                case DescriptorType::StorageTexelBuffer:
+                case DescriptorType::StorageTexelBuffer_ReadOnly:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+                    const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+                    const BufferVkImpl*     pBuffVk     = pBuffViewVk->GetBuffer<const BufferVkImpl>();
+
+                    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+                    AddressInfo.range   = ViewDesc.ByteWidth;
+                    AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+                    if (DescrType == DescriptorType::UniformTexelBuffer)
+                        DescrInfo.data.pUniformTexelBuffer = &AddressInfo;
+                    else
+                        DescrInfo.data.pStorageTexelBuffer = &AddressInfo;
+                    break;
+                }
+
+                case DescriptorType::CombinedImageSampler:
+                case DescriptorType::SeparateImage:
+                case DescriptorType::StorageImage:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    ImageInfo = Res.GetImageDescriptorWriteInfo();
+                    if (DescrType == DescriptorType::CombinedImageSampler)
+                    {
+                        // Immutable samplers are not written to descriptor buffers automatically
+                        if (vkImtblSampler != VK_NULL_HANDLE)
+                            ImageInfo.sampler = vkImtblSampler;
+                        DescrInfo.data.pCombinedImageSampler = &ImageInfo;
+                    }
+                    else if (DescrType == DescriptorType::SeparateImage)
+                        DescrInfo.data.pSampledImage = &ImageInfo;
+                    else
+                        DescrInfo.data.pStorageImage = &ImageInfo;
+                    break;
+                }
+
+                case DescriptorType::InputAttachment:
+                case DescriptorType::InputAttachment_General:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    ImageInfo                            = Res.GetInputAttachmentDescriptorWriteInfo();
+                    DescrInfo.data.pInputAttachmentImage = &ImageInfo;
+                    break;
+                }
+
+                case DescriptorType::Sampler:
+                {
+                    if (vkImtblSampler != VK_NULL_HANDLE)
+                        ImageInfo.sampler = vkImtblSampler;
+                    else if (!Res.IsNull())
+                        ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+                    else
+                        continue;
+
+                    DescrInfo.data.pSampler = &ImageInfo.sampler;
+                    break;
+                }
+
+                case DescriptorType::AccelerationStructure:
+                {
+                    if (Res.IsNull())
+                        continue;
+
+                    DescrInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+                    break;
+                }
+
+                default:
+                    UNEXPECTED("Unexpected resource type");
+                    continue;
+            }
+
+            VERIFY_EXPR(pDstDescriptor + DescrSize <= pDstData + m_DescriptorBufferSetSizes[SetIndex]);
+            LogicalDevice.GetDescriptor(DescrInfo, DescrSize, pDstDescriptor);
+        }
+    }
+
+    // Immutable samplers that are not assigned to any resource
+    for (Uint32 s = 0; s < m_Desc.NumImmutableSamplers; ++s)
+    {
+        const VkDeviceSize Offset = m_DescriptorBufferImmutableSamplerOffsets[s];
+        if (Offset == ~VkDeviceSize{0} || m_pImmutableSamplerAttribs[s].DescrSet != SetIndex)
+            continue;
+
+        const RefCntAutoPtr<SamplerVkImpl>& pSamplerVk = m_pImmutableSamplers[s];
+        if (!pSamplerVk)
+            continue;
+
+        const VkSampler vkSampler = pSamplerVk->GetVkSampler();
+
+        VkDescriptorGetInfoEXT DescrInfo{};
+        DescrInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+        DescrInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+        DescrInfo.data.pSampler = &vkSampler;
+        LogicalDevice.GetDescriptor(DescrInfo, Props.samplerDescriptorSize, pDstData + Offset);
+    }
+}
+
 
 #ifdef DILIGENT_DEVELOPMENT
 bool PipelineResourceSignatureVkImpl::DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
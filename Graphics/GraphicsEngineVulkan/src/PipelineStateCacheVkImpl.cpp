@@ -75,11 +75,81 @@ PipelineStateCacheVkImpl::PipelineStateCacheVkImpl(IReferenceCounters*
 
 PipelineStateCacheVkImpl::~PipelineStateCacheVkImpl()
 {
+    // Thread caches hold strong references to the object, so all of them are in the pool now
+    for (auto& Cache : m_ThreadCachePool)
+        m_pDevice->SafeReleaseDeviceObject(std::move(Cache.vkCache), ~Uint64{0});
+
     // Vk object can only be destroyed when it is no longer used by the GPU
     if (m_PipelineStateCache != VK_NULL_HANDLE)
         m_pDevice->SafeReleaseDeviceObject(std::move(m_PipelineStateCache), ~Uint64{0});
 }
 
+PipelineStateCacheVkImpl::PooledCache PipelineStateCacheVkImpl::AcquireThreadCache()
+{
+    std::lock_guard<std::mutex> Lock{m_PoolMtx};
+
+    if (!m_ThreadCachePool.empty())
+    {
+        PooledCache Cache = std::move(m_ThreadCachePool.back());
+        m_ThreadCachePool.pop_back();
+        return Cache;
+    }
+
+    const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+    VkPipelineCacheCreateInfo VkPipelineStateCacheCI{};
+    VkPipelineStateCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+
+    PooledCache Cache;
+    Cache.vkCache = LogicalDevice.CreatePipelineCache(VkPipelineStateCacheCI, m_Desc.Name);
+
+    // Seed the new cache with the contents of the main cache, which includes the initial data.
+    // The main cache is only modified while m_PoolMtx is locked.
+    const VkPipelineCache vkMainCache = m_PipelineStateCache;
+    if (LogicalDevice.MergePipelineCaches(Cache.vkCache, 1, &vkMainCache) != VK_SUCCESS)
+        LOG_WARNING_MESSAGE("Failed to merge the main pipeline cache into a thread cache of '", m_Desc.Name, "'");
+
+    return Cache;
+}
+
+void PipelineStateCacheVkImpl::ReleaseThreadCache(PooledCache&& Cache)
+{
+    VERIFY_EXPR(Cache.vkCache != VK_NULL_HANDLE);
+
+    std::lock_guard<std::mutex> Lock{m_PoolMtx};
+
+    if (++Cache.NumPipelines >= MergeInterval)
+    {
+        const VkPipelineCache vkCache = Cache.vkCache;
+        MergeThreadCaches(&vkCache, 1);
+        Cache.NumPipelines = 0;
+    }
+
+    m_ThreadCachePool.emplace_back(std::move(Cache));
+}
+
+void PipelineStateCacheVkImpl::MergeThreadCaches(const VkPipelineCache* pCaches, Uint32 NumCaches)
+{
+    if (NumCaches == 0)
+        return;
+
+    if (m_pDevice->GetLogicalDevice().MergePipelineCaches(m_PipelineStateCache, NumCaches, pCaches) != VK_SUCCESS)
+        LOG_WARNING_MESSAGE("Failed to merge thread caches into the pipeline cache '", m_Desc.Name, "'");
+}
+
+PipelineStateCacheVkImpl::ThreadCache::ThreadCache(IPipelineStateCache* pCache) :
+    m_pOwner{ClassPtrCast<PipelineStateCacheVkImpl>(pCache)}
+{
+    if (m_pOwner)
+        m_Cache = m_pOwner->AcquireThreadCache();
+}
+
+PipelineStateCacheVkImpl::ThreadCache::~ThreadCache()
+{
+    if (m_pOwner)
+        m_pOwner->ReleaseThreadCache(std::move(m_Cache));
+}
+
 void PipelineStateCacheVkImpl::GetData(IDataBlob** ppBlob)
 {
     DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
@@ -87,6 +157,22 @@ void PipelineStateCacheVkImpl::GetData(IDataBlob** ppBlob)
 
     const auto vkDevice = m_pDevice->GetLogicalDevice().GetVkDevice();
 
+    // The lock also protects the main cache while its data is read.
+    // Caches that are currently used to create pipelines will be merged when they are released.
+    std::lock_guard<std::mutex> Lock{m_PoolMtx};
+
+    std::vector<VkPipelineCache> vkCaches;
+    vkCaches.reserve(m_ThreadCachePool.size());
+    for (auto& Cache : m_ThreadCachePool)
+    {
+        if (Cache.NumPipelines > 0)
+        {
+            vkCaches.push_back(Cache.vkCache);
+            Cache.NumPipelines = 0;
+        }
+    }
+    MergeThreadCaches(vkCaches.data(), static_cast<Uint32>(vkCaches.size()));
+
     size_t DataSize = 0;
     if (vkGetPipelineCacheData(vkDevice, m_PipelineStateCache, &DataSize, nullptr) != VK_SUCCESS)
         return;
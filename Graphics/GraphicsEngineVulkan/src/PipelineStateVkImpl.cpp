@@ -30,6 +30,7 @@
 #include "PipelineStateVkImpl.hpp"
 
 #include <array>
+#include <algorithm>
 #include <unordered_map>
 
 #include "RenderDeviceVkImpl.hpp"
@@ -42,6 +43,8 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
+#include "ThreadPool.hpp"
+#include "CPUProfiler.hpp"
 
 #if !DILIGENT_NO_HLSL
 #    include "SPIRVTools.hpp"
@@ -116,6 +119,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -126,19 +131,208 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
-void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
-                            std::vector<VkPipelineShaderStageCreateInfo>& Stages,
-                            const PipelineLayoutVk&                       Layout,
-                            const PipelineStateDesc&                      PSODesc,
-                            const GraphicsPipelineDesc&                   GraphicsPipeline,
-                            VulkanUtilities::PipelineWrapper&             Pipeline,
-                            RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+VulkanUtilities::PipelineWrapper LinkGraphicsPipeline(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                                      const std::vector<VkPipeline>&              Libraries,
+                                                      VkPipelineLayout                            vkLayout,
+                                                      VkPipelineCreateFlags                       Flags,
+                                                      VkPipelineCache                             vkPSOCache,
+                                                      const char*                                 Name)
+{
+    VkPipelineLibraryCreateInfoKHR LibrariesCI{};
+    LibrariesCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibrariesCI.pNext        = nullptr;
+    LibrariesCI.libraryCount = static_cast<uint32_t>(Libraries.size());
+    LibrariesCI.pLibraries   = Libraries.data();
+
+    // All state is taken from the libraries
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType              = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext              = &LibrariesCI;
+    PipelineCI.flags              = Flags;
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+
+    return LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, Name);
+}
+
+
+// Creates or finds in the cache the vertex input interface, pre-rasterization shaders, fragment shader
+// and fragment output interface libraries for the graphics pipeline described by PipelineCI.
+void GetGraphicsPipelineLibraries(RenderDeviceVkImpl*                                  pDeviceVk,
+                                  const VkGraphicsPipelineCreateInfo&                  PipelineCI,
+                                  const PipelineStateVkImpl::TShaderStages&            ShaderStages,
+                                  const RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSignatures[],
+                                  Uint32                                               SignatureCount,
+                                  const PipelineStateDesc&                             PSODesc,
+                                  const GraphicsPipelineDesc&                          GraphicsPipeline,
+                                  VkPipelineCache                                      vkPSOCache,
+                                  std::vector<VkPipeline>&                             Libraries) noexcept(false)
+{
+    using LibraryKey = PipelineLibraryCache::LibraryKey;
+
+    const auto& LogicalDevice = pDeviceVk->GetLogicalDevice();
+    auto&       LibraryCache  = pDeviceVk->GetPipelineLibraryCache();
+
+    // Split shader stages between the pre-rasterization and fragment shader parts.
+    // Stages are initialized by InitPipelineShaderStages() in the same order as ShaderStages.
+    std::vector<VkPipelineShaderStageCreateInfo> PreRasterStages;
+    std::vector<VkPipelineShaderStageCreateInfo> FragmentStages;
+    std::vector<LibraryKey::ShaderInfo>          PreRasterShaders;
+    std::vector<LibraryKey::ShaderInfo>          FragmentShaders;
+
+    uint32_t StageIdx = 0;
+    for (const auto& Stage : ShaderStages)
+    {
+        for (const auto& SPIRV : Stage.SPIRVs)
+        {
+            VERIFY_EXPR(StageIdx < PipelineCI.stageCount);
+            const VkPipelineShaderStageCreateInfo& StageCI = PipelineCI.pStages[StageIdx++];
+
+            const bool IsFragment = StageCI.stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+            (IsFragment ? FragmentStages : PreRasterStages).push_back(StageCI);
+            (IsFragment ? FragmentShaders : PreRasterShaders).push_back({StageCI.stage, StageCI.pName, SPIRV});
+        }
+    }
+    VERIFY_EXPR(StageIdx == PipelineCI.stageCount);
+
+    auto GetLibrary = [&](VkGraphicsPipelineLibraryFlagsEXT                   Part,
+                          LibraryKey&&                                        Key,
+                          const std::vector<VkPipelineShaderStageCreateInfo>& Stages,
+                          const char*                                         PartName) //
+    {
+        Key.Part = Part;
+
+        VkPipeline vkLibrary = LibraryCache.GetLibrary(
+            std::move(Key),
+            [&]() {
+                VkGraphicsPipelineLibraryCreateInfoEXT LibraryCI{};
+                LibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+                LibraryCI.pNext = PipelineCI.pNext; // VkPipelineRenderingCreateInfoKHR
+                LibraryCI.flags = Part;
+
+                // State that is not relevant for the library part is ignored
+                VkGraphicsPipelineCreateInfo LibraryPipelineCI = PipelineCI;
+                LibraryPipelineCI.pNext = &LibraryCI;
+                LibraryPipelineCI.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+                LibraryPipelineCI.stageCount = static_cast<uint32_t>(Stages.size());
+                LibraryPipelineCI.pStages    = !Stages.empty() ? Stages.data() : nullptr;
+
+                const std::string LibraryName = std::string{PSODesc.Name != nullptr ? PSODesc.Name : ""} + " - " + PartName;
+                return LogicalDevice.CreateGraphicsPipeline(LibraryPipelineCI, vkPSOCache, LibraryName.c_str());
+            });
+        Libraries.push_back(vkLibrary);
+    };
+
+    std::vector<RefCntAutoPtr<PipelineResourceSignatureVkImpl>> Signatures{pSignatures, pSignatures + SignatureCount};
+
+    Libraries.clear();
+
+    // States that are dynamic are reset to default values in the keys so that
+    // pipelines that only differ by these states share the same libraries.
+    const auto DynamicStateFlags = GraphicsPipeline.DynamicStateFlags;
+
+    // Mesh pipelines have no vertex input state
+    if (PSODesc.PipelineType != PIPELINE_TYPE_MESH)
+    {
+        LibraryKey Key;
+        // Dynamic topology must still be of the same class as the pipeline topology, so it is kept in the key
+        Key.Desc.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+        Key.Desc.DynamicStateFlags = DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY;
+        Key.InputLayout            = GraphicsPipeline.InputLayout;
+        GetLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, std::move(Key), {}, "vertex input library");
+    }
+
+    {
+        LibraryKey Key;
+        Key.Desc.RasterizerDesc    = GraphicsPipeline.RasterizerDesc;
+        Key.Desc.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+        Key.Desc.NumViewports      = GraphicsPipeline.NumViewports;
+        Key.Desc.ShadingRateFlags  = GraphicsPipeline.ShadingRateFlags;
+        Key.Desc.DynamicStateFlags = DynamicStateFlags & (PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE | PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE);
+        if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE)
+            Key.Desc.RasterizerDesc.CullMode = RasterizerStateDesc{}.CullMode;
+        if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE)
+            Key.Desc.RasterizerDesc.FrontCounterClockwise = RasterizerStateDesc{}.FrontCounterClockwise;
+        Key.Signatures = Signatures;
+        Key.Shaders    = std::move(PreRasterShaders);
+        GetLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, std::move(Key), PreRasterStages, "pre-rasterization library");
+    }
+
+    {
+        LibraryKey Key;
+        Key.Desc.DepthStencilDesc  = GraphicsPipeline.DepthStencilDesc;
+        Key.Desc.SmplDesc          = GraphicsPipeline.SmplDesc;
+        Key.Desc.SampleMask        = GraphicsPipeline.SampleMask;
+        Key.Desc.ShadingRateFlags  = GraphicsPipeline.ShadingRateFlags;
+        Key.Desc.DynamicStateFlags = DynamicStateFlags & (PIPELINE_DYNAMIC_STATE_FLAG_DEPTH | PIPELINE_DYNAMIC_STATE_FLAG_STENCIL);
+
+        auto&                       DSSDesc = Key.Desc.DepthStencilDesc;
+        const DepthStencilStateDesc DefaultDSSDesc;
+        if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_DEPTH)
+        {
+            DSSDesc.DepthEnable      = DefaultDSSDesc.DepthEnable;
+            DSSDesc.DepthWriteEnable = DefaultDSSDesc.DepthWriteEnable;
+            DSSDesc.DepthFunc        = DefaultDSSDesc.DepthFunc;
+        }
+        if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_STENCIL)
+        {
+            DSSDesc.StencilEnable    = DefaultDSSDesc.StencilEnable;
+            DSSDesc.StencilReadMask  = DefaultDSSDesc.StencilReadMask;
+            DSSDesc.StencilWriteMask = DefaultDSSDesc.StencilWriteMask;
+            DSSDesc.FrontFace        = DefaultDSSDesc.FrontFace;
+            DSSDesc.BackFace         = DefaultDSSDesc.BackFace;
+        }
+
+        Key.Signatures = std::move(Signatures);
+        Key.Shaders    = std::move(FragmentShaders);
+        GetLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, std::move(Key), FragmentStages, "fragment shader library");
+    }
+
+    {
+        LibraryKey Key;
+        Key.Desc.BlendDesc        = GraphicsPipeline.BlendDesc;
+        Key.Desc.NumRenderTargets = GraphicsPipeline.NumRenderTargets;
+        for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+            Key.Desc.RTVFormats[rt] = GraphicsPipeline.RTVFormats[rt];
+        Key.Desc.DSVFormat  = GraphicsPipeline.DSVFormat;
+        Key.Desc.SmplDesc   = GraphicsPipeline.SmplDesc;
+        Key.Desc.SampleMask = GraphicsPipeline.SampleMask;
+        GetLibrary(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, std::move(Key), {}, "fragment output library");
+    }
+}
+
+
+void CreateGraphicsPipeline(RenderDeviceVkImpl*                                  pDeviceVk,
+                            std::vector<VkPipelineShaderStageCreateInfo>&        Stages,
+                            const PipelineStateVkImpl::TShaderStages&            ShaderStages,
+                            const RefCntAutoPtr<PipelineResourceSignatureVkImpl> pSignatures[],
+                            Uint32                                               SignatureCount,
+                            const PipelineLayoutVk&                              Layout,
+                            const PipelineStateDesc&                             PSODesc,
+                            const GraphicsPipelineDesc&                          GraphicsPipeline,
+                            VulkanUtilities::PipelineWrapper&                    Pipeline,
+                            RefCntAutoPtr<IRenderPass>&                          pRenderPass,
+                            VkPipelineCache                                      vkPSOCache,
+                            bool&                                                UseDynamicRendering,
+                            bool                                                 FastLink,
+                            std::vector<VkPipeline>&                             Libraries,
+                            VkPipelineCreateFlags&                               LinkFlags)
 {
     const auto& LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const auto& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
     auto&       RPCache        = pDeviceVk->GetImplicitRenderPassCache();
 
+    // Pipelines that use implicit render passes are created for dynamic rendering when it is enabled,
+    // so that the device context does not need render pass and framebuffer objects to draw with them.
+    // Fragment shading rate attachments are not supported with dynamic rendering and still
+    // require a render pass (see DeviceContextVkImpl::ChooseRenderPassAndFramebuffer).
+    UseDynamicRendering =
+        pRenderPass == nullptr &&
+        (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) == 0 &&
+        LogicalDevice.GetEnabledExtFeatures().DynamicRendering.dynamicRendering != VK_FALSE;
+
+    // The implicit render pass is still created as it defines the pipeline's attachment layout
     if (pRenderPass == nullptr)
     {
         RenderPassCache::RenderPassCacheKey Key{
@@ -159,6 +353,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount = static_cast<Uint32>(Stages.size());
     PipelineCI.pStages    = Stages.data();
@@ -319,17 +515,81 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DynamicStates.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
 
+    // The states are set by DeviceContextVkImpl::CommitDynamicRenderState()
+    // using the values from IDeviceContext::SetDynamicRenderState().
+    const auto DynamicStateFlags = GraphicsPipeline.DynamicStateFlags;
+    if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+    if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+    if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY)
+        DynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+    if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_DEPTH)
+    {
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+    }
+    if (DynamicStateFlags & PIPELINE_DYNAMIC_STATE_FLAG_STENCIL)
+    {
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
+        DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
+    }
+
     DynamicStateCI.dynamicStateCount = static_cast<uint32_t>(DynamicStates.size());
     DynamicStateCI.pDynamicStates    = DynamicStates.data();
     PipelineCI.pDynamicState         = &DynamicStateCI;
 
 
-    PipelineCI.renderPass         = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
-    PipelineCI.subpass            = GraphicsPipeline.SubpassIndex;
+    VkPipelineRenderingCreateInfoKHR         RenderingCI{};
+    std::array<VkFormat, MAX_RENDER_TARGETS> ColorAttachmentFormats{};
+    if (UseDynamicRendering)
+    {
+        RenderingCI.sType                = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+        RenderingCI.pNext                = nullptr;
+        RenderingCI.viewMask             = 0;
+        RenderingCI.colorAttachmentCount = GraphicsPipeline.NumRenderTargets;
+        for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+            ColorAttachmentFormats[rt] = TexFormatToVkFormat(GraphicsPipeline.RTVFormats[rt]);
+        RenderingCI.pColorAttachmentFormats = GraphicsPipeline.NumRenderTargets > 0 ? ColorAttachmentFormats.data() : nullptr;
+
+        if (GraphicsPipeline.DSVFormat != TEX_FORMAT_UNKNOWN)
+        {
+            RenderingCI.depthAttachmentFormat = TexFormatToVkFormat(GraphicsPipeline.DSVFormat);
+            if (GetTextureFormatAttribs(GraphicsPipeline.DSVFormat).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
+                RenderingCI.stencilAttachmentFormat = RenderingCI.depthAttachmentFormat;
+        }
+
+        PipelineCI.pNext      = &RenderingCI;
+        PipelineCI.renderPass = VK_NULL_HANDLE;
+        PipelineCI.subpass    = 0;
+    }
+    else
+    {
+        PipelineCI.renderPass = pRenderPass.RawPtr<IRenderPassVk>()->GetVkRenderPass();
+        PipelineCI.subpass    = GraphicsPipeline.SubpassIndex;
+    }
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    // Libraries require VkPipelineRenderingCreateInfoKHR as they can't reference the render pass
+    if (UseDynamicRendering && pDeviceVk->UseGraphicsPipelineLibrary())
+    {
+        GetGraphicsPipelineLibraries(pDeviceVk, PipelineCI, ShaderStages, pSignatures, SignatureCount, PSODesc, GraphicsPipeline, vkPSOCache, Libraries);
+
+        // Without link-time optimizations, the pipeline is linked from the libraries almost instantly,
+        // but may be slower than the optimized pipeline.
+        LinkFlags = PipelineCI.flags;
+        Pipeline  = LinkGraphicsPipeline(LogicalDevice, Libraries, PipelineCI.layout,
+                                         FastLink ? LinkFlags : LinkFlags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT,
+                                         vkPSOCache, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -350,6 +610,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -814,36 +1076,402 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
 
     InitPipelineLayout(CreateInfo, ShaderStages);
 
-    // Create shader modules and initialize shader stages
-    InitPipelineShaderStages(LogicalDevice, ShaderStages, ShaderModules, vkShaderStages);
+    // Shader objects are created from the bytecode directly and do not need shader modules
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) == 0)
+    {
+        // Create shader modules and initialize shader stages
+        InitPipelineShaderStages(LogicalDevice, ShaderStages, ShaderModules, vkShaderStages);
+    }
 
     return ShaderStages;
 }
 
+bool PipelineStateVkImpl::EnqueueOptimizeSPIRVTask(const TShaderStages& ShaderStages, IPipelineStateCache* pPSOCache)
+{
+#if !DILIGENT_NO_HLSL
+    if (!m_pDevice->DeferSPIRVOptimization())
+        return false;
+
+    bool HasDeferredShaders = false;
+    for (const auto& Stage : ShaderStages)
+    {
+        for (const auto* pShader : Stage.Shaders)
+            HasDeferredShaders = HasDeferredShaders || pShader->IsSPIRVOptimizationDeferred();
+    }
+    if (!HasDeferredShaders)
+        return false;
+
+    // Keep the shaders alive as the task uses their names and entry points
+    std::vector<RefCntAutoPtr<IShader>> Shaders;
+    for (const auto& Stage : ShaderStages)
+    {
+        for (const auto* pShader : Stage.Shaders)
+            Shaders.emplace_back(const_cast<ShaderVkImpl*>(pShader));
+    }
+
+    m_pOptimizePipelineTask = EnqueueAsyncWork(
+        m_pDevice->GetShaderCompilationThreadPool(),
+        [this,
+         ShaderStages = ShaderStages,
+         Shaders      = std::move(Shaders),
+         pPSOCache    = RefCntAutoPtr<IPipelineStateCache>{pPSOCache}](Uint32 ThreadId) mutable //
+        {
+            // Resources in the bytecode have already been remapped and reflection information has been stripped,
+            // so the optimized bytecode can be used as is.
+            for (auto& Stage : ShaderStages)
+            {
+                for (size_t i = 0; i < Stage.Shaders.size(); ++i)
+                {
+                    if (!Stage.Shaders[i]->IsSPIRVOptimizationDeferred())
+                        continue;
+
+                    auto OptimizedSPIRV = OptimizeSPIRV(Stage.SPIRVs[i], SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+                    if (OptimizedSPIRV.empty())
+                    {
+                        // The original pipeline will continue to be used
+                        return ASYNC_TASK_STATUS_COMPLETE;
+                    }
+                    Stage.SPIRVs[i] = std::move(OptimizedSPIRV);
+                }
+            }
+
+            const PipelineStateCacheVkImpl::ThreadCache vkPSOCache{pPSOCache};
+            try
+            {
+                std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
+                std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
+                InitPipelineShaderStages(m_pDevice->GetLogicalDevice(), ShaderStages, ShaderModules, vkShaderStages);
+
+                VulkanUtilities::PipelineWrapper OptimizedPipeline;
+                if (m_Desc.IsAnyGraphicsPipeline())
+                {
+                    // The render pass has been set when the original pipeline was created,
+                    // so the same rendering mode is selected.
+                    RefCntAutoPtr<IRenderPass> pRenderPass{GetRenderPassPtr()};
+                    bool                       UseDynamicRendering = false;
+                    std::vector<VkPipeline>    Libraries;
+                    VkPipelineCreateFlags      LinkFlags = 0;
+                    CreateGraphicsPipeline(m_pDevice, vkShaderStages, ShaderStages, m_Signatures, m_SignatureCount, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc,
+                                           OptimizedPipeline, pRenderPass, vkPSOCache, UseDynamicRendering, false /*FastLink*/, Libraries, LinkFlags);
+                    VERIFY_EXPR(UseDynamicRendering == m_UseDynamicRendering);
+                }
+                else
+                {
+                    VERIFY_EXPR(m_Desc.IsComputePipeline());
+                    CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, OptimizedPipeline, vkPSOCache);
+                }
+
+                m_OptimizedPipeline = std::move(OptimizedPipeline);
+                m_OptimizedPipelineReady.store(true);
+            }
+            catch (...)
+            {
+                // The original pipeline will continue to be used
+            }
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void PipelineStateVkImpl::InitShaderObjects(const TShaderStages& ShaderStages) noexcept(false)
+{
+    const auto& LogicalDevice    = m_pDevice->GetLogicalDevice();
+    const auto& Features         = m_pDevice->GetFeatures();
+    const auto& GraphicsPipeline = m_pGraphicsPipelineData->Desc;
+    auto&       ShaderCache      = m_pDevice->GetShaderObjectCache();
+
+    // The implicit render pass is still created as it defines the pipeline's attachment layout
+    // (see CreateGraphicsPipeline()). Explicit render passes are not allowed with shader objects.
+    VERIFY_EXPR(GetRenderPassPtr() == nullptr);
+    {
+        RenderPassCache::RenderPassCacheKey Key{
+            GraphicsPipeline.NumRenderTargets,
+            GraphicsPipeline.SmplDesc.Count,
+            GraphicsPipeline.RTVFormats,
+            GraphicsPipeline.DSVFormat,
+            false, // EnableVRS
+            GraphicsPipeline.ReadOnlyDSV};
+        GetRenderPassPtr() = m_pDevice->GetImplicitRenderPassCache().GetRenderPass(Key);
+        if (GetRenderPassPtr() == nullptr)
+            LOG_ERROR_AND_THROW("Failed to create default render pass.");
+    }
+
+    auto pData = std::make_unique<ShaderObjectData>();
+
+    // Shader objects must use the same descriptor set layouts as the pipeline layout
+    // that is used to bind descriptor sets (see PipelineLayoutVk::Create)
+    std::vector<VkDescriptorSetLayout> SetLayouts;
+    for (Uint32 i = 0; i < m_SignatureCount; ++i)
+    {
+        const auto& pSignature = m_Signatures[i];
+        if (pSignature == nullptr)
+            continue;
+
+        for (auto SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE, PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
+        {
+            if (pSignature->HasDescriptorSet(SetId))
+                SetLayouts.push_back(pSignature->GetVkDescriptorSetLayout(SetId));
+        }
+    }
+
+    // Every stage that is supported by the device must be bound before drawing
+    const bool HasTess = Features.Tessellation != DEVICE_FEATURE_STATE_DISABLED;
+    const bool HasGS   = Features.GeometryShaders != DEVICE_FEATURE_STATE_DISABLED;
+    const bool HasMesh = Features.MeshShaders != DEVICE_FEATURE_STATE_DISABLED;
+
+    pData->Stages.push_back(VK_SHADER_STAGE_VERTEX_BIT);
+    if (HasTess)
+    {
+        pData->Stages.push_back(VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT);
+        pData->Stages.push_back(VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT);
+    }
+    if (HasGS)
+        pData->Stages.push_back(VK_SHADER_STAGE_GEOMETRY_BIT);
+    if (HasMesh)
+    {
+        pData->Stages.push_back(VK_SHADER_STAGE_TASK_BIT_EXT);
+        pData->Stages.push_back(VK_SHADER_STAGE_MESH_BIT_EXT);
+    }
+    pData->Stages.push_back(VK_SHADER_STAGE_FRAGMENT_BIT);
+    pData->Shaders.resize(pData->Stages.size(), VK_NULL_HANDLE);
+
+    // All stages that may follow the given one. Shaders are not linked together, so using
+    // the widest set of next stages lets different pipelines share the same shader objects.
+    auto GetNextStages = [&](VkShaderStageFlagBits Stage) -> VkShaderStageFlags {
+        switch (Stage)
+        {
+            case VK_SHADER_STAGE_VERTEX_BIT:
+                return (HasTess ? VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT : 0) |
+                    (HasGS ? VK_SHADER_STAGE_GEOMETRY_BIT : 0) |
+                    VK_SHADER_STAGE_FRAGMENT_BIT;
+
+            case VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT:
+                return VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+
+            case VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT:
+                return (HasGS ? VK_SHADER_STAGE_GEOMETRY_BIT : 0) | VK_SHADER_STAGE_FRAGMENT_BIT;
+
+            case VK_SHADER_STAGE_GEOMETRY_BIT:
+            case VK_SHADER_STAGE_MESH_BIT_EXT:
+                return VK_SHADER_STAGE_FRAGMENT_BIT;
+
+            case VK_SHADER_STAGE_TASK_BIT_EXT:
+                return VK_SHADER_STAGE_MESH_BIT_EXT;
+
+            default:
+                return 0;
+        }
+    };
+
+    bool HasTaskShader = false;
+    for (const auto& Stage : ShaderStages)
+        HasTaskShader = HasTaskShader || Stage.Type == SHADER_TYPE_AMPLIFICATION;
+
+    std::vector<RefCntAutoPtr<PipelineResourceSignatureVkImpl>> Signatures{m_Signatures, m_Signatures + m_SignatureCount};
+    for (const auto& Stage : ShaderStages)
+    {
+        VERIFY(Stage.Shaders.size() == 1, "Graphics pipelines have exactly one shader per stage");
+
+        const auto* pShader = Stage.Shaders[0];
+        const auto& SPIRV   = Stage.SPIRVs[0];
+
+        ShaderObjectCache::ShaderKey Key;
+        Key.Stage      = ShaderTypeToVkShaderStageFlagBit(Stage.Type);
+        Key.NextStage  = GetNextStages(Key.Stage);
+        Key.EntryPoint = pShader->GetEntryPoint();
+        Key.SPIRV      = SPIRV;
+        Key.Signatures = Signatures;
+        if (Key.Stage == VK_SHADER_STAGE_MESH_BIT_EXT && !HasTaskShader)
+            Key.Flags |= VK_SHADER_CREATE_NO_TASK_SHADER_BIT_EXT;
+
+        VkShaderCreateInfoEXT ShaderCI{};
+        ShaderCI.sType                  = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT;
+        ShaderCI.pNext                  = nullptr;
+        ShaderCI.flags                  = Key.Flags;
+        ShaderCI.stage                  = Key.Stage;
+        ShaderCI.nextStage              = Key.NextStage;
+        ShaderCI.codeType               = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+        ShaderCI.codeSize               = SPIRV.size() * sizeof(uint32_t);
+        ShaderCI.pCode                  = SPIRV.data();
+        ShaderCI.pName                  = pShader->GetEntryPoint();
+        ShaderCI.setLayoutCount         = static_cast<uint32_t>(SetLayouts.size());
+        ShaderCI.pSetLayouts            = !SetLayouts.empty() ? SetLayouts.data() : nullptr;
+        ShaderCI.pushConstantRangeCount = 0;
+        ShaderCI.pPushConstantRanges    = nullptr;
+        ShaderCI.pSpecializationInfo    = nullptr;
+
+        const VkShaderEXT vkShader = ShaderCache.GetShader(
+            std::move(Key),
+            [&]() {
+                return LogicalDevice.CreateShaderObject(ShaderCI, pShader->GetDesc().Name);
+            });
+
+        auto it = std::find(pData->Stages.begin(), pData->Stages.end(), ShaderCI.stage);
+        VERIFY(it != pData->Stages.end(), "Shader stage is not supported by the device. This should've been caught by PSO validation.");
+        if (it != pData->Stages.end())
+            pData->Shaders[it - pData->Stages.begin()] = vkShader;
+    }
+
+    if (m_Desc.PipelineType != PIPELINE_TYPE_MESH)
+    {
+        VkPipelineVertexInputStateCreateInfo           VertexInputStateCI   = {};
+        VkPipelineVertexInputDivisorStateCreateInfoEXT VertexInputDivisorCI = {};
+
+        std::array<VkVertexInputBindingDescription, MAX_LAYOUT_ELEMENTS>           BindingDescriptions;
+        std::array<VkVertexInputAttributeDescription, MAX_LAYOUT_ELEMENTS>         AttributeDescription;
+        std::array<VkVertexInputBindingDivisorDescriptionEXT, MAX_LAYOUT_ELEMENTS> VertexBindingDivisors;
+        InputLayoutDesc_To_VkVertexInputStateCI(GraphicsPipeline.InputLayout, VertexInputStateCI, VertexInputDivisorCI, BindingDescriptions, AttributeDescription, VertexBindingDivisors);
+
+        pData->VertexBindings.resize(VertexInputStateCI.vertexBindingDescriptionCount);
+        for (uint32_t i = 0; i < VertexInputStateCI.vertexBindingDescriptionCount; ++i)
+        {
+            const auto& SrcBinding = BindingDescriptions[i];
+            auto&       DstBinding = pData->VertexBindings[i];
+
+            DstBinding.sType     = VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT;
+            DstBinding.pNext     = nullptr;
+            DstBinding.binding   = SrcBinding.binding;
+            DstBinding.stride    = SrcBinding.stride;
+            DstBinding.inputRate = SrcBinding.inputRate;
+            DstBinding.divisor   = 1;
+            for (uint32_t d = 0; d < VertexInputDivisorCI.vertexBindingDivisorCount; ++d)
+            {
+                if (VertexBindingDivisors[d].binding == SrcBinding.binding)
+                    DstBinding.divisor = VertexBindingDivisors[d].divisor;
+            }
+        }
+
+        pData->VertexAttributes.resize(VertexInputStateCI.vertexAttributeDescriptionCount);
+        for (uint32_t i = 0; i < VertexInputStateCI.vertexAttributeDescriptionCount; ++i)
+        {
+            const auto& SrcAttrib = AttributeDescription[i];
+            auto&       DstAttrib = pData->VertexAttributes[i];
+
+            DstAttrib.sType    = VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT;
+            DstAttrib.pNext    = nullptr;
+            DstAttrib.location = SrcAttrib.location;
+            DstAttrib.binding  = SrcAttrib.binding;
+            DstAttrib.format   = SrcAttrib.format;
+            DstAttrib.offset   = SrcAttrib.offset;
+        }
+
+        PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(GraphicsPipeline.PrimitiveTopology, pData->Topology, pData->PatchControlPoints);
+        // Same as in CreateGraphicsPipeline()
+        pData->PrimitiveRestartEnable =
+            (GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP ||
+             GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_ADJ ||
+             GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP ||
+             GraphicsPipeline.PrimitiveTopology == PRIMITIVE_TOPOLOGY_LINE_STRIP_ADJ) ?
+            VK_TRUE :
+            VK_FALSE;
+    }
+
+    pData->RasterizerState   = RasterizerStateDesc_To_VkRasterizationStateCI(GraphicsPipeline.RasterizerDesc);
+    pData->DepthStencilState = DepthStencilStateDesc_To_VkDepthStencilStateCI(GraphicsPipeline.DepthStencilDesc);
+
+    std::vector<VkPipelineColorBlendAttachmentState> ColorBlendAttachmentStates(GraphicsPipeline.NumRenderTargets);
+
+    VkPipelineColorBlendStateCreateInfo BlendStateCI{};
+    BlendStateCI.attachmentCount = GraphicsPipeline.NumRenderTargets;
+    BlendStateDesc_To_VkBlendStateCI(GraphicsPipeline.BlendDesc, BlendStateCI, ColorBlendAttachmentStates);
+
+    for (const auto& Attachment : ColorBlendAttachmentStates)
+    {
+        pData->ColorBlendEnables.push_back(Attachment.blendEnable);
+        pData->ColorBlendEquations.push_back({
+            Attachment.srcColorBlendFactor,
+            Attachment.dstColorBlendFactor,
+            Attachment.colorBlendOp,
+            Attachment.srcAlphaBlendFactor,
+            Attachment.dstAlphaBlendFactor,
+            Attachment.alphaBlendOp,
+        });
+        pData->ColorWriteMasks.push_back(Attachment.colorWriteMask);
+    }
+
+    m_pShaderObjectData = std::move(pData);
+}
+
 void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+
+    if ((CreateInfo.Flags & PSO_CREATE_FLAG_SHADER_OBJECTS) != 0)
+    {
+        // Shader objects are only compatible with dynamic rendering.
+        // Note that they are never optimized in the background as there is no pipeline to replace.
+        m_UseDynamicRendering = true;
+        InitShaderObjects(ShaderStages);
+        return;
+    }
 
-    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+    // Fast-linked pipelines are only used while the optimized pipeline is being compiled in the background
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    const bool   FastLink    = pThreadPool != nullptr && m_pDevice->GetPhysicalDevice().GetExtProperties().GraphicsPipelineLibrary.graphicsPipelineLibraryFastLinking != VK_FALSE;
+
+    std::vector<VkPipeline> Libraries;
+    VkPipelineCreateFlags   LinkFlags = 0;
+
+    const PipelineStateCacheVkImpl::ThreadCache vkSPOCache{CreateInfo.pPSOCache};
+    CreateGraphicsPipeline(m_pDevice, vkShaderStages, ShaderStages, m_Signatures, m_SignatureCount, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc,
+                           m_Pipeline, GetRenderPassPtr(), vkSPOCache, m_UseDynamicRendering, FastLink, Libraries, LinkFlags);
+
+    // When SPIR-V optimization is deferred, the optimized pipeline is rebuilt from the optimized bytecode instead
+    if (!EnqueueOptimizeSPIRVTask(ShaderStages, CreateInfo.pPSOCache) && FastLink && !Libraries.empty())
+    {
+        // Link the optimized pipeline from the same libraries in the background.
+        // Libraries are owned by the device's pipeline library cache and outlive the pipeline.
+        m_pOptimizePipelineTask = EnqueueAsyncWork(
+            pThreadPool,
+            [this,
+             Libraries = std::move(Libraries),
+             LinkFlags,
+             pPSOCache = RefCntAutoPtr<IPipelineStateCache>{CreateInfo.pPSOCache}](Uint32 ThreadId) //
+            {
+                const PipelineStateCacheVkImpl::ThreadCache vkPSOCache{pPSOCache};
+                try
+                {
+                    m_OptimizedPipeline = LinkGraphicsPipeline(m_pDevice->GetLogicalDevice(), Libraries, m_PipelineLayout.GetVkPipelineLayout(),
+                                                               LinkFlags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT, vkPSOCache, m_Desc.Name);
+                    m_OptimizedPipelineReady.store(true);
+                }
+                catch (...)
+                {
+                    // The fast-linked pipeline will continue to be used
+                }
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+    }
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const auto ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
-    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+    const PipelineStateCacheVkImpl::ThreadCache vkSPOCache{CreateInfo.pPSOCache};
     CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
+
+    EnqueueOptimizeSPIRVTask(ShaderStages, CreateInfo.pPSOCache);
 }
 
 void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
 
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
@@ -851,8 +1479,8 @@ void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreate
 
     const auto ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
     const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
-    const auto vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
 
+    const PipelineStateCacheVkImpl::ThreadCache vkSPOCache{CreateInfo.pPSOCache};
     CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, m_pRayTracingPipelineData->Desc, m_Pipeline, vkSPOCache);
 
     VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
@@ -898,7 +1526,16 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
 
 void PipelineStateVkImpl::Destruct()
 {
+    if (m_pOptimizePipelineTask)
+    {
+        // The task references the pipeline layout and the pipeline object
+        m_pOptimizePipelineTask->Cancel();
+        m_pOptimizePipelineTask->WaitForCompletion();
+        m_pOptimizePipelineTask.Release();
+    }
+
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
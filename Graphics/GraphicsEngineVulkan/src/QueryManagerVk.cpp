@@ -30,6 +30,7 @@
 #include "QueryManagerVk.hpp"
 
 #include <algorithm>
+#include <functional>
 
 #include "RenderDeviceVkImpl.hpp"
 #include "GraphicsAccessories.hpp"
@@ -46,9 +47,12 @@ void QueryManagerVk::QueryPoolInfo::Init(const VulkanUtilities::VulkanLogicalDev
     m_QueryCount  = QueryPoolCI.queryCount;
     m_vkQueryPool = LogicalDevice.CreateQueryPool(QueryPoolCI, "QueryManagerVk: query pool");
 
+    // Newly created queries are not used by the GPU
     m_StaleQueries.resize(m_QueryCount);
     for (Uint32 i = 0; i < m_QueryCount; ++i)
-        m_StaleQueries[i] = i;
+        m_StaleQueries[i] = {i, 0};
+    m_AvailableQueries.reserve(m_QueryCount);
+    m_QueriesToReset.reserve(m_QueryCount);
 }
 
 QueryManagerVk::QueryPoolInfo::~QueryPoolInfo()
@@ -81,7 +85,7 @@ Uint32 QueryManagerVk::QueryPoolInfo::Allocate()
     return Index;
 }
 
-void QueryManagerVk::QueryPoolInfo::Discard(Uint32 Index)
+void QueryManagerVk::QueryPoolInfo::Discard(Uint32 Index, Uint64 FenceValue)
 {
     std::lock_guard<std::mutex> Lock{m_QueriesMtx};
 
@@ -89,58 +93,79 @@ void QueryManagerVk::QueryPoolInfo::Discard(Uint32 Index)
     VERIFY(m_vkQueryPool != VK_NULL_HANDLE, "Query pool is not initialized");
     VERIFY(std::find(m_AvailableQueries.begin(), m_AvailableQueries.end(), Index) == m_AvailableQueries.end(),
            "Index ", Index, " already present in available queries list");
-    VERIFY(std::find(m_StaleQueries.begin(), m_StaleQueries.end(), Index) == m_StaleQueries.end(),
+    VERIFY(std::find_if(m_StaleQueries.begin(), m_StaleQueries.end(), [Index](const StaleQuery& Q) { return Q.Index == Index; }) == m_StaleQueries.end(),
            "Index ", Index, " already present in stale queries list");
 
-    m_StaleQueries.push_back(Index);
+    m_StaleQueries.push_back({Index, FenceValue});
 }
 
 Uint32 QueryManagerVk::QueryPoolInfo::ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
-                                                        VulkanUtilities::VulkanCommandBuffer&       CmdBuff)
+                                                        VulkanUtilities::VulkanCommandBuffer&       CmdBuff,
+                                                        Uint64                                      CompletedFenceValue)
 {
+    std::lock_guard<std::mutex> Lock{m_QueriesMtx};
     if (m_StaleQueries.empty())
         return 0;
 
-    const auto& EnabledExtFeatures = LogicalDevice.GetEnabledExtFeatures();
+    VERIFY(!IsNull(), "Query pool is not initialized");
+
+    // Host query reset does not require a render pass to be ended and does not add commands to the
+    // command buffer, but the queries must not be used by the GPU when they are reset (17.2).
+    // Command buffer reset is ordered with the commands previously submitted to the queue, but
+    // vkCmdResetQueryPool must be called outside of a render pass.
+    const bool UseHostReset = LogicalDevice.GetEnabledExtFeatures().HostQueryReset.hostQueryReset != VK_FALSE;
 
-    auto ResetQueries = [&](uint32_t FirstQuery, uint32_t QueryCount) //
+    m_QueriesToReset.clear();
+    if (UseHostReset)
     {
-        if (EnabledExtFeatures.HostQueryReset.hostQueryReset)
-        {
-            LogicalDevice.ResetQueryPool(m_vkQueryPool, FirstQuery, QueryCount);
-        }
-        else
-        {
-            // Note that vkCmdResetQueryPool must be called outside of a render pass,
-            // so it is suboptimal to postpone query reset until it is used.
-            CmdBuff.ResetQueryPool(m_vkQueryPool, FirstQuery, QueryCount);
-        }
-    };
+        auto StaleEnd = std::remove_if(m_StaleQueries.begin(), m_StaleQueries.end(),
+                                       [&](const StaleQuery& Q) //
+                                       {
+                                           if (Q.FenceValue > CompletedFenceValue)
+                                               return false;
+                                           m_QueriesToReset.push_back(Q.Index);
+                                           return true;
+                                       });
+        m_StaleQueries.erase(StaleEnd, m_StaleQueries.end());
+    }
+    else
+    {
+        for (const auto& Q : m_StaleQueries)
+            m_QueriesToReset.push_back(Q.Index);
+        m_StaleQueries.clear();
+    }
 
-    std::lock_guard<std::mutex> Lock{m_QueriesMtx};
-    VERIFY(!IsNull(), "Query pool is not initialized");
+    if (m_QueriesToReset.empty())
+        return 0;
 
     // After query pool creation, each query must be reset before it is used.
     // Queries must also be reset between uses (17.2).
+    // Reset contiguous ranges of queries with a single command.
+    std::sort(m_QueriesToReset.begin(), m_QueriesToReset.end());
     Uint32 NumCommands = 0;
-    if (m_StaleQueries.size() == m_QueryCount)
-    {
-        ResetQueries(0, m_QueryCount);
-        m_AvailableQueries.resize(m_QueryCount);
-        for (Uint32 i = 0; i < m_QueryCount; ++i)
-            m_AvailableQueries[i] = i;
-        NumCommands = 1;
-    }
-    else
+    for (size_t i = 0; i < m_QueriesToReset.size();)
     {
-        for (auto& StaleQuery : m_StaleQueries)
+        const auto FirstQuery = m_QueriesToReset[i];
+
+        Uint32 QueryCount = 1;
+        while (i + QueryCount < m_QueriesToReset.size() && m_QueriesToReset[i + QueryCount] == FirstQuery + QueryCount)
+            ++QueryCount;
+
+        if (UseHostReset)
         {
-            ResetQueries(StaleQuery, 1);
-            m_AvailableQueries.push_back(StaleQuery);
+            LogicalDevice.ResetQueryPool(m_vkQueryPool, FirstQuery, QueryCount);
         }
-        NumCommands = static_cast<Uint32>(m_StaleQueries.size());
+        else
+        {
+            CmdBuff.ResetQueryPool(m_vkQueryPool, FirstQuery, QueryCount);
+            ++NumCommands;
+        }
+        i += QueryCount;
     }
-    m_StaleQueries.clear();
+
+    // Keep available queries sorted in descending order
+    m_AvailableQueries.insert(m_AvailableQueries.end(), m_QueriesToReset.begin(), m_QueriesToReset.end());
+    std::sort(m_AvailableQueries.begin(), m_AvailableQueries.end(), std::greater<Uint32>{});
 
     return NumCommands;
 }
@@ -274,19 +299,22 @@ Uint32 QueryManagerVk::AllocateQuery(QUERY_TYPE Type)
     return m_Pools[Type].Allocate();
 }
 
-void QueryManagerVk::DiscardQuery(QUERY_TYPE Type, Uint32 Index)
+void QueryManagerVk::DiscardQuery(QUERY_TYPE Type, Uint32 Index, Uint64 FenceValue)
 {
-    m_Pools[Type].Discard(Index);
+    m_Pools[Type].Discard(Index, FenceValue);
 }
 
-Uint32 QueryManagerVk::ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, VulkanUtilities::VulkanCommandBuffer& CmdBuff)
+Uint32 QueryManagerVk::ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                         VulkanUtilities::VulkanCommandBuffer&       CmdBuff,
+                                         Uint64                                      CompletedFenceValue)
 {
-    Uint32 NumQueriesReset = 0;
+    Uint32 NumCommands = 0;
     for (auto& PoolInfo : m_Pools)
     {
-        NumQueriesReset += PoolInfo.ResetStaleQueries(LogicalDevice, CmdBuff);
+        if (!PoolInfo.IsNull())
+            NumCommands += PoolInfo.ResetStaleQueries(LogicalDevice, CmdBuff, CompletedFenceValue);
     }
-    return NumQueriesReset;
+    return NumCommands;
 }
 
 } // namespace Diligent
@@ -63,7 +63,9 @@ void QueryVkImpl::DiscardQueries()
         if (QueryPoolIdx != QueryManagerVk::InvalidIndex)
         {
             VERIFY_EXPR(m_pQueryMgr != nullptr);
-            m_pQueryMgr->DiscardQuery(m_Desc.Type, QueryPoolIdx);
+            // Commands that use the query are submitted no later than with the next fence value
+            const auto FenceValue = m_pDevice->GetNextFenceValue(m_pQueryMgr->GetCommandQueueId());
+            m_pQueryMgr->DiscardQuery(m_Desc.Type, QueryPoolIdx, FenceValue);
             QueryPoolIdx = QueryManagerVk::InvalidIndex;
         }
     }
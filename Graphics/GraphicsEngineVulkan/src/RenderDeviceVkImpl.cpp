@@ -52,6 +52,10 @@
 #include "EngineMemory.h"
 #include "QueryManagerVk.hpp"
 
+#if !DILIGENT_NO_GLSLANG
+#    include "GLSLangUtils.hpp"
+#endif
+
 namespace Diligent
 {
 
@@ -81,6 +85,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     m_LogicalVkDevice        {std::move(LogicalDevice) },
     m_FramebufferCache       {*this                    },
     m_ImplicitRenderPassCache{*this                    },
+    m_PipelineLibraryCache   {*this                    },
+    m_ShaderObjectCache      {*this                    },
     m_DescriptorSetAllocator
     {
         *this,
@@ -134,7 +140,8 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DeviceLocalMemoryPageSize,
         EngineCI.HostVisibleMemoryPageSize,
         EngineCI.DeviceLocalMemoryReserveSize,
-        EngineCI.HostVisibleMemoryReserveSize
+        EngineCI.HostVisibleMemoryReserveSize,
+        EngineCI.DedicatedAllocationThreshold
     },
     m_DynamicMemoryManager
     {
@@ -143,7 +150,9 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DynamicHeapSize,
         ~Uint64{0}
     },
-    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)}
+    m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)},
+    m_pShaderBytecodeStore{EngineCI.EnableShaderBytecodeCache ? ShaderBytecodeStore::Get(EngineCI.pShaderBytecodeCacheDir) : nullptr},
+    m_DeferSPIRVOptimization{EngineCI.DeferSPIRVOptimization != False}
 // clang-format on
 {
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
@@ -195,10 +204,41 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
 
     InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
+
+#if !DILIGENT_NO_GLSLANG
+    if (m_pShaderCompilationThreadPool)
+    {
+        // Build glslang built-in symbol tables in the background so that the first
+        // shaders do not have to wait for it. Use the same targets as ShaderVkImpl.
+        GLSLangUtils::GlslangWarmUpAttribs WarmUpAttribs;
+        WarmUpAttribs.ShaderStages         = SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL | SHADER_TYPE_COMPUTE;
+        WarmUpAttribs.GLSLVersionDirective = "#version 460 core";
+        if (vkVersion >= VK_API_VERSION_1_2)
+            WarmUpAttribs.Version = GLSLangUtils::SpirvVersion::Vk120;
+        else if (vkVersion >= VK_API_VERSION_1_1)
+            WarmUpAttribs.Version = m_LogicalVkDevice->GetEnabledExtFeatures().Spirv14 ? GLSLangUtils::SpirvVersion::Vk110_Spirv14 : GLSLangUtils::SpirvVersion::Vk110;
+
+        m_pGlslangWarmUpTask = EnqueueAsyncWork(m_pShaderCompilationThreadPool,
+                                                [WarmUpAttribs](Uint32 ThreadId) {
+                                                    GLSLangUtils::WarmUpGlslang(WarmUpAttribs);
+
+                                                    // HLSL shaders always target SPIRV 1.0
+                                                    GLSLangUtils::GlslangWarmUpAttribs HLSLAttribs;
+                                                    HLSLAttribs.ShaderStages = WarmUpAttribs.ShaderStages;
+                                                    HLSLAttribs.HLSL         = true;
+                                                    GLSLangUtils::WarmUpGlslang(HLSLAttribs);
+                                                    return ASYNC_TASK_STATUS_COMPLETE;
+                                                });
+    }
+#endif
 }
 
 RenderDeviceVkImpl::~RenderDeviceVkImpl()
 {
+    // glslang is finalized when the Vulkan instance is destroyed, so wait for the warm-up task
+    if (m_pGlslangWarmUpTask)
+        m_pGlslangWarmUpTask->WaitForCompletion();
+
     // Explicitly destroy dynamic heap. This will move resources owned by
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
@@ -206,6 +246,12 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     // Explicitly destroy render pass cache
     m_ImplicitRenderPassCache.Destroy();
 
+    // Explicitly destroy pipeline library cache
+    m_PipelineLibraryCache.Destroy();
+
+    // Explicitly destroy shader object cache
+    m_ShaderObjectCache.Destroy();
+
     // Wait for the GPU to complete all its operations
     IdleGPU();
 
@@ -310,12 +356,14 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
     //              |            |    F < SubmittedFenceValue==F+1        |                                      |
     //
     // Since transient command buffers do not count as real command buffers, submit them directly to the queue
-    // to avoid interference with the command buffer counter
+    // to avoid interference with the command buffer counter.
+    // Transient command buffers are not submitted immediately, but are batched with the next submission to the
+    // queue, which saves a vkQueueSubmit call and a fence per buffer when many resources are initialized.
     Uint64 FenceValue = 0;
     LockCmdQueueAndRun(CommandQueueId,
                        [&](ICommandQueueVk* pCmdQueueVk) //
                        {
-                           FenceValue = pCmdQueueVk->SubmitCmdBuffer(vkCmdBuff);
+                           FenceValue = ClassPtrCast<CommandQueueVkImpl>(pCmdQueueVk)->EnqueueCmdBuffer(vkCmdBuff);
                        } //
     );
 
@@ -429,6 +477,20 @@ Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueI
 }
 
 
+IThreadPool* RenderDeviceVkImpl::GetPresentThreadPool()
+{
+    std::lock_guard<std::mutex> Lock{m_PresentThreadPoolMtx};
+    if (!m_pPresentThreadPool)
+    {
+        // Presents from all swap chains are serialized on one thread, which
+        // also keeps them in the order in which they were issued.
+        ThreadPoolCreateInfo ThreadPoolCI;
+        ThreadPoolCI.NumThreads = 1;
+        m_pPresentThreadPool    = CreateThreadPool(ThreadPoolCI);
+    }
+    return m_pPresentThreadPool;
+}
+
 void RenderDeviceVkImpl::IdleGPU()
 {
     IdleAllCommandQueues(true);
@@ -436,6 +498,63 @@ void RenderDeviceVkImpl::IdleGPU()
     ReleaseStaleResources();
 }
 
+void RenderDeviceVkImpl::GetMemoryStats(DeviceMemoryStats& Stats)
+{
+    TRenderDeviceBase::GetMemoryStats(Stats);
+
+    auto PageStatsToHeapStats = [](const VulkanUtilities::VulkanMemoryManager::PageStats& PageStats, MemoryHeapStats& HeapStats) //
+    {
+        HeapStats.CommittedSize     = PageStats.AllocatedSize;
+        HeapStats.UsedSize          = PageStats.UsedSize;
+        HeapStats.PeakCommittedSize = PageStats.PeakAllocatedSize;
+        HeapStats.PeakUsedSize      = PageStats.PeakUsedSize;
+    };
+    PageStatsToHeapStats(m_MemoryMgr.GetPageStats(false), Stats.DeviceLocalMemory);
+    PageStatsToHeapStats(m_MemoryMgr.GetPageStats(true), Stats.HostVisibleMemory);
+
+    // The dynamic heap is allocated up-front, so the committed size is constant
+    Stats.DynamicMemory.CommittedSize     = m_DynamicMemoryManager.GetSize();
+    Stats.DynamicMemory.UsedSize          = m_DynamicMemoryManager.GetUsedSize();
+    Stats.DynamicMemory.PeakCommittedSize = m_DynamicMemoryManager.GetSize();
+    Stats.DynamicMemory.PeakUsedSize      = m_DynamicMemoryManager.GetPeakUsedSize();
+
+    Stats.ResourceDescriptors.AllocatedCount = static_cast<Uint32>(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter());
+    Stats.ResourceDescriptors.Capacity       = m_DescriptorSetAllocator.GetPoolCapacity();
+}
+
+Bool RenderDeviceVkImpl::WaitForFences(IFence* const* ppFences,
+                                       const Uint64*  pValues,
+                                       Uint32         NumFences,
+                                       Bool           WaitAll,
+                                       Uint64         Timeout)
+{
+    DvpVerifyWaitForFencesArguments(ppFences, pValues, NumFences);
+    if (NumFences == 0)
+        return True;
+
+    std::vector<VkSemaphore> vkSemaphores(NumFences);
+    for (Uint32 i = 0; i < NumFences; ++i)
+    {
+        FenceVkImpl* pFenceVk = ClassPtrCast<FenceVkImpl>(ppFences[i]);
+        // Fences emulated with binary semaphores and VkFence objects can't be waited on with vkWaitSemaphores
+        if (!pFenceVk->IsTimelineSemaphore())
+            return TRenderDeviceBase::WaitForFences(ppFences, pValues, NumFences, WaitAll, Timeout);
+        vkSemaphores[i] = pFenceVk->GetVkSemaphore();
+    }
+
+    VkSemaphoreWaitInfo WaitInfo{};
+    WaitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    WaitInfo.pNext          = nullptr;
+    WaitInfo.flags          = WaitAll ? VkSemaphoreWaitFlags{0} : VkSemaphoreWaitFlags{VK_SEMAPHORE_WAIT_ANY_BIT};
+    WaitInfo.semaphoreCount = NumFences;
+    WaitInfo.pSemaphores    = vkSemaphores.data();
+    WaitInfo.pValues        = pValues;
+
+    const VkResult err = m_LogicalVkDevice->WaitSemaphores(WaitInfo, Timeout);
+    DEV_CHECK_ERR(err == VK_SUCCESS || err == VK_TIMEOUT, "Failed to wait for timeline semaphores");
+    return err == VK_SUCCESS ? True : False;
+}
+
 void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 {
     // Submit empty command buffer to the queue. This will effectively signal the fence and
@@ -602,6 +721,9 @@ void RenderDeviceVkImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
         GetLogicalDevice().GetEnabledExtFeatures().Spirv14,
         ppCompilerOutput,
         m_pShaderCompilationThreadPool,
+        m_pShaderBytecodeStore.get(),
+        &m_ShaderReflectionRegistry,
+        DeferSPIRVOptimization(),
     };
     CreateShaderImpl(ppShader, ShaderCI, VkShaderCI);
 }
@@ -692,6 +814,62 @@ void RenderDeviceVkImpl::CreateFenceFromVulkanResource(VkSemaphore      vkTimeli
     CreateFenceImpl(ppFence, Desc, vkTimelineSemaphore);
 }
 
+void RenderDeviceVkImpl::GetMemoryBudget(MemoryBudgetVk& Budget)
+{
+    static_assert(DILIGENT_MAX_VK_MEMORY_HEAPS == VK_MAX_MEMORY_HEAPS, "DILIGENT_MAX_VK_MEMORY_HEAPS must match VK_MAX_MEMORY_HEAPS");
+
+    Budget = {};
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT vkBudget;
+    Budget.IsBudgetSupported = m_LogicalVkDevice->GetEnabledExtFeatures().MemoryBudget && m_PhysicalDevice->GetMemoryBudget(vkBudget);
+
+    const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
+    Budget.HeapCount        = MemoryProps.memoryHeapCount;
+    for (Uint32 HeapIdx = 0; HeapIdx < Budget.HeapCount; ++HeapIdx)
+    {
+        const auto& vkHeap     = MemoryProps.memoryHeaps[HeapIdx];
+        auto&       HeapBudget = Budget.Heaps[HeapIdx];
+
+        HeapBudget.Size                = vkHeap.size;
+        HeapBudget.EngineAllocatedSize = m_MemoryMgr.GetHeapAllocatedSize(HeapIdx);
+        HeapBudget.IsDeviceLocal       = (vkHeap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+        if (Budget.IsBudgetSupported)
+        {
+            HeapBudget.Budget = vkBudget.heapBudget[HeapIdx];
+            HeapBudget.Usage  = vkBudget.heapUsage[HeapIdx];
+        }
+        else
+        {
+            HeapBudget.Budget = vkHeap.size;
+            HeapBudget.Usage  = HeapBudget.EngineAllocatedSize;
+        }
+    }
+}
+
+void RenderDeviceVkImpl::SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback,
+                                                 void*                      pUserData,
+                                                 float                      Threshold)
+{
+    if (Callback == nullptr)
+    {
+        m_MemoryMgr.SetBudgetCallback(nullptr, 1.f);
+        return;
+    }
+
+    DEV_CHECK_ERR(Threshold > 0 && Threshold <= 1, "Memory budget threshold (", Threshold, ") must be in (0, 1] range");
+    if (!m_LogicalVkDevice->GetEnabledExtFeatures().MemoryBudget)
+        LOG_WARNING_MESSAGE("VK_EXT_memory_budget extension is not supported by the device: memory budget callback will never be called");
+
+    m_MemoryMgr.SetBudgetCallback(
+        [this, Callback, pUserData](uint32_t HeapIndex) {
+            MemoryBudgetVk Budget;
+            GetMemoryBudget(Budget);
+            VERIFY_EXPR(HeapIndex < Budget.HeapCount);
+            Callback(HeapIndex, &Budget.Heaps[HeapIndex], pUserData);
+        },
+        Threshold);
+}
+
 void RenderDeviceVkImpl::CreateTLAS(const TopLevelASDesc& Desc,
                                     ITopLevelAS**         ppTLAS)
 {
@@ -735,11 +913,11 @@ void RenderDeviceVkImpl::CreatePipelineStateCache(const PipelineStateCacheCreate
     CreatePipelineStateCacheImpl(ppPipelineStateCache, CreateInfo);
 }
 
-std::vector<uint32_t> RenderDeviceVkImpl::ConvertCmdQueueIdsToQueueFamilies(Uint64 CommandQueueMask) const
+RenderDeviceVkImpl::QueueFamilyIndicesArray RenderDeviceVkImpl::ConvertCmdQueueIdsToQueueFamilies(Uint64 CommandQueueMask) const
 {
     std::bitset<MAX_COMMAND_QUEUES> QueueFamilyBits{};
 
-    std::vector<uint32_t> QueueFamilyIndices;
+    QueueFamilyIndicesArray QueueFamilyIndices;
     while (CommandQueueMask != 0)
     {
         auto CmdQueueInd = PlatformMisc::GetLSB(CommandQueueMask);
@@ -69,12 +69,28 @@ static RenderPassDesc GetImplicitRenderPassDesc(
     Uint8                                                         SampleCount,
     TEXTURE_FORMAT                                                ShadingRateTexFormat,
     uint2                                                         ShadingRateTileSize,
+    Uint32                                                        ClearMask,
+    Uint32                                                        DiscardLoadMask,
+    Uint32                                                        DiscardStoreMask,
     std::array<RenderPassAttachmentDesc, MAX_RENDER_TARGETS + 2>& Attachments,
     std::array<AttachmentReference, MAX_RENDER_TARGETS + 2>&      AttachmentReferences,
     SubpassDesc&                                                  SubpassDesc,
     ShadingRateAttachment&                                        ShadingRateAttachment)
 {
     VERIFY_EXPR(NumRenderTargets <= MAX_RENDER_TARGETS);
+    VERIFY((ClearMask & DiscardLoadMask) == 0, "Attachment can't be both cleared and discarded");
+
+    const auto GetLoadOp = [ClearMask, DiscardLoadMask](Uint32 AttachmentBit) {
+        if (ClearMask & AttachmentBit)
+            return ATTACHMENT_LOAD_OP_CLEAR;
+        else if (DiscardLoadMask & AttachmentBit)
+            return ATTACHMENT_LOAD_OP_DISCARD;
+        else
+            return ATTACHMENT_LOAD_OP_LOAD;
+    };
+    const auto GetStoreOp = [DiscardStoreMask](Uint32 AttachmentBit) {
+        return (DiscardStoreMask & AttachmentBit) ? ATTACHMENT_STORE_OP_DISCARD : ATTACHMENT_STORE_OP_STORE;
+    };
 
     RenderPassDesc RPDesc;
 
@@ -89,14 +105,14 @@ static RenderPassDesc GetImplicitRenderPassDesc(
 
         DepthAttachment.Format      = DSVFormat;
         DepthAttachment.SampleCount = SampleCount;
-        DepthAttachment.LoadOp      = ATTACHMENT_LOAD_OP_LOAD; // previous contents of the image within the render area
-                                                               // will be preserved. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT.
-        DepthAttachment.StoreOp = ATTACHMENT_STORE_OP_STORE;   // the contents generated during the render pass and within the render
-                                                               // area are written to memory. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT.
-        DepthAttachment.StencilLoadOp  = ATTACHMENT_LOAD_OP_LOAD;
-        DepthAttachment.StencilStoreOp = ATTACHMENT_STORE_OP_STORE;
+        // By default, previous contents of the image within the render area are preserved (LOAD_OP_LOAD)
+        // and the contents generated during the render pass are written to memory (STORE_OP_STORE).
+        // For attachments with a depth/stencil format, this uses the access types
+        // VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT and VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT.
+        DepthAttachment.LoadOp         = GetLoadOp(RenderPassCache::RenderPassCacheKey::DepthAttachmentBit);
+        DepthAttachment.StoreOp        = GetStoreOp(RenderPassCache::RenderPassCacheKey::DepthAttachmentBit);
+        DepthAttachment.StencilLoadOp  = GetLoadOp(RenderPassCache::RenderPassCacheKey::StencilAttachmentBit);
+        DepthAttachment.StencilStoreOp = GetStoreOp(RenderPassCache::RenderPassCacheKey::StencilAttachmentBit);
         DepthAttachment.InitialState   = DepthAttachmentState;
         DepthAttachment.FinalState     = DepthAttachmentState;
 
@@ -122,12 +138,12 @@ static RenderPassDesc GetImplicitRenderPassDesc(
 
         ColorAttachment.Format      = RTVFormats[rt];
         ColorAttachment.SampleCount = SampleCount;
-        ColorAttachment.LoadOp      = ATTACHMENT_LOAD_OP_LOAD; // previous contents of the image within the render area
-                                                               // will be preserved. For attachments with a depth/stencil format,
-                                                               // this uses the access type VK_ACCESS_COLOR_ATTACHMENT_READ_BIT.
-        ColorAttachment.StoreOp = ATTACHMENT_STORE_OP_STORE;   // the contents generated during the render pass and within the render
-                                                               // area are written to memory. For attachments with a color format,
-                                                               // this uses the access type VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT.
+        // By default, previous contents of the image within the render area are preserved (LOAD_OP_LOAD)
+        // and the contents generated during the render pass are written to memory (STORE_OP_STORE).
+        // For attachments with a color format, this uses the access types
+        // VK_ACCESS_COLOR_ATTACHMENT_READ_BIT and VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT.
+        ColorAttachment.LoadOp         = GetLoadOp(1u << rt);
+        ColorAttachment.StoreOp        = GetStoreOp(1u << rt);
         ColorAttachment.StencilLoadOp  = ATTACHMENT_LOAD_OP_DISCARD;
         ColorAttachment.StencilStoreOp = ATTACHMENT_STORE_OP_DISCARD;
         ColorAttachment.InitialState   = RESOURCE_STATE_RENDER_TARGET;
@@ -212,7 +228,7 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
         ShadingRateAttachment ShadingRate;
 
         auto RPDesc = GetImplicitRenderPassDesc(Key.NumRenderTargets, Key.RTVFormats, Key.DSVFormat, Key.ReadOnlyDSV, Key.SampleCount, SRFormat, SRTileSize,
-                                                Attachments, AttachmentReferences, Subpass, ShadingRate);
+                                                Key.ClearMask, Key.DiscardLoadMask, Key.DiscardStoreMask, Attachments, AttachmentReferences, Subpass, ShadingRate);
 
         std::stringstream PassNameSS;
         PassNameSS << "Implicit render pass: RT count: " << Uint32{Key.NumRenderTargets} << "; sample count: " << Uint32{Key.SampleCount}
@@ -227,6 +243,11 @@ RenderPassVkImpl* RenderPassCache::GetRenderPass(const RenderPassCacheKey& Key)
         }
         if (Key.EnableVRS)
             PassNameSS << "; VRS";
+        if (Key.ClearMask != 0 || Key.DiscardLoadMask != 0 || Key.DiscardStoreMask != 0)
+        {
+            PassNameSS << std::hex << "; clear mask: 0x" << Uint32{Key.ClearMask} << "; discard load mask: 0x" << Uint32{Key.DiscardLoadMask}
+                       << "; discard store mask: 0x" << Uint32{Key.DiscardStoreMask};
+        }
 
         const auto PassName{PassNameSS.str()};
         RPDesc.Name = PassName.c_str();
@@ -47,13 +47,14 @@ ShaderBindingTableVkImpl::~ShaderBindingTableVkImpl()
 {
 }
 
-void ShaderBindingTableVkImpl::GetData(BufferVkImpl*& pSBTBufferVk,
-                                       BindingTable&  RayGenShaderRecord,
-                                       BindingTable&  MissShaderTable,
-                                       BindingTable&  HitGroupTable,
-                                       BindingTable&  CallableShaderTable)
+void ShaderBindingTableVkImpl::GetData(BufferVkImpl*&                  pSBTBufferVk,
+                                       BindingTable&                   RayGenShaderRecord,
+                                       BindingTable&                   MissShaderTable,
+                                       BindingTable&                   HitGroupTable,
+                                       BindingTable&                   CallableShaderTable,
+                                       std::vector<BufferUpdateRange>& UpdateRanges)
 {
-    TShaderBindingTableBase::GetData(pSBTBufferVk, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable);
+    TShaderBindingTableBase::GetData(pSBTBufferVk, RayGenShaderRecord, MissShaderTable, HitGroupTable, CallableShaderTable, UpdateRanges);
 
     // clang-format off
     m_VkBindingTable.RaygenShader   = {pSBTBufferVk->GetVkDeviceAddress() + RayGenShaderRecord.Offset,  RayGenShaderRecord.Stride,  RayGenShaderRecord.Size };
@@ -41,6 +41,102 @@
 namespace Diligent
 {
 
+namespace
+{
+
+// Do not zero-initialize!
+union DescriptorWriteInfo
+{
+    VkDescriptorImageInfo                        vkDescrImageInfo;
+    VkDescriptorBufferInfo                       vkDescrBufferInfo;
+    VkBufferView                                 vkDescrBufferView;
+    VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
+};
+
+void InitDescriptorWrite(const ShaderResourceCacheVk::Resource& DstRes,
+                         VkDescriptorSet                        vkSet,
+                         Uint32                                 BindingIndex,
+                         Uint32                                 ArrayIndex,
+                         VkWriteDescriptorSet&                  WriteDescrSet,
+                         DescriptorWriteInfo&                   Info)
+{
+    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescrSet.pNext           = nullptr;
+    WriteDescrSet.dstSet          = vkSet;
+    WriteDescrSet.dstBinding      = BindingIndex;
+    WriteDescrSet.dstArrayElement = ArrayIndex;
+    WriteDescrSet.descriptorCount = 1;
+    // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
+    // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
+    WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
+    WriteDescrSet.pImageInfo       = nullptr;
+    WriteDescrSet.pBufferInfo      = nullptr;
+    WriteDescrSet.pTexelBufferView = nullptr;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (DstRes.Type)
+    {
+        case DescriptorType::Sampler:
+            Info.vkDescrImageInfo    = DstRes.GetSamplerDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &Info.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            Info.vkDescrImageInfo    = DstRes.GetImageDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &Info.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            Info.vkDescrBufferView         = DstRes.GetBufferViewWriteInfo();
+            WriteDescrSet.pTexelBufferView = &Info.vkDescrBufferView;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            Info.vkDescrBufferInfo    = DstRes.GetUniformBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &Info.vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            Info.vkDescrBufferInfo    = DstRes.GetStorageBufferDescriptorWriteInfo();
+            WriteDescrSet.pBufferInfo = &Info.vkDescrBufferInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            Info.vkDescrImageInfo    = DstRes.GetInputAttachmentDescriptorWriteInfo();
+            WriteDescrSet.pImageInfo = &Info.vkDescrImageInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            Info.vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
+            WriteDescrSet.pNext         = &Info.vkDescrAccelStructInfo;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
+} // namespace
+
+struct ShaderResourceCacheVk::PendingDescriptorWrites
+{
+    const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice = nullptr;
+
+    std::vector<VkWriteDescriptorSet> Writes;
+    std::vector<DescriptorWriteInfo>  Infos;
+
+    bool IsActive = false;
+};
+
 size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes)
 {
     Uint32 TotalResources = 0;
@@ -333,86 +429,67 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     {
         VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
 
-        VkWriteDescriptorSet WriteDescrSet;
-        WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
-        WriteDescrSet.descriptorCount = 1;
-        // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
-        // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
-        WriteDescrSet.pImageInfo       = nullptr;
-        WriteDescrSet.pBufferInfo      = nullptr;
-        WriteDescrSet.pTexelBufferView = nullptr;
-
-        // Do not zero-initialize!
-        union
+        if (m_pPendingWrites && m_pPendingWrites->IsActive)
         {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
-
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
+            PendingDescriptorWrites& Pending = *m_pPendingWrites;
+            VERIFY(Pending.pLogicalDevice == nullptr || Pending.pLogicalDevice == pLogicalDevice, "All writes in a bulk update must use the same logical device");
+            Pending.pLogicalDevice = pLogicalDevice;
+            Pending.Writes.emplace_back();
+            Pending.Infos.emplace_back();
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, Pending.Writes.back(), Pending.Infos.back());
+        }
+        else
         {
-            case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+            VkWriteDescriptorSet WriteDescrSet;
+            DescriptorWriteInfo  Info;
+            InitDescriptorWrite(DstRes, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, WriteDescrSet, Info);
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        }
+    }
 
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
-                break;
+    UpdateRevision();
 
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+    return DstRes;
+}
 
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+void ShaderResourceCacheVk::BeginBulkUpdate()
+{
+    if (!m_pPendingWrites)
+        m_pPendingWrites = std::make_unique<PendingDescriptorWrites>();
 
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
+    VERIFY(!m_pPendingWrites->IsActive, "Bulk update is already in progress");
+    m_pPendingWrites->IsActive = true;
+}
 
-            case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
-                break;
+void ShaderResourceCacheVk::EndBulkUpdate()
+{
+    VERIFY(m_pPendingWrites && m_pPendingWrites->IsActive, "BeginBulkUpdate() has not been called");
+    PendingDescriptorWrites& Pending = *m_pPendingWrites;
+    Pending.IsActive                 = false;
 
-            default:
-                UNEXPECTED("Unexpected descriptor type");
-        }
+    if (Pending.Writes.empty())
+        return;
 
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+    // Infos may have been reallocated as writes were added, so update the pointers.
+    VERIFY_EXPR(Pending.Writes.size() == Pending.Infos.size());
+    for (size_t i = 0; i < Pending.Writes.size(); ++i)
+    {
+        VkWriteDescriptorSet& WriteDescrSet = Pending.Writes[i];
+        DescriptorWriteInfo&  Info          = Pending.Infos[i];
+        if (WriteDescrSet.pImageInfo != nullptr)
+            WriteDescrSet.pImageInfo = &Info.vkDescrImageInfo;
+        if (WriteDescrSet.pBufferInfo != nullptr)
+            WriteDescrSet.pBufferInfo = &Info.vkDescrBufferInfo;
+        if (WriteDescrSet.pTexelBufferView != nullptr)
+            WriteDescrSet.pTexelBufferView = &Info.vkDescrBufferView;
+        if (WriteDescrSet.pNext != nullptr)
+            WriteDescrSet.pNext = &Info.vkDescrAccelStructInfo;
     }
+    Pending.pLogicalDevice->UpdateDescriptorSets(static_cast<uint32_t>(Pending.Writes.size()), Pending.Writes.data(), 0, nullptr);
 
-    UpdateRevision();
-
-    return DstRes;
+    Pending.Writes.clear();
+    Pending.Infos.clear();
+    Pending.pLogicalDevice = nullptr;
 }
 
 void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
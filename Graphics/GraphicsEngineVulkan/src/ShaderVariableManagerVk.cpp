@@ -92,7 +92,7 @@ void ShaderVariableManagerVk::Initialize(const PipelineResourceSignatureVkImpl&
     if (m_NumVariables == 0)
         return;
 
-    TBase::Initialize(Signature, Allocator, MemSize);
+    TBase::Initialize(Signature, Allocator, MemSize, ShaderType);
 
     Uint32 VarInd = 0;
     ProcessSignatureResources(Signature, AllowedVarTypes, NumAllowedTypes, ShaderType,
@@ -116,13 +116,11 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableVkImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    const Uint32 ResIndex = FindResourceIndex(Name);
+    if (ResIndex == InvalidPipelineResourceIndex)
+        return nullptr;
+
+    return FindVariableByResIndex(m_pVariables, m_NumVariables, ResIndex);
 }
 
 
@@ -297,7 +295,9 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
             if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
                 m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
             {
-                VERIFY(vkDescrSet != VK_NULL_HANDLE, "Static and mutable variables must have a valid Vulkan descriptor set assigned");
+                // With descriptor buffers, static and mutable descriptors are written when resources are committed
+                VERIFY(vkDescrSet != VK_NULL_HANDLE || Signature.GetDevice()->UseDescriptorBuffers(),
+                       "Static and mutable variables must have a valid Vulkan descriptor set assigned");
             }
             else
             {
@@ -37,6 +37,10 @@
 #include "GLSLUtils.hpp"
 #include "DXCompiler.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ShaderBytecodeStore.hpp"
+#include "HashUtils.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 #if !DILIGENT_NO_GLSLANG
 #    include "GLSLangUtils.hpp"
@@ -51,6 +55,12 @@ namespace Diligent
 
 constexpr INTERFACE_ID ShaderVkImpl::IID_InternalImpl;
 
+size_t ShaderVkImpl::ReflectionKey::Hasher::operator()(const ReflectionKey& Key) const noexcept
+{
+    return ComputeHash(Key.SPIRVHash, Key.SPIRVSize, Key.ShaderType, Key.LoadShaderStageInputs,
+                       Key.LoadConstantBufferReflection, Key.ShaderName, Key.CombinedSamplerSuffix);
+}
+
 namespace
 {
 
@@ -100,7 +110,8 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
 #else
     if (ShaderCI.SourceLanguage == SHADER_SOURCE_LANGUAGE_HLSL)
     {
-        SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, VulkanDefine, VkShaderCI.ppCompilerOutput);
+        SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, VulkanDefine, VkShaderCI.ppCompilerOutput,
+                                          !VkShaderCI.DeferSPIRVOptimization);
     }
     else
     {
@@ -146,6 +157,7 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
         Attribs.UseRowMajorMatrices        = (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0;
         Attribs.pShaderSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
         Attribs.ppCompilerOutput           = VkShaderCI.ppCompilerOutput;
+        Attribs.OptimizeForPerformance     = !VkShaderCI.DeferSPIRVOptimization;
 
         if (VkShaderCI.VkVersion >= VK_API_VERSION_1_2)
             Attribs.Version = GLSLangUtils::SpirvVersion::Vk120;
@@ -159,6 +171,25 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
     return SPIRV;
 }
 
+// Hashes the compilation target parameters that affect the generated SPIR-V.
+size_t ComputeTargetHash(SHADER_COMPILER ShaderCompiler, const ShaderVkImpl::CreateInfo& VkShaderCI)
+{
+    const DeviceFeatures& Features = VkShaderCI.DeviceInfo.Features;
+
+    size_t Hash = ComputeHash(RENDER_DEVICE_TYPE_VULKAN,
+                              ShaderCompiler,
+                              VkShaderCI.VkVersion,
+                              VkShaderCI.HasSpirv14,
+                              VkShaderCI.AdapterInfo.Vendor,
+                              ComputeHashRaw(&Features, sizeof(Features)));
+    if (ShaderCompiler == SHADER_COMPILER_DXC)
+    {
+        const Version DXCVersion = VkShaderCI.pDXCompiler->GetVersion();
+        HashCombine(Hash, DXCVersion.Major, DXCVersion.Minor);
+    }
+    return Hash;
+}
+
 } // namespace
 
 void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
@@ -179,19 +210,63 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
             }
         }
 
-        switch (ShaderCompiler)
+        ShaderBytecodeStore::KeyType BytecodeKey = 0;
+        if (VkShaderCI.pBytecodeStore != nullptr)
         {
-            case SHADER_COMPILER_DXC:
-                m_SPIRV = CompileShaderDXC(ShaderCI, VkShaderCI);
-                break;
+            BytecodeKey = ShaderBytecodeStore::ComputeKey(ShaderCI, ComputeTargetHash(ShaderCompiler, VkShaderCI));
+
+            std::vector<Uint8> Bytecode;
+            if (VkShaderCI.pBytecodeStore->Find(BytecodeKey, Bytecode) && !Bytecode.empty() && Bytecode.size() % 4 == 0)
+            {
+                m_SPIRV.resize(Bytecode.size() / 4);
+                memcpy(m_SPIRV.data(), Bytecode.data(), Bytecode.size());
+            }
+        }
 
-            case SHADER_COMPILER_DEFAULT:
-            case SHADER_COMPILER_GLSLANG:
-                m_SPIRV = CompileShaderGLSLang(ShaderCI, VkShaderCI);
-                break;
+        if (m_SPIRV.empty())
+        {
+            Timer CompileTimer;
+            switch (ShaderCompiler)
+            {
+                case SHADER_COMPILER_DXC:
+                    m_SPIRV = CompileShaderDXC(ShaderCI, VkShaderCI);
+                    break;
+
+                case SHADER_COMPILER_DEFAULT:
+                case SHADER_COMPILER_GLSLANG:
+                    m_SPIRV = CompileShaderGLSLang(ShaderCI, VkShaderCI);
+                    // Performance passes are only skipped by glslang path
+                    m_SPIRVOptimizationDeferred = VkShaderCI.DeferSPIRVOptimization;
+                    break;
+
+                default:
+                    LOG_ERROR_AND_THROW("Unsupported shader compiler");
+            }
+            m_CompileTime.store(CompileTimer.GetElapsedTime());
 
-            default:
-                LOG_ERROR_AND_THROW("Unsupported shader compiler");
+            if (!m_SPIRV.empty() && VkShaderCI.pBytecodeStore != nullptr)
+            {
+                if (!m_SPIRVOptimizationDeferred)
+                {
+                    VkShaderCI.pBytecodeStore->Add(BytecodeKey, m_SPIRV.data(), m_SPIRV.size() * sizeof(m_SPIRV[0]));
+                }
+#if !DILIGENT_NO_HLSL
+                else if (VkShaderCI.pCompilationThreadPool != nullptr)
+                {
+                    // Only store the optimized bytecode so that the next run loads it directly.
+                    // The task is waited for in the destructor as it uses the store owned by the device.
+                    m_pStoreOptimizedSPIRVTask = EnqueueAsyncWork(
+                        VkShaderCI.pCompilationThreadPool,
+                        [SPIRV = m_SPIRV, pBytecodeStore = VkShaderCI.pBytecodeStore, BytecodeKey](Uint32 ThreadId) //
+                        {
+                            const auto OptimizedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+                            if (!OptimizedSPIRV.empty())
+                                pBytecodeStore->Add(BytecodeKey, OptimizedSPIRV.data(), OptimizedSPIRV.size() * sizeof(OptimizedSPIRV[0]));
+                            return ASYNC_TASK_STATUS_COMPLETE;
+                        });
+                }
+#endif
+            }
         }
 
         if (m_SPIRV.empty())
@@ -219,25 +294,57 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_SKIP_REFLECTION) == 0)
         {
-            auto& Allocator = GetRawAllocator();
+            const bool  LoadShaderInputs      = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
+            const char* CombinedSamplerSuffix = m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr;
 
-            std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
-                ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
-                STDDeleterRawMem<void>(Allocator),
-            };
-            auto LoadShaderInputs = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
-            new (pRawMem.get()) SPIRVShaderResources // May throw
-                {
-                    Allocator,
-                    m_SPIRV,
-                    m_Desc,
-                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
-                    LoadShaderInputs,
-                    ShaderCI.LoadConstantBufferReflection,
-                    m_EntryPoint //
+            auto CreateReflection = [&]() {
+                auto& Allocator = GetRawAllocator();
+
+                std::unique_ptr<void, STDDeleterRawMem<void>> pRawMem{
+                    ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
+                    STDDeleterRawMem<void>(Allocator),
                 };
+                auto pReflection = std::make_shared<SharedReflection>();
+                new (pRawMem.get()) SPIRVShaderResources // May throw
+                    {
+                        Allocator,
+                        m_SPIRV,
+                        m_Desc,
+                        CombinedSamplerSuffix,
+                        LoadShaderInputs,
+                        ShaderCI.LoadConstantBufferReflection,
+                        pReflection->EntryPoint //
+                    };
+                pReflection->pResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
+                return std::shared_ptr<const SharedReflection>{std::move(pReflection)};
+            };
+
+            std::shared_ptr<const SharedReflection> pReflection;
+            if (VkShaderCI.pReflectionRegistry != nullptr)
+            {
+                // Shaders with identical bytecode, e.g. the same shader unpacked from an archive
+                // for multiple pipelines, share the reflection data and skip SPIRV-Cross parsing.
+                ReflectionKey Key;
+                Key.SPIRVHash                    = ComputeHashRaw(m_SPIRV.data(), m_SPIRV.size() * sizeof(m_SPIRV[0]));
+                Key.SPIRVSize                    = m_SPIRV.size();
+                Key.ShaderType                   = m_Desc.ShaderType;
+                Key.LoadShaderStageInputs        = LoadShaderInputs;
+                Key.LoadConstantBufferReflection = ShaderCI.LoadConstantBufferReflection;
+                Key.ShaderName                   = m_Desc.Name != nullptr ? m_Desc.Name : "";
+                Key.CombinedSamplerSuffix        = CombinedSamplerSuffix != nullptr ? CombinedSamplerSuffix : "";
+
+                pReflection = VkShaderCI.pReflectionRegistry->Get(Key, CreateReflection);
+            }
+            else
+            {
+                pReflection = CreateReflection();
+            }
+
+            m_EntryPoint = pReflection->EntryPoint;
             VERIFY_EXPR(ShaderCI.ByteCode != nullptr || m_EntryPoint == ShaderCI.EntryPoint);
-            m_pShaderResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
+            // Use the aliasing constructor so that the shared reflection object is kept alive
+            // as long as the shader resources are referenced.
+            m_pShaderResources = std::shared_ptr<const SPIRVShaderResources>{pReflection, pReflection->pResources.get()};
 
             if (LoadShaderInputs && m_pShaderResources->IsHLSLSource())
             {
@@ -281,13 +388,17 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
         this->m_AsyncInitializer = AsyncInitializer::Start(
             VkShaderCI.pCompilationThreadPool,
             [this,
-             ShaderCI         = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()},
-             pDXCompiler      = VkShaderCI.pDXCompiler,
-             DeviceInfo       = VkShaderCI.DeviceInfo,
-             AdapterInfo      = VkShaderCI.AdapterInfo,
-             VkVersion        = VkShaderCI.VkVersion,
-             HasSpirv14       = VkShaderCI.HasSpirv14,
-             ppCompilerOutput = VkShaderCI.ppCompilerOutput](Uint32 ThreadId) mutable //
+             ShaderCI          = ShaderCreateInfoWrapper{ShaderCI, GetRawAllocator()},
+             pDXCompiler       = VkShaderCI.pDXCompiler,
+             DeviceInfo        = VkShaderCI.DeviceInfo,
+             AdapterInfo       = VkShaderCI.AdapterInfo,
+             VkVersion         = VkShaderCI.VkVersion,
+             HasSpirv14        = VkShaderCI.HasSpirv14,
+             ppCompilerOutput  = VkShaderCI.ppCompilerOutput,
+             pThreadPool       = VkShaderCI.pCompilationThreadPool,
+             pBytecodeStore    = VkShaderCI.pBytecodeStore,
+             pReflRegistry     = VkShaderCI.pReflectionRegistry,
+             DeferOptimization = VkShaderCI.DeferSPIRVOptimization](Uint32 ThreadId) mutable //
             {
                 try
                 {
@@ -298,7 +409,10 @@ ShaderVkImpl::ShaderVkImpl(IReferenceCounters*     pRefCounters,
                         VkVersion,
                         HasSpirv14,
                         ppCompilerOutput,
-                        nullptr,
+                        pThreadPool, // Only used to enqueue the bytecode optimization task
+                        pBytecodeStore,
+                        pReflRegistry,
+                        DeferOptimization,
                     };
                     Initialize(ShaderCI, VkShaderCI);
                 }
@@ -316,6 +430,9 @@ ShaderVkImpl::~ShaderVkImpl()
     // Make sure that asynchrous task is complete as it references the shader object.
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion = */ true);
+
+    if (m_pStoreOptimizedSPIRVTask)
+        m_pStoreOptimizedSPIRVTask->WaitForCompletion();
 }
 
 void ShaderVkImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
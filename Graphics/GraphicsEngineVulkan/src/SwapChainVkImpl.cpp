@@ -519,6 +519,8 @@ void SwapChainVkImpl::CreateVulkanSwapChain()
 
 SwapChainVkImpl::~SwapChainVkImpl()
 {
+    FinishAsyncPresent();
+
     if (m_VkSwapChain != VK_NULL_HANDLE)
     {
         auto  pDeviceContext  = m_wpDeviceContext.Lock();
@@ -604,6 +606,14 @@ void SwapChainVkImpl::InitBuffersAndViews()
 }
 
 VkResult SwapChainVkImpl::AcquireNextImage(DeviceContextVkImpl* pDeviceCtxVk)
+{
+    auto res = AcquireVkImage();
+    if (res == VK_SUCCESS)
+        OnImageAcquired(pDeviceCtxVk);
+    return res;
+}
+
+VkResult SwapChainVkImpl::AcquireVkImage()
 {
     auto*       pDeviceVk     = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>();
     const auto& LogicalDevice = pDeviceVk->GetLogicalDevice();
@@ -648,29 +658,30 @@ VkResult SwapChainVkImpl::AcquireNextImage(DeviceContextVkImpl* pDeviceCtxVk)
     auto res = vkAcquireNextImageKHR(LogicalDevice.GetVkDevice(), m_VkSwapChain, UINT64_MAX, ImageAcquiredSemaphore, ImageAcquiredFence, &m_BackBufferIndex);
 
     m_ImageAcquiredFenceSubmitted[m_SemaphoreIndex] = (res == VK_SUCCESS);
-    if (res == VK_SUCCESS)
-    {
-        // Next command in the device context must wait for the next image to be acquired.
-        // Unlike fences or events, the act of waiting for a semaphore also unsignals that semaphore (6.4.2).
-        // Swapchain image may be used as render target or as destination for copy command.
-        pDeviceCtxVk->AddWaitSemaphore(m_ImageAcquiredSemaphores[m_SemaphoreIndex], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
-        if (!m_SwapChainImagesInitialized[m_BackBufferIndex])
-        {
-            // Vulkan validation layers do not like uninitialized memory.
-            // Clear back buffer first time we acquire it.
-
-            ITextureView* pRTV = GetCurrentBackBufferRTV();
-            ITextureView* pDSV = GetDepthBufferDSV();
-            pDeviceCtxVk->SetRenderTargets(1, &pRTV, pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
-            pDeviceCtxVk->ClearRenderTarget(GetCurrentBackBufferRTV(), nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
-            m_SwapChainImagesInitialized[m_BackBufferIndex] = true;
-        }
-        pDeviceCtxVk->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
-    }
 
     return res;
 }
 
+void SwapChainVkImpl::OnImageAcquired(DeviceContextVkImpl* pDeviceCtxVk)
+{
+    // Next command in the device context must wait for the next image to be acquired.
+    // Unlike fences or events, the act of waiting for a semaphore also unsignals that semaphore (6.4.2).
+    // Swapchain image may be used as render target or as destination for copy command.
+    pDeviceCtxVk->AddWaitSemaphore(m_ImageAcquiredSemaphores[m_SemaphoreIndex], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
+    if (!m_SwapChainImagesInitialized[m_BackBufferIndex])
+    {
+        // Vulkan validation layers do not like uninitialized memory.
+        // Clear back buffer first time we acquire it.
+
+        ITextureView* pRTV = GetCurrentBackBufferRTV();
+        ITextureView* pDSV = GetDepthBufferDSV();
+        pDeviceCtxVk->SetRenderTargets(1, &pRTV, pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pDeviceCtxVk->ClearRenderTarget(GetCurrentBackBufferRTV(), nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        m_SwapChainImagesInitialized[m_BackBufferIndex] = true;
+    }
+    pDeviceCtxVk->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+}
+
 void SwapChainVkImpl::Present(Uint32 SyncInterval)
 {
     if (SyncInterval != 0 && SyncInterval != 1)
@@ -686,6 +697,9 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
     auto* pImmediateCtxVk = pDeviceContext.RawPtr<DeviceContextVkImpl>();
     auto* pDeviceVk       = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>();
 
+    // The previous asynchronous present must acquire the image we are about to present
+    FinishAsyncPresent();
+
     auto* pBackBuffer = GetCurrentBackBufferRTV()->GetTexture();
     pImmediateCtxVk->UnbindTextureFromFramebuffer(ClassPtrCast<TextureVkImpl>(pBackBuffer), false);
 
@@ -700,29 +714,43 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
 
     pImmediateCtxVk->Flush();
 
-    if (!m_IsMinimized)
+    const bool EnableVSync = SyncInterval != 0;
+    if (!m_IsMinimized && m_SwapChainDesc.AsyncPresent && m_VSyncEnabled == EnableVSync)
     {
-        VkPresentInfoKHR PresentInfo = {};
-
-        PresentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-        PresentInfo.pNext              = nullptr;
-        PresentInfo.waitSemaphoreCount = 1;
-        // Unlike fences or events, the act of waiting for a semaphore also unsignals that semaphore (6.4.2)
-        VkSemaphore WaitSemaphore[] = {m_DrawCompleteSemaphores[m_SemaphoreIndex]->Get()};
-        PresentInfo.pWaitSemaphores = WaitSemaphore;
-        PresentInfo.swapchainCount  = 1;
-        PresentInfo.pSwapchains     = &m_VkSwapChain;
-        PresentInfo.pImageIndices   = &m_BackBufferIndex;
-        VkResult Result             = VK_SUCCESS;
-        PresentInfo.pResults        = &Result;
-        pDeviceVk->LockCmdQueueAndRun(
-            pImmediateCtxVk->GetCommandQueueId(),
-            [&PresentInfo](ICommandQueueVk* pCmdQueueVk) //
-            {
-                pCmdQueueVk->Present(PresentInfo);
-            } //
-        );
+        // Present the image, wait for the frame latency and acquire the next image on the present thread.
+        // The swap chain is only accessed by the present thread until FinishAsyncPresent() is called.
+        // Operations that require the immediate context and swap chain recreation are performed
+        // by FinishAsyncPresent() on the render thread.
+        m_pAsyncPresentTask = EnqueueAsyncWork(pDeviceVk->GetPresentThreadPool(),
+                                               [this, CmdQueueId = pImmediateCtxVk->GetCommandQueueId()](Uint32 ThreadId) //
+                                               {
+                                                   m_AsyncAcquireResult = VK_NOT_READY;
+                                                   m_AsyncPresentResult = PresentVkImage(CmdQueueId);
+                                                   if (m_AsyncPresentResult == VK_SUCCESS)
+                                                   {
+                                                       WaitForPresent();
+
+                                                       ++m_SemaphoreIndex;
+                                                       if (m_SemaphoreIndex >= m_SwapChainDesc.BufferCount)
+                                                           m_SemaphoreIndex = 0;
+
+                                                       m_AsyncAcquireResult = AcquireVkImage();
+                                                   }
+                                                   m_FrameStartTime = std::chrono::steady_clock::now();
+                                                   return ASYNC_TASK_STATUS_COMPLETE;
+                                               });
+
+        if (m_SwapChainDesc.IsPrimary)
+        {
+            pImmediateCtxVk->FinishFrame();
+            pDeviceVk->ReleaseStaleResources();
+        }
+        return;
+    }
 
+    if (!m_IsMinimized)
+    {
+        auto Result = PresentVkImage(pImmediateCtxVk->GetCommandQueueId());
         if (Result == VK_SUBOPTIMAL_KHR || Result == VK_ERROR_OUT_OF_DATE_KHR)
         {
             RecreateVulkanSwapchain(pImmediateCtxVk);
@@ -742,34 +770,205 @@ void SwapChainVkImpl::Present(Uint32 SyncInterval)
 
     if (!m_IsMinimized)
     {
+        WaitForPresent();
+
         ++m_SemaphoreIndex;
         if (m_SemaphoreIndex >= m_SwapChainDesc.BufferCount)
             m_SemaphoreIndex = 0;
 
-        bool EnableVSync = SyncInterval != 0;
-
         auto res = (m_VSyncEnabled == EnableVSync) ? AcquireNextImage(pImmediateCtxVk) : VK_ERROR_OUT_OF_DATE_KHR;
         if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR)
         {
             m_VSyncEnabled = EnableVSync;
-            RecreateVulkanSwapchain(pImmediateCtxVk);
-            m_SemaphoreIndex = m_SwapChainDesc.BufferCount - 1; // To start with 0 index when acquire next image
+            RecreateAndAcquireNextImage(pImmediateCtxVk);
+        }
+        else
+        {
+            DEV_CHECK_ERR(res == VK_SUCCESS, "Failed to acquire next swap chain image");
+        }
+    }
+
+    m_FrameStartTime = std::chrono::steady_clock::now();
+}
+
+VkResult SwapChainVkImpl::PresentVkImage(SoftwareQueueIndex CmdQueueId)
+{
+    auto* pDeviceVk = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>();
+
+    VkPresentInfoKHR PresentInfo = {};
+
+    PresentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    PresentInfo.pNext              = nullptr;
+    PresentInfo.waitSemaphoreCount = 1;
+    // Unlike fences or events, the act of waiting for a semaphore also unsignals that semaphore (6.4.2)
+    VkSemaphore WaitSemaphore[] = {m_DrawCompleteSemaphores[m_SemaphoreIndex]->Get()};
+    PresentInfo.pWaitSemaphores = WaitSemaphore;
+    PresentInfo.swapchainCount  = 1;
+    PresentInfo.pSwapchains     = &m_VkSwapChain;
+    PresentInfo.pImageIndices   = &m_BackBufferIndex;
+    VkResult Result             = VK_SUCCESS;
+    PresentInfo.pResults        = &Result;
+
+    VkPresentIdKHR PresentId{};
+    if (IsPresentWaitEnabled())
+    {
+        ++m_PresentId;
+        PresentId.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        PresentId.swapchainCount = 1;
+        PresentId.pPresentIds    = &m_PresentId;
+        PresentInfo.pNext        = &PresentId;
+    }
+    pDeviceVk->LockCmdQueueAndRun(
+        CmdQueueId,
+        [&PresentInfo](ICommandQueueVk* pCmdQueueVk) //
+        {
+            pCmdQueueVk->Present(PresentInfo);
+        } //
+    );
+
+    if (PresentInfo.pNext != nullptr && (Result == VK_SUCCESS || Result == VK_SUBOPTIMAL_KHR))
+        m_PendingPresents.push_back({m_PresentId, m_FrameStartTime});
 
-            res = AcquireNextImage(pImmediateCtxVk);
+    return Result;
+}
+
+void SwapChainVkImpl::RecreateAndAcquireNextImage(DeviceContextVkImpl* pImmediateCtxVk)
+{
+    RecreateVulkanSwapchain(pImmediateCtxVk);
+    m_SemaphoreIndex = m_SwapChainDesc.BufferCount - 1; // To start with 0 index when acquire next image
+
+    auto res = AcquireNextImage(pImmediateCtxVk);
 
 #if PLATFORM_APPLE
-            // For some reason, on MoltenVk we may get VK_SUBOPTIMAL_KHR first time we
-            // acquire the image after the swap chain has been recreated.
-            // Recreating it yet again seems to fix the problem.
-            if (res == VK_SUBOPTIMAL_KHR)
+    // For some reason, on MoltenVk we may get VK_SUBOPTIMAL_KHR first time we
+    // acquire the image after the swap chain has been recreated.
+    // Recreating it yet again seems to fix the problem.
+    if (res == VK_SUBOPTIMAL_KHR)
+    {
+        RecreateVulkanSwapchain(pImmediateCtxVk);
+        res = AcquireNextImage(pImmediateCtxVk);
+    }
+#endif
+
+    DEV_CHECK_ERR(res == VK_SUCCESS, "Failed to acquire next swap chain image");
+}
+
+void SwapChainVkImpl::FinishAsyncPresent()
+{
+    if (!m_pAsyncPresentTask)
+        return;
+
+    m_pAsyncPresentTask->WaitForCompletion();
+    m_pAsyncPresentTask.Release();
+
+    auto pDeviceContext = m_wpDeviceContext.Lock();
+    if (!pDeviceContext)
+        return;
+    auto* pImmediateCtxVk = pDeviceContext.RawPtr<DeviceContextVkImpl>();
+
+    if (m_AsyncPresentResult == VK_SUBOPTIMAL_KHR || m_AsyncPresentResult == VK_ERROR_OUT_OF_DATE_KHR)
+    {
+        // Same as in the synchronous path: recreate the swap chain and acquire the image with the first semaphore
+        RecreateVulkanSwapchain(pImmediateCtxVk);
+        m_SemaphoreIndex = 0;
+
+        auto res = AcquireNextImage(pImmediateCtxVk);
+        if (res == VK_SUBOPTIMAL_KHR || res == VK_ERROR_OUT_OF_DATE_KHR)
+            RecreateAndAcquireNextImage(pImmediateCtxVk);
+        else
+            DEV_CHECK_ERR(res == VK_SUCCESS, "Failed to acquire next swap chain image");
+        return;
+    }
+    DEV_CHECK_ERR(m_AsyncPresentResult == VK_SUCCESS, "Present failed");
+
+    if (m_AsyncAcquireResult == VK_SUCCESS)
+    {
+        OnImageAcquired(pImmediateCtxVk);
+    }
+    else if (m_AsyncAcquireResult == VK_SUBOPTIMAL_KHR || m_AsyncAcquireResult == VK_ERROR_OUT_OF_DATE_KHR)
+    {
+        RecreateAndAcquireNextImage(pImmediateCtxVk);
+    }
+    else
+    {
+        DEV_CHECK_ERR(m_AsyncAcquireResult == VK_SUCCESS, "Failed to acquire next swap chain image");
+    }
+}
+
+bool SwapChainVkImpl::IsPresentWaitEnabled() const
+{
+#if DILIGENT_USE_VOLK
+    const auto& EnabledExtFeats = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>()->GetLogicalDevice().GetEnabledExtFeatures();
+    return EnabledExtFeats.PresentId.presentId != VK_FALSE && EnabledExtFeats.PresentWait.presentWait != VK_FALSE;
+#else
+    // vkWaitForPresentKHR is only available through Volk
+    return false;
+#endif
+}
+
+void SwapChainVkImpl::WaitForPresent()
+{
+#if DILIGENT_USE_VOLK
+    if (m_PendingPresents.empty())
+        return;
+
+    const VkDevice vkDevice = m_pRenderDevice.RawPtr<RenderDeviceVkImpl>()->GetVkDevice();
+
+    if (m_SwapChainDesc.LowLatency || m_SwapChainDesc.MaxFrameLatency != 0)
+    {
+        // To keep no more than MaxLatency frames in the queue, the next frame may only
+        // start when the frame presented MaxLatency-1 frames ago has been displayed.
+        //
+        // MaxLatency = 2
+        //
+        //   N-2           N-1            N (Current frame)
+        //    |             |             |
+        //                  |
+        //       Wait for this present id
+        //
+        const Uint64 MaxLatency = GetMaxFrameLatency();
+        if (m_PresentId >= MaxLatency)
+        {
+            const Uint64 WaitPresentId = m_PresentId - (MaxLatency - 1);
+            // Only wait for the frames presented by the current Vulkan swap chain.
+            // Frames that are not in the list any more have already been displayed.
+            if (WaitPresentId >= m_PendingPresents.front().PresentId && WaitPresentId <= m_PendingPresents.back().PresentId)
             {
-                RecreateVulkanSwapchain(pImmediateCtxVk);
-                res = AcquireNextImage(pImmediateCtxVk);
+                constexpr uint64_t Timeout = 500000000; // 0.5 second timeout (shouldn't ever occur)
+
+                auto res = vkWaitForPresentKHR(vkDevice, m_VkSwapChain, WaitPresentId, Timeout);
+                if (res == VK_TIMEOUT)
+                    LOG_WARNING_MESSAGE_ONCE("Timeout elapsed while waiting for the frame to be presented.");
             }
-#endif
         }
-        DEV_CHECK_ERR(res == VK_SUCCESS, "Failed to acquire next swap chain image");
     }
+
+    // Measure the latency of the frames that have been displayed
+    const auto CurrTime = std::chrono::steady_clock::now();
+    while (!m_PendingPresents.empty())
+    {
+        const auto& Frame = m_PendingPresents.front();
+
+        auto res = vkWaitForPresentKHR(vkDevice, m_VkSwapChain, Frame.PresentId, 0);
+        if (res != VK_SUCCESS && res != VK_SUBOPTIMAL_KHR)
+            break;
+
+        AddFrameLatencySample(std::chrono::duration<double>{CurrTime - Frame.StartTime}.count());
+        m_PendingPresents.pop_front();
+    }
+
+    // We don't need to keep more frames than can possibly be queued
+    constexpr size_t MaxPendingPresents = 16;
+    while (m_PendingPresents.size() > MaxPendingPresents)
+        m_PendingPresents.pop_front();
+#endif
+}
+
+void SwapChainVkImpl::SetMaximumFrameLatency(Uint32 MaxLatency)
+{
+    // The latency is used by the present thread
+    FinishAsyncPresent();
+    m_SwapChainDesc.MaxFrameLatency = MaxLatency;
 }
 
 void SwapChainVkImpl::WaitForImageAcquiredFences()
@@ -834,6 +1033,9 @@ void SwapChainVkImpl::ReleaseSwapChainResources(DeviceContextVkImpl* pImmediateC
     m_ImageAcquiredFences.clear();
     m_SemaphoreIndex = 0;
 
+    // Present ids can't be waited for once the Vulkan swap chain is replaced
+    m_PendingPresents.clear();
+
     if (DestroyVkSwapChain)
     {
         vkDestroySwapchainKHR(pDeviceVk->GetVkDevice(), m_VkSwapChain, NULL);
@@ -874,6 +1076,8 @@ void SwapChainVkImpl::RecreateVulkanSwapchain(DeviceContextVkImpl* pImmediateCtx
 
 void SwapChainVkImpl::Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform)
 {
+    FinishAsyncPresent();
+
     bool RecreateSwapChain = false;
 
 #if PLATFORM_ANDROID
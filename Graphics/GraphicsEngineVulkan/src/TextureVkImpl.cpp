@@ -181,7 +181,7 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
 
         const auto QueueFamilyIndices = PlatformMisc::CountOneBits(m_Desc.ImmediateContextMask) > 1 ?
             GetDevice()->ConvertCmdQueueIdsToQueueFamilies(m_Desc.ImmediateContextMask) :
-            std::vector<uint32_t>{};
+            RenderDeviceVkImpl::QueueFamilyIndicesArray{};
         if (QueueFamilyIndices.size() > 1)
         {
             // If sharingMode is VK_SHARING_MODE_CONCURRENT, queueFamilyIndexCount must be greater than 1
@@ -209,11 +209,14 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         {
             m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+            RenderDeviceVkImpl::DedicatedAllocationInfo DedicatedInfo;
+            DedicatedInfo.vkImage = m_VulkanImage;
+
+            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, DedicatedInfo.PrefersDedicatedAllocation);
 
             const auto ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags, 0, &DedicatedInfo);
             if (!m_MemoryAllocation)
                 LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
 
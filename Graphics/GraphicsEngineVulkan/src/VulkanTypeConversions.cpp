@@ -1213,7 +1213,7 @@ static VkPipelineStageFlags ResourceStateFlagToVkPipelineStage(RESOURCE_STATE St
         case RESOURCE_STATE_DEPTH_READ:        return VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
         case RESOURCE_STATE_SHADER_RESOURCE:   return VulkanUtilities::VK_PIPELINE_STAGE_ALL_SHADERS;
         case RESOURCE_STATE_STREAM_OUT:        return 0;
-        case RESOURCE_STATE_INDIRECT_ARGUMENT: return VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+        case RESOURCE_STATE_INDIRECT_ARGUMENT: return VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT; // Conditional rendering stage is masked out if not enabled
         case RESOURCE_STATE_COPY_DEST:         return VK_PIPELINE_STAGE_TRANSFER_BIT;
         case RESOURCE_STATE_COPY_SOURCE:       return VK_PIPELINE_STAGE_TRANSFER_BIT;
         case RESOURCE_STATE_RESOLVE_DEST:      return VK_PIPELINE_STAGE_TRANSFER_BIT;
@@ -1256,7 +1256,6 @@ static VkAccessFlags ResourceStateFlagToVkAccessFlags(RESOURCE_STATE StateFlag)
     //VK_ACCESS_MEMORY_WRITE_BIT
     //VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_READ_BIT_EXT
     //VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT
-    //VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT
     //VK_ACCESS_COMMAND_PROCESS_READ_BIT_NVX
     //VK_ACCESS_COMMAND_PROCESS_WRITE_BIT_NVX
     //VK_ACCESS_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT
@@ -1277,7 +1276,7 @@ static VkAccessFlags ResourceStateFlagToVkAccessFlags(RESOURCE_STATE StateFlag)
         case RESOURCE_STATE_DEPTH_READ:        return VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT;
         case RESOURCE_STATE_SHADER_RESOURCE:   return VK_ACCESS_SHADER_READ_BIT;
         case RESOURCE_STATE_STREAM_OUT:        return VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT;
-        case RESOURCE_STATE_INDIRECT_ARGUMENT: return VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+        case RESOURCE_STATE_INDIRECT_ARGUMENT: return VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT; // Conditional rendering access is masked out if not enabled
         case RESOURCE_STATE_COPY_DEST:         return VK_ACCESS_TRANSFER_WRITE_BIT;
         case RESOURCE_STATE_COPY_SOURCE:       return VK_ACCESS_TRANSFER_READ_BIT;
         case RESOURCE_STATE_RESOLVE_DEST:      return VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -1362,7 +1361,7 @@ static RESOURCE_STATE VkAccessFlagToResourceStates(VkAccessFlagBits AccessFlagBi
         case VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT:          return RESOURCE_STATE_UNKNOWN;
         case VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_READ_BIT_EXT:   return RESOURCE_STATE_UNKNOWN;
         case VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT:  return RESOURCE_STATE_UNKNOWN;
-        case VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT:        return RESOURCE_STATE_UNKNOWN;
+        case VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT:        return RESOURCE_STATE_INDIRECT_ARGUMENT;
         case VK_ACCESS_COMMAND_PREPROCESS_READ_BIT_NV:            return RESOURCE_STATE_UNKNOWN;
         case VK_ACCESS_COMMAND_PREPROCESS_WRITE_BIT_NV:           return RESOURCE_STATE_UNKNOWN;
         case VK_ACCESS_COLOR_ATTACHMENT_READ_NONCOHERENT_BIT_EXT: return RESOURCE_STATE_UNKNOWN;
@@ -2045,6 +2044,20 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
     INIT_FEATURE(NativeMultiDraw,
                  ExtFeatures.MultiDraw.multiDraw != VK_FALSE && ExtFeatures.ShaderDrawParameters.shaderDrawParameters != VK_FALSE);
 
+    INIT_FEATURE(DynamicRenderState,
+                 ExtFeatures.ExtendedDynamicState.extendedDynamicState != VK_FALSE);
+
+#if DILIGENT_USE_VOLK
+    INIT_FEATURE(ConditionalRendering,
+                 ExtFeatures.ConditionalRendering.conditionalRendering != VK_FALSE);
+
+    // Same conditions as dynamic rendering in EngineFactoryVkImpl::CreateDeviceAndContextsVk()
+    INIT_FEATURE(ShaderObjects,
+                 ExtFeatures.ShaderObject.shaderObject != VK_FALSE &&
+                     ExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE &&
+                     vkVersion >= VK_API_VERSION_1_2);
+#endif
+
 #undef INIT_FEATURE
 
     // Not supported in Vulkan on top of Metal.
@@ -2054,7 +2067,7 @@ DeviceFeatures VkFeaturesToDeviceFeatures(uint32_t
     Features.DurationQueries        = DEVICE_FEATURE_STATE_DISABLED;
 #endif
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here (if necessary).");
 
     return Features;
 }
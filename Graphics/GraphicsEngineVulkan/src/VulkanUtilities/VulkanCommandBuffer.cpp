@@ -140,6 +140,53 @@ static VkAccessFlags AccessMaskFromImageLayout(VkImageLayout Layout,
     return AccessMask;
 }
 
+static bool SubresourceRangesOverlap(const VkImageSubresourceRange& Range0, const VkImageSubresourceRange& Range1)
+{
+    const auto StartLayer0 = Range0.baseArrayLayer;
+    const auto EndLayer0   = Range0.layerCount != VK_REMAINING_ARRAY_LAYERS ? (Range0.baseArrayLayer + Range0.layerCount) : ~0u;
+    const auto StartLayer1 = Range1.baseArrayLayer;
+    const auto EndLayer1   = Range1.layerCount != VK_REMAINING_ARRAY_LAYERS ? (Range1.baseArrayLayer + Range1.layerCount) : ~0u;
+
+    const auto StartMip0 = Range0.baseMipLevel;
+    const auto EndMip0   = Range0.levelCount != VK_REMAINING_MIP_LEVELS ? (Range0.baseMipLevel + Range0.levelCount) : ~0u;
+    const auto StartMip1 = Range1.baseMipLevel;
+    const auto EndMip1   = Range1.levelCount != VK_REMAINING_MIP_LEVELS ? (Range1.baseMipLevel + Range1.levelCount) : ~0u;
+
+    const auto SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
+    const auto MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
+
+    return SlicesOverlap && MipsOverlap;
+}
+
+static bool SubresourceRangesEqual(const VkImageSubresourceRange& Range0, const VkImageSubresourceRange& Range1)
+{
+    // clang-format off
+    return Range0.aspectMask     == Range1.aspectMask     &&
+           Range0.baseMipLevel   == Range1.baseMipLevel   &&
+           Range0.levelCount     == Range1.levelCount     &&
+           Range0.baseArrayLayer == Range1.baseArrayLayer &&
+           Range0.layerCount     == Range1.layerCount;
+    // clang-format on
+}
+
+// Returns the synchronization2 access mask for the given image layout.
+// Legacy access flags have the same values in VkAccessFlags2, but some of them
+// can be narrowed down to more precise 64-bit flags.
+static VkAccessFlags2KHR AccessMask2FromImageLayout(VkImageLayout Layout,
+                                                    bool          IsDstMask,
+                                                    VkAccessFlags SupportedAccessMask)
+{
+    VkAccessFlags2KHR AccessMask = AccessMaskFromImageLayout(Layout, IsDstMask) & SupportedAccessMask;
+    if (Layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && (AccessMask & VK_ACCESS_SHADER_READ_BIT) != 0)
+    {
+        // Images in this layout can only be read in shaders as sampled images
+        // or input attachments, so storage reads do not need to be made visible.
+        AccessMask &= ~VkAccessFlags2KHR{VK_ACCESS_2_SHADER_READ_BIT_KHR};
+        AccessMask |= VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR;
+    }
+    return AccessMask;
+}
+
 } // namespace
 
 
@@ -148,6 +195,21 @@ VulkanCommandBuffer::VulkanCommandBuffer() noexcept
     m_ImageBarriers.reserve(32);
 }
 
+void VulkanCommandBuffer::SetUseSynchronization2(bool UseSync2)
+{
+    VERIFY(m_ImageBarriers.empty() && m_ImageBarriers2.empty(), "Synchronization mode must not be changed while there are pending barriers");
+#if !DILIGENT_USE_VOLK
+    if (UseSync2)
+    {
+        UNSUPPORTED("Synchronization2 is not supported when vulkan library is linked statically");
+        UseSync2 = false;
+    }
+#endif
+    m_UseSync2 = UseSync2;
+    if (m_UseSync2)
+        m_ImageBarriers2.reserve(32);
+}
+
 void VulkanCommandBuffer::TransitionImageLayout(VkImage                        Image,
                                                 VkImageLayout                  OldLayout,
                                                 VkImageLayout                  NewLayout,
@@ -155,7 +217,7 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
                                                 VkPipelineStageFlags           SrcStages,
                                                 VkPipelineStageFlags           DstStages)
 {
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (m_State.IsInsideRenderPass())
     {
         // Image layout transitions within a render pass execute
         // dependencies between attachments
@@ -175,6 +237,12 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
         return;
     }
 
+    if (m_UseSync2)
+    {
+        TransitionImageLayout2(Image, OldLayout, NewLayout, SubresRange, SrcStages, DstStages);
+        return;
+    }
+
     // Check overlapping subresources
     for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
     {
@@ -182,24 +250,9 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
         if (ImgBarrier.image != Image)
             continue;
 
-        const auto& OtherRange = ImgBarrier.subresourceRange;
-
-        const auto StartLayer0 = SubresRange.baseArrayLayer;
-        const auto EndLayer0   = SubresRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (SubresRange.baseArrayLayer + SubresRange.layerCount) : ~0u;
-        const auto StartLayer1 = OtherRange.baseArrayLayer;
-        const auto EndLayer1   = OtherRange.layerCount != VK_REMAINING_ARRAY_LAYERS ? (OtherRange.baseArrayLayer + OtherRange.layerCount) : ~0u;
-
-        const auto StartMip0 = SubresRange.baseMipLevel;
-        const auto EndMip0   = SubresRange.levelCount != VK_REMAINING_MIP_LEVELS ? (SubresRange.baseMipLevel + SubresRange.levelCount) : ~0u;
-        const auto StartMip1 = OtherRange.baseMipLevel;
-        const auto EndMip1   = OtherRange.levelCount != VK_REMAINING_MIP_LEVELS ? (OtherRange.baseMipLevel + OtherRange.levelCount) : ~0u;
-
-        const auto SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
-        const auto MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
-
         // If the range overlaps with any of the existing barriers, we need to
         // flush them.
-        if (SlicesOverlap && MipsOverlap)
+        if (SubresourceRangesOverlap(SubresRange, ImgBarrier.subresourceRange))
         {
             FlushBarriers();
             break;
@@ -223,12 +276,92 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
     m_ImageBarriers.emplace_back(ImgBarrier);
 }
 
+void VulkanCommandBuffer::TransitionImageLayout2(VkImage                        Image,
+                                                 VkImageLayout                  OldLayout,
+                                                 VkImageLayout                  NewLayout,
+                                                 const VkImageSubresourceRange& SubresRange,
+                                                 VkPipelineStageFlags           SrcStages,
+                                                 VkPipelineStageFlags           DstStages)
+{
+    VERIFY_EXPR(m_UseSync2);
+    VERIFY_EXPR(OldLayout != NewLayout);
+
+    const VkPipelineStageFlags2KHR SrcStages2 = SrcStages & m_Barrier.SupportedStagesMask;
+    const VkPipelineStageFlags2KHR DstStages2 = DstStages & m_Barrier.SupportedStagesMask;
+    const VkAccessFlags2KHR        SrcAccess2 = AccessMask2FromImageLayout(OldLayout, false, m_Barrier.SupportedAccessMask);
+    const VkAccessFlags2KHR        DstAccess2 = AccessMask2FromImageLayout(NewLayout, true, m_Barrier.SupportedAccessMask);
+
+    for (auto it = m_ImageBarriers2.begin(); it != m_ImageBarriers2.end(); ++it)
+    {
+        auto& ImgBarrier = *it;
+        if (ImgBarrier.image != Image)
+            continue;
+
+        if (SubresourceRangesEqual(ImgBarrier.subresourceRange, SubresRange))
+        {
+            if (ImgBarrier.oldLayout == OldLayout && ImgBarrier.newLayout == NewLayout)
+            {
+                // The same transition is already in the batch - merge the masks.
+                ImgBarrier.srcStageMask |= SrcStages2;
+                ImgBarrier.dstStageMask |= DstStages2;
+                return;
+            }
+
+            if (ImgBarrier.newLayout == OldLayout)
+            {
+                // The subresource is transitioned again before any command uses it in the
+                // intermediate layout (every command flushes pending barriers), so
+                // A -> B -> C can be recorded as a single A -> C transition.
+                if (ImgBarrier.oldLayout == NewLayout)
+                {
+                    // A -> B -> A does not change the layout: only keep the memory dependency.
+                    m_Barrier.MemorySrcStages |= static_cast<VkPipelineStageFlags>(ImgBarrier.srcStageMask);
+                    m_Barrier.MemoryDstStages |= DstStages;
+                    m_Barrier.MemorySrcAccess |= AccessMaskFromImageLayout(ImgBarrier.oldLayout, false);
+                    m_Barrier.MemoryDstAccess |= AccessMaskFromImageLayout(NewLayout, true);
+                    m_ImageBarriers2.erase(it);
+                }
+                else
+                {
+                    ImgBarrier.newLayout     = NewLayout;
+                    ImgBarrier.dstStageMask  = DstStages2;
+                    ImgBarrier.dstAccessMask = DstAccess2;
+                }
+                return;
+            }
+        }
+
+        // If the range overlaps with any of the existing barriers, we need to
+        // flush them.
+        if (SubresourceRangesOverlap(SubresRange, ImgBarrier.subresourceRange))
+        {
+            FlushBarriers2();
+            break;
+        }
+    }
+
+    VkImageMemoryBarrier2KHR ImgBarrier{};
+    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+    ImgBarrier.pNext               = nullptr;
+    ImgBarrier.srcStageMask        = SrcStages2;
+    ImgBarrier.srcAccessMask       = SrcAccess2;
+    ImgBarrier.dstStageMask        = DstStages2;
+    ImgBarrier.dstAccessMask       = DstAccess2;
+    ImgBarrier.oldLayout           = OldLayout;
+    ImgBarrier.newLayout           = NewLayout;
+    ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.image               = Image;
+    ImgBarrier.subresourceRange    = SubresRange;
+    m_ImageBarriers2.emplace_back(ImgBarrier);
+}
+
 void VulkanCommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
                                         VkAccessFlags        dstAccessMask,
                                         VkPipelineStageFlags SrcStages,
                                         VkPipelineStageFlags DstStages)
 {
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (m_State.IsInsideRenderPass())
     {
         EndRenderPass();
     }
@@ -243,12 +376,105 @@ void VulkanCommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     m_Barrier.MemoryDstAccess |= dstAccessMask;
 }
 
+void VulkanCommandBuffer::SetEvent(VkEvent Event, VkPipelineStageFlags StageMask)
+{
+    if (m_State.IsInsideRenderPass())
+    {
+        EndRenderPass();
+    }
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY_EXPR((StageMask & m_Barrier.SupportedStagesMask) != 0);
+
+    // Pending barriers must be executed before the event is signaled
+    FlushBarriers();
+    vkCmdSetEvent(m_VkCmdBuffer, Event, StageMask & m_Barrier.SupportedStagesMask);
+}
+
+void VulkanCommandBuffer::WaitEvent(VkEvent                     Event,
+                                    VkPipelineStageFlags        SrcStages,
+                                    VkPipelineStageFlags        DstStages,
+                                    const VkMemoryBarrier*      pMemBarrier,
+                                    const VkImageMemoryBarrier* pImgBarrier)
+{
+    if (m_State.IsInsideRenderPass())
+    {
+        EndRenderPass();
+    }
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+    VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
+    VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
+
+    // Barriers recorded before the split barrier ends must be executed first
+    FlushBarriers();
+
+    // Note that srcStageMask must be the same stage mask that was used to set the event
+    vkCmdWaitEvents(m_VkCmdBuffer,
+                    1, &Event,
+                    SrcStages & m_Barrier.SupportedStagesMask,
+                    DstStages & m_Barrier.SupportedStagesMask,
+                    pMemBarrier != nullptr ? 1 : 0, pMemBarrier,
+                    0, nullptr,
+                    pImgBarrier != nullptr ? 1 : 0, pImgBarrier);
+    if (m_pBarrierCounter != nullptr)
+        ++*m_pBarrierCounter;
+}
+
+void VulkanCommandBuffer::WaitEventMemoryBarrier(VkEvent              Event,
+                                                 VkAccessFlags        srcAccessMask,
+                                                 VkAccessFlags        dstAccessMask,
+                                                 VkPipelineStageFlags SrcStages,
+                                                 VkPipelineStageFlags DstStages)
+{
+    VkMemoryBarrier vkMemBarrier{};
+    vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    vkMemBarrier.pNext         = nullptr;
+    vkMemBarrier.srcAccessMask = srcAccessMask & m_Barrier.SupportedAccessMask;
+    vkMemBarrier.dstAccessMask = dstAccessMask & m_Barrier.SupportedAccessMask;
+
+    const bool HasMemoryBarrier = vkMemBarrier.srcAccessMask != 0 && vkMemBarrier.dstAccessMask != 0;
+    WaitEvent(Event, SrcStages, DstStages, HasMemoryBarrier ? &vkMemBarrier : nullptr, nullptr);
+}
+
+void VulkanCommandBuffer::WaitEventImageLayout(VkEvent                        Event,
+                                               VkImage                        Image,
+                                               VkImageLayout                  OldLayout,
+                                               VkImageLayout                  NewLayout,
+                                               const VkImageSubresourceRange& SubresRange,
+                                               VkPipelineStageFlags           SrcStages,
+                                               VkPipelineStageFlags           DstStages)
+{
+    if (OldLayout == NewLayout)
+    {
+        WaitEventMemoryBarrier(Event, AccessMaskFromImageLayout(OldLayout, false), AccessMaskFromImageLayout(NewLayout, true), SrcStages, DstStages);
+        return;
+    }
+
+    VkImageMemoryBarrier ImgBarrier{};
+    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    ImgBarrier.pNext               = nullptr;
+    ImgBarrier.oldLayout           = OldLayout;
+    ImgBarrier.newLayout           = NewLayout;
+    ImgBarrier.image               = Image;
+    ImgBarrier.subresourceRange    = SubresRange;
+    ImgBarrier.srcAccessMask       = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.dstAccessMask       = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+    ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    WaitEvent(Event, SrcStages, DstStages, nullptr, &ImgBarrier);
+}
+
 void VulkanCommandBuffer::FlushBarriers()
 {
+    if (m_UseSync2)
+    {
+        FlushBarriers2();
+        return;
+    }
+
     if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers.empty())
         return;
 
-    if (m_State.RenderPass != VK_NULL_HANDLE)
+    if (m_State.IsInsideRenderPass())
     {
         EndRenderPass();
     }
@@ -279,6 +505,8 @@ void VulkanCommandBuffer::FlushBarriers()
                          nullptr,
                          static_cast<uint32_t>(m_ImageBarriers.size()),
                          m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
+    if (m_pBarrierCounter != nullptr)
+        ++*m_pBarrierCounter;
 
     m_ImageBarriers.clear();
     m_Barrier.ImageSrcStages  = 0;
@@ -290,4 +518,58 @@ void VulkanCommandBuffer::FlushBarriers()
     // Do not clear SupportedStagesMask and SupportedAccessMask
 }
 
+void VulkanCommandBuffer::FlushBarriers2()
+{
+    if (m_Barrier.MemorySrcStages == 0 && m_Barrier.MemoryDstStages == 0 && m_ImageBarriers2.empty())
+        return;
+
+    if (m_State.IsInsideRenderPass())
+    {
+        EndRenderPass();
+    }
+
+    VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+    // Unlike vkCmdPipelineBarrier, synchronization2 has no global stage masks: execution
+    // dependencies are only defined by the barriers, so the memory barrier must be recorded
+    // even if it has no access masks.
+    VkMemoryBarrier2KHR vkMemBarrier{};
+    vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+    vkMemBarrier.pNext         = nullptr;
+    vkMemBarrier.srcStageMask  = m_Barrier.MemorySrcStages & m_Barrier.SupportedStagesMask;
+    vkMemBarrier.srcAccessMask = m_Barrier.MemorySrcAccess & m_Barrier.SupportedAccessMask;
+    vkMemBarrier.dstStageMask  = m_Barrier.MemoryDstStages & m_Barrier.SupportedStagesMask;
+    vkMemBarrier.dstAccessMask = m_Barrier.MemoryDstAccess & m_Barrier.SupportedAccessMask;
+
+    const bool HasMemoryBarrier = vkMemBarrier.srcStageMask != 0 || vkMemBarrier.dstStageMask != 0;
+
+    VkDependencyInfoKHR DependencyInfo{};
+    DependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+    DependencyInfo.pNext                    = nullptr;
+    DependencyInfo.dependencyFlags          = 0;
+    DependencyInfo.memoryBarrierCount       = HasMemoryBarrier ? 1 : 0;
+    DependencyInfo.pMemoryBarriers          = HasMemoryBarrier ? &vkMemBarrier : nullptr;
+    DependencyInfo.bufferMemoryBarrierCount = 0;
+    DependencyInfo.pBufferMemoryBarriers    = nullptr;
+    DependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(m_ImageBarriers2.size());
+    DependencyInfo.pImageMemoryBarriers     = m_ImageBarriers2.empty() ? nullptr : m_ImageBarriers2.data();
+
+    if (HasMemoryBarrier || !m_ImageBarriers2.empty())
+    {
+#if DILIGENT_USE_VOLK
+        vkCmdPipelineBarrier2KHR(m_VkCmdBuffer, &DependencyInfo);
+#else
+        UNSUPPORTED("Synchronization2 is not supported when vulkan library is linked statically");
+#endif
+        if (m_pBarrierCounter != nullptr)
+            ++*m_pBarrierCounter;
+    }
+
+    m_ImageBarriers2.clear();
+    m_Barrier.MemorySrcStages = 0;
+    m_Barrier.MemoryDstStages = 0;
+    m_Barrier.MemorySrcAccess = 0;
+    m_Barrier.MemoryDstAccess = 0;
+}
+
 } // namespace VulkanUtilities
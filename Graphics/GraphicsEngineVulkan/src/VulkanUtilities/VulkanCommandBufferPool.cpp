@@ -59,30 +59,43 @@ VulkanCommandBufferPool::~VulkanCommandBufferPool()
                   "buffers in release queues, VulkanCommandBufferPool::RecycleCommandBuffer() will crash when attempting to "
                   "return the buffer to the pool.");
 
-    for (auto CmdBuff : m_CmdBuffers)
-        m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
+    for (size_t Level = 0; Level < CMD_BUFFER_LEVEL_COUNT; ++Level)
+    {
+        for (auto CmdBuff : m_ReadyCmdBuffers[Level])
+            m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
+        for (auto CmdBuff : m_RecycledCmdBuffers[Level])
+            m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
+    }
     m_CmdPool.Release();
 }
 
-VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
+VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char*                           DebugName,
+                                                          const VkCommandBufferInheritanceInfo* pInheritanceInfo,
+                                                          VkCommandBufferUsageFlags             UsageFlags)
 {
-    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
+    const CMD_BUFFER_LEVEL Level = pInheritanceInfo != nullptr ? CMD_BUFFER_LEVEL_SECONDARY : CMD_BUFFER_LEVEL_PRIMARY;
 
+    auto& ReadyCmdBuffers = m_ReadyCmdBuffers[Level];
+    if (ReadyCmdBuffers.empty() && m_NumRecycledCmdBuffers[Level].load(std::memory_order_relaxed) != 0)
     {
-        std::lock_guard<std::mutex> Lock{m_Mutex};
-
-        if (!m_CmdBuffers.empty())
-        {
-            CmdBuffer = m_CmdBuffers.front();
-            auto err  = vkResetCommandBuffer(
-                CmdBuffer,
-                0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
-                  // owned by the command buffer should be returned to the parent command pool.
-            );
-            DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
-            (void)err;
-            m_CmdBuffers.pop_front();
-        }
+        // Take all recycled command buffers at once
+        std::lock_guard<std::mutex> Lock{m_RecycledCmdBuffersMtx};
+        ReadyCmdBuffers.swap(m_RecycledCmdBuffers[Level]);
+        m_NumRecycledCmdBuffers[Level].store(0, std::memory_order_relaxed);
+    }
+
+    VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
+    if (!ReadyCmdBuffers.empty())
+    {
+        CmdBuffer = ReadyCmdBuffers.front();
+        auto err  = vkResetCommandBuffer(
+            CmdBuffer,
+            0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
+              // owned by the command buffer should be returned to the parent command pool.
+        );
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
+        (void)err;
+        ReadyCmdBuffers.pop_front();
     }
 
     // If no cmd buffers were ready to be reused, create a new one
@@ -93,10 +106,10 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
         BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         BuffAllocInfo.pNext              = nullptr;
         BuffAllocInfo.commandPool        = m_CmdPool;
-        BuffAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        BuffAllocInfo.level              = Level == CMD_BUFFER_LEVEL_SECONDARY ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         BuffAllocInfo.commandBufferCount = 1;
 
-        CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
+        CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo, DebugName);
         DEV_CHECK_ERR(CmdBuffer != VK_NULL_HANDLE, "Failed to allocate vulkan command buffer");
     }
 
@@ -104,10 +117,15 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
 
     CmdBuffBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     CmdBuffBeginInfo.pNext = nullptr;
-    CmdBuffBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; // Each recording of the command buffer will only be
-                                                                          // submitted once, and the command buffer will be reset
-                                                                          // and recorded again between each submission.
-    CmdBuffBeginInfo.pInheritanceInfo = nullptr;                          // Ignored for a primary command buffer
+    // VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT (default) indicates that each recording of the command buffer will
+    // only be submitted once, and the command buffer will be reset and recorded again between each submission.
+    CmdBuffBeginInfo.flags = UsageFlags;
+    if (pInheritanceInfo != nullptr)
+    {
+        // The secondary command buffer is entirely inside a render pass
+        CmdBuffBeginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
+    CmdBuffBeginInfo.pInheritanceInfo = pInheritanceInfo; // Ignored for a primary command buffer
 
     auto err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
@@ -118,10 +136,14 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
     return CmdBuffer;
 }
 
-void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
+void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, bool IsSecondary)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
+    const CMD_BUFFER_LEVEL Level = IsSecondary ? CMD_BUFFER_LEVEL_SECONDARY : CMD_BUFFER_LEVEL_PRIMARY;
+    {
+        std::lock_guard<std::mutex> Lock{m_RecycledCmdBuffersMtx};
+        m_RecycledCmdBuffers[Level].emplace_back(CmdBuffer);
+        m_NumRecycledCmdBuffers[Level].fetch_add(1, std::memory_order_relaxed);
+    }
     CmdBuffer = VK_NULL_HANDLE;
 #ifdef DILIGENT_DEVELOPMENT
     --m_BuffCounter;
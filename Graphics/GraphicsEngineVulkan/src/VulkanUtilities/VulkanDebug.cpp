@@ -471,6 +471,16 @@ void SetPipelineCacheName(VkDevice device, VkPipelineCache pipeCache, const char
     SetObjectName(device, (uint64_t)pipeCache, VK_OBJECT_TYPE_PIPELINE_CACHE, name);
 }
 
+void SetDescriptorUpdateTemplateName(VkDevice device, VkDescriptorUpdateTemplate updateTemplate, const char* name)
+{
+    SetObjectName(device, (uint64_t)updateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE, name);
+}
+
+void SetShaderObjectName(VkDevice device, VkShaderEXT shader, const char* name)
+{
+    SetObjectName(device, (uint64_t)shader, VK_OBJECT_TYPE_SHADER_EXT, name);
+}
+
 
 template <>
 void SetVulkanObjectName<VkCommandPool, VulkanHandleTypeId::CommandPool>(VkDevice device, VkCommandPool cmdPool, const char* name)
@@ -610,6 +620,18 @@ void SetVulkanObjectName<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(VkD
     SetPipelineCacheName(device, pipeCache, name);
 }
 
+template <>
+void SetVulkanObjectName<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(VkDevice device, VkDescriptorUpdateTemplate updateTemplate, const char* name)
+{
+    SetDescriptorUpdateTemplateName(device, updateTemplate, name);
+}
+
+template <>
+void SetVulkanObjectName<VkShaderEXT, VulkanHandleTypeId::ShaderEXT>(VkDevice device, VkShaderEXT shader, const char* name)
+{
+    SetShaderObjectName(device, shader, name);
+}
+
 
 const char* VkResultToString(VkResult errorCode)
 {
@@ -777,6 +799,7 @@ const char* VkObjectTypeToString(VkObjectType ObjectType)
         case VK_OBJECT_TYPE_DEFERRED_OPERATION_KHR:         return "deferred operation KHR";
         case VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV:    return "indirect commands layout NV";
         case VK_OBJECT_TYPE_PRIVATE_DATA_SLOT_EXT:          return "private data slot EXT";
+        case VK_OBJECT_TYPE_SHADER_EXT:                     return "shader EXT";
         default: return "unknown";
             // clang-format on
     }
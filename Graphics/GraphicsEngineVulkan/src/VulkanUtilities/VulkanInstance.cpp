@@ -46,6 +46,7 @@
 #endif
 
 #include "PlatformDefinitions.h"
+#include "CPUProfiler.hpp"
 
 namespace VulkanUtilities
 {
@@ -173,6 +174,8 @@ std::shared_ptr<VulkanInstance> VulkanInstance::Create(const CreateInfo& CI)
 VulkanInstance::VulkanInstance(const CreateInfo& CI) :
     m_pVkAllocator{CI.pVkAllocator}
 {
+    DILIGENT_PROFILE_FUNCTION();
+
 #if DILIGENT_USE_VOLK
     if (volkInitialize() != VK_SUCCESS)
     {
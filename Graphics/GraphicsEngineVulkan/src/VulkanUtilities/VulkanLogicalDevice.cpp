@@ -30,6 +30,7 @@
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 #include "VulkanUtilities/VulkanDebug.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "CPUProfiler.hpp"
 
 namespace VulkanUtilities
 {
@@ -56,6 +57,8 @@ VulkanLogicalDevice::VulkanLogicalDevice(const VulkanPhysicalDevice&  PhysicalDe
     m_EnabledFeatures{*DeviceCI.pEnabledFeatures},
     m_EnabledExtFeatures{EnabledExtFeatures}
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     auto res = vkCreateDevice(PhysicalDevice.GetVkDeviceHandle(), &DeviceCI, vkAllocator, &m_VkDevice);
     CHECK_VK_ERROR_AND_THROW(res, "Failed to create logical device");
 
@@ -117,6 +120,12 @@ VulkanLogicalDevice::VulkanLogicalDevice(const VulkanPhysicalDevice&  PhysicalDe
         GraphicsStages |= VK_PIPELINE_STAGE_FRAGMENT_DENSITY_PROCESS_BIT_EXT;
         GraphicsAccessMask |= VK_ACCESS_FRAGMENT_DENSITY_MAP_READ_BIT_EXT;
     }
+    if (m_EnabledExtFeatures.ConditionalRendering.conditionalRendering != VK_FALSE)
+    {
+        // Conditional rendering applies to both draw and dispatch commands
+        ComputeStages |= VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT;
+        ComputeAccessMask |= VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT;
+    }
 
     const auto QueueCount = PhysicalDevice.GetQueueProperties().size();
     m_SupportedStagesMask.resize(QueueCount, 0);
@@ -385,6 +394,12 @@ SemaphoreWrapper VulkanLogicalDevice::CreateTimelineSemaphore(uint64_t InitialVa
     return CreateVulkanObject<VkSemaphore, VulkanHandleTypeId::Semaphore>(vkCreateSemaphore, SemaphoreCI, DebugName, "timeline semaphore");
 }
 
+EventWrapper VulkanLogicalDevice::CreateEvent(const VkEventCreateInfo& EventCI, const char* DebugName) const
+{
+    VERIFY_EXPR(EventCI.sType == VK_STRUCTURE_TYPE_EVENT_CREATE_INFO);
+    return CreateVulkanObject<VkEvent, VulkanHandleTypeId::Event>(vkCreateEvent, EventCI, DebugName, "event");
+}
+
 QueryPoolWrapper VulkanLogicalDevice::CreateQueryPool(const VkQueryPoolCreateInfo& QueryPoolCI, const char* DebugName) const
 {
     VERIFY_EXPR(QueryPoolCI.sType == VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO);
@@ -447,6 +462,40 @@ PipelineCacheWrapper VulkanLogicalDevice::CreatePipelineCache(const VkPipelineCa
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+VkResult VulkanLogicalDevice::MergePipelineCaches(VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) const
+{
+    return vkMergePipelineCaches(m_VkDevice, dstCache, srcCacheCount, pSrcCaches);
+}
+
+const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName) const
+{
+    VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, CI, DebugName, "descriptor update template");
+}
+
+ShaderObjectWrapper VulkanLogicalDevice::CreateShaderObject(const VkShaderCreateInfoEXT& ShaderCI, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(ShaderCI.sType == VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT);
+
+    if (DebugName == nullptr)
+        DebugName = "";
+
+    VkShaderEXT vkShader = VK_NULL_HANDLE;
+
+    auto err = vkCreateShadersEXT(m_VkDevice, 1, &ShaderCI, m_VkAllocator, &vkShader);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to create shader object '", DebugName, '\'');
+
+    if (*DebugName != 0)
+        SetVulkanObjectName<VkShaderEXT, VulkanHandleTypeId::ShaderEXT>(m_VkDevice, vkShader, DebugName);
+
+    return ShaderObjectWrapper{GetSharedPtr(), std::move(vkShader)};
+#else
+    UNSUPPORTED("vkCreateShadersEXT is only available through Volk");
+    return ShaderObjectWrapper{};
+#endif
+}
+
 void VulkanLogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -543,6 +592,12 @@ void VulkanLogicalDevice::ReleaseVulkanObject(SemaphoreWrapper&& Semaphore) cons
     Semaphore.m_VkObject = VK_NULL_HANDLE;
 }
 
+void VulkanLogicalDevice::ReleaseVulkanObject(EventWrapper&& Event) const
+{
+    vkDestroyEvent(m_VkDevice, Event.m_VkObject, m_VkAllocator);
+    Event.m_VkObject = VK_NULL_HANDLE;
+}
+
 void VulkanLogicalDevice::ReleaseVulkanObject(QueryPoolWrapper&& QueryPool) const
 {
     vkDestroyQueryPool(m_VkDevice, QueryPool.m_VkObject, m_VkAllocator);
@@ -565,6 +620,22 @@ void VulkanLogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache)
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void VulkanLogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& UpdateTemplate) const
+{
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, UpdateTemplate.m_VkObject, m_VkAllocator);
+    UpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+}
+
+void VulkanLogicalDevice::ReleaseVulkanObject(ShaderObjectWrapper&& ShaderObject) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyShaderEXT(m_VkDevice, ShaderObject.m_VkObject, m_VkAllocator);
+    ShaderObject.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyShaderEXT is only available through Volk");
+#endif
+}
+
 void VulkanLogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -593,6 +664,58 @@ VkMemoryRequirements VulkanLogicalDevice::GetImageMemoryRequirements(VkImage vkI
     return MemReqs;
 }
 
+VkMemoryRequirements VulkanLogicalDevice::GetBufferMemoryRequirements(VkBuffer vkBuffer, bool& PrefersDedicatedAllocation) const
+{
+#if DILIGENT_USE_VOLK
+    if (m_EnabledExtFeatures.DedicatedAllocation)
+    {
+        VkBufferMemoryRequirementsInfo2 MemReqsInfo{};
+        MemReqsInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
+        MemReqsInfo.buffer = vkBuffer;
+
+        VkMemoryDedicatedRequirements DedicatedReqs{};
+        DedicatedReqs.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 MemReqs2{};
+        MemReqs2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        MemReqs2.pNext = &DedicatedReqs;
+        vkGetBufferMemoryRequirements2KHR(m_VkDevice, &MemReqsInfo, &MemReqs2);
+
+        PrefersDedicatedAllocation = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
+        return MemReqs2.memoryRequirements;
+    }
+#endif
+
+    PrefersDedicatedAllocation = false;
+    return GetBufferMemoryRequirements(vkBuffer);
+}
+
+VkMemoryRequirements VulkanLogicalDevice::GetImageMemoryRequirements(VkImage vkImage, bool& PrefersDedicatedAllocation) const
+{
+#if DILIGENT_USE_VOLK
+    if (m_EnabledExtFeatures.DedicatedAllocation)
+    {
+        VkImageMemoryRequirementsInfo2 MemReqsInfo{};
+        MemReqsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+        MemReqsInfo.image = vkImage;
+
+        VkMemoryDedicatedRequirements DedicatedReqs{};
+        DedicatedReqs.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+
+        VkMemoryRequirements2 MemReqs2{};
+        MemReqs2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+        MemReqs2.pNext = &DedicatedReqs;
+        vkGetImageMemoryRequirements2KHR(m_VkDevice, &MemReqsInfo, &MemReqs2);
+
+        PrefersDedicatedAllocation = DedicatedReqs.prefersDedicatedAllocation != VK_FALSE || DedicatedReqs.requiresDedicatedAllocation != VK_FALSE;
+        return MemReqs2.memoryRequirements;
+    }
+#endif
+
+    PrefersDedicatedAllocation = false;
+    return GetImageMemoryRequirements(vkImage);
+}
+
 VkResult VulkanLogicalDevice::BindBufferMemory(VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
 {
     return vkBindBufferMemory(m_VkDevice, buffer, memory, memoryOffset);
@@ -618,6 +741,21 @@ VkDeviceAddress VulkanLogicalDevice::GetAccelerationStructureDeviceAddress(VkAcc
 #endif
 }
 
+VkDeviceAddress VulkanLogicalDevice::GetBufferDeviceAddress(VkBuffer vkBuffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR Info = {};
+
+    Info.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    Info.buffer = vkBuffer;
+
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &Info);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return VkDeviceAddress{};
+#endif
+}
+
 void VulkanLogicalDevice::GetAccelerationStructureBuildSizes(const VkAccelerationStructureBuildGeometryInfoKHR& BuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR& SizeInfo) const
 {
 #if DILIGENT_USE_VOLK
@@ -707,6 +845,46 @@ void VulkanLogicalDevice::UpdateDescriptorSets(uint32_t                    descr
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void VulkanLogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                          VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                          const void*                pData) const
+{
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout vkLayout) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, vkLayout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize VulkanLogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout vkLayout, uint32_t Binding) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, vkLayout, Binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void VulkanLogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t DataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    vkGetDescriptorEXT(m_VkDevice, &DescriptorInfo, DataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
 VkResult VulkanLogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                                VkCommandPoolResetFlags flags) const
 {
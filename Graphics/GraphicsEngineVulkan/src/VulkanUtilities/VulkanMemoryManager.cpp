@@ -40,37 +40,57 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
     }
 }
 
-VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                                   VkDeviceSize          PageSize,
-                                   uint32_t              MemoryTypeIndex,
-                                   bool                  IsHostVisible,
-                                   VkMemoryAllocateFlags AllocateFlags) :
+VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                                   VkDeviceSize                         PageSize,
+                                   uint32_t                             MemoryTypeIndex,
+                                   bool                                 IsHostVisible,
+                                   VkMemoryAllocateFlags                AllocateFlags,
+                                   bool                                 IsDedicated,
+                                   const VkMemoryDedicatedAllocateInfo* pDedicatedInfo) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_MemoryTypeIndex{MemoryTypeIndex},
+    m_IsDedicated    {IsDedicated}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "PageSize (", PageSize, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
 
-    VkMemoryAllocateInfo      MemAlloc    = {};
-    VkMemoryAllocateFlagsInfo MemFlagInfo = {};
+    VkMemoryAllocateInfo          MemAlloc      = {};
+    VkMemoryAllocateFlagsInfo     MemFlagInfo   = {};
+    VkMemoryDedicatedAllocateInfo DedicatedInfo = {};
 
     MemAlloc.pNext           = nullptr;
     MemAlloc.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize  = PageSize;
     MemAlloc.memoryTypeIndex = MemoryTypeIndex;
 
+    const void** NextExt = &MemAlloc.pNext;
     if (AllocateFlags)
     {
-        MemAlloc.pNext    = &MemFlagInfo;
         MemFlagInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
         MemFlagInfo.pNext = nullptr;
         MemFlagInfo.flags = AllocateFlags;
+
+        *NextExt = &MemFlagInfo;
+        NextExt  = &MemFlagInfo.pNext;
+    }
+
+    if (pDedicatedInfo != nullptr)
+    {
+        VERIFY(IsDedicated, "Dedicated allocation info must only be used for dedicated pages");
+        VERIFY_EXPR(pDedicatedInfo->sType == VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO);
+        DedicatedInfo       = *pDedicatedInfo;
+        DedicatedInfo.pNext = nullptr;
+
+        *NextExt = &DedicatedInfo;
+        NextExt  = &DedicatedInfo.pNext;
     }
 
-    auto MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    auto MemoryName = Diligent::FormatString(IsDedicated ? "Dedicated device memory. Size: " : "Device memory page. Size: ",
+                                             Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory      = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -118,15 +138,16 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
 
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
-    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
     std::lock_guard<std::mutex> Lock{m_Mutex};
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    // Notify the manager after the memory is returned to the page so that ShrinkMemory() sees empty dedicated page
+    m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr, m_IsDedicated);
     Allocation = VulkanMemoryAllocation{};
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo* pDedicated)
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
     // Bit i is set if the memory type i in the VkPhysicalDeviceMemoryProperties structure for the
@@ -155,11 +176,17 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements&
     }
 
     bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
-    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
+    return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags, pDedicated);
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo* pDedicated)
 {
+    if (pDedicated != nullptr &&
+        (pDedicated->PrefersDedicatedAllocation || (m_DedicatedAllocationThreshold != 0 && Size >= m_DedicatedAllocationThreshold)))
+    {
+        return AllocateDedicated(Size, MemoryTypeIndex, HostVisible, AllocateFlags, *pDedicated);
+    }
+
     VulkanMemoryAllocation Allocation;
 
     // On integrated GPUs, there is no difference between host-visible and GPU-only
@@ -169,65 +196,203 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    MemoryPageIndex PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    // The callback must be called after the lock is released as it may allocate or release memory
+    BudgetCallbackType BudgetCallback;
+    uint32_t           BudgetHeapIndex = 0;
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
+        std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+        auto range = m_Pages.equal_range(PageIdx);
+        for (auto page_it = range.first; page_it != range.second; ++page_it)
+        {
+            Allocation = page_it->second.Allocate(Size, Alignment);
+            if (Allocation.Page != nullptr)
+                break;
+        }
+
+        size_t stat_ind = HostVisible ? 1 : 0;
+        if (Allocation.Page == nullptr)
+        {
+            auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+            while (PageSize < Size)
+                PageSize *= 2;
+
+            const auto HeapIndex = GetHeapIndex(MemoryTypeIndex);
+
+            // If the full page does not fit into the budget, only allocate the memory required by this allocation
+            if (CheckHeapBudget(HeapIndex, Diligent::AlignUp(Size, Alignment) + Alignment, PageSize) && m_BudgetCallback)
+            {
+                BudgetCallback  = m_BudgetCallback;
+                BudgetHeapIndex = HeapIndex;
+            }
+
+            m_CurrAllocatedSize[stat_ind] += PageSize;
+            m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+            m_HeapAllocatedSize[HeapIndex] += PageSize;
+
+            auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
+            LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
+                             " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
+                             "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+            OnNewPageCreated(it->second);
+            Allocation = it->second.Allocate(Size, Alignment);
+            DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+        }
+
         if (Allocation.Page != nullptr)
-            break;
+        {
+            VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+        }
+
+        m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
+        m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
     }
 
-    size_t stat_ind = HostVisible ? 1 : 0;
-    if (Allocation.Page == nullptr)
-    {
-        auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
+    if (BudgetCallback)
+        BudgetCallback(BudgetHeapIndex);
 
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+    return Allocation;
+}
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+VulkanMemoryAllocation VulkanMemoryManager::AllocateDedicated(VkDeviceSize Size, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags, const DedicatedAllocationInfo& Dedicated)
+{
+    VERIFY((Dedicated.vkImage != VK_NULL_HANDLE) != (Dedicated.vkBuffer != VK_NULL_HANDLE), "Exactly one of image or buffer must be specified");
+
+    // Without VK_KHR_dedicated_allocation, the resource still gets its own device memory object,
+    // but the driver is not informed about it.
+    VkMemoryDedicatedAllocateInfo DedicatedInfo{};
+    const bool                    UseDedicatedInfo = m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation;
+    if (UseDedicatedInfo)
+    {
+        DedicatedInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        DedicatedInfo.image  = Dedicated.vkImage;
+        DedicatedInfo.buffer = Dedicated.vkBuffer;
     }
 
-    if (Allocation.Page != nullptr)
+    VulkanMemoryAllocation Allocation;
+
+    BudgetCallbackType BudgetCallback;
+    const auto         HeapIndex = GetHeapIndex(MemoryTypeIndex);
     {
-        VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
+        std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+        // Dedicated allocation size must match the size of the resource, so it can't be reduced
+        auto PageSize = Size;
+        if (CheckHeapBudget(HeapIndex, Size, PageSize) && m_BudgetCallback)
+            BudgetCallback = m_BudgetCallback;
+        VERIFY_EXPR(PageSize == Size);
+
+        m_DedicatedPages.emplace_back(*this, Size, MemoryTypeIndex, HostVisible, AllocateFlags, true, UseDedicatedInfo ? &DedicatedInfo : nullptr);
+        auto& Page = m_DedicatedPages.back();
+
+        size_t stat_ind = HostVisible ? 1 : 0;
+        m_CurrAllocatedSize[stat_ind] += Size;
+        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+        m_HeapAllocatedSize[HeapIndex] += Size;
+
+        OnNewPageCreated(Page);
+
+        // The page is exactly as large as the resource and the allocation is at zero offset,
+        // which satisfies any alignment.
+        Allocation = Page.Allocate(Size, 1);
+        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate memory from a dedicated page");
+        VERIFY_EXPR(Allocation.UnalignedOffset == 0);
+
+        m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
+        m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
     }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+    if (BudgetCallback)
+        BudgetCallback(HeapIndex);
 
     return Allocation;
 }
 
+bool VulkanMemoryManager::CheckHeapBudget(uint32_t HeapIndex, VkDeviceSize MinPageSize, VkDeviceSize& PageSize)
+{
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget;
+    if (!m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget || !m_PhysicalDevice.GetMemoryBudget(Budget))
+        return false;
+
+    const auto HeapBudget = Budget.heapBudget[HeapIndex];
+    const auto HeapUsage  = Budget.heapUsage[HeapIndex];
+
+    // Oversubscribing the heap makes the driver page resources, which causes stalls.
+    if (HeapUsage + PageSize > HeapBudget && MinPageSize < PageSize)
+    {
+        LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': heap ", HeapIndex, " usage (", Diligent::FormatMemorySize(HeapUsage, 2),
+                         ") is close to the budget (", Diligent::FormatMemorySize(HeapBudget, 2), "). Reducing page size to ",
+                         Diligent::FormatMemorySize(MinPageSize, 2));
+        PageSize = MinPageSize;
+    }
+
+    return static_cast<double>(HeapUsage + PageSize) > static_cast<double>(HeapBudget) * m_BudgetThreshold;
+}
+
 void VulkanMemoryManager::ShrinkMemory()
 {
     std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+
+    if (m_NumReleasedDedicatedPages.load() > 0)
+    {
+        // Dedicated pages are never reused, so they are released regardless of the reserve size
+        auto it = m_DedicatedPages.begin();
+        while (it != m_DedicatedPages.end())
+        {
+            auto curr_it = it;
+            ++it;
+            auto& Page = *curr_it;
+            if (!Page.IsEmpty())
+                continue;
+
+            const bool IsHostVisible = Page.GetCPUMemory() != nullptr;
+            const auto PageSize      = Page.GetPageSize();
+            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
+            m_HeapAllocatedSize[GetHeapIndex(Page.GetMemoryTypeIndex())] -= PageSize;
+            OnPageDestroy(Page);
+            m_DedicatedPages.erase(curr_it);
+            m_NumReleasedDedicatedPages.fetch_sub(1);
+        }
+    }
+
+    // When memory budget is available, reserved pages are also released if the heap exceeds its budget
+    const bool UseBudget = m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget;
+    if (!UseBudget && m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
         return;
 
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT Budget{};
+    bool                                      BudgetQueried = false;
+
     auto it = m_Pages.begin();
     while (it != m_Pages.end())
     {
         auto curr_it = it;
         ++it;
-        auto& Page          = curr_it->second;
-        bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
-        auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        auto& Page = curr_it->second;
+        if (!Page.IsEmpty())
+            continue;
+
+        bool IsHostVisible = Page.GetCPUMemory() != nullptr;
+        auto ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+        auto HeapIndex     = GetHeapIndex(curr_it->first.MemoryTypeIndex);
+        bool ReleasePage   = m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize;
+        if (!ReleasePage && UseBudget)
+        {
+            if (!BudgetQueried)
+            {
+                m_PhysicalDevice.GetMemoryBudget(Budget);
+                BudgetQueried = true;
+            }
+            ReleasePage = Budget.heapUsage[HeapIndex] > Budget.heapBudget[HeapIndex];
+        }
+
+        if (ReleasePage)
         {
             auto PageSize = Page.GetPageSize();
             m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
+            m_HeapAllocatedSize[HeapIndex] -= PageSize;
             LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
                              " page (", Diligent::FormatMemorySize(PageSize, 2),
                              "). Current allocated size: ",
@@ -238,9 +403,71 @@ void VulkanMemoryManager::ShrinkMemory()
     }
 }
 
-void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
+void VulkanMemoryManager::SetBudgetCallback(BudgetCallbackType Callback, float Threshold)
+{
+    VERIFY(!Callback || (Threshold > 0 && Threshold <= 1), "Threshold (", Threshold, ") must be in (0, 1] range");
+
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    m_BudgetCallback  = std::move(Callback);
+    m_BudgetThreshold = Threshold;
+}
+
+VkDeviceSize VulkanMemoryManager::GetHeapAllocatedSize(uint32_t HeapIndex)
+{
+    VERIFY_EXPR(HeapIndex < VK_MAX_MEMORY_HEAPS);
+
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    return m_HeapAllocatedSize[HeapIndex];
+}
+
+uint32_t VulkanMemoryManager::GetDirectWriteMemoryTypeIndex(uint32_t MemoryTypeBits) const
+{
+    // Without resizable BAR, device-local host-visible memory is limited to a 256 MB window
+    // that is too small to place resources in.
+    constexpr VkDeviceSize MaxBARWindowSize = VkDeviceSize{256} << 20;
+
+    constexpr VkMemoryPropertyFlags RequiredProps =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    const auto& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+    for (uint32_t TypeIdx = 0; TypeIdx < MemoryProps.memoryTypeCount; ++TypeIdx)
+    {
+        if ((MemoryTypeBits & (1u << TypeIdx)) == 0)
+            continue;
+
+        const auto& MemType = MemoryProps.memoryTypes[TypeIdx];
+        if ((MemType.propertyFlags & RequiredProps) != RequiredProps)
+            continue;
+
+        if (MemoryProps.memoryHeaps[MemType.heapIndex].size > MaxBARWindowSize)
+            return TypeIdx;
+    }
+
+    return VulkanPhysicalDevice::InvalidMemoryTypeIndex;
+}
+
+VulkanMemoryManager::PageStats VulkanMemoryManager::GetPageStats(bool HostVisible)
+{
+    const size_t stat_ind = HostVisible ? 1 : 0;
+
+    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+
+    PageStats Stats;
+    Stats.AllocatedSize     = m_CurrAllocatedSize[stat_ind];
+    Stats.UsedSize          = static_cast<VkDeviceSize>(std::max(m_CurrUsedSize[stat_ind].load(), int64_t{0}));
+    Stats.PeakAllocatedSize = m_PeakAllocatedSize[stat_ind];
+    Stats.PeakUsedSize      = m_PeakUsedSize[stat_ind];
+    return Stats;
+}
+
+void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible, bool IsDedicatedPage)
 {
     m_CurrUsedSize[IsHostVisible ? 1 : 0].fetch_add(-static_cast<int64_t>(Size));
+    // Dedicated page contains a single allocation, so it is empty now
+    if (IsDedicatedPage)
+        m_NumReleasedDedicatedPages.fetch_add(1);
 }
 
 VulkanMemoryManager::~VulkanMemoryManager()
@@ -259,6 +486,8 @@ VulkanMemoryManager::~VulkanMemoryManager()
 
     for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
         VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    for (const auto& Page : m_DedicatedPages)
+        VERIFY(Page.IsEmpty(), "The dedicated page contains outstanding allocation");
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
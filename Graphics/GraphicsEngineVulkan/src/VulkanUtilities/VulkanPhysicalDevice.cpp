@@ -31,6 +31,7 @@
 
 #include "VulkanErrors.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
+#include "CPUProfiler.hpp"
 
 namespace VulkanUtilities
 {
@@ -44,6 +45,8 @@ std::unique_ptr<VulkanPhysicalDevice> VulkanPhysicalDevice::Create(const CreateI
 VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
     m_VkDevice{CI.vkDevice}
 {
+    DILIGENT_PROFILE_FUNCTION();
+
     VERIFY_EXPR(m_VkDevice != VK_NULL_HANDLE);
 
     vkGetPhysicalDeviceProperties(m_VkDevice, &m_Properties);
@@ -79,6 +82,30 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
     m_VkVersion &= ~VK_MAKE_VERSION(0, 0, VK_API_VERSION_PATCH(~0u));
 
 #if DILIGENT_USE_VOLK
+    // Find the device group that contains this physical device
+    if (CI.Instance.GetVersion() >= VK_API_VERSION_1_1)
+    {
+        uint32_t GroupCount = 0;
+        vkEnumeratePhysicalDeviceGroups(CI.Instance.GetVkInstance(), &GroupCount, nullptr);
+
+        std::vector<VkPhysicalDeviceGroupProperties> Groups(GroupCount);
+        for (auto& Group : Groups)
+            Group.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
+
+        if (GroupCount > 0 && vkEnumeratePhysicalDeviceGroups(CI.Instance.GetVkInstance(), &GroupCount, Groups.data()) == VK_SUCCESS)
+        {
+            for (uint32_t g = 0; g < GroupCount; ++g)
+            {
+                const auto& Group = Groups[g];
+                for (uint32_t d = 0; d < Group.physicalDeviceCount; ++d)
+                {
+                    if (Group.physicalDevices[d] == m_VkDevice)
+                        m_DeviceGroupSize = Group.physicalDeviceCount;
+                }
+            }
+        }
+    }
+
     if (CI.Instance.IsExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
     {
         VkPhysicalDeviceFeatures2 Feats2{};
@@ -310,6 +337,22 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
             m_ExtFeatures.DrawIndirectCount = true;
         }
 
+        if (IsExtensionSupported(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DynamicRendering;
+            NextFeat  = &m_ExtFeatures.DynamicRendering.pNext;
+
+            m_ExtFeatures.DynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+        }
+
+        if (IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.Synchronization2;
+            NextFeat  = &m_ExtFeatures.Synchronization2.pNext;
+
+            m_ExtFeatures.Synchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        }
+
         if (IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME))
         {
             *NextProp = &m_ExtProperties.Maintenance3;
@@ -336,6 +379,92 @@ VulkanPhysicalDevice::VulkanPhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.MultiDraw.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
         }
 
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        {
+            m_ExtFeatures.PushDescriptor = true;
+
+            *NextProp = &m_ExtProperties.PushDescriptor;
+            NextProp  = &m_ExtProperties.PushDescriptor.pNext;
+
+            m_ExtProperties.PushDescriptor.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        }
+
+        // VK_EXT_memory_budget requires VK_KHR_get_physical_device_properties2
+        if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+            m_ExtFeatures.MemoryBudget = true;
+
+        // VK_KHR_dedicated_allocation requires VK_KHR_get_memory_requirements2
+        if (IsExtensionSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME) &&
+            IsExtensionSupported(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME))
+            m_ExtFeatures.DedicatedAllocation = true;
+
+        // VK_EXT_graphics_pipeline_library requires VK_KHR_pipeline_library
+        if (IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) &&
+            IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.GraphicsPipelineLibrary;
+            NextFeat  = &m_ExtFeatures.GraphicsPipelineLibrary.pNext;
+
+            m_ExtFeatures.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.GraphicsPipelineLibrary;
+            NextProp  = &m_ExtProperties.GraphicsPipelineLibrary.pNext;
+
+            m_ExtProperties.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ExtendedDynamicState;
+            NextFeat  = &m_ExtFeatures.ExtendedDynamicState.pNext;
+
+            m_ExtFeatures.ExtendedDynamicState.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ConditionalRendering;
+            NextFeat  = &m_ExtFeatures.ConditionalRendering.pNext;
+
+            m_ExtFeatures.ConditionalRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_EXT_SHADER_OBJECT_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.ShaderObject;
+            NextFeat  = &m_ExtFeatures.ShaderObject.pNext;
+
+            m_ExtFeatures.ShaderObject.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+        }
+
+        // VK_KHR_present_wait requires VK_KHR_present_id
+        if (IsExtensionSupported(VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+            IsExtensionSupported(VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.PresentId;
+            NextFeat  = &m_ExtFeatures.PresentId.pNext;
+
+            m_ExtFeatures.PresentId.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+            *NextFeat = &m_ExtFeatures.PresentWait;
+            NextFeat  = &m_ExtFeatures.PresentWait.pNext;
+
+            m_ExtFeatures.PresentWait.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        }
+
         // make sure that last pNext is null
         *NextFeat = nullptr;
         *NextProp = nullptr;
@@ -516,4 +645,23 @@ VkFormatProperties VulkanPhysicalDevice::GetPhysicalDeviceFormatProperties(VkFor
     return formatProperties;
 }
 
+bool VulkanPhysicalDevice::GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const
+{
+    Budget       = {};
+    Budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+#if DILIGENT_USE_VOLK
+    if (m_ExtFeatures.MemoryBudget)
+    {
+        VkPhysicalDeviceMemoryProperties2 MemProps2{};
+        MemProps2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        MemProps2.pNext = &Budget;
+        vkGetPhysicalDeviceMemoryProperties2KHR(m_VkDevice, &MemProps2);
+        return true;
+    }
+#endif
+
+    return false;
+}
+
 } // namespace VulkanUtilities
@@ -0,0 +1,171 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::BindGroupCacheWebGPU class
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "WebGPUObjectWrappers.hpp"
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+// Bind group cache keeps bind groups created with the same bind group layout and reuses them
+// when a resource cache requests a bind group for a combination of resources that has been
+// seen before. This avoids calling wgpuDeviceCreateBindGroup() every time dynamic variables
+// cycle through a small set of resources.
+//
+// Bind groups that are currently used by at least one resource cache are never evicted.
+// Unused bind groups are kept in the LRU order and the least recently used ones are released
+// when the number of bind groups in the cache exceeds the maximum size.
+//
+// Note that a cached bind group keeps references to the WebGPU objects in its entries, so
+// the memory of released resources is not freed until the bind group is evicted.
+class BindGroupCacheWebGPU
+{
+public:
+    // Statistics shared by all bind group caches of the device
+    struct Statistics
+    {
+        std::atomic<Uint64> NumHits{0};
+        std::atomic<Uint64> NumMisses{0};
+        std::atomic<Uint64> NumEvictions{0};
+    };
+
+    BindGroupCacheWebGPU(Uint32 MaxSize, Statistics& Stats) noexcept;
+    ~BindGroupCacheWebGPU();
+
+    // clang-format off
+    BindGroupCacheWebGPU           (const BindGroupCacheWebGPU&)  = delete;
+    BindGroupCacheWebGPU           (      BindGroupCacheWebGPU&&) = delete;
+    BindGroupCacheWebGPU& operator=(const BindGroupCacheWebGPU&)  = delete;
+    BindGroupCacheWebGPU& operator=(      BindGroupCacheWebGPU&&) = delete;
+    // clang-format on
+
+    class CachedBindGroup;
+
+    // Returns the bind group for the given entries, creating it if necessary.
+    // The returned bind group is referenced by the caller and must be released with Release().
+    CachedBindGroup* GetBindGroup(WGPUDevice                wgpuDevice,
+                                  WGPUBindGroupLayout       wgpuGroupLayout,
+                                  const WGPUBindGroupEntry* wgpuEntries,
+                                  Uint32                    NumEntries);
+
+    void Release(CachedBindGroup* pBindGroup);
+
+    static WGPUBindGroup GetWGPUBindGroup(const CachedBindGroup* pBindGroup);
+
+private:
+    // Identity of the resources in a single bind group entry
+    struct EntryKey
+    {
+        WGPUBuffer      wgpuBuffer      = nullptr;
+        Uint64          Offset          = 0;
+        Uint64          Size            = 0;
+        WGPUSampler     wgpuSampler     = nullptr;
+        WGPUTextureView wgpuTextureView = nullptr;
+
+        bool operator==(const EntryKey& RHS) const
+        {
+            // clang-format off
+            return wgpuBuffer      == RHS.wgpuBuffer  &&
+                   Offset          == RHS.Offset      &&
+                   Size            == RHS.Size        &&
+                   wgpuSampler     == RHS.wgpuSampler &&
+                   wgpuTextureView == RHS.wgpuTextureView;
+            // clang-format on
+        }
+    };
+
+    struct BindGroupKey
+    {
+        std::vector<EntryKey> Entries;
+        size_t                Hash = 0;
+
+        bool operator==(const BindGroupKey& RHS) const
+        {
+            return Hash == RHS.Hash && Entries == RHS.Entries;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const BindGroupKey& Key) const
+            {
+                return Key.Hash;
+            }
+        };
+    };
+
+public:
+    class CachedBindGroup
+    {
+    public:
+        CachedBindGroup(WGPUBindGroup wgpuBindGroup) noexcept :
+            m_wgpuBindGroup{wgpuBindGroup}
+        {}
+
+    private:
+        friend BindGroupCacheWebGPU;
+
+        WebGPUBindGroupWrapper m_wgpuBindGroup;
+
+        // The number of resource caches that use this bind group
+        Uint32 m_RefCount = 0;
+
+        const BindGroupKey* m_pKey = nullptr;
+
+        // Position in the LRU list. Only valid when the bind group is not used.
+        std::list<const BindGroupKey*>::iterator m_LRUIt;
+    };
+
+private:
+    void EvictUnusedBindGroups();
+
+private:
+    const Uint32 m_MaxSize;
+    Statistics&  m_Stats;
+
+    std::mutex m_Mtx;
+
+    std::unordered_map<BindGroupKey, CachedBindGroup, BindGroupKey::Hasher> m_Cache;
+
+    // Unused bind groups. The most recently used bind group is at the front.
+    std::list<const BindGroupKey*> m_LRUList;
+
+    // Scratch key that is reused for look-ups to avoid memory allocations
+    BindGroupKey m_TmpKey;
+};
+
+} // namespace Diligent
@@ -77,6 +77,9 @@ public:
     /// Implementation of IDeviceContext::SetBlendFactors() in WebGPU backend.
     void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
 
+    /// Implementation of IDeviceContext::SetDynamicRenderState() in WebGPU backend.
+    void DILIGENT_CALL_TYPE SetDynamicRenderState(const DynamicRenderState& State) override final;
+
     /// Implementation of IDeviceContext::SetVertexBuffers() in WebGPU backend.
     void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
                                              Uint32                         NumBuffersSet,
@@ -159,6 +162,10 @@ public:
                                               const void*                    RGBA,
                                               RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
 
+    /// Implementation of IDeviceContext::InvalidateAttachments() in WebGPU backend.
+    void DILIGENT_CALL_TYPE InvalidateAttachments(Uint32               NumViews,
+                                                  ITextureView* const* ppViews) override final;
+
     /// Implementation of IDeviceContext::UpdateBuffer() in WebGPU backend.
     void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
                                          Uint64                         Offset,
@@ -230,6 +237,19 @@ public:
     /// Implementation of IDeviceContext::EndQuery() in WebGPU backend.
     void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
 
+    /// Implementation of IDeviceContext::ResolveQueries() in WebGPU backend.
+    void DILIGENT_CALL_TYPE ResolveQueries(IQuery* const*                 ppQueries,
+                                           Uint32                         NumQueries,
+                                           IBuffer*                       pDstBuffer,
+                                           Uint64                         DstOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::BeginConditionalRendering() in WebGPU backend.
+    void DILIGENT_CALL_TYPE BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::EndConditionalRendering() in WebGPU backend.
+    void DILIGENT_CALL_TYPE EndConditionalRendering() override final;
+
     /// Implementation of IDeviceContext::Flush() in WebGPU backend.
     void DILIGENT_CALL_TYPE Flush() override final;
 
@@ -300,6 +320,10 @@ public:
     /// Implementation of IDeviceContextWebGPU::GetWebGPUQueue() in WebGPU backend.
     WGPUQueue DILIGENT_CALL_TYPE GetWebGPUQueue() override final;
 
+    /// Implementation of IDeviceContextWebGPU::BeginRenderBundle() in WebGPU backend.
+    void DILIGENT_CALL_TYPE BeginRenderBundle(Uint32                         ImmediateContextId,
+                                              const SetRenderTargetsAttribs& Attribs) override final;
+
     QueryManagerWebGPU& GetQueryManager();
 
     Uint64 GetNextFenceValue();
@@ -346,6 +370,9 @@ private:
     WGPURenderPassEncoder  GetRenderPassCommandEncoder();
     WGPUComputePassEncoder GetComputePassCommandEncoder();
 
+    // Returns the render bundle encoder of the deferred context (see BeginRenderBundle)
+    WGPURenderBundleEncoder GetRenderBundleEncoder();
+
     void EndCommandEncoders(Uint32 EncoderFlags = COMMAND_ENCODER_FLAG_ALL);
 
     void CommitRenderTargets();
@@ -358,15 +385,23 @@ private:
                          const float               ClearData[],
                          Uint8                     Stencil);
 
-    WGPURenderPassEncoder  PrepareForDraw(DRAW_FLAGS Flags);
-    WGPURenderPassEncoder  PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
+    // Render commands are encoded into a render pass encoder by the immediate context
+    // and into a render bundle encoder by deferred contexts.
+    template <typename CmdEncoderType>
+    CmdEncoderType PrepareForDraw(DRAW_FLAGS Flags);
+    template <typename CmdEncoderType>
+    CmdEncoderType PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
+
     WGPUComputePassEncoder PrepareForDispatchCompute();
     WGPUBuffer             PrepareForIndirectCommand(IBuffer* pAttribsBuffer, Uint64& IdirectBufferOffset);
 
-    void CommitGraphicsPSO(WGPURenderPassEncoder CmdEncoder);
+    template <typename CmdEncoderType>
+    void CommitGraphicsPSO(CmdEncoderType CmdEncoder);
     void CommitComputePSO(WGPUComputePassEncoder CmdEncoder);
-    void CommitVertexBuffers(WGPURenderPassEncoder CmdEncoder);
-    void CommitIndexBuffer(WGPURenderPassEncoder CmdEncoder, VALUE_TYPE IndexType);
+    template <typename CmdEncoderType>
+    void CommitVertexBuffers(CmdEncoderType CmdEncoder);
+    template <typename CmdEncoderType>
+    void CommitIndexBuffer(CmdEncoderType CmdEncoder, VALUE_TYPE IndexType);
     void CommitViewports(WGPURenderPassEncoder CmdEncoder);
     void CommitScissorRects(WGPURenderPassEncoder CmdEncoder);
 
@@ -576,6 +611,11 @@ private:
     WebGPURenderPassEncoderWrapper  m_wgpuRenderPassEncoder;
     WebGPUComputePassEncoderWrapper m_wgpuComputePassEncoder;
 
+    // Render bundle encoder of the deferred context (see BeginRenderBundle)
+    WebGPURenderBundleEncoderWrapper m_wgpuRenderBundleEncoder;
+
+    FixedBlockMemoryAllocator m_CmdListAllocator;
+
     PendingFenceList        m_SignaledFences;
     AttachmentClearList     m_AttachmentClearValues;
     PendingQueryList        m_PendingTimeQueries;
@@ -57,6 +57,9 @@ public:
     /// Implementation of IFence::Wait() in WebGPU backend.
     void DILIGENT_CALL_TYPE Wait(Uint64 Value) override final;
 
+    /// Implementation of IFence::RegisterCompletionCallback() in WebGPU backend.
+    void DILIGENT_CALL_TYPE RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData) override final;
+
     void AppendSyncPoints(const std::vector<RefCntAutoPtr<SyncPointWebGPUImpl>>& SyncPoints, Uint64 Value);
 
 private:
@@ -40,6 +40,7 @@
 
 #include "PipelineResourceAttribsWebGPU.hpp"
 #include "WebGPUObjectWrappers.hpp"
+#include "BindGroupCacheWebGPU.hpp"
 #include "SamplerWebGPUImpl.hpp"
 
 namespace Diligent
@@ -117,6 +118,9 @@ public:
 
     WGPUBindGroupLayout GetWGPUBindGroupLayout(BIND_GROUP_ID GroupId);
 
+    // Returns the cache of bind groups created with the given layout, or null if bind group caching is disabled
+    BindGroupCacheWebGPU* GetBindGroupCache(BIND_GROUP_ID GroupId) const { return m_BindGroupCaches[GroupId].get(); }
+
     bool   HasBindGroup(BIND_GROUP_ID GroupId) const { return m_BindGroupSizes[GroupId] != ~0u && m_BindGroupSizes[GroupId] > 0; }
     Uint32 GetBindGroupSize(BIND_GROUP_ID GroupId) const { return m_BindGroupSizes[GroupId]; }
     Uint32 GetDynamicOffsetCount(BIND_GROUP_ID GroupId) const { return m_DynamicOffsetCounts[GroupId]; }
@@ -183,6 +187,8 @@ private:
 
     std::array<WebGPUBindGroupLayoutWrapper, BIND_GROUP_ID_NUM_GROUPS> m_wgpuBindGroupLayouts;
 
+    std::array<std::unique_ptr<BindGroupCacheWebGPU>, BIND_GROUP_ID_NUM_GROUPS> m_BindGroupCaches;
+
     // Bind group sizes indexed by the group index in the layout (not BIND_GROUP_ID!)
     std::array<Uint32, MAX_BIND_GROUPS> m_BindGroupSizes = {~0U, ~0U};
 
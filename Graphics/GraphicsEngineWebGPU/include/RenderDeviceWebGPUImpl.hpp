@@ -37,6 +37,7 @@
 #include "UploadMemoryManagerWebGPU.hpp"
 #include "DynamicMemoryManagerWebGPU.hpp"
 #include "GenerateMipsHelperWebGPU.hpp"
+#include "BindGroupCacheWebGPU.hpp"
 
 namespace Diligent
 {
@@ -140,6 +141,13 @@ public:
     /// Implementation of IRenderDevice::IdleGPU() in WebGPU backend.
     void DILIGENT_CALL_TYPE IdleGPU() override final;
 
+    /// Implementation of IRenderDevice::WaitForFences() in WebGPU backend.
+    Bool DILIGENT_CALL_TYPE WaitForFences(IFence* const* ppFences,
+                                          const Uint64*  pValues,
+                                          Uint32         NumFences,
+                                          Bool           WaitAll,
+                                          Uint64         Timeout) override final;
+
     /// Implementation of IRenderDevice::GetSparseTextureFormatInfo() in WebGPU backend.
     SparseTextureFormatInfo DILIGENT_CALL_TYPE GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
                                                                           RESOURCE_DIMENSION Dimension,
@@ -213,6 +221,10 @@ public:
 
     void DeviceTick();
 
+    Uint32 GetBindGroupCacheSize() const { return m_BindGroupCacheSize; }
+
+    BindGroupCacheWebGPU::Statistics& GetBindGroupCacheStats() { return m_BindGroupCacheStats; }
+
 private:
     void TestTextureFormat(TEXTURE_FORMAT TexFormat) override;
 
@@ -230,6 +242,9 @@ private:
     std::unique_ptr<AttachmentCleanerWebGPU>  m_pAttachmentCleaner;
     std::unique_ptr<GenerateMipsHelperWebGPU> m_pMipsGenerator;
     std::unique_ptr<QueryManagerWebGPU>       m_pQueryManager;
+
+    const Uint32                     m_BindGroupCacheSize;
+    BindGroupCacheWebGPU::Statistics m_BindGroupCacheStats;
 };
 
 } // namespace Diligent
@@ -33,6 +33,7 @@
 #include "PipelineResourceAttribsWebGPU.hpp"
 #include "STDAllocator.hpp"
 #include "WebGPUObjectWrappers.hpp"
+#include "BindGroupCacheWebGPU.hpp"
 #include "IndexWrapper.hpp"
 
 namespace Diligent
@@ -111,6 +112,11 @@ public:
         BindGroup& operator=(      BindGroup&&) = delete;
         // clang-format on
 
+        ~BindGroup()
+        {
+            ReleaseCachedBindGroup();
+        }
+
         const Resource& GetResource(Uint32 CacheOffset) const
         {
             VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
@@ -121,7 +127,21 @@ public:
 
         WGPUBindGroup GetWGPUBindGroup() const
         {
-            return m_wgpuBindGroup;
+            return m_pCachedBindGroup != nullptr ?
+                BindGroupCacheWebGPU::GetWGPUBindGroup(m_pCachedBindGroup) :
+                m_wgpuBindGroup.Get();
+        }
+
+    private:
+        void ReleaseCachedBindGroup()
+        {
+            if (m_pCachedBindGroup != nullptr)
+            {
+                VERIFY_EXPR(m_pBindGroupCache != nullptr);
+                m_pBindGroupCache->Release(m_pCachedBindGroup);
+                m_pCachedBindGroup = nullptr;
+                m_pBindGroupCache  = nullptr;
+            }
         }
 
     private:
@@ -130,7 +150,11 @@ public:
         /* 8 */ Resource* const           m_pResources   = nullptr;
         /*16 */ WGPUBindGroupEntry* const m_wgpuEntries  = nullptr;
         /*24 */ WebGPUBindGroupWrapper    m_wgpuBindGroup;
-        /*40 */ // End of structure
+
+        // Bind group owned by the bind group cache of the signature, if the cache is used
+        /*40 */ BindGroupCacheWebGPU*                  m_pBindGroupCache  = nullptr;
+        /*48 */ BindGroupCacheWebGPU::CachedBindGroup* m_pCachedBindGroup = nullptr;
+        /*56 */ // End of structure
 
     private:
         friend ShaderResourceCacheWebGPU;
@@ -174,7 +198,12 @@ public:
 
     ResourceCacheContentType GetContentType() const { return static_cast<ResourceCacheContentType>(m_ContentType); }
 
-    WGPUBindGroup UpdateBindGroup(WGPUDevice wgpuDevice, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout);
+    // Returns the bind group for the current resources in the group. If the bind group cache is not null,
+    // the bind group is taken from the cache; otherwise a new bind group is created when resources change.
+    WGPUBindGroup UpdateBindGroup(WGPUDevice            wgpuDevice,
+                                  Uint32                GroupIndex,
+                                  WGPUBindGroupLayout   wgpuGroupLayout,
+                                  BindGroupCacheWebGPU* pBindGroupCache = nullptr);
 
     // Returns true if any dynamic offset has changed
     bool GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
@@ -43,6 +43,8 @@ class ShaderVariableManagerWebGPU : ShaderVariableManagerBase<EngineWebGPUImplTr
 {
 public:
     using TBase = ShaderVariableManagerBase<EngineWebGPUImplTraits, ShaderVariableWebGPUImpl>;
+    using TBase::GetResourceCache;
+    using TBase::GetSignature;
     ShaderVariableManagerWebGPU(IObject&                   Owner,
                                 ShaderResourceCacheWebGPU& ResourceCache) noexcept :
         TBase{Owner, ResourceCache}
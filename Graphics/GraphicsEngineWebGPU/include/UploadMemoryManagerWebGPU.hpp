@@ -31,6 +31,7 @@
 
 #include <mutex>
 #include <vector>
+#include <list>
 
 #include "WebGPUObjectWrappers.hpp"
 #include "BasicTypes.h"
@@ -45,6 +46,12 @@ namespace Diligent
 //
 // The data is first written to the upload memory and the copy command is added to the command list.
 // Upload data is flushed to the GPU memory before the command list is submitted to the queue.
+//
+// By default, the data is written to a CPU-side copy of each page that is then uploaded with
+// wgpuQueueWriteBuffer(). When mapped pages are enabled, every page is a MAP_WRITE buffer that
+// is mapped at creation, so the data is written directly to the mapped memory and the page is
+// unmapped before the submission. After the submission, the page is mapped again with
+// wgpuBufferMapAsync() and becomes available for reuse once the GPU is done with it.
 class UploadMemoryManagerWebGPU
 {
 public:
@@ -82,17 +89,24 @@ public:
 
         size_t GetSize() const
         {
-            return m_Data.size();
+            return m_Size;
         }
 
     private:
+        friend UploadMemoryManagerWebGPU;
+
         UploadMemoryManagerWebGPU* m_pMgr = nullptr;
         WebGPUBufferWrapper        m_wgpuBuffer;
         std::vector<Uint8>         m_Data;
+        size_t                     m_Size       = 0;
         size_t                     m_CurrOffset = 0;
+
+        // CPU address of the page memory: either m_Data or the mapped range of the buffer.
+        // Null when the mapped page is not currently mapped.
+        Uint8* m_pData = nullptr;
     };
 
-    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize);
+    UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedPages);
     ~UploadMemoryManagerWebGPU();
 
     Page GetPage(size_t Size);
@@ -100,13 +114,20 @@ public:
 private:
     void RecyclePage(Page&& page);
 
+    static void OnPageMapped(WGPUBufferMapAsyncStatus MapStatus, void* pUserData);
+
 private:
     const size_t m_PageSize;
     WGPUDevice   m_wgpuDevice;
+    const bool   m_UseMappedPages;
 
     std::mutex        m_AvailablePagesMtx;
     std::vector<Page> m_AvailablePages;
 
+    // Mapped pages that have been submitted and are waiting for wgpuBufferMapAsync() to complete.
+    // std::list is used to keep the page addresses stable as they are passed to the map callbacks.
+    std::list<Page> m_PendingPages;
+
 #if DILIGENT_DEBUG
     std::atomic<uint32_t> m_DbgPageCounter{0};
 #endif
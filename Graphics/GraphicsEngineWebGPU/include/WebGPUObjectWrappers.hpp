@@ -144,6 +144,8 @@ DECLARE_WEBGPU_WRAPPER(WebGPUCommandBuffer, WGPUCommandBuffer, wgpuCommandBuffer
 DECLARE_WEBGPU_WRAPPER(WebGPUCommandEncoder, WGPUCommandEncoder, wgpuCommandEncoder)
 DECLARE_WEBGPU_WRAPPER(WebGPURenderPassEncoder, WGPURenderPassEncoder, wgpuRenderPassEncoder)
 DECLARE_WEBGPU_WRAPPER(WebGPUComputePassEncoder, WGPUComputePassEncoder, wgpuComputePassEncoder)
+DECLARE_WEBGPU_WRAPPER(WebGPURenderBundleEncoder, WGPURenderBundleEncoder, wgpuRenderBundleEncoder)
+DECLARE_WEBGPU_WRAPPER(WebGPURenderBundle, WGPURenderBundle, wgpuRenderBundle)
 DECLARE_WEBGPU_WRAPPER(WebGPUBindGroup, WGPUBindGroup, wgpuBindGroup)
 DECLARE_WEBGPU_WRAPPER(WebGPUQuerySet, WGPUQuerySet, wgpuQuerySet)
 
@@ -55,6 +55,31 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextWebGPU, IDeviceContext)
 {
     /// Returns a pointer to the WebGPU queue object associated with this device context.
     VIRTUAL WGPUQueue METHOD(GetWebGPUQueue)(THIS) PURE;
+
+    /// Begins recording a render bundle in the deferred context.
+
+    /// \param [in] ImmediateContextId - Index of the immediate context that will execute the render bundle.
+    /// \param [in] Attribs            - Render targets the render bundle will be executed with.
+    ///                                  Only their formats and sample count are used.
+    ///
+    /// \remarks  This method can only be called for deferred contexts and is used instead of IDeviceContext::Begin().
+    ///           Draw commands and the state they depend on are encoded into a WebGPU render bundle,
+    ///           which the immediate context replays with a single call. This avoids encoding
+    ///           static draw sequences again every frame.
+    ///
+    ///           While recording the render bundle, render targets can't be changed and only draw commands,
+    ///           pipeline, resource, vertex and index buffer bindings and debug groups may be used.
+    ///           Viewports, scissor rects, blend factors and stencil reference are inherited from
+    ///           the render pass the bundle is executed in. Dynamic buffers can't be used.
+    ///
+    ///           The render bundle is finished with IDeviceContext::FinishCommandList() and executed with
+    ///           IDeviceContext::ExecuteCommandLists() inside a render pass with compatible render targets.
+    ///           Unlike other command lists, the command list can be executed any number of times.
+    ///           Executing render bundles resets the pipeline and resource bindings of the immediate
+    ///           context, which are committed again by the next draw command.
+    VIRTUAL void METHOD(BeginRenderBundle)(THIS_
+                                           Uint32                            ImmediateContextId,
+                                           const SetRenderTargetsAttribs REF Attribs) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -66,6 +91,7 @@ DILIGENT_END_INTERFACE
 #    define IDeviceContextWebGPU_MapBufferAsync(This, ...)              CALL_IFACE_METHOD(DeviceContextWebGPU, MapBufferAsync, This, __VA_ARGS__)
 #    define IDeviceContextWebGPU_MapTextureSubresourceAsync(This, ...)  CALL_IFACE_METHOD(DeviceContextWebGPU, MapTextureSubresourceAsync, This, __VA_ARGS__)
 #    define IDeviceContextWebGPU_GetWebGPUQueue(This)                   CALL_IFACE_METHOD(DeviceContextWebGPU, GetWebGPUQueue, This)
+#    define IDeviceContextWebGPU_BeginRenderBundle(This, ...)           CALL_IFACE_METHOD(DeviceContextWebGPU, BeginRenderBundle, This, __VA_ARGS__)
 // clang-format on
 
 #endif
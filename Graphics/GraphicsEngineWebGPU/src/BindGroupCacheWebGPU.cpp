@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "BindGroupCacheWebGPU.hpp"
+#include "DebugUtilities.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+BindGroupCacheWebGPU::BindGroupCacheWebGPU(Uint32 MaxSize, Statistics& Stats) noexcept :
+    m_MaxSize{MaxSize},
+    m_Stats{Stats}
+{
+}
+
+BindGroupCacheWebGPU::~BindGroupCacheWebGPU()
+{
+#ifdef DILIGENT_DEBUG
+    for (const auto& it : m_Cache)
+    {
+        VERIFY(it.second.m_RefCount == 0, "Bind group is still in use by a resource cache. This may be the result of a resource cache outliving its signature.");
+    }
+#endif
+}
+
+BindGroupCacheWebGPU::CachedBindGroup* BindGroupCacheWebGPU::GetBindGroup(WGPUDevice                wgpuDevice,
+                                                                          WGPUBindGroupLayout       wgpuGroupLayout,
+                                                                          const WGPUBindGroupEntry* wgpuEntries,
+                                                                          Uint32                    NumEntries)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    m_TmpKey.Entries.resize(NumEntries);
+    m_TmpKey.Hash = 0;
+    for (Uint32 i = 0; i < NumEntries; ++i)
+    {
+        const WGPUBindGroupEntry& wgpuEntry = wgpuEntries[i];
+        VERIFY(wgpuEntry.binding == i, "Bind group entries are expected to be ordered by binding index");
+
+        EntryKey& Entry{m_TmpKey.Entries[i]};
+        Entry.wgpuBuffer      = wgpuEntry.buffer;
+        Entry.Offset          = wgpuEntry.offset;
+        Entry.Size            = wgpuEntry.size;
+        Entry.wgpuSampler     = wgpuEntry.sampler;
+        Entry.wgpuTextureView = wgpuEntry.textureView;
+        HashCombine(m_TmpKey.Hash, Entry.wgpuBuffer, Entry.Offset, Entry.Size, Entry.wgpuSampler, Entry.wgpuTextureView);
+    }
+
+    auto it = m_Cache.find(m_TmpKey);
+    if (it != m_Cache.end())
+    {
+        CachedBindGroup& BindGroup = it->second;
+        if (BindGroup.m_RefCount == 0)
+        {
+            // The bind group is used again and can't be evicted
+            m_LRUList.erase(BindGroup.m_LRUIt);
+            BindGroup.m_LRUIt = {};
+        }
+        ++BindGroup.m_RefCount;
+        m_Stats.NumHits.fetch_add(1);
+        return &BindGroup;
+    }
+
+    WGPUBindGroupDescriptor wgpuBindGroupDescriptor;
+    wgpuBindGroupDescriptor.nextInChain = nullptr;
+    wgpuBindGroupDescriptor.label       = nullptr;
+    wgpuBindGroupDescriptor.layout      = wgpuGroupLayout;
+    wgpuBindGroupDescriptor.entryCount  = NumEntries;
+    wgpuBindGroupDescriptor.entries     = wgpuEntries;
+
+    WGPUBindGroup wgpuBindGroup = wgpuDeviceCreateBindGroup(wgpuDevice, &wgpuBindGroupDescriptor);
+    m_Stats.NumMisses.fetch_add(1);
+
+    it = m_Cache.emplace(std::piecewise_construct, std::forward_as_tuple(m_TmpKey), std::forward_as_tuple(wgpuBindGroup)).first;
+
+    CachedBindGroup& BindGroup = it->second;
+    BindGroup.m_pKey           = &it->first;
+    BindGroup.m_RefCount       = 1;
+
+    EvictUnusedBindGroups();
+
+    return &BindGroup;
+}
+
+void BindGroupCacheWebGPU::Release(CachedBindGroup* pBindGroup)
+{
+    VERIFY_EXPR(pBindGroup != nullptr);
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    VERIFY(pBindGroup->m_RefCount > 0, "Releasing bind group that is not used");
+    if (--pBindGroup->m_RefCount == 0)
+    {
+        m_LRUList.push_front(pBindGroup->m_pKey);
+        pBindGroup->m_LRUIt = m_LRUList.begin();
+
+        EvictUnusedBindGroups();
+    }
+}
+
+WGPUBindGroup BindGroupCacheWebGPU::GetWGPUBindGroup(const CachedBindGroup* pBindGroup)
+{
+    return pBindGroup != nullptr ? pBindGroup->m_wgpuBindGroup.Get() : nullptr;
+}
+
+void BindGroupCacheWebGPU::EvictUnusedBindGroups()
+{
+    while (m_Cache.size() > m_MaxSize && !m_LRUList.empty())
+    {
+        auto it = m_Cache.find(*m_LRUList.back());
+        VERIFY_EXPR(it != m_Cache.end() && it->second.m_RefCount == 0);
+        m_LRUList.pop_back();
+        m_Cache.erase(it);
+        m_Stats.NumEvictions.fetch_add(1);
+    }
+}
+
+} // namespace Diligent
@@ -38,6 +38,7 @@
 #include "RenderPassWebGPUImpl.hpp"
 #include "FramebufferWebGPUImpl.hpp"
 #include "FenceWebGPUImpl.hpp"
+#include "CommandListWebGPUImpl.hpp"
 #include "QueryManagerWebGPU.hpp"
 #include "QueryWebGPUImpl.hpp"
 #include "AttachmentCleanerWebGPU.hpp"
@@ -57,7 +58,8 @@ DeviceContextWebGPUImpl::DeviceContextWebGPUImpl(IReferenceCounters*           p
         pRefCounters,
         pDevice,
         Desc
-    }
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListWebGPUImpl), 64}
 // clang-format on
 {
     m_wgpuQueue.Reset(wgpuDeviceGetQueue(pDevice->GetWebGPUDevice()));
@@ -68,8 +70,55 @@ DeviceContextWebGPUImpl::DeviceContextWebGPUImpl(IReferenceCounters*           p
 
 void DeviceContextWebGPUImpl::Begin(Uint32 ImmediateContextId)
 {
+    DEV_ERROR("Deferred contexts in WebGPU can only record render bundles. Use IDeviceContextWebGPU::BeginRenderBundle() instead of Begin().");
+}
+
+void DeviceContextWebGPUImpl::BeginRenderBundle(Uint32 ImmediateContextId, const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Render bundles can only be recorded by deferred contexts");
     DEV_CHECK_ERR(ImmediateContextId == 0, "WebGPU supports only one immediate context");
     TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+
+    // Render targets are only used to define the render bundle layout - no render pass is begun
+    TDeviceContextBase::SetRenderTargets(Attribs);
+
+    std::array<WGPUTextureFormat, MAX_RENDER_TARGETS> wgpuColorFormats{};
+
+    Uint32 SampleCount = 1;
+    for (Uint32 RTIndex = 0; RTIndex < m_NumBoundRenderTargets; ++RTIndex)
+    {
+        if (TextureViewWebGPUImpl* pRTV = m_pBoundRenderTargets[RTIndex].RawPtr())
+        {
+            wgpuColorFormats[RTIndex] = TextureFormatToWGPUFormat(pRTV->GetDesc().Format);
+            SampleCount               = pRTV->GetTexture()->GetDesc().SampleCount;
+        }
+        else
+        {
+            wgpuColorFormats[RTIndex] = WGPUTextureFormat_Undefined;
+        }
+    }
+
+    WGPURenderBundleEncoderDescriptor wgpuRenderBundleEncoderDesc{};
+    wgpuRenderBundleEncoderDesc.colorFormatCount   = m_NumBoundRenderTargets;
+    wgpuRenderBundleEncoderDesc.colorFormats       = wgpuColorFormats.data();
+    wgpuRenderBundleEncoderDesc.depthStencilFormat = WGPUTextureFormat_Undefined;
+    if (m_pBoundDepthStencil)
+    {
+        const TextureViewDesc& DSVDesc = m_pBoundDepthStencil->GetDesc();
+
+        wgpuRenderBundleEncoderDesc.depthStencilFormat = TextureFormatToWGPUFormat(DSVDesc.Format);
+        if (DSVDesc.ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL)
+        {
+            // Must match the depth-stencil attachment of the render pass (see CommitRenderTargets)
+            wgpuRenderBundleEncoderDesc.depthReadOnly   = true;
+            wgpuRenderBundleEncoderDesc.stencilReadOnly = GetTextureFormatAttribs(DSVDesc.Format).ComponentType == COMPONENT_TYPE_DEPTH_STENCIL;
+        }
+        SampleCount = m_pBoundDepthStencil->GetTexture()->GetDesc().SampleCount;
+    }
+    wgpuRenderBundleEncoderDesc.sampleCount = SampleCount;
+
+    m_wgpuRenderBundleEncoder.Reset(wgpuDeviceCreateRenderBundleEncoder(m_pDevice->GetWebGPUDevice(), &wgpuRenderBundleEncoderDesc));
+    DEV_CHECK_ERR(m_wgpuRenderBundleEncoder != nullptr, "Failed to create render bundle encoder");
 }
 
 void DeviceContextWebGPUImpl::SetPipelineState(IPipelineState* pPipelineState)
@@ -174,6 +223,8 @@ void DeviceContextWebGPUImpl::DvpValidateCommittedShaderResources()
 void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
                                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Commit);
+
     TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
 
     ShaderResourceBindingWebGPUImpl* pResBindingWebGPU = ClassPtrCast<ShaderResourceBindingWebGPUImpl>(pShaderResourceBinding);
@@ -201,7 +252,7 @@ void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*
         WebGPUResourceBindInfo::BindGroupInfo& BindGroup = m_BindInfo.BindGroups[SRBIndex][BindGroupId];
         if (pSignature->HasBindGroup(BindGroupId))
         {
-            BindGroup.wgpuBindGroup = ResourceCache.UpdateBindGroup(wgpuDevice, BGIndex, pSignature->GetWGPUBindGroupLayout(BindGroupId));
+            BindGroup.wgpuBindGroup = ResourceCache.UpdateBindGroup(wgpuDevice, BGIndex, pSignature->GetWGPUBindGroupLayout(BindGroupId), pSignature->GetBindGroupCache(BindGroupId));
             ++BGIndex;
         }
         else
@@ -220,6 +271,33 @@ void SetBindGroup(WGPUComputePassEncoder Encoder, uint32_t GroupIndex, WGPUBindG
 {
     wgpuComputePassEncoderSetBindGroup(Encoder, GroupIndex, Group, DynamicOffsets.size(), !DynamicOffsets.empty() ? DynamicOffsets.data() : nullptr);
 }
+void SetBindGroup(WGPURenderBundleEncoder Encoder, uint32_t GroupIndex, WGPUBindGroup Group, const std::vector<Uint32>& DynamicOffsets)
+{
+    wgpuRenderBundleEncoderSetBindGroup(Encoder, GroupIndex, Group, DynamicOffsets.size(), !DynamicOffsets.empty() ? DynamicOffsets.data() : nullptr);
+}
+
+// clang-format off
+void EncoderSetPipeline(WGPURenderPassEncoder   Encoder, WGPURenderPipeline Pipeline) { wgpuRenderPassEncoderSetPipeline(Encoder, Pipeline); }
+void EncoderSetPipeline(WGPURenderBundleEncoder Encoder, WGPURenderPipeline Pipeline) { wgpuRenderBundleEncoderSetPipeline(Encoder, Pipeline); }
+
+void EncoderSetVertexBuffer(WGPURenderPassEncoder   Encoder, uint32_t Slot, WGPUBuffer Buffer, uint64_t Offset, uint64_t Size) { wgpuRenderPassEncoderSetVertexBuffer(Encoder, Slot, Buffer, Offset, Size); }
+void EncoderSetVertexBuffer(WGPURenderBundleEncoder Encoder, uint32_t Slot, WGPUBuffer Buffer, uint64_t Offset, uint64_t Size) { wgpuRenderBundleEncoderSetVertexBuffer(Encoder, Slot, Buffer, Offset, Size); }
+
+void EncoderSetIndexBuffer(WGPURenderPassEncoder   Encoder, WGPUBuffer Buffer, WGPUIndexFormat Format, uint64_t Offset, uint64_t Size) { wgpuRenderPassEncoderSetIndexBuffer(Encoder, Buffer, Format, Offset, Size); }
+void EncoderSetIndexBuffer(WGPURenderBundleEncoder Encoder, WGPUBuffer Buffer, WGPUIndexFormat Format, uint64_t Offset, uint64_t Size) { wgpuRenderBundleEncoderSetIndexBuffer(Encoder, Buffer, Format, Offset, Size); }
+
+void EncoderDraw(WGPURenderPassEncoder   Encoder, uint32_t VertexCount, uint32_t InstanceCount, uint32_t FirstVertex, uint32_t FirstInstance) { wgpuRenderPassEncoderDraw(Encoder, VertexCount, InstanceCount, FirstVertex, FirstInstance); }
+void EncoderDraw(WGPURenderBundleEncoder Encoder, uint32_t VertexCount, uint32_t InstanceCount, uint32_t FirstVertex, uint32_t FirstInstance) { wgpuRenderBundleEncoderDraw(Encoder, VertexCount, InstanceCount, FirstVertex, FirstInstance); }
+
+void EncoderDrawIndexed(WGPURenderPassEncoder   Encoder, uint32_t IndexCount, uint32_t InstanceCount, uint32_t FirstIndex, int32_t BaseVertex, uint32_t FirstInstance) { wgpuRenderPassEncoderDrawIndexed(Encoder, IndexCount, InstanceCount, FirstIndex, BaseVertex, FirstInstance); }
+void EncoderDrawIndexed(WGPURenderBundleEncoder Encoder, uint32_t IndexCount, uint32_t InstanceCount, uint32_t FirstIndex, int32_t BaseVertex, uint32_t FirstInstance) { wgpuRenderBundleEncoderDrawIndexed(Encoder, IndexCount, InstanceCount, FirstIndex, BaseVertex, FirstInstance); }
+
+void EncoderDrawIndirect(WGPURenderPassEncoder   Encoder, WGPUBuffer IndirectBuffer, uint64_t IndirectOffset) { wgpuRenderPassEncoderDrawIndirect(Encoder, IndirectBuffer, IndirectOffset); }
+void EncoderDrawIndirect(WGPURenderBundleEncoder Encoder, WGPUBuffer IndirectBuffer, uint64_t IndirectOffset) { wgpuRenderBundleEncoderDrawIndirect(Encoder, IndirectBuffer, IndirectOffset); }
+
+void EncoderDrawIndexedIndirect(WGPURenderPassEncoder   Encoder, WGPUBuffer IndirectBuffer, uint64_t IndirectOffset) { wgpuRenderPassEncoderDrawIndexedIndirect(Encoder, IndirectBuffer, IndirectOffset); }
+void EncoderDrawIndexedIndirect(WGPURenderBundleEncoder Encoder, WGPUBuffer IndirectBuffer, uint64_t IndirectOffset) { wgpuRenderBundleEncoderDrawIndexedIndirect(Encoder, IndirectBuffer, IndirectOffset); }
+// clang-format on
 
 template <typename CmdEncoderType>
 void DeviceContextWebGPUImpl::CommitBindGroups(CmdEncoderType CmdEncoder, Uint32 CommitSRBMask)
@@ -295,6 +373,11 @@ void DeviceContextWebGPUImpl::SetBlendFactors(const float* pBlendFactors)
         m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_BLEND_FACTORS);
 }
 
+void DeviceContextWebGPUImpl::SetDynamicRenderState(const DynamicRenderState& State)
+{
+    UNSUPPORTED("SetDynamicRenderState is not supported in WebGPU");
+}
+
 void DeviceContextWebGPUImpl::SetVertexBuffers(Uint32                         StartSlot,
                                                Uint32                         NumBuffersSet,
                                                IBuffer* const*                ppBuffers,
@@ -332,6 +415,12 @@ void DeviceContextWebGPUImpl::SetScissorRects(Uint32 NumRects, const Rect* pRect
 
 void DeviceContextWebGPUImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
 {
+    if (IsDeferred())
+    {
+        DEV_ERROR("Render targets can't be changed while recording a render bundle. They are set by IDeviceContextWebGPU::BeginRenderBundle().");
+        return;
+    }
+
     if (m_PendingClears.AnyPending())
     {
         bool RTChanged =
@@ -381,6 +470,8 @@ void DeviceContextWebGPUImpl::EndRenderPass()
 
 void DeviceContextWebGPUImpl::Draw(const DrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::Draw(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -390,12 +481,19 @@ void DeviceContextWebGPUImpl::Draw(const DrawAttribs& Attribs)
     if (Attribs.NumVertices == 0 || Attribs.NumInstances == 0)
         return;
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForDraw(Attribs.Flags);
-    wgpuRenderPassEncoderDraw(wgpuRenderCmdEncoder, Attribs.NumVertices, Attribs.NumInstances, Attribs.StartVertexLocation, Attribs.FirstInstanceLocation);
+    auto EncodeDraw = [&Attribs](auto wgpuRenderCmdEncoder) {
+        EncoderDraw(wgpuRenderCmdEncoder, Attribs.NumVertices, Attribs.NumInstances, Attribs.StartVertexLocation, Attribs.FirstInstanceLocation);
+    };
+    if (IsDeferred())
+        EncodeDraw(PrepareForDraw<WGPURenderBundleEncoder>(Attribs.Flags));
+    else
+        EncodeDraw(PrepareForDraw<WGPURenderPassEncoder>(Attribs.Flags));
 }
 
 void DeviceContextWebGPUImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -405,17 +503,24 @@ void DeviceContextWebGPUImpl::MultiDraw(const MultiDrawAttribs& Attribs)
     if (Attribs.NumInstances == 0)
         return;
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForDraw(Attribs.Flags);
-    for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
-    {
-        const MultiDrawItem& Item = Attribs.pDrawItems[DrawIdx];
-        if (Item.NumVertices > 0)
-            wgpuRenderPassEncoderDraw(wgpuRenderCmdEncoder, Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
-    }
+    auto EncodeMultiDraw = [&Attribs](auto wgpuRenderCmdEncoder) {
+        for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
+        {
+            const MultiDrawItem& Item = Attribs.pDrawItems[DrawIdx];
+            if (Item.NumVertices > 0)
+                EncoderDraw(wgpuRenderCmdEncoder, Item.NumVertices, Attribs.NumInstances, Item.StartVertexLocation, Attribs.FirstInstanceLocation);
+        }
+    };
+    if (IsDeferred())
+        EncodeMultiDraw(PrepareForDraw<WGPURenderBundleEncoder>(Attribs.Flags));
+    else
+        EncodeMultiDraw(PrepareForDraw<WGPURenderPassEncoder>(Attribs.Flags));
 }
 
 void DeviceContextWebGPUImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -425,12 +530,19 @@ void DeviceContextWebGPUImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
     if (Attribs.NumIndices == 0 || Attribs.NumInstances == 0)
         return;
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
-    wgpuRenderPassEncoderDrawIndexed(wgpuRenderCmdEncoder, Attribs.NumIndices, Attribs.NumInstances, Attribs.FirstIndexLocation, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
+    auto EncodeDrawIndexed = [&Attribs](auto wgpuRenderCmdEncoder) {
+        EncoderDrawIndexed(wgpuRenderCmdEncoder, Attribs.NumIndices, Attribs.NumInstances, Attribs.FirstIndexLocation, Attribs.BaseVertex, Attribs.FirstInstanceLocation);
+    };
+    if (IsDeferred())
+        EncodeDrawIndexed(PrepareForIndexedDraw<WGPURenderBundleEncoder>(Attribs.Flags, Attribs.IndexType));
+    else
+        EncodeDrawIndexed(PrepareForIndexedDraw<WGPURenderPassEncoder>(Attribs.Flags, Attribs.IndexType));
 }
 
 void DeviceContextWebGPUImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -440,17 +552,24 @@ void DeviceContextWebGPUImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& At
     if (Attribs.NumInstances == 0)
         return;
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
-    for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
-    {
-        const MultiDrawIndexedItem& Item = Attribs.pDrawItems[DrawIdx];
-        if (Item.NumIndices > 0)
-            wgpuRenderPassEncoderDrawIndexed(wgpuRenderCmdEncoder, Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
-    }
+    auto EncodeMultiDrawIndexed = [&Attribs](auto wgpuRenderCmdEncoder) {
+        for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
+        {
+            const MultiDrawIndexedItem& Item = Attribs.pDrawItems[DrawIdx];
+            if (Item.NumIndices > 0)
+                EncoderDrawIndexed(wgpuRenderCmdEncoder, Item.NumIndices, Attribs.NumInstances, Item.FirstIndexLocation, Item.BaseVertex, Attribs.FirstInstanceLocation);
+        }
+    };
+    if (IsDeferred())
+        EncodeMultiDrawIndexed(PrepareForIndexedDraw<WGPURenderBundleEncoder>(Attribs.Flags, Attribs.IndexType));
+    else
+        EncodeMultiDrawIndexed(PrepareForIndexedDraw<WGPURenderPassEncoder>(Attribs.Flags, Attribs.IndexType));
 }
 
 void DeviceContextWebGPUImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndirect(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -459,19 +578,26 @@ void DeviceContextWebGPUImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
         ClassPtrCast<BufferWebGPUImpl>(Attribs.pAttribsBuffer)->DvpVerifyDynamicAllocation(this);
 #endif
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForDraw(Attribs.Flags);
-    Uint64                IndirectBufferOffset = Attribs.DrawArgsOffset;
-    WGPUBuffer            wgpuIndirectBuffer   = PrepareForIndirectCommand(Attribs.pAttribsBuffer, IndirectBufferOffset);
+    auto EncodeDrawIndirect = [&](auto wgpuRenderCmdEncoder) {
+        Uint64     IndirectBufferOffset = Attribs.DrawArgsOffset;
+        WGPUBuffer wgpuIndirectBuffer   = PrepareForIndirectCommand(Attribs.pAttribsBuffer, IndirectBufferOffset);
 
-    for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
-    {
-        wgpuRenderPassEncoderDrawIndirect(wgpuRenderCmdEncoder, wgpuIndirectBuffer, IndirectBufferOffset);
-        IndirectBufferOffset += Attribs.DrawArgsStride;
-    }
+        for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
+        {
+            EncoderDrawIndirect(wgpuRenderCmdEncoder, wgpuIndirectBuffer, IndirectBufferOffset);
+            IndirectBufferOffset += Attribs.DrawArgsStride;
+        }
+    };
+    if (IsDeferred())
+        EncodeDrawIndirect(PrepareForDraw<WGPURenderBundleEncoder>(Attribs.Flags));
+    else
+        EncodeDrawIndirect(PrepareForDraw<WGPURenderPassEncoder>(Attribs.Flags));
 }
 
 void DeviceContextWebGPUImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -480,15 +606,20 @@ void DeviceContextWebGPUImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttri
         ClassPtrCast<BufferWebGPUImpl>(Attribs.pAttribsBuffer)->DvpVerifyDynamicAllocation(this);
 #endif
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
-    Uint64                IndirectBufferOffset = Attribs.DrawArgsOffset;
-    WGPUBuffer            wgpuIndirectBuffer   = PrepareForIndirectCommand(Attribs.pAttribsBuffer, IndirectBufferOffset);
+    auto EncodeDrawIndexedIndirect = [&](auto wgpuRenderCmdEncoder) {
+        Uint64     IndirectBufferOffset = Attribs.DrawArgsOffset;
+        WGPUBuffer wgpuIndirectBuffer   = PrepareForIndirectCommand(Attribs.pAttribsBuffer, IndirectBufferOffset);
 
-    for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
-    {
-        wgpuRenderPassEncoderDrawIndexedIndirect(wgpuRenderCmdEncoder, wgpuIndirectBuffer, IndirectBufferOffset);
-        IndirectBufferOffset += Attribs.DrawArgsStride;
-    }
+        for (Uint32 DrawIdx = 0; DrawIdx < Attribs.DrawCount; ++DrawIdx)
+        {
+            EncoderDrawIndexedIndirect(wgpuRenderCmdEncoder, wgpuIndirectBuffer, IndirectBufferOffset);
+            IndirectBufferOffset += Attribs.DrawArgsStride;
+        }
+    };
+    if (IsDeferred())
+        EncodeDrawIndexedIndirect(PrepareForIndexedDraw<WGPURenderBundleEncoder>(Attribs.Flags, Attribs.IndexType));
+    else
+        EncodeDrawIndexedIndirect(PrepareForIndexedDraw<WGPURenderPassEncoder>(Attribs.Flags, Attribs.IndexType));
 }
 
 void DeviceContextWebGPUImpl::DrawMesh(const DrawMeshAttribs& Attribs)
@@ -503,6 +634,8 @@ void DeviceContextWebGPUImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& At
 
 void DeviceContextWebGPUImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -518,6 +651,8 @@ void DeviceContextWebGPUImpl::DispatchCompute(const DispatchComputeAttribs& Attr
 
 void DeviceContextWebGPUImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Draw);
+
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -541,6 +676,12 @@ void DeviceContextWebGPUImpl::ClearDepthStencil(ITextureView*                  p
 {
     TDeviceContextBase::ClearDepthStencil(pView);
 
+    if (IsDeferred())
+    {
+        DEV_ERROR("Render targets can't be cleared in a render bundle");
+        return;
+    }
+
     if (pView != m_pBoundDepthStencil)
     {
         LOG_ERROR_MESSAGE("Depth stencil buffer must be bound to the context to be cleared in WebGPU backend");
@@ -565,6 +706,12 @@ void DeviceContextWebGPUImpl::ClearRenderTarget(ITextureView*                  p
 {
     TDeviceContextBase::ClearRenderTarget(pView);
 
+    if (IsDeferred())
+    {
+        DEV_ERROR("Render targets can't be cleared in a render bundle");
+        return;
+    }
+
     static constexpr float Zero[4] = {0.f, 0.f, 0.f, 0.f};
     if (RGBA == nullptr)
         RGBA = Zero;
@@ -591,6 +738,44 @@ void DeviceContextWebGPUImpl::ClearRenderTarget(ITextureView*                  p
         m_PendingClears.SetColor(RTIndex, static_cast<const float*>(RGBA));
 }
 
+void DeviceContextWebGPUImpl::InvalidateAttachments(Uint32               NumViews,
+                                                    ITextureView* const* ppViews)
+{
+    TDeviceContextBase::InvalidateAttachments(NumViews, ppViews, 0);
+
+    // The contents of the running render pass can't be discarded
+    if (IsDeferred() || m_wgpuRenderPassEncoder)
+        return;
+
+    // WebGPU has no load operation that leaves the contents undefined, so invalidated attachments
+    // are cleared instead, which is as cheap as not loading them on tile-based GPUs.
+    static constexpr float Zero[4] = {0.f, 0.f, 0.f, 0.f};
+    for (Uint32 i = 0; i < NumViews; ++i)
+    {
+        if (ppViews[i] == nullptr)
+            continue;
+
+        if (ppViews[i] == m_pBoundDepthStencil)
+        {
+            if (!m_PendingClears.DepthPending())
+                m_PendingClears.SetDepth(0);
+            if (!m_PendingClears.StencilPending())
+                m_PendingClears.SetStencil(0);
+            continue;
+        }
+
+        for (Uint32 RTIndex = 0; RTIndex < m_NumBoundRenderTargets; ++RTIndex)
+        {
+            if (m_pBoundRenderTargets[RTIndex] == ppViews[i])
+            {
+                if (!m_PendingClears.ColorPending(RTIndex))
+                    m_PendingClears.SetColor(RTIndex, Zero);
+                break;
+            }
+        }
+    }
+}
+
 void DeviceContextWebGPUImpl::UpdateBuffer(IBuffer*                       pBuffer,
                                            Uint64                         Offset,
                                            Uint64                         Size,
@@ -705,6 +890,8 @@ void DeviceContextWebGPUImpl::MapBuffer(IBuffer*  pBuffer,
                                         MAP_FLAGS MapFlags,
                                         PVoid&    pMappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
 
     BufferWebGPUImpl* const pBufferWebGPU = ClassPtrCast<BufferWebGPUImpl>(pBuffer);
@@ -772,6 +959,8 @@ void DeviceContextWebGPUImpl::MapBuffer(IBuffer*  pBuffer,
 
 void DeviceContextWebGPUImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
 
     BufferWebGPUImpl* const pBufferWebGPU = ClassPtrCast<BufferWebGPUImpl>(pBuffer);
@@ -1107,6 +1296,8 @@ void DeviceContextWebGPUImpl::MapTextureSubresource(ITexture*                 pT
                                                     const Box*                pMapRegion,
                                                     MappedTextureSubresource& MappedData)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
 
     EndCommandEncoders();
@@ -1191,6 +1382,8 @@ void DeviceContextWebGPUImpl::MapTextureSubresource(ITexture*                 pT
 
 void DeviceContextWebGPUImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Map);
+
     TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
 
     EndCommandEncoders();
@@ -1253,12 +1446,47 @@ void DeviceContextWebGPUImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32
 
 void DeviceContextWebGPUImpl::FinishCommandList(ICommandList** ppCommandList)
 {
-    LOG_ERROR("Deferred contexts are not supported in WebGPU");
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
+    DEV_CHECK_ERR(m_wgpuRenderBundleEncoder != nullptr, "There is no render bundle being recorded. Call IDeviceContextWebGPU::BeginRenderBundle() first.");
+
+    WGPURenderBundleDescriptor wgpuRenderBundleDesc{};
+    WebGPURenderBundleWrapper  wgpuRenderBundle{wgpuRenderBundleEncoderFinish(m_wgpuRenderBundleEncoder, &wgpuRenderBundleDesc)};
+    DEV_CHECK_ERR(wgpuRenderBundle != nullptr, "Failed to finish render bundle encoder");
+    m_wgpuRenderBundleEncoder.Reset(nullptr);
+    m_DebugGroupsStack.clear();
+
+    CommandListWebGPUImpl* pCmdListWebGPU{NEW_RC_OBJ(m_CmdListAllocator, "CommandListWebGPUImpl instance", CommandListWebGPUImpl)(m_pDevice, this, std::move(wgpuRenderBundle))};
+    pCmdListWebGPU->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    InvalidateState();
+    TDeviceContextBase::FinishCommandList();
 }
 
 void DeviceContextWebGPUImpl::ExecuteCommandLists(Uint32 NumCommandLists, ICommandList* const* ppCommandLists)
 {
-    LOG_ERROR("Deferred contexts are not supported in WebGPU");
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    std::vector<WGPURenderBundle> wgpuRenderBundles(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        const CommandListWebGPUImpl* pCmdListWebGPU = ClassPtrCast<CommandListWebGPUImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListWebGPU != nullptr, "Command list at index ", i, " is null");
+        wgpuRenderBundles[i] = pCmdListWebGPU->GetWebGPURenderBundle();
+    }
+
+    // Render bundles are executed in the render pass defined by the currently bound render targets
+    wgpuRenderPassEncoderExecuteBundles(GetRenderPassCommandEncoder(), NumCommandLists, wgpuRenderBundles.data());
+
+    // Executing render bundles resets the pipeline, bind groups, vertex and index buffers of the render pass.
+    // Viewports, scissor rects, blend constant and stencil reference are preserved, but are reset
+    // along with the rest of the encoder state for simplicity.
+    ClearEncoderState();
 }
 
 void DeviceContextWebGPUImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
@@ -1380,8 +1608,29 @@ void DeviceContextWebGPUImpl::EndQuery(IQuery* pQuery)
     }
 }
 
+void DeviceContextWebGPUImpl::ResolveQueries(IQuery* const*                 ppQueries,
+                                             Uint32                         NumQueries,
+                                             IBuffer*                       pDstBuffer,
+                                             Uint64                         DstOffset,
+                                             RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    UNSUPPORTED("ResolveQueries is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::BeginConditionalRendering(const BeginConditionalRenderingAttribs& Attribs)
+{
+    UNSUPPORTED("Conditional rendering is not supported in WebGPU");
+}
+
+void DeviceContextWebGPUImpl::EndConditionalRendering()
+{
+    UNSUPPORTED("Conditional rendering is not supported in WebGPU");
+}
+
 void DeviceContextWebGPUImpl::Flush()
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Submit);
+
     EnqueueSignal(m_pFence, ++m_FenceValue);
     EndCommandEncoders();
 
@@ -1401,9 +1650,7 @@ void DeviceContextWebGPUImpl::Flush()
     for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
     {
         MemPage.FlushWrites(m_wgpuQueue);
-        MemPage.Recycle();
     }
-    m_UploadMemPages.clear();
 
     if (m_wgpuCommandEncoder || !m_SignaledFences.empty())
     {
@@ -1444,6 +1691,14 @@ void DeviceContextWebGPUImpl::Flush()
         m_PendingStagingReads.clear();
     }
 
+    // Upload pages must be recycled after the submission as mapped pages are
+    // mapped again, and a buffer with a pending mapping can't be used in a submit.
+    for (UploadMemoryManagerWebGPU::Page& MemPage : m_UploadMemPages)
+    {
+        MemPage.Recycle();
+    }
+    m_UploadMemPages.clear();
+
     // Without DeviceTick(), the work done callback is never called
     m_pDevice->DeviceTick();
 }
@@ -1511,7 +1766,12 @@ void DeviceContextWebGPUImpl::BeginDebugGroup(const Char* Name, const float* pCo
     VERIFY(!(m_wgpuRenderPassEncoder && m_wgpuComputePassEncoder), "Another command encoder is currently active");
     TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
 
-    if (m_wgpuRenderPassEncoder)
+    if (IsDeferred())
+    {
+        wgpuRenderBundleEncoderPushDebugGroup(GetRenderBundleEncoder(), Name);
+        m_DebugGroupsStack.push_back(DEBUG_GROUP_TYPE_RENDER);
+    }
+    else if (m_wgpuRenderPassEncoder)
     {
         wgpuRenderPassEncoderPushDebugGroup(GetRenderPassCommandEncoder(), Name);
         m_DebugGroupsStack.push_back(DEBUG_GROUP_TYPE_RENDER);
@@ -1542,7 +1802,12 @@ void DeviceContextWebGPUImpl::EndDebugGroup()
     DEBUG_GROUP_TYPE DebugGroupType = m_DebugGroupsStack.back();
     m_DebugGroupsStack.pop_back();
 
-    if (m_wgpuRenderPassEncoder)
+    if (IsDeferred())
+    {
+        VERIFY_EXPR(DebugGroupType == DEBUG_GROUP_TYPE_RENDER);
+        wgpuRenderBundleEncoderPopDebugGroup(GetRenderBundleEncoder());
+    }
+    else if (m_wgpuRenderPassEncoder)
     {
         if (DebugGroupType == DEBUG_GROUP_TYPE_RENDER)
             wgpuRenderPassEncoderPopDebugGroup(GetRenderPassCommandEncoder());
@@ -1570,7 +1835,9 @@ void DeviceContextWebGPUImpl::InsertDebugLabel(const Char* Label, const float* p
     VERIFY(!(m_wgpuRenderPassEncoder && m_wgpuComputePassEncoder), "Another command encoder is currently active");
     TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
 
-    if (m_wgpuRenderPassEncoder)
+    if (IsDeferred())
+        wgpuRenderBundleEncoderInsertDebugMarker(GetRenderBundleEncoder(), Label);
+    else if (m_wgpuRenderPassEncoder)
         wgpuRenderPassEncoderInsertDebugMarker(GetRenderPassCommandEncoder(), Label);
     else if (m_wgpuComputePassEncoder)
         wgpuComputePassEncoderInsertDebugMarker(GetComputePassCommandEncoder(), Label);
@@ -1622,6 +1889,8 @@ void DeviceContextWebGPUImpl::ResolveTextureSubresource(ITexture*
                                                         ITexture*                               pDstTexture,
                                                         const ResolveTextureSubresourceAttribs& ResolveAttribs)
 {
+    DILIGENT_CONTEXT_CPU_TIME_SCOPE(Transition);
+
     TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -1667,6 +1936,7 @@ WGPUQueue DeviceContextWebGPUImpl::GetWebGPUQueue()
 
 WGPUCommandEncoder DeviceContextWebGPUImpl::GetCommandEncoder()
 {
+    DEV_CHECK_ERR(!IsDeferred(), "Only draw commands and the state they use can be recorded into a render bundle by a deferred context");
     if (!m_wgpuCommandEncoder)
     {
         WGPUCommandEncoderDescriptor wgpuCommandEncoderDesc{};
@@ -1688,6 +1958,12 @@ WGPURenderPassEncoder DeviceContextWebGPUImpl::GetRenderPassCommandEncoder()
     return m_wgpuRenderPassEncoder;
 }
 
+WGPURenderBundleEncoder DeviceContextWebGPUImpl::GetRenderBundleEncoder()
+{
+    DEV_CHECK_ERR(m_wgpuRenderBundleEncoder != nullptr, "There is no render bundle being recorded. Call IDeviceContextWebGPU::BeginRenderBundle() first.");
+    return m_wgpuRenderBundleEncoder;
+}
+
 WGPUComputePassEncoder DeviceContextWebGPUImpl::GetComputePassCommandEncoder()
 {
     if (!m_wgpuComputePassEncoder)
@@ -1763,8 +2039,10 @@ void DeviceContextWebGPUImpl::CommitRenderTargets()
         {
             const auto& ClearColor = m_PendingClears.Colors[RTIndex];
 
+            const bool IsTransient = (pRTV->GetTexture()->GetDesc().MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT) != 0;
+
             wgpuRenderPassColorAttachments[RTIndex].view       = pRTV->GetWebGPUTextureView();
-            wgpuRenderPassColorAttachments[RTIndex].storeOp    = WGPUStoreOp_Store;
+            wgpuRenderPassColorAttachments[RTIndex].storeOp    = IsTransient ? WGPUStoreOp_Discard : WGPUStoreOp_Store;
             wgpuRenderPassColorAttachments[RTIndex].loadOp     = m_PendingClears.ColorPending(RTIndex) ? WGPULoadOp_Clear : WGPULoadOp_Load;
             wgpuRenderPassColorAttachments[RTIndex].clearValue = WGPUColor{ClearColor[0], ClearColor[1], ClearColor[2], ClearColor[3]};
             wgpuRenderPassColorAttachments[RTIndex].depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
@@ -1777,16 +2055,19 @@ void DeviceContextWebGPUImpl::CommitRenderTargets()
     if (m_pBoundDepthStencil)
     {
         const auto& FormatAttribs = GetTextureFormatAttribs(m_pBoundDepthStencil->GetDesc().Format);
+        const auto  StoreOp       = (m_pBoundDepthStencil->GetTexture()->GetDesc().MiscFlags & MISC_TEXTURE_FLAG_TRANSIENT_ATTACHMENT) != 0 ?
+            WGPUStoreOp_Discard :
+            WGPUStoreOp_Store;
 
         wgpuRenderPassDepthStencilAttachment.view            = m_pBoundDepthStencil->GetWebGPUTextureView();
         wgpuRenderPassDepthStencilAttachment.depthLoadOp     = m_PendingClears.DepthPending() ? WGPULoadOp_Clear : WGPULoadOp_Load;
-        wgpuRenderPassDepthStencilAttachment.depthStoreOp    = WGPUStoreOp_Store;
+        wgpuRenderPassDepthStencilAttachment.depthStoreOp    = StoreOp;
         wgpuRenderPassDepthStencilAttachment.depthClearValue = m_PendingClears.Depth;
 
         if (FormatAttribs.ComponentType == COMPONENT_TYPE_DEPTH_STENCIL)
         {
             wgpuRenderPassDepthStencilAttachment.stencilLoadOp     = m_PendingClears.StencilPending() ? WGPULoadOp_Clear : WGPULoadOp_Load;
-            wgpuRenderPassDepthStencilAttachment.stencilStoreOp    = WGPUStoreOp_Store;
+            wgpuRenderPassDepthStencilAttachment.stencilStoreOp    = StoreOp;
             wgpuRenderPassDepthStencilAttachment.stencilClearValue = m_PendingClears.Stencil;
         }
 
@@ -1988,7 +2269,8 @@ void DeviceContextWebGPUImpl::ClearAttachment(Int32                     RTIndex,
     m_EncoderState.Invalidate(WebGPUEncoderState::CMD_ENCODER_STATE_PIPELINE_STATE);
 }
 
-WGPURenderPassEncoder DeviceContextWebGPUImpl::PrepareForDraw(DRAW_FLAGS Flags)
+template <typename CmdEncoderType>
+CmdEncoderType DeviceContextWebGPUImpl::PrepareForDraw(DRAW_FLAGS Flags)
 {
 #ifdef DILIGENT_DEVELOPMENT
     if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
@@ -1996,7 +2278,13 @@ WGPURenderPassEncoder DeviceContextWebGPUImpl::PrepareForDraw(DRAW_FLAGS Flags)
 #endif
     DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = GetRenderPassCommandEncoder();
+    constexpr bool IsRenderBundle = std::is_same_v<CmdEncoderType, WGPURenderBundleEncoder>;
+
+    CmdEncoderType wgpuRenderCmdEncoder = nullptr;
+    if constexpr (IsRenderBundle)
+        wgpuRenderCmdEncoder = GetRenderBundleEncoder();
+    else
+        wgpuRenderCmdEncoder = GetRenderPassCommandEncoder();
 
     // Handle pipeline state first because CommitGraphicsPSO may update another flags
     if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_PIPELINE_STATE))
@@ -2005,28 +2293,33 @@ WGPURenderPassEncoder DeviceContextWebGPUImpl::PrepareForDraw(DRAW_FLAGS Flags)
     if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_VERTEX_BUFFERS) || (m_EncoderState.HasDynamicVertexBuffers && (Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT) == 0))
         CommitVertexBuffers(wgpuRenderCmdEncoder);
 
-    if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_VIEWPORTS))
-        CommitViewports(wgpuRenderCmdEncoder);
-
-    if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_SCISSOR_RECTS))
-        CommitScissorRects(wgpuRenderCmdEncoder);
-
-    if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_BLEND_FACTORS))
+    // Render bundles inherit viewports, scissor rects, blend constant and stencil reference
+    // from the render pass they are executed in.
+    if constexpr (!IsRenderBundle)
     {
-        WGPUColor wgpuBlendColor;
-        wgpuBlendColor.r = m_BlendFactors[0];
-        wgpuBlendColor.g = m_BlendFactors[1];
-        wgpuBlendColor.b = m_BlendFactors[2];
-        wgpuBlendColor.a = m_BlendFactors[3];
+        if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_VIEWPORTS))
+            CommitViewports(wgpuRenderCmdEncoder);
 
-        wgpuRenderPassEncoderSetBlendConstant(wgpuRenderCmdEncoder, &wgpuBlendColor);
-        m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_BLEND_FACTORS);
-    }
+        if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_SCISSOR_RECTS))
+            CommitScissorRects(wgpuRenderCmdEncoder);
 
-    if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_STENCIL_REF))
-    {
-        wgpuRenderPassEncoderSetStencilReference(wgpuRenderCmdEncoder, m_StencilRef);
-        m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_STENCIL_REF);
+        if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_BLEND_FACTORS))
+        {
+            WGPUColor wgpuBlendColor;
+            wgpuBlendColor.r = m_BlendFactors[0];
+            wgpuBlendColor.g = m_BlendFactors[1];
+            wgpuBlendColor.b = m_BlendFactors[2];
+            wgpuBlendColor.a = m_BlendFactors[3];
+
+            wgpuRenderPassEncoderSetBlendConstant(wgpuRenderCmdEncoder, &wgpuBlendColor);
+            m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_BLEND_FACTORS);
+        }
+
+        if (!m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_STENCIL_REF))
+        {
+            wgpuRenderPassEncoderSetStencilReference(wgpuRenderCmdEncoder, m_StencilRef);
+            m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_STENCIL_REF);
+        }
     }
 
     if (auto CommitSRBMask = m_BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
@@ -2035,11 +2328,12 @@ WGPURenderPassEncoder DeviceContextWebGPUImpl::PrepareForDraw(DRAW_FLAGS Flags)
     return wgpuRenderCmdEncoder;
 }
 
-WGPURenderPassEncoder DeviceContextWebGPUImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
+template <typename CmdEncoderType>
+CmdEncoderType DeviceContextWebGPUImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pPipelineState != nullptr, "No PSO is bound in the context");
 
-    WGPURenderPassEncoder wgpuRenderCmdEncoder = PrepareForDraw(Flags);
+    CmdEncoderType wgpuRenderCmdEncoder = PrepareForDraw<CmdEncoderType>(Flags);
 
     if (!m_EncoderState.IsUpToDate((WebGPUEncoderState::CMD_ENCODER_STATE_INDEX_BUFFER)))
         CommitIndexBuffer(wgpuRenderCmdEncoder, IndexType);
@@ -2081,13 +2375,14 @@ WGPUBuffer DeviceContextWebGPUImpl::PrepareForIndirectCommand(IBuffer* pAttribsB
     return wgpuIndirectBuffer;
 }
 
-void DeviceContextWebGPUImpl::CommitGraphicsPSO(WGPURenderPassEncoder CmdEncoder)
+template <typename CmdEncoderType>
+void DeviceContextWebGPUImpl::CommitGraphicsPSO(CmdEncoderType CmdEncoder)
 {
     DEV_CHECK_ERR(m_pPipelineState, "No pipeline state to commit!");
     DEV_CHECK_ERR(m_pPipelineState->GetDesc().PipelineType == PIPELINE_TYPE_GRAPHICS, "Current PSO is not a graphics pipeline");
 
     WGPURenderPipeline wgpuPipeline = m_pPipelineState->GetWebGPURenderPipeline();
-    wgpuRenderPassEncoderSetPipeline(CmdEncoder, wgpuPipeline);
+    EncoderSetPipeline(CmdEncoder, wgpuPipeline);
 
     const auto& GraphicsPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
     const auto& BlendDesc        = GraphicsPipeline.BlendDesc;
@@ -2122,7 +2417,8 @@ void DeviceContextWebGPUImpl::CommitComputePSO(WGPUComputePassEncoder CmdEncoder
     m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_PIPELINE_STATE);
 }
 
-void DeviceContextWebGPUImpl::CommitVertexBuffers(WGPURenderPassEncoder CmdEncoder)
+template <typename CmdEncoderType>
+void DeviceContextWebGPUImpl::CommitVertexBuffers(CmdEncoderType CmdEncoder)
 {
     DEV_CHECK_ERR(m_pPipelineState, "No pipeline state to commit!");
 
@@ -2158,7 +2454,7 @@ void DeviceContextWebGPUImpl::CommitVertexBuffers(WGPURenderPassEncoder CmdEncod
         if (m_EncoderState.VertexBufferOffsets[SlotIdx] != Offset || !m_EncoderState.IsUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_VERTEX_BUFFERS))
         {
             // Do NOT use WGPU_WHOLE_SIZE due to https://github.com/emscripten-core/emscripten/issues/20538
-            wgpuRenderPassEncoderSetVertexBuffer(CmdEncoder, SlotIdx, wgpuBuffer, Offset, Size);
+            EncoderSetVertexBuffer(CmdEncoder, SlotIdx, wgpuBuffer, Offset, Size);
             m_EncoderState.VertexBufferOffsets[SlotIdx] = Offset;
         }
     }
@@ -2166,7 +2462,8 @@ void DeviceContextWebGPUImpl::CommitVertexBuffers(WGPURenderPassEncoder CmdEncod
     m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_VERTEX_BUFFERS);
 }
 
-void DeviceContextWebGPUImpl::CommitIndexBuffer(WGPURenderPassEncoder CmdEncoder, VALUE_TYPE IndexType)
+template <typename CmdEncoderType>
+void DeviceContextWebGPUImpl::CommitIndexBuffer(CmdEncoderType CmdEncoder, VALUE_TYPE IndexType)
 {
     DEV_CHECK_ERR(m_pPipelineState, "No pipeline state to commit!");
     DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
@@ -2176,7 +2473,7 @@ void DeviceContextWebGPUImpl::CommitIndexBuffer(WGPURenderPassEncoder CmdEncoder
     // Do NOT use WGPU_WHOLE_SIZE due to https://github.com/emscripten-core/emscripten/issues/20538
     VERIFY_EXPR(IndexBuffDesc.Size >= m_IndexDataStartOffset);
     const Uint64 Size = IndexBuffDesc.Size - m_IndexDataStartOffset;
-    wgpuRenderPassEncoderSetIndexBuffer(CmdEncoder, m_pIndexBuffer->GetWebGPUBuffer(), IndexTypeToWGPUIndexFormat(IndexType), Offset, Size);
+    EncoderSetIndexBuffer(CmdEncoder, m_pIndexBuffer->GetWebGPUBuffer(), IndexTypeToWGPUIndexFormat(IndexType), Offset, Size);
     if (IndexBuffDesc.Usage != USAGE_DYNAMIC)
         m_EncoderState.SetUpToDate(WebGPUEncoderState::CMD_ENCODER_STATE_INDEX_BUFFER);
 }
@@ -2291,6 +2588,8 @@ UploadMemoryManagerWebGPU::Allocation DeviceContextWebGPUImpl::AllocateUploadMem
 
 DynamicMemoryManagerWebGPU::Allocation DeviceContextWebGPUImpl::AllocateDynamicMemory(size_t Size, size_t Alignment)
 {
+    // Dynamic memory pages are flushed by the immediate context, and render bundles may be executed many times
+    DEV_CHECK_ERR(!IsDeferred(), "Dynamic buffers can't be used in render bundles");
     DynamicMemoryManagerWebGPU::Allocation Alloc;
     if (!m_DynamicMemPages.empty())
         Alloc = m_DynamicMemPages.back().Allocate(Size, Alignment);
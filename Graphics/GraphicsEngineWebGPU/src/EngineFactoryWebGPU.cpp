@@ -375,7 +375,7 @@ GraphicsAdapterInfo GetGraphicsAdapterInfo(WGPUAdapter wgpuAdapter, WGPUDevice w
         }
     }
 
-    ASSERT_SIZEOF(DeviceFeatures, 47, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+    ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
     WGPUSupportedLimits wgpuSupportedLimits{};
     if (wgpuAdapter)
@@ -493,14 +493,14 @@ void EngineFactoryWebGPUImpl::CreateDearchiver(const DearchiverCreateInfo& Creat
 
 void EngineFactoryWebGPUImpl::CreateDeviceAndContextsWebGPU(const EngineWebGPUCreateInfo& EngineCI,
                                                             IRenderDevice**               ppDevice,
-                                                            IDeviceContext**              ppImmediateContext)
+                                                            IDeviceContext**              ppContexts)
 {
-    DEV_CHECK_ERR(ppDevice && ppImmediateContext, "Null pointer provided");
-    if (!ppDevice || !ppImmediateContext)
+    DEV_CHECK_ERR(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
         return;
 
-    *ppDevice           = nullptr;
-    *ppImmediateContext = nullptr;
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (size_t{1} + size_t{EngineCI.NumDeferredContexts}));
 
     try
     {
@@ -521,7 +521,7 @@ void EngineFactoryWebGPUImpl::CreateDeviceAndContextsWebGPU(const EngineWebGPUCr
         }
 
         WebGPUDeviceWrapper Device = CreateDeviceForAdapter(EngineCI, wgpuInstance.Get(), SpecificAdapter.Get());
-        AttachToWebGPUDevice(wgpuInstance.Detach(), SpecificAdapter.Detach(), Device.Detach(), EngineCI, ppDevice, ppImmediateContext);
+        AttachToWebGPUDevice(wgpuInstance.Detach(), SpecificAdapter.Detach(), Device.Detach(), EngineCI, ppDevice, ppContexts);
     }
     catch (const std::runtime_error&)
     {
@@ -566,7 +566,7 @@ void EngineFactoryWebGPUImpl::AttachToWebGPUDevice(void*
                                                    void*                         wgpuDevice,
                                                    const EngineWebGPUCreateInfo& EngineCI,
                                                    IRenderDevice**               ppDevice,
-                                                   IDeviceContext**              ppImmediateContext)
+                                                   IDeviceContext**              ppContexts)
 {
     if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
     {
@@ -574,8 +574,8 @@ void EngineFactoryWebGPUImpl::AttachToWebGPUDevice(void*
         return;
     }
 
-    VERIFY(ppDevice && ppImmediateContext, "Null pointer provided");
-    if (!ppDevice || !ppImmediateContext)
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
         return;
 
     if (EngineCI.NumImmediateContexts > 1)
@@ -584,14 +584,8 @@ void EngineFactoryWebGPUImpl::AttachToWebGPUDevice(void*
         return;
     }
 
-    if (EngineCI.NumDeferredContexts > 0)
-    {
-        LOG_ERROR_MESSAGE("WebGPU backend doesn't support multiple deferred contexts");
-        return;
-    }
-
-    *ppDevice           = nullptr;
-    *ppImmediateContext = nullptr;
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (size_t{1} + size_t{EngineCI.NumDeferredContexts}));
 
     try
     {
@@ -616,8 +610,24 @@ void EngineFactoryWebGPUImpl::AttachToWebGPUDevice(void*
                     0,     // Context id
                     0      // Queue id
                 })};
-        pDeviceContextWebGPU->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppImmediateContext));
+        pDeviceContextWebGPU->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts));
         pRenderDeviceWebGPU->SetImmediateContext(0, pDeviceContextWebGPU);
+
+        // Deferred contexts record render bundles (see IDeviceContextWebGPU::BeginRenderBundle)
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            DeviceContextWebGPUImpl* pDeferredCtxWebGPU{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextWebGPUImpl instance", DeviceContextWebGPUImpl)(
+                    pRenderDeviceWebGPU, EngineCI,
+                    DeviceContextDesc{
+                        nullptr,
+                        COMMAND_QUEUE_TYPE_UNKNOWN,
+                        True,           // IsDeferred
+                        1 + DeferredCtx // Context id
+                    })};
+            pDeferredCtxWebGPU->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + 1 + DeferredCtx));
+            pRenderDeviceWebGPU->SetDeferredContext(DeferredCtx, pDeferredCtxWebGPU);
+        }
     }
     catch (const std::runtime_error&)
     {
@@ -627,10 +637,13 @@ void EngineFactoryWebGPUImpl::AttachToWebGPUDevice(void*
             *ppDevice = nullptr;
         }
 
-        if (*ppImmediateContext != nullptr)
+        for (Uint32 ctx = 0; ctx < 1 + EngineCI.NumDeferredContexts; ++ctx)
         {
-            (*ppImmediateContext)->Release();
-            *ppImmediateContext = nullptr;
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
         }
 
         LOG_ERROR("Failed to create WebGPU-based render device and context");
@@ -101,4 +101,9 @@ void FenceWebGPUImpl::AppendSyncPoints(const std::vector<RefCntAutoPtr<SyncPoint
     ProcessSyncPoints();
 }
 
+void FenceWebGPUImpl::RegisterCompletionCallback(Uint64 Value, FenceCompletionCallbackType Callback, void* pUserData)
+{
+    DEV_ERROR("RegisterCompletionCallback() is not supported in WebGPU backend");
+}
+
 } // namespace Diligent
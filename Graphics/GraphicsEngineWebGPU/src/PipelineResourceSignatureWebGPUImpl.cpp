@@ -663,6 +663,13 @@ void PipelineResourceSignatureWebGPUImpl::CreateBindGroupLayouts(const bool IsSe
 
     // Since WebGPU does not support multithreading, we can't create the bind group layouts
     // here as the signature may be created in a worker thread.
+
+    // Bind group caches do not use WebGPU objects and can be created right away
+    if (const Uint32 BindGroupCacheSize = GetDevice()->GetBindGroupCacheSize())
+    {
+        for (auto& pCache : m_BindGroupCaches)
+            pCache = std::make_unique<BindGroupCacheWebGPU>(BindGroupCacheSize, GetDevice()->GetBindGroupCacheStats());
+    }
 }
 
 WGPUBindGroupLayout PipelineResourceSignatureWebGPUImpl::GetWGPUBindGroupLayout(BIND_GROUP_ID GroupId)
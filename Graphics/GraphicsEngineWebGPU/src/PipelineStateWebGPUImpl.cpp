@@ -131,6 +131,9 @@ void PipelineStateWebGPUImpl::RemapOrVerifyShaderResources(
             pDvpShaderResources->emplace_back(pShaderResources);
 
         WGSLResourceMapping ResMapping;
+        // WGSL loaded from an archive or the render state cache has typically been remapped already.
+        // In this case, all bindings match and there is no need to run Tint again.
+        bool BindingsMatch = true;
 
         pShaderResources->ProcessResources(
             [&](const WGSLShaderResourceAttribs& WGSLAttribs, Uint32) //
@@ -205,13 +208,15 @@ void PipelineStateWebGPUImpl::RemapOrVerifyShaderResources(
                 else
                 {
                     ResMapping[WGSLAttribs.Name] = {BindGroup, ResourceBinding, ArraySize};
+                    if (WGSLAttribs.BindGroup != BindGroup || WGSLAttribs.BindIndex != ResourceBinding || WGSLAttribs.ArraySize != 1 || ArraySize != 1)
+                        BindingsMatch = false;
                 }
 
                 if (pDvpResourceAttibutions)
                     pDvpResourceAttibutions->emplace_back(ResAttribution);
             });
 
-        if (!bVerifyOnly)
+        if (!bVerifyOnly && !BindingsMatch)
         {
             PatchedWGSL = RamapWGSLResourceBindings(pShader->GetWGSL(), ResMapping, pShader->GetEmulatedArrayIndexSuffix());
         }
@@ -288,6 +293,7 @@ struct PipelineStateWebGPUImpl::AsyncPipelineBuilder : public ObjectBase<IObject
     void InitializePipelines(WGPUCreatePipelineAsyncStatus PipelineStatus,
                              WGPURenderPipeline            RenderPipeline,
                              WGPUComputePipeline           ComputePipeline,
+                             const char*                   PipelineType,
                              const char*                   Message)
     {
         VERIFY_EXPR(Status.load() == CallbackStatus::InProgress);
@@ -298,7 +304,7 @@ struct PipelineStateWebGPUImpl::AsyncPipelineBuilder : public ObjectBase<IObject
         }
         else
         {
-            LOG_ERROR_MESSAGE("Failed to create WebGPU render pipeline: ", Message);
+            LOG_ERROR_MESSAGE("Failed to create WebGPU ", PipelineType, " pipeline: ", Message != nullptr ? Message : "");
         }
         Status.store(CallbackStatus::Completed);
         Release();
@@ -306,7 +312,7 @@ struct PipelineStateWebGPUImpl::AsyncPipelineBuilder : public ObjectBase<IObject
 
     static void CreateRenderPipelineCallback(WGPUCreatePipelineAsyncStatus Status, WGPURenderPipeline Pipeline, const char* Message, void* pUserData)
     {
-        static_cast<AsyncPipelineBuilder*>(pUserData)->InitializePipelines(Status, Pipeline, nullptr, Message);
+        static_cast<AsyncPipelineBuilder*>(pUserData)->InitializePipelines(Status, Pipeline, nullptr, "render", Message);
     }
 
     static void CreateRenderPipelineCallback2(WGPUCreatePipelineAsyncStatus Status, WGPURenderPipeline Pipeline, const char* Message, void* pUserData1, void* pUserData2)
@@ -316,7 +322,7 @@ struct PipelineStateWebGPUImpl::AsyncPipelineBuilder : public ObjectBase<IObject
 
     static void CreateComputePipelineCallback(WGPUCreatePipelineAsyncStatus Status, WGPUComputePipeline Pipeline, const char* Message, void* pUserData)
     {
-        static_cast<AsyncPipelineBuilder*>(pUserData)->InitializePipelines(Status, nullptr, Pipeline, Message);
+        static_cast<AsyncPipelineBuilder*>(pUserData)->InitializePipelines(Status, nullptr, Pipeline, "compute", Message);
     }
 
     static void CreateComputePipelineCallback2(WGPUCreatePipelineAsyncStatus Status, WGPUComputePipeline Pipeline, const char* Message, void* pUserData1, void* pUserData2)
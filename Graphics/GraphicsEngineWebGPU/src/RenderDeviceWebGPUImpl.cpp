@@ -26,6 +26,8 @@
 
 #include "pch.h"
 
+#include <iomanip>
+
 #include "RenderDeviceWebGPUImpl.hpp"
 #include "DeviceContextWebGPUImpl.hpp"
 #include "RenderPassWebGPUImpl.hpp"
@@ -93,7 +95,8 @@ RenderDeviceWebGPUImpl::RenderDeviceWebGPUImpl(IReferenceCounters*           pRe
     },
     m_wgpuInstance(wgpuInstance),
     m_wgpuAdapter{wgpuAdapter},
-    m_wgpuDevice{wgpuDevice}
+    m_wgpuDevice{wgpuDevice},
+    m_BindGroupCacheSize{EngineCI.BindGroupCacheSize}
 // clang-format on
 {
     WGPUSupportedLimits wgpuSupportedLimits{};
@@ -108,7 +111,7 @@ RenderDeviceWebGPUImpl::RenderDeviceWebGPUImpl(IReferenceCounters*           pRe
 
     m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
 
-    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize);
+    m_pUploadMemoryManager  = std::make_unique<UploadMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.UploadHeapPageSize, EngineCI.UseMappedUploadPages);
     m_pDynamicMemoryManager = std::make_unique<DynamicMemoryManagerWebGPU>(m_wgpuDevice, EngineCI.DynamicHeapPageSize, EngineCI.DynamicHeapSize);
     m_pAttachmentCleaner    = std::make_unique<AttachmentCleanerWebGPU>(*this);
     m_pMipsGenerator        = std::make_unique<GenerateMipsHelperWebGPU>(*this);
@@ -129,6 +132,18 @@ RenderDeviceWebGPUImpl::~RenderDeviceWebGPUImpl()
 #if !PLATFORM_EMSCRIPTEN
     IdleGPU();
 #endif
+
+    if (m_BindGroupCacheSize > 0)
+    {
+        const Uint64 NumHits   = m_BindGroupCacheStats.NumHits.load();
+        const Uint64 NumMisses = m_BindGroupCacheStats.NumMisses.load();
+        LOG_INFO_MESSAGE("Bind group cache stats:\n"
+                         "                       Hits: ",
+                         NumHits, ". Misses: ", NumMisses,
+                         ". Hit rate: ", std::fixed, std::setprecision(1),
+                         static_cast<double>(NumHits) / static_cast<double>(std::max(NumHits + NumMisses, Uint64{1})) * 100.0, '%',
+                         ". Evictions: ", m_BindGroupCacheStats.NumEvictions.load());
+    }
 }
 
 void RenderDeviceWebGPUImpl::CreateBuffer(const BufferDesc& BuffDesc,
@@ -165,7 +180,11 @@ void RenderDeviceWebGPUImpl::CreateSampler(const SamplerDesc& SamplerDesc,
                                            ISampler**         ppSampler,
                                            bool               IsDeviceInternal)
 {
-    CreateSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
+    // Device-internal samplers are never shared with the application (see CreateUnsharedSamplerImpl).
+    if (IsDeviceInternal)
+        CreateUnsharedSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
+    else
+        CreateSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
 }
 
 void RenderDeviceWebGPUImpl::CreateSampler(const SamplerDesc& SamplerDesc,
@@ -304,6 +323,24 @@ void RenderDeviceWebGPUImpl::IdleGPU()
 #endif
 }
 
+Bool RenderDeviceWebGPUImpl::WaitForFences(IFence* const* ppFences,
+                                           const Uint64*  pValues,
+                                           Uint32         NumFences,
+                                           Bool           WaitAll,
+                                           Uint64         Timeout)
+{
+    DvpVerifyWaitForFencesArguments(ppFences, pValues, NumFences);
+#if PLATFORM_EMSCRIPTEN
+    if (Timeout != 0)
+    {
+        LOG_ERROR_MESSAGE("IRenderDevice::WaitForFences() with non-zero timeout is not supported on the Web. Use non-blocking synchronization methods.");
+        Timeout = 0;
+    }
+#endif
+    // Fences are only updated when the device is ticked, so tick it instead of sleeping
+    return PollFences(ppFences, pValues, NumFences, WaitAll, Timeout, [this]() { DeviceTick(); }) ? True : False;
+}
+
 void RenderDeviceWebGPUImpl::CreateTextureFromWebGPUTexture(WGPUTexture        wgpuTexture,
                                                             const TextureDesc& TexDesc,
                                                             RESOURCE_STATE     InitialState,
@@ -456,10 +456,29 @@ void ShaderResourceCacheWebGPU::SetDynamicBufferOffset(Uint32 BindGroupIndex,
     DstRes.BufferDynamicOffset = DynamicBufferOffset;
 }
 
-WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(WGPUDevice wgpuDevice, Uint32 GroupIndex, WGPUBindGroupLayout wgpuGroupLayout)
+WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(WGPUDevice            wgpuDevice,
+                                                         Uint32                GroupIndex,
+                                                         WGPUBindGroupLayout   wgpuGroupLayout,
+                                                         BindGroupCacheWebGPU* pBindGroupCache)
 {
     BindGroup& Group = GetBindGroup(GroupIndex);
-    if (!Group.m_wgpuBindGroup || Group.m_IsDirty)
+    if (pBindGroupCache != nullptr)
+    {
+        if (Group.m_pCachedBindGroup == nullptr || Group.m_IsDirty)
+        {
+            // Reference the new bind group before releasing the old one so that the cache
+            // does not evict it if both are the same.
+            BindGroupCacheWebGPU::CachedBindGroup* pCachedBindGroup =
+                pBindGroupCache->GetBindGroup(wgpuDevice, wgpuGroupLayout, Group.m_wgpuEntries, Group.m_NumResources);
+            Group.ReleaseCachedBindGroup();
+            Group.m_wgpuBindGroup.Reset();
+            Group.m_pBindGroupCache  = pBindGroupCache;
+            Group.m_pCachedBindGroup = pCachedBindGroup;
+            Group.m_IsDirty          = false;
+        }
+        VERIFY(Group.m_pBindGroupCache == pBindGroupCache, "Bind group cache must not change");
+    }
+    else if (!Group.m_wgpuBindGroup || Group.m_IsDirty)
     {
         WGPUBindGroupDescriptor wgpuBindGroupDescriptor;
         wgpuBindGroupDescriptor.nextInChain = nullptr;
@@ -472,7 +491,7 @@ WGPUBindGroup ShaderResourceCacheWebGPU::UpdateBindGroup(WGPUDevice wgpuDevice,
         Group.m_IsDirty = false;
     }
 
-    return Group.m_wgpuBindGroup;
+    return Group.GetWGPUBindGroup();
 }
 
 bool ShaderResourceCacheWebGPU::GetDynamicBufferOffsets(DeviceContextIndex     CtxId,
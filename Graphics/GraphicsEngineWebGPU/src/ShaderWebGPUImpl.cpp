@@ -34,6 +34,7 @@
 #include "HLSLUtils.hpp"
 #include "HLSLParsingTools.hpp"
 #include "SPIRVUtils.hpp"
+#include "Timer.hpp"
 
 #if !DILIGENT_NO_GLSLANG
 #    include "GLSLangUtils.hpp"
@@ -154,6 +155,17 @@ std::vector<uint32_t> CompileShaderToSPIRV(const ShaderCreateInfo&             S
     return SPIRV;
 }
 
+bool IsSPIRVByteCode(const void* pByteCode, size_t Size)
+{
+    constexpr uint32_t SPIRVMagicNumber = 0x07230203;
+
+    uint32_t FirstWord = 0;
+    if (Size < sizeof(FirstWord))
+        return false;
+    memcpy(&FirstWord, pByteCode, sizeof(FirstWord));
+    return FirstWord == SPIRVMagicNumber;
+}
+
 } // namespace
 
 void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
@@ -185,7 +197,9 @@ void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
         if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
         {
             DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
+            Timer CompileTimer;
             SPIRV = CompileShaderToSPIRV(ShaderCI, WebGPUShaderCI);
+            m_CompileTime.store(CompileTimer.GetElapsedTime());
             if (SPIRV.empty())
             {
                 LOG_ERROR_AND_THROW("Failed to compile shader '", m_Desc.Name, '\'');
@@ -194,19 +208,34 @@ void ShaderWebGPUImpl::Initialize(const ShaderCreateInfo& ShaderCI,
         else if (ShaderCI.ByteCode != nullptr)
         {
             DEV_CHECK_ERR(ShaderCI.ByteCodeSize != 0, "ByteCodeSize must not be 0");
-            DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
-            SPIRV.resize(ShaderCI.ByteCodeSize / 4);
-            memcpy(SPIRV.data(), ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+            if (IsSPIRVByteCode(ShaderCI.ByteCode, ShaderCI.ByteCodeSize))
+            {
+                DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
+                SPIRV.resize(ShaderCI.ByteCodeSize / 4);
+                memcpy(SPIRV.data(), ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+            }
+            else
+            {
+                // The byte code is the WGSL returned by GetBytecode() (e.g. stored in the bytecode cache).
+                // Use it as is to avoid converting the shader with Tint again.
+                m_WGSL.assign(static_cast<const char*>(ShaderCI.ByteCode), StaticCast<size_t>(ShaderCI.ByteCodeSize));
+                ParsedSourceLanguage = ParseShaderSourceLanguageDefinition(m_WGSL);
+                if (ParsedSourceLanguage != SHADER_SOURCE_LANGUAGE_DEFAULT)
+                    SourceLanguage = ParsedSourceLanguage;
+            }
         }
         else
         {
             LOG_ERROR_AND_THROW("Shader source must be provided through one of the 'Source', 'FilePath' or 'ByteCode' members");
         }
 
-        m_WGSL = ConvertSPIRVtoWGSL(SPIRV);
-        if (m_WGSL.empty())
+        if (!SPIRV.empty())
         {
-            LOG_ERROR_AND_THROW("Failed to convert SPIRV to WGSL for shader '", m_Desc.Name, '\'');
+            m_WGSL = ConvertSPIRVtoWGSL(SPIRV);
+            if (m_WGSL.empty())
+            {
+                LOG_ERROR_AND_THROW("Failed to convert SPIRV to WGSL for shader '", m_Desc.Name, '\'');
+            }
         }
     }
     else
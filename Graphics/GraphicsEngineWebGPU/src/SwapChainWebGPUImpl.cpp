@@ -325,6 +325,8 @@ public:
         wgpuQueueSubmit(pDeviceContext->GetWebGPUQueue(), 1, &wgpuCmdBuffer.Get());
 
 #if PLATFORM_EMSCRIPTEN
+        // The frame is presented when the thread that owns the canvas returns to the browser event loop.
+        // This may be a worker thread that the canvas has been transferred to as an OffscreenCanvas.
         emscripten_request_animation_frame([](double Time, void* pUserData) -> EM_BOOL { return EM_FALSE; }, nullptr);
 #else
         wgpuSurfacePresent(pSwapChain->GetWebGPUSurface());
@@ -412,7 +414,23 @@ void SwapChainWebGPUImpl::Resize(Uint32            NewWidth,
                                  SURFACE_TRANSFORM NewPreTransform)
 {
     if (TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
+    {
+#if PLATFORM_EMSCRIPTEN
+        // The size of an OffscreenCanvas can only be changed by the thread that owns it, so the
+        // application cannot resize it from the main thread when rendering happens in a worker.
+        // For a canvas owned by the main thread, the call is proxied.
+        int32_t CanvasWidth  = 0;
+        int32_t CanvasHeight = 0;
+        emscripten_get_canvas_element_size(m_NativeWindow.pCanvasId, &CanvasWidth, &CanvasHeight);
+        if (m_SwapChainDesc.Width != static_cast<Uint32>(CanvasWidth) || m_SwapChainDesc.Height != static_cast<Uint32>(CanvasHeight))
+        {
+            auto EmResult = emscripten_set_canvas_element_size(m_NativeWindow.pCanvasId, static_cast<int>(m_SwapChainDesc.Width), static_cast<int>(m_SwapChainDesc.Height));
+            if (EmResult != EMSCRIPTEN_RESULT_SUCCESS)
+                LOG_ERROR_MESSAGE("Failed to resize canvas '", m_NativeWindow.pCanvasId, "': emscripten_set_canvas_element_size() returned ", EmResult);
+        }
+#endif
         RecreateSwapChain();
+    }
 }
 
 void SwapChainWebGPUImpl::SetFullscreenMode(const DisplayModeAttribs& DisplayMode)
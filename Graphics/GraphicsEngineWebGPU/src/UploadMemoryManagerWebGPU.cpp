@@ -36,20 +36,42 @@ namespace Diligent
 
 UploadMemoryManagerWebGPU::Page::Page(UploadMemoryManagerWebGPU& Mgr, size_t Size) :
     m_pMgr{&Mgr},
-    m_Data(Size)
+    m_Size{Size}
 {
     WGPUBufferDescriptor wgpuBufferDesc{};
     wgpuBufferDesc.label = "Upload memory page";
     wgpuBufferDesc.size  = Size;
-    wgpuBufferDesc.usage =
-        WGPUBufferUsage_CopyDst |
-        WGPUBufferUsage_CopySrc |
-        WGPUBufferUsage_Uniform |
-        WGPUBufferUsage_Storage |
-        WGPUBufferUsage_Vertex |
-        WGPUBufferUsage_Index |
-        WGPUBufferUsage_Indirect;
+    if (m_pMgr->m_UseMappedPages)
+    {
+        // MAP_WRITE can only be combined with COPY_SRC
+        wgpuBufferDesc.usage            = WGPUBufferUsage_MapWrite | WGPUBufferUsage_CopySrc;
+        wgpuBufferDesc.mappedAtCreation = true;
+    }
+    else
+    {
+        wgpuBufferDesc.usage =
+            WGPUBufferUsage_CopyDst |
+            WGPUBufferUsage_CopySrc |
+            WGPUBufferUsage_Uniform |
+            WGPUBufferUsage_Storage |
+            WGPUBufferUsage_Vertex |
+            WGPUBufferUsage_Index |
+            WGPUBufferUsage_Indirect;
+    }
     m_wgpuBuffer.Reset(wgpuDeviceCreateBuffer(m_pMgr->m_wgpuDevice, &wgpuBufferDesc));
+
+    if (m_pMgr->m_UseMappedPages)
+    {
+        // Do NOT use WGPU_WHOLE_MAP_SIZE due to https://github.com/emscripten-core/emscripten/issues/20538
+        m_pData = static_cast<Uint8*>(wgpuBufferGetMappedRange(m_wgpuBuffer, 0, Size));
+        VERIFY(m_pData != nullptr, "Mapped range is null");
+    }
+    else
+    {
+        m_Data.resize(Size);
+        m_pData = m_Data.data();
+    }
+
     LOG_INFO_MESSAGE("Created a new upload memory page, size: ", FormatMemorySize(Size));
 }
 
@@ -58,7 +80,9 @@ UploadMemoryManagerWebGPU::Page::Page(Page&& RHS) noexcept :
     m_pMgr{RHS.m_pMgr},
     m_wgpuBuffer{std::move(RHS.m_wgpuBuffer)},
     m_Data{std::move(RHS.m_Data)},
-    m_CurrOffset{RHS.m_CurrOffset}
+    m_Size{RHS.m_Size},
+    m_CurrOffset{RHS.m_CurrOffset},
+    m_pData{RHS.m_pData}
 // clang-format on
 {
     RHS = Page{};
@@ -72,10 +96,14 @@ UploadMemoryManagerWebGPU::Page& UploadMemoryManagerWebGPU::Page::operator=(Page
     m_pMgr       = RHS.m_pMgr;
     m_wgpuBuffer = std::move(RHS.m_wgpuBuffer);
     m_Data       = std::move(RHS.m_Data);
+    m_Size       = RHS.m_Size;
     m_CurrOffset = RHS.m_CurrOffset;
+    m_pData      = RHS.m_pData;
 
     RHS.m_pMgr       = nullptr;
+    RHS.m_Size       = 0;
     RHS.m_CurrOffset = 0;
+    RHS.m_pData      = nullptr;
 
     return *this;
 }
@@ -91,10 +119,11 @@ UploadMemoryManagerWebGPU::Allocation UploadMemoryManagerWebGPU::Page::Allocate(
     Allocation Alloc;
     Alloc.Offset = AlignUp(m_CurrOffset, Alignment);
     Alloc.Size   = AlignUp(Size, Alignment);
-    if (Alloc.Offset + Alloc.Size <= m_Data.size())
+    if (Alloc.Offset + Alloc.Size <= m_Size)
     {
+        VERIFY(m_pData != nullptr, "The page is not mapped");
         Alloc.wgpuBuffer = m_wgpuBuffer;
-        Alloc.pData      = &m_Data[Alloc.Offset];
+        Alloc.pData      = m_pData + Alloc.Offset;
         m_CurrOffset     = Alloc.Offset + Alloc.Size;
         return Alloc;
     }
@@ -105,7 +134,17 @@ void UploadMemoryManagerWebGPU::Page::FlushWrites(WGPUQueue wgpuQueue)
 {
     if (m_CurrOffset > 0)
     {
-        wgpuQueueWriteBuffer(wgpuQueue, m_wgpuBuffer, 0, m_Data.data(), m_CurrOffset);
+        if (m_pMgr->m_UseMappedPages)
+        {
+            // The buffer must be unmapped before it is used by the submitted commands.
+            // The data has already been written to the mapped memory.
+            wgpuBufferUnmap(m_wgpuBuffer);
+            m_pData = nullptr;
+        }
+        else
+        {
+            wgpuQueueWriteBuffer(wgpuQueue, m_wgpuBuffer, 0, m_Data.data(), m_CurrOffset);
+        }
     }
 }
 
@@ -122,15 +161,31 @@ void UploadMemoryManagerWebGPU::Page::Recycle()
 }
 
 
-UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize) :
+UploadMemoryManagerWebGPU::UploadMemoryManagerWebGPU(WGPUDevice wgpuDevice, size_t PageSize, bool UseMappedPages) :
     m_PageSize{PageSize},
-    m_wgpuDevice{wgpuDevice}
+    m_wgpuDevice{wgpuDevice},
+    m_UseMappedPages{UseMappedPages}
 {
     VERIFY(IsPowerOfTwo(m_PageSize), "Page size must be power of two");
 }
 
 UploadMemoryManagerWebGPU::~UploadMemoryManagerWebGPU()
 {
+    std::list<Page> PendingPages;
+    {
+        std::lock_guard Lock{m_AvailablePagesMtx};
+        PendingPages.swap(m_PendingPages);
+    }
+    // Unmapping the buffer cancels the pending mapping. The callback will not find the page
+    // in m_PendingPages and will ignore it.
+    for (Page& PendingPage : PendingPages)
+    {
+        wgpuBufferUnmap(PendingPage.m_wgpuBuffer);
+#if DILIGENT_DEBUG
+        m_DbgPageCounter.fetch_sub(1);
+#endif
+    }
+
     VERIFY(m_DbgPageCounter == m_AvailablePages.size(),
            "Not all pages have been recycled. This may result in a crash if the page is recycled later.");
     size_t TotalSize = 0;
@@ -170,7 +225,57 @@ UploadMemoryManagerWebGPU::Page UploadMemoryManagerWebGPU::GetPage(size_t Size)
 void UploadMemoryManagerWebGPU::RecyclePage(Page&& Item)
 {
     std::lock_guard Lock{m_AvailablePagesMtx};
-    m_AvailablePages.emplace_back(std::move(Item));
+    if (Item.m_pData != nullptr)
+    {
+        m_AvailablePages.emplace_back(std::move(Item));
+        return;
+    }
+
+    // The page has been unmapped and submitted. Map it again; the mapping completes when
+    // the GPU is done with the commands that read from the page.
+    VERIFY_EXPR(m_UseMappedPages);
+    m_PendingPages.emplace_back(std::move(Item));
+    Page& PendingPage = m_PendingPages.back();
+    wgpuBufferMapAsync(PendingPage.m_wgpuBuffer, WGPUMapMode_Write, 0, PendingPage.m_Size, OnPageMapped, &PendingPage);
+}
+
+void UploadMemoryManagerWebGPU::OnPageMapped(WGPUBufferMapAsyncStatus MapStatus, void* pUserData)
+{
+    VERIFY_EXPR(pUserData != nullptr);
+    Page* pPage = static_cast<Page*>(pUserData);
+
+    UploadMemoryManagerWebGPU* pMgr = pPage->m_pMgr;
+    VERIFY_EXPR(pMgr != nullptr);
+
+    std::lock_guard Lock{pMgr->m_AvailablePagesMtx};
+
+    auto Iter = pMgr->m_PendingPages.begin();
+    while (Iter != pMgr->m_PendingPages.end() && &*Iter != pPage)
+        ++Iter;
+    if (Iter == pMgr->m_PendingPages.end())
+    {
+        // The manager is being destroyed
+        return;
+    }
+
+    if (MapStatus == WGPUBufferMapAsyncStatus_Success)
+    {
+        Iter->m_pData = static_cast<Uint8*>(wgpuBufferGetMappedRange(Iter->m_wgpuBuffer, 0, Iter->m_Size));
+        VERIFY(Iter->m_pData != nullptr, "Mapped range is null");
+    }
+
+    if (Iter->m_pData != nullptr)
+    {
+        pMgr->m_AvailablePages.emplace_back(std::move(*Iter));
+    }
+    else
+    {
+        LOG_WARNING_MESSAGE("Failed to map upload memory page. The page will be released.");
+#if DILIGENT_DEBUG
+        pMgr->m_DbgPageCounter.fetch_sub(1);
+#endif
+    }
+    pMgr->m_PendingPages.erase(Iter);
 }
 
 } // namespace Diligent
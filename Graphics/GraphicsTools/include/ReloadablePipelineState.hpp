@@ -30,6 +30,7 @@
 /// Definition of the Diligent::ReloadablePipelineState class
 
 #include <memory>
+#include <unordered_set>
 
 #include "PipelineState.h"
 #include "RenderStateCache.h"
@@ -68,11 +69,27 @@ public:
                        const PipelineStateCreateInfo& CreateInfo,
                        IPipelineState**               ppReloadablePipeline);
 
+    /// Re-creates the internal pipeline object.
+
+    /// \return    true if the pipeline was recreated, and false if it was found in the cache.
+    ///
+    /// \remarks   If the new pipeline is not ready yet (e.g. its shaders are being compiled
+    ///            asynchronously), the current pipeline keeps being used until the new one
+    ///            is ready, see UpdatePendingPipeline().
     bool Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData);
 
+    /// Returns true if the pipeline uses any of the given shaders.
+    bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const;
+
+    /// Returns the pipeline type.
+    PIPELINE_TYPE GetPipelineType() const { return m_Type; }
+
 private:
     void CopyStaticResources();
 
+    // Replaces the internal pipeline with the pending one once it is ready.
+    void UpdatePendingPipeline(bool WaitForCompletion);
+
 private:
     template <typename CreateInfoType>
     bool Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData);
@@ -88,6 +105,9 @@ private:
 
     // Old pipeline state kept around to copy static resources from
     RefCntAutoPtr<IPipelineState> m_pOldPipeline;
+
+    // Reloaded pipeline that is not ready yet
+    RefCntAutoPtr<IPipelineState> m_pPendingPipeline;
 };
 
 } // namespace Diligent
@@ -29,6 +29,10 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
 
@@ -48,10 +52,11 @@ public:
     static constexpr INTERFACE_ID IID_InternalImpl =
         {0x6bfaaabd, 0xfe55, 0x4420, {0xb0, 0xc8, 0x5c, 0x4b, 0x4f, 0x5f, 0x8d, 0x65}};
 
-    ReloadableShader(IReferenceCounters*     pRefCounters,
-                     RenderStateCacheImpl*   pStateCache,
-                     IShader*                pShader,
-                     const ShaderCreateInfo& CreateInfo);
+    ReloadableShader(IReferenceCounters*              pRefCounters,
+                     RenderStateCacheImpl*            pStateCache,
+                     IShader*                         pShader,
+                     const ShaderCreateInfo&          CreateInfo,
+                     IShaderSourceInputStreamFactory* pOriginalSourceFactory);
 
     ~ReloadableShader();
 
@@ -99,22 +104,72 @@ public:
         m_pShader->GetBytecode(ppBytecode, Size);
     }
 
-    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final
+    virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final;
+
+    virtual Float64 DILIGENT_CALL_TYPE GetCompileTime() const override final
+    {
+        return m_pShader->GetCompileTime();
+    }
+
+    /// Creates a reloadable shader.
+
+    /// \param [in]  pStateCache            - Render state cache that creates the shader.
+    /// \param [in]  pShader                - Internal shader object.
+    /// \param [in]  CreateInfo             - Create info that is used to reload the shader.
+    /// \param [in]  pOriginalSourceFactory - Source stream factory that pShader was loaded from.
+    ///                                       It may be different from the CreateInfo factory when
+    ///                                       the cache uses a reload source.
+    /// \param [out] ppReloadableShader     - Address of the memory location where the pointer
+    ///                                       to the reloadable shader will be written.
+    static void Create(RenderStateCacheImpl*            pStateCache,
+                       IShader*                         pShader,
+                       const ShaderCreateInfo&          CreateInfo,
+                       IShaderSourceInputStreamFactory* pOriginalSourceFactory,
+                       IShader**                        ppReloadableShader);
+
+    /// Re-creates the internal shader object.
+
+    /// \param [in] CompileAsync - Whether to compile the shader asynchronously. If true,
+    ///                            the new shader replaces the current one immediately and
+    ///                            GetStatus() reports that it is compiling. If the compilation
+    ///                            fails, GetStatus() restores the previous version.
+    /// \return     true if the shader was recompiled, and false if it was found in the cache.
+    bool Reload(bool CompileAsync = false);
+
+    /// Returns the stream factory that is used to load the shader source files.
+    IShaderSourceInputStreamFactory* GetSourceStreamFactory() const
     {
-        return m_pShader->GetStatus(WaitForCompletion);
+        return m_CreateInfo.Get().pShaderSourceStreamFactory;
     }
 
-    static void Create(RenderStateCacheImpl*   pStateCache,
-                       IShader*                pShader,
-                       const ShaderCreateInfo& CreateInfo,
-                       IShader**               ppReloadableShader);
+    /// Checks if any of the source files the shader depends on has changed.
 
-    bool Reload();
+    /// \param [in] GetFileHash - Function that returns the current hash of the file with the given path
+    ///                           loaded from GetSourceStreamFactory().
+    ///
+    /// \remarks    The source files are the main shader file and all files it includes, directly or
+    ///             indirectly. The list is updated every time the shader is created or reloaded.
+    ///             If the list could not be built, the method always returns true.
+    bool HasSourceChanged(const std::function<size_t(const std::string&)>& GetFileHash) const;
+
+private:
+    void UpdateSourceFiles(IShaderSourceInputStreamFactory* pSourceFactory);
 
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
-    ShaderCreateInfoWrapper             m_CreateInfo;
+    // The last version of the shader that compiled successfully, kept until the reloaded shader is ready
+    RefCntAutoPtr<IShader>  m_pPrevShader;
+    ShaderCreateInfoWrapper m_CreateInfo;
+
+    struct SourceFileInfo
+    {
+        std::string Path;
+        size_t      Hash = 0;
+    };
+    // The main shader file and all included files
+    std::vector<SourceFileInfo> m_SourceFiles;
+    bool                        m_SourceFilesValid = false;
 };
 
 } // namespace Diligent
@@ -29,8 +29,11 @@
 /// \file
 /// Definition of the Diligent::RenderStateCacheImpl class
 
+#include <atomic>
 #include <unordered_map>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +41,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "ObjectsRegistry.hpp"
 
 namespace Diligent
 {
@@ -56,10 +60,7 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE Load(const IDataBlob* pArchive,
                                          Uint32           ContentVersion,
-                                         bool             MakeCopy) override final
-    {
-        return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
-    }
+                                         bool             MakeCopy) override final;
 
     virtual bool DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
                                                  IShader**               ppShader) override final;
@@ -96,6 +97,8 @@ public:
 
     virtual Bool DILIGENT_CALL_TYPE WriteToStream(Uint32 ContentVersion, IFileStream* pStream) override final;
 
+    virtual Bool DILIGENT_CALL_TYPE WriteToJournal(Uint32 ContentVersion, IFileStream* pStream) override final;
+
     virtual void DILIGENT_CALL_TYPE Reset() override final;
 
     virtual Uint32 DILIGENT_CALL_TYPE Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData) override final;
@@ -105,13 +108,28 @@ public:
         return m_pDearchiver ? m_pDearchiver->GetContentVersion() : ~0u;
     }
 
+    virtual Bool DILIGENT_CALL_TYPE WritePipelineUsage(IDataBlob** ppBlob) override final;
+
+    virtual Uint32 DILIGENT_CALL_TYPE PrewarmPipelines(const IDataBlob* pUsageData) override final;
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetPrewarmProgress(Uint32* pTotalCount) override final;
+
     bool CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
                               IShader**               ppShader);
 
+    bool CreateNewShader(const ShaderCreateInfo& ShaderCI,
+                         const XXH128Hash&       Hash,
+                         IShader**               ppShader);
+
     template <typename CreateInfoType>
     bool CreatePipelineStateInternal(const CreateInfoType& PSOCreateInfo,
                                      IPipelineState**      ppPipelineState);
 
+    template <typename CreateInfoType>
+    bool CreateNewPipelineState(const CreateInfoType& PSOCreateInfo,
+                                const std::string&    HashStr,
+                                IPipelineState**      ppPipelineState);
+
     RefCntAutoPtr<IShader> FindReloadableShader(IShader* pShader);
 
 private:
@@ -129,27 +147,74 @@ private:
     bool CreatePipelineState(const CreateInfoType& PSOCreateInfo,
                              IPipelineState**      ppPipelineState);
 
+    void RecordPipelineUsage(const XXH128Hash& Hash, const PipelineStateDesc& Desc);
+
+    XXH128Hash ComputeShaderHash(const ShaderCreateInfo& ShaderCI);
+
+    bool LoadJournal(const IDataBlob* pJournal, Uint32 ContentVersion, bool MakeCopy);
+
+    Uint32 ResolveContentVersion(Uint32 ContentVersion) const;
+
 private:
     RefCntAutoPtr<IRenderDevice>                   m_pDevice;
     const RENDER_DEVICE_TYPE                       m_DeviceType;
     const size_t                                   m_DeviceHash; // Hash of the device-specific properties
     const RenderStateCacheCreateInfo               m_CI;
     RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pReloadSource;
+    RefCntAutoPtr<IPipelineStateCache>             m_pPSOCache;
     RefCntAutoPtr<ISerializationDevice>            m_pSerializationDevice;
     RefCntAutoPtr<IArchiver>                       m_pArchiver;
     RefCntAutoPtr<IDearchiver>                     m_pDearchiver;
 
-    std::mutex                                             m_ShadersMtx;
-    std::unordered_map<XXH128Hash, RefCntWeakPtr<IShader>> m_Shaders;
+    // The number of objects added to the archiver since the last write
+    std::atomic<Uint32> m_NumNewObjects{0};
+
+    // Shaders and pipelines are registered by their hashes. Lookups of existing objects only take
+    // a shared lock of one registry shard, and concurrent requests for the same missing object
+    // wait until the first one creates it.
+    ObjectsRegistry<XXH128Hash, RefCntAutoPtr<IShader>> m_Shaders;
+
+    struct SourceFileStamp
+    {
+        std::string Path;
+        Uint64      Size             = 0;
+        Uint64      ModificationTime = 0;
+    };
+    struct ShaderHashMemo
+    {
+        std::vector<SourceFileStamp> Files;
+        XXH128Hash                   Hash;
+    };
+    // Full shader hashes indexed by the hash of the create info without the source contents.
+    // Only used when m_CI.UseFileMetadataForShaderHash is true.
+    std::mutex                                     m_ShaderHashMemoMtx;
+    std::unordered_map<XXH128Hash, ShaderHashMemo> m_ShaderHashMemo;
 
     std::mutex                                                   m_ReloadableShadersMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IShader>> m_ReloadableShaders;
+    // Compound reload source factories indexed by the original factory. Sharing the factories lets
+    // Reload() check every source file once for all shaders that include it.
+    std::unordered_map<const IShaderSourceInputStreamFactory*, RefCntAutoPtr<IShaderSourceInputStreamFactory>> m_CompoundReloadSources;
 
-    std::mutex                                                    m_PipelinesMtx;
-    std::unordered_map<XXH128Hash, RefCntWeakPtr<IPipelineState>> m_Pipelines;
+    ObjectsRegistry<XXH128Hash, RefCntAutoPtr<IPipelineState>> m_Pipelines;
 
     std::mutex                                                          m_ReloadablePipelinesMtx;
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
+
+    // Pipelines created by PrewarmPipelines()
+    std::mutex                                 m_PrewarmedPipelinesMtx;
+    std::vector<RefCntAutoPtr<IPipelineState>> m_PrewarmedPipelines;
+
+    struct PipelineUsageInfo
+    {
+        std::string   HashStr; // Pipeline name in the archive
+        std::string   Name;    // Original pipeline name
+        PIPELINE_TYPE Type            = PIPELINE_TYPE_INVALID;
+        Uint32        RequestCount    = 0;
+        Uint32        FirstRequestIdx = 0;
+    };
+    std::mutex                                        m_PipelineUsageMtx;
+    std::unordered_map<XXH128Hash, PipelineUsageInfo> m_PipelineUsage;
 };
 
 } // namespace Diligent
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+#pragma once
+
+/// \file
+/// Declaration of BLASManager interface and related data structures
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/BottomLevelAS.h"
+
+namespace Diligent
+{
+
+// {1C958215-8252-4593-96EC-970E9528F845}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_BLASManager =
+    {0x1c958215, 0x8252, 0x4593, {0x96, 0xec, 0x97, 0xe, 0x95, 0x28, 0xf8, 0x45}};
+
+
+/// BLAS manager create information.
+struct BLASManagerCreateInfo
+{
+    /// BLAS manager name.
+    const Char* Name = nullptr;
+
+    /// Size of the shared scratch buffer, in bytes.
+
+    /// All builds that are executed by one IBLASManager::Update() call share the scratch buffer.
+    /// Builds that do not fit into the remaining space start a new batch that reuses
+    /// the buffer after a barrier. The buffer grows if a single BLAS requires more scratch
+    /// memory than its size.
+    Uint64 ScratchBufferSize = 32 << 20;
+
+    /// Whether to compact the BLASes after they are built.
+
+    /// When this flag is true, the BLASes are created with RAYTRACING_BUILD_AS_ALLOW_COMPACTION flag.
+    /// The compacted sizes are read back asynchronously, and the BLASes are replaced with
+    /// the compacted copies by a later IBLASManager::Update() call.
+    bool Compact = true;
+
+    /// Maximum number of BLASes that are compacted by one IBLASManager::Update() call.
+
+    /// Zero means no limit.
+    Uint32 MaxCompactionsPerUpdate = 0;
+};
+
+
+/// BLAS manager statistics.
+struct BLASManagerStats
+{
+    /// The number of BLASes managed by the manager.
+    Uint32 NumBLASes = 0;
+
+    /// The number of BLASes that have not been built yet.
+    Uint32 NumPendingBuilds = 0;
+
+    /// The number of BLASes whose compacted sizes have not been read back yet.
+    Uint32 NumPendingSizeReads = 0;
+
+    /// The number of BLASes that are ready to be compacted.
+    Uint32 NumPendingCompactions = 0;
+
+    /// The number of compacted BLASes.
+    Uint32 NumCompacted = 0;
+
+    /// Total size of the compacted BLASes, in bytes.
+    Uint64 CompactedSize = 0;
+
+    /// Current size of the scratch buffer, in bytes.
+    Uint64 ScratchBufferSize = 0;
+};
+
+
+/// The result of IBLASManager::Update().
+struct BLASManagerUpdateResult
+{
+    /// The number of BLASes that were built.
+    Uint32 NumBuilt = 0;
+
+    /// The number of BLASes that were replaced with compacted copies.
+    Uint32 NumCompacted = 0;
+};
+
+
+/// Bottom-level acceleration structure manager.
+
+/// The manager orchestrates the BLAS life cycle: it batches the builds into a shared
+/// scratch buffer, asynchronously reads back the compacted sizes, and replaces the
+/// BLASes with compacted copies once the sizes are available.
+///
+/// \remarks    Every build or compaction replaces the BLAS object returned by GetBLAS().
+///             When IBLASManager::Update() reports built or compacted BLASes, the application
+///             must rebuild the top-level acceleration structures that reference them.
+///
+///             All methods must be called from the thread that owns the device context.
+///             Update() must always be called with the same immediate context.
+struct IBLASManager : public IObject
+{
+    /// Adds a new BLAS.
+
+    /// \param [in] Desc          - BLAS description.
+    /// \param [in] pTriangleData - Triangle geometry data, see Diligent::BLASBuildTriangleData.
+    /// \param [in] TriangleCount - The number of elements in pTriangleData.
+    /// \param [in] pBoxData      - Bounding box geometry data, see Diligent::BLASBuildBoundingBoxData.
+    /// \param [in] BoxCount      - The number of elements in pBoxData.
+    /// \return     The BLAS identifier, or zero if the BLAS could not be created.
+    ///
+    /// \remarks    The BLAS is created immediately, but is only built by the next Update() call.
+    ///             The build data is copied, and the manager keeps strong references to the
+    ///             geometry buffers until the BLAS is built.
+    virtual Uint32 AddBLAS(const BottomLevelASDesc&        Desc,
+                           const BLASBuildTriangleData*    pTriangleData,
+                           Uint32                          TriangleCount,
+                           const BLASBuildBoundingBoxData* pBoxData,
+                           Uint32                          BoxCount) = 0;
+
+    /// Removes the BLAS.
+
+    /// \param [in] Id - BLAS identifier returned by AddBLAS().
+    virtual void RemoveBLAS(Uint32 Id) = 0;
+
+    /// Returns the current BLAS object, or null if the identifier is invalid.
+
+    /// \param [in] Id - BLAS identifier returned by AddBLAS().
+    ///
+    /// \remarks    The BLAS must not be used in a TLAS build before it has been built by Update().
+    virtual IBottomLevelAS* GetBLAS(Uint32 Id) const = 0;
+
+    /// Returns true if the BLAS has been built.
+    virtual bool IsBuilt(Uint32 Id) const = 0;
+
+    /// Executes pending compactions and builds.
+
+    /// \param [in] pContext - Immediate device context.
+    /// \return     The number of built and compacted BLASes, see Diligent::BLASManagerUpdateResult.
+    ///
+    /// \remarks    The method never waits for the GPU.
+    virtual BLASManagerUpdateResult Update(IDeviceContext* pContext) = 0;
+
+    /// Returns the manager statistics, see Diligent::BLASManagerStats.
+    virtual BLASManagerStats GetStats() const = 0;
+};
+
+
+/// Creates a new BLAS manager.
+
+/// \param[in]  pDevice       - Pointer to the render device. The device must support ray tracing.
+/// \param[in]  CreateInfo    - BLAS manager create info, see Diligent::BLASManagerCreateInfo.
+/// \param[out] ppBLASManager - Memory location where pointer to the BLAS manager will be written.
+void CreateBLASManager(IRenderDevice*               pDevice,
+                       const BLASManagerCreateInfo& CreateInfo,
+                       IBLASManager**               ppBLASManager);
+
+} // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of BufferSuballocator interface and related data structures
 
 #include <algorithm>
+#include <functional>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
@@ -55,6 +56,9 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_BufferSuballocator =
 struct IBufferSuballocation : public IObject
 {
     /// Returns the start offset of the suballocation, in bytes.
+
+    /// \remarks    The offset may change when the parent allocator is defragmented,
+    ///             see IBufferSuballocator::Defragment().
     virtual Uint32 GetOffset() const = 0;
 
     /// Returns the suballocation size, in bytes.
@@ -115,6 +119,13 @@ struct BufferSuballocatorUsageStats
     }
 };
 
+/// Callback that is called by IBufferSuballocator::Defragment() for every moved suballocation.
+
+/// \param[in] pSuballocation - The suballocation that was moved. Its new offset
+///                             is returned by IBufferSuballocation::GetOffset().
+/// \param[in] OldOffset      - The offset of the suballocation before the move.
+using BufferSuballocationMovedCallbackType = std::function<void(IBufferSuballocation* pSuballocation, Uint32 OldOffset)>;
+
 /// Buffer suballocator.
 struct IBufferSuballocator : public IObject
 {
@@ -158,6 +169,35 @@ struct IBufferSuballocator : public IObject
     /// Returns the internal buffer version. The version is incremented every time
     /// the buffer is expanded.
     virtual Uint32 GetVersion() const = 0;
+
+    /// Incrementally defragments the internal buffer.
+
+    /// \param[in]  pDevice        - A pointer to the render device that will be used to
+    ///                              create the scratch buffer, if necessary.
+    /// \param[in]  pContext       - A pointer to the device context that will be used to
+    ///                              copy the suballocation data.
+    /// \param[in]  MaxBytesToMove - The maximum number of bytes to move. At least one suballocation
+    ///                              is moved if it can be moved to a lower offset.
+    /// \param[in]  OnMoved        - Optional callback that is called for every moved suballocation,
+    ///                              see Diligent::BufferSuballocationMovedCallbackType.
+    /// \return     The number of bytes moved.
+    ///
+    /// \remarks    The method moves suballocations with the highest offsets to the free space
+    ///             closer to the start of the buffer, so that free space is merged into larger
+    ///             chunks and the buffer does not need to grow. The data is copied on the GPU
+    ///             through a scratch buffer.
+    ///
+    ///             Suballocation offsets are updated before the copy commands are recorded.
+    ///             Commands that use the new offsets must be recorded in pContext after this
+    ///             method returns, or in other contexts after the copies are complete.
+    ///             The method is thread-safe with respect to Allocate(), but must not be called
+    ///             simultaneously with Update().
+    ///
+    ///             The buffer must be a USAGE_DEFAULT or USAGE_SPARSE buffer.
+    virtual Uint64 Defragment(IRenderDevice*                              pDevice,
+                              IDeviceContext*                             pContext,
+                              Uint64                                      MaxBytesToMove,
+                              const BufferSuballocationMovedCallbackType& OnMoved = nullptr) = 0;
 };
 
 /// Buffer suballocator create information.
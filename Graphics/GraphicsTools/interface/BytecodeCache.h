@@ -35,6 +35,11 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 struct BytecodeCacheCreateInfo
 {
     enum RENDER_DEVICE_TYPE DeviceType DEFAULT_INITIALIZER(RENDER_DEVICE_TYPE_UNDEFINED);
+
+    /// Whether to compress the byte code in the data produced by IBytecodeCache::Store.
+    /// Every byte code is compressed with LZ4 separately. Compressed data is
+    /// decompressed by IBytecodeCache::Load regardless of this option.
+    bool CompressBytecode DEFAULT_INITIALIZER(false);
 };
 typedef struct BytecodeCacheCreateInfo BytecodeCacheCreateInfo;
 
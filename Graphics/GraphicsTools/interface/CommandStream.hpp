@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+#pragma once
+
+/// \file
+/// Declaration of CommandStream class
+
+#include <vector>
+#include <functional>
+
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+
+namespace Diligent
+{
+
+/// Compact stream of device context commands that can be recorded on one thread and replayed
+/// onto any device context later.
+
+/// Commands are packed one after another into a single linear buffer together with their arguments,
+/// so that recording a command is a bump allocation and a copy, and replaying the whole stream
+/// is a single loop over the buffer. Data passed by pointer (buffer updates, viewports, barriers,
+/// clear values, debug names, etc.) is copied into the stream.
+///
+/// The stream is backend-agnostic and can be used to hand the frame over from the simulation
+/// thread to the render thread and to pipeline several frames even on backends that do not support
+/// deferred contexts, such as OpenGL.
+///
+/// \remarks    Object references (pipelines, buffers, views, etc.) are stored as raw pointers and
+///             are not reference-counted. The application must keep all objects referenced by the
+///             stream alive until the stream is executed or reset.
+///
+///             The stream is not thread-safe. A typical setup uses one stream per frame in flight:
+///             the stream is recorded by one thread, handed over to the render thread that executes it,
+///             and is then reset and reused.
+class CommandStream
+{
+public:
+    /// Callback that is executed during the replay.
+    using CallbackType = void (*)(IDeviceContext* pContext, void* pUserData);
+
+    /// \param [in] InitialCapacity - Initial capacity of the command buffer, in bytes.
+    explicit CommandStream(size_t InitialCapacity = 64 << 10);
+
+    // clang-format off
+    CommandStream           (const CommandStream&)  = delete;
+    CommandStream& operator=(const CommandStream&)  = delete;
+    CommandStream           (      CommandStream&&) = default;
+    CommandStream& operator=(      CommandStream&&) = default;
+    // clang-format on
+
+    void SetPipelineState(IPipelineState* pPSO);
+    void CommitShaderResources(IShaderResourceBinding* pSRB, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+    void SetStencilRef(Uint32 StencilRef);
+    void SetBlendFactors(const float* pBlendFactors = nullptr);
+
+    void SetVertexBuffers(Uint32                         StartSlot,
+                          Uint32                         NumBuffersSet,
+                          IBuffer* const*                ppBuffers,
+                          const Uint64*                  pOffsets,
+                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                          SET_VERTEX_BUFFERS_FLAGS       Flags = SET_VERTEX_BUFFERS_FLAG_NONE);
+
+    void SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    void SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight);
+    void SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight);
+
+    void SetRenderTargets(Uint32                         NumRenderTargets,
+                          ITextureView* const*           ppRenderTargets,
+                          ITextureView*                  pDepthStencil,
+                          RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    void BeginRenderPass(const BeginRenderPassAttribs& Attribs);
+    void NextSubpass();
+    void EndRenderPass();
+
+    void Draw(const DrawAttribs& Attribs);
+    void DrawIndexed(const DrawIndexedAttribs& Attribs);
+    void DrawIndirect(const DrawIndirectAttribs& Attribs);
+    void DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs);
+    void DrawMesh(const DrawMeshAttribs& Attribs);
+    void DispatchCompute(const DispatchComputeAttribs& Attribs);
+    void DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs);
+
+    void ClearDepthStencil(ITextureView*                  pView,
+                           CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                           float                          fDepth,
+                           Uint8                          Stencil,
+                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    /// Records the render target clear command.
+
+    /// \param [in] pView - Render target view to clear.
+    /// \param [in] RGBA  - Clear color. Four 32-bit values are copied into the stream,
+    ///                     which covers both float and integer formats.
+    /// \param [in] StateTransitionMode - State transition mode.
+    void ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    /// Records the buffer update command. The data is copied into the stream.
+    void UpdateBuffer(IBuffer*                       pBuffer,
+                      Uint64                         Offset,
+                      Uint64                         Size,
+                      const void*                    pData,
+                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    void CopyBuffer(IBuffer*                       pSrcBuffer,
+                    Uint64                         SrcOffset,
+                    RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                    IBuffer*                       pDstBuffer,
+                    Uint64                         DstOffset,
+                    Uint64                         Size,
+                    RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode);
+
+    void CopyTexture(const CopyTextureAttribs& CopyAttribs);
+
+    void TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers);
+
+    void BeginDebugGroup(const Char* Name, const float* pColor = nullptr);
+    void EndDebugGroup();
+    void InsertDebugLabel(const Char* Label, const float* pColor = nullptr);
+
+    /// Records the callback that is invoked with the executing context during the replay.
+    /// The user data is not copied and must remain valid until the stream is executed.
+    void InvokeCallback(CallbackType Callback, void* pUserData);
+
+    /// Replays all recorded commands onto the device context.
+
+    /// \param [in] pContext - Device context to execute the commands in.
+    ///
+    /// \remarks    The stream is not modified and may be executed several times.
+    void Execute(IDeviceContext* pContext) const;
+
+    /// Removes all commands from the stream. The memory is kept for reuse.
+    void Reset();
+
+    /// Returns the number of recorded commands.
+    Uint32 GetCommandCount() const { return m_CommandCount; }
+
+    /// Returns the size of the recorded data, in bytes.
+    size_t GetSize() const { return m_Data.size(); }
+
+    bool IsEmpty() const { return m_CommandCount == 0; }
+
+
+    /// Callback that returns the ID of the object referenced by the stream.
+    using GetObjectIdCallbackType = std::function<Uint32(IObject* pObject)>;
+
+    /// Callback that returns the object with the given ID.
+    using GetObjectCallbackType = std::function<IObject*(Uint32 Id)>;
+
+    /// Serializes the stream into a data blob that can be saved to a file and replayed later.
+
+    /// \param [in]  GetObjectId - Callback that is called for every non-null object
+    ///                            referenced by the stream and returns its ID.
+    /// \param [out] Data        - Serialized data.
+    /// \return      true if the stream was serialized successfully, and false otherwise.
+    ///
+    /// \remarks    Object references are replaced with the IDs returned by the callback. The application
+    ///             is responsible for saving the objects (e.g. resource descriptions and contents, or
+    ///             pipeline states through the render state archiver) and for recreating them
+    ///             before the stream is deserialized.
+    ///
+    ///             Streams that contain callbacks can't be serialized.
+    ///             The data is only compatible with the platforms that have the same pointer size.
+    bool Serialize(const GetObjectIdCallbackType& GetObjectId, std::vector<Uint8>& Data) const;
+
+    /// Replaces the contents of the stream with the serialized data.
+
+    /// \param [in] pData     - Serialized data produced by Serialize().
+    /// \param [in] DataSize  - Data size, in bytes.
+    /// \param [in] GetObject - Callback that returns the object for every ID referenced by the stream.
+    ///                         The returned object must have the same type as the original object.
+    /// \return     true if the data was deserialized successfully, and false otherwise.
+    ///             If deserialization fails, the stream is empty.
+    bool Deserialize(const void* pData, size_t DataSize, const GetObjectCallbackType& GetObject);
+
+private:
+    enum class CMD_TYPE : Uint32;
+
+    // Allocates the command with the given payload size and returns the pointer to the payload.
+    // The pointer is only valid until the next allocation.
+    void* AllocateCommand(CMD_TYPE Type, size_t PayloadSize);
+
+    // Allocates the command followed by DataSize bytes of variable-size data.
+    template <typename CmdType>
+    CmdType& AllocateCommand(CMD_TYPE Type, size_t DataSize = 0);
+
+    // Calls Handler for every object pointer in the command. Returns false if the command
+    // contains references that can't be processed (callbacks).
+    template <typename HandlerType>
+    static bool ProcessObjectReferences(CMD_TYPE Type, void* pPayload, HandlerType&& Handler);
+
+    std::vector<Uint8> m_Data;
+    Uint32             m_CommandCount = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of ConstantBufferWriter class
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/Shader.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/HashUtils.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Writes constant buffer fields using the layout from the shader reflection and uploads only the modified data.
+
+/// The writer flattens the constant buffer description returned by IShader::GetConstantBufferDesc()
+/// into a table of fields with precomputed offsets. Struct members are named with their full path,
+/// e.g. "g_Material.BaseColor", and members of struct array elements include the element index,
+/// e.g. "g_Lights[2].Color". Arrays of basic types are single fields that are indexed when set.
+///
+/// Field IDs are resolved once, and fields are then set by ID:
+///
+///     ConstantBufferWriter Writer{pShader, "cbMaterial"};
+///     const Uint32 BaseColorId = Writer.GetFieldId("g_Material.BaseColor");
+///     ...
+///     Writer.Set(BaseColorId, float4{1, 0, 0, 1});
+///     Writer.Upload(pContext, pMaterialCB);
+///
+/// The writer keeps a CPU copy of the buffer. Setting a field to a value that differs from the copy
+/// marks the corresponding 16-byte rows as dirty, and Upload() only writes the dirty ranges with
+/// IDeviceContext::UpdateBuffer().
+///
+/// \remarks    Array element strides follow the HLSL constant buffer and GLSL std140 packing rules,
+///             where every array element starts at a 16-byte boundary.
+///             The object is not thread-safe.
+class ConstantBufferWriter
+{
+public:
+    /// Invalid field ID.
+    static constexpr Uint32 InvalidFieldId = ~0u;
+
+    /// Creates the writer from the constant buffer description.
+    explicit ConstantBufferWriter(const ShaderCodeBufferDesc& BufferDesc);
+
+    /// Creates the writer from the reflection of the constant buffer with the given name.
+
+    /// \remarks    The shader must be created with ShaderCreateInfo::LoadConstantBufferReflection flag.
+    ///             The constructor throws an exception if the buffer is not found.
+    ConstantBufferWriter(IShader* pShader, const Char* BufferName);
+
+    // clang-format off
+    ConstantBufferWriter           (const ConstantBufferWriter&)  = delete;
+    ConstantBufferWriter& operator=(const ConstantBufferWriter&)  = delete;
+    ConstantBufferWriter           (      ConstantBufferWriter&&) = default;
+    ConstantBufferWriter& operator=(      ConstantBufferWriter&&) = default;
+    // clang-format on
+
+    /// Field description
+    struct FieldInfo
+    {
+        /// Full field name, e.g. "g_Lights[2].Color".
+        std::string Name;
+
+        /// Offset of the field, in bytes, from the start of the buffer.
+        Uint32 Offset = 0;
+
+        /// Size of one element of the field, in bytes.
+        Uint32 Size = 0;
+
+        /// The number of array elements, or 1 if the field is not an array.
+        Uint32 ArraySize = 1;
+
+        /// Distance between array elements, in bytes.
+        Uint32 ArrayStride = 0;
+    };
+
+    /// Returns the ID of the field with the given name, or InvalidFieldId if there is no such field.
+    Uint32 GetFieldId(const Char* Name) const;
+
+    /// Returns the number of fields.
+    Uint32 GetNumFields() const { return static_cast<Uint32>(m_Fields.size()); }
+
+    /// Returns the field description.
+    const FieldInfo& GetField(Uint32 FieldId) const { return m_Fields[FieldId]; }
+
+    /// Sets the field data.
+
+    /// \param [in] FieldId    - Field ID returned by GetFieldId().
+    /// \param [in] pData      - Pointer to the data.
+    /// \param [in] DataSize   - Data size, in bytes. Must not exceed the size of one element of the field.
+    /// \param [in] ArrayIndex - Array element index.
+    ///
+    /// \return     true if the data has changed.
+    bool SetData(Uint32 FieldId, const void* pData, Uint32 DataSize, Uint32 ArrayIndex = 0);
+
+    /// Sets the field value.
+    template <typename T>
+    bool Set(Uint32 FieldId, const T& Value, Uint32 ArrayIndex = 0)
+    {
+        return SetData(FieldId, &Value, static_cast<Uint32>(sizeof(T)), ArrayIndex);
+    }
+
+    /// Sets the value of the field with the given name.
+
+    /// \remarks    This method looks up the field by name every time it is called.
+    ///             Use GetFieldId() and Set() for fields that are updated frequently.
+    template <typename T>
+    bool Set(const Char* Name, const T& Value, Uint32 ArrayIndex = 0)
+    {
+        const Uint32 FieldId = GetFieldId(Name);
+        if (FieldId == InvalidFieldId)
+        {
+            UNEXPECTED("Field '", Name, "' is not found");
+            return false;
+        }
+        return Set(FieldId, Value, ArrayIndex);
+    }
+
+    /// Returns the CPU copy of the buffer data.
+    const void* GetData() const { return m_Data.data(); }
+
+    /// Returns the buffer size, in bytes.
+    Uint32 GetSize() const { return static_cast<Uint32>(m_Data.size()); }
+
+    /// Returns true if any data has been modified since the last upload.
+    bool IsDirty() const { return m_NumDirtyRows > 0; }
+
+    /// Marks the whole buffer as dirty, e.g. when the writer is used with a new buffer.
+    void MarkAllDirty();
+
+    /// Uploads the modified data to the buffer.
+
+    /// \param [in] pContext       - Device context.
+    /// \param [in] pBuffer        - Buffer to upload the data to.
+    /// \param [in] TransitionMode - State transition mode for the buffer.
+    ///
+    /// \return     The number of bytes uploaded.
+    ///
+    /// \remarks    For USAGE_DEFAULT buffers, only the dirty ranges are written with UpdateBuffer().
+    ///             Ranges that are separated by small gaps are merged to reduce the number of commands.
+    ///             Contents of USAGE_DYNAMIC buffers do not persist between frames in Direct3D12
+    ///             and Vulkan, so the whole buffer is written every time with MAP_FLAG_DISCARD.
+    ///             Use USAGE_DEFAULT buffers for large buffers that change sparsely.
+    Uint32 Upload(IDeviceContext*                pContext,
+                  IBuffer*                       pBuffer,
+                  RESOURCE_STATE_TRANSITION_MODE TransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    /// Size of the dirty tracking unit, in bytes.
+    static constexpr Uint32 RowSize = 16;
+
+private:
+    void AddVariables(const ShaderCodeVariableDesc* pVariables, Uint32 NumVariables, Uint32 BaseOffset, const std::string& Prefix);
+
+private:
+    std::vector<FieldInfo>                       m_Fields;
+    std::unordered_map<HashMapStringKey, Uint32> m_FieldIds;
+
+    std::vector<Uint8> m_Data;
+    std::vector<bool>  m_DirtyRows;
+    Uint32             m_NumDirtyRows = 0;
+};
+
+} // namespace Diligent
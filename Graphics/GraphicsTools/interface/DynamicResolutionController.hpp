@@ -0,0 +1,254 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of DynamicResolutionController class
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+class DurationQueryHelper;
+
+/// Defines how the dynamic resolution controller allocates render targets.
+enum DYNAMIC_RESOLUTION_TARGET_MODE : Uint8
+{
+    /// A separate texture is created for every render target and every scale step
+    /// when the target is added or the full resolution changes.
+    /// Switching the scale only selects another pre-allocated texture.
+    DYNAMIC_RESOLUTION_TARGET_MODE_SEPARATE = 0,
+
+    /// A single full-resolution texture is created for every render target, and
+    /// all scale steps render into its top-left region of GetRenderWidth() x GetRenderHeight()
+    /// pixels. This mode uses the least memory, but the application must set the viewport
+    /// and scissor rects, and account for the region when sampling the texture.
+    DYNAMIC_RESOLUTION_TARGET_MODE_SHARED,
+};
+
+/// Dynamic resolution controller create information.
+struct DynamicResolutionControllerCreateInfo
+{
+    /// Target GPU frame time, in seconds.
+    double TargetFrameTime = 1.0 / 60.0;
+
+    /// Minimum render scale.
+    float MinScale = 0.5f;
+
+    /// Maximum render scale.
+    float MaxScale = 1.0f;
+
+    /// Scale step. Scale steps are MaxScale, MaxScale - ScaleStep, ..., down to MinScale.
+    float ScaleStep = 0.125f;
+
+    /// The controller lowers the scale when the average GPU frame time exceeds
+    /// TargetFrameTime * DecreaseThreshold.
+    float DecreaseThreshold = 0.95f;
+
+    /// The controller raises the scale when the average GPU frame time, projected to the
+    /// next scale step, does not exceed TargetFrameTime * IncreaseThreshold.
+    ///
+    /// \remarks    IncreaseThreshold should be less than DecreaseThreshold to provide hysteresis.
+    float IncreaseThreshold = 0.85f;
+
+    /// The number of GPU frame time measurements to average before making a decision.
+    Uint32 NumFramesToAverage = 8;
+
+    /// The minimum number of frames between two scale changes.
+    Uint32 MinFramesBetweenChanges = 30;
+
+    /// Full render resolution width.
+    Uint32 Width = 0;
+
+    /// Full render resolution height.
+    Uint32 Height = 0;
+
+    /// Render target allocation mode, see Diligent::DYNAMIC_RESOLUTION_TARGET_MODE.
+    DYNAMIC_RESOLUTION_TARGET_MODE TargetMode = DYNAMIC_RESOLUTION_TARGET_MODE_SEPARATE;
+};
+
+/// Selects the render resolution scale from the measured GPU frame time.
+
+/// The controller measures the GPU time between BeginFrame() and EndFrame() with timestamp
+/// queries. Results are read back several frames later without stalling the GPU.
+/// When the average frame time is above the target, the controller lowers the scale by one
+/// step; when there is enough headroom at the next higher step, it raises the scale.
+/// Measurements of frames that were submitted before a scale change are discarded.
+///
+/// The controller also owns the render targets that are rendered at the dynamic resolution.
+/// All textures are created when a target is added or when the full resolution changes, so
+/// switching the scale never creates resources:
+///
+///     Uint32 ColorRT = Controller.AddRenderTarget(ColorDesc);
+///     ...
+///     Controller.BeginFrame(pContext);
+///     // Render the scene to Controller.GetRenderTarget(ColorRT)
+///     //   using GetRenderWidth() x GetRenderHeight() resolution
+///     // Upscale to the swap chain
+///     Controller.EndFrame(pContext);
+///
+/// \remarks    If the device does not support timestamp queries, the scale is only
+///             changed by SetScaleIndex() or Update(). The controller is not thread-safe.
+class DynamicResolutionController
+{
+public:
+    /// Invalid render target index.
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// \param[in] pDevice    - Render device. May be null, in which case no queries are
+    ///                         created and the controller can't create render targets.
+    ///                         Frame times must then be provided by Update().
+    /// \param[in] CreateInfo - Create information, see Diligent::DynamicResolutionControllerCreateInfo.
+    DynamicResolutionController(IRenderDevice* pDevice, const DynamicResolutionControllerCreateInfo& CreateInfo);
+
+    // clang-format off
+    DynamicResolutionController           (const DynamicResolutionController&)  = delete;
+    DynamicResolutionController& operator=(const DynamicResolutionController&)  = delete;
+    DynamicResolutionController           (      DynamicResolutionController&&) = delete;
+    DynamicResolutionController& operator=(      DynamicResolutionController&&) = delete;
+    // clang-format on
+
+    ~DynamicResolutionController();
+
+    /// Begins GPU frame time measurement.
+    void BeginFrame(IDeviceContext* pContext);
+
+    /// Ends GPU frame time measurement and updates the scale if a measurement is available.
+
+    /// \return     true if the scale has changed.
+    bool EndFrame(IDeviceContext* pContext);
+
+    /// Adds a GPU frame time measurement and updates the scale.
+
+    /// \param[in] GPUFrameTime - GPU frame time, in seconds, of a frame rendered at the current scale.
+    ///
+    /// \return     true if the scale has changed.
+    ///
+    /// \remarks    EndFrame() calls this method automatically. The method may be used directly
+    ///             when frame times are measured by other means.
+    bool Update(double GPUFrameTime);
+
+    /// Adds a render target rendered at the dynamic resolution.
+
+    /// \param[in] Desc - Texture description. Width and height are ignored and are
+    ///                   computed from the full resolution and the scale.
+    ///
+    /// \return     Render target index, or InvalidIndex if the textures could not be created.
+    Uint32 AddRenderTarget(const TextureDesc& Desc);
+
+    /// Sets the full render resolution and recreates all render targets.
+    void SetFullResolution(Uint32 Width, Uint32 Height);
+
+    /// Returns the render target texture for the current scale.
+    ITexture* GetRenderTarget(Uint32 Index) const
+    {
+        return GetRenderTarget(Index, m_ScaleIdx);
+    }
+
+    /// Returns the render target texture for the given scale step.
+    ITexture* GetRenderTarget(Uint32 Index, Uint32 ScaleIdx) const;
+
+    /// Returns the render width at the current scale.
+    Uint32 GetRenderWidth() const { return GetScaledSize(m_Width, m_ScaleIdx); }
+
+    /// Returns the render height at the current scale.
+    Uint32 GetRenderHeight() const { return GetScaledSize(m_Height, m_ScaleIdx); }
+
+    /// Returns the current scale.
+    float GetScale() const { return m_Scales[m_ScaleIdx]; }
+
+    /// Returns the current scale step index. Index 0 corresponds to the maximum scale.
+    Uint32 GetScaleIndex() const { return m_ScaleIdx; }
+
+    /// Returns the number of scale steps.
+    Uint32 GetNumScales() const { return static_cast<Uint32>(m_Scales.size()); }
+
+    /// Returns the scale of the given step.
+    float GetScaleAt(Uint32 ScaleIdx) const { return m_Scales[ScaleIdx]; }
+
+    /// Forces the scale step. The step is kept for at least MinFramesBetweenChanges frames.
+    void SetScaleIndex(Uint32 ScaleIdx);
+
+    /// Returns the average GPU frame time, in seconds, of the recent measurements
+    /// at the current scale, or 0 if no measurements are available.
+    double GetAverageGPUFrameTime() const;
+
+    /// Returns true if the controller measures GPU frame time with timestamp queries.
+    bool IsGPUTimingSupported() const { return m_pQueryHelper != nullptr; }
+
+private:
+    Uint32 GetScaledSize(Uint32 Size, Uint32 ScaleIdx) const;
+    void   CreateTextures(Uint32 Index);
+    void   OnScaleChanged();
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const DynamicResolutionControllerCreateInfo m_CI;
+
+    std::unique_ptr<DurationQueryHelper> m_pQueryHelper;
+
+    std::vector<float> m_Scales;
+    Uint32             m_ScaleIdx = 0;
+
+    Uint32 m_Width  = 0;
+    Uint32 m_Height = 0;
+
+    // Recent frame time measurements at the current scale (circular buffer)
+    std::vector<double> m_FrameTimes;
+    Uint32              m_NumFrameTimes = 0;
+    Uint32              m_FrameTimeIdx  = 0;
+
+    Uint32 m_FramesSinceChange = 0;
+
+    // The number of frames that have been begun, but whose measurements have not been received yet
+    Uint32 m_NumPendingFrames = 0;
+    // The number of measurements to skip because the frames were rendered at the previous scale
+    Uint32 m_NumMeasurementsToSkip = 0;
+
+    struct RenderTarget
+    {
+        TextureDesc Desc;
+        std::string Name;
+
+        // One texture per scale step in DYNAMIC_RESOLUTION_TARGET_MODE_SEPARATE mode,
+        // a single texture in DYNAMIC_RESOLUTION_TARGET_MODE_SHARED mode.
+        std::vector<RefCntAutoPtr<ITexture>> Textures;
+    };
+    std::vector<RenderTarget> m_RenderTargets;
+};
+
+} // namespace Diligent
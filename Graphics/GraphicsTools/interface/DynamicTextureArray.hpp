@@ -30,6 +30,7 @@
 /// Declaration of DynamicTextureArray class
 
 #include <atomic>
+#include <vector>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
@@ -58,6 +59,45 @@ struct DynamicTextureArrayCreateInfo
     ///     This value is only relevant when Desc.Usage == USAGE_SPARSE and
     ///     defines the number of texture array slices in one memory page.
     Uint32 NumSlicesInMemoryPage = 1;
+
+    /// The number of slices in one texture chunk.
+
+    /// \remarks
+    ///     When this value is not zero and the texture array is not sparse (either because
+    ///     Desc.Usage is USAGE_DEFAULT, or because sparse textures are not supported by the device),
+    ///     the array is stored as a list of texture arrays (chunks) with NumSlicesInChunk slices each.
+    ///     Growing the array only creates new chunks and never copies existing slices.
+    ///     Chunks are meant to be exposed to shaders as an array of textures (see
+    ///     DynamicTextureArray::GetChunk()), where slice i is located in chunk i / NumSlicesInChunk
+    ///     at index i % NumSlicesInChunk.
+    ///
+    ///     When this value is zero, a non-sparse array is stored as a single texture,
+    ///     and all slices are copied to the new texture every time the array is resized.
+    Uint32 NumSlicesInChunk = 0;
+};
+
+/// Dynamic texture array statistics.
+struct DynamicTextureArrayStats
+{
+    /// The current number of slices.
+    Uint32 NumSlices = 0;
+
+    /// The current number of texture chunks.
+    /// This value is zero if the array is not chunked.
+    Uint32 NumChunks = 0;
+
+    /// The amount of memory currently used by the array, in bytes.
+    Uint64 CommittedMemorySize = 0;
+
+    /// The peak amount of memory used by the array, in bytes.
+    Uint64 PeakCommittedMemorySize = 0;
+
+    /// The number of committed resize operations.
+    Uint32 NumResizes = 0;
+
+    /// The total number of bytes copied between textures by resize operations.
+    /// This value can only be non-zero for non-sparse, non-chunked arrays.
+    Uint64 CopiedBytes = 0;
 };
 
 /// Dynamically resizable texture 2D array
@@ -109,6 +149,9 @@ public:
     ///
     ///             Typically pContext is null when the method is called from a worker thread.
     ///
+    ///             Chunked arrays never copy existing contents, so only pDevice is required
+    ///             to commit the resize.
+    ///
     ///             If NewArraySize is zero, internal buffer will be released.
     ITexture* Resize(IRenderDevice*  pDevice,
                      IDeviceContext* pContext,
@@ -140,9 +183,36 @@ public:
     /// \remarks    If the texture has not be initialized, the method returns null.
     ///             If the texture may need to be updated (initialized or resized),
     ///             use the Update() method.
+    ///
+    ///             If the array is chunked, the method returns the first chunk.
     ITexture* GetTexture() const
     {
-        return m_pTexture;
+        return !m_Chunks.empty() ? m_Chunks.front().RawPtr() : m_pTexture.RawPtr();
+    }
+
+    /// Returns true if the array is stored as a list of texture chunks,
+    /// see Diligent::DynamicTextureArrayCreateInfo::NumSlicesInChunk.
+    bool IsChunked() const
+    {
+        return m_NumSlicesInChunk != 0 && m_Desc.Usage == USAGE_DEFAULT;
+    }
+
+    /// Returns the number of slices in one texture chunk, or zero if the array is not chunked.
+    Uint32 GetNumSlicesInChunk() const
+    {
+        return IsChunked() ? m_NumSlicesInChunk : 0;
+    }
+
+    /// Returns the current number of texture chunks.
+    Uint32 GetNumChunks() const
+    {
+        return static_cast<Uint32>(m_Chunks.size());
+    }
+
+    /// Returns the texture chunk at the given index.
+    ITexture* GetChunk(Uint32 Index) const
+    {
+        return Index < m_Chunks.size() ? m_Chunks[Index].RawPtr() : nullptr;
     }
 
     /// Returns true if the texture must be updated before use (e.g. it has been resized,
@@ -169,6 +239,9 @@ public:
     /// Returns the amount of memory currently used by the dynamic array, in bytes.
     Uint64 GetMemoryUsage() const;
 
+    /// Returns the dynamic array statistics, see Diligent::DynamicTextureArrayStats.
+    DynamicTextureArrayStats GetStats() const;
+
 private:
     void CommitResize(IRenderDevice*  pDevice,
                       IDeviceContext* pContext,
@@ -176,6 +249,7 @@ private:
 
     void ResizeSparseTexture(IDeviceContext* pContext);
     void ResizeDefaultTexture(IDeviceContext* pContext);
+    void ResizeChunks(IRenderDevice* pDevice);
 
     void CreateSparseTexture(IRenderDevice* pDevice);
     void CreateResources(IRenderDevice* pDevice);
@@ -183,6 +257,7 @@ private:
     const std::string m_Name;
     TextureDesc       m_Desc;
     const Uint32      m_NumSlicesInPage;
+    const Uint32      m_NumSlicesInChunk;
 
     std::atomic<Uint32> m_Version{0};
 
@@ -192,6 +267,8 @@ private:
     RefCntAutoPtr<ITexture>      m_pStaleTexture;
     RefCntAutoPtr<IDeviceMemory> m_pMemory;
 
+    std::vector<RefCntAutoPtr<ITexture>> m_Chunks;
+
     Uint64 m_MemoryPageSize = 0;
 
     Uint64 m_NextBeforeResizeFenceValue = 1;
@@ -200,6 +277,10 @@ private:
 
     RefCntAutoPtr<IFence> m_pBeforeResizeFence;
     RefCntAutoPtr<IFence> m_pAfterResizeFence;
+
+    Uint32 m_NumResizes      = 0;
+    Uint64 m_CopiedBytes     = 0;
+    Uint64 m_PeakMemoryUsage = 0;
 };
 
 } // namespace Diligent
@@ -111,6 +111,15 @@ struct DynamicTextureAtlasUsageStats
     /// Used area is always equal to or larger than the
     /// allocated area due to alignment requirements.
     Uint64 UsedArea = 0;
+
+    /// The number of slices that contain at least one allocation.
+    Uint32 SlicesInUse = 0;
+
+    /// Packing efficiency, e.g. the ratio of the used area to
+    /// the total area of the slices that are in use.
+
+    /// The value is in the range [0, 1] and is zero when the atlas is empty.
+    float PackingEfficiency = 0;
 };
 
 
@@ -158,6 +167,24 @@ struct IDynamicTextureAtlas : public IObject
                           ITextureAtlasSuballocation** ppSuballocation) = 0;
 
 
+    /// Performs multiple suballocations from the atlas in one call.
+
+    /// \param[in]  NumRegions       - The number of regions to allocate.
+    /// \param[in]  pSizes           - An array of NumRegions region sizes.
+    /// \param[out] ppSuballocations - An array of NumRegions memory locations where pointers to
+    ///                                the new suballocations will be stored. If a region can't be
+    ///                                allocated, the corresponding pointer is left null.
+    ///
+    /// \remarks    The method is thread-safe and can be called from multiple threads simultaneously.
+    ///
+    ///             Regions that share the same alignment are allocated from a slice while its lock
+    ///             is held, so allocating a batch is considerably cheaper than allocating the regions
+    ///             one by one. Larger regions are placed first for better packing.
+    virtual void AllocateBatch(Uint32                       NumRegions,
+                               const uint2*                 pSizes,
+                               ITextureAtlasSuballocation** ppSuballocations) = 0;
+
+
     /// Returns the texture atlas description
     virtual const TextureDesc& GetAtlasDesc() const = 0;
 
@@ -179,6 +206,23 @@ struct IDynamicTextureAtlas : public IObject
 
 
 /// Dynamic texture atlas create information.
+/// Dynamic texture atlas packing strategy.
+enum TEXTURE_ATLAS_PACKING_STRATEGY : Uint8
+{
+    /// Free space is recursively split into rectangles that are merged back
+    /// when regions are released. Works best when regions of very different
+    /// sizes are frequently allocated and released.
+    TEXTURE_ATLAS_PACKING_STRATEGY_GUILLOTINE = 0,
+
+    /// Regions are placed at the lowest position along the skyline of every slice.
+    /// Gives higher occupancy and faster allocation for many regions of similar
+    /// height, such as font glyphs. Released space is reused, but the skyline of a
+    /// slice is only reset when all regions in that slice are released.
+    TEXTURE_ATLAS_PACKING_STRATEGY_SKYLINE,
+
+    TEXTURE_ATLAS_PACKING_STRATEGY_COUNT
+};
+
 struct DynamicTextureAtlasCreateInfo
 {
     /// Texture description
@@ -239,6 +283,21 @@ struct DynamicTextureAtlasCreateInfo
 
     /// Silence allocation errors.
     bool Silent = false;
+
+    /// Use thread-affine allocation policy.
+
+    /// Every slice of the atlas is locked independently. When this flag is set, each thread
+    /// starts looking for space in its own preferred slice and skips slices that are currently
+    /// locked by other threads, so that threads that allocate at the same time mostly work
+    /// with different slices. If no unlocked slice has enough space, the atlas falls back to the
+    /// default policy that tries all slices in order.
+    ///
+    /// This reduces contention when many worker threads allocate from the same atlas
+    /// at the cost of a less compact packing. The flag has no effect for 2D atlases.
+    bool ThreadAffineAllocation = false;
+
+    /// Packing strategy, see Diligent::TEXTURE_ATLAS_PACKING_STRATEGY.
+    TEXTURE_ATLAS_PACKING_STRATEGY PackingStrategy = TEXTURE_ATLAS_PACKING_STRATEGY_GUILLOTINE;
 };
 
 
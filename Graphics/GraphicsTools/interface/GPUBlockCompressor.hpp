@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of GPUBlockCompressor class
+
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Compresses textures into BC formats on the GPU.
+
+/// A compute shader encodes the source texture into a buffer of compressed blocks,
+/// and the blocks are then copied to the destination texture with IDeviceContext::UpdateTexture.
+/// The following destination formats are supported:
+/// - BC1_UNORM, BC1_UNORM_SRGB (four-color mode only, alpha is ignored)
+/// - BC3_UNORM, BC3_UNORM_SRGB
+/// - BC4_UNORM
+/// - BC5_UNORM
+/// - BC6H_UF16 (single-region mode)
+/// - BC7_UNORM, BC7_UNORM_SRGB (single-subset mode)
+///
+/// The encoder is tuned for speed: endpoints are taken from the bounding box of
+/// every block. Use Diligent::CompressBC for higher quality CPU compression.
+///
+/// \remarks    The compressor is supported by Direct3D12 and Vulkan backends, see IsSupported().
+///             The object is not thread-safe.
+class GPUBlockCompressor
+{
+public:
+    explicit GPUBlockCompressor(IRenderDevice* pDevice);
+    ~GPUBlockCompressor();
+
+    // clang-format off
+    GPUBlockCompressor           (const GPUBlockCompressor&)  = delete;
+    GPUBlockCompressor           (      GPUBlockCompressor&&) = delete;
+    GPUBlockCompressor& operator=(const GPUBlockCompressor&)  = delete;
+    GPUBlockCompressor& operator=(      GPUBlockCompressor&&) = delete;
+    // clang-format on
+
+    /// Returns true if the compressor is supported by the device.
+    static bool IsSupported(IRenderDevice* pDevice);
+
+    /// Returns true if the compressor can produce the format.
+    static bool IsFormatSupported(TEXTURE_FORMAT Format);
+
+    /// Compression attributes
+    struct CompressAttribs
+    {
+        /// Shader resource view of the source 2D texture.
+
+        /// The most detailed mip level of the view is compressed.
+        /// Its size must match the size of the destination mip level.
+        /// If both the view and the destination formats are sRGB, the texels are
+        /// converted back to sRGB space before they are compressed.
+        ITextureView* pSrcView = nullptr;
+
+        /// Destination texture.
+        ITexture* pDstTexture = nullptr;
+
+        /// Destination mip level.
+        Uint32 DstMipLevel = 0;
+
+        /// Destination array slice.
+        Uint32 DstSlice = 0;
+
+        /// State transition mode of the destination texture.
+        RESOURCE_STATE_TRANSITION_MODE DstTextureTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    };
+
+    /// Compresses the source view into the destination texture subresource.
+
+    /// \remarks    The source texture is transitioned to the shader resource state.
+    ///             Multiple subresources can be compressed one after another in the
+    ///             same context; the internal block buffer is reused.
+    void Compress(IDeviceContext* pContext, const CompressAttribs& Attribs);
+
+private:
+    struct PipelineInfo
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    PipelineInfo* GetPipeline(Uint32 BCFormat, bool ConvertToSRGB);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IBuffer>       m_pConstants;
+    RefCntAutoPtr<IBuffer>       m_pBlockBuffer;
+
+    std::unordered_map<Uint32, PipelineInfo> m_Pipelines;
+};
+
+} // namespace Diligent
@@ -0,0 +1,200 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of GPUInstanceCuller class
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Culls instances on the GPU and generates compacted indirect draw arguments.
+
+/// Every instance references a mesh by its index in the mesh buffer. The culler tests the
+/// bounding box of every instance against the view frustum and, optionally, against a
+/// hierarchical depth buffer, and writes the indices of the visible instances into the
+/// visible instance buffer. It then writes one DrawIndexedIndirect command for every mesh
+/// with visible instances and the number of commands into the draw count buffer.
+/// The commands are executed with a single IDeviceContext::DrawIndexedIndirect() call,
+/// see GetDrawAttribs().
+///
+/// The visible instance buffer contains one Uint32 instance index per slot and is meant
+/// to be bound as a per-instance vertex buffer: the FirstInstanceLocation of every command
+/// points to the range of its mesh, so the vertex shader receives the instance index
+/// as a vertex attribute with all backends.
+///
+/// Mesh geometry is expected to live in shared buffers, e.g. the ones managed by
+/// IVertexPool and IBufferSuballocator, so that all meshes can be drawn with the same
+/// vertex and index buffers: MeshData::BaseVertex is the start vertex of the vertex pool
+/// allocation, and MeshData::FirstIndexLocation is the offset of the index suballocation
+/// divided by the index size.
+///
+/// \remarks    The culler is supported by Direct3D12 and Vulkan backends, see IsSupported().
+///             The order of the generated commands is not deterministic.
+///             The object is not thread-safe.
+class GPUInstanceCuller
+{
+public:
+    /// Instance data, the layout of the elements of the instance buffer.
+    struct InstanceData
+    {
+        /// Minimum corner of the world-space bounding box.
+        float3 BoundsMin;
+
+        /// Index of the instance mesh in the mesh buffer.
+        /// Instances with invalid mesh indices are culled.
+        Uint32 MeshId = 0;
+
+        /// Maximum corner of the world-space bounding box.
+        float3 BoundsMax;
+
+        /// User data that is ignored by the culler.
+        Uint32 UserData = 0;
+    };
+    static_assert(sizeof(InstanceData) == 32, "Instance data size must match the shader");
+
+    /// Mesh data, the layout of the elements of the mesh buffer.
+    struct MeshData
+    {
+        /// The number of indices to draw.
+        Uint32 NumIndices = 0;
+
+        /// The first index in the index buffer.
+        Uint32 FirstIndexLocation = 0;
+
+        /// The value added to the vertex indices.
+        Uint32 BaseVertex = 0;
+
+        /// The first slot in the visible instance buffer reserved for the instances of this mesh.
+
+        /// Ranges of different meshes must not overlap, and every range must be large
+        /// enough to hold all instances of the mesh. Typically, this is the total number of
+        /// instances of all previous meshes.
+        Uint32 FirstInstance = 0;
+    };
+    static_assert(sizeof(MeshData) == 16, "Mesh data size must match the shader");
+
+    explicit GPUInstanceCuller(IRenderDevice* pDevice);
+    ~GPUInstanceCuller();
+
+    // clang-format off
+    GPUInstanceCuller           (const GPUInstanceCuller&)  = delete;
+    GPUInstanceCuller           (      GPUInstanceCuller&&) = delete;
+    GPUInstanceCuller& operator=(const GPUInstanceCuller&)  = delete;
+    GPUInstanceCuller& operator=(      GPUInstanceCuller&&) = delete;
+    // clang-format on
+
+    /// Returns true if the culler is supported by the device.
+    static bool IsSupported(IRenderDevice* pDevice);
+
+    /// Culling attributes
+    struct CullAttribs
+    {
+        /// Structured buffer of InstanceData elements with the BIND_SHADER_RESOURCE flag.
+        IBuffer* pInstances = nullptr;
+
+        /// The number of instances to cull.
+        Uint32 NumInstances = 0;
+
+        /// Structured buffer of MeshData elements with the BIND_SHADER_RESOURCE flag.
+        IBuffer* pMeshes = nullptr;
+
+        /// The number of meshes.
+        Uint32 NumMeshes = 0;
+
+        /// The number of slots in the visible instance buffer.
+
+        /// If zero, NumInstances is used, which is sufficient when the mesh instance
+        /// ranges are tightly packed.
+        Uint32 NumVisibleInstanceSlots = 0;
+
+        /// View-projection matrix. The frustum planes are extracted from this matrix.
+        float4x4 ViewProj = float4x4::Identity();
+
+        /// Optional shader resource view of the Hi-Z pyramid.
+
+        /// Every texel of the pyramid must contain the farthest depth of the corresponding
+        /// texels of the previous level, and the most detailed level must cover the viewport,
+        /// see HiZPyramidBuilder.
+        /// If null, only frustum culling is performed.
+        ITextureView* pHiZView = nullptr;
+
+        /// Whether the depth buffer uses reversed depth (near plane at 1).
+        bool ReverseDepth = false;
+    };
+
+    /// Culls the instances and generates the draw commands.
+
+    /// \remarks    The instance and mesh buffers are transitioned to the shader resource state.
+    ///             The generated commands may be used by any number of draw calls until
+    ///             the next call to Cull().
+    void Cull(IDeviceContext* pContext, const CullAttribs& Attribs);
+
+    /// Returns the buffer with DrawIndexedIndirect commands.
+    IBuffer* GetDrawArgsBuffer() const { return m_pDrawArgs; }
+
+    /// Returns the buffer with the number of commands.
+    IBuffer* GetDrawCountBuffer() const { return m_pDrawCount; }
+
+    /// Returns the buffer with the indices of the visible instances.
+    IBuffer* GetVisibleInstanceBuffer() const { return m_pVisibleInstances; }
+
+    /// Returns the attributes of the draw call that executes the commands generated by the last Cull() call.
+    DrawIndexedIndirectAttribs GetDrawAttribs(VALUE_TYPE IndexType, DRAW_FLAGS Flags = DRAW_FLAG_NONE) const;
+
+private:
+    struct PipelineInfo
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    bool CreatePipeline(const char* EntryPoint, bool UseHiZ, PipelineInfo& Pipeline);
+    bool CreateBuffers(Uint32 NumMeshes, Uint32 NumVisibleInstanceSlots);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IBuffer>       m_pConstants;
+
+    PipelineInfo m_ResetPipeline;
+    PipelineInfo m_CullPipeline;
+    PipelineInfo m_CullHiZPipeline;
+    PipelineInfo m_BuildArgsPipeline;
+
+    RefCntAutoPtr<IBuffer> m_pMeshInstanceCounts;
+    RefCntAutoPtr<IBuffer> m_pVisibleInstances;
+    RefCntAutoPtr<IBuffer> m_pDrawArgs;
+    RefCntAutoPtr<IBuffer> m_pDrawCount;
+
+    Uint32 m_NumMeshes = 0;
+};
+
+} // namespace Diligent
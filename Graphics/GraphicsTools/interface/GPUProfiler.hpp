@@ -0,0 +1,273 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GPUProfiler class
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <mutex>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Hierarchical GPU profiler.
+
+/// The profiler records a pair of timestamp queries for every scope and
+/// resolves them asynchronously a few frames later, so that the CPU never
+/// waits for the GPU. Scopes may be nested and may be recorded in any number
+/// of device contexts. Scopes in different contexts are tracked independently.
+///
+/// Typical usage:
+///
+///     {
+///         GPUProfiler::Scope Frame{Profiler, pContext, "Frame"};
+///         {
+///             GPUProfiler::Scope Shadows{Profiler, pContext, "Shadows"};
+///             ...
+///         }
+///     }
+///     Profiler.EndFrame();
+///
+///     GPUProfiler::FrameData Frame;
+///     if (Profiler.GetLastResolvedFrame(Frame))
+///         ...
+///
+/// \remarks    All methods are thread-safe. Timestamps recorded in
+///             contexts that belong to different queues may use different
+///             clocks and may not be directly comparable.
+class GPUProfiler
+{
+public:
+    /// Resolved scope timing.
+    struct ScopeData
+    {
+        /// Scope name.
+        std::string Name;
+
+        /// Index of the parent scope in FrameData::Scopes, or InvalidIndex for top-level scopes.
+        Uint32 Parent = InvalidIndex;
+
+        /// Nesting depth, zero for top-level scopes.
+        Uint32 Depth = 0;
+
+        /// Index of the context the scope was recorded in, see GetContextName().
+        Uint32 ContextIndex = 0;
+
+        /// Scope start time, in seconds, relative to FrameData::StartTime.
+        double StartTime = 0;
+
+        /// Scope duration, in seconds.
+        double Duration = 0;
+    };
+
+    /// Resolved frame.
+    struct FrameData
+    {
+        /// Frame number, as counted by EndFrame().
+        Uint64 FrameNumber = 0;
+
+        /// GPU time of the earliest scope start in this frame, in seconds.
+        double StartTime = 0;
+
+        /// Scopes in the order they were begun in each context. A parent scope
+        /// always precedes its children, which forms a tree.
+        std::vector<ScopeData> Scopes;
+    };
+
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// \param [in] pDevice              - Render device.
+    /// \param [in] NumQueriesToReserve  - The number of timestamp queries to create for every
+    ///                                    context when the context is first used.
+    /// \param [in] MaxResolvedFrames    - The number of resolved frames to keep for export.
+    /// \param [in] ExpectedFrameLatency - The number of unresolved frames after which
+    ///                                    a warning is printed.
+    ///
+    /// \remarks    If the device does not support timestamp queries, all scopes are ignored.
+    GPUProfiler(IRenderDevice* pDevice,
+                Uint32         NumQueriesToReserve  = 64,
+                Uint32         MaxResolvedFrames    = 64,
+                Uint32         ExpectedFrameLatency = 5);
+
+    // clang-format off
+    GPUProfiler           (const GPUProfiler&) = delete;
+    GPUProfiler& operator=(const GPUProfiler&) = delete;
+    GPUProfiler           (GPUProfiler&&)      = delete;
+    GPUProfiler& operator=(GPUProfiler&&)      = delete;
+    // clang-format on
+
+
+    /// Begins a new scope in the given context.
+
+    /// \param [in] pCtx - Context to record the start timestamp.
+    /// \param [in] Name - Scope name.
+    ///
+    /// \remarks    There must be exactly one matching EndScope() call in the same
+    ///             context for every BeginScope() call before EndFrame() is called.
+    void BeginScope(IDeviceContext* pCtx, const Char* Name);
+
+
+    /// Ends the innermost scope in the given context.
+    void EndScope(IDeviceContext* pCtx);
+
+
+    /// Ends the current frame and resolves the timings of previous frames
+    /// whose queries have become available.
+
+    /// \remarks    The method never waits for the GPU.
+    ///             Frames are resolved in the order they were ended.
+    void EndFrame();
+
+
+    /// Copies the most recently resolved frame to Frame.
+
+    /// \return     true if at least one frame has been resolved, and false otherwise.
+    bool GetLastResolvedFrame(FrameData& Frame) const;
+
+
+    /// Returns the name of the context with the given index.
+    std::string GetContextName(Uint32 ContextIndex) const;
+
+
+    /// Exports resolved frames in Chrome trace event format.
+
+    /// The output can be loaded into chrome://tracing or https://ui.perfetto.dev.
+    /// Every context is shown as a separate thread.
+    std::string ExportChromeTrace() const;
+
+
+    /// RAII helper that begins a profiler scope and a debug group with the same
+    /// name, and ends both when destroyed.
+    class Scope
+    {
+    public:
+        Scope(GPUProfiler&    Profiler,
+              IDeviceContext* pContext,
+              const Char*     Name,
+              const float*    pColor = nullptr) :
+            m_pProfiler{&Profiler},
+            m_pContext{pContext}
+        {
+            VERIFY_EXPR(pContext != nullptr && Name != nullptr);
+            pContext->BeginDebugGroup(Name, pColor);
+            Profiler.BeginScope(pContext, Name);
+        }
+
+        ~Scope()
+        {
+            if (m_pContext != nullptr)
+            {
+                m_pProfiler->EndScope(m_pContext);
+                m_pContext->EndDebugGroup();
+            }
+        }
+
+        // clang-format off
+        Scope           (const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&)      = delete;
+        // clang-format on
+
+        Scope(Scope&& rhs) noexcept :
+            m_pProfiler{rhs.m_pProfiler},
+            m_pContext{rhs.m_pContext}
+        {
+            rhs.m_pContext = nullptr;
+        }
+
+    private:
+        GPUProfiler*    m_pProfiler = nullptr;
+        IDeviceContext* m_pContext  = nullptr;
+    };
+
+private:
+    struct PendingScope
+    {
+        Uint32 NameIndex    = 0;
+        Uint32 Parent       = InvalidIndex;
+        Uint32 Depth        = 0;
+        Uint32 ContextIndex = 0;
+
+        RefCntAutoPtr<IQuery> StartTimestamp;
+        RefCntAutoPtr<IQuery> EndTimestamp;
+    };
+
+    struct PendingFrame
+    {
+        Uint64                    FrameNumber = 0;
+        std::vector<PendingScope> Scopes;
+    };
+
+    struct ContextData
+    {
+        IDeviceContext* pContext = nullptr;
+        std::string     Name;
+
+        // Timestamp queries are never shared between contexts
+        std::vector<RefCntAutoPtr<IQuery>> AvailableQueries;
+
+        // Indices of open scopes in the current frame
+        std::vector<Uint32> ScopeStack;
+    };
+
+    RefCntAutoPtr<IQuery> GetQuery(Uint32 ContextIndex);
+    void                  RecycleQuery(Uint32 ContextIndex, RefCntAutoPtr<IQuery>&& pQuery);
+    Uint32                GetContextIndex(IDeviceContext* pCtx);
+    Uint32                GetNameIndex(const Char* Name);
+    bool                  ResolveOldestFrame();
+    void                  RecycleFrameQueries(PendingFrame& Frame);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint32 m_NumQueriesToReserve;
+    const Uint32 m_MaxResolvedFrames;
+    const Uint32 m_ExpectedFrameLatency;
+    const bool   m_TimestampsSupported;
+
+    mutable std::mutex m_Mtx;
+
+    std::vector<ContextData> m_Contexts;
+
+    std::unordered_map<HashMapStringKey, Uint32, HashMapStringKey::Hasher> m_NameToIndex;
+    std::vector<const Char*>                                               m_Names;
+
+    PendingFrame             m_CurrentFrame;
+    std::deque<PendingFrame> m_PendingFrames;
+    std::deque<FrameData>    m_ResolvedFrames;
+};
+
+} // namespace Diligent
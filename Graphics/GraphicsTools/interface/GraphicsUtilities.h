@@ -33,6 +33,7 @@
 #include "../../GraphicsEngine/interface/Texture.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../../Common/interface/ThreadPool.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
@@ -108,6 +109,14 @@ struct ComputeMipLevelAttribs
     ///         A_new = max(A_old; 1/3 * A_old + 2/3 * AlphaCutoff)
     float AlphaCutoff          DEFAULT_INITIALIZER(0);
 
+    /// Optional thread pool.
+    ///
+    /// \remarks
+    ///     If the pool is provided, large mip levels are split into groups of rows
+    ///     that are processed in parallel. The function still returns only
+    ///     after the coarse mip level has been computed.
+    struct IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr ComputeMipLevelAttribs() noexcept {}
 
@@ -119,7 +128,8 @@ struct ComputeMipLevelAttribs
                                      void*            _pCoarseMipData,
                                      size_t           _CoarseMipStride,
                                      MIP_FILTER_TYPE _FilterType  = ComputeMipLevelAttribs{}.FilterType,
-                                     float            _AlphaCutoff = ComputeMipLevelAttribs{}.AlphaCutoff) noexcept :
+                                     float            _AlphaCutoff = ComputeMipLevelAttribs{}.AlphaCutoff,
+                                     IThreadPool*     _pThreadPool = ComputeMipLevelAttribs{}.pThreadPool) noexcept :
         Format          {_Format},
         FineMipWidth    {_FineMipWidth},
         FineMipHeight   {_FineMipHeight},
@@ -128,7 +138,8 @@ struct ComputeMipLevelAttribs
         pCoarseMipData  {_pCoarseMipData},
         CoarseMipStride {_CoarseMipStride},
         FilterType      {_FilterType},
-        AlphaCutoff     {_AlphaCutoff}
+        AlphaCutoff     {_AlphaCutoff},
+        pThreadPool     {_pThreadPool}
     {} 
 #endif
 };
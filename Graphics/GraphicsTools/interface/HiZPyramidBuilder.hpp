@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of HiZPyramidBuilder class
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Builds a hierarchical depth (Hi-Z) pyramid from a depth buffer with compute shaders.
+
+/// Every texel of the pyramid contains the minimum, the maximum, or both of the depths
+/// of the corresponding texels of the previous level. The most detailed level of the pyramid
+/// has the largest power-of-two size that does not exceed the size of the depth buffer,
+/// in each dimension. When the depth buffer size is not a power of two, every texel of the most
+/// detailed level covers all depth texels that its footprint overlaps, so the pyramid remains
+/// conservative.
+///
+/// Every compute dispatch builds up to four levels of the pyramid, so a 4K depth buffer
+/// takes three dispatches.
+///
+/// To use the pyramid for occlusion culling with GPUInstanceCuller, use ReductionMode::Max
+/// for the standard depth and ReductionMode::Min for the reversed depth, so that every
+/// texel contains the farthest depth.
+///
+/// \remarks    The builder requires compute shader support, see IsSupported().
+///             The object is not thread-safe.
+class HiZPyramidBuilder
+{
+public:
+    /// Depth reduction mode.
+    enum class ReductionMode : Uint8
+    {
+        /// Every texel contains the minimum depth, the pyramid format is TEX_FORMAT_R32_FLOAT.
+        Min,
+
+        /// Every texel contains the maximum depth, the pyramid format is TEX_FORMAT_R32_FLOAT.
+        Max,
+
+        /// Every texel contains the minimum depth in the red channel and the maximum depth
+        /// in the green channel, the pyramid format is TEX_FORMAT_RG32_FLOAT.
+        MinMax
+    };
+
+    HiZPyramidBuilder(IRenderDevice* pDevice, ReductionMode Mode);
+    ~HiZPyramidBuilder();
+
+    // clang-format off
+    HiZPyramidBuilder           (const HiZPyramidBuilder&)  = delete;
+    HiZPyramidBuilder           (      HiZPyramidBuilder&&) = delete;
+    HiZPyramidBuilder& operator=(const HiZPyramidBuilder&)  = delete;
+    HiZPyramidBuilder& operator=(      HiZPyramidBuilder&&) = delete;
+    // clang-format on
+
+    /// Returns true if the builder is supported by the device.
+    static bool IsSupported(IRenderDevice* pDevice);
+
+    /// Build attributes
+    struct BuildAttribs
+    {
+        /// Shader resource view of the depth buffer.
+
+        /// The view must reference a single-sampled 2D texture with one mip level
+        /// and a single-channel floating-point or normalized format, e.g. the default
+        /// shader resource view of a TEX_FORMAT_D32_FLOAT texture.
+        ITextureView* pDepthSRV = nullptr;
+    };
+
+    /// Builds the pyramid.
+
+    /// \remarks    The pyramid is recreated when the depth buffer size changes.
+    ///             The depth buffer is transitioned to the shader resource state.
+    ///             When the method returns, the whole pyramid is in the shader resource state.
+    void Build(IDeviceContext* pContext, const BuildAttribs& Attribs);
+
+    /// Returns the pyramid texture, or null if the pyramid has not been built yet.
+    ITexture* GetPyramid() const { return m_pPyramid; }
+
+    /// Returns the shader resource view of all levels of the pyramid, or null if the pyramid has not been built yet.
+    ITextureView* GetPyramidSRV() const { return m_pPyramid ? m_pPyramid->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE) : nullptr; }
+
+    /// Returns the reduction mode.
+    ReductionMode GetReductionMode() const { return m_Mode; }
+
+    /// The maximum number of levels built by a single dispatch.
+    static constexpr Uint32 MaxLevelsPerDispatch = 4;
+
+private:
+    struct PipelineInfo
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    bool CreatePipeline(bool SourceIsDepth, PipelineInfo& Pipeline);
+    bool CreatePyramid(Uint32 DepthWidth, Uint32 DepthHeight);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IBuffer>       m_pConstants;
+
+    const ReductionMode m_Mode;
+
+    PipelineInfo m_DepthPipeline;
+    PipelineInfo m_LevelPipeline;
+
+    RefCntAutoPtr<ITexture> m_pPyramid;
+
+    // Per-mip views
+    std::vector<RefCntAutoPtr<ITextureView>> m_MipSRVs;
+    std::vector<RefCntAutoPtr<ITextureView>> m_MipUAVs;
+
+    Uint32 m_DepthWidth  = 0;
+    Uint32 m_DepthHeight = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Mesh optimization utilities: vertex cache and overdraw reordering, vertex fetch remapping
+/// and vertex attribute quantization.
+///
+/// The typical pipeline for a triangle list before it is uploaded into IVertexPool
+/// or IBufferSuballocator is:
+///
+///     OptimizeVertexCache(Indices, Indices, NumIndices, NumVertices);
+///     OptimizeOverdraw(Indices, Indices, NumIndices, Positions, sizeof(float3), NumVertices);
+///     NumVertices = OptimizeVertexFetchRemap(Remap, Indices, NumIndices, NumVertices);
+///     RemapIndices(Indices, Indices, NumIndices, Remap);
+///     RemapVertices(Vertices, Vertices, OldNumVertices, VertexStride, Remap);
+///     QuantizeAttributes(...);
+///
+/// All index functions are available for Uint16 and Uint32 indices.
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+struct IThreadPool;
+
+/// Reorders the triangles to improve the post-transform vertex cache efficiency.
+
+/// \param [out] pDstIndices - Destination index buffer. May be the same as pIndices.
+/// \param [in]  pIndices    - Source triangle list.
+/// \param [in]  NumIndices  - The number of indices, must be a multiple of 3.
+/// \param [in]  NumVertices - The number of vertices. All indices must be less than this value.
+///
+/// \remarks    The function uses the Forsyth algorithm with a 32-entry LRU cache model,
+///             which works well for all GPUs without tuning for a specific cache size.
+///             The triangle winding is preserved.
+template <typename IndexType>
+void OptimizeVertexCache(IndexType* pDstIndices, const IndexType* pIndices, size_t NumIndices, size_t NumVertices);
+
+/// Reorders the triangles to reduce the pixel overdraw.
+
+/// \param [out] pDstIndices    - Destination index buffer. May be the same as pIndices.
+/// \param [in]  pIndices       - Source triangle list, should be optimized by OptimizeVertexCache().
+/// \param [in]  NumIndices     - The number of indices, must be a multiple of 3.
+/// \param [in]  pPositions     - Pointer to the first vertex position. Every position is three floats.
+/// \param [in]  PositionStride - Distance between consecutive positions, in bytes.
+/// \param [in]  NumVertices    - The number of vertices.
+/// \param [in]  Threshold      - The maximum allowed degradation of the vertex cache efficiency.
+///                               For example, 1.05 allows the ACMR to grow by up to 5%.
+///
+/// \remarks    The triangles are split into clusters at the points where the vertex cache
+///             is effectively flushed. The clusters are then sorted so that the ones facing
+///             away from the mesh center are drawn first, as they are more likely to occlude
+///             the others. This approach is view-independent.
+template <typename IndexType>
+void OptimizeOverdraw(IndexType*       pDstIndices,
+                      const IndexType* pIndices,
+                      size_t           NumIndices,
+                      const void*      pPositions,
+                      size_t           PositionStride,
+                      size_t           NumVertices,
+                      float            Threshold = 1.05f);
+
+/// Computes the vertex remap table that orders the vertices by their first use in the index buffer.
+
+/// \param [out] pRemap      - Remap table with NumVertices elements. Vertices that are not referenced
+///                            by the index buffer are mapped to ~0u.
+/// \param [in]  pIndices    - Triangle list, should be optimized by OptimizeVertexCache() and OptimizeOverdraw().
+/// \param [in]  NumIndices  - The number of indices.
+/// \param [in]  NumVertices - The number of vertices.
+///
+/// \return     The number of vertices referenced by the index buffer, which is the size
+///             of the remapped vertex buffer.
+///
+/// \remarks    Apply the table with RemapIndices() and RemapVertices(). The resulting vertex
+///             buffer is accessed almost sequentially, which improves the vertex fetch efficiency.
+template <typename IndexType>
+Uint32 OptimizeVertexFetchRemap(Uint32* pRemap, const IndexType* pIndices, size_t NumIndices, size_t NumVertices);
+
+/// Applies the remap table to the index buffer.
+
+/// \param [out] pDstIndices - Destination index buffer. May be the same as pIndices.
+/// \param [in]  pIndices    - Source index buffer.
+/// \param [in]  NumIndices  - The number of indices.
+/// \param [in]  pRemap      - Remap table, see OptimizeVertexFetchRemap().
+template <typename IndexType>
+void RemapIndices(IndexType* pDstIndices, const IndexType* pIndices, size_t NumIndices, const Uint32* pRemap);
+
+/// Applies the remap table to the vertex buffer.
+
+/// \param [out] pDstVertices - Destination vertex buffer. May be the same as pVertices.
+/// \param [in]  pVertices    - Source vertex buffer.
+/// \param [in]  NumVertices  - The number of vertices in the source buffer.
+/// \param [in]  VertexStride - Vertex size, in bytes.
+/// \param [in]  pRemap       - Remap table, see OptimizeVertexFetchRemap().
+///
+/// \remarks    Vertices that are mapped to ~0u are dropped.
+void RemapVertices(void* pDstVertices, const void* pVertices, size_t NumVertices, size_t VertexStride, const Uint32* pRemap);
+
+
+/// Post-transform vertex cache statistics, see AnalyzeVertexCache().
+struct VertexCacheStatistics
+{
+    /// The number of vertex shader invocations.
+    Uint32 VerticesTransformed = 0;
+
+    /// Average cache miss ratio: the number of transformed vertices per triangle.
+    /// The best possible value is about 0.5, the worst is 3.
+    float ACMR = 0;
+
+    /// Average transform to vertex ratio: the number of transformed vertices per referenced vertex.
+    /// The best possible value is 1.
+    float ATVR = 0;
+};
+
+/// Simulates a FIFO post-transform vertex cache and returns the statistics.
+
+/// \param [in] pIndices    - Triangle list.
+/// \param [in] NumIndices  - The number of indices, must be a multiple of 3.
+/// \param [in] NumVertices - The number of vertices.
+/// \param [in] CacheSize   - The number of entries in the cache.
+template <typename IndexType>
+VertexCacheStatistics AnalyzeVertexCache(const IndexType* pIndices, size_t NumIndices, size_t NumVertices, Uint32 CacheSize = 16);
+
+
+/// QuantizeAttributes function attributes
+struct QuantizeAttributesAttribs
+{
+    /// Source floating-point values.
+    const float* pSrc = nullptr;
+
+    /// Destination values.
+    void* pDst = nullptr;
+
+    /// The number of values to convert.
+    size_t NumValues = 0;
+
+    /// Destination value type.
+
+    /// - VT_UINT8 and VT_UINT16 - normalized unsigned integers. Source values are clamped to [0, 1].
+    /// - VT_INT8 and VT_INT16 - normalized signed integers. Source values are clamped to [-1, 1].
+    /// - VT_FLOAT16 - half-precision floats.
+    ///
+    /// The resulting values should be declared in the input layout with the same
+    /// value type and LayoutElement::IsNormalized set to true for integer types.
+    VALUE_TYPE DstType = VT_UNDEFINED;
+
+    /// Optional thread pool.
+
+    /// If the pool is provided, large arrays are split into chunks that are processed in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Quantizes floating-point vertex attributes to compact formats.
+
+/// \remarks    The conversion uses SSE2 or NEON instructions when available.
+///             Values are rounded to the nearest representable value.
+///             The function returns false if the attributes are invalid.
+bool QuantizeAttributes(const QuantizeAttributesAttribs& Attribs);
+
+/// Quantizes a value in [0, 1] range to an unsigned normalized integer with the given number of bits.
+inline Uint32 QuantizeUNorm(float Value, Uint32 Bits)
+{
+    const float Scale = static_cast<float>((1u << Bits) - 1u);
+    Value             = clamp(Value, 0.f, 1.f);
+    return static_cast<Uint32>(Value * Scale + 0.5f);
+}
+
+/// Quantizes a value in [-1, 1] range to a signed normalized integer with the given number of bits.
+inline Int32 QuantizeSNorm(float Value, Uint32 Bits)
+{
+    const float Scale = static_cast<float>((1u << (Bits - 1u)) - 1u);
+    Value             = clamp(Value, -1.f, 1.f);
+    const float Round = Value >= 0 ? 0.5f : -0.5f;
+    return static_cast<Int32>(Value * Scale + Round);
+}
+
+/// Converts a float to a half-precision float, rounding to the nearest even value.
+Uint16 QuantizeHalf(float Value);
+
+} // namespace Diligent
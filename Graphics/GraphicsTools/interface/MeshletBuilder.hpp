@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Meshlet generation utilities for mesh shader pipelines
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/GraphicsTypes.h"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+struct IThreadPool;
+
+/// Meshlet description, the layout of the elements of MeshletData::Meshlets.
+struct MeshletDesc
+{
+    /// Offset of the first meshlet vertex in MeshletData::VertexIndices.
+    Uint32 VertexOffset = 0;
+
+    /// The number of meshlet vertices.
+    Uint32 VertexCount = 0;
+
+    /// Offset of the first meshlet triangle in MeshletData::PrimitiveIndices.
+    Uint32 PrimitiveOffset = 0;
+
+    /// The number of meshlet triangles.
+    Uint32 PrimitiveCount = 0;
+};
+static_assert(sizeof(MeshletDesc) == 16, "Meshlet description is expected to be 16 bytes");
+
+/// Meshlet culling bounds, the layout of the elements of MeshletData::Bounds.
+
+/// The meshlet can be culled if it is outside of the view frustum or occluded
+/// when tested against the bounding sphere.
+///
+/// The meshlet is back-facing and can be culled when
+///
+///     dot(normalize(ConeApex - CameraPosition), ConeAxis) >= ConeCutoff
+///
+/// Meshlets with wide normal cones have ConeCutoff = 1 and are never culled by this test.
+/// With orthographic projection, use dot(ViewDirection, ConeAxis) >= ConeCutoff instead.
+struct MeshletBounds
+{
+    /// Center of the bounding sphere.
+    float3 Center;
+
+    /// Radius of the bounding sphere.
+    float Radius = 0;
+
+    /// Apex of the normal cone.
+    float3 ConeApex;
+
+    /// Sine of the normal cone half-angle, see the test above.
+    float ConeCutoff = 1;
+
+    /// Normalized axis of the normal cone.
+    float3 ConeAxis;
+
+    float Padding = 0;
+};
+static_assert(sizeof(MeshletBounds) == 48, "Meshlet bounds are expected to be 48 bytes");
+
+/// BuildMeshlets function attributes
+struct BuildMeshletsAttribs
+{
+    /// Pointer to the index data. Every three indices form a triangle.
+    const void* pIndices = nullptr;
+
+    /// Index type, must be VT_UINT16 or VT_UINT32.
+    VALUE_TYPE IndexType = VT_UINT32;
+
+    /// The number of indices, must be a multiple of 3.
+    Uint32 NumIndices = 0;
+
+    /// Pointer to the first vertex position. Every position is three floats.
+    const void* pPositions = nullptr;
+
+    /// Distance between consecutive positions, in bytes.
+    Uint32 PositionStride = sizeof(float3);
+
+    /// The number of vertices. All indices must be less than this value.
+    Uint32 NumVertices = 0;
+
+    /// The maximum number of vertices in a meshlet, must not exceed 256.
+    Uint32 MaxVertices = 64;
+
+    /// The maximum number of triangles in a meshlet, must not exceed 256.
+    Uint32 MaxPrimitives = 124;
+
+    /// Optional mesh shader properties of the adapter, see GraphicsAdapterInfo::MeshShader.
+
+    /// If not null, MaxVertices and MaxPrimitives are clamped to the output limits of the adapter.
+    const MeshShaderProperties* pMeshShaderProps = nullptr;
+
+    /// Optional thread pool.
+
+    /// If the pool is provided, the triangles are split into contiguous groups
+    /// that are processed in parallel. The function still returns only after
+    /// all meshlets have been built.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Meshlets produced by BuildMeshlets().
+
+/// All arrays are tightly packed and consist of 4-byte or 16-byte elements, so they can be
+/// uploaded as is into structured or raw buffers, or buffer suballocations (see IBufferSuballocator)
+/// and vertex pool allocations (see IVertexPool). The offsets in MeshletDesc are relative to the
+/// beginning of the arrays: when the data is placed into a suballocation, the shader should add the
+/// offset of the allocation.
+struct MeshletData
+{
+    /// Meshlet descriptions.
+    std::vector<MeshletDesc> Meshlets;
+
+    /// Culling bounds of every meshlet.
+    std::vector<MeshletBounds> Bounds;
+
+    /// Indices of the meshlet vertices in the original vertex buffer.
+    std::vector<Uint32> VertexIndices;
+
+    /// Meshlet triangles. Every element packs the three meshlet-local vertex indices of
+    /// a triangle into bits 0-7, 8-15, and 16-23.
+    std::vector<Uint32> PrimitiveIndices;
+};
+
+/// Splits the triangle list into meshlets for mesh shader pipelines.
+
+/// \param [in]  Attribs - Build attributes, see Diligent::BuildMeshletsAttribs.
+/// \param [out] Data    - Generated meshlets. Any previous contents are replaced.
+///
+/// \remarks    Every meshlet is grown greedily from a seed triangle by adding the adjacent
+///             triangle that introduces the fewest new vertices, breaking ties by the distance
+///             to the meshlet center. When there are no adjacent triangles, the closest remaining
+///             triangle is used. This keeps the meshlets compact and fully occupied, which is
+///             what mostly determines the mesh shader throughput and the culling efficiency.
+///
+///             The function returns false if the attributes are invalid.
+bool BuildMeshlets(const BuildMeshletsAttribs& Attribs, MeshletData& Data);
+
+/// Computes the culling bounds of a meshlet.
+
+/// \param [in] Attribs    - Attributes that were used to build the meshlet. Only the positions are used.
+/// \param [in] Data       - Meshlet data.
+/// \param [in] MeshletIdx - Meshlet index.
+///
+/// \remarks    BuildMeshlets() computes the bounds of all meshlets. This function is useful
+///             when the meshlets are modified afterwards.
+MeshletBounds ComputeMeshletBounds(const BuildMeshletsAttribs& Attribs, const MeshletData& Data, Uint32 MeshletIdx);
+
+} // namespace Diligent
@@ -26,12 +26,73 @@
 
 #pragma once
 
+#include <functional>
+
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/SwapChain.h"
 
 namespace Diligent
 {
 
+/// Contents of a frame presented by the off-screen swap chain.
+struct OffScreenFrameData
+{
+    /// Pointer to the frame pixels.
+
+    /// \remarks    The pointer references the mapped staging memory
+    ///             and is only valid during the callback.
+    const void* pData = nullptr;
+
+    /// Row stride, in bytes.
+    Uint64 RowStride = 0;
+
+    /// Frame width, in pixels.
+    Uint32 Width = 0;
+
+    /// Frame height, in pixels.
+    Uint32 Height = 0;
+
+    /// Pixel format.
+    TEXTURE_FORMAT Format = TEX_FORMAT_UNKNOWN;
+
+    /// Index of the frame, counted from zero.
+    Uint64 FrameIndex = 0;
+};
+
+/// Off-screen swap chain frame callback.
+using OffScreenFrameCallbackType = std::function<void(const OffScreenFrameData& Frame)>;
+
+/// Off-screen swap chain frame readback attributes.
+struct OffScreenSwapChainReadbackAttribs
+{
+    /// Callback that receives the contents of every presented frame.
+
+    /// The callback is called from IDeviceContext::Present() of the swap chain,
+    /// from the thread that presents the frames, in presentation order.
+    OffScreenFrameCallbackType FrameCallback;
+
+    /// The number of frames that may be read back at the same time.
+
+    /// Every frame is copied to its own staging texture, so that the readback of one
+    /// frame overlaps the rendering of the next ones. When all staging textures are busy,
+    /// Present() waits for the oldest frame.
+    Uint32 NumStagingTextures = 3;
+};
+
+/// Creates an off-screen swap chain.
 void CreateOffScreenSwapChain(IRenderDevice* pDevice, IDeviceContext* pContext, const SwapChainDesc& SCDesc, ISwapChain** ppSwapChain);
 
+/// Creates an off-screen swap chain that reads back every presented frame.
+
+/// The swap chain uses SwapChainDesc::BufferCount render targets in a ring,
+/// and Present() copies the current render target to a ring of staging textures.
+/// Frames are delivered to ReadbackAttribs.FrameCallback as soon as the GPU has
+/// finished the copy without an extra CPU copy. When the swap chain is resized or
+/// destroyed, all pending frames are delivered first.
+void CreateOffScreenSwapChain(IRenderDevice*                           pDevice,
+                              IDeviceContext*                          pContext,
+                              const SwapChainDesc&                     SCDesc,
+                              const OffScreenSwapChainReadbackAttribs& ReadbackAttribs,
+                              ISwapChain**                             ppSwapChain);
+
 } // namespace Diligent
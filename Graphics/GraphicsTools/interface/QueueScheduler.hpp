@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <string>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Helper class that schedules work on several immediate contexts (command queues)
+/// and synchronizes it with fences.
+
+/// The work is described by passes that are added in submission order. Each pass is recorded
+/// into one immediate context and may depend on earlier passes recorded into other contexts.
+/// When the passes are executed, the scheduler signals a fence after every pass that another
+/// context depends on and flushes the context, so that the dependent contexts can wait for the fence
+/// on the GPU. Independent passes on different queues, for instance uploads on the transfer queue
+/// or compute work, overlap with each other while all dependencies are respected.
+///
+/// \remarks    Resources used by several contexts must have the corresponding bits set in their
+///             ImmediateContextMask. Such resources are accessible by all these queues (in Vulkan,
+///             they are created with VK_SHARING_MODE_CONCURRENT), so no explicit ownership
+///             release/acquire is required. The queue that uses the resource next only needs to
+///             transition it to the required state after the wait, which is what the pass barriers
+///             (see PassDesc::pBarriers) are for.
+///
+///             The scheduler is not thread-safe and must be used by the thread that owns the contexts.
+class QueueScheduler
+{
+public:
+    /// Pass handle returned by AddPass().
+    using PassHandle = Uint32;
+
+    /// Callback that records the pass commands into the immediate context.
+    using RecordPassCallbackType = std::function<void(IDeviceContext* pContext)>;
+
+    /// Pass description.
+    struct PassDesc
+    {
+        /// Pass name used for debug groups.
+        const char* Name = nullptr;
+
+        /// Index of the context in the array given to the constructor that records the pass.
+        Uint32 ContextIndex = 0;
+
+        /// Passes that must be completed before this pass starts.
+        /// Only passes added earlier may be referenced.
+        const PassHandle* pDependencies = nullptr;
+
+        /// The number of elements in pDependencies array.
+        Uint32 NumDependencies = 0;
+
+        /// State transitions performed by the context before the pass is recorded.
+
+        /// Resources that were previously used by another queue should be transitioned
+        /// here once the dependencies have been satisfied.
+        const StateTransitionDesc* pBarriers = nullptr;
+
+        /// The number of elements in pBarriers array.
+        Uint32 NumBarriers = 0;
+    };
+
+    /// Creates the scheduler.
+
+    /// \param [in] pDevice     - Render device.
+    /// \param [in] ppContexts  - Immediate contexts the passes will be recorded into.
+    /// \param [in] NumContexts - The number of contexts in ppContexts array.
+    QueueScheduler(IRenderDevice*         pDevice,
+                   IDeviceContext* const* ppContexts,
+                   Uint32                 NumContexts);
+
+    // clang-format off
+    QueueScheduler           (const QueueScheduler&) = delete;
+    QueueScheduler& operator=(const QueueScheduler&) = delete;
+    QueueScheduler           (QueueScheduler&&)      = default;
+    QueueScheduler& operator=(QueueScheduler&&)      = delete;
+    // clang-format on
+
+    /// Adds a pass and returns its handle.
+
+    /// \param [in] Desc     - Pass description.
+    /// \param [in] Callback - Callback that records the pass commands. The callback
+    ///                        is called by Execute().
+    /// \return                Pass handle that can be used as a dependency of subsequent passes.
+    PassHandle AddPass(const PassDesc& Desc, RecordPassCallbackType Callback);
+
+    /// Records all passes in the order they were added and submits them to the queues.
+    /// All passes are removed afterwards and handles returned by AddPass() become invalid.
+    void Execute();
+
+    /// Returns the fence that is signaled by the context with the given index.
+    IFence* GetFence(Uint32 ContextIndex) const;
+
+    /// Returns the last value the fence of the context with the given index has been signaled with.
+
+    /// \remarks    Waiting for this value on the CPU, see IFence::Wait(), ensures that all passes
+    ///             recorded into the context by the last Execute() call have been completed.
+    Uint64 GetLastSignaledValue(Uint32 ContextIndex) const;
+
+private:
+    struct ContextInfo
+    {
+        RefCntAutoPtr<IDeviceContext> pContext;
+        RefCntAutoPtr<IFence>         pFence;
+
+        Uint64 LastSignaledValue = 0;
+    };
+    std::vector<ContextInfo> m_Contexts;
+
+    // The last fence values each context has waited for, indexed by
+    // [WaitingContext * m_Contexts.size() + SignalingContext].
+    std::vector<Uint64> m_WaitedValues;
+
+    struct PassInfo
+    {
+        std::string                      Name;
+        Uint32                           ContextIndex = 0;
+        std::vector<PassHandle>          Dependencies;
+        std::vector<StateTransitionDesc> Barriers;
+        RecordPassCallbackType           Callback;
+    };
+    std::vector<PassInfo> m_Passes;
+};
+
+} // namespace Diligent
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of ReadbackQueue interface and related data structures
+
+#include <functional>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+
+namespace Diligent
+{
+
+// {5ACBDBC2-017C-43B4-8A57-28CA74E253ED}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_ReadbackQueue =
+    {0x5acbdbc2, 0x17c, 0x43b4, {0x8a, 0x57, 0x28, 0xca, 0x74, 0xe2, 0x53, 0xed}};
+
+
+/// Data that was read back from the GPU.
+struct ReadbackData
+{
+    /// Pointer to the data.
+
+    /// \remarks    The pointer is only valid during the callback.
+    const void* pData = nullptr;
+
+    /// Data size, in bytes.
+    Uint64 DataSize = 0;
+
+    /// Row stride, in bytes, for texture data. Zero for buffer data.
+    Uint64 RowStride = 0;
+
+    /// Width of the texture region, in texels. Zero for buffer data.
+    Uint32 Width = 0;
+
+    /// Height of the texture region, in texels. Zero for buffer data.
+    Uint32 Height = 0;
+};
+
+/// Readback callback.
+
+/// The callback is invoked exactly once for every read. If the read failed
+/// (e.g. the readback queue was destroyed before the GPU completed the copy),
+/// ReadbackData::pData is null.
+using ReadbackCallbackType = std::function<void(const ReadbackData& Data)>;
+
+
+/// Readback queue create information.
+struct ReadbackQueueCreateInfo
+{
+    /// Readback queue name.
+    const Char* Name = nullptr;
+
+    /// Maximum total size of staging buffers that are kept for reuse, in bytes.
+
+    /// Staging buffers that do not fit into the limit are released when their
+    /// reads complete. Zero means no limit.
+    Uint64 MaxPooledMemorySize = 64 << 20;
+
+    /// Whether to defer callbacks until IReadbackQueue::InvokeCallbacks() is called.
+
+    /// When this flag is false, callbacks are invoked by IReadbackQueue::ProcessCompleted()
+    /// directly from the mapped staging memory. When this flag is true, ProcessCompleted()
+    /// copies the data to CPU memory, and the callbacks are invoked by
+    /// IReadbackQueue::InvokeCallbacks(), which can be called from any thread.
+    bool DeferCallbacks = false;
+};
+
+
+/// Asynchronous GPU readback queue.
+
+/// The queue copies GPU resources to pooled staging resources, signals a fence
+/// after every copy, and invokes the user callback once the fence has passed.
+/// The queue never waits for the GPU.
+///
+/// \remarks    ReadBuffer(), ReadTexture() and ProcessCompleted() must be called from the
+///             thread that owns the device context. All reads must be enqueued in the same
+///             immediate context. InvokeCallbacks() is thread-safe.
+struct IReadbackQueue : public IObject
+{
+    /// Enqueues a buffer read.
+
+    /// \param [in] pContext       - Immediate device context to record the copy.
+    /// \param [in] pSrcBuffer     - Buffer to read from.
+    /// \param [in] Offset         - Offset of the data in the buffer, in bytes.
+    /// \param [in] Size           - Size of the data, in bytes.
+    /// \param [in] Callback       - Callback to invoke when the data is available.
+    /// \param [in] TransitionMode - Source buffer state transition mode.
+    virtual void ReadBuffer(IDeviceContext*                pContext,
+                            IBuffer*                       pSrcBuffer,
+                            Uint64                         Offset,
+                            Uint64                         Size,
+                            ReadbackCallbackType           Callback,
+                            RESOURCE_STATE_TRANSITION_MODE TransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION) = 0;
+
+    /// Enqueues a read of a 2D texture region.
+
+    /// \param [in] pContext       - Immediate device context to record the copy.
+    /// \param [in] pSrcTexture    - Texture to read from.
+    /// \param [in] MipLevel       - Mip level to read.
+    /// \param [in] Slice          - Array slice to read.
+    /// \param [in] pSrcBox        - Region to read. If null, the entire mip level is read.
+    /// \param [in] Callback       - Callback to invoke when the data is available.
+    /// \param [in] TransitionMode - Source texture state transition mode.
+    virtual void ReadTexture(IDeviceContext*                pContext,
+                             ITexture*                      pSrcTexture,
+                             Uint32                         MipLevel,
+                             Uint32                         Slice,
+                             const Box*                     pSrcBox,
+                             ReadbackCallbackType           Callback,
+                             RESOURCE_STATE_TRANSITION_MODE TransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION) = 0;
+
+    /// Processes the reads that have been completed by the GPU.
+
+    /// \param [in] pContext - Immediate device context to map staging resources.
+    /// \return     The number of completed reads.
+    ///
+    /// \remarks    The method never waits for the GPU.
+    virtual Uint32 ProcessCompleted(IDeviceContext* pContext) = 0;
+
+    /// Invokes deferred callbacks, see ReadbackQueueCreateInfo::DeferCallbacks.
+
+    /// \return     The number of invoked callbacks.
+    ///
+    /// \remarks    This method can be called from any thread.
+    virtual Uint32 InvokeCallbacks() = 0;
+
+    /// Returns the number of reads that have not been completed by the GPU yet.
+    virtual Uint32 GetNumPendingReads() const = 0;
+
+    /// Returns the total size of pooled staging buffers, in bytes.
+    virtual Uint64 GetPooledMemorySize() const = 0;
+};
+
+
+/// Creates a new readback queue.
+
+/// \param[in]  pDevice         - Pointer to the render device.
+/// \param[in]  CreateInfo      - Readback queue create info, see Diligent::ReadbackQueueCreateInfo.
+/// \param[out] ppReadbackQueue - Memory location where pointer to the readback queue will be written.
+void CreateReadbackQueue(IRenderDevice*                 pDevice,
+                         const ReadbackQueueCreateInfo& CreateInfo,
+                         IReadbackQueue**               ppReadbackQueue);
+
+} // namespace Diligent
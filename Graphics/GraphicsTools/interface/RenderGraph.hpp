@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of RenderGraph class
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/ThreadPool.h"
+#include "TransientTextureAllocator.hpp"
+
+namespace Diligent
+{
+
+class RenderGraph;
+
+/// Render graph create information.
+struct RenderGraphCreateInfo
+{
+    /// Render graph name.
+    const Char* Name = nullptr;
+
+    /// Whether to skip the passes whose results are not used.
+
+    /// \remarks    A pass is used if it has side effects (see RenderGraphPassBuilder::SetSideEffects()),
+    ///             writes to an imported resource, or writes to a resource that is read by a used pass.
+    bool EnablePassCulling = true;
+
+    /// Transient texture allocator settings, see Diligent::TransientTextureAllocatorCreateInfo.
+    bool EnableAliasing   = true;
+    bool EnableMemoryless = true;
+};
+
+/// Render graph statistics.
+struct RenderGraphStats
+{
+    /// The number of passes added to the graph.
+    Uint32 NumPasses = 0;
+
+    /// The number of passes that were culled.
+    Uint32 NumCulledPasses = 0;
+
+    /// The number of transient textures used by the executed passes.
+    Uint32 NumTransientTextures = 0;
+
+    /// The number of state transitions recorded by the graph.
+    Uint32 NumTransitions = 0;
+
+    /// The number of TransitionResourceStates() calls issued by the graph.
+    Uint32 NumTransitionBatches = 0;
+
+    /// Transient texture allocator statistics.
+    TransientTextureAllocatorStats Allocator;
+};
+
+/// Render graph pass execute callback.
+
+/// \param [in] pContext - Device context to record the pass commands.
+/// \param [in] Graph    - Render graph; use RenderGraph::GetTexture() and
+///                        RenderGraph::GetBuffer() to access the pass resources.
+///
+/// \remarks    The graph transitions all resources declared by the pass to the required states,
+///             so the callback should use RESOURCE_STATE_TRANSITION_MODE_VERIFY or
+///             RESOURCE_STATE_TRANSITION_MODE_NONE for these resources.
+///             The callback may be called from a worker thread (see RenderGraph::Execute()).
+using RenderGraphExecuteCallbackType = std::function<void(IDeviceContext* pContext, const RenderGraph& Graph)>;
+
+/// Declares the resources accessed by a render graph pass.
+class RenderGraphPassBuilder
+{
+public:
+    /// Declares that the pass reads the resource in the given state.
+    RenderGraphPassBuilder& Read(Uint32 Resource, RESOURCE_STATE State = RESOURCE_STATE_SHADER_RESOURCE);
+
+    /// Declares that the pass writes the resource in the given state.
+
+    /// \remarks    The previous contents of the resource are considered overwritten. If the pass
+    ///             preserves the contents (e.g. loads a render target), it must also read the resource.
+    RenderGraphPassBuilder& Write(Uint32 Resource, RESOURCE_STATE State = RESOURCE_STATE_RENDER_TARGET);
+
+    /// Marks the pass as having side effects that are not visible to the graph.
+    /// Such passes are never culled.
+    RenderGraphPassBuilder& SetSideEffects();
+
+private:
+    friend RenderGraph;
+    RenderGraphPassBuilder(RenderGraph& Graph, Uint32 Pass) noexcept :
+        m_Graph{Graph},
+        m_Pass{Pass}
+    {}
+
+    RenderGraph& m_Graph;
+    const Uint32 m_Pass;
+};
+
+/// Render graph.
+
+/// The graph schedules the passes of a frame. Each pass declares the resources it reads
+/// and writes. At compile time, the graph:
+///     - culls the passes whose results are not used;
+///     - allocates transient textures with TransientTextureAllocator, aliasing the memory
+///       of textures with disjoint lifetimes;
+///     - computes state transitions and batches them into one call per pass.
+///
+/// Execute() records the passes in declaration order, either in the immediate context or
+/// in parallel in deferred contexts that are then executed in order.
+///
+/// A typical frame looks as follows:
+///
+///     Graph.Reset();
+///     auto BackBuffer = Graph.ImportTexture(pBackBuffer, RESOURCE_STATE_PRESENT);
+///     auto HDR        = Graph.CreateTexture(HDRDesc);
+///     Graph.AddPass("Scene", DrawScene).Write(HDR);
+///     Graph.AddPass("Tonemap", Tonemap).Read(HDR).Write(BackBuffer);
+///     Graph.Compile(pContext);
+///     Graph.Execute(pContext);
+///
+/// \remarks    The graph is not thread-safe.
+class RenderGraph
+{
+public:
+    /// Invalid resource handle.
+    static constexpr Uint32 InvalidResource = ~0u;
+
+    RenderGraph(IRenderDevice* pDevice, const RenderGraphCreateInfo& CreateInfo);
+
+    // clang-format off
+    RenderGraph           (const RenderGraph&)  = delete;
+    RenderGraph& operator=(const RenderGraph&)  = delete;
+    RenderGraph           (      RenderGraph&&) = delete;
+    RenderGraph& operator=(      RenderGraph&&) = delete;
+    // clang-format on
+
+    ~RenderGraph();
+
+    /// Removes all passes and resources. Call this method at the beginning of every frame.
+
+    /// \remarks    Transient texture objects and memory are kept and reused when
+    ///             the same textures are declared again.
+    void Reset();
+
+    /// Imports an external texture.
+
+    /// \param[in] pTexture   - Texture to import. The texture state must be known.
+    /// \param[in] FinalState - State to transition the texture to after the last pass.
+    ///                         If RESOURCE_STATE_UNKNOWN, the texture is left in the state
+    ///                         required by the last pass that accesses it.
+    ///
+    /// \return     Resource handle.
+    Uint32 ImportTexture(ITexture* pTexture, RESOURCE_STATE FinalState = RESOURCE_STATE_UNKNOWN);
+
+    /// Imports an external buffer, see ImportTexture().
+    Uint32 ImportBuffer(IBuffer* pBuffer, RESOURCE_STATE FinalState = RESOURCE_STATE_UNKNOWN);
+
+    /// Declares a transient texture whose contents only live within the frame.
+
+    /// \param[in] Desc  - Texture description. Usage must be USAGE_DEFAULT.
+    /// \param[in] Flags - Transient texture flags, see Diligent::TRANSIENT_TEXTURE_FLAGS.
+    ///
+    /// \return     Resource handle.
+    Uint32 CreateTexture(const TextureDesc& Desc, TRANSIENT_TEXTURE_FLAGS Flags = TRANSIENT_TEXTURE_FLAG_NONE);
+
+    /// Adds a pass.
+
+    /// \param[in] Name    - Pass name.
+    /// \param[in] Execute - Callback that records the pass commands.
+    ///
+    /// \return     Pass builder that declares the resources accessed by the pass.
+    RenderGraphPassBuilder AddPass(const Char* Name, RenderGraphExecuteCallbackType Execute);
+
+    /// Culls passes, allocates transient textures and computes state transitions.
+
+    /// \param[in] pContext - Immediate device context that is used to bind the memory
+    ///                       of aliased textures.
+    void Compile(IDeviceContext* pContext);
+
+    /// Records the passes.
+
+    /// \param[in] pContext            - Immediate device context.
+    /// \param[in] ppDeferredContexts  - Deferred contexts to record passes in parallel.
+    ///                                  If null, all passes are recorded in pContext.
+    /// \param[in] NumDeferredContexts - The number of deferred contexts.
+    /// \param[in] pThreadPool         - Thread pool to record deferred contexts. If null,
+    ///                                  deferred contexts are recorded by the calling thread.
+    ///
+    /// \remarks    With deferred contexts, consecutive passes are split into at most NumDeferredContexts
+    ///             groups. Each group is recorded into its own command list, and the command lists
+    ///             are executed in pContext in the pass order.
+    void Execute(IDeviceContext*        pContext,
+                 IDeviceContext* const* ppDeferredContexts  = nullptr,
+                 Uint32                 NumDeferredContexts = 0,
+                 IThreadPool*           pThreadPool         = nullptr);
+
+    /// Returns the texture for the resource handle.
+
+    /// \remarks    Transient textures are only available after Compile().
+    ITexture* GetTexture(Uint32 Resource) const;
+
+    /// Returns the buffer for the resource handle.
+    IBuffer* GetBuffer(Uint32 Resource) const;
+
+    /// Returns true if the pass has been culled by the last Compile().
+    bool IsPassCulled(Uint32 Pass) const;
+
+    /// Returns the render graph statistics, see Diligent::RenderGraphStats.
+    RenderGraphStats GetStats() const;
+
+private:
+    friend RenderGraphPassBuilder;
+    void AddPassAccess(Uint32 Pass, Uint32 Resource, RESOURCE_STATE State, bool IsWrite);
+
+    void CullPasses();
+    void ComputeTransitions();
+    void RecordPass(IDeviceContext* pContext, Uint32 Pass, bool UpdateState);
+    void RecordTransitions(IDeviceContext* pContext, size_t FirstTransition, size_t NumTransitions, bool UpdateState);
+
+    IDeviceObject* GetResourceObject(Uint32 Resource) const;
+
+    struct ResourceInfo
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+        RefCntAutoPtr<IBuffer>  pBuffer;
+
+        // Transient texture description and flags
+        TextureDesc             Desc;
+        TRANSIENT_TEXTURE_FLAGS Flags = TRANSIENT_TEXTURE_FLAG_NONE;
+
+        bool IsImported = false;
+
+        RESOURCE_STATE FinalState = RESOURCE_STATE_UNKNOWN;
+
+        // Transient texture allocator handle
+        Uint32 AllocatorHandle = TransientTextureAllocator::InvalidHandle;
+        Uint32 FirstPass       = ~0u;
+        Uint32 LastPass        = 0;
+
+        // Resource state after all passes, but before the final transition
+        RESOURCE_STATE EndState = RESOURCE_STATE_UNKNOWN;
+    };
+
+    struct ResourceAccess
+    {
+        Uint32         Resource = InvalidResource;
+        RESOURCE_STATE State    = RESOURCE_STATE_UNKNOWN;
+        bool           IsRead   = false;
+        bool           IsWrite  = false;
+    };
+
+    struct Transition
+    {
+        Uint32         Resource = InvalidResource;
+        RESOURCE_STATE OldState = RESOURCE_STATE_UNKNOWN;
+        RESOURCE_STATE NewState = RESOURCE_STATE_UNKNOWN;
+    };
+
+    struct PassInfo
+    {
+        std::string                    Name;
+        RenderGraphExecuteCallbackType Execute;
+        std::vector<ResourceAccess>    Accesses;
+
+        bool HasSideEffects = false;
+        bool IsCulled       = false;
+
+        // Transitions recorded before the pass
+        size_t FirstTransition = 0;
+        size_t NumTransitions  = 0;
+    };
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const std::string m_Name;
+    const bool        m_EnablePassCulling;
+
+    TransientTextureAllocator m_Allocator;
+
+    std::vector<ResourceInfo> m_Resources;
+    std::vector<PassInfo>     m_Passes;
+    std::vector<Transition>   m_Transitions;
+
+    // Transitions of imported resources to their final states
+    size_t m_FirstFinalTransition = 0;
+
+    bool m_IsCompiled = false;
+
+    Uint32 m_NumTransitionBatches = 0;
+};
+
+} // namespace Diligent
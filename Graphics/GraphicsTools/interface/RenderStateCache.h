@@ -76,6 +76,39 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional pipeline state cache to use when creating pipeline states.
+
+    /// \remarks   The cache is passed to the device when pipelines are unpacked from
+    ///             the archive or created from scratch. In OpenGL backend, this allows
+    ///             restoring linked program binaries instead of linking programs from
+    ///             GLSL on every run. The application is responsible for saving the cache
+    ///             data (see IPipelineStateCache::GetData) and for loading it next time.
+    IPipelineStateCache* pPSOCache DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to compress the shader data in the cache written by
+    /// IRenderStateCache::WriteToBlob and IRenderStateCache::WriteToStream.
+    ///
+    /// \remarks    Shader data is compressed with LZ4 separately for each device type.
+    ///             Compressed data is decompressed transparently when the cache is loaded.
+    bool CompressShaders DEFAULT_INITIALIZER(false);
+
+    /// Whether to use source file metadata to speed up shader hashing.
+    ///
+    /// \remarks    By default, every call to IRenderStateCache::CreateShader reads and hashes
+    ///             the shader source and all its includes to find the shader in the cache.
+    ///             When this option is enabled, the cache remembers the size and modification
+    ///             time of every source file of the shader, and reuses the previously computed
+    ///             hash if none of them have changed. The full hash is only recomputed when
+    ///             file metadata changes.
+    ///
+    ///             The option only applies to shaders loaded from files through the factory
+    ///             created by IEngineFactory::CreateDefaultShaderSourceStreamFactory. Other
+    ///             shaders are always hashed by their contents.
+    ///
+    ///             Since modification time has one-second resolution, changes made within
+    ///             the same second that do not change the file size may not be detected.
+    bool UseFileMetadataForShaderHash DEFAULT_INITIALIZER(false);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -85,12 +118,14 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_LOG_LEVEL     _LogLevel          = RenderStateCacheCreateInfo{}.LogLevel,
         bool                             _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                             _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        IPipelineStateCache*             _pPSOCache         = RenderStateCacheCreateInfo{}.pPSOCache) noexcept :
         pDevice{_pDevice},
         LogLevel{_LogLevel},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        pPSOCache{_pPSOCache}
     {}
 #endif
 };
@@ -123,6 +158,8 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     /// Loads the cache contents.
 
     /// \param [in] pCacheData     - A pointer to the cache data to load objects from.
+    ///                              This may be either the data written by WriteToBlob or
+    ///                              WriteToStream, or the journal written by WriteToJournal.
     /// \param [in] ContentVersion - The expected version of the content in the cache.
     ///                              If the version of the content in the cache does not
     ///                              match the expected version, the method will fail.
@@ -228,6 +265,31 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
                                        Uint32       ContentVersion, 
                                        IFileStream* pStream) PURE;
 
+    /// Appends render states created since the last write to a cache journal.
+
+    /// \param [in]  ContentVersion - The version of the content to write.
+    /// \param [in]  pStream        - Pointer to the IFileStream interface of the journal.
+    ///                              The stream must be open for reading and writing.
+    ///
+    /// \return     true if the data was written successfully, and false otherwise.
+    ///
+    /// \remarks    Unlike WriteToStream, this method does not rewrite the entire cache.
+    ///             Only shaders and pipelines added since the previous call to
+    ///             WriteToBlob, WriteToStream or WriteToJournal are appended to the end
+    ///             of the stream as a new record. If nothing was added, the stream is
+    ///             not modified. If the stream is empty, the journal header is written first.
+    ///
+    ///             The journal can be loaded with the Load method, which replays all
+    ///             records and ignores a truncated trailing record (e.g. if the application
+    ///             was terminated while writing it). To compact the journal, load it and
+    ///             write the cache to a new file with WriteToStream.
+    ///
+    ///             If ContentVersion is ~0u (aka 0xFFFFFFFF), the version of the
+    ///             previously loaded content will be used, or 0 if none was loaded.
+    VIRTUAL Bool METHOD(WriteToJournal)(THIS_
+                                        Uint32       ContentVersion,
+                                        IFileStream* pStream) PURE;
+
 
     /// Resets the cache to default state.
     VIRTUAL void METHOD(Reset)(THIS) PURE;
@@ -243,6 +305,21 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// \remars     Reloading is only enabled if the cache was created with the EnableHotReload member of
     ///             RenderStateCacheCreateInfo member set to true.
+    ///
+    ///             The cache tracks the source files of every shader, including all included files.
+    ///             Only the shaders whose source files have changed are recompiled, and only the
+    ///             pipelines that use these shaders are re-created. Graphics pipelines are also
+    ///             re-created when ReloadGraphicsPipeline is not null.
+    ///
+    ///             If the device has a shader compilation thread pool (see IRenderDevice::GetShaderCompilationThreadPool),
+    ///             the shaders are recompiled in parallel. The method only waits for the shaders used by
+    ///             the pipelines that were created without PSO_CREATE_FLAG_ASYNCHRONOUS. Pipelines created with
+    ///             this flag are re-created asynchronously: they keep using the previous version until the new
+    ///             one is ready, and switch to it when they are bound to a device context or their status is queried.
+    ///             If a shader or a pipeline fails to compile, the previous version is kept.
+    ///
+    ///             The method invalidates the process-wide shader include cache so that
+    ///             changed include files are reloaded.
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
@@ -250,6 +327,47 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     /// Returns the content version of the cache data.
     /// If no data has been loaded, returns ~0u (aka 0xFFFFFFFF).
     VIRTUAL Uint32 METHOD(GetContentVersion)(THIS) CONST PURE;
+
+    /// Writes the list of pipeline states requested from the cache to a memory blob.
+
+    /// \param [out] ppBlob - Address of the memory location where a pointer to the created
+    ///                       data blob will be written.
+    ///
+    /// \return     true if the data was written successfully, and false otherwise.
+    ///
+    /// \remarks    The cache records every pipeline state request. Pipelines are written in
+    ///             priority order: the most frequently requested pipelines come first, and
+    ///             pipelines with equal request counts are ordered by their first request.
+    ///             The application should save the data together with the cache contents
+    ///             and pass it to IRenderStateCache::PrewarmPipelines next time it starts.
+    VIRTUAL Bool METHOD(WritePipelineUsage)(THIS_
+                                            IDataBlob** ppBlob) PURE;
+
+    /// Creates pipeline states listed in the usage data ahead of time.
+
+    /// \param [in] pUsageData - Pipeline usage data written by IRenderStateCache::WritePipelineUsage.
+    ///
+    /// \return     The number of pipelines that were scheduled for creation.
+    ///
+    /// \remarks    Pipelines are unpacked from the data loaded by IRenderStateCache::Load in
+    ///             priority order. Pipelines that are not found in the loaded data are skipped.
+    ///             If the device has a shader compilation thread pool (see IRenderDevice::GetShaderCompilationThreadPool),
+    ///             the pipelines are compiled asynchronously by the pool. Use IRenderStateCache::GetPrewarmProgress
+    ///             to track the progress.
+    ///
+    ///             The cache keeps strong references to the pre-warmed pipelines until
+    ///             IRenderStateCache::Reset is called. Subsequent requests for the same pipelines
+    ///             return the pre-warmed objects. If a pipeline is still compiling and the request
+    ///             does not use PSO_CREATE_FLAG_ASYNCHRONOUS, the cache waits for the compilation to finish.
+    VIRTUAL Uint32 METHOD(PrewarmPipelines)(THIS_
+                                            const IDataBlob* pUsageData) PURE;
+
+    /// Returns the number of pre-warmed pipelines that are no longer compiling.
+
+    /// \param [out] pTotalCount - An optional pointer to the variable that will receive the total number
+    ///                            of pipelines scheduled by IRenderStateCache::PrewarmPipelines.
+    VIRTUAL Uint32 METHOD(GetPrewarmProgress)(THIS_
+                                              Uint32* pTotalCount DEFAULT_VALUE(nullptr)) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -266,9 +384,13 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_CreateTilePipelineState(This, ...)       CALL_IFACE_METHOD(RenderStateCache, CreateTilePipelineState,      This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToBlob(This, ...)                   CALL_IFACE_METHOD(RenderStateCache, WriteToBlob,                  This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToStream(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, WriteToStream,                This, __VA_ARGS__)
+#    define IRenderStateCache_WriteToJournal(This, ...)                CALL_IFACE_METHOD(RenderStateCache, WriteToJournal,               This, __VA_ARGS__)
 #    define IRenderStateCache_Reset(This)                              CALL_IFACE_METHOD(RenderStateCache, Reset,                        This)
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
+#    define IRenderStateCache_WritePipelineUsage(This, ...)            CALL_IFACE_METHOD(RenderStateCache, WritePipelineUsage,           This, __VA_ARGS__)
+#    define IRenderStateCache_PrewarmPipelines(This, ...)              CALL_IFACE_METHOD(RenderStateCache, PrewarmPipelines,             This, __VA_ARGS__)
+#    define IRenderStateCache_GetPrewarmProgress(This, ...)            CALL_IFACE_METHOD(RenderStateCache, GetPrewarmProgress,           This, __VA_ARGS__)
 // clang-format on
 
 #endif
@@ -278,4 +278,11 @@ std::string GetRenderStateCacheFilePath(const char*        CacheLocation,
                                         const char*        AppName,
                                         RENDER_DEVICE_TYPE DeviceType);
 
+/// Returns the path to the pipeline state cache file that accompanies the render state cache file.
+
+/// \param [in] RenderStateCacheFilePath - Path to the render state cache file, see GetRenderStateCacheFilePath().
+/// \return                              Pipeline state cache file path that can be used as
+///                                      PipelineStateCacheCreateInfo::FilePath.
+std::string GetPipelineStateCacheFilePath(const char* RenderStateCacheFilePath);
+
 } // namespace Diligent
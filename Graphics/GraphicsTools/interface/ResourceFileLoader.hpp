@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ResourceFileLoader class
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/AsyncFileReader.hpp"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Loads file regions into GPU buffers and textures.
+
+/// The application enqueues requests that copy a region of a file (path, offset and size)
+/// to a buffer range or a texture subresource region, and groups them into batches with Submit().
+/// File regions are read by the worker threads of the AsyncFileReader. Process() copies the data
+/// of completed batches to the resources in submission order and signals the fence of every
+/// completed batch on the device context.
+///
+/// \remarks    Requests can be enqueued and submitted from any thread. Process() must be called
+///             by the thread that owns the device context.
+///
+///             The loader reads files through the regular file system and uploads data with
+///             IDeviceContext::UpdateBuffer and IDeviceContext::UpdateTexture, so it works on
+///             all backends.
+class ResourceFileLoader
+{
+public:
+    /// Loader create info. Files are read in the thread pool of the AsyncFileReader.
+    using CreateInfo = AsyncFileReader::CreateInfo;
+
+    /// Request to load a file region into a buffer.
+    struct BufferRequest
+    {
+        /// Path to the file.
+        const Char* FilePath = nullptr;
+
+        /// Offset of the region in the file, in bytes.
+        Uint64 FileOffset = 0;
+
+        /// Region size, in bytes.
+        Uint64 Size = 0;
+
+        /// Destination buffer. The buffer must be created with USAGE_DEFAULT.
+        IBuffer* pBuffer = nullptr;
+
+        /// Offset in the destination buffer, in bytes.
+        Uint64 DstOffset = 0;
+    };
+
+    /// Request to load a file region into a texture subresource.
+    struct TextureRequest
+    {
+        /// Path to the file.
+        const Char* FilePath = nullptr;
+
+        /// Offset of the region in the file, in bytes.
+        Uint64 FileOffset = 0;
+
+        /// Region size, in bytes.
+        Uint64 Size = 0;
+
+        /// Destination texture.
+        ITexture* pTexture = nullptr;
+
+        /// Destination mip level.
+        Uint32 MipLevel = 0;
+
+        /// Destination array slice.
+        Uint32 Slice = 0;
+
+        /// Destination region in the subresource.
+        Box DstBox;
+
+        /// Row stride of the data in the file, in bytes.
+        Uint64 Stride = 0;
+
+        /// Depth slice stride of the data in the file, in bytes.
+        Uint64 DepthStride = 0;
+    };
+
+    explicit ResourceFileLoader(const CreateInfo& CI);
+
+    /// Waits for all pending file reads to finish.
+    ~ResourceFileLoader();
+
+    // clang-format off
+    ResourceFileLoader           (const ResourceFileLoader&)  = delete;
+    ResourceFileLoader           (      ResourceFileLoader&&) = delete;
+    ResourceFileLoader& operator=(const ResourceFileLoader&)  = delete;
+    ResourceFileLoader& operator=(      ResourceFileLoader&&) = delete;
+    // clang-format on
+
+    /// Enqueues a request to load a file region into a buffer.
+
+    /// \remarks    The file is read immediately. The data is copied to the
+    ///             buffer by Process() after the batch is submitted.
+    void EnqueueRead(const BufferRequest& Request);
+
+    /// Enqueues a request to load a file region into a texture subresource.
+
+    /// \remarks    The file is read immediately. The data is copied to the
+    ///             texture by Process() after the batch is submitted.
+    void EnqueueRead(const TextureRequest& Request);
+
+    /// Submits all requests enqueued since the last call as a batch.
+
+    /// \param [in] pFence     - Optional fence to signal when the data of all requests
+    ///                          in the batch has been copied to the resources.
+    /// \param [in] FenceValue - The value to signal the fence with.
+    void Submit(IFence* pFence = nullptr, Uint64 FenceValue = 0);
+
+    /// Copies the data of completed batches to the resources and signals the batch fences.
+
+    /// \param [in] pContext - Device context to record the copy commands and fence signals in.
+    ///
+    /// \return     The number of batches that were completed.
+    ///
+    /// \remarks    Batches are completed in submission order. A batch is completed when
+    ///             all its file reads have finished. Requests whose file regions could not
+    ///             be read are skipped, but the batch fence is still signaled.
+    ///
+    ///             Fence signals are enqueued with IDeviceContext::EnqueueSignal, so they are
+    ///             executed by the GPU when the context is flushed.
+    Uint32 Process(IDeviceContext* pContext);
+
+    /// Returns the number of submitted batches that are not completed yet.
+    Uint32 GetNumPendingBatches();
+
+    /// Returns the total number of requests whose file regions could not be read.
+    Uint32 GetNumFailedRequests();
+
+private:
+    struct PendingRequest
+    {
+        RefCntAutoPtr<AsyncFileReader::ReadRequest> pRead;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        Uint64                 DstOffset = 0;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        Uint32                  MipLevel    = 0;
+        Uint32                  Slice       = 0;
+        Box                     DstBox;
+        Uint64                  Stride      = 0;
+        Uint64                  DepthStride = 0;
+    };
+
+    struct Batch
+    {
+        std::vector<PendingRequest> Requests;
+        RefCntAutoPtr<IFence>       pFence;
+        Uint64                      FenceValue = 0;
+    };
+
+    AsyncFileReader m_Reader;
+
+    std::mutex                  m_Mtx;
+    std::vector<PendingRequest> m_UnsubmittedRequests;
+    std::deque<Batch>           m_Batches;
+    Uint32                      m_NumFailedRequests = 0;
+};
+
+} // namespace Diligent
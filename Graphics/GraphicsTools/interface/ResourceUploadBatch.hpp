@@ -0,0 +1,191 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of ResourceUploadBatch class
+
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Resource upload batch create information.
+struct ResourceUploadBatchCreateInfo
+{
+    /// Render device.
+    IRenderDevice* pDevice = nullptr;
+
+    /// Immediate device context that records the copy commands.
+
+    /// The context may use a transfer queue (see ImmediateContextCreateInfo), in which case
+    /// the uploads do not interfere with the rendering. Resources must then be created with
+    /// ImmediateContextMask that includes both the transfer and the graphics contexts.
+    IDeviceContext* pContext = nullptr;
+
+    /// The size of the staging buffer pages, in bytes.
+
+    /// Initial data of all resources in the batch is tightly packed into the pages.
+    /// Resources whose data does not fit into a page get a dedicated staging buffer.
+    Uint64 StagingPageSize = 16 << 20;
+};
+
+/// Creates resources with initial data and uploads the data in batches.
+
+/// When a resource is created with initial data by IRenderDevice::CreateBuffer() or
+/// IRenderDevice::CreateTexture(), the backend allocates a staging resource and submits
+/// the copy for every resource individually. The batch instead creates the resources
+/// without data, packs the data of all resources into shared staging pages, and records
+/// all copies at once when Submit() is called:
+///
+///     ResourceUploadBatch Batch{CI};
+///     for (const auto& Mesh : Meshes)
+///         Batch.CreateBuffer(Mesh.VBDesc, &Mesh.VBData, &Mesh.pVB);
+///     for (const auto& Tex : Textures)
+///         Batch.CreateTexture(Tex.Desc, &Tex.Data, &Tex.pTexture);
+///     Uint64 FenceValue = Batch.Submit();
+///     // The resources may be used once Batch.GetFence() reaches FenceValue,
+///     // or right away on the same context.
+///
+/// Staging pages are recycled after the GPU has finished the copies that use them.
+///
+/// \remarks    The resources are created with USAGE_DEFAULT if USAGE_IMMUTABLE is requested,
+///             since immutable resources can only be initialized at creation.
+///             Direct3D11 does not support copying texture data from a buffer, so textures
+///             are created with their initial data directly.
+///
+///             The batch is not thread-safe and must be used from the thread that owns the context.
+class ResourceUploadBatch
+{
+public:
+    explicit ResourceUploadBatch(const ResourceUploadBatchCreateInfo& CI);
+
+    // clang-format off
+    ResourceUploadBatch           (const ResourceUploadBatch&)  = delete;
+    ResourceUploadBatch& operator=(const ResourceUploadBatch&)  = delete;
+    ResourceUploadBatch           (      ResourceUploadBatch&&) = delete;
+    ResourceUploadBatch& operator=(      ResourceUploadBatch&&) = delete;
+    // clang-format on
+
+    /// Submits the pending uploads, if any.
+    ~ResourceUploadBatch();
+
+    /// Creates a buffer and adds its initial data to the batch.
+
+    /// \param [in]  Desc      - Buffer description.
+    /// \param [in]  pBuffData - Optional initial data. BufferData::pContext is ignored.
+    /// \param [out] ppBuffer  - Address of the memory location where the pointer to the buffer will be written.
+    ///
+    /// \remarks    The buffer contents are undefined until the copy is executed by the GPU.
+    void CreateBuffer(const BufferDesc& Desc, const BufferData* pBuffData, IBuffer** ppBuffer);
+
+    /// Creates a texture and adds its initial data to the batch.
+
+    /// \param [in]  Desc      - Texture description.
+    /// \param [in]  pTexData  - Optional initial data. TextureData::pContext is ignored.
+    /// \param [out] ppTexture - Address of the memory location where the pointer to the texture will be written.
+    ///
+    /// \remarks    The texture contents are undefined until the copy is executed by the GPU.
+    void CreateTexture(const TextureDesc& Desc, const TextureData* pTexData, ITexture** ppTexture);
+
+    /// Records the copy commands for all pending uploads, flushes the context,
+    /// and signals the fence.
+
+    /// \return     The fence value that will be signaled when all uploads are complete,
+    ///             see GetFence(). If there are no pending uploads, the last signaled value
+    ///             is returned.
+    Uint64 Submit();
+
+    /// Returns the fence that is signaled by Submit().
+
+    /// \remarks    If the device supports native fences, the fence is created with
+    ///             FENCE_TYPE_GENERAL and other queues may wait for it with IDeviceContext::DeviceWaitForFence().
+    IFence* GetFence() const { return m_pFence; }
+
+    /// Returns true if the uploads submitted with the given fence value are complete.
+    bool IsComplete(Uint64 FenceValue) const { return m_pFence->GetCompletedValue() >= FenceValue; }
+
+    /// Returns the number of uploads that have not been submitted yet.
+    size_t GetNumPendingUploads() const { return m_BufferCopies.size() + m_TextureCopies.size(); }
+
+    /// Returns the total size of the staging pages, in bytes.
+    Uint64 GetStagingMemorySize() const;
+
+private:
+    struct StagingPage
+    {
+        RefCntAutoPtr<IBuffer> pBuffer;
+        Uint8*                 pData      = nullptr;
+        Uint64                 Size       = 0;
+        Uint64                 Offset     = 0;
+        Uint64                 FenceValue = 0;
+    };
+
+    // Allocates staging memory and returns the page index and the offset in the page
+    bool Allocate(Uint64 Size, Uint64 Alignment, size_t& PageIdx, Uint64& Offset);
+
+    struct BufferCopy
+    {
+        RefCntAutoPtr<IBuffer> pDstBuffer;
+        IBuffer*               pSrcBuffer = nullptr;
+        Uint64                 SrcOffset  = 0;
+        Uint64                 Size       = 0;
+    };
+
+    struct TextureCopy
+    {
+        RefCntAutoPtr<ITexture> pDstTexture;
+        Uint32                  MipLevel = 0;
+        Uint32                  Slice    = 0;
+        Box                     DstBox;
+        TextureSubResData       SubresData;
+    };
+
+    RefCntAutoPtr<IRenderDevice>  m_pDevice;
+    RefCntAutoPtr<IDeviceContext> m_pContext;
+    RefCntAutoPtr<IFence>         m_pFence;
+
+    const Uint64 m_StagingPageSize;
+    const bool   m_TexturesFromBuffers;
+
+    Uint64 m_LastFenceValue = 0;
+
+    // Pages that are being filled by the current batch
+    std::vector<StagingPage> m_ActivePages;
+    // Pages that are used by the GPU or are ready to be reused
+    std::vector<StagingPage> m_SubmittedPages;
+
+    std::vector<BufferCopy>  m_BufferCopies;
+    std::vector<TextureCopy> m_TextureCopies;
+};
+
+} // namespace Diligent
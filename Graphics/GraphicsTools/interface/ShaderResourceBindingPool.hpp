@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of ShaderResourceBindingPool class
+
+#include <vector>
+#include <deque>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/PipelineResourceSignature.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Shader resource binding pool create information.
+struct ShaderResourceBindingPoolCreateInfo
+{
+    /// Render device.
+    IRenderDevice* pDevice = nullptr;
+
+    /// Pipeline resource signature that is used to create the shader resource bindings.
+    IPipelineResourceSignature* pSignature = nullptr;
+
+    /// Whether to initialize static resources in the new shader resource bindings,
+    /// see IPipelineResourceSignature::CreateShaderResourceBinding().
+    bool InitStaticResources = true;
+
+    /// The number of shader resource bindings to create up front.
+    Uint32 InitialSize = 0;
+};
+
+/// Pool of shader resource bindings that are recycled instead of destroyed.
+
+/// Creating a shader resource binding allocates the object, its resource cache and
+/// the descriptor space for static and mutable resources. Renderers that create transient
+/// SRBs every frame (e.g. for dynamic materials) can allocate them from the pool instead:
+///
+///     auto* pSRB = Pool.Allocate();
+///     pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTexSRV, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+///     pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+///     ...
+///     // At the end of the frame
+///     Pool.FinishFrame(pContext);
+///
+/// All SRBs allocated since the last call to FinishFrame() are returned to the pool
+/// at once when the GPU finishes the commands submitted before the call. The SRBs keep
+/// their resource caches and descriptor allocations, so reusing an SRB only updates the
+/// bindings. Dynamic descriptors are allocated by the device context from the per-frame
+/// heaps that are already reset in bulk.
+///
+/// \remarks    Recycled SRBs retain the resources that were bound to them. Since other resources
+///             are typically bound to the same variables, use SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE
+///             or BIND_SHADER_RESOURCES_ALLOW_OVERWRITE flag to rebind static and mutable variables.
+///             Call ReleaseResources() to release the references held by the free SRBs.
+///
+///             The pool is not thread-safe.
+class ShaderResourceBindingPool
+{
+public:
+    explicit ShaderResourceBindingPool(const ShaderResourceBindingPoolCreateInfo& CI);
+
+    // clang-format off
+    ShaderResourceBindingPool           (const ShaderResourceBindingPool&)  = delete;
+    ShaderResourceBindingPool& operator=(const ShaderResourceBindingPool&)  = delete;
+    ShaderResourceBindingPool           (      ShaderResourceBindingPool&&) = delete;
+    ShaderResourceBindingPool& operator=(      ShaderResourceBindingPool&&) = delete;
+    // clang-format on
+
+    /// Returns a shader resource binding for the current frame.
+
+    /// \return     A pointer to the shader resource binding that is owned by the pool,
+    ///             or null if the SRB could not be created.
+    ///             The SRB can be used until the GPU finishes the frame, see FinishFrame().
+    ///             The caller may keep a strong reference to the SRB, but must not use it
+    ///             after that, since the SRB will be reused.
+    IShaderResourceBinding* Allocate();
+
+    /// Ends the current frame.
+
+    /// \param [in] pContext - Device context that was used to commit the SRBs of the frame.
+    ///                        The SRBs are recycled when the GPU finishes the commands submitted
+    ///                        to this context before the call.
+    ///
+    /// \remarks    The method enqueues a fence signal, but does not flush the context.
+    void FinishFrame(IDeviceContext* pContext);
+
+    /// Releases the references to the resources that are bound to the static and mutable variables
+    /// of the free SRBs.
+
+    /// \remarks    Dynamic variables are not released as this requires no synchronization and
+    ///             they are typically rebound every time the SRB is used.
+    void ReleaseResources();
+
+    /// Destroys the free SRBs.
+    void Shrink();
+
+    /// Returns the pipeline resource signature of the pool.
+    IPipelineResourceSignature* GetSignature() const { return m_pSignature; }
+
+    /// Returns the total number of SRBs created by the pool that have not been destroyed.
+    size_t GetSize() const { return m_NumSRBs; }
+
+    /// Returns the number of SRBs that are ready to be reused.
+    size_t GetNumFreeSRBs() const { return m_FreeSRBs.size(); }
+
+private:
+    void RecycleCompletedFrames();
+
+    using SRBList = std::vector<RefCntAutoPtr<IShaderResourceBinding>>;
+
+    struct PendingFrame
+    {
+        SRBList SRBs;
+        Uint64  FenceValue = 0;
+    };
+
+    RefCntAutoPtr<IRenderDevice>              m_pDevice;
+    RefCntAutoPtr<IPipelineResourceSignature> m_pSignature;
+    RefCntAutoPtr<IFence>                     m_pFence;
+
+    const bool m_InitStaticResources;
+
+    Uint64 m_NextFenceValue = 1;
+    size_t m_NumSRBs        = 0;
+
+    // SRBs allocated in the current frame
+    SRBList m_FrameSRBs;
+    // SRBs that may be in use by the GPU
+    std::deque<PendingFrame> m_PendingFrames;
+    // SRBs that are ready to be reused
+    SRBList m_FreeSRBs;
+};
+
+} // namespace Diligent
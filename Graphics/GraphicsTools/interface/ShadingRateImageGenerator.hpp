@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of ShadingRateImageGenerator class
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Generates a variable rate shading texture from the content of a color buffer with a compute shader.
+
+/// Every texel of the shading rate texture covers a tile of the render target. The generator
+/// analyzes the perceptual luminance of the tile in the color buffer, typically the previous frame,
+/// and lowers the shading rate along an axis when the contrast along this axis is low. When a motion
+/// vector buffer is provided, fast-moving tiles, where detail is masked by motion, are shaded at a lower
+/// rate as well.
+///
+/// The texture format depends on the device, see ShadingRateProperties::Format:
+///     - SHADING_RATE_FORMAT_PALETTE: TEX_FORMAT_R8_UINT texture with SHADING_RATE values
+///       (Direct3D12, VK_KHR_fragment_shading_rate). The rates are remapped to the ones supported by the device.
+///     - SHADING_RATE_FORMAT_UNORM8: TEX_FORMAT_RG8_UNORM fragment density map (VK_EXT_fragment_density_map).
+///
+/// The tile size is ShadingRateProperties::MaxTileSize, which is the size used by
+/// IDeviceContext::SetRenderTargetsEx(). Bind the texture as follows:
+///
+///     Generator.Generate(pContext, Attribs);
+///     SetRenderTargetsAttribs RTAttribs;
+///     ...
+///     RTAttribs.pShadingRateMap = Generator.GetShadingRateView();
+///     pContext->SetRenderTargetsEx(RTAttribs);
+///     pContext->SetShadingRate(SHADING_RATE_1X1, SHADING_RATE_COMBINER_PASSTHROUGH, SHADING_RATE_COMBINER_OVERRIDE);
+///
+/// \remarks    The generator requires compute shaders and texture-based shading rate, see IsSupported().
+///             Metal rasterization rate maps (SHADING_RATE_FORMAT_COL_ROW_FP32) are defined by per-column
+///             and per-row rates on the CPU and are not supported.
+///             The object is not thread-safe.
+class ShadingRateImageGenerator
+{
+public:
+    explicit ShadingRateImageGenerator(IRenderDevice* pDevice);
+    ~ShadingRateImageGenerator();
+
+    // clang-format off
+    ShadingRateImageGenerator           (const ShadingRateImageGenerator&)  = delete;
+    ShadingRateImageGenerator           (      ShadingRateImageGenerator&&) = delete;
+    ShadingRateImageGenerator& operator=(const ShadingRateImageGenerator&)  = delete;
+    ShadingRateImageGenerator& operator=(      ShadingRateImageGenerator&&) = delete;
+    // clang-format on
+
+    /// Returns true if the generator is supported by the device.
+    static bool IsSupported(IRenderDevice* pDevice);
+
+    /// Generation attributes
+    struct GenerateAttribs
+    {
+        /// Shader resource view of the color buffer, typically the previous frame.
+
+        /// The view must reference a single-sampled 2D texture. The color is expected
+        /// to be in linear space, e.g. the view of an sRGB texture or of an HDR buffer after tone mapping.
+        ITextureView* pColorSRV = nullptr;
+
+        /// Optional shader resource view of the motion vectors.
+
+        /// The view must have the same size as the color buffer. The red and green channels
+        /// are multiplied by MotionVectorScale to get the motion in pixels.
+        ITextureView* pMotionVectorsSRV = nullptr;
+
+        /// Scale that converts the motion vectors to pixels.
+        float2 MotionVectorScale = float2{1, 1};
+
+        /// Perceptual luminance difference between adjacent pixels, in [0, 1] range, below which the
+        /// shading rate along the axis is halved. A quarter of this value allows the quarter rate.
+        /// Lower values preserve more detail.
+        float ContrastThreshold = 0.04f;
+
+        /// Tile motion, in pixels per frame, above which the shading rate along the axis is halved.
+        /// Four times this value allows the quarter rate. Ignored if pMotionVectorsSRV is null.
+        float MotionThreshold = 4.f;
+
+        /// The coarsest shading rate that the generator may select.
+        SHADING_RATE MaxRate = SHADING_RATE_2X2;
+
+        /// Whether the horizontal and vertical rates may differ (e.g. SHADING_RATE_2X1).
+        /// If false, the finer of the two rates is used for both axes.
+        bool AllowAnisotropicRates = true;
+
+        /// The number of samples of the render target that uses the shading rate texture.
+        /// Only the rates supported for this sample count are selected.
+        Uint32 SampleCount = 1;
+    };
+
+    /// Generates the shading rate texture.
+
+    /// \remarks    The texture is recreated when the color buffer size changes.
+    ///             The color and motion vector buffers are transitioned to the shader resource state.
+    ///             When the method returns, the shading rate texture is in the shading rate state.
+    void Generate(IDeviceContext* pContext, const GenerateAttribs& Attribs);
+
+    /// Returns the shading rate texture, or null if it has not been generated yet.
+    ITexture* GetShadingRateTexture() const { return m_pShadingRate; }
+
+    /// Returns the shading rate view of the texture, or null if it has not been generated yet.
+    ITextureView* GetShadingRateView() const { return m_pShadingRate ? m_pShadingRate->GetDefaultView(TEXTURE_VIEW_SHADING_RATE) : nullptr; }
+
+    /// Returns the size of the render target region covered by one texel of the shading rate texture.
+    uint2 GetTileSize() const { return m_TileSize; }
+
+private:
+    struct PipelineInfo
+    {
+        RefCntAutoPtr<IPipelineState>         pPSO;
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    };
+    bool CreatePipeline(bool UseMotionVectors, PipelineInfo& Pipeline);
+    bool CreateShadingRateTexture(Uint32 ColorWidth, Uint32 ColorHeight);
+
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+    RefCntAutoPtr<IBuffer>       m_pConstants;
+
+    const SHADING_RATE_FORMAT m_Format;
+    const uint2               m_TileSize;
+
+    PipelineInfo m_Pipeline;
+    PipelineInfo m_MotionPipeline;
+
+    RefCntAutoPtr<ITexture> m_pShadingRate;
+    // Intermediate texture written by the shader when the shading rate texture
+    // can't be used as an unordered access view
+    RefCntAutoPtr<ITexture> m_pStaging;
+
+    Uint32 m_ColorWidth  = 0;
+    Uint32 m_ColorHeight = 0;
+};
+
+} // namespace Diligent
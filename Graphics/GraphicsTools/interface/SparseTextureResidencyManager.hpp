@@ -0,0 +1,372 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of SparseTextureResidencyManager class
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../GraphicsEngine/interface/DeviceMemory.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/BasicMath.hpp"
+#include "ReadbackQueue.h"
+
+namespace Diligent
+{
+
+/// Sparse texture residency manager create information.
+struct SparseTextureResidencyManagerCreateInfo
+{
+    /// Sparse texture description.
+
+    /// \remarks
+    ///     - Desc.Type must be RESOURCE_DIM_TEX_2D or RESOURCE_DIM_TEX_2D_ARRAY
+    ///     - Desc.Usage must be USAGE_SPARSE
+    ///     - Desc.Format must not be TEX_FORMAT_UNKNOWN
+    TextureDesc Desc;
+
+    /// The number of tiles in one memory page.
+
+    /// \remarks    Device memory is allocated and released in pages.
+    ///             Larger pages reduce the number of memory allocations,
+    ///             but increase the amount of memory that may stay unused.
+    Uint32 NumTilesInMemoryPage = 16;
+
+    /// Memory budget, in bytes.
+
+    /// \remarks    The budget includes the memory for the mip tails.
+    ///             When the budget is exhausted, the least recently used tiles
+    ///             are evicted to make room for new ones.
+    ///             Zero means that the number of resident tiles is only limited
+    ///             by the texture size.
+    Uint64 MemoryBudget = 0;
+
+    /// The minimum number of frames a tile must not be requested before it can be evicted.
+
+    /// \remarks    Tiles that were requested in one of the last MinEvictionAge frames
+    ///             are never evicted, even if the budget is exhausted.
+    Uint32 MinEvictionAge = 2;
+
+    /// The maximum number of tiles to bind in one frame. Zero means no limit.
+
+    /// \remarks    When the limit is reached, remaining requests are postponed to the following frames.
+    ///             Tiles of coarser mip levels are bound first.
+    Uint32 MaxTileBindsPerFrame = 0;
+};
+
+/// Sparse texture tile coordinates.
+struct SparseTextureTile
+{
+    /// Tile column, in tiles.
+    Uint32 X = 0;
+
+    /// Tile row, in tiles.
+    Uint32 Y = 0;
+
+    /// Mip level. Must be less than the first mip level in the mip tail.
+    Uint32 MipLevel = 0;
+
+    /// Array slice.
+    Uint32 Slice = 0;
+};
+
+/// Sparse texture residency manager statistics.
+struct SparseTextureResidencyStats
+{
+    /// The number of tiles that are currently resident.
+    Uint32 NumResidentTiles = 0;
+
+    /// The number of tiles that are requested, but not yet resident.
+    Uint32 NumPendingTiles = 0;
+
+    /// The number of memory pages currently allocated for tiles.
+    Uint32 NumMemoryPages = 0;
+
+    /// The amount of memory currently committed by the manager, in bytes.
+    Uint64 CommittedMemorySize = 0;
+
+    /// The total number of tiles bound to memory.
+    Uint64 NumBoundTiles = 0;
+
+    /// The total number of tiles evicted to make room for other tiles.
+    Uint64 NumEvictedTiles = 0;
+
+    /// The total number of BindSparseResourceMemory commands issued by the manager.
+    Uint32 NumBindCommands = 0;
+};
+
+/// Manages residency of sparse texture tiles.
+
+/// The manager owns the sparse texture and the device memory it is backed with.
+/// An application requests tiles either explicitly with RequestTile(), or by providing
+/// the feedback written by shaders (see ProcessFeedback() and ReadFeedback()).
+/// Commit() then binds memory to the requested tiles and unbinds evicted tiles with
+/// a single IDeviceContext::BindSparseResourceMemory() command.
+///
+/// Mip tails are always resident so that shaders can always fall back to the
+/// coarsest mip levels.
+///
+/// \remarks    The manager is not thread-safe.
+class SparseTextureResidencyManager
+{
+public:
+    /// Initializes the residency manager.
+
+    /// \param[in] pDevice    - Render device that will be used to create the texture and the memory.
+    /// \param[in] CreateInfo - Manager create information, see Diligent::SparseTextureResidencyManagerCreateInfo.
+    ///
+    /// \remarks    The constructor throws an exception if the device does not support
+    ///             the sparse texture.
+    SparseTextureResidencyManager(IRenderDevice* pDevice, const SparseTextureResidencyManagerCreateInfo& CreateInfo);
+
+    // clang-format off
+    SparseTextureResidencyManager           (const SparseTextureResidencyManager&)  = delete;
+    SparseTextureResidencyManager& operator=(const SparseTextureResidencyManager&)  = delete;
+    SparseTextureResidencyManager           (      SparseTextureResidencyManager&&) = delete;
+    SparseTextureResidencyManager& operator=(      SparseTextureResidencyManager&&) = delete;
+    // clang-format on
+
+    ~SparseTextureResidencyManager();
+
+
+    /// Returns the total number of tiles outside of the mip tails.
+
+    /// \remarks    This is also the number of Uint32 elements in the feedback buffer,
+    ///             see ProcessFeedback().
+    Uint32 GetNumTiles() const
+    {
+        return static_cast<Uint32>(m_Tiles.size());
+    }
+
+    /// Returns the linear index of the tile.
+
+    /// \remarks    Tiles are ordered by slice, then by mip level, then by row and column.
+    Uint32 GetTileIndex(const SparseTextureTile& Tile) const;
+
+    /// Returns the number of tiles in the given mip level, or zero if the mip level is in the mip tail.
+    uint2 GetNumTilesInMipLevel(Uint32 MipLevel) const;
+
+    /// Requests the tile to be resident.
+
+    /// \remarks    The tile is bound to memory by the next call to Commit(). If the tile
+    ///             is already resident, it is marked as recently used.
+    void RequestTile(const SparseTextureTile& Tile)
+    {
+        RequestTile(GetTileIndex(Tile));
+    }
+
+    /// Requests the tile with the given linear index to be resident, see GetTileIndex().
+    void RequestTile(Uint32 TileIndex);
+
+    /// Processes the residency feedback.
+
+    /// \param[in] pFeedback   - Feedback data. Element i must be non-zero if the tile
+    ///                          with linear index i (see GetTileIndex()) was requested.
+    /// \param[in] NumElements - The number of elements in pFeedback. Must not exceed GetNumTiles().
+    ///
+    /// \remarks    Shaders typically write the feedback to a buffer with GetNumTiles() Uint32 elements
+    ///             that is cleared every frame.
+    void ProcessFeedback(const Uint32* pFeedback, Uint32 NumElements);
+
+    /// Processes the minimum mip level feedback, see Diligent::TextureFeedbackManager.
+
+    /// \param[in] Slice      - Array slice the feedback was recorded for.
+    /// \param[in] pMinMips   - Minimum mip level requested in every region of the texture,
+    ///                         GridWidth x GridHeight elements in row-major order.
+    /// \param[in] GridWidth  - Feedback grid width.
+    /// \param[in] GridHeight - Feedback grid height.
+    ///
+    /// \remarks    For every region, the method requests the tiles of the minimum mip level
+    ///             that overlap the region. Regions that request mip levels in the mip tail
+    ///             or were not sampled (0xFFFFFFFF) are ignored.
+    void ProcessMinMipFeedback(Uint32 Slice, const Uint32* pMinMips, Uint32 GridWidth, Uint32 GridHeight);
+
+    /// Enqueues an asynchronous read of the feedback buffer.
+
+    /// \param[in] pContext        - Immediate device context to record the copy.
+    /// \param[in] pQueue          - Readback queue to use.
+    /// \param[in] pFeedbackBuffer - Feedback buffer, see ProcessFeedback().
+    ///
+    /// \remarks    When the data is available, the readback queue calls ProcessFeedback().
+    ///             Since the manager is not thread-safe, the readback queue must invoke callbacks
+    ///             on the thread that uses the manager. The manager must outlive the pending reads.
+    void ReadFeedback(IDeviceContext* pContext, IReadbackQueue* pQueue, IBuffer* pFeedbackBuffer);
+
+    /// Returns true if the tile is resident.
+
+    /// \remarks    Tiles bound by Commit() are resident once the command has been executed by the GPU.
+    bool IsTileResident(const SparseTextureTile& Tile) const;
+
+    /// Binds memory to the requested tiles and unbinds evicted tiles.
+
+    /// \param[in] pContext - Immediate device context that supports sparse binding operations.
+    ///
+    /// \remarks    The method issues at most one IDeviceContext::BindSparseResourceMemory() command
+    ///             and should be called once per frame. Tiles requested since the previous
+    ///             call that can't be bound because of the budget or the MaxTileBindsPerFrame
+    ///             limit stay pending.
+    ///
+    ///             Contents of the tiles bound by the method are undefined. An application must
+    ///             initialize the tiles returned by GetBoundTiles() before they are sampled.
+    void Commit(IDeviceContext* pContext);
+
+    /// Returns the linear indices of the tiles bound by the last call to Commit().
+    const std::vector<Uint32>& GetBoundTiles() const
+    {
+        return m_BoundTiles;
+    }
+
+    /// Returns the coordinates of the tile with the given linear index, see GetTileIndex().
+    SparseTextureTile GetTile(Uint32 TileIndex) const;
+
+    /// Sets the new memory budget, see SparseTextureResidencyManagerCreateInfo::MemoryBudget.
+
+    /// \remarks    If the new budget is smaller than the committed memory size, the least recently
+    ///             used tiles are evicted by the next call to Commit(), regardless of their age.
+    void SetMemoryBudget(Uint64 MemoryBudget);
+
+    /// Returns the sparse texture.
+    ITexture* GetTexture() const
+    {
+        return m_pTexture;
+    }
+
+    /// Returns the device memory object that backs the texture.
+    IDeviceMemory* GetMemory() const
+    {
+        return m_pMemory;
+    }
+
+    /// Returns the manager statistics, see Diligent::SparseTextureResidencyStats.
+    SparseTextureResidencyStats GetStats() const;
+
+private:
+    void   CreateResources(IRenderDevice* pDevice);
+    Uint32 GetMaxTileSlots() const;
+    Uint32 GetNumSlots() const
+    {
+        return static_cast<Uint32>(m_SlotTiles.size());
+    }
+    Uint32 AllocateSlot();
+    void   ReleaseTrailingPages();
+    void   EvictTile(Uint32 TileIndex, std::vector<SparseTextureMemoryBindRange>& Ranges);
+    void   AddTileRange(Uint32 TileIndex, IDeviceMemory* pMemory, std::vector<SparseTextureMemoryBindRange>& Ranges) const;
+
+    void LruRemove(Uint32 TileIndex);
+    void LruPushFront(Uint32 TileIndex);
+
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    struct TileInfo
+    {
+        // Memory slot, or InvalidIndex if the tile is not resident
+        Uint32 Slot = InvalidIndex;
+
+        // The frame in which the tile was requested last time
+        Uint64 LastRequestFrame = 0;
+
+        // LRU list links
+        Uint32 Prev = InvalidIndex;
+        Uint32 Next = InvalidIndex;
+
+        bool IsPending = false;
+    };
+
+    struct MipLevelInfo
+    {
+        // Mip level storage dimensions
+        Uint32 Width  = 0;
+        Uint32 Height = 0;
+
+        // The number of tiles in the mip level
+        uint2 NumTiles;
+
+        // The index of the first tile of the mip level in the slice
+        Uint32 FirstTile = 0;
+    };
+
+    const std::string m_Name;
+    TextureDesc       m_Desc;
+    Uint32            m_NumTilesInPage;
+    const Uint32      m_MinEvictionAge;
+    const Uint32      m_MaxTileBindsPerFrame;
+    Uint64            m_MemoryBudget;
+
+    RefCntAutoPtr<ITexture>      m_pTexture;
+    RefCntAutoPtr<IDeviceMemory> m_pMemory;
+
+    Uint32 m_TileSize[3]     = {};
+    Uint32 m_BlockSize       = 0;
+    Uint32 m_FirstMipInTail  = 0;
+    Uint32 m_NumMipTails     = 0;
+    Uint64 m_MipTailSize     = 0;
+    Uint64 m_MemoryPageSize  = 0;
+    Uint32 m_NumMipTailPages = 0;
+    Uint32 m_NumTilesInSlice = 0;
+    bool   m_MipTailsBound   = false;
+
+    std::vector<MipLevelInfo> m_Mips;
+    std::vector<TileInfo>     m_Tiles;
+
+    // Slot index -> tile index, or InvalidIndex if the slot is free
+    std::vector<Uint32> m_SlotTiles;
+    // Free slots. Slots with lower indices are used first so that trailing pages can be released.
+    std::set<Uint32> m_FreeSlots;
+
+    // Tiles that were requested, but are not resident
+    std::vector<Uint32> m_PendingTiles;
+    // Tiles bound by the last Commit()
+    std::vector<Uint32> m_BoundTiles;
+
+    // Least recently used list of resident tiles
+    Uint32 m_LruHead = InvalidIndex;
+    Uint32 m_LruTail = InvalidIndex;
+
+    Uint64 m_FrameIndex       = 1;
+    Uint32 m_NumResidentTiles = 0;
+
+    Uint64 m_NextBeforeBindFenceValue = 1;
+    Uint64 m_NextAfterBindFenceValue  = 1;
+
+    RefCntAutoPtr<IFence> m_pBeforeBindFence;
+    RefCntAutoPtr<IFence> m_pAfterBindFence;
+
+    Uint64 m_NumBoundTiles   = 0;
+    Uint64 m_NumEvictedTiles = 0;
+    Uint32 m_NumBindCommands = 0;
+};
+
+} // namespace Diligent
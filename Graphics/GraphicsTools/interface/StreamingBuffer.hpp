@@ -30,6 +30,7 @@
 #include <functional>
 #include <vector>
 #include <string>
+#include <algorithm>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
@@ -49,6 +50,25 @@ struct StreamingBufferCreateInfo
     bool                          AllowPersistentMapping = false;
 };
 
+/// Streaming buffer allocation statistics.
+struct StreamingBufferStats
+{
+    /// The number of bytes allocated in all contexts since the last Reset() call.
+    Uint64 CurrFrameSize = 0;
+
+    /// The number of bytes allocated in all contexts between the two last Reset() calls.
+    Uint64 LastFrameSize = 0;
+
+    /// The maximum number of bytes allocated between two Reset() calls.
+    Uint64 PeakFrameSize = 0;
+
+    /// The number of times the buffer was reallocated because an allocation did not fit.
+    Uint32 NumResizes = 0;
+
+    /// The number of times the buffer ran out of space and was flushed before Reset() was called.
+    Uint32 NumOverflows = 0;
+};
+
 class StreamingBuffer
 {
 public:
@@ -56,15 +76,39 @@ public:
     {}
 
     explicit StreamingBuffer(const StreamingBufferCreateInfo& CI) :
-        m_UsePersistentMap{CI.AllowPersistentMapping && (CI.pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_VULKAN || CI.pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D12)},
         m_BufferSize{CI.BuffDesc.Size},
         m_OnBufferResizeCallback{CI.OnBufferResizeCallback},
         m_MapInfo(CI.NumContexts)
     {
         VERIFY_EXPR(CI.pDevice != nullptr);
         VERIFY_EXPR(CI.BuffDesc.Usage == USAGE_DYNAMIC);
-        CI.pDevice->CreateBuffer(CI.BuffDesc, nullptr, &m_pBuffer);
+
+        const auto DeviceType = CI.pDevice->GetDeviceInfo().Type;
+        const bool IsGL       = DeviceType == RENDER_DEVICE_TYPE_GL || DeviceType == RENDER_DEVICE_TYPE_GLES;
+
+        auto BuffDesc = CI.BuffDesc;
+        if (CI.AllowPersistentMapping && IsGL)
+        {
+            // OpenGL buffers can only be used by the GPU while mapped if they are created with persistent storage
+            BuffDesc.MiscFlags |= MISC_BUFFER_FLAG_PERSISTENT_MAP;
+        }
+
+        CI.pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBuffer);
         VERIFY_EXPR(m_pBuffer);
+
+        if (CI.AllowPersistentMapping)
+        {
+            if (DeviceType == RENDER_DEVICE_TYPE_VULKAN || DeviceType == RENDER_DEVICE_TYPE_D3D12)
+            {
+                m_UsePersistentMap = true;
+            }
+            else if (IsGL)
+            {
+                // The flag is removed if the device does not support persistent buffer storage
+                m_UsePersistentMap = (m_pBuffer->GetDesc().MiscFlags & MISC_BUFFER_FLAG_PERSISTENT_MAP) != 0;
+            }
+        }
+
         if (m_OnBufferResizeCallback)
             m_OnBufferResizeCallback(m_pBuffer);
     }
@@ -92,6 +136,9 @@ public:
         // Check if there is enough space in the buffer
         if (MapInfo.m_CurrOffset + Size > m_BufferSize)
         {
+            if (MapInfo.m_CurrOffset > 0)
+                ++MapInfo.m_NumOverflows;
+
             // Unmap the buffer
             Flush(CtxNum);
             VERIFY_EXPR(MapInfo.m_CurrOffset == 0);
@@ -111,6 +158,7 @@ public:
                 pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBuffer);
                 if (m_OnBufferResizeCallback)
                     m_OnBufferResizeCallback(m_pBuffer);
+                ++m_NumResizes;
 
                 LOG_INFO_MESSAGE("Extended streaming buffer '", BuffDesc.Name, "' to ", m_BufferSize, " bytes");
             }
@@ -132,6 +180,7 @@ public:
         auto Offset = MapInfo.m_CurrOffset;
         // Update offset
         MapInfo.m_CurrOffset += Size;
+        MapInfo.m_FrameSize += Size;
         return Offset;
     }
 
@@ -162,10 +211,37 @@ public:
 
     void Reset()
     {
+        Uint64 FrameSize = 0;
         for (Uint32 ctx = 0; ctx < m_MapInfo.size(); ++ctx)
+        {
             Flush(ctx);
+            FrameSize += m_MapInfo[ctx].m_FrameSize;
+            m_MapInfo[ctx].m_FrameSize = 0;
+        }
+        m_LastFrameSize = FrameSize;
+        m_PeakFrameSize = std::max(m_PeakFrameSize, FrameSize);
     }
 
+    /// Returns the allocation statistics, see Diligent::StreamingBufferStats.
+
+    /// \remarks   PeakFrameSize is the buffer size that avoids resizes and
+    ///            overflows for the observed workload.
+    StreamingBufferStats GetStats() const
+    {
+        StreamingBufferStats Stats;
+        for (const auto& MapInfo : m_MapInfo)
+        {
+            Stats.CurrFrameSize += MapInfo.m_FrameSize;
+            Stats.NumOverflows += MapInfo.m_NumOverflows;
+        }
+        Stats.LastFrameSize = m_LastFrameSize;
+        Stats.PeakFrameSize = m_PeakFrameSize;
+        Stats.NumResizes    = m_NumResizes;
+        return Stats;
+    }
+
+    bool IsPersistentlyMapped() const { return m_UsePersistentMap; }
+
     IBuffer* GetBuffer() const { return m_pBuffer; }
 
     void* GetMappedCPUAddress(size_t CtxNum = 0)
@@ -182,10 +258,16 @@ private:
 
     std::function<void(IBuffer*)> m_OnBufferResizeCallback;
 
+    Uint64 m_LastFrameSize = 0;
+    Uint64 m_PeakFrameSize = 0;
+    Uint32 m_NumResizes    = 0;
+
     struct MapInfo
     {
         MapHelper<Uint8> m_MappedData;
-        Uint32           m_CurrOffset = 0;
+        Uint32           m_CurrOffset   = 0;
+        Uint64           m_FrameSize    = 0;
+        Uint32           m_NumOverflows = 0;
     };
     // We need to keep track of mapped data for every context
     std::vector<MapInfo> m_MapInfo;
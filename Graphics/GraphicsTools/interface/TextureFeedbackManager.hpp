@@ -0,0 +1,208 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of TextureFeedbackManager class
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/BufferView.h"
+#include "../../GraphicsAccessories/interface/VariableSizeAllocationsManager.hpp"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "ReadbackQueue.h"
+
+namespace Diligent
+{
+
+/// Texture feedback manager create information.
+struct TextureFeedbackManagerCreateInfo
+{
+    /// Feedback buffer name.
+    const Char* Name = nullptr;
+
+    /// The total number of feedback elements (texture regions) in the feedback buffer.
+    Uint32 NumElements = 16384;
+};
+
+/// Texture feedback callback.
+
+/// \param [in] pMinMips   - Minimum mip level requested in every region of the texture,
+///                          GridWidth x GridHeight elements in row-major order. Regions that
+///                          were not sampled contain TextureFeedbackManager::NotRequested.
+/// \param [in] GridWidth  - Feedback grid width.
+/// \param [in] GridHeight - Feedback grid height.
+///
+/// \remarks    The pointer is only valid during the callback.
+///             The callback must not register or unregister textures.
+using TextureFeedbackCallbackType = std::function<void(const Uint32* pMinMips, Uint32 GridWidth, Uint32 GridHeight)>;
+
+
+/// Collects the minimum mip levels requested by shaders for streamed textures.
+
+/// Shaders write the mip levels they sample to the feedback buffer using the
+/// TextureFeedback_Write() function declared in the shader include returned by
+/// GetShaderIncludeSource(). Every texture is split into a grid of regions, and
+/// the buffer keeps the minimum requested mip level of every region.
+///
+/// A typical frame looks as follows:
+///     - Clear() resets the feedback buffer before the first draw that writes feedback
+///     - Shaders write the feedback through the UAV returned by GetBufferUAV()
+///     - Resolve() enqueues an asynchronous read of the buffer; once the data is
+///       available, the callbacks of the registered textures are invoked
+///
+/// The callbacks are meant to drive texture streaming, for example by requesting
+/// tiles from SparseTextureResidencyManager or uploading mip levels with TextureUploader.
+///
+/// \remarks    The manager is not thread-safe and must outlive the reads it has enqueued.
+class TextureFeedbackManager
+{
+public:
+    /// Invalid feedback ID.
+    static constexpr Uint32 InvalidFeedbackId = ~0u;
+
+    /// Value of the regions that were not sampled in the frame.
+    static constexpr Uint32 NotRequested = ~0u;
+
+    /// Initializes the feedback manager.
+
+    /// \param[in] pDevice    - Render device that will be used to create the feedback buffer.
+    /// \param[in] CreateInfo - Manager create information, see Diligent::TextureFeedbackManagerCreateInfo.
+    TextureFeedbackManager(IRenderDevice* pDevice, const TextureFeedbackManagerCreateInfo& CreateInfo);
+
+    // clang-format off
+    TextureFeedbackManager           (const TextureFeedbackManager&)  = delete;
+    TextureFeedbackManager& operator=(const TextureFeedbackManager&)  = delete;
+    TextureFeedbackManager           (      TextureFeedbackManager&&) = delete;
+    TextureFeedbackManager& operator=(      TextureFeedbackManager&&) = delete;
+    // clang-format on
+
+    ~TextureFeedbackManager();
+
+    /// Registers a texture.
+
+    /// \param[in] GridWidth  - The number of feedback regions along the texture width.
+    /// \param[in] GridHeight - The number of feedback regions along the texture height.
+    /// \param[in] Callback   - Callback that receives the feedback of the texture.
+    ///
+    /// \return     Feedback ID that must be passed to TextureFeedback_Write() in the shader,
+    ///             or InvalidFeedbackId if the buffer is full.
+    ///
+    /// \remarks    A 1x1 grid gives the minimum mip level requested for the entire texture.
+    ///             For sparse textures, the grid typically matches the number of tiles in
+    ///             the most detailed mip level.
+    Uint32 RegisterTexture(Uint32 GridWidth, Uint32 GridHeight, TextureFeedbackCallbackType Callback);
+
+    /// Unregisters the texture.
+
+    /// \remarks    The callback is not invoked for the reads that complete after the texture has been unregistered.
+    void UnregisterTexture(Uint32 FeedbackId);
+
+    /// Resets all elements of the feedback buffer to NotRequested.
+
+    /// \param[in] pContext - Device context to record the command.
+    void Clear(IDeviceContext* pContext);
+
+    /// Enqueues an asynchronous read of the feedback buffer.
+
+    /// \param[in] pContext - Immediate device context to record the copy.
+    /// \param[in] pQueue   - Readback queue to use.
+    ///
+    /// \remarks    The callbacks are invoked by the readback queue, typically several frames later.
+    ///             The readback queue must invoke callbacks on the thread that uses the manager.
+    void Resolve(IDeviceContext* pContext, IReadbackQueue* pQueue);
+
+    /// Returns the feedback buffer.
+    IBuffer* GetBuffer() const
+    {
+        return m_pBuffer;
+    }
+
+    /// Returns the unordered access view of the feedback buffer.
+    IBufferView* GetBufferUAV() const
+    {
+        return m_pBufferUAV;
+    }
+
+    /// Returns the number of feedback elements used by registered textures.
+    Uint32 GetNumUsedElements() const
+    {
+        return static_cast<Uint32>(m_Allocator.GetUsedSize());
+    }
+
+    /// Returns the number of reads that have been processed.
+    Uint32 GetNumResolvedReads() const
+    {
+        return m_NumResolvedReads;
+    }
+
+    /// Returns the name of the shader include file, "TextureFeedback.fxh".
+    static const Char* GetShaderIncludeName();
+
+    /// Returns the source of the shader include file that declares the feedback buffer
+    /// and the TextureFeedback_ComputeMipLevel() and TextureFeedback_Write() functions.
+
+    /// \remarks    The source can be added to the shader source factory with CreateMemoryShaderSourceFactory().
+    static const Char* GetShaderIncludeSource();
+
+private:
+    void ProcessFeedback(Uint32 ResolveIndex, const Uint32* pData, size_t NumElements);
+
+    struct TextureInfo
+    {
+        Uint32 GridWidth  = 0;
+        Uint32 GridHeight = 0;
+
+        // Index of the first Resolve() call that may contain the feedback of this texture
+        Uint32 FirstResolve = 0;
+
+        TextureFeedbackCallbackType Callback;
+    };
+
+    const std::string m_Name;
+    const Uint32      m_NumElements;
+
+    RefCntAutoPtr<IBuffer>     m_pBuffer;
+    RefCntAutoPtr<IBufferView> m_pBufferUAV;
+    RefCntAutoPtr<IBuffer>     m_pClearBuffer;
+
+    VariableSizeAllocationsManager m_Allocator;
+
+    // Registered textures indexed by feedback ID
+    std::unordered_map<Uint32, TextureInfo> m_Textures;
+
+    Uint32 m_NumResolves      = 0;
+    Uint32 m_NumResolvedReads = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <functional>
+
+#include "TextureUploader.hpp"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../../Primitives/interface/DataBlob.h"
+#include "../../../Common/interface/ThreadPool.hpp"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Transcodes one subresource of a compressed payload.
+
+/// \param [in] pSrcData    - Pointer to the compressed payload.
+/// \param [in] SrcDataSize - Payload size, in bytes.
+/// \param [in] Mip         - Mip level in the upload buffer.
+/// \param [in] Slice       - Array slice in the upload buffer.
+/// \param [in] DstDesc     - Upload buffer description.
+/// \param [in] DstData     - Mapped upload buffer memory of the subresource.
+///                           The function must write the transcoded data
+///                           directly to this memory.
+/// \return     true if the subresource was transcoded successfully, and false otherwise.
+using TextureTranscodeFunctionType = std::function<bool(const void*                     pSrcData,
+                                                        size_t                          SrcDataSize,
+                                                        Uint32                          Mip,
+                                                        Uint32                          Slice,
+                                                        const UploadBufferDesc&         DstDesc,
+                                                        const MappedTextureSubresource& DstData)>;
+
+/// Texture transcode request.
+struct TextureTranscodeRequest
+{
+    /// Destination texture.
+    RefCntAutoPtr<ITexture> pDstTexture;
+
+    /// The first destination array slice.
+    Uint32 DstSlice = 0;
+
+    /// The first destination mip level.
+    Uint32 DstMip = 0;
+
+    /// Upload buffer description. The format must be the format
+    /// that the payload is transcoded to.
+    UploadBufferDesc UploadDesc;
+
+    /// Compressed payload.
+
+    /// \remarks    The payload must stay valid until the task completes,
+    ///             unless it is owned by pDataBlob.
+    const void* pData = nullptr;
+
+    /// Payload size, in bytes.
+    size_t DataSize = 0;
+
+    /// Optional data blob that owns the payload.
+    /// The request keeps a strong reference to the blob.
+    RefCntAutoPtr<IDataBlob> pDataBlob;
+
+    /// Transcode function, see Diligent::TextureTranscodeFunctionType.
+
+    /// If the function is null, the payload is expected to contain the data of
+    /// all subresources in UploadDesc.Format, tightly packed in slice-major order,
+    /// see Diligent::CopyPackedTextureSubresource.
+    TextureTranscodeFunctionType Transcode;
+
+    /// Priority of the thread pool task and the GPU copy.
+    Int32 Priority = 0;
+};
+
+/// Copies one subresource from a tightly packed payload to the mapped upload buffer memory.
+
+/// The payload must contain the data of all subresources in DstDesc.Format, with
+/// all mip levels of slice 0 first, followed by all mip levels of slice 1, etc.
+/// This function can be used for block-compressed data that does not require
+/// transcoding. Its signature matches Diligent::TextureTranscodeFunctionType.
+bool CopyPackedTextureSubresource(const void*                     pSrcData,
+                                  size_t                          SrcDataSize,
+                                  Uint32                          Mip,
+                                  Uint32                          Slice,
+                                  const UploadBufferDesc&         DstDesc,
+                                  const MappedTextureSubresource& DstData);
+
+/// Enqueues an asynchronous texture transcode task.
+
+/// \param [in] pUploader   - Texture uploader.
+/// \param [in] pThreadPool - Thread pool that runs the task.
+/// \param [in] Request     - Transcode request, see Diligent::TextureTranscodeRequest.
+/// \return     The task that tracks the request.
+///
+/// \remarks    The task allocates an upload buffer, transcodes the payload directly
+///             into the mapped buffer memory, schedules the GPU copy and recycles the buffer.
+///             There are no intermediate copies between the payload and the upload buffer.
+///
+///             The task runs the worker-thread path of the uploader, so the application
+///             must keep calling ITextureUploader::RenderThreadUpdate until the task is finished.
+///             If transcoding fails, the task is cancelled. The upload buffer is still copied
+///             to the texture so that it can be recycled, and the destination contents are undefined.
+RefCntAutoPtr<IAsyncTask> EnqueueTextureTranscode(ITextureUploader*       pUploader,
+                                                  IThreadPool*            pThreadPool,
+                                                  TextureTranscodeRequest Request);
+
+} // namespace Diligent
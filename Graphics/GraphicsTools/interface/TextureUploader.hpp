@@ -66,6 +66,32 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// Optional immediate context of a transfer (or compute) queue.
+
+    /// When this context is provided, Direct3D12 and Vulkan uploaders record
+    /// all copy commands into it instead of the context passed to
+    /// ITextureUploader::RenderThreadUpdate and ITextureUploader::ScheduleGPUCopy.
+    /// The copies are submitted to the transfer queue and signal a fence, and
+    /// the render context waits for the fence on the GPU. In this way, the
+    /// render queue never accesses a destination texture before the upload
+    /// is complete.
+    ///
+    /// \remarks    Destination textures must be created with the bit of this
+    ///             context set in TextureDesc::ImmediateContextMask.
+    ///             The context must only be used by the uploader and the thread
+    ///             that calls ITextureUploader::RenderThreadUpdate.
+    ///             Other backends ignore this member.
+    IDeviceContext* pCopyContext = nullptr;
+
+    /// Maximum number of bytes copied by one ITextureUploader::RenderThreadUpdate call.
+
+    /// Zero means no limit.
+    ///
+    /// \remarks    Copies that do not fit into the budget remain queued
+    ///             until the next update. At least one copy is always
+    ///             executed so that large uploads are never starved.
+    ///             This member is only used by Direct3D12 and Vulkan uploaders.
+    Uint64 MaxCopyBytesPerUpdate = 0;
 };
 
 
@@ -119,6 +145,8 @@ public:
     /// \param [in] MipLevel      - Destination mip level. When multiple mip levels are copied,
     ///                             the starting mip level.
     /// \param [in] pUploadBuffer - Upload buffer to copy data from.
+    /// \param [in] Priority      - Copy priority. Copies enqueued by worker threads are
+    ///                             executed in order of decreasing priority.
     ///
     /// \remarks  When the method is called from a worker thread (pContext is null),
     ///           it may enqueue a render-thread operation and block until the operation is
@@ -127,11 +155,16 @@ public:
     ///           when calling the method from the render thread. On the other hand, always
     ///           pass null when calling the method from a worker thread to avoid
     ///           synchronization issues, which may result in an undefined behavior.
+    ///
+    ///           Copies executed by the render thread are never deferred, so the priority
+    ///           only affects copies enqueued by worker threads. Priorities are only
+    ///           honored by Direct3D12 and Vulkan uploaders.
     virtual void ScheduleGPUCopy(IDeviceContext* pContext,
                                  ITexture*       pDstTexture,
                                  Uint32          ArraySlice,
                                  Uint32          MipLevel,
-                                 IUploadBuffer*  pUploadBuffer) = 0;
+                                 IUploadBuffer*  pUploadBuffer,
+                                 Int32           Priority = 0) = 0;
 
 
     /// Recycles upload buffer to make it available for future operations.
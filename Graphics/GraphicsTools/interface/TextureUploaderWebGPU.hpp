@@ -49,7 +49,8 @@ public:
                                  ITexture*       pDstTexture,
                                  Uint32          ArraySlice,
                                  Uint32          MipLevel,
-                                 IUploadBuffer*  pUploadBuffer) override final;
+                                 IUploadBuffer*  pUploadBuffer,
+                                 Int32           Priority) override final;
 
     virtual void RecycleBuffer(IUploadBuffer* pUploadBuffer) override final;
 
@@ -0,0 +1,258 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of TransientTextureAllocator class
+
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../GraphicsEngine/interface/DeviceMemory.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Transient texture flags.
+enum TRANSIENT_TEXTURE_FLAGS : Uint8
+{
+    /// No flags.
+    TRANSIENT_TEXTURE_FLAG_NONE = 0u,
+
+    /// The texture is only used as a framebuffer attachment within render passes
+    /// and may be memoryless (see MISC_TEXTURE_FLAG_MEMORYLESS) if the device supports it.
+    TRANSIENT_TEXTURE_FLAG_ALLOW_MEMORYLESS = 1u << 0,
+
+    /// The texture must not share memory with other textures.
+    TRANSIENT_TEXTURE_FLAG_NO_ALIASING = 1u << 1
+};
+DEFINE_FLAG_ENUM_OPERATORS(TRANSIENT_TEXTURE_FLAGS);
+
+/// Transient texture allocator create information.
+struct TransientTextureAllocatorCreateInfo
+{
+    /// Allocator name.
+    const Char* Name = nullptr;
+
+    /// Whether to alias texture memory when the device supports it.
+
+    /// \remarks    Aliasing requires SparseResources device feature and SPARSE_RESOURCE_CAP_FLAG_ALIASED
+    ///             capability. Textures that can't be aliased share texture objects instead.
+    bool EnableAliasing = true;
+
+    /// Whether to create memoryless textures when the device supports them,
+    /// see TRANSIENT_TEXTURE_FLAG_ALLOW_MEMORYLESS.
+    bool EnableMemoryless = true;
+};
+
+/// Transient texture allocator statistics.
+struct TransientTextureAllocatorStats
+{
+    /// The number of declared textures.
+    Uint32 NumTextures = 0;
+
+    /// The number of declared textures that share memory in the aliasing heap.
+    Uint32 NumAliasedTextures = 0;
+
+    /// The number of declared textures that are memoryless.
+    Uint32 NumMemorylessTextures = 0;
+
+    /// The number of texture objects created for textures that are not aliased.
+    Uint32 NumPooledTextureObjects = 0;
+
+    /// The total memory size of the aliased textures if they were not aliased, in bytes.
+    Uint64 AliasedTexturesSize = 0;
+
+    /// The size of the aliasing heap, in bytes.
+    Uint64 HeapSize = 0;
+
+    /// The number of times the allocator layout has been rebuilt.
+    Uint32 NumCompiles = 0;
+};
+
+/// Allocates intermediate textures with frame-relative lifetimes.
+
+/// An application declares transient textures together with the range of passes
+/// in which they are used, and the allocator places textures whose lifetimes do not
+/// overlap into the same memory:
+///     - When aliasing is supported, textures are created as sparse textures with
+///       MISC_TEXTURE_FLAG_SPARSE_ALIASING and are bound to one shared device memory
+///       object at offsets computed from their lifetimes.
+///     - Textures that allow it are created as memoryless on tile-based GPUs.
+///     - Other textures with identical descriptions and disjoint lifetimes share
+///       the same texture object.
+///
+/// A typical frame looks as follows:
+///
+///     Allocator.Reset();
+///     auto Color = Allocator.DeclareTexture(ColorDesc, 0, 1);
+///     auto Blur  = Allocator.DeclareTexture(BlurDesc,  1, 2);
+///     Allocator.Compile(pDevice, pContext);
+///     for (Uint32 Pass = 0; Pass < NumPasses; ++Pass)
+///     {
+///         Allocator.BeginPass(pContext, Pass);
+///         // Render pass using Allocator.GetTexture(...)
+///     }
+///
+/// Compile() only rebuilds the layout when the declarations differ from the previous
+/// frame, so declaring the same textures every frame is cheap.
+///
+/// \remarks    Contents of a transient texture are undefined at the beginning of its first pass.
+///             The allocator is not thread-safe.
+class TransientTextureAllocator
+{
+public:
+    /// Invalid texture handle.
+    static constexpr Uint32 InvalidHandle = ~0u;
+
+    TransientTextureAllocator(IRenderDevice* pDevice, const TransientTextureAllocatorCreateInfo& CreateInfo);
+
+    // clang-format off
+    TransientTextureAllocator           (const TransientTextureAllocator&)  = delete;
+    TransientTextureAllocator& operator=(const TransientTextureAllocator&)  = delete;
+    TransientTextureAllocator           (      TransientTextureAllocator&&) = delete;
+    TransientTextureAllocator& operator=(      TransientTextureAllocator&&) = delete;
+    // clang-format on
+
+    ~TransientTextureAllocator();
+
+    /// Clears the texture declarations. Call this method at the beginning of every frame.
+
+    /// \remarks    Texture objects and memory are kept and reused by the next Compile().
+    void Reset();
+
+    /// Declares a transient texture.
+
+    /// \param[in] Desc      - Texture description. Usage must be USAGE_DEFAULT.
+    /// \param[in] FirstPass - The first pass that uses the texture.
+    /// \param[in] LastPass  - The last pass that uses the texture.
+    /// \param[in] Flags     - Texture flags, see Diligent::TRANSIENT_TEXTURE_FLAGS.
+    ///
+    /// \return     Texture handle that is valid until the next Reset().
+    Uint32 DeclareTexture(const TextureDesc&      Desc,
+                          Uint32                  FirstPass,
+                          Uint32                  LastPass,
+                          TRANSIENT_TEXTURE_FLAGS Flags = TRANSIENT_TEXTURE_FLAG_NONE);
+
+    /// Creates textures and binds memory for the declared textures.
+
+    /// \param[in] pDevice  - Render device to create textures and memory.
+    /// \param[in] pContext - Immediate device context to bind sparse memory.
+    ///
+    /// \remarks    If the declarations are the same as in the previous call,
+    ///             the method does nothing.
+    void Compile(IRenderDevice* pDevice, IDeviceContext* pContext);
+
+    /// Prepares the textures whose lifetime starts in the given pass.
+
+    /// \param[in] pContext - Device context to record aliasing barriers.
+    /// \param[in] Pass     - Pass index.
+    ///
+    /// \remarks    The method must be called for every pass in increasing order before
+    ///             the textures of the pass are accessed.
+    void BeginPass(IDeviceContext* pContext, Uint32 Pass);
+
+    /// Returns the texture object for the handle returned by DeclareTexture().
+    ITexture* GetTexture(Uint32 Handle) const;
+
+    /// Returns the allocator statistics, see Diligent::TransientTextureAllocatorStats.
+    TransientTextureAllocatorStats GetStats() const;
+
+private:
+    struct TextureDeclaration
+    {
+        TextureDesc             Desc;
+        Uint32                  FirstPass = 0;
+        Uint32                  LastPass  = 0;
+        TRANSIENT_TEXTURE_FLAGS Flags     = TRANSIENT_TEXTURE_FLAG_NONE;
+
+        bool operator==(const TextureDeclaration& RHS) const
+        {
+            return Desc == RHS.Desc && FirstPass == RHS.FirstPass && LastPass == RHS.LastPass && Flags == RHS.Flags;
+        }
+    };
+
+    bool CanAlias(IRenderDevice* pDevice, const TextureDeclaration& Decl) const;
+    bool CanBeMemoryless(IRenderDevice* pDevice, const TextureDeclaration& Decl) const;
+
+    void CompileAliasedTextures(IRenderDevice*             pDevice,
+                                IDeviceContext*            pContext,
+                                const std::vector<Uint32>& Handles,
+                                std::vector<Uint32>&       FallbackHandles);
+    void CompilePooledTextures(IRenderDevice* pDevice, const std::vector<Uint32>& Handles);
+
+    const std::string m_Name;
+    const bool        m_EnableAliasing;
+    const bool        m_EnableMemoryless;
+
+    // Declarations of the current frame
+    std::vector<TextureDeclaration> m_Declarations;
+    // Declarations the current layout was built for
+    std::vector<TextureDeclaration> m_CompiledDeclarations;
+
+    struct TextureSlot
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+
+        // Memory offset in the aliasing heap and memory size for aliased textures
+        Uint64 MemoryOffset = 0;
+        Uint64 MemorySize   = 0;
+
+        bool IsAliased    = false;
+        bool IsMemoryless = false;
+    };
+    // Texture slots indexed by texture handle
+    std::vector<TextureSlot> m_Slots;
+
+    struct PooledTexture
+    {
+        RefCntAutoPtr<ITexture> pTexture;
+
+        // The last pass of the texture that currently uses the object
+        Uint32 LastPass = 0;
+        bool   InUse    = false;
+    };
+    std::vector<PooledTexture> m_Pool;
+
+    RefCntAutoPtr<IDeviceMemory> m_pHeap;
+
+    Uint64 m_NextBeforeBindFenceValue = 1;
+    Uint64 m_NextAfterBindFenceValue  = 1;
+
+    RefCntAutoPtr<IFence> m_pBeforeBindFence;
+    RefCntAutoPtr<IFence> m_pAfterBindFence;
+
+    Uint32 m_NumCompiles = 0;
+};
+
+} // namespace Diligent
@@ -34,6 +34,8 @@
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../../Common/interface/StringTools.h"
 
+#include <functional>
+
 namespace Diligent
 {
 
@@ -52,6 +54,9 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_VertexPool =
 struct IVertexPoolAllocation : public IObject
 {
     /// Returns the start vertex of the allocation.
+
+    /// \remarks    The start vertex may change when the pool is defragmented,
+    ///             see IVertexPool::Defragment().
     virtual Uint32 GetStartVertex() const = 0;
 
     /// Returns the number of vertices in the allocation.
@@ -205,6 +210,13 @@ struct VertexPoolDesc
     }
 };
 
+/// Callback that is called by IVertexPool::Defragment() for every moved allocation.
+
+/// \param[in] pAllocation    - The allocation that was moved. Its new start vertex
+///                             is returned by IVertexPoolAllocation::GetStartVertex().
+/// \param[in] OldStartVertex - The start vertex of the allocation before the move.
+using VertexPoolAllocationMovedCallbackType = std::function<void(IVertexPoolAllocation* pAllocation, Uint32 OldStartVertex)>;
+
 /// Vertex pool interface.
 ///
 /// The vertex pool is a collection of dynamic buffers that can be used to store vertex data.
@@ -259,6 +271,26 @@ struct IVertexPool : public IObject
 
     /// Returns the pool description.
     virtual const VertexPoolDesc& GetDesc() const = 0;
+
+    /// Incrementally defragments the pool.
+
+    /// \param[in]  pDevice        - A pointer to the render device that will be used to
+    ///                              create the scratch buffer, if necessary.
+    /// \param[in]  pContext       - A pointer to the device context that will be used to
+    ///                              copy the vertex data.
+    /// \param[in]  MaxBytesToMove - The maximum number of bytes to move across all buffers.
+    ///                              At least one allocation is moved if it can be moved
+    ///                              to a lower start vertex.
+    /// \param[in]  OnMoved        - Optional callback that is called for every moved allocation,
+    ///                              see Diligent::VertexPoolAllocationMovedCallbackType.
+    /// \return     The number of bytes moved.
+    ///
+    /// \remarks    The method works the same way as IBufferSuballocator::Defragment().
+    ///             All buffers must be USAGE_DEFAULT or USAGE_SPARSE buffers.
+    virtual Uint64 Defragment(IRenderDevice*                               pDevice,
+                              IDeviceContext*                              pContext,
+                              Uint64                                       MaxBytesToMove,
+                              const VertexPoolAllocationMovedCallbackType& OnMoved = nullptr) = 0;
 };
 
 
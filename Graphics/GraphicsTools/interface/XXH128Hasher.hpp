@@ -27,6 +27,8 @@
 #pragma once
 
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Graphics/GraphicsEngine/interface/Shader.h"
@@ -123,6 +125,10 @@ struct XXH128State final
 
     void Update(const ShaderCreateInfo& ShaderCI) noexcept;
 
+    /// Same as Update(const ShaderCreateInfo&), but also returns the paths of all source
+    /// files (including includes) that were loaded through the shader source stream factory.
+    void Update(const ShaderCreateInfo& ShaderCI, std::vector<std::string>* pSourceFiles) noexcept;
+
     template <typename T>
     typename std::enable_if<(std::is_same<typename std::remove_cv<T>::type, SamplerDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, StencilOpDesc>::value ||
@@ -130,6 +136,7 @@ struct XXH128State final
                              std::is_same<typename std::remove_cv<T>::type, RasterizerStateDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, BlendStateDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, TextureViewDesc>::value ||
+                             std::is_same<typename std::remove_cv<T>::type, BufferViewDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, SampleDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, ShaderResourceVariableDesc>::value ||
                              std::is_same<typename std::remove_cv<T>::type, ImmutableSamplerDesc>::value ||
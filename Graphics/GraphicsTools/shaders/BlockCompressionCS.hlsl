@@ -0,0 +1,398 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+// Compresses 4x4 texel blocks into BC formats. Every thread encodes one block
+// and writes it to the output buffer as 2 (BC1, BC4) or 4 (BC3, BC5, BC6H, BC7) uints.
+//
+// Endpoints are computed from the bounding box of the block, using the box diagonal
+// that follows the texel distribution, and texels are assigned to the closest palette
+// entry by projecting them onto the endpoint segment.
+//
+// BC_FORMAT selects the output format:
+//   1 - BC1 (four-color mode only)
+//   3 - BC3
+//   4 - BC4
+//   5 - BC5
+//   6 - BC6H unsigned (mode 11: single region, 10-bit endpoints)
+//   7 - BC7 (mode 6: single subset with combined color and alpha)
+
+#ifndef BC_FORMAT
+#   define BC_FORMAT 1
+#endif
+
+#if BC_FORMAT == 1 || BC_FORMAT == 4
+#   define BLOCK_SIZE 2u
+#else
+#   define BLOCK_SIZE 4u
+#endif
+
+#ifndef THREAD_GROUP_SIZE
+#   define THREAD_GROUP_SIZE 8
+#endif
+
+#ifndef CONVERT_TO_SRGB
+#   define CONVERT_TO_SRGB 0
+#endif
+
+Texture2D<float4>        g_SrcTexture;
+RWStructuredBuffer<uint> g_DstBlocks;
+
+cbuffer cbBlockCompressionAttribs
+{
+    uint2 g_SrcSize;      // Source size, in texels
+    uint2 g_NumBlocks;    // Number of blocks in the output
+    uint  g_DstRowStride; // Stride between block rows in the output buffer, in uints
+    uint  g_Padding0;
+    uint  g_Padding1;
+    uint  g_Padding2;
+}
+
+float LinearToSRGB(float x)
+{
+    return x <= 0.0031308 ? x * 12.92 : 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+}
+
+float4 LoadTexel(uint2 Block, uint i)
+{
+    // Replicate edge texels for incomplete blocks
+    uint2  Coord = min(Block * 4u + uint2(i % 4u, i / 4u), g_SrcSize - 1u);
+    float4 Texel = g_SrcTexture.Load(int3(Coord, 0));
+#if BC_FORMAT == 6
+    // HDR data is encoded as is
+    return Texel;
+#else
+#    if CONVERT_TO_SRGB
+    Texel.rgb = float3(LinearToSRGB(Texel.r), LinearToSRGB(Texel.g), LinearToSRGB(Texel.b));
+#    endif
+    return saturate(Texel) * 255.0;
+#endif
+}
+
+// Computes the endpoints from the bounding box of the texels.
+// Channels that are not set in the mask are ignored.
+void ComputeEndpoints(in float4 Texels[16], float4 Mask, float InsetScale, out float4 E0, out float4 E1)
+{
+    float4 MinC = Texels[0];
+    float4 MaxC = Texels[0];
+    float4 Mean = float4(0.0, 0.0, 0.0, 0.0);
+    for (uint i = 0u; i < 16u; ++i)
+    {
+        MinC = min(MinC, Texels[i]);
+        MaxC = max(MaxC, Texels[i]);
+        Mean += Texels[i];
+    }
+    Mean /= 16.0;
+
+    // Select the diagonal of the box that follows the texel distribution:
+    // flip channels that are anti-correlated with the channel of the largest range.
+    float4 Range    = (MaxC - MinC) * Mask;
+    float  MaxRange = max(max(Range.x, Range.y), max(Range.z, Range.w));
+    uint   RefCh    = Range.x == MaxRange ? 0u : (Range.y == MaxRange ? 1u : (Range.z == MaxRange ? 2u : 3u));
+
+    float4 Cov = float4(0.0, 0.0, 0.0, 0.0);
+    for (uint j = 0u; j < 16u; ++j)
+    {
+        float4 d = Texels[j] - Mean;
+        Cov += d * d[RefCh];
+    }
+    float4 Flip = float4(Cov < float4(0.0, 0.0, 0.0, 0.0));
+    E0 = lerp(MinC, MaxC, Flip);
+    E1 = lerp(MaxC, MinC, Flip);
+
+    // Inset the box to reduce the average error
+    float4 Inset = (E1 - E0) * InsetScale;
+    E0 = (E0 + Inset) * Mask;
+    E1 = (E1 - Inset) * Mask;
+}
+
+// Returns the relative positions of the texels along the E0->E1 segment, in [0, 1]
+void ProjectTexels(in float4 Texels[16], float4 E0, float4 E1, float4 Mask, out float Pos[16])
+{
+    float4 Dir   = (E1 - E0) * Mask;
+    float  LenSq = dot(Dir, Dir);
+    Dir = LenSq > 1e-6 ? Dir / LenSq : float4(0.0, 0.0, 0.0, 0.0);
+    for (uint i = 0u; i < 16u; ++i)
+        Pos[i] = saturate(dot(Texels[i] * Mask - E0, Dir));
+}
+
+// Writes NumBits bits of Value to the block at the bit position Pos
+void WriteBits(inout uint4 Block, inout uint Pos, uint Value, uint NumBits)
+{
+    uint Word  = Pos / 32u;
+    uint Shift = Pos % 32u;
+    Block[Word] |= Value << Shift;
+    if (Shift + NumBits > 32u)
+        Block[Word + 1u] |= Value >> (32u - Shift);
+    Pos += NumBits;
+}
+
+
+uint PackRGB565(float3 Color)
+{
+    uint3 q = uint3(saturate(Color / 255.0) * float3(31.0, 63.0, 31.0) + 0.5);
+    return (q.r << 11u) | (q.g << 5u) | q.b;
+}
+
+float3 UnpackRGB565(uint Color)
+{
+    uint3 q = uint3((Color >> 11u) & 0x1Fu, (Color >> 5u) & 0x3Fu, Color & 0x1Fu);
+    return float3((q.r << 3u) | (q.r >> 2u), (q.g << 2u) | (q.g >> 4u), (q.b << 3u) | (q.b >> 2u));
+}
+
+uint2 EncodeBC1(in float4 Texels[16])
+{
+    float4 Mask = float4(1.0, 1.0, 1.0, 0.0);
+    float4 E0, E1;
+    ComputeEndpoints(Texels, Mask, 1.0 / 16.0, E0, E1);
+
+    uint C0 = PackRGB565(E0.rgb);
+    uint C1 = PackRGB565(E1.rgb);
+    // Four-color mode requires C0 > C1. When C0 == C1, all indices are 0.
+    if (C0 < C1)
+    {
+        uint Tmp = C0;
+        C0       = C1;
+        C1       = Tmp;
+    }
+
+    float Pos[16];
+    ProjectTexels(Texels, float4(UnpackRGB565(C0), 0.0), float4(UnpackRGB565(C1), 0.0), Mask, Pos);
+
+    uint4 Block  = uint4(0u, 0u, 0u, 0u);
+    uint  BitPos = 0u;
+    WriteBits(Block, BitPos, C0, 16u);
+    WriteBits(Block, BitPos, C1, 16u);
+
+    // Palette entries in the order of increasing position: 0, 2, 3, 1
+    const uint IndexMap[4] = {0u, 2u, 3u, 1u};
+    for (uint i = 0u; i < 16u; ++i)
+        WriteBits(Block, BitPos, IndexMap[uint(Pos[i] * 3.0 + 0.5)], 2u);
+
+    return Block.xy;
+}
+
+uint2 EncodeBC4(in float4 Texels[16], uint Channel)
+{
+    float4 Mask   = float4(0.0, 0.0, 0.0, 0.0);
+    Mask[Channel] = 1.0;
+
+    float MinVal = Texels[0][Channel];
+    float MaxVal = Texels[0][Channel];
+    for (uint i = 1u; i < 16u; ++i)
+    {
+        MinVal = min(MinVal, Texels[i][Channel]);
+        MaxVal = max(MaxVal, Texels[i][Channel]);
+    }
+
+    // Eight-value mode: A0 > A1. When A0 == A1, all indices are 0.
+    uint A0 = uint(MaxVal + 0.5);
+    uint A1 = uint(MinVal + 0.5);
+
+    float Pos[16];
+    ProjectTexels(Texels, Mask * float(A0), Mask * float(A1), Mask, Pos);
+
+    uint4 Block  = uint4(0u, 0u, 0u, 0u);
+    uint  BitPos = 0u;
+    WriteBits(Block, BitPos, A0, 8u);
+    WriteBits(Block, BitPos, A1, 8u);
+    for (uint j = 0u; j < 16u; ++j)
+    {
+        // Palette entries in the order of increasing position: 0, 2, 3, ..., 7, 1
+        uint q = uint(Pos[j] * 7.0 + 0.5);
+        WriteBits(Block, BitPos, q == 0u ? 0u : (q == 7u ? 1u : q + 1u), 3u);
+    }
+
+    return Block.xy;
+}
+
+// Quantizes the BC7 endpoint to 7-bit components with the shared P-bit
+uint4 QuantizeBC7Endpoint(float4 E, out uint P)
+{
+    uint4 Best      = uint4(0u, 0u, 0u, 0u);
+    float BestError = 1e+30;
+    P               = 0u;
+    for (uint p = 0u; p < 2u; ++p)
+    {
+        uint4  q     = uint4(clamp((E - float(p)) * 0.5 + 0.5, 0.0, 127.0));
+        float4 d     = float4(q * 2u + p) - E;
+        float  Error = dot(d, d);
+        if (Error < BestError)
+        {
+            BestError = Error;
+            Best      = q;
+            P         = p;
+        }
+    }
+    return Best;
+}
+
+// Writes 4-bit indices of a single-region block. The most significant bit of the first index
+// is implicitly zero, so the caller must make sure that it is less than 8.
+void WriteIndices4(inout uint4 Block, inout uint BitPos, in uint Indices[16])
+{
+    WriteBits(Block, BitPos, Indices[0], 3u);
+    for (uint i = 1u; i < 16u; ++i)
+        WriteBits(Block, BitPos, Indices[i], 4u);
+}
+
+uint4 EncodeBC7(in float4 Texels[16])
+{
+    float4 Mask = float4(1.0, 1.0, 1.0, 1.0);
+    float4 E0, E1;
+    ComputeEndpoints(Texels, Mask, 1.0 / 32.0, E0, E1);
+
+    uint  P0, P1;
+    uint4 Q0 = QuantizeBC7Endpoint(E0, P0);
+    uint4 Q1 = QuantizeBC7Endpoint(E1, P1);
+
+    float Pos[16];
+    ProjectTexels(Texels, float4(Q0 * 2u + P0), float4(Q1 * 2u + P1), Mask, Pos);
+
+    uint Indices[16];
+    for (uint i = 0u; i < 16u; ++i)
+        Indices[i] = uint(Pos[i] * 15.0 + 0.5);
+
+    if (Indices[0] >= 8u)
+    {
+        uint4 TmpQ = Q0;
+        Q0         = Q1;
+        Q1         = TmpQ;
+        uint TmpP  = P0;
+        P0         = P1;
+        P1         = TmpP;
+        for (uint j = 0u; j < 16u; ++j)
+            Indices[j] = 15u - Indices[j];
+    }
+
+    uint4 Block  = uint4(0u, 0u, 0u, 0u);
+    uint  BitPos = 0u;
+    WriteBits(Block, BitPos, 1u << 6u, 7u); // Mode 6
+    for (uint c = 0u; c < 4u; ++c)
+    {
+        WriteBits(Block, BitPos, Q0[c], 7u);
+        WriteBits(Block, BitPos, Q1[c], 7u);
+    }
+    WriteBits(Block, BitPos, P0, 1u);
+    WriteBits(Block, BitPos, P1, 1u);
+    WriteIndices4(Block, BitPos, Indices);
+
+    return Block;
+}
+
+// Maps the value to the space of unquantized BC6H endpoints,
+// where palette entries are interpolated linearly.
+float ToBC6HUnquantized(float x)
+{
+    // Negative values, NaNs and infinities can't be represented
+    uint h = f32tof16(clamp(x, 0.0, 65504.0));
+    return float(h) * (64.0 / 31.0);
+}
+
+uint QuantizeBC6HEndpoint(float u)
+{
+    return uint(clamp((u - 32.0) / 64.0 + 0.5, 0.0, 1023.0));
+}
+
+float UnquantizeBC6HEndpoint(uint q)
+{
+    return q == 0u ? 0.0 : (q == 1023u ? 65535.0 : float(((q << 16u) + 0x8000u) >> 10u));
+}
+
+uint4 EncodeBC6H(in float4 Texels[16])
+{
+    float4 U[16];
+    for (uint i = 0u; i < 16u; ++i)
+        U[i] = float4(ToBC6HUnquantized(Texels[i].r), ToBC6HUnquantized(Texels[i].g), ToBC6HUnquantized(Texels[i].b), 0.0);
+
+    float4 Mask = float4(1.0, 1.0, 1.0, 0.0);
+    float4 E0, E1;
+    ComputeEndpoints(U, Mask, 1.0 / 32.0, E0, E1);
+
+    uint3 Q0 = uint3(QuantizeBC6HEndpoint(E0.r), QuantizeBC6HEndpoint(E0.g), QuantizeBC6HEndpoint(E0.b));
+    uint3 Q1 = uint3(QuantizeBC6HEndpoint(E1.r), QuantizeBC6HEndpoint(E1.g), QuantizeBC6HEndpoint(E1.b));
+
+    float Pos[16];
+    ProjectTexels(U,
+                  float4(UnquantizeBC6HEndpoint(Q0.r), UnquantizeBC6HEndpoint(Q0.g), UnquantizeBC6HEndpoint(Q0.b), 0.0),
+                  float4(UnquantizeBC6HEndpoint(Q1.r), UnquantizeBC6HEndpoint(Q1.g), UnquantizeBC6HEndpoint(Q1.b), 0.0),
+                  Mask, Pos);
+
+    uint Indices[16];
+    for (uint j = 0u; j < 16u; ++j)
+        Indices[j] = uint(Pos[j] * 15.0 + 0.5);
+
+    if (Indices[0] >= 8u)
+    {
+        uint3 Tmp = Q0;
+        Q0        = Q1;
+        Q1        = Tmp;
+        for (uint k = 0u; k < 16u; ++k)
+            Indices[k] = 15u - Indices[k];
+    }
+
+    uint4 Block  = uint4(0u, 0u, 0u, 0u);
+    uint  BitPos = 0u;
+    WriteBits(Block, BitPos, 0x03u, 5u); // Mode 11
+    for (uint c0 = 0u; c0 < 3u; ++c0)
+        WriteBits(Block, BitPos, Q0[c0], 10u);
+    for (uint c1 = 0u; c1 < 3u; ++c1)
+        WriteBits(Block, BitPos, Q1[c1], 10u);
+    WriteIndices4(Block, BitPos, Indices);
+
+    return Block;
+}
+
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void main(uint3 ThreadId : SV_DispatchThreadID)
+{
+    if (ThreadId.x >= g_NumBlocks.x || ThreadId.y >= g_NumBlocks.y)
+        return;
+
+    float4 Texels[16];
+    for (uint i = 0u; i < 16u; ++i)
+        Texels[i] = LoadTexel(ThreadId.xy, i);
+
+#if BC_FORMAT == 1
+    uint4 Block = uint4(EncodeBC1(Texels), 0u, 0u);
+#elif BC_FORMAT == 3
+    uint4 Block = uint4(EncodeBC4(Texels, 3u), EncodeBC1(Texels));
+#elif BC_FORMAT == 4
+    uint4 Block = uint4(EncodeBC4(Texels, 0u), 0u, 0u);
+#elif BC_FORMAT == 5
+    uint4 Block = uint4(EncodeBC4(Texels, 0u), EncodeBC4(Texels, 1u));
+#elif BC_FORMAT == 6
+    uint4 Block = EncodeBC6H(Texels);
+#elif BC_FORMAT == 7
+    uint4 Block = EncodeBC7(Texels);
+#else
+#   error Unexpected BC format
+#endif
+
+    uint Offset = ThreadId.y * g_DstRowStride + ThreadId.x * BLOCK_SIZE;
+    for (uint w = 0u; w < BLOCK_SIZE; ++w)
+        g_DstBlocks[Offset + w] = Block[w];
+}
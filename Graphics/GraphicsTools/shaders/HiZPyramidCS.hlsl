@@ -0,0 +1,200 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+// Builds up to four levels of the Hi-Z pyramid from the source texture in one dispatch.
+//
+// Every 8x8 thread group produces a 16x16 tile of the first output level and reduces it
+// to 8x8, 4x4 and 2x2 tiles of the next three levels, the last two through the group
+// shared memory.
+//
+// Every texel of the first output level is the reduction of all source texels that its
+// footprint overlaps. The footprint covers up to 3x3 texels, which conservatively handles
+// non-power-of-two depth buffers that are reduced into the power-of-two level 0.
+//
+// REDUCTION_MODE selects the reduction:
+//   0 - minimum depth
+//   1 - maximum depth
+//   2 - minimum depth in the red channel and maximum depth in the green channel
+//
+// SOURCE_IS_DEPTH is set when the source is the single-channel depth buffer
+// rather than a level of the pyramid.
+
+#ifndef REDUCTION_MODE
+#   define REDUCTION_MODE 1
+#endif
+
+#ifndef SOURCE_IS_DEPTH
+#   define SOURCE_IS_DEPTH 1
+#endif
+
+#if REDUCTION_MODE == 2
+#   define HIZ_TYPE float2
+#else
+#   define HIZ_TYPE float
+#endif
+
+#if SOURCE_IS_DEPTH
+Texture2D<float>    g_Source;
+#else
+Texture2D<HIZ_TYPE> g_Source;
+#endif
+
+// Storage image formats must be spelled out for the GLSL converter
+#if REDUCTION_MODE == 2
+RWTexture2D<float2 /*format = rg32f*/> g_OutLevel0;
+RWTexture2D<float2 /*format = rg32f*/> g_OutLevel1;
+RWTexture2D<float2 /*format = rg32f*/> g_OutLevel2;
+RWTexture2D<float2 /*format = rg32f*/> g_OutLevel3;
+#else
+RWTexture2D<float /*format = r32f*/> g_OutLevel0;
+RWTexture2D<float /*format = r32f*/> g_OutLevel1;
+RWTexture2D<float /*format = r32f*/> g_OutLevel2;
+RWTexture2D<float /*format = r32f*/> g_OutLevel3;
+#endif
+
+cbuffer cbHiZPyramidAttribs
+{
+    uint2 g_SrcSize;   // Size of the source texture, in texels
+    uint2 g_DstSize;   // Size of the first output level, in texels
+    uint  g_NumLevels; // Number of levels to write: [1, 4]
+    uint  g_Padding0;
+    uint  g_Padding1;
+    uint  g_Padding2;
+}
+
+groupshared HIZ_TYPE gs_Values[64];
+
+HIZ_TYPE Reduce(HIZ_TYPE a, HIZ_TYPE b)
+{
+#if REDUCTION_MODE == 0
+    return min(a, b);
+#elif REDUCTION_MODE == 1
+    return max(a, b);
+#else
+    return float2(min(a.x, b.x), max(a.y, b.y));
+#endif
+}
+
+HIZ_TYPE Reduce4(HIZ_TYPE a, HIZ_TYPE b, HIZ_TYPE c, HIZ_TYPE d)
+{
+    return Reduce(Reduce(a, b), Reduce(c, d));
+}
+
+HIZ_TYPE LoadSource(uint2 Coord)
+{
+#if SOURCE_IS_DEPTH && REDUCTION_MODE == 2
+    float Depth = g_Source.Load(int3(Coord, 0));
+    return float2(Depth, Depth);
+#else
+    return g_Source.Load(int3(Coord, 0));
+#endif
+}
+
+// Reduces the source texels overlapped by the footprint of the first output level texel
+HIZ_TYPE ReduceFootprint(uint2 DstCoord)
+{
+    // Texels outside of the level duplicate the edge texels and do not affect the reduction
+    DstCoord = min(DstCoord, g_DstSize - 1u);
+
+    uint2 First = (DstCoord * g_SrcSize) / g_DstSize;
+    uint2 Last  = ((DstCoord + 1u) * g_SrcSize + g_DstSize - 1u) / g_DstSize - 1u;
+    Last = min(Last, g_SrcSize - 1u);
+
+    HIZ_TYPE Value = LoadSource(First);
+    [unroll]
+    for (uint y = 0u; y < 3u; ++y)
+    {
+        [unroll]
+        for (uint x = 0u; x < 3u; ++x)
+        {
+            uint2 Coord = First + uint2(x, y);
+            if (Coord.x <= Last.x && Coord.y <= Last.y)
+                Value = Reduce(Value, LoadSource(Coord));
+        }
+    }
+    return Value;
+}
+
+void StoreLevel(uint Level, uint2 Coord, HIZ_TYPE Value)
+{
+    uint2 LevelSize = max(g_DstSize >> Level, uint2(1u, 1u));
+    if (Level >= g_NumLevels || Coord.x >= LevelSize.x || Coord.y >= LevelSize.y)
+        return;
+
+    if (Level == 0u)
+        g_OutLevel0[Coord] = Value;
+    else if (Level == 1u)
+        g_OutLevel1[Coord] = Value;
+    else if (Level == 2u)
+        g_OutLevel2[Coord] = Value;
+    else
+        g_OutLevel3[Coord] = Value;
+}
+
+[numthreads(8, 8, 1)]
+void main(uint3 GroupId : SV_GroupID, uint3 GTid : SV_GroupThreadID)
+{
+    uint2 Tile = GroupId.xy;
+    uint2 XY   = GTid.xy;
+
+    // Level 0: 16x16 tile, every thread processes a 2x2 block
+    uint2    Coord0 = Tile * 16u + XY * 2u;
+    HIZ_TYPE V00    = ReduceFootprint(Coord0 + uint2(0u, 0u));
+    HIZ_TYPE V10    = ReduceFootprint(Coord0 + uint2(1u, 0u));
+    HIZ_TYPE V01    = ReduceFootprint(Coord0 + uint2(0u, 1u));
+    HIZ_TYPE V11    = ReduceFootprint(Coord0 + uint2(1u, 1u));
+    StoreLevel(0u, Coord0 + uint2(0u, 0u), V00);
+    StoreLevel(0u, Coord0 + uint2(1u, 0u), V10);
+    StoreLevel(0u, Coord0 + uint2(0u, 1u), V01);
+    StoreLevel(0u, Coord0 + uint2(1u, 1u), V11);
+
+    // Level 1: 8x8 tile
+    HIZ_TYPE Value = Reduce4(V00, V10, V01, V11);
+    StoreLevel(1u, Tile * 8u + XY, Value);
+    gs_Values[XY.y * 8u + XY.x] = Value;
+    GroupMemoryBarrierWithGroupSync();
+
+    // Level 2: 4x4 tile
+    if (XY.x < 4u && XY.y < 4u)
+    {
+        uint Idx = XY.y * 16u + XY.x * 2u;
+        Value = Reduce4(gs_Values[Idx], gs_Values[Idx + 1u], gs_Values[Idx + 8u], gs_Values[Idx + 9u]);
+        StoreLevel(2u, Tile * 4u + XY, Value);
+    }
+    GroupMemoryBarrierWithGroupSync();
+    if (XY.x < 4u && XY.y < 4u)
+        gs_Values[XY.y * 8u + XY.x] = Value;
+    GroupMemoryBarrierWithGroupSync();
+
+    // Level 3: 2x2 tile
+    if (XY.x < 2u && XY.y < 2u)
+    {
+        uint Idx = XY.y * 16u + XY.x * 2u;
+        Value = Reduce4(gs_Values[Idx], gs_Values[Idx + 1u], gs_Values[Idx + 8u], gs_Values[Idx + 9u]);
+        StoreLevel(3u, Tile * 2u + XY, Value);
+    }
+}
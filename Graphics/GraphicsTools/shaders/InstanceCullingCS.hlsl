@@ -0,0 +1,215 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+// Culls instances against the view frustum and, optionally, a hierarchical depth buffer,
+// and generates compacted DrawIndexedIndirect arguments for the meshes with visible instances.
+//
+// Entry points:
+//   ResetCS     - resets the per-mesh instance counters and the draw counter (one thread per mesh)
+//   CullCS      - culls the instances and writes the indices of the visible ones
+//                 to the ranges of their meshes (one thread per instance)
+//   BuildArgsCS - writes the draw arguments of the meshes with visible instances (one thread per mesh)
+//
+// USE_HIZ enables the occlusion test against the Hi-Z pyramid.
+
+#ifndef THREAD_GROUP_SIZE
+#   define THREAD_GROUP_SIZE 64
+#endif
+
+#ifndef USE_HIZ
+#   define USE_HIZ 0
+#endif
+
+// Mirrors GPUInstanceCuller::InstanceData
+struct InstanceData
+{
+    float3 BoundsMin;
+    uint   MeshId;
+    float3 BoundsMax;
+    uint   UserData;
+};
+
+// Mirrors GPUInstanceCuller::MeshData
+struct MeshData
+{
+    uint NumIndices;
+    uint FirstIndexLocation;
+    uint BaseVertex;
+    uint FirstInstance;
+};
+
+cbuffer cbInstanceCullingAttribs
+{
+    float4   g_FrustumPlanes[6];
+    float4x4 g_ViewProj;
+
+    uint   g_NumInstances;
+    uint   g_NumMeshes;
+    uint   g_NumVisibleInstanceSlots;
+    uint   g_ReverseDepth;
+
+    float2 g_HiZSize;      // Size of the most detailed Hi-Z level, in texels
+    uint   g_HiZMipLevels;
+    uint   g_Padding;
+}
+
+StructuredBuffer<InstanceData> g_Instances;
+StructuredBuffer<MeshData>     g_Meshes;
+
+RWStructuredBuffer<uint> g_MeshInstanceCounts;
+RWByteAddressBuffer      g_VisibleInstances;
+RWByteAddressBuffer      g_DrawArgs;
+RWByteAddressBuffer      g_DrawCount;
+
+#if USE_HIZ
+// Every texel contains the farthest depth of the corresponding texels of the previous level
+Texture2D<float> g_HiZ;
+#endif
+
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void ResetCS(uint3 DTid : SV_DispatchThreadID)
+{
+    if (DTid.x == 0u)
+        g_DrawCount.Store(0, 0u);
+
+    if (DTid.x < g_NumMeshes)
+        g_MeshInstanceCounts[DTid.x] = 0u;
+}
+
+bool IsInsideFrustum(float3 BoxMin, float3 BoxMax)
+{
+    // Same test as GetBoxVisibilityAgainstPlane() in AdvancedMath.hpp
+    float3 Center     = (BoxMax + BoxMin) * 0.5;
+    float3 HalfExtent = (BoxMax - BoxMin) * 0.5;
+    for (uint i = 0u; i < 6u; ++i)
+    {
+        float4 Plane       = g_FrustumPlanes[i];
+        float  Distance    = dot(Center, Plane.xyz) + Plane.w;
+        float  ProjHalfLen = dot(HalfExtent, abs(Plane.xyz));
+        if (Distance < -ProjHalfLen)
+            return false;
+    }
+    return true;
+}
+
+#if USE_HIZ
+bool IsOccluded(float3 BoxMin, float3 BoxMax)
+{
+    float2 UVMin        = float2(1.0, 1.0);
+    float2 UVMax        = float2(0.0, 0.0);
+    float  NearestDepth = g_ReverseDepth != 0u ? 0.0 : 1.0;
+    for (uint i = 0u; i < 8u; ++i)
+    {
+        float3 Corner;
+        Corner.x = (i & 1u) != 0u ? BoxMax.x : BoxMin.x;
+        Corner.y = (i & 2u) != 0u ? BoxMax.y : BoxMin.y;
+        Corner.z = (i & 4u) != 0u ? BoxMax.z : BoxMin.z;
+
+        float4 ClipPos = mul(float4(Corner, 1.0), g_ViewProj);
+        // Boxes that cross the camera plane are never occluded
+        if (ClipPos.w <= 0.0)
+            return false;
+
+        float3 NDC = ClipPos.xyz / ClipPos.w;
+        float2 UV  = NDC.xy * float2(0.5, -0.5) + float2(0.5, 0.5);
+        UVMin = min(UVMin, UV);
+        UVMax = max(UVMax, UV);
+        NearestDepth = g_ReverseDepth != 0u ? max(NearestDepth, NDC.z) : min(NearestDepth, NDC.z);
+    }
+    UVMin = saturate(UVMin);
+    UVMax = saturate(UVMax);
+
+    // Select the level where the box covers at most 2x2 texels
+    float2 SizeInTexels = (UVMax - UVMin) * g_HiZSize;
+    float  Level        = ceil(log2(max(max(SizeInTexels.x, SizeInTexels.y), 1.0)));
+    uint   Mip          = min(uint(Level), g_HiZMipLevels - 1u);
+
+    int2 MipSize  = max(int2(g_HiZSize) >> Mip, int2(1, 1));
+    int2 TexelMin = min(int2(UVMin * float2(MipSize)), MipSize - 1);
+    int2 TexelMax = min(int2(UVMax * float2(MipSize)), MipSize - 1);
+
+    float D0 = g_HiZ.Load(int3(TexelMin.x, TexelMin.y, Mip));
+    float D1 = g_HiZ.Load(int3(TexelMax.x, TexelMin.y, Mip));
+    float D2 = g_HiZ.Load(int3(TexelMin.x, TexelMax.y, Mip));
+    float D3 = g_HiZ.Load(int3(TexelMax.x, TexelMax.y, Mip));
+
+    if (g_ReverseDepth != 0u)
+        return NearestDepth < min(min(D0, D1), min(D2, D3));
+    else
+        return NearestDepth > max(max(D0, D1), max(D2, D3));
+}
+#endif
+
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CullCS(uint3 DTid : SV_DispatchThreadID)
+{
+    uint InstanceIdx = DTid.x;
+    if (InstanceIdx >= g_NumInstances)
+        return;
+
+    InstanceData Instance = g_Instances[InstanceIdx];
+    if (Instance.MeshId >= g_NumMeshes)
+        return;
+
+    if (!IsInsideFrustum(Instance.BoundsMin, Instance.BoundsMax))
+        return;
+
+#if USE_HIZ
+    if (IsOccluded(Instance.BoundsMin, Instance.BoundsMax))
+        return;
+#endif
+
+    uint Slot;
+    InterlockedAdd(g_MeshInstanceCounts[Instance.MeshId], 1u, Slot);
+
+    uint DstSlot = g_Meshes[Instance.MeshId].FirstInstance + Slot;
+    if (DstSlot < g_NumVisibleInstanceSlots)
+        g_VisibleInstances.Store(DstSlot * 4u, InstanceIdx);
+}
+
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void BuildArgsCS(uint3 DTid : SV_DispatchThreadID)
+{
+    uint MeshIdx = DTid.x;
+    if (MeshIdx >= g_NumMeshes)
+        return;
+
+    MeshData Mesh = g_Meshes[MeshIdx];
+
+    // Instances that did not fit into the visible instance buffer are dropped
+    uint NumInstances = min(g_MeshInstanceCounts[MeshIdx], g_NumVisibleInstanceSlots - min(Mesh.FirstInstance, g_NumVisibleInstanceSlots));
+    if (NumInstances == 0u)
+        return;
+
+    uint DrawIdx;
+    g_DrawCount.InterlockedAdd(0, 1u, DrawIdx);
+
+    // NumIndices, NumInstances, FirstIndexLocation, BaseVertex, FirstInstanceLocation
+    uint Offset = DrawIdx * 20u;
+    g_DrawArgs.Store4(Offset, uint4(Mesh.NumIndices, NumInstances, Mesh.FirstIndexLocation, Mesh.BaseVertex));
+    g_DrawArgs.Store(Offset + 16u, Mesh.FirstInstance);
+}
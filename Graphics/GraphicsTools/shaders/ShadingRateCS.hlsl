@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+// Computes the shading rate of every tile of the color buffer.
+//
+// Every 8x8 thread group processes one tile and writes one texel of the shading rate texture.
+// Every thread finds the largest perceptual luminance difference between horizontally and
+// vertically adjacent pixels in its subset of the tile, and sums the motion vectors. The
+// results are then reduced through the group shared memory.
+//
+// OUTPUT_FORMAT selects the output:
+//   0 - SHADING_RATE values in R8_UINT texture (SHADING_RATE_FORMAT_PALETTE)
+//   1 - fragment density in RG8_UNORM texture (SHADING_RATE_FORMAT_UNORM8)
+//
+// USE_MOTION_VECTORS is set when the motion vector buffer is bound.
+
+#ifndef OUTPUT_FORMAT
+#   define OUTPUT_FORMAT 0
+#endif
+
+#ifndef USE_MOTION_VECTORS
+#   define USE_MOTION_VECTORS 0
+#endif
+
+// Must match DILIGENT_SHADING_RATE_X_SHIFT
+#define SHADING_RATE_X_SHIFT 2u
+
+Texture2D<float4> g_Color;
+#if USE_MOTION_VECTORS
+Texture2D<float2> g_MotionVectors;
+#endif
+
+// Storage image formats must be spelled out for the GLSL converter
+#if OUTPUT_FORMAT == 0
+RWTexture2D<uint /*format = r8ui*/> g_ShadingRate;
+#else
+RWTexture2D<float2 /*format = rg8*/> g_ShadingRate;
+#endif
+
+cbuffer cbShadingRateAttribs
+{
+    uint2  g_ColorSize;         // Size of the color buffer, in pixels
+    uint2  g_TileSize;          // Size of the tile, in pixels
+    uint2  g_RateTexSize;       // Size of the shading rate texture, in texels
+    uint2  g_MaxAxisRate;       // The coarsest axis rates (AXIS_SHADING_RATE)
+
+    float2 g_MotionVectorScale; // Converts motion vectors to pixels
+    float  g_ContrastThreshold;
+    float  g_MotionThreshold;
+
+    uint   g_AllowAnisotropic;
+    uint   g_Padding0;
+    uint   g_Padding1;
+    uint   g_Padding2;
+
+    uint4  g_RateRemap[3];      // Maps every SHADING_RATE value to the closest rate supported by the device
+}
+
+#define THREAD_GROUP_SIZE 8u
+
+groupshared float4 gs_TileStats[THREAD_GROUP_SIZE * THREAD_GROUP_SIZE];
+
+float LoadLuminance(uint2 Coord)
+{
+    Coord = min(Coord, g_ColorSize - 1u);
+    float3 Color = g_Color.Load(int3(Coord, 0)).rgb;
+    // Square root approximates the perceptual response to linear luminance
+    return sqrt(saturate(dot(Color, float3(0.2126, 0.7152, 0.0722))));
+}
+
+// Returns AXIS_SHADING_RATE value for the largest luminance difference and motion along the axis
+uint GetAxisRate(float MaxDiff, float Motion, uint MaxRate)
+{
+    uint Rate = 0u;
+    if (MaxDiff < g_ContrastThreshold)
+        Rate = MaxDiff < g_ContrastThreshold * 0.25 ? 2u : 1u;
+
+#if USE_MOTION_VECTORS
+    if (Motion > g_MotionThreshold)
+        Rate = max(Rate, Motion > g_MotionThreshold * 4.0 ? 2u : 1u);
+#endif
+
+    return min(Rate, MaxRate);
+}
+
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void main(uint3 GroupId : SV_GroupID, uint3 GTid : SV_GroupThreadID)
+{
+    uint2 Tile      = GroupId.xy;
+    uint2 TileStart = Tile * g_TileSize;
+    uint2 TileEnd   = min(TileStart + g_TileSize, g_ColorSize);
+
+    // x - max horizontal difference, y - max vertical difference, zw - motion vector sum
+    float4 Stats = float4(0.0, 0.0, 0.0, 0.0);
+    for (uint y = TileStart.y + GTid.y; y < TileEnd.y; y += THREAD_GROUP_SIZE)
+    {
+        for (uint x = TileStart.x + GTid.x; x < TileEnd.x; x += THREAD_GROUP_SIZE)
+        {
+            float L  = LoadLuminance(uint2(x, y));
+            float Lx = LoadLuminance(uint2(x + 1u, y));
+            float Ly = LoadLuminance(uint2(x, y + 1u));
+            Stats.x  = max(Stats.x, abs(Lx - L));
+            Stats.y  = max(Stats.y, abs(Ly - L));
+#if USE_MOTION_VECTORS
+            Stats.zw += g_MotionVectors.Load(int3(x, y, 0)).xy;
+#endif
+        }
+    }
+    gs_TileStats[GTid.y * THREAD_GROUP_SIZE + GTid.x] = Stats;
+    GroupMemoryBarrierWithGroupSync();
+
+    if (GTid.x != 0u || GTid.y != 0u || Tile.x >= g_RateTexSize.x || Tile.y >= g_RateTexSize.y)
+        return;
+
+    for (uint i = 1u; i < THREAD_GROUP_SIZE * THREAD_GROUP_SIZE; ++i)
+    {
+        float4 ThreadStats = gs_TileStats[i];
+        Stats.xy = max(Stats.xy, ThreadStats.xy);
+        Stats.zw += ThreadStats.zw;
+    }
+
+    uint2  TileSize = max(TileEnd - TileStart, uint2(1u, 1u));
+    float2 Motion   = abs(Stats.zw * g_MotionVectorScale) / float(TileSize.x * TileSize.y);
+
+    uint RateX = GetAxisRate(Stats.x, Motion.x, g_MaxAxisRate.x);
+    uint RateY = GetAxisRate(Stats.y, Motion.y, g_MaxAxisRate.y);
+    if (g_AllowAnisotropic == 0u)
+    {
+        RateX = min(RateX, RateY);
+        RateY = RateX;
+    }
+
+#if OUTPUT_FORMAT == 0
+    uint Rate = (RateX << SHADING_RATE_X_SHIFT) | RateY;
+    g_ShadingRate[Tile] = g_RateRemap[Rate >> 2u][Rate & 3u];
+#else
+    g_ShadingRate[Tile] = float2(1.0 / float(1u << RateX), 1.0 / float(1u << RateY));
+#endif
+}
@@ -0,0 +1,484 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BLASManager.h"
+
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "ReadbackQueue.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+class BLASManagerImpl final : public ObjectBase<IBLASManager>
+{
+public:
+    using TBase = ObjectBase<IBLASManager>;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_BLASManager, TBase)
+
+    BLASManagerImpl(IReferenceCounters*          pRefCounters,
+                    IRenderDevice*               pDevice,
+                    const BLASManagerCreateInfo& CreateInfo) :
+        TBase{pRefCounters},
+        m_pDevice{pDevice},
+        m_Name{CreateInfo.Name != nullptr ? CreateInfo.Name : "BLAS manager"},
+        m_ScratchBufferSize{std::max(CreateInfo.ScratchBufferSize, Uint64{1})},
+        m_Compact{CreateInfo.Compact},
+        m_MaxCompactionsPerUpdate{CreateInfo.MaxCompactionsPerUpdate}
+    {
+        if (pDevice == nullptr)
+            LOG_ERROR_AND_THROW("Render device must not be null");
+
+        if (pDevice->GetDeviceInfo().Features.RayTracing != DEVICE_FEATURE_STATE_ENABLED)
+            LOG_ERROR_AND_THROW("Ray tracing is not supported by this device");
+
+        m_ScratchAlignment = std::max(pDevice->GetAdapterInfo().RayTracing.ScratchBufferAlignment, Uint32{1});
+
+        if (m_Compact)
+        {
+            ReadbackQueueCreateInfo QueueCI;
+            QueueCI.Name = m_Name.c_str();
+            CreateReadbackQueue(pDevice, QueueCI, &m_pReadbackQueue);
+            if (!m_pReadbackQueue)
+                LOG_ERROR_AND_THROW("Failed to create compacted size readback queue");
+        }
+    }
+
+    virtual Uint32 AddBLAS(const BottomLevelASDesc&        Desc,
+                           const BLASBuildTriangleData*    pTriangleData,
+                           Uint32                          TriangleCount,
+                           const BLASBuildBoundingBoxData* pBoxData,
+                           Uint32                          BoxCount) override final
+    {
+        DEV_CHECK_ERR(TriangleCount == 0 || pTriangleData != nullptr, "pTriangleData must not be null when TriangleCount is not zero");
+        DEV_CHECK_ERR(BoxCount == 0 || pBoxData != nullptr, "pBoxData must not be null when BoxCount is not zero");
+        DEV_CHECK_ERR(Desc.CompactedSize == 0, "Compacted BLASes can't be built and must not be added to the BLAS manager");
+
+        BottomLevelASDesc BLASDesc = Desc;
+        if (m_Compact)
+            BLASDesc.Flags |= RAYTRACING_BUILD_AS_ALLOW_COMPACTION;
+
+        BLASEntry Entry;
+        m_pDevice->CreateBLAS(BLASDesc, &Entry.pBLAS);
+        if (!Entry.pBLAS)
+        {
+            LOG_ERROR_MESSAGE(m_Name, ": failed to create BLAS '", (Desc.Name != nullptr ? Desc.Name : ""), "'");
+            return 0;
+        }
+
+        // Build data references geometry descriptions by name. Point the names to the strings
+        // owned by the BLAS so that the application does not need to keep them alive.
+        const auto& CreatedDesc = Entry.pBLAS->GetDesc();
+
+        Entry.Triangles.assign(pTriangleData, pTriangleData + TriangleCount);
+        for (auto& Tri : Entry.Triangles)
+        {
+            const auto GeoIdx = Entry.pBLAS->GetGeometryDescIndex(Tri.GeometryName);
+            if (GeoIdx == INVALID_INDEX || GeoIdx >= CreatedDesc.TriangleCount)
+            {
+                LOG_ERROR_MESSAGE(m_Name, ": triangle geometry '", (Tri.GeometryName != nullptr ? Tri.GeometryName : ""),
+                                  "' is not found in BLAS '", CreatedDesc.Name, "'");
+                return 0;
+            }
+            Tri.GeometryName = CreatedDesc.pTriangles[GeoIdx].GeometryName;
+            Entry.KeepAlive(Tri.pVertexBuffer);
+            Entry.KeepAlive(Tri.pIndexBuffer);
+            Entry.KeepAlive(Tri.pTransformBuffer);
+        }
+
+        Entry.Boxes.assign(pBoxData, pBoxData + BoxCount);
+        for (auto& Box : Entry.Boxes)
+        {
+            const auto GeoIdx = Entry.pBLAS->GetGeometryDescIndex(Box.GeometryName);
+            if (GeoIdx == INVALID_INDEX || GeoIdx >= CreatedDesc.BoxCount)
+            {
+                LOG_ERROR_MESSAGE(m_Name, ": box geometry '", (Box.GeometryName != nullptr ? Box.GeometryName : ""),
+                                  "' is not found in BLAS '", CreatedDesc.Name, "'");
+                return 0;
+            }
+            Box.GeometryName = CreatedDesc.pBoxes[GeoIdx].GeometryName;
+            Entry.KeepAlive(Box.pBoxBuffer);
+        }
+
+        const auto Id = m_NextId++;
+        m_BLASes.emplace(Id, std::move(Entry));
+        m_PendingBuilds.push_back(Id);
+        return Id;
+    }
+
+    virtual void RemoveBLAS(Uint32 Id) override final
+    {
+        // Pending builds and compactions of the removed BLAS are skipped by Update().
+        // The engine keeps the BLAS memory alive until the GPU is done with it.
+        m_BLASes.erase(Id);
+    }
+
+    virtual IBottomLevelAS* GetBLAS(Uint32 Id) const override final
+    {
+        auto it = m_BLASes.find(Id);
+        return it != m_BLASes.end() ? it->second.pBLAS.RawPtr() : nullptr;
+    }
+
+    virtual bool IsBuilt(Uint32 Id) const override final
+    {
+        auto it = m_BLASes.find(Id);
+        return it != m_BLASes.end() && it->second.State != BLAS_STATE_PENDING_BUILD;
+    }
+
+    virtual BLASManagerUpdateResult Update(IDeviceContext* pContext) override final
+    {
+        DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+        BLASManagerUpdateResult Result;
+        if (m_pReadbackQueue)
+        {
+            // Invokes OnCompactedSizesRead() for the sizes that are available
+            m_pReadbackQueue->ProcessCompleted(pContext);
+        }
+
+        Result.NumCompacted = CompactBLASes(pContext);
+        Result.NumBuilt     = BuildPendingBLASes(pContext);
+        return Result;
+    }
+
+    virtual BLASManagerStats GetStats() const override final
+    {
+        BLASManagerStats Stats;
+        Stats.NumBLASes         = static_cast<Uint32>(m_BLASes.size());
+        Stats.CompactedSize     = 0;
+        Stats.ScratchBufferSize = m_pScratchBuffer ? m_pScratchBuffer->GetDesc().Size : 0;
+        for (const auto& it : m_BLASes)
+        {
+            const auto& Entry = it.second;
+            switch (Entry.State)
+            {
+                // clang-format off
+                case BLAS_STATE_PENDING_BUILD:      ++Stats.NumPendingBuilds;      break;
+                case BLAS_STATE_PENDING_SIZE_READ:  ++Stats.NumPendingSizeReads;   break;
+                case BLAS_STATE_PENDING_COMPACTION: ++Stats.NumPendingCompactions; break;
+                case BLAS_STATE_READY:                                             break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unexpected BLAS state");
+            }
+            if (Entry.IsCompacted)
+            {
+                ++Stats.NumCompacted;
+                Stats.CompactedSize += Entry.CompactedSize;
+            }
+        }
+        return Stats;
+    }
+
+private:
+    enum BLAS_STATE : Uint8
+    {
+        BLAS_STATE_PENDING_BUILD = 0,
+        BLAS_STATE_PENDING_SIZE_READ,
+        BLAS_STATE_PENDING_COMPACTION,
+        BLAS_STATE_READY
+    };
+
+    struct BLASEntry
+    {
+        RefCntAutoPtr<IBottomLevelAS> pBLAS;
+
+        BLAS_STATE State         = BLAS_STATE_PENDING_BUILD;
+        bool       IsCompacted   = false;
+        Uint64     CompactedSize = 0;
+
+        // Build data that is released once the BLAS is built
+        std::vector<BLASBuildTriangleData>    Triangles;
+        std::vector<BLASBuildBoundingBoxData> Boxes;
+        std::vector<RefCntAutoPtr<IBuffer>>   GeometryBuffers;
+
+        void KeepAlive(IBuffer* pBuffer)
+        {
+            if (pBuffer != nullptr)
+                GeometryBuffers.emplace_back(pBuffer);
+        }
+
+        void ReleaseBuildData()
+        {
+            std::vector<BLASBuildTriangleData>{}.swap(Triangles);
+            std::vector<BLASBuildBoundingBoxData>{}.swap(Boxes);
+            std::vector<RefCntAutoPtr<IBuffer>>{}.swap(GeometryBuffers);
+        }
+    };
+
+    Uint32 CompactBLASes(IDeviceContext* pContext)
+    {
+        Uint32 NumCompacted = 0;
+
+        size_t i = 0;
+        for (; i < m_PendingCompactions.size(); ++i)
+        {
+            if (m_MaxCompactionsPerUpdate != 0 && NumCompacted >= m_MaxCompactionsPerUpdate)
+                break;
+
+            auto it = m_BLASes.find(m_PendingCompactions[i]);
+            if (it == m_BLASes.end() || it->second.State != BLAS_STATE_PENDING_COMPACTION)
+                continue;
+
+            auto& Entry = it->second;
+            Entry.State = BLAS_STATE_READY;
+
+            const auto& SrcDesc = Entry.pBLAS->GetDesc();
+
+            BottomLevelASDesc CompactedDesc;
+            CompactedDesc.Name                 = SrcDesc.Name;
+            CompactedDesc.CompactedSize        = Entry.CompactedSize;
+            CompactedDesc.ImmediateContextMask = SrcDesc.ImmediateContextMask;
+
+            RefCntAutoPtr<IBottomLevelAS> pCompactedBLAS;
+            m_pDevice->CreateBLAS(CompactedDesc, &pCompactedBLAS);
+            if (!pCompactedBLAS)
+            {
+                LOG_ERROR_MESSAGE(m_Name, ": failed to create compacted BLAS '", SrcDesc.Name, "'. The original BLAS will be used.");
+                continue;
+            }
+
+            // The copy also transfers geometry descriptions to the compacted BLAS
+            CopyBLASAttribs CopyAttribs{
+                Entry.pBLAS,
+                pCompactedBLAS,
+                COPY_AS_MODE_COMPACT,
+                RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+            };
+            pContext->CopyBLAS(CopyAttribs);
+
+            // The original BLAS is released when the GPU is done with the copy
+            Entry.pBLAS       = std::move(pCompactedBLAS);
+            Entry.IsCompacted = true;
+            ++NumCompacted;
+        }
+        m_PendingCompactions.erase(m_PendingCompactions.begin(), m_PendingCompactions.begin() + i);
+
+        return NumCompacted;
+    }
+
+    Uint32 BuildPendingBLASes(IDeviceContext* pContext)
+    {
+        if (m_PendingBuilds.empty())
+            return 0;
+
+        Uint32              NumBuilt = 0;
+        std::vector<Uint32> BuiltIds;
+        BuiltIds.reserve(m_PendingBuilds.size());
+
+        Uint64 ScratchOffset = 0;
+        bool   NewBatch      = true;
+        for (auto Id : m_PendingBuilds)
+        {
+            auto it = m_BLASes.find(Id);
+            if (it == m_BLASes.end() || it->second.State != BLAS_STATE_PENDING_BUILD)
+                continue;
+
+            auto& Entry = it->second;
+
+            const auto ScratchSize = Entry.pBLAS->GetScratchBufferSizes().Build;
+            if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < ScratchSize)
+            {
+                // The old buffer is released when the GPU is done with it
+                m_pScratchBuffer.Release();
+
+                BufferDesc BuffDesc;
+                BuffDesc.Name      = "BLAS manager scratch buffer";
+                BuffDesc.Usage     = USAGE_DEFAULT;
+                BuffDesc.BindFlags = BIND_RAY_TRACING;
+                BuffDesc.Size      = std::max(m_ScratchBufferSize, ScratchSize);
+                m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pScratchBuffer);
+                if (!m_pScratchBuffer)
+                {
+                    LOG_ERROR_MESSAGE(m_Name, ": failed to create scratch buffer of size ", BuffDesc.Size);
+                    break;
+                }
+                ScratchOffset = 0;
+                NewBatch      = true;
+            }
+            else if (ScratchOffset + ScratchSize > m_pScratchBuffer->GetDesc().Size)
+            {
+                ScratchOffset = 0;
+                NewBatch      = true;
+            }
+
+            BuildBLASAttribs Attribs;
+            Attribs.pBLAS                  = Entry.pBLAS;
+            Attribs.BLASTransitionMode     = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+            Attribs.GeometryTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+            Attribs.pTriangleData          = Entry.Triangles.data();
+            Attribs.TriangleDataCount      = static_cast<Uint32>(Entry.Triangles.size());
+            Attribs.pBoxData               = Entry.Boxes.data();
+            Attribs.BoxDataCount           = static_cast<Uint32>(Entry.Boxes.size());
+            Attribs.pScratchBuffer         = m_pScratchBuffer;
+            Attribs.ScratchBufferOffset    = ScratchOffset;
+            // Builds within a batch use disjoint scratch ranges and may execute concurrently.
+            // The first build of a batch transitions the scratch buffer, which makes it
+            // wait for the previous batch that used the same memory.
+            Attribs.ScratchBufferTransitionMode = NewBatch ? RESOURCE_STATE_TRANSITION_MODE_TRANSITION : RESOURCE_STATE_TRANSITION_MODE_NONE;
+            pContext->BuildBLAS(Attribs);
+
+            NewBatch      = false;
+            ScratchOffset = AlignUp(ScratchOffset + ScratchSize, Uint64{m_ScratchAlignment});
+
+            Entry.ReleaseBuildData();
+            Entry.State = m_Compact ? BLAS_STATE_PENDING_SIZE_READ : BLAS_STATE_READY;
+            BuiltIds.push_back(Id);
+            ++NumBuilt;
+        }
+
+        // Builds that were not executed because of an error remain in the list
+        m_PendingBuilds.erase(std::remove_if(m_PendingBuilds.begin(), m_PendingBuilds.end(),
+                                             [this](Uint32 Id) {
+                                                 auto it = m_BLASes.find(Id);
+                                                 return it == m_BLASes.end() || it->second.State != BLAS_STATE_PENDING_BUILD;
+                                             }),
+                              m_PendingBuilds.end());
+
+        if (m_Compact && !BuiltIds.empty())
+            RequestCompactedSizes(pContext, std::move(BuiltIds));
+
+        return NumBuilt;
+    }
+
+    void RequestCompactedSizes(IDeviceContext* pContext, std::vector<Uint32> Ids)
+    {
+        const Uint64 RequiredSize = sizeof(Uint64) * Ids.size();
+        if (!m_pSizeBuffer || m_pSizeBuffer->GetDesc().Size < RequiredSize)
+        {
+            m_pSizeBuffer.Release();
+
+            // The buffer is reused by every update: the readback copy is ordered before the writes
+            // of the next update on the GPU timeline.
+            BufferDesc BuffDesc;
+            BuffDesc.Name      = "BLAS manager compacted size buffer";
+            BuffDesc.Usage     = USAGE_DEFAULT;
+            BuffDesc.BindFlags = BIND_UNORDERED_ACCESS;
+            BuffDesc.Mode      = BUFFER_MODE_RAW;
+            BuffDesc.Size      = std::max(RequiredSize, Uint64{sizeof(Uint64) * 64});
+            m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pSizeBuffer);
+            if (!m_pSizeBuffer)
+            {
+                LOG_ERROR_MESSAGE(m_Name, ": failed to create compacted size buffer. Built BLASes will not be compacted.");
+                OnCompactedSizesRead(Ids, ReadbackData{});
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < Ids.size(); ++i)
+        {
+            WriteBLASCompactedSizeAttribs Attribs{
+                m_BLASes[Ids[i]].pBLAS,
+                m_pSizeBuffer,
+                sizeof(Uint64) * i,
+                RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+            };
+            pContext->WriteBLASCompactedSize(Attribs);
+        }
+
+        m_pReadbackQueue->ReadBuffer(
+            pContext, m_pSizeBuffer, 0, RequiredSize,
+            [this, Ids = std::move(Ids)](const ReadbackData& Data) {
+                OnCompactedSizesRead(Ids, Data);
+            },
+            RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    void OnCompactedSizesRead(const std::vector<Uint32>& Ids, const ReadbackData& Data)
+    {
+        VERIFY_EXPR(Data.pData == nullptr || Data.DataSize >= sizeof(Uint64) * Ids.size());
+        const auto* pSizes = static_cast<const Uint64*>(Data.pData);
+        for (size_t i = 0; i < Ids.size(); ++i)
+        {
+            auto it = m_BLASes.find(Ids[i]);
+            if (it == m_BLASes.end() || it->second.State != BLAS_STATE_PENDING_SIZE_READ)
+                continue;
+
+            auto& Entry = it->second;
+            // If the read failed, the BLAS is kept uncompacted
+            if (pSizes != nullptr && pSizes[i] != 0)
+            {
+                Entry.CompactedSize = pSizes[i];
+                Entry.State         = BLAS_STATE_PENDING_COMPACTION;
+                m_PendingCompactions.push_back(Ids[i]);
+            }
+            else
+            {
+                Entry.State = BLAS_STATE_READY;
+            }
+        }
+    }
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const std::string m_Name;
+    const Uint64      m_ScratchBufferSize;
+    const bool        m_Compact;
+    const Uint32      m_MaxCompactionsPerUpdate;
+    Uint32            m_ScratchAlignment = 1;
+
+    Uint32 m_NextId = 1;
+
+    std::unordered_map<Uint32, BLASEntry> m_BLASes;
+
+    std::vector<Uint32> m_PendingBuilds;
+    std::vector<Uint32> m_PendingCompactions;
+
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
+    RefCntAutoPtr<IBuffer> m_pSizeBuffer;
+
+    // Must be declared last: the queue invokes the callbacks of the pending reads
+    // when it is destroyed, and the callbacks access the members above.
+    RefCntAutoPtr<IReadbackQueue> m_pReadbackQueue;
+};
+
+
+void CreateBLASManager(IRenderDevice*               pDevice,
+                       const BLASManagerCreateInfo& CreateInfo,
+                       IBLASManager**               ppBLASManager)
+{
+    try
+    {
+        auto* pManager = MakeNewRCObj<BLASManagerImpl>()(pDevice, CreateInfo);
+        pManager->QueryInterface(IID_BLASManager, reinterpret_cast<IObject**>(ppBLASManager));
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create BLAS manager");
+    }
+}
+
+} // namespace Diligent
@@ -29,6 +29,8 @@
 
 #include <mutex>
 #include <atomic>
+#include <map>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -50,15 +52,16 @@ public:
     using TBase = ObjectBase<IBufferSuballocation>;
     BufferSuballocationImpl(IReferenceCounters*                          pRefCounters,
                             BufferSuballocatorImpl*                      pParentAllocator,
-                            Uint32                                       Offset,
                             Uint32                                       Size,
+                            Uint32                                       Alignment,
                             VariableSizeAllocationsManager::Allocation&& Subregion) :
         // clang-format off
         TBase             {pRefCounters},
         m_pParentAllocator{pParentAllocator},
         m_Subregion       {std::move(Subregion)},
-        m_Offset          {Offset},
-        m_Size            {Size}
+        m_Offset          {AlignUp(static_cast<Uint32>(m_Subregion.UnalignedOffset), Alignment)},
+        m_Size            {Size},
+        m_Alignment       {Alignment}
     // clang-format on
     {
         VERIFY_EXPR(m_pParentAllocator);
@@ -83,7 +86,7 @@ public:
 
     virtual Uint32 GetOffset() const override final
     {
-        return m_Offset;
+        return m_Offset.load();
     }
 
     virtual Uint32 GetSize() const override final
@@ -107,13 +110,36 @@ public:
         return m_pUserData;
     }
 
+    Uint32 GetAlignment() const
+    {
+        return m_Alignment;
+    }
+
+    const VariableSizeAllocationsManager::Allocation& GetSubregion() const
+    {
+        return m_Subregion;
+    }
+
+    // Replaces the subregion with the new one and returns the old subregion.
+    // The parent allocator's mutex must be locked.
+    VariableSizeAllocationsManager::Allocation SwapSubregion(VariableSizeAllocationsManager::Allocation&& NewSubregion)
+    {
+        VariableSizeAllocationsManager::Allocation OldSubregion = std::move(m_Subregion);
+
+        m_Subregion = std::move(NewSubregion);
+        m_Offset.store(AlignUp(static_cast<Uint32>(m_Subregion.UnalignedOffset), m_Alignment));
+        return OldSubregion;
+    }
+
 private:
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
     VariableSizeAllocationsManager::Allocation m_Subregion;
 
-    const Uint32 m_Offset;
-    const Uint32 m_Size;
+    // The offset may be changed by the defragmentation
+    std::atomic<Uint32> m_Offset{0};
+    const Uint32        m_Size;
+    const Uint32        m_Alignment;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -256,13 +282,15 @@ public:
 
         if (Subregion.IsValid())
         {
+            const auto UnalignedOffset = Subregion.UnalignedOffset;
+
             // clang-format off
             BufferSuballocationImpl* pSuballocation{
                 NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
                 (
                     this,
-                    AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
                     Size,
+                    Alignment,
                     std::move(Subregion)
                 )
             };
@@ -270,12 +298,18 @@ public:
 
             pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
             m_AllocationCount.fetch_add(1);
+
+            {
+                std::lock_guard<std::mutex> Lock{m_MgrMtx};
+                m_Suballocations.emplace(UnalignedOffset, RefCntWeakPtr<BufferSuballocationImpl>{pSuballocation});
+            }
         }
     }
 
     void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        m_Suballocations.erase(Subregion.UnalignedOffset);
         m_Mgr.Free(std::move(Subregion));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
@@ -295,6 +329,11 @@ public:
         UsageStats.AllocationCount  = m_AllocationCount.load();
     }
 
+    virtual Uint64 Defragment(IRenderDevice*                              pDevice,
+                              IDeviceContext*                             pContext,
+                              Uint64                                      MaxBytesToMove,
+                              const BufferSuballocationMovedCallbackType& OnMoved) override final;
+
 private:
     void UpdateUsageStats()
     {
@@ -302,6 +341,16 @@ private:
         m_MaxFreeBlockSize.store(m_Mgr.GetMaxFreeBlockSize());
     }
 
+    // m_MgrMtx must be locked
+    void UpdateSuballocationKey(VariableSizeAllocationsManager::OffsetType OldKey, VariableSizeAllocationsManager::OffsetType NewKey)
+    {
+        auto it = m_Suballocations.find(OldKey);
+        VERIFY_EXPR(it != m_Suballocations.end());
+        auto pWeakSuballocation = std::move(it->second);
+        m_Suballocations.erase(it);
+        m_Suballocations.emplace(NewKey, std::move(pWeakSuballocation));
+    }
+
 private:
     const Uint64 m_MaxSize;
     const Uint32 m_ExpansionSize;
@@ -319,6 +368,13 @@ private:
     std::atomic<Uint64> m_MaxFreeBlockSize{0};
 
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
+
+    // All live suballocations, keyed by the unaligned offset of their subregion.
+    // Protected by m_MgrMtx.
+    std::map<VariableSizeAllocationsManager::OffsetType, RefCntWeakPtr<BufferSuballocationImpl>> m_Suballocations;
+
+    // Scratch buffer used to move the data during the defragmentation
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
 };
 
 
@@ -343,6 +399,149 @@ IBuffer* BufferSuballocationImpl::GetBuffer() const
 }
 
 
+Uint64 BufferSuballocatorImpl::Defragment(IRenderDevice*                              pDevice,
+                                          IDeviceContext*                             pContext,
+                                          Uint64                                      MaxBytesToMove,
+                                          const BufferSuballocationMovedCallbackType& OnMoved)
+{
+    DEV_CHECK_ERR(pDevice != nullptr && pContext != nullptr, "Device and context must not be null");
+
+    const auto Usage = m_Buffer.GetDesc().Usage;
+    if (Usage != USAGE_DEFAULT && Usage != USAGE_SPARSE)
+    {
+        LOG_WARNING_MESSAGE_ONCE("Defragmentation is only supported for USAGE_DEFAULT and USAGE_SPARSE buffers");
+        return 0;
+    }
+
+    IBuffer* pBuffer = Update(pDevice, pContext);
+    if (pBuffer == nullptr)
+        return 0;
+
+    struct MoveInfo
+    {
+        RefCntAutoPtr<BufferSuballocationImpl>     pSuballocation;
+        VariableSizeAllocationsManager::Allocation OldSubregion;
+        Uint32                                     OldOffset;
+    };
+    std::vector<MoveInfo> Moves;
+
+    Uint64 BytesToMove = 0;
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // Move the suballocations with the highest offsets first
+        for (auto it = m_Suballocations.rbegin(); it != m_Suballocations.rend(); ++it)
+        {
+            // There is no free space below this suballocation
+            if (it->first < m_Mgr.GetFirstFreeBlockOffset())
+                break;
+
+            auto pSuballocation = it->second.Lock();
+            if (!pSuballocation)
+                continue; // The suballocation is being destroyed
+
+            const auto Size = pSuballocation->GetSize();
+            if (!Moves.empty() && BytesToMove + Size > MaxBytesToMove)
+                break;
+
+            auto NewSubregion = m_Mgr.Allocate(Size, pSuballocation->GetAlignment());
+            if (!NewSubregion.IsValid())
+                continue;
+
+            if (NewSubregion.UnalignedOffset >= it->first)
+            {
+                // The suballocation can't be moved to a lower offset
+                m_Mgr.Free(std::move(NewSubregion));
+                continue;
+            }
+
+            const auto OldOffset = pSuballocation->GetOffset();
+
+            auto OldSubregion = pSuballocation->SwapSubregion(std::move(NewSubregion));
+            Moves.push_back({std::move(pSuballocation), std::move(OldSubregion), OldOffset});
+            BytesToMove += Size;
+        }
+
+        // Update the keys after the iteration is complete to keep the iterators valid
+        for (const auto& Move : Moves)
+            UpdateSuballocationKey(Move.OldSubregion.UnalignedOffset, Move.pSuballocation->GetSubregion().UnalignedOffset);
+    }
+
+    if (Moves.empty())
+        return 0;
+
+    // Direct copies within the same buffer are not allowed in all backends,
+    // so the data is moved through the scratch buffer.
+    if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < BytesToMove)
+    {
+        m_pScratchBuffer.Release();
+
+        BufferDesc ScratchDesc;
+        ScratchDesc.Name  = "Buffer suballocator defragmentation scratch buffer";
+        ScratchDesc.Size  = BytesToMove;
+        ScratchDesc.Usage = USAGE_DEFAULT;
+        pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+    }
+
+    if (m_pScratchBuffer)
+    {
+        Uint64 ScratchOffset = 0;
+        for (const auto& Move : Moves)
+        {
+            const auto Size = Move.pSuballocation->GetSize();
+            pContext->CopyBuffer(pBuffer, Move.OldOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 m_pScratchBuffer, ScratchOffset, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ScratchOffset += Size;
+        }
+
+        ScratchOffset = 0;
+        for (const auto& Move : Moves)
+        {
+            const auto Size = Move.pSuballocation->GetSize();
+            pContext->CopyBuffer(m_pScratchBuffer, ScratchOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 pBuffer, Move.pSuballocation->GetOffset(), Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ScratchOffset += Size;
+        }
+    }
+    else
+    {
+        LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer");
+
+        // Move the suballocations back to their original subregions
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+            for (auto& Move : Moves)
+            {
+                auto NewSubregion = Move.pSuballocation->SwapSubregion(std::move(Move.OldSubregion));
+                UpdateSuballocationKey(NewSubregion.UnalignedOffset, Move.pSuballocation->GetSubregion().UnalignedOffset);
+                m_Mgr.Free(std::move(NewSubregion));
+            }
+            UpdateUsageStats();
+        }
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        for (auto& Move : Moves)
+            m_Mgr.Free(std::move(Move.OldSubregion));
+        UpdateUsageStats();
+    }
+
+    if (OnMoved)
+    {
+        for (const auto& Move : Moves)
+            OnMoved(Move.pSuballocation, Move.OldOffset);
+    }
+
+    // NB: strong references must be released outside of the lock since
+    //     suballocation destructors lock the mutex.
+    Moves.clear();
+
+    return BytesToMove;
+}
+
+
 void CreateBufferSuballocator(IRenderDevice*                      pDevice,
                               const BufferSuballocatorCreateInfo& CreateInfo,
                               IBufferSuballocator**               ppBufferSuballocator)
@@ -25,6 +25,7 @@
  */
 
 #include <unordered_map>
+#include <vector>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
@@ -33,6 +34,7 @@
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "LZ4Compression.hpp"
 
 namespace Diligent
 {
@@ -46,7 +48,8 @@ public:
     struct BytecodeCacheHeader
     {
         static constexpr Uint32 HeaderMagic   = 0x7ADECACE;
-        static constexpr Uint32 HeaderVersion = 1;
+        // Version 2 adds byte code compression
+        static constexpr Uint32 HeaderVersion = 2;
 
         Uint32 Magic   = HeaderMagic;
         Uint32 Version = HeaderVersion;
@@ -65,10 +68,15 @@ public:
         XXH128Hash Hash     = {};
         size_t     DataSize = 0;
 
+        // The size of the uncompressed byte code, or zero if the byte code is not compressed.
+        size_t UncompressedSize = 0;
+
         template <typename SerType>
-        void Serialize(SerType& Stream)
+        void Serialize(SerType& Stream, Uint32 Version = BytecodeCacheHeader::HeaderVersion)
         {
             Stream(Hash.LowPart, Hash.HighPart, DataSize);
+            if (Version >= 2)
+                Stream(UncompressedSize);
         }
     };
 
@@ -76,7 +84,8 @@ public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
         TBase{pRefCounters},
-        m_DeviceType{CreateInfo.DeviceType}
+        m_DeviceType{CreateInfo.DeviceType},
+        m_CompressBytecode{CreateInfo.CompressBytecode}
     {
     }
 
@@ -100,7 +109,7 @@ public:
             return false;
         }
 
-        if (Header.Version != BytecodeCacheHeader::HeaderVersion)
+        if (Header.Version != 1 && Header.Version != BytecodeCacheHeader::HeaderVersion)
         {
             LOG_ERROR_MESSAGE("Incorrect bytecode header version (", Header.Version, "). ", Uint32{BytecodeCacheHeader::HeaderVersion}, " is expected.");
             return false;
@@ -109,10 +118,30 @@ public:
         for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
         {
             BytecodeCacheElementHeader ElementHeader;
-            ElementHeader.Serialize(Stream);
+            ElementHeader.Serialize(Stream, Header.Version);
 
-            auto pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
-            Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
+            RefCntAutoPtr<DataBlobImpl> pBytecode;
+            if (ElementHeader.UncompressedSize != 0)
+            {
+                std::vector<Uint8> Compressed(ElementHeader.DataSize);
+                if (!Stream.CopyBytes(Compressed.data(), Compressed.size()))
+                {
+                    LOG_ERROR_MESSAGE("Failed to read compressed byte code");
+                    return false;
+                }
+
+                pBytecode = DataBlobImpl::Create(ElementHeader.UncompressedSize);
+                if (!DecompressLZ4(Compressed.data(), Compressed.size(), pBytecode->GetDataPtr(), pBytecode->GetSize()))
+                {
+                    LOG_ERROR_MESSAGE("Failed to decompress byte code. The cache data may be corrupted.");
+                    return false;
+                }
+            }
+            else
+            {
+                pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
+                Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
+            }
             m_HashMap.emplace(ElementHeader.Hash, pBytecode);
         }
 
@@ -152,6 +181,24 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
+        // Compressed byte code, if compression reduces the size
+        std::unordered_map<XXH128Hash, std::vector<Uint8>> CompressedBytecode;
+        if (m_CompressBytecode)
+        {
+            for (auto const& Pair : m_HashMap)
+            {
+                const auto& pBytecode = Pair.second;
+
+                std::vector<Uint8> Compressed(GetLZ4CompressedSizeBound(pBytecode->GetSize()));
+                const size_t       CompressedSize = CompressLZ4(pBytecode->GetConstDataPtr(), pBytecode->GetSize(), Compressed.data(), Compressed.size());
+                if (CompressedSize != 0 && CompressedSize < pBytecode->GetSize())
+                {
+                    Compressed.resize(CompressedSize);
+                    CompressedBytecode.emplace(Pair.first, std::move(Compressed));
+                }
+            }
+        }
+
         auto WriteData = [&](auto& Stream) //
         {
             BytecodeCacheHeader Header{};
@@ -162,12 +209,21 @@ public:
             {
                 const auto& pBytecode = Pair.second;
 
+                const auto  compressed_it = CompressedBytecode.find(Pair.first);
+                const void* pData         = pBytecode->GetConstDataPtr();
+
                 BytecodeCacheElementHeader ElementHeader;
                 ElementHeader.Hash     = Pair.first;
                 ElementHeader.DataSize = pBytecode->GetSize();
+                if (compressed_it != CompressedBytecode.end())
+                {
+                    ElementHeader.UncompressedSize = ElementHeader.DataSize;
+                    ElementHeader.DataSize         = compressed_it->second.size();
+                    pData                          = compressed_it->second.data();
+                }
                 ElementHeader.Serialize(Stream);
 
-                Stream.CopyBytes(pBytecode->GetConstDataPtr(), ElementHeader.DataSize);
+                Stream.CopyBytes(pData, ElementHeader.DataSize);
             }
         };
 
@@ -197,7 +253,8 @@ private:
     }
 
 private:
-    RENDER_DEVICE_TYPE m_DeviceType;
+    const RENDER_DEVICE_TYPE m_DeviceType;
+    const bool               m_CompressBytecode;
 
     std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
 };
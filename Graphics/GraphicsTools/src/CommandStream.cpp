@@ -0,0 +1,1016 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "CommandStream.hpp"
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "DebugUtilities.hpp"
+#include "Align.hpp"
+#include "Cast.hpp"
+
+namespace Diligent
+{
+
+enum class CommandStream::CMD_TYPE : Uint32
+{
+    SetPipelineState,
+    CommitShaderResources,
+    SetStencilRef,
+    SetBlendFactors,
+    SetVertexBuffers,
+    SetIndexBuffer,
+    SetViewports,
+    SetScissorRects,
+    SetRenderTargets,
+    BeginRenderPass,
+    NextSubpass,
+    EndRenderPass,
+    Draw,
+    DrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    DrawMesh,
+    DispatchCompute,
+    DispatchComputeIndirect,
+    ClearDepthStencil,
+    ClearRenderTarget,
+    UpdateBuffer,
+    CopyBuffer,
+    CopyTexture,
+    TransitionResourceStates,
+    BeginDebugGroup,
+    EndDebugGroup,
+    InsertDebugLabel,
+    InvokeCallback,
+    Count
+};
+
+namespace
+{
+
+// All commands and their variable-size data are aligned to 8 bytes.
+constexpr size_t CmdAlignment = 8;
+
+struct CommandHeader
+{
+    Uint32 Type;
+    Uint32 Size; // Total command size including the header
+};
+static_assert(sizeof(CommandHeader) % CmdAlignment == 0, "Command header size must be a multiple of the command alignment");
+
+template <typename CmdType>
+constexpr size_t AlignedCmdSize()
+{
+    static_assert(alignof(CmdType) <= CmdAlignment, "Command alignment exceeds the stream alignment");
+    return AlignUp(sizeof(CmdType), CmdAlignment);
+}
+
+// Returns the pointer to the variable-size data that follows the command.
+template <typename DataType, typename CmdType>
+DataType* GetCmdData(CmdType& Cmd, size_t Offset = 0)
+{
+    return reinterpret_cast<DataType*>(reinterpret_cast<Uint8*>(&Cmd) + AlignedCmdSize<CmdType>() + Offset);
+}
+
+template <typename DataType, typename CmdType>
+const DataType* GetCmdData(const CmdType& Cmd, size_t Offset = 0)
+{
+    return reinterpret_cast<const DataType*>(reinterpret_cast<const Uint8*>(&Cmd) + AlignedCmdSize<CmdType>() + Offset);
+}
+
+struct CmdSetPipelineState
+{
+    IPipelineState* pPSO;
+};
+
+struct CmdCommitShaderResources
+{
+    IShaderResourceBinding*        pSRB;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+struct CmdSetStencilRef
+{
+    Uint32 StencilRef;
+};
+
+struct CmdSetBlendFactors
+{
+    float BlendFactors[4];
+    bool  HasBlendFactors;
+};
+
+// Followed by IBuffer*[NumBuffers] and, if HasOffsets is true, Uint64[NumBuffers]
+struct CmdSetVertexBuffers
+{
+    Uint32                         StartSlot;
+    Uint32                         NumBuffers;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+    SET_VERTEX_BUFFERS_FLAGS       Flags;
+    bool                           HasOffsets;
+};
+
+struct CmdSetIndexBuffer
+{
+    IBuffer*                       pBuffer;
+    Uint64                         ByteOffset;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+// Followed by Viewport[NumViewports] or Rect[NumViewports]
+struct CmdSetViewportsOrRects
+{
+    Uint32 Count;
+    Uint32 RTWidth;
+    Uint32 RTHeight;
+};
+
+// Followed by ITextureView*[NumRenderTargets]
+struct CmdSetRenderTargets
+{
+    ITextureView*                  pDSV;
+    Uint32                         NumRenderTargets;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+// Followed by OptimizedClearValue[Attribs.ClearValueCount]
+struct CmdBeginRenderPass
+{
+    BeginRenderPassAttribs Attribs;
+};
+
+template <typename AttribsType>
+struct CmdAttribs
+{
+    AttribsType Attribs;
+};
+
+struct CmdClearDepthStencil
+{
+    ITextureView*                  pView;
+    CLEAR_DEPTH_STENCIL_FLAGS      Flags;
+    float                          Depth;
+    Uint8                          Stencil;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+struct CmdClearRenderTarget
+{
+    ITextureView*                  pView;
+    Uint32                         RGBA[4];
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+// Followed by Size bytes of data
+struct CmdUpdateBuffer
+{
+    IBuffer*                       pBuffer;
+    Uint64                         Offset;
+    Uint64                         Size;
+    RESOURCE_STATE_TRANSITION_MODE Mode;
+};
+
+struct CmdCopyBuffer
+{
+    IBuffer*                       pSrcBuffer;
+    IBuffer*                       pDstBuffer;
+    Uint64                         SrcOffset;
+    Uint64                         DstOffset;
+    Uint64                         Size;
+    RESOURCE_STATE_TRANSITION_MODE SrcMode;
+    RESOURCE_STATE_TRANSITION_MODE DstMode;
+};
+
+// Followed by StateTransitionDesc[BarrierCount]
+struct CmdTransitionResourceStates
+{
+    Uint32 BarrierCount;
+};
+
+// Followed by the null-terminated name
+struct CmdDebugLabel
+{
+    float Color[4];
+    bool  HasColor;
+};
+
+struct CmdCopyTexture
+{
+    CopyTextureAttribs Attribs;
+    Box                SrcBox;
+    bool               HasSrcBox;
+};
+
+struct CmdInvokeCallback
+{
+    CommandStream::CallbackType Callback;
+    void*                       pUserData;
+};
+
+} // namespace
+
+CommandStream::CommandStream(size_t InitialCapacity)
+{
+    m_Data.reserve(InitialCapacity);
+}
+
+void* CommandStream::AllocateCommand(CMD_TYPE Type, size_t PayloadSize)
+{
+    const size_t CmdSize = sizeof(CommandHeader) + AlignUp(PayloadSize, CmdAlignment);
+    DEV_CHECK_ERR(CmdSize <= std::numeric_limits<Uint32>::max(), "Command size (", CmdSize, ") is too large");
+
+    const size_t Offset = m_Data.size();
+    // std::vector grows geometrically, so the amortized cost of recording a command is constant
+    m_Data.resize(Offset + CmdSize);
+
+    CommandHeader* pHeader = reinterpret_cast<CommandHeader*>(&m_Data[Offset]);
+    pHeader->Type          = static_cast<Uint32>(Type);
+    pHeader->Size          = static_cast<Uint32>(CmdSize);
+    ++m_CommandCount;
+
+    return pHeader + 1;
+}
+
+template <typename CmdType>
+CmdType& CommandStream::AllocateCommand(CMD_TYPE Type, size_t DataSize)
+{
+    static_assert(std::is_trivially_destructible<CmdType>::value, "Commands are never destroyed");
+    return *new (AllocateCommand(Type, AlignedCmdSize<CmdType>() + DataSize)) CmdType{};
+}
+
+void CommandStream::Reset()
+{
+    m_Data.clear();
+    m_CommandCount = 0;
+}
+
+void CommandStream::SetPipelineState(IPipelineState* pPSO)
+{
+    AllocateCommand<CmdSetPipelineState>(CMD_TYPE::SetPipelineState).pPSO = pPSO;
+}
+
+void CommandStream::CommitShaderResources(IShaderResourceBinding* pSRB, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    CmdCommitShaderResources& Cmd = AllocateCommand<CmdCommitShaderResources>(CMD_TYPE::CommitShaderResources);
+
+    Cmd.pSRB = pSRB;
+    Cmd.Mode = StateTransitionMode;
+}
+
+void CommandStream::SetStencilRef(Uint32 StencilRef)
+{
+    AllocateCommand<CmdSetStencilRef>(CMD_TYPE::SetStencilRef).StencilRef = StencilRef;
+}
+
+void CommandStream::SetBlendFactors(const float* pBlendFactors)
+{
+    CmdSetBlendFactors& Cmd = AllocateCommand<CmdSetBlendFactors>(CMD_TYPE::SetBlendFactors);
+
+    Cmd.HasBlendFactors = pBlendFactors != nullptr;
+    if (pBlendFactors != nullptr)
+        memcpy(Cmd.BlendFactors, pBlendFactors, sizeof(Cmd.BlendFactors));
+}
+
+void CommandStream::SetVertexBuffers(Uint32                         StartSlot,
+                                     Uint32                         NumBuffersSet,
+                                     IBuffer* const*                ppBuffers,
+                                     const Uint64*                  pOffsets,
+                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                     SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    DEV_CHECK_ERR(NumBuffersSet == 0 || ppBuffers != nullptr, "ppBuffers must not be null when NumBuffersSet is not zero");
+
+    const size_t BuffersSize = AlignUp(sizeof(IBuffer*) * NumBuffersSet, CmdAlignment);
+    const size_t OffsetsSize = pOffsets != nullptr ? sizeof(Uint64) * NumBuffersSet : 0;
+
+    CmdSetVertexBuffers& Cmd = AllocateCommand<CmdSetVertexBuffers>(CMD_TYPE::SetVertexBuffers, BuffersSize + OffsetsSize);
+
+    Cmd.StartSlot  = StartSlot;
+    Cmd.NumBuffers = NumBuffersSet;
+    Cmd.Mode       = StateTransitionMode;
+    Cmd.Flags      = Flags;
+    Cmd.HasOffsets = pOffsets != nullptr;
+    if (NumBuffersSet > 0)
+        memcpy(GetCmdData<IBuffer*>(Cmd), ppBuffers, sizeof(IBuffer*) * NumBuffersSet);
+    if (OffsetsSize > 0)
+        memcpy(GetCmdData<Uint64>(Cmd, BuffersSize), pOffsets, OffsetsSize);
+}
+
+void CommandStream::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    CmdSetIndexBuffer& Cmd = AllocateCommand<CmdSetIndexBuffer>(CMD_TYPE::SetIndexBuffer);
+
+    Cmd.pBuffer    = pIndexBuffer;
+    Cmd.ByteOffset = ByteOffset;
+    Cmd.Mode       = StateTransitionMode;
+}
+
+void CommandStream::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    DEV_CHECK_ERR(NumViewports == 0 || pViewports != nullptr, "pViewports must not be null when NumViewports is not zero");
+
+    CmdSetViewportsOrRects& Cmd = AllocateCommand<CmdSetViewportsOrRects>(CMD_TYPE::SetViewports, sizeof(Viewport) * NumViewports);
+
+    Cmd.Count    = NumViewports;
+    Cmd.RTWidth  = RTWidth;
+    Cmd.RTHeight = RTHeight;
+    if (NumViewports > 0)
+        memcpy(GetCmdData<Viewport>(Cmd), pViewports, sizeof(Viewport) * NumViewports);
+}
+
+void CommandStream::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    DEV_CHECK_ERR(NumRects == 0 || pRects != nullptr, "pRects must not be null when NumRects is not zero");
+
+    CmdSetViewportsOrRects& Cmd = AllocateCommand<CmdSetViewportsOrRects>(CMD_TYPE::SetScissorRects, sizeof(Rect) * NumRects);
+
+    Cmd.Count    = NumRects;
+    Cmd.RTWidth  = RTWidth;
+    Cmd.RTHeight = RTHeight;
+    if (NumRects > 0)
+        memcpy(GetCmdData<Rect>(Cmd), pRects, sizeof(Rect) * NumRects);
+}
+
+void CommandStream::SetRenderTargets(Uint32                         NumRenderTargets,
+                                     ITextureView* const*           ppRenderTargets,
+                                     ITextureView*                  pDepthStencil,
+                                     RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DEV_CHECK_ERR(NumRenderTargets == 0 || ppRenderTargets != nullptr, "ppRenderTargets must not be null when NumRenderTargets is not zero");
+
+    CmdSetRenderTargets& Cmd = AllocateCommand<CmdSetRenderTargets>(CMD_TYPE::SetRenderTargets, sizeof(ITextureView*) * NumRenderTargets);
+
+    Cmd.pDSV             = pDepthStencil;
+    Cmd.NumRenderTargets = NumRenderTargets;
+    Cmd.Mode             = StateTransitionMode;
+    if (NumRenderTargets > 0)
+        memcpy(GetCmdData<ITextureView*>(Cmd), ppRenderTargets, sizeof(ITextureView*) * NumRenderTargets);
+}
+
+void CommandStream::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    const Uint32 NumClearValues = Attribs.pClearValues != nullptr ? Attribs.ClearValueCount : 0;
+
+    CmdBeginRenderPass& Cmd = AllocateCommand<CmdBeginRenderPass>(CMD_TYPE::BeginRenderPass, sizeof(OptimizedClearValue) * NumClearValues);
+
+    Cmd.Attribs                 = Attribs;
+    Cmd.Attribs.ClearValueCount = NumClearValues;
+    // The pointer is restored during the replay as the stream memory may be reallocated
+    Cmd.Attribs.pClearValues = nullptr;
+    if (NumClearValues > 0)
+        memcpy(GetCmdData<OptimizedClearValue>(Cmd), Attribs.pClearValues, sizeof(OptimizedClearValue) * NumClearValues);
+}
+
+void CommandStream::NextSubpass()
+{
+    AllocateCommand(CMD_TYPE::NextSubpass, 0);
+}
+
+void CommandStream::EndRenderPass()
+{
+    AllocateCommand(CMD_TYPE::EndRenderPass, 0);
+}
+
+void CommandStream::Draw(const DrawAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DrawAttribs>>(CMD_TYPE::Draw).Attribs = Attribs;
+}
+
+void CommandStream::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DrawIndexedAttribs>>(CMD_TYPE::DrawIndexed).Attribs = Attribs;
+}
+
+void CommandStream::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DrawIndirectAttribs>>(CMD_TYPE::DrawIndirect).Attribs = Attribs;
+}
+
+void CommandStream::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DrawIndexedIndirectAttribs>>(CMD_TYPE::DrawIndexedIndirect).Attribs = Attribs;
+}
+
+void CommandStream::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DrawMeshAttribs>>(CMD_TYPE::DrawMesh).Attribs = Attribs;
+}
+
+void CommandStream::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DispatchComputeAttribs>>(CMD_TYPE::DispatchCompute).Attribs = Attribs;
+}
+
+void CommandStream::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    AllocateCommand<CmdAttribs<DispatchComputeIndirectAttribs>>(CMD_TYPE::DispatchComputeIndirect).Attribs = Attribs;
+}
+
+void CommandStream::ClearDepthStencil(ITextureView*                  pView,
+                                      CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                      float                          fDepth,
+                                      Uint8                          Stencil,
+                                      RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    CmdClearDepthStencil& Cmd = AllocateCommand<CmdClearDepthStencil>(CMD_TYPE::ClearDepthStencil);
+
+    Cmd.pView   = pView;
+    Cmd.Flags   = ClearFlags;
+    Cmd.Depth   = fDepth;
+    Cmd.Stencil = Stencil;
+    Cmd.Mode    = StateTransitionMode;
+}
+
+void CommandStream::ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    CmdClearRenderTarget& Cmd = AllocateCommand<CmdClearRenderTarget>(CMD_TYPE::ClearRenderTarget);
+
+    Cmd.pView = pView;
+    Cmd.Mode  = StateTransitionMode;
+    if (RGBA != nullptr)
+        memcpy(Cmd.RGBA, RGBA, sizeof(Cmd.RGBA));
+}
+
+void CommandStream::UpdateBuffer(IBuffer*                       pBuffer,
+                                 Uint64                         Offset,
+                                 Uint64                         Size,
+                                 const void*                    pData,
+                                 RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DEV_CHECK_ERR(Size == 0 || pData != nullptr, "pData must not be null when Size is not zero");
+
+    CmdUpdateBuffer& Cmd = AllocateCommand<CmdUpdateBuffer>(CMD_TYPE::UpdateBuffer, StaticCast<size_t>(Size));
+
+    Cmd.pBuffer = pBuffer;
+    Cmd.Offset  = Offset;
+    Cmd.Size    = Size;
+    Cmd.Mode    = StateTransitionMode;
+    if (Size > 0)
+        memcpy(GetCmdData<Uint8>(Cmd), pData, StaticCast<size_t>(Size));
+}
+
+void CommandStream::CopyBuffer(IBuffer*                       pSrcBuffer,
+                               Uint64                         SrcOffset,
+                               RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                               IBuffer*                       pDstBuffer,
+                               Uint64                         DstOffset,
+                               Uint64                         Size,
+                               RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    CmdCopyBuffer& Cmd = AllocateCommand<CmdCopyBuffer>(CMD_TYPE::CopyBuffer);
+
+    Cmd.pSrcBuffer = pSrcBuffer;
+    Cmd.pDstBuffer = pDstBuffer;
+    Cmd.SrcOffset  = SrcOffset;
+    Cmd.DstOffset  = DstOffset;
+    Cmd.Size       = Size;
+    Cmd.SrcMode    = SrcBufferTransitionMode;
+    Cmd.DstMode    = DstBufferTransitionMode;
+}
+
+void CommandStream::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    CmdCopyTexture& Cmd = AllocateCommand<CmdCopyTexture>(CMD_TYPE::CopyTexture);
+
+    Cmd.Attribs   = CopyAttribs;
+    Cmd.HasSrcBox = CopyAttribs.pSrcBox != nullptr;
+    if (CopyAttribs.pSrcBox != nullptr)
+        Cmd.SrcBox = *CopyAttribs.pSrcBox;
+    // The pointer is restored during the replay as the stream memory may be reallocated
+    Cmd.Attribs.pSrcBox = nullptr;
+}
+
+void CommandStream::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    DEV_CHECK_ERR(BarrierCount == 0 || pResourceBarriers != nullptr, "pResourceBarriers must not be null when BarrierCount is not zero");
+
+    CmdTransitionResourceStates& Cmd = AllocateCommand<CmdTransitionResourceStates>(CMD_TYPE::TransitionResourceStates, sizeof(StateTransitionDesc) * BarrierCount);
+
+    Cmd.BarrierCount = BarrierCount;
+    if (BarrierCount > 0)
+        memcpy(GetCmdData<StateTransitionDesc>(Cmd), pResourceBarriers, sizeof(StateTransitionDesc) * BarrierCount);
+}
+
+static void WriteDebugLabel(CmdDebugLabel& Cmd, const Char* Name, size_t NameLen, const float* pColor)
+{
+    Cmd.HasColor = pColor != nullptr;
+    if (pColor != nullptr)
+        memcpy(Cmd.Color, pColor, sizeof(Cmd.Color));
+    memcpy(GetCmdData<Char>(Cmd), Name, NameLen);
+    GetCmdData<Char>(Cmd)[NameLen] = '\0';
+}
+
+void CommandStream::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    if (Name == nullptr)
+        Name = "";
+
+    const size_t   NameLen = strlen(Name);
+    CmdDebugLabel& Cmd     = AllocateCommand<CmdDebugLabel>(CMD_TYPE::BeginDebugGroup, NameLen + 1);
+    WriteDebugLabel(Cmd, Name, NameLen, pColor);
+}
+
+void CommandStream::EndDebugGroup()
+{
+    AllocateCommand(CMD_TYPE::EndDebugGroup, 0);
+}
+
+void CommandStream::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    if (Label == nullptr)
+        Label = "";
+
+    const size_t   LabelLen = strlen(Label);
+    CmdDebugLabel& Cmd      = AllocateCommand<CmdDebugLabel>(CMD_TYPE::InsertDebugLabel, LabelLen + 1);
+    WriteDebugLabel(Cmd, Label, LabelLen, pColor);
+}
+
+void CommandStream::InvokeCallback(CallbackType Callback, void* pUserData)
+{
+    DEV_CHECK_ERR(Callback != nullptr, "Callback must not be null");
+
+    CmdInvokeCallback& Cmd = AllocateCommand<CmdInvokeCallback>(CMD_TYPE::InvokeCallback);
+
+    Cmd.Callback  = Callback;
+    Cmd.pUserData = pUserData;
+}
+
+void CommandStream::Execute(IDeviceContext* pContext) const
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+    const Uint8*       pCurr = m_Data.data();
+    const Uint8* const pEnd  = pCurr + m_Data.size();
+    while (pCurr < pEnd)
+    {
+        const CommandHeader& Header   = *reinterpret_cast<const CommandHeader*>(pCurr);
+        const void*          pPayload = &Header + 1;
+        VERIFY_EXPR(Header.Size >= sizeof(CommandHeader) && pCurr + Header.Size <= pEnd);
+
+#define CMD(Type) (*static_cast<const Type*>(pPayload))
+        switch (static_cast<CMD_TYPE>(Header.Type))
+        {
+            case CMD_TYPE::SetPipelineState:
+                pContext->SetPipelineState(CMD(CmdSetPipelineState).pPSO);
+                break;
+
+            case CMD_TYPE::CommitShaderResources:
+            {
+                const CmdCommitShaderResources& Cmd = CMD(CmdCommitShaderResources);
+                pContext->CommitShaderResources(Cmd.pSRB, Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::SetStencilRef:
+                pContext->SetStencilRef(CMD(CmdSetStencilRef).StencilRef);
+                break;
+
+            case CMD_TYPE::SetBlendFactors:
+            {
+                const CmdSetBlendFactors& Cmd = CMD(CmdSetBlendFactors);
+                pContext->SetBlendFactors(Cmd.HasBlendFactors ? Cmd.BlendFactors : nullptr);
+                break;
+            }
+
+            case CMD_TYPE::SetVertexBuffers:
+            {
+                const CmdSetVertexBuffers& Cmd         = CMD(CmdSetVertexBuffers);
+                const size_t               BuffersSize = AlignUp(sizeof(IBuffer*) * Cmd.NumBuffers, CmdAlignment);
+                pContext->SetVertexBuffers(Cmd.StartSlot, Cmd.NumBuffers, GetCmdData<IBuffer* const>(Cmd),
+                                           Cmd.HasOffsets ? GetCmdData<Uint64>(Cmd, BuffersSize) : nullptr,
+                                           Cmd.Mode, Cmd.Flags);
+                break;
+            }
+
+            case CMD_TYPE::SetIndexBuffer:
+            {
+                const CmdSetIndexBuffer& Cmd = CMD(CmdSetIndexBuffer);
+                pContext->SetIndexBuffer(Cmd.pBuffer, Cmd.ByteOffset, Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::SetViewports:
+            {
+                const CmdSetViewportsOrRects& Cmd = CMD(CmdSetViewportsOrRects);
+                pContext->SetViewports(Cmd.Count, GetCmdData<Viewport>(Cmd), Cmd.RTWidth, Cmd.RTHeight);
+                break;
+            }
+
+            case CMD_TYPE::SetScissorRects:
+            {
+                const CmdSetViewportsOrRects& Cmd = CMD(CmdSetViewportsOrRects);
+                pContext->SetScissorRects(Cmd.Count, GetCmdData<Rect>(Cmd), Cmd.RTWidth, Cmd.RTHeight);
+                break;
+            }
+
+            case CMD_TYPE::SetRenderTargets:
+            {
+                const CmdSetRenderTargets& Cmd = CMD(CmdSetRenderTargets);
+                pContext->SetRenderTargets(Cmd.NumRenderTargets, const_cast<ITextureView**>(GetCmdData<ITextureView*>(Cmd)), Cmd.pDSV, Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::BeginRenderPass:
+            {
+                const CmdBeginRenderPass& Cmd     = CMD(CmdBeginRenderPass);
+                BeginRenderPassAttribs    Attribs = Cmd.Attribs;
+                if (Attribs.ClearValueCount > 0)
+                    Attribs.pClearValues = const_cast<OptimizedClearValue*>(GetCmdData<OptimizedClearValue>(Cmd));
+                pContext->BeginRenderPass(Attribs);
+                break;
+            }
+
+            case CMD_TYPE::NextSubpass:
+                pContext->NextSubpass();
+                break;
+
+            case CMD_TYPE::EndRenderPass:
+                pContext->EndRenderPass();
+                break;
+
+            case CMD_TYPE::Draw:
+                pContext->Draw(CMD(CmdAttribs<DrawAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DrawIndexed:
+                pContext->DrawIndexed(CMD(CmdAttribs<DrawIndexedAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DrawIndirect:
+                pContext->DrawIndirect(CMD(CmdAttribs<DrawIndirectAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DrawIndexedIndirect:
+                pContext->DrawIndexedIndirect(CMD(CmdAttribs<DrawIndexedIndirectAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DrawMesh:
+                pContext->DrawMesh(CMD(CmdAttribs<DrawMeshAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DispatchCompute:
+                pContext->DispatchCompute(CMD(CmdAttribs<DispatchComputeAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::DispatchComputeIndirect:
+                pContext->DispatchComputeIndirect(CMD(CmdAttribs<DispatchComputeIndirectAttribs>).Attribs);
+                break;
+
+            case CMD_TYPE::ClearDepthStencil:
+            {
+                const CmdClearDepthStencil& Cmd = CMD(CmdClearDepthStencil);
+                pContext->ClearDepthStencil(Cmd.pView, Cmd.Flags, Cmd.Depth, Cmd.Stencil, Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::ClearRenderTarget:
+            {
+                const CmdClearRenderTarget& Cmd = CMD(CmdClearRenderTarget);
+                pContext->ClearRenderTarget(Cmd.pView, Cmd.RGBA, Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::UpdateBuffer:
+            {
+                const CmdUpdateBuffer& Cmd = CMD(CmdUpdateBuffer);
+                pContext->UpdateBuffer(Cmd.pBuffer, Cmd.Offset, Cmd.Size, GetCmdData<Uint8>(Cmd), Cmd.Mode);
+                break;
+            }
+
+            case CMD_TYPE::CopyBuffer:
+            {
+                const CmdCopyBuffer& Cmd = CMD(CmdCopyBuffer);
+                pContext->CopyBuffer(Cmd.pSrcBuffer, Cmd.SrcOffset, Cmd.SrcMode, Cmd.pDstBuffer, Cmd.DstOffset, Cmd.Size, Cmd.DstMode);
+                break;
+            }
+
+            case CMD_TYPE::CopyTexture:
+            {
+                const CmdCopyTexture& Cmd     = CMD(CmdCopyTexture);
+                CopyTextureAttribs    Attribs = Cmd.Attribs;
+                if (Cmd.HasSrcBox)
+                    Attribs.pSrcBox = &Cmd.SrcBox;
+                pContext->CopyTexture(Attribs);
+                break;
+            }
+
+            case CMD_TYPE::TransitionResourceStates:
+            {
+                const CmdTransitionResourceStates& Cmd = CMD(CmdTransitionResourceStates);
+                pContext->TransitionResourceStates(Cmd.BarrierCount, GetCmdData<StateTransitionDesc>(Cmd));
+                break;
+            }
+
+            case CMD_TYPE::BeginDebugGroup:
+            {
+                const CmdDebugLabel& Cmd = CMD(CmdDebugLabel);
+                pContext->BeginDebugGroup(GetCmdData<Char>(Cmd), Cmd.HasColor ? Cmd.Color : nullptr);
+                break;
+            }
+
+            case CMD_TYPE::EndDebugGroup:
+                pContext->EndDebugGroup();
+                break;
+
+            case CMD_TYPE::InsertDebugLabel:
+            {
+                const CmdDebugLabel& Cmd = CMD(CmdDebugLabel);
+                pContext->InsertDebugLabel(GetCmdData<Char>(Cmd), Cmd.HasColor ? Cmd.Color : nullptr);
+                break;
+            }
+
+            case CMD_TYPE::InvokeCallback:
+            {
+                const CmdInvokeCallback& Cmd = CMD(CmdInvokeCallback);
+                Cmd.Callback(pContext, Cmd.pUserData);
+                break;
+            }
+
+            default:
+                UNEXPECTED("Unexpected command type");
+        }
+#undef CMD
+
+        pCurr += Header.Size;
+    }
+}
+
+namespace
+{
+
+struct SerializedStreamHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x4D525453; // 'STRM'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic;
+    Uint32 Version;
+    Uint32 PointerSize;
+    Uint32 CommandCount;
+    Uint64 DataSize;
+};
+static_assert(sizeof(SerializedStreamHeader) % CmdAlignment == 0, "Header size must be a multiple of the command alignment");
+
+} // namespace
+
+template <typename HandlerType>
+bool CommandStream::ProcessObjectReferences(CMD_TYPE Type, void* pPayload, HandlerType&& Handler)
+{
+#define CMD(Type) (*static_cast<Type*>(pPayload))
+    switch (Type)
+    {
+        case CMD_TYPE::SetPipelineState:
+            Handler(CMD(CmdSetPipelineState).pPSO);
+            break;
+
+        case CMD_TYPE::CommitShaderResources:
+            Handler(CMD(CmdCommitShaderResources).pSRB);
+            break;
+
+        case CMD_TYPE::SetVertexBuffers:
+        {
+            CmdSetVertexBuffers& Cmd      = CMD(CmdSetVertexBuffers);
+            IBuffer**            ppBuffer = GetCmdData<IBuffer*>(Cmd);
+            for (Uint32 i = 0; i < Cmd.NumBuffers; ++i)
+                Handler(ppBuffer[i]);
+            break;
+        }
+
+        case CMD_TYPE::SetIndexBuffer:
+            Handler(CMD(CmdSetIndexBuffer).pBuffer);
+            break;
+
+        case CMD_TYPE::SetRenderTargets:
+        {
+            CmdSetRenderTargets& Cmd   = CMD(CmdSetRenderTargets);
+            ITextureView**       ppRTs = GetCmdData<ITextureView*>(Cmd);
+            for (Uint32 i = 0; i < Cmd.NumRenderTargets; ++i)
+                Handler(ppRTs[i]);
+            Handler(Cmd.pDSV);
+            break;
+        }
+
+        case CMD_TYPE::BeginRenderPass:
+        {
+            BeginRenderPassAttribs& Attribs = CMD(CmdBeginRenderPass).Attribs;
+            Handler(Attribs.pRenderPass);
+            Handler(Attribs.pFramebuffer);
+            break;
+        }
+
+        case CMD_TYPE::DrawIndirect:
+        {
+            DrawIndirectAttribs& Attribs = CMD(CmdAttribs<DrawIndirectAttribs>).Attribs;
+            Handler(Attribs.pAttribsBuffer);
+            Handler(Attribs.pCounterBuffer);
+            break;
+        }
+
+        case CMD_TYPE::DrawIndexedIndirect:
+        {
+            DrawIndexedIndirectAttribs& Attribs = CMD(CmdAttribs<DrawIndexedIndirectAttribs>).Attribs;
+            Handler(Attribs.pAttribsBuffer);
+            Handler(Attribs.pCounterBuffer);
+            break;
+        }
+
+        case CMD_TYPE::DispatchComputeIndirect:
+            Handler(CMD(CmdAttribs<DispatchComputeIndirectAttribs>).Attribs.pAttribsBuffer);
+            break;
+
+        case CMD_TYPE::ClearDepthStencil:
+            Handler(CMD(CmdClearDepthStencil).pView);
+            break;
+
+        case CMD_TYPE::ClearRenderTarget:
+            Handler(CMD(CmdClearRenderTarget).pView);
+            break;
+
+        case CMD_TYPE::UpdateBuffer:
+            Handler(CMD(CmdUpdateBuffer).pBuffer);
+            break;
+
+        case CMD_TYPE::CopyBuffer:
+        {
+            CmdCopyBuffer& Cmd = CMD(CmdCopyBuffer);
+            Handler(Cmd.pSrcBuffer);
+            Handler(Cmd.pDstBuffer);
+            break;
+        }
+
+        case CMD_TYPE::CopyTexture:
+        {
+            CopyTextureAttribs& Attribs = CMD(CmdCopyTexture).Attribs;
+            Handler(Attribs.pSrcTexture);
+            Handler(Attribs.pDstTexture);
+            break;
+        }
+
+        case CMD_TYPE::TransitionResourceStates:
+        {
+            CmdTransitionResourceStates& Cmd       = CMD(CmdTransitionResourceStates);
+            StateTransitionDesc*         pBarriers = GetCmdData<StateTransitionDesc>(Cmd);
+            for (Uint32 i = 0; i < Cmd.BarrierCount; ++i)
+            {
+                Handler(pBarriers[i].pResourceBefore);
+                Handler(pBarriers[i].pResource);
+            }
+            break;
+        }
+
+        case CMD_TYPE::InvokeCallback:
+            return false;
+
+        default:
+            // No object references
+            break;
+    }
+#undef CMD
+
+    return true;
+}
+
+bool CommandStream::Serialize(const GetObjectIdCallbackType& GetObjectId, std::vector<Uint8>& Data) const
+{
+    DEV_CHECK_ERR(GetObjectId, "GetObjectId callback must not be null");
+
+    Data.resize(sizeof(SerializedStreamHeader) + m_Data.size());
+
+    SerializedStreamHeader& Header = *reinterpret_cast<SerializedStreamHeader*>(Data.data());
+    Header.Magic                   = SerializedStreamHeader::ExpectedMagic;
+    Header.Version                 = SerializedStreamHeader::ExpectedVersion;
+    Header.PointerSize             = sizeof(void*);
+    Header.CommandCount            = m_CommandCount;
+    Header.DataSize                = m_Data.size();
+
+    Uint8* const pStart = Data.data() + sizeof(SerializedStreamHeader);
+    if (!m_Data.empty())
+        memcpy(pStart, m_Data.data(), m_Data.size());
+
+    // Object pointers are replaced with Id + 1, so that null pointers remain null
+    auto ObjectToId = [&GetObjectId](auto*& pObject) {
+        if (pObject != nullptr)
+        {
+            const Uint32 Id = GetObjectId(pObject);
+            pObject         = reinterpret_cast<std::remove_reference_t<decltype(pObject)>>(uintptr_t{Id} + 1);
+        }
+    };
+
+    for (Uint8* pCurr = pStart; pCurr < pStart + m_Data.size();)
+    {
+        const CommandHeader& CmdHeader = *reinterpret_cast<const CommandHeader*>(pCurr);
+        if (!ProcessObjectReferences(static_cast<CMD_TYPE>(CmdHeader.Type), pCurr + sizeof(CommandHeader), ObjectToId))
+        {
+            LOG_ERROR_MESSAGE("Command streams that contain callbacks can't be serialized");
+            Data.clear();
+            return false;
+        }
+        pCurr += CmdHeader.Size;
+    }
+
+    return true;
+}
+
+bool CommandStream::Deserialize(const void* pData, size_t DataSize, const GetObjectCallbackType& GetObject)
+{
+    DEV_CHECK_ERR(GetObject, "GetObject callback must not be null");
+
+    Reset();
+
+    if (pData == nullptr || DataSize < sizeof(SerializedStreamHeader))
+    {
+        LOG_ERROR_MESSAGE("Serialized command stream data is too small");
+        return false;
+    }
+
+    SerializedStreamHeader Header;
+    memcpy(&Header, pData, sizeof(Header));
+    if (Header.Magic != SerializedStreamHeader::ExpectedMagic)
+    {
+        LOG_ERROR_MESSAGE("Data is not a serialized command stream");
+        return false;
+    }
+    if (Header.Version != SerializedStreamHeader::ExpectedVersion)
+    {
+        LOG_ERROR_MESSAGE("Serialized command stream version (", Header.Version, ") is not supported. Expected version: ", SerializedStreamHeader::ExpectedVersion);
+        return false;
+    }
+    if (Header.PointerSize != sizeof(void*))
+    {
+        LOG_ERROR_MESSAGE("Serialized command stream was created on a platform with ", Header.PointerSize * 8, "-bit pointers");
+        return false;
+    }
+    if (Header.DataSize != DataSize - sizeof(SerializedStreamHeader))
+    {
+        LOG_ERROR_MESSAGE("Serialized command stream data size (", DataSize - sizeof(SerializedStreamHeader), ") does not match the size in the header (", Header.DataSize, ")");
+        return false;
+    }
+
+    m_Data.resize(StaticCast<size_t>(Header.DataSize));
+    if (!m_Data.empty())
+        memcpy(m_Data.data(), static_cast<const Uint8*>(pData) + sizeof(SerializedStreamHeader), m_Data.size());
+
+    auto IdToObject = [&GetObject](auto*& pObject) {
+        const uintptr_t Id = reinterpret_cast<uintptr_t>(pObject);
+        if (Id != 0)
+            pObject = static_cast<std::remove_reference_t<decltype(pObject)>>(GetObject(static_cast<Uint32>(Id - 1)));
+    };
+
+    Uint32       NumCommands = 0;
+    Uint8*       pCurr       = m_Data.data();
+    Uint8* const pEnd        = pCurr + m_Data.size();
+    while (pCurr < pEnd)
+    {
+        const CommandHeader& CmdHeader = *reinterpret_cast<const CommandHeader*>(pCurr);
+        if (static_cast<size_t>(pEnd - pCurr) < sizeof(CommandHeader) ||
+            CmdHeader.Size < sizeof(CommandHeader) || CmdHeader.Size % CmdAlignment != 0 || CmdHeader.Size > static_cast<size_t>(pEnd - pCurr) ||
+            CmdHeader.Type >= static_cast<Uint32>(CMD_TYPE::Count) ||
+            !ProcessObjectReferences(static_cast<CMD_TYPE>(CmdHeader.Type), pCurr + sizeof(CommandHeader), IdToObject))
+        {
+            LOG_ERROR_MESSAGE("Serialized command stream data is corrupted");
+            Reset();
+            return false;
+        }
+        pCurr += CmdHeader.Size;
+        ++NumCommands;
+    }
+
+    if (NumCommands != Header.CommandCount)
+    {
+        LOG_ERROR_MESSAGE("The number of commands in the serialized command stream (", NumCommands, ") does not match the number in the header (", Header.CommandCount, ")");
+        Reset();
+        return false;
+    }
+    m_CommandCount = NumCommands;
+
+    return true;
+}
+
+} // namespace Diligent
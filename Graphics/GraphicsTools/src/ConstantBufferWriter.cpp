@@ -0,0 +1,294 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ConstantBufferWriter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Align.hpp"
+#include "MapHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint32 GetBasicTypeSize(SHADER_CODE_BASIC_TYPE Type)
+{
+    switch (Type)
+    {
+        case SHADER_CODE_BASIC_TYPE_INT64:
+        case SHADER_CODE_BASIC_TYPE_UINT64:
+        case SHADER_CODE_BASIC_TYPE_DOUBLE:
+            return 8;
+
+        case SHADER_CODE_BASIC_TYPE_INT16:
+        case SHADER_CODE_BASIC_TYPE_UINT16:
+        case SHADER_CODE_BASIC_TYPE_FLOAT16:
+            return 2;
+
+        // Minimum precision types occupy 32 bits in constant buffers
+        default:
+            return 4;
+    }
+}
+
+Uint32 GetVariableSize(const ShaderCodeVariableDesc& Var);
+
+// Returns the size of one element of the variable
+Uint32 GetElementSize(const ShaderCodeVariableDesc& Var)
+{
+    switch (Var.Class)
+    {
+        case SHADER_CODE_VARIABLE_CLASS_STRUCT:
+        {
+            Uint32 Size = 0;
+            for (Uint32 i = 0; i < Var.NumMembers; ++i)
+                Size = std::max(Size, Var.pMembers[i].Offset + GetVariableSize(Var.pMembers[i]));
+            return Size;
+        }
+
+        case SHADER_CODE_VARIABLE_CLASS_MATRIX_ROWS:
+        case SHADER_CODE_VARIABLE_CLASS_MATRIX_COLUMNS:
+        {
+            // Every row or column occupies a 16-byte register except the last one. The reflection
+            // swaps rows and columns for some compilers, so use the larger size to be conservative.
+            const Uint32 Dim = std::max(Var.NumRows, Var.NumColumns);
+            return (Dim - 1) * 16 + Dim * GetBasicTypeSize(Var.BasicType);
+        }
+
+        default:
+            return std::max<Uint32>(Var.NumColumns, 1) * std::max<Uint32>(Var.NumRows, 1) * GetBasicTypeSize(Var.BasicType);
+    }
+}
+
+Uint32 GetArrayStride(const ShaderCodeVariableDesc& Var)
+{
+    return AlignUp(GetElementSize(Var), ConstantBufferWriter::RowSize);
+}
+
+// Returns the total size of the variable, including all array elements
+Uint32 GetVariableSize(const ShaderCodeVariableDesc& Var)
+{
+    const Uint32 ElementSize = GetElementSize(Var);
+    return Var.ArraySize > 1 ? (Var.ArraySize - 1) * GetArrayStride(Var) + ElementSize : ElementSize;
+}
+
+const ShaderCodeBufferDesc* FindConstantBufferDesc(IShader* pShader, const Char* BufferName)
+{
+    DEV_CHECK_ERR(pShader != nullptr, "Shader must not be null");
+    DEV_CHECK_ERR(BufferName != nullptr, "Buffer name must not be null");
+
+    const Uint32 ResCount = pShader->GetResourceCount();
+    for (Uint32 i = 0; i < ResCount; ++i)
+    {
+        ShaderResourceDesc ResDesc;
+        pShader->GetResourceDesc(i, ResDesc);
+        if (ResDesc.Type != SHADER_RESOURCE_TYPE_CONSTANT_BUFFER || strcmp(ResDesc.Name, BufferName) != 0)
+            continue;
+
+        const ShaderCodeBufferDesc* pBufferDesc = pShader->GetConstantBufferDesc(i);
+        if (pBufferDesc == nullptr)
+        {
+            LOG_ERROR_AND_THROW("Reflection of constant buffer '", BufferName, "' is not available in shader '", pShader->GetDesc().Name,
+                                "'. Create the shader with ShaderCreateInfo::LoadConstantBufferReflection set to true.");
+        }
+        return pBufferDesc;
+    }
+
+    LOG_ERROR_AND_THROW("Constant buffer '", BufferName, "' is not found in shader '", pShader->GetDesc().Name, "'");
+    return nullptr;
+}
+
+} // namespace
+
+ConstantBufferWriter::ConstantBufferWriter(const ShaderCodeBufferDesc& BufferDesc) :
+    m_Data(BufferDesc.Size),
+    m_DirtyRows((BufferDesc.Size + RowSize - 1) / RowSize)
+{
+    AddVariables(BufferDesc.pVariables, BufferDesc.NumVariables, 0, "");
+    MarkAllDirty();
+}
+
+ConstantBufferWriter::ConstantBufferWriter(IShader* pShader, const Char* BufferName) :
+    ConstantBufferWriter{*FindConstantBufferDesc(pShader, BufferName)}
+{
+}
+
+void ConstantBufferWriter::AddVariables(const ShaderCodeVariableDesc* pVariables, Uint32 NumVariables, Uint32 BaseOffset, const std::string& Prefix)
+{
+    for (Uint32 i = 0; i < NumVariables; ++i)
+    {
+        const ShaderCodeVariableDesc& Var = pVariables[i];
+        if (Var.Name == nullptr)
+            continue;
+
+        const std::string Name   = Prefix + Var.Name;
+        const Uint32      Offset = BaseOffset + Var.Offset;
+        if (Var.Class == SHADER_CODE_VARIABLE_CLASS_STRUCT)
+        {
+            if (Var.ArraySize > 1)
+            {
+                const Uint32 Stride = GetArrayStride(Var);
+                for (Uint32 Elem = 0; Elem < Var.ArraySize; ++Elem)
+                    AddVariables(Var.pMembers, Var.NumMembers, Offset + Elem * Stride, Name + '[' + std::to_string(Elem) + "].");
+            }
+            else
+            {
+                AddVariables(Var.pMembers, Var.NumMembers, Offset, Name + '.');
+            }
+            continue;
+        }
+
+        FieldInfo Field;
+        Field.Name        = Name;
+        Field.Offset      = Offset;
+        Field.Size        = GetElementSize(Var);
+        Field.ArraySize   = std::max(Var.ArraySize, 1u);
+        Field.ArrayStride = GetArrayStride(Var);
+        if (Field.Offset + (Field.ArraySize - 1) * Field.ArrayStride + Field.Size > m_Data.size())
+        {
+            // Conservative matrix size may exceed the buffer size for the last variable
+            if (Field.Offset >= m_Data.size())
+            {
+                LOG_WARNING_MESSAGE("Constant buffer field '", Name, "' is outside of the buffer and will be ignored");
+                continue;
+            }
+            Field.Size = std::min(Field.Size, static_cast<Uint32>(m_Data.size()) - Field.Offset);
+        }
+
+        m_Fields.emplace_back(std::move(Field));
+        const Uint32 FieldId = static_cast<Uint32>(m_Fields.size() - 1);
+        if (!m_FieldIds.emplace(HashMapStringKey{m_Fields.back().Name.c_str(), true}, FieldId).second)
+            LOG_WARNING_MESSAGE("Duplicate constant buffer field '", Name, "'");
+    }
+}
+
+Uint32 ConstantBufferWriter::GetFieldId(const Char* Name) const
+{
+    auto it = m_FieldIds.find(Name);
+    return it != m_FieldIds.end() ? it->second : InvalidFieldId;
+}
+
+bool ConstantBufferWriter::SetData(Uint32 FieldId, const void* pData, Uint32 DataSize, Uint32 ArrayIndex)
+{
+    if (FieldId >= m_Fields.size())
+    {
+        UNEXPECTED("Field ID (", FieldId, ") is out of range");
+        return false;
+    }
+
+    const FieldInfo& Field = m_Fields[FieldId];
+    if (ArrayIndex >= Field.ArraySize)
+    {
+        UNEXPECTED("Array index (", ArrayIndex, ") is out of range for field '", Field.Name, "' with ", Field.ArraySize, " elements");
+        return false;
+    }
+    DEV_CHECK_ERR(DataSize <= Field.Size, "Data size (", DataSize, ") exceeds the size of field '", Field.Name, "' (", Field.Size, ")");
+    DataSize = std::min(DataSize, Field.Size);
+
+    const Uint32 Offset = Field.Offset + ArrayIndex * Field.ArrayStride;
+    VERIFY_EXPR(Offset + DataSize <= m_Data.size());
+    if (DataSize == 0 || memcmp(&m_Data[Offset], pData, DataSize) == 0)
+        return false;
+
+    memcpy(&m_Data[Offset], pData, DataSize);
+    for (Uint32 Row = Offset / RowSize; Row <= (Offset + DataSize - 1) / RowSize; ++Row)
+    {
+        if (!m_DirtyRows[Row])
+        {
+            m_DirtyRows[Row] = true;
+            ++m_NumDirtyRows;
+        }
+    }
+    return true;
+}
+
+void ConstantBufferWriter::MarkAllDirty()
+{
+    std::fill(m_DirtyRows.begin(), m_DirtyRows.end(), true);
+    m_NumDirtyRows = static_cast<Uint32>(m_DirtyRows.size());
+}
+
+Uint32 ConstantBufferWriter::Upload(IDeviceContext* pContext, IBuffer* pBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(pBuffer != nullptr, "Buffer must not be null");
+
+    const BufferDesc& BuffDesc = pBuffer->GetDesc();
+    DEV_CHECK_ERR(BuffDesc.Size >= m_Data.size(), "Buffer '", BuffDesc.Name, "' is too small (", BuffDesc.Size, " bytes) to hold the constant buffer data (", m_Data.size(), " bytes)");
+
+    if (BuffDesc.Usage == USAGE_DYNAMIC)
+    {
+        MapHelper<Uint8> MappedData{pContext, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+        if (!MappedData)
+            return 0;
+        memcpy(MappedData, m_Data.data(), m_Data.size());
+        std::fill(m_DirtyRows.begin(), m_DirtyRows.end(), false);
+        m_NumDirtyRows = 0;
+        return static_cast<Uint32>(m_Data.size());
+    }
+
+    DEV_CHECK_ERR(BuffDesc.Usage == USAGE_DEFAULT, "Buffer '", BuffDesc.Name, "' must be USAGE_DEFAULT or USAGE_DYNAMIC");
+    if (m_NumDirtyRows == 0)
+        return 0;
+
+    // Merging ranges separated by a few clean rows is cheaper than issuing separate commands
+    constexpr Uint32 MaxGapRows = 2;
+
+    const Uint32 NumRows       = static_cast<Uint32>(m_DirtyRows.size());
+    Uint32       UploadedBytes = 0;
+    for (Uint32 Row = 0; Row < NumRows;)
+    {
+        if (!m_DirtyRows[Row])
+        {
+            ++Row;
+            continue;
+        }
+
+        const Uint32 FirstRow = Row;
+        Uint32       LastRow  = Row;
+        for (++Row; Row < NumRows && Row <= LastRow + MaxGapRows + 1; ++Row)
+        {
+            if (m_DirtyRows[Row])
+                LastRow = Row;
+        }
+        Row = LastRow + 1;
+
+        const Uint32 Offset = FirstRow * RowSize;
+        const Uint32 Size   = std::min((LastRow + 1) * RowSize, static_cast<Uint32>(m_Data.size())) - Offset;
+        pContext->UpdateBuffer(pBuffer, Offset, Size, &m_Data[Offset], TransitionMode);
+        UploadedBytes += Size;
+    }
+
+    std::fill(m_DirtyRows.begin(), m_DirtyRows.end(), false);
+    m_NumDirtyRows = 0;
+    return UploadedBytes;
+}
+
+} // namespace Diligent
@@ -0,0 +1,265 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DynamicResolutionController.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "DurationQueryHelper.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+DynamicResolutionController::DynamicResolutionController(IRenderDevice* pDevice, const DynamicResolutionControllerCreateInfo& CreateInfo) :
+    m_pDevice{pDevice},
+    m_CI{CreateInfo},
+    m_Width{CreateInfo.Width},
+    m_Height{CreateInfo.Height}
+{
+    if (m_CI.MinScale <= 0 || m_CI.MinScale > m_CI.MaxScale)
+        LOG_ERROR_AND_THROW("MinScale (", m_CI.MinScale, ") must be positive and not greater than MaxScale (", m_CI.MaxScale, ")");
+    if (m_CI.ScaleStep <= 0)
+        LOG_ERROR_AND_THROW("ScaleStep (", m_CI.ScaleStep, ") must be positive");
+    if (m_CI.TargetFrameTime <= 0)
+        LOG_ERROR_AND_THROW("TargetFrameTime must be positive");
+    if (m_CI.IncreaseThreshold >= m_CI.DecreaseThreshold)
+        LOG_WARNING_MESSAGE("IncreaseThreshold (", m_CI.IncreaseThreshold, ") is not less than DecreaseThreshold (", m_CI.DecreaseThreshold,
+                            "), which may cause the scale to oscillate");
+
+    for (Uint32 Step = 0;; ++Step)
+    {
+        const float Scale = m_CI.MaxScale - static_cast<float>(Step) * m_CI.ScaleStep;
+        if (Scale <= m_CI.MinScale + m_CI.ScaleStep * 1e-3f)
+            break;
+        m_Scales.push_back(Scale);
+    }
+    m_Scales.push_back(m_CI.MinScale);
+
+    m_FrameTimes.resize(std::max(m_CI.NumFramesToAverage, 1u));
+
+    if (m_pDevice)
+    {
+        if (m_pDevice->GetDeviceInfo().Features.TimestampQueries)
+            m_pQueryHelper = std::make_unique<DurationQueryHelper>(m_pDevice, 4, 8);
+        else
+            LOG_WARNING_MESSAGE("Timestamp queries are not supported by this device. Dynamic resolution scale will only be changed manually.");
+    }
+}
+
+DynamicResolutionController::~DynamicResolutionController()
+{
+}
+
+void DynamicResolutionController::BeginFrame(IDeviceContext* pContext)
+{
+    if (!m_pQueryHelper)
+        return;
+
+    m_pQueryHelper->Begin(pContext);
+    ++m_NumPendingFrames;
+}
+
+bool DynamicResolutionController::EndFrame(IDeviceContext* pContext)
+{
+    if (!m_pQueryHelper)
+        return false;
+
+    double GPUFrameTime = 0;
+    if (!m_pQueryHelper->End(pContext, GPUFrameTime))
+        return false;
+
+    VERIFY_EXPR(m_NumPendingFrames > 0);
+    --m_NumPendingFrames;
+    return Update(GPUFrameTime);
+}
+
+bool DynamicResolutionController::Update(double GPUFrameTime)
+{
+    ++m_FramesSinceChange;
+
+    if (m_NumMeasurementsToSkip > 0)
+    {
+        // The frame was rendered at the previous scale
+        --m_NumMeasurementsToSkip;
+        return false;
+    }
+
+    const Uint32 WindowSize       = static_cast<Uint32>(m_FrameTimes.size());
+    m_FrameTimes[m_FrameTimeIdx] = GPUFrameTime;
+    m_FrameTimeIdx               = (m_FrameTimeIdx + 1) % WindowSize;
+    m_NumFrameTimes              = std::min(m_NumFrameTimes + 1, WindowSize);
+
+    if (m_NumFrameTimes < WindowSize || m_FramesSinceChange < m_CI.MinFramesBetweenChanges)
+        return false;
+
+    const double AvgFrameTime = GetAverageGPUFrameTime();
+
+    Uint32 NewScaleIdx = m_ScaleIdx;
+    if (AvgFrameTime > m_CI.TargetFrameTime * m_CI.DecreaseThreshold)
+    {
+        if (m_ScaleIdx + 1 < m_Scales.size())
+            NewScaleIdx = m_ScaleIdx + 1;
+    }
+    else if (m_ScaleIdx > 0)
+    {
+        // Assume that the frame time is proportional to the number of pixels
+        const double Ratio = static_cast<double>(m_Scales[m_ScaleIdx - 1]) / static_cast<double>(m_Scales[m_ScaleIdx]);
+        if (AvgFrameTime * Ratio * Ratio <= m_CI.TargetFrameTime * m_CI.IncreaseThreshold)
+            NewScaleIdx = m_ScaleIdx - 1;
+    }
+
+    if (NewScaleIdx == m_ScaleIdx)
+        return false;
+
+    m_ScaleIdx = NewScaleIdx;
+    OnScaleChanged();
+    return true;
+}
+
+void DynamicResolutionController::SetScaleIndex(Uint32 ScaleIdx)
+{
+    if (ScaleIdx >= m_Scales.size())
+    {
+        UNEXPECTED("Scale index (", ScaleIdx, ") is out of range [0, ", m_Scales.size(), ")");
+        return;
+    }
+
+    if (ScaleIdx == m_ScaleIdx)
+        return;
+
+    m_ScaleIdx = ScaleIdx;
+    OnScaleChanged();
+}
+
+void DynamicResolutionController::OnScaleChanged()
+{
+    m_NumFrameTimes     = 0;
+    m_FrameTimeIdx      = 0;
+    m_FramesSinceChange = 0;
+    // Measurements of the frames that are in flight are not representative of the new scale
+    m_NumMeasurementsToSkip = m_NumPendingFrames;
+}
+
+double DynamicResolutionController::GetAverageGPUFrameTime() const
+{
+    if (m_NumFrameTimes == 0)
+        return 0;
+
+    double Sum = 0;
+    for (Uint32 i = 0; i < m_NumFrameTimes; ++i)
+        Sum += m_FrameTimes[i];
+    return Sum / static_cast<double>(m_NumFrameTimes);
+}
+
+Uint32 DynamicResolutionController::GetScaledSize(Uint32 Size, Uint32 ScaleIdx) const
+{
+    const Uint32 ScaledSize = static_cast<Uint32>(std::lround(static_cast<double>(Size) * m_Scales[ScaleIdx]));
+    return std::max(ScaledSize, 1u);
+}
+
+void DynamicResolutionController::CreateTextures(Uint32 Index)
+{
+    RenderTarget& RT = m_RenderTargets[Index];
+    RT.Textures.clear();
+    if (m_Width == 0 || m_Height == 0)
+        return;
+
+    const Uint32 NumTextures = m_CI.TargetMode == DYNAMIC_RESOLUTION_TARGET_MODE_SEPARATE ? static_cast<Uint32>(m_Scales.size()) : 1;
+    RT.Textures.resize(NumTextures);
+    for (Uint32 ScaleIdx = 0; ScaleIdx < NumTextures; ++ScaleIdx)
+    {
+        TextureDesc Desc = RT.Desc;
+        Desc.Width       = GetScaledSize(m_Width, ScaleIdx);
+        Desc.Height      = GetScaledSize(m_Height, ScaleIdx);
+
+        const std::string Name = RT.Name + " (" + std::to_string(Desc.Width) + "x" + std::to_string(Desc.Height) + ")";
+        Desc.Name              = Name.c_str();
+
+        m_pDevice->CreateTexture(Desc, nullptr, &RT.Textures[ScaleIdx]);
+        if (!RT.Textures[ScaleIdx])
+            LOG_ERROR_MESSAGE("Failed to create dynamic resolution render target '", Name, "'");
+    }
+}
+
+Uint32 DynamicResolutionController::AddRenderTarget(const TextureDesc& Desc)
+{
+    if (!m_pDevice)
+    {
+        LOG_ERROR_MESSAGE("Render targets can't be created by a dynamic resolution controller without a render device");
+        return InvalidIndex;
+    }
+
+    const Uint32 Index = static_cast<Uint32>(m_RenderTargets.size());
+
+    RenderTarget RT;
+    RT.Name      = Desc.Name != nullptr ? Desc.Name : "Dynamic resolution render target";
+    RT.Desc      = Desc;
+    RT.Desc.Name = nullptr;
+    m_RenderTargets.emplace_back(std::move(RT));
+
+    CreateTextures(Index);
+    for (const RefCntAutoPtr<ITexture>& pTex : m_RenderTargets[Index].Textures)
+    {
+        if (!pTex)
+        {
+            m_RenderTargets.pop_back();
+            return InvalidIndex;
+        }
+    }
+
+    return Index;
+}
+
+void DynamicResolutionController::SetFullResolution(Uint32 Width, Uint32 Height)
+{
+    if (m_Width == Width && m_Height == Height)
+        return;
+
+    m_Width  = Width;
+    m_Height = Height;
+    for (Uint32 i = 0; i < m_RenderTargets.size(); ++i)
+        CreateTextures(i);
+}
+
+ITexture* DynamicResolutionController::GetRenderTarget(Uint32 Index, Uint32 ScaleIdx) const
+{
+    if (Index >= m_RenderTargets.size())
+    {
+        UNEXPECTED("Render target index (", Index, ") is out of range");
+        return nullptr;
+    }
+
+    const std::vector<RefCntAutoPtr<ITexture>>& Textures = m_RenderTargets[Index].Textures;
+    if (Textures.empty())
+        return nullptr;
+
+    return m_CI.TargetMode == DYNAMIC_RESOLUTION_TARGET_MODE_SEPARATE ? Textures[ScaleIdx] : Textures[0];
+}
+
+} // namespace Diligent
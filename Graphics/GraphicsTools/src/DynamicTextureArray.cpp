@@ -73,7 +73,8 @@ bool VerifySparseTextureCompatibility(IRenderDevice* pDevice, const TextureDesc&
 DynamicTextureArray::DynamicTextureArray(IRenderDevice* pDevice, const DynamicTextureArrayCreateInfo& CreateInfo) :
     m_Name{CreateInfo.Desc.Name != nullptr ? CreateInfo.Desc.Name : "Dynamic Texture"},
     m_Desc{CreateInfo.Desc},
-    m_NumSlicesInPage{std::max(CreateInfo.NumSlicesInMemoryPage, 1u)}
+    m_NumSlicesInPage{std::max(CreateInfo.NumSlicesInMemoryPage, 1u)},
+    m_NumSlicesInChunk{CreateInfo.NumSlicesInChunk}
 {
     m_Desc.Name = m_Name.c_str();
 
@@ -232,6 +233,12 @@ void DynamicTextureArray::CreateResources(IRenderDevice* pDevice)
     }
 
     // NB: m_Desc.Usage may be changed by CreateSparseTexture()
+    if (IsChunked())
+    {
+        ResizeChunks(pDevice);
+        return;
+    }
+
     if (m_Desc.Usage == USAGE_DEFAULT && m_PendingSize > 0)
     {
         auto Desc      = m_Desc;
@@ -403,16 +410,71 @@ void DynamicTextureArray::ResizeDefaultTexture(IDeviceContext* pContext)
             CopyAttribs.SrcMipLevel = mip;
             CopyAttribs.DstMipLevel = mip;
             pContext->CopyTexture(CopyAttribs);
+
+            m_CopiedBytes += GetMipLevelProperties(SrcTexDesc, mip).MipSize;
         }
     }
     m_pStaleTexture.Release();
 }
 
+void DynamicTextureArray::ResizeChunks(IRenderDevice* pDevice)
+{
+    VERIFY_EXPR(IsChunked());
+
+    m_PendingSize = AlignUp(m_PendingSize, m_NumSlicesInChunk);
+
+    const size_t NumChunks = m_PendingSize / m_NumSlicesInChunk;
+    if (NumChunks == m_Chunks.size())
+        return;
+
+    if (NumChunks < m_Chunks.size())
+    {
+        // Release the chunks at the end of the array
+        m_Chunks.resize(NumChunks);
+    }
+    else
+    {
+        VERIFY(pDevice != nullptr, "Render device is required to create new chunks");
+
+        auto ChunkDesc      = m_Desc;
+        ChunkDesc.ArraySize = m_NumSlicesInChunk;
+
+        m_Chunks.reserve(NumChunks);
+        while (m_Chunks.size() < NumChunks)
+        {
+            const auto ChunkName = m_Name + " - chunk " + std::to_string(m_Chunks.size());
+            ChunkDesc.Name       = ChunkName.c_str();
+
+            RefCntAutoPtr<ITexture> pChunk;
+            pDevice->CreateTexture(ChunkDesc, nullptr, &pChunk);
+            if (!pChunk)
+            {
+                DEV_ERROR("Failed to create texture chunk for dynamic texture array '", m_Name, "'");
+                break;
+            }
+            m_Chunks.emplace_back(std::move(pChunk));
+        }
+    }
+
+    // NB: if a chunk could not be created, the update will still be pending
+    m_Desc.ArraySize = static_cast<Uint32>(m_Chunks.size()) * m_NumSlicesInChunk;
+    ++m_NumResizes;
+    m_PeakMemoryUsage = std::max(m_PeakMemoryUsage, GetMemoryUsage());
+
+    // Chunk list has changed, so all bindings must be updated
+    m_Version.fetch_add(1);
+
+    LOG_INFO_MESSAGE("Dynamic texture array: resizing chunked texture '", m_Desc.Name,
+                     "' (", m_Desc.Width, " x ", m_Desc.Height, " ", m_Desc.MipLevels, "-mip ",
+                     GetTextureFormatAttribs(m_Desc.Format).Name, ") to ",
+                     m_Chunks.size(), " chunks of ", m_NumSlicesInChunk, " slices. Version: ", GetVersion());
+}
+
 void DynamicTextureArray::CommitResize(IRenderDevice*  pDevice,
                                        IDeviceContext* pContext,
                                        bool            AllowNull)
 {
-    if (!m_pTexture && m_PendingSize > 0)
+    if (!m_pTexture && m_Chunks.empty() && m_PendingSize > 0)
     {
         if (pDevice != nullptr)
             CreateResources(pDevice);
@@ -420,6 +482,19 @@ void DynamicTextureArray::CommitResize(IRenderDevice*  pDevice,
             DEV_CHECK_ERR(AllowNull, "Dynamic texture array must be initialized, but pDevice is null");
     }
 
+    if (IsChunked())
+    {
+        if (m_Desc.ArraySize != m_PendingSize)
+        {
+            // Releasing chunks does not require the device
+            if (pDevice != nullptr || m_PendingSize < m_Desc.ArraySize)
+                ResizeChunks(pDevice);
+            else
+                DEV_CHECK_ERR(AllowNull, "Dynamic texture array must be resized, but pDevice is null. Use PendingUpdate() to check if the array must be updated.");
+        }
+        return;
+    }
+
     if (m_pTexture && m_Desc.ArraySize != m_PendingSize)
     {
         if (pContext != nullptr)
@@ -430,6 +505,8 @@ void DynamicTextureArray::CommitResize(IRenderDevice*  pDevice,
                 ResizeDefaultTexture(pContext);
 
             m_Desc.ArraySize = m_PendingSize;
+            ++m_NumResizes;
+            m_PeakMemoryUsage = std::max(m_PeakMemoryUsage, GetMemoryUsage());
 
             LOG_INFO_MESSAGE("Dynamic texture array: expanding texture '", m_Desc.Name,
                              "' (", m_Desc.Width, " x ", m_Desc.Height, " ", m_Desc.MipLevels, "-mip ",
@@ -452,7 +529,7 @@ ITexture* DynamicTextureArray::Resize(IRenderDevice*  pDevice,
     {
         m_PendingSize = NewArraySize;
 
-        if (m_Desc.Usage != USAGE_SPARSE)
+        if (m_Desc.Usage != USAGE_SPARSE && !IsChunked())
         {
             if (!m_pStaleTexture)
                 m_pStaleTexture = std::move(m_pTexture);
@@ -479,7 +556,7 @@ ITexture* DynamicTextureArray::Resize(IRenderDevice*  pDevice,
 
     CommitResize(pDevice, pContext, true /*AllowNull*/);
 
-    return m_pTexture;
+    return GetTexture();
 }
 
 ITexture* DynamicTextureArray::Update(IRenderDevice*  pDevice,
@@ -495,7 +572,7 @@ ITexture* DynamicTextureArray::Update(IRenderDevice*  pDevice,
         pContext->DeviceWaitForFence(m_pAfterResizeFence, m_LastAfterResizeFenceValue);
     }
 
-    return m_pTexture;
+    return GetTexture();
 }
 
 Uint64 DynamicTextureArray::GetMemoryUsage() const
@@ -515,4 +592,16 @@ Uint64 DynamicTextureArray::GetMemoryUsage() const
     return MemUsage;
 }
 
+DynamicTextureArrayStats DynamicTextureArray::GetStats() const
+{
+    DynamicTextureArrayStats Stats;
+    Stats.NumSlices               = m_Desc.ArraySize;
+    Stats.NumChunks               = GetNumChunks();
+    Stats.CommittedMemorySize     = GetMemoryUsage();
+    Stats.PeakCommittedMemorySize = std::max(m_PeakMemoryUsage, Stats.CommittedMemorySize);
+    Stats.NumResizes              = m_NumResizes;
+    Stats.CopiedBytes             = m_CopiedBytes;
+    return Stats;
+}
+
 } // namespace Diligent
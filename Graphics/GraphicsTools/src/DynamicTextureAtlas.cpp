@@ -33,6 +33,8 @@
 #include <unordered_map>
 #include <map>
 #include <set>
+#include <vector>
+#include <tuple>
 
 #include "DynamicAtlasManager.hpp"
 #include "DynamicTextureArray.hpp"
@@ -140,11 +142,26 @@ private:
 namespace
 {
 
+struct AtlasAllocationRequest
+{
+    // Index of the request in the batch
+    Uint32 Index = 0;
+
+    Uint32 Alignment = 0;
+
+    // Region size in units of alignment
+    Uint32 Width  = 0;
+    Uint32 Height = 0;
+
+    DynamicAtlasManager::Region Subregion;
+    Uint32                      Slice = 0;
+};
+
 class ThreadSafeAtlasManager
 {
 public:
-    ThreadSafeAtlasManager(const uint2& Dim) noexcept :
-        Mgr{Dim.x, Dim.y}
+    ThreadSafeAtlasManager(const uint2& Dim, DynamicAtlasManager::PackingStrategy Strategy) noexcept :
+        Mgr{Dim.x, Dim.y, Strategy}
     {}
 
     // clang-format off
@@ -198,12 +215,36 @@ public:
             return pAtlasMgr != nullptr;
         }
 
-        DynamicAtlasManager::Region Allocate(Uint32 Width, Uint32 Height)
+        // Allocates regions for all requests that have not been allocated yet while holding the lock.
+        // If TryLock is true and the slice is locked by another thread, returns false without
+        // allocating anything.
+        bool Allocate(AtlasAllocationRequest* pRequests, size_t NumRequests, Uint32 Slice, bool TryLock)
         {
             VERIFY_EXPR(pAtlasMgr != nullptr);
             VERIFY_EXPR(pAtlasMgr->UseCount > 0);
-            std::lock_guard<std::mutex> Guard{pAtlasMgr->Mtx};
-            return pAtlasMgr->Mgr.Allocate(Width, Height);
+
+            std::unique_lock<std::mutex> Guard{pAtlasMgr->Mtx, std::defer_lock};
+            if (TryLock)
+            {
+                if (!Guard.try_lock())
+                    return false;
+            }
+            else
+            {
+                Guard.lock();
+            }
+
+            for (size_t i = 0; i < NumRequests; ++i)
+            {
+                auto& Req = pRequests[i];
+                if (!Req.Subregion.IsEmpty())
+                    continue;
+
+                Req.Subregion = pAtlasMgr->Mgr.Allocate(Req.Width, Req.Height);
+                if (!Req.Subregion.IsEmpty())
+                    Req.Slice = Slice;
+            }
+            return true;
         }
 
         // Frees a region and returns true if the atlas is empty
@@ -273,8 +314,9 @@ private:
 
 struct SliceBatch
 {
-    SliceBatch(const uint2 AtlasDim) noexcept :
-        m_AtlasDim{AtlasDim}
+    SliceBatch(const uint2 AtlasDim, DynamicAtlasManager::PackingStrategy Strategy) noexcept :
+        m_AtlasDim{AtlasDim},
+        m_Strategy{Strategy}
     {}
 
     ~SliceBatch()
@@ -318,7 +360,7 @@ struct SliceBatch
         std::lock_guard<std::mutex> Guard{m_Mtx};
 
         VERIFY(m_Slices.find(Slice) == m_Slices.end(), "Slice ", Slice, " already present in the batch.");
-        auto it = m_Slices.emplace(Slice, m_AtlasDim).first;
+        auto it = m_Slices.emplace(std::piecewise_construct, std::forward_as_tuple(Slice), std::forward_as_tuple(m_AtlasDim, m_Strategy)).first;
         // NB: Lock() atomically increases the use count of the slice while we hold the mutex.
         return it->second.Lock();
     }
@@ -353,7 +395,8 @@ struct SliceBatch
     }
 
 private:
-    const uint2 m_AtlasDim;
+    const uint2                                m_AtlasDim;
+    const DynamicAtlasManager::PackingStrategy m_Strategy;
 
     std::mutex m_Mtx;
     // For every alignment, we keep a list of slice managers sorted by the slice index.
@@ -382,11 +425,15 @@ public:
             }(CreateInfo.Desc) //
         },
         // clang-format off
-        m_MinAlignment    {CreateInfo.MinAlignment},
-        m_ExtraSliceCount {CreateInfo.ExtraSliceCount},
-        m_ExtraSliceFactor{clamp(CreateInfo.GrowthFactor, 1.f, 2.f) - 1.f},
-        m_MaxSliceCount   {CreateInfo.Desc.Type == RESOURCE_DIM_TEX_2D_ARRAY ? std::min(CreateInfo.MaxSliceCount, Uint32{2048}) : 1},
-        m_Silent          {CreateInfo.Silent},
+        m_MinAlignment          {CreateInfo.MinAlignment},
+        m_ExtraSliceCount       {CreateInfo.ExtraSliceCount},
+        m_ExtraSliceFactor      {clamp(CreateInfo.GrowthFactor, 1.f, 2.f) - 1.f},
+        m_MaxSliceCount         {CreateInfo.Desc.Type == RESOURCE_DIM_TEX_2D_ARRAY ? std::min(CreateInfo.MaxSliceCount, Uint32{2048}) : 1},
+        m_Silent                {CreateInfo.Silent},
+        m_ThreadAffineAllocation{CreateInfo.ThreadAffineAllocation},
+        m_PackingStrategy       {CreateInfo.PackingStrategy == TEXTURE_ATLAS_PACKING_STRATEGY_SKYLINE ?
+                                    DynamicAtlasManager::PackingStrategy::Skyline :
+                                    DynamicAtlasManager::PackingStrategy::Guillotine},
         m_SuballocationsAllocator
         {
             DefaultRawMemoryAllocator::GetAllocator(),
@@ -407,6 +454,9 @@ public:
         if (m_Desc.Height == 0)
             LOG_ERROR_AND_THROW("Texture height must not be zero");
 
+        if (CreateInfo.PackingStrategy >= TEXTURE_ATLAS_PACKING_STRATEGY_COUNT)
+            LOG_ERROR_AND_THROW("Invalid packing strategy (", Uint32{CreateInfo.PackingStrategy}, ")");
+
         if (m_MinAlignment != 0)
         {
             if (!IsPowerOfTwo(m_MinAlignment))
@@ -446,6 +496,7 @@ public:
         VERIFY_EXPR(m_UsedArea.load() == 0);
         VERIFY_EXPR(m_AllocationCount.load() == 0);
         VERIFY_EXPR(m_AvailableSlices.size() == m_MaxSliceCount);
+        VERIFY_EXPR(m_NumSlicesInUse.load() == 0);
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DynamicTextureAtlas, TBase)
@@ -492,88 +543,102 @@ public:
                           Uint32                       Height,
                           ITextureAtlasSuballocation** ppSuballocation) override final
     {
-        if (Width == 0 || Height == 0)
-        {
-            UNEXPECTED("Subregion size must not be zero");
+        const uint2 Size{Width, Height};
+        AllocateBatch(1, &Size, ppSuballocation);
+    }
+
+    virtual void AllocateBatch(Uint32                       NumRegions,
+                               const uint2*                 pSizes,
+                               ITextureAtlasSuballocation** ppSuballocations) override final
+    {
+        if (NumRegions == 0)
             return;
-        }
 
-        if (Width > m_Desc.Width || Height > m_Desc.Height)
+        if (pSizes == nullptr || ppSuballocations == nullptr)
         {
-            LOG_ERROR_MESSAGE("Requested region size ", Width, " x ", Height, " exceeds atlas dimensions ", m_Desc.Width, " x ", m_Desc.Height);
+            UNEXPECTED("pSizes and ppSuballocations must not be null");
             return;
         }
 
-        const auto Alignment     = GetAllocationAlignment(Width, Height);
-        const auto AlignedWidth  = AlignUp(Width, Alignment);
-        const auto AlignedHeight = AlignUp(Height, Alignment);
-
-        auto* pBatch = GetSliceBatch(Alignment, m_Desc.Width / Alignment, m_Desc.Height / Alignment);
-        VERIFY_EXPR(pBatch != nullptr);
-
-        DynamicAtlasManager::Region Subregion;
-
-        Uint32 Slice = 0;
-        while (Slice < m_MaxSliceCount)
+        std::vector<AtlasAllocationRequest> Requests;
+        Requests.reserve(NumRegions);
+        for (Uint32 i = 0; i < NumRegions; ++i)
         {
-            // Lock the first available slice with index >= Slice
-            auto SliceMgr = pBatch->LockSliceAfter(Slice);
-            if (!SliceMgr)
+            DEV_CHECK_ERR(ppSuballocations[i] == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+            const auto Width  = pSizes[i].x;
+            const auto Height = pSizes[i].y;
+            if (Width == 0 || Height == 0)
             {
-                const auto NewSlice = GetNextAvailableSlice();
-                if (NewSlice != ~Uint32{0})
-                {
-                    Slice    = NewSlice;
-                    SliceMgr = pBatch->AddSlice(Slice);
-                    VERIFY_EXPR(SliceMgr);
-                }
-                else
-                {
-                    // It is possible that another thread added a new slice while this thread failed
-                    SliceMgr = pBatch->LockSliceAfter(Slice);
-                    if (!SliceMgr)
-                        break;
-                }
+                UNEXPECTED("Subregion size must not be zero");
+                continue;
             }
 
-            if (SliceMgr)
+            if (Width > m_Desc.Width || Height > m_Desc.Height)
             {
-                Subregion = SliceMgr.Allocate(AlignedWidth / Alignment, AlignedHeight / Alignment);
-                if (!Subregion.IsEmpty())
-                    break;
+                LOG_ERROR_MESSAGE("Requested region size ", Width, " x ", Height, " exceeds atlas dimensions ", m_Desc.Width, " x ", m_Desc.Height);
+                continue;
             }
 
-            // Failed to allocate the region - try the next slice
-            ++Slice;
+            AtlasAllocationRequest Req;
+            Req.Index     = i;
+            Req.Alignment = GetAllocationAlignment(Width, Height);
+            Req.Width     = AlignUp(Width, Req.Alignment) / Req.Alignment;
+            Req.Height    = AlignUp(Height, Req.Alignment) / Req.Alignment;
+            Requests.push_back(Req);
         }
 
-        if (Subregion.IsEmpty())
+        // Group the requests by alignment and place larger regions first for better packing
+        std::sort(Requests.begin(), Requests.end(),
+                  [](const AtlasAllocationRequest& R0, const AtlasAllocationRequest& R1) {
+                      if (R0.Alignment != R1.Alignment)
+                          return R0.Alignment > R1.Alignment;
+                      return Uint64{R0.Width} * Uint64{R0.Height} > Uint64{R1.Width} * Uint64{R1.Height};
+                  });
+
+        for (auto GroupStart = Requests.begin(); GroupStart != Requests.end();)
         {
-            if (!m_Silent)
-            {
-                LOG_ERROR_MESSAGE("Failed to suballocate texture subregion ", Width, " x ", Height, " from texture atlas");
-            }
-            return;
+            const auto Alignment = GroupStart->Alignment;
+            const auto GroupEnd  = std::find_if(GroupStart, Requests.end(),
+                                               [Alignment](const AtlasAllocationRequest& Req) {
+                                                   return Req.Alignment != Alignment;
+                                               });
+            AllocateRegions(&*GroupStart, static_cast<size_t>(GroupEnd - GroupStart));
+            GroupStart = GroupEnd;
         }
 
-        m_AllocatedArea.fetch_add(Int64{Width} * Int64{Height});
-        m_UsedArea.fetch_add(Int64{AlignedWidth} * Int64{AlignedHeight});
-        m_AllocationCount.fetch_add(1);
+        for (auto& Req : Requests)
+        {
+            const auto Width  = pSizes[Req.Index].x;
+            const auto Height = pSizes[Req.Index].y;
+            if (Req.Subregion.IsEmpty())
+            {
+                if (!m_Silent)
+                {
+                    LOG_ERROR_MESSAGE("Failed to suballocate texture subregion ", Width, " x ", Height, " from texture atlas");
+                }
+                continue;
+            }
 
-        // clang-format off
-        TextureAtlasSuballocationImpl* pSuballocation{
-            NEW_RC_OBJ(m_SuballocationsAllocator, "TextureAtlasSuballocationImpl instance", TextureAtlasSuballocationImpl)
-            (
-                this,
-                std::move(Subregion),
-                Slice,
-                Alignment,
-                uint2{Width, Height}
-            )
-        };
-        // clang-format on
+            m_AllocatedArea.fetch_add(Int64{Width} * Int64{Height});
+            m_UsedArea.fetch_add(Int64{Req.Width * Req.Alignment} * Int64{Req.Height * Req.Alignment});
+            m_AllocationCount.fetch_add(1);
+
+            // clang-format off
+            TextureAtlasSuballocationImpl* pSuballocation{
+                NEW_RC_OBJ(m_SuballocationsAllocator, "TextureAtlasSuballocationImpl instance", TextureAtlasSuballocationImpl)
+                (
+                    this,
+                    std::move(Req.Subregion),
+                    Req.Slice,
+                    Req.Alignment,
+                    uint2{Width, Height}
+                )
+            };
+            // clang-format on
 
-        pSuballocation->QueryInterface(IID_TextureAtlasSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
+            pSuballocation->QueryInterface(IID_TextureAtlasSuballocation, reinterpret_cast<IObject**>(&ppSuballocations[Req.Index]));
+        }
     }
 
     void Free(Uint32 Slice, Uint32 Alignment, DynamicAtlasManager::Region&& Subregion, Uint32 Width, Uint32 Height)
@@ -672,9 +737,96 @@ public:
         Stats.AllocationCount = m_AllocationCount.load();
         Stats.AllocatedArea   = m_AllocatedArea.load();
         Stats.UsedArea        = m_UsedArea.load();
+        Stats.SlicesInUse     = static_cast<Uint32>(m_NumSlicesInUse.load());
+
+        const auto SliceArea    = Uint64{m_Desc.Width} * Uint64{m_Desc.Height};
+        Stats.PackingEfficiency = Stats.SlicesInUse > 0 ?
+            static_cast<float>(static_cast<double>(Stats.UsedArea) / static_cast<double>(SliceArea * Stats.SlicesInUse)) :
+            0.f;
     }
 
 private:
+    // Allocates regions for the requests that share the same alignment
+    void AllocateRegions(AtlasAllocationRequest* pRequests, size_t NumRequests)
+    {
+        VERIFY_EXPR(NumRequests > 0);
+        const auto Alignment = pRequests[0].Alignment;
+
+        auto* pBatch = GetSliceBatch(Alignment, m_Desc.Width / Alignment, m_Desc.Height / Alignment);
+        VERIFY_EXPR(pBatch != nullptr);
+
+        auto HasPendingRequests = [&]() {
+            return std::any_of(pRequests, pRequests + NumRequests,
+                               [](const AtlasAllocationRequest& Req) { return Req.Subregion.IsEmpty(); });
+        };
+
+        if (m_ThreadAffineAllocation)
+        {
+            // Start from the preferred slice of this thread, wrap around and skip the
+            // slices that are currently locked by other threads.
+            const auto NumSlices  = std::max(m_TexArraySize.load(), 1u);
+            const auto StartSlice = GetThreadIndex() % NumSlices;
+            for (Uint32 Pass = 0; Pass < 2 && HasPendingRequests(); ++Pass)
+            {
+                Uint32       Slice    = Pass == 0 ? StartSlice : 0;
+                const Uint32 EndSlice = Pass == 0 ? m_MaxSliceCount : StartSlice;
+                while (Slice < EndSlice)
+                {
+                    // Lock the first available slice with index >= Slice
+                    auto SliceMgr = pBatch->LockSliceAfter(Slice);
+                    if (!SliceMgr || Slice >= EndSlice)
+                        break;
+
+                    if (SliceMgr.Allocate(pRequests, NumRequests, Slice, /*TryLock = */ true) && !HasPendingRequests())
+                        return;
+
+                    ++Slice;
+                }
+            }
+        }
+
+        Uint32 Slice = 0;
+        while (Slice < m_MaxSliceCount)
+        {
+            // Lock the first available slice with index >= Slice
+            auto SliceMgr = pBatch->LockSliceAfter(Slice);
+            if (!SliceMgr)
+            {
+                const auto NewSlice = GetNextAvailableSlice();
+                if (NewSlice != ~Uint32{0})
+                {
+                    Slice    = NewSlice;
+                    SliceMgr = pBatch->AddSlice(Slice);
+                    VERIFY_EXPR(SliceMgr);
+                }
+                else
+                {
+                    // It is possible that another thread added a new slice while this thread failed
+                    SliceMgr = pBatch->LockSliceAfter(Slice);
+                    if (!SliceMgr)
+                        break;
+                }
+            }
+
+            if (SliceMgr)
+            {
+                SliceMgr.Allocate(pRequests, NumRequests, Slice, /*TryLock = */ false);
+                if (!HasPendingRequests())
+                    break;
+            }
+
+            // Failed to allocate some regions - try the next slice
+            ++Slice;
+        }
+    }
+
+    static Uint32 GetThreadIndex()
+    {
+        static std::atomic<Uint32> NextThreadIndex{0};
+        static thread_local Uint32 ThreadIndex = NextThreadIndex.fetch_add(1);
+        return ThreadIndex;
+    }
+
     Uint32 GetNextAvailableSlice()
     {
         std::lock_guard<std::mutex> Guard{m_AvailableSlicesMtx};
@@ -684,6 +836,7 @@ private:
         auto FirstFreeSlice = *m_AvailableSlices.begin();
         VERIFY_EXPR(FirstFreeSlice < m_MaxSliceCount);
         m_AvailableSlices.erase(m_AvailableSlices.begin());
+        m_NumSlicesInUse.fetch_add(1);
 
         while (m_TexArraySize <= FirstFreeSlice)
         {
@@ -702,6 +855,7 @@ private:
         std::lock_guard<std::mutex> Guard{m_AvailableSlicesMtx};
         VERIFY(m_AvailableSlices.find(Slice) == m_AvailableSlices.end(), "Slice ", Slice, " is already in the available slices list. This is a bug.");
         m_AvailableSlices.insert(Slice);
+        m_NumSlicesInUse.fetch_add(-1);
     }
 
     SliceBatch* GetSliceBatch(Uint32 Alignment, Uint32 AtlasWidth = 0, Uint32 AtlasHeight = 0)
@@ -711,7 +865,7 @@ private:
         // Get the list of slices for this alignment
         auto BatchIt = m_SliceBatchesByAlignment.find(Alignment);
         if (BatchIt == m_SliceBatchesByAlignment.end() && AtlasWidth != 0 && AtlasHeight != 0)
-            BatchIt = m_SliceBatchesByAlignment.emplace(Alignment, uint2{AtlasWidth, AtlasHeight}).first;
+            BatchIt = m_SliceBatchesByAlignment.emplace(std::piecewise_construct, std::forward_as_tuple(Alignment), std::forward_as_tuple(uint2{AtlasWidth, AtlasHeight}, m_PackingStrategy)).first;
 
         return BatchIt != m_SliceBatchesByAlignment.end() ? &BatchIt->second : nullptr;
     }
@@ -725,6 +879,9 @@ private:
     const float  m_ExtraSliceFactor;
     const Uint32 m_MaxSliceCount;
     const bool   m_Silent;
+    const bool   m_ThreadAffineAllocation;
+
+    const DynamicAtlasManager::PackingStrategy m_PackingStrategy;
 
     std::unique_ptr<DynamicTextureArray> m_DynamicTexArray;
     RefCntAutoPtr<ITexture>              m_pTexture;
@@ -738,6 +895,8 @@ private:
     std::atomic<Int64> m_AllocatedArea{0};
     std::atomic<Int64> m_UsedArea{0};
 
+    std::atomic<Int32> m_NumSlicesInUse{0};
+
     std::mutex m_SliceBatchesByAlignmentMtx;
     // Alignment -> slice batch
     std::unordered_map<Uint32, SliceBatch> m_SliceBatchesByAlignment;
@@ -0,0 +1,265 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUBlockCompressor.hpp"
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char BlockCompressionCSSource[] =
+    {
+#include "BlockCompressionCS_inc.h"
+};
+
+constexpr Uint32 ThreadGroupSize = 8;
+
+// Mirrors cbBlockCompressionAttribs in BlockCompressionCS.hlsl
+struct BlockCompressionAttribs
+{
+    Uint32 SrcWidth;
+    Uint32 SrcHeight;
+    Uint32 NumBlocksX;
+    Uint32 NumBlocksY;
+    Uint32 DstRowStride;
+    Uint32 Padding0;
+    Uint32 Padding1;
+    Uint32 Padding2;
+};
+static_assert(sizeof(BlockCompressionAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+// Returns the value of the BC_FORMAT shader macro, or 0 if the format is not supported
+Uint32 GetBCFormatId(TEXTURE_FORMAT Format)
+{
+    switch (Format)
+    {
+        case TEX_FORMAT_BC1_UNORM:
+        case TEX_FORMAT_BC1_UNORM_SRGB:
+            return 1;
+
+        case TEX_FORMAT_BC3_UNORM:
+        case TEX_FORMAT_BC3_UNORM_SRGB:
+            return 3;
+
+        case TEX_FORMAT_BC4_UNORM:
+            return 4;
+
+        case TEX_FORMAT_BC5_UNORM:
+            return 5;
+
+        case TEX_FORMAT_BC6H_UF16:
+            return 6;
+
+        case TEX_FORMAT_BC7_UNORM:
+        case TEX_FORMAT_BC7_UNORM_SRGB:
+            return 7;
+
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+GPUBlockCompressor::GPUBlockCompressor(IRenderDevice* pDevice) :
+    m_pDevice{pDevice}
+{
+    DEV_CHECK_ERR(IsSupported(pDevice), "GPU block compressor is not supported by this device");
+    CreateUniformBuffer(pDevice, sizeof(BlockCompressionAttribs), "GPU block compressor attribs", &m_pConstants);
+}
+
+GPUBlockCompressor::~GPUBlockCompressor()
+{
+}
+
+bool GPUBlockCompressor::IsSupported(IRenderDevice* pDevice)
+{
+    if (pDevice == nullptr)
+        return false;
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    // The blocks are copied from a buffer, which is not supported by Direct3D11 and
+    // would require an explicit pixel buffer barrier in OpenGL.
+    return (DeviceInfo.Type == RENDER_DEVICE_TYPE_D3D12 || DeviceInfo.Type == RENDER_DEVICE_TYPE_VULKAN) &&
+        DeviceInfo.Features.ComputeShaders;
+}
+
+bool GPUBlockCompressor::IsFormatSupported(TEXTURE_FORMAT Format)
+{
+    return GetBCFormatId(Format) != 0;
+}
+
+GPUBlockCompressor::PipelineInfo* GPUBlockCompressor::GetPipeline(Uint32 BCFormat, bool ConvertToSRGB)
+{
+    const Uint32 Key = BCFormat * 2 + (ConvertToSRGB ? 1 : 0);
+
+    auto it = m_Pipelines.find(Key);
+    if (it != m_Pipelines.end())
+        return &it->second;
+
+    ShaderMacroHelper Macros;
+    Macros.Add("BC_FORMAT", BCFormat);
+    Macros.Add("CONVERT_TO_SRGB", ConvertToSRGB ? 1 : 0);
+    Macros.Add("THREAD_GROUP_SIZE", ThreadGroupSize);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc           = {"Block compression CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = BlockCompressionCSSource;
+    ShaderCI.SourceLength   = sizeof(BlockCompressionCSSource) - 1;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    m_pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create block compression shader");
+        return nullptr;
+    }
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Block compression PSO";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    // The source view and the block buffer change between calls
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbBlockCompressionAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables    = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = _countof(Vars);
+
+    PipelineInfo Pipeline;
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create block compression PSO");
+        return nullptr;
+    }
+    Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbBlockCompressionAttribs")->Set(m_pConstants);
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return &m_Pipelines.emplace(Key, std::move(Pipeline)).first->second;
+}
+
+void GPUBlockCompressor::Compress(IDeviceContext* pContext, const CompressAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.pSrcView != nullptr, "Source view must not be null");
+    DEV_CHECK_ERR(Attribs.pSrcView->GetDesc().ViewType == TEXTURE_VIEW_SHADER_RESOURCE, "Source view must be a shader resource view");
+    DEV_CHECK_ERR(Attribs.pDstTexture != nullptr, "Destination texture must not be null");
+
+    const auto& DstDesc  = Attribs.pDstTexture->GetDesc();
+    const auto  BCFormat = GetBCFormatId(DstDesc.Format);
+    if (BCFormat == 0)
+    {
+        UNSUPPORTED("Texture format ", GetTextureFormatAttribs(DstDesc.Format).Name, " is not supported by the GPU block compressor");
+        return;
+    }
+
+    const auto& SrcViewDesc = Attribs.pSrcView->GetDesc();
+    const auto  SrcMipProps = GetMipLevelProperties(Attribs.pSrcView->GetTexture()->GetDesc(), SrcViewDesc.MostDetailedMip);
+    const auto  DstMipProps = GetMipLevelProperties(DstDesc, Attribs.DstMipLevel);
+    DEV_CHECK_ERR(SrcMipProps.LogicalWidth == DstMipProps.LogicalWidth && SrcMipProps.LogicalHeight == DstMipProps.LogicalHeight,
+                  "Source view size (", SrcMipProps.LogicalWidth, "x", SrcMipProps.LogicalHeight, ") does not match the size of the destination mip level (",
+                  DstMipProps.LogicalWidth, "x", DstMipProps.LogicalHeight, ")");
+
+    const bool ConvertToSRGB = IsSRGBFormat(SrcViewDesc.Format) && IsSRGBFormat(DstDesc.Format);
+    auto*      pPipeline     = GetPipeline(BCFormat, ConvertToSRGB);
+    if (pPipeline == nullptr)
+        return;
+
+    const Uint32 BlockSize  = GetTextureFormatAttribs(DstDesc.Format).ComponentSize;
+    const Uint32 NumBlocksX = (DstMipProps.LogicalWidth + 3) / 4;
+    const Uint32 NumBlocksY = (DstMipProps.LogicalHeight + 3) / 4;
+
+    Uint32 RowStride = NumBlocksX * BlockSize;
+    if (m_pDevice->GetDeviceInfo().Type == RENDER_DEVICE_TYPE_D3D12)
+    {
+        // D3D12_TEXTURE_DATA_PITCH_ALIGNMENT
+        RowStride = AlignUp(RowStride, 256u);
+    }
+
+    const Uint64 BufferSize = Uint64{RowStride} * NumBlocksY;
+    if (!m_pBlockBuffer || m_pBlockBuffer->GetDesc().Size < BufferSize)
+    {
+        m_pBlockBuffer.Release();
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "GPU block compressor blocks";
+        BuffDesc.Size              = BufferSize;
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBlockBuffer);
+        if (!m_pBlockBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create block buffer");
+            return;
+        }
+    }
+
+    {
+        MapHelper<BlockCompressionAttribs> CBAttribs{pContext, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        CBAttribs->SrcWidth     = SrcMipProps.LogicalWidth;
+        CBAttribs->SrcHeight    = SrcMipProps.LogicalHeight;
+        CBAttribs->NumBlocksX   = NumBlocksX;
+        CBAttribs->NumBlocksY   = NumBlocksY;
+        CBAttribs->DstRowStride = RowStride / sizeof(Uint32);
+    }
+
+    pPipeline->pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_SrcTexture")->Set(Attribs.pSrcView);
+    pPipeline->pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_DstBlocks")->Set(m_pBlockBuffer->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    pContext->SetPipelineState(pPipeline->pPSO);
+    pContext->CommitShaderResources(pPipeline->pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DispatchComputeAttribs DispatchAttribs;
+    DispatchAttribs.ThreadGroupCountX = (NumBlocksX + ThreadGroupSize - 1) / ThreadGroupSize;
+    DispatchAttribs.ThreadGroupCountY = (NumBlocksY + ThreadGroupSize - 1) / ThreadGroupSize;
+    pContext->DispatchCompute(DispatchAttribs);
+
+    const Box         DstBox{0, DstMipProps.LogicalWidth, 0, DstMipProps.LogicalHeight};
+    TextureSubResData SubresData{m_pBlockBuffer, 0, RowStride};
+    pContext->UpdateTexture(Attribs.pDstTexture, Attribs.DstMipLevel, Attribs.DstSlice, DstBox, SubresData,
+                            RESOURCE_STATE_TRANSITION_MODE_TRANSITION, Attribs.DstTextureTransitionMode);
+}
+
+} // namespace Diligent
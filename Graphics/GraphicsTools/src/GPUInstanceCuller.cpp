@@ -0,0 +1,302 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUInstanceCuller.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "AdvancedMath.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char InstanceCullingCSSource[] =
+    {
+#include "InstanceCullingCS_inc.h"
+};
+
+constexpr Uint32 ThreadGroupSize = 64;
+
+// sizeof(Uint32) * 5, see DrawIndexedIndirectAttribs::pAttribsBuffer
+constexpr Uint32 DrawArgsStride = 20;
+
+// Mirrors cbInstanceCullingAttribs in InstanceCullingCS.hlsl
+struct InstanceCullingAttribs
+{
+    float4   FrustumPlanes[ViewFrustum::NUM_PLANES];
+    float4x4 ViewProj;
+
+    Uint32 NumInstances;
+    Uint32 NumMeshes;
+    Uint32 NumVisibleInstanceSlots;
+    Uint32 ReverseDepth;
+
+    float2 HiZSize;
+    Uint32 HiZMipLevels;
+    Uint32 Padding;
+};
+static_assert(sizeof(InstanceCullingAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+void SetVariable(IShaderResourceBinding* pSRB, const char* Name, IDeviceObject* pObject)
+{
+    // Resources that are not used by the entry point are not present in the SRB
+    if (IShaderResourceVariable* pVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, Name))
+        pVar->Set(pObject);
+}
+
+} // namespace
+
+GPUInstanceCuller::GPUInstanceCuller(IRenderDevice* pDevice) :
+    m_pDevice{pDevice}
+{
+    DEV_CHECK_ERR(IsSupported(pDevice), "GPU instance culler is not supported by this device");
+    CreateUniformBuffer(pDevice, sizeof(InstanceCullingAttribs), "GPU instance culler attribs", &m_pConstants);
+}
+
+GPUInstanceCuller::~GPUInstanceCuller()
+{
+}
+
+bool GPUInstanceCuller::IsSupported(IRenderDevice* pDevice)
+{
+    if (pDevice == nullptr)
+        return false;
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    // The Hi-Z test assumes the [0, 1] NDC depth range, and Direct3D11 does not support counter buffers.
+    return (DeviceInfo.Type == RENDER_DEVICE_TYPE_D3D12 || DeviceInfo.Type == RENDER_DEVICE_TYPE_VULKAN) &&
+        DeviceInfo.Features.ComputeShaders &&
+        (pDevice->GetAdapterInfo().DrawCommand.CapFlags & DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER) != 0;
+}
+
+bool GPUInstanceCuller::CreatePipeline(const char* EntryPoint, bool UseHiZ, PipelineInfo& Pipeline)
+{
+    ShaderMacroHelper Macros;
+    Macros.Add("THREAD_GROUP_SIZE", ThreadGroupSize);
+    Macros.Add("USE_HIZ", UseHiZ ? 1 : 0);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc           = {"Instance culling CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = EntryPoint;
+    ShaderCI.Source         = InstanceCullingCSSource;
+    ShaderCI.SourceLength   = sizeof(InstanceCullingCSSource) - 1;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    m_pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create instance culling shader '", EntryPoint, "'");
+        return false;
+    }
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Instance culling PSO";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    // Input buffers and internal buffers may change between calls
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbInstanceCullingAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables    = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = _countof(Vars);
+
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create instance culling PSO '", EntryPoint, "'");
+        return false;
+    }
+    Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbInstanceCullingAttribs")->Set(m_pConstants);
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return true;
+}
+
+bool GPUInstanceCuller::CreateBuffers(Uint32 NumMeshes, Uint32 NumVisibleInstanceSlots)
+{
+    auto PrepareBuffer = [this](RefCntAutoPtr<IBuffer>& pBuffer, const char* Name, Uint64 Size, BIND_FLAGS BindFlags, BUFFER_MODE Mode) {
+        if (pBuffer && pBuffer->GetDesc().Size >= Size)
+            return true;
+
+        pBuffer.Release();
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = Name;
+        BuffDesc.Size      = Size;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        BuffDesc.BindFlags = BindFlags;
+        BuffDesc.Mode      = Mode;
+        if (Mode == BUFFER_MODE_STRUCTURED)
+            BuffDesc.ElementByteStride = sizeof(Uint32);
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        if (!pBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create ", Name);
+            return false;
+        }
+        return true;
+    };
+
+    // clang-format off
+    return PrepareBuffer(m_pMeshInstanceCounts, "GPU instance culler mesh instance counts", Uint64{NumMeshes} * sizeof(Uint32),               BIND_UNORDERED_ACCESS,                           BUFFER_MODE_STRUCTURED) &&
+           PrepareBuffer(m_pVisibleInstances,   "GPU instance culler visible instances",    Uint64{NumVisibleInstanceSlots} * sizeof(Uint32), BIND_UNORDERED_ACCESS | BIND_VERTEX_BUFFER,      BUFFER_MODE_RAW)        &&
+           PrepareBuffer(m_pDrawArgs,           "GPU instance culler draw args",            Uint64{NumMeshes} * DrawArgsStride,               BIND_UNORDERED_ACCESS | BIND_INDIRECT_DRAW_ARGS, BUFFER_MODE_RAW)        &&
+           PrepareBuffer(m_pDrawCount,          "GPU instance culler draw count",           16,                                               BIND_UNORDERED_ACCESS | BIND_INDIRECT_DRAW_ARGS, BUFFER_MODE_RAW);
+    // clang-format on
+}
+
+void GPUInstanceCuller::Cull(IDeviceContext* pContext, const CullAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.NumInstances == 0 || Attribs.pInstances != nullptr, "Instance buffer must not be null");
+    DEV_CHECK_ERR(Attribs.NumMeshes == 0 || Attribs.pMeshes != nullptr, "Mesh buffer must not be null");
+#ifdef DILIGENT_DEVELOPMENT
+    if (Attribs.pInstances != nullptr)
+    {
+        const auto& InstDesc = Attribs.pInstances->GetDesc();
+        DEV_CHECK_ERR(InstDesc.Mode == BUFFER_MODE_STRUCTURED && InstDesc.ElementByteStride == sizeof(InstanceData),
+                      "Instance buffer '", InstDesc.Name, "' must be a structured buffer with ", sizeof(InstanceData), "-byte elements");
+        DEV_CHECK_ERR(InstDesc.Size >= Uint64{Attribs.NumInstances} * sizeof(InstanceData), "Instance buffer '", InstDesc.Name, "' is too small");
+    }
+    if (Attribs.pMeshes != nullptr)
+    {
+        const auto& MeshDesc = Attribs.pMeshes->GetDesc();
+        DEV_CHECK_ERR(MeshDesc.Mode == BUFFER_MODE_STRUCTURED && MeshDesc.ElementByteStride == sizeof(MeshData),
+                      "Mesh buffer '", MeshDesc.Name, "' must be a structured buffer with ", sizeof(MeshData), "-byte elements");
+        DEV_CHECK_ERR(MeshDesc.Size >= Uint64{Attribs.NumMeshes} * sizeof(MeshData), "Mesh buffer '", MeshDesc.Name, "' is too small");
+    }
+    if (Attribs.pHiZView != nullptr)
+    {
+        DEV_CHECK_ERR(Attribs.pHiZView->GetDesc().ViewType == TEXTURE_VIEW_SHADER_RESOURCE, "Hi-Z view must be a shader resource view");
+    }
+#endif
+
+    const Uint32 NumVisibleInstanceSlots = Attribs.NumVisibleInstanceSlots != 0 ? Attribs.NumVisibleInstanceSlots : Attribs.NumInstances;
+    if (!CreateBuffers(std::max(Attribs.NumMeshes, 1u), std::max(NumVisibleInstanceSlots, 1u)))
+        return;
+
+    const bool    UseHiZ       = Attribs.pHiZView != nullptr;
+    PipelineInfo& CullPipeline = UseHiZ ? m_CullHiZPipeline : m_CullPipeline;
+    if ((!m_ResetPipeline.pPSO && !CreatePipeline("ResetCS", false, m_ResetPipeline)) ||
+        (!CullPipeline.pPSO && !CreatePipeline("CullCS", UseHiZ, CullPipeline)) ||
+        (!m_BuildArgsPipeline.pPSO && !CreatePipeline("BuildArgsCS", false, m_BuildArgsPipeline)))
+        return;
+
+    m_NumMeshes = Attribs.NumMeshes;
+
+    {
+        MapHelper<InstanceCullingAttribs> CBAttribs{pContext, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+
+        ViewFrustum Frustum;
+        ExtractViewFrustumPlanesFromMatrix(Attribs.ViewProj, Frustum, false);
+        for (Uint32 i = 0; i < ViewFrustum::NUM_PLANES; ++i)
+        {
+            const Plane3D& Plane        = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(i));
+            CBAttribs->FrustumPlanes[i] = float4{Plane.Normal, Plane.Distance};
+        }
+        CBAttribs->ViewProj = Attribs.ViewProj.Transpose();
+
+        CBAttribs->NumInstances            = Attribs.NumInstances;
+        CBAttribs->NumMeshes               = Attribs.NumMeshes;
+        CBAttribs->NumVisibleInstanceSlots = NumVisibleInstanceSlots;
+        CBAttribs->ReverseDepth            = Attribs.ReverseDepth ? 1 : 0;
+
+        if (UseHiZ)
+        {
+            const auto& HiZViewDesc = Attribs.pHiZView->GetDesc();
+            const auto  MipProps    = GetMipLevelProperties(Attribs.pHiZView->GetTexture()->GetDesc(), HiZViewDesc.MostDetailedMip);
+
+            CBAttribs->HiZSize      = float2{static_cast<float>(MipProps.LogicalWidth), static_cast<float>(MipProps.LogicalHeight)};
+            CBAttribs->HiZMipLevels = HiZViewDesc.NumMipLevels;
+        }
+        else
+        {
+            CBAttribs->HiZSize      = float2{0, 0};
+            CBAttribs->HiZMipLevels = 0;
+        }
+    }
+
+    IDeviceObject* pInstancesSRV = Attribs.pInstances != nullptr ? Attribs.pInstances->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE) : nullptr;
+    IDeviceObject* pMeshesSRV    = Attribs.pMeshes != nullptr ? Attribs.pMeshes->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE) : nullptr;
+
+    auto Dispatch = [&](PipelineInfo& Pipeline, Uint32 NumThreads) {
+        SetVariable(Pipeline.pSRB, "g_Instances", pInstancesSRV);
+        SetVariable(Pipeline.pSRB, "g_Meshes", pMeshesSRV);
+        SetVariable(Pipeline.pSRB, "g_MeshInstanceCounts", m_pMeshInstanceCounts->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        SetVariable(Pipeline.pSRB, "g_VisibleInstances", m_pVisibleInstances->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        SetVariable(Pipeline.pSRB, "g_DrawArgs", m_pDrawArgs->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        SetVariable(Pipeline.pSRB, "g_DrawCount", m_pDrawCount->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        SetVariable(Pipeline.pSRB, "g_HiZ", Attribs.pHiZView);
+
+        pContext->SetPipelineState(Pipeline.pPSO);
+        pContext->CommitShaderResources(Pipeline.pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{(NumThreads + ThreadGroupSize - 1) / ThreadGroupSize, 1});
+    };
+
+    // The counters are written and read by consecutive dispatches
+    StateTransitionDesc CounterBarriers[] = {
+        {m_pMeshInstanceCounts, RESOURCE_STATE_UNORDERED_ACCESS, RESOURCE_STATE_UNORDERED_ACCESS},
+        {m_pDrawCount, RESOURCE_STATE_UNORDERED_ACCESS, RESOURCE_STATE_UNORDERED_ACCESS},
+    };
+
+    Dispatch(m_ResetPipeline, std::max(Attribs.NumMeshes, 1u));
+    pContext->TransitionResourceStates(_countof(CounterBarriers), CounterBarriers);
+
+    if (Attribs.NumInstances > 0 && Attribs.NumMeshes > 0)
+    {
+        Dispatch(CullPipeline, Attribs.NumInstances);
+        pContext->TransitionResourceStates(_countof(CounterBarriers), CounterBarriers);
+
+        Dispatch(m_BuildArgsPipeline, Attribs.NumMeshes);
+    }
+}
+
+DrawIndexedIndirectAttribs GPUInstanceCuller::GetDrawAttribs(VALUE_TYPE IndexType, DRAW_FLAGS Flags) const
+{
+    DrawIndexedIndirectAttribs DrawAttribs{IndexType, m_pDrawArgs, Flags};
+    DrawAttribs.DrawCount                        = std::max(m_NumMeshes, 1u);
+    DrawAttribs.DrawArgsStride                   = DrawArgsStride;
+    DrawAttribs.AttribsBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    DrawAttribs.pCounterBuffer                   = m_pDrawCount;
+    DrawAttribs.CounterBufferStateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    return DrawAttribs;
+}
+
+} // namespace Diligent
@@ -0,0 +1,340 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUProfiler.hpp"
+
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+namespace Diligent
+{
+
+GPUProfiler::GPUProfiler(IRenderDevice* pDevice,
+                         Uint32         NumQueriesToReserve,
+                         Uint32         MaxResolvedFrames,
+                         Uint32         ExpectedFrameLatency) :
+    m_pDevice{pDevice},
+    m_NumQueriesToReserve{NumQueriesToReserve},
+    m_MaxResolvedFrames{std::max(MaxResolvedFrames, 1u)},
+    m_ExpectedFrameLatency{ExpectedFrameLatency},
+    m_TimestampsSupported{pDevice->GetDeviceInfo().Features.TimestampQueries != DEVICE_FEATURE_STATE_DISABLED}
+{
+    if (!m_TimestampsSupported)
+        LOG_WARNING_MESSAGE("GPUProfiler: timestamp queries are not supported by the device. No timings will be recorded.");
+}
+
+Uint32 GPUProfiler::GetContextIndex(IDeviceContext* pCtx)
+{
+    for (Uint32 i = 0; i < m_Contexts.size(); ++i)
+    {
+        if (m_Contexts[i].pContext == pCtx)
+            return i;
+    }
+
+    const auto ContextIndex = static_cast<Uint32>(m_Contexts.size());
+    m_Contexts.emplace_back();
+
+    auto& Ctx    = m_Contexts.back();
+    Ctx.pContext = pCtx;
+
+    const auto& CtxDesc = pCtx->GetDesc();
+    Ctx.Name            = CtxDesc.Name != nullptr ? CtxDesc.Name : (std::string{"Context "} + std::to_string(ContextIndex));
+
+    Ctx.AvailableQueries.reserve(m_NumQueriesToReserve);
+    for (Uint32 i = 0; i < m_NumQueriesToReserve; ++i)
+        Ctx.AvailableQueries.emplace_back(GetQuery(ContextIndex));
+
+    return ContextIndex;
+}
+
+Uint32 GPUProfiler::GetNameIndex(const Char* Name)
+{
+    auto it = m_NameToIndex.find(Name);
+    if (it == m_NameToIndex.end())
+    {
+        it = m_NameToIndex.emplace(HashMapStringKey{Name, true}, static_cast<Uint32>(m_Names.size())).first;
+        m_Names.push_back(it->first.GetStr());
+    }
+    return it->second;
+}
+
+RefCntAutoPtr<IQuery> GPUProfiler::GetQuery(Uint32 ContextIndex)
+{
+    auto& AvailableQueries = m_Contexts[ContextIndex].AvailableQueries;
+    if (!AvailableQueries.empty())
+    {
+        auto pQuery = std::move(AvailableQueries.back());
+        AvailableQueries.pop_back();
+        return pQuery;
+    }
+
+    QueryDesc queryDesc{QUERY_TYPE_TIMESTAMP};
+    queryDesc.Name = "GPU profiler timestamp query";
+
+    RefCntAutoPtr<IQuery> pQuery;
+    m_pDevice->CreateQuery(queryDesc, &pQuery);
+    VERIFY(pQuery, "Failed to create timestamp query");
+    return pQuery;
+}
+
+void GPUProfiler::RecycleQuery(Uint32 ContextIndex, RefCntAutoPtr<IQuery>&& pQuery)
+{
+    if (pQuery)
+        m_Contexts[ContextIndex].AvailableQueries.emplace_back(std::move(pQuery));
+}
+
+void GPUProfiler::RecycleFrameQueries(PendingFrame& Frame)
+{
+    for (auto& Scope : Frame.Scopes)
+    {
+        RecycleQuery(Scope.ContextIndex, std::move(Scope.StartTimestamp));
+        RecycleQuery(Scope.ContextIndex, std::move(Scope.EndTimestamp));
+    }
+    Frame.Scopes.clear();
+}
+
+void GPUProfiler::BeginScope(IDeviceContext* pCtx, const Char* Name)
+{
+    VERIFY_EXPR(pCtx != nullptr && Name != nullptr);
+    if (!m_TimestampsSupported)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    const auto ContextIndex = GetContextIndex(pCtx);
+    auto&      ScopeStack   = m_Contexts[ContextIndex].ScopeStack;
+
+    PendingScope Scope;
+    Scope.NameIndex    = GetNameIndex(Name);
+    Scope.Parent       = !ScopeStack.empty() ? ScopeStack.back() : InvalidIndex;
+    Scope.Depth        = static_cast<Uint32>(ScopeStack.size());
+    Scope.ContextIndex = ContextIndex;
+
+    Scope.StartTimestamp = GetQuery(ContextIndex);
+    if (!Scope.StartTimestamp)
+        return;
+    pCtx->EndQuery(Scope.StartTimestamp);
+
+    ScopeStack.push_back(static_cast<Uint32>(m_CurrentFrame.Scopes.size()));
+    m_CurrentFrame.Scopes.emplace_back(std::move(Scope));
+}
+
+void GPUProfiler::EndScope(IDeviceContext* pCtx)
+{
+    VERIFY_EXPR(pCtx != nullptr);
+    if (!m_TimestampsSupported)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    const auto ContextIndex = GetContextIndex(pCtx);
+    auto&      ScopeStack   = m_Contexts[ContextIndex].ScopeStack;
+    if (ScopeStack.empty())
+    {
+        LOG_ERROR_MESSAGE("GPUProfiler: there are no open scopes in context '", m_Contexts[ContextIndex].Name,
+                          "', which likely indicates inconsistent BeginScope()/EndScope() calls");
+        return;
+    }
+
+    auto& Scope = m_CurrentFrame.Scopes[ScopeStack.back()];
+    ScopeStack.pop_back();
+
+    VERIFY_EXPR(!Scope.EndTimestamp);
+    Scope.EndTimestamp = GetQuery(ContextIndex);
+    if (Scope.EndTimestamp)
+        pCtx->EndQuery(Scope.EndTimestamp);
+}
+
+bool GPUProfiler::ResolveOldestFrame()
+{
+    VERIFY_EXPR(!m_PendingFrames.empty());
+    auto& Frame = m_PendingFrames.front();
+
+    FrameData Resolved;
+    Resolved.FrameNumber = Frame.FrameNumber;
+    Resolved.StartTime   = 0;
+    Resolved.Scopes.resize(Frame.Scopes.size());
+
+    for (size_t i = 0; i < Frame.Scopes.size(); ++i)
+    {
+        const auto& Scope = Frame.Scopes[i];
+        VERIFY_EXPR(Scope.StartTimestamp && Scope.EndTimestamp);
+
+        // Do not invalidate the queries until all data in the frame is available
+        QueryDataTimestamp StartData;
+        QueryDataTimestamp EndData;
+        if (!Scope.StartTimestamp->GetData(&StartData, sizeof(StartData), false) ||
+            !Scope.EndTimestamp->GetData(&EndData, sizeof(EndData), false))
+            return false;
+
+        const auto StartTime = static_cast<double>(StartData.Counter) / static_cast<double>(StartData.Frequency);
+        const auto EndTime   = static_cast<double>(EndData.Counter) / static_cast<double>(EndData.Frequency);
+
+        auto& Dst        = Resolved.Scopes[i];
+        Dst.Name         = m_Names[Scope.NameIndex];
+        Dst.Parent       = Scope.Parent;
+        Dst.Depth        = Scope.Depth;
+        Dst.ContextIndex = Scope.ContextIndex;
+        Dst.StartTime    = StartTime;
+        Dst.Duration     = std::max(EndTime - StartTime, 0.0);
+
+        Resolved.StartTime = i == 0 ? StartTime : std::min(Resolved.StartTime, StartTime);
+    }
+
+    for (auto& Scope : Resolved.Scopes)
+        Scope.StartTime -= Resolved.StartTime;
+
+    for (auto& Scope : Frame.Scopes)
+    {
+        Scope.StartTimestamp->Invalidate();
+        Scope.EndTimestamp->Invalidate();
+    }
+    RecycleFrameQueries(Frame);
+    m_PendingFrames.pop_front();
+
+    m_ResolvedFrames.emplace_back(std::move(Resolved));
+    while (m_ResolvedFrames.size() > m_MaxResolvedFrames)
+        m_ResolvedFrames.pop_front();
+
+    return true;
+}
+
+void GPUProfiler::EndFrame()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    bool IsComplete = true;
+    for (auto& Ctx : m_Contexts)
+    {
+        if (!Ctx.ScopeStack.empty())
+        {
+            LOG_ERROR_MESSAGE("GPUProfiler: ", Ctx.ScopeStack.size(), " scope(s) in context '", Ctx.Name,
+                              "' have not been ended. The frame will be discarded.");
+            Ctx.ScopeStack.clear();
+            IsComplete = false;
+        }
+    }
+
+    const auto FrameNumber = m_CurrentFrame.FrameNumber;
+    if (IsComplete && !m_CurrentFrame.Scopes.empty())
+        m_PendingFrames.emplace_back(std::move(m_CurrentFrame));
+    else
+        RecycleFrameQueries(m_CurrentFrame);
+
+    m_CurrentFrame             = {};
+    m_CurrentFrame.FrameNumber = FrameNumber + 1;
+
+    while (!m_PendingFrames.empty() && ResolveOldestFrame())
+        ;
+
+    if (m_PendingFrames.size() > m_ExpectedFrameLatency)
+    {
+        LOG_WARNING_MESSAGE("GPUProfiler: there are ", m_PendingFrames.size(), " unresolved frames which exceeds the expected frame latency (",
+                            m_ExpectedFrameLatency, "). Make sure that the contexts are flushed and FinishFrame() is called.");
+    }
+}
+
+bool GPUProfiler::GetLastResolvedFrame(FrameData& Frame) const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    if (m_ResolvedFrames.empty())
+        return false;
+
+    Frame = m_ResolvedFrames.back();
+    return true;
+}
+
+std::string GPUProfiler::GetContextName(Uint32 ContextIndex) const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return ContextIndex < m_Contexts.size() ? m_Contexts[ContextIndex].Name : std::string{};
+}
+
+static void WriteJSONString(std::stringstream& ss, const std::string& Str)
+{
+    ss << '"';
+    for (auto c : Str)
+    {
+        switch (c)
+        {
+            case '"': ss << "\\\""; break;
+            case '\\': ss << "\\\\"; break;
+            case '\n': ss << "\\n"; break;
+            case '\r': ss << "\\r"; break;
+            case '\t': ss << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                else
+                    ss << c;
+        }
+    }
+    ss << '"';
+}
+
+std::string GPUProfiler::ExportChromeTrace() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"traceEvents\":[";
+
+    bool IsFirstEvent = true;
+    for (size_t i = 0; i < m_Contexts.size(); ++i)
+    {
+        ss << (IsFirstEvent ? "\n" : ",\n");
+        ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"args\":{\"name\":";
+        WriteJSONString(ss, m_Contexts[i].Name);
+        ss << "}}";
+        IsFirstEvent = false;
+    }
+
+    const double BaseTime = !m_ResolvedFrames.empty() ? m_ResolvedFrames.front().StartTime : 0;
+    for (const auto& Frame : m_ResolvedFrames)
+    {
+        for (const auto& Scope : Frame.Scopes)
+        {
+            // Timestamps are in microseconds
+            const auto StartTime = (Frame.StartTime - BaseTime + Scope.StartTime) * 1e+6;
+
+            ss << (IsFirstEvent ? "\n" : ",\n");
+            ss << "{\"name\":";
+            WriteJSONString(ss, Scope.Name);
+            ss << ",\"cat\":\"GPU\",\"ph\":\"X\",\"pid\":0,\"tid\":" << Scope.ContextIndex
+               << ",\"ts\":" << StartTime
+               << ",\"dur\":" << Scope.Duration * 1e+6
+               << ",\"args\":{\"frame\":" << Frame.FrameNumber << "}}";
+            IsFirstEvent = false;
+        }
+    }
+
+    ss << "\n]}\n";
+    return ss.str();
+}
+
+} // namespace Diligent
@@ -28,12 +28,15 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include "GraphicsUtilities.h"
 #include "DebugUtilities.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ColorConversion.h"
 #include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
 
 #define PI_F 3.1415926f
 
@@ -137,28 +140,44 @@ void GenerateCheckerBoardPattern(Uint32 Width, Uint32 Height, TEXTURE_FORMAT Fmt
 
 
 
-template <typename ChannelType>
-ChannelType SRGBAverage(ChannelType c0, ChannelType c1, ChannelType c2, ChannelType c3, Uint32 /*col*/, Uint32 /*row*/)
+// Look-up table for sRGB averaging.
+// Gamma-to-linear conversion of 8-bit values is tabulated, while the rest of the math is the
+// same as in the original per-channel implementation, so the results are bit-identical to it.
+class SRGBAverageLUT
 {
-    static_assert(std::numeric_limits<ChannelType>::is_integer && !std::numeric_limits<ChannelType>::is_signed, "Unsigned integers are expected");
+public:
+    static const SRGBAverageLUT& Get()
+    {
+        static const SRGBAverageLUT LUT;
+        return LUT;
+    }
 
-    static constexpr float MaxVal    = static_cast<float>(std::numeric_limits<ChannelType>::max());
-    static constexpr float MaxValInv = 1.f / MaxVal;
+    Uint8 Average(Uint8 c0, Uint8 c1, Uint8 c2, Uint8 c3) const
+    {
+        float fLinearAverage = (m_ToLinear[c0] + m_ToLinear[c1] + m_ToLinear[c2] + m_ToLinear[c3]) * 0.25f;
+        float fSRGBAverage   = FastLinearToGamma(fLinearAverage) * MaxVal;
 
-    float fc0 = static_cast<float>(c0) * MaxValInv;
-    float fc1 = static_cast<float>(c1) * MaxValInv;
-    float fc2 = static_cast<float>(c2) * MaxValInv;
-    float fc3 = static_cast<float>(c3) * MaxValInv;
+        // Clamping on both ends is essential because fast SRGB math is imprecise
+        fSRGBAverage = std::max(fSRGBAverage, 0.f);
+        fSRGBAverage = std::min(fSRGBAverage, MaxVal);
 
-    float fLinearAverage = (FastGammaToLinear(fc0) + FastGammaToLinear(fc1) + FastGammaToLinear(fc2) + FastGammaToLinear(fc3)) * 0.25f;
-    float fSRGBAverage   = FastLinearToGamma(fLinearAverage) * MaxVal;
+        return static_cast<Uint8>(fSRGBAverage);
+    }
 
-    // Clamping on both ends is essential because fast SRGB math is imprecise
-    fSRGBAverage = std::max(fSRGBAverage, 0.f);
-    fSRGBAverage = std::min(fSRGBAverage, MaxVal);
+private:
+    static constexpr float MaxVal    = static_cast<float>(std::numeric_limits<Uint8>::max());
+    static constexpr float MaxValInv = 1.f / MaxVal;
 
-    return static_cast<ChannelType>(fSRGBAverage);
-}
+    SRGBAverageLUT()
+    {
+        for (Uint32 i = 0; i < 256; ++i)
+        {
+            m_ToLinear[i] = FastGammaToLinear(static_cast<float>(i) * MaxValInv);
+        }
+    }
+
+    float m_ToLinear[256];
+};
 
 template <typename ChannelType>
 ChannelType LinearAverage(ChannelType c0, ChannelType c1, ChannelType c2, ChannelType c3, Uint32 /*col*/, Uint32 /*row*/);
@@ -288,53 +307,151 @@ ChannelType MostFrequentSelector(ChannelType c0, ChannelType c1, ChannelType c2,
 
 template <typename ChannelType,
           typename FilterType>
-void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
-                    Uint32                        NumChannels,
-                    FilterType                    Filter)
-{
-    VERIFY_EXPR(Attribs.FineMipWidth > 0 && Attribs.FineMipHeight > 0);
-    DEV_CHECK_ERR(Attribs.FineMipHeight == 1 || Attribs.FineMipStride >= Attribs.FineMipWidth * sizeof(ChannelType) * NumChannels, "Fine mip level stride is too small");
+void FilterMipRow(const ChannelType* pSrcRow0,
+                  const ChannelType* pSrcRow1,
+                  ChannelType*       pDstRow,
+                  Uint32             FineMipWidth,
+                  Uint32             StartCol,
+                  Uint32             EndCol,
+                  Uint32             NumChannels,
+                  Uint32             row,
+                  FilterType&&       Filter)
+{
+    for (Uint32 col = StartCol; col < EndCol; ++col)
+    {
+        auto src_col0 = col * 2;
+        auto src_col1 = std::min(col * 2 + 1, FineMipWidth - 1);
 
-    const auto CoarseMipWidth  = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
-    const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            const auto Chnl00 = pSrcRow0[src_col0 * NumChannels + c];
+            const auto Chnl10 = pSrcRow0[src_col1 * NumChannels + c];
+            const auto Chnl01 = pSrcRow1[src_col0 * NumChannels + c];
+            const auto Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
 
-    VERIFY(CoarseMipHeight == 1 || Attribs.CoarseMipStride >= CoarseMipWidth * sizeof(ChannelType) * NumChannels, "Coarse mip level stride is too small");
+            pDstRow[col * NumChannels + c] = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
+        }
+    }
+}
 
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+// Computes the box average of the 8-bit 4-channel texels.
+// Returns the number of processed coarse texels, which is a multiple of 4. The results are identical to LinearAverage<Uint8>.
+Uint32 BoxAverageRowRGBA8(const Uint8* pSrcRow0,
+                          const Uint8* pSrcRow1,
+                          Uint8*       pDstRow,
+                          Uint32       NumCols)
+{
+    // Only process the texels that have both source columns
+    const Uint32 NumSIMDCols = NumCols & ~3u;
+#if DILIGENT_SSE2_ENABLED
+    const __m128i Zero = _mm_setzero_si128();
+    for (Uint32 col = 0; col < NumSIMDCols; col += 4)
+    {
+        // Averages four fine texels (16 bytes) into two coarse texels (4 x 16-bit values each)
+        auto Average4Texels = [Zero](const Uint8* pRow0, const Uint8* pRow1) {
+            const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow0));
+            const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1));
+            // [t0, t1] and [t2, t3], vertically summed
+            const __m128i t01 = _mm_add_epi16(_mm_unpacklo_epi8(r0, Zero), _mm_unpacklo_epi8(r1, Zero));
+            const __m128i t23 = _mm_add_epi16(_mm_unpackhi_epi8(r0, Zero), _mm_unpackhi_epi8(r1, Zero));
+            // [t0 + t1, t2 + t3]
+            const __m128i Sum = _mm_add_epi16(_mm_unpacklo_epi64(t01, t23), _mm_unpackhi_epi64(t01, t23));
+            return _mm_srli_epi16(Sum, 2);
+        };
+        const __m128i Avg0 = Average4Texels(pSrcRow0 + col * 8, pSrcRow1 + col * 8);
+        const __m128i Avg1 = Average4Texels(pSrcRow0 + col * 8 + 16, pSrcRow1 + col * 8 + 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstRow + col * 4), _mm_packus_epi16(Avg0, Avg1));
+    }
+    return NumSIMDCols;
+#elif DILIGENT_NEON_ENABLED
+    for (Uint32 col = 0; col < NumSIMDCols; col += 4)
     {
-        auto src_row0 = row * 2;
-        auto src_row1 = std::min(row * 2 + 1, Attribs.FineMipHeight - 1);
+        auto Average4Texels = [](const Uint8* pRow0, const Uint8* pRow1) {
+            const uint8x16_t r0 = vld1q_u8(pRow0);
+            const uint8x16_t r1 = vld1q_u8(pRow1);
+            // [t0, t1] and [t2, t3], vertically summed
+            const uint16x8_t t01 = vaddl_u8(vget_low_u8(r0), vget_low_u8(r1));
+            const uint16x8_t t23 = vaddl_u8(vget_high_u8(r0), vget_high_u8(r1));
+            // [t0 + t1, t2 + t3]
+            const uint16x8_t Sum = vaddq_u16(vcombine_u16(vget_low_u16(t01), vget_low_u16(t23)),
+                                             vcombine_u16(vget_high_u16(t01), vget_high_u16(t23)));
+            return vshrn_n_u16(Sum, 2);
+        };
+        const uint8x8_t Avg0 = Average4Texels(pSrcRow0 + col * 8, pSrcRow1 + col * 8);
+        const uint8x8_t Avg1 = Average4Texels(pSrcRow0 + col * 8 + 16, pSrcRow1 + col * 8 + 16);
+        vst1q_u8(pDstRow + col * 4, vcombine_u8(Avg0, Avg1));
+    }
+    return NumSIMDCols;
+#else
+    (void)pSrcRow0;
+    (void)pSrcRow1;
+    (void)pDstRow;
+    return 0;
+#endif
+}
 
-        auto pSrcRow0 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row0 * Attribs.FineMipStride);
-        auto pSrcRow1 = reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(Attribs.pFineMipData) + src_row1 * Attribs.FineMipStride);
+template <typename ChannelType>
+const ChannelType* GetMipRow(const void* pData, size_t Stride, Uint32 row)
+{
+    return reinterpret_cast<const ChannelType*>(reinterpret_cast<const Uint8*>(pData) + row * Stride);
+}
 
-        for (Uint32 col = 0; col < CoarseMipWidth; ++col)
-        {
-            auto src_col0 = col * 2;
-            auto src_col1 = std::min(col * 2 + 1, Attribs.FineMipWidth - 1);
+template <typename ChannelType>
+ChannelType* GetMipRow(void* pData, size_t Stride, Uint32 row)
+{
+    return reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(pData) + row * Stride);
+}
 
-            for (Uint32 c = 0; c < NumChannels; ++c)
-            {
-                const auto Chnl00 = pSrcRow0[src_col0 * NumChannels + c];
-                const auto Chnl10 = pSrcRow0[src_col1 * NumChannels + c];
-                const auto Chnl01 = pSrcRow1[src_col0 * NumChannels + c];
-                const auto Chnl11 = pSrcRow1[src_col1 * NumChannels + c];
+// Filters the coarse mip rows in the range [StartRow, EndRow)
+template <typename ChannelType,
+          typename FilterType>
+void FilterMipLevel(const ComputeMipLevelAttribs& Attribs,
+                    Uint32                        NumChannels,
+                    Uint32                        StartRow,
+                    Uint32                        EndRow,
+                    FilterType&&                  Filter)
+{
+    const auto CoarseMipWidth = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+    for (Uint32 row = StartRow; row < EndRow; ++row)
+    {
+        const auto src_row0 = row * 2;
+        const auto src_row1 = std::min(row * 2 + 1, Attribs.FineMipHeight - 1);
 
-                auto& DstCol = reinterpret_cast<ChannelType*>(reinterpret_cast<Uint8*>(Attribs.pCoarseMipData) + row * Attribs.CoarseMipStride)[col * NumChannels + c];
+        FilterMipRow(GetMipRow<ChannelType>(Attribs.pFineMipData, Attribs.FineMipStride, src_row0),
+                     GetMipRow<ChannelType>(Attribs.pFineMipData, Attribs.FineMipStride, src_row1),
+                     GetMipRow<ChannelType>(Attribs.pCoarseMipData, Attribs.CoarseMipStride, row),
+                     Attribs.FineMipWidth, 0, CoarseMipWidth, NumChannels, row, Filter);
+    }
+}
 
-                DstCol = Filter(Chnl00, Chnl10, Chnl01, Chnl11, col, row);
-            }
-        }
+void BoxAverageMipLevelRGBA8(const ComputeMipLevelAttribs& Attribs,
+                             Uint32                        StartRow,
+                             Uint32                        EndRow)
+{
+    const auto CoarseMipWidth = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+    for (Uint32 row = StartRow; row < EndRow; ++row)
+    {
+        const auto src_row0 = row * 2;
+        const auto src_row1 = std::min(row * 2 + 1, Attribs.FineMipHeight - 1);
+
+        const auto* pSrcRow0 = GetMipRow<Uint8>(Attribs.pFineMipData, Attribs.FineMipStride, src_row0);
+        const auto* pSrcRow1 = GetMipRow<Uint8>(Attribs.pFineMipData, Attribs.FineMipStride, src_row1);
+        auto*       pDstRow  = GetMipRow<Uint8>(Attribs.pCoarseMipData, Attribs.CoarseMipStride, row);
+
+        // Only the coarse texels that have both source columns are processed by the SIMD kernel
+        const Uint32 NumSIMDCols = BoxAverageRowRGBA8(pSrcRow0, pSrcRow1, pDstRow, Attribs.FineMipWidth / 2);
+        FilterMipRow(pSrcRow0, pSrcRow1, pDstRow, Attribs.FineMipWidth, NumSIMDCols, CoarseMipWidth, 4, row, LinearAverage<Uint8>);
     }
 }
 
 void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
                 Uint32                        NumChannels,
-                Uint32                        AlphaChannelInd)
+                Uint32                        AlphaChannelInd,
+                Uint32                        StartRow,
+                Uint32                        EndRow)
 {
-    const auto CoarseMipWidth  = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
-    const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
-    for (Uint32 row = 0; row < CoarseMipHeight; ++row)
+    const auto CoarseMipWidth = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+    for (Uint32 row = StartRow; row < EndRow; ++row)
     {
         for (Uint32 col = 0; col < CoarseMipWidth; ++col)
         {
@@ -355,7 +472,9 @@ void RemapAlpha(const ComputeMipLevelAttribs& Attribs,
 
 template <typename ChannelType>
 void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
-                             const TextureFormatAttribs&   FmtAttribs)
+                             const TextureFormatAttribs&   FmtAttribs,
+                             Uint32                        StartRow,
+                             Uint32                        EndRow)
 {
     auto FilterType = Attribs.FilterType;
     if (FilterType == MIP_FILTER_TYPE_DEFAULT)
@@ -365,37 +484,43 @@ void ComputeMipLevelInternal(const ComputeMipLevelAttribs& Attribs,
             MIP_FILTER_TYPE_BOX_AVERAGE;
     }
 
-    FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents,
-                                FilterType == MIP_FILTER_TYPE_BOX_AVERAGE ?
-                                    LinearAverage<ChannelType> :
-                                    MostFrequentSelector<ChannelType>);
+    if (FilterType == MIP_FILTER_TYPE_BOX_AVERAGE)
+    {
+        if (std::is_same<ChannelType, Uint8>::value && FmtAttribs.NumComponents == 4)
+            BoxAverageMipLevelRGBA8(Attribs, StartRow, EndRow);
+        else
+            FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, StartRow, EndRow, LinearAverage<ChannelType>);
+    }
+    else
+    {
+        FilterMipLevel<ChannelType>(Attribs, FmtAttribs.NumComponents, StartRow, EndRow, MostFrequentSelector<ChannelType>);
+    }
 }
 
-void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
+void ComputeMipLevelRows(const ComputeMipLevelAttribs& Attribs,
+                         const TextureFormatAttribs&   FmtAttribs,
+                         Uint32                        StartRow,
+                         Uint32                        EndRow)
 {
-    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
-    DEV_CHECK_ERR(Attribs.FineMipWidth != 0, "Fine mip width must not be zero");
-    DEV_CHECK_ERR(Attribs.FineMipHeight != 0, "Fine mip height must not be zero");
-    DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
-    DEV_CHECK_ERR(Attribs.pCoarseMipData != nullptr, "Coarse level data must not be null");
-
-    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
-
-    VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
-    VERIFY(Attribs.AlphaCutoff == 0 || FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1,
-           "Alpha remapping is only supported for 4-channel 8-bit textures");
-
     switch (FmtAttribs.ComponentType)
     {
         case COMPONENT_TYPE_UNORM_SRGB:
             VERIFY(FmtAttribs.ComponentSize == 1, "Only 8-bit sRGB formats are expected");
-            FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents,
-                                  Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT ?
-                                      MostFrequentSelector<Uint8> :
-                                      SRGBAverage<Uint8>);
+            if (Attribs.FilterType == MIP_FILTER_TYPE_MOST_FREQUENT)
+            {
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, StartRow, EndRow, MostFrequentSelector<Uint8>);
+            }
+            else
+            {
+                const auto& LUT = SRGBAverageLUT::Get();
+                FilterMipLevel<Uint8>(Attribs, FmtAttribs.NumComponents, StartRow, EndRow,
+                                      [&LUT](Uint8 c0, Uint8 c1, Uint8 c2, Uint8 c3, Uint32 /*col*/, Uint32 /*row*/) {
+                                          return LUT.Average(c0, c1, c2, c3);
+                                      });
+            }
             if (Attribs.AlphaCutoff > 0)
             {
-                RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
+                RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1, StartRow, EndRow);
             }
             break;
 
@@ -404,19 +529,19 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Uint8>(Attribs, FmtAttribs, StartRow, EndRow);
                     if (Attribs.AlphaCutoff > 0)
                     {
-                        RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1);
+                        RemapAlpha(Attribs, FmtAttribs.NumComponents, FmtAttribs.NumComponents - 1, StartRow, EndRow);
                     }
                     break;
 
                 case 2:
-                    ComputeMipLevelInternal<Uint16>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Uint16>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 4:
-                    ComputeMipLevelInternal<Uint32>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Uint32>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 default:
@@ -429,15 +554,15 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
             switch (FmtAttribs.ComponentSize)
             {
                 case 1:
-                    ComputeMipLevelInternal<Int8>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int8>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 2:
-                    ComputeMipLevelInternal<Int16>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int16>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 case 4:
-                    ComputeMipLevelInternal<Int32>(Attribs, FmtAttribs);
+                    ComputeMipLevelInternal<Int32>(Attribs, FmtAttribs, StartRow, EndRow);
                     break;
 
                 default:
@@ -447,7 +572,7 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
 
         case COMPONENT_TYPE_FLOAT:
             VERIFY(FmtAttribs.ComponentSize == 4, "Only 32-bit float formats are currently supported");
-            ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs);
+            ComputeMipLevelInternal<Float32>(Attribs, FmtAttribs, StartRow, EndRow);
             break;
 
         default:
@@ -455,6 +580,45 @@ void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
     }
 }
 
+void ComputeMipLevel(const ComputeMipLevelAttribs& Attribs)
+{
+    DEV_CHECK_ERR(Attribs.Format != TEX_FORMAT_UNKNOWN, "Format must not be unknown");
+    DEV_CHECK_ERR(Attribs.FineMipWidth != 0, "Fine mip width must not be zero");
+    DEV_CHECK_ERR(Attribs.FineMipHeight != 0, "Fine mip height must not be zero");
+    DEV_CHECK_ERR(Attribs.pFineMipData != nullptr, "Fine level data must not be null");
+    DEV_CHECK_ERR(Attribs.pCoarseMipData != nullptr, "Coarse level data must not be null");
+
+    const auto& FmtAttribs = GetTextureFormatAttribs(Attribs.Format);
+
+    VERIFY_EXPR(Attribs.AlphaCutoff >= 0 && Attribs.AlphaCutoff <= 1);
+    VERIFY(Attribs.AlphaCutoff == 0 || FmtAttribs.NumComponents == 4 && FmtAttribs.ComponentSize == 1,
+           "Alpha remapping is only supported for 4-channel 8-bit textures");
+
+    const auto CoarseMipWidth  = std::max(Attribs.FineMipWidth / Uint32{2}, Uint32{1});
+    const auto CoarseMipHeight = std::max(Attribs.FineMipHeight / Uint32{2}, Uint32{1});
+
+    DEV_CHECK_ERR(Attribs.FineMipHeight == 1 || Attribs.FineMipStride >= size_t{Attribs.FineMipWidth} * FmtAttribs.GetElementSize(), "Fine mip level stride is too small");
+    DEV_CHECK_ERR(CoarseMipHeight == 1 || Attribs.CoarseMipStride >= size_t{CoarseMipWidth} * FmtAttribs.GetElementSize(), "Coarse mip level stride is too small");
+
+    // The number of coarse texels processed by one task. Smaller levels are processed by the calling thread.
+    constexpr Uint32 MinTexelsPerTask = 64 << 10;
+
+    const Uint32 RowsPerTask = std::max(MinTexelsPerTask / CoarseMipWidth, 1u);
+    if (Attribs.pThreadPool != nullptr && CoarseMipHeight > RowsPerTask)
+    {
+        const Uint32 NumTasks = (CoarseMipHeight + RowsPerTask - 1) / RowsPerTask;
+        ParallelFor(Attribs.pThreadPool, 0, NumTasks, 1,
+                    [&](Uint32 Task) {
+                        const Uint32 StartRow = Task * RowsPerTask;
+                        ComputeMipLevelRows(Attribs, FmtAttribs, StartRow, std::min(StartRow + RowsPerTask, CoarseMipHeight));
+                    });
+    }
+    else
+    {
+        ComputeMipLevelRows(Attribs, FmtAttribs, 0, CoarseMipHeight);
+    }
+}
+
 #if !METAL_SUPPORTED
 void CreateSparseTextureMtl(IRenderDevice*     pDevice,
                             const TextureDesc& TexDesc,
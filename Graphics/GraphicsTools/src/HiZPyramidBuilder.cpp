@@ -0,0 +1,277 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HiZPyramidBuilder.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "BasicMath.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char HiZPyramidCSSource[] =
+    {
+#include "HiZPyramidCS_inc.h"
+};
+
+// Every thread group writes a 16x16 tile of the first output level, see HiZPyramidCS.hlsl
+constexpr Uint32 TileSize = 16;
+
+// Mirrors cbHiZPyramidAttribs in HiZPyramidCS.hlsl
+struct HiZPyramidAttribs
+{
+    uint2  SrcSize;
+    uint2  DstSize;
+    Uint32 NumLevels;
+    Uint32 Padding0;
+    Uint32 Padding1;
+    Uint32 Padding2;
+};
+static_assert(sizeof(HiZPyramidAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+constexpr const char* OutLevelNames[] = {"g_OutLevel0", "g_OutLevel1", "g_OutLevel2", "g_OutLevel3"};
+static_assert(_countof(OutLevelNames) == HiZPyramidBuilder::MaxLevelsPerDispatch, "Output level names do not match the number of levels per dispatch");
+
+// The largest power of two that does not exceed the value
+Uint32 FloorPow2(Uint32 Value)
+{
+    return Uint32{1} << PlatformMisc::GetMSB(std::max(Value, 1u));
+}
+
+} // namespace
+
+HiZPyramidBuilder::HiZPyramidBuilder(IRenderDevice* pDevice, ReductionMode Mode) :
+    m_pDevice{pDevice},
+    m_Mode{Mode}
+{
+    DEV_CHECK_ERR(IsSupported(pDevice), "Hi-Z pyramid builder is not supported by this device");
+    CreateUniformBuffer(pDevice, sizeof(HiZPyramidAttribs), "Hi-Z pyramid attribs", &m_pConstants);
+}
+
+HiZPyramidBuilder::~HiZPyramidBuilder()
+{
+}
+
+bool HiZPyramidBuilder::IsSupported(IRenderDevice* pDevice)
+{
+    return pDevice != nullptr && pDevice->GetDeviceInfo().Features.ComputeShaders;
+}
+
+bool HiZPyramidBuilder::CreatePipeline(bool SourceIsDepth, PipelineInfo& Pipeline)
+{
+    ShaderMacroHelper Macros;
+    Macros.Add("REDUCTION_MODE", static_cast<int>(m_Mode));
+    Macros.Add("SOURCE_IS_DEPTH", SourceIsDepth ? 1 : 0);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc           = {"Hi-Z pyramid CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = HiZPyramidCSSource;
+    ShaderCI.SourceLength   = sizeof(HiZPyramidCSSource) - 1;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    m_pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Hi-Z pyramid shader");
+        return false;
+    }
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = SourceIsDepth ? "Hi-Z pyramid from depth PSO" : "Hi-Z pyramid level PSO";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    // Source and output levels change between dispatches
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbHiZPyramidAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables    = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = _countof(Vars);
+
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Hi-Z pyramid PSO");
+        return false;
+    }
+    Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbHiZPyramidAttribs")->Set(m_pConstants);
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return true;
+}
+
+bool HiZPyramidBuilder::CreatePyramid(Uint32 DepthWidth, Uint32 DepthHeight)
+{
+    if (m_pPyramid && m_DepthWidth == DepthWidth && m_DepthHeight == DepthHeight)
+        return true;
+
+    m_pPyramid.Release();
+    m_MipSRVs.clear();
+    m_MipUAVs.clear();
+    m_DepthWidth  = 0;
+    m_DepthHeight = 0;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Hi-Z pyramid";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = FloorPow2(DepthWidth);
+    TexDesc.Height    = FloorPow2(DepthHeight);
+    TexDesc.MipLevels = ComputeMipLevelsCount(TexDesc.Width, TexDesc.Height);
+    TexDesc.Format    = m_Mode == ReductionMode::MinMax ? TEX_FORMAT_RG32_FLOAT : TEX_FORMAT_R32_FLOAT;
+    TexDesc.Usage     = USAGE_DEFAULT;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+
+    m_pDevice->CreateTexture(TexDesc, nullptr, &m_pPyramid);
+    if (!m_pPyramid)
+    {
+        LOG_ERROR_MESSAGE("Failed to create Hi-Z pyramid texture");
+        return false;
+    }
+
+    m_MipSRVs.resize(TexDesc.MipLevels);
+    m_MipUAVs.resize(TexDesc.MipLevels);
+    for (Uint32 Mip = 0; Mip < TexDesc.MipLevels; ++Mip)
+    {
+        TextureViewDesc ViewDesc{"Hi-Z pyramid mip SRV", TEXTURE_VIEW_SHADER_RESOURCE, RESOURCE_DIM_TEX_2D, TexDesc.Format, Mip, 1};
+        m_pPyramid->CreateView(ViewDesc, &m_MipSRVs[Mip]);
+
+        ViewDesc.Name     = "Hi-Z pyramid mip UAV";
+        ViewDesc.ViewType = TEXTURE_VIEW_UNORDERED_ACCESS;
+        m_pPyramid->CreateView(ViewDesc, &m_MipUAVs[Mip]);
+
+        if (!m_MipSRVs[Mip] || !m_MipUAVs[Mip])
+        {
+            LOG_ERROR_MESSAGE("Failed to create views of Hi-Z pyramid mip level ", Mip);
+            m_pPyramid.Release();
+            return false;
+        }
+    }
+
+    m_DepthWidth  = DepthWidth;
+    m_DepthHeight = DepthHeight;
+    return true;
+}
+
+void HiZPyramidBuilder::Build(IDeviceContext* pContext, const BuildAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.pDepthSRV != nullptr, "Depth buffer view must not be null");
+    if (Attribs.pDepthSRV == nullptr)
+        return;
+
+    const TextureViewDesc& DepthViewDesc = Attribs.pDepthSRV->GetDesc();
+    const TextureDesc&     DepthDesc     = Attribs.pDepthSRV->GetTexture()->GetDesc();
+    DEV_CHECK_ERR(DepthViewDesc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE, "Depth buffer view must be a shader resource view");
+    DEV_CHECK_ERR(DepthViewDesc.TextureDim == RESOURCE_DIM_TEX_2D, "Depth buffer view must be a 2D texture view");
+    DEV_CHECK_ERR(DepthDesc.SampleCount == 1, "Multisampled depth buffers are not supported");
+
+    const MipLevelProperties DepthMipProps = GetMipLevelProperties(DepthDesc, DepthViewDesc.MostDetailedMip);
+    if (!CreatePyramid(DepthMipProps.LogicalWidth, DepthMipProps.LogicalHeight))
+        return;
+
+    if ((!m_DepthPipeline.pPSO && !CreatePipeline(true, m_DepthPipeline)) ||
+        (!m_LevelPipeline.pPSO && !CreatePipeline(false, m_LevelPipeline)))
+        return;
+
+    const TextureDesc& PyramidDesc = m_pPyramid->GetDesc();
+    const Uint32       NumMips     = PyramidDesc.MipLevels;
+
+    // Individual mip levels are transitioned below without updating the texture state,
+    // so the whole texture starts in the unordered access state.
+    StateTransitionDesc InitBarrier{m_pPyramid, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_UNORDERED_ACCESS, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &InitBarrier);
+
+    for (Uint32 FirstMip = 0; FirstMip < NumMips; FirstMip += MaxLevelsPerDispatch)
+    {
+        const Uint32 NumLevels = std::min(NumMips - FirstMip, MaxLevelsPerDispatch);
+        const bool   FromDepth = FirstMip == 0;
+
+        const MipLevelProperties DstMipProps = GetMipLevelProperties(PyramidDesc, FirstMip);
+        uint2                    SrcSize{DepthMipProps.LogicalWidth, DepthMipProps.LogicalHeight};
+        if (!FromDepth)
+        {
+            const MipLevelProperties SrcMipProps = GetMipLevelProperties(PyramidDesc, FirstMip - 1);
+            SrcSize                              = uint2{SrcMipProps.LogicalWidth, SrcMipProps.LogicalHeight};
+
+            // The last level written by the previous dispatch is the source of this one
+            StateTransitionDesc SrcBarrier{m_pPyramid, RESOURCE_STATE_UNORDERED_ACCESS, RESOURCE_STATE_SHADER_RESOURCE, FirstMip - 1, 1, 0, REMAINING_ARRAY_SLICES};
+            pContext->TransitionResourceStates(1, &SrcBarrier);
+        }
+
+        {
+            MapHelper<HiZPyramidAttribs> CBAttribs{pContext, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            CBAttribs->SrcSize   = SrcSize;
+            CBAttribs->DstSize   = uint2{DstMipProps.LogicalWidth, DstMipProps.LogicalHeight};
+            CBAttribs->NumLevels = NumLevels;
+        }
+
+        PipelineInfo& Pipeline = FromDepth ? m_DepthPipeline : m_LevelPipeline;
+        Pipeline.pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Source")->Set(FromDepth ? Attribs.pDepthSRV : m_MipSRVs[FirstMip - 1].RawPtr());
+        for (Uint32 Level = 0; Level < MaxLevelsPerDispatch; ++Level)
+        {
+            // Unused outputs are never written, but must still be bound to valid views
+            const Uint32 Mip = FirstMip + std::min(Level, NumLevels - 1);
+            Pipeline.pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, OutLevelNames[Level])->Set(m_MipUAVs[Mip]);
+        }
+
+        pContext->SetPipelineState(Pipeline.pPSO);
+        // The first dispatch transitions the depth buffer. The pyramid mip levels are transitioned manually.
+        pContext->CommitShaderResources(Pipeline.pSRB, FromDepth ? RESOURCE_STATE_TRANSITION_MODE_TRANSITION : RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+        DispatchComputeAttribs DispatchAttribs;
+        DispatchAttribs.ThreadGroupCountX = (DstMipProps.LogicalWidth + TileSize - 1) / TileSize;
+        DispatchAttribs.ThreadGroupCountY = (DstMipProps.LogicalHeight + TileSize - 1) / TileSize;
+        pContext->DispatchCompute(DispatchAttribs);
+    }
+
+    // Transition the levels that were not used as a source of another dispatch
+    std::vector<StateTransitionDesc> Barriers;
+    for (Uint32 Mip = 0; Mip < NumMips; ++Mip)
+    {
+        const bool IsSource = (Mip + 1) % MaxLevelsPerDispatch == 0 && Mip + 1 < NumMips;
+        if (!IsSource)
+            Barriers.emplace_back(m_pPyramid, RESOURCE_STATE_UNORDERED_ACCESS, RESOURCE_STATE_SHADER_RESOURCE, Mip, 1, 0, REMAINING_ARRAY_SLICES);
+    }
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+    m_pPyramid->SetState(RESOURCE_STATE_SHADER_RESOURCE);
+}
+
+} // namespace Diligent
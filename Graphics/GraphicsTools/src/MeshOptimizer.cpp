@@ -0,0 +1,712 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Intrinsics.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+float3 ReadPosition(const void* pPositions, size_t Stride, Uint32 Vertex)
+{
+    const float* pPos = reinterpret_cast<const float*>(static_cast<const Uint8*>(pPositions) + Vertex * Stride);
+    return float3{pPos[0], pPos[1], pPos[2]};
+}
+
+// Vertex-triangle adjacency in compressed row format
+template <typename IndexType>
+struct TriangleAdjacency
+{
+    std::vector<Uint32> Offsets;
+    std::vector<Uint32> Triangles;
+    std::vector<Uint32> Counts;
+
+    TriangleAdjacency(const IndexType* pIndices, size_t NumIndices, size_t NumVertices) :
+        Offsets(NumVertices + 1),
+        Triangles(NumIndices),
+        Counts(NumVertices)
+    {
+        for (size_t i = 0; i < NumIndices; ++i)
+            ++Counts[pIndices[i]];
+
+        for (size_t v = 0; v < NumVertices; ++v)
+            Offsets[v + 1] = Offsets[v] + Counts[v];
+
+        std::vector<Uint32> Fill{Offsets.begin(), Offsets.end() - 1};
+        for (size_t i = 0; i < NumIndices; ++i)
+            Triangles[Fill[pIndices[i]]++] = static_cast<Uint32>(i / 3);
+    }
+};
+
+// FIFO cache model. A vertex is in the cache if it was added within the last CacheSize misses.
+class FIFOCacheModel
+{
+public:
+    FIFOCacheModel(size_t NumVertices, Uint32 CacheSize) :
+        m_Timestamps(NumVertices, 0),
+        m_CacheSize{CacheSize},
+        m_Time{CacheSize + 1}
+    {}
+
+    // Returns the number of cache misses for the triangle
+    template <typename IndexType>
+    Uint32 ProcessTriangle(const IndexType* pTri)
+    {
+        Uint32 Misses = 0;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            Uint32& Timestamp = m_Timestamps[pTri[c]];
+            if (m_Time - Timestamp > m_CacheSize)
+            {
+                Timestamp = m_Time++;
+                ++Misses;
+            }
+        }
+        return Misses;
+    }
+
+    void Flush()
+    {
+        m_Time += m_CacheSize + 1;
+    }
+
+private:
+    std::vector<Uint32> m_Timestamps;
+    const Uint32        m_CacheSize;
+    Uint32              m_Time;
+};
+
+// Forsyth vertex cache optimization, see https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+constexpr Uint32 ForsythCacheSize  = 32;
+constexpr Uint32 ForsythMaxValence = 32;
+
+struct ForsythScoreTables
+{
+    float CachePosition[ForsythCacheSize];
+    float Valence[ForsythMaxValence + 1];
+
+    ForsythScoreTables()
+    {
+        constexpr float CacheDecayPower   = 1.5f;
+        constexpr float LastTriScore      = 0.75f;
+        constexpr float ValenceBoostScale = 2.0f;
+        constexpr float ValenceBoostPower = 0.5f;
+
+        for (Uint32 i = 0; i < ForsythCacheSize; ++i)
+        {
+            // The vertices of the last triangle get a fixed score, so that the algorithm
+            // does not prefer any particular winding of the next triangle.
+            CachePosition[i] = i < 3 ?
+                LastTriScore :
+                std::pow(1.f - static_cast<float>(i - 3) / static_cast<float>(ForsythCacheSize - 3), CacheDecayPower);
+        }
+
+        // Vertices with few remaining triangles are boosted to avoid leaving lone triangles behind
+        Valence[0] = 0;
+        for (Uint32 i = 1; i <= ForsythMaxValence; ++i)
+            Valence[i] = ValenceBoostScale * std::pow(static_cast<float>(i), -ValenceBoostPower);
+    }
+
+    float GetVertexScore(Int32 CachePos, Uint32 NumLiveTris) const
+    {
+        if (NumLiveTris == 0)
+            return -1;
+
+        const float Score = CachePos >= 0 ? CachePosition[CachePos] : 0.f;
+        return Score + Valence[std::min(NumLiveTris, ForsythMaxValence)];
+    }
+};
+
+} // namespace
+
+template <typename IndexType>
+void OptimizeVertexCache(IndexType* pDstIndices, const IndexType* pIndices, size_t NumIndices, size_t NumVertices)
+{
+    DEV_CHECK_ERR(NumIndices % 3 == 0, "The number of indices (", NumIndices, ") must be a multiple of 3");
+    DEV_CHECK_ERR(std::all_of(pIndices, pIndices + NumIndices, [NumVertices](IndexType Idx) { return Idx < NumVertices; }),
+                  "All indices must be less than the number of vertices (", NumVertices, ")");
+
+    const size_t NumTris = NumIndices / 3;
+    if (NumTris == 0)
+        return;
+
+    static const ForsythScoreTables ScoreTables;
+
+    // The destination may alias the source
+    const std::vector<IndexType> Src{pIndices, pIndices + NumIndices};
+
+    // Counts are the numbers of triangles that have not been emitted yet. The live triangles
+    // of every vertex are kept at the beginning of its adjacency range.
+    TriangleAdjacency<IndexType> Adjacency{Src.data(), NumIndices, NumVertices};
+
+    std::vector<Int32> CachePos(NumVertices, -1);
+    std::vector<float> VertexScores(NumVertices);
+    for (size_t v = 0; v < NumVertices; ++v)
+        VertexScores[v] = ScoreTables.GetVertexScore(-1, Adjacency.Counts[v]);
+
+    std::vector<float> TriScores(NumTris);
+    std::vector<bool>  Emitted(NumTris, false);
+    Uint32             BestTri = 0;
+    for (size_t t = 0; t < NumTris; ++t)
+    {
+        TriScores[t] = VertexScores[Src[t * 3 + 0]] + VertexScores[Src[t * 3 + 1]] + VertexScores[Src[t * 3 + 2]];
+        if (TriScores[t] > TriScores[BestTri])
+            BestTri = static_cast<Uint32>(t);
+    }
+
+    std::vector<Uint32> Cache, NewCache;
+    Cache.reserve(ForsythCacheSize + 3);
+    NewCache.reserve(ForsythCacheSize + 3);
+
+    size_t NextTri  = 0;
+    size_t OutIndex = 0;
+    while (true)
+    {
+        if (BestTri == InvalidIndex)
+        {
+            // No candidates in the cache: continue with the first remaining triangle
+            while (NextTri < NumTris && Emitted[NextTri])
+                ++NextTri;
+            if (NextTri == NumTris)
+                break;
+            BestTri = static_cast<Uint32>(NextTri);
+        }
+
+        Emitted[BestTri] = true;
+        NewCache.clear();
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 v = Src[BestTri * 3 + c];
+
+            pDstIndices[OutIndex++] = static_cast<IndexType>(v);
+
+            // Remove the triangle from the live triangles of the vertex
+            Uint32* const pLiveTris = &Adjacency.Triangles[Adjacency.Offsets[v]];
+            Uint32&       NumLive   = Adjacency.Counts[v];
+            Uint32* const pTri      = std::find(pLiveTris, pLiveTris + NumLive, BestTri);
+            VERIFY_EXPR(pTri != pLiveTris + NumLive);
+            std::swap(*pTri, pLiveTris[NumLive - 1]);
+            --NumLive;
+
+            if (std::find(NewCache.begin(), NewCache.end(), v) == NewCache.end())
+                NewCache.push_back(v);
+        }
+
+        for (Uint32 v : Cache)
+        {
+            if (std::find(NewCache.begin(), NewCache.end(), v) == NewCache.end())
+                NewCache.push_back(v);
+        }
+
+        // Update the scores of all vertices that were in the cache, including the evicted ones,
+        // and find the best triangle among the triangles of the cached vertices.
+        BestTri             = InvalidIndex;
+        float BestTriScore  = -1;
+        for (size_t i = 0; i < NewCache.size(); ++i)
+        {
+            const Uint32 v = NewCache[i];
+
+            CachePos[v] = i < ForsythCacheSize ? static_cast<Int32>(i) : -1;
+
+            const float Score = ScoreTables.GetVertexScore(CachePos[v], Adjacency.Counts[v]);
+            const float Delta = Score - VertexScores[v];
+            VertexScores[v]   = Score;
+
+            const Uint32* pLiveTris = &Adjacency.Triangles[Adjacency.Offsets[v]];
+            for (Uint32 j = 0; j < Adjacency.Counts[v]; ++j)
+            {
+                const Uint32 t = pLiveTris[j];
+                TriScores[t] += Delta;
+                if (CachePos[v] >= 0 && TriScores[t] > BestTriScore)
+                {
+                    BestTri      = t;
+                    BestTriScore = TriScores[t];
+                }
+            }
+        }
+
+        if (NewCache.size() > ForsythCacheSize)
+            NewCache.resize(ForsythCacheSize);
+        std::swap(Cache, NewCache);
+    }
+    VERIFY_EXPR(OutIndex == NumIndices);
+}
+
+template <typename IndexType>
+void OptimizeOverdraw(IndexType*       pDstIndices,
+                      const IndexType* pIndices,
+                      size_t           NumIndices,
+                      const void*      pPositions,
+                      size_t           PositionStride,
+                      size_t           NumVertices,
+                      float            Threshold)
+{
+    DEV_CHECK_ERR(NumIndices % 3 == 0, "The number of indices (", NumIndices, ") must be a multiple of 3");
+    DEV_CHECK_ERR(pPositions != nullptr, "Position data must not be null");
+    DEV_CHECK_ERR(PositionStride >= sizeof(float3), "Position stride (", PositionStride, ") must be at least ", sizeof(float3), " bytes");
+
+    const size_t NumTris = NumIndices / 3;
+    if (NumTris == 0)
+        return;
+
+    constexpr Uint32 CacheSize = 16;
+
+    const std::vector<IndexType> Src{pIndices, pIndices + NumIndices};
+
+    // Hard boundaries are the triangles that miss the cache on all vertices: the cache is
+    // effectively flushed there, so the clusters can be reordered at no cost.
+    std::vector<Uint32> HardClusters;
+    {
+        FIFOCacheModel Cache{NumVertices, CacheSize};
+        for (size_t t = 0; t < NumTris; ++t)
+        {
+            if (Cache.ProcessTriangle(&Src[t * 3]) == 3)
+                HardClusters.push_back(static_cast<Uint32>(t));
+        }
+    }
+    HardClusters.push_back(static_cast<Uint32>(NumTris));
+
+    // Soft boundaries split the hard clusters further as long as the cache efficiency
+    // of every part stays within the threshold of the whole cluster.
+    std::vector<Uint32> Clusters;
+    {
+        FIFOCacheModel Cache{NumVertices, CacheSize};
+        for (size_t c = 0; c + 1 < HardClusters.size(); ++c)
+        {
+            const Uint32 Start = HardClusters[c];
+            const Uint32 End   = HardClusters[c + 1];
+
+            Cache.Flush();
+            Uint32 ClusterMisses = 0;
+            for (Uint32 t = Start; t < End; ++t)
+                ClusterMisses += Cache.ProcessTriangle(&Src[t * 3]);
+            const float TargetACMR = static_cast<float>(ClusterMisses) / static_cast<float>(End - Start) * Threshold;
+
+            Cache.Flush();
+            Clusters.push_back(Start);
+            Uint32 PartStart  = Start;
+            Uint32 PartMisses = 0;
+            for (Uint32 t = Start; t < End; ++t)
+            {
+                PartMisses += Cache.ProcessTriangle(&Src[t * 3]);
+                if (t + 1 < End && static_cast<float>(PartMisses) <= TargetACMR * static_cast<float>(t + 1 - PartStart))
+                {
+                    Clusters.push_back(t + 1);
+                    PartStart  = t + 1;
+                    PartMisses = 0;
+                    Cache.Flush();
+                }
+            }
+        }
+    }
+    const size_t NumClusters = Clusters.size();
+    Clusters.push_back(static_cast<Uint32>(NumTris));
+
+    // Area-weighted cluster centroids and normals
+    std::vector<float3> ClusterCentroids(NumClusters);
+    std::vector<float3> ClusterNormals(NumClusters);
+    float3              MeshCentroid;
+    float               MeshArea = 0;
+    for (size_t c = 0; c < NumClusters; ++c)
+    {
+        float ClusterArea = 0;
+        for (Uint32 t = Clusters[c]; t < Clusters[c + 1]; ++t)
+        {
+            const float3 p0 = ReadPosition(pPositions, PositionStride, Src[t * 3 + 0]);
+            const float3 p1 = ReadPosition(pPositions, PositionStride, Src[t * 3 + 1]);
+            const float3 p2 = ReadPosition(pPositions, PositionStride, Src[t * 3 + 2]);
+
+            const float3 Normal = cross(p1 - p0, p2 - p0);
+            const float  Area   = length(Normal);
+
+            ClusterCentroids[c] += (p0 + p1 + p2) * (Area / 3.f);
+            ClusterNormals[c] += Normal;
+            ClusterArea += Area;
+        }
+
+        MeshCentroid += ClusterCentroids[c];
+        MeshArea += ClusterArea;
+        if (ClusterArea > 0)
+            ClusterCentroids[c] /= ClusterArea;
+    }
+    if (MeshArea > 0)
+        MeshCentroid /= MeshArea;
+
+    // Clusters that face away from the mesh center are more likely to occlude the others
+    std::vector<float> SortKeys(NumClusters);
+    for (size_t c = 0; c < NumClusters; ++c)
+    {
+        const float NormalLen = length(ClusterNormals[c]);
+        SortKeys[c]           = NormalLen > 0 ? dot(ClusterCentroids[c] - MeshCentroid, ClusterNormals[c] / NormalLen) : 0.f;
+    }
+
+    std::vector<Uint32> ClusterOrder(NumClusters);
+    for (size_t c = 0; c < NumClusters; ++c)
+        ClusterOrder[c] = static_cast<Uint32>(c);
+    std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](Uint32 c0, Uint32 c1) {
+        return SortKeys[c0] > SortKeys[c1];
+    });
+
+    size_t OutIndex = 0;
+    for (Uint32 c : ClusterOrder)
+    {
+        const size_t First = size_t{Clusters[c]} * 3;
+        const size_t Last  = size_t{Clusters[c + 1]} * 3;
+        std::copy(Src.begin() + First, Src.begin() + Last, pDstIndices + OutIndex);
+        OutIndex += Last - First;
+    }
+    VERIFY_EXPR(OutIndex == NumIndices);
+}
+
+template <typename IndexType>
+Uint32 OptimizeVertexFetchRemap(Uint32* pRemap, const IndexType* pIndices, size_t NumIndices, size_t NumVertices)
+{
+    std::fill(pRemap, pRemap + NumVertices, InvalidIndex);
+
+    Uint32 NumUsedVertices = 0;
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        const IndexType Idx = pIndices[i];
+        DEV_CHECK_ERR(Idx < NumVertices, "Index ", Idx, " exceeds the number of vertices (", NumVertices, ")");
+        if (pRemap[Idx] == InvalidIndex)
+            pRemap[Idx] = NumUsedVertices++;
+    }
+    return NumUsedVertices;
+}
+
+template <typename IndexType>
+void RemapIndices(IndexType* pDstIndices, const IndexType* pIndices, size_t NumIndices, const Uint32* pRemap)
+{
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        VERIFY(pRemap[pIndices[i]] != InvalidIndex, "Referenced vertex is not present in the remap table");
+        pDstIndices[i] = static_cast<IndexType>(pRemap[pIndices[i]]);
+    }
+}
+
+void RemapVertices(void* pDstVertices, const void* pVertices, size_t NumVertices, size_t VertexStride, const Uint32* pRemap)
+{
+    std::vector<Uint8> Temp;
+    if (pDstVertices == pVertices)
+    {
+        Temp.assign(static_cast<const Uint8*>(pVertices), static_cast<const Uint8*>(pVertices) + NumVertices * VertexStride);
+        pVertices = Temp.data();
+    }
+
+    for (size_t v = 0; v < NumVertices; ++v)
+    {
+        if (pRemap[v] != InvalidIndex)
+        {
+            memcpy(static_cast<Uint8*>(pDstVertices) + pRemap[v] * VertexStride,
+                   static_cast<const Uint8*>(pVertices) + v * VertexStride,
+                   VertexStride);
+        }
+    }
+}
+
+template <typename IndexType>
+VertexCacheStatistics AnalyzeVertexCache(const IndexType* pIndices, size_t NumIndices, size_t NumVertices, Uint32 CacheSize)
+{
+    VertexCacheStatistics Stats;
+    if (NumIndices < 3)
+        return Stats;
+
+    FIFOCacheModel    Cache{NumVertices, CacheSize};
+    std::vector<bool> Referenced(NumVertices, false);
+    Uint32            NumReferenced = 0;
+    for (size_t t = 0; t < NumIndices / 3; ++t)
+    {
+        Stats.VerticesTransformed += Cache.ProcessTriangle(&pIndices[t * 3]);
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            if (!Referenced[pIndices[t * 3 + c]])
+            {
+                Referenced[pIndices[t * 3 + c]] = true;
+                ++NumReferenced;
+            }
+        }
+    }
+
+    Stats.ACMR = static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(NumIndices / 3);
+    Stats.ATVR = static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(NumReferenced);
+    return Stats;
+}
+
+#define INSTANTIATE_INDEX_FUNCTIONS(IndexType)                                                                                                  \
+    template void                  OptimizeVertexCache<IndexType>(IndexType*, const IndexType*, size_t, size_t);                                \
+    template void                  OptimizeOverdraw<IndexType>(IndexType*, const IndexType*, size_t, const void*, size_t, size_t, float); \
+    template Uint32                OptimizeVertexFetchRemap<IndexType>(Uint32*, const IndexType*, size_t, size_t);                       \
+    template void                  RemapIndices<IndexType>(IndexType*, const IndexType*, size_t, const Uint32*);                         \
+    template VertexCacheStatistics AnalyzeVertexCache<IndexType>(const IndexType*, size_t, size_t, Uint32);
+
+INSTANTIATE_INDEX_FUNCTIONS(Uint16)
+INSTANTIATE_INDEX_FUNCTIONS(Uint32)
+
+#undef INSTANTIATE_INDEX_FUNCTIONS
+
+
+Uint16 QuantizeHalf(float Value)
+{
+    Uint32 x;
+    memcpy(&x, &Value, sizeof(x));
+
+    const Uint32 Sign = (x >> 16u) & 0x8000u;
+    const Uint32 Abs  = x & 0x7FFFFFFFu;
+
+    // NaN
+    if (Abs > 0x7F800000u)
+        return static_cast<Uint16>(Sign | 0x7E00u);
+
+    // Values that round to infinity
+    if (Abs >= 0x477FF000u)
+        return static_cast<Uint16>(Sign | 0x7C00u);
+
+    // Denormals: align the mantissa with the implicit bit to the denormal exponent
+    if (Abs < 0x38800000u)
+    {
+        const Uint32 Shift = 126u - (Abs >> 23u);
+        // Values below 2^-25 round to zero
+        if (Shift > 24u)
+            return static_cast<Uint16>(Sign);
+
+        const Uint32 Mant = (Abs & 0x7FFFFFu) | 0x800000u;
+        Uint32       h    = Mant >> Shift;
+        const Uint32 Rem  = Mant & ((1u << Shift) - 1u);
+        const Uint32 Half = 1u << (Shift - 1u);
+        if (Rem > Half || (Rem == Half && (h & 1u) != 0))
+            ++h;
+        return static_cast<Uint16>(Sign | h);
+    }
+
+    // Normal values: rebias the exponent and round the mantissa to nearest even.
+    // A carry from the mantissa correctly increments the exponent.
+    Uint32       h   = (Abs - 0x38000000u) >> 13u;
+    const Uint32 Rem = Abs & 0x1FFFu;
+    if (Rem > 0x1000u || (Rem == 0x1000u && (h & 1u) != 0))
+        ++h;
+    return static_cast<Uint16>(Sign | h);
+}
+
+namespace
+{
+
+template <typename DstType>
+void QuantizeScalar(const float* pSrc, DstType* pDst, size_t NumValues, VALUE_TYPE Type)
+{
+    for (size_t i = 0; i < NumValues; ++i)
+    {
+        switch (Type)
+        {
+            case VT_UINT8: pDst[i] = static_cast<DstType>(QuantizeUNorm(pSrc[i], 8)); break;
+            case VT_UINT16: pDst[i] = static_cast<DstType>(QuantizeUNorm(pSrc[i], 16)); break;
+            case VT_INT8: pDst[i] = static_cast<DstType>(QuantizeSNorm(pSrc[i], 8)); break;
+            case VT_INT16: pDst[i] = static_cast<DstType>(QuantizeSNorm(pSrc[i], 16)); break;
+            case VT_FLOAT16: pDst[i] = static_cast<DstType>(QuantizeHalf(pSrc[i])); break;
+            default: UNEXPECTED("Unexpected value type");
+        }
+    }
+}
+
+// Quantizes the values to normalized integers with SIMD instructions.
+// Returns the number of processed values, which is a multiple of 16. The results are identical to QuantizeScalar.
+size_t QuantizeNormSIMD(const float* pSrc, void* pDst, size_t NumValues, VALUE_TYPE Type)
+{
+    const size_t NumSIMDValues = NumValues & ~size_t{15};
+    if (Type == VT_FLOAT16)
+        return 0;
+
+    const bool  IsSigned = Type == VT_INT8 || Type == VT_INT16;
+    const bool  Is8Bit   = Type == VT_UINT8 || Type == VT_INT8;
+    const float MinVal   = IsSigned ? -1.f : 0.f;
+    const float Scale    = Is8Bit ? (IsSigned ? 127.f : 255.f) : (IsSigned ? 32767.f : 65535.f);
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128 vMin      = _mm_set1_ps(MinVal);
+    const __m128 vMax      = _mm_set1_ps(1.f);
+    const __m128 vScale    = _mm_set1_ps(Scale);
+    const __m128 vHalf     = _mm_set1_ps(0.5f);
+    const __m128 vSignMask = _mm_set1_ps(-0.f);
+    // Unsigned 16-bit values do not fit into the signed saturation range of _mm_packs_epi32,
+    // so they are biased to the signed range and the bias is removed after packing.
+    const __m128i vBias32 = _mm_set1_epi32(IsSigned || Is8Bit ? 0 : 32768);
+    const __m128i vBias16 = _mm_set1_epi16(IsSigned || Is8Bit ? 0 : static_cast<short>(0x8000));
+
+    auto Convert4 = [&](const float* p) {
+        __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), vMin), vMax);
+        v        = _mm_mul_ps(v, vScale);
+        // Round half away from zero, same as QuantizeUNorm/QuantizeSNorm
+        v = _mm_add_ps(v, _mm_or_ps(_mm_and_ps(v, vSignMask), vHalf));
+        return _mm_sub_epi32(_mm_cvttps_epi32(v), vBias32);
+    };
+
+    for (size_t i = 0; i < NumSIMDValues; i += 16)
+    {
+        const __m128i i01 = _mm_packs_epi32(Convert4(pSrc + i + 0), Convert4(pSrc + i + 4));
+        const __m128i i23 = _mm_packs_epi32(Convert4(pSrc + i + 8), Convert4(pSrc + i + 12));
+        if (Is8Bit)
+        {
+            const __m128i Packed = IsSigned ? _mm_packs_epi16(i01, i23) : _mm_packus_epi16(i01, i23);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<Uint8*>(pDst) + i), Packed);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<Uint16*>(pDst) + i + 0), _mm_xor_si128(i01, vBias16));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(static_cast<Uint16*>(pDst) + i + 8), _mm_xor_si128(i23, vBias16));
+        }
+    }
+    return NumSIMDValues;
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t vMin   = vdupq_n_f32(MinVal);
+    const float32x4_t vMax   = vdupq_n_f32(1.f);
+    const float32x4_t vScale = vdupq_n_f32(Scale);
+    const float32x4_t vHalf  = vdupq_n_f32(0.5f);
+
+    auto Convert4 = [&](const float* p) {
+        float32x4_t v = vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(p), vMin), vMax), vScale);
+        // Round half away from zero, same as QuantizeUNorm/QuantizeSNorm
+        const uint32x4_t Sign = vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000u));
+        v                     = vaddq_f32(v, vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vHalf), Sign)));
+        return vcvtq_s32_f32(v);
+    };
+
+    for (size_t i = 0; i < NumSIMDValues; i += 16)
+    {
+        int32x4_t v[4];
+        for (size_t j = 0; j < 4; ++j)
+            v[j] = Convert4(pSrc + i + j * 4);
+
+        if (IsSigned)
+        {
+            const int16x8_t i01 = vcombine_s16(vmovn_s32(v[0]), vmovn_s32(v[1]));
+            const int16x8_t i23 = vcombine_s16(vmovn_s32(v[2]), vmovn_s32(v[3]));
+            if (Is8Bit)
+                vst1q_s8(static_cast<Int8*>(pDst) + i, vcombine_s8(vmovn_s16(i01), vmovn_s16(i23)));
+            else
+            {
+                vst1q_s16(static_cast<Int16*>(pDst) + i + 0, i01);
+                vst1q_s16(static_cast<Int16*>(pDst) + i + 8, i23);
+            }
+        }
+        else
+        {
+            const uint16x8_t u01 = vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(v[0])), vmovn_u32(vreinterpretq_u32_s32(v[1])));
+            const uint16x8_t u23 = vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(v[2])), vmovn_u32(vreinterpretq_u32_s32(v[3])));
+            if (Is8Bit)
+                vst1q_u8(static_cast<Uint8*>(pDst) + i, vcombine_u8(vmovn_u16(u01), vmovn_u16(u23)));
+            else
+            {
+                vst1q_u16(static_cast<Uint16*>(pDst) + i + 0, u01);
+                vst1q_u16(static_cast<Uint16*>(pDst) + i + 8, u23);
+            }
+        }
+    }
+    return NumSIMDValues;
+#else
+    (void)pSrc;
+    (void)pDst;
+    (void)NumSIMDValues;
+    (void)Scale;
+    (void)MinVal;
+    return 0;
+#endif
+}
+
+void QuantizeRange(const float* pSrc, void* pDst, size_t NumValues, VALUE_TYPE Type)
+{
+    const size_t NumProcessed = QuantizeNormSIMD(pSrc, pDst, NumValues, Type);
+
+    pSrc += NumProcessed;
+    NumValues -= NumProcessed;
+    switch (Type)
+    {
+        case VT_UINT8: QuantizeScalar(pSrc, static_cast<Uint8*>(pDst) + NumProcessed, NumValues, Type); break;
+        case VT_INT8: QuantizeScalar(pSrc, static_cast<Int8*>(pDst) + NumProcessed, NumValues, Type); break;
+        case VT_UINT16: QuantizeScalar(pSrc, static_cast<Uint16*>(pDst) + NumProcessed, NumValues, Type); break;
+        case VT_INT16: QuantizeScalar(pSrc, static_cast<Int16*>(pDst) + NumProcessed, NumValues, Type); break;
+        case VT_FLOAT16: QuantizeScalar(pSrc, static_cast<Uint16*>(pDst) + NumProcessed, NumValues, Type); break;
+        default: UNEXPECTED("Unexpected value type");
+    }
+}
+
+} // namespace
+
+bool QuantizeAttributes(const QuantizeAttributesAttribs& Attribs)
+{
+    if (Attribs.NumValues == 0)
+        return true;
+
+    if (Attribs.pSrc == nullptr || Attribs.pDst == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Source and destination data must not be null");
+        return false;
+    }
+
+    if (Attribs.DstType != VT_UINT8 && Attribs.DstType != VT_INT8 &&
+        Attribs.DstType != VT_UINT16 && Attribs.DstType != VT_INT16 &&
+        Attribs.DstType != VT_FLOAT16)
+    {
+        LOG_ERROR_MESSAGE("Destination type must be VT_UINT8, VT_INT8, VT_UINT16, VT_INT16 or VT_FLOAT16");
+        return false;
+    }
+
+    // The number of values processed by one task. Smaller arrays are processed by the calling thread.
+    constexpr size_t ValuesPerTask = 64 << 10;
+
+    const size_t ValueSize = Attribs.DstType == VT_UINT8 || Attribs.DstType == VT_INT8 ? 1 : 2;
+    if (Attribs.pThreadPool != nullptr && Attribs.NumValues > ValuesPerTask)
+    {
+        const Uint32 NumTasks = static_cast<Uint32>((Attribs.NumValues + ValuesPerTask - 1) / ValuesPerTask);
+        ParallelFor(Attribs.pThreadPool, 0, NumTasks, 1,
+                    [&](Uint32 Task) {
+                        const size_t First = size_t{Task} * ValuesPerTask;
+                        QuantizeRange(Attribs.pSrc + First,
+                                      static_cast<Uint8*>(Attribs.pDst) + First * ValueSize,
+                                      std::min(ValuesPerTask, Attribs.NumValues - First),
+                                      Attribs.DstType);
+                    });
+    }
+    else
+    {
+        QuantizeRange(Attribs.pSrc, Attribs.pDst, Attribs.NumValues, Attribs.DstType);
+    }
+
+    return true;
+}
+
+} // namespace Diligent
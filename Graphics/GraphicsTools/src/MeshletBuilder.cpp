@@ -0,0 +1,528 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshletBuilder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The number of triangles processed by one task. Meshlets never cross group boundaries,
+// so larger groups produce slightly fewer partially filled meshlets.
+constexpr Uint32 TrianglesPerGroup = 8192;
+
+// Meshlet-local vertex indices are packed into 8 bits
+constexpr Uint32 MaxMeshletVertices   = 256;
+constexpr Uint32 MaxMeshletPrimitives = 256;
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+float3 ReadPosition(const BuildMeshletsAttribs& Attribs, Uint32 Vertex)
+{
+    const float* pPos = reinterpret_cast<const float*>(static_cast<const Uint8*>(Attribs.pPositions) + size_t{Vertex} * Attribs.PositionStride);
+    return float3{pPos[0], pPos[1], pPos[2]};
+}
+
+float LengthSq(const float3& v)
+{
+    return dot(v, v);
+}
+
+Uint32 ReadIndex(const BuildMeshletsAttribs& Attribs, Uint32 Idx)
+{
+    return Attribs.IndexType == VT_UINT16 ?
+        Uint32{static_cast<const Uint16*>(Attribs.pIndices)[Idx]} :
+        static_cast<const Uint32*>(Attribs.pIndices)[Idx];
+}
+
+MeshletBounds ComputeBounds(const BuildMeshletsAttribs& Attribs,
+                            const Uint32*               pVertexIndices,
+                            Uint32                      VertexCount,
+                            const Uint32*               pPrimitives,
+                            Uint32                      PrimitiveCount)
+{
+    MeshletBounds Bounds;
+    if (VertexCount == 0)
+        return Bounds;
+
+    // Bounding sphere centered at the bounding box center
+    float3 BoxMin = ReadPosition(Attribs, pVertexIndices[0]);
+    float3 BoxMax = BoxMin;
+    for (Uint32 v = 1; v < VertexCount; ++v)
+    {
+        const float3 Pos = ReadPosition(Attribs, pVertexIndices[v]);
+        BoxMin           = std::min(BoxMin, Pos);
+        BoxMax           = std::max(BoxMax, Pos);
+    }
+    Bounds.Center = (BoxMin + BoxMax) * 0.5f;
+
+    float MaxDistSq = 0;
+    for (Uint32 v = 0; v < VertexCount; ++v)
+        MaxDistSq = std::max(MaxDistSq, LengthSq(ReadPosition(Attribs, pVertexIndices[v]) - Bounds.Center));
+    Bounds.Radius = std::sqrt(MaxDistSq);
+
+    // Normal cone
+    struct TriangleInfo
+    {
+        float3 Pos0;
+        float3 Normal;
+    };
+    std::vector<TriangleInfo> Triangles;
+    Triangles.reserve(PrimitiveCount);
+
+    float3 NormalSum;
+    for (Uint32 p = 0; p < PrimitiveCount; ++p)
+    {
+        const Uint32 Prim = pPrimitives[p];
+        const float3 Pos0 = ReadPosition(Attribs, pVertexIndices[(Prim >> 0u) & 0xFFu]);
+        const float3 Pos1 = ReadPosition(Attribs, pVertexIndices[(Prim >> 8u) & 0xFFu]);
+        const float3 Pos2 = ReadPosition(Attribs, pVertexIndices[(Prim >> 16u) & 0xFFu]);
+
+        const float3 Normal = cross(Pos1 - Pos0, Pos2 - Pos0);
+        const float  Area   = length(Normal);
+        // Degenerate triangles do not affect the cone
+        if (Area == 0)
+            continue;
+
+        Triangles.push_back({Pos0, Normal / Area});
+        NormalSum += Triangles.back().Normal;
+    }
+
+    const float AxisLen = length(NormalSum);
+    if (Triangles.empty() || AxisLen == 0)
+        return Bounds;
+
+    const float3 Axis = NormalSum / AxisLen;
+
+    float MinDot = 1;
+    for (const TriangleInfo& Tri : Triangles)
+        MinDot = std::min(MinDot, dot(Tri.Normal, Axis));
+
+    // Wide cones are never culled
+    if (MinDot <= 0.1f)
+        return Bounds;
+
+    // The apex is moved back along the axis so that all triangle planes are in front of it
+    float MaxT = 0;
+    for (const TriangleInfo& Tri : Triangles)
+    {
+        const float T = dot(Bounds.Center - Tri.Pos0, Tri.Normal) / dot(Axis, Tri.Normal);
+        MaxT          = std::max(MaxT, T);
+    }
+
+    Bounds.ConeApex = Bounds.Center - Axis * MaxT;
+    Bounds.ConeAxis = Axis;
+    // The normal cone half-angle is acos(MinDot). The back-facing cone of view directions is
+    // extended by 90 degrees on both sides, and its cosine is -cos(acos(MinDot) + 90) = sin(acos(MinDot)).
+    Bounds.ConeCutoff = std::sqrt(1.f - MinDot * MinDot);
+
+    return Bounds;
+}
+
+// Builds meshlets from a contiguous group of triangles
+class MeshletGroupBuilder
+{
+public:
+    MeshletGroupBuilder(const BuildMeshletsAttribs& Attribs,
+                        Uint32                      MaxVertices,
+                        Uint32                      MaxPrimitives,
+                        MeshletData&                Data) :
+        m_Attribs{Attribs},
+        m_MaxVertices{MaxVertices},
+        m_MaxPrimitives{MaxPrimitives},
+        m_Data{Data}
+    {}
+
+    bool Build(Uint32 FirstTriangle, Uint32 NumTriangles)
+    {
+        if (!InitTopology(FirstTriangle, NumTriangles))
+            return false;
+
+        Uint32 NextSeed = 0;
+        while (true)
+        {
+            Uint32 NewVertices = 0;
+            Uint32 Tri         = FindAdjacentTriangle(NewVertices);
+            if (Tri == InvalidIndex)
+            {
+                Tri = m_MeshletTriangles.empty() ? FindSeedTriangle(NextSeed) : FindClosestTriangle();
+                if (Tri == InvalidIndex)
+                    break;
+                NewVertices = CountNewVertices(Tri);
+            }
+
+            if (m_MeshletVertices.size() + NewVertices > m_MaxVertices || m_MeshletTriangles.size() + 1 > m_MaxPrimitives)
+                FlushMeshlet();
+
+            AddTriangle(Tri);
+        }
+        FlushMeshlet();
+
+        return true;
+    }
+
+private:
+    bool InitTopology(Uint32 FirstTriangle, Uint32 NumTriangles)
+    {
+        std::unordered_map<Uint32, Uint32> GlobalToLocal;
+        GlobalToLocal.reserve(size_t{NumTriangles} * 3 / 2);
+
+        m_Triangles.resize(size_t{NumTriangles} * 3);
+        for (Uint32 i = 0; i < NumTriangles * 3; ++i)
+        {
+            const Uint32 Vertex = ReadIndex(m_Attribs, FirstTriangle * 3 + i);
+            if (Vertex >= m_Attribs.NumVertices)
+            {
+                LOG_ERROR_MESSAGE("Index ", Vertex, " at position ", FirstTriangle * 3 + i, " exceeds the vertex count (", m_Attribs.NumVertices, ")");
+                return false;
+            }
+
+            auto it = GlobalToLocal.emplace(Vertex, static_cast<Uint32>(m_LocalToGlobal.size())).first;
+            if (it->second == m_LocalToGlobal.size())
+                m_LocalToGlobal.push_back(Vertex);
+            m_Triangles[i] = it->second;
+        }
+
+        const size_t NumVertices = m_LocalToGlobal.size();
+
+        // Vertex-triangle adjacency
+        m_AdjacencyOffsets.assign(NumVertices + 1, 0);
+        for (Uint32 v : m_Triangles)
+            ++m_AdjacencyOffsets[v + 1];
+        for (size_t v = 0; v < NumVertices; ++v)
+            m_AdjacencyOffsets[v + 1] += m_AdjacencyOffsets[v];
+
+        m_LiveTriangles.resize(NumVertices);
+        for (size_t v = 0; v < NumVertices; ++v)
+            m_LiveTriangles[v] = m_AdjacencyOffsets[v + 1] - m_AdjacencyOffsets[v];
+
+        m_Adjacency.resize(m_Triangles.size());
+        std::vector<Uint32> Fill{m_AdjacencyOffsets.begin(), m_AdjacencyOffsets.end() - 1};
+        for (Uint32 i = 0; i < m_Triangles.size(); ++i)
+            m_Adjacency[Fill[m_Triangles[i]]++] = i / 3;
+
+        m_Centroids.resize(NumTriangles);
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            m_Centroids[t] = (ReadPosition(m_Attribs, m_LocalToGlobal[m_Triangles[t * 3 + 0]]) +
+                              ReadPosition(m_Attribs, m_LocalToGlobal[m_Triangles[t * 3 + 1]]) +
+                              ReadPosition(m_Attribs, m_LocalToGlobal[m_Triangles[t * 3 + 2]])) /
+                3.f;
+        }
+
+        m_Emitted.assign(NumTriangles, false);
+        m_MeshletSlot.assign(NumVertices, InvalidIndex);
+
+        return true;
+    }
+
+    Uint32 CountNewVertices(Uint32 Tri) const
+    {
+        Uint32 NewVertices = 0;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            if (m_MeshletSlot[m_Triangles[Tri * 3 + c]] == InvalidIndex)
+                ++NewVertices;
+        }
+        return NewVertices;
+    }
+
+    float3 GetMeshletCenter() const
+    {
+        return m_CentroidSum / static_cast<float>(m_MeshletTriangles.size());
+    }
+
+    // Finds the triangle that shares vertices with the meshlet and adds the fewest new vertices
+    Uint32 FindAdjacentTriangle(Uint32& NewVertices) const
+    {
+        if (m_MeshletTriangles.empty())
+            return InvalidIndex;
+
+        const float3 Center = GetMeshletCenter();
+
+        Uint32 BestTri    = InvalidIndex;
+        Uint32 BestNew    = 4;
+        float  BestDistSq = 0;
+        for (Uint32 v : m_MeshletVertices)
+        {
+            if (m_LiveTriangles[v] == 0)
+                continue;
+
+            for (Uint32 a = m_AdjacencyOffsets[v]; a < m_AdjacencyOffsets[v + 1]; ++a)
+            {
+                const Uint32 Tri = m_Adjacency[a];
+                if (m_Emitted[Tri])
+                    continue;
+
+                const Uint32 New = CountNewVertices(Tri);
+                if (New > BestNew)
+                    continue;
+
+                const float DistSq = LengthSq(m_Centroids[Tri] - Center);
+                if (New < BestNew || DistSq < BestDistSq)
+                {
+                    BestTri    = Tri;
+                    BestNew    = New;
+                    BestDistSq = DistSq;
+                }
+            }
+        }
+
+        NewVertices = BestNew;
+        return BestTri;
+    }
+
+    // Finds the remaining triangle that is closest to the meshlet center
+    Uint32 FindClosestTriangle() const
+    {
+        const float3 Center = GetMeshletCenter();
+
+        Uint32 BestTri    = InvalidIndex;
+        float  BestDistSq = 0;
+        for (Uint32 Tri = 0; Tri < m_Emitted.size(); ++Tri)
+        {
+            if (m_Emitted[Tri])
+                continue;
+
+            const float DistSq = LengthSq(m_Centroids[Tri] - Center);
+            if (BestTri == InvalidIndex || DistSq < BestDistSq)
+            {
+                BestTri    = Tri;
+                BestDistSq = DistSq;
+            }
+        }
+        return BestTri;
+    }
+
+    // Finds the first remaining triangle in the original order
+    Uint32 FindSeedTriangle(Uint32& NextSeed) const
+    {
+        while (NextSeed < m_Emitted.size() && m_Emitted[NextSeed])
+            ++NextSeed;
+        return NextSeed < m_Emitted.size() ? NextSeed : InvalidIndex;
+    }
+
+    void AddTriangle(Uint32 Tri)
+    {
+        VERIFY_EXPR(!m_Emitted[Tri]);
+        m_Emitted[Tri] = true;
+
+        Uint32 Prim = 0;
+        for (Uint32 c = 0; c < 3; ++c)
+        {
+            const Uint32 v = m_Triangles[Tri * 3 + c];
+            if (m_MeshletSlot[v] == InvalidIndex)
+            {
+                m_MeshletSlot[v] = static_cast<Uint32>(m_MeshletVertices.size());
+                m_MeshletVertices.push_back(v);
+            }
+            VERIFY_EXPR(m_LiveTriangles[v] > 0);
+            --m_LiveTriangles[v];
+            Prim |= m_MeshletSlot[v] << (c * 8u);
+        }
+        m_MeshletTriangles.push_back(Prim);
+        m_CentroidSum += m_Centroids[Tri];
+    }
+
+    void FlushMeshlet()
+    {
+        if (m_MeshletTriangles.empty())
+            return;
+
+        MeshletDesc Meshlet;
+        Meshlet.VertexOffset    = static_cast<Uint32>(m_Data.VertexIndices.size());
+        Meshlet.VertexCount     = static_cast<Uint32>(m_MeshletVertices.size());
+        Meshlet.PrimitiveOffset = static_cast<Uint32>(m_Data.PrimitiveIndices.size());
+        Meshlet.PrimitiveCount  = static_cast<Uint32>(m_MeshletTriangles.size());
+
+        for (Uint32 v : m_MeshletVertices)
+        {
+            m_Data.VertexIndices.push_back(m_LocalToGlobal[v]);
+            m_MeshletSlot[v] = InvalidIndex;
+        }
+        m_Data.PrimitiveIndices.insert(m_Data.PrimitiveIndices.end(), m_MeshletTriangles.begin(), m_MeshletTriangles.end());
+
+        m_Data.Meshlets.push_back(Meshlet);
+        m_Data.Bounds.push_back(ComputeBounds(m_Attribs,
+                                              &m_Data.VertexIndices[Meshlet.VertexOffset], Meshlet.VertexCount,
+                                              &m_Data.PrimitiveIndices[Meshlet.PrimitiveOffset], Meshlet.PrimitiveCount));
+
+        m_MeshletVertices.clear();
+        m_MeshletTriangles.clear();
+        m_CentroidSum = float3{};
+    }
+
+private:
+    const BuildMeshletsAttribs& m_Attribs;
+    const Uint32                m_MaxVertices;
+    const Uint32                m_MaxPrimitives;
+    MeshletData&                m_Data;
+
+    // Group-local vertex indices of every triangle
+    std::vector<Uint32> m_Triangles;
+    std::vector<Uint32> m_LocalToGlobal;
+
+    // Triangles adjacent to every local vertex
+    std::vector<Uint32> m_AdjacencyOffsets;
+    std::vector<Uint32> m_Adjacency;
+    // The number of adjacent triangles that have not been emitted yet
+    std::vector<Uint32> m_LiveTriangles;
+
+    std::vector<float3> m_Centroids;
+    std::vector<bool>   m_Emitted;
+
+    // Index of the vertex in the current meshlet, or InvalidIndex
+    std::vector<Uint32> m_MeshletSlot;
+
+    // Current meshlet
+    std::vector<Uint32> m_MeshletVertices;
+    std::vector<Uint32> m_MeshletTriangles;
+    float3              m_CentroidSum;
+};
+
+} // namespace
+
+bool BuildMeshlets(const BuildMeshletsAttribs& Attribs, MeshletData& Data)
+{
+    Data = {};
+
+    if (Attribs.NumIndices == 0)
+        return true;
+
+    if (Attribs.pIndices == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Index data must not be null");
+        return false;
+    }
+    if (Attribs.IndexType != VT_UINT16 && Attribs.IndexType != VT_UINT32)
+    {
+        LOG_ERROR_MESSAGE("Index type must be VT_UINT16 or VT_UINT32");
+        return false;
+    }
+    if (Attribs.NumIndices % 3 != 0)
+    {
+        LOG_ERROR_MESSAGE("The number of indices (", Attribs.NumIndices, ") must be a multiple of 3");
+        return false;
+    }
+    if (Attribs.pPositions == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Position data must not be null");
+        return false;
+    }
+    if (Attribs.PositionStride < sizeof(float3))
+    {
+        LOG_ERROR_MESSAGE("Position stride (", Attribs.PositionStride, ") must be at least ", sizeof(float3), " bytes");
+        return false;
+    }
+
+    Uint32 MaxVertices   = std::min(Attribs.MaxVertices, MaxMeshletVertices);
+    Uint32 MaxPrimitives = std::min(Attribs.MaxPrimitives, MaxMeshletPrimitives);
+    if (Attribs.pMeshShaderProps != nullptr)
+    {
+        if (Attribs.pMeshShaderProps->MaxOutputVertices != 0)
+            MaxVertices = std::min(MaxVertices, Attribs.pMeshShaderProps->MaxOutputVertices);
+        if (Attribs.pMeshShaderProps->MaxOutputPrimitives != 0)
+            MaxPrimitives = std::min(MaxPrimitives, Attribs.pMeshShaderProps->MaxOutputPrimitives);
+    }
+    if (MaxVertices < 3 || MaxPrimitives < 1)
+    {
+        LOG_ERROR_MESSAGE("Meshlet limits are too small: ", MaxVertices, " vertices, ", MaxPrimitives, " primitives");
+        return false;
+    }
+
+    const Uint32 NumTriangles = Attribs.NumIndices / 3;
+    const Uint32 NumGroups    = (NumTriangles + TrianglesPerGroup - 1) / TrianglesPerGroup;
+
+    std::vector<MeshletData> GroupData(NumGroups);
+    std::atomic<bool>        Succeeded{true};
+    ParallelFor(Attribs.pThreadPool, 0, NumGroups, 1,
+                [&](Uint32 Group) {
+                    const Uint32 FirstTriangle = Group * TrianglesPerGroup;
+
+                    MeshletGroupBuilder Builder{Attribs, MaxVertices, MaxPrimitives, GroupData[Group]};
+                    if (!Builder.Build(FirstTriangle, std::min(TrianglesPerGroup, NumTriangles - FirstTriangle)))
+                        Succeeded.store(false);
+                });
+    if (!Succeeded.load())
+        return false;
+
+    if (NumGroups == 1)
+    {
+        Data = std::move(GroupData[0]);
+        return true;
+    }
+
+    size_t NumMeshlets = 0, NumVertices = 0, NumPrimitives = 0;
+    for (const MeshletData& Group : GroupData)
+    {
+        NumMeshlets += Group.Meshlets.size();
+        NumVertices += Group.VertexIndices.size();
+        NumPrimitives += Group.PrimitiveIndices.size();
+    }
+    Data.Meshlets.reserve(NumMeshlets);
+    Data.Bounds.reserve(NumMeshlets);
+    Data.VertexIndices.reserve(NumVertices);
+    Data.PrimitiveIndices.reserve(NumPrimitives);
+
+    for (const MeshletData& Group : GroupData)
+    {
+        const Uint32 VertexOffset    = static_cast<Uint32>(Data.VertexIndices.size());
+        const Uint32 PrimitiveOffset = static_cast<Uint32>(Data.PrimitiveIndices.size());
+        for (MeshletDesc Meshlet : Group.Meshlets)
+        {
+            Meshlet.VertexOffset += VertexOffset;
+            Meshlet.PrimitiveOffset += PrimitiveOffset;
+            Data.Meshlets.push_back(Meshlet);
+        }
+        Data.Bounds.insert(Data.Bounds.end(), Group.Bounds.begin(), Group.Bounds.end());
+        Data.VertexIndices.insert(Data.VertexIndices.end(), Group.VertexIndices.begin(), Group.VertexIndices.end());
+        Data.PrimitiveIndices.insert(Data.PrimitiveIndices.end(), Group.PrimitiveIndices.begin(), Group.PrimitiveIndices.end());
+    }
+
+    return true;
+}
+
+MeshletBounds ComputeMeshletBounds(const BuildMeshletsAttribs& Attribs, const MeshletData& Data, Uint32 MeshletIdx)
+{
+    DEV_CHECK_ERR(MeshletIdx < Data.Meshlets.size(), "Meshlet index (", MeshletIdx, ") is out of range");
+    DEV_CHECK_ERR(Attribs.pPositions != nullptr, "Position data must not be null");
+
+    const MeshletDesc& Meshlet = Data.Meshlets[MeshletIdx];
+    return ComputeBounds(Attribs,
+                         Data.VertexIndices.data() + Meshlet.VertexOffset, Meshlet.VertexCount,
+                         Data.PrimitiveIndices.data() + Meshlet.PrimitiveOffset, Meshlet.PrimitiveCount);
+}
+
+} // namespace Diligent
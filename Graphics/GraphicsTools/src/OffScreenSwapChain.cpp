@@ -25,11 +25,17 @@
  */
 
 
+#include <vector>
+#include <deque>
+
 #include "../../../Common/interface/ObjectBase.hpp"
 #include "../../../Graphics/GraphicsEngine/include/SwapChainBase.hpp"
 #include "../../../Graphics/GraphicsEngine/include/RenderDeviceBase.hpp"
 #include "../../../Graphics/GraphicsAccessories/interface/GraphicsAccessories.hpp"
 
+#include "../../../Graphics/GraphicsEngine/interface/DeviceContext.h"
+#include "../../../Graphics/GraphicsEngine/interface/Fence.h"
+
 #include "OffScreenSwapChain.hpp"
 
 namespace Diligent
@@ -40,12 +46,26 @@ class OffScreenSwapChain : public SwapChainBase<ISwapChain>
 public:
     using TSwapChainBase = SwapChainBase;
 
-    OffScreenSwapChain(IReferenceCounters*  pRefCounters,
-                       IRenderDevice*       pDevice,
-                       IDeviceContext*      pContext,
-                       const SwapChainDesc& SCDesc) :
-        SwapChainBase{pRefCounters, pDevice, pContext, SCDesc}
+    OffScreenSwapChain(IReferenceCounters*                      pRefCounters,
+                       IRenderDevice*                           pDevice,
+                       IDeviceContext*                          pContext,
+                       const SwapChainDesc&                     SCDesc,
+                       const OffScreenSwapChainReadbackAttribs& ReadbackAttribs = {}) :
+        SwapChainBase{pRefCounters, pDevice, pContext, SCDesc},
+        m_FrameCallback{ReadbackAttribs.FrameCallback},
+        m_NumStagingTextures{std::max(ReadbackAttribs.NumStagingTextures, 1u)},
+        // Render targets are only rotated when frames are read back to preserve the original behavior
+        m_NumRenderTargets{ReadbackAttribs.FrameCallback ? std::max(SCDesc.BufferCount, 1u) : 1u}
     {
+        if (m_FrameCallback)
+        {
+            FenceDesc Desc;
+            Desc.Name = "Off-screen swap chain readback fence";
+            Desc.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+            m_pRenderDevice->CreateFence(Desc, &m_pFence);
+            if (!m_pFence)
+                LOG_ERROR_AND_THROW("Failed to create off-screen swap chain readback fence");
+        }
 
         if (m_DesiredPreTransform != SURFACE_TRANSFORM_OPTIMAL && m_DesiredPreTransform != SURFACE_TRANSFORM_IDENTITY)
         {
@@ -69,24 +89,66 @@ public:
             return;
         }
 
+        if (m_FrameCallback)
+            EnqueueReadback(pDeviceContext);
+
         pDeviceContext->Flush();
 
+        if (m_FrameCallback)
+        {
+            // Deliver all frames that are ready. If all staging textures are busy,
+            // wait for the oldest frame so that the queue depth stays bounded.
+            DeliverFrames(pDeviceContext, m_NumStagingTextures - 1);
+        }
+
         if (m_SwapChainDesc.IsPrimary)
         {
             pDeviceContext->FinishFrame();
             m_pRenderDevice->ReleaseStaleResources();
         }
+
+        m_BackBufferIndex = (m_BackBufferIndex + 1) % m_NumRenderTargets;
+    }
+
+    ~OffScreenSwapChain()
+    {
+        if (!m_PendingFrames.empty())
+        {
+            if (auto pDeviceContext = m_wpDeviceContext.Lock())
+            {
+                pDeviceContext->Flush();
+                DeliverFrames(pDeviceContext, 0);
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("Immediate context has been released. ", m_PendingFrames.size(), " pending frame(s) will be lost");
+            }
+        }
     }
 
     virtual void DILIGENT_CALL_TYPE Resize(Uint32 NewWidth, Uint32 NewHeight, SURFACE_TRANSFORM NewPreTransform) override final
     {
         if (TSwapChainBase::Resize(NewWidth, NewHeight, NewPreTransform))
         {
-            m_pRTV.Release();
+            if (!m_PendingFrames.empty())
+            {
+                // Deliver the frames of the old size before the staging textures are released
+                if (auto pDeviceContext = m_wpDeviceContext.Lock())
+                {
+                    pDeviceContext->Flush();
+                    DeliverFrames(pDeviceContext, 0);
+                }
+                m_PendingFrames.clear();
+            }
+            m_AvailableStagingTextures.clear();
+
+            m_RTVs.clear();
             m_pDSV.Release();
-            m_pRenderTarget.Release();
+            m_RenderTargets.clear();
             m_pDepthBuffer.Release();
+            m_BackBufferIndex = 0;
 
+            for (Uint32 i = 0; i < m_NumRenderTargets; ++i)
             {
                 TextureDesc RenderTargetDesc;
                 RenderTargetDesc.Name        = "Off screen color buffer";
@@ -97,10 +159,12 @@ public:
                 RenderTargetDesc.SampleCount = 1;
                 RenderTargetDesc.Usage       = USAGE_DEFAULT;
                 RenderTargetDesc.BindFlags   = BIND_RENDER_TARGET;
-                m_pRenderDevice->CreateTexture(RenderTargetDesc, nullptr, &m_pRenderTarget);
-                VERIFY_EXPR(m_pRenderTarget != nullptr);
-                m_pRTV = m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
-                VERIFY_EXPR(m_pRTV != nullptr);
+                RefCntAutoPtr<ITexture> pRenderTarget;
+                m_pRenderDevice->CreateTexture(RenderTargetDesc, nullptr, &pRenderTarget);
+                VERIFY_EXPR(pRenderTarget != nullptr);
+                m_RTVs.emplace_back(pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET));
+                VERIFY_EXPR(m_RTVs.back() != nullptr);
+                m_RenderTargets.emplace_back(std::move(pRenderTarget));
             }
 
             if (m_SwapChainDesc.DepthBufferFormat != TEX_FORMAT_UNKNOWN)
@@ -144,7 +208,7 @@ public:
 
     virtual ITextureView* DILIGENT_CALL_TYPE GetCurrentBackBufferRTV() override final
     {
-        return m_pRTV;
+        return m_RTVs[m_BackBufferIndex];
     }
 
     virtual ITextureView* DILIGENT_CALL_TYPE GetDepthBufferDSV() override final
@@ -152,11 +216,118 @@ public:
         return m_pDSV;
     }
 
+private:
+    void EnqueueReadback(IDeviceContext* pContext)
+    {
+        RefCntAutoPtr<ITexture> pStagingTexture;
+        if (!m_AvailableStagingTextures.empty())
+        {
+            pStagingTexture = std::move(m_AvailableStagingTextures.back());
+            m_AvailableStagingTextures.pop_back();
+        }
+        else
+        {
+            TextureDesc StagingDesc;
+            StagingDesc.Name           = "Off screen staging texture";
+            StagingDesc.Type           = RESOURCE_DIM_TEX_2D;
+            StagingDesc.Width          = m_SwapChainDesc.Width;
+            StagingDesc.Height         = m_SwapChainDesc.Height;
+            StagingDesc.Format         = m_SwapChainDesc.ColorBufferFormat;
+            StagingDesc.Usage          = USAGE_STAGING;
+            StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+            m_pRenderDevice->CreateTexture(StagingDesc, nullptr, &pStagingTexture);
+            if (!pStagingTexture)
+            {
+                LOG_ERROR_MESSAGE("Failed to create off-screen swap chain staging texture. Frame ", m_NextFrameIndex, " will be skipped.");
+                ++m_NextFrameIndex;
+                return;
+            }
+        }
+
+        CopyTextureAttribs CopyAttribs{m_RenderTargets[m_BackBufferIndex], RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                       pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        pContext->CopyTexture(CopyAttribs);
+        pContext->EnqueueSignal(m_pFence, m_NextFenceValue);
+
+        m_PendingFrames.emplace_back(std::move(pStagingTexture), m_NextFenceValue, m_NextFrameIndex);
+        ++m_NextFenceValue;
+        ++m_NextFrameIndex;
+    }
+
+    // Delivers completed frames and waits for the oldest frames until
+    // no more than MaxPendingFrames frames remain in flight.
+    void DeliverFrames(IDeviceContext* pContext, size_t MaxPendingFrames)
+    {
+        while (!m_PendingFrames.empty())
+        {
+            auto& Frame = m_PendingFrames.front();
+            if (Frame.FenceValue > m_pFence->GetCompletedValue())
+            {
+                if (m_PendingFrames.size() <= MaxPendingFrames)
+                    break;
+                m_pFence->Wait(Frame.FenceValue);
+            }
+
+            // The copy is complete, so mapping never waits for the GPU
+            MappedTextureSubresource MappedData;
+            pContext->MapTextureSubresource(Frame.pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+            if (MappedData.pData != nullptr)
+            {
+                const auto& StagingDesc = Frame.pStagingTexture->GetDesc();
+
+                OffScreenFrameData FrameData;
+                FrameData.pData      = MappedData.pData;
+                FrameData.RowStride  = MappedData.Stride;
+                FrameData.Width      = StagingDesc.Width;
+                FrameData.Height     = StagingDesc.Height;
+                FrameData.Format     = StagingDesc.Format;
+                FrameData.FrameIndex = Frame.FrameIndex;
+                m_FrameCallback(FrameData);
+
+                pContext->UnmapTextureSubresource(Frame.pStagingTexture, 0, 0);
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("Failed to map off-screen swap chain staging texture. Frame ", Frame.FrameIndex, " will be skipped.");
+            }
+
+            m_AvailableStagingTextures.emplace_back(std::move(Frame.pStagingTexture));
+            m_PendingFrames.pop_front();
+        }
+    }
+
+    struct PendingFrame
+    {
+        PendingFrame(RefCntAutoPtr<ITexture>&& _pStagingTexture, Uint64 _FenceValue, Uint64 _FrameIndex) :
+            // clang-format off
+            pStagingTexture{std::move(_pStagingTexture)},
+            FenceValue     {_FenceValue},
+            FrameIndex     {_FrameIndex}
+        // clang-format on
+        {}
+
+        RefCntAutoPtr<ITexture> pStagingTexture;
+        Uint64                  FenceValue;
+        Uint64                  FrameIndex;
+    };
+
 protected:
-    RefCntAutoPtr<ITexture>     m_pRenderTarget;
+    const OffScreenFrameCallbackType m_FrameCallback;
+    const Uint32                     m_NumStagingTextures;
+    const Uint32                     m_NumRenderTargets;
+
+    std::vector<RefCntAutoPtr<ITexture>>     m_RenderTargets;
+    std::vector<RefCntAutoPtr<ITextureView>> m_RTVs;
+    Uint32                                   m_BackBufferIndex = 0;
+
     RefCntAutoPtr<ITexture>     m_pDepthBuffer;
-    RefCntAutoPtr<ITextureView> m_pRTV;
     RefCntAutoPtr<ITextureView> m_pDSV;
+
+    RefCntAutoPtr<IFence>                m_pFence;
+    Uint64                               m_NextFenceValue = 1;
+    Uint64                               m_NextFrameIndex = 0;
+    std::vector<RefCntAutoPtr<ITexture>> m_AvailableStagingTextures;
+    std::deque<PendingFrame>             m_PendingFrames;
 };
 
 
@@ -174,4 +345,22 @@ void CreateOffScreenSwapChain(IRenderDevice* pDevice, IDeviceContext* pContext,
     }
 }
 
+void CreateOffScreenSwapChain(IRenderDevice*                           pDevice,
+                              IDeviceContext*                          pContext,
+                              const SwapChainDesc&                     SCDesc,
+                              const OffScreenSwapChainReadbackAttribs& ReadbackAttribs,
+                              ISwapChain**                             ppSwapChain)
+{
+    try
+    {
+        RefCntAutoPtr<ISwapChain> pSwapChain{MakeNewRCObj<OffScreenSwapChain>()(pDevice, pContext, SCDesc, ReadbackAttribs)};
+        if (pSwapChain)
+            pSwapChain->QueryInterface(IID_SwapChain, reinterpret_cast<IObject**>(ppSwapChain));
+    }
+    catch (...)
+    {
+        LOG_ERROR("Failed to create off-screen swap chain");
+    }
+}
+
 } // namespace Diligent
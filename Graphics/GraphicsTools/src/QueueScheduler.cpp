@@ -0,0 +1,204 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "QueueScheduler.hpp"
+
+#include <string>
+
+#include "ScopedDebugGroup.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+QueueScheduler::QueueScheduler(IRenderDevice*         pDevice,
+                               IDeviceContext* const* ppContexts,
+                               Uint32                 NumContexts)
+{
+    DEV_CHECK_ERR(pDevice != nullptr, "Render device must not be null");
+    DEV_CHECK_ERR(NumContexts > 0 && ppContexts != nullptr, "At least one context must be provided");
+
+    m_Contexts.resize(NumContexts);
+    for (Uint32 ctx = 0; ctx < NumContexts; ++ctx)
+    {
+        auto& Ctx = m_Contexts[ctx];
+
+        Ctx.pContext = ppContexts[ctx];
+        DEV_CHECK_ERR(Ctx.pContext, "Context ", ctx, " must not be null");
+        DEV_CHECK_ERR(!Ctx.pContext->GetDesc().IsDeferred, "Context ", ctx, " must be an immediate context");
+
+        const std::string Name = std::string{"QueueScheduler fence for context "} + Ctx.pContext->GetDesc().Name;
+
+        FenceDesc Desc;
+        Desc.Name = Name.c_str();
+        // The fence is waited for by the other contexts on the GPU
+        Desc.Type = FENCE_TYPE_GENERAL;
+        pDevice->CreateFence(Desc, &Ctx.pFence);
+        DEV_CHECK_ERR(Ctx.pFence, "Failed to create fence");
+    }
+
+    m_WaitedValues.resize(size_t{NumContexts} * size_t{NumContexts});
+}
+
+QueueScheduler::PassHandle QueueScheduler::AddPass(const PassDesc& Desc, RecordPassCallbackType Callback)
+{
+    DEV_CHECK_ERR(Desc.ContextIndex < m_Contexts.size(), "Context index (", Desc.ContextIndex, ") is out of range");
+    DEV_CHECK_ERR(Desc.NumDependencies == 0 || Desc.pDependencies != nullptr, "pDependencies must not be null");
+    DEV_CHECK_ERR(Desc.NumBarriers == 0 || Desc.pBarriers != nullptr, "pBarriers must not be null");
+
+    const auto Handle = static_cast<PassHandle>(m_Passes.size());
+
+    m_Passes.emplace_back();
+    auto& Pass = m_Passes.back();
+
+    Pass.Name         = Desc.Name != nullptr ? Desc.Name : "";
+    Pass.ContextIndex = Desc.ContextIndex;
+    Pass.Callback     = std::move(Callback);
+
+    Pass.Dependencies.reserve(Desc.NumDependencies);
+    for (Uint32 i = 0; i < Desc.NumDependencies; ++i)
+    {
+        const auto Dependency = Desc.pDependencies[i];
+        // This also guarantees that the dependency graph has no cycles
+        DEV_CHECK_ERR(Dependency < Handle, "Pass '", Pass.Name, "' depends on pass ", Dependency, " that has not been added before it");
+        Pass.Dependencies.push_back(Dependency);
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    const auto ContextMask = Uint64{1} << m_Contexts[Desc.ContextIndex].pContext->GetDesc().ContextId;
+    for (Uint32 i = 0; i < Desc.NumBarriers; ++i)
+    {
+        const auto& Barrier = Desc.pBarriers[i];
+
+        Uint64 ImmediateContextMask = ~Uint64{0};
+        if (RefCntAutoPtr<ITexture> pTexture{Barrier.pResource, IID_Texture})
+            ImmediateContextMask = pTexture->GetDesc().ImmediateContextMask;
+        else if (RefCntAutoPtr<IBuffer> pBuffer{Barrier.pResource, IID_Buffer})
+            ImmediateContextMask = pBuffer->GetDesc().ImmediateContextMask;
+
+        DEV_CHECK_ERR((ImmediateContextMask & ContextMask) != 0, "Resource transitioned by pass '", Pass.Name,
+                      "' can't be used by the pass context. Add the context bit to the resource's ImmediateContextMask.");
+    }
+#endif
+    Pass.Barriers.assign(Desc.pBarriers, Desc.pBarriers + Desc.NumBarriers);
+
+    return Handle;
+}
+
+void QueueScheduler::Execute()
+{
+    const size_t NumContexts = m_Contexts.size();
+
+    // Only the passes that other contexts depend on need to be followed by a fence signal
+    std::vector<bool> SignalAfterPass(m_Passes.size(), false);
+    for (const auto& Pass : m_Passes)
+    {
+        for (auto Dependency : Pass.Dependencies)
+        {
+            if (m_Passes[Dependency].ContextIndex != Pass.ContextIndex)
+                SignalAfterPass[Dependency] = true;
+        }
+    }
+
+    // Fence values signaled after the passes
+    std::vector<Uint64> PassFenceValues(m_Passes.size(), 0);
+    // Indicates that the context has recorded commands that have not been flushed yet
+    std::vector<bool> HasPendingCommands(NumContexts, false);
+
+    for (size_t pass = 0; pass < m_Passes.size(); ++pass)
+    {
+        const auto& Pass = m_Passes[pass];
+        auto&       Ctx  = m_Contexts[Pass.ContextIndex];
+
+        for (auto Dependency : Pass.Dependencies)
+        {
+            const auto SrcContextIndex = m_Passes[Dependency].ContextIndex;
+            if (SrcContextIndex == Pass.ContextIndex)
+                continue; // Commands in the same queue are executed in order
+
+            // The dependency pass has been submitted before, so the value is never
+            // greater than the last pending value, which is required without native fences.
+            const auto FenceValue = PassFenceValues[Dependency];
+            VERIFY_EXPR(FenceValue != 0);
+
+            auto& WaitedValue = m_WaitedValues[Pass.ContextIndex * NumContexts + SrcContextIndex];
+            if (WaitedValue < FenceValue)
+            {
+                Ctx.pContext->DeviceWaitForFence(m_Contexts[SrcContextIndex].pFence, FenceValue);
+                WaitedValue = FenceValue;
+            }
+        }
+
+        {
+            ScopedDebugGroup DebugGroup;
+            if (!Pass.Name.empty())
+                DebugGroup = ScopedDebugGroup{Ctx.pContext, Pass.Name};
+
+            if (!Pass.Barriers.empty())
+                Ctx.pContext->TransitionResourceStates(static_cast<Uint32>(Pass.Barriers.size()), Pass.Barriers.data());
+
+            if (Pass.Callback)
+                Pass.Callback(Ctx.pContext);
+        }
+        HasPendingCommands[Pass.ContextIndex] = true;
+
+        if (SignalAfterPass[pass])
+        {
+            PassFenceValues[pass] = ++Ctx.LastSignaledValue;
+            Ctx.pContext->EnqueueSignal(Ctx.pFence, Ctx.LastSignaledValue);
+            Ctx.pContext->Flush();
+            HasPendingCommands[Pass.ContextIndex] = false;
+        }
+    }
+
+    // Submit the remaining work and signal the fences so that the application can
+    // wait for the completion of all passes
+    for (size_t ctx = 0; ctx < NumContexts; ++ctx)
+    {
+        if (!HasPendingCommands[ctx])
+            continue;
+
+        auto& Ctx = m_Contexts[ctx];
+        Ctx.pContext->EnqueueSignal(Ctx.pFence, ++Ctx.LastSignaledValue);
+        Ctx.pContext->Flush();
+    }
+
+    m_Passes.clear();
+}
+
+IFence* QueueScheduler::GetFence(Uint32 ContextIndex) const
+{
+    DEV_CHECK_ERR(ContextIndex < m_Contexts.size(), "Context index (", ContextIndex, ") is out of range");
+    return m_Contexts[ContextIndex].pFence;
+}
+
+Uint64 QueueScheduler::GetLastSignaledValue(Uint32 ContextIndex) const
+{
+    DEV_CHECK_ERR(ContextIndex < m_Contexts.size(), "Context index (", ContextIndex, ") is out of range");
+    return m_Contexts[ContextIndex].LastSignaledValue;
+}
+
+} // namespace Diligent
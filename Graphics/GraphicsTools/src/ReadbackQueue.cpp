@@ -0,0 +1,452 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ReadbackQueue.h"
+
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <vector>
+#include <cstring>
+
+#include "GPUCompletionAwaitQueue.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct PendingRead
+{
+    RefCntAutoPtr<IBuffer>  pStagingBuffer;
+    RefCntAutoPtr<ITexture> pStagingTexture;
+
+    Uint64 Size   = 0;
+    Uint32 Width  = 0;
+    Uint32 Height = 0;
+
+    ReadbackCallbackType Callback;
+
+    PendingRead() noexcept {}
+
+    // clang-format off
+    PendingRead           (const PendingRead&) = delete;
+    PendingRead& operator=(const PendingRead&) = delete;
+    // clang-format on
+
+    PendingRead(PendingRead&& rhs) noexcept :
+        pStagingBuffer{std::move(rhs.pStagingBuffer)},
+        pStagingTexture{std::move(rhs.pStagingTexture)},
+        Size{rhs.Size},
+        Width{rhs.Width},
+        Height{rhs.Height},
+        Callback{std::move(rhs.Callback)}
+    {
+        rhs.Callback = nullptr;
+    }
+
+    PendingRead& operator=(PendingRead&& rhs) noexcept
+    {
+        Fail();
+        pStagingBuffer  = std::move(rhs.pStagingBuffer);
+        pStagingTexture = std::move(rhs.pStagingTexture);
+        Size            = rhs.Size;
+        Width           = rhs.Width;
+        Height          = rhs.Height;
+        Callback        = std::move(rhs.Callback);
+        rhs.Callback    = nullptr;
+        return *this;
+    }
+
+    ~PendingRead()
+    {
+        // Reads that were never completed (e.g. when the queue is destroyed)
+        // still invoke the callback exactly once.
+        Fail();
+    }
+
+    void Fail()
+    {
+        if (Callback)
+        {
+            auto Cb  = std::move(Callback);
+            Callback = nullptr;
+            Cb(ReadbackData{});
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return pStagingBuffer || pStagingTexture;
+    }
+};
+
+} // namespace
+
+
+class ReadbackQueueImpl final : public ObjectBase<IReadbackQueue>
+{
+public:
+    using TBase = ObjectBase<IReadbackQueue>;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ReadbackQueue, TBase)
+
+    ReadbackQueueImpl(IReferenceCounters*            pRefCounters,
+                      IRenderDevice*                 pDevice,
+                      const ReadbackQueueCreateInfo& CreateInfo) :
+        TBase{pRefCounters},
+        m_pDevice{pDevice},
+        m_Name{CreateInfo.Name != nullptr ? CreateInfo.Name : "Readback queue"},
+        m_MaxPooledMemorySize{CreateInfo.MaxPooledMemorySize},
+        m_DeferCallbacks{CreateInfo.DeferCallbacks},
+        m_PendingReads{pDevice}
+    {
+        if (pDevice == nullptr)
+            LOG_ERROR_AND_THROW("Render device must not be null");
+    }
+
+    ~ReadbackQueueImpl()
+    {
+        // Deliver the data that has already been read back
+        InvokeCallbacks();
+    }
+
+    virtual void ReadBuffer(IDeviceContext*                pContext,
+                            IBuffer*                       pSrcBuffer,
+                            Uint64                         Offset,
+                            Uint64                         Size,
+                            ReadbackCallbackType           Callback,
+                            RESOURCE_STATE_TRANSITION_MODE TransitionMode) override final
+    {
+        DEV_CHECK_ERR(pContext != nullptr && pSrcBuffer != nullptr, "Context and source buffer must not be null");
+        DEV_CHECK_ERR(Offset + Size <= pSrcBuffer->GetDesc().Size, "The region [", Offset, ", ", Offset + Size,
+                      ") is out of bounds of buffer '", pSrcBuffer->GetDesc().Name, "'");
+
+        PendingRead Read;
+        Read.Callback = std::move(Callback);
+        Read.Size     = Size;
+        if (Size == 0)
+        {
+            Read.Callback(ReadbackData{});
+            Read.Callback = nullptr;
+            return;
+        }
+
+        Read.pStagingBuffer = GetStagingBuffer(Size);
+        if (!Read.pStagingBuffer)
+            return;
+
+        pContext->CopyBuffer(pSrcBuffer, Offset, TransitionMode, Read.pStagingBuffer, 0, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_PendingReads.Enqueue(pContext, std::move(Read));
+        m_NumPendingReads.fetch_add(1);
+    }
+
+    virtual void ReadTexture(IDeviceContext*                pContext,
+                             ITexture*                      pSrcTexture,
+                             Uint32                         MipLevel,
+                             Uint32                         Slice,
+                             const Box*                     pSrcBox,
+                             ReadbackCallbackType           Callback,
+                             RESOURCE_STATE_TRANSITION_MODE TransitionMode) override final
+    {
+        DEV_CHECK_ERR(pContext != nullptr && pSrcTexture != nullptr, "Context and source texture must not be null");
+
+        const auto& SrcDesc = pSrcTexture->GetDesc();
+        const auto  MipProps = GetMipLevelProperties(SrcDesc, MipLevel);
+
+        Box Region = pSrcBox != nullptr ? *pSrcBox : Box{0, MipProps.LogicalWidth, 0, MipProps.LogicalHeight};
+        DEV_CHECK_ERR(Region.IsValid() && Region.MaxX <= MipProps.StorageWidth && Region.MaxY <= MipProps.StorageHeight,
+                      "Invalid source region for texture '", SrcDesc.Name, "'");
+
+        PendingRead Read;
+        Read.Callback = std::move(Callback);
+        Read.Width    = Region.Width();
+        Read.Height   = Region.Height();
+
+        Read.pStagingTexture = GetStagingTexture(Read.Width, Read.Height, SrcDesc.Format);
+        if (!Read.pStagingTexture)
+            return;
+
+        CopyTextureAttribs CopyAttribs{pSrcTexture, TransitionMode, Read.pStagingTexture, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        CopyAttribs.SrcMipLevel = MipLevel;
+        CopyAttribs.SrcSlice    = Slice;
+        CopyAttribs.pSrcBox     = &Region;
+        pContext->CopyTexture(CopyAttribs);
+
+        m_PendingReads.Enqueue(pContext, std::move(Read));
+        m_NumPendingReads.fetch_add(1);
+    }
+
+    virtual Uint32 ProcessCompleted(IDeviceContext* pContext) override final
+    {
+        DEV_CHECK_ERR(pContext != nullptr, "Context must not be null");
+
+        Uint32 NumCompleted = 0;
+        while (auto Read = m_PendingReads.GetFirstCompleted())
+        {
+            m_NumPendingReads.fetch_add(-1);
+            if (Read.pStagingBuffer)
+                ProcessBufferRead(pContext, Read);
+            else
+                ProcessTextureRead(pContext, Read);
+            ++NumCompleted;
+        }
+        return NumCompleted;
+    }
+
+    virtual Uint32 InvokeCallbacks() override final
+    {
+        std::vector<DeferredCallback> Callbacks;
+        {
+            std::lock_guard<std::mutex> Lock{m_DeferredCallbacksMtx};
+            Callbacks.swap(m_DeferredCallbacks);
+        }
+
+        for (auto& Cb : Callbacks)
+        {
+            ReadbackData Data;
+            Data.pData     = Cb.Data.data();
+            Data.DataSize  = Cb.Data.size();
+            Data.RowStride = Cb.RowStride;
+            Data.Width     = Cb.Width;
+            Data.Height    = Cb.Height;
+            Cb.Callback(Data);
+        }
+
+        return static_cast<Uint32>(Callbacks.size());
+    }
+
+    virtual Uint32 GetNumPendingReads() const override final
+    {
+        return static_cast<Uint32>(m_NumPendingReads.load());
+    }
+
+    virtual Uint64 GetPooledMemorySize() const override final
+    {
+        return m_PooledMemorySize;
+    }
+
+private:
+    RefCntAutoPtr<IBuffer> GetStagingBuffer(Uint64 Size)
+    {
+        auto it = m_AvailableBuffers.lower_bound(Size);
+        if (it != m_AvailableBuffers.end())
+        {
+            auto pBuffer = std::move(it->second);
+            m_PooledMemorySize -= it->first;
+            m_AvailableBuffers.erase(it);
+            return pBuffer;
+        }
+
+        const auto Name = m_Name + " - staging buffer";
+
+        // Round the size up to the power of two so that buffers can be reused by similar reads
+        const auto BufferSize = std::max(IsPowerOfTwo(Size) ? Size : (Uint64{1} << (PlatformMisc::GetMSB(Size) + 1)), Uint64{256});
+
+        BufferDesc Desc;
+        Desc.Name           = Name.c_str();
+        Desc.Size           = BufferSize;
+        Desc.Usage          = USAGE_STAGING;
+        Desc.CPUAccessFlags = CPU_ACCESS_READ;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        m_pDevice->CreateBuffer(Desc, nullptr, &pBuffer);
+        if (!pBuffer)
+            LOG_ERROR_MESSAGE("Failed to create staging buffer of size ", Desc.Size, " for readback queue '", m_Name, "'");
+        return pBuffer;
+    }
+
+    RefCntAutoPtr<ITexture> GetStagingTexture(Uint32 Width, Uint32 Height, TEXTURE_FORMAT Format)
+    {
+        for (auto it = m_AvailableTextures.begin(); it != m_AvailableTextures.end(); ++it)
+        {
+            const auto& Desc = (*it)->GetDesc();
+            if (Desc.Width == Width && Desc.Height == Height && Desc.Format == Format)
+            {
+                auto pTexture = std::move(*it);
+                m_PooledMemorySize -= GetMipLevelProperties(Desc, 0).MipSize;
+                m_AvailableTextures.erase(it);
+                return pTexture;
+            }
+        }
+
+        const auto Name = m_Name + " - staging texture";
+
+        TextureDesc Desc;
+        Desc.Name           = Name.c_str();
+        Desc.Type           = RESOURCE_DIM_TEX_2D;
+        Desc.Width          = Width;
+        Desc.Height         = Height;
+        Desc.Format         = Format;
+        Desc.Usage          = USAGE_STAGING;
+        Desc.CPUAccessFlags = CPU_ACCESS_READ;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        m_pDevice->CreateTexture(Desc, nullptr, &pTexture);
+        if (!pTexture)
+            LOG_ERROR_MESSAGE("Failed to create ", Width, "x", Height, " staging texture for readback queue '", m_Name, "'");
+        return pTexture;
+    }
+
+    bool CanPool(Uint64 Size) const
+    {
+        return m_MaxPooledMemorySize == 0 || m_PooledMemorySize + Size <= m_MaxPooledMemorySize;
+    }
+
+    void ProcessBufferRead(IDeviceContext* pContext, PendingRead& Read)
+    {
+        // The fence has been signaled, so mapping never waits for the GPU
+        PVoid pMappedData = nullptr;
+        pContext->MapBuffer(Read.pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pMappedData);
+        if (pMappedData != nullptr)
+        {
+            ReadbackData Data;
+            Data.pData    = pMappedData;
+            Data.DataSize = Read.Size;
+            Deliver(Read, Data);
+            pContext->UnmapBuffer(Read.pStagingBuffer, MAP_READ);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map staging buffer in readback queue '", m_Name, "'");
+            Read.Fail();
+        }
+
+        const auto BufferSize = Read.pStagingBuffer->GetDesc().Size;
+        if (CanPool(BufferSize))
+        {
+            m_PooledMemorySize += BufferSize;
+            m_AvailableBuffers.emplace(BufferSize, std::move(Read.pStagingBuffer));
+        }
+    }
+
+    void ProcessTextureRead(IDeviceContext* pContext, PendingRead& Read)
+    {
+        const auto& Desc     = Read.pStagingTexture->GetDesc();
+        const auto  MipProps = GetMipLevelProperties(Desc, 0);
+
+        MappedTextureSubresource MappedData;
+        pContext->MapTextureSubresource(Read.pStagingTexture, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        if (MappedData.pData != nullptr)
+        {
+            const auto NumRows = MipProps.RowSize != 0 ? MipProps.DepthSliceSize / MipProps.RowSize : 0;
+
+            ReadbackData Data;
+            Data.pData     = MappedData.pData;
+            Data.RowStride = MappedData.Stride;
+            Data.DataSize  = NumRows > 0 ? MappedData.Stride * (NumRows - 1) + MipProps.RowSize : 0;
+            Data.Width     = Read.Width;
+            Data.Height    = Read.Height;
+            Deliver(Read, Data);
+            pContext->UnmapTextureSubresource(Read.pStagingTexture, 0, 0);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to map staging texture in readback queue '", m_Name, "'");
+            Read.Fail();
+        }
+
+        if (CanPool(MipProps.MipSize))
+        {
+            m_PooledMemorySize += MipProps.MipSize;
+            m_AvailableTextures.emplace_back(std::move(Read.pStagingTexture));
+        }
+    }
+
+    void Deliver(PendingRead& Read, const ReadbackData& Data)
+    {
+        auto Callback = std::move(Read.Callback);
+        Read.Callback = nullptr;
+
+        if (!m_DeferCallbacks)
+        {
+            Callback(Data);
+            return;
+        }
+
+        DeferredCallback Deferred;
+        Deferred.Callback  = std::move(Callback);
+        Deferred.RowStride = Data.RowStride;
+        Deferred.Width     = Data.Width;
+        Deferred.Height    = Data.Height;
+        Deferred.Data.resize(static_cast<size_t>(Data.DataSize));
+        if (Data.DataSize > 0)
+            std::memcpy(Deferred.Data.data(), Data.pData, static_cast<size_t>(Data.DataSize));
+
+        std::lock_guard<std::mutex> Lock{m_DeferredCallbacksMtx};
+        m_DeferredCallbacks.emplace_back(std::move(Deferred));
+    }
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const std::string m_Name;
+    const Uint64      m_MaxPooledMemorySize;
+    const bool        m_DeferCallbacks;
+
+    GPUCompletionAwaitQueue<PendingRead> m_PendingReads;
+    std::atomic<Int32>                   m_NumPendingReads{0};
+
+    // Available staging buffers sorted by size
+    std::multimap<Uint64, RefCntAutoPtr<IBuffer>> m_AvailableBuffers;
+    std::vector<RefCntAutoPtr<ITexture>>          m_AvailableTextures;
+    Uint64                                        m_PooledMemorySize = 0;
+
+    struct DeferredCallback
+    {
+        ReadbackCallbackType Callback;
+        std::vector<Uint8>   Data;
+        Uint64               RowStride = 0;
+        Uint32               Width     = 0;
+        Uint32               Height    = 0;
+    };
+    std::mutex                    m_DeferredCallbacksMtx;
+    std::vector<DeferredCallback> m_DeferredCallbacks;
+};
+
+
+void CreateReadbackQueue(IRenderDevice*                 pDevice,
+                         const ReadbackQueueCreateInfo& CreateInfo,
+                         IReadbackQueue**               ppReadbackQueue)
+{
+    try
+    {
+        auto* pQueue = MakeNewRCObj<ReadbackQueueImpl>()(pDevice, CreateInfo);
+        pQueue->QueryInterface(IID_ReadbackQueue, reinterpret_cast<IObject**>(ppReadbackQueue));
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create readback queue");
+    }
+}
+
+} // namespace Diligent
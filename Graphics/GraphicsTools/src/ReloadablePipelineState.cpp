@@ -38,6 +38,8 @@ constexpr INTERFACE_ID ReloadablePipelineState::IID_InternalImpl;
 struct ReloadablePipelineState::CreateInfoWrapperBase
 {
     virtual ~CreateInfoWrapperBase() {}
+
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const = 0;
 };
 
 template <typename CreateInfoType>
@@ -74,6 +76,16 @@ struct ReloadablePipelineState::CreateInfoWrapper : CreateInfoWrapperBase
         return m_CI;
     }
 
+    virtual bool UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const override final
+    {
+        bool UsesShader = false;
+        ProcessPipelineStateCreateInfoShaders(static_cast<const CreateInfoType&>(m_CI), [&](const IShader* pShader) {
+            if (pShader != nullptr && Shaders.find(pShader) != Shaders.end())
+                UsesShader = true;
+        });
+        return UsesShader;
+    }
+
 protected:
     typename PipelineStateCreateInfoXTraits<CreateInfoType>::CreateInfoXType m_CI;
 };
@@ -132,6 +144,10 @@ void ReloadablePipelineState::QueryInterface(const INTERFACE_ID& IID, IObject**
     }
     else
     {
+        // Device contexts request the implementation when the pipeline is bound, which
+        // is where the reloaded pipeline replaces the current one once it is ready.
+        UpdatePendingPipeline(/*WaitForCompletion = */ false);
+
         // This will handle implementation-specific interfaces such as PipelineStateD3D11Impl::IID_InternalImpl,
         // PipelineStateD3D12Impl::IID_InternalImpl, etc. requested by e.g. device context implementations
         // (DeviceContextD3D11Impl::SetPipelineState, DeviceContextD3D12Impl::SetPipelineState, etc.)
@@ -168,19 +184,14 @@ bool ReloadablePipelineState::Reload(ReloadGraphicsPipelineCallbackType ReloadGr
     {
         if (m_pPipeline != pNewPSO)
         {
-            // Do not update old pipeline if it is not null.
-            // If multiple reloads are requested, we need to keep the original pipeline that keeps the original resources.
-            if (!m_pOldPipeline)
-            {
-                m_pOldPipeline = m_pPipeline;
-            }
-            m_pPipeline = pNewPSO;
-
-            // If any of the pipelines is not ready, we will copy static resources when both are ready in GetStatus()
-            if (m_pPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY && m_pOldPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY)
-            {
-                CopyStaticResources();
-            }
+            // If the previous reload has not finished yet, the new pipeline replaces it.
+            // The current pipeline is used until the new one is ready.
+            m_pPendingPipeline = std::move(pNewPSO);
+            UpdatePendingPipeline(/*WaitForCompletion = */ false);
+        }
+        else
+        {
+            m_pPendingPipeline.Release();
         }
     }
     else
@@ -215,8 +226,45 @@ void ReloadablePipelineState::CopyStaticResources()
 }
 
 
+void ReloadablePipelineState::UpdatePendingPipeline(bool WaitForCompletion)
+{
+    if (!m_pPendingPipeline)
+        return;
+
+    const PIPELINE_STATE_STATUS Status = m_pPendingPipeline->GetStatus(WaitForCompletion);
+    if (Status == PIPELINE_STATE_STATUS_READY)
+    {
+        // Do not update old pipeline if it is not null.
+        // If multiple reloads are requested, we need to keep the original pipeline that keeps the original resources.
+        if (!m_pOldPipeline)
+        {
+            m_pOldPipeline = m_pPipeline;
+        }
+        m_pPipeline = std::move(m_pPendingPipeline);
+
+        // If the old pipeline is not ready, we will copy static resources when it is ready in GetStatus()
+        if (m_pOldPipeline->GetStatus() == PIPELINE_STATE_STATUS_READY)
+        {
+            CopyStaticResources();
+        }
+    }
+    else if (Status == PIPELINE_STATE_STATUS_FAILED)
+    {
+        const auto* Name = m_pPipeline->GetDesc().Name;
+        LOG_ERROR_MESSAGE("Failed to reload pipeline state '", (Name ? Name : "<unnamed>"), "'. The previous version will be used.");
+        m_pPendingPipeline.Release();
+    }
+}
+
+bool ReloadablePipelineState::UsesAnyShader(const std::unordered_set<const IShader*>& Shaders) const
+{
+    return m_pCreateInfo && m_pCreateInfo->UsesAnyShader(Shaders);
+}
+
 PIPELINE_STATE_STATUS ReloadablePipelineState::GetStatus(bool WaitForCompletion)
 {
+    UpdatePendingPipeline(WaitForCompletion);
+
     const PIPELINE_STATE_STATUS Status = m_pPipeline ? m_pPipeline->GetStatus(WaitForCompletion) : PIPELINE_STATE_STATUS_FAILED;
     if (Status != PIPELINE_STATE_STATUS_READY)
         return Status;
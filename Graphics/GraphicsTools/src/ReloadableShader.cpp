@@ -26,16 +26,19 @@
 
 #include "ReloadableShader.hpp"
 #include "RenderStateCacheImpl.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
 
 constexpr INTERFACE_ID ReloadableShader::IID_InternalImpl;
 
-ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
-                                   RenderStateCacheImpl*   pStateCache,
-                                   IShader*                pShader,
-                                   const ShaderCreateInfo& CreateInfo) :
+ReloadableShader::ReloadableShader(IReferenceCounters*              pRefCounters,
+                                   RenderStateCacheImpl*            pStateCache,
+                                   IShader*                         pShader,
+                                   const ShaderCreateInfo&          CreateInfo,
+                                   IShaderSourceInputStreamFactory* pOriginalSourceFactory) :
     TBase{pRefCounters},
     m_pStateCache{pStateCache},
     m_pShader{pShader},
@@ -45,6 +48,9 @@ ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+    // Hash the files the shader was actually compiled from, so that the files that are
+    // different in the reload source are detected by the first reload.
+    UpdateSourceFiles(pOriginalSourceFactory);
 }
 
 ReloadableShader::~ReloadableShader()
@@ -81,14 +87,28 @@ void ReloadableShader::QueryInterface(const INTERFACE_ID& IID, IObject** ppInter
     }
 }
 
-bool ReloadableShader::Reload()
+bool ReloadableShader::Reload(bool CompileAsync)
 {
     RefCntAutoPtr<IShader> pNewShader;
 
-    const bool FoundInCache = m_pStateCache->CreateShaderInternal(m_CreateInfo, &pNewShader);
+    ShaderCreateInfo ShaderCI = m_CreateInfo;
+    if (CompileAsync)
+        ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+    const bool FoundInCache = m_pStateCache->CreateShaderInternal(ShaderCI, &pNewShader);
+    // Record the current versions of the source files even if the compilation fails,
+    // so that the shader is not reloaded again until the files change.
+    UpdateSourceFiles(m_CreateInfo.Get().pShaderSourceStreamFactory);
+
     if (pNewShader)
     {
-        m_pShader = pNewShader;
+        if (pNewShader != m_pShader)
+        {
+            // If the previous reload has not finished yet, keep the version that was compiled successfully
+            if (!m_pPrevShader)
+                m_pPrevShader = m_pShader;
+            m_pShader = pNewShader;
+        }
     }
     else
     {
@@ -98,15 +118,78 @@ bool ReloadableShader::Reload()
     return !FoundInCache;
 }
 
+SHADER_STATUS ReloadableShader::GetStatus(bool WaitForCompletion)
+{
+    SHADER_STATUS Status = m_pShader->GetStatus(WaitForCompletion);
+    if (m_pPrevShader)
+    {
+        if (Status == SHADER_STATUS_READY)
+        {
+            m_pPrevShader.Release();
+        }
+        else if (Status == SHADER_STATUS_FAILED)
+        {
+            // Keep the previous version of the shader
+            const char* Name = m_CreateInfo.Get().Desc.Name;
+            LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'. The previous version will be used.");
+            m_pShader = std::move(m_pPrevShader);
+            Status    = m_pShader->GetStatus(WaitForCompletion);
+        }
+    }
+    return Status;
+}
+
+void ReloadableShader::UpdateSourceFiles(IShaderSourceInputStreamFactory* pSourceFactory)
+{
+    m_SourceFiles.clear();
+    m_SourceFilesValid = false;
+
+    ShaderCreateInfo ShaderCI           = m_CreateInfo;
+    ShaderCI.pShaderSourceStreamFactory = pSourceFactory;
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
+    {
+        // The shader is created from byte code, there is nothing to track
+        m_SourceFilesValid = true;
+        return;
+    }
+    if (ShaderCI.Source == nullptr && ShaderCI.pShaderSourceStreamFactory == nullptr)
+    {
+        // The files can't be loaded, so the shader will be reloaded every time
+        return;
+    }
+
+    m_SourceFilesValid = ProcessShaderIncludes(
+        ShaderCI,
+        [this](const ShaderIncludePreprocessInfo& FileInfo) {
+            // The main source that is not loaded from a file can't change
+            if (!FileInfo.FilePath.empty())
+                m_SourceFiles.push_back({FileInfo.FilePath, ComputeHashRaw(FileInfo.Source, FileInfo.SourceLength)});
+        });
+}
+
+bool ReloadableShader::HasSourceChanged(const std::function<size_t(const std::string&)>& GetFileHash) const
+{
+    if (!m_SourceFilesValid)
+        return true;
+
+    for (const SourceFileInfo& File : m_SourceFiles)
+    {
+        if (GetFileHash(File.Path) != File.Hash)
+            return true;
+    }
+    return false;
+}
+
 
-void ReloadableShader::Create(RenderStateCacheImpl*   pStateCache,
-                              IShader*                pShader,
-                              const ShaderCreateInfo& CreateInfo,
-                              IShader**               ppReloadableShader)
+void ReloadableShader::Create(RenderStateCacheImpl*            pStateCache,
+                              IShader*                         pShader,
+                              const ShaderCreateInfo&          CreateInfo,
+                              IShaderSourceInputStreamFactory* pOriginalSourceFactory,
+                              IShader**                        ppReloadableShader)
 {
     try
     {
-        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo)};
+        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo, pOriginalSourceFactory)};
         *ppReloadableShader = pReloadableShader.Detach();
     }
     catch (...)
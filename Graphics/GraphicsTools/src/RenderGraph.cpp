@@ -0,0 +1,476 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RenderGraph.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+TransientTextureAllocatorCreateInfo GetAllocatorCreateInfo(const RenderGraphCreateInfo& CreateInfo)
+{
+    TransientTextureAllocatorCreateInfo AllocatorCI;
+    AllocatorCI.Name             = CreateInfo.Name;
+    AllocatorCI.EnableAliasing   = CreateInfo.EnableAliasing;
+    AllocatorCI.EnableMemoryless = CreateInfo.EnableMemoryless;
+    return AllocatorCI;
+}
+
+bool IsReadOnlyState(RESOURCE_STATE State)
+{
+    return (State & ~RESOURCE_STATE_GENERIC_READ) == 0;
+}
+
+} // namespace
+
+RenderGraphPassBuilder& RenderGraphPassBuilder::Read(Uint32 Resource, RESOURCE_STATE State)
+{
+    m_Graph.AddPassAccess(m_Pass, Resource, State, false);
+    return *this;
+}
+
+RenderGraphPassBuilder& RenderGraphPassBuilder::Write(Uint32 Resource, RESOURCE_STATE State)
+{
+    m_Graph.AddPassAccess(m_Pass, Resource, State, true);
+    return *this;
+}
+
+RenderGraphPassBuilder& RenderGraphPassBuilder::SetSideEffects()
+{
+    m_Graph.m_Passes[m_Pass].HasSideEffects = true;
+    return *this;
+}
+
+
+RenderGraph::RenderGraph(IRenderDevice* pDevice, const RenderGraphCreateInfo& CreateInfo) :
+    m_pDevice{pDevice},
+    m_Name{CreateInfo.Name != nullptr ? CreateInfo.Name : "Render graph"},
+    m_EnablePassCulling{CreateInfo.EnablePassCulling},
+    m_Allocator{pDevice, GetAllocatorCreateInfo(CreateInfo)}
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+}
+
+void RenderGraph::Reset()
+{
+    m_Resources.clear();
+    m_Passes.clear();
+    m_Transitions.clear();
+    m_FirstFinalTransition = 0;
+    m_NumTransitionBatches = 0;
+    m_IsCompiled           = false;
+}
+
+Uint32 RenderGraph::ImportTexture(ITexture* pTexture, RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "pTexture must not be null");
+    DEV_CHECK_ERR(pTexture->GetState() != RESOURCE_STATE_UNKNOWN, "The state of imported texture '", pTexture->GetDesc().Name, "' is unknown");
+
+    ResourceInfo Res;
+    Res.pTexture   = pTexture;
+    Res.IsImported = true;
+    Res.FinalState = FinalState;
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return static_cast<Uint32>(m_Resources.size() - 1);
+}
+
+Uint32 RenderGraph::ImportBuffer(IBuffer* pBuffer, RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pBuffer != nullptr, "pBuffer must not be null");
+    DEV_CHECK_ERR(pBuffer->GetState() != RESOURCE_STATE_UNKNOWN, "The state of imported buffer '", pBuffer->GetDesc().Name, "' is unknown");
+
+    ResourceInfo Res;
+    Res.pBuffer    = pBuffer;
+    Res.IsImported = true;
+    Res.FinalState = FinalState;
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return static_cast<Uint32>(m_Resources.size() - 1);
+}
+
+Uint32 RenderGraph::CreateTexture(const TextureDesc& Desc, TRANSIENT_TEXTURE_FLAGS Flags)
+{
+    ResourceInfo Res;
+    Res.Desc  = Desc;
+    Res.Flags = Flags;
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return static_cast<Uint32>(m_Resources.size() - 1);
+}
+
+RenderGraphPassBuilder RenderGraph::AddPass(const Char* Name, RenderGraphExecuteCallbackType Execute)
+{
+    DEV_CHECK_ERR(Execute, "Execute callback must not be null");
+
+    PassInfo Pass;
+    Pass.Name    = Name != nullptr ? Name : "";
+    Pass.Execute = std::move(Execute);
+    m_Passes.emplace_back(std::move(Pass));
+    m_IsCompiled = false;
+    return RenderGraphPassBuilder{*this, static_cast<Uint32>(m_Passes.size() - 1)};
+}
+
+void RenderGraph::AddPassAccess(Uint32 Pass, Uint32 Resource, RESOURCE_STATE State, bool IsWrite)
+{
+    DEV_CHECK_ERR(Resource < m_Resources.size(), "Resource handle ", Resource, " is out of range");
+    DEV_CHECK_ERR(State != RESOURCE_STATE_UNKNOWN && State != RESOURCE_STATE_UNDEFINED, "Resource state must be known");
+
+    auto& Accesses = m_Passes[Pass].Accesses;
+    auto  it       = std::find_if(Accesses.begin(), Accesses.end(), [Resource](const ResourceAccess& Access) { return Access.Resource == Resource; });
+    if (it == Accesses.end())
+    {
+        ResourceAccess Access;
+        Access.Resource = Resource;
+        Access.State    = State;
+        Access.IsRead   = !IsWrite;
+        Access.IsWrite  = IsWrite;
+        Accesses.emplace_back(Access);
+        return;
+    }
+
+    // The resource is accessed by the pass in one state
+    if (it->State != State)
+    {
+        if (IsReadOnlyState(it->State) && IsReadOnlyState(State))
+        {
+            it->State |= State;
+        }
+        else
+        {
+            DEV_ERROR("Pass '", m_Passes[Pass].Name, "' accesses the same resource in incompatible states ",
+                      GetResourceStateString(it->State), " and ", GetResourceStateString(State));
+            if (IsWrite)
+                it->State = State;
+        }
+    }
+    it->IsRead  = it->IsRead || !IsWrite;
+    it->IsWrite = it->IsWrite || IsWrite;
+}
+
+IDeviceObject* RenderGraph::GetResourceObject(Uint32 Resource) const
+{
+    const auto& Res = m_Resources[Resource];
+    if (Res.pTexture)
+        return Res.pTexture;
+    return Res.pBuffer;
+}
+
+void RenderGraph::CullPasses()
+{
+    // Resources whose current contents are used by the passes processed so far.
+    // The contents of imported resources are always used.
+    std::vector<bool> IsUsed(m_Resources.size());
+    for (size_t Res = 0; Res < m_Resources.size(); ++Res)
+        IsUsed[Res] = m_Resources[Res].IsImported;
+
+    for (auto PassIt = m_Passes.rbegin(); PassIt != m_Passes.rend(); ++PassIt)
+    {
+        auto& Pass = *PassIt;
+
+        bool IsNeeded = !m_EnablePassCulling || Pass.HasSideEffects;
+        for (const auto& Access : Pass.Accesses)
+        {
+            if (Access.IsWrite && IsUsed[Access.Resource])
+                IsNeeded = true;
+        }
+        Pass.IsCulled = !IsNeeded;
+        if (Pass.IsCulled)
+            continue;
+
+        // Contents written by the pass are not needed before the pass,
+        // unless the pass reads them.
+        for (const auto& Access : Pass.Accesses)
+        {
+            if (Access.IsWrite && !Access.IsRead && !m_Resources[Access.Resource].IsImported)
+                IsUsed[Access.Resource] = false;
+        }
+        for (const auto& Access : Pass.Accesses)
+        {
+            if (Access.IsRead)
+                IsUsed[Access.Resource] = true;
+        }
+    }
+}
+
+void RenderGraph::ComputeTransitions()
+{
+    m_Transitions.clear();
+    m_NumTransitionBatches = 0;
+
+    std::vector<RESOURCE_STATE> CurrState(m_Resources.size(), RESOURCE_STATE_UNDEFINED);
+    for (Uint32 Res = 0; Res < m_Resources.size(); ++Res)
+    {
+        const auto& ResInfo = m_Resources[Res];
+        if (ResInfo.IsImported)
+        {
+            const auto State = ResInfo.pTexture ? ResInfo.pTexture->GetState() : ResInfo.pBuffer->GetState();
+            CurrState[Res]   = State != RESOURCE_STATE_UNKNOWN ? State : RESOURCE_STATE_UNDEFINED;
+        }
+    }
+
+    for (auto& Pass : m_Passes)
+    {
+        Pass.FirstTransition = m_Transitions.size();
+        Pass.NumTransitions  = 0;
+        if (Pass.IsCulled)
+            continue;
+
+        for (const auto& Access : Pass.Accesses)
+        {
+            auto& State = CurrState[Access.Resource];
+            // UAV to UAV transition between passes is required to make writes visible
+            if (State != Access.State || State == RESOURCE_STATE_UNORDERED_ACCESS)
+                m_Transitions.push_back({Access.Resource, State, Access.State});
+            State = Access.State;
+        }
+        Pass.NumTransitions = m_Transitions.size() - Pass.FirstTransition;
+        if (Pass.NumTransitions > 0)
+            ++m_NumTransitionBatches;
+    }
+
+    m_FirstFinalTransition = m_Transitions.size();
+    for (Uint32 Res = 0; Res < m_Resources.size(); ++Res)
+    {
+        auto& ResInfo    = m_Resources[Res];
+        ResInfo.EndState = CurrState[Res];
+        if (ResInfo.IsImported && ResInfo.FinalState != RESOURCE_STATE_UNKNOWN && CurrState[Res] != ResInfo.FinalState)
+            m_Transitions.push_back({Res, CurrState[Res], ResInfo.FinalState});
+    }
+    if (m_Transitions.size() > m_FirstFinalTransition)
+        ++m_NumTransitionBatches;
+}
+
+void RenderGraph::Compile(IDeviceContext* pContext)
+{
+    CullPasses();
+
+    // Compute lifetimes of transient textures
+    for (auto& Res : m_Resources)
+    {
+        Res.FirstPass = ~0u;
+        Res.LastPass  = 0;
+    }
+    for (Uint32 Pass = 0; Pass < m_Passes.size(); ++Pass)
+    {
+        if (m_Passes[Pass].IsCulled)
+            continue;
+        for (const auto& Access : m_Passes[Pass].Accesses)
+        {
+            auto& Res     = m_Resources[Access.Resource];
+            Res.FirstPass = std::min(Res.FirstPass, Pass);
+            Res.LastPass  = std::max(Res.LastPass, Pass);
+        }
+    }
+
+    m_Allocator.Reset();
+    for (auto& Res : m_Resources)
+    {
+        Res.AllocatorHandle = TransientTextureAllocator::InvalidHandle;
+        if (Res.IsImported)
+            continue;
+
+        Res.pTexture.Release();
+        // Textures that are only accessed by culled passes are not allocated
+        if (Res.FirstPass <= Res.LastPass)
+            Res.AllocatorHandle = m_Allocator.DeclareTexture(Res.Desc, Res.FirstPass, Res.LastPass, Res.Flags);
+    }
+    m_Allocator.Compile(m_pDevice, pContext);
+
+    for (auto& Res : m_Resources)
+    {
+        if (Res.AllocatorHandle != TransientTextureAllocator::InvalidHandle)
+        {
+            Res.pTexture = m_Allocator.GetTexture(Res.AllocatorHandle);
+            DEV_CHECK_ERR(Res.pTexture, "Failed to allocate transient texture '", (Res.Desc.Name != nullptr ? Res.Desc.Name : ""), "'");
+        }
+    }
+
+    ComputeTransitions();
+    m_IsCompiled = true;
+}
+
+void RenderGraph::RecordTransitions(IDeviceContext* pContext, size_t FirstTransition, size_t NumTransitions, bool UpdateState)
+{
+    if (NumTransitions == 0)
+        return;
+
+    std::vector<StateTransitionDesc> Barriers;
+    Barriers.reserve(NumTransitions);
+    for (size_t i = FirstTransition; i < FirstTransition + NumTransitions; ++i)
+    {
+        const auto& Trans = m_Transitions[i];
+
+        StateTransitionDesc Barrier;
+        Barrier.pResource = GetResourceObject(Trans.Resource);
+        Barrier.OldState  = Trans.OldState;
+        Barrier.NewState  = Trans.NewState;
+        Barrier.Flags     = UpdateState ? STATE_TRANSITION_FLAG_UPDATE_STATE : STATE_TRANSITION_FLAG_NONE;
+        if (Barrier.pResource != nullptr)
+            Barriers.push_back(Barrier);
+    }
+    pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+}
+
+void RenderGraph::RecordPass(IDeviceContext* pContext, Uint32 PassIdx, bool UpdateState)
+{
+    const auto& Pass = m_Passes[PassIdx];
+    VERIFY_EXPR(!Pass.IsCulled);
+
+    m_Allocator.BeginPass(pContext, PassIdx);
+    RecordTransitions(pContext, Pass.FirstTransition, Pass.NumTransitions, UpdateState);
+    Pass.Execute(pContext, *this);
+}
+
+void RenderGraph::Execute(IDeviceContext*        pContext,
+                          IDeviceContext* const* ppDeferredContexts,
+                          Uint32                 NumDeferredContexts,
+                          IThreadPool*           pThreadPool)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "pContext must not be null");
+    DEV_CHECK_ERR(m_IsCompiled, "Render graph '", m_Name, "' must be compiled before execution");
+
+    std::vector<Uint32> Passes;
+    for (Uint32 Pass = 0; Pass < m_Passes.size(); ++Pass)
+    {
+        if (!m_Passes[Pass].IsCulled)
+            Passes.push_back(Pass);
+    }
+
+    const Uint32 NumGroups = ppDeferredContexts != nullptr ? std::min(NumDeferredContexts, static_cast<Uint32>(Passes.size())) : 0;
+    if (NumGroups == 0)
+    {
+        for (Uint32 Pass : Passes)
+            RecordPass(pContext, Pass, true);
+    }
+    else
+    {
+        // Deferred contexts must not update resource states as they are recorded
+        // in parallel. The states are set after the command lists are executed.
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumGroups);
+
+        const Uint32 ImmediateContextId = pContext->GetDesc().ContextId;
+        ParallelFor(
+            pThreadPool, 0, NumGroups, 1,
+            [&](Uint32 Group) {
+                IDeviceContext* pDeferredCtx = ppDeferredContexts[Group];
+                pDeferredCtx->Begin(ImmediateContextId);
+
+                const size_t FirstPass = Passes.size() * Group / NumGroups;
+                const size_t EndPass   = Passes.size() * (Group + 1) / NumGroups;
+                for (size_t i = FirstPass; i < EndPass; ++i)
+                    RecordPass(pDeferredCtx, Passes[i], false);
+
+                pDeferredCtx->FinishCommandList(&CmdLists[Group]);
+            },
+            NumGroups);
+
+        std::vector<ICommandList*> pCmdLists(NumGroups);
+        for (Uint32 Group = 0; Group < NumGroups; ++Group)
+            pCmdLists[Group] = CmdLists[Group];
+        pContext->ExecuteCommandLists(NumGroups, pCmdLists.data());
+
+        for (Uint32 Group = 0; Group < NumGroups; ++Group)
+            ppDeferredContexts[Group]->FinishFrame();
+
+        // Several transient resources may share one texture object. The state
+        // of the object is defined by the resource that is used last.
+        std::unordered_map<IDeviceObject*, Uint32> LastResources;
+        for (Uint32 Res = 0; Res < m_Resources.size(); ++Res)
+        {
+            const auto& ResInfo = m_Resources[Res];
+            if (ResInfo.FirstPass > ResInfo.LastPass)
+                continue; // Not used by the executed passes
+
+            auto it = LastResources.emplace(GetResourceObject(Res), Res).first;
+            if (m_Resources[it->second].LastPass < ResInfo.LastPass)
+                it->second = Res;
+        }
+        for (const auto& it : LastResources)
+        {
+            const auto& ResInfo = m_Resources[it.second];
+            if (ResInfo.pTexture)
+                ResInfo.pTexture->SetState(ResInfo.EndState);
+            else if (ResInfo.pBuffer)
+                ResInfo.pBuffer->SetState(ResInfo.EndState);
+        }
+    }
+
+    RecordTransitions(pContext, m_FirstFinalTransition, m_Transitions.size() - m_FirstFinalTransition, true);
+}
+
+ITexture* RenderGraph::GetTexture(Uint32 Resource) const
+{
+    DEV_CHECK_ERR(Resource < m_Resources.size(), "Resource handle ", Resource, " is out of range");
+    return m_Resources[Resource].pTexture;
+}
+
+IBuffer* RenderGraph::GetBuffer(Uint32 Resource) const
+{
+    DEV_CHECK_ERR(Resource < m_Resources.size(), "Resource handle ", Resource, " is out of range");
+    return m_Resources[Resource].pBuffer;
+}
+
+bool RenderGraph::IsPassCulled(Uint32 Pass) const
+{
+    DEV_CHECK_ERR(Pass < m_Passes.size(), "Pass index ", Pass, " is out of range");
+    return m_Passes[Pass].IsCulled;
+}
+
+RenderGraphStats RenderGraph::GetStats() const
+{
+    RenderGraphStats Stats;
+    Stats.NumPasses = static_cast<Uint32>(m_Passes.size());
+    for (const auto& Pass : m_Passes)
+    {
+        if (Pass.IsCulled)
+            ++Stats.NumCulledPasses;
+    }
+    for (const auto& Res : m_Resources)
+    {
+        if (Res.AllocatorHandle != TransientTextureAllocator::InvalidHandle)
+            ++Stats.NumTransientTextures;
+    }
+    Stats.NumTransitions       = static_cast<Uint32>(m_Transitions.size());
+    Stats.NumTransitionBatches = m_NumTransitionBatches;
+    Stats.Allocator            = m_Allocator.GetStats();
+    return Stats;
+}
+
+} // namespace Diligent
@@ -32,8 +32,12 @@
 #include "ReloadablePipelineState.hpp"
 #include "AsyncPipelineState.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "Archiver.h"
@@ -46,14 +50,57 @@
 #include "SerializationDevice.h"
 #include "SerializedShader.h"
 #include "CallbackWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
 #include "GraphicsAccessories.hpp"
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
+#include "ShaderIncludeCache.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "HashUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+
+#include "ProxyDataBlob.hpp"
+#include "FileSystem.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
 
-Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+namespace
+{
+
+// Render state cache journal layout:
+//
+//  | JournalHeader | RecordHeader | Archive 0 | Padding | RecordHeader | Archive 1 | Padding | ...
+//
+// Every record contains an archive with the render states that were added to the cache
+// since the previous record. The size of each record is aligned to JournalRecordAlignment.
+struct JournalHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x4A535352; // 'RSSJ'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic   = ExpectedMagic;
+    Uint32 Version = ExpectedVersion;
+};
+static_assert(sizeof(JournalHeader) == 8, "Journal header size must not change");
+
+struct JournalRecordHeader
+{
+    static constexpr Uint32 ExpectedMagic = 0x5253534A; // 'JSSR'
+
+    Uint32 Magic    = ExpectedMagic;
+    Uint32 Reserved = 0;
+    Uint64 Size     = 0; // Archive size, without padding
+};
+static_assert(sizeof(JournalRecordHeader) == 16, "Journal record header size must not change");
+
+constexpr size_t JournalRecordAlignment = 8;
+
+} // namespace
+
+Uint32 RenderStateCacheImpl::ResolveContentVersion(Uint32 ContentVersion) const
 {
     if (ContentVersion == ~0u)
     {
@@ -61,6 +108,81 @@ Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob
         if (ContentVersion == ~0u)
             ContentVersion = 0;
     }
+    return ContentVersion;
+}
+
+bool RenderStateCacheImpl::Load(const IDataBlob* pArchive,
+                                Uint32           ContentVersion,
+                                bool             MakeCopy)
+{
+    if (pArchive != nullptr && pArchive->GetSize() >= sizeof(JournalHeader))
+    {
+        JournalHeader Header;
+        memcpy(&Header, pArchive->GetConstDataPtr(), sizeof(Header));
+        if (Header.Magic == JournalHeader::ExpectedMagic)
+            return LoadJournal(pArchive, ContentVersion, MakeCopy);
+    }
+
+    return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
+}
+
+bool RenderStateCacheImpl::LoadJournal(const IDataBlob* pJournal, Uint32 ContentVersion, bool MakeCopy)
+{
+    const Uint8* const pData    = static_cast<const Uint8*>(pJournal->GetConstDataPtr());
+    const size_t       DataSize = pJournal->GetSize();
+
+    JournalHeader Header;
+    memcpy(&Header, pData, sizeof(Header));
+    if (Header.Version != JournalHeader::ExpectedVersion)
+    {
+        LOG_ERROR_MESSAGE("Unsupported render state cache journal version (", Header.Version, "). Expected version: ", Uint32{JournalHeader::ExpectedVersion}, ".");
+        return false;
+    }
+
+    size_t Offset     = sizeof(Header);
+    Uint32 NumRecords = 0;
+    while (Offset < DataSize)
+    {
+        JournalRecordHeader Record;
+        if (DataSize - Offset < sizeof(Record))
+        {
+            LOG_WARNING_MESSAGE("Render state cache journal ends with an incomplete record header. The record is ignored.");
+            break;
+        }
+        memcpy(&Record, pData + Offset, sizeof(Record));
+        if (Record.Magic != JournalRecordHeader::ExpectedMagic)
+        {
+            LOG_ERROR_MESSAGE("Render state cache journal is corrupted: invalid magic number of record ", NumRecords, ".");
+            return false;
+        }
+        Offset += sizeof(Record);
+
+        if (Record.Size > DataSize - Offset)
+        {
+            LOG_WARNING_MESSAGE("Render state cache journal record ", NumRecords, " is truncated. The record is ignored.");
+            break;
+        }
+
+        // The proxy keeps the journal blob alive if the dearchiver does not make a copy
+        RefCntAutoPtr<IDataBlob> pRecordData{
+            ProxyDataBlob::Create(pData + Offset, static_cast<size_t>(Record.Size), const_cast<IDataBlob*>(pJournal)),
+        };
+        if (!m_pDearchiver->LoadArchive(pRecordData, ContentVersion, MakeCopy))
+        {
+            LOG_ERROR_MESSAGE("Failed to load render state cache journal record ", NumRecords, ".");
+            return false;
+        }
+
+        Offset += AlignUp(static_cast<size_t>(Record.Size), JournalRecordAlignment);
+        ++NumRecords;
+    }
+
+    return true;
+}
+
+Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+{
+    ContentVersion = ResolveContentVersion(ContentVersion);
 
     // Load new render states from archiver to dearchiver
 
@@ -79,6 +201,7 @@ Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob
     }
 
     m_pArchiver->Reset();
+    m_NumNewObjects.store(0);
 
     return m_pDearchiver->Store(ppBlob);
 }
@@ -96,14 +219,80 @@ Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pSt
     return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
 }
 
+Bool RenderStateCacheImpl::WriteToJournal(Uint32 ContentVersion, IFileStream* pStream)
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+    if (pStream == nullptr)
+        return false;
+
+    if (m_NumNewObjects.load() == 0)
+        return true;
+
+    ContentVersion = ResolveContentVersion(ContentVersion);
+
+    RefCntAutoPtr<IDataBlob> pNewData;
+    m_pArchiver->SerializeToBlob(ContentVersion, &pNewData);
+    if (!pNewData)
+    {
+        LOG_ERROR_MESSAGE("Failed to serialize render state data");
+        return false;
+    }
+
+    // Records are always appended to the end of the journal
+    if (!pStream->SetPos(0, static_cast<int>(FilePosOrigin::End)))
+    {
+        LOG_ERROR_MESSAGE("Failed to seek to the end of the render state cache journal");
+        return false;
+    }
+
+    if (pStream->GetPos() == 0)
+    {
+        const JournalHeader Header;
+        if (!pStream->Write(&Header, sizeof(Header)))
+            return false;
+    }
+
+    JournalRecordHeader Record;
+    Record.Size = pNewData->GetSize();
+    if (!pStream->Write(&Record, sizeof(Record)))
+        return false;
+    if (!pStream->Write(pNewData->GetConstDataPtr(), pNewData->GetSize()))
+        return false;
+
+    const size_t PaddingSize = AlignUp(pNewData->GetSize(), JournalRecordAlignment) - pNewData->GetSize();
+    if (PaddingSize > 0)
+    {
+        const Uint8 Padding[JournalRecordAlignment] = {};
+        if (!pStream->Write(Padding, PaddingSize))
+            return false;
+    }
+
+    // The new data is now part of the journal, so move it to the dearchiver
+    if (!m_pDearchiver->LoadArchive(pNewData, ContentVersion))
+    {
+        LOG_ERROR_MESSAGE("Failed to add new render state data to existing archive");
+        return false;
+    }
+
+    m_pArchiver->Reset();
+    m_NumNewObjects.store(0);
+
+    return true;
+}
+
 void RenderStateCacheImpl::Reset()
 {
     m_pDearchiver->Reset();
     m_pArchiver->Reset();
-    m_Shaders.clear();
+    m_NumNewObjects.store(0);
+    m_Shaders.Clear();
     m_ReloadableShaders.clear();
-    m_Pipelines.clear();
+    m_CompoundReloadSources.clear();
+    m_ShaderHashMemo.clear();
+    m_Pipelines.Clear();
     m_ReloadablePipelines.clear();
+    m_PrewarmedPipelines.clear();
+    m_PipelineUsage.clear();
 }
 
 RefCntAutoPtr<IShader> RenderStateCacheImpl::FindReloadableShader(IShader* pShader)
@@ -161,7 +350,8 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_DeviceType   {CreateInfo.pDevice != nullptr ? CreateInfo.pDevice->GetDeviceInfo().Type : RENDER_DEVICE_TYPE_UNDEFINED},
     m_DeviceHash   {ComputeDeviceAttribsHash(CreateInfo.pDevice)},
     m_CI           {CreateInfo},
-    m_pReloadSource{CreateInfo.pReloadSource}
+    m_pReloadSource{CreateInfo.pReloadSource},
+    m_pPSOCache    {CreateInfo.pPSOCache}
 // clang-format on
 {
     if (CreateInfo.pDevice == nullptr)
@@ -225,6 +415,8 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
         LOG_ERROR_AND_THROW("Failed to create archiver");
 
     DearchiverCreateInfo DearchiverCI;
+    DearchiverCI.pThreadPool     = m_pDevice->GetShaderCompilationThreadPool();
+    DearchiverCI.CompressShaders = CreateInfo.CompressShaders;
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
@@ -277,15 +469,21 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
         {
             auto _ShaderCI = ShaderCI;
 
-            RefCntAutoPtr<IShaderSourceInputStreamFactory> pCompoundReloadSource;
             if (m_pReloadSource)
             {
                 if (ShaderCI.pShaderSourceStreamFactory)
                 {
+                    std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
+
                     // Create compound shader source factory that will first try to load shader from the reload source
                     // and if it fails, will fall back to the original source factory.
-                    pCompoundReloadSource =
-                        CreateCompoundShaderSourceFactory({m_pReloadSource, ShaderCI.pShaderSourceStreamFactory});
+                    // Note that the compound factory keeps the original one alive, so its address can't be reused.
+                    auto& pCompoundReloadSource = m_CompoundReloadSources[ShaderCI.pShaderSourceStreamFactory];
+                    if (!pCompoundReloadSource)
+                    {
+                        pCompoundReloadSource =
+                            CreateCompoundShaderSourceFactory({m_pReloadSource, ShaderCI.pShaderSourceStreamFactory});
+                    }
                     _ShaderCI.pShaderSourceStreamFactory = pCompoundReloadSource;
                 }
                 else
@@ -293,7 +491,7 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                     _ShaderCI.pShaderSourceStreamFactory = m_pReloadSource;
                 }
             }
-            ReloadableShader::Create(this, pShader, _ShaderCI, ppShader);
+            ReloadableShader::Create(this, pShader, _ShaderCI, ShaderCI.pShaderSourceStreamFactory, ppShader);
 
             std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
             m_ReloadableShaders.emplace(pShader->GetUniqueID(), RefCntWeakPtr<IShader>{*ppShader});
@@ -307,65 +505,139 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
     return FoundInCache;
 }
 
-bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
-                                                IShader**               ppShader)
+XXH128Hash RenderStateCacheImpl::ComputeShaderHash(const ShaderCreateInfo& ShaderCI)
 {
-    VERIFY_EXPR(ppShader != nullptr && *ppShader == nullptr);
-
-    XXH128State Hasher;
 #ifdef DILIGENT_DEBUG
     constexpr bool IsDebug = true;
 #else
     constexpr bool IsDebug = false;
 #endif
-    Hasher.Update(ShaderCI, m_DeviceHash, IsDebug);
-    const auto Hash = Hasher.Digest();
 
-    // First, try to check if the shader has already been requested
+    const bool UseFileMetadata = (m_CI.UseFileMetadataForShaderHash &&
+                                  ShaderCI.Source == nullptr &&
+                                  ShaderCI.FilePath != nullptr &&
+                                  ShaderCI.pShaderSourceStreamFactory != nullptr);
+    if (!UseFileMetadata)
     {
-        std::lock_guard<std::mutex> Guard{m_ShadersMtx};
+        XXH128State Hasher;
+        Hasher.Update(ShaderCI, m_DeviceHash, IsDebug);
+        return Hasher.Digest();
+    }
 
-        auto it = m_Shaders.find(Hash);
-        if (it != m_Shaders.end())
-        {
-            if (auto pShader = it->second.Lock())
-            {
-                *ppShader = pShader.Detach();
-                RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing shader '", (ShaderCI.Desc.Name ? ShaderCI.Desc.Name : ""), "'.");
-                return true;
-            }
-            else
-            {
-                m_Shaders.erase(it);
-            }
-        }
+    // The memo key is the hash of all create info members except the source contents.
+    XXH128Hash MemoKey;
+    {
+        ShaderCreateInfo KeyCI{ShaderCI};
+        KeyCI.FilePath = nullptr;
+
+        XXH128State Hasher;
+        Hasher.Update(KeyCI, m_DeviceHash, IsDebug, ShaderCI.FilePath);
+        MemoKey = Hasher.Digest();
     }
 
-    class AddShaderHelper
+    auto GetFileStamp = [&ShaderCI](const std::string& Path, SourceFileStamp& Stamp) {
+        ShaderSourceFileInfo Info;
+        if (!GetShaderSourceFileInfo(ShaderCI.pShaderSourceStreamFactory, Path.c_str(), Info))
+            return false;
+        Stamp.Size             = Info.Size;
+        Stamp.ModificationTime = Info.ModificationTime;
+        return true;
+    };
+
     {
-    public:
-        AddShaderHelper(RenderStateCacheImpl& Cache, const XXH128Hash& Hash, IShader** ppShader) :
-            m_Cache{Cache},
-            m_Hash{Hash},
-            m_ppShader{ppShader}
+        ShaderHashMemo Memo;
         {
+            std::lock_guard<std::mutex> Guard{m_ShaderHashMemoMtx};
+
+            auto it = m_ShaderHashMemo.find(MemoKey);
+            if (it != m_ShaderHashMemo.end())
+                Memo = it->second;
         }
 
-        ~AddShaderHelper()
+        if (!Memo.Files.empty())
         {
-            if (*m_ppShader != nullptr)
+            bool IsUpToDate = true;
+            for (const auto& File : Memo.Files)
             {
-                std::lock_guard<std::mutex> Guard{m_Cache.m_ShadersMtx};
-                m_Cache.m_Shaders.emplace(m_Hash, *m_ppShader);
+                SourceFileStamp Stamp;
+                if (!GetFileStamp(File.Path, Stamp) || Stamp.Size != File.Size || Stamp.ModificationTime != File.ModificationTime)
+                {
+                    IsUpToDate = false;
+                    break;
+                }
             }
+            if (IsUpToDate)
+                return Memo.Hash;
         }
+    }
 
-    private:
-        RenderStateCacheImpl& m_Cache;
-        const XXH128Hash&     m_Hash;
-        IShader** const       m_ppShader;
-    };
-    AddShaderHelper AutoAddShader{*this, Hash, ppShader};
+    // Compute the full hash and remember the metadata of all source files
+    std::vector<std::string> SourceFiles;
+
+    XXH128State Hasher;
+    Hasher.Update(ShaderCI, &SourceFiles);
+    Hasher.Update(m_DeviceHash, IsDebug);
+
+    ShaderHashMemo Memo;
+    Memo.Hash = Hasher.Digest();
+    Memo.Files.reserve(SourceFiles.size());
+    for (auto& Path : SourceFiles)
+    {
+        SourceFileStamp Stamp;
+        if (!GetFileStamp(Path, Stamp))
+        {
+            // The factory does not provide file metadata
+            return Memo.Hash;
+        }
+        Stamp.Path = std::move(Path);
+        Memo.Files.emplace_back(std::move(Stamp));
+    }
+
+    {
+        std::lock_guard<std::mutex> Guard{m_ShaderHashMemoMtx};
+        m_ShaderHashMemo[MemoKey] = Memo;
+    }
+
+    return Memo.Hash;
+}
+
+bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
+                                                IShader**               ppShader)
+{
+    VERIFY_EXPR(ppShader != nullptr && *ppShader == nullptr);
+
+    const auto Hash = ComputeShaderHash(ShaderCI);
+
+    // Concurrent requests for the same shader wait until the first one creates it
+    bool IsNewShader  = false;
+    bool FoundInCache = false;
+
+    auto pShader = m_Shaders.Get(Hash,
+                                 [&]() {
+                                     IsNewShader = true;
+                                     RefCntAutoPtr<IShader> pNewShader;
+                                     FoundInCache = CreateNewShader(ShaderCI, Hash, &pNewShader);
+                                     return pNewShader;
+                                 });
+    if (pShader && !IsNewShader)
+    {
+        // The shader may have been requested with asynchronous compilation before
+        if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0)
+            pShader->GetStatus(/*WaitForCompletion = */ true);
+
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing shader '", (ShaderCI.Desc.Name ? ShaderCI.Desc.Name : ""), "'.");
+        FoundInCache = true;
+    }
+
+    *ppShader = pShader.Detach();
+    return FoundInCache;
+}
+
+bool RenderStateCacheImpl::CreateNewShader(const ShaderCreateInfo& ShaderCI,
+                                           const XXH128Hash&       Hash,
+                                           IShader**               ppShader)
+{
+    VERIFY_EXPR(ppShader != nullptr && *ppShader == nullptr);
 
     const auto HashStr = MakeHashStr(ShaderCI.Desc.Name, Hash);
 
@@ -413,7 +685,10 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
         if (pArchivedShader)
         {
             if (m_pArchiver->AddShader(pArchivedShader))
+            {
+                m_NumNewObjects.fetch_add(1);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added shader '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive shader '", HashStr, "'.");
         }
@@ -742,54 +1017,12 @@ bool RenderStateCacheImpl::CreatePipelineState(const CreateInfoType& PSOCreateIn
 }
 
 template <typename CreateInfoType>
-bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSOCreateInfo,
-                                                       IPipelineState**      ppPipelineState)
+bool RenderStateCacheImpl::CreateNewPipelineState(const CreateInfoType& PSOCreateInfo,
+                                                  const std::string&    HashStr,
+                                                  IPipelineState**      ppPipelineState)
 {
     VERIFY_EXPR(ppPipelineState != nullptr && *ppPipelineState == nullptr);
 
-    const SHADER_STATUS ShadersStatus = GetPipelineStateCreateInfoShadersStatus<CreateInfoType>(PSOCreateInfo);
-    VERIFY(ShadersStatus != SHADER_STATUS_UNINITIALIZED, "Unexpected shader status");
-    if (ShadersStatus == SHADER_STATUS_FAILED)
-    {
-        LOG_ERROR_MESSAGE("Failed to create pipeline state '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : "<unnamed>"), "': one or more shaders failed to compile.");
-        return false;
-    }
-
-    if (ShadersStatus == SHADER_STATUS_COMPILING)
-    {
-        // Note that async pipeline may be wrapped into ReloadablePipelineState.
-        // This will work totally fine as reloadable pipeline will delegate all calls to the async pipeline
-        // and may create another async pipeline.
-        AsyncPipelineState::Create(this, PSOCreateInfo, ppPipelineState);
-        return false;
-    }
-
-    XXH128State Hasher;
-    Hasher.Update(PSOCreateInfo, m_DeviceHash);
-    const auto Hash = Hasher.Digest();
-
-    // First, try to check if the PSO has already been requested
-    {
-        std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
-
-        auto it = m_Pipelines.find(Hash);
-        if (it != m_Pipelines.end())
-        {
-            if (auto pPSO = it->second.Lock())
-            {
-                *ppPipelineState = pPSO.Detach();
-                RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing pipeline '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : ""), "'.");
-                return true;
-            }
-            else
-            {
-                m_Pipelines.erase(it);
-            }
-        }
-    }
-
-    const auto HashStr = MakeHashStr(PSOCreateInfo.PSODesc.Name, Hash);
-
     bool FoundInCache = false;
     // Try to find PSO in the loaded archive
     {
@@ -802,6 +1035,7 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
         UnpackInfo.PipelineType                  = PSOCreateInfo.PSODesc.PipelineType;
         UnpackInfo.Name                          = HashStr.c_str();
         UnpackInfo.pDevice                       = m_pDevice;
+        UnpackInfo.pCache                        = m_pPSOCache;
         UnpackInfo.ModifyPipelineStateCreateInfo = Callback;
         UnpackInfo.pUserData                     = Callback;
         RefCntAutoPtr<IPipelineState> pPSO;
@@ -842,16 +1076,76 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
 
     if (*ppPipelineState == nullptr)
     {
-        m_pDevice->CreatePipelineState(PSOCreateInfo, ppPipelineState);
-        if (*ppPipelineState == nullptr)
-            return false;
+        CreateInfoType CI = PSOCreateInfo;
+        if (CI.pPSOCache == nullptr)
+            CI.pPSOCache = m_pPSOCache;
+        m_pDevice->CreatePipelineState(CI, ppPipelineState);
     }
 
+    return FoundInCache;
+}
+
+template <typename CreateInfoType>
+bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSOCreateInfo,
+                                                       IPipelineState**      ppPipelineState)
+{
+    VERIFY_EXPR(ppPipelineState != nullptr && *ppPipelineState == nullptr);
+
+    // Shaders may be compiling asynchronously, e.g. after they have been reloaded.
+    // Synchronous pipelines wait for them, so that they are ready when they are returned.
+    const bool          WaitForShaders = (PSOCreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0;
+    const SHADER_STATUS ShadersStatus  = GetPipelineStateCreateInfoShadersStatus<CreateInfoType>(PSOCreateInfo, WaitForShaders);
+    VERIFY(ShadersStatus != SHADER_STATUS_UNINITIALIZED, "Unexpected shader status");
+    if (ShadersStatus == SHADER_STATUS_FAILED)
     {
-        std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
-        m_Pipelines.emplace(Hash, *ppPipelineState);
+        LOG_ERROR_MESSAGE("Failed to create pipeline state '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : "<unnamed>"), "': one or more shaders failed to compile.");
+        return false;
     }
 
+    if (ShadersStatus == SHADER_STATUS_COMPILING)
+    {
+        // Note that async pipeline may be wrapped into ReloadablePipelineState.
+        // This will work totally fine as reloadable pipeline will delegate all calls to the async pipeline
+        // and may create another async pipeline.
+        AsyncPipelineState::Create(this, PSOCreateInfo, ppPipelineState);
+        return false;
+    }
+
+    XXH128State Hasher;
+    Hasher.Update(PSOCreateInfo, m_DeviceHash);
+    const auto Hash = Hasher.Digest();
+
+    RecordPipelineUsage(Hash, PSOCreateInfo.PSODesc);
+
+    // Concurrent requests for the same pipeline wait until the first one creates it
+    std::string HashStr;
+    bool        IsNewPipeline = false;
+    bool        FoundInCache  = false;
+
+    auto pPSO = m_Pipelines.Get(Hash,
+                                [&]() {
+                                    IsNewPipeline = true;
+                                    HashStr       = MakeHashStr(PSOCreateInfo.PSODesc.Name, Hash);
+                                    RefCntAutoPtr<IPipelineState> pNewPSO;
+                                    FoundInCache = CreateNewPipelineState(PSOCreateInfo, HashStr, &pNewPSO);
+                                    return pNewPSO;
+                                });
+    if (!pPSO)
+        return false;
+
+    if (!IsNewPipeline)
+    {
+        // The pipeline may have been pre-warmed asynchronously
+        if ((PSOCreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) == 0)
+            pPSO->GetStatus(/*WaitForCompletion = */ true);
+
+        *ppPipelineState = pPSO.Detach();
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing pipeline '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : ""), "'.");
+        return true;
+    }
+
+    *ppPipelineState = pPSO.Detach();
+
     if (FoundInCache)
     {
         RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Found pipeline '", HashStr, "' in the archive.");
@@ -875,7 +1169,10 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
         if (pSerializedPSO)
         {
             if (m_pArchiver->AddPipelineState(pSerializedPSO))
+            {
+                m_NumNewObjects.fetch_add(1);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added pipeline '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive PSO '", HashStr, "'.");
         }
@@ -897,54 +1194,316 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
 
     Uint32 NumStatesReloaded = 0;
 
-    // Reload all shaders first
+    // Shader source files may have changed, so cached includes must be reloaded.
+    auto& IncludeCache = ShaderIncludeCache::GetInstance();
+    IncludeCache.Invalidate();
+
+    // Reload the shaders whose source files have changed.
+    // The include dependency graph maps every source file to its current hash, so that
+    // files shared by many shaders (e.g. common includes) are only loaded once.
+    // If the device has a shader compilation thread pool, the shaders are compiled in parallel.
+    // A reloaded shader is used by new pipelines right away, but the pipelines that use it keep
+    // rendering with the previous version until the new pipelines are ready.
+    std::unordered_set<const IShader*> ReloadedShaders;
     {
-        std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
-        for (auto shader_it : m_ReloadableShaders)
+        const bool CompileAsync = m_pDevice->GetShaderCompilationThreadPool() != nullptr;
+
+        struct SourceFileKey
         {
-            if (auto pShader = shader_it.second.Lock())
+            const IShaderSourceInputStreamFactory* pFactory = nullptr;
+            const std::string&                     Path;
+
+            bool operator==(const SourceFileKey& rhs) const
             {
-                RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
-                if (pReloadableShader)
+                return pFactory == rhs.pFactory && Path == rhs.Path;
+            }
+
+            struct Hasher
+            {
+                size_t operator()(const SourceFileKey& Key) const
                 {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
+                    return ComputeHash(Key.pFactory, Key.Path);
                 }
-                else
+            };
+        };
+        // Note that the keys reference the paths stored in the reloadable shaders,
+        // which are not modified until the map is no longer used.
+        std::unordered_map<SourceFileKey, size_t, SourceFileKey::Hasher> SourceFileHashes;
+
+        std::vector<RefCntAutoPtr<ReloadableShader>> Shaders;
+        {
+            std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
+            Shaders.reserve(m_ReloadableShaders.size());
+            for (auto shader_it : m_ReloadableShaders)
+            {
+                if (auto pShader = shader_it.second.Lock())
                 {
-                    UNEXPECTED("Shader object is not a ReloadableShader");
+                    RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
+                    if (pReloadableShader)
+                        Shaders.emplace_back(std::move(pReloadableShader));
+                    else
+                        UNEXPECTED("Shader object is not a ReloadableShader");
                 }
             }
         }
+
+        std::vector<ReloadableShader*> OutdatedShaders;
+        for (auto& pShader : Shaders)
+        {
+            IShaderSourceInputStreamFactory* pFactory = pShader->GetSourceStreamFactory();
+
+            const bool SourceChanged = pShader->HasSourceChanged(
+                [&](const std::string& Path) {
+                    auto it = SourceFileHashes.find({pFactory, Path});
+                    if (it == SourceFileHashes.end())
+                    {
+                        size_t Hash = 0;
+                        try
+                        {
+                            const ShaderSourceFileData FileData = ReadShaderSourceFile(nullptr, 0, pFactory, Path.c_str());
+                            Hash                                = ComputeHashRaw(FileData.Source, FileData.SourceLength);
+                        }
+                        catch (...)
+                        {
+                            // The file has been removed or can't be read: the shader will be reloaded and report the error
+                        }
+                        it = SourceFileHashes.emplace(SourceFileKey{pFactory, Path}, Hash).first;
+                    }
+                    return it->second;
+                });
+            if (SourceChanged)
+                OutdatedShaders.push_back(pShader);
+        }
+        SourceFileHashes.clear();
+
+        for (ReloadableShader* pShader : OutdatedShaders)
+        {
+            if (pShader->Reload(CompileAsync))
+                ++NumStatesReloaded;
+            ReloadedShaders.insert(pShader);
+        }
     }
 
-    // Reload pipelines.
+    // Reload pipelines that use the reloaded shaders. Graphics pipelines are also reloaded
+    // when the application provides the callback that may modify their create info.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
     {
-        std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
-        for (auto pso_it : m_ReloadablePipelines)
+        std::vector<RefCntAutoPtr<ReloadablePipelineState>> Pipelines;
         {
-            if (auto pPSO = pso_it.second.Lock())
+            std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
+            Pipelines.reserve(m_ReloadablePipelines.size());
+            for (auto pso_it : m_ReloadablePipelines)
             {
-                RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (auto pPSO = pso_it.second.Lock())
                 {
-                    if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
-                        ++NumStatesReloaded;
-                }
-                else
-                {
-                    UNEXPECTED("Pipeline state object is not a ReloadablePipelineState");
+                    RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
+                    if (pReloadablePSO)
+                        Pipelines.emplace_back(std::move(pReloadablePSO));
+                    else
+                        UNEXPECTED("Pipeline state object is not a ReloadablePipelineState");
                 }
             }
         }
+
+        for (auto& pPSO : Pipelines)
+        {
+            const PIPELINE_TYPE Type = pPSO->GetPipelineType();
+
+            const bool NeedsReload =
+                pPSO->UsesAnyShader(ReloadedShaders) ||
+                (ReloadGraphicsPipeline != nullptr && (Type == PIPELINE_TYPE_GRAPHICS || Type == PIPELINE_TYPE_MESH));
+            if (NeedsReload && pPSO->Reload(ReloadGraphicsPipeline, pUserData))
+                ++NumStatesReloaded;
+        }
+    }
+
+    if (IncludeCache.IsEnabled())
+    {
+        const auto Stats = IncludeCache.GetStatistics();
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Shader include cache: ", Stats.NumHits, " hits, ", Stats.NumMisses,
+                               " misses (", static_cast<Uint32>(Stats.GetHitRate() * 100 + 0.5), "% hit rate), ", Stats.NumFiles, " files.");
     }
 
     return NumStatesReloaded;
 }
 
-static constexpr char RenderStateCacheFileExtension[] = ".diligentcache";
+void RenderStateCacheImpl::RecordPipelineUsage(const XXH128Hash& Hash, const PipelineStateDesc& Desc)
+{
+    std::lock_guard<std::mutex> Guard{m_PipelineUsageMtx};
+
+    auto it = m_PipelineUsage.find(Hash);
+    if (it == m_PipelineUsage.end())
+    {
+        PipelineUsageInfo Info;
+        Info.HashStr         = MakeHashStr(Desc.Name, Hash);
+        Info.Name            = Desc.Name != nullptr ? Desc.Name : "";
+        Info.Type            = Desc.PipelineType;
+        Info.FirstRequestIdx = static_cast<Uint32>(m_PipelineUsage.size());
+        it                   = m_PipelineUsage.emplace(Hash, std::move(Info)).first;
+    }
+    ++it->second.RequestCount;
+}
+
+static constexpr Uint32 PipelineUsageDataVersion = 1;
+
+Bool RenderStateCacheImpl::WritePipelineUsage(IDataBlob** ppBlob)
+{
+    if (ppBlob == nullptr)
+    {
+        DEV_ERROR("ppBlob must not be null");
+        return false;
+    }
+    DEV_CHECK_ERR(*ppBlob == nullptr, "Overwriting reference to existing data blob may cause memory leaks");
+
+    std::lock_guard<std::mutex> Guard{m_PipelineUsageMtx};
+
+    std::vector<std::pair<const XXH128Hash*, const PipelineUsageInfo*>> Pipelines;
+    Pipelines.reserve(m_PipelineUsage.size());
+    for (const auto& it : m_PipelineUsage)
+        Pipelines.emplace_back(&it.first, &it.second);
+
+    std::sort(Pipelines.begin(), Pipelines.end(),
+              [](const auto& Lhs, const auto& Rhs) {
+                  if (Lhs.second->RequestCount != Rhs.second->RequestCount)
+                      return Lhs.second->RequestCount > Rhs.second->RequestCount;
+                  return Lhs.second->FirstRequestIdx < Rhs.second->FirstRequestIdx;
+              });
+
+    auto SerializeUsage = [&Pipelines](auto& Ser) {
+        const Uint32 Version = PipelineUsageDataVersion;
+        const Uint32 Count   = static_cast<Uint32>(Pipelines.size());
+        if (!Ser(Version, Count))
+            return false;
+
+        for (const auto& Pipeline : Pipelines)
+        {
+            const XXH128Hash&        Hash    = *Pipeline.first;
+            const PipelineUsageInfo& Info    = *Pipeline.second;
+            const char*              HashStr = Info.HashStr.c_str();
+            const char*              Name    = Info.Name.c_str();
+            if (!Ser(Hash.LowPart, Hash.HighPart, Info.Type, HashStr, Name))
+                return false;
+        }
+        return true;
+    };
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeUsage(MeasureSer);
+
+    auto pDataBlob = DataBlobImpl::Create(MeasureSer.GetSize());
+
+    SerializedData                    Data{pDataBlob->GetDataPtr(), pDataBlob->GetSize()};
+    Serializer<SerializerMode::Write> WriteSer{Data};
+    if (!SerializeUsage(WriteSer) || !WriteSer.IsEnded())
+    {
+        UNEXPECTED("Failed to serialize pipeline usage data");
+        return false;
+    }
+
+    *ppBlob = pDataBlob.Detach();
+    return true;
+}
+
+Uint32 RenderStateCacheImpl::PrewarmPipelines(const IDataBlob* pUsageData)
+{
+    if (pUsageData == nullptr)
+    {
+        DEV_ERROR("pUsageData must not be null");
+        return 0;
+    }
+
+    SerializedData                   Data{const_cast<void*>(pUsageData->GetConstDataPtr()), pUsageData->GetSize()};
+    Serializer<SerializerMode::Read> Ser{Data};
+
+    Uint32 Version = 0;
+    Uint32 Count   = 0;
+    if (!Ser(Version, Count) || Version != PipelineUsageDataVersion)
+    {
+        LOG_ERROR_MESSAGE("Pipeline usage data is invalid or has unsupported version");
+        return 0;
+    }
+
+    // When the device has a thread pool, compile pipelines in the background
+    const bool CompileAsync = m_pDevice->GetShaderCompilationThreadPool() != nullptr;
+
+    Uint32 NumScheduled = 0;
+    for (Uint32 i = 0; i < Count; ++i)
+    {
+        XXH128Hash    Hash;
+        PIPELINE_TYPE Type    = PIPELINE_TYPE_INVALID;
+        const char*   HashStr = nullptr;
+        const char*   Name    = nullptr;
+        if (!Ser(Hash.LowPart, Hash.HighPart, Type, HashStr, Name))
+        {
+            LOG_ERROR_MESSAGE("Failed to read pipeline usage data");
+            break;
+        }
+
+        // Pipelines that already exist are not pre-warmed
+        bool IsUnpacked = false;
+
+        auto pPSO = m_Pipelines.Get(Hash,
+                                    [&]() {
+                                        IsUnpacked = true;
+
+                                        auto Callback = MakeCallback(
+                                            [Name, CompileAsync](PipelineStateCreateInfo& CI) {
+                                                CI.PSODesc.Name = Name;
+                                                if (CompileAsync)
+                                                    CI.Flags |= PSO_CREATE_FLAG_ASYNCHRONOUS;
+                                            });
+
+                                        PipelineStateUnpackInfo UnpackInfo;
+                                        UnpackInfo.PipelineType                  = Type;
+                                        UnpackInfo.Name                          = HashStr;
+                                        UnpackInfo.pDevice                       = m_pDevice;
+                                        UnpackInfo.pCache                        = m_pPSOCache;
+                                        UnpackInfo.ModifyPipelineStateCreateInfo = Callback;
+                                        UnpackInfo.pUserData                     = Callback;
+                                        RefCntAutoPtr<IPipelineState> pNewPSO;
+                                        m_pDearchiver->UnpackPipelineState(UnpackInfo, &pNewPSO);
+                                        return pNewPSO;
+                                    });
+        if (!IsUnpacked)
+            continue;
+
+        if (!pPSO)
+        {
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Pipeline '", HashStr, "' was not found in the archive and will not be pre-warmed.");
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> Guard{m_PrewarmedPipelinesMtx};
+            m_PrewarmedPipelines.emplace_back(std::move(pPSO));
+        }
+        ++NumScheduled;
+    }
+
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Scheduled ", NumScheduled, " of ", Count, " pipelines for pre-warming.");
+
+    return NumScheduled;
+}
+
+Uint32 RenderStateCacheImpl::GetPrewarmProgress(Uint32* pTotalCount)
+{
+    std::lock_guard<std::mutex> Guard{m_PrewarmedPipelinesMtx};
+
+    if (pTotalCount != nullptr)
+        *pTotalCount = static_cast<Uint32>(m_PrewarmedPipelines.size());
+
+    Uint32 NumReady = 0;
+    for (const auto& pPSO : m_PrewarmedPipelines)
+    {
+        if (pPSO->GetStatus() != PIPELINE_STATE_STATUS_COMPILING)
+            ++NumReady;
+    }
+    return NumReady;
+}
+
+static constexpr char RenderStateCacheFileExtension[]   = ".diligentcache";
+static constexpr char PipelineStateCacheFileExtension[] = ".psocache";
 
 std::string GetRenderStateCacheFilePath(const char* CacheLocation, const char* AppName, RENDER_DEVICE_TYPE DeviceType)
 {
@@ -987,6 +1546,25 @@ std::string GetRenderStateCacheFilePath(const char* CacheLocation, const char* A
     return StateCachePath;
 }
 
+std::string GetPipelineStateCacheFilePath(const char* RenderStateCacheFilePath)
+{
+    if (RenderStateCacheFilePath == nullptr)
+    {
+        UNEXPECTED("Render state cache file path is null");
+        return "";
+    }
+
+    std::string PSOCachePath = RenderStateCacheFilePath;
+
+    const size_t ExtLen = sizeof(RenderStateCacheFileExtension) - 1;
+    if (PSOCachePath.length() >= ExtLen && PSOCachePath.compare(PSOCachePath.length() - ExtLen, ExtLen, RenderStateCacheFileExtension) == 0)
+        PSOCachePath.resize(PSOCachePath.length() - ExtLen);
+
+    PSOCachePath += PipelineStateCacheFileExtension;
+
+    return PSOCachePath;
+}
+
 } // namespace Diligent
 
 extern "C"
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ResourceFileLoader.hpp"
+
+#include <utility>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+ResourceFileLoader::ResourceFileLoader(const CreateInfo& CI) :
+    m_Reader{CI}
+{
+}
+
+ResourceFileLoader::~ResourceFileLoader()
+{
+    m_Reader.WaitForIdle();
+}
+
+void ResourceFileLoader::EnqueueRead(const BufferRequest& Request)
+{
+    DEV_CHECK_ERR(Request.FilePath != nullptr, "File path must not be null");
+    DEV_CHECK_ERR(Request.pBuffer != nullptr, "Destination buffer must not be null");
+    DEV_CHECK_ERR(Request.Size != 0, "Region size must not be zero");
+    DEV_CHECK_ERR(Request.DstOffset + Request.Size <= Request.pBuffer->GetDesc().Size,
+                  "The region [", Request.DstOffset, ", ", Request.DstOffset + Request.Size,
+                  ") is out of bounds of buffer '", Request.pBuffer->GetDesc().Name, "'");
+
+    PendingRequest Pending;
+    Pending.pRead     = m_Reader.ReadFileRegion(Request.FilePath, Request.FileOffset, Request.Size);
+    Pending.pBuffer   = Request.pBuffer;
+    Pending.DstOffset = Request.DstOffset;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_UnsubmittedRequests.emplace_back(std::move(Pending));
+}
+
+void ResourceFileLoader::EnqueueRead(const TextureRequest& Request)
+{
+    DEV_CHECK_ERR(Request.FilePath != nullptr, "File path must not be null");
+    DEV_CHECK_ERR(Request.pTexture != nullptr, "Destination texture must not be null");
+    DEV_CHECK_ERR(Request.Size != 0, "Region size must not be zero");
+    DEV_CHECK_ERR(Request.Stride != 0, "Row stride must not be zero");
+
+    PendingRequest Pending;
+    Pending.pRead       = m_Reader.ReadFileRegion(Request.FilePath, Request.FileOffset, Request.Size);
+    Pending.pTexture    = Request.pTexture;
+    Pending.MipLevel    = Request.MipLevel;
+    Pending.Slice       = Request.Slice;
+    Pending.DstBox      = Request.DstBox;
+    Pending.Stride      = Request.Stride;
+    Pending.DepthStride = Request.DepthStride;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_UnsubmittedRequests.emplace_back(std::move(Pending));
+}
+
+void ResourceFileLoader::Submit(IFence* pFence, Uint64 FenceValue)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    if (m_UnsubmittedRequests.empty() && pFence == nullptr)
+        return;
+
+    Batch NewBatch;
+    NewBatch.Requests   = std::move(m_UnsubmittedRequests);
+    NewBatch.pFence     = pFence;
+    NewBatch.FenceValue = FenceValue;
+    m_Batches.emplace_back(std::move(NewBatch));
+
+    m_UnsubmittedRequests.clear();
+}
+
+Uint32 ResourceFileLoader::Process(IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+    Uint32 NumCompletedBatches = 0;
+    while (true)
+    {
+        Batch CompletedBatch;
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            if (m_Batches.empty())
+                break;
+
+            const Batch& FrontBatch = m_Batches.front();
+            for (const PendingRequest& Request : FrontBatch.Requests)
+            {
+                if (Request.pRead && !Request.pRead->IsFinished())
+                    return NumCompletedBatches;
+            }
+
+            CompletedBatch = std::move(m_Batches.front());
+            m_Batches.pop_front();
+        }
+
+        Uint32 NumFailedRequests = 0;
+        for (const PendingRequest& Request : CompletedBatch.Requests)
+        {
+            IDataBlob* pData = Request.pRead ? Request.pRead->GetData() : nullptr;
+            if (pData == nullptr)
+            {
+                LOG_ERROR_MESSAGE("Failed to read ", Request.pRead ? Request.pRead->GetFilePath() : "<unknown file>",
+                                  ". The request is skipped.");
+                ++NumFailedRequests;
+                continue;
+            }
+
+            if (Request.pBuffer)
+            {
+                pContext->UpdateBuffer(Request.pBuffer, Request.DstOffset, pData->GetSize(), pData->GetConstDataPtr(),
+                                       RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            else if (Request.pTexture)
+            {
+                TextureSubResData SubresData;
+                SubresData.pData       = pData->GetConstDataPtr();
+                SubresData.Stride      = Request.Stride;
+                SubresData.DepthStride = Request.DepthStride;
+                pContext->UpdateTexture(Request.pTexture, Request.MipLevel, Request.Slice, Request.DstBox, SubresData,
+                                        RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+
+        if (CompletedBatch.pFence)
+            pContext->EnqueueSignal(CompletedBatch.pFence, CompletedBatch.FenceValue);
+
+        if (NumFailedRequests != 0)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_NumFailedRequests += NumFailedRequests;
+        }
+
+        ++NumCompletedBatches;
+    }
+
+    return NumCompletedBatches;
+}
+
+Uint32 ResourceFileLoader::GetNumPendingBatches()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return static_cast<Uint32>(m_Batches.size());
+}
+
+Uint32 ResourceFileLoader::GetNumFailedRequests()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    return m_NumFailedRequests;
+}
+
+} // namespace Diligent
@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ResourceUploadBatch.hpp"
+
+#include <cstring>
+
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// D3D12_TEXTURE_DATA_PITCH_ALIGNMENT and WebGPU bytesPerRow alignment
+constexpr Uint64 TextureRowAlignment = 256;
+// D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+constexpr Uint64 TextureDataAlignment = 512;
+constexpr Uint64 BufferDataAlignment  = 16;
+
+} // namespace
+
+ResourceUploadBatch::ResourceUploadBatch(const ResourceUploadBatchCreateInfo& CI) :
+    m_pDevice{CI.pDevice},
+    m_pContext{CI.pContext},
+    m_StagingPageSize{CI.StagingPageSize},
+    m_TexturesFromBuffers{CI.pDevice != nullptr && CI.pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_D3D11}
+{
+    DEV_CHECK_ERR(m_pDevice != nullptr, "Device must not be null");
+    DEV_CHECK_ERR(m_pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(!m_pContext->GetDesc().IsDeferred, "Staging buffers can only be mapped by an immediate context");
+    DEV_CHECK_ERR(m_StagingPageSize > 0, "Staging page size must not be zero");
+
+    FenceDesc Desc;
+    Desc.Name = "Resource upload batch fence";
+    Desc.Type = m_pDevice->GetDeviceInfo().Features.NativeFence ? FENCE_TYPE_GENERAL : FENCE_TYPE_CPU_WAIT_ONLY;
+    m_pDevice->CreateFence(Desc, &m_pFence);
+    DEV_CHECK_ERR(m_pFence, "Failed to create fence");
+}
+
+ResourceUploadBatch::~ResourceUploadBatch()
+{
+    if (GetNumPendingUploads() > 0)
+        Submit();
+}
+
+bool ResourceUploadBatch::Allocate(Uint64 Size, Uint64 Alignment, size_t& PageIdx, Uint64& Offset)
+{
+    if (!m_ActivePages.empty())
+    {
+        StagingPage& Page = m_ActivePages.back();
+
+        const Uint64 AlignedOffset = AlignUp(Page.Offset, Alignment);
+        if (AlignedOffset + Size <= Page.Size)
+        {
+            Page.Offset = AlignedOffset + Size;
+            PageIdx     = m_ActivePages.size() - 1;
+            Offset      = AlignedOffset;
+            return true;
+        }
+    }
+
+    StagingPage NewPage;
+    if (Size <= m_StagingPageSize)
+    {
+        // Reuse a page whose copies have been completed
+        const Uint64 CompletedValue = m_pFence->GetCompletedValue();
+        for (auto it = m_SubmittedPages.begin(); it != m_SubmittedPages.end(); ++it)
+        {
+            if (it->FenceValue <= CompletedValue)
+            {
+                NewPage = std::move(*it);
+                m_SubmittedPages.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (!NewPage.pBuffer)
+    {
+        BufferDesc Desc;
+        Desc.Name           = "Resource upload batch staging page";
+        Desc.Size           = std::max(Size, m_StagingPageSize);
+        Desc.Usage          = USAGE_STAGING;
+        Desc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        m_pDevice->CreateBuffer(Desc, nullptr, &NewPage.pBuffer);
+        if (!NewPage.pBuffer)
+        {
+            LOG_ERROR_MESSAGE("Failed to create staging buffer of size ", Desc.Size);
+            return false;
+        }
+        NewPage.Size = Desc.Size;
+    }
+
+    void* pMappedData = nullptr;
+    m_pContext->MapBuffer(NewPage.pBuffer, MAP_WRITE, MAP_FLAG_NONE, pMappedData);
+    if (pMappedData == nullptr)
+    {
+        LOG_ERROR_MESSAGE("Failed to map staging buffer");
+        return false;
+    }
+    NewPage.pData  = static_cast<Uint8*>(pMappedData);
+    NewPage.Offset = Size;
+
+    m_ActivePages.emplace_back(std::move(NewPage));
+    PageIdx = m_ActivePages.size() - 1;
+    Offset  = 0;
+    return true;
+}
+
+void ResourceUploadBatch::CreateBuffer(const BufferDesc& Desc, const BufferData* pBuffData, IBuffer** ppBuffer)
+{
+    DEV_CHECK_ERR(ppBuffer != nullptr && *ppBuffer == nullptr, "ppBuffer must not be null and must point to a null pointer");
+
+    const bool HasData = pBuffData != nullptr && pBuffData->pData != nullptr && pBuffData->DataSize > 0;
+    if (!HasData || (Desc.Usage != USAGE_DEFAULT && Desc.Usage != USAGE_IMMUTABLE))
+    {
+        // Dynamic, staging, and unified buffers are initialized by the CPU
+        BufferData BuffData;
+        if (pBuffData != nullptr)
+        {
+            BuffData          = *pBuffData;
+            BuffData.pContext = m_pContext;
+        }
+        m_pDevice->CreateBuffer(Desc, pBuffData != nullptr ? &BuffData : nullptr, ppBuffer);
+        return;
+    }
+
+    BufferDesc BuffDesc = Desc;
+    if (BuffDesc.Usage == USAGE_IMMUTABLE)
+        BuffDesc.Usage = USAGE_DEFAULT;
+
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, ppBuffer);
+    if (*ppBuffer == nullptr)
+        return;
+
+    const Uint64 DataSize = std::min(pBuffData->DataSize, BuffDesc.Size);
+
+    size_t PageIdx = 0;
+    Uint64 Offset  = 0;
+    if (!Allocate(DataSize, BufferDataAlignment, PageIdx, Offset))
+        return;
+
+    StagingPage& Page = m_ActivePages[PageIdx];
+    memcpy(Page.pData + Offset, pBuffData->pData, static_cast<size_t>(DataSize));
+
+    m_BufferCopies.push_back({RefCntAutoPtr<IBuffer>{*ppBuffer}, Page.pBuffer, Offset, DataSize});
+}
+
+void ResourceUploadBatch::CreateTexture(const TextureDesc& Desc, const TextureData* pTexData, ITexture** ppTexture)
+{
+    DEV_CHECK_ERR(ppTexture != nullptr && *ppTexture == nullptr, "ppTexture must not be null and must point to a null pointer");
+
+    const bool HasData = pTexData != nullptr && pTexData->pSubResources != nullptr && pTexData->NumSubresources > 0;
+    if (!HasData || !m_TexturesFromBuffers || (Desc.Usage != USAGE_DEFAULT && Desc.Usage != USAGE_IMMUTABLE))
+    {
+        TextureData TexData;
+        if (pTexData != nullptr)
+        {
+            TexData          = *pTexData;
+            TexData.pContext = m_pContext;
+        }
+        m_pDevice->CreateTexture(Desc, pTexData != nullptr ? &TexData : nullptr, ppTexture);
+        return;
+    }
+
+    TextureDesc TexDesc = Desc;
+    if (TexDesc.Usage == USAGE_IMMUTABLE)
+        TexDesc.Usage = USAGE_DEFAULT;
+
+    m_pDevice->CreateTexture(TexDesc, nullptr, ppTexture);
+    if (*ppTexture == nullptr)
+        return;
+
+    // Use the final description as the number of mip levels may have been computed by the device
+    const TextureDesc& FinalDesc = (*ppTexture)->GetDesc();
+
+    const Uint32 NumSlices = FinalDesc.Is3D() ? 1 : FinalDesc.GetArraySize();
+    if (pTexData->NumSubresources != FinalDesc.MipLevels * NumSlices)
+    {
+        LOG_ERROR_MESSAGE("Incorrect number of subresources in the initial data of texture '", (Desc.Name != nullptr ? Desc.Name : ""),
+                          "': ", FinalDesc.MipLevels * NumSlices, " expected, ", pTexData->NumSubresources, " provided");
+        return;
+    }
+
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(FinalDesc.Format);
+    const bool                  IsCompressed = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED;
+    const Uint32                TexelSize    = IsCompressed ? Uint32{FmtAttribs.ComponentSize} : Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+
+    RefCntAutoPtr<ITexture> pTexture{*ppTexture};
+    for (Uint32 Slice = 0; Slice < NumSlices; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < FinalDesc.MipLevels; ++Mip)
+        {
+            const TextureSubResData& SrcSubres = pTexData->pSubResources[Slice * FinalDesc.MipLevels + Mip];
+            const MipLevelProperties MipProps  = GetMipLevelProperties(FinalDesc, Mip);
+
+            TextureCopy Copy;
+            Copy.pDstTexture = pTexture;
+            Copy.MipLevel    = Mip;
+            Copy.Slice       = Slice;
+            Copy.DstBox      = Box{0, MipProps.LogicalWidth, 0, MipProps.LogicalHeight, 0, MipProps.Depth};
+
+            if (SrcSubres.pSrcBuffer != nullptr)
+            {
+                // The data is already in a GPU buffer
+                Copy.SubresData = SrcSubres;
+                m_TextureCopies.emplace_back(std::move(Copy));
+                continue;
+            }
+
+            const Uint32 RowCount = IsCompressed ? MipProps.StorageHeight / FmtAttribs.BlockHeight : MipProps.StorageHeight;
+
+            // The row pitch must be a multiple of both the row alignment and the texel size
+            Uint64 Stride = AlignUp(MipProps.RowSize, TextureRowAlignment);
+            while (Stride % TexelSize != 0)
+                Stride += TextureRowAlignment;
+            const Uint64 DepthStride = Stride * RowCount;
+
+            size_t PageIdx = 0;
+            Uint64 Offset  = 0;
+            if (!Allocate(DepthStride * MipProps.Depth, TextureDataAlignment, PageIdx, Offset))
+                return;
+
+            StagingPage& Page = m_ActivePages[PageIdx];
+            for (Uint32 z = 0; z < MipProps.Depth; ++z)
+            {
+                for (Uint32 Row = 0; Row < RowCount; ++Row)
+                {
+                    const Uint8* pSrcRow = static_cast<const Uint8*>(SrcSubres.pData) + z * SrcSubres.DepthStride + Row * SrcSubres.Stride;
+                    Uint8*       pDstRow = Page.pData + Offset + z * DepthStride + Row * Stride;
+                    memcpy(pDstRow, pSrcRow, static_cast<size_t>(MipProps.RowSize));
+                }
+            }
+
+            Copy.SubresData = TextureSubResData{Page.pBuffer, Offset, Stride, DepthStride};
+            m_TextureCopies.emplace_back(std::move(Copy));
+        }
+    }
+}
+
+Uint64 ResourceUploadBatch::Submit()
+{
+    if (GetNumPendingUploads() == 0)
+        return m_LastFenceValue;
+
+    for (StagingPage& Page : m_ActivePages)
+    {
+        m_pContext->UnmapBuffer(Page.pBuffer, MAP_WRITE);
+        Page.pData = nullptr;
+    }
+
+    for (const BufferCopy& Copy : m_BufferCopies)
+    {
+        m_pContext->CopyBuffer(Copy.pSrcBuffer, Copy.SrcOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                               Copy.pDstBuffer, 0, Copy.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    m_BufferCopies.clear();
+
+    for (const TextureCopy& Copy : m_TextureCopies)
+    {
+        m_pContext->UpdateTexture(Copy.pDstTexture, Copy.MipLevel, Copy.Slice, Copy.DstBox, Copy.SubresData,
+                                  RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    m_TextureCopies.clear();
+
+    m_pContext->EnqueueSignal(m_pFence, ++m_LastFenceValue);
+    m_pContext->Flush();
+
+    for (StagingPage& Page : m_ActivePages)
+    {
+        // Dedicated pages for large resources are released when the copies are complete
+        if (Page.Size == m_StagingPageSize)
+        {
+            Page.Offset     = 0;
+            Page.FenceValue = m_LastFenceValue;
+            m_SubmittedPages.emplace_back(std::move(Page));
+        }
+    }
+    m_ActivePages.clear();
+
+    return m_LastFenceValue;
+}
+
+Uint64 ResourceUploadBatch::GetStagingMemorySize() const
+{
+    Uint64 Size = 0;
+    for (const StagingPage& Page : m_ActivePages)
+        Size += Page.Size;
+    for (const StagingPage& Page : m_SubmittedPages)
+        Size += Page.Size;
+    return Size;
+}
+
+} // namespace Diligent
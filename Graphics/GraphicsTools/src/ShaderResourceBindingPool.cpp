@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderResourceBindingPool.hpp"
+
+#include "BasicMath.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+ShaderResourceBindingPool::ShaderResourceBindingPool(const ShaderResourceBindingPoolCreateInfo& CI) :
+    m_pDevice{CI.pDevice},
+    m_pSignature{CI.pSignature},
+    m_InitStaticResources{CI.InitStaticResources}
+{
+    DEV_CHECK_ERR(m_pDevice != nullptr, "Device must not be null");
+    DEV_CHECK_ERR(m_pSignature != nullptr, "Pipeline resource signature must not be null");
+
+    FenceDesc Desc;
+    Desc.Name = "Shader resource binding pool fence";
+    Desc.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+    m_pDevice->CreateFence(Desc, &m_pFence);
+    DEV_CHECK_ERR(m_pFence, "Failed to create fence");
+
+    m_FreeSRBs.reserve(CI.InitialSize);
+    for (Uint32 i = 0; i < CI.InitialSize; ++i)
+    {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        m_pSignature->CreateShaderResourceBinding(&pSRB, m_InitStaticResources);
+        if (!pSRB)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shader resource binding");
+            break;
+        }
+        m_FreeSRBs.emplace_back(std::move(pSRB));
+        ++m_NumSRBs;
+    }
+}
+
+void ShaderResourceBindingPool::RecycleCompletedFrames()
+{
+    const Uint64 CompletedValue = m_pFence->GetCompletedValue();
+    while (!m_PendingFrames.empty() && m_PendingFrames.front().FenceValue <= CompletedValue)
+    {
+        SRBList& SRBs = m_PendingFrames.front().SRBs;
+        m_FreeSRBs.insert(m_FreeSRBs.end(), std::make_move_iterator(SRBs.begin()), std::make_move_iterator(SRBs.end()));
+        m_PendingFrames.pop_front();
+    }
+}
+
+IShaderResourceBinding* ShaderResourceBindingPool::Allocate()
+{
+    if (m_FreeSRBs.empty())
+        RecycleCompletedFrames();
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    if (!m_FreeSRBs.empty())
+    {
+        pSRB = std::move(m_FreeSRBs.back());
+        m_FreeSRBs.pop_back();
+    }
+    else
+    {
+        m_pSignature->CreateShaderResourceBinding(&pSRB, m_InitStaticResources);
+        if (!pSRB)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shader resource binding");
+            return nullptr;
+        }
+        ++m_NumSRBs;
+    }
+
+    m_FrameSRBs.emplace_back(std::move(pSRB));
+    return m_FrameSRBs.back();
+}
+
+void ShaderResourceBindingPool::FinishFrame(IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+
+    if (m_FrameSRBs.empty())
+        return;
+
+    PendingFrame Frame;
+    Frame.SRBs       = std::move(m_FrameSRBs);
+    Frame.FenceValue = m_NextFenceValue++;
+    m_FrameSRBs.clear();
+
+    pContext->EnqueueSignal(m_pFence, Frame.FenceValue);
+    m_PendingFrames.emplace_back(std::move(Frame));
+}
+
+void ShaderResourceBindingPool::ReleaseResources()
+{
+    RecycleCompletedFrames();
+    if (m_FreeSRBs.empty())
+        return;
+
+    const PipelineResourceSignatureDesc& SignDesc = m_pSignature->GetDesc();
+
+    std::vector<IDeviceObject*> NullObjects;
+    for (Uint32 r = 0; r < SignDesc.NumResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = SignDesc.Resources[r];
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
+            (ResDesc.Flags & PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS) != 0)
+            continue;
+
+        // Resources that are shared between stages are bound to the same variable
+        SHADER_TYPE       Stages     = ResDesc.ShaderStages;
+        const SHADER_TYPE ShaderType = ExtractLSB(Stages);
+        if (NullObjects.size() < ResDesc.ArraySize)
+            NullObjects.resize(ResDesc.ArraySize);
+
+        for (IShaderResourceBinding* pSRB : m_FreeSRBs)
+        {
+            if (IShaderResourceVariable* pVar = pSRB->GetVariableByName(ShaderType, ResDesc.Name))
+                pVar->SetArray(NullObjects.data(), 0, ResDesc.ArraySize, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+        }
+    }
+}
+
+void ShaderResourceBindingPool::Shrink()
+{
+    RecycleCompletedFrames();
+    m_NumSRBs -= m_FreeSRBs.size();
+    m_FreeSRBs.clear();
+}
+
+} // namespace Diligent
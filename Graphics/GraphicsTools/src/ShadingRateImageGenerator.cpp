@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ShadingRateImageGenerator.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char ShadingRateCSSource[] =
+    {
+#include "ShadingRateCS_inc.h"
+};
+
+// The number of SHADING_RATE values in the remap table, see g_RateRemap in ShadingRateCS.hlsl
+constexpr Uint32 NumRateRemapEntries = 12;
+static_assert(SHADING_RATE_MAX < NumRateRemapEntries, "The remap table is too small");
+
+// Mirrors cbShadingRateAttribs in ShadingRateCS.hlsl
+struct ShadingRateAttribs
+{
+    uint2 ColorSize;
+    uint2 TileSize;
+    uint2 RateTexSize;
+    uint2 MaxAxisRate;
+
+    float2 MotionVectorScale;
+    float  ContrastThreshold;
+    float  MotionThreshold;
+
+    Uint32 AllowAnisotropic;
+    Uint32 Padding0;
+    Uint32 Padding1;
+    Uint32 Padding2;
+
+    // Packed into uint4 array in the shader
+    Uint32 RateRemap[NumRateRemapEntries];
+};
+static_assert(sizeof(ShadingRateAttribs) % 16 == 0, "Constant buffer size must be a multiple of 16 bytes");
+
+} // namespace
+
+ShadingRateImageGenerator::ShadingRateImageGenerator(IRenderDevice* pDevice) :
+    m_pDevice{pDevice},
+    m_Format{pDevice != nullptr ? pDevice->GetAdapterInfo().ShadingRate.Format : SHADING_RATE_FORMAT_UNKNOWN},
+    m_TileSize{
+        pDevice != nullptr ? pDevice->GetAdapterInfo().ShadingRate.MaxTileSize[0] : 0,
+        pDevice != nullptr ? pDevice->GetAdapterInfo().ShadingRate.MaxTileSize[1] : 0,
+    }
+{
+    DEV_CHECK_ERR(IsSupported(pDevice), "Shading rate image generator is not supported by this device");
+    CreateUniformBuffer(pDevice, sizeof(ShadingRateAttribs), "Shading rate image generator attribs", &m_pConstants);
+}
+
+ShadingRateImageGenerator::~ShadingRateImageGenerator()
+{
+}
+
+bool ShadingRateImageGenerator::IsSupported(IRenderDevice* pDevice)
+{
+    if (pDevice == nullptr)
+        return false;
+
+    const RenderDeviceInfo&      DeviceInfo = pDevice->GetDeviceInfo();
+    const ShadingRateProperties& SRProps    = pDevice->GetAdapterInfo().ShadingRate;
+    return DeviceInfo.Features.ComputeShaders &&
+        DeviceInfo.Features.VariableRateShading &&
+        (SRProps.CapFlags & SHADING_RATE_CAP_FLAG_TEXTURE_BASED) != 0 &&
+        (SRProps.Format == SHADING_RATE_FORMAT_PALETTE || SRProps.Format == SHADING_RATE_FORMAT_UNORM8) &&
+        SRProps.MaxTileSize[0] != 0 && SRProps.MaxTileSize[1] != 0;
+}
+
+bool ShadingRateImageGenerator::CreatePipeline(bool UseMotionVectors, PipelineInfo& Pipeline)
+{
+    ShaderMacroHelper Macros;
+    Macros.Add("OUTPUT_FORMAT", m_Format == SHADING_RATE_FORMAT_UNORM8 ? 1 : 0);
+    Macros.Add("USE_MOTION_VECTORS", UseMotionVectors ? 1 : 0);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc           = {"Shading rate CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = ShadingRateCSSource;
+    ShaderCI.SourceLength   = sizeof(ShadingRateCSSource) - 1;
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    m_pDevice->CreateShader(ShaderCI, &pCS);
+    if (!pCS)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shading rate shader");
+        return false;
+    }
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = UseMotionVectors ? "Shading rate with motion vectors PSO" : "Shading rate PSO";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    // Input buffers and the shading rate texture may change between calls
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+    ShaderResourceVariableDesc Vars[] = {
+        {SHADER_TYPE_COMPUTE, "cbShadingRateAttribs", SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables    = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables = _countof(Vars);
+
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &Pipeline.pPSO);
+    if (!Pipeline.pPSO)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shading rate PSO");
+        return false;
+    }
+    Pipeline.pPSO->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbShadingRateAttribs")->Set(m_pConstants);
+    Pipeline.pPSO->CreateShaderResourceBinding(&Pipeline.pSRB, true);
+
+    return true;
+}
+
+bool ShadingRateImageGenerator::CreateShadingRateTexture(Uint32 ColorWidth, Uint32 ColorHeight)
+{
+    if (m_pShadingRate && m_ColorWidth == ColorWidth && m_ColorHeight == ColorHeight)
+        return true;
+
+    m_pShadingRate.Release();
+    m_pStaging.Release();
+    m_ColorWidth  = 0;
+    m_ColorHeight = 0;
+
+    const ShadingRateProperties& SRProps = m_pDevice->GetAdapterInfo().ShadingRate;
+
+    TextureDesc TexDesc;
+    TexDesc.Name   = "Shading rate texture";
+    TexDesc.Type   = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width  = (ColorWidth + m_TileSize.x - 1) / m_TileSize.x;
+    TexDesc.Height = (ColorHeight + m_TileSize.y - 1) / m_TileSize.y;
+    TexDesc.Format = m_Format == SHADING_RATE_FORMAT_UNORM8 ? TEX_FORMAT_RG8_UNORM : TEX_FORMAT_R8_UINT;
+    TexDesc.Usage  = USAGE_DEFAULT;
+
+    // Write the texture directly when the device allows it, otherwise use an intermediate texture
+    const bool DirectWrite = (SRProps.BindFlags & BIND_UNORDERED_ACCESS) != 0;
+
+    TexDesc.BindFlags = BIND_SHADING_RATE | (DirectWrite ? BIND_UNORDERED_ACCESS : BIND_NONE);
+    m_pDevice->CreateTexture(TexDesc, nullptr, &m_pShadingRate);
+    if (!m_pShadingRate)
+    {
+        LOG_ERROR_MESSAGE("Failed to create shading rate texture");
+        return false;
+    }
+
+    if (!DirectWrite)
+    {
+        TexDesc.Name      = "Shading rate staging texture";
+        TexDesc.BindFlags = BIND_UNORDERED_ACCESS;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pStaging);
+        if (!m_pStaging)
+        {
+            LOG_ERROR_MESSAGE("Failed to create shading rate staging texture");
+            m_pShadingRate.Release();
+            return false;
+        }
+    }
+
+    m_ColorWidth  = ColorWidth;
+    m_ColorHeight = ColorHeight;
+    return true;
+}
+
+void ShadingRateImageGenerator::Generate(IDeviceContext* pContext, const GenerateAttribs& Attribs)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "Device context must not be null");
+    DEV_CHECK_ERR(Attribs.pColorSRV != nullptr, "Color buffer view must not be null");
+    if (Attribs.pColorSRV == nullptr)
+        return;
+
+    const TextureViewDesc& ColorViewDesc = Attribs.pColorSRV->GetDesc();
+    const TextureDesc&     ColorDesc     = Attribs.pColorSRV->GetTexture()->GetDesc();
+    DEV_CHECK_ERR(ColorViewDesc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE, "Color buffer view must be a shader resource view");
+    DEV_CHECK_ERR(ColorViewDesc.TextureDim == RESOURCE_DIM_TEX_2D, "Color buffer view must be a 2D texture view");
+    DEV_CHECK_ERR(ColorDesc.SampleCount == 1, "Multisampled color buffers are not supported");
+
+    const MipLevelProperties ColorMipProps = GetMipLevelProperties(ColorDesc, ColorViewDesc.MostDetailedMip);
+#ifdef DILIGENT_DEVELOPMENT
+    if (Attribs.pMotionVectorsSRV != nullptr)
+    {
+        const TextureViewDesc&   MotionViewDesc = Attribs.pMotionVectorsSRV->GetDesc();
+        const MipLevelProperties MotionMipProps = GetMipLevelProperties(Attribs.pMotionVectorsSRV->GetTexture()->GetDesc(), MotionViewDesc.MostDetailedMip);
+        DEV_CHECK_ERR(MotionViewDesc.ViewType == TEXTURE_VIEW_SHADER_RESOURCE, "Motion vector view must be a shader resource view");
+        DEV_CHECK_ERR(MotionMipProps.LogicalWidth == ColorMipProps.LogicalWidth && MotionMipProps.LogicalHeight == ColorMipProps.LogicalHeight,
+                      "Motion vector buffer size (", MotionMipProps.LogicalWidth, "x", MotionMipProps.LogicalHeight,
+                      ") does not match the color buffer size (", ColorMipProps.LogicalWidth, "x", ColorMipProps.LogicalHeight, ")");
+    }
+#endif
+
+    if (!CreateShadingRateTexture(ColorMipProps.LogicalWidth, ColorMipProps.LogicalHeight))
+        return;
+
+    const bool    UseMotionVectors = Attribs.pMotionVectorsSRV != nullptr;
+    PipelineInfo& Pipeline         = UseMotionVectors ? m_MotionPipeline : m_Pipeline;
+    if (!Pipeline.pPSO && !CreatePipeline(UseMotionVectors, Pipeline))
+        return;
+
+    ITexture*          pOutput     = m_pStaging ? m_pStaging : m_pShadingRate;
+    const TextureDesc& RateTexDesc = m_pShadingRate->GetDesc();
+
+    {
+        MapHelper<ShadingRateAttribs> CBAttribs{pContext, m_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+        CBAttribs->ColorSize         = uint2{ColorMipProps.LogicalWidth, ColorMipProps.LogicalHeight};
+        CBAttribs->TileSize          = m_TileSize;
+        CBAttribs->RateTexSize       = uint2{RateTexDesc.Width, RateTexDesc.Height};
+        CBAttribs->MaxAxisRate       = uint2{
+            (Attribs.MaxRate >> DILIGENT_SHADING_RATE_X_SHIFT) & AXIS_SHADING_RATE_MAX,
+            Attribs.MaxRate & AXIS_SHADING_RATE_MAX,
+        };
+        CBAttribs->MotionVectorScale = Attribs.MotionVectorScale;
+        CBAttribs->ContrastThreshold = Attribs.ContrastThreshold;
+        CBAttribs->MotionThreshold   = Attribs.MotionThreshold;
+        CBAttribs->AllowAnisotropic  = Attribs.AllowAnisotropicRates ? 1 : 0;
+
+        // Replace every rate with the finest supported rate that is not finer than it.
+        // The supported rates are sorted from the coarsest to the finest, and 1x1 is always supported.
+        const ShadingRateProperties& SRProps = m_pDevice->GetAdapterInfo().ShadingRate;
+        for (Uint32 Rate = 0; Rate < NumRateRemapEntries; ++Rate)
+        {
+            CBAttribs->RateRemap[Rate] = SHADING_RATE_1X1;
+            for (Uint32 i = 0; i < SRProps.NumShadingRates; ++i)
+            {
+                const ShadingRateMode& Mode = SRProps.ShadingRates[i];
+                if (Rate >= Mode.Rate && Mode.HasSampleCount(Attribs.SampleCount))
+                {
+                    CBAttribs->RateRemap[Rate] = Mode.Rate;
+                    break;
+                }
+            }
+        }
+    }
+
+    Pipeline.pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Color")->Set(Attribs.pColorSRV);
+    if (UseMotionVectors)
+        Pipeline.pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_MotionVectors")->Set(Attribs.pMotionVectorsSRV);
+    Pipeline.pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_ShadingRate")->Set(pOutput->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+
+    pContext->SetPipelineState(Pipeline.pPSO);
+    pContext->CommitShaderResources(Pipeline.pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DispatchComputeAttribs DispatchAttribs;
+    DispatchAttribs.ThreadGroupCountX = RateTexDesc.Width;
+    DispatchAttribs.ThreadGroupCountY = RateTexDesc.Height;
+    pContext->DispatchCompute(DispatchAttribs);
+
+    if (m_pStaging)
+    {
+        CopyTextureAttribs CopyAttribs{m_pStaging, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, m_pShadingRate, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        pContext->CopyTexture(CopyAttribs);
+    }
+
+    StateTransitionDesc Barrier{m_pShadingRate, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_SHADING_RATE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+}
+
+} // namespace Diligent
@@ -0,0 +1,621 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SparseTextureResidencyManager.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "GraphicsUtilities.h"
+
+namespace Diligent
+{
+
+SparseTextureResidencyManager::SparseTextureResidencyManager(IRenderDevice* pDevice, const SparseTextureResidencyManagerCreateInfo& CreateInfo) :
+    m_Name{CreateInfo.Desc.Name != nullptr ? CreateInfo.Desc.Name : "Sparse texture"},
+    m_Desc{CreateInfo.Desc},
+    m_NumTilesInPage{std::max(CreateInfo.NumTilesInMemoryPage, 1u)},
+    // Tiles bound in the current frame must never be evicted in the same frame
+    m_MinEvictionAge{std::max(CreateInfo.MinEvictionAge, 1u)},
+    m_MaxTileBindsPerFrame{CreateInfo.MaxTileBindsPerFrame},
+    m_MemoryBudget{CreateInfo.MemoryBudget}
+{
+    m_Desc.Name = m_Name.c_str();
+
+    if (pDevice == nullptr)
+        LOG_ERROR_AND_THROW("pDevice must not be null");
+
+    if (m_Desc.Type != RESOURCE_DIM_TEX_2D && m_Desc.Type != RESOURCE_DIM_TEX_2D_ARRAY)
+        LOG_ERROR_AND_THROW(GetResourceDimString(m_Desc.Type), " is not a valid resource dimension. Only 2D and 2D array textures are allowed");
+
+    if (m_Desc.Usage != USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Texture usage must be USAGE_SPARSE");
+
+    if (m_Desc.Format == TEX_FORMAT_UNKNOWN)
+        LOG_ERROR_AND_THROW("Texture format must not be UNKNOWN");
+
+    if (m_Desc.Width == 0 || m_Desc.Height == 0)
+        LOG_ERROR_AND_THROW("Texture dimensions must not be zero");
+
+    if (m_Desc.MipLevels == 0)
+        m_Desc.MipLevels = ComputeMipLevelsCount(m_Desc.Width, m_Desc.Height);
+
+    if (m_Desc.Type == RESOURCE_DIM_TEX_2D)
+        m_Desc.ArraySize = 1;
+
+    const auto& Features = pDevice->GetDeviceInfo().Features;
+    if (!Features.SparseResources)
+        LOG_ERROR_AND_THROW("SparseResources device feature is not enabled");
+
+    const auto& SparseRes     = pDevice->GetAdapterInfo().SparseResources;
+    const auto  RequiredCaps  = m_Desc.Type == RESOURCE_DIM_TEX_2D ? SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D : SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D_ARRAY_MIP_TAIL;
+    if ((SparseRes.CapFlags & RequiredCaps) == 0)
+        LOG_ERROR_AND_THROW("This device does not support sparse ", (m_Desc.Type == RESOURCE_DIM_TEX_2D ? "2D textures" : "texture 2D arrays with mip tails"));
+
+    const auto& SparseInfo = pDevice->GetSparseTextureFormatInfo(m_Desc.Format, m_Desc.Type, m_Desc.SampleCount);
+    if ((SparseInfo.BindFlags & m_Desc.BindFlags) != m_Desc.BindFlags)
+        LOG_ERROR_AND_THROW("The following bind flags requested for the sparse texture are not supported by device: ", GetBindFlagsString(m_Desc.BindFlags & ~SparseInfo.BindFlags, ", "));
+
+    CreateResources(pDevice);
+}
+
+SparseTextureResidencyManager::~SparseTextureResidencyManager()
+{
+}
+
+void SparseTextureResidencyManager::CreateResources(IRenderDevice* pDevice)
+{
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+
+    if (DeviceInfo.IsMetalDevice())
+    {
+        // Metal sparse texture requires memory object at initialization
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name     = "Sparse texture residency manager memory";
+        MemCI.Desc.Type     = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize = 65536;
+        MemCI.InitialSize   = m_MemoryBudget != 0 ? AlignUp(m_MemoryBudget, MemCI.Desc.PageSize) : Uint64{512} << Uint64{20};
+
+        pDevice->CreateDeviceMemory(MemCI, &m_pMemory);
+        if (!m_pMemory)
+            LOG_ERROR_AND_THROW("Failed to create device memory");
+
+        CreateSparseTextureMtl(pDevice, m_Desc, m_pMemory, &m_pTexture);
+    }
+    else
+    {
+        pDevice->CreateTexture(m_Desc, nullptr, &m_pTexture);
+    }
+    if (!m_pTexture)
+        LOG_ERROR_AND_THROW("Failed to create sparse texture '", m_Name, "'");
+
+    const auto& TexSparseProps = m_pTexture->GetSparseProperties();
+    if (TexSparseProps.TileSize[2] != 1)
+        LOG_ERROR_AND_THROW("Sparse tiles of 2D textures are expected to have unit depth");
+
+    m_TileSize[0]    = TexSparseProps.TileSize[0];
+    m_TileSize[1]    = TexSparseProps.TileSize[1];
+    m_TileSize[2]    = TexSparseProps.TileSize[2];
+    m_BlockSize      = TexSparseProps.BlockSize;
+    m_FirstMipInTail = std::min(m_Desc.MipLevels, TexSparseProps.FirstMipInTail);
+    if (m_Desc.MipLevels > TexSparseProps.FirstMipInTail)
+    {
+        m_MipTailSize = TexSparseProps.MipTailSize;
+        m_NumMipTails = (TexSparseProps.Flags & SPARSE_TEXTURE_FLAG_SINGLE_MIPTAIL) != 0 ? 1 : m_Desc.ArraySize;
+    }
+
+    // Enumerate tiles
+    m_Mips.resize(m_FirstMipInTail);
+    m_NumTilesInSlice = 0;
+    for (Uint32 Mip = 0; Mip < m_FirstMipInTail; ++Mip)
+    {
+        const auto MipProps = GetMipLevelProperties(m_Desc, Mip);
+        const auto NumTiles = GetNumSparseTilesInMipLevel(m_Desc, m_TileSize, Mip);
+
+        auto& MipInfo{m_Mips[Mip]};
+        MipInfo.Width     = MipProps.StorageWidth;
+        MipInfo.Height    = MipProps.StorageHeight;
+        MipInfo.NumTiles  = uint2{NumTiles.x, NumTiles.y};
+        MipInfo.FirstTile = m_NumTilesInSlice;
+        m_NumTilesInSlice += NumTiles.x * NumTiles.y;
+    }
+    m_Tiles.resize(size_t{m_NumTilesInSlice} * m_Desc.ArraySize);
+
+    m_MemoryPageSize = Uint64{m_NumTilesInPage} * m_BlockSize;
+    if (m_pMemory)
+    {
+        // Memory size must be a multiple of the page size of the memory object
+        const auto MemPageSize = m_pMemory->GetDesc().PageSize;
+
+        m_MemoryPageSize = (m_MemoryPageSize + MemPageSize - 1) / MemPageSize * MemPageSize;
+        m_NumTilesInPage = StaticCast<Uint32>(m_MemoryPageSize / m_BlockSize);
+    }
+
+    // Mip tails are stored in the first pages of the memory object
+    m_NumMipTailPages = StaticCast<Uint32>((m_MipTailSize * m_NumMipTails + m_MemoryPageSize - 1) / m_MemoryPageSize);
+
+    // Memory size must not be zero, so always allocate at least one page
+    const Uint32 NumInitialPages = std::max(m_NumMipTailPages, 1u);
+    if (!m_pMemory)
+    {
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name     = "Sparse texture residency manager memory";
+        MemCI.Desc.Type     = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize = m_MemoryPageSize;
+        MemCI.InitialSize   = m_MemoryPageSize * NumInitialPages;
+
+        IDeviceObject* pCompatibleRes[]{m_pTexture};
+        MemCI.ppCompatibleResources = pCompatibleRes;
+        MemCI.NumResources          = _countof(pCompatibleRes);
+
+        pDevice->CreateDeviceMemory(MemCI, &m_pMemory);
+        if (!m_pMemory)
+            LOG_ERROR_AND_THROW("Failed to create device memory");
+    }
+    else
+    {
+        VERIFY_EXPR(DeviceInfo.IsMetalDevice());
+        m_pMemory->Resize(m_MemoryPageSize * NumInitialPages);
+    }
+
+    // Pages that are not occupied by the mip tails are available for tiles
+    const Uint32 NumTilePages = NumInitialPages - m_NumMipTailPages;
+    m_SlotTiles.resize(size_t{NumTilePages} * m_NumTilesInPage, InvalidIndex);
+    for (Uint32 Slot = 0; Slot < GetNumSlots(); ++Slot)
+        m_FreeSlots.insert(Slot);
+
+    // Note: D3D11 and WebGPU do not support general fences
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D11 && DeviceInfo.Type != RENDER_DEVICE_TYPE_WEBGPU)
+    {
+        FenceDesc Desc;
+        Desc.Type = FENCE_TYPE_GENERAL;
+
+        Desc.Name = "Sparse texture residency manager before-bind fence";
+        pDevice->CreateFence(Desc, &m_pBeforeBindFence);
+        Desc.Name = "Sparse texture residency manager after-bind fence";
+        pDevice->CreateFence(Desc, &m_pAfterBindFence);
+    }
+}
+
+Uint32 SparseTextureResidencyManager::GetTileIndex(const SparseTextureTile& Tile) const
+{
+    DEV_CHECK_ERR(Tile.MipLevel < m_FirstMipInTail, "Mip level ", Tile.MipLevel, " is in the mip tail, which is always resident");
+    DEV_CHECK_ERR(Tile.Slice < m_Desc.ArraySize, "Slice ", Tile.Slice, " is out of range");
+
+    const auto& MipInfo = m_Mips[Tile.MipLevel];
+    DEV_CHECK_ERR(Tile.X < MipInfo.NumTiles.x && Tile.Y < MipInfo.NumTiles.y, "Tile (", Tile.X, ", ", Tile.Y, ") is out of range");
+
+    return Tile.Slice * m_NumTilesInSlice + MipInfo.FirstTile + Tile.Y * MipInfo.NumTiles.x + Tile.X;
+}
+
+SparseTextureTile SparseTextureResidencyManager::GetTile(Uint32 TileIndex) const
+{
+    VERIFY_EXPR(TileIndex < m_Tiles.size());
+
+    SparseTextureTile Tile;
+    Tile.Slice = TileIndex / m_NumTilesInSlice;
+
+    const Uint32 IndexInSlice = TileIndex % m_NumTilesInSlice;
+    // Find the last mip level whose first tile is not greater than the index
+    auto MipIt = std::upper_bound(m_Mips.begin(), m_Mips.end(), IndexInSlice,
+                                  [](Uint32 Index, const MipLevelInfo& Mip) {
+                                      return Index < Mip.FirstTile;
+                                  });
+    VERIFY_EXPR(MipIt != m_Mips.begin());
+    --MipIt;
+
+    const Uint32 IndexInMip = IndexInSlice - MipIt->FirstTile;
+
+    Tile.MipLevel = static_cast<Uint32>(MipIt - m_Mips.begin());
+    Tile.X        = IndexInMip % MipIt->NumTiles.x;
+    Tile.Y        = IndexInMip / MipIt->NumTiles.x;
+    return Tile;
+}
+
+uint2 SparseTextureResidencyManager::GetNumTilesInMipLevel(Uint32 MipLevel) const
+{
+    return MipLevel < m_FirstMipInTail ? m_Mips[MipLevel].NumTiles : uint2{0, 0};
+}
+
+bool SparseTextureResidencyManager::IsTileResident(const SparseTextureTile& Tile) const
+{
+    return m_Tiles[GetTileIndex(Tile)].Slot != InvalidIndex;
+}
+
+void SparseTextureResidencyManager::RequestTile(Uint32 TileIndex)
+{
+    DEV_CHECK_ERR(TileIndex < m_Tiles.size(), "Tile index ", TileIndex, " is out of range");
+
+    auto& Tile = m_Tiles[TileIndex];
+    if (Tile.LastRequestFrame == m_FrameIndex)
+        return; // The tile has already been requested in this frame
+
+    Tile.LastRequestFrame = m_FrameIndex;
+    if (Tile.Slot != InvalidIndex)
+    {
+        // Move the tile to the front of the LRU list
+        LruRemove(TileIndex);
+        LruPushFront(TileIndex);
+    }
+    else if (!Tile.IsPending)
+    {
+        Tile.IsPending = true;
+        m_PendingTiles.push_back(TileIndex);
+    }
+}
+
+void SparseTextureResidencyManager::ProcessFeedback(const Uint32* pFeedback, Uint32 NumElements)
+{
+    DEV_CHECK_ERR(pFeedback != nullptr || NumElements == 0, "pFeedback must not be null");
+    DEV_CHECK_ERR(NumElements <= GetNumTiles(), "The number of feedback elements (", NumElements, ") exceeds the number of tiles (", GetNumTiles(), ")");
+
+    NumElements = std::min(NumElements, GetNumTiles());
+    for (Uint32 i = 0; i < NumElements; ++i)
+    {
+        if (pFeedback[i] != 0)
+            RequestTile(i);
+    }
+}
+
+void SparseTextureResidencyManager::ProcessMinMipFeedback(Uint32 Slice, const Uint32* pMinMips, Uint32 GridWidth, Uint32 GridHeight)
+{
+    DEV_CHECK_ERR(pMinMips != nullptr, "pMinMips must not be null");
+    DEV_CHECK_ERR(GridWidth > 0 && GridHeight > 0, "Feedback grid dimensions must not be zero");
+    DEV_CHECK_ERR(Slice < m_Desc.ArraySize, "Slice ", Slice, " is out of range");
+
+    for (Uint32 y = 0; y < GridHeight; ++y)
+    {
+        for (Uint32 x = 0; x < GridWidth; ++x)
+        {
+            const Uint32 MipLevel = pMinMips[y * GridWidth + x];
+            if (MipLevel >= m_FirstMipInTail)
+                continue;
+
+            // Tiles of the mip level that overlap the region
+            const auto&  NumTiles = m_Mips[MipLevel].NumTiles;
+            const Uint32 StartX   = x * NumTiles.x / GridWidth;
+            const Uint32 EndX     = std::max(((x + 1) * NumTiles.x + GridWidth - 1) / GridWidth, StartX + 1);
+            const Uint32 StartY   = y * NumTiles.y / GridHeight;
+            const Uint32 EndY     = std::max(((y + 1) * NumTiles.y + GridHeight - 1) / GridHeight, StartY + 1);
+
+            SparseTextureTile Tile;
+            Tile.MipLevel = MipLevel;
+            Tile.Slice    = Slice;
+            for (Tile.Y = StartY; Tile.Y < EndY; ++Tile.Y)
+            {
+                for (Tile.X = StartX; Tile.X < EndX; ++Tile.X)
+                    RequestTile(Tile);
+            }
+        }
+    }
+}
+
+void SparseTextureResidencyManager::ReadFeedback(IDeviceContext* pContext, IReadbackQueue* pQueue, IBuffer* pFeedbackBuffer)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "pContext must not be null");
+    DEV_CHECK_ERR(pQueue != nullptr, "pQueue must not be null");
+    DEV_CHECK_ERR(pFeedbackBuffer != nullptr, "pFeedbackBuffer must not be null");
+
+    const Uint64 Size = std::min(pFeedbackBuffer->GetDesc().Size, Uint64{GetNumTiles()} * sizeof(Uint32));
+    pQueue->ReadBuffer(pContext, pFeedbackBuffer, 0, Size,
+                       [this](const ReadbackData& Data) {
+                           if (Data.pData != nullptr)
+                               ProcessFeedback(static_cast<const Uint32*>(Data.pData), StaticCast<Uint32>(Data.DataSize / sizeof(Uint32)));
+                       });
+}
+
+void SparseTextureResidencyManager::SetMemoryBudget(Uint64 MemoryBudget)
+{
+    m_MemoryBudget = MemoryBudget;
+}
+
+Uint32 SparseTextureResidencyManager::GetMaxTileSlots() const
+{
+    const Uint32 MaxPages = (GetNumTiles() + m_NumTilesInPage - 1) / m_NumTilesInPage;
+
+    Uint32 NumPages = MaxPages;
+    if (m_MemoryBudget != 0)
+    {
+        const Uint64 NumBudgetPages = m_MemoryBudget / m_MemoryPageSize;
+        // Always keep at least one page for tiles
+        NumPages = NumBudgetPages > m_NumMipTailPages ?
+            static_cast<Uint32>(std::min(NumBudgetPages - m_NumMipTailPages, Uint64{MaxPages})) :
+            std::min(1u, MaxPages);
+    }
+
+    return NumPages * m_NumTilesInPage;
+}
+
+Uint32 SparseTextureResidencyManager::AllocateSlot()
+{
+    const Uint32 MaxSlots = GetMaxTileSlots();
+    // Slots beyond the budget are released at the end of the frame and must not be reused
+    if (m_FreeSlots.empty() || *m_FreeSlots.begin() >= MaxSlots)
+    {
+        if (GetNumSlots() + m_NumTilesInPage > MaxSlots)
+            return InvalidIndex;
+
+        // Allocate a new page
+        const Uint32 NumPages = m_NumMipTailPages + GetNumSlots() / m_NumTilesInPage + 1;
+        if (!m_pMemory->Resize(m_MemoryPageSize * NumPages))
+        {
+            LOG_WARNING_MESSAGE("Failed to allocate a new memory page for sparse texture '", m_Name, "'");
+            return InvalidIndex;
+        }
+
+        const Uint32 FirstNewSlot = GetNumSlots();
+        m_SlotTiles.resize(size_t{FirstNewSlot} + m_NumTilesInPage, InvalidIndex);
+        for (Uint32 Slot = FirstNewSlot; Slot < GetNumSlots(); ++Slot)
+            m_FreeSlots.insert(Slot);
+    }
+
+    const Uint32 Slot = *m_FreeSlots.begin();
+    m_FreeSlots.erase(m_FreeSlots.begin());
+    return Slot;
+}
+
+void SparseTextureResidencyManager::ReleaseTrailingPages()
+{
+    Uint32 NumSlots = GetNumSlots();
+    // Memory size must not be zero, so keep at least one page
+    while (NumSlots >= m_NumTilesInPage && (m_NumMipTailPages > 0 || NumSlots > m_NumTilesInPage))
+    {
+        const Uint32 FirstPageSlot = NumSlots - m_NumTilesInPage;
+        if (static_cast<Uint32>(std::distance(m_FreeSlots.lower_bound(FirstPageSlot), m_FreeSlots.end())) != m_NumTilesInPage)
+            break; // The last page is in use
+
+        m_FreeSlots.erase(m_FreeSlots.lower_bound(FirstPageSlot), m_FreeSlots.end());
+        NumSlots = FirstPageSlot;
+    }
+
+    if (NumSlots < GetNumSlots())
+    {
+        m_SlotTiles.resize(NumSlots);
+        m_pMemory->Resize(m_MemoryPageSize * (m_NumMipTailPages + NumSlots / m_NumTilesInPage));
+    }
+}
+
+void SparseTextureResidencyManager::AddTileRange(Uint32 TileIndex, IDeviceMemory* pMemory, std::vector<SparseTextureMemoryBindRange>& Ranges) const
+{
+    const auto  Tile    = GetTile(TileIndex);
+    const auto& MipInfo = m_Mips[Tile.MipLevel];
+
+    SparseTextureMemoryBindRange Range;
+    Range.MipLevel   = Tile.MipLevel;
+    Range.ArraySlice = Tile.Slice;
+    Range.Region.MinX = Tile.X * m_TileSize[0];
+    Range.Region.MaxX = std::min(Range.Region.MinX + m_TileSize[0], MipInfo.Width);
+    Range.Region.MinY = Tile.Y * m_TileSize[1];
+    Range.Region.MaxY = std::min(Range.Region.MinY + m_TileSize[1], MipInfo.Height);
+    Range.Region.MinZ = 0;
+    Range.Region.MaxZ = 1;
+    Range.MemorySize  = m_BlockSize;
+    if (pMemory != nullptr)
+    {
+        const Uint32 Slot = m_Tiles[TileIndex].Slot;
+        VERIFY_EXPR(Slot != InvalidIndex);
+        Range.MemoryOffset = m_NumMipTailPages * m_MemoryPageSize + Uint64{Slot} * m_BlockSize;
+        Range.pMemory      = pMemory;
+    }
+    Ranges.push_back(Range);
+}
+
+void SparseTextureResidencyManager::EvictTile(Uint32 TileIndex, std::vector<SparseTextureMemoryBindRange>& Ranges)
+{
+    auto& Tile = m_Tiles[TileIndex];
+    VERIFY_EXPR(Tile.Slot != InvalidIndex);
+
+    AddTileRange(TileIndex, nullptr, Ranges);
+    LruRemove(TileIndex);
+    m_SlotTiles[Tile.Slot] = InvalidIndex;
+    m_FreeSlots.insert(Tile.Slot);
+    Tile.Slot = InvalidIndex;
+    --m_NumResidentTiles;
+    ++m_NumEvictedTiles;
+}
+
+void SparseTextureResidencyManager::LruRemove(Uint32 TileIndex)
+{
+    auto& Tile = m_Tiles[TileIndex];
+    if (Tile.Prev != InvalidIndex)
+        m_Tiles[Tile.Prev].Next = Tile.Next;
+    else
+        m_LruHead = Tile.Next;
+
+    if (Tile.Next != InvalidIndex)
+        m_Tiles[Tile.Next].Prev = Tile.Prev;
+    else
+        m_LruTail = Tile.Prev;
+
+    Tile.Prev = InvalidIndex;
+    Tile.Next = InvalidIndex;
+}
+
+void SparseTextureResidencyManager::LruPushFront(Uint32 TileIndex)
+{
+    auto& Tile = m_Tiles[TileIndex];
+    VERIFY_EXPR(Tile.Prev == InvalidIndex && Tile.Next == InvalidIndex);
+
+    Tile.Next = m_LruHead;
+    if (m_LruHead != InvalidIndex)
+        m_Tiles[m_LruHead].Prev = TileIndex;
+    else
+        m_LruTail = TileIndex;
+    m_LruHead = TileIndex;
+}
+
+void SparseTextureResidencyManager::Commit(IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "pContext must not be null");
+
+    m_BoundTiles.clear();
+
+    std::vector<SparseTextureMemoryBindRange> Ranges;
+
+    if (!m_MipTailsBound)
+    {
+        for (Uint32 Tail = 0; Tail < m_NumMipTails; ++Tail)
+        {
+            SparseTextureMemoryBindRange Range;
+            Range.MipLevel        = m_FirstMipInTail;
+            Range.ArraySlice      = Tail;
+            Range.OffsetInMipTail = 0;
+            Range.MemorySize      = m_MipTailSize;
+            Range.MemoryOffset    = Tail * m_MipTailSize;
+            Range.pMemory         = m_pMemory;
+            Ranges.push_back(Range);
+        }
+        m_MipTailsBound = true;
+    }
+
+    // Evict tiles from the slots that exceed the budget
+    const Uint32 MaxSlots = GetMaxTileSlots();
+    if (GetNumSlots() > MaxSlots)
+    {
+        for (Uint32 Slot = MaxSlots; Slot < GetNumSlots(); ++Slot)
+        {
+            if (m_SlotTiles[Slot] != InvalidIndex)
+                EvictTile(m_SlotTiles[Slot], Ranges);
+        }
+    }
+
+    // Drop stale requests of tiles that have not been requested recently
+    m_PendingTiles.erase(std::remove_if(m_PendingTiles.begin(), m_PendingTiles.end(),
+                                        [this](Uint32 TileIndex) {
+                                            auto& Tile = m_Tiles[TileIndex];
+                                            if (m_FrameIndex - Tile.LastRequestFrame < m_MinEvictionAge)
+                                                return false;
+                                            Tile.IsPending = false;
+                                            return true;
+                                        }),
+                         m_PendingTiles.end());
+
+    // Bind coarser mip levels first so that shaders can fall back to them
+    std::stable_sort(m_PendingTiles.begin(), m_PendingTiles.end(),
+                     [this](Uint32 Tile0, Uint32 Tile1) {
+                         return GetTile(Tile0).MipLevel > GetTile(Tile1).MipLevel;
+                     });
+
+    size_t NumProcessed = 0;
+    for (; NumProcessed < m_PendingTiles.size(); ++NumProcessed)
+    {
+        if (m_MaxTileBindsPerFrame != 0 && m_BoundTiles.size() >= m_MaxTileBindsPerFrame)
+            break;
+
+        Uint32 Slot = AllocateSlot();
+        if (Slot == InvalidIndex)
+        {
+            // Evict the least recently used tile if it has not been requested recently
+            if (m_LruTail == InvalidIndex || m_FrameIndex - m_Tiles[m_LruTail].LastRequestFrame < m_MinEvictionAge)
+                break;
+
+            EvictTile(m_LruTail, Ranges);
+            Slot = AllocateSlot();
+            VERIFY_EXPR(Slot != InvalidIndex);
+        }
+
+        const Uint32 TileIndex = m_PendingTiles[NumProcessed];
+        auto&        Tile      = m_Tiles[TileIndex];
+        VERIFY_EXPR(Tile.Slot == InvalidIndex && Tile.IsPending);
+        Tile.Slot         = Slot;
+        Tile.IsPending    = false;
+        m_SlotTiles[Slot] = TileIndex;
+        LruPushFront(TileIndex);
+        ++m_NumResidentTiles;
+
+        AddTileRange(TileIndex, m_pMemory, Ranges);
+        m_BoundTiles.push_back(TileIndex);
+    }
+    m_PendingTiles.erase(m_PendingTiles.begin(), m_PendingTiles.begin() + NumProcessed);
+    m_NumBoundTiles += m_BoundTiles.size();
+
+    if (!Ranges.empty())
+    {
+        SparseTextureMemoryBindInfo TexBind;
+        TexBind.pTexture  = m_pTexture;
+        TexBind.pRanges   = Ranges.data();
+        TexBind.NumRanges = StaticCast<Uint32>(Ranges.size());
+
+        BindSparseResourceMemoryAttribs BindMemAttribs;
+        BindMemAttribs.NumTextureBinds = 1;
+        BindMemAttribs.pTextureBinds   = &TexBind;
+
+        Uint64  WaitFenceValue = 0;
+        IFence* pWaitFence     = nullptr;
+        if (m_pBeforeBindFence)
+        {
+            WaitFenceValue = m_NextBeforeBindFenceValue++;
+            pWaitFence     = m_pBeforeBindFence;
+
+            BindMemAttribs.NumWaitFences    = 1;
+            BindMemAttribs.pWaitFenceValues = &WaitFenceValue;
+            BindMemAttribs.ppWaitFences     = &pWaitFence;
+
+            pContext->EnqueueSignal(m_pBeforeBindFence, WaitFenceValue);
+        }
+
+        Uint64  SignalFenceValue = 0;
+        IFence* pSignalFence     = nullptr;
+        if (m_pAfterBindFence)
+        {
+            SignalFenceValue = m_NextAfterBindFenceValue++;
+            pSignalFence     = m_pAfterBindFence;
+
+            BindMemAttribs.NumSignalFences    = 1;
+            BindMemAttribs.pSignalFenceValues = &SignalFenceValue;
+            BindMemAttribs.ppSignalFences     = &pSignalFence;
+        }
+
+        pContext->BindSparseResourceMemory(BindMemAttribs);
+        ++m_NumBindCommands;
+
+        if (m_pAfterBindFence)
+            pContext->DeviceWaitForFence(m_pAfterBindFence, SignalFenceValue);
+    }
+
+    // Release pages that are no longer used. Memory is only released after
+    // the unbind commands have been recorded.
+    ReleaseTrailingPages();
+
+    ++m_FrameIndex;
+}
+
+SparseTextureResidencyStats SparseTextureResidencyManager::GetStats() const
+{
+    SparseTextureResidencyStats Stats;
+    Stats.NumResidentTiles    = m_NumResidentTiles;
+    Stats.NumPendingTiles     = static_cast<Uint32>(m_PendingTiles.size());
+    Stats.NumMemoryPages      = GetNumSlots() / m_NumTilesInPage;
+    Stats.CommittedMemorySize = m_pMemory ? m_pMemory->GetCapacity() : 0;
+    Stats.NumBoundTiles       = m_NumBoundTiles;
+    Stats.NumEvictedTiles     = m_NumEvictedTiles;
+    Stats.NumBindCommands     = m_NumBindCommands;
+    return Stats;
+}
+
+} // namespace Diligent
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TextureFeedbackManager.hpp"
+
+#include <vector>
+
+#include "DebugUtilities.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char TextureFeedbackSource[] =
+    {
+#include "TextureFeedback_inc.h"
+};
+
+} // namespace
+
+TextureFeedbackManager::TextureFeedbackManager(IRenderDevice* pDevice, const TextureFeedbackManagerCreateInfo& CreateInfo) :
+    m_Name{CreateInfo.Name != nullptr ? CreateInfo.Name : "Texture feedback buffer"},
+    m_NumElements{CreateInfo.NumElements},
+    m_Allocator{CreateInfo.NumElements, DefaultRawMemoryAllocator::GetAllocator()}
+{
+    if (pDevice == nullptr)
+        LOG_ERROR_AND_THROW("pDevice must not be null");
+
+    if (m_NumElements == 0)
+        LOG_ERROR_AND_THROW("The number of feedback elements must not be zero");
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = m_Name.c_str();
+    BuffDesc.Size              = Uint64{m_NumElements} * sizeof(Uint32);
+    BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+    BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+    BuffDesc.ElementByteStride = sizeof(Uint32);
+    pDevice->CreateBuffer(BuffDesc, nullptr, &m_pBuffer);
+    if (!m_pBuffer)
+        LOG_ERROR_AND_THROW("Failed to create texture feedback buffer");
+
+    m_pBufferUAV = m_pBuffer->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS);
+    VERIFY_EXPR(m_pBufferUAV);
+
+    // The feedback buffer is cleared by copying from the immutable buffer
+    // that is filled with NotRequested values.
+    const std::vector<Uint32> ClearData(m_NumElements, NotRequested);
+
+    BufferData InitData{ClearData.data(), BuffDesc.Size};
+
+    BuffDesc.Name      = "Texture feedback clear buffer";
+    BuffDesc.BindFlags = BIND_NONE;
+    BuffDesc.Mode      = BUFFER_MODE_UNDEFINED;
+    BuffDesc.Usage     = USAGE_IMMUTABLE;
+
+    BuffDesc.ElementByteStride = 0;
+    pDevice->CreateBuffer(BuffDesc, &InitData, &m_pClearBuffer);
+    if (!m_pClearBuffer)
+        LOG_ERROR_AND_THROW("Failed to create texture feedback clear buffer");
+}
+
+TextureFeedbackManager::~TextureFeedbackManager()
+{
+    for (const auto& it : m_Textures)
+        m_Allocator.Free(it.first, size_t{it.second.GridWidth} * it.second.GridHeight);
+}
+
+Uint32 TextureFeedbackManager::RegisterTexture(Uint32 GridWidth, Uint32 GridHeight, TextureFeedbackCallbackType Callback)
+{
+    DEV_CHECK_ERR(GridWidth > 0 && GridHeight > 0, "Feedback grid dimensions must not be zero");
+    DEV_CHECK_ERR(Callback, "Callback must not be null");
+
+    const auto Allocation = m_Allocator.Allocate(size_t{GridWidth} * GridHeight, 1);
+    if (!Allocation.IsValid())
+    {
+        LOG_WARNING_MESSAGE("Texture feedback buffer '", m_Name, "' is full: unable to allocate ", GridWidth, "x", GridHeight,
+                            " elements. Increase TextureFeedbackManagerCreateInfo::NumElements.");
+        return InvalidFeedbackId;
+    }
+
+    const Uint32 FeedbackId = static_cast<Uint32>(Allocation.UnalignedOffset);
+
+    TextureInfo& Info{m_Textures[FeedbackId]};
+    Info.GridWidth    = GridWidth;
+    Info.GridHeight   = GridHeight;
+    Info.FirstResolve = m_NumResolves;
+    Info.Callback     = std::move(Callback);
+
+    return FeedbackId;
+}
+
+void TextureFeedbackManager::UnregisterTexture(Uint32 FeedbackId)
+{
+    auto it = m_Textures.find(FeedbackId);
+    if (it == m_Textures.end())
+    {
+        DEV_ERROR("Feedback ID ", FeedbackId, " is not registered");
+        return;
+    }
+
+    m_Allocator.Free(FeedbackId, size_t{it->second.GridWidth} * it->second.GridHeight);
+    m_Textures.erase(it);
+}
+
+void TextureFeedbackManager::Clear(IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "pContext must not be null");
+
+    pContext->CopyBuffer(m_pClearBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         m_pBuffer, 0, m_pBuffer->GetDesc().Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+}
+
+void TextureFeedbackManager::Resolve(IDeviceContext* pContext, IReadbackQueue* pQueue)
+{
+    DEV_CHECK_ERR(pContext != nullptr, "pContext must not be null");
+    DEV_CHECK_ERR(pQueue != nullptr, "pQueue must not be null");
+
+    const Uint32 ResolveIndex = m_NumResolves++;
+    pQueue->ReadBuffer(pContext, m_pBuffer, 0, m_pBuffer->GetDesc().Size,
+                       [this, ResolveIndex](const ReadbackData& Data) {
+                           if (Data.pData != nullptr)
+                               ProcessFeedback(ResolveIndex, static_cast<const Uint32*>(Data.pData), static_cast<size_t>(Data.DataSize / sizeof(Uint32)));
+                       });
+}
+
+void TextureFeedbackManager::ProcessFeedback(Uint32 ResolveIndex, const Uint32* pData, size_t NumElements)
+{
+    ++m_NumResolvedReads;
+
+    for (const auto& it : m_Textures)
+    {
+        const TextureInfo& Info = it.second;
+        // Skip textures that were registered after the read had been enqueued
+        if (ResolveIndex < Info.FirstResolve)
+            continue;
+
+        VERIFY_EXPR(it.first + size_t{Info.GridWidth} * Info.GridHeight <= NumElements);
+        Info.Callback(pData + it.first, Info.GridWidth, Info.GridHeight);
+    }
+}
+
+const Char* TextureFeedbackManager::GetShaderIncludeName()
+{
+    return "TextureFeedback.fxh";
+}
+
+const Char* TextureFeedbackManager::GetShaderIncludeSource()
+{
+    return TextureFeedbackSource;
+}
+
+} // namespace Diligent
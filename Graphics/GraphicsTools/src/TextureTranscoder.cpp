@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureTranscoder.hpp"
+
+#include "GraphicsAccessories.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+bool CopyPackedTextureSubresource(const void*                     pSrcData,
+                                  size_t                          SrcDataSize,
+                                  Uint32                          Mip,
+                                  Uint32                          Slice,
+                                  const UploadBufferDesc&         DstDesc,
+                                  const MappedTextureSubresource& DstData)
+{
+    VERIFY_EXPR(Mip < DstDesc.MipLevels && Slice < DstDesc.ArraySize);
+
+    TextureDesc TexDesc;
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Width     = DstDesc.Width;
+    TexDesc.Height    = DstDesc.Height;
+    TexDesc.ArraySize = DstDesc.ArraySize;
+    TexDesc.MipLevels = DstDesc.MipLevels;
+    TexDesc.Format    = DstDesc.Format;
+
+    Uint64 SliceSize = 0;
+    Uint64 MipOffset = 0;
+    for (Uint32 i = 0; i < DstDesc.MipLevels; ++i)
+    {
+        if (i == Mip)
+            MipOffset = SliceSize;
+        SliceSize += GetMipLevelProperties(TexDesc, i).MipSize;
+    }
+
+    const auto MipProps  = GetMipLevelProperties(TexDesc, Mip);
+    const auto SrcOffset = SliceSize * Slice + MipOffset;
+    if (SrcOffset + MipProps.MipSize > SrcDataSize)
+    {
+        LOG_ERROR_MESSAGE("Packed texture data is too small: mip ", Mip, " of slice ", Slice, " requires ",
+                          SrcOffset + MipProps.MipSize, " bytes, but only ", SrcDataSize, " bytes are available");
+        return false;
+    }
+
+    TextureSubResData SrcSubres;
+    SrcSubres.pData       = static_cast<const Uint8*>(pSrcData) + SrcOffset;
+    SrcSubres.Stride      = MipProps.RowSize;
+    SrcSubres.DepthStride = MipProps.DepthSliceSize;
+
+    // For block-compressed formats, one row contains a row of blocks
+    const auto NumRows = static_cast<Uint32>(MipProps.DepthSliceSize / MipProps.RowSize);
+    CopyTextureSubresource(SrcSubres, NumRows, MipProps.Depth, MipProps.RowSize,
+                           DstData.pData, DstData.Stride, DstData.DepthStride);
+
+    return true;
+}
+
+RefCntAutoPtr<IAsyncTask> EnqueueTextureTranscode(ITextureUploader*       pUploader,
+                                                  IThreadPool*            pThreadPool,
+                                                  TextureTranscodeRequest Request)
+{
+    DEV_CHECK_ERR(pUploader != nullptr, "Texture uploader must not be null");
+    DEV_CHECK_ERR(pThreadPool != nullptr, "Thread pool must not be null");
+    DEV_CHECK_ERR(Request.pDstTexture != nullptr, "Destination texture must not be null");
+
+    if (Request.pData == nullptr && Request.pDataBlob)
+    {
+        Request.pData    = Request.pDataBlob->GetConstDataPtr();
+        Request.DataSize = Request.pDataBlob->GetSize();
+    }
+    DEV_CHECK_ERR(Request.pData != nullptr, "Texture payload must not be null");
+
+    if (!Request.Transcode)
+        Request.Transcode = CopyPackedTextureSubresource;
+
+    const auto fPriority = static_cast<float>(Request.Priority);
+    return EnqueueAsyncWork(
+        pThreadPool,
+        [pUploader = RefCntAutoPtr<ITextureUploader>{pUploader}, Request = std::move(Request)](Uint32 ThreadId) {
+            const auto& UploadDesc = Request.UploadDesc;
+
+            // Blocks until the render thread maps the buffer
+            RefCntAutoPtr<IUploadBuffer> pUploadBuffer;
+            pUploader->AllocateUploadBuffer(nullptr, UploadDesc, &pUploadBuffer);
+            if (!pUploadBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to allocate upload buffer for texture '", Request.pDstTexture->GetDesc().Name, "'");
+                return ASYNC_TASK_STATUS_CANCELLED;
+            }
+
+            bool Transcoded = true;
+            for (Uint32 Slice = 0; Slice < UploadDesc.ArraySize && Transcoded; ++Slice)
+            {
+                for (Uint32 Mip = 0; Mip < UploadDesc.MipLevels && Transcoded; ++Mip)
+                {
+                    Transcoded = Request.Transcode(Request.pData, Request.DataSize, Mip, Slice, UploadDesc, pUploadBuffer->GetMappedData(Mip, Slice));
+                    if (!Transcoded)
+                    {
+                        LOG_ERROR_MESSAGE("Failed to transcode mip ", Mip, " of slice ", Slice, " of texture '",
+                                          Request.pDstTexture->GetDesc().Name, "'");
+                    }
+                }
+            }
+
+            // The buffer must be copied even if transcoding failed, as
+            // only buffers with scheduled copies can be recycled.
+            pUploader->ScheduleGPUCopy(nullptr, Request.pDstTexture, Request.DstSlice, Request.DstMip, pUploadBuffer, Request.Priority);
+            pUploadBuffer->WaitForCopyScheduled();
+            pUploader->RecycleBuffer(pUploadBuffer);
+
+            return Transcoded ? ASYNC_TASK_STATUS_COMPLETE : ASYNC_TASK_STATUS_CANCELLED;
+        },
+        fPriority);
+}
+
+} // namespace Diligent
@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <deque>
 #include <vector>
+#include <algorithm>
 
 #include "TextureUploaderD3D12_Vk.hpp"
 #include "ThreadSignal.hpp"
@@ -51,6 +52,10 @@ public:
         m_pStagingTexture{pStagingTexture}
     // clang-format on
     {
+        const auto& TexDesc = m_pStagingTexture->GetDesc();
+        for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            m_DataSize += GetMipLevelProperties(TexDesc, Mip).MipSize;
+        m_DataSize *= m_Desc.ArraySize;
     }
 
     ~UploadTexture()
@@ -110,6 +115,8 @@ public:
 
     ITexture* GetStagingTexture() { return m_pStagingTexture; }
 
+    Uint64 GetDataSize() const { return m_DataSize; }
+
     bool DbgIsCopyScheduled() const
     {
         return m_CopyScheduledSignal.IsTriggered();
@@ -132,6 +139,7 @@ private:
 
     RefCntAutoPtr<ITexture> m_pStagingTexture;
     Uint64                  m_CopyScheduledFenceValue = 0;
+    Uint64                  m_DataSize                = 0;
 };
 
 } // namespace
@@ -150,26 +158,34 @@ struct TextureUploaderD3D12_Vk::InternalData
         RefCntAutoPtr<ITexture>      pDstTexture;
         Uint32                       DstSlice = 0;
         Uint32                       DstMip   = 0;
+        Int32                        Priority = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadTexture* pUploadTex) :
             operation     {op        },
             pUploadTexture{pUploadTex}
         {}
-        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
+        PendingBufferOperation(Operation op, UploadTexture* pUploadTex, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip, Int32 priority = 0) :
             operation      {op        },
             pUploadTexture {pUploadTex},
             pDstTexture    {pDstTex   },
             DstSlice       {dstSlice  },
-            DstMip         {dstMip    }
+            DstMip         {dstMip    },
+            Priority       {priority  }
         {}
         // clang-format on
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, const TextureUploaderDesc& Desc) :
+        m_pCopyContext{Desc.pCopyContext},
+        m_MaxCopyBytesPerUpdate{Desc.MaxCopyBytesPerUpdate}
     {
+        DEV_CHECK_ERR(!m_pCopyContext || !m_pCopyContext->GetDesc().IsDeferred, "Copy context must be an immediate context");
+
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
+        // The render context waits for the copy context on the GPU, which requires a general fence
+        fenceDesc.Type = m_pCopyContext ? FENCE_TYPE_GENERAL : FENCE_TYPE_CPU_WAIT_ONLY;
         pDevice->CreateFence(fenceDesc, &m_pFence);
     }
 
@@ -195,10 +211,22 @@ struct TextureUploaderD3D12_Vk::InternalData
         return m_InWorkOperations;
     }
 
-    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
+    void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip, Int32 Priority)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip, Priority);
+    }
+
+    // Returns operations that did not fit into the copy budget back to the queue
+    void RequeueOperations(std::vector<PendingBufferOperation>& Operations, size_t FirstOperation)
     {
+        if (FirstOperation >= Operations.size())
+            return;
+
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
+        m_PendingOperations.insert(m_PendingOperations.begin(),
+                                   std::make_move_iterator(Operations.begin() + FirstOperation),
+                                   std::make_move_iterator(Operations.end()));
     }
 
     void EnqueueMap(UploadTexture* pUploadBuffer)
@@ -212,7 +240,19 @@ struct TextureUploaderD3D12_Vk::InternalData
         // Fences can't be accessed from multiple threads simultaneously even
         // when protected by mutex
         auto FenceValue = m_NextFenceValue++;
-        pContext->EnqueueSignal(m_pFence, FenceValue);
+        if (m_pCopyContext)
+        {
+            // Submit the copies to the transfer queue and make the render queue
+            // wait until they are complete before it accesses destination textures.
+            // The value must be pending before the render context can wait for it.
+            m_pCopyContext->EnqueueSignal(m_pFence, FenceValue);
+            m_pCopyContext->Flush();
+            pContext->DeviceWaitForFence(m_pFence, FenceValue);
+        }
+        else
+        {
+            pContext->EnqueueSignal(m_pFence, FenceValue);
+        }
         return FenceValue;
     }
 
@@ -261,6 +301,10 @@ struct TextureUploaderD3D12_Vk::InternalData
 
     void Execute(IDeviceContext* pContext, PendingBufferOperation& OperationInfo);
 
+    bool HasCopyContext() const { return m_pCopyContext != nullptr; }
+
+    Uint64 GetMaxCopyBytesPerUpdate() const { return m_MaxCopyBytesPerUpdate; }
+
 private:
     std::mutex                          m_PendingOperationsMtx;
     std::vector<PendingBufferOperation> m_PendingOperations;
@@ -272,11 +316,14 @@ private:
     RefCntAutoPtr<IFence> m_pFence;
     Uint64                m_NextFenceValue      = 1;
     Uint64                m_CompletedFenceValue = 0;
+
+    RefCntAutoPtr<IDeviceContext> m_pCopyContext;
+    const Uint64                  m_MaxCopyBytesPerUpdate;
 };
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc)}
 {
 }
 
@@ -297,12 +344,35 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
     auto& InWorkOperations = m_pInternalData->SwapMapQueues();
     if (!InWorkOperations.empty())
     {
+        using PendingBufferOperation = InternalData::PendingBufferOperation;
+
+        // Worker threads block until map operations are complete, so execute them first.
+        // Copy operations are executed in order of decreasing priority.
+        std::stable_sort(InWorkOperations.begin(), InWorkOperations.end(),
+                         [](const PendingBufferOperation& lhs, const PendingBufferOperation& rhs) {
+                             if (lhs.operation != rhs.operation)
+                                 return lhs.operation == PendingBufferOperation::Map;
+                             return lhs.Priority > rhs.Priority;
+                         });
+
+        const auto MaxCopyBytes = m_pInternalData->GetMaxCopyBytesPerUpdate();
+
         Uint32 NumCopyOperations = 0;
-        for (auto& OperationInfo : InWorkOperations)
+        Uint64 NumCopiedBytes    = 0;
+        size_t NumExecutedOps    = 0;
+        for (; NumExecutedOps < InWorkOperations.size(); ++NumExecutedOps)
         {
-            m_pInternalData->Execute(pContext, OperationInfo);
-            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+            auto& OperationInfo = InWorkOperations[NumExecutedOps];
+            if (OperationInfo.operation == PendingBufferOperation::Copy)
+            {
+                const auto CopySize = OperationInfo.pUploadTexture->GetDataSize();
+                // Always execute at least one copy so that large uploads are never starved
+                if (MaxCopyBytes != 0 && NumCopyOperations > 0 && NumCopiedBytes + CopySize > MaxCopyBytes)
+                    break;
+                NumCopiedBytes += CopySize;
                 ++NumCopyOperations;
+            }
+            m_pInternalData->Execute(pContext, OperationInfo);
         }
 
         if (NumCopyOperations > 0)
@@ -311,13 +381,17 @@ void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
             // so we must signal the fence first.
             auto SignaledFenceValue = m_pInternalData->SignalFence(pContext);
 
-            for (auto& OperationInfo : InWorkOperations)
+            for (size_t i = 0; i < NumExecutedOps; ++i)
             {
-                if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
+                auto& OperationInfo = InWorkOperations[i];
+                if (OperationInfo.operation == PendingBufferOperation::Copy)
                     OperationInfo.pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
             }
         }
 
+        // Only copy operations may be left, and they keep their priority order
+        m_pInternalData->RequeueOperations(InWorkOperations, NumExecutedOps);
+
         InWorkOperations.clear();
     }
 
@@ -367,7 +441,7 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
                     CopyInfo.SrcSlice    = Slice;
                     CopyInfo.DstMipLevel = OperationInfo.DstMip + Mip;
                     CopyInfo.DstSlice    = OperationInfo.DstSlice + Slice;
-                    pContext->CopyTexture(CopyInfo);
+                    (m_pCopyContext ? m_pCopyContext.RawPtr() : pContext)->CopyTexture(CopyInfo);
                 }
             }
         }
@@ -393,6 +467,12 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
         StagingTexDesc.ArraySize      = Desc.ArraySize;
         StagingTexDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
         StagingTexDesc.Usage          = USAGE_STAGING;
+        if (m_pInternalData->HasCopyContext())
+        {
+            // The staging texture is mapped by the render context and read by the copy context.
+            // The mask is clamped to the existing immediate contexts by the engine.
+            StagingTexDesc.ImmediateContextMask = ~Uint64{0};
+        }
 
         RefCntAutoPtr<ITexture> pStagingTexture;
         m_pDevice->CreateTexture(StagingTexDesc, nullptr, &pStagingTexture);
@@ -423,7 +503,8 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                                               ITexture*       pDstTexture,
                                               Uint32          ArraySlice,
                                               Uint32          MipLevel,
-                                              IUploadBuffer*  pUploadBuffer)
+                                              IUploadBuffer*  pUploadBuffer,
+                                              Int32           Priority)
 {
     auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
     if (pContext != nullptr)
@@ -435,7 +516,8 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                 pUploadTexture,
                 pDstTexture,
                 ArraySlice,
-                MipLevel //
+                MipLevel,
+                Priority //
             };
         m_pInternalData->Execute(pContext, CopyOp);
 
@@ -449,7 +531,7 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
     else
     {
         // Worker thread
-        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel);
+        m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel, Priority);
     }
 }
 
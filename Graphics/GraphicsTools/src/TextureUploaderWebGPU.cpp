@@ -364,7 +364,8 @@ void TextureUploaderWebGPU::ScheduleGPUCopy(IDeviceContext* pContext,
                                             ITexture*       pDstTexture,
                                             Uint32          ArraySlice,
                                             Uint32          MipLevel,
-                                            IUploadBuffer*  pUploadBuffer)
+                                            IUploadBuffer*  pUploadBuffer,
+                                            Int32           /*Priority*/)
 {
     auto* pUploadBufferWebGPU = ClassPtrCast<UploadBufferWebGPU>(pUploadBuffer);
     if (pContext != nullptr)
@@ -0,0 +1,480 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TransientTextureAllocator.hpp"
+
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+TransientTextureAllocator::TransientTextureAllocator(IRenderDevice* pDevice, const TransientTextureAllocatorCreateInfo& CreateInfo) :
+    m_Name{CreateInfo.Name != nullptr ? CreateInfo.Name : "Transient texture allocator"},
+    m_EnableAliasing{CreateInfo.EnableAliasing},
+    m_EnableMemoryless{CreateInfo.EnableMemoryless}
+{
+    if (pDevice == nullptr)
+        LOG_ERROR_AND_THROW("pDevice must not be null");
+
+    // Note: D3D11 and WebGPU do not support general fences
+    const auto DeviceType = pDevice->GetDeviceInfo().Type;
+    if (m_EnableAliasing && DeviceType != RENDER_DEVICE_TYPE_D3D11 && DeviceType != RENDER_DEVICE_TYPE_WEBGPU)
+    {
+        FenceDesc Desc;
+        Desc.Type = FENCE_TYPE_GENERAL;
+
+        Desc.Name = "Transient texture allocator before-bind fence";
+        pDevice->CreateFence(Desc, &m_pBeforeBindFence);
+        Desc.Name = "Transient texture allocator after-bind fence";
+        pDevice->CreateFence(Desc, &m_pAfterBindFence);
+    }
+}
+
+TransientTextureAllocator::~TransientTextureAllocator()
+{
+}
+
+void TransientTextureAllocator::Reset()
+{
+    m_Declarations.clear();
+}
+
+Uint32 TransientTextureAllocator::DeclareTexture(const TextureDesc&      Desc,
+                                                 Uint32                  FirstPass,
+                                                 Uint32                  LastPass,
+                                                 TRANSIENT_TEXTURE_FLAGS Flags)
+{
+    DEV_CHECK_ERR(Desc.Usage == USAGE_DEFAULT, "Transient texture '", (Desc.Name != nullptr ? Desc.Name : ""), "' must use USAGE_DEFAULT");
+    DEV_CHECK_ERR(FirstPass <= LastPass, "The first pass (", FirstPass, ") must not be greater than the last pass (", LastPass, ")");
+
+    TextureDeclaration Decl;
+    Decl.Desc      = Desc;
+    Decl.FirstPass = FirstPass;
+    Decl.LastPass  = LastPass;
+    Decl.Flags     = Flags;
+    if (Decl.Desc.MipLevels == 0)
+        Decl.Desc.MipLevels = ComputeMipLevelsCount(Desc.GetWidth(), Desc.GetHeight(), Desc.GetDepth());
+
+    m_Declarations.emplace_back(Decl);
+    return static_cast<Uint32>(m_Declarations.size() - 1);
+}
+
+bool TransientTextureAllocator::CanBeMemoryless(IRenderDevice* pDevice, const TextureDeclaration& Decl) const
+{
+    if (!m_EnableMemoryless || (Decl.Flags & TRANSIENT_TEXTURE_FLAG_ALLOW_MEMORYLESS) == 0)
+        return false;
+
+    const auto MemorylessBindFlags = pDevice->GetAdapterInfo().Memory.MemorylessTextureBindFlags;
+    return MemorylessBindFlags != BIND_NONE && (Decl.Desc.BindFlags & ~MemorylessBindFlags) == 0;
+}
+
+bool TransientTextureAllocator::CanAlias(IRenderDevice* pDevice, const TextureDeclaration& Decl) const
+{
+    if (!m_EnableAliasing || (Decl.Flags & TRANSIENT_TEXTURE_FLAG_NO_ALIASING) != 0)
+        return false;
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    // Metal sparse textures are created from a memory object and can't be bound to a different one
+    if (!DeviceInfo.Features.SparseResources || DeviceInfo.IsMetalDevice())
+        return false;
+
+    const auto& Desc      = Decl.Desc;
+    const auto  CapFlags  = pDevice->GetAdapterInfo().SparseResources.CapFlags;
+    const auto  Required2D = (Desc.Type == RESOURCE_DIM_TEX_2D_ARRAY && Desc.MipLevels > 1) ?
+        SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D | SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D_ARRAY_MIP_TAIL :
+        SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D;
+    if ((CapFlags & SPARSE_RESOURCE_CAP_FLAG_ALIASED) == 0 || (CapFlags & Required2D) != Required2D)
+        return false;
+
+    if ((Desc.Type != RESOURCE_DIM_TEX_2D && Desc.Type != RESOURCE_DIM_TEX_2D_ARRAY) || Desc.SampleCount != 1)
+        return false;
+
+    const auto& SparseInfo = pDevice->GetSparseTextureFormatInfo(Desc.Format, Desc.Type, Desc.SampleCount);
+    return (SparseInfo.BindFlags & Desc.BindFlags) == Desc.BindFlags;
+}
+
+void TransientTextureAllocator::Compile(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pDevice != nullptr, "pDevice must not be null");
+
+    if (m_Declarations == m_CompiledDeclarations)
+        return;
+
+    m_Slots.clear();
+    m_Slots.resize(m_Declarations.size());
+
+    std::vector<Uint32> AliasedHandles;
+    std::vector<Uint32> PooledHandles;
+    for (Uint32 Handle = 0; Handle < m_Declarations.size(); ++Handle)
+    {
+        const auto& Decl = m_Declarations[Handle];
+        if (CanBeMemoryless(pDevice, Decl))
+        {
+            // Memoryless textures do not occupy memory, but still share objects
+            m_Slots[Handle].IsMemoryless = true;
+            PooledHandles.push_back(Handle);
+        }
+        else if (CanAlias(pDevice, Decl))
+        {
+            AliasedHandles.push_back(Handle);
+        }
+        else
+        {
+            PooledHandles.push_back(Handle);
+        }
+    }
+
+    if (!AliasedHandles.empty() && pContext == nullptr)
+    {
+        DEV_ERROR("Binding aliased texture memory requires a device context");
+        PooledHandles.insert(PooledHandles.end(), AliasedHandles.begin(), AliasedHandles.end());
+        AliasedHandles.clear();
+    }
+
+    // Textures that fail to be aliased fall back to pooled objects
+    CompileAliasedTextures(pDevice, pContext, AliasedHandles, PooledHandles);
+    CompilePooledTextures(pDevice, PooledHandles);
+
+    m_CompiledDeclarations = m_Declarations;
+    ++m_NumCompiles;
+}
+
+void TransientTextureAllocator::CompileAliasedTextures(IRenderDevice*             pDevice,
+                                                       IDeviceContext*            pContext,
+                                                       const std::vector<Uint32>& Handles,
+                                                       std::vector<Uint32>&       FallbackHandles)
+{
+    // Previous textures and memory are released when the GPU is done with them
+    m_pHeap.Release();
+    if (Handles.empty())
+        return;
+
+    // Create sparse textures and compute their memory requirements
+    std::vector<Uint32> PlacedHandles;
+    PlacedHandles.reserve(Handles.size());
+    Uint32 MaxBlockSize = 0;
+    for (Uint32 Handle : Handles)
+    {
+        const auto& Decl = m_Declarations[Handle];
+        auto&       Slot = m_Slots[Handle];
+
+        auto Desc = Decl.Desc;
+        Desc.Usage = USAGE_SPARSE;
+        Desc.MiscFlags |= MISC_TEXTURE_FLAG_SPARSE_ALIASING;
+        pDevice->CreateTexture(Desc, nullptr, &Slot.pTexture);
+        if (!Slot.pTexture)
+        {
+            LOG_WARNING_MESSAGE("Failed to create aliased transient texture '", (Desc.Name != nullptr ? Desc.Name : ""), "'. The texture will not be aliased.");
+            FallbackHandles.push_back(Handle);
+            continue;
+        }
+
+        const auto& Props = Slot.pTexture->GetSparseProperties();
+
+        const auto NumNormalMips = std::min(Desc.MipLevels, Props.FirstMipInTail);
+        Uint64     NumBlocks     = 0;
+        for (Uint32 Mip = 0; Mip < NumNormalMips; ++Mip)
+        {
+            const auto NumTiles = GetNumSparseTilesInMipLevel(Desc, Props.TileSize, Mip);
+            NumBlocks += Uint64{NumTiles.x} * NumTiles.y * NumTiles.z;
+        }
+        Slot.MemorySize = NumBlocks * Props.BlockSize * Desc.ArraySize;
+        if (Desc.MipLevels > Props.FirstMipInTail)
+        {
+            const Uint32 NumMipTails = (Props.Flags & SPARSE_TEXTURE_FLAG_SINGLE_MIPTAIL) != 0 ? 1 : Desc.ArraySize;
+            Slot.MemorySize += Props.MipTailSize * NumMipTails;
+        }
+        Slot.IsAliased = true;
+        MaxBlockSize   = std::max(MaxBlockSize, Props.BlockSize);
+        PlacedHandles.push_back(Handle);
+    }
+    if (PlacedHandles.empty())
+        return;
+
+    // Place larger textures first. Every texture is placed at the lowest offset
+    // that does not overlap textures with intersecting lifetimes.
+    std::sort(PlacedHandles.begin(), PlacedHandles.end(),
+              [this](Uint32 H0, Uint32 H1) {
+                  return m_Slots[H0].MemorySize != m_Slots[H1].MemorySize ?
+                      m_Slots[H0].MemorySize > m_Slots[H1].MemorySize :
+                      H0 < H1;
+              });
+
+    Uint64 HeapSize = 0;
+    for (size_t i = 0; i < PlacedHandles.size(); ++i)
+    {
+        const auto& Decl = m_Declarations[PlacedHandles[i]];
+        auto&       Slot = m_Slots[PlacedHandles[i]];
+
+        // Memory ranges of the placed textures that are alive at the same time
+        std::vector<std::pair<Uint64, Uint64>> Occupied;
+        for (size_t j = 0; j < i; ++j)
+        {
+            const auto& OtherDecl = m_Declarations[PlacedHandles[j]];
+            const auto& OtherSlot = m_Slots[PlacedHandles[j]];
+            if (OtherDecl.FirstPass <= Decl.LastPass && Decl.FirstPass <= OtherDecl.LastPass)
+                Occupied.emplace_back(OtherSlot.MemoryOffset, OtherSlot.MemoryOffset + OtherSlot.MemorySize);
+        }
+        std::sort(Occupied.begin(), Occupied.end());
+
+        const Uint32 Alignment = Slot.pTexture->GetSparseProperties().BlockSize;
+
+        Uint64 Offset = 0;
+        for (const auto& Range : Occupied)
+        {
+            if (Offset + Slot.MemorySize <= Range.first)
+                break;
+            Offset = std::max(Offset, AlignUp(Range.second, Uint64{Alignment}));
+        }
+        Slot.MemoryOffset = Offset;
+        HeapSize          = std::max(HeapSize, Offset + Slot.MemorySize);
+    }
+    HeapSize = AlignUp(HeapSize, Uint64{MaxBlockSize});
+
+    std::vector<IDeviceObject*> pCompatibleRes;
+    pCompatibleRes.reserve(PlacedHandles.size());
+    for (Uint32 Handle : PlacedHandles)
+        pCompatibleRes.push_back(m_Slots[Handle].pTexture);
+
+    DeviceMemoryCreateInfo MemCI;
+    MemCI.Desc.Name             = "Transient texture aliasing heap";
+    MemCI.Desc.Type             = DEVICE_MEMORY_TYPE_SPARSE;
+    MemCI.Desc.PageSize         = HeapSize;
+    MemCI.InitialSize           = HeapSize;
+    MemCI.ppCompatibleResources = pCompatibleRes.data();
+    MemCI.NumResources          = static_cast<Uint32>(pCompatibleRes.size());
+    pDevice->CreateDeviceMemory(MemCI, &m_pHeap);
+    if (!m_pHeap)
+    {
+        LOG_ERROR_MESSAGE("Failed to create the aliasing heap for transient textures of '", m_Name, "'. Textures will not be aliased.");
+        for (Uint32 Handle : PlacedHandles)
+        {
+            m_Slots[Handle] = {};
+            FallbackHandles.push_back(Handle);
+        }
+        return;
+    }
+
+    // Bind the whole textures to their memory ranges
+    std::vector<SparseTextureMemoryBindRange> Ranges;
+    std::vector<SparseTextureMemoryBindInfo>  TexBinds;
+    std::vector<size_t>                       FirstRanges;
+    for (Uint32 Handle : PlacedHandles)
+    {
+        const auto& Slot  = m_Slots[Handle];
+        const auto& Desc  = Slot.pTexture->GetDesc();
+        const auto& Props = Slot.pTexture->GetSparseProperties();
+
+        FirstRanges.push_back(Ranges.size());
+
+        const auto NumNormalMips = std::min(Desc.MipLevels, Props.FirstMipInTail);
+        const bool SingleMipTail = (Props.Flags & SPARSE_TEXTURE_FLAG_SINGLE_MIPTAIL) != 0;
+
+        Uint64 Offset = Slot.MemoryOffset;
+        for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < NumNormalMips; ++Mip)
+            {
+                const auto MipProps = GetMipLevelProperties(Desc, Mip);
+
+                SparseTextureMemoryBindRange Range;
+                Range.MipLevel     = Mip;
+                Range.ArraySlice   = Slice;
+                Range.Region       = Box{0, MipProps.StorageWidth, 0, MipProps.StorageHeight};
+                Range.MemoryOffset = Offset;
+                Range.pMemory      = m_pHeap;
+
+                const auto NumTiles = GetNumSparseTilesInBox(Range.Region, Props.TileSize);
+                Range.MemorySize    = Uint64{NumTiles.x} * NumTiles.y * NumTiles.z * Props.BlockSize;
+                Offset += Range.MemorySize;
+                Ranges.push_back(Range);
+            }
+
+            if (Desc.MipLevels > Props.FirstMipInTail && (!SingleMipTail || Slice == 0))
+            {
+                SparseTextureMemoryBindRange Range;
+                Range.MipLevel     = Props.FirstMipInTail;
+                Range.ArraySlice   = Slice;
+                Range.MemorySize   = Props.MipTailSize;
+                Range.MemoryOffset = Offset;
+                Range.pMemory      = m_pHeap;
+                Offset += Range.MemorySize;
+                Ranges.push_back(Range);
+            }
+        }
+        VERIFY_EXPR(Offset == Slot.MemoryOffset + Slot.MemorySize);
+    }
+
+    // Ranges must not be reallocated after pointers to them are taken
+    for (size_t i = 0; i < PlacedHandles.size(); ++i)
+    {
+        const size_t RangesEnd = i + 1 < FirstRanges.size() ? FirstRanges[i + 1] : Ranges.size();
+
+        SparseTextureMemoryBindInfo TexBind;
+        TexBind.pTexture  = m_Slots[PlacedHandles[i]].pTexture;
+        TexBind.pRanges   = Ranges.data() + FirstRanges[i];
+        TexBind.NumRanges = static_cast<Uint32>(RangesEnd - FirstRanges[i]);
+        TexBinds.push_back(TexBind);
+    }
+
+    BindSparseResourceMemoryAttribs BindMemAttribs;
+    BindMemAttribs.NumTextureBinds = static_cast<Uint32>(TexBinds.size());
+    BindMemAttribs.pTextureBinds   = TexBinds.data();
+
+    Uint64  WaitFenceValue = 0;
+    IFence* pWaitFence     = nullptr;
+    if (m_pBeforeBindFence)
+    {
+        WaitFenceValue = m_NextBeforeBindFenceValue++;
+        pWaitFence     = m_pBeforeBindFence;
+
+        BindMemAttribs.NumWaitFences    = 1;
+        BindMemAttribs.pWaitFenceValues = &WaitFenceValue;
+        BindMemAttribs.ppWaitFences     = &pWaitFence;
+
+        pContext->EnqueueSignal(m_pBeforeBindFence, WaitFenceValue);
+    }
+
+    Uint64  SignalFenceValue = 0;
+    IFence* pSignalFence     = nullptr;
+    if (m_pAfterBindFence)
+    {
+        SignalFenceValue = m_NextAfterBindFenceValue++;
+        pSignalFence     = m_pAfterBindFence;
+
+        BindMemAttribs.NumSignalFences    = 1;
+        BindMemAttribs.pSignalFenceValues = &SignalFenceValue;
+        BindMemAttribs.ppSignalFences     = &pSignalFence;
+    }
+
+    pContext->BindSparseResourceMemory(BindMemAttribs);
+
+    if (m_pAfterBindFence)
+        pContext->DeviceWaitForFence(m_pAfterBindFence, SignalFenceValue);
+}
+
+void TransientTextureAllocator::CompilePooledTextures(IRenderDevice* pDevice, const std::vector<Uint32>& Handles)
+{
+    for (auto& Pooled : m_Pool)
+        Pooled.InUse = false;
+
+    // Assign textures in the order of their first pass so that an object
+    // can be reused by a texture whose lifetime starts after the previous one ends.
+    std::vector<Uint32> SortedHandles{Handles};
+    std::stable_sort(SortedHandles.begin(), SortedHandles.end(),
+                     [this](Uint32 H0, Uint32 H1) {
+                         return m_Declarations[H0].FirstPass < m_Declarations[H1].FirstPass;
+                     });
+
+    for (Uint32 Handle : SortedHandles)
+    {
+        const auto& Decl = m_Declarations[Handle];
+        auto&       Slot = m_Slots[Handle];
+
+        auto Desc = Decl.Desc;
+        if (Slot.IsMemoryless)
+            Desc.MiscFlags |= MISC_TEXTURE_FLAG_MEMORYLESS;
+
+        auto PooledIt = std::find_if(m_Pool.begin(), m_Pool.end(),
+                                     [&](const PooledTexture& Pooled) {
+                                         return (!Pooled.InUse || Pooled.LastPass < Decl.FirstPass) && Pooled.pTexture->GetDesc() == Desc;
+                                     });
+        if (PooledIt == m_Pool.end())
+        {
+            PooledTexture Pooled;
+            pDevice->CreateTexture(Desc, nullptr, &Pooled.pTexture);
+            if (!Pooled.pTexture)
+            {
+                LOG_ERROR_MESSAGE("Failed to create transient texture '", (Desc.Name != nullptr ? Desc.Name : ""), "'");
+                continue;
+            }
+            PooledIt = m_Pool.emplace(m_Pool.end(), std::move(Pooled));
+        }
+
+        PooledIt->InUse    = true;
+        PooledIt->LastPass = Decl.LastPass;
+        Slot.pTexture      = PooledIt->pTexture;
+    }
+
+    // Release objects that are no longer used
+    m_Pool.erase(std::remove_if(m_Pool.begin(), m_Pool.end(),
+                                [](const PooledTexture& Pooled) {
+                                    return !Pooled.InUse;
+                                }),
+                 m_Pool.end());
+}
+
+void TransientTextureAllocator::BeginPass(IDeviceContext* pContext, Uint32 Pass)
+{
+    DEV_CHECK_ERR(m_Declarations == m_CompiledDeclarations, "Compile() must be called after the textures have been declared");
+
+    std::vector<StateTransitionDesc> Barriers;
+    for (Uint32 Handle = 0; Handle < m_Slots.size(); ++Handle)
+    {
+        const auto& Slot = m_Slots[Handle];
+        if (Slot.IsAliased && m_Declarations[Handle].FirstPass == Pass)
+        {
+            // Any texture that shares the memory may have been used before
+            Barriers.emplace_back(nullptr, Slot.pTexture);
+        }
+    }
+
+    if (!Barriers.empty())
+        pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+}
+
+ITexture* TransientTextureAllocator::GetTexture(Uint32 Handle) const
+{
+    DEV_CHECK_ERR(m_Declarations == m_CompiledDeclarations, "Compile() must be called after the textures have been declared");
+    return Handle < m_Slots.size() ? m_Slots[Handle].pTexture.RawPtr() : nullptr;
+}
+
+TransientTextureAllocatorStats TransientTextureAllocator::GetStats() const
+{
+    TransientTextureAllocatorStats Stats;
+    Stats.NumTextures = static_cast<Uint32>(m_Slots.size());
+    for (const auto& Slot : m_Slots)
+    {
+        if (Slot.IsAliased)
+        {
+            ++Stats.NumAliasedTextures;
+            Stats.AliasedTexturesSize += Slot.MemorySize;
+        }
+        if (Slot.IsMemoryless)
+            ++Stats.NumMemorylessTextures;
+    }
+    Stats.NumPooledTextureObjects = static_cast<Uint32>(m_Pool.size());
+    Stats.HeapSize                = m_pHeap ? m_pHeap->GetCapacity() : 0;
+    Stats.NumCompiles             = m_NumCompiles;
+    return Stats;
+}
+
+} // namespace Diligent
@@ -29,6 +29,8 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <map>
+#include <vector>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -50,14 +52,13 @@ public:
     using TBase = ObjectBase<IVertexPoolAllocation>;
     VertexPoolAllocationImpl(IReferenceCounters*                          pRefCounters,
                              VertexPoolImpl*                              pParentPool,
-                             Uint32                                       StartVertex,
                              Uint32                                       VertexCount,
                              VariableSizeAllocationsManager::Allocation&& Region) :
         // clang-format off
         TBase        {pRefCounters},
         m_pParentPool{pParentPool},
         m_Region     {std::move(Region)},
-        m_StartVertex{StartVertex},
+        m_StartVertex{static_cast<Uint32>(m_Region.UnalignedOffset)},
         m_VertexCount{VertexCount}
     // clang-format on
     {
@@ -83,7 +84,7 @@ public:
 
     virtual Uint32 GetStartVertex() const override final
     {
-        return m_StartVertex;
+        return m_StartVertex.load();
     }
 
     virtual Uint32 GetVertexCount() const override final
@@ -107,13 +108,25 @@ public:
         return m_pUserData;
     }
 
+    // Replaces the region with the new one and returns the old region.
+    // The parent pool's mutex must be locked.
+    VariableSizeAllocationsManager::Allocation SwapRegion(VariableSizeAllocationsManager::Allocation&& NewRegion)
+    {
+        VariableSizeAllocationsManager::Allocation OldRegion = std::move(m_Region);
+
+        m_Region = std::move(NewRegion);
+        m_StartVertex.store(static_cast<Uint32>(m_Region.UnalignedOffset));
+        return OldRegion;
+    }
+
 private:
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
     VariableSizeAllocationsManager::Allocation m_Region;
 
-    const Uint32 m_StartVertex;
-    const Uint32 m_VertexCount;
+    // The start vertex may be changed by the defragmentation
+    std::atomic<Uint32> m_StartVertex{0};
+    const Uint32        m_VertexCount;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -315,12 +328,13 @@ public:
 
         if (Region.IsValid())
         {
+            const auto StartVertex = Region.UnalignedOffset;
+
             // clang-format off
             VertexPoolAllocationImpl* pSuballocation{
                 NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
                 (
                     this,
-                    static_cast<Uint32>(Region.UnalignedOffset),
                     NumVertices,
                     std::move(Region)
                 )
@@ -329,12 +343,18 @@ public:
 
             pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
             m_AllocationCount.fetch_add(1);
+
+            {
+                std::lock_guard<std::mutex> Lock{m_MgrMtx};
+                m_Allocations.emplace(StartVertex, RefCntWeakPtr<VertexPoolAllocationImpl>{pSuballocation});
+            }
         }
     }
 
     void Free(VariableSizeAllocationsManager::Allocation&& Region)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        m_Allocations.erase(Region.UnalignedOffset);
         m_Mgr.Free(std::move(Region));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
@@ -368,6 +388,11 @@ public:
         UsageStats.AllocationCount = m_AllocationCount.load();
     }
 
+    virtual Uint64 Defragment(IRenderDevice*                               pDevice,
+                              IDeviceContext*                              pContext,
+                              Uint64                                       MaxBytesToMove,
+                              const VertexPoolAllocationMovedCallbackType& OnMoved) override final;
+
 private:
     void UpdateUsageStats()
     {
@@ -383,6 +408,16 @@ private:
         m_CommittedMemorySize.store(CommittedMemorySize);
     }
 
+    // m_MgrMtx must be locked
+    void UpdateAllocationKey(VariableSizeAllocationsManager::OffsetType OldKey, VariableSizeAllocationsManager::OffsetType NewKey)
+    {
+        auto it = m_Allocations.find(OldKey);
+        VERIFY_EXPR(it != m_Allocations.end());
+        auto pWeakAllocation = std::move(it->second);
+        m_Allocations.erase(it);
+        m_Allocations.emplace(NewKey, std::move(pWeakAllocation));
+    }
+
 private:
     const std::string                        m_Name;
     const std::vector<VertexPoolElementDesc> m_Elements;
@@ -406,6 +441,13 @@ private:
     std::atomic<Uint64> m_TotalVertexCount{0};
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
+
+    // All live allocations, keyed by their start vertex.
+    // Protected by m_MgrMtx.
+    std::map<VariableSizeAllocationsManager::OffsetType, RefCntWeakPtr<VertexPoolAllocationImpl>> m_Allocations;
+
+    // Scratch buffer used to move the data during the defragmentation
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
 };
 
 
@@ -429,6 +471,163 @@ IBuffer* VertexPoolAllocationImpl::GetBuffer(Uint32 Index) const
     return m_pParentPool->GetBuffer(Index);
 }
 
+
+Uint64 VertexPoolImpl::Defragment(IRenderDevice*                               pDevice,
+                                  IDeviceContext*                              pContext,
+                                  Uint64                                       MaxBytesToMove,
+                                  const VertexPoolAllocationMovedCallbackType& OnMoved)
+{
+    DEV_CHECK_ERR(pDevice != nullptr && pContext != nullptr, "Device and context must not be null");
+
+    Uint64 VertexSize  = 0;
+    Uint32 MaxElemSize = 0;
+    for (const auto& Elem : m_Elements)
+    {
+        if (Elem.Usage != USAGE_DEFAULT && Elem.Usage != USAGE_SPARSE)
+        {
+            LOG_WARNING_MESSAGE_ONCE("Defragmentation is only supported for pools with USAGE_DEFAULT and USAGE_SPARSE buffers");
+            return 0;
+        }
+        VertexSize += Elem.Size;
+        MaxElemSize = std::max(MaxElemSize, Elem.Size);
+    }
+
+    UpdateAll(pDevice, pContext);
+    for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+    {
+        if (GetBuffer(i) == nullptr)
+            return 0;
+    }
+
+    struct MoveInfo
+    {
+        RefCntAutoPtr<VertexPoolAllocationImpl>    pAllocation;
+        VariableSizeAllocationsManager::Allocation OldRegion;
+        Uint32                                     OldStartVertex;
+    };
+    std::vector<MoveInfo> Moves;
+
+    Uint64 VerticesToMove = 0;
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+        // Move the allocations with the highest start vertices first
+        for (auto it = m_Allocations.rbegin(); it != m_Allocations.rend(); ++it)
+        {
+            // There is no free space below this allocation
+            if (it->first < m_Mgr.GetFirstFreeBlockOffset())
+                break;
+
+            auto pAllocation = it->second.Lock();
+            if (!pAllocation)
+                continue; // The allocation is being destroyed
+
+            const auto VertexCount = pAllocation->GetVertexCount();
+            if (!Moves.empty() && (VerticesToMove + VertexCount) * VertexSize > MaxBytesToMove)
+                break;
+
+            auto NewRegion = m_Mgr.Allocate(VertexCount, 1);
+            if (!NewRegion.IsValid())
+                continue;
+
+            if (NewRegion.UnalignedOffset >= it->first)
+            {
+                // The allocation can't be moved to a lower start vertex
+                m_Mgr.Free(std::move(NewRegion));
+                continue;
+            }
+
+            const auto OldStartVertex = pAllocation->GetStartVertex();
+
+            auto OldRegion = pAllocation->SwapRegion(std::move(NewRegion));
+            Moves.push_back({std::move(pAllocation), std::move(OldRegion), OldStartVertex});
+            VerticesToMove += VertexCount;
+        }
+
+        // Update the keys after the iteration is complete to keep the iterators valid
+        for (const auto& Move : Moves)
+            UpdateAllocationKey(Move.OldRegion.UnalignedOffset, Move.pAllocation->GetStartVertex());
+    }
+
+    if (Moves.empty())
+        return 0;
+
+    // Direct copies within the same buffer are not allowed in all backends,
+    // so the data is moved through the scratch buffer that is reused for all elements.
+    const Uint64 ScratchSize = VerticesToMove * MaxElemSize;
+    if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < ScratchSize)
+    {
+        m_pScratchBuffer.Release();
+
+        BufferDesc ScratchDesc;
+        ScratchDesc.Name  = "Vertex pool defragmentation scratch buffer";
+        ScratchDesc.Size  = ScratchSize;
+        ScratchDesc.Usage = USAGE_DEFAULT;
+        pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+    }
+
+    if (!m_pScratchBuffer)
+    {
+        LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer");
+
+        // Move the allocations back to their original regions
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+            for (auto& Move : Moves)
+            {
+                auto NewRegion = Move.pAllocation->SwapRegion(std::move(Move.OldRegion));
+                UpdateAllocationKey(NewRegion.UnalignedOffset, Move.pAllocation->GetStartVertex());
+                m_Mgr.Free(std::move(NewRegion));
+            }
+            UpdateUsageStats();
+        }
+        return 0;
+    }
+
+    for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+    {
+        IBuffer*     pBuffer  = m_Buffers[i]->GetBuffer();
+        const Uint64 ElemSize = m_Elements[i].Size;
+
+        Uint64 ScratchOffset = 0;
+        for (const auto& Move : Moves)
+        {
+            const auto Size = Move.pAllocation->GetVertexCount() * ElemSize;
+            pContext->CopyBuffer(pBuffer, Move.OldStartVertex * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 m_pScratchBuffer, ScratchOffset, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ScratchOffset += Size;
+        }
+
+        ScratchOffset = 0;
+        for (const auto& Move : Moves)
+        {
+            const auto Size = Move.pAllocation->GetVertexCount() * ElemSize;
+            pContext->CopyBuffer(m_pScratchBuffer, ScratchOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                 pBuffer, Move.pAllocation->GetStartVertex() * ElemSize, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            ScratchOffset += Size;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_MgrMtx};
+        for (auto& Move : Moves)
+            m_Mgr.Free(std::move(Move.OldRegion));
+        UpdateUsageStats();
+    }
+
+    if (OnMoved)
+    {
+        for (const auto& Move : Moves)
+            OnMoved(Move.pAllocation, Move.OldStartVertex);
+    }
+
+    // NB: strong references must be released outside of the lock since
+    //     allocation destructors lock the mutex.
+    Moves.clear();
+
+    return VerticesToMove * VertexSize;
+}
+
 void CreateVertexPool(IRenderDevice*              pDevice,
                       const VertexPoolCreateInfo& CreateInfo,
                       IVertexPool**               ppVertexPool)
@@ -61,6 +61,11 @@ XXH128Hash XXH128State::Digest() noexcept
 }
 
 void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
+{
+    Update(ShaderCI, nullptr);
+}
+
+void XXH128State::Update(const ShaderCreateInfo& ShaderCI, std::vector<std::string>* pSourceFiles) noexcept
 {
     ASSERT_SIZEOF64(ShaderCI, 152, "Did you add new members to ShaderCreateInfo? Please handle them here.");
 
@@ -73,14 +78,17 @@ void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
            ShaderCI.GLSLVersion,
            ShaderCI.GLESSLVersion,
            ShaderCI.MSLVersion,
-           ShaderCI.CompileFlags,
+           // Asynchronous compilation does not affect the bytecode
+           ShaderCI.CompileFlags & ~SHADER_COMPILE_FLAG_ASYNCHRONOUS,
            ShaderCI.LoadConstantBufferReflection);
 
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "ShaderCI.ByteCode must be null when either Source or FilePath is specified");
-        ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
+        ProcessShaderIncludes(ShaderCI, [this, pSourceFiles](const ShaderIncludePreprocessInfo& ProcessInfo) {
             UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
+            if (pSourceFiles != nullptr && !ProcessInfo.FilePath.empty())
+                pSourceFiles->push_back(ProcessInfo.FilePath);
         });
     }
     else if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
@@ -36,6 +36,7 @@
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
 #include "Shader.h"
+#include "ThreadPool.h"
 #include "HashUtils.hpp"
 #include "Constants.h"
 #include "HLSLTokenizer.hpp"
@@ -147,6 +148,24 @@ public:
     /// \return     Converted GLSL source code.
     String Convert(ConversionAttribs& Attribs) const;
 
+    /// Converts multiple entry points from the same HLSL source
+
+    /// \param [in] pAttribs    - Array of NumAttribs conversion attributes, one for every entry point.
+    ///                          Source-related members (pSourceStreamFactory, HLSLSource, NumSymbols
+    ///                          and InputFileName) are taken from the first element.
+    ///                          ppConversionStream members are ignored.
+    /// \param [in] NumAttribs  - Number of elements in pAttribs array.
+    /// \param [in] pThreadPool - Optional thread pool to run the conversions on.
+    ///                          If null, entry points are converted sequentially on the calling thread.
+    /// \return     Converted GLSL source code for every entry point, in the same order as pAttribs.
+    ///             Empty string is returned for entry points that failed to convert.
+    ///
+    /// \remarks    The source is tokenized only once, and all conversions read the shared
+    ///             tokenized representation concurrently.
+    std::vector<String> Convert(const ConversionAttribs* pAttribs,
+                                Uint32                   NumAttribs,
+                                IThreadPool*             pThreadPool) const;
+
     /// Creates a conversion stream
 
     /// \param [in] InputFileName - Input file name. If HLSLSource is null, this name will be
@@ -242,6 +261,10 @@ private:
         /// \param [in] NumSymbols    - Number of symbols in the HLSLSource string
         /// \param [in] bPreserveTokens - Whether to preserve original tokens. This must be set to true if the stream
         ///                               will be used for multiple conversions.
+        ///
+        /// \remarks   When original tokens are preserved, they are never modified after the stream
+        ///            is created, and every conversion runs on its own copy of the tokens.
+        ///            Such stream can be used by multiple threads simultaneously.
         ConversionStream(IReferenceCounters*              pRefCounters,
                          const HLSL2GLSLConverterImpl&    Converter,
                          const char*                      InputFileName,
@@ -250,6 +273,10 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates a single-use stream that converts a copy of the tokens of the parsed stream.
+        ConversionStream(IReferenceCounters*     pRefCounters,
+                         const ConversionStream& ParsedStream);
+
         String Convert(const Char* EntryPoint,
                        SHADER_TYPE ShaderType,
                        bool        IncludeDefintions,
@@ -459,7 +486,8 @@ private:
 
         String BuildGLSLSource();
 
-        // Tokenized source code
+        // Tokenized source code.
+        // If the stream preserves tokens, the list is never modified after the stream is created.
         TokenListType m_Tokens;
 
         // List of tokens defining structs
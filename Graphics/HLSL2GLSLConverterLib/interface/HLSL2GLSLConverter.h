@@ -51,6 +51,11 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_HLSL2GLSLConversionStream =
 
 DILIGENT_BEGIN_INTERFACE(IHLSL2GLSLConversionStream, IObject)
 {
+    /// Converts the shader entry point to GLSL.
+
+    /// \remarks   The stream tokenizes the source once when it is created, and every conversion
+    ///            works on its own copy of the tokens. The method can be called by multiple threads
+    ///            simultaneously, for example to convert different entry points in parallel.
     VIRTUAL void METHOD(Convert)(THIS_
                                  const Char* EntryPoint,
                                  SHADER_TYPE ShaderType,
@@ -381,6 +381,7 @@
 #include "ParsingTools.hpp"
 #include "EngineMemory.h"
 #include "GLSLParsingTools.hpp"
+#include "ThreadPool.hpp"
 
 using namespace std;
 
@@ -4459,6 +4460,18 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
     m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
 }
 
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*     pRefCounters,
+                                                           const ConversionStream& ParsedStream) :
+    // clang-format off
+    TBase            {pRefCounters                },
+    m_Tokens         {ParsedStream.m_Tokens       },
+    m_bPreserveTokens{false                       },
+    m_Converter      {ParsedStream.m_Converter    },
+    m_InputFileName  {ParsedStream.m_InputFileName}
+// clang-format on
+{
+}
+
 
 String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
 {
@@ -4504,6 +4517,44 @@ String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
     }
 }
 
+std::vector<String> HLSL2GLSLConverterImpl::Convert(const ConversionAttribs* pAttribs,
+                                                    Uint32                   NumAttribs,
+                                                    IThreadPool*             pThreadPool) const
+{
+    std::vector<String> GLSLSources(NumAttribs);
+    if (NumAttribs == 0)
+        return GLSLSources;
+
+    DEV_CHECK_ERR(pAttribs != nullptr, "Conversion attributes must not be null");
+
+    try
+    {
+        const auto& SrcAttribs = pAttribs[0];
+        // The source is tokenized once. The stream preserves the tokens, so every
+        // conversion works on its own copy and the stream can be accessed concurrently.
+        ConversionStream Stream{nullptr, *this, SrcAttribs.InputFileName, SrcAttribs.pSourceStreamFactory, SrcAttribs.HLSLSource, SrcAttribs.NumSymbols, true};
+
+        ParallelFor(pThreadPool, 0, NumAttribs, 1,
+                    [&](Uint32 Idx) {
+                        const auto& Attribs = pAttribs[Idx];
+                        try
+                        {
+                            GLSLSources[Idx] = Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+                                                              Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
+                                                              Attribs.UseRowMajorMatrices);
+                        }
+                        catch (std::runtime_error&)
+                        {
+                        }
+                    });
+    }
+    catch (std::runtime_error&)
+    {
+    }
+
+    return GLSLSources;
+}
+
 void HLSL2GLSLConverterImpl::CreateStream(const Char*                      InputFileName,
                                           IShaderSourceInputStreamFactory* pSourceStreamFactory,
                                           const Char*                      HLSLSource,
@@ -4548,9 +4599,16 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                          bool        UseInOutLocationQualifiers,
                                                          bool        UseRowMajorMatrices)
 {
+    if (m_bPreserveTokens)
+    {
+        // Original tokens are never modified, so that multiple threads can
+        // convert different entry points from the same stream simultaneously.
+        ConversionStream Stream{nullptr, *this};
+        return Stream.Convert(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
+    }
+
     m_bUseInOutLocationQualifiers = UseInOutLocationQualifiers;
     m_bUseRowMajorMatrices        = UseRowMajorMatrices;
-    TokenListType TokensCopy(m_bPreserveTokens ? m_Tokens : TokenListType());
 
     Uint32 ShaderStorageBlockBinding = 0;
     Uint32 ImageBinding              = 0;
@@ -4787,14 +4845,6 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 
     auto GLSLSource = BuildGLSLSource();
 
-    if (m_bPreserveTokens)
-    {
-        m_Tokens.swap(TokensCopy);
-        m_StructDefinitions.clear();
-        m_PreprocessorDefinitions.clear();
-        m_Objects.clear();
-    }
-
     if (IncludeDefintions)
         GLSLSource.insert(0, g_GLSLDefinitions);
 
@@ -80,7 +80,8 @@ public:
     /// Compiles HLSL source code to DXIL or SPIRV.
     ///
     /// \remarks    The method is thread-safe.
-    ///             For each compilation, the method creates a new IDxcCompiler instance.
+    ///             DXC objects are created once per calling thread and are reused
+    ///             by all subsequent compilations on this thread.
     virtual bool Compile(const CompileAttribs& Attribs) = 0;
 
     virtual void Compile(const ShaderCreateInfo& ShaderCI,
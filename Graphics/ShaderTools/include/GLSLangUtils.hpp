@@ -30,6 +30,7 @@
 #include <vector>
 #include "Shader.h"
 #include "DataBlob.h"
+#include "ThreadPool.h"
 
 namespace Diligent
 {
@@ -53,6 +54,33 @@ enum class SpirvVersion
 void InitializeGlslang();
 void FinalizeGlslang();
 
+struct GlslangWarmUpAttribs
+{
+    /// Target SPIRV version of the shaders that will be compiled.
+    SpirvVersion Version = SpirvVersion::Vk100;
+
+    /// Shader stages to warm up.
+    SHADER_TYPE ShaderStages = SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL | SHADER_TYPE_COMPUTE;
+
+    /// GLSL version directive that the shaders will use, e.g. "#version 460 core".
+    /// If null, the GLSL front-end is not warmed up.
+    const char* GLSLVersionDirective = nullptr;
+
+    /// Whether to warm up the HLSL front-end.
+    bool HLSL = false;
+};
+
+/// Builds glslang built-in symbol tables for the given stages and targets.
+
+/// glslang builds the tables when a shader for a new combination of stage, language
+/// version and target is compiled for the first time, and then shares them between all
+/// threads. Building the tables is expensive and is serialized by a global lock, so
+/// calling this function at startup (e.g. on a worker thread) removes this cost from
+/// the first shader compilations.
+///
+/// \remarks   InitializeGlslang() must be called before this function.
+void WarmUpGlslang(const GlslangWarmUpAttribs& Attribs);
+
 struct GLSLtoSPIRVAttribs
 {
     SHADER_TYPE                      ShaderType    = SHADER_TYPE_UNKNOWN;
@@ -64,14 +92,39 @@ struct GLSLtoSPIRVAttribs
     IDataBlob**                      ppCompilerOutput           = nullptr;
     bool                             AssignBindings             = true;
     bool                             UseRowMajorMatrices        = false;
+
+    /// Whether to run SPIRV-Tools performance passes on the generated bytecode.
+    /// When false, the bytecode is returned as produced by glslang.
+    bool OptimizeForPerformance = true;
 };
 
 std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs);
 
+/// Compiles multiple GLSL shaders to SPIRV using the thread pool.
+
+/// \param [in] pAttribs       - An array of NumShaders compilation attributes.
+/// \param [in] NumShaders     - The number of shaders to compile.
+/// \param [in] SharedPreamble - Optional code that is added to the preamble of every shader
+///                              after the shader macros, e.g. common definitions.
+/// \param [in] pThreadPool    - Thread pool to use. If null, all shaders are compiled by
+///                              the calling thread.
+///
+/// \return    An array of SPIRV bytecodes, one for every shader. The bytecode of a shader
+///            that failed to compile is empty.
+std::vector<std::vector<unsigned int>> GLSLtoSPIRV(const GLSLtoSPIRVAttribs* pAttribs,
+                                                   Uint32                    NumShaders,
+                                                   const char*               SharedPreamble,
+                                                   IThreadPool*              pThreadPool);
+
+/// Compiles HLSL shader to SPIRV.
+
+/// \remarks  The generated bytecode is always legalized. When OptimizeForPerformance is false,
+///           performance passes are skipped, which makes the compilation noticeably faster.
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       SpirvVersion            Version,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput);
+                                      IDataBlob**             ppCompilerOutput,
+                                      bool                    OptimizeForPerformance = true);
 
 } // namespace GLSLangUtils
 
@@ -28,10 +28,13 @@
 
 #include <unordered_map>
 #include <list>
+#include <memory>
+#include <type_traits>
 
 #include "ParsingTools.hpp"
 #include "HLSLKeywords.h"
 #include "HashUtils.hpp"
+#include "DynamicLinearAllocator.hpp"
 
 namespace Diligent
 {
@@ -175,6 +178,109 @@ struct HLSLTokenInfo
     }
 };
 
+/// Memory pool for the token list nodes.
+
+/// Nodes are carved out of chunks allocated by a dynamic linear allocator,
+/// and nodes released by the list are recycled through a free list.
+/// All memory is returned at once when the pool is destroyed.
+/// The pool is not thread-safe.
+class HLSLTokenNodePool
+{
+public:
+    HLSLTokenNodePool();
+
+    // clang-format off
+    HLSLTokenNodePool           (const HLSLTokenNodePool&)  = delete;
+    HLSLTokenNodePool           (      HLSLTokenNodePool&&) = delete;
+    HLSLTokenNodePool& operator=(const HLSLTokenNodePool&)  = delete;
+    HLSLTokenNodePool& operator=(      HLSLTokenNodePool&&) = delete;
+    // clang-format on
+
+    void* Allocate(size_t Size, size_t Alignment);
+    void  Free(void* Ptr, size_t Size);
+
+private:
+    static constexpr Uint32 PageSize  = 64 << 10;
+    static constexpr size_t ChunkSize = 16 << 10;
+
+    struct FreeNode
+    {
+        FreeNode* pNext;
+    };
+
+    DynamicLinearAllocator m_Allocator;
+
+    // Size of the blocks that are recycled through the free list.
+    // This is the size of the first requested block, which is the list node size.
+    size_t m_NodeSize = 0;
+
+    FreeNode* m_pFreeList = nullptr;
+    Uint8*    m_pChunkPos = nullptr;
+    Uint8*    m_pChunkEnd = nullptr;
+};
+
+/// STL allocator for the token list that allocates nodes from the HLSLTokenNodePool.
+
+/// Each default-constructed allocator creates a new pool that is shared by
+/// all copies of the allocator. Copies of the token list get their own pool,
+/// while moved and swapped lists take the pool with them.
+template <typename T>
+struct HLSLTokenListAllocator
+{
+    using value_type = T;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    HLSLTokenListAllocator() :
+        pPool{std::make_shared<HLSLTokenNodePool>()}
+    {}
+
+    HLSLTokenListAllocator(const HLSLTokenListAllocator& Other) noexcept :
+        pPool{Other.pPool}
+    {}
+
+    template <typename U>
+    HLSLTokenListAllocator(const HLSLTokenListAllocator<U>& Other) noexcept :
+        pPool{Other.pPool}
+    {}
+
+    HLSLTokenListAllocator& operator=(const HLSLTokenListAllocator& Other) noexcept
+    {
+        pPool = Other.pPool;
+        return *this;
+    }
+
+    HLSLTokenListAllocator select_on_container_copy_construction() const
+    {
+        return HLSLTokenListAllocator{};
+    }
+
+    T* allocate(size_t Count)
+    {
+        return static_cast<T*>(pPool->Allocate(Count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* Ptr, size_t Count)
+    {
+        pPool->Free(Ptr, Count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const HLSLTokenListAllocator<U>& rhs) const
+    {
+        return pPool == rhs.pPool;
+    }
+
+    template <typename U>
+    bool operator!=(const HLSLTokenListAllocator<U>& rhs) const
+    {
+        return pPool != rhs.pPool;
+    }
+
+    std::shared_ptr<HLSLTokenNodePool> pPool;
+};
+
 class HLSLTokenizer
 {
 public:
@@ -186,7 +292,10 @@ public:
         return it != m_Keywords.end() ? &it->second : nullptr;
     }
 
-    using TokenListType = std::list<HLSLTokenInfo>;
+    // Token list nodes are allocated from the pool rather than from the heap.
+    // The list keeps iterators stable across insertions and removals
+    // that the HLSL-to-GLSL converter performs.
+    using TokenListType = std::list<HLSLTokenInfo, HLSLTokenListAllocator<HLSLTokenInfo>>;
     TokenListType Tokenize(const String& Source) const;
 
 private:
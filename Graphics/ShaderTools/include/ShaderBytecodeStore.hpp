@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ShaderBytecodeStore class
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Shader.h"
+
+namespace Diligent
+{
+
+/// Process-shared store of compiled shader bytecode, optionally backed by a directory on disk.
+
+/// The store maps a content key computed by ComputeKey() to the compiled bytecode.
+/// Render devices that are created with the same cache directory share the same store
+/// instance, so a shader compiled by one device is reused by all others.
+/// All methods are thread-safe.
+class ShaderBytecodeStore
+{
+public:
+    using KeyType = size_t;
+
+    /// Returns the store instance for the given cache directory.
+    ///
+    /// \param [in] CacheDir - Directory where the bytecode files are stored.
+    ///                        If null or empty, the store only keeps the bytecode in memory.
+    static std::shared_ptr<ShaderBytecodeStore> Get(const char* CacheDir);
+
+    explicit ShaderBytecodeStore(const char* CacheDir);
+
+    // clang-format off
+    ShaderBytecodeStore           (const ShaderBytecodeStore&)  = delete;
+    ShaderBytecodeStore           (      ShaderBytecodeStore&&) = delete;
+    ShaderBytecodeStore& operator=(const ShaderBytecodeStore&)  = delete;
+    ShaderBytecodeStore& operator=(      ShaderBytecodeStore&&) = delete;
+    // clang-format on
+
+    /// Computes the key of the shader from its preprocessed source (with all includes unrolled),
+    /// macros, entry point, compiler and compile options.
+    ///
+    /// \param [in] ShaderCI   - Shader create info. The shader must be created from source code or a file.
+    /// \param [in] TargetHash - Hash of the backend-specific compilation target, e.g. API version and
+    ///                          device features that affect the generated code.
+    ///
+    /// \remarks   The function throws an exception if the shader source or one of its includes
+    ///            can't be loaded.
+    static KeyType ComputeKey(const ShaderCreateInfo& ShaderCI, size_t TargetHash) noexcept(false);
+
+    /// Looks up the bytecode with the given key in memory and then on disk.
+    ///
+    /// \return    true if the bytecode was found, and false otherwise.
+    bool Find(KeyType Key, std::vector<Uint8>& Bytecode);
+
+    /// Adds the bytecode to the store and writes it to disk if the cache directory is set.
+    void Add(KeyType Key, const void* pBytecode, size_t Size);
+
+private:
+    std::string GetFilePath(KeyType Key) const;
+
+private:
+    const std::string m_CacheDir;
+
+    std::mutex                                      m_Mtx;
+    std::unordered_map<KeyType, std::vector<Uint8>> m_Bytecode;
+};
+
+} // namespace Diligent
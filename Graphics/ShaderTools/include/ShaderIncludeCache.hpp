@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of the Diligent::ShaderIncludeCache class
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Shader.h"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Process-wide cache of shader source files loaded through shader source input stream factories.
+
+/// When the cache is enabled, ProcessShaderIncludes() and UnrollShaderIncludes() load every
+/// source file and find its #include directives only once. All later requests for the same
+/// file from the same factory are served from memory, so common headers are not reloaded
+/// and rescanned for every shader.
+///
+/// The cache is disabled by default. Since stream factories do not expose file modification
+/// times, the cache cannot detect changes on its own: the application must call Invalidate()
+/// when source files change. IRenderStateCache::Reload() invalidates the cache automatically.
+///
+/// All methods are thread-safe.
+class ShaderIncludeCache
+{
+public:
+    /// #include directive found in the source file.
+    struct IncludeDirective
+    {
+        /// Path to the included file, as written in the directive.
+        std::string Path;
+
+        /// Offset of the directive start in the source.
+        size_t Start = 0;
+
+        /// Offset past the directive end in the source.
+        size_t End = 0;
+    };
+
+    /// Cached source file.
+    struct FileData
+    {
+        /// Source code of the file.
+        std::string Source;
+
+        /// Hash of the source code.
+        size_t Hash = 0;
+
+        /// #include directives in the order they appear in the source.
+        std::vector<IncludeDirective> Includes;
+    };
+
+    /// Cache statistics.
+    struct Statistics
+    {
+        /// The number of requests served from the cache.
+        Uint64 NumHits = 0;
+
+        /// The number of requests that had to load the file.
+        Uint64 NumMisses = 0;
+
+        /// The number of files currently in the cache.
+        Uint32 NumFiles = 0;
+
+        /// The total size of the cached source code, in bytes.
+        Uint64 TotalSourceSize = 0;
+
+        /// Returns the share of requests served from the cache, in [0, 1] range.
+        double GetHitRate() const
+        {
+            const auto NumRequests = NumHits + NumMisses;
+            return NumRequests != 0 ? static_cast<double>(NumHits) / static_cast<double>(NumRequests) : 0.0;
+        }
+    };
+
+    /// Returns the global cache instance.
+    static ShaderIncludeCache& GetInstance();
+
+    ShaderIncludeCache() = default;
+
+    // clang-format off
+    ShaderIncludeCache           (const ShaderIncludeCache&)  = delete;
+    ShaderIncludeCache           (      ShaderIncludeCache&&) = delete;
+    ShaderIncludeCache& operator=(const ShaderIncludeCache&)  = delete;
+    ShaderIncludeCache& operator=(      ShaderIncludeCache&&) = delete;
+    // clang-format on
+
+    /// Enables or disables the cache. Disabling the cache also removes all cached files.
+    void SetEnabled(bool Enabled);
+
+    bool IsEnabled() const { return m_Enabled.load(); }
+
+    /// Looks up the file loaded from the given factory.
+    ///
+    /// \return    Pointer to the cached file data, or null if the file is not in the cache.
+    ///            The data remains valid as long as the pointer is held, even if the cache
+    ///            is invalidated.
+    std::shared_ptr<const FileData> Find(IShaderSourceInputStreamFactory* pFactory, const char* FilePath);
+
+    /// Adds the file loaded from the given factory to the cache.
+    ///
+    /// \return    Pointer to the cached file data. If another thread has added the same
+    ///            file in the meantime, the existing data is returned.
+    std::shared_ptr<const FileData> Add(IShaderSourceInputStreamFactory* pFactory, const char* FilePath, FileData&& Data);
+
+    /// Removes all files from the cache.
+    void Invalidate();
+
+    /// Removes the file with the given path loaded from any factory.
+    void Invalidate(const char* FilePath);
+
+    Statistics GetStatistics() const;
+
+    void ResetStatistics();
+
+private:
+    struct FileKey
+    {
+        const IShaderSourceInputStreamFactory* pFactory = nullptr;
+        std::string                            Path;
+
+        bool operator==(const FileKey& rhs) const
+        {
+            return pFactory == rhs.pFactory && Path == rhs.Path;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const FileKey& Key) const;
+        };
+    };
+
+    struct CachedFile
+    {
+        // Used to detect that the factory has been destroyed and
+        // another one was created at the same address.
+        RefCntWeakPtr<IShaderSourceInputStreamFactory> wpFactory;
+
+        std::shared_ptr<const FileData> pData;
+    };
+
+    std::atomic<bool> m_Enabled{false};
+
+    mutable std::mutex                                       m_Mtx;
+    std::unordered_map<FileKey, CachedFile, FileKey::Hasher> m_Files;
+
+    Uint64 m_TotalSourceSize = 0;
+
+    std::atomic<Uint64> m_NumHits{0};
+    std::atomic<Uint64> m_NumMisses{0};
+};
+
+} // namespace Diligent
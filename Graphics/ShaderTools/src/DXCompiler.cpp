@@ -34,6 +34,8 @@
 #include <atomic>
 #include <array>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
 #if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
 #    include "WinHPreface.h"
@@ -118,7 +120,18 @@ public:
                                        IDxcBlob**                 ppDstByteCode) override final;
 
 private:
-    bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* pdxcLibrary, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
+    // DXC objects are not thread-safe and must be used on the thread that created them.
+    // Every thread that uses the compiler gets its own set of objects that is reused
+    // by all subsequent calls on this thread.
+    struct ThreadObjects
+    {
+        CComPtr<IDxcLibrary>   pLibrary;
+        CComPtr<IDxcCompiler>  pCompiler;
+        CComPtr<IDxcValidator> pValidator;
+    };
+    ThreadObjects& GetThreadObjects(DxcCreateInstanceProc CreateInstance) noexcept(false);
+
+    bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, ThreadObjects& Objects, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
 
     enum RES_TYPE : Uint32
     {
@@ -156,6 +169,10 @@ private:
 private:
     DXCompilerLibrary m_Library;
     const Uint32      m_APIVersion;
+
+    std::mutex m_ThreadObjectsMtx;
+    // Objects are never removed, so references returned by GetThreadObjects() remain valid.
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadObjects>> m_ThreadObjects;
 };
 
 #define CHECK_D3D_RESULT(Expr, Message)   \
@@ -344,15 +361,9 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
 
         HRESULT hr;
 
-        // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
-        // Compiler objects should be created and then used on the same thread.
-        // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
-
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
-
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
+        ThreadObjects&      Objects      = GetThreadObjects(CreateInstance);
+        IDxcLibrary* const  pdxcLibrary  = Objects.pLibrary;
+        IDxcCompiler* const pdxcCompiler = Objects.pCompiler;
 
         CComPtr<IDxcBlobEncoding> pSourceBlob;
         CHECK_D3D_RESULT(pdxcLibrary->CreateBlobWithEncodingFromPinned(Attribs.Source, UINT32{Attribs.SourceLength}, CP_UTF8, &pSourceBlob), "Failed to create DXC Blob Encoding");
@@ -398,7 +409,7 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
         // Validate and sign
         if (m_Library.GetTarget() == DXCompilerTarget::Direct3D12)
         {
-            return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, Attribs.ppBlobOut);
+            return ValidateAndSign(CreateInstance, Objects, pCompiledBlob, Attribs.ppBlobOut);
         }
         else
         {
@@ -412,13 +423,37 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
     }
 }
 
-bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* library, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
+DXCompilerImpl::ThreadObjects& DXCompilerImpl::GetThreadObjects(DxcCreateInstanceProc CreateInstance) noexcept(false)
 {
-    CComPtr<IDxcValidator> pdxcValidator;
-    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&pdxcValidator)), "Failed to create DXC Validator");
+    // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
+    // Compiler objects should be created and then used on the same thread.
+    // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
+
+    const std::thread::id ThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> Lock{m_ThreadObjectsMtx};
+
+        auto it = m_ThreadObjects.find(ThreadId);
+        if (it != m_ThreadObjects.end())
+            return *it->second;
+    }
+
+    // Only this thread may add objects for its own id, so it is safe to create them without holding the lock.
+    std::unique_ptr<ThreadObjects> pObjects = std::make_unique<ThreadObjects>();
+    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pObjects->pLibrary)), "Failed to create DXC Library");
+    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pObjects->pCompiler)), "Failed to create DXC Compiler");
+
+    std::lock_guard<std::mutex> Lock{m_ThreadObjectsMtx};
+    return *m_ThreadObjects.emplace(ThreadId, std::move(pObjects)).first->second;
+}
+
+bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, ThreadObjects& Objects, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
+{
+    if (!Objects.pValidator)
+        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&Objects.pValidator)), "Failed to create DXC Validator");
 
     CComPtr<IDxcOperationResult> pdxcResult;
-    CHECK_D3D_RESULT(pdxcValidator->Validate(compiled, DxcValidatorFlags_InPlaceEdit, &pdxcResult), "Failed to validate shader bytecode");
+    CHECK_D3D_RESULT(Objects.pValidator->Validate(compiled, DxcValidatorFlags_InPlaceEdit, &pdxcResult), "Failed to validate shader bytecode");
 
     HRESULT status = E_FAIL;
     pdxcResult->GetStatus(&status);
@@ -436,7 +471,7 @@ bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcL
         CComPtr<IDxcBlobEncoding> pdxcOutput;
         CComPtr<IDxcBlobEncoding> pdxcOutputUtf8;
         pdxcResult->GetErrorBuffer(&pdxcOutput);
-        library->GetBlobAsUtf8(pdxcOutput, &pdxcOutputUtf8);
+        Objects.pLibrary->GetBlobAsUtf8(pdxcOutput, &pdxcOutputUtf8);
 
         const auto  ValidationMsgLen = pdxcOutputUtf8 ? pdxcOutputUtf8->GetBufferSize() : 0;
         const auto* ValidationMsg    = ValidationMsgLen > 0 ? static_cast<const char*>(pdxcOutputUtf8->GetBufferPointer()) : "";
@@ -827,15 +862,13 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
             return false;
         }
 
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
+        ThreadObjects&      Objects      = GetThreadObjects(CreateInstance);
+        IDxcLibrary* const  pdxcLibrary  = Objects.pLibrary;
+        IDxcCompiler* const pdxcCompiler = Objects.pCompiler;
 
         CComPtr<IDxcAssembler> pdxcAssembler;
         CHECK_D3D_RESULT(CreateInstance(CLSID_DxcAssembler, IID_PPV_ARGS(&pdxcAssembler)), "Failed to create DXC assembler");
 
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
-
         CComPtr<IDxcBlobEncoding> pdxcDisasm;
         CHECK_D3D_RESULT(pdxcCompiler->Disassemble(pSrcBytecode, &pdxcDisasm), "Failed to disassemble bytecode");
 
@@ -988,7 +1021,7 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
         CComPtr<IDxcBlob> pCompiledBlob;
         CHECK_D3D_RESULT(pdxcResult->GetResult(static_cast<IDxcBlob**>(&pCompiledBlob)), "Failed to get compiled blob from DXC result");
 
-        return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, ppDstByteCode);
+        return ValidateAndSign(CreateInstance, Objects, pCompiledBlob, ppDstByteCode);
     }
     catch (...)
     {
@@ -47,6 +47,8 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ThreadPool.hpp"
+#include "BasicMath.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
 #endif
@@ -229,6 +231,13 @@ TBuiltInResource InitResources()
     return Resources;
 }
 
+// Resource limits are the same for all shaders, so build the table only once
+const TBuiltInResource& GetDefaultResources()
+{
+    static const TBuiltInResource Resources = InitResources();
+    return Resources;
+}
+
 void LogCompilerError(const char* DebugOutputMessage,
                       const char* InfoLog,
                       const char* InfoDebugLog,
@@ -265,7 +274,7 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 {
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
-    TBuiltInResource Resources = InitResources();
+    const TBuiltInResource& Resources = GetDefaultResources();
 
     auto ParseResult = pIncluder != nullptr ?
         Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
@@ -403,6 +412,17 @@ void SetupWithSpirvVersion(::glslang::TShader&  Shader,
     }
 }
 
+EShMessages GetGLSLMessages(SpirvVersion Version)
+{
+    EShMessages messages = EShMsgSpvRules;
+    static_assert(static_cast<int>(SpirvVersion::Count) == 6, "Did you add a new member to SpirvVersion? You may need to handle it here.");
+    if (Version != SpirvVersion::GL && Version != SpirvVersion::GLES)
+        messages = static_cast<EShMessages>(messages | EShMsgVulkanRules);
+    return messages;
+}
+
+constexpr EShMessages HLSLMessages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
+
 #ifdef USE_SPIRV_TOOLS
 spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 {
@@ -429,11 +449,12 @@ spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       SpirvVersion            Version,
                                       const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+                                      IDataBlob**             ppCompilerOutput,
+                                      bool                    OptimizeForPerformance)
 {
     EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
     ::glslang::TShader Shader{ShLang};
-    EShMessages        messages  = (EShMessages)(EShMsgSpvRules | EShMsgVulkanRules | EShMsgReadHlsl | EShMsgHlslLegalization);
+    EShMessages        messages  = HLSLMessages;
     ::EProfile         shProfile = EProfile::ENoProfile;
 
     SetupWithSpirvVersion(Shader, shProfile, ShLang, Version, ::glslang::EShSourceHlsl);
@@ -487,7 +508,10 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
 #ifdef USE_SPIRV_TOOLS
     // SPIR-V bytecode generated from HLSL must be legalized to
     // turn it into a valid vulkan SPIR-V shader.
-    auto LegalizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+    SPIRV_OPTIMIZATION_FLAGS Passes = SPIRV_OPTIMIZATION_FLAG_LEGALIZATION;
+    if (OptimizeForPerformance)
+        Passes |= SPIRV_OPTIMIZATION_FLAG_PERFORMANCE;
+    auto LegalizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), Passes);
     if (!LegalizedSPIRV.empty())
     {
         return LegalizedSPIRV;
@@ -500,7 +524,51 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     return SPIRV;
 }
 
-std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+void WarmUpGlslang(const GlslangWarmUpAttribs& Attribs)
+{
+    static constexpr char HLSLSource[] = "void main(){}\n";
+
+    const std::string GLSLSource = Attribs.GLSLVersionDirective != nullptr ?
+        std::string{Attribs.GLSLVersionDirective} + "\nvoid main(){}\n" :
+        std::string{};
+
+    for (SHADER_TYPE Stages = Attribs.ShaderStages; Stages != SHADER_TYPE_UNKNOWN;)
+    {
+        const SHADER_TYPE ShaderType = ExtractLSB(Stages);
+        if (ShaderType == SHADER_TYPE_TILE)
+            continue;
+
+        const EShLanguage ShLang = ShaderTypeToShLanguage(ShaderType);
+
+        // Built-in symbol tables are created by parse() before the source is processed,
+        // so the result of the parsing is irrelevant.
+        if (!GLSLSource.empty())
+        {
+            ::glslang::TShader Shader{ShLang};
+            ::EProfile         shProfile = EProfile::ENoProfile;
+            SetupWithSpirvVersion(Shader, shProfile, ShLang, Attribs.Version, ::glslang::EShSourceGlsl);
+
+            const char* ShaderStrings[] = {GLSLSource.c_str()};
+            Shader.setStrings(ShaderStrings, 1);
+            Shader.parse(&GetDefaultResources(), 100, shProfile, false, false, GetGLSLMessages(Attribs.Version));
+        }
+
+        if (Attribs.HLSL)
+        {
+            ::glslang::TShader Shader{ShLang};
+            ::EProfile         shProfile = EProfile::ENoProfile;
+            SetupWithSpirvVersion(Shader, shProfile, ShLang, Attribs.Version, ::glslang::EShSourceHlsl);
+            Shader.setEntryPoint("main");
+            Shader.setEnvTargetHlslFunctionality1();
+
+            const char* ShaderStrings[] = {HLSLSource};
+            Shader.setStrings(ShaderStrings, 1);
+            Shader.parse(&GetDefaultResources(), 100, shProfile, false, false, HLSLMessages);
+        }
+    }
+}
+
+static std::vector<unsigned int> GLSLtoSPIRVInternal(const GLSLtoSPIRVAttribs& Attribs, const char* SharedPreamble)
 {
     VERIFY_EXPR(Attribs.ShaderSource != nullptr && Attribs.SourceCodeLen > 0);
 
@@ -510,10 +578,7 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
 
     SetupWithSpirvVersion(Shader, shProfile, ShLang, Attribs.Version, ::glslang::EShSourceGlsl);
 
-    EShMessages messages = EShMsgSpvRules;
-    static_assert(static_cast<int>(SpirvVersion::Count) == 6, "Did you add a new member to SpirvVersion? You may need to handle it here.");
-    if (Attribs.Version != SpirvVersion::GL && Attribs.Version != SpirvVersion::GLES)
-        messages = static_cast<EShMessages>(messages | EShMsgVulkanRules);
+    const EShMessages messages = GetGLSLMessages(Attribs.Version);
 
     const char* ShaderStrings[] = {Attribs.ShaderSource};
     int         Lengths[]       = {Attribs.SourceCodeLen};
@@ -525,6 +590,8 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     Preamble.append("#define GLSLANG\n\n");
     if (Attribs.Macros)
         AppendShaderMacros(Preamble, Attribs.Macros);
+    if (SharedPreamble != nullptr)
+        Preamble.append(SharedPreamble);
     Shader.setPreamble(Preamble.c_str());
 
     IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
@@ -534,6 +601,9 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
         return SPIRV;
 
 #ifdef USE_SPIRV_TOOLS
+    if (!Attribs.OptimizeForPerformance)
+        return SPIRV;
+
     auto OptimizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Attribs.Version), SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
     if (!OptimizedSPIRV.empty())
     {
@@ -547,6 +617,28 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     return SPIRV;
 }
 
+std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+{
+    return GLSLtoSPIRVInternal(Attribs, nullptr);
+}
+
+std::vector<std::vector<unsigned int>> GLSLtoSPIRV(const GLSLtoSPIRVAttribs* pAttribs,
+                                                   Uint32                    NumShaders,
+                                                   const char*               SharedPreamble,
+                                                   IThreadPool*              pThreadPool)
+{
+    DEV_CHECK_ERR(pAttribs != nullptr || NumShaders == 0, "pAttribs must not be null when NumShaders is not zero");
+
+    // glslang is thread-safe once the process is initialized: every compilation
+    // uses its own thread-local pool allocator and shares the built-in symbol tables.
+    std::vector<std::vector<unsigned int>> SPIRVs(NumShaders);
+    ParallelFor(pThreadPool, 0, NumShaders, 1,
+                [&](Uint32 Idx) {
+                    SPIRVs[Idx] = GLSLtoSPIRVInternal(pAttribs[Idx], SharedPreamble);
+                });
+    return SPIRVs;
+}
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
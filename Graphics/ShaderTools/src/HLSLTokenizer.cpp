@@ -26,12 +26,69 @@
 
 #include "HLSLTokenizer.hpp"
 
+#include <new>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
 namespace Diligent
 {
 
 namespace Parsing
 {
 
+HLSLTokenNodePool::HLSLTokenNodePool() :
+    m_Allocator{DefaultRawMemoryAllocator::GetAllocator(), PageSize}
+{
+}
+
+void* HLSLTokenNodePool::Allocate(size_t Size, size_t Alignment)
+{
+    if (m_NodeSize == 0 && Size >= sizeof(FreeNode) && Size <= ChunkSize && Alignment <= alignof(std::max_align_t))
+        m_NodeSize = Size;
+
+    if (Size != m_NodeSize)
+    {
+        // Blocks of other sizes are never recycled
+        void* Ptr = m_Allocator.Allocate(Size, Alignment);
+        if (Ptr == nullptr)
+            throw std::bad_alloc{};
+        return Ptr;
+    }
+
+    if (m_pFreeList != nullptr)
+    {
+        FreeNode* pNode = m_pFreeList;
+        m_pFreeList     = pNode->pNext;
+        return pNode;
+    }
+
+    if (m_pChunkPos + m_NodeSize > m_pChunkEnd)
+    {
+        // Chunk start is aligned to the max alignment and node size is a multiple
+        // of the node alignment, so all nodes in the chunk are properly aligned.
+        const size_t ChunkBytes = (ChunkSize / m_NodeSize) * m_NodeSize;
+
+        m_pChunkPos = static_cast<Uint8*>(m_Allocator.Allocate(ChunkBytes, alignof(std::max_align_t)));
+        if (m_pChunkPos == nullptr)
+            throw std::bad_alloc{};
+        m_pChunkEnd = m_pChunkPos + ChunkBytes;
+    }
+
+    void* Ptr = m_pChunkPos;
+    m_pChunkPos += m_NodeSize;
+    return Ptr;
+}
+
+void HLSLTokenNodePool::Free(void* Ptr, size_t Size)
+{
+    if (Ptr == nullptr || Size != m_NodeSize)
+        return;
+
+    FreeNode* pNode = static_cast<FreeNode*>(Ptr);
+    pNode->pNext    = m_pFreeList;
+    m_pFreeList     = pNode;
+}
+
 HLSLTokenizer::HLSLTokenizer()
 {
     // Populate HLSL keywords hash map
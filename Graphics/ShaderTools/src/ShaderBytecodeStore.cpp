@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderBytecodeStore.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+
+#include "ShaderToolsCommon.hpp"
+#include "FileWrapper.hpp"
+#include "MappedFileDataBlob.hpp"
+#include "FileSystem.hpp"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct BytecodeFileHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x43425344; // DSBC
+    static constexpr Uint32 ExpectedVersion = 2; // Version 2: keys use XXH64-based ComputeHashRaw
+
+    Uint32 Magic   = ExpectedMagic;
+    Uint32 Version = ExpectedVersion;
+    Uint64 Key     = 0;
+    Uint64 Size    = 0;
+};
+static_assert(sizeof(BytecodeFileHeader) == 24, "Unexpected header size. Did you add new members?");
+
+void HashString(size_t& Hash, const char* Str)
+{
+    // Use ComputeHashRaw rather than std::hash as the keys are stored on disk and
+    // must be the same across runs and standard library implementations.
+    const size_t Len = Str != nullptr ? strlen(Str) : 0;
+    HashCombine(Hash, Len, ComputeHashRaw(Str, Len));
+}
+
+} // namespace
+
+std::shared_ptr<ShaderBytecodeStore> ShaderBytecodeStore::Get(const char* CacheDir)
+{
+    static std::mutex                                                          StoresMtx;
+    static std::unordered_map<std::string, std::weak_ptr<ShaderBytecodeStore>> Stores;
+
+    const std::string Dir = CacheDir != nullptr ? CacheDir : "";
+
+    std::lock_guard<std::mutex> Lock{StoresMtx};
+
+    auto& wpStore = Stores[Dir];
+    if (auto pStore = wpStore.lock())
+        return pStore;
+
+    auto pStore = std::make_shared<ShaderBytecodeStore>(Dir.c_str());
+    wpStore     = pStore;
+    return pStore;
+}
+
+ShaderBytecodeStore::ShaderBytecodeStore(const char* CacheDir) :
+    m_CacheDir{CacheDir != nullptr ? CacheDir : ""}
+{
+    if (!m_CacheDir.empty() && !FileSystem::PathExists(m_CacheDir.c_str()))
+    {
+        if (!FileSystem::CreateDirectory(m_CacheDir.c_str()))
+            LOG_WARNING_MESSAGE("Failed to create shader bytecode cache directory '", m_CacheDir, "'. Compiled shaders will only be cached in memory.");
+    }
+}
+
+ShaderBytecodeStore::KeyType ShaderBytecodeStore::ComputeKey(const ShaderCreateInfo& ShaderCI, size_t TargetHash) noexcept(false)
+{
+    VERIFY(ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr, "Shader must be created from source code or a file");
+
+    size_t Hash = TargetHash;
+
+    const std::string Source = UnrollShaderIncludes(ShaderCI);
+    HashCombine(Hash, Source.length(), ComputeHashRaw(Source.data(), Source.length()));
+
+    HashCombine(Hash, ShaderCI.Macros.Count);
+    for (Uint32 i = 0; i < ShaderCI.Macros.Count; ++i)
+    {
+        HashString(Hash, ShaderCI.Macros[i].Name);
+        HashString(Hash, ShaderCI.Macros[i].Definition);
+    }
+
+    HashString(Hash, ShaderCI.EntryPoint);
+    HashString(Hash, ShaderCI.Desc.CombinedSamplerSuffix);
+    HashString(Hash, ShaderCI.GLSLExtensions);
+    HashString(Hash, ShaderCI.WebGPUEmulatedArrayIndexSuffix);
+    HashCombine(Hash,
+                ShaderCI.Desc.ShaderType,
+                ShaderCI.Desc.UseCombinedTextureSamplers,
+                ShaderCI.SourceLanguage,
+                ShaderCI.ShaderCompiler,
+                ShaderCI.HLSLVersion.Major,
+                ShaderCI.HLSLVersion.Minor,
+                ShaderCI.GLSLVersion.Major,
+                ShaderCI.GLSLVersion.Minor,
+                ShaderCI.GLESSLVersion.Major,
+                ShaderCI.GLESSLVersion.Minor,
+                ShaderCI.MSLVersion.Major,
+                ShaderCI.MSLVersion.Minor,
+                ShaderCI.CompileFlags);
+
+    return Hash;
+}
+
+std::string ShaderBytecodeStore::GetFilePath(KeyType Key) const
+{
+    std::stringstream ss;
+    ss << m_CacheDir;
+    if (!FileSystem::IsSlash(m_CacheDir.back()))
+        ss << FileSystem::SlashSymbol;
+    ss << std::hex << std::setw(sizeof(KeyType) * 2) << std::setfill('0') << Key << ".bin";
+    return ss.str();
+}
+
+bool ShaderBytecodeStore::Find(KeyType Key, std::vector<Uint8>& Bytecode)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Bytecode.find(Key);
+        if (it != m_Bytecode.end())
+        {
+            Bytecode = it->second;
+            return true;
+        }
+    }
+
+    if (m_CacheDir.empty())
+        return false;
+
+    const std::string FilePath = GetFilePath(Key);
+    if (!FileSystem::FileExists(FilePath.c_str()))
+        return false;
+
+    // Map the file to copy the bytecode directly from the file pages
+    auto pFileData = MappedFileDataBlob::Create(FilePath.c_str(), MappedFileDataBlob::AccessHint::Sequential);
+    if (!pFileData)
+        return false;
+
+    const auto* pFileBytes = pFileData->GetConstDataPtr<Uint8>();
+    const auto  FileSize   = pFileData->GetSize();
+
+    BytecodeFileHeader Header;
+    if (FileSize < sizeof(Header))
+        return false;
+    memcpy(&Header, pFileBytes, sizeof(Header));
+    if (Header.Magic != BytecodeFileHeader::ExpectedMagic ||
+        Header.Version != BytecodeFileHeader::ExpectedVersion ||
+        Header.Key != Uint64{Key} ||
+        Header.Size != FileSize - sizeof(Header))
+    {
+        // The file may have been written by an incompatible version or is truncated.
+        return false;
+    }
+
+    Bytecode.assign(pFileBytes + sizeof(Header), pFileBytes + FileSize);
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_Bytecode.emplace(Key, Bytecode);
+    return true;
+}
+
+void ShaderBytecodeStore::Add(KeyType Key, const void* pBytecode, size_t Size)
+{
+    VERIFY_EXPR(pBytecode != nullptr && Size != 0);
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        const auto* pBytes = static_cast<const Uint8*>(pBytecode);
+        if (!m_Bytecode.emplace(Key, std::vector<Uint8>{pBytes, pBytes + Size}).second)
+            return; // Already added by another thread
+    }
+
+    if (m_CacheDir.empty())
+        return;
+
+    BytecodeFileHeader Header;
+    Header.Key  = Key;
+    Header.Size = Size;
+
+    std::vector<Uint8> FileData(sizeof(Header) + Size);
+    memcpy(FileData.data(), &Header, sizeof(Header));
+    memcpy(FileData.data() + sizeof(Header), pBytecode, Size);
+
+    const std::string FilePath = GetFilePath(Key);
+    if (!FileWrapper::WriteFile(FilePath.c_str(), FileData.data(), FileData.size(), /*Silent = */ true))
+        LOG_WARNING_MESSAGE("Failed to write shader bytecode to '", FilePath, "'.");
+}
+
+} // namespace Diligent
@@ -0,0 +1,152 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderIncludeCache.hpp"
+
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderIncludeCache::FileKey::Hasher::operator()(const FileKey& Key) const
+{
+    return ComputeHash(Key.pFactory, ComputeHashRaw(Key.Path.data(), Key.Path.length()));
+}
+
+ShaderIncludeCache& ShaderIncludeCache::GetInstance()
+{
+    static ShaderIncludeCache Cache;
+    return Cache;
+}
+
+void ShaderIncludeCache::SetEnabled(bool Enabled)
+{
+    m_Enabled.store(Enabled);
+    if (!Enabled)
+        Invalidate();
+}
+
+std::shared_ptr<const ShaderIncludeCache::FileData> ShaderIncludeCache::Find(IShaderSourceInputStreamFactory* pFactory, const char* FilePath)
+{
+    if (pFactory == nullptr || FilePath == nullptr)
+        return {};
+
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_Files.find(FileKey{pFactory, FilePath});
+        if (it != m_Files.end())
+        {
+            if (it->second.wpFactory.IsValid())
+            {
+                m_NumHits.fetch_add(1);
+                return it->second.pData;
+            }
+
+            // The factory has been destroyed, and the new one was created at the same address
+            m_TotalSourceSize -= it->second.pData->Source.length();
+            m_Files.erase(it);
+        }
+    }
+
+    m_NumMisses.fetch_add(1);
+    return {};
+}
+
+std::shared_ptr<const ShaderIncludeCache::FileData> ShaderIncludeCache::Add(IShaderSourceInputStreamFactory* pFactory, const char* FilePath, FileData&& Data)
+{
+    auto pData = std::make_shared<const FileData>(std::move(Data));
+    // Factories without reference counters can't be tracked, so their files are never cached.
+    if (pFactory == nullptr || FilePath == nullptr || pFactory->GetReferenceCounters() == nullptr || !IsEnabled())
+        return pData;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    auto it_inserted = m_Files.emplace(FileKey{pFactory, FilePath}, CachedFile{});
+    auto& File       = it_inserted.first->second;
+    if (!it_inserted.second)
+    {
+        if (File.wpFactory.IsValid())
+            return File.pData;
+
+        m_TotalSourceSize -= File.pData->Source.length();
+    }
+
+    File.wpFactory = RefCntWeakPtr<IShaderSourceInputStreamFactory>{pFactory};
+    File.pData     = pData;
+    m_TotalSourceSize += pData->Source.length();
+
+    return pData;
+}
+
+void ShaderIncludeCache::Invalidate()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_Files.clear();
+    m_TotalSourceSize = 0;
+}
+
+void ShaderIncludeCache::Invalidate(const char* FilePath)
+{
+    if (FilePath == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    for (auto it = m_Files.begin(); it != m_Files.end();)
+    {
+        if (it->first.Path == FilePath)
+        {
+            m_TotalSourceSize -= it->second.pData->Source.length();
+            it = m_Files.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+ShaderIncludeCache::Statistics ShaderIncludeCache::GetStatistics() const
+{
+    Statistics Stats;
+    Stats.NumHits   = m_NumHits.load();
+    Stats.NumMisses = m_NumMisses.load();
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        Stats.NumFiles        = static_cast<Uint32>(m_Files.size());
+        Stats.TotalSourceSize = m_TotalSourceSize;
+    }
+    return Stats;
+}
+
+void ShaderIncludeCache::ResetStatistics()
+{
+    m_NumHits.store(0);
+    m_NumMisses.store(0);
+}
+
+} // namespace Diligent
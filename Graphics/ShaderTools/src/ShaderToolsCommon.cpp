@@ -35,6 +35,8 @@
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
+#include "ShaderIncludeCache.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
@@ -422,31 +424,63 @@ static void ProcessIncludeErrorHandler(const ShaderCreateInfo& ShaderCI, const s
     throw std::pair<std::string, std::string>{std::move(FileInfo), Error};
 }
 
-template <typename IncludeHandlerType>
-void ProcessShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& Includes, IncludeHandlerType&& IncludeHandler) noexcept(false)
+// Loads the shader source and finds all #include directives in it.
+// Files loaded through the input stream factory are served from the include cache when it is enabled.
+static std::shared_ptr<const ShaderIncludeCache::FileData> LoadShaderSource(const ShaderCreateInfo& ShaderCI) noexcept(false)
 {
+    auto& Cache = ShaderIncludeCache::GetInstance();
+
+    const bool UseCache = (Cache.IsEnabled() &&
+                           ShaderCI.Source == nullptr &&
+                           ShaderCI.FilePath != nullptr &&
+                           ShaderCI.pShaderSourceStreamFactory != nullptr);
+    if (UseCache)
+    {
+        if (auto pCachedData = Cache.Find(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath))
+            return pCachedData;
+    }
+
     const auto SourceData = ReadShaderSourceFile(ShaderCI);
 
-    ShaderIncludePreprocessInfo FileInfo;
-    FileInfo.Source       = SourceData.Source;
-    FileInfo.SourceLength = SourceData.SourceLength;
-    FileInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+    ShaderIncludeCache::FileData Data;
+    Data.Source.assign(SourceData.Source, SourceData.SourceLength);
+    Data.Hash = ComputeHashRaw(Data.Source.data(), Data.Source.length());
 
     FindIncludes(
-        FileInfo.Source, FileInfo.SourceLength,
-        [&](const std::string& FilePath, size_t Start, size_t End) //
+        Data.Source.data(), Data.Source.length(),
+        [&Data](const std::string& Path, size_t Start, size_t End) //
         {
-            if (!Includes.insert(FilePath).second)
-                return;
-
-            auto IncludeCI{ShaderCI};
-            IncludeCI.FilePath     = FilePath.c_str();
-            IncludeCI.Source       = nullptr;
-            IncludeCI.SourceLength = 0;
-            ProcessShaderIncludesImpl(IncludeCI, Includes, IncludeHandler);
+            Data.Includes.push_back({Path, Start, End});
         },
         std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
 
+    return UseCache ?
+        Cache.Add(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, std::move(Data)) :
+        std::make_shared<const ShaderIncludeCache::FileData>(std::move(Data));
+}
+
+template <typename IncludeHandlerType>
+void ProcessShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& Includes, IncludeHandlerType&& IncludeHandler) noexcept(false)
+{
+    const auto pSourceData = LoadShaderSource(ShaderCI);
+
+    ShaderIncludePreprocessInfo FileInfo;
+    FileInfo.Source       = pSourceData->Source.c_str();
+    FileInfo.SourceLength = pSourceData->Source.length();
+    FileInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+
+    for (const auto& Include : pSourceData->Includes)
+    {
+        if (!Includes.insert(Include.Path).second)
+            continue;
+
+        auto IncludeCI{ShaderCI};
+        IncludeCI.FilePath     = Include.Path.c_str();
+        IncludeCI.Source       = nullptr;
+        IncludeCI.SourceLength = 0;
+        ProcessShaderIncludesImpl(IncludeCI, Includes, IncludeHandler);
+    }
+
     if (IncludeHandler)
         IncludeHandler(FileInfo);
 }
@@ -471,39 +505,35 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
-static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
+static std::string UnrollShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
 {
-    const auto SourceData = ReadShaderSourceFile(ShaderCI);
-
-    ShaderCI.Source       = SourceData.Source;
-    ShaderCI.SourceLength = SourceData.SourceLength;
-    ShaderCI.FilePath     = nullptr;
+    const auto  pSourceData = LoadShaderSource(ShaderCI);
+    const auto& Source      = pSourceData->Source;
 
     std::stringstream Stream;
     size_t            PrevIncludeEnd = 0;
 
-    FindIncludes(
-        ShaderCI.Source, ShaderCI.SourceLength, [&](const std::string& Path, size_t IncludeStart, size_t IncludeEnd) {
-            // Insert text before the include start
-            Stream.write(ShaderCI.Source + PrevIncludeEnd, IncludeStart - PrevIncludeEnd);
+    for (const auto& Include : pSourceData->Includes)
+    {
+        // Insert text before the include start
+        Stream.write(Source.data() + PrevIncludeEnd, Include.Start - PrevIncludeEnd);
 
-            if (AllIncludes.insert(Path).second)
-            {
-                // Process the #include directive
-                ShaderCreateInfo IncludeCI{ShaderCI};
-                IncludeCI.Source       = nullptr;
-                IncludeCI.SourceLength = 0;
-                IncludeCI.FilePath     = Path.c_str();
-                auto UnrolledInclude   = UnrollShaderIncludesImpl(IncludeCI, AllIncludes);
-                Stream << UnrolledInclude;
-            }
+        if (AllIncludes.insert(Include.Path).second)
+        {
+            // Process the #include directive
+            ShaderCreateInfo IncludeCI{ShaderCI};
+            IncludeCI.Source       = nullptr;
+            IncludeCI.SourceLength = 0;
+            IncludeCI.FilePath     = Include.Path.c_str();
+            auto UnrolledInclude   = UnrollShaderIncludesImpl(IncludeCI, AllIncludes);
+            Stream << UnrolledInclude;
+        }
 
-            PrevIncludeEnd = IncludeEnd;
-        },
-        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+        PrevIncludeEnd = Include.End;
+    }
 
     // Insert text after the last include
-    Stream.write(ShaderCI.Source + PrevIncludeEnd, ShaderCI.SourceLength - PrevIncludeEnd);
+    Stream.write(Source.data() + PrevIncludeEnd, Source.length() - PrevIncludeEnd);
 
     return Stream.str();
 }
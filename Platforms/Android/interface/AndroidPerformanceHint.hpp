@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of AndroidPerformanceHintSession class
+
+#include <chrono>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Reports frame work durations to the Android Dynamic Performance Framework (ADPF).
+
+/// The performance hint manager uses the target and actual work durations of the threads
+/// in the session to adjust CPU clocks: it boosts them when a frame is about to miss the target,
+/// and lowers them when there is headroom, which reduces power consumption and thermal throttling.
+///
+/// A typical frame looks as follows:
+///
+///     Session.BeginFrame();
+///     // Update and render the frame
+///     pContext->Flush();
+///     pContext->FinishFrame();
+///     Session.EndFrame();
+///     pSwapChain->Present();
+///
+/// EndFrame() should be called before ISwapChain::Present() so that the time spent waiting
+/// for the presentation engine is not reported as work.
+///
+/// \remarks    The performance hint API is available starting with Android 13 (API level 33) and is
+///             loaded at run time, so the class can be used with any minimum SDK version. If the API
+///             is not available, all methods do nothing, see IsSupported().
+///             The object is not thread-safe.
+class AndroidPerformanceHintSession
+{
+public:
+    /// \param [in] TargetWorkDurationNs - Target work duration of a frame, in nanoseconds, e.g. 16'666'666 for 60 FPS.
+    /// \param [in] pThreadIds           - IDs of the threads that do the frame work (see gettid()).
+    ///                                    If null, the calling thread is used.
+    /// \param [in] NumThreads           - The number of elements in pThreadIds.
+    AndroidPerformanceHintSession(Int64 TargetWorkDurationNs, const Int32* pThreadIds = nullptr, Uint32 NumThreads = 0);
+    ~AndroidPerformanceHintSession();
+
+    // clang-format off
+    AndroidPerformanceHintSession           (const AndroidPerformanceHintSession&)  = delete;
+    AndroidPerformanceHintSession           (      AndroidPerformanceHintSession&&) = delete;
+    AndroidPerformanceHintSession& operator=(const AndroidPerformanceHintSession&)  = delete;
+    AndroidPerformanceHintSession& operator=(      AndroidPerformanceHintSession&&) = delete;
+    // clang-format on
+
+    /// Returns true if the performance hint session has been created.
+    bool IsSupported() const { return m_pSession != nullptr; }
+
+    /// Updates the target work duration, e.g. when the display refresh rate changes.
+    void SetTargetWorkDuration(Int64 TargetWorkDurationNs);
+
+    /// Returns the target work duration, in nanoseconds.
+    Int64 GetTargetWorkDuration() const { return m_TargetWorkDurationNs; }
+
+    /// Reports the actual work duration of a frame, in nanoseconds.
+    void ReportActualWorkDuration(Int64 ActualWorkDurationNs);
+
+    /// Marks the beginning of the frame work.
+    void BeginFrame();
+
+    /// Marks the end of the frame work and reports its duration.
+    void EndFrame();
+
+private:
+    struct APIFunctions;
+
+    void*         m_pLibrary = nullptr;
+    APIFunctions* m_pAPI     = nullptr;
+    void*         m_pSession = nullptr;
+
+    Int64 m_TargetWorkDurationNs = 0;
+
+    std::chrono::steady_clock::time_point m_FrameStart;
+    bool                                  m_FrameStarted = false;
+};
+
+} // namespace Diligent
@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AndroidPerformanceHint.hpp"
+
+#include <vector>
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+// Functions of the performance hint API (android/performance_hint.h), available in libandroid.so starting with API level 33
+struct AndroidPerformanceHintSession::APIFunctions
+{
+    using GetManagerProc               = void* (*)();
+    using CreateSessionProc            = void* (*)(void* pManager, const int32_t* pThreadIds, size_t Size, int64_t InitialTargetWorkDurationNanos);
+    using UpdateTargetWorkDurationProc = int (*)(void* pSession, int64_t TargetDurationNanos);
+    using ReportActualWorkDurationProc = int (*)(void* pSession, int64_t ActualDurationNanos);
+    using CloseSessionProc             = void (*)(void* pSession);
+
+    GetManagerProc               GetManager               = nullptr;
+    CreateSessionProc            CreateSession            = nullptr;
+    UpdateTargetWorkDurationProc UpdateTargetWorkDuration = nullptr;
+    ReportActualWorkDurationProc ReportActualWorkDuration = nullptr;
+    CloseSessionProc             CloseSession             = nullptr;
+
+    bool Load(void* pLibrary)
+    {
+        GetManager               = reinterpret_cast<GetManagerProc>(dlsym(pLibrary, "APerformanceHint_getManager"));
+        CreateSession            = reinterpret_cast<CreateSessionProc>(dlsym(pLibrary, "APerformanceHint_createSession"));
+        UpdateTargetWorkDuration = reinterpret_cast<UpdateTargetWorkDurationProc>(dlsym(pLibrary, "APerformanceHint_updateTargetWorkDuration"));
+        ReportActualWorkDuration = reinterpret_cast<ReportActualWorkDurationProc>(dlsym(pLibrary, "APerformanceHint_reportActualWorkDuration"));
+        CloseSession             = reinterpret_cast<CloseSessionProc>(dlsym(pLibrary, "APerformanceHint_closeSession"));
+        return GetManager != nullptr && CreateSession != nullptr && UpdateTargetWorkDuration != nullptr &&
+            ReportActualWorkDuration != nullptr && CloseSession != nullptr;
+    }
+};
+
+AndroidPerformanceHintSession::AndroidPerformanceHintSession(Int64 TargetWorkDurationNs, const Int32* pThreadIds, Uint32 NumThreads) :
+    m_TargetWorkDurationNs{TargetWorkDurationNs}
+{
+    DEV_CHECK_ERR(TargetWorkDurationNs > 0, "Target work duration must be positive");
+
+    m_pLibrary = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+    if (m_pLibrary == nullptr)
+    {
+        LOG_WARNING_MESSAGE("Failed to load libandroid.so. Performance hints are disabled.");
+        return;
+    }
+
+    m_pAPI = new APIFunctions{};
+    if (!m_pAPI->Load(m_pLibrary))
+    {
+        LOG_INFO_MESSAGE("Performance hint API is not available (requires Android 13 or later). Performance hints are disabled.");
+        return;
+    }
+
+    void* pManager = m_pAPI->GetManager();
+    if (pManager == nullptr)
+    {
+        LOG_INFO_MESSAGE("Performance hint manager is not available. Performance hints are disabled.");
+        return;
+    }
+
+    std::vector<int32_t> ThreadIds;
+    if (pThreadIds != nullptr && NumThreads > 0)
+        ThreadIds.assign(pThreadIds, pThreadIds + NumThreads);
+    else
+        ThreadIds.push_back(static_cast<int32_t>(gettid()));
+
+    m_pSession = m_pAPI->CreateSession(pManager, ThreadIds.data(), ThreadIds.size(), m_TargetWorkDurationNs);
+    if (m_pSession == nullptr)
+        LOG_WARNING_MESSAGE("Failed to create performance hint session. Performance hints are disabled.");
+}
+
+AndroidPerformanceHintSession::~AndroidPerformanceHintSession()
+{
+    if (m_pSession != nullptr)
+        m_pAPI->CloseSession(m_pSession);
+
+    delete m_pAPI;
+
+    if (m_pLibrary != nullptr)
+        dlclose(m_pLibrary);
+}
+
+void AndroidPerformanceHintSession::SetTargetWorkDuration(Int64 TargetWorkDurationNs)
+{
+    DEV_CHECK_ERR(TargetWorkDurationNs > 0, "Target work duration must be positive");
+    if (m_TargetWorkDurationNs == TargetWorkDurationNs)
+        return;
+
+    m_TargetWorkDurationNs = TargetWorkDurationNs;
+    if (m_pSession != nullptr)
+        m_pAPI->UpdateTargetWorkDuration(m_pSession, TargetWorkDurationNs);
+}
+
+void AndroidPerformanceHintSession::ReportActualWorkDuration(Int64 ActualWorkDurationNs)
+{
+    // The API rejects non-positive durations
+    if (m_pSession != nullptr && ActualWorkDurationNs > 0)
+        m_pAPI->ReportActualWorkDuration(m_pSession, ActualWorkDurationNs);
+}
+
+void AndroidPerformanceHintSession::BeginFrame()
+{
+    m_FrameStart   = std::chrono::steady_clock::now();
+    m_FrameStarted = true;
+}
+
+void AndroidPerformanceHintSession::EndFrame()
+{
+    if (!m_FrameStarted)
+    {
+        UNEXPECTED("EndFrame() must be preceded by BeginFrame()");
+        return;
+    }
+    m_FrameStarted = false;
+
+    const auto Duration = std::chrono::steady_clock::now() - m_FrameStart;
+    ReportActualWorkDuration(std::chrono::duration_cast<std::chrono::nanoseconds>(Duration).count());
+}
+
+} // namespace Diligent
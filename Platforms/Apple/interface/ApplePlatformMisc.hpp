@@ -37,6 +37,14 @@ namespace Diligent
 struct AppleMisc : public LinuxMisc
 {
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Returns the CPU topology.
+
+    /// \remarks   macOS and iOS report the number of cores in each performance level,
+    ///             but do not expose which logical cores belong to which level, and
+    ///             do not support affinity masks. As a result, core counts are
+    ///             filled in, while core types are Unknown and all affinity masks are zero.
+    static CPUTopology GetCPUTopology();
 };
 
 } // namespace Diligent
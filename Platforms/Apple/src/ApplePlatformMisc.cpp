@@ -26,6 +26,10 @@
 
 #include "ApplePlatformMisc.hpp"
 
+#include <sys/types.h>
+#include <sys/sysctl.h>
+#include <algorithm>
+
 namespace Diligent
 {
 
@@ -35,4 +39,44 @@ Uint64 AppleMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+static Uint32 GetSysCtlUint32(const char* Name)
+{
+    int    Value = 0;
+    size_t Size  = sizeof(Value);
+    if (sysctlbyname(Name, &Value, &Size, nullptr, 0) != 0)
+        return 0;
+    return static_cast<Uint32>(Value);
+}
+
+CPUTopology AppleMisc::GetCPUTopology()
+{
+    const Uint32 NumLogicalCores  = GetSysCtlUint32("hw.logicalcpu");
+    const Uint32 NumPhysicalCores = GetSysCtlUint32("hw.physicalcpu");
+    if (NumLogicalCores == 0)
+        return BasicPlatformMisc::GetCPUTopology();
+
+    CPUTopology Topology;
+    Topology.LogicalCores.resize(NumLogicalCores);
+    for (Uint32 i = 0; i < NumLogicalCores; ++i)
+    {
+        Topology.LogicalCores[i].PhysicalCoreId = i;
+        Topology.LogicalCores[i].CacheClusterId = i;
+    }
+    Topology.NumPhysicalCores = NumPhysicalCores != 0 ? NumPhysicalCores : NumLogicalCores;
+
+    // Performance level 0 is the highest-performance level
+    const Uint32 NumPerfLevels = GetSysCtlUint32("hw.nperflevels");
+    if (NumPerfLevels > 1)
+    {
+        Topology.NumPerformanceCores = GetSysCtlUint32("hw.perflevel0.logicalcpu");
+        Topology.NumEfficiencyCores  = NumLogicalCores - std::min(Topology.NumPerformanceCores, NumLogicalCores);
+    }
+    else
+    {
+        Topology.NumPerformanceCores = NumLogicalCores;
+    }
+
+    return Topology;
+}
+
 } // namespace Diligent
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../../../Primitives/interface/BasicTypes.h"
 
 namespace Diligent
@@ -42,6 +44,70 @@ enum class ThreadPriority
     Highest
 };
 
+/// CPU core type
+enum class CPUCoreType : Uint8
+{
+    /// The core type could not be determined.
+    Unknown,
+
+    /// Performance (big) core.
+    Performance,
+
+    /// Efficiency (little) core.
+    Efficiency
+};
+
+/// CPU topology description returned by PlatformMisc::GetCPUTopology().
+struct CPUTopology
+{
+    struct LogicalCore
+    {
+        /// Core type.
+
+        /// \remarks   On CPUs where all cores have the same performance class,
+        ///             all cores are reported as performance cores.
+        CPUCoreType Type = CPUCoreType::Unknown;
+
+        /// Relative performance class of the core. Higher values indicate
+        /// faster and less power-efficient cores.
+        Uint8 PerformanceClass = 0;
+
+        /// Index of the first logical core that belongs to the same physical core.
+        /// SMT siblings share the same physical core id.
+        Uint32 PhysicalCoreId = 0;
+
+        /// Index of the first logical core that shares the same L2 cache.
+        Uint32 CacheClusterId = 0;
+    };
+
+    /// Logical cores, indexed by the logical processor number.
+    std::vector<LogicalCore> LogicalCores;
+
+    /// The number of physical cores.
+    Uint32 NumPhysicalCores = 0;
+
+    /// The number of logical performance cores.
+    Uint32 NumPerformanceCores = 0;
+
+    /// The number of logical efficiency cores.
+    Uint32 NumEfficiencyCores = 0;
+
+    /// Affinity mask of all performance cores.
+    Uint64 PerformanceCoresMask = 0;
+
+    /// Affinity mask of all efficiency cores.
+    Uint64 EfficiencyCoresMask = 0;
+
+    /// Affinity mask that contains the first logical core of every physical core.
+    Uint64 PhysicalCoresMask = 0;
+
+    /// Returns true if the CPU has both performance and efficiency cores.
+    bool IsHybrid() const
+    {
+        return NumPerformanceCores > 0 && NumEfficiencyCores > 0;
+    }
+};
+
 struct BasicPlatformMisc
 {
     template <typename Type>
@@ -110,6 +176,23 @@ struct BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
 
+    /// Returns the CPU topology.
+
+    /// \remarks   The base implementation reports std::thread::hardware_concurrency()
+    ///             performance cores without SMT siblings.
+    ///
+    ///             Affinity masks only cover the first 64 logical cores
+    ///             (on Windows, the first processor group).
+    ///
+    ///             The function queries the operating system every time it is called,
+    ///             so the application should cache the result.
+    static CPUTopology GetCPUTopology();
+
+protected:
+    /// Derives core types, core counts and affinity masks from
+    /// the performance class and physical core id of every logical core.
+    static void InitCPUTopology(CPUTopology& Topology);
+
 private:
     static void SwapBytes16(Uint16& Val)
     {
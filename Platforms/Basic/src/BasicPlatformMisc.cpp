@@ -25,6 +25,10 @@
  */
 
 #include "BasicPlatformMisc.hpp"
+
+#include <thread>
+#include <algorithm>
+
 #include "DebugUtilities.hpp"
 
 namespace Diligent
@@ -48,4 +52,62 @@ Uint64 BasicPlatformMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+CPUTopology BasicPlatformMisc::GetCPUTopology()
+{
+    CPUTopology Topology;
+    Topology.LogicalCores.resize(std::max(std::thread::hardware_concurrency(), 1u));
+    for (Uint32 i = 0; i < Topology.LogicalCores.size(); ++i)
+    {
+        Topology.LogicalCores[i].PhysicalCoreId = i;
+        Topology.LogicalCores[i].CacheClusterId = i;
+    }
+    InitCPUTopology(Topology);
+    return Topology;
+}
+
+void BasicPlatformMisc::InitCPUTopology(CPUTopology& Topology)
+{
+    Uint8 MinClass = 255;
+    Uint8 MaxClass = 0;
+    for (const auto& Core : Topology.LogicalCores)
+    {
+        MinClass = std::min(MinClass, Core.PerformanceClass);
+        MaxClass = std::max(MaxClass, Core.PerformanceClass);
+    }
+
+    Topology.NumPhysicalCores     = 0;
+    Topology.NumPerformanceCores  = 0;
+    Topology.NumEfficiencyCores   = 0;
+    Topology.PerformanceCoresMask = 0;
+    Topology.EfficiencyCoresMask  = 0;
+    Topology.PhysicalCoresMask    = 0;
+    for (Uint32 i = 0; i < Topology.LogicalCores.size(); ++i)
+    {
+        auto& Core = Topology.LogicalCores[i];
+        // Only the lowest performance class is considered efficient, so that
+        // mid cores of three-tier designs are treated as performance cores.
+        Core.Type = (MinClass != MaxClass && Core.PerformanceClass == MinClass) ?
+            CPUCoreType::Efficiency :
+            CPUCoreType::Performance;
+
+        const Uint64 CoreBit = i < 64 ? Uint64{1} << i : 0;
+        if (Core.Type == CPUCoreType::Efficiency)
+        {
+            ++Topology.NumEfficiencyCores;
+            Topology.EfficiencyCoresMask |= CoreBit;
+        }
+        else
+        {
+            ++Topology.NumPerformanceCores;
+            Topology.PerformanceCoresMask |= CoreBit;
+        }
+
+        if (Core.PhysicalCoreId == i)
+        {
+            ++Topology.NumPhysicalCores;
+            Topology.PhysicalCoresMask |= CoreBit;
+        }
+    }
+}
+
 } // namespace Diligent
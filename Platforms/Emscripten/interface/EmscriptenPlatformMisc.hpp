@@ -33,6 +33,13 @@ namespace Diligent
 {
 
 struct EmscriptenMisc : public LinuxMisc
-{};
+{
+    /// The browser only reports the number of logical cores (navigator.hardwareConcurrency),
+    /// so the base implementation is used.
+    static CPUTopology GetCPUTopology()
+    {
+        return BasicPlatformMisc::GetCPUTopology();
+    }
+};
 
 } // namespace Diligent
@@ -111,6 +111,13 @@ struct LinuxMisc : public BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Returns the CPU topology read from sysfs.
+
+    /// \remarks   On ARM, core classes are derived from the core capacity or maximum frequency.
+    ///             On x86, efficiency cores are only detected on hybrid Intel CPUs
+    ///             that expose the cpu_atom PMU.
+    static CPUTopology GetCPUTopology();
 };
 
 } // namespace Diligent
@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "LinuxPlatformMisc.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <cstdlib>
+
+namespace Diligent
+{
+
+namespace
+{
+
+const char* const SysCPUPath = "/sys/devices/system/cpu/";
+
+bool ReadSysFile(const std::string& Path, std::string& Line)
+{
+    std::ifstream File{Path};
+    if (!File.is_open())
+        return false;
+
+    std::getline(File, Line);
+    return !File.fail();
+}
+
+Uint64 ReadSysUint(const std::string& Path)
+{
+    std::string Line;
+    if (!ReadSysFile(Path, Line))
+        return 0;
+
+    char* pEnd = nullptr;
+    return strtoull(Line.c_str(), &pEnd, 10);
+}
+
+// Parses a CPU list such as "0-3,8,10-11"
+std::vector<Uint32> ParseCPUList(const std::string& List)
+{
+    std::vector<Uint32> CPUs;
+
+    const char* pCurr = List.c_str();
+    while (*pCurr != '\0')
+    {
+        char*        pEnd  = nullptr;
+        const Uint32 First = static_cast<Uint32>(strtoul(pCurr, &pEnd, 10));
+        if (pEnd == pCurr)
+            break;
+
+        Uint32 Last = First;
+        pCurr       = pEnd;
+        if (*pCurr == '-')
+        {
+            ++pCurr;
+            Last  = static_cast<Uint32>(strtoul(pCurr, &pEnd, 10));
+            pCurr = pEnd;
+        }
+
+        for (Uint32 cpu = First; cpu <= Last; ++cpu)
+            CPUs.push_back(cpu);
+
+        if (*pCurr != ',')
+            break;
+        ++pCurr;
+    }
+
+    return CPUs;
+}
+
+std::vector<Uint32> ReadSysCPUList(const std::string& Path)
+{
+    std::string Line;
+    return ReadSysFile(Path, Line) ? ParseCPUList(Line) : std::vector<Uint32>{};
+}
+
+} // namespace
+
+CPUTopology LinuxMisc::GetCPUTopology()
+{
+    // Use the possible CPUs rather than the online ones, so that
+    // the core indices match the affinity mask bits.
+    const auto PossibleCPUs = ReadSysCPUList(std::string{SysCPUPath} + "possible");
+
+    const Uint32 NumCores = !PossibleCPUs.empty() ?
+        PossibleCPUs.back() + 1 :
+        std::max(std::thread::hardware_concurrency(), 1u);
+
+    CPUTopology Topology;
+    Topology.LogicalCores.resize(NumCores);
+
+    std::vector<Uint64> Capacities(NumCores);
+    for (Uint32 i = 0; i < NumCores; ++i)
+    {
+        auto& Core = Topology.LogicalCores[i];
+
+        const std::string CPUPath = std::string{SysCPUPath} + "cpu" + std::to_string(i) + "/";
+
+        const auto Siblings = ReadSysCPUList(CPUPath + "topology/thread_siblings_list");
+        Core.PhysicalCoreId = !Siblings.empty() ? Siblings.front() : i;
+
+        Core.CacheClusterId = Core.PhysicalCoreId;
+        for (Uint32 idx = 0; idx < 8; ++idx)
+        {
+            const std::string CachePath = CPUPath + "cache/index" + std::to_string(idx) + "/";
+
+            const Uint64 Level = ReadSysUint(CachePath + "level");
+            if (Level == 0)
+                break;
+            if (Level != 2)
+                continue;
+
+            const auto SharedCPUs = ReadSysCPUList(CachePath + "shared_cpu_list");
+            if (!SharedCPUs.empty())
+                Core.CacheClusterId = SharedCPUs.front();
+            break;
+        }
+
+#if !defined(__x86_64__) && !defined(__i386__)
+        // Energy-aware scheduling exposes the normalized core capacity on ARM.
+        // Fall back to the maximum frequency if it is not available.
+        Capacities[i] = ReadSysUint(CPUPath + "cpu_capacity");
+        if (Capacities[i] == 0)
+            Capacities[i] = ReadSysUint(CPUPath + "cpufreq/cpuinfo_max_freq");
+#endif
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    // On x86, the maximum frequency is not a reliable indicator as favored cores (e.g. Turbo
+    // Boost Max 3.0) report higher frequencies. Hybrid Intel CPUs expose separate PMUs instead.
+    const auto AtomCPUs = ReadSysCPUList("/sys/devices/cpu_atom/cpus");
+    const auto BigCPUs  = ReadSysCPUList("/sys/devices/cpu_core/cpus");
+    if (!AtomCPUs.empty() && !BigCPUs.empty())
+    {
+        for (Uint32 cpu : BigCPUs)
+        {
+            if (cpu < NumCores)
+                Capacities[cpu] = 2;
+        }
+        for (Uint32 cpu : AtomCPUs)
+        {
+            if (cpu < NumCores)
+                Capacities[cpu] = 1;
+        }
+    }
+#endif
+
+    // Core classes are only assigned if the capacity of every core is known
+    if (std::find(Capacities.begin(), Capacities.end(), Uint64{0}) == Capacities.end())
+    {
+        std::vector<Uint64> UniqueCapacities = Capacities;
+        std::sort(UniqueCapacities.begin(), UniqueCapacities.end());
+        UniqueCapacities.erase(std::unique(UniqueCapacities.begin(), UniqueCapacities.end()), UniqueCapacities.end());
+
+        for (Uint32 i = 0; i < NumCores; ++i)
+        {
+            const auto Class = std::lower_bound(UniqueCapacities.begin(), UniqueCapacities.end(), Capacities[i]) - UniqueCapacities.begin();
+            Topology.LogicalCores[i].PerformanceClass = static_cast<Uint8>(std::min(Class, decltype(Class){255}));
+        }
+    }
+
+    InitCPUTopology(Topology);
+    return Topology;
+}
+
+} // namespace Diligent
@@ -173,6 +173,9 @@ struct WindowsMisc : public BasicPlatformMisc
     /// Sets the current thread priority and on success returns the previous priority.
     /// On failure, returns ThreadPriority::Unknown.
     static ThreadPriority SetCurrentThreadPriority(ThreadPriority Priority);
+
+    /// Returns the CPU topology reported by GetLogicalProcessorInformationEx().
+    static CPUTopology GetCPUTopology();
 #endif
 };
 
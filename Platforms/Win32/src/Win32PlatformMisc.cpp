@@ -30,6 +30,8 @@
 #include <Windows.h>
 #include "WinHPostface.h"
 
+#include <vector>
+
 namespace Diligent
 {
 
@@ -88,4 +90,66 @@ ThreadPriority WindowsMisc::SetCurrentThreadPriority(ThreadPriority Priority)
         return ThreadPriority::Unknown;
 }
 
+CPUTopology WindowsMisc::GetCPUTopology()
+{
+    DWORD BufferSize = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &BufferSize);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER || BufferSize == 0)
+        return BasicPlatformMisc::GetCPUTopology();
+
+    std::vector<Uint8> Buffer(BufferSize);
+    if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(Buffer.data()), &BufferSize))
+        return BasicPlatformMisc::GetCPUTopology();
+
+    // Only the first processor group is considered as affinity masks are 64-bit.
+    CPUTopology Topology;
+    Topology.LogicalCores.resize(GetActiveProcessorCount(0));
+
+    const auto ForEachCore = [&Topology](KAFFINITY Mask, auto&& Handler) {
+        for (Uint32 i = 0; i < Topology.LogicalCores.size() && i < 64; ++i)
+        {
+            if (Mask & (KAFFINITY{1} << i))
+                Handler(Topology.LogicalCores[i]);
+        }
+    };
+
+    // Caches are processed after all cores are known
+    std::vector<KAFFINITY> L2CacheMasks;
+    for (DWORD Offset = 0; Offset < BufferSize;)
+    {
+        const auto& Info = *reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(&Buffer[Offset]);
+        if (Info.Relationship == RelationProcessorCore && Info.Processor.GroupMask[0].Group == 0)
+        {
+            const KAFFINITY Mask = Info.Processor.GroupMask[0].Mask;
+            if (Mask != 0)
+            {
+                const Uint32 PhysicalCoreId = GetLSB(Uint64{Mask});
+                ForEachCore(Mask, [&](CPUTopology::LogicalCore& Core) {
+                    Core.PhysicalCoreId   = PhysicalCoreId;
+                    Core.CacheClusterId   = PhysicalCoreId;
+                    Core.PerformanceClass = Info.Processor.EfficiencyClass;
+                });
+            }
+        }
+        else if (Info.Relationship == RelationCache && Info.Cache.Level == 2 && Info.Cache.GroupMask.Group == 0)
+        {
+            L2CacheMasks.push_back(Info.Cache.GroupMask.Mask);
+        }
+        Offset += Info.Size;
+    }
+
+    for (KAFFINITY Mask : L2CacheMasks)
+    {
+        if (Mask == 0)
+            continue;
+        const Uint32 ClusterId = GetLSB(Uint64{Mask});
+        ForEachCore(Mask, [ClusterId](CPUTopology::LogicalCore& Core) {
+            Core.CacheClusterId = ClusterId;
+        });
+    }
+
+    InitCPUTopology(Topology);
+    return Topology;
+}
+
 } // namespace Diligent
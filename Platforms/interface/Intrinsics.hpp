@@ -34,3 +34,22 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+#if DILIGENT_AVX2_SUPPORTED && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__))
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#    define DILIGENT_FMA_ENABLED 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
+
+// WebAssembly SIMD128 is enabled by the -msimd128 compiler option
+#if defined(__wasm_simd128__)
+#    include <wasm_simd128.h>
+#    define DILIGENT_WASM_SIMD_ENABLED 1
+#endif
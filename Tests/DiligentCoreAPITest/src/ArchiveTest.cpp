@@ -1560,6 +1560,130 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+void TestUnpackPipelineStates(bool Asynchronous)
+{
+    auto* pEnv             = GPUTestingEnvironment::GetInstance();
+    auto* pDevice          = pEnv->GetDevice();
+    auto* pArchiverFactory = pEnv->GetArchiverFactory();
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    auto DeviceBits = GetDeviceBits();
+#if PLATFORM_MACOS
+    // Compute shaders are not supported in OpenGL on MacOS
+    DeviceBits &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSerializedPRS;
+    {
+        constexpr PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+        };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "ArchiveTest.UnpackPipelineStates - PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{GetDeviceBits()}, &pSerializedPRS);
+        ASSERT_NE(pSerializedPRS, nullptr);
+    }
+
+    constexpr Uint32         NumPSOs = 8;
+    std::vector<std::string> PSONames;
+    {
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        ASSERT_NE(pArchiver, nullptr);
+
+        ShaderCreateInfo       ShaderCI;
+        RefCntAutoPtr<IShader> pSerializedCS;
+        CreateComputeShader(nullptr, pSerializationDevice, ShaderCI, nullptr, &pSerializedCS);
+        ASSERT_NE(pSerializedCS, nullptr);
+
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            PSONames.emplace_back("ArchiveTest.UnpackPipelineStates - PSO " + std::to_string(i));
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSONames.back().c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pSerializedCS;
+
+            IPipelineResourceSignature* Signatures[] = {pSerializedPRS};
+            PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+            PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+            RefCntAutoPtr<IPipelineState> pSerializedPSO;
+            pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, PipelineStateArchiveInfo{PSO_ARCHIVE_FLAG_NONE, DeviceBits}, &pSerializedPSO);
+            ASSERT_NE(pSerializedPSO, nullptr);
+            ASSERT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+        }
+
+        RefCntAutoPtr<IDataBlob> pArchive;
+        pArchiver->SerializeToBlob(ContentVersion, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+        ASSERT_TRUE(pDearchiver->LoadArchive(pArchive, ContentVersion));
+    }
+
+    std::vector<PipelineStateUnpackInfo> UnpackInfos(NumPSOs + 1);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        UnpackInfos[i].Name         = PSONames[i].c_str();
+        UnpackInfos[i].pDevice      = pDevice;
+        UnpackInfos[i].PipelineType = PIPELINE_TYPE_COMPUTE;
+    }
+    UnpackInfos[NumPSOs].Name         = "Non-existing PSO name";
+    UnpackInfos[NumPSOs].pDevice      = pDevice;
+    UnpackInfos[NumPSOs].PipelineType = PIPELINE_TYPE_COMPUTE;
+
+    std::vector<IPipelineState*> pPSOs(UnpackInfos.size());
+    pDearchiver->UnpackPipelineStates(UnpackInfos.data(), static_cast<Uint32>(UnpackInfos.size()), pPSOs.data(), Asynchronous);
+
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(pPSOs.size());
+    for (size_t i = 0; i < pPSOs.size(); ++i)
+        PSOs[i].Attach(pPSOs[i]);
+
+    EXPECT_EQ(PSOs[NumPSOs], nullptr);
+    for (Uint32 i = 0; i < NumPSOs; ++i)
+    {
+        const auto& pPSO = PSOs[i];
+        ASSERT_NE(pPSO, nullptr);
+
+        // The signature must be shared by all pipelines
+        EXPECT_EQ(pPSO->GetResourceSignature(0), PSOs[0]->GetResourceSignature(0));
+        EXPECT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+
+        // Unpacked pipelines must be cached
+        RefCntAutoPtr<IPipelineState> pPSO2;
+        pDearchiver->UnpackPipelineState(UnpackInfos[i], &pPSO2);
+        EXPECT_EQ(pPSO, pPSO2);
+    }
+}
+
+TEST(ArchiveTest, UnpackPipelineStates)
+{
+    TestUnpackPipelineStates(/*Asynchronous = */ false);
+}
+
+TEST(ArchiveTest, UnpackPipelineStates_Async)
+{
+    TestUnpackPipelineStates(/*Asynchronous = */ true);
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     auto* pEnv             = GPUTestingEnvironment::GetInstance();
@@ -126,6 +126,19 @@ TEST(Shader, AsyncCompilation)
     LOG_INFO_MESSAGE(Shaders.size(), " shaders were compiled after ", Iter, " iterations (", (T.GetElapsedTime() - StartTime) * 1000, " ms)");
 }
 
+TEST(Shader, CompileTime)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pShader = CreateShader("AsyncShaderCompilationTest.psh", "Compile time test", SHADER_TYPE_PIXEL, SHADER_COMPILE_FLAG_NONE, /*SimplifiedShader = */ true);
+    ASSERT_NE(pShader, nullptr);
+    ASSERT_EQ(pShader->GetStatus(/*WaitForCompletion = */ true), SHADER_STATUS_READY);
+
+    const Float64 CompileTime = pShader->GetCompileTime();
+    EXPECT_GT(CompileTime, 0.0);
+    LOG_INFO_MESSAGE("Shader was compiled in ", CompileTime * 1000, " ms");
+}
+
 TEST(Shader, ReleaseWhileCompiling)
 {
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
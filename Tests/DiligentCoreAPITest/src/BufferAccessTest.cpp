@@ -126,6 +126,34 @@ TEST(BufferAccessTest, UpdateBufferData)
     VerifyBufferData(pBuffer);
 }
 
+TEST(BufferAccessTest, UpdateBufferDataDirect)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Test default buffer with direct updates";
+    BuffDesc.Usage     = USAGE_DEFAULT;
+    BuffDesc.Size      = sizeof(TestBufferData);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BuffDesc.MiscFlags = MISC_BUFFER_FLAG_DIRECT_UPDATES;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr) << "Buffer desc:\n"
+                                << BuffDesc;
+
+    // Update the buffer in two parts to test updates with non-zero offset
+    constexpr Uint64 HalfSize = sizeof(TestBufferData) / 2;
+    pContext->UpdateBuffer(pBuffer, 0, HalfSize, TestBufferData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->UpdateBuffer(pBuffer, HalfSize, HalfSize, reinterpret_cast<const Uint8*>(TestBufferData) + HalfSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    VerifyBufferData(pBuffer);
+}
+
 TEST(BufferAccessTest, MapWriteDiscard)
 {
     auto* pEnv     = GPUTestingEnvironment::GetInstance();
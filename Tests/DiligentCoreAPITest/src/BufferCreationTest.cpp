@@ -437,4 +437,36 @@ TEST_F(BufferCreationTest, CreateUnifiedBuffer)
     }
 }
 
+TEST_F(BufferCreationTest, MemoryStats)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    DeviceMemoryStats StatsBefore;
+    pDevice->GetMemoryStats(StatsBefore);
+
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Memory stats test buffer";
+        BuffDesc.Size      = 1024;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr) << GetObjectDescString(BuffDesc);
+
+        DeviceMemoryStats Stats;
+        pDevice->GetMemoryStats(Stats);
+        EXPECT_EQ(Stats.NumBuffers, StatsBefore.NumBuffers + 1);
+        EXPECT_EQ(Stats.BufferMemorySize, StatsBefore.BufferMemorySize + BuffDesc.Size);
+        EXPECT_EQ(Stats.NumTextures, StatsBefore.NumTextures);
+    }
+
+    DeviceMemoryStats StatsAfter;
+    pDevice->GetMemoryStats(StatsAfter);
+    EXPECT_EQ(StatsAfter.NumBuffers, StatsBefore.NumBuffers);
+    EXPECT_EQ(StatsAfter.BufferMemorySize, StatsBefore.BufferMemorySize);
+}
+
 } // namespace
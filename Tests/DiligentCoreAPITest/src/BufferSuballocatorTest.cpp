@@ -153,4 +153,62 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+TEST(BufferSuballocatorTest, Defragment)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name      = "Buffer Suballocator Defragment Test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 1024;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_TRUE(pAllocator);
+
+    std::vector<RefCntAutoPtr<IBufferSuballocation>> Allocs(8);
+    for (auto& Alloc : Allocs)
+    {
+        pAllocator->Allocate(64, 16, &Alloc);
+        ASSERT_TRUE(Alloc);
+    }
+    pAllocator->Update(pDevice, pContext);
+
+    // Free every other allocation to fragment the buffer
+    for (size_t i = 0; i < Allocs.size(); i += 2)
+        Allocs[i].Release();
+
+    BufferSuballocatorUsageStats Stats;
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.MaxFreeChunkSize, 1024u - 8u * 64u);
+
+    // The budget allows only one move
+    Uint32 NumMoved = 0;
+    auto   Moved    = pAllocator->Defragment(pDevice, pContext, 64,
+                                        [&](IBufferSuballocation* pSuballocation, Uint32 OldOffset) {
+                                            EXPECT_LT(pSuballocation->GetOffset(), OldOffset);
+                                            ++NumMoved;
+                                        });
+    EXPECT_EQ(Moved, 64u);
+    EXPECT_EQ(NumMoved, 1u);
+
+    Moved = pAllocator->Defragment(pDevice, pContext, ~Uint64{0});
+    EXPECT_GT(Moved, 0u);
+
+    // All allocations are now packed at the beginning of the buffer
+    for (const auto& Alloc : Allocs)
+    {
+        if (Alloc)
+            EXPECT_LT(Alloc->GetOffset(), 4u * 64u);
+    }
+
+    pAllocator->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.MaxFreeChunkSize, 1024u - 4u * 64u);
+    EXPECT_EQ(pAllocator->Defragment(pDevice, pContext, ~Uint64{0}), 0u);
+}
+
 } // namespace
@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <string>
+
+#include "CommandStream.hpp"
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+#include "DurationQueryHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(CommandStreamTest, UpdateAndCopyBuffer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumValues = 64;
+    constexpr Uint32 BuffSize  = NumValues * sizeof(Uint32);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Command stream test buffer";
+        BuffDesc.Size      = BuffSize;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+
+        BuffDesc.Name           = "Command stream test staging buffer";
+        BuffDesc.BindFlags      = BIND_NONE;
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+    }
+
+    CommandStream Stream{16};
+
+    Uint32 RefData[NumValues] = {};
+    {
+        Uint32 Data[NumValues];
+        for (Uint32 i = 0; i < NumValues; ++i)
+            RefData[i] = Data[i] = i * 3 + 1;
+
+        Stream.BeginDebugGroup("Command stream test");
+        // The data is copied into the stream, so the source array may go out of scope
+        Stream.UpdateBuffer(pBuffer, 0, BuffSize / 2, Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        Stream.UpdateBuffer(pBuffer, BuffSize / 2, BuffSize / 2, Data + NumValues / 2, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        Stream.CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                          pStagingBuffer, 0, BuffSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        Stream.EndDebugGroup();
+    }
+
+    Uint32 NumCallbacks = 0;
+    Stream.InvokeCallback(
+        [](IDeviceContext* pCtx, void* pUserData) {
+            EXPECT_NE(pCtx, nullptr);
+            ++*static_cast<Uint32*>(pUserData);
+        },
+        &NumCallbacks);
+
+    EXPECT_EQ(Stream.GetCommandCount(), 6u);
+    EXPECT_GT(Stream.GetSize(), size_t{BuffSize});
+
+    Stream.Execute(pContext);
+    EXPECT_EQ(NumCallbacks, 1u);
+
+    pContext->WaitForIdle();
+    {
+        MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        EXPECT_EQ(memcmp(ReadBackData, RefData, BuffSize), 0);
+    }
+
+    Stream.Reset();
+    EXPECT_TRUE(Stream.IsEmpty());
+    EXPECT_EQ(Stream.GetSize(), size_t{0});
+
+    // Executing an empty stream is a no-op
+    Stream.Execute(pContext);
+    EXPECT_EQ(NumCallbacks, 1u);
+}
+
+// Captures a stream, serializes it and replays the deserialized copy several times, reporting
+// CPU and GPU timings. This is the basic workflow of replaying captured frames for benchmarking.
+TEST(CommandStreamTest, SerializeAndReplay)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 NumValues = 256;
+    constexpr Uint32 BuffSize  = NumValues * sizeof(Uint32);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Command stream replay test buffer";
+        BuffDesc.Size      = BuffSize;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+
+        BuffDesc.Name           = "Command stream replay test staging buffer";
+        BuffDesc.BindFlags      = BIND_NONE;
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+    }
+
+    // Object table that is saved alongside the stream
+    IObject* const Objects[] = {pBuffer, pStagingBuffer};
+
+    Uint32 RefData[NumValues] = {};
+    for (Uint32 i = 0; i < NumValues; ++i)
+        RefData[i] = i * 7 + 5;
+
+    std::vector<Uint8> SerializedData;
+    {
+        CommandStream Capture;
+        for (Uint32 i = 0; i < NumValues; i += 16)
+            Capture.UpdateBuffer(pBuffer, i * sizeof(Uint32), 16 * sizeof(Uint32), &RefData[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        const StateTransitionDesc Barrier{pBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        Capture.TransitionResourceStates(1, &Barrier);
+        Capture.CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_VERIFY,
+                           pStagingBuffer, 0, BuffSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        const bool Serialized = Capture.Serialize(
+            [&](IObject* pObject) {
+                const auto it = std::find(std::begin(Objects), std::end(Objects), pObject);
+                EXPECT_NE(it, std::end(Objects));
+                return static_cast<Uint32>(it - std::begin(Objects));
+            },
+            SerializedData);
+        ASSERT_TRUE(Serialized);
+    }
+
+    CommandStream Replay;
+    {
+        const bool Deserialized = Replay.Deserialize(
+            SerializedData.data(), SerializedData.size(),
+            [&](Uint32 Id) -> IObject* {
+                EXPECT_LT(Id, _countof(Objects));
+                return Id < _countof(Objects) ? Objects[Id] : nullptr;
+            });
+        ASSERT_TRUE(Deserialized);
+        EXPECT_EQ(Replay.GetCommandCount(), NumValues / 16 + 2);
+    }
+
+    // Corrupted data must be rejected
+    {
+        CommandStream Broken;
+        EXPECT_FALSE(Broken.Deserialize(SerializedData.data(), SerializedData.size() - 8, [](Uint32) -> IObject* { return nullptr; }));
+        EXPECT_TRUE(Broken.IsEmpty());
+    }
+
+    std::unique_ptr<DurationQueryHelper> pDurationQuery;
+    if (pDevice->GetDeviceInfo().Features.DurationQueries)
+        pDurationQuery = std::make_unique<DurationQueryHelper>(pDevice, 2);
+
+    constexpr Uint32 NumReplays = 16;
+
+    double CPUTime     = 0;
+    double GPUTime     = 0;
+    Uint32 NumGPUTimes = 0;
+    for (Uint32 i = 0; i < NumReplays; ++i)
+    {
+        if (pDurationQuery)
+            pDurationQuery->Begin(pContext);
+
+        Timer ReplayTimer;
+        Replay.Execute(pContext);
+        CPUTime += ReplayTimer.GetElapsedTime();
+
+        double Duration = 0;
+        if (pDurationQuery && pDurationQuery->End(pContext, Duration))
+        {
+            GPUTime += Duration;
+            ++NumGPUTimes;
+        }
+        pContext->Flush();
+    }
+    pContext->WaitForIdle();
+
+    LOG_INFO_MESSAGE("Command stream replay: ", Replay.GetCommandCount(), " commands, CPU: ", CPUTime / NumReplays * 1000.0, " ms",
+                     (NumGPUTimes > 0 ? ", GPU: " : ""), (NumGPUTimes > 0 ? std::to_string(GPUTime / NumGPUTimes * 1000.0) + " ms" : std::string{}));
+
+    {
+        MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        EXPECT_EQ(memcmp(ReadBackData, RefData, BuffSize), 0);
+    }
+}
+
+} // namespace
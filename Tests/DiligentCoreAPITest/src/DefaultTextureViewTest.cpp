@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<ITexture> CreateTestTexture(IRenderDevice* pDevice, MISC_TEXTURE_FLAGS MiscFlags)
+{
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Default view test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+    TexDesc.MiscFlags = MiscFlags;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    return pTexture;
+}
+
+TEST(DefaultTextureViewTest, LazyCreation)
+{
+    auto* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    for (MISC_TEXTURE_FLAGS MiscFlags : {MISC_TEXTURE_FLAG_NONE, MISC_TEXTURE_FLAG_EAGER_DEFAULT_VIEWS})
+    {
+        auto pTexture = CreateTestTexture(pDevice, MiscFlags);
+        ASSERT_NE(pTexture, nullptr);
+
+        // Request the views from multiple threads at once: all threads must get the same view
+        constexpr size_t           NumThreads = 8;
+        std::vector<ITextureView*> SRVs(NumThreads), RTVs(NumThreads);
+        std::vector<std::thread>   Threads;
+        for (size_t i = 0; i < NumThreads; ++i)
+        {
+            Threads.emplace_back([&, i]() {
+                SRVs[i] = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+                RTVs[i] = pTexture->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+
+        ASSERT_NE(SRVs[0], nullptr);
+        ASSERT_NE(RTVs[0], nullptr);
+        EXPECT_NE(SRVs[0], RTVs[0]);
+        for (size_t i = 1; i < NumThreads; ++i)
+        {
+            EXPECT_EQ(SRVs[i], SRVs[0]);
+            EXPECT_EQ(RTVs[i], RTVs[0]);
+        }
+        EXPECT_EQ(SRVs[0]->GetDesc().ViewType, TEXTURE_VIEW_SHADER_RESOURCE);
+        EXPECT_EQ(RTVs[0]->GetDesc().ViewType, TEXTURE_VIEW_RENDER_TARGET);
+
+        EXPECT_EQ(pTexture->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), nullptr);
+        EXPECT_EQ(pTexture->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS), nullptr);
+    }
+}
+
+} // namespace
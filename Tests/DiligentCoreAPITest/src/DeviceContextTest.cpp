@@ -26,6 +26,7 @@
 
 #include "DynamicBuffer.hpp"
 #include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
 
 #include "gtest/gtest.h"
 
@@ -50,4 +51,42 @@ TEST(DeviceContextTest, DebugGroups)
     pCtx->EndDebugGroup();
 }
 
+#ifndef DILIGENT_NO_CONTEXT_STATS
+TEST(DeviceContextTest, CPUTimeStats)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    auto* pCtx    = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "CPU time stats test buffer";
+    BuffDesc.Size           = 256;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    const Uint64 MapTimeBefore = pCtx->GetStats().CPUTime.Map;
+
+    // CPU time is not measured by default
+    {
+        MapHelper<Uint8> Data{pCtx, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+    }
+    EXPECT_EQ(pCtx->GetStats().CPUTime.Map, MapTimeBefore);
+
+    pCtx->EnableCPUTimeStats(true);
+    {
+        MapHelper<Uint8> Data{pCtx, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+    }
+    pCtx->EnableCPUTimeStats(false);
+    EXPECT_GT(pCtx->GetStats().CPUTime.Map, MapTimeBefore);
+
+    pCtx->Flush();
+}
+#endif
+
 } // namespace
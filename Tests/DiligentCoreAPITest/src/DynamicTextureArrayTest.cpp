@@ -314,4 +314,68 @@ INSTANTIATE_TEST_SUITE_P(DynamicTextureArray,
                              testing::Values<TEXTURE_FORMAT>(TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_BC1_UNORM_SRGB)),
                          GetTestName); //
 
+
+TEST(DynamicTextureArray, Chunked)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    DynamicTextureArrayCreateInfo DynTexArrCI;
+    DynTexArrCI.NumSlicesInChunk = 4;
+
+    auto& Desc{DynTexArrCI.Desc};
+    Desc.Name      = "Dynamic texture array chunked test";
+    Desc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    Desc.BindFlags = BIND_SHADER_RESOURCE;
+    Desc.Width     = 256;
+    Desc.Height    = 256;
+    Desc.MipLevels = 1;
+    Desc.Usage     = USAGE_DEFAULT;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.ArraySize = 3;
+
+    auto pDynTexArray = std::make_unique<DynamicTextureArray>(pDevice, DynTexArrCI);
+    ASSERT_NE(pDynTexArray, nullptr);
+    EXPECT_TRUE(pDynTexArray->IsChunked());
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetDesc().ArraySize, 4u);
+    EXPECT_EQ(pDynTexArray->GetNumChunks(), 1u);
+
+    RefCntAutoPtr<ITexture> pChunk0{pDynTexArray->GetChunk(0)};
+    ASSERT_NE(pChunk0, nullptr);
+    EXPECT_EQ(pChunk0->GetDesc().ArraySize, 4u);
+    EXPECT_EQ(pDynTexArray->GetTexture(), pChunk0);
+
+    const auto SliceSize = GetMipLevelProperties(Desc, 0).MipSize;
+
+    // Growing the array requires only the device and never copies existing chunks
+    pDynTexArray->Resize(pDevice, nullptr, 10);
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetDesc().ArraySize, 12u);
+    EXPECT_EQ(pDynTexArray->GetNumChunks(), 3u);
+    EXPECT_EQ(pDynTexArray->GetChunk(0), pChunk0);
+
+    auto Stats = pDynTexArray->GetStats();
+    EXPECT_EQ(Stats.NumSlices, 12u);
+    EXPECT_EQ(Stats.NumChunks, 3u);
+    EXPECT_EQ(Stats.CommittedMemorySize, SliceSize * 12);
+    EXPECT_EQ(Stats.PeakCommittedMemorySize, SliceSize * 12);
+    EXPECT_EQ(Stats.CopiedBytes, 0u);
+
+    pDynTexArray->Resize(nullptr, nullptr, 5);
+    EXPECT_FALSE(pDynTexArray->PendingUpdate());
+    EXPECT_EQ(pDynTexArray->GetNumChunks(), 2u);
+    EXPECT_EQ(pDynTexArray->GetChunk(0), pChunk0);
+
+    Stats = pDynTexArray->GetStats();
+    EXPECT_EQ(Stats.CommittedMemorySize, SliceSize * 8);
+    EXPECT_EQ(Stats.PeakCommittedMemorySize, SliceSize * 12);
+
+    pDynTexArray->Resize(nullptr, nullptr, 0);
+    EXPECT_EQ(pDynTexArray->GetNumChunks(), 0u);
+    EXPECT_EQ(pDynTexArray->GetTexture(), nullptr);
+}
+
 } // namespace
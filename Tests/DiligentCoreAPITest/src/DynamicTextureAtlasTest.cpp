@@ -549,4 +549,171 @@ TEST(DynamicTextureAtlas, AllocFreeRace)
     }
 }
 
+
+TEST(DynamicTextureAtlas, AllocateBatch)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    const Uint32 NumThreads = std::max(4u, std::thread::hardware_concurrency());
+
+    constexpr Uint32 AtlasDim          = 512;
+    constexpr Uint32 NumRegionsInBatch = 8;
+
+    DynamicTextureAtlasCreateInfo CI;
+    CI.ExtraSliceCount        = 2;
+    CI.MaxSliceCount          = NumThreads * 2;
+    CI.MinAlignment           = 16;
+    CI.ThreadAffineAllocation = true;
+    CI.Desc.Format            = TEX_FORMAT_RGBA8_UNORM;
+    CI.Desc.Name              = "Dynamic Texture Atlas Allocate Batch Test";
+    CI.Desc.Type              = RESOURCE_DIM_TEX_2D_ARRAY;
+    CI.Desc.BindFlags         = BIND_SHADER_RESOURCE;
+    CI.Desc.Width             = AtlasDim;
+    CI.Desc.Height            = AtlasDim;
+    CI.Desc.ArraySize         = 2;
+
+    RefCntAutoPtr<IDynamicTextureAtlas> pAtlas;
+    CreateDynamicTextureAtlas(pDevice, CI, &pAtlas);
+    ASSERT_TRUE(pAtlas);
+
+    // Every batch uses a quarter of a slice
+    const uint2 Sizes[NumRegionsInBatch] =
+        {
+            {128, 128},
+            {64, 64},
+            {128, 64},
+            {64, 128},
+            {32, 32},
+            {64, 32},
+            {32, 64},
+            {32, 32},
+        };
+
+    std::vector<std::vector<RefCntAutoPtr<ITextureAtlasSuballocation>>> Allocations(NumThreads);
+    {
+        std::vector<std::thread> Threads(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads[t] = std::thread{
+                [&](Uint32 ThreadId) //
+                {
+                    ITextureAtlasSuballocation* pSuballocations[NumRegionsInBatch] = {};
+                    pAtlas->AllocateBatch(NumRegionsInBatch, Sizes, pSuballocations);
+
+                    auto& Allocs = Allocations[ThreadId];
+                    Allocs.resize(NumRegionsInBatch);
+                    for (Uint32 i = 0; i < NumRegionsInBatch; ++i)
+                        Allocs[i].Attach(pSuballocations[i]);
+                },
+                t,
+            };
+        }
+
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    std::vector<ITextureAtlasSuballocation*> AllAllocs;
+    for (const auto& Allocs : Allocations)
+    {
+        for (Uint32 i = 0; i < NumRegionsInBatch; ++i)
+        {
+            ASSERT_TRUE(Allocs[i]);
+            EXPECT_EQ(Allocs[i]->GetSize(), Sizes[i]);
+            AllAllocs.push_back(Allocs[i]);
+        }
+    }
+
+    // Check that the regions do not overlap
+    for (size_t i = 0; i < AllAllocs.size(); ++i)
+    {
+        const auto* pA0 = AllAllocs[i];
+        for (size_t j = i + 1; j < AllAllocs.size(); ++j)
+        {
+            const auto* pA1 = AllAllocs[j];
+            if (pA0->GetSlice() != pA1->GetSlice())
+                continue;
+
+            const auto Min0 = pA0->GetOrigin();
+            const auto Max0 = Min0 + pA0->GetSize();
+            const auto Min1 = pA1->GetOrigin();
+            const auto Max1 = Min1 + pA1->GetSize();
+            EXPECT_TRUE(Max0.x <= Min1.x || Max1.x <= Min0.x || Max0.y <= Min1.y || Max1.y <= Min0.y);
+        }
+    }
+
+    auto* pTexture = pAtlas->Update(pDevice, pContext);
+    EXPECT_NE(pTexture, nullptr);
+
+    DynamicTextureAtlasUsageStats Stats;
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, NumThreads * NumRegionsInBatch);
+
+    Allocations.clear();
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+}
+
+
+TEST(DynamicTextureAtlas, SkylinePacking)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 AtlasDim = 256;
+
+    DynamicTextureAtlasCreateInfo CI;
+    CI.ExtraSliceCount = 1;
+    CI.MaxSliceCount   = 4;
+    CI.MinAlignment    = 4;
+    CI.PackingStrategy = TEXTURE_ATLAS_PACKING_STRATEGY_SKYLINE;
+    CI.Desc.Format     = TEX_FORMAT_R8_UNORM;
+    CI.Desc.Name       = "Dynamic Texture Atlas Skyline Packing Test";
+    CI.Desc.Type       = RESOURCE_DIM_TEX_2D_ARRAY;
+    CI.Desc.BindFlags  = BIND_SHADER_RESOURCE;
+    CI.Desc.Width      = AtlasDim;
+    CI.Desc.Height     = AtlasDim;
+    CI.Desc.ArraySize  = 1;
+
+    RefCntAutoPtr<IDynamicTextureAtlas> pAtlas;
+    CreateDynamicTextureAtlas(pDevice, CI, &pAtlas);
+    ASSERT_TRUE(pAtlas);
+
+    DynamicTextureAtlasUsageStats Stats;
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.SlicesInUse, 0u);
+    EXPECT_EQ(Stats.PackingEfficiency, 0.f);
+
+    // Glyph-like regions of similar height
+    std::vector<RefCntAutoPtr<ITextureAtlasSuballocation>> Allocations;
+    for (Uint32 i = 0; i < 256; ++i)
+    {
+        RefCntAutoPtr<ITextureAtlasSuballocation> pSuballoc;
+        pAtlas->Allocate(8 + (i * 7) % 16, 16 + (i % 2) * 4, &pSuballoc);
+        ASSERT_TRUE(pSuballoc);
+        Allocations.emplace_back(std::move(pSuballoc));
+    }
+
+    auto* pTexture = pAtlas->Update(pDevice, pContext);
+    EXPECT_NE(pTexture, nullptr);
+
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 256u);
+    EXPECT_GT(Stats.SlicesInUse, 0u);
+    EXPECT_GT(Stats.PackingEfficiency, 0.f);
+    EXPECT_LE(Stats.PackingEfficiency, 1.f);
+
+    Allocations.clear();
+    pAtlas->GetUsageStats(Stats);
+    EXPECT_EQ(Stats.AllocationCount, 0u);
+    EXPECT_EQ(Stats.SlicesInUse, 0u);
+}
+
 } // namespace
@@ -210,6 +210,51 @@ TEST_F(FenceTest, GPUWaitForCPU)
 }
 
 
+// Fences of the default type must be signaled by the device context regardless of whether
+// the NativeFence feature is enabled (in which case the Vulkan backend does not create sync points).
+TEST_F(FenceTest, CPUWaitOnlyFence)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    FenceDesc FenceCI;
+    FenceCI.Name = "CPU wait only fence";
+    ASSERT_EQ(FenceCI.Type, FENCE_TYPE_CPU_WAIT_ONLY);
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(FenceCI, &pFence);
+    ASSERT_NE(pFence, nullptr);
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{0});
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Fence test buffer";
+    BuffDesc.Size      = sizeof(float4);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    for (Uint64 Value = 1; Value <= 3; ++Value)
+    {
+        const float4 Data{static_cast<float>(Value), 0, 0, 0};
+        pContext->UpdateBuffer(pBuffer, 0, sizeof(Data), &Data, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->EnqueueSignal(pFence, Value);
+        pContext->Flush();
+
+        pFence->Wait(Value);
+        EXPECT_GE(pFence->GetCompletedValue(), Value);
+    }
+
+    // Signal without any commands recorded
+    pContext->EnqueueSignal(pFence, 10);
+    pContext->Flush();
+    pFence->Wait(10);
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{10});
+}
+
 TEST_F(FenceTest, ContextWaitForAnotherContext)
 {
     auto* pEnv    = GPUTestingEnvironment::GetInstance();
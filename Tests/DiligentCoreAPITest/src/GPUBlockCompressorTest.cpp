@@ -0,0 +1,144 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUBlockCompressor.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void TestSolidColorCompression(TEXTURE_FORMAT Format, const std::vector<Uint8>& RefBlock)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!GPUBlockCompressor::IsSupported(pDevice))
+    {
+        GTEST_SKIP() << "GPU block compressor is not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 Width  = 24;
+    constexpr Uint32 Height = 12;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "GPU block compressor source texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Width;
+    TexDesc.Height    = Height;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    // Solid red color
+    std::vector<Uint8> SrcData(Width * Height * 4);
+    for (size_t i = 0; i < SrcData.size(); i += 4)
+    {
+        SrcData[i + 0] = 255;
+        SrcData[i + 3] = 255;
+    }
+    TextureSubResData SubresData{SrcData.data(), Width * 4};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pSrcTex;
+    pDevice->CreateTexture(TexDesc, &InitData, &pSrcTex);
+    ASSERT_NE(pSrcTex, nullptr);
+
+    TexDesc.Name      = "GPU block compressor destination texture";
+    TexDesc.Format    = Format;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    RefCntAutoPtr<ITexture> pDstTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pDstTex);
+    ASSERT_NE(pDstTex, nullptr);
+
+    TexDesc.Name           = "GPU block compressor staging texture";
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    TexDesc.BindFlags      = BIND_NONE;
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTex);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    GPUBlockCompressor Compressor{pDevice};
+
+    GPUBlockCompressor::CompressAttribs Attribs;
+    Attribs.pSrcView    = pSrcTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    Attribs.pDstTexture = pDstTex;
+    Compressor.Compress(pContext, Attribs);
+
+    CopyTextureAttribs CopyAttribs{pDstTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    pContext->CopyTexture(CopyAttribs);
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    ASSERT_NE(MappedData.pData, nullptr);
+
+    const size_t BlockSize = RefBlock.size();
+    for (Uint32 by = 0; by < Height / 4; ++by)
+    {
+        for (Uint32 bx = 0; bx < Width / 4; ++bx)
+        {
+            const auto* pBlock = static_cast<const Uint8*>(MappedData.pData) + by * MappedData.Stride + bx * BlockSize;
+            EXPECT_TRUE(std::equal(RefBlock.begin(), RefBlock.end(), pBlock)) << "Block (" << bx << ", " << by << ") does not match the reference";
+        }
+    }
+
+    pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+}
+
+TEST(GPUBlockCompressorTest, BC1)
+{
+    // Both endpoints are RGB565 red, all indices are 0
+    TestSolidColorCompression(TEX_FORMAT_BC1_UNORM, {0x00, 0xF8, 0x00, 0xF8, 0, 0, 0, 0});
+}
+
+TEST(GPUBlockCompressorTest, BC3)
+{
+    TestSolidColorCompression(TEX_FORMAT_BC3_UNORM, {0xFF, 0xFF, 0, 0, 0, 0, 0, 0, 0x00, 0xF8, 0x00, 0xF8, 0, 0, 0, 0});
+}
+
+TEST(GPUBlockCompressorTest, BC4)
+{
+    TestSolidColorCompression(TEX_FORMAT_BC4_UNORM, {0xFF, 0xFF, 0, 0, 0, 0, 0, 0});
+}
+
+TEST(GPUBlockCompressorTest, BC5)
+{
+    TestSolidColorCompression(TEX_FORMAT_BC5_UNORM, {0xFF, 0xFF, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+}
+
+} // namespace
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUInstanceCuller.hpp"
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IBuffer> CreateStructuredBuffer(IRenderDevice* pDevice, const char* Name, const void* pData, Uint32 ElementSize, Uint32 NumElements)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = Name;
+    BuffDesc.Size              = Uint64{ElementSize} * NumElements;
+    BuffDesc.Usage             = USAGE_IMMUTABLE;
+    BuffDesc.BindFlags         = BIND_SHADER_RESOURCE;
+    BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+    BuffDesc.ElementByteStride = ElementSize;
+
+    BufferData InitData{pData, BuffDesc.Size};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+    return pBuffer;
+}
+
+std::vector<Uint32> ReadBuffer(IRenderDevice* pDevice, IDeviceContext* pContext, IBuffer* pBuffer, Uint32 Size)
+{
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "GPU instance culler test staging buffer";
+    BuffDesc.Size           = Size;
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    if (!pStagingBuffer)
+        return {};
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuffer, 0, Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    MapHelper<Uint32> ReadBackData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    const Uint32*     pData = ReadBackData;
+    return std::vector<Uint32>(pData, pData + Size / sizeof(Uint32));
+}
+
+TEST(GPUInstanceCullerTest, FrustumCulling)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!GPUInstanceCuller::IsSupported(pDevice))
+    {
+        GTEST_SKIP() << "GPU instance culler is not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // The view volume is [-10, 10] x [-10, 10] x [0, 100]
+    const float4x4 ViewProj = float4x4::Ortho(20, 20, 0, 100, false);
+
+    auto MakeInstance = [](const float3& Center, Uint32 MeshId) {
+        GPUInstanceCuller::InstanceData Instance;
+        Instance.BoundsMin = Center - float3{1, 1, 1};
+        Instance.BoundsMax = Center + float3{1, 1, 1};
+        Instance.MeshId    = MeshId;
+        return Instance;
+    };
+
+    const GPUInstanceCuller::InstanceData Instances[] = {
+        MakeInstance(float3{0, 0, 10}, 0),   // Visible
+        MakeInstance(float3{50, 0, 10}, 0),  // Outside of the frustum
+        MakeInstance(float3{0, 50, 10}, 1),  // Outside of the frustum
+        MakeInstance(float3{5, 5, 20}, 2),   // Visible
+        MakeInstance(float3{-5, -5, 30}, 0), // Visible
+        MakeInstance(float3{0, 0, 10}, 5),   // Invalid mesh index
+    };
+    constexpr Uint32 NumInstances = _countof(Instances);
+
+    // Instance ranges of the meshes are tightly packed: mesh 0 has 3 instances, meshes 1 and 2 have 1 instance
+    const GPUInstanceCuller::MeshData Meshes[] = {
+        {36, 0, 0, 0},
+        {6, 36, 100, 3},
+        {12, 42, 200, 4},
+    };
+    constexpr Uint32 NumMeshes = _countof(Meshes);
+
+    auto pInstances = CreateStructuredBuffer(pDevice, "GPU instance culler test instances", Instances, sizeof(GPUInstanceCuller::InstanceData), NumInstances);
+    ASSERT_NE(pInstances, nullptr);
+    auto pMeshes = CreateStructuredBuffer(pDevice, "GPU instance culler test meshes", Meshes, sizeof(GPUInstanceCuller::MeshData), NumMeshes);
+    ASSERT_NE(pMeshes, nullptr);
+
+    GPUInstanceCuller Culler{pDevice};
+
+    GPUInstanceCuller::CullAttribs Attribs;
+    Attribs.pInstances   = pInstances;
+    Attribs.NumInstances = NumInstances;
+    Attribs.pMeshes      = pMeshes;
+    Attribs.NumMeshes    = NumMeshes;
+    Attribs.ViewProj     = ViewProj;
+    Culler.Cull(pContext, Attribs);
+
+    ASSERT_NE(Culler.GetDrawArgsBuffer(), nullptr);
+    ASSERT_NE(Culler.GetDrawCountBuffer(), nullptr);
+    ASSERT_NE(Culler.GetVisibleInstanceBuffer(), nullptr);
+
+    const auto DrawAttribs = Culler.GetDrawAttribs(VT_UINT32);
+    EXPECT_EQ(DrawAttribs.pAttribsBuffer, Culler.GetDrawArgsBuffer());
+    EXPECT_EQ(DrawAttribs.pCounterBuffer, Culler.GetDrawCountBuffer());
+    EXPECT_EQ(DrawAttribs.DrawCount, NumMeshes);
+
+    const auto DrawCount = ReadBuffer(pDevice, pContext, Culler.GetDrawCountBuffer(), sizeof(Uint32));
+    ASSERT_EQ(DrawCount.size(), size_t{1});
+    ASSERT_EQ(DrawCount[0], 2u);
+
+    auto DrawArgs = ReadBuffer(pDevice, pContext, Culler.GetDrawArgsBuffer(), 2 * 5 * sizeof(Uint32));
+    ASSERT_EQ(DrawArgs.size(), size_t{10});
+    // The order of the commands is not deterministic
+    if (DrawArgs[4] > DrawArgs[9])
+        std::swap_ranges(DrawArgs.begin(), DrawArgs.begin() + 5, DrawArgs.begin() + 5);
+
+    // clang-format off
+    const std::vector<Uint32> RefDrawArgs = {
+        36, 2,  0,   0, 0,
+        12, 1, 42, 200, 4
+    };
+    // clang-format on
+    EXPECT_EQ(DrawArgs, RefDrawArgs);
+
+    const auto VisibleInstances = ReadBuffer(pDevice, pContext, Culler.GetVisibleInstanceBuffer(), NumInstances * sizeof(Uint32));
+    ASSERT_EQ(VisibleInstances.size(), size_t{NumInstances});
+    EXPECT_EQ(std::min(VisibleInstances[0], VisibleInstances[1]), 0u);
+    EXPECT_EQ(std::max(VisibleInstances[0], VisibleInstances[1]), 4u);
+    EXPECT_EQ(VisibleInstances[4], 3u);
+}
+
+} // namespace
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <chrono>
+
+#include "GPUProfiler.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(GPUProfilerTest, NestedScopes)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "GPU profiler test buffer";
+    BuffDesc.Size      = 4096;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    std::vector<Uint8> Data(BuffDesc.Size);
+
+    GPUProfiler Profiler{pDevice, 8};
+
+    constexpr Uint32 NumFrames = 3;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        {
+            GPUProfiler::Scope FrameScope{Profiler, pContext, "Frame"};
+            {
+                GPUProfiler::Scope UpdateScope{Profiler, pContext, "Update"};
+                pContext->UpdateBuffer(pBuffer, 0, BuffDesc.Size, Data.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            {
+                GPUProfiler::Scope CopyScope{Profiler, pContext, "Copy \"quoted\""};
+                pContext->UpdateBuffer(pBuffer, 0, BuffDesc.Size / 2, Data.data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+        pContext->Flush();
+        pContext->FinishFrame();
+        Profiler.EndFrame();
+    }
+    pContext->WaitForIdle();
+
+    GPUProfiler::FrameData Frame;
+    for (Uint32 i = 0; i < 100; ++i)
+    {
+        // Queries may not become available immediately after the GPU is idle in OpenGL
+        Profiler.EndFrame();
+        if (Profiler.GetLastResolvedFrame(Frame) && Frame.FrameNumber == NumFrames - 1)
+            break;
+        Frame = {};
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    ASSERT_EQ(Frame.FrameNumber, NumFrames - 1);
+    ASSERT_EQ(Frame.Scopes.size(), 3u);
+
+    const auto& Root = Frame.Scopes[0];
+    EXPECT_EQ(Root.Name, "Frame");
+    EXPECT_EQ(Root.Parent, GPUProfiler::InvalidIndex);
+    EXPECT_EQ(Root.Depth, 0u);
+    EXPECT_EQ(Root.StartTime, 0.0);
+    for (Uint32 i = 1; i < 3; ++i)
+    {
+        const auto& Child = Frame.Scopes[i];
+        EXPECT_EQ(Child.Parent, 0u);
+        EXPECT_EQ(Child.Depth, 1u);
+        EXPECT_EQ(Child.ContextIndex, Root.ContextIndex);
+        EXPECT_GE(Child.StartTime, Root.StartTime);
+        EXPECT_GE(Child.Duration, 0.0);
+    }
+    EXPECT_EQ(Frame.Scopes[1].Name, "Update");
+    EXPECT_EQ(Frame.Scopes[2].Name, "Copy \"quoted\"");
+
+    const auto Trace = Profiler.ExportChromeTrace();
+    EXPECT_NE(Trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Update\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Copy \\\"quoted\\\"\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"thread_name\""), std::string::npos);
+}
+
+} // namespace
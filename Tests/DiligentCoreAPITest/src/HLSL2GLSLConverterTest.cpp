@@ -27,6 +27,7 @@
 
 #include "GPUTestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "ThreadPool.hpp"
 
 #include "gtest/gtest.h"
 
@@ -175,4 +176,64 @@ TEST(HLSL2GLSLConverterTest, Preprocessor)
     }
 }
 
+TEST(HLSL2GLSLConverterTest, ParallelConversion)
+{
+    auto* pEnv = GPUTestingEnvironment::GetInstance();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pEnv->GetDevice()->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    // The source is tokenized once by the stream
+    RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+    pConverter->CreateStream("VS_PS.hlsl", pShaderSourceFactory, nullptr, 0, &pStream);
+    ASSERT_NE(pStream, nullptr);
+
+    struct EntryPointInfo
+    {
+        const char* Name;
+        SHADER_TYPE Type;
+    };
+    constexpr EntryPointInfo EntryPoints[] = {
+        {"TestVS", SHADER_TYPE_VERTEX},
+        {"TestPS", SHADER_TYPE_PIXEL},
+    };
+    constexpr Uint32 NumEntryPoints = _countof(EntryPoints);
+
+    auto ConvertEntryPoint = [&](const EntryPointInfo& EntryPoint) {
+        RefCntAutoPtr<IDataBlob> pGLSL;
+        pStream->Convert(EntryPoint.Name, EntryPoint.Type, true, "_sampler", true, false, &pGLSL);
+        return pGLSL != nullptr ?
+            std::string{pGLSL->GetConstDataPtr<char>(), pGLSL->GetSize()} :
+            std::string{};
+    };
+
+    std::string RefGLSL[NumEntryPoints];
+    for (Uint32 i = 0; i < NumEntryPoints; ++i)
+    {
+        RefGLSL[i] = ConvertEntryPoint(EntryPoints[i]);
+        ASSERT_FALSE(RefGLSL[i].empty()) << EntryPoints[i].Name;
+    }
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads = 4;
+    auto pThreadPool        = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Convert every entry point multiple times from the same stream on the thread pool
+    constexpr Uint32         NumConversions = 32;
+    std::vector<std::string> GLSL(NumConversions);
+    ParallelFor(pThreadPool, 0, NumConversions, 1,
+                [&](Uint32 Idx) {
+                    GLSL[Idx] = ConvertEntryPoint(EntryPoints[Idx % NumEntryPoints]);
+                });
+
+    for (Uint32 i = 0; i < NumConversions; ++i)
+        EXPECT_EQ(GLSL[i], RefGLSL[i % NumEntryPoints]) << EntryPoints[i % NumEntryPoints].Name;
+}
+
 } // namespace
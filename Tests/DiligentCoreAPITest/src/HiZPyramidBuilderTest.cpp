@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HiZPyramidBuilder.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 SrcWidth  = 37;
+constexpr Uint32 SrcHeight = 21;
+
+constexpr float MinDepth = 0.125f;
+constexpr float MaxDepth = 0.875f;
+
+// Builds the pyramid from a non-power-of-two source and returns the texel of the last level
+float2 BuildPyramid(HiZPyramidBuilder::ReductionMode Mode)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    // All depths are in [0.25, 0.75). The extreme values are placed at the texels that
+    // are not covered by the power-of-two footprint of the most detailed level.
+    std::vector<float> SrcData(SrcWidth * SrcHeight);
+    for (Uint32 y = 0; y < SrcHeight; ++y)
+    {
+        for (Uint32 x = 0; x < SrcWidth; ++x)
+            SrcData[x + y * SrcWidth] = 0.25f + 0.5f * static_cast<float>((x * 7 + y * 13) % 100) / 100.f;
+    }
+    SrcData[(SrcWidth - 1) + (SrcHeight - 1) * SrcWidth] = MinDepth;
+    SrcData[(SrcWidth - 1)]                              = MaxDepth;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Hi-Z pyramid builder test source";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = SrcWidth;
+    TexDesc.Height    = SrcHeight;
+    TexDesc.Format    = TEX_FORMAT_R32_FLOAT;
+    TexDesc.Usage     = USAGE_IMMUTABLE;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    TextureSubResData SubresData{SrcData.data(), SrcWidth * sizeof(float)};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pSrcTex;
+    pDevice->CreateTexture(TexDesc, &InitData, &pSrcTex);
+    if (!pSrcTex)
+    {
+        ADD_FAILURE() << "Failed to create the source texture";
+        return {};
+    }
+
+    HiZPyramidBuilder Builder{pDevice, Mode};
+    Builder.Build(pContext, {pSrcTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE)});
+
+    ITexture* pPyramid = Builder.GetPyramid();
+    if (pPyramid == nullptr)
+    {
+        ADD_FAILURE() << "Failed to build the pyramid";
+        return {};
+    }
+    EXPECT_NE(Builder.GetPyramidSRV(), nullptr);
+
+    const auto& PyramidDesc = pPyramid->GetDesc();
+    EXPECT_EQ(PyramidDesc.Width, 32u);
+    EXPECT_EQ(PyramidDesc.Height, 16u);
+    // Two dispatches are required to build six levels
+    EXPECT_EQ(PyramidDesc.MipLevels, 6u);
+    EXPECT_EQ(PyramidDesc.Format, Mode == HiZPyramidBuilder::ReductionMode::MinMax ? TEX_FORMAT_RG32_FLOAT : TEX_FORMAT_R32_FLOAT);
+
+    TexDesc.Name           = "Hi-Z pyramid builder test staging texture";
+    TexDesc.Width          = 1;
+    TexDesc.Height         = 1;
+    TexDesc.Format         = PyramidDesc.Format;
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    TexDesc.BindFlags      = BIND_NONE;
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTex);
+    if (!pStagingTex)
+    {
+        ADD_FAILURE() << "Failed to create the staging texture";
+        return {};
+    }
+
+    CopyTextureAttribs CopyAttribs{pPyramid, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+    CopyAttribs.SrcMipLevel = PyramidDesc.MipLevels - 1;
+    pContext->CopyTexture(CopyAttribs);
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    if (MappedData.pData == nullptr)
+    {
+        ADD_FAILURE() << "Failed to map the staging texture";
+        return {};
+    }
+
+    const float* pTexel = static_cast<const float*>(MappedData.pData);
+    float2       Texel{pTexel[0], Mode == HiZPyramidBuilder::ReductionMode::MinMax ? pTexel[1] : 0.f};
+    pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+
+    return Texel;
+}
+
+void TestReduction(HiZPyramidBuilder::ReductionMode Mode)
+{
+    auto* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+    if (!HiZPyramidBuilder::IsSupported(pDevice))
+    {
+        GTEST_SKIP() << "Hi-Z pyramid builder is not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const float2 Texel = BuildPyramid(Mode);
+    switch (Mode)
+    {
+        case HiZPyramidBuilder::ReductionMode::Min:
+            EXPECT_EQ(Texel.x, MinDepth);
+            break;
+
+        case HiZPyramidBuilder::ReductionMode::Max:
+            EXPECT_EQ(Texel.x, MaxDepth);
+            break;
+
+        case HiZPyramidBuilder::ReductionMode::MinMax:
+            EXPECT_EQ(Texel.x, MinDepth);
+            EXPECT_EQ(Texel.y, MaxDepth);
+            break;
+    }
+}
+
+TEST(HiZPyramidBuilderTest, Min)
+{
+    TestReduction(HiZPyramidBuilder::ReductionMode::Min);
+}
+
+TEST(HiZPyramidBuilderTest, Max)
+{
+    TestReduction(HiZPyramidBuilder::ReductionMode::Max);
+}
+
+TEST(HiZPyramidBuilderTest, MinMax)
+{
+    TestReduction(HiZPyramidBuilder::ReductionMode::MinMax);
+}
+
+} // namespace
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "OffScreenSwapChain.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(OffScreenSwapChainTest, FrameReadback)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    SwapChainDesc SCDesc;
+    SCDesc.Width             = 64;
+    SCDesc.Height            = 32;
+    SCDesc.ColorBufferFormat = TEX_FORMAT_RGBA8_UNORM;
+    SCDesc.DepthBufferFormat = TEX_FORMAT_UNKNOWN;
+    SCDesc.BufferCount       = 2;
+    SCDesc.IsPrimary         = false;
+
+    struct ReceivedFrame
+    {
+        Uint64 Index;
+        Uint32 FirstPixel;
+        Uint32 LastPixel;
+    };
+    std::vector<ReceivedFrame> ReceivedFrames;
+
+    OffScreenSwapChainReadbackAttribs ReadbackAttribs;
+    ReadbackAttribs.NumStagingTextures = 3;
+    ReadbackAttribs.FrameCallback      = [&](const OffScreenFrameData& Frame) {
+        EXPECT_EQ(Frame.Width, SCDesc.Width);
+        EXPECT_EQ(Frame.Height, SCDesc.Height);
+        EXPECT_EQ(Frame.Format, SCDesc.ColorBufferFormat);
+        ASSERT_NE(Frame.pData, nullptr);
+
+        const auto* pFirstRow = static_cast<const Uint32*>(Frame.pData);
+        const auto* pLastRow  = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(Frame.pData) + Frame.RowStride * (Frame.Height - 1));
+        ReceivedFrames.push_back({Frame.FrameIndex, pFirstRow[0], pLastRow[Frame.Width - 1]});
+    };
+
+    constexpr Uint32 NumFrames = 8;
+    {
+        RefCntAutoPtr<ISwapChain> pSwapChain;
+        CreateOffScreenSwapChain(pDevice, pContext, SCDesc, ReadbackAttribs, &pSwapChain);
+        ASSERT_NE(pSwapChain, nullptr);
+
+        for (Uint32 frame = 0; frame < NumFrames; ++frame)
+        {
+            auto* pRTV = pSwapChain->GetCurrentBackBufferRTV();
+            ASSERT_NE(pRTV, nullptr);
+            pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+            const float ClearColor[] = {static_cast<float>(frame) / 255.f, 0, 0, 1};
+            pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            pContext->SetRenderTargets(0, nullptr, nullptr, RESOURCE_STATE_TRANSITION_MODE_NONE);
+
+            pSwapChain->Present();
+
+            // No more than NumStagingTextures - 1 frames remain in flight after Present()
+            EXPECT_GE(ReceivedFrames.size() + ReadbackAttribs.NumStagingTextures - 1, frame + 1);
+        }
+        // All pending frames are delivered when the swap chain is destroyed
+    }
+
+    ASSERT_EQ(ReceivedFrames.size(), NumFrames);
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        const Uint32 RefPixel = frame | 0xFF000000u;
+        EXPECT_EQ(ReceivedFrames[frame].Index, frame);
+        EXPECT_EQ(ReceivedFrames[frame].FirstPixel, RefPixel);
+        EXPECT_EQ(ReceivedFrames[frame].LastPixel, RefPixel);
+    }
+}
+
+} // namespace
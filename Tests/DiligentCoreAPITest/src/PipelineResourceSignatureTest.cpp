@@ -2031,4 +2031,99 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+TEST_F(PipelineResourceSignatureTest, InlineConstants)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    float ClearColor[] = {0.625, 0.125, 0.25, 0.5};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc       = {"Triangle VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    // The constants scale the vertex color, so the result must match the reference
+    // only if all four constants are uploaded.
+    static constexpr char InlineConstantsPS[] = R"(
+cbuffer cbInlineConstants
+{
+    float4 g_Scale;
+}
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return float4(PSIn.Color.rgb * g_Scale.rgb, g_Scale.a);
+}
+)";
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc       = {"Inline constants PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = InlineConstantsPS;
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Inline constants test";
+
+    PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_PIXEL, "cbInlineConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS},
+    };
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    auto pPSO = CreateGraphicsPSO(pVS, pPS, {pPRS});
+    ASSERT_TRUE(pPSO);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_TRUE(pSRB);
+
+    auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbInlineConstants");
+    ASSERT_NE(pVar, nullptr);
+
+    const float Scale[] = {1, 1, 1, 1};
+    pVar->SetInlineConstants(&Scale[0], 0, 2);
+    pVar->SetInlineConstants(&Scale[2], 2, 2);
+    EXPECT_NE(pVar->Get(), nullptr);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttribs DrawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+    pContext->Draw(DrawAttrs);
+
+    pSwapChain->Present();
+}
+
 } // namespace Diligent
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "QueueScheduler.hpp"
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(QueueSchedulerTest, CrossQueueDependency)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    if (pEnv->GetNumImmediateContexts() <= 1)
+    {
+        GTEST_SKIP() << "Multiple immediate contexts are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    IDeviceContext* pContexts[] = {pEnv->GetDeviceContext(0), pEnv->GetDeviceContext(1)};
+
+    const Uint64 QueueMask = (Uint64{1} << pContexts[0]->GetDesc().ContextId) | (Uint64{1} << pContexts[1]->GetDesc().ContextId);
+
+    constexpr float TestData[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    constexpr auto  BuffSize   = sizeof(TestData);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name                 = "Queue scheduler test buffer";
+        BuffDesc.Size                 = BuffSize;
+        BuffDesc.BindFlags            = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage                = USAGE_DEFAULT;
+        BuffDesc.ImmediateContextMask = QueueMask;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+
+        BuffDesc.Name                 = "Queue scheduler test staging buffer";
+        BuffDesc.BindFlags            = BIND_NONE;
+        BuffDesc.Usage                = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags       = CPU_ACCESS_READ;
+        BuffDesc.ImmediateContextMask = Uint64{1} << pContexts[0]->GetDesc().ContextId;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+        ASSERT_NE(pStagingBuffer, nullptr);
+    }
+
+    QueueScheduler Scheduler{pDevice, pContexts, _countof(pContexts)};
+
+    QueueScheduler::PassDesc UploadPass;
+    UploadPass.Name         = "Upload";
+    UploadPass.ContextIndex = 1;
+
+    const auto UploadPassHandle = Scheduler.AddPass(
+        UploadPass,
+        [&](IDeviceContext* pCtx) {
+            pCtx->UpdateBuffer(pBuffer, 0, BuffSize, TestData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        });
+
+    const StateTransitionDesc Barrier{pBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_SOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE};
+
+    QueueScheduler::PassDesc ReadBackPass;
+    ReadBackPass.Name            = "Read back";
+    ReadBackPass.ContextIndex    = 0;
+    ReadBackPass.pDependencies   = &UploadPassHandle;
+    ReadBackPass.NumDependencies = 1;
+    ReadBackPass.pBarriers       = &Barrier;
+    ReadBackPass.NumBarriers     = 1;
+
+    Scheduler.AddPass(
+        ReadBackPass,
+        [&](IDeviceContext* pCtx) {
+            pCtx->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_VERIFY,
+                             pStagingBuffer, 0, BuffSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        });
+
+    Scheduler.Execute();
+
+    // Both contexts have been flushed and signaled
+    EXPECT_GT(Scheduler.GetLastSignaledValue(0), Uint64{0});
+    EXPECT_GT(Scheduler.GetLastSignaledValue(1), Uint64{0});
+
+    Scheduler.GetFence(0)->Wait(Scheduler.GetLastSignaledValue(0));
+
+    {
+        MapHelper<float> ReadBackData{pContexts[0], pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        EXPECT_EQ(memcmp(ReadBackData, TestData, BuffSize), 0);
+    }
+
+    for (auto* pCtx : pContexts)
+        pCtx->WaitForIdle();
+}
+
+} // namespace
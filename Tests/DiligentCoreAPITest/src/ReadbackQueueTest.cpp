@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstring>
+
+#include "ReadbackQueue.h"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Processes completed reads until there are no pending reads
+void WaitForReads(IReadbackQueue* pQueue, IDeviceContext* pContext)
+{
+    pContext->Flush();
+    pContext->WaitForIdle();
+    for (Uint32 i = 0; i < 100 && pQueue->GetNumPendingReads() > 0; ++i)
+    {
+        pQueue->ProcessCompleted(pContext);
+        if (pQueue->GetNumPendingReads() > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+TEST(ReadbackQueueTest, ReadBuffer)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    std::vector<Uint32> RefData(1024);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint32>(i * 3 + 1);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Readback queue test buffer";
+    BuffDesc.Size      = RefData.size() * sizeof(RefData[0]);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    BufferData InitData{RefData.data(), BuffDesc.Size};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    for (bool DeferCallbacks : {false, true})
+    {
+        ReadbackQueueCreateInfo CI;
+        CI.Name           = "Readback queue test";
+        CI.DeferCallbacks = DeferCallbacks;
+
+        RefCntAutoPtr<IReadbackQueue> pQueue;
+        CreateReadbackQueue(pDevice, CI, &pQueue);
+        ASSERT_NE(pQueue, nullptr);
+
+        constexpr Uint32 NumReads = 4;
+
+        Uint32 NumCallbacks = 0;
+        for (Uint32 pass = 0; pass < 2; ++pass)
+        {
+            for (Uint32 r = 0; r < NumReads; ++r)
+            {
+                const Uint64 Offset = r * 256 * sizeof(Uint32);
+                const Uint64 Size   = (r + 1) * 64 * sizeof(Uint32);
+                pQueue->ReadBuffer(pContext, pBuffer, Offset, Size,
+                                   [&, Offset, Size](const ReadbackData& Data) {
+                                       ++NumCallbacks;
+                                       ASSERT_NE(Data.pData, nullptr);
+                                       EXPECT_EQ(Data.DataSize, Size);
+                                       EXPECT_EQ(memcmp(Data.pData, reinterpret_cast<const Uint8*>(RefData.data()) + Offset, static_cast<size_t>(Size)), 0);
+                                   });
+            }
+            EXPECT_EQ(pQueue->GetNumPendingReads(), NumReads);
+
+            WaitForReads(pQueue, pContext);
+            EXPECT_EQ(pQueue->GetNumPendingReads(), 0u);
+
+            if (DeferCallbacks)
+            {
+                EXPECT_EQ(NumCallbacks, pass * NumReads);
+                std::thread{[&]() { EXPECT_EQ(pQueue->InvokeCallbacks(), NumReads); }}.join();
+            }
+            EXPECT_EQ(NumCallbacks, (pass + 1) * NumReads);
+
+            // Staging buffers are reused
+            EXPECT_GT(pQueue->GetPooledMemorySize(), 0u);
+        }
+    }
+}
+
+TEST(ReadbackQueueTest, ReadTexture)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr Uint32 TexWidth  = 64;
+    constexpr Uint32 TexHeight = 32;
+
+    std::vector<Uint32> RefData(TexWidth * TexHeight);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint32>(i * 7 + 5);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Readback queue test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = TexWidth;
+    TexDesc.Height    = TexHeight;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_DEFAULT;
+
+    TextureSubResData SubresData{RefData.data(), TexWidth * sizeof(Uint32)};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    RefCntAutoPtr<IReadbackQueue> pQueue;
+    CreateReadbackQueue(pDevice, ReadbackQueueCreateInfo{}, &pQueue);
+    ASSERT_NE(pQueue, nullptr);
+
+    const Box Region{8, 40, 4, 20};
+
+    bool CallbackInvoked = false;
+    pQueue->ReadTexture(pContext, pTexture, 0, 0, &Region,
+                        [&](const ReadbackData& Data) {
+                            CallbackInvoked = true;
+                            ASSERT_NE(Data.pData, nullptr);
+                            EXPECT_EQ(Data.Width, Region.Width());
+                            EXPECT_EQ(Data.Height, Region.Height());
+                            EXPECT_GE(Data.RowStride, Region.Width() * sizeof(Uint32));
+                            for (Uint32 y = 0; y < Data.Height; ++y)
+                            {
+                                const auto* pRow = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(Data.pData) + y * Data.RowStride);
+                                for (Uint32 x = 0; x < Data.Width; ++x)
+                                {
+                                    EXPECT_EQ(pRow[x], RefData[(Region.MinY + y) * TexWidth + Region.MinX + x]);
+                                }
+                            }
+                        });
+
+    WaitForReads(pQueue, pContext);
+    EXPECT_TRUE(CallbackInvoked);
+}
+
+TEST(ReadbackQueueTest, ReleaseWithPendingReads)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Readback queue test buffer";
+    BuffDesc.Size      = 1024;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BuffDesc.Usage     = USAGE_DEFAULT;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    Uint32 NumFailedReads = 0;
+    {
+        RefCntAutoPtr<IReadbackQueue> pQueue;
+        CreateReadbackQueue(pDevice, ReadbackQueueCreateInfo{}, &pQueue);
+        ASSERT_NE(pQueue, nullptr);
+
+        for (Uint32 r = 0; r < 3; ++r)
+        {
+            pQueue->ReadBuffer(pContext, pBuffer, 0, BuffDesc.Size,
+                               [&](const ReadbackData& Data) {
+                                   if (Data.pData == nullptr)
+                                       ++NumFailedReads;
+                               });
+        }
+    }
+    // Every callback is invoked exactly once
+    EXPECT_EQ(NumFailedReads, 3u);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+
+#include "RenderGraph.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(RenderGraphTest, CullAndExecute)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TextureDesc Desc;
+    Desc.Name      = "Render graph test texture";
+    Desc.Type      = RESOURCE_DIM_TEX_2D;
+    Desc.Width     = 256;
+    Desc.Height    = 256;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+    Desc.MipLevels = 1;
+
+    RefCntAutoPtr<ITexture> pOutput;
+    pDevice->CreateTexture(Desc, nullptr, &pOutput);
+    ASSERT_NE(pOutput, nullptr);
+
+    RenderGraphCreateInfo CI;
+    CI.Name = "Render graph test";
+    RenderGraph Graph{pDevice, CI};
+
+    std::vector<Uint32> ExecutedPasses;
+
+    const auto Output  = Graph.ImportTexture(pOutput, RESOURCE_STATE_SHADER_RESOURCE);
+    const auto GBuffer = Graph.CreateTexture(Desc);
+    const auto Unused  = Graph.CreateTexture(Desc);
+
+    Graph.AddPass("GBuffer", [&](IDeviceContext*, const RenderGraph& G) {
+             EXPECT_NE(G.GetTexture(GBuffer), nullptr);
+             ExecutedPasses.push_back(0);
+         })
+        .Write(GBuffer);
+    Graph.AddPass("Unused", [&](IDeviceContext*, const RenderGraph&) {
+             ExecutedPasses.push_back(1);
+         })
+        .Read(GBuffer)
+        .Write(Unused);
+    Graph.AddPass("Lighting", [&](IDeviceContext*, const RenderGraph& G) {
+             EXPECT_EQ(G.GetTexture(Output), pOutput);
+             ExecutedPasses.push_back(2);
+         })
+        .Read(GBuffer)
+        .Write(Output);
+
+    Graph.Compile(pContext);
+    EXPECT_FALSE(Graph.IsPassCulled(0));
+    EXPECT_TRUE(Graph.IsPassCulled(1));
+    EXPECT_FALSE(Graph.IsPassCulled(2));
+    EXPECT_EQ(Graph.GetTexture(Unused), nullptr);
+
+    Graph.Execute(pContext);
+    EXPECT_EQ(ExecutedPasses, (std::vector<Uint32>{0, 2}));
+    EXPECT_EQ(pOutput->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+    const auto Stats = Graph.GetStats();
+    EXPECT_EQ(Stats.NumPasses, 3u);
+    EXPECT_EQ(Stats.NumCulledPasses, 1u);
+    EXPECT_EQ(Stats.NumTransientTextures, 1u);
+    EXPECT_GT(Stats.NumTransitions, 0u);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -33,6 +33,8 @@
 #include "FastRand.hpp"
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
 #include "ResourceLayoutTestCommon.hpp"
 
 #include "InlineShaders/RayTracingTestHLSL.h"
@@ -1095,6 +1097,179 @@ TEST(RenderStateCacheTest, AppendData)
     }
 }
 
+TEST(RenderStateCacheTest, Journal)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    auto pWhiteTexture = CreateWhiteTexture();
+
+    constexpr bool UseSignature  = false;
+    constexpr bool UseRenderPass = false;
+
+    auto pJournal = DataBlobImpl::Create();
+
+    // Write the first record with the compute pipeline
+    size_t FirstRecordEnd = 0;
+    {
+        auto pCache  = CreateCache(pDevice, /*HotReload = */ false);
+        auto pStream = MemoryFileStream::Create(pJournal);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ false);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, UseSignature, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        EXPECT_TRUE(pCache->WriteToJournal(ContentVersion, pStream));
+        FirstRecordEnd = pJournal->GetSize();
+        EXPECT_GT(FirstRecordEnd, size_t{0});
+
+        // Nothing new was added, so the journal must not change
+        EXPECT_TRUE(pCache->WriteToJournal(ContentVersion, pStream));
+        EXPECT_EQ(pJournal->GetSize(), FirstRecordEnd);
+    }
+
+    // Replay the journal and append the second record with the graphics pipeline
+    {
+        // The cache references the loaded data, so it must not be modified while the cache is alive
+        auto pLoadedJournal = DataBlobImpl::Create(pJournal->GetSize(), pJournal->GetConstDataPtr());
+        auto pCache         = CreateCache(pDevice, /*HotReload = */ false, pLoadedJournal);
+        auto pStream        = MemoryFileStream::Create(pJournal);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateGraphicsPSO(pCache, /*PresentInCache = */ false, pVS, pPS, UseRenderPass, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        EXPECT_TRUE(pCache->WriteToJournal(ContentVersion, pStream));
+        EXPECT_GT(pJournal->GetSize(), FirstRecordEnd);
+    }
+
+    // Replay both records
+    {
+        auto pCache = CreateCache(pDevice, /*HotReload = */ false, pJournal);
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ true);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateGraphicsPSO(pCache, /*PresentInCache = */ true, pVS, pPS, UseRenderPass, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        VerifyGraphicsPSO(pPSO, nullptr, pWhiteTexture, UseRenderPass);
+
+        // Compact the journal
+        RefCntAutoPtr<IDataBlob> pData;
+        pCache->WriteToBlob(~0u, &pData);
+        ASSERT_NE(pData, nullptr);
+
+        auto pCache2 = CreateCache(pDevice, /*HotReload = */ false, pData);
+
+        RefCntAutoPtr<IPipelineState> pPSO2;
+        CreateGraphicsPSO(pCache2, /*PresentInCache = */ true, pVS, pPS, UseRenderPass, /*CompileAsync = */ false, &pPSO2);
+        ASSERT_NE(pPSO2, nullptr);
+    }
+
+    // Truncated trailing record must be ignored
+    {
+        pJournal->Resize(pJournal->GetSize() - 1);
+        auto pCache = CreateCache(pDevice, /*HotReload = */ false, pJournal);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+    }
+}
+
+TEST(RenderStateCacheTest, PrewarmPipelines)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    auto pWhiteTexture = CreateWhiteTexture();
+
+    constexpr bool HotReload     = false;
+    constexpr bool UseRenderPass = false;
+    constexpr bool CompileAsync  = false;
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefCntAutoPtr<IDataBlob> pUsageData;
+    {
+        auto pCache = CreateCache(pDevice, HotReload);
+        ASSERT_TRUE(pCache);
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateGraphicsPSO(pCache, /*PresentInCache = */ false, pVS, pPS, UseRenderPass, CompileAsync, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        pCache->WriteToBlob(ContentVersion, &pData);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_TRUE(pCache->WritePipelineUsage(&pUsageData));
+        ASSERT_NE(pUsageData, nullptr);
+    }
+
+    auto pCache = CreateCache(pDevice, HotReload, pData);
+    ASSERT_TRUE(pCache);
+    EXPECT_EQ(pCache->PrewarmPipelines(pUsageData), 1u);
+
+    Uint32 NumTotal = 0;
+    pCache->GetPrewarmProgress(&NumTotal);
+    EXPECT_EQ(NumTotal, 1u);
+
+    RefCntAutoPtr<IShader> pVS, pPS;
+    CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, true);
+    ASSERT_NE(pVS, nullptr);
+    ASSERT_NE(pPS, nullptr);
+
+    // The pipeline must be returned from the pre-warmed set, so it is ready when the call returns
+    RefCntAutoPtr<IPipelineState> pPSO;
+    CreateGraphicsPSO(pCache, /*PresentInCache = */ true, pVS, pPS, UseRenderPass, CompileAsync, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    EXPECT_EQ(pCache->GetPrewarmProgress(), 1u);
+
+    VerifyGraphicsPSO(pPSO, nullptr, pWhiteTexture, UseRenderPass);
+}
+
 TEST(RenderStateCacheTest, RenderDeviceWithCache)
 {
     constexpr bool Execute = false;
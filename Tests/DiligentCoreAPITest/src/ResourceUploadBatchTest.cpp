@@ -0,0 +1,246 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+#include <cstring>
+
+#include "ResourceUploadBatch.hpp"
+#include "GraphicsAccessories.hpp"
+#include "MapHelper.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::vector<Uint8> ReadBuffer(IRenderDevice* pDevice, IDeviceContext* pContext, IBuffer* pBuffer)
+{
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Resource upload batch test readback buffer";
+    StagingDesc.Size           = pBuffer->GetDesc().Size;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuff;
+    pDevice->CreateBuffer(StagingDesc, nullptr, &pStagingBuff);
+    if (!pStagingBuff)
+        return {};
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pStagingBuff, 0, StagingDesc.Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    MapHelper<Uint8> Data{pContext, pStagingBuff, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    return {&Data[0], &Data[0] + StagingDesc.Size};
+}
+
+TEST(ResourceUploadBatchTest, Buffers)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    ResourceUploadBatchCreateInfo CI;
+    CI.pDevice         = pDevice;
+    CI.pContext        = pContext;
+    CI.StagingPageSize = 4096;
+
+    ResourceUploadBatch Batch{CI};
+
+    // The first three buffers share a page, the last one gets a dedicated page
+    constexpr Uint32   NumBuffers              = 4;
+    const Uint64       BufferSizes[NumBuffers] = {256, 1000, 2048, 10000};
+    std::vector<Uint8> RefData[NumBuffers];
+
+    RefCntAutoPtr<IBuffer> pBuffers[NumBuffers];
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        RefData[i].resize(static_cast<size_t>(BufferSizes[i]));
+        for (size_t j = 0; j < RefData[i].size(); ++j)
+            RefData[i][j] = static_cast<Uint8>(j * 7 + i);
+
+        BufferDesc Desc;
+        Desc.Name      = "Resource upload batch test buffer";
+        Desc.Size      = BufferSizes[i];
+        Desc.BindFlags = BIND_VERTEX_BUFFER;
+        Desc.Usage     = USAGE_IMMUTABLE;
+
+        BufferData Data{RefData[i].data(), BufferSizes[i]};
+        Batch.CreateBuffer(Desc, &Data, &pBuffers[i]);
+        ASSERT_NE(pBuffers[i], nullptr);
+    }
+    EXPECT_EQ(Batch.GetNumPendingUploads(), size_t{NumBuffers});
+    EXPECT_EQ(Batch.GetStagingMemorySize(), Uint64{4096 + 10000});
+
+    const Uint64 FenceValue = Batch.Submit();
+    EXPECT_EQ(FenceValue, Uint64{1});
+    EXPECT_EQ(Batch.GetNumPendingUploads(), size_t{0});
+    // Dedicated page is released after the submission
+    EXPECT_EQ(Batch.GetStagingMemorySize(), Uint64{4096});
+
+    // Nothing to submit
+    EXPECT_EQ(Batch.Submit(), FenceValue);
+
+    Batch.GetFence()->Wait(FenceValue);
+    EXPECT_TRUE(Batch.IsComplete(FenceValue));
+
+    for (Uint32 i = 0; i < NumBuffers; ++i)
+    {
+        EXPECT_EQ(ReadBuffer(pDevice, pContext, pBuffers[i]), RefData[i]) << "Buffer " << i;
+    }
+
+    // The completed page must be reused by the next batch
+    RefCntAutoPtr<IBuffer> pBuffer;
+    {
+        BufferDesc Desc;
+        Desc.Name      = "Resource upload batch test buffer 2";
+        Desc.Size      = 512;
+        Desc.BindFlags = BIND_VERTEX_BUFFER;
+
+        BufferData Data{RefData[2].data(), Desc.Size};
+        Batch.CreateBuffer(Desc, &Data, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr);
+    }
+    EXPECT_EQ(Batch.GetStagingMemorySize(), Uint64{4096});
+    EXPECT_EQ(Batch.Submit(), FenceValue + 1);
+    Batch.GetFence()->Wait(FenceValue + 1);
+
+    EXPECT_EQ(ReadBuffer(pDevice, pContext, pBuffer), std::vector<Uint8>(RefData[2].begin(), RefData[2].begin() + 512));
+}
+
+TEST(ResourceUploadBatchTest, Textures)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TextureDesc Desc;
+    Desc.Name      = "Resource upload batch test texture";
+    Desc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    Desc.Width     = 100;
+    Desc.Height    = 60;
+    Desc.ArraySize = 2;
+    Desc.MipLevels = 3;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    Desc.BindFlags = BIND_SHADER_RESOURCE;
+    Desc.Usage     = USAGE_IMMUTABLE;
+
+    std::vector<std::vector<Uint8>> RefData(Desc.ArraySize * Desc.MipLevels);
+    std::vector<TextureSubResData>  SubResources(RefData.size());
+    for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            const auto MipProps = GetMipLevelProperties(Desc, Mip);
+            const auto Idx      = Slice * Desc.MipLevels + Mip;
+
+            RefData[Idx].resize(static_cast<size_t>(MipProps.MipSize));
+            for (size_t i = 0; i < RefData[Idx].size(); ++i)
+                RefData[Idx][i] = static_cast<Uint8>(i * 13 + Idx);
+            SubResources[Idx] = TextureSubResData{RefData[Idx].data(), MipProps.RowSize};
+        }
+    }
+
+    ResourceUploadBatchCreateInfo CI;
+    CI.pDevice  = pDevice;
+    CI.pContext = pContext;
+
+    ResourceUploadBatch Batch{CI};
+
+    TextureData             InitData{SubResources.data(), static_cast<Uint32>(SubResources.size())};
+    RefCntAutoPtr<ITexture> pTextures[2];
+    for (auto& pTex : pTextures)
+    {
+        Batch.CreateTexture(Desc, &InitData, &pTex);
+        ASSERT_NE(pTex, nullptr);
+    }
+
+    const Uint64 FenceValue = Batch.Submit();
+    Batch.GetFence()->Wait(FenceValue);
+    EXPECT_EQ(Batch.GetNumPendingUploads(), size_t{0});
+
+    auto StagingDesc           = Desc;
+    StagingDesc.Name           = "Resource upload batch test staging texture";
+    StagingDesc.BindFlags      = BIND_NONE;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(StagingDesc, nullptr, &pStagingTex);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    for (auto& pTex : pTextures)
+    {
+        for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            {
+                CopyTextureAttribs CopyAttribs{pTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+                CopyAttribs.SrcSlice    = Slice;
+                CopyAttribs.SrcMipLevel = Mip;
+                CopyAttribs.DstSlice    = Slice;
+                CopyAttribs.DstMipLevel = Mip;
+                pContext->CopyTexture(CopyAttribs);
+            }
+        }
+        pContext->WaitForIdle();
+
+        for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            {
+                const auto  MipProps = GetMipLevelProperties(Desc, Mip);
+                const auto& Ref      = RefData[Slice * Desc.MipLevels + Mip];
+
+                MappedTextureSubresource MappedSubres;
+                pContext->MapTextureSubresource(pStagingTex, Mip, Slice, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedSubres);
+                ASSERT_NE(MappedSubres.pData, nullptr);
+
+                bool DataOK = true;
+                for (Uint32 Row = 0; Row < MipProps.LogicalHeight; ++Row)
+                {
+                    const auto* pRow    = static_cast<const Uint8*>(MappedSubres.pData) + Row * MappedSubres.Stride;
+                    const auto* pRefRow = &Ref[static_cast<size_t>(Row * MipProps.RowSize)];
+                    if (memcmp(pRow, pRefRow, static_cast<size_t>(MipProps.RowSize)) != 0)
+                        DataOK = false;
+                }
+                pContext->UnmapTextureSubresource(pStagingTex, Mip, Slice);
+                EXPECT_TRUE(DataOK) << "Slice " << Slice << ", mip " << Mip;
+            }
+        }
+    }
+}
+
+} // namespace
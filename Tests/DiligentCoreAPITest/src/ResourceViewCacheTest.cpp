@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ResourceViewCacheTest, TextureViews)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "View cache test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.MipLevels = 4;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.MiscFlags = MISC_TEXTURE_FLAG_CACHE_VIEWS;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    TextureViewDesc ViewDesc;
+    ViewDesc.Name            = "Mip 1 SRV";
+    ViewDesc.ViewType        = TEXTURE_VIEW_SHADER_RESOURCE;
+    ViewDesc.MostDetailedMip = 1;
+    ViewDesc.NumMipLevels    = 1;
+
+    RefCntAutoPtr<ITextureView> pView0;
+    pTexture->CreateView(ViewDesc, &pView0);
+    ASSERT_NE(pView0, nullptr);
+
+    // Same description with a different name must return the same view
+    ViewDesc.Name = "Mip 1 SRV - 2";
+    RefCntAutoPtr<ITextureView> pView1;
+    pTexture->CreateView(ViewDesc, &pView1);
+    EXPECT_EQ(pView0, pView1);
+
+    ViewDesc.MostDetailedMip = 2;
+    RefCntAutoPtr<ITextureView> pView2;
+    pTexture->CreateView(ViewDesc, &pView2);
+    ASSERT_NE(pView2, nullptr);
+    EXPECT_NE(pView0, pView2);
+    EXPECT_EQ(pView2->GetDesc().MostDetailedMip, 2u);
+
+    // The cache does not keep the views alive
+    pView0.Release();
+    pView1.Release();
+    ViewDesc.MostDetailedMip = 1;
+    pTexture->CreateView(ViewDesc, &pView0);
+    ASSERT_NE(pView0, nullptr);
+    EXPECT_EQ(pView0->GetDesc().MostDetailedMip, 1u);
+}
+
+TEST(ResourceViewCacheTest, BufferViews)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Structured buffers are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name              = "View cache test buffer";
+    BuffDesc.Size              = 1024;
+    BuffDesc.BindFlags         = BIND_SHADER_RESOURCE;
+    BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+    BuffDesc.ElementByteStride = 16;
+    BuffDesc.MiscFlags         = MISC_BUFFER_FLAG_CACHE_VIEWS;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BufferViewDesc ViewDesc;
+    ViewDesc.Name       = "Buffer SRV";
+    ViewDesc.ViewType   = BUFFER_VIEW_SHADER_RESOURCE;
+    ViewDesc.ByteOffset = 0;
+    ViewDesc.ByteWidth  = 256;
+
+    RefCntAutoPtr<IBufferView> pView0;
+    pBuffer->CreateView(ViewDesc, &pView0);
+    ASSERT_NE(pView0, nullptr);
+
+    RefCntAutoPtr<IBufferView> pView1;
+    pBuffer->CreateView(ViewDesc, &pView1);
+    EXPECT_EQ(pView0, pView1);
+
+    ViewDesc.ByteWidth = 512;
+    RefCntAutoPtr<IBufferView> pView2;
+    pBuffer->CreateView(ViewDesc, &pView2);
+    ASSERT_NE(pView2, nullptr);
+    EXPECT_NE(pView0, pView2);
+}
+
+} // namespace
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+
+#include "ShaderResourceBindingPool.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ShaderResourceBindingPoolTest, Recycle)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Mut", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", 2, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "SRB pool test";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "SRB pool test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 16;
+    TexDesc.Height    = 16;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+    auto* pSRV = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    ShaderResourceBindingPoolCreateInfo PoolCI;
+    PoolCI.pDevice     = pDevice;
+    PoolCI.pSignature  = pPRS;
+    PoolCI.InitialSize = 1;
+
+    ShaderResourceBindingPool Pool{PoolCI};
+    EXPECT_EQ(Pool.GetSize(), size_t{1});
+    EXPECT_EQ(Pool.GetNumFreeSRBs(), size_t{1});
+
+    constexpr size_t        NumSRBs = 3;
+    IShaderResourceBinding* pSRBs[NumSRBs]{};
+    for (auto& pSRB : pSRBs)
+    {
+        pSRB = Pool.Allocate();
+        ASSERT_NE(pSRB, nullptr);
+        auto* pVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex2D_Mut");
+        ASSERT_NE(pVar, nullptr);
+        pVar->Set(pSRV, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    }
+    EXPECT_EQ(Pool.GetSize(), NumSRBs);
+    EXPECT_EQ(Pool.GetNumFreeSRBs(), size_t{0});
+
+    Pool.FinishFrame(pContext);
+    pContext->WaitForIdle();
+
+    // SRBs of the completed frame must be reused
+    for (size_t i = 0; i < NumSRBs; ++i)
+    {
+        auto* pSRB = Pool.Allocate();
+        ASSERT_NE(pSRB, nullptr);
+        EXPECT_NE(std::find(std::begin(pSRBs), std::end(pSRBs), pSRB), std::end(pSRBs));
+        // Bindings are retained
+        EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "g_Tex2D_Mut")->Get(), pSRV);
+    }
+    EXPECT_EQ(Pool.GetSize(), NumSRBs);
+
+    Pool.FinishFrame(pContext);
+    pContext->WaitForIdle();
+
+    Pool.ReleaseResources();
+    EXPECT_EQ(Pool.GetNumFreeSRBs(), NumSRBs);
+    for (auto* pSRB : pSRBs)
+    {
+        EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex2D_Mut")->Get(), nullptr);
+    }
+
+    Pool.Shrink();
+    EXPECT_EQ(Pool.GetSize(), size_t{0});
+    EXPECT_EQ(Pool.GetNumFreeSRBs(), size_t{0});
+}
+
+} // namespace
@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+#include "ShadingRateImageGenerator.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Returns the rate that the generator selects on this device for the given rate, see ShadingRateImageGenerator::Generate()
+Uint8 RemapShadingRate(const ShadingRateProperties& SRProps, SHADING_RATE Rate)
+{
+    for (Uint32 i = 0; i < SRProps.NumShadingRates; ++i)
+    {
+        if (Rate >= SRProps.ShadingRates[i].Rate && SRProps.ShadingRates[i].HasSampleCount(1))
+            return SRProps.ShadingRates[i].Rate;
+    }
+    return SHADING_RATE_1X1;
+}
+
+TEST(ShadingRateImageGeneratorTest, Palette)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!ShadingRateImageGenerator::IsSupported(pDevice))
+    {
+        GTEST_SKIP() << "Shading rate image generator is not supported by this device";
+    }
+
+    const ShadingRateProperties& SRProps = pDevice->GetAdapterInfo().ShadingRate;
+    if (SRProps.Format != SHADING_RATE_FORMAT_PALETTE)
+    {
+        GTEST_SKIP() << "This test requires SHADING_RATE_FORMAT_PALETTE";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShadingRateImageGenerator Generator{pDevice};
+    const uint2               TileSize = Generator.GetTileSize();
+
+    // Three tiles: flat color, vertical stripes and a checkerboard
+    const Uint32       Width  = TileSize.x * 3;
+    const Uint32       Height = TileSize.y;
+    std::vector<Uint8> ColorData(Width * Height * 4);
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            Uint8 Value = 128;
+            if (x >= TileSize.x * 2)
+                Value = ((x + y) & 1) != 0 ? 255 : 0;
+            else if (x >= TileSize.x)
+                Value = (x & 1) != 0 ? 255 : 0;
+
+            Uint8* pTexel = &ColorData[(x + y * Width) * 4];
+            pTexel[0] = pTexel[1] = pTexel[2] = Value;
+            pTexel[3] = 255;
+        }
+    }
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "Shading rate image generator test color";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = Width;
+    TexDesc.Height    = Height;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.Usage     = USAGE_IMMUTABLE;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+
+    TextureSubResData SubresData{ColorData.data(), Width * 4};
+    TextureData       InitData{&SubresData, 1};
+
+    RefCntAutoPtr<ITexture> pColorTex;
+    pDevice->CreateTexture(TexDesc, &InitData, &pColorTex);
+    ASSERT_NE(pColorTex, nullptr);
+
+    ShadingRateImageGenerator::GenerateAttribs Attribs;
+    Attribs.pColorSRV = pColorTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    Attribs.MaxRate   = SHADING_RATE_2X2;
+    Generator.Generate(pContext, Attribs);
+
+    ITexture* pShadingRate = Generator.GetShadingRateTexture();
+    ASSERT_NE(pShadingRate, nullptr);
+    EXPECT_NE(Generator.GetShadingRateView(), nullptr);
+
+    const TextureDesc& RateDesc = pShadingRate->GetDesc();
+    EXPECT_EQ(RateDesc.Width, 3u);
+    EXPECT_EQ(RateDesc.Height, 1u);
+    EXPECT_EQ(RateDesc.Format, TEX_FORMAT_R8_UINT);
+
+    TexDesc.Name           = "Shading rate image generator test staging texture";
+    TexDesc.Width          = RateDesc.Width;
+    TexDesc.Height         = RateDesc.Height;
+    TexDesc.Format         = RateDesc.Format;
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    TexDesc.BindFlags      = BIND_NONE;
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTex);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    pContext->CopyTexture({pShadingRate, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION});
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    ASSERT_NE(MappedData.pData, nullptr);
+
+    const Uint8* pRates = static_cast<const Uint8*>(MappedData.pData);
+    // Flat tile is shaded at the coarsest allowed rate
+    EXPECT_EQ(pRates[0], RemapShadingRate(SRProps, SHADING_RATE_2X2));
+    // Vertical stripes only have horizontal contrast
+    EXPECT_EQ(pRates[1], RemapShadingRate(SRProps, SHADING_RATE_1X2));
+    // Checkerboard has contrast along both axes
+    EXPECT_EQ(pRates[2], SHADING_RATE_1X1);
+    pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+}
+
+} // namespace
@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SparseTextureResidencyManager.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::unique_ptr<SparseTextureResidencyManager> CreateResidencyManager(Uint64 MemoryBudget)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    if (pDevice->GetDeviceInfo().IsMetalDevice())
+        return {};
+
+    if (!pDevice->GetDeviceInfo().Features.SparseResources)
+        return {};
+
+    if ((pDevice->GetAdapterInfo().SparseResources.CapFlags & SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D) == 0)
+        return {};
+
+    SparseTextureResidencyManagerCreateInfo CI;
+    CI.Desc.Name      = "Sparse texture residency manager test";
+    CI.Desc.Type      = RESOURCE_DIM_TEX_2D;
+    CI.Desc.Usage     = USAGE_SPARSE;
+    CI.Desc.BindFlags = BIND_SHADER_RESOURCE;
+    CI.Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    CI.Desc.Width     = 2048;
+    CI.Desc.Height    = 2048;
+    CI.Desc.MipLevels = 0;
+
+    CI.NumTilesInMemoryPage = 4;
+    CI.MemoryBudget         = MemoryBudget;
+    CI.MinEvictionAge       = 1;
+
+    return std::make_unique<SparseTextureResidencyManager>(pDevice, CI);
+}
+
+TEST(SparseTextureResidencyManager, RequestTiles)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    auto pMgr = CreateResidencyManager(0);
+    if (!pMgr)
+        GTEST_SKIP() << "Sparse 2D textures are not supported by this device";
+
+    ASSERT_GT(pMgr->GetNumTiles(), 8u);
+    for (Uint32 i = 0; i < pMgr->GetNumTiles(); ++i)
+        EXPECT_EQ(pMgr->GetTileIndex(pMgr->GetTile(i)), i);
+
+    SparseTextureTile Tile;
+    pMgr->RequestTile(Tile);
+    EXPECT_FALSE(pMgr->IsTileResident(Tile));
+    EXPECT_EQ(pMgr->GetStats().NumPendingTiles, 1u);
+
+    pMgr->Commit(pContext);
+    EXPECT_TRUE(pMgr->IsTileResident(Tile));
+    ASSERT_EQ(pMgr->GetBoundTiles().size(), 1u);
+    EXPECT_EQ(pMgr->GetBoundTiles()[0], pMgr->GetTileIndex(Tile));
+
+    std::vector<Uint32> Feedback(pMgr->GetNumTiles());
+    for (Uint32 i = 0; i < 8; ++i)
+        Feedback[i] = 1;
+    pMgr->ProcessFeedback(Feedback.data(), static_cast<Uint32>(Feedback.size()));
+    pMgr->Commit(pContext);
+
+    // Tile 0 is already resident
+    EXPECT_EQ(pMgr->GetBoundTiles().size(), 7u);
+
+    const auto Stats = pMgr->GetStats();
+    EXPECT_EQ(Stats.NumResidentTiles, 8u);
+    EXPECT_EQ(Stats.NumPendingTiles, 0u);
+    EXPECT_EQ(Stats.NumBoundTiles, 8u);
+    EXPECT_EQ(Stats.NumEvictedTiles, 0u);
+    EXPECT_EQ(Stats.NumBindCommands, 2u);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+TEST(SparseTextureResidencyManager, Eviction)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    auto pMgr = CreateResidencyManager(0);
+    if (!pMgr)
+        GTEST_SKIP() << "Sparse 2D textures are not supported by this device";
+
+    // Allow two more pages of tiles
+    pMgr->Commit(pContext);
+    pMgr->SetMemoryBudget(pMgr->GetStats().CommittedMemorySize + 2 * 4 * pMgr->GetTexture()->GetSparseProperties().BlockSize);
+
+    const auto NumTilesInMip0 = pMgr->GetNumTilesInMipLevel(0);
+    ASSERT_GE(NumTilesInMip0.x * NumTilesInMip0.y, 128u);
+
+    for (Uint32 i = 0; i < 64; ++i)
+        pMgr->RequestTile(i);
+    pMgr->Commit(pContext);
+
+    const Uint32 NumSlots = pMgr->GetStats().NumResidentTiles;
+    ASSERT_GT(NumSlots, 0u);
+    ASSERT_LT(NumSlots, 64u);
+    EXPECT_EQ(pMgr->GetStats().NumPendingTiles, 64u - NumSlots);
+
+    // Requesting new tiles evicts the least recently used ones.
+    // Requests that were not repeated are dropped.
+    for (Uint32 i = 64; i < 64 + NumSlots; ++i)
+        pMgr->RequestTile(i);
+    pMgr->Commit(pContext);
+
+    const auto Stats = pMgr->GetStats();
+    EXPECT_EQ(Stats.NumResidentTiles, NumSlots);
+    EXPECT_EQ(Stats.NumEvictedTiles, NumSlots);
+    EXPECT_EQ(Stats.NumPendingTiles, 0u);
+    for (Uint32 i = 0; i < NumSlots; ++i)
+    {
+        EXPECT_FALSE(pMgr->IsTileResident(pMgr->GetTile(i)));
+        EXPECT_TRUE(pMgr->IsTileResident(pMgr->GetTile(64 + i)));
+    }
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+} // namespace
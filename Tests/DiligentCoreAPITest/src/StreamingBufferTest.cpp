@@ -101,4 +101,99 @@ TEST(StreamingBufferTest, MapUnmap)
     StreamBuff.Reset();
 }
 
+StreamingBufferCreateInfo GetTestStreamingBufferCI(IRenderDevice* pDevice, bool AllowPersistentMapping)
+{
+    StreamingBufferCreateInfo CI;
+    CI.pDevice = pDevice;
+
+    CI.BuffDesc.Name           = "Test streaming buffer";
+    CI.BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+    CI.BuffDesc.Usage          = USAGE_DYNAMIC;
+    CI.BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    CI.BuffDesc.Size           = 1024;
+    CI.AllowPersistentMapping  = AllowPersistentMapping;
+    return CI;
+}
+
+TEST(StreamingBufferTest, PersistentMapping)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    StreamingBuffer StreamBuff{GetTestStreamingBufferCI(pDevice, true)};
+    ASSERT_TRUE(StreamBuff.GetBuffer() != nullptr);
+
+    for (Uint32 frame = 0; frame < 3; ++frame)
+    {
+        auto Offset = StreamBuff.Map(pContext, pDevice, 256);
+        EXPECT_EQ(Offset, Uint32{0});
+        StreamBuff.Unmap();
+        // The buffer stays mapped in persistent mode
+        EXPECT_EQ(StreamBuff.GetMappedCPUAddress() != nullptr, StreamBuff.IsPersistentlyMapped());
+
+        Offset = StreamBuff.Map(pContext, pDevice, 512);
+        EXPECT_EQ(Offset, Uint32{256});
+        StreamBuff.Unmap();
+
+        StreamBuff.Reset();
+        EXPECT_EQ(StreamBuff.GetMappedCPUAddress(), nullptr);
+    }
+}
+
+TEST(StreamingBufferTest, Stats)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    StreamingBuffer StreamBuff{GetTestStreamingBufferCI(pDevice, false)};
+    ASSERT_TRUE(StreamBuff.GetBuffer() != nullptr);
+
+    auto Allocate = [&](Uint32 Size) {
+        StreamBuff.Map(pContext, pDevice, Size);
+        StreamBuff.Unmap();
+    };
+
+    Allocate(512);
+    Allocate(256);
+    {
+        const auto Stats = StreamBuff.GetStats();
+        EXPECT_EQ(Stats.CurrFrameSize, Uint64{768});
+        EXPECT_EQ(Stats.LastFrameSize, Uint64{0});
+        EXPECT_EQ(Stats.PeakFrameSize, Uint64{0});
+        EXPECT_EQ(Stats.NumResizes, Uint32{0});
+        EXPECT_EQ(Stats.NumOverflows, Uint32{0});
+    }
+
+    // Does not fit into the remaining space
+    Allocate(512);
+    StreamBuff.Reset();
+    {
+        const auto Stats = StreamBuff.GetStats();
+        EXPECT_EQ(Stats.CurrFrameSize, Uint64{0});
+        EXPECT_EQ(Stats.LastFrameSize, Uint64{1280});
+        EXPECT_EQ(Stats.PeakFrameSize, Uint64{1280});
+        EXPECT_EQ(Stats.NumResizes, Uint32{0});
+        EXPECT_EQ(Stats.NumOverflows, Uint32{1});
+    }
+
+    // Does not fit into the buffer
+    Allocate(2048);
+    StreamBuff.Reset();
+    Allocate(128);
+    StreamBuff.Reset();
+    {
+        const auto Stats = StreamBuff.GetStats();
+        EXPECT_EQ(Stats.LastFrameSize, Uint64{128});
+        EXPECT_EQ(Stats.PeakFrameSize, Uint64{2048});
+        EXPECT_EQ(Stats.NumResizes, Uint32{1});
+        EXPECT_EQ(Stats.NumOverflows, Uint32{1});
+    }
+}
+
 } // namespace
@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#include "TextureFeedbackManager.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+const char* FeedbackTestCS = R"(
+#include "TextureFeedback.fxh"
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    TextureFeedback_Write(FEEDBACK_ID_A, uint2(1u, 1u), float2(0.5, 0.5), 3.0);
+    TextureFeedback_Write(FEEDBACK_ID_A, uint2(1u, 1u), float2(0.2, 0.7), 1.0);
+    TextureFeedback_Write(FEEDBACK_ID_B, uint2(2u, 2u), float2(0.75, 0.25), 2.5);
+}
+)";
+
+TEST(TextureFeedbackManagerTest, Resolve)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    TextureFeedbackManagerCreateInfo CI;
+    CI.Name        = "Texture feedback test buffer";
+    CI.NumElements = 64;
+    TextureFeedbackManager FeedbackMgr{pDevice, CI};
+
+    std::vector<Uint32> FeedbackA, FeedbackB;
+
+    const Uint32 IdA = FeedbackMgr.RegisterTexture(1, 1, [&](const Uint32* pMinMips, Uint32 GridWidth, Uint32 GridHeight) {
+        FeedbackA.assign(pMinMips, pMinMips + GridWidth * GridHeight);
+    });
+    const Uint32 IdB = FeedbackMgr.RegisterTexture(2, 2, [&](const Uint32* pMinMips, Uint32 GridWidth, Uint32 GridHeight) {
+        FeedbackB.assign(pMinMips, pMinMips + GridWidth * GridHeight);
+    });
+    ASSERT_NE(IdA, TextureFeedbackManager::InvalidFeedbackId);
+    ASSERT_NE(IdB, TextureFeedbackManager::InvalidFeedbackId);
+    EXPECT_EQ(FeedbackMgr.GetNumUsedElements(), 5u);
+
+    // The buffer is full
+    EXPECT_EQ(FeedbackMgr.RegisterTexture(8, 8, [](const Uint32*, Uint32, Uint32) {}), TextureFeedbackManager::InvalidFeedbackId);
+
+    auto pShaderSourceFactory = CreateMemoryShaderSourceFactory({
+        {"FeedbackTest.csh", FeedbackTestCS},
+        {TextureFeedbackManager::GetShaderIncludeName(), TextureFeedbackManager::GetShaderIncludeSource()},
+    });
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("FEEDBACK_ID_A", IdA);
+    Macros.AddShaderMacro("FEEDBACK_ID_B", IdB);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc                       = {"Texture feedback test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler             = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.FilePath                   = "FeedbackTest.csh";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+    ShaderCI.Macros                     = Macros;
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name         = "Texture feedback test PSO";
+    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.pCS                  = pCS;
+
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_TextureFeedback")->Set(FeedbackMgr.GetBufferUAV());
+
+    RefCntAutoPtr<IReadbackQueue> pQueue;
+    CreateReadbackQueue(pDevice, ReadbackQueueCreateInfo{}, &pQueue);
+    ASSERT_NE(pQueue, nullptr);
+
+    FeedbackMgr.Clear(pContext);
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+    FeedbackMgr.Resolve(pContext, pQueue);
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+    for (Uint32 i = 0; i < 100 && pQueue->GetNumPendingReads() > 0; ++i)
+    {
+        pQueue->ProcessCompleted(pContext);
+        if (pQueue->GetNumPendingReads() > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(FeedbackMgr.GetNumResolvedReads(), 1u);
+
+    ASSERT_EQ(FeedbackA.size(), 1u);
+    EXPECT_EQ(FeedbackA[0], 1u);
+
+    constexpr Uint32 NR = TextureFeedbackManager::NotRequested;
+    ASSERT_EQ(FeedbackB.size(), 4u);
+    EXPECT_EQ(FeedbackB[0], NR);
+    EXPECT_EQ(FeedbackB[1], 2u);
+    EXPECT_EQ(FeedbackB[2], NR);
+    EXPECT_EQ(FeedbackB[3], NR);
+
+    FeedbackMgr.UnregisterTexture(IdA);
+    FeedbackMgr.UnregisterTexture(IdB);
+    EXPECT_EQ(FeedbackMgr.GetNumUsedElements(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TransientTextureAllocator.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(TransientTextureAllocatorTest, Compile)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    for (bool EnableAliasing : {false, true})
+    {
+        TransientTextureAllocatorCreateInfo CI;
+        CI.Name             = "Transient texture allocator test";
+        CI.EnableAliasing   = EnableAliasing;
+        CI.EnableMemoryless = false;
+        TransientTextureAllocator Allocator{pDevice, CI};
+
+        TextureDesc Desc;
+        Desc.Name      = "Transient texture";
+        Desc.Type      = RESOURCE_DIM_TEX_2D;
+        Desc.Width     = 512;
+        Desc.Height    = 512;
+        Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        Desc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE;
+        Desc.MipLevels = 1;
+
+        for (Uint32 Frame = 0; Frame < 2; ++Frame)
+        {
+            Allocator.Reset();
+            const auto Tex0 = Allocator.DeclareTexture(Desc, 0, 1);
+            const auto Tex1 = Allocator.DeclareTexture(Desc, 1, 2);
+            const auto Tex2 = Allocator.DeclareTexture(Desc, 2, 3);
+            Allocator.Compile(pDevice, pContext);
+
+            ITexture* pTex0 = Allocator.GetTexture(Tex0);
+            ITexture* pTex1 = Allocator.GetTexture(Tex1);
+            ITexture* pTex2 = Allocator.GetTexture(Tex2);
+            ASSERT_NE(pTex0, nullptr);
+            ASSERT_NE(pTex1, nullptr);
+            ASSERT_NE(pTex2, nullptr);
+            EXPECT_NE(pTex0, pTex1);
+            EXPECT_NE(pTex1, pTex2);
+
+            const auto Stats = Allocator.GetStats();
+            EXPECT_EQ(Stats.NumTextures, 3u);
+            // Identical declarations do not rebuild the layout
+            EXPECT_EQ(Stats.NumCompiles, 1u);
+            if (Stats.NumAliasedTextures == 3)
+            {
+                // Textures 0 and 2 share memory
+                EXPECT_LT(Stats.HeapSize, Stats.AliasedTexturesSize);
+                EXPECT_EQ(Stats.NumPooledTextureObjects, 0u);
+            }
+            else
+            {
+                EXPECT_FALSE(EnableAliasing && Stats.NumAliasedTextures != 0);
+                // Textures 0 and 2 share the texture object
+                EXPECT_EQ(pTex0, pTex2);
+                EXPECT_EQ(Stats.NumPooledTextureObjects, 2u);
+            }
+
+            for (Uint32 Pass = 0; Pass < 4; ++Pass)
+                Allocator.BeginPass(pContext, Pass);
+        }
+    }
+
+    pContext->Flush();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -183,4 +183,53 @@ TEST(VertexPoolTest, Allocate)
     }
 }
 
+TEST(VertexPoolTest, Defragment)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto* const pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{8},
+        };
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Vertex pool defragment test";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 1024;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+
+    RefCntAutoPtr<IVertexPoolAllocation> pAlloc0;
+    pVtxPool->Allocate(256, &pAlloc0);
+    ASSERT_NE(pAlloc0, nullptr);
+
+    RefCntAutoPtr<IVertexPoolAllocation> pAlloc1;
+    pVtxPool->Allocate(128, &pAlloc1);
+    ASSERT_NE(pAlloc1, nullptr);
+    EXPECT_EQ(pAlloc1->GetStartVertex(), 256u);
+
+    pVtxPool->UpdateAll(pDevice, pContext);
+    pAlloc0.Release();
+
+    Uint32 NumMoved = 0;
+    auto   Moved    = pVtxPool->Defragment(pDevice, pContext, ~Uint64{0},
+                                      [&](IVertexPoolAllocation* pAllocation, Uint32 OldStartVertex) {
+                                          EXPECT_EQ(pAllocation, pAlloc1.RawPtr());
+                                          EXPECT_EQ(OldStartVertex, 256u);
+                                          ++NumMoved;
+                                      });
+    EXPECT_EQ(Moved, 128u * (16u + 8u));
+    EXPECT_EQ(NumMoved, 1u);
+    EXPECT_LT(pAlloc1->GetStartVertex(), 256u);
+
+    EXPECT_EQ(pVtxPool->Defragment(pDevice, pContext, ~Uint64{0}), 0u);
+}
+
 } // namespace
@@ -83,5 +83,7 @@ int TestShaderResourceBindingCInterface(struct IShaderResourceBinding* pSRB)
 void TestShaderResourceBindingC_API(struct IShaderResourceBinding* pSRB)
 {
     struct IResourceMapping* pResMapping = NULL;
+    ShaderVariableUpdate     Update      = {SHADER_TYPE_VERTEX, "g_tex2D_Mut", 0, 0, 1, NULL, SET_SHADER_RESOURCE_FLAG_NONE};
     IShaderResourceBinding_BindResources(pSRB, SHADER_TYPE_VERTEX, pResMapping, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED);
+    IShaderResourceBinding_SetVariables(pSRB, &Update, 0);
 }
@@ -41,6 +41,7 @@ int TestShaderCInterface(struct IShader* pShader)
     ShaderDesc         ShaderDesc;
     Uint32             ResourceCount = 0;
     ShaderResourceDesc ResourceDesc;
+    Float64            CompileTime = 0;
 
     int num_errors =
         TestObjectCInterface((struct IObject*)pShader) +
@@ -81,5 +82,9 @@ int TestShaderCInterface(struct IShader* pShader)
     if (ResourceDesc.ArraySize == 0)
         ++num_errors;
 
+    CompileTime = IShader_GetCompileTime(pShader);
+    if (CompileTime < 0)
+        ++num_errors;
+
     return num_errors;
 }
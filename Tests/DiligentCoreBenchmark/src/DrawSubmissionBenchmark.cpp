@@ -0,0 +1,297 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <iostream>
+#include <string>
+
+#include "GPUTestingEnvironment.hpp"
+#include "GraphicsAccessories.hpp"
+#include "BasicMath.hpp"
+#include "MapHelper.hpp"
+#include "Timer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Every scenario records NumWarmupOps operations first and then times NumTimedOps operations.
+// Only the CPU time spent recording the commands is measured: the triangle is degenerate, so
+// the GPU has virtually no work to do.
+constexpr Uint32 NumWarmupOps = 1000;
+constexpr Uint32 NumTimedOps  = 10000;
+
+const char* VSSource = R"(
+void main(out float4 Pos : SV_Position)
+{
+    Pos = float4(0.0, 0.0, 0.0, 1.0);
+}
+)";
+
+const char* PSSource = R"(
+cbuffer Constants
+{
+    float4 g_Color;
+}
+
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return g_Color;
+}
+)";
+
+class DrawSubmissionBenchmark : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        auto* pEnv       = GPUTestingEnvironment::GetInstance();
+        auto* pDevice    = pEnv->GetDevice();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+        RefCntAutoPtr<IShader> pVS;
+        {
+            ShaderCI.Desc       = {"Draw submission benchmark VS", SHADER_TYPE_VERTEX, true};
+            ShaderCI.EntryPoint = "main";
+            ShaderCI.Source     = VSSource;
+            pDevice->CreateShader(ShaderCI, &pVS);
+            ASSERT_NE(pVS, nullptr);
+        }
+
+        RefCntAutoPtr<IShader> pPS;
+        {
+            ShaderCI.Desc       = {"Draw submission benchmark PS", SHADER_TYPE_PIXEL, true};
+            ShaderCI.EntryPoint = "main";
+            ShaderCI.Source     = PSSource;
+            pDevice->CreateShader(ShaderCI, &pPS);
+            ASSERT_NE(pPS, nullptr);
+        }
+
+        // All pipelines share one explicit signature so that a single SRB stays compatible
+        // when the pipeline is switched.
+        {
+            const PipelineResourceDesc Resources[] = {
+                {SHADER_TYPE_PIXEL, "Constants", SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            };
+
+            PipelineResourceSignatureDesc PRSDesc;
+            PRSDesc.Name         = "Draw submission benchmark signature";
+            PRSDesc.Resources    = Resources;
+            PRSDesc.NumResources = _countof(Resources);
+            pDevice->CreatePipelineResourceSignature(PRSDesc, &sm_pSignature);
+            ASSERT_NE(sm_pSignature, nullptr);
+        }
+
+        for (size_t i = 0; i < _countof(sm_pPSOs); ++i)
+        {
+            GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+            auto& PSODesc          = PSOCreateInfo.PSODesc;
+            auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+            PSODesc.Name = i == 0 ? "Draw submission benchmark PSO 0" : "Draw submission benchmark PSO 1";
+
+            IPipelineResourceSignature* ppSignatures[] = {sm_pSignature};
+            PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+            PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+            GraphicsPipeline.NumRenderTargets                       = 1;
+            GraphicsPipeline.RTVFormats[0]                          = pSwapChain->GetDesc().ColorBufferFormat;
+            GraphicsPipeline.PrimitiveTopology                      = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            GraphicsPipeline.RasterizerDesc.CullMode                = i == 0 ? CULL_MODE_NONE : CULL_MODE_BACK;
+            GraphicsPipeline.DepthStencilDesc.DepthEnable           = False;
+            GraphicsPipeline.BlendDesc.RenderTargets[0].BlendEnable = i != 0;
+
+            PSOCreateInfo.pVS = pVS;
+            PSOCreateInfo.pPS = pPS;
+            pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &sm_pPSOs[i]);
+            ASSERT_NE(sm_pPSOs[i], nullptr);
+        }
+
+        const float4 Color{0, 0, 0, 1};
+        for (size_t i = 0; i < _countof(sm_pSRBs); ++i)
+        {
+            // The last SRB references a dynamic buffer that is used by the MapDiscard scenario
+            const bool IsDynamic = i == _countof(sm_pSRBs) - 1;
+
+            BufferDesc BuffDesc;
+            BuffDesc.Name           = "Draw submission benchmark constants";
+            BuffDesc.Size           = sizeof(float4);
+            BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+            BuffDesc.Usage          = IsDynamic ? USAGE_DYNAMIC : USAGE_DEFAULT;
+            BuffDesc.CPUAccessFlags = IsDynamic ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+
+            BufferData InitData{&Color, sizeof(Color)};
+            pDevice->CreateBuffer(BuffDesc, IsDynamic ? nullptr : &InitData, &sm_pConstants[i]);
+            ASSERT_NE(sm_pConstants[i], nullptr);
+
+            sm_pSignature->CreateShaderResourceBinding(&sm_pSRBs[i], true);
+            ASSERT_NE(sm_pSRBs[i], nullptr);
+
+            auto* pVar = sm_pSRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "Constants");
+            ASSERT_NE(pVar, nullptr);
+            pVar->Set(sm_pConstants[i]);
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        for (auto& pSRB : sm_pSRBs)
+            pSRB.Release();
+        for (auto& pBuff : sm_pConstants)
+            pBuff.Release();
+        for (auto& pPSO : sm_pPSOs)
+            pPSO.Release();
+        sm_pSignature.Release();
+
+        auto* pEnv = GPUTestingEnvironment::GetInstance();
+        pEnv->Reset();
+    }
+
+    static IBuffer* GetDynamicBuffer()
+    {
+        return sm_pConstants[_countof(sm_pConstants) - 1];
+    }
+
+    static IShaderResourceBinding* GetDynamicSRB()
+    {
+        return sm_pSRBs[_countof(sm_pSRBs) - 1];
+    }
+
+    // Binds the render target, the first pipeline and the SRB, and then times NumTimedOps calls of Op.
+    // The result is printed to stdout and recorded as a test property so that it appears in
+    // the XML/JSON report produced with --gtest_output.
+    template <typename OpType>
+    static void Run(IShaderResourceBinding* pSRB, OpType&& Op)
+    {
+        ASSERT_NE(pSRB, nullptr);
+        ASSERT_NE(sm_pPSOs[0], nullptr);
+        ASSERT_NE(sm_pPSOs[1], nullptr);
+
+        auto* pEnv       = GPUTestingEnvironment::GetInstance();
+        auto* pContext   = pEnv->GetDeviceContext();
+        auto* pSwapChain = pEnv->GetSwapChain();
+
+        ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+        pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+        // Transition all resources once so that the timed loop can use the verify mode
+        for (auto& pResSRB : sm_pSRBs)
+            pContext->TransitionShaderResources(pResSRB);
+        {
+            // Dynamic buffers must be mapped in the frame before they are used
+            MapHelper<float4> Data{pContext, GetDynamicBuffer(), MAP_WRITE, MAP_FLAG_DISCARD};
+            *Data = float4{0, 0, 0, 1};
+        }
+
+        pContext->SetPipelineState(sm_pPSOs[0]);
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+        for (Uint32 i = 0; i < NumWarmupOps; ++i)
+            Op(pContext, i);
+        pContext->Flush();
+        pContext->WaitForIdle();
+
+        Timer  T;
+        Uint32 i = 0;
+        for (; i < NumTimedOps; ++i)
+            Op(pContext, i);
+        const double ElapsedTime = T.GetElapsedTime();
+
+        pSwapChain->Present();
+        pContext->Flush();
+        pContext->InvalidateState();
+
+        const auto* TestInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        const auto  NsPerOp  = static_cast<Uint64>(ElapsedTime * 1e9 / i);
+        const auto  Backend  = GetRenderDeviceTypeShortString(pEnv->GetDevice()->GetDeviceInfo().Type);
+
+        RecordProperty("backend", Backend);
+        RecordProperty("ops", std::to_string(i));
+        RecordProperty("ns_per_op", std::to_string(NsPerOp));
+
+        std::cout << "[ BENCH    ] " << Backend << ' ' << TestInfo->name() << ": " << NsPerOp << " ns/op (" << i << " ops)" << std::endl;
+    }
+
+    static RefCntAutoPtr<IPipelineResourceSignature> sm_pSignature;
+    static RefCntAutoPtr<IPipelineState>             sm_pPSOs[2];
+    static RefCntAutoPtr<IBuffer>                    sm_pConstants[3];
+    static RefCntAutoPtr<IShaderResourceBinding>     sm_pSRBs[3];
+};
+
+RefCntAutoPtr<IPipelineResourceSignature> DrawSubmissionBenchmark::sm_pSignature;
+RefCntAutoPtr<IPipelineState>             DrawSubmissionBenchmark::sm_pPSOs[2];
+RefCntAutoPtr<IBuffer>                    DrawSubmissionBenchmark::sm_pConstants[3];
+RefCntAutoPtr<IShaderResourceBinding>     DrawSubmissionBenchmark::sm_pSRBs[3];
+
+constexpr DrawAttribs BenchmarkDrawAttribs{3, DRAW_FLAG_VERIFY_ALL};
+
+// Back-to-back draws with no state changes
+TEST_F(DrawSubmissionBenchmark, Draw)
+{
+    Run(sm_pSRBs[0], [](IDeviceContext* pContext, Uint32) {
+        pContext->Draw(BenchmarkDrawAttribs);
+    });
+}
+
+// Alternates between two SRBs before every draw
+TEST_F(DrawSubmissionBenchmark, CommitSRB)
+{
+    Run(sm_pSRBs[0], [](IDeviceContext* pContext, Uint32 i) {
+        pContext->CommitShaderResources(sm_pSRBs[i & 0x01], RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+        pContext->Draw(BenchmarkDrawAttribs);
+    });
+}
+
+// Alternates between two pipelines that share the resource signature before every draw
+TEST_F(DrawSubmissionBenchmark, SwitchPSO)
+{
+    Run(sm_pSRBs[0], [](IDeviceContext* pContext, Uint32 i) {
+        pContext->SetPipelineState(sm_pPSOs[i & 0x01]);
+        pContext->Draw(BenchmarkDrawAttribs);
+    });
+}
+
+// Updates a dynamic constant buffer with MAP_FLAG_DISCARD before every draw
+TEST_F(DrawSubmissionBenchmark, MapDiscard)
+{
+    Run(GetDynamicSRB(), [](IDeviceContext* pContext, Uint32 i) {
+        {
+            MapHelper<float4> Data{pContext, GetDynamicBuffer(), MAP_WRITE, MAP_FLAG_DISCARD};
+            *Data = float4{static_cast<float>(i & 0xFF) / 255.f, 0, 0, 1};
+        }
+        pContext->Draw(BenchmarkDrawAttribs);
+    });
+}
+
+} // namespace
@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+#include <deque>
+
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+#include "RingBuffer.hpp"
+#include "FastRand.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Every thread allocates a batch of blocks and then releases them.
+// Measures the allocator throughput with and without thread caches under contention.
+TEST(FixedBlockMemoryAllocatorBench, AllocateFree)
+{
+    constexpr Uint64 NumOpsPerThread = 500000;
+    constexpr size_t BatchSize       = 16;
+
+    for (Uint32 ThreadCacheSize : {0u, 64u})
+    {
+        const char* Scenario = ThreadCacheSize == 0 ? "NoThreadCache" : "ThreadCache";
+        for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+        {
+            FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 64, 1024, ThreadCacheSize};
+            RunBenchmark(Scenario, NumThreads, NumOpsPerThread,
+                         [&Allocator](Uint32, Uint64 NumOps) {
+                             std::array<void*, BatchSize> Blocks{};
+                             for (Uint64 i = 0; i < NumOps; i += BatchSize)
+                             {
+                                 for (auto& pBlock : Blocks)
+                                     pBlock = Allocator.Allocate(64, "Benchmark block", __FILE__, __LINE__);
+                                 for (auto* pBlock : Blocks)
+                                     Allocator.Free(pBlock);
+                             }
+                         });
+        }
+    }
+}
+
+// Keeps a fixed number of live allocations of random sizes, releasing the oldest one
+// for every new allocation. This fragments the free block lists similar to a real heap.
+TEST(VariableSizeAllocationsManagerBench, AllocateFree)
+{
+    constexpr Uint64 NumOps        = 500000;
+    constexpr size_t NumLiveAllocs = 1024;
+    constexpr size_t MaxSize       = size_t{64} << 20;
+
+    using AllocationType = VariableSizeAllocationsManager::Allocation;
+
+    VariableSizeAllocationsManager Mgr{MaxSize, DefaultRawMemoryAllocator::GetAllocator()};
+    FastRandInt                    Rnd{0, 16, 4096};
+
+    std::deque<AllocationType> LiveAllocs;
+
+    Timer T;
+    for (Uint64 i = 0; i < NumOps; ++i)
+    {
+        if (LiveAllocs.size() >= NumLiveAllocs)
+        {
+            Mgr.Free(std::move(LiveAllocs.front()));
+            LiveAllocs.pop_front();
+        }
+
+        auto Alloc = Mgr.Allocate(static_cast<size_t>(Rnd()), 16);
+        ASSERT_TRUE(Alloc.IsValid());
+        LiveAllocs.emplace_back(Alloc);
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+
+    for (auto& Alloc : LiveAllocs)
+        Mgr.Free(std::move(Alloc));
+    EXPECT_TRUE(Mgr.IsEmpty());
+
+    ReportBenchmarkResult("Fragmented", 1, NumOps, ElapsedTime);
+}
+
+// Allocates chunks of random sizes every frame and releases the frames that
+// are two frames old, which is how the upload ring buffers are used.
+TEST(RingBufferBench, AllocateFrames)
+{
+    constexpr Uint64 NumFrames         = 20000;
+    constexpr Uint32 NumAllocsPerFrame = 256;
+    constexpr size_t MaxSize           = size_t{16} << 20;
+
+    RingBuffer  RingBuff{MaxSize, DefaultRawMemoryAllocator::GetAllocator()};
+    FastRandInt Rnd{0, 16, 2048};
+
+    Timer T;
+    for (Uint64 Frame = 1; Frame <= NumFrames; ++Frame)
+    {
+        for (Uint32 i = 0; i < NumAllocsPerFrame; ++i)
+        {
+            const auto Offset = RingBuff.Allocate(static_cast<size_t>(Rnd()), 16);
+            ASSERT_NE(Offset, RingBuffer::InvalidOffset);
+            DoNotOptimize(Offset);
+        }
+        RingBuff.FinishCurrentFrame(Frame);
+        if (Frame > 2)
+            RingBuff.ReleaseCompletedFrames(Frame - 2);
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+
+    RingBuff.ReleaseCompletedFrames(NumFrames);
+    EXPECT_TRUE(RingBuff.IsEmpty());
+
+    ReportBenchmarkResult("Allocations", 1, NumFrames * NumAllocsPerFrame, ElapsedTime);
+}
+
+} // namespace
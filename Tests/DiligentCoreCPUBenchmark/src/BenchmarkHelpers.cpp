@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BenchmarkHelpers.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+#include "DebugUtilities.hpp"
+
+#include "gtest/gtest.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+std::vector<Uint32> GetBenchmarkThreadCounts()
+{
+    const Uint32 NumHardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    std::vector<Uint32> ThreadCounts;
+    for (Uint32 NumThreads = 1; NumThreads < NumHardwareThreads; NumThreads *= 2)
+        ThreadCounts.push_back(NumThreads);
+    ThreadCounts.push_back(NumHardwareThreads);
+    return ThreadCounts;
+}
+
+void ReportBenchmarkResult(const char* Scenario, Uint32 NumThreads, Uint64 NumOps, double ElapsedTime)
+{
+    const auto* TestInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    VERIFY_EXPR(TestInfo != nullptr);
+
+    const double NsPerOp    = NumOps > 0 ? ElapsedTime * 1e9 / static_cast<double>(NumOps) : 0.0;
+    const double MOpsPerSec = ElapsedTime > 0 ? static_cast<double>(NumOps) / ElapsedTime * 1e-6 : 0.0;
+
+    const std::string Key = std::string{Scenario} + "_t" + std::to_string(NumThreads);
+    ::testing::Test::RecordProperty(Key + "_ns_per_op", std::to_string(NsPerOp));
+    ::testing::Test::RecordProperty(Key + "_mops_per_sec", std::to_string(MOpsPerSec));
+
+    std::cout << "[ BENCH    ] " << TestInfo->test_suite_name() << '.' << TestInfo->name() << ' ' << Scenario
+              << " (" << NumThreads << (NumThreads == 1 ? " thread): " : " threads): ")
+              << NsPerOp << " ns/op, " << MOpsPerSec << " Mops/s (" << NumOps << " ops)" << std::endl;
+}
+
+void DoNotOptimize(Uint64 Value)
+{
+    static std::atomic<Uint64> Sink{0};
+    Sink.fetch_xor(Value, std::memory_order_relaxed);
+}
+
+} // namespace Testing
+
+} // namespace Diligent
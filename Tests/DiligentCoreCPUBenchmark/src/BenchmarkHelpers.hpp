@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Returns the thread counts that the contention scenarios are run with:
+/// powers of two up to the number of hardware threads, and the number of hardware threads itself.
+std::vector<Uint32> GetBenchmarkThreadCounts();
+
+/// Prints the benchmark result to stdout and records it as a test property, so that it appears
+/// in the XML/JSON report produced with --gtest_output.
+void ReportBenchmarkResult(const char* Scenario, Uint32 NumThreads, Uint64 NumOps, double ElapsedTime);
+
+/// Keeps the value alive so that the compiler does not optimize away the computation that produced it.
+void DoNotOptimize(Uint64 Value);
+
+/// Runs Body(ThreadId, NumOpsPerThread) on NumThreads threads that start at the same time,
+/// and reports the total throughput.
+template <typename BodyType>
+void RunBenchmark(const char* Scenario, Uint32 NumThreads, Uint64 NumOpsPerThread, BodyType&& Body)
+{
+    std::atomic<Uint32> NumReadyThreads{0};
+    std::atomic<bool>   Start{false};
+
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&, t]() {
+                NumReadyThreads.fetch_add(1);
+                while (!Start.load())
+                    std::this_thread::yield();
+                Body(t, NumOpsPerThread);
+            });
+    }
+
+    while (NumReadyThreads.load() < NumThreads)
+        std::this_thread::yield();
+
+    Timer T;
+    Start.store(true);
+    for (auto& Thread : Threads)
+        Thread.join();
+    const double ElapsedTime = T.GetElapsedTime();
+
+    ReportBenchmarkResult(Scenario, NumThreads, NumOpsPerThread * NumThreads, ElapsedTime);
+}
+
+} // namespace Testing
+
+} // namespace Diligent
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <vector>
+
+#include "ColorConversion.h"
+#include "FastRand.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr size_t NumTexels = 1920 * 1080;
+constexpr Uint32 NumRuns   = 8;
+
+class ColorConversionBench : public ::testing::Test
+{
+protected:
+    ColorConversionBench() :
+        RGBA8(NumTexels * 4),
+        RGBA32F(NumTexels * 4),
+        RGBA16F(NumTexels * 4),
+        RGBA8Out(NumTexels * 4)
+    {
+        FastRandInt Rnd{0, 0, 255};
+        for (auto& c : RGBA8)
+            c = static_cast<Uint8>(Rnd());
+        SRGBA8ToLinearRGBA32F(RGBA8.data(), RGBA32F.data(), NumTexels);
+        RGBA8ToRGBA16F(RGBA8.data(), RGBA16F.data(), NumTexels);
+    }
+
+    // Reports the best time of several runs; one operation is one texel
+    template <typename FuncType>
+    void Run(const char* Scenario, FuncType&& Func)
+    {
+        double Time = 1e+10;
+        for (Uint32 run = 0; run < NumRuns; ++run)
+        {
+            Timer T;
+            Func();
+            Time = std::min(Time, T.GetElapsedTime());
+        }
+        ReportBenchmarkResult(Scenario, 1, NumTexels, Time);
+    }
+
+    std::vector<Uint8>  RGBA8;
+    std::vector<float>  RGBA32F;
+    std::vector<Uint16> RGBA16F;
+    std::vector<Uint8>  RGBA8Out;
+};
+
+TEST_F(ColorConversionBench, SRGBToLinear)
+{
+    Run("SRGBA8ToLinearRGBA32F", [&]() { SRGBA8ToLinearRGBA32F(RGBA8.data(), RGBA32F.data(), NumTexels); });
+    Run("LinearRGBA32FToSRGBA8", [&]() { LinearRGBA32FToSRGBA8(RGBA32F.data(), RGBA8Out.data(), NumTexels); });
+    DoNotOptimize(RGBA8Out[NumTexels / 2]);
+}
+
+TEST_F(ColorConversionBench, HalfFloat)
+{
+    Run("RGBA8ToRGBA16F", [&]() { RGBA8ToRGBA16F(RGBA8.data(), RGBA16F.data(), NumTexels); });
+    Run("RGBA16FToRGBA8", [&]() { RGBA16FToRGBA8(RGBA16F.data(), RGBA8Out.data(), NumTexels); });
+    DoNotOptimize(RGBA8Out[NumTexels / 2]);
+}
+
+TEST_F(ColorConversionBench, PremultiplyAlpha)
+{
+    Run("PremultiplyAlphaRGBA8", [&]() { PremultiplyAlphaRGBA8(RGBA8Out.data(), NumTexels); });
+    Run("PremultiplyAlphaRGBA32F", [&]() { PremultiplyAlphaRGBA32F(RGBA32F.data(), NumTexels); });
+    DoNotOptimize(RGBA8Out[NumTexels / 2] + static_cast<Uint64>(RGBA32F[NumTexels / 2]));
+}
+
+} // namespace
@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "DynamicAtlasManager.hpp"
+#include "FastRand.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Allocates glyph-like regions and releases the oldest ones when the atlas gets full
+// or the number of live regions reaches the limit, similar to a font glyph cache.
+void RunAtlasBenchmark(DynamicAtlasManager::PackingStrategy Strategy)
+{
+    constexpr Uint64 NumOps         = 200000;
+    constexpr size_t NumLiveRegions = 4096;
+
+    DynamicAtlasManager Mgr{2048, 2048, Strategy};
+    FastRandInt         WidthRnd{0, 8, 48};
+    FastRandInt         HeightRnd{1, 16, 32};
+
+    std::deque<DynamicAtlasManager::Region> LiveRegions;
+
+    Timer T;
+    for (Uint64 i = 0; i < NumOps; ++i)
+    {
+        const Uint32 Width  = static_cast<Uint32>(WidthRnd());
+        const Uint32 Height = static_cast<Uint32>(HeightRnd());
+
+        auto R = Mgr.Allocate(Width, Height);
+        while (R.IsEmpty() || LiveRegions.size() >= NumLiveRegions)
+        {
+            ASSERT_FALSE(LiveRegions.empty());
+            Mgr.Free(std::move(LiveRegions.front()));
+            LiveRegions.pop_front();
+            if (R.IsEmpty())
+                R = Mgr.Allocate(Width, Height);
+        }
+        LiveRegions.emplace_back(R);
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+
+    for (auto& R : LiveRegions)
+        Mgr.Free(std::move(R));
+    EXPECT_TRUE(Mgr.IsEmpty());
+
+    ReportBenchmarkResult("GlyphCache", 1, NumOps, ElapsedTime);
+}
+
+// Packs glyph-like regions of similar height into an empty atlas until it is full
+void RunPackingBenchmark(DynamicAtlasManager::PackingStrategy Strategy)
+{
+    constexpr Uint32 AtlasSize = 512;
+    constexpr Uint32 NumRuns   = 3;
+
+    double MinTime      = 1e+10;
+    Uint32 NumAllocated = 0;
+    for (Uint32 run = 0; run < NumRuns; ++run)
+    {
+        DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Strategy};
+        FastRandInt         WidthRnd{run, 4, 24};
+        FastRandInt         HeightRnd{run + 1, 14, 18};
+
+        std::vector<DynamicAtlasManager::Region> Regions;
+        Regions.reserve(size_t{AtlasSize} * AtlasSize / (4 * 14));
+
+        Timer T;
+        for (Uint32 NumFailures = 0; NumFailures < 16;)
+        {
+            auto R = Mgr.Allocate(static_cast<Uint32>(WidthRnd()), static_cast<Uint32>(HeightRnd()));
+            if (!R.IsEmpty())
+                Regions.emplace_back(std::move(R));
+            else
+                ++NumFailures;
+        }
+        MinTime      = std::min(MinTime, T.GetElapsedTime());
+        NumAllocated = static_cast<Uint32>(Regions.size());
+
+        for (auto& R : Regions)
+            Mgr.Free(std::move(R));
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+
+    ReportBenchmarkResult("PackUntilFull", 1, NumAllocated, MinTime);
+}
+
+TEST(DynamicAtlasManagerBench, Guillotine)
+{
+    RunAtlasBenchmark(DynamicAtlasManager::PackingStrategy::Guillotine);
+}
+
+TEST(DynamicAtlasManagerBench, Skyline)
+{
+    RunAtlasBenchmark(DynamicAtlasManager::PackingStrategy::Skyline);
+}
+
+TEST(DynamicAtlasManagerBench, GuillotinePacking)
+{
+    RunPackingBenchmark(DynamicAtlasManager::PackingStrategy::Guillotine);
+}
+
+TEST(DynamicAtlasManagerBench, SkylinePacking)
+{
+    RunPackingBenchmark(DynamicAtlasManager::PackingStrategy::Skyline);
+}
+
+} // namespace
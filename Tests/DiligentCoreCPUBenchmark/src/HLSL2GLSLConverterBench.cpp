@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "HLSL2GLSLConverter.h"
+#include "RefCntAutoPtr.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Generates a large vertex shader that exercises the most common conversion paths:
+// constant buffers, structures, texture sampling and function calls.
+std::string GenerateLargeShader(Uint32 NumFunctions)
+{
+    std::stringstream ss;
+    ss << "cbuffer Constants\n"
+          "{\n"
+          "    float4x4 g_WorldViewProj;\n"
+          "    float4   g_Params;\n"
+          "};\n"
+          "Texture2D    g_Tex;\n"
+          "SamplerState g_Tex_sampler;\n"
+          "struct VSOutput\n"
+          "{\n"
+          "    float4 Pos : SV_POSITION;\n"
+          "    float2 UV  : TEX_COORD;\n"
+          "};\n";
+    for (Uint32 i = 0; i < NumFunctions; ++i)
+    {
+        ss << "float4 Func" << i << "(float4 Pos, float2 UV)\n"
+           << "{\n"
+           << "    float4 Color = g_Tex.SampleLevel(g_Tex_sampler, UV, 0.0);\n"
+           << "    // Scale the position by the parameters\n"
+           << "    Pos = mul(Pos, g_WorldViewProj) * Color + g_Params * " << i << ".0;\n"
+           << "    return (Pos.x > 0.5) ? Pos.yxzw : Pos;\n"
+           << "}\n";
+    }
+    ss << "void main(in float3 Pos : ATTRIB0, in float2 UV : ATTRIB1, out VSOutput Out)\n"
+          "{\n"
+          "    Out.Pos = float4(Pos, 1.0);\n";
+    for (Uint32 i = 0; i < NumFunctions; i += NumFunctions / 16 + 1)
+        ss << "    Out.Pos = Func" << i << "(Out.Pos, UV);\n";
+    ss << "    Out.UV = UV;\n"
+          "}\n";
+    return ss.str();
+}
+
+// Converts a large generated shader. One operation is one line of HLSL source.
+TEST(HLSL2GLSLConverterBench, LargeShader)
+{
+    RefCntAutoPtr<IHLSL2GLSLConverter> pConverter;
+    CreateHLSL2GLSLConverter(&pConverter);
+    ASSERT_NE(pConverter, nullptr);
+
+    const auto Source = GenerateLargeShader(2000);
+
+    constexpr Uint32 NumRuns = 3;
+
+    double MinTime = 1e+10;
+    for (Uint32 run = 0; run < NumRuns; ++run)
+    {
+        Timer T;
+
+        RefCntAutoPtr<IHLSL2GLSLConversionStream> pStream;
+        pConverter->CreateStream("LargeShader", nullptr, Source.c_str(), Source.length(), &pStream);
+        ASSERT_NE(pStream, nullptr);
+
+        RefCntAutoPtr<IDataBlob> pGLSL;
+        pStream->Convert("main", SHADER_TYPE_VERTEX, false, "_sampler", true, false, &pGLSL);
+        ASSERT_NE(pGLSL, nullptr);
+
+        MinTime = std::min(MinTime, T.GetElapsedTime());
+    }
+
+    const auto NumLines = static_cast<Uint64>(std::count(Source.begin(), Source.end(), '\n'));
+    ReportBenchmarkResult("Lines", 1, NumLines, MinTime);
+}
+
+} // namespace
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "HashUtils.hpp"
+#include "BasicMath.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(HashUtilsBench, ComputeHashRaw)
+{
+    for (size_t Size : {size_t{16}, size_t{256}, size_t{4096}, size_t{65536}})
+    {
+        std::vector<Uint8> Data(Size);
+        for (size_t i = 0; i < Size; ++i)
+            Data[i] = static_cast<Uint8>(i * 31);
+
+        const Uint64 NumOps = (Uint64{256} << 20) / Size;
+
+        Timer  T;
+        Uint64 Hash = 0;
+        for (Uint64 i = 0; i < NumOps; ++i)
+            Hash += ComputeHashRaw64(Data.data(), Data.size(), i);
+        const double ElapsedTime = T.GetElapsedTime();
+        DoNotOptimize(Hash);
+
+        const std::string Scenario = std::to_string(Size) + "B";
+        ReportBenchmarkResult(Scenario.c_str(), 1, NumOps, ElapsedTime);
+    }
+}
+
+// Reference implementation that hashes one 32-bit word at a time with HashCombine,
+// which is what ComputeHashRaw used before switching to XXH64.
+TEST(HashUtilsBench, ComputeHashRawDwordsReference)
+{
+    auto ComputeHashRawDwords = [](const void* pData, size_t Size, Uint64 Seed) {
+        size_t Hash = static_cast<size_t>(Seed);
+        for (size_t i = 0; i + 4 <= Size; i += 4)
+        {
+            Uint32 Dword;
+            memcpy(&Dword, static_cast<const Uint8*>(pData) + i, sizeof(Dword));
+            HashCombine(Hash, Dword);
+        }
+        return Hash;
+    };
+
+    for (size_t Size : {size_t{16}, size_t{256}, size_t{4096}, size_t{65536}})
+    {
+        std::vector<Uint8> Data(Size);
+        for (size_t i = 0; i < Size; ++i)
+            Data[i] = static_cast<Uint8>(i * 31);
+
+        const Uint64 NumOps = (Uint64{256} << 20) / Size;
+
+        Timer  T;
+        Uint64 Hash = 0;
+        for (Uint64 i = 0; i < NumOps; ++i)
+            Hash += ComputeHashRawDwords(Data.data(), Data.size(), i);
+        const double ElapsedTime = T.GetElapsedTime();
+        DoNotOptimize(Hash);
+
+        const std::string Scenario = std::to_string(Size) + "B";
+        ReportBenchmarkResult(Scenario.c_str(), 1, NumOps, ElapsedTime);
+    }
+}
+
+TEST(HashUtilsBench, ComputeHash)
+{
+    constexpr Uint64 NumOps = 20000000;
+
+    Timer  T;
+    Uint64 Hash = 0;
+    for (Uint64 i = 0; i < NumOps; ++i)
+        Hash += ComputeHash(static_cast<Uint32>(i), i, static_cast<float>(i & 0xFF));
+    const double ElapsedTime = T.GetElapsedTime();
+    DoNotOptimize(Hash);
+
+    ReportBenchmarkResult("ThreeValues", 1, NumOps, ElapsedTime);
+}
+
+TEST(HashUtilsBench, HashMapStringKey)
+{
+    constexpr Uint64 NumOps = 2000000;
+
+    const char* Strings[] = {
+        "g_Texture",
+        "g_ShadowMap_sampler",
+        "cbCameraAttribs",
+        "g_MaterialAttribs_With_A_Rather_Long_Name",
+    };
+
+    Timer  T;
+    Uint64 Hash = 0;
+    for (Uint64 i = 0; i < NumOps; ++i)
+        Hash += HashMapStringKey{Strings[i % _countof(Strings)]}.GetHash();
+    const double ElapsedTime = T.GetElapsedTime();
+    DoNotOptimize(Hash);
+
+    ReportBenchmarkResult("NoCopy", 1, NumOps, ElapsedTime);
+}
+
+} // namespace
@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LRUCache.hpp"
+#include "FastRand.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint64 NumOpsPerThread = 200000;
+constexpr Uint32 NumKeys         = 1024;
+
+using CacheType = LRUCache<Uint32, Uint64>;
+
+void InitCacheData(Uint32 Key, Uint64& Data, size_t& Size)
+{
+    Data = Uint64{Key} * 0x9E3779B97F4A7C15ull;
+    Size = 1;
+}
+
+void RunCacheBenchmark(const char* Scenario, size_t MaxCacheSize)
+{
+    for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+    {
+        CacheType Cache{MaxCacheSize};
+        for (Uint32 Key = 0; Key < NumKeys; ++Key)
+            Cache.Get(Key, [Key](Uint64& Data, size_t& Size) { InitCacheData(Key, Data, Size); });
+
+        RunBenchmark(Scenario, NumThreads, NumOpsPerThread,
+                     [&Cache](Uint32 ThreadId, Uint64 NumOps) {
+                         FastRandInt Rnd{ThreadId + 1, 0, static_cast<int>(NumKeys - 1)};
+
+                         Uint64 Sum = 0;
+                         for (Uint64 i = 0; i < NumOps; ++i)
+                         {
+                             const Uint32 Key = static_cast<Uint32>(Rnd());
+                             Sum += Cache.Get(Key, [Key](Uint64& Data, size_t& Size) { InitCacheData(Key, Data, Size); });
+                         }
+                         DoNotOptimize(Sum);
+                     });
+    }
+}
+
+// All keys are in the cache, so every access is a hit
+TEST(LRUCacheBench, Hit)
+{
+    RunCacheBenchmark("RandomKeys", NumKeys);
+}
+
+// The cache only holds half of the keys, so about a half of the accesses
+// are misses that initialize the data and evict the oldest entry.
+TEST(LRUCacheBench, HitMiss)
+{
+    RunCacheBenchmark("RandomKeys", NumKeys / 2);
+}
+
+} // namespace
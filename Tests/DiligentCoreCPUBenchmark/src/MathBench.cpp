@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "BasicMath.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr size_t NumMatrices = 1024;
+constexpr Uint32 NumPasses   = 2000;
+
+std::vector<float4x4> CreateMatrices()
+{
+    std::vector<float4x4> Matrices(NumMatrices);
+    for (size_t i = 0; i < NumMatrices; ++i)
+    {
+        const float f = static_cast<float>(i);
+        Matrices[i]   = float4x4::RotationY(f * 0.01f) * float4x4::Translation(f, f * 0.5f, -f);
+    }
+    return Matrices;
+}
+
+Uint64 Checksum(const float4& v)
+{
+    return static_cast<Uint64>(v.x + v.y + v.z + v.w);
+}
+
+Uint64 Checksum(const float4x4& m)
+{
+    return static_cast<Uint64>(m._41 + m._42 + m._43 + m._44);
+}
+
+TEST(MathBench, MatrixMultiply)
+{
+    const auto Matrices = CreateMatrices();
+    const auto ViewProj = float4x4::Translation(1, 2, 3) * float4x4::RotationY(0.5f);
+
+    std::vector<float4x4> Results(NumMatrices);
+
+    Timer T;
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        for (size_t i = 0; i < NumMatrices; ++i)
+            Results[i] = Matrices[i] * ViewProj;
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+    DoNotOptimize(Checksum(Results[NumMatrices / 2]));
+
+    ReportBenchmarkResult("float4x4", 1, Uint64{NumPasses} * NumMatrices, ElapsedTime);
+}
+
+TEST(MathBench, MatrixInverse)
+{
+    const auto Matrices = CreateMatrices();
+
+    std::vector<float4x4> Results(NumMatrices);
+
+    Timer T;
+    for (Uint32 pass = 0; pass < NumPasses / 4; ++pass)
+    {
+        for (size_t i = 0; i < NumMatrices; ++i)
+            Results[i] = Matrices[i].Inverse();
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+    DoNotOptimize(Checksum(Results[NumMatrices / 2]));
+
+    ReportBenchmarkResult("float4x4", 1, Uint64{NumPasses / 4} * NumMatrices, ElapsedTime);
+}
+
+TEST(MathBench, TransformVectors)
+{
+    const auto Matrix = float4x4::RotationY(0.25f) * float4x4::Translation(1, 2, 3);
+
+    std::vector<float4> Vectors(NumMatrices * 16);
+    for (size_t i = 0; i < Vectors.size(); ++i)
+        Vectors[i] = float4{static_cast<float>(i), 1, -static_cast<float>(i), 1};
+
+    Timer T;
+    for (Uint32 pass = 0; pass < NumPasses / 4; ++pass)
+    {
+        for (auto& v : Vectors)
+            v = v * Matrix;
+    }
+    const double ElapsedTime = T.GetElapsedTime();
+    DoNotOptimize(Checksum(Vectors[Vectors.size() / 2]));
+
+    ReportBenchmarkResult("float4", 1, Uint64{NumPasses / 4} * Vectors.size(), ElapsedTime);
+}
+
+} // namespace
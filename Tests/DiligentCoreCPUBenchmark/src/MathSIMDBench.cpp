@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <algorithm>
+#include <vector>
+
+#include "BasicMathSIMD.hpp"
+#include "FastRand.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr size_t NumItems = 16384;
+constexpr Uint32 NumRuns  = 8;
+
+const char* GetSIMDPathName()
+{
+#if DILIGENT_SIMD_MATH_SSE
+    return "SSE";
+#elif DILIGENT_SIMD_MATH_NEON
+    return "NEON";
+#elif DILIGENT_SIMD_MATH_WASM
+    return "WASM_SIMD128";
+#else
+    return "ScalarFallback";
+#endif
+}
+
+float4 RandomFloat4(FastRandFloat& Rnd)
+{
+    return float4{Rnd(), Rnd(), Rnd(), Rnd()};
+}
+
+float4x4 RandomFloat4x4(FastRandFloat& Rnd)
+{
+    return float4x4{RandomFloat4(Rnd), RandomFloat4(Rnd), RandomFloat4(Rnd), RandomFloat4(Rnd)};
+}
+
+Uint64 Checksum(const float4& v)
+{
+    return static_cast<Uint64>(v.x + v.y + v.z + v.w);
+}
+
+Uint64 Checksum(const float4x4& m)
+{
+    return static_cast<Uint64>(m._41 + m._42 + m._43 + m._44);
+}
+
+class MathSIMDBench : public ::testing::Test
+{
+protected:
+    MathSIMDBench() :
+        Matrices(NumItems),
+        Vectors(NumItems),
+        MatResults(NumItems),
+        VecResults(NumItems)
+    {
+        FastRandFloat Rnd{0, -10, +10};
+        for (size_t i = 0; i < NumItems; ++i)
+        {
+            // Make the matrices well-conditioned
+            Matrices[i] = RandomFloat4x4(Rnd) + float4x4::Identity() * 50.f;
+            Vectors[i]  = RandomFloat4(Rnd);
+        }
+        Transform = RandomFloat4x4(Rnd);
+    }
+
+    // Runs the scalar and SIMD versions of the same operation and reports the best time of each
+    template <typename ScalarFuncType, typename SIMDFuncType>
+    void Run(ScalarFuncType&& ScalarFunc, SIMDFuncType&& SIMDFunc)
+    {
+        double ScalarTime = 1e+10;
+        double SIMDTime   = 1e+10;
+        for (Uint32 run = 0; run < NumRuns; ++run)
+        {
+            {
+                Timer T;
+                ScalarFunc();
+                ScalarTime = std::min(ScalarTime, T.GetElapsedTime());
+            }
+            {
+                Timer T;
+                SIMDFunc();
+                SIMDTime = std::min(SIMDTime, T.GetElapsedTime());
+            }
+        }
+        DoNotOptimize(Checksum(MatResults[NumItems / 2]) + Checksum(VecResults[NumItems / 2]));
+
+        ReportBenchmarkResult("Scalar", 1, NumItems, ScalarTime);
+        ReportBenchmarkResult(GetSIMDPathName(), 1, NumItems, SIMDTime);
+    }
+
+    std::vector<float4x4> Matrices;
+    std::vector<float4>   Vectors;
+    float4x4              Transform;
+
+    std::vector<float4x4> MatResults;
+    std::vector<float4>   VecResults;
+};
+
+TEST_F(MathSIMDBench, MatrixMultiply)
+{
+    Run(
+        [&]() {
+            for (size_t i = 0; i < NumItems; ++i)
+                MatResults[i] = Matrices[i] * Transform;
+        },
+        [&]() {
+            for (size_t i = 0; i < NumItems; ++i)
+                MatResults[i] = SIMD::Mul(Matrices[i], Transform);
+        });
+}
+
+TEST_F(MathSIMDBench, TransformVectors)
+{
+    Run(
+        [&]() {
+            for (size_t i = 0; i < NumItems; ++i)
+                VecResults[i] = Vectors[i] * Transform;
+        },
+        [&]() {
+            SIMD::TransformVectors(Vectors.data(), VecResults.data(), NumItems, Transform);
+        });
+}
+
+TEST_F(MathSIMDBench, MatrixInverse)
+{
+    Run(
+        [&]() {
+            for (size_t i = 0; i < NumItems; ++i)
+                MatResults[i] = Matrices[i].Inverse();
+        },
+        [&]() {
+            for (size_t i = 0; i < NumItems; ++i)
+                MatResults[i] = SIMD::Inverse(Matrices[i]);
+        });
+}
+
+TEST_F(MathSIMDBench, Lerp)
+{
+    Run(
+        [&]() {
+            for (size_t i = 0; i + 1 < NumItems; ++i)
+                VecResults[i] = lerp(Vectors[i], Vectors[i + 1], 0.5f);
+        },
+        [&]() {
+            for (size_t i = 0; i + 1 < NumItems; ++i)
+                VecResults[i] = SIMD::Lerp(Vectors[i], Vectors[i + 1], 0.5f);
+        });
+}
+
+} // namespace
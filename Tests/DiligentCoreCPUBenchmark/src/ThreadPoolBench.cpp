@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "BenchmarkHelpers.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 NumTasks = 50000;
+
+const char* GetSchedulerName(THREAD_POOL_SCHEDULER Scheduler)
+{
+    return Scheduler == THREAD_POOL_SCHEDULER_WORK_STEALING ? "WorkStealing" : "PriorityQueue";
+}
+
+RefCntAutoPtr<IThreadPool> CreateBenchmarkThreadPool(Uint32 NumThreads, THREAD_POOL_SCHEDULER Scheduler)
+{
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads = NumThreads;
+    ThreadPoolCI.Scheduler  = Scheduler;
+    return CreateThreadPool(ThreadPoolCI);
+}
+
+// Enqueues small tasks from one thread and waits until all of them are complete.
+// Measures the cost of task allocation, scheduling and completion.
+TEST(ThreadPoolBench, EnqueueAndWait)
+{
+    for (auto Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+        {
+            auto pThreadPool = CreateBenchmarkThreadPool(NumThreads, Scheduler);
+            ASSERT_NE(pThreadPool, nullptr);
+
+            std::atomic<Uint32> NumCompleted{0};
+
+            Timer T;
+            for (Uint32 i = 0; i < NumTasks; ++i)
+            {
+                EnqueueAsyncWork(pThreadPool,
+                                 [&NumCompleted](Uint32 ThreadId) {
+                                     NumCompleted.fetch_add(1, std::memory_order_relaxed);
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+            }
+            pThreadPool->WaitForAllTasks();
+            const double ElapsedTime = T.GetElapsedTime();
+
+            EXPECT_EQ(NumCompleted.load(), NumTasks);
+            ReportBenchmarkResult(GetSchedulerName(Scheduler), NumThreads, NumTasks, ElapsedTime);
+        }
+    }
+}
+
+// Enqueues tasks from several threads at the same time. Measures the contention on the task queue.
+TEST(ThreadPoolBench, ConcurrentEnqueue)
+{
+    for (auto Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+        {
+            auto pThreadPool = CreateBenchmarkThreadPool(NumThreads, Scheduler);
+            ASSERT_NE(pThreadPool, nullptr);
+
+            std::atomic<Uint32> NumCompleted{0};
+            RunBenchmark(GetSchedulerName(Scheduler), NumThreads, NumTasks / NumThreads,
+                         [&](Uint32, Uint64 NumOps) {
+                             for (Uint64 i = 0; i < NumOps; ++i)
+                             {
+                                 EnqueueAsyncWork(pThreadPool,
+                                                  [&NumCompleted](Uint32 ThreadId) {
+                                                      NumCompleted.fetch_add(1, std::memory_order_relaxed);
+                                                      return ASYNC_TASK_STATUS_COMPLETE;
+                                                  });
+                             }
+                         });
+            pThreadPool->WaitForAllTasks();
+            EXPECT_EQ(NumCompleted.load(), NumTasks / NumThreads * NumThreads);
+        }
+    }
+}
+
+// Enqueues tasks from several external threads while every task enqueues a few subtasks
+// from the worker thread. The tasks are very short, so the time is dominated by the scheduling overhead.
+TEST(ThreadPoolBench, NestedEnqueue)
+{
+    constexpr Uint32 NumProducers     = 4;
+    constexpr Uint32 NumTasksPerBatch = 4096;
+    constexpr Uint32 NumSubtasks      = 4;
+    constexpr Uint32 TotalTasks       = NumProducers * NumTasksPerBatch * (1 + NumSubtasks);
+
+    for (auto Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+        {
+            auto pThreadPool = CreateBenchmarkThreadPool(NumThreads, Scheduler);
+            ASSERT_NE(pThreadPool, nullptr);
+
+            std::atomic<Uint32> NumCompleted{0};
+
+            Timer T;
+
+            std::vector<std::thread> Producers(NumProducers);
+            for (auto& Producer : Producers)
+            {
+                Producer = std::thread{
+                    [&]() {
+                        for (Uint32 i = 0; i < NumTasksPerBatch; ++i)
+                        {
+                            EnqueueAsyncWork(pThreadPool,
+                                             [&NumCompleted, pThreadPool = pThreadPool.RawPtr()](Uint32 ThreadId) {
+                                                 for (Uint32 j = 0; j < NumSubtasks; ++j)
+                                                 {
+                                                     EnqueueAsyncWork(pThreadPool,
+                                                                      [&NumCompleted](Uint32 ThreadId) {
+                                                                          NumCompleted.fetch_add(1, std::memory_order_relaxed);
+                                                                          return ASYNC_TASK_STATUS_COMPLETE;
+                                                                      });
+                                                 }
+                                                 NumCompleted.fetch_add(1, std::memory_order_relaxed);
+                                                 return ASYNC_TASK_STATUS_COMPLETE;
+                                             },
+                                             static_cast<float>(i % 2));
+                        }
+                    }};
+            }
+            for (auto& Producer : Producers)
+                Producer.join();
+
+            pThreadPool->WaitForAllTasks();
+            const double ElapsedTime = T.GetElapsedTime();
+
+            EXPECT_EQ(NumCompleted.load(), TotalTasks);
+            ReportBenchmarkResult(GetSchedulerName(Scheduler), NumThreads, TotalTasks, ElapsedTime);
+        }
+    }
+}
+
+// Processes a large range with ParallelFor. Measures the per-item overhead and the scaling.
+TEST(ThreadPoolBench, ParallelFor)
+{
+    constexpr Uint32 NumItems  = 1u << 22;
+    constexpr Uint32 GrainSize = 1024;
+
+    std::vector<Uint32> Data(NumItems);
+    for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+    {
+        // The calling thread also processes the items
+        auto pThreadPool = CreateBenchmarkThreadPool(NumThreads - 1, THREAD_POOL_SCHEDULER_WORK_STEALING);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        Timer T;
+        ParallelFor(pThreadPool, 0, NumItems, GrainSize,
+                    [&Data](Uint32 Idx) {
+                        Data[Idx] = Idx * 2654435761u;
+                    },
+                    NumThreads);
+        const double ElapsedTime = T.GetElapsedTime();
+
+        EXPECT_EQ(Data[NumItems - 1], (NumItems - 1) * 2654435761u);
+        ReportBenchmarkResult("Items", NumThreads, NumItems, ElapsedTime);
+    }
+}
+
+} // namespace
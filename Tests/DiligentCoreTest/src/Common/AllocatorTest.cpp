@@ -26,6 +26,9 @@
  */
 
 #include <array>
+#include <thread>
+#include <vector>
+#include <unordered_set>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -124,6 +127,110 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, ThreadCache)
+{
+    constexpr Uint32 AllocSize             = 32;
+    constexpr Uint32 NumAllocationsPerPage = 16;
+    constexpr Uint32 ThreadCacheSize       = 8;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    // The first allocation refills the cache with ThreadCacheSize/2 blocks
+    std::array<void*, ThreadCacheSize / 2> Allocations = {};
+    for (auto& Alloc : Allocations)
+        Alloc = TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__);
+    {
+        const auto Stats = TestAllocator.GetThreadCacheStats();
+        EXPECT_EQ(Stats.NumMisses, 1u);
+        EXPECT_EQ(Stats.NumHits, ThreadCacheSize / 2 - 1);
+    }
+
+    for (auto* Alloc : Allocations)
+        TestAllocator.Free(Alloc);
+    {
+        const auto Stats = TestAllocator.GetThreadCacheStats();
+        EXPECT_EQ(Stats.NumMisses, 1u);
+        EXPECT_EQ(Stats.NumHits, ThreadCacheSize - 1);
+    }
+
+    // Recently released blocks are reused first
+    for (size_t i = Allocations.size(); i > 0; --i)
+    {
+        auto* NewAlloc = TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__);
+        EXPECT_EQ(NewAlloc, Allocations[i - 1]);
+    }
+    for (auto* Alloc : Allocations)
+        TestAllocator.Free(Alloc);
+
+    // Overflow the cache
+    std::vector<void*> ManyAllocations(NumAllocationsPerPage * 3);
+    for (auto& Alloc : ManyAllocations)
+        Alloc = TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__);
+    EXPECT_EQ(std::unordered_set<void*>(ManyAllocations.begin(), ManyAllocations.end()).size(), ManyAllocations.size());
+    for (auto* Alloc : ManyAllocations)
+        TestAllocator.Free(Alloc);
+
+    {
+        const auto Stats = TestAllocator.GetThreadCacheStats();
+        EXPECT_GT(Stats.NumMisses, 1u);
+        EXPECT_GT(Stats.NumHits, Stats.NumMisses);
+    }
+
+    TestAllocator.FlushThreadCaches();
+}
+
+TEST(Common_FixedBlockMemoryAllocator, ThreadCacheMultithreaded)
+{
+    constexpr Uint32 AllocSize             = 48;
+    constexpr Uint32 NumAllocationsPerPage = 64;
+    constexpr Uint32 ThreadCacheSize       = 16;
+    constexpr Uint32 NumThreads            = 8;
+    constexpr Uint32 NumIterations         = 256;
+    constexpr Uint32 NumLiveBlocks         = 48;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage, ThreadCacheSize};
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&TestAllocator, t]() {
+            std::vector<Uint32*> Blocks;
+            for (Uint32 i = 0; i < NumIterations; ++i)
+            {
+                while (Blocks.size() < NumLiveBlocks)
+                {
+                    auto* pBlock = static_cast<Uint32*>(TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__));
+                    pBlock[0]    = t;
+                    pBlock[1]    = static_cast<Uint32>(Blocks.size());
+                    Blocks.push_back(pBlock);
+                }
+
+                // Make sure no other thread has received the same block
+                for (size_t b = 0; b < Blocks.size(); ++b)
+                {
+                    EXPECT_EQ(Blocks[b][0], t);
+                    EXPECT_EQ(Blocks[b][1], b);
+                }
+
+                // Release a varying number of blocks
+                const size_t NumToRelease = 1 + (i * 7 + t) % NumLiveBlocks;
+                for (size_t b = 0; b < NumToRelease; ++b)
+                {
+                    TestAllocator.Free(Blocks.back());
+                    Blocks.pop_back();
+                }
+            }
+            for (auto* pBlock : Blocks)
+                TestAllocator.Free(pBlock);
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    const auto Stats = TestAllocator.GetThreadCacheStats();
+    EXPECT_GT(Stats.NumHits, Stats.NumMisses);
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
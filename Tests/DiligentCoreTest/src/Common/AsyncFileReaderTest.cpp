@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AsyncFileReader.hpp"
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <cstring>
+
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(Common_AsyncFileReader, ReadFiles)
+{
+    constexpr size_t NumFiles = 8;
+
+    std::vector<std::string>        FilePaths(NumFiles);
+    std::vector<std::vector<Uint8>> RefData(NumFiles);
+    for (size_t f = 0; f < NumFiles; ++f)
+    {
+        FilePaths[f] = "AsyncFileReaderTest" + std::to_string(f) + ".bin";
+        RefData[f].resize((f + 1) * 4096 + f);
+        for (size_t i = 0; i < RefData[f].size(); ++i)
+            RefData[f][i] = static_cast<Uint8>(i * 17 + f);
+        ASSERT_TRUE(FileWrapper::WriteFile(FilePaths[f].c_str(), RefData[f].data(), RefData[f].size()));
+    }
+
+    {
+        AsyncFileReader::CreateInfo CI;
+        CI.NumThreads = 4;
+        AsyncFileReader Reader{CI};
+
+        std::atomic<Uint32> NumCallbacks{0};
+
+        std::vector<RefCntAutoPtr<AsyncFileReader::ReadRequest>> Requests(NumFiles);
+        for (size_t f = 0; f < NumFiles; ++f)
+        {
+            Requests[f] = Reader.ReadFile(
+                FilePaths[f].c_str(),
+                [&NumCallbacks, &RefData, f](const Char* FilePath, IDataBlob* pData) //
+                {
+                    if (pData != nullptr && pData->GetSize() == RefData[f].size())
+                        NumCallbacks.fetch_add(1);
+                });
+            ASSERT_NE(Requests[f], nullptr);
+        }
+
+        Requests[0]->WaitForCompletion();
+        EXPECT_EQ(Requests[0]->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+
+        Reader.WaitForIdle();
+        EXPECT_EQ(Reader.GetNumPendingRequests(), 0u);
+        EXPECT_EQ(NumCallbacks.load(), NumFiles);
+
+        for (size_t f = 0; f < NumFiles; ++f)
+        {
+            EXPECT_STREQ(Requests[f]->GetFilePath(), FilePaths[f].c_str());
+            IDataBlob* pData = Requests[f]->GetData();
+            ASSERT_NE(pData, nullptr);
+            ASSERT_EQ(pData->GetSize(), RefData[f].size());
+            EXPECT_EQ(std::memcmp(pData->GetConstDataPtr(), RefData[f].data(), RefData[f].size()), 0);
+        }
+    }
+
+    for (const auto& FilePath : FilePaths)
+        FileSystem::DeleteFile(FilePath.c_str());
+}
+
+TEST(Common_AsyncFileReader, ExternalThreadPool)
+{
+    const char*        FilePath = "AsyncFileReaderTest_Pool.bin";
+    std::vector<Uint8> RefData(1000);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>(i);
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath, RefData.data(), RefData.size()));
+
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads = 2;
+    auto pThreadPool        = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    {
+        AsyncFileReader::CreateInfo CI;
+        CI.pThreadPool = pThreadPool;
+        AsyncFileReader Reader{CI};
+        EXPECT_EQ(Reader.GetThreadPool(), pThreadPool);
+
+        auto pRequest = Reader.ReadFile(FilePath);
+        ASSERT_NE(pRequest, nullptr);
+
+        // The file data can be consumed by a task that depends on the request
+        std::atomic<bool> DataMatches{false};
+        IAsyncTask*       pPrereq = pRequest;
+        auto              pTask   = EnqueueAsyncWork(
+            pThreadPool, &pPrereq, 1,
+            [&](Uint32 ThreadId) //
+            {
+                IDataBlob* pData = pRequest->GetData();
+                DataMatches.store(pData != nullptr &&
+                                  pData->GetSize() == RefData.size() &&
+                                  std::memcmp(pData->GetConstDataPtr(), RefData.data(), RefData.size()) == 0);
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+        pTask->WaitForCompletion();
+        EXPECT_TRUE(DataMatches.load());
+    }
+
+    FileSystem::DeleteFile(FilePath);
+}
+
+TEST(Common_AsyncFileReader, ReadFileRegion)
+{
+    const char*        FilePath = "AsyncFileReaderTest_Region.bin";
+    std::vector<Uint8> RefData(10000);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>(i * 7);
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath, RefData.data(), RefData.size()));
+
+    {
+        AsyncFileReader Reader{AsyncFileReader::CreateInfo{}};
+
+        auto pRequest = Reader.ReadFileRegion(FilePath, 1234, 5000);
+        ASSERT_NE(pRequest, nullptr);
+        pRequest->WaitForCompletion();
+        EXPECT_EQ(pRequest->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+        EXPECT_EQ(pRequest->GetOffset(), Uint64{1234});
+
+        IDataBlob* pData = pRequest->GetData();
+        ASSERT_NE(pData, nullptr);
+        ASSERT_EQ(pData->GetSize(), size_t{5000});
+        EXPECT_EQ(std::memcmp(pData->GetConstDataPtr(), &RefData[1234], 5000), 0);
+
+        // The region that ends at the end of the file
+        pRequest = Reader.ReadFileRegion(FilePath, 9000, 1000);
+        ASSERT_NE(pRequest, nullptr);
+        pRequest->WaitForCompletion();
+        EXPECT_EQ(pRequest->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+        ASSERT_NE(pRequest->GetData(), nullptr);
+        EXPECT_EQ(std::memcmp(pRequest->GetData()->GetConstDataPtr(), &RefData[9000], 1000), 0);
+
+        {
+            TestingEnvironment::ErrorScope ExpectedErrors{"exceeds the size of file"};
+
+            pRequest = Reader.ReadFileRegion(FilePath, 9000, 1001);
+            ASSERT_NE(pRequest, nullptr);
+            pRequest->WaitForCompletion();
+            EXPECT_EQ(pRequest->GetStatus(), ASYNC_TASK_STATUS_CANCELLED);
+            EXPECT_EQ(pRequest->GetData(), nullptr);
+        }
+    }
+
+    FileSystem::DeleteFile(FilePath);
+}
+
+TEST(Common_AsyncFileReader, MissingFile)
+{
+    AsyncFileReader Reader{AsyncFileReader::CreateInfo{}};
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file", "Failed to open file"};
+
+    std::atomic<bool> CallbackCalled{false};
+
+    auto pRequest = Reader.ReadFile("AsyncFileReaderTest_NonExistentFile.bin",
+                                    [&CallbackCalled](const Char* FilePath, IDataBlob* pData) //
+                                    {
+                                        EXPECT_EQ(pData, nullptr);
+                                        CallbackCalled.store(true);
+                                    });
+    ASSERT_NE(pRequest, nullptr);
+    pRequest->WaitForCompletion();
+    Reader.WaitForIdle();
+
+    EXPECT_TRUE(CallbackCalled.load());
+    EXPECT_EQ(pRequest->GetData(), nullptr);
+    EXPECT_EQ(pRequest->GetStatus(), ASYNC_TASK_STATUS_CANCELLED);
+}
+
+} // namespace
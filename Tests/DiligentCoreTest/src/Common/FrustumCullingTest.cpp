@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <vector>
+
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+#include "Timer.hpp"
+#include "Intrinsics.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class FrustumCullingTest : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumItems = 4099;
+
+    void SetUp() override
+    {
+        const float4x4 View     = float4x4::RotationY(0.3f) * float4x4::RotationX(-0.2f) * float4x4::Translation(1, 2, 30);
+        const float4x4 Proj     = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+        const float4x4 ViewProj = View * Proj;
+        ExtractViewFrustumPlanesFromMatrix(ViewProj, Frustum, false);
+
+        FastRandFloat Rnd{0, -100, +100};
+        FastRandFloat RndSize{1, 0, 10};
+
+        MinX.resize(NumItems);
+        MinY.resize(NumItems);
+        MinZ.resize(NumItems);
+        MaxX.resize(NumItems);
+        MaxY.resize(NumItems);
+        MaxZ.resize(NumItems);
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            MinX[i] = Rnd();
+            MinY[i] = Rnd();
+            MinZ[i] = Rnd();
+            MaxX[i] = MinX[i] + RndSize();
+            MaxY[i] = MinY[i] + RndSize();
+            MaxZ[i] = MinZ[i] + RndSize();
+        }
+        Boxes = {MinX.data(), MinY.data(), MinZ.data(), MaxX.data(), MaxY.data(), MaxZ.data()};
+
+        // Use the box coordinates for spheres
+        Spheres = {MinX.data(), MinY.data(), MinZ.data(), MaxX.data()};
+        for (Uint32 i = 0; i < NumItems; ++i)
+            Radii.push_back(RndSize());
+        Spheres.Radius = Radii.data();
+    }
+
+    bool IsBoxVisible(Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) const
+    {
+        BoundBox Box;
+        Box.Min = float3{MinX[i], MinY[i], MinZ[i]};
+        Box.Max = float3{MaxX[i], MaxY[i], MaxZ[i]};
+        return GetBoxVisibility(Frustum, Box, PlaneFlags) != BoxVisibility::Invisible;
+    }
+
+    bool IsSphereVisible(Uint32 i, FRUSTUM_PLANE_FLAGS PlaneFlags) const
+    {
+        const float3 Center{MinX[i], MinY[i], MinZ[i]};
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+            const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+            if (dot(Center, Plane.Normal) + Plane.Distance < -Radii[i] * length(Plane.Normal))
+                return false;
+        }
+        return true;
+    }
+
+    ViewFrustum          Frustum;
+    std::vector<float>   MinX, MinY, MinZ, MaxX, MaxY, MaxZ, Radii;
+    BoundBoxArraysSoA    Boxes;
+    BoundSphereArraysSoA Spheres;
+};
+
+TEST_F(FrustumCullingTest, BoxesVisibility)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_NONE})
+    {
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            // Test different counts to cover partial SIMD groups and mask words
+            for (Uint32 Count : {0u, 1u, 7u, 32u, 33u, NumItems})
+            {
+                std::vector<Uint32> Mask((Count + 31) / 32 + 1, 0xDEADBEEF);
+                GetBoxesVisibility(Frustum, Boxes, Count, Mask.data(), PlaneFlags, pPool);
+
+                Uint32 NumVisible = 0;
+                for (Uint32 i = 0; i < Count; ++i)
+                {
+                    const bool IsVisible = (Mask[i / 32] & (1u << (i % 32))) != 0;
+                    EXPECT_EQ(IsVisible, IsBoxVisible(i, PlaneFlags)) << "Box " << i;
+                    NumVisible += IsVisible ? 1 : 0;
+                }
+                if (Count % 32 != 0)
+                {
+                    EXPECT_EQ(Mask[Count / 32] >> (Count % 32), 0u) << "Unused bits must be zero";
+                }
+                EXPECT_EQ(Mask.back(), 0xDEADBEEF) << "Mask buffer overrun";
+
+                std::vector<Uint32> Indices(Count + 1);
+                const Uint32        NumIndices = GetVisibleBoxes(Frustum, Boxes, Count, Indices.data(), PlaneFlags, pPool);
+                EXPECT_EQ(NumIndices, NumVisible);
+                for (Uint32 i = 0; i < NumIndices; ++i)
+                {
+                    EXPECT_TRUE(IsBoxVisible(Indices[i], PlaneFlags));
+                    if (i > 0)
+                    {
+                        EXPECT_LT(Indices[i - 1], Indices[i]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(FrustumCullingTest, SpheresVisibility)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR})
+    {
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+        {
+            std::vector<Uint32> Mask((NumItems + 31) / 32);
+            GetSpheresVisibility(Frustum, Spheres, NumItems, Mask.data(), PlaneFlags, pPool);
+
+            Uint32 NumVisible = 0;
+            for (Uint32 i = 0; i < NumItems; ++i)
+            {
+                const bool IsVisible = (Mask[i / 32] & (1u << (i % 32))) != 0;
+                EXPECT_EQ(IsVisible, IsSphereVisible(i, PlaneFlags)) << "Sphere " << i;
+                NumVisible += IsVisible ? 1 : 0;
+            }
+            EXPECT_GT(NumVisible, 0u);
+            EXPECT_LT(NumVisible, NumItems);
+
+            std::vector<Uint32> Indices(NumItems);
+            EXPECT_EQ(GetVisibleSpheres(Frustum, Spheres, NumItems, Indices.data(), PlaneFlags, pPool), NumVisible);
+        }
+    }
+}
+
+// Compares the batched culling with testing every box individually.
+// The batched path uses AVX2, SSE2, NEON or WebAssembly SIMD128 depending on the build.
+TEST_F(FrustumCullingTest, Benchmark)
+{
+#if DILIGENT_AVX2_ENABLED
+    const char* SIMDPath = "AVX2";
+#elif DILIGENT_SSE2_ENABLED
+    const char* SIMDPath = "SSE2";
+#elif DILIGENT_NEON_ENABLED
+    const char* SIMDPath = "NEON";
+#elif DILIGENT_WASM_SIMD_ENABLED
+    const char* SIMDPath = "WebAssembly SIMD128";
+#else
+    const char* SIMDPath = "scalar";
+#endif
+
+    constexpr int NumRuns = 16;
+
+    std::vector<Uint32> Mask((NumItems + 31) / 32);
+
+    double ScalarTime  = 1e+10;
+    double BatchedTime = 1e+10;
+    for (int run = 0; run < NumRuns; ++run)
+    {
+        {
+            Timer T;
+            for (Uint32 i = 0; i < NumItems; ++i)
+            {
+                if (IsBoxVisible(i, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM))
+                    Mask[i / 32] |= 1u << (i % 32);
+            }
+            ScalarTime = std::min(ScalarTime, T.GetElapsedTime());
+        }
+        {
+            Timer T;
+            GetBoxesVisibility(Frustum, Boxes, NumItems, Mask.data());
+            BatchedTime = std::min(BatchedTime, T.GetElapsedTime());
+        }
+    }
+
+    LOG_INFO_MESSAGE("Frustum culling of ", NumItems, " boxes (", SIMDPath, "): scalar ", ScalarTime * 1000.0,
+                     " ms, batched ", BatchedTime * 1000.0, " ms (", ScalarTime / std::max(BatchedTime, 1e-9), "x)");
+}
+
+} // namespace
@@ -186,6 +186,35 @@ TEST(Common_HashUtils, ComputeHashRaw)
     }
 }
 
+TEST(Common_HashUtils, ComputeHashRaw64)
+{
+    // Reference XXH64 values
+    EXPECT_EQ(ComputeHashRaw64("", 0), 0xEF46DB3751D8E999ull);
+    EXPECT_EQ(ComputeHashRaw64("a", 1), 0xD24EC4F1A98C6E5Bull);
+    EXPECT_EQ(ComputeHashRaw64("abc", 3), 0x44BC2CF5AD770999ull);
+    {
+        const char Str[] = "Nobody inspects the spammish repetition";
+        EXPECT_EQ(ComputeHashRaw64(Str, sizeof(Str) - 1), 0xFBCEA83C8A378BF1ull);
+    }
+
+    // Hashes of all sizes and offsets must be unique and independent of alignment
+    std::vector<Uint8> RefData(256);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>(i * 7 + 3);
+
+    std::unordered_set<Uint64> Hashes;
+    for (size_t size = 0; size <= 100; ++size)
+    {
+        const Uint64 RefHash = ComputeHashRaw64(RefData.data(), size);
+        EXPECT_TRUE(Hashes.insert(RefHash).second) << size;
+        for (size_t offset = 1; offset < 8; ++offset)
+        {
+            std::vector<Uint8> Data(size + offset);
+            std::copy(RefData.begin(), RefData.begin() + size, Data.begin() + offset);
+            EXPECT_EQ(ComputeHashRaw64(&Data[offset], size), RefHash) << offset << " " << size;
+        }
+    }
+}
 
 template <typename Type>
 class StdHasherTestHelper
@@ -570,6 +599,31 @@ TEST(Common_HashUtils, TextureViewDescXXH128Hash)
 }
 
 
+template <template <typename T> class HelperType>
+void TestBufferViewDescHasher()
+{
+    ASSERT_SIZEOF64(BufferViewDesc, 32, "Did you add new members to BufferViewDesc? Please update the tests.");
+    DEFINE_HELPER(BufferViewDesc);
+
+    TEST_RANGE(ViewType, static_cast<BUFFER_VIEW_TYPE>(1), BUFFER_VIEW_NUM_VIEWS);
+    TEST_RANGE(Format.ValueType, static_cast<VALUE_TYPE>(1), VT_NUM_TYPES);
+    TEST_RANGE(Format.NumComponents, Uint8{1u}, Uint8{4u});
+    TEST_BOOL(Format.IsNormalized);
+    TEST_RANGE(ByteOffset, Uint64{1u}, Uint64{1024u});
+    TEST_RANGE(ByteWidth, Uint64{1u}, Uint64{1024u});
+}
+
+TEST(Common_HashUtils, BufferViewDescStdHash)
+{
+    TestBufferViewDescHasher<StdHasherTestHelper>();
+}
+
+TEST(Common_HashUtils, BufferViewDescXXH128Hash)
+{
+    TestBufferViewDescHasher<XXH128HasherTestHelper>();
+}
+
+
 template <template <typename T> class HelperType>
 void TestSampleDescHasher()
 {
@@ -982,6 +1036,7 @@ void TestGraphicsPipelineDescHasher()
     TEST_RANGE(NumViewports, Uint8{2u}, Uint8{32u});
     TEST_RANGE(SubpassIndex, Uint8{1u}, Uint8{8u});
     TEST_FLAGS(ShadingRateFlags, static_cast<PIPELINE_SHADING_RATE_FLAGS>(1), PIPELINE_SHADING_RATE_FLAG_LAST);
+    TEST_FLAGS(DynamicStateFlags, static_cast<PIPELINE_DYNAMIC_STATE_FLAGS>(1), PIPELINE_DYNAMIC_STATE_FLAG_LAST);
 
     for (Uint8 i = 1; i < MAX_RENDER_TARGETS; ++i)
     {
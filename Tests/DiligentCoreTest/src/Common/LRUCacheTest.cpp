@@ -30,6 +30,7 @@
 
 #include <thread>
 #include <functional>
+#include <atomic>
 
 #include "ThreadSignal.hpp"
 
@@ -183,4 +184,114 @@ TEST(Common_LRUCache, Exceptions)
     }
 }
 
+
+TEST(Common_LRUCache, Stats)
+{
+    LRUCache<int, CacheData> Cache{4};
+
+    auto InitData = [](CacheData& Data, size_t& Size) {
+        Data.Value = 1;
+        Size       = 1;
+    };
+
+    for (int i = 0; i < 4; ++i)
+        Cache.Get(i, InitData);
+    Cache.Get(0, InitData);
+    Cache.Get(1, InitData);
+
+    auto Stats = Cache.GetStats();
+    EXPECT_EQ(Stats.NumHits, size_t{2});
+    EXPECT_EQ(Stats.NumMisses, size_t{4});
+    EXPECT_EQ(Stats.NumEvictions, size_t{0});
+
+    // Key 2 is the least recently used one and is evicted
+    Cache.Get(4, InitData);
+    Stats = Cache.GetStats();
+    EXPECT_EQ(Stats.NumMisses, size_t{5});
+    EXPECT_EQ(Stats.NumEvictions, size_t{1});
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{4});
+
+    Cache.Get(2, InitData);
+    Stats = Cache.GetStats();
+    EXPECT_EQ(Stats.NumHits, size_t{2});
+    EXPECT_EQ(Stats.NumMisses, size_t{6});
+}
+
+
+TEST(Common_ShardedLRUCache, Get)
+{
+    constexpr Uint32 NumKeys = 256;
+
+    ShardedLRUCache<int, CacheData, std::hash<int>, 8> Cache{NumKeys};
+
+    constexpr Uint32                    NumThreads = 16;
+    std::vector<std::thread>            Threads(NumThreads);
+    std::vector<std::vector<CacheData>> ThreadsData(NumThreads);
+    std::atomic<Uint32>                 NumInitialized{0};
+
+    Threading::Signal StartSignal;
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        ThreadsData[i].resize(NumKeys);
+
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                StartSignal.Wait();
+
+                auto& Data = ThreadsData[ThreadId];
+                for (Uint32 i = 0; i < Data.size(); ++i)
+                {
+                    // Get elements with the same keys from all threads
+                    Data[i] = Cache.Get(i,
+                                        [&](CacheData& Data, size_t& Size) //
+                                        {
+                                            NumInitialized.fetch_add(1);
+                                            Data.Value = i;
+                                            Size       = 1;
+                                        });
+                }
+            },
+            i);
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    for (auto& Data : ThreadsData)
+    {
+        for (Uint32 i = 0; i < Data.size(); ++i)
+        {
+            EXPECT_EQ(Data[i].Value, i);
+        }
+    }
+
+    const auto Stats = Cache.GetStats();
+    EXPECT_EQ(Stats.NumHits + Stats.NumMisses, size_t{NumThreads} * NumKeys);
+    EXPECT_EQ(Stats.NumMisses, size_t{NumInitialized});
+    // Every key is initialized at least once
+    EXPECT_GE(Stats.NumMisses, size_t{NumKeys});
+    EXPECT_LE(Cache.GetCurrSize(), size_t{NumKeys});
+}
+
+
+TEST(Common_ShardedLRUCache, Eviction)
+{
+    ShardedLRUCache<int, CacheData, std::hash<int>, 4> Cache{16};
+
+    auto InitData = [](CacheData& Data, size_t& Size) {
+        Data.Value = 1;
+        Size       = 1;
+    };
+
+    for (int i = 0; i < 1024; ++i)
+        Cache.Get(i, InitData);
+
+    // Every shard keeps at most 4 objects
+    EXPECT_LE(Cache.GetCurrSize(), size_t{16});
+    const auto Stats = Cache.GetStats();
+    EXPECT_EQ(Stats.NumMisses, size_t{1024});
+    EXPECT_EQ(Stats.NumEvictions, size_t{1024} - Cache.GetCurrSize());
+}
+
 } // namespace
@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LZ4Compression.hpp"
+
+#include <vector>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+void TestRoundTrip(const std::vector<Uint8>& Src)
+{
+    std::vector<Uint8> Compressed(GetLZ4CompressedSizeBound(Src.size()));
+
+    const size_t CompressedSize = CompressLZ4(Src.data(), Src.size(), Compressed.data(), Compressed.size());
+    ASSERT_GT(CompressedSize, size_t{0});
+    ASSERT_LE(CompressedSize, Compressed.size());
+
+    std::vector<Uint8> Decompressed(Src.size());
+    EXPECT_TRUE(DecompressLZ4(Compressed.data(), CompressedSize, Decompressed.data(), Decompressed.size()));
+    EXPECT_EQ(Decompressed, Src);
+
+    if (!Src.empty())
+    {
+        // Wrong decompressed size
+        EXPECT_FALSE(DecompressLZ4(Compressed.data(), CompressedSize, Decompressed.data(), Decompressed.size() - 1));
+    }
+}
+
+TEST(Common_LZ4Compression, Empty)
+{
+    TestRoundTrip({});
+}
+
+TEST(Common_LZ4Compression, Small)
+{
+    for (Uint8 Size = 1; Size < 32; ++Size)
+    {
+        std::vector<Uint8> Data(Size);
+        for (Uint8 i = 0; i < Size; ++i)
+            Data[i] = i % 3;
+        TestRoundTrip(Data);
+    }
+}
+
+TEST(Common_LZ4Compression, Repetitive)
+{
+    std::vector<Uint8> Data(65536 * 3);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>((i % 13) * 7);
+    TestRoundTrip(Data);
+
+    std::vector<Uint8> Compressed(GetLZ4CompressedSizeBound(Data.size()));
+    EXPECT_LT(CompressLZ4(Data.data(), Data.size(), Compressed.data(), Compressed.size()), Data.size() / 100);
+}
+
+TEST(Common_LZ4Compression, Random)
+{
+    FastRandInt Rnd{0, 0, 255};
+
+    std::vector<Uint8> Data(100000);
+    for (auto& Byte : Data)
+        Byte = static_cast<Uint8>(Rnd());
+    TestRoundTrip(Data);
+
+    // Partially compressible data
+    for (size_t i = 0; i < Data.size(); ++i)
+    {
+        if ((Rnd() & 3) != 0 && i > 0)
+            Data[i] = Data[i - 1];
+    }
+    TestRoundTrip(Data);
+}
+
+TEST(Common_LZ4Compression, SmallDstBuffer)
+{
+    std::vector<Uint8> Data(1000);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 31);
+
+    std::vector<Uint8> Compressed(16);
+    EXPECT_EQ(CompressLZ4(Data.data(), Data.size(), Compressed.data(), Compressed.size()), size_t{0});
+}
+
+TEST(Common_LZ4Compression, CorruptedData)
+{
+    std::vector<Uint8> Data(4096);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i / 16);
+
+    std::vector<Uint8> Compressed(GetLZ4CompressedSizeBound(Data.size()));
+    Compressed.resize(CompressLZ4(Data.data(), Data.size(), Compressed.data(), Compressed.size()));
+    ASSERT_FALSE(Compressed.empty());
+
+    std::vector<Uint8> Decompressed(Data.size());
+    // Truncated data
+    EXPECT_FALSE(DecompressLZ4(Compressed.data(), Compressed.size() / 2, Decompressed.data(), Decompressed.size()));
+
+    // Random corruption must never result in out-of-bounds access
+    FastRandInt Rnd{1, 0, 255};
+    for (int i = 0; i < 256; ++i)
+    {
+        auto Corrupted = Compressed;
+        Corrupted[Rnd() % Corrupted.size()] ^= static_cast<Uint8>(Rnd() | 1);
+        DecompressLZ4(Corrupted.data(), Corrupted.size(), Decompressed.data(), Decompressed.size());
+    }
+}
+
+} // namespace
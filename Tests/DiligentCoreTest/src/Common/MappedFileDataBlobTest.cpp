@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MappedFileDataBlob.hpp"
+
+#include <vector>
+#include <cstring>
+
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileSystem.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(Common_MappedFileDataBlob, Map)
+{
+    const char* FilePath = "MappedFileDataBlobTest.bin";
+
+    std::vector<Uint8> RefData(1 << 20);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>(i * 31 + (i >> 8));
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath, RefData.data(), RefData.size()));
+
+    {
+        RefCntAutoPtr<IDataBlob> pBlob = MappedFileDataBlob::Create(FilePath);
+        ASSERT_NE(pBlob, nullptr);
+        ASSERT_EQ(pBlob->GetSize(), RefData.size());
+        EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), RefData.data(), RefData.size()), 0);
+        EXPECT_EQ(*static_cast<const Uint8*>(pBlob->GetConstDataPtr(12345)), RefData[12345]);
+
+        // Writes to the blob must not modify the file
+        static_cast<Uint8*>(pBlob->GetDataPtr())[100] = ~RefData[100];
+        EXPECT_EQ(static_cast<const Uint8*>(pBlob->GetConstDataPtr())[100], static_cast<Uint8>(~RefData[100]));
+
+        std::vector<Uint8> FileData;
+        ASSERT_TRUE(FileWrapper::ReadWholeFile(FilePath, FileData));
+        EXPECT_EQ(FileData, RefData);
+    }
+
+    FileSystem::DeleteFile(FilePath);
+}
+
+TEST(Common_MappedFileDataBlob, EmptyFile)
+{
+    const char* FilePath = "MappedFileDataBlobTest_Empty.bin";
+    {
+        FileWrapper File{FilePath, EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+    }
+
+    {
+        RefCntAutoPtr<IDataBlob> pBlob = MappedFileDataBlob::Create(FilePath);
+        ASSERT_NE(pBlob, nullptr);
+        EXPECT_EQ(pBlob->GetSize(), size_t{0});
+    }
+
+    FileSystem::DeleteFile(FilePath);
+}
+
+TEST(Common_MappedFileDataBlob, Advise)
+{
+    const char* FilePath = "MappedFileDataBlobTest_Advise.bin";
+
+    std::vector<Uint8> RefData(3 << 16);
+    for (size_t i = 0; i < RefData.size(); ++i)
+        RefData[i] = static_cast<Uint8>(i * 7);
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath, RefData.data(), RefData.size()));
+
+    {
+        RefCntAutoPtr<IDataBlob> pBlob = MappedFileDataBlob::Create(FilePath, MappedFileDataBlob::AccessHint::Sequential);
+        ASSERT_NE(pBlob, nullptr);
+
+        RefCntAutoPtr<MappedFileDataBlob> pMappedBlob{pBlob, MappedFileDataBlob::IID_InternalImpl};
+#if PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+        ASSERT_NE(pMappedBlob, nullptr);
+        // Ranges do not need to be aligned to the page size
+        EXPECT_TRUE(pMappedBlob->Advise(MappedFileDataBlob::AccessHint::WillNeed, 1000, 50000));
+        EXPECT_TRUE(pMappedBlob->Advise(MappedFileDataBlob::AccessHint::Random, 12345));
+        EXPECT_TRUE(MappedFileDataBlob::Advise(pBlob, MappedFileDataBlob::AccessHint::Normal));
+#endif
+        // Hints never change the data
+        EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), RefData.data(), RefData.size()), 0);
+
+        RefCntAutoPtr<IDataBlob> pOtherBlob = DataBlobImpl::Create(16);
+        EXPECT_FALSE(MappedFileDataBlob::Advise(pOtherBlob, MappedFileDataBlob::AccessHint::WillNeed));
+    }
+
+    FileSystem::DeleteFile(FilePath);
+}
+
+TEST(Common_MappedFileDataBlob, MissingFile)
+{
+    TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+    EXPECT_EQ(MappedFileDataBlob::Create("NonExistentFile.bin"), nullptr);
+}
+
+} // namespace
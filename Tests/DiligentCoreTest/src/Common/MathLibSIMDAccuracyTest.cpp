@@ -0,0 +1,91 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Fast SIMD path accuracy tests. The benchmarks comparing it with the scalar BasicMath path are in DiligentCoreCPUBenchmark.
+#include "BasicMathSIMD.hpp"
+
+#include <vector>
+
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+float4 RandomFloat4(FastRandFloat& Rnd)
+{
+    return float4{Rnd(), Rnd(), Rnd(), Rnd()};
+}
+
+float4x4 RandomFloat4x4(FastRandFloat& Rnd)
+{
+    return float4x4{RandomFloat4(Rnd), RandomFloat4(Rnd), RandomFloat4(Rnd), RandomFloat4(Rnd)};
+}
+
+void ExpectNear(const float4& a, const float4& b, float Tolerance)
+{
+    for (int i = 0; i < 4; ++i)
+        EXPECT_NEAR(a[i], b[i], Tolerance * std::max(1.f, std::abs(b[i])));
+}
+
+void ExpectNear(const float4x4& a, const float4x4& b, float Tolerance)
+{
+    for (int r = 0; r < 4; ++r)
+        for (int c = 0; c < 4; ++c)
+            EXPECT_NEAR(a[r][c], b[r][c], Tolerance * std::max(1.f, std::abs(b[r][c])));
+}
+
+TEST(Common_BasicMathSIMD, FastPathAccuracy)
+{
+    FastRandFloat Rnd{0, -10, +10};
+    for (int i = 0; i < 1000; ++i)
+    {
+        const float4x4 m1 = RandomFloat4x4(Rnd);
+        const float4x4 m2 = RandomFloat4x4(Rnd);
+        const float4   a  = RandomFloat4(Rnd);
+        const float4   b  = RandomFloat4(Rnd);
+
+        ExpectNear(SIMD::Mul(m1, m2), m1 * m2, 1e-5f);
+        ExpectNear(SIMD::Mul(a, m1), a * m1, 1e-5f);
+        ExpectNear(SIMD::Mul(m1, a), m1 * a, 1e-5f);
+        ExpectNear(SIMD::Add(a, b), a + b, 1e-6f);
+        ExpectNear(SIMD::Lerp(a, b, 0.25f), lerp(a, b, 0.25f), 1e-6f);
+        ExpectNear(SIMD::Normalize(a), normalize(a), 1e-6f);
+        EXPECT_NEAR(SIMD::Dot(a, b), dot(a, b), 1e-5f * std::max(1.f, std::abs(dot(a, b))));
+
+        // Make the matrix well-conditioned
+        const float4x4 m = m1 + float4x4::Identity() * 50.f;
+
+        const float4x4 Inv = SIMD::Inverse(m);
+        ExpectNear(Inv, m.Inverse(), 1e-4f);
+        ExpectNear(Inv * m, float4x4::Identity(), 1e-4f);
+    }
+}
+
+} // namespace
@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+// Verify that the strict SIMD path produces results that are bit-identical to the scalar path
+#define DILIGENT_SIMD_MATH_STRICT 1
+#include "BasicMathSIMD.hpp"
+
+#include <cstring>
+#include <limits>
+
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+template <typename T>
+bool BitwiseEqual(const T& a, const T& b)
+{
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+#define EXPECT_BITWISE_EQ(a, b) EXPECT_TRUE(BitwiseEqual(a, b))
+
+class SIMDStrictTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+#if DILIGENT_FMA_ENABLED
+        // The compiler may contract multiplications and additions in the scalar path into FMA
+        GTEST_SKIP() << "Scalar path may use FMA instructions";
+#endif
+    }
+
+    float4 RandomFloat4()
+    {
+        return float4{Rnd(), Rnd(), Rnd(), Rnd()};
+    }
+
+    float4x4 RandomFloat4x4()
+    {
+        return float4x4{RandomFloat4(), RandomFloat4(), RandomFloat4(), RandomFloat4()};
+    }
+
+    FastRandFloat Rnd{0, -100, +100};
+
+    static constexpr int NumIterations = 1000;
+};
+
+TEST_F(SIMDStrictTest, VectorOps)
+{
+    for (int i = 0; i < NumIterations; ++i)
+    {
+        const float4 a = RandomFloat4();
+        const float4 b = RandomFloat4();
+        const float  s = Rnd();
+
+        EXPECT_BITWISE_EQ(SIMD::Add(a, b), a + b);
+        EXPECT_BITWISE_EQ(SIMD::Sub(a, b), a - b);
+        EXPECT_BITWISE_EQ(SIMD::Mul(a, b), a * b);
+        EXPECT_BITWISE_EQ(SIMD::Mul(a, s), a * s);
+        EXPECT_BITWISE_EQ(SIMD::Div(a, b), a / b);
+        EXPECT_BITWISE_EQ(SIMD::Min(a, b), (min)(a, b));
+        EXPECT_BITWISE_EQ(SIMD::Max(a, b), (max)(a, b));
+        EXPECT_BITWISE_EQ(SIMD::Dot(a, b), dot(a, b));
+        EXPECT_BITWISE_EQ(SIMD::Normalize(a), normalize(a));
+        EXPECT_BITWISE_EQ(SIMD::Lerp(a, b, 0.375f), lerp(a, b, 0.375f));
+    }
+}
+
+TEST_F(SIMDStrictTest, MinMaxSpecialValues)
+{
+    const float  NaN = std::numeric_limits<float>::quiet_NaN();
+    const float4 a{+0.f, -0.f, NaN, 1.f};
+    const float4 b{-0.f, +0.f, 1.f, NaN};
+    EXPECT_BITWISE_EQ(SIMD::Min(a, b), (min)(a, b));
+    EXPECT_BITWISE_EQ(SIMD::Max(a, b), (max)(a, b));
+    EXPECT_BITWISE_EQ(SIMD::Min(b, a), (min)(b, a));
+    EXPECT_BITWISE_EQ(SIMD::Max(b, a), (max)(b, a));
+}
+
+TEST_F(SIMDStrictTest, MatrixOps)
+{
+    for (int i = 0; i < NumIterations; ++i)
+    {
+        const float4x4 m1 = RandomFloat4x4();
+        const float4x4 m2 = RandomFloat4x4();
+        const float4   v  = RandomFloat4();
+
+        EXPECT_BITWISE_EQ(SIMD::Mul(m1, m2), m1 * m2);
+        EXPECT_BITWISE_EQ(SIMD::Mul(v, m1), v * m1);
+        EXPECT_BITWISE_EQ(SIMD::Mul(m1, v), m1 * v);
+        EXPECT_BITWISE_EQ(SIMD::Transpose(m1), m1.Transpose());
+        EXPECT_BITWISE_EQ(SIMD::Inverse(m1), m1.Inverse());
+    }
+
+    // The scalar path accumulates products starting from zero, which makes -0 results +0
+    {
+        const float4x4 m1{
+            -1, 0, 0, 0,
+            0, 1, 0, 0,
+            0, 0, 1, 0,
+            0, 0, 0, 1};
+        const float4x4 m2{
+            0, 1, 0, 0,
+            1, 0, 0, 0,
+            0, 0, 1, 0,
+            0, 0, 0, 1};
+        EXPECT_BITWISE_EQ(SIMD::Mul(m1, m2), m1 * m2);
+    }
+}
+
+TEST_F(SIMDStrictTest, TransformVectors)
+{
+    const float4x4 m = RandomFloat4x4();
+
+    constexpr size_t NumVectors = 37;
+    float4           Src[NumVectors];
+    float4           Dst[NumVectors];
+    for (auto& v : Src)
+        v = RandomFloat4();
+
+    SIMD::TransformVectors(Src, Dst, NumVectors, m);
+    for (size_t i = 0; i < NumVectors; ++i)
+        EXPECT_BITWISE_EQ(Dst[i], Src[i] * m);
+
+    // In-place transform
+    SIMD::TransformVectors(Src, Src, NumVectors, m);
+    for (size_t i = 0; i < NumVectors; ++i)
+        EXPECT_BITWISE_EQ(Src[i], Dst[i]);
+}
+
+} // namespace
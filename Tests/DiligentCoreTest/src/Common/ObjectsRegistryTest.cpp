@@ -244,4 +244,71 @@ TEST(Common_ObjectsRegistry, Exceptions_RefCntAutoPtr)
     TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>();
 }
 
+
+template <template <typename T> class StrongPtrType, typename DataType>
+void TestObjectRegistryConcurrentReads()
+{
+    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{32};
+
+    constexpr Uint32                     NumObjects = 256;
+    std::vector<StrongPtrType<DataType>> Objects(NumObjects);
+    for (Uint32 i = 0; i < NumObjects; ++i)
+    {
+        Objects[i] = Registry.Get(i, std::bind(DataType::Create, i));
+        ASSERT_NE(Objects[i], nullptr);
+    }
+
+    // Release odd objects
+    for (Uint32 i = 1; i < NumObjects; i += 2)
+        Objects[i] = {};
+
+    constexpr Uint32         NumThreads = 16;
+    std::vector<std::thread> Threads(NumThreads);
+
+    Threading::Signal StartSignal;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread(
+            [&](Uint32 ThreadId) {
+                StartSignal.Wait();
+                for (Uint32 iter = 0; iter < 16; ++iter)
+                {
+                    for (Uint32 i = 0; i < NumObjects; i += 2)
+                    {
+                        // Existing objects must be found without calling the initializer
+                        auto pData = Registry.Get(i, []() -> StrongPtrType<DataType> { return {}; });
+                        EXPECT_EQ(pData, Objects[i]);
+                        EXPECT_EQ(Registry.Get(i), Objects[i]);
+                        EXPECT_EQ(Registry.Get(i + 1), nullptr);
+                    }
+                }
+            },
+            t);
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    Registry.Purge();
+
+    Uint32 NumElements = 0;
+    Registry.ProcessElements([&](int Key, const DataType& Data) {
+        EXPECT_EQ(Key % 2, 0);
+        EXPECT_EQ(Data.Value, static_cast<Uint32>(Key));
+        ++NumElements;
+    });
+    EXPECT_EQ(NumElements, NumObjects / 2);
+}
+
+TEST(Common_ObjectsRegistry, ConcurrentReads_SharedPtr)
+{
+    TestObjectRegistryConcurrentReads<std::shared_ptr, RegistryData>();
+}
+
+TEST(Common_ObjectsRegistry, ConcurrentReads_RefCntAutoPtr)
+{
+    TestObjectRegistryConcurrentReads<RefCntAutoPtr, RegistryDataObj>();
+}
+
 } // namespace
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PooledRawMemoryAllocator.hpp"
+
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_PooledRawMemoryAllocator, BlockSize)
+{
+    size_t PrevBlockSize = 0;
+    for (size_t Size = 1; Size <= PooledRawMemoryAllocator::MaxPooledSize; ++Size)
+    {
+        const auto BlockSize = PooledRawMemoryAllocator::GetBlockSize(Size);
+        ASSERT_GE(BlockSize, Size);
+        ASSERT_GE(BlockSize, PrevBlockSize);
+        ASSERT_EQ(BlockSize % 16, size_t{0});
+        // Four size classes per power of two limit the waste to 25%
+        ASSERT_LE(BlockSize, std::max(Size + 15, Size + Size / 4));
+        PrevBlockSize = BlockSize;
+    }
+    EXPECT_EQ(PooledRawMemoryAllocator::GetBlockSize(PooledRawMemoryAllocator::MaxPooledSize), PooledRawMemoryAllocator::MaxPooledSize);
+    EXPECT_EQ(PooledRawMemoryAllocator::GetBlockSize(100000), size_t{100000});
+}
+
+TEST(Common_PooledRawMemoryAllocator, AllocateFree)
+{
+    auto& Allocator = PooledRawMemoryAllocator::GetAllocator();
+
+    std::vector<std::pair<Uint8*, size_t>> Allocations;
+    for (size_t Size : {1, 7, 16, 17, 100, 128, 129, 1000, 4096, 30000, 40000, 1 << 20})
+    {
+        for (Uint32 i = 0; i < 16; ++i)
+        {
+            auto* Ptr = static_cast<Uint8*>(Allocator.Allocate(Size, "Test", __FILE__, __LINE__));
+            ASSERT_NE(Ptr, nullptr);
+            EXPECT_EQ(reinterpret_cast<size_t>(Ptr) % 16, size_t{0});
+            std::memset(Ptr, static_cast<int>(Size + i), Size);
+            Allocations.emplace_back(Ptr, Size);
+        }
+    }
+
+    for (size_t Alignment : {16, 32, 64, 256, 4096})
+    {
+        for (size_t Size : {1, 100, 5000, 50000})
+        {
+            auto* Ptr = static_cast<Uint8*>(Allocator.AllocateAligned(Size, Alignment, "Test", __FILE__, __LINE__));
+            ASSERT_NE(Ptr, nullptr);
+            EXPECT_EQ(reinterpret_cast<size_t>(Ptr) % Alignment, size_t{0});
+            std::memset(Ptr, 0xCD, Size);
+            Allocator.FreeAligned(Ptr);
+        }
+    }
+
+    // Verify that allocations do not overlap
+    for (Uint32 i = 0; i < Allocations.size(); ++i)
+    {
+        const auto& Alloc = Allocations[i];
+        const auto  Val   = static_cast<Uint8>(Alloc.second + i % 16);
+        for (size_t b = 0; b < Alloc.second; ++b)
+            ASSERT_EQ(Alloc.first[b], Val);
+    }
+
+    for (const auto& Alloc : Allocations)
+        Allocator.Free(Alloc.first);
+
+    Allocator.Free(nullptr);
+}
+
+TEST(Common_PooledRawMemoryAllocator, CrossThreadFree)
+{
+    auto& Allocator = PooledRawMemoryAllocator::GetAllocator();
+
+    constexpr Uint32 NumThreads        = 4;
+    constexpr Uint32 NumAllocsPerThread = 10000;
+
+    // Every thread allocates blocks that are then freed by the next thread
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+    {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                auto& Allocs = Allocations[t];
+                Allocs.resize(NumAllocsPerThread);
+                for (Uint32 i = 0; i < NumAllocsPerThread; ++i)
+                {
+                    const size_t Size = 8 + (i * 37) % 2000;
+                    Allocs[i]         = Allocator.Allocate(Size, "Test", __FILE__, __LINE__);
+                    std::memset(Allocs[i], static_cast<int>(t), Size);
+                }
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                for (void* Ptr : Allocations[(t + 1) % NumThreads])
+                    Allocator.Free(Ptr);
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+}
+
+TEST(Common_PooledRawMemoryAllocator, Stats)
+{
+    auto& Allocator = PooledRawMemoryAllocator::GetAllocator();
+
+    Allocator.ResetStats();
+    Allocator.EnableStats(true);
+
+    const char* Desc1 = "PooledRawMemoryAllocatorTest 1";
+    const char* Desc2 = "PooledRawMemoryAllocatorTest 2";
+
+    std::vector<void*> Allocations;
+    for (Uint32 i = 0; i < 3; ++i)
+        Allocations.push_back(Allocator.Allocate(100, Desc1, __FILE__, __LINE__));
+    Allocations.push_back(Allocator.AllocateAligned(50000, 64, Desc2, __FILE__, __LINE__));
+
+    Allocator.EnableStats(false);
+    Allocations.push_back(Allocator.Allocate(10, Desc2, __FILE__, __LINE__));
+
+    for (void* Ptr : Allocations)
+        Allocator.Free(Ptr);
+
+    const auto Stats = Allocator.GetStats();
+    ASSERT_EQ(Stats.size(), size_t{2});
+    EXPECT_EQ(Stats[0].Description, Desc1);
+    EXPECT_EQ(Stats[0].NumAllocations, Uint64{3});
+    EXPECT_EQ(Stats[0].TotalSize, Uint64{300});
+    EXPECT_EQ(Stats[1].Description, Desc2);
+    EXPECT_EQ(Stats[1].NumAllocations, Uint64{1});
+    EXPECT_EQ(Stats[1].TotalSize, Uint64{50000});
+
+    Allocator.ResetStats();
+    EXPECT_TRUE(Allocator.GetStats().empty());
+}
+
+} // namespace
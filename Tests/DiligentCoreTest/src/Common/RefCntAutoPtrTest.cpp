@@ -30,10 +30,12 @@
 #include <mutex>
 #include <condition_variable>
 #include <algorithm>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "RefCountedObjectImpl.hpp"
+#include "ObjectBase.hpp"
 #include "ThreadSignal.hpp"
 
 #include "gtest/gtest.h"
@@ -904,4 +906,134 @@ TEST(Common_RefCntAutoPtr, Threading)
     ThreadingTest.RunConcurrencyTest();
 }
 
+
+class IntrusiveObject : public Diligent::IntrusiveObjectBase<Diligent::IObject>
+{
+public:
+    explicit IntrusiveObject(int Value, bool* pDestroyed = nullptr) :
+        m_Value{Value},
+        m_pDestroyed{pDestroyed}
+    {
+    }
+
+    ~IntrusiveObject()
+    {
+        if (m_pDestroyed != nullptr)
+            *m_pDestroyed = true;
+    }
+
+    const int m_Value;
+
+private:
+    bool* const m_pDestroyed;
+};
+
+TEST(Common_IntrusiveRefCountedObject, Lifetime)
+{
+    bool Destroyed = false;
+    {
+        RefCntAutoPtr<IntrusiveObject> pObj{MakeNewIntrusiveRCObj<IntrusiveObject>{}(5, &Destroyed)};
+        ASSERT_NE(pObj, nullptr);
+        EXPECT_EQ(pObj->m_Value, 5);
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumWeakRefs(), 0);
+
+        {
+            RefCntAutoPtr<IntrusiveObject> pObj2{pObj};
+            EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 2);
+
+            RefCntAutoPtr<IObject> pUnknown;
+            pObj->QueryInterface(IID_Unknown, &pUnknown);
+            EXPECT_EQ(pUnknown, pObj);
+            EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 3);
+        }
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+        // Strong references through the reference counters interface are forwarded to the object
+        IReferenceCounters* pRefCounters = pObj->GetReferenceCounters();
+        EXPECT_EQ(pRefCounters->AddStrongRef(), 2);
+        EXPECT_EQ(pRefCounters->ReleaseStrongRef(), 1);
+        EXPECT_FALSE(Destroyed);
+    }
+    EXPECT_TRUE(Destroyed);
+}
+
+TEST(Common_IntrusiveRefCountedObject, Allocator)
+{
+    bool Destroyed = false;
+    {
+        auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+        RefCntAutoPtr<IntrusiveObject> pObj{NEW_INTRUSIVE_RC_OBJ(Allocator, "Intrusive test object", IntrusiveObject)(7, &Destroyed)};
+        ASSERT_NE(pObj, nullptr);
+        EXPECT_EQ(pObj->m_Value, 7);
+    }
+    EXPECT_TRUE(Destroyed);
+}
+
+TEST(Common_IntrusiveRefCountedObject, Threading)
+{
+    constexpr size_t NumThreads    = 8;
+    constexpr int    NumIterations = 10000;
+
+    bool Destroyed = false;
+
+    RefCntAutoPtr<IntrusiveObject> pObj{MakeNewIntrusiveRCObj<IntrusiveObject>{}(1, &Destroyed)};
+
+    std::vector<std::thread> Threads(NumThreads);
+    for (auto& Thread : Threads)
+    {
+        Thread = std::thread{
+            [pObj]() {
+                for (int i = 0; i < NumIterations; ++i)
+                {
+                    RefCntAutoPtr<IntrusiveObject> pCopy{pObj};
+                    EXPECT_GE(pCopy->GetReferenceCounters()->GetNumStrongRefs(), 2);
+                }
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+    pObj.Release();
+    EXPECT_TRUE(Destroyed);
+}
+
+TEST(Common_RefCntBorrowedPtr, Basic)
+{
+    SmartPtr pObj{MakeNewObj<Object>()};
+
+    RefCntBorrowedPtr<Object> pBorrowed{pObj};
+    EXPECT_EQ(pBorrowed.RawPtr(), pObj.RawPtr());
+    EXPECT_TRUE(pBorrowed);
+    EXPECT_FALSE(!pBorrowed);
+    // Borrowing does not touch the reference counters
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    pBorrowed->m_Value = 10;
+    EXPECT_EQ((*pBorrowed).m_Value, 10);
+
+    RefCntBorrowedPtr<IObject> pBorrowedBase{pBorrowed};
+    EXPECT_EQ(pBorrowedBase.RawPtr(), static_cast<IObject*>(pObj.RawPtr()));
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    {
+        auto pPromoted = pBorrowed.Promote();
+        EXPECT_EQ(pPromoted, pObj);
+        EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 2);
+    }
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+
+    RefCntBorrowedPtr<Object> pNull;
+    EXPECT_FALSE(pNull);
+    EXPECT_EQ(pNull.Promote(), nullptr);
+
+    RefCntAutoPtr<DerivedObject>     pDerived{MakeNewObj<DerivedObject>()};
+    RefCntBorrowedPtr<Object>        pBorrowedDerived{pDerived};
+    RefCntBorrowedPtr<DerivedObject> pBorrowedDerived2{pDerived.RawPtr()};
+    EXPECT_EQ(pBorrowedDerived.RawPtr(), pBorrowedDerived2.RawPtr());
+    EXPECT_EQ(pBorrowedDerived.RawPtr<DerivedObject>()->m_Value2, 1);
+}
+
 } // namespace
@@ -172,4 +172,75 @@ TEST(SerializerTest, SerializerTest)
     }
 }
 
+TEST(SerializerTest, ArrayRawView)
+{
+    const Uint8  RefU8                  = 0x35;
+    const Uint32 RefArraySize           = 4;
+    const Uint64 RefArray[RefArraySize] = {0x1251, 0x620ull << 32, 0x8816, 0x9527};
+
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    DynamicLinearAllocator TmpAllocator{RawAllocator};
+    const auto             WriteData = [&](auto& Ser) {
+        EXPECT_TRUE(Ser(RefU8));
+        EXPECT_TRUE(Ser.SerializeArrayRaw(&TmpAllocator, RefArray, RefArraySize));
+        EXPECT_TRUE(Ser(RefU8));
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    auto Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    const auto* const pDataStart = static_cast<const Uint8*>(Data.Ptr());
+    const auto* const pDataEnd   = pDataStart + Data.Size();
+
+    // Const elements are referenced in the source buffer
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+
+        Uint8 U8 = 0;
+        EXPECT_TRUE(RSer(U8));
+
+        Uint32        ArraySize = 0;
+        const Uint64* pArray    = nullptr;
+        EXPECT_TRUE(RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize));
+        ASSERT_EQ(ArraySize, RefArraySize);
+        EXPECT_EQ(reinterpret_cast<size_t>(pArray) % alignof(Uint64), size_t{0});
+        EXPECT_GE(reinterpret_cast<const Uint8*>(pArray), pDataStart);
+        EXPECT_LE(reinterpret_cast<const Uint8*>(pArray + ArraySize), pDataEnd);
+        for (Uint32 i = 0; i < RefArraySize; ++i)
+            EXPECT_EQ(RefArray[i], pArray[i]);
+
+        EXPECT_TRUE(RSer(U8));
+        EXPECT_EQ(U8, RefU8);
+        EXPECT_TRUE(RSer.IsEnded());
+    }
+
+    // Non-const elements are copied
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+
+        Uint8 U8 = 0;
+        EXPECT_TRUE(RSer(U8));
+
+        Uint32  ArraySize = 0;
+        Uint64* pArray    = nullptr;
+        EXPECT_TRUE(RSer.SerializeArrayRaw(&TmpAllocator, pArray, ArraySize));
+        ASSERT_EQ(ArraySize, RefArraySize);
+        EXPECT_TRUE(reinterpret_cast<const Uint8*>(pArray) < pDataStart || reinterpret_cast<const Uint8*>(pArray) >= pDataEnd);
+        for (Uint32 i = 0; i < RefArraySize; ++i)
+            EXPECT_EQ(RefArray[i], pArray[i]);
+
+        EXPECT_TRUE(RSer(U8));
+        EXPECT_EQ(U8, RefU8);
+        EXPECT_TRUE(RSer.IsEnded());
+    }
+}
+
 } // namespace
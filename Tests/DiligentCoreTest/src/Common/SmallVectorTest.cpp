@@ -0,0 +1,216 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SmallVector.hpp"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct Counted
+{
+    static int NumAlive;
+
+    explicit Counted(int _Val = 0) :
+        Val{_Val}
+    {
+        ++NumAlive;
+    }
+    Counted(const Counted& Other) :
+        Val{Other.Val}
+    {
+        ++NumAlive;
+    }
+    Counted(Counted&& Other) :
+        Val{Other.Val}
+    {
+        Other.Val = -1;
+        ++NumAlive;
+    }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+
+    ~Counted()
+    {
+        --NumAlive;
+    }
+
+    int Val;
+};
+int Counted::NumAlive = 0;
+
+TEST(Common_SmallVector, InplaceStorage)
+{
+    SmallVector<int, 4> Vec;
+    EXPECT_TRUE(Vec.empty());
+    EXPECT_EQ(Vec.capacity(), size_t{4});
+    EXPECT_TRUE(Vec.IsUsingInplaceStorage());
+
+    for (int i = 0; i < 4; ++i)
+        Vec.push_back(i);
+    EXPECT_EQ(Vec.size(), size_t{4});
+    EXPECT_TRUE(Vec.IsUsingInplaceStorage());
+    EXPECT_EQ(Vec.front(), 0);
+    EXPECT_EQ(Vec.back(), 3);
+
+    Vec.push_back(4);
+    EXPECT_FALSE(Vec.IsUsingInplaceStorage());
+    EXPECT_GE(Vec.capacity(), size_t{5});
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(Vec[i], i);
+
+    Vec.pop_back();
+    EXPECT_EQ(Vec.size(), size_t{4});
+
+    int Sum = 0;
+    for (auto i : Vec)
+        Sum += i;
+    EXPECT_EQ(Sum, 0 + 1 + 2 + 3);
+
+    // Clear keeps the capacity
+    const auto Capacity = Vec.capacity();
+    Vec.clear();
+    EXPECT_TRUE(Vec.empty());
+    EXPECT_EQ(Vec.capacity(), Capacity);
+}
+
+TEST(Common_SmallVector, Constructors)
+{
+    {
+        SmallVector<int, 2> Vec{1, 2, 3};
+        ASSERT_EQ(Vec.size(), size_t{3});
+        EXPECT_EQ(Vec[2], 3);
+    }
+    {
+        SmallVector<int, 4> Vec(3, 7);
+        ASSERT_EQ(Vec.size(), size_t{3});
+        EXPECT_EQ(Vec[0], 7);
+        EXPECT_EQ(Vec[2], 7);
+    }
+    {
+        const int           Src[] = {5, 6, 7};
+        SmallVector<int, 4> Vec(std::begin(Src), std::end(Src));
+        ASSERT_EQ(Vec.size(), size_t{3});
+        EXPECT_EQ(Vec[1], 6);
+    }
+    {
+        SmallVector<int, 4> Vec(5);
+        ASSERT_EQ(Vec.size(), size_t{5});
+        EXPECT_EQ(Vec[4], 0);
+    }
+}
+
+TEST(Common_SmallVector, CopyMove)
+{
+    for (size_t Size : {2, 8})
+    {
+        SmallVector<std::string, 4> Vec;
+        for (size_t i = 0; i < Size; ++i)
+            Vec.emplace_back(std::to_string(i));
+
+        SmallVector<std::string, 4> Copy{Vec};
+        ASSERT_EQ(Copy.size(), Size);
+        EXPECT_EQ(Copy.back(), std::to_string(Size - 1));
+
+        const auto* pData = Vec.data();
+        const auto  IsInplace = Vec.IsUsingInplaceStorage();
+
+        SmallVector<std::string, 4> Moved{std::move(Vec)};
+        EXPECT_TRUE(Vec.empty());
+        EXPECT_TRUE(Vec.IsUsingInplaceStorage());
+        ASSERT_EQ(Moved.size(), Size);
+        EXPECT_EQ(Moved.back(), std::to_string(Size - 1));
+        // Heap storage is taken over without copying
+        EXPECT_EQ(Moved.data() == pData, !IsInplace);
+
+        SmallVector<std::string, 4> Assigned{"a"};
+        Assigned = Copy;
+        EXPECT_EQ(Assigned.size(), Size);
+        Assigned = std::move(Moved);
+        EXPECT_EQ(Assigned.size(), Size);
+        EXPECT_TRUE(Moved.empty());
+
+        Vec = {"x", "y"};
+        EXPECT_EQ(Vec.size(), size_t{2});
+        EXPECT_EQ(Vec[1], "y");
+    }
+}
+
+TEST(Common_SmallVector, ObjectLifetime)
+{
+    {
+        SmallVector<Counted, 2> Vec;
+        Vec.emplace_back(1);
+        Vec.emplace_back(2);
+        EXPECT_EQ(Counted::NumAlive, 2);
+
+        Vec.emplace_back(3);
+        EXPECT_EQ(Counted::NumAlive, 3);
+        EXPECT_EQ(Vec[0].Val, 1);
+        EXPECT_EQ(Vec[2].Val, 3);
+
+        Vec.resize(5, Counted{9});
+        EXPECT_EQ(Counted::NumAlive, 5);
+        EXPECT_EQ(Vec[4].Val, 9);
+
+        Vec.resize(1);
+        EXPECT_EQ(Counted::NumAlive, 1);
+
+        SmallVector<Counted, 2> Vec2{std::move(Vec)};
+        EXPECT_EQ(Counted::NumAlive, 1);
+    }
+    EXPECT_EQ(Counted::NumAlive, 0);
+
+    {
+        SmallVector<std::unique_ptr<int>, 2> Vec;
+        for (int i = 0; i < 5; ++i)
+            Vec.emplace_back(new int{i});
+        EXPECT_EQ(*Vec[4], 4);
+    }
+}
+
+TEST(Common_SmallVector, OverAligned)
+{
+    struct alignas(32) Vec4
+    {
+        float f[4];
+    };
+    SmallVector<Vec4, 3> Vec;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        Vec.emplace_back();
+        EXPECT_EQ(reinterpret_cast<size_t>(&Vec.back()) % 32, size_t{0});
+    }
+}
+
+} // namespace
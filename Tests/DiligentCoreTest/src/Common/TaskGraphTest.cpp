@@ -0,0 +1,172 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TaskGraph.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <array>
+
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void TestDiamondGraph(IThreadPool* pThreadPool)
+{
+    // Diamond graph: A runs first, B and C depend on A, D depends on both B and C
+    std::atomic<Uint32>                Counter{0};
+    std::array<Uint32, 4>              Order{};
+    std::array<std::atomic<Uint32>, 4> NumRuns{};
+
+    TaskGraph Graph;
+
+    auto MakeTask = [&](Uint32 Idx) {
+        return Graph.AddTask([&, Idx](Uint32) {
+            NumRuns[Idx].fetch_add(1);
+            Order[Idx] = Counter.fetch_add(1);
+        });
+    };
+    // Add the tasks in reverse order to make sure the graph does
+    // not rely on the order in which the tasks are added
+    const auto D = MakeTask(3);
+    const auto C = MakeTask(2);
+    const auto B = MakeTask(1);
+    const auto A = MakeTask(0);
+    Graph.AddDependency(B, A);
+    Graph.AddDependency(C, A);
+    Graph.AddDependency(D, B);
+    Graph.AddDependency(D, C);
+    EXPECT_EQ(Graph.GetNumTasks(), 4u);
+    EXPECT_FALSE(Graph.IsFinished());
+
+    ASSERT_TRUE(Graph.Execute(pThreadPool));
+    Graph.WaitForCompletion();
+    EXPECT_TRUE(Graph.IsFinished());
+
+    for (const auto& Runs : NumRuns)
+        EXPECT_EQ(Runs.load(), 1u);
+    EXPECT_EQ(Order[0], 0u);
+    EXPECT_GT(Order[3], Order[1]);
+    EXPECT_GT(Order[3], Order[2]);
+    EXPECT_EQ(Order[3], 3u);
+
+    // The graph can only be executed once
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"The task graph has already been executed"};
+        EXPECT_FALSE(Graph.Execute(pThreadPool));
+    }
+}
+
+TEST(Common_TaskGraph, Diamond)
+{
+    TestDiamondGraph(nullptr);
+
+    for (THREAD_POOL_SCHEDULER Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        ThreadPoolCreateInfo PoolCI{4};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+        for (Uint32 i = 0; i < 16; ++i)
+            TestDiamondGraph(pThreadPool);
+    }
+}
+
+TEST(Common_TaskGraph, WideGraph)
+{
+    for (THREAD_POOL_SCHEDULER Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        ThreadPoolCreateInfo PoolCI{4};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        // Layers of tasks where every task depends on all tasks of the previous layer
+        constexpr Uint32 NumLayers     = 8;
+        constexpr Uint32 TasksPerLayer = 16;
+
+        std::array<std::atomic<Uint32>, NumLayers> NumLayerTasksComplete{};
+        std::atomic<bool>                          OrderViolated{false};
+
+        TaskGraph                    Graph;
+        std::vector<TaskGraph::NodeId> PrevLayer;
+        for (Uint32 Layer = 0; Layer < NumLayers; ++Layer)
+        {
+            std::vector<TaskGraph::NodeId> CurrLayer;
+            for (Uint32 i = 0; i < TasksPerLayer; ++i)
+            {
+                const auto Task = Graph.AddTask(
+                    [&, Layer](Uint32) {
+                        if (Layer > 0 && NumLayerTasksComplete[Layer - 1].load() != TasksPerLayer)
+                            OrderViolated.store(true);
+                        NumLayerTasksComplete[Layer].fetch_add(1);
+                    },
+                    static_cast<float>(i % 3));
+                for (auto Prerequisite : PrevLayer)
+                    Graph.AddDependency(Task, Prerequisite);
+                CurrLayer.push_back(Task);
+            }
+            PrevLayer = std::move(CurrLayer);
+        }
+
+        ASSERT_TRUE(Graph.Execute(pThreadPool));
+        Graph.WaitForCompletion();
+        EXPECT_TRUE(Graph.IsFinished());
+        EXPECT_FALSE(OrderViolated.load());
+        for (const auto& NumComplete : NumLayerTasksComplete)
+            EXPECT_EQ(NumComplete.load(), TasksPerLayer);
+    }
+}
+
+TEST(Common_TaskGraph, Cycle)
+{
+    std::atomic<Uint32> NumRuns{0};
+
+    TaskGraph  Graph;
+    const auto A = Graph.AddTask([&](Uint32) { NumRuns.fetch_add(1); });
+    const auto B = Graph.AddTask([&](Uint32) { NumRuns.fetch_add(1); });
+    const auto C = Graph.AddTask([&](Uint32) { NumRuns.fetch_add(1); });
+    Graph.AddDependency(B, A);
+    Graph.AddDependency(C, B);
+    Graph.AddDependency(B, C);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"The task graph contains a cycle"};
+        EXPECT_FALSE(Graph.Execute(pThreadPool));
+    }
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(NumRuns.load(), 0u);
+}
+
+} // namespace
@@ -30,6 +30,7 @@
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "ThreadSignal.hpp"
 
@@ -362,11 +363,14 @@ TEST(Common_ThreadPool, Priorities)
 }
 
 
-TEST(Common_ThreadPool, Prerequisites)
+void TestPrerequisites(THREAD_POOL_SCHEDULER Scheduler)
 {
     for (Uint32 NumThreads : {1, 8})
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
         ASSERT_NE(pThreadPool, nullptr);
 
         constexpr Uint32               NumTasks = 16;
@@ -414,10 +418,204 @@ TEST(Common_ThreadPool, Prerequisites)
     }
 }
 
+TEST(Common_ThreadPool, Prerequisites)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ReRunTasks)
+
+// The task that counts how many times its status was checked
+class StatusCounterTask final : public ObjectBase<IAsyncTask>
 {
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+public:
+    using TBase = ObjectBase<IAsyncTask>;
+    StatusCounterTask(IReferenceCounters* pRefCounters,
+                      Threading::Signal&  WaitSignal) :
+        TBase{pRefCounters},
+        m_WaitSignal{WaitSignal}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_AsyncTask, TBase)
+
+    virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE Run(Uint32 ThreadId) override final
+    {
+        m_WaitSignal.Wait();
+        return ASYNC_TASK_STATUS_COMPLETE;
+    }
+
+    virtual void DILIGENT_CALL_TYPE Cancel() override final {}
+
+    virtual void DILIGENT_CALL_TYPE SetStatus(ASYNC_TASK_STATUS TaskStatus) override final
+    {
+        m_Status.store(TaskStatus);
+    }
+
+    virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE GetStatus() const override final
+    {
+        return m_Status.load();
+    }
+
+    virtual void DILIGENT_CALL_TYPE SetPriority(float fPriority) override final {}
+
+    virtual float DILIGENT_CALL_TYPE GetPriority() const override final
+    {
+        return 0;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE IsFinished() const override final
+    {
+        m_NumStatusChecks.fetch_add(1);
+        return m_Status.load() >= ASYNC_TASK_STATUS_CANCELLED;
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForCompletion() const override final
+    {
+        while (m_Status.load() < ASYNC_TASK_STATUS_CANCELLED)
+            std::this_thread::yield();
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitUntilRunning() const override final
+    {
+        while (m_Status.load() == ASYNC_TASK_STATUS_NOT_STARTED)
+            std::this_thread::yield();
+    }
+
+    Uint32 GetNumStatusChecks() const
+    {
+        return m_NumStatusChecks.load();
+    }
+
+private:
+    Threading::Signal& m_WaitSignal;
+
+    std::atomic<ASYNC_TASK_STATUS> m_Status{ASYNC_TASK_STATUS_NOT_STARTED};
+    mutable std::atomic<Uint32>    m_NumStatusChecks{0};
+};
+
+void TestPrerequisiteContinuations(THREAD_POOL_SCHEDULER Scheduler)
+{
+    constexpr Uint32 NumThreads    = 4;
+    constexpr Uint32 NumDependents = 32;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal                Signal;
+    RefCntAutoPtr<StatusCounterTask> pPrereq{MakeNewRCObj<StatusCounterTask>()(Signal)};
+    pThreadPool->EnqueueTask(pPrereq);
+    pPrereq->WaitUntilRunning();
+
+    std::atomic<Uint32> NumDependentsComplete{0};
+    for (Uint32 i = 0; i < NumDependents; ++i)
+    {
+        IAsyncTask* pPrereqTask = pPrereq;
+        EnqueueAsyncWork(pThreadPool, &pPrereqTask, 1,
+                         [&NumDependentsComplete](Uint32 ThreadId) //
+                         {
+                             NumDependentsComplete.fetch_add(1);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    EXPECT_EQ(pThreadPool->GetQueueSize(), NumDependents);
+
+    // Give idle workers plenty of time to poll the prerequisite
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+    // Dependent tasks must not be dequeued until the prerequisite is finished
+    EXPECT_EQ(pPrereq->GetNumStatusChecks(), 0u);
+    EXPECT_EQ(NumDependentsComplete.load(), 0u);
+
+    Signal.Trigger(true, 1);
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_EQ(NumDependentsComplete.load(), NumDependents);
+    // Every dependent checks the prerequisite status once when it is dequeued,
+    // plus the thread pool checks the status after the prerequisite has run.
+    EXPECT_LE(pPrereq->GetNumStatusChecks(), NumDependents + 1);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+}
+
+TEST(Common_ThreadPool, PrerequisiteContinuations)
+{
+    TestPrerequisiteContinuations(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+void TestRemoveWaitingTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    constexpr Uint32 NumThreads = 2;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal Signal;
+
+    // Occupy all worker threads
+    std::array<RefCntAutoPtr<WaitTask>, NumThreads> WaitTasks;
+    for (auto& Task : WaitTasks)
+    {
+        Task = MakeNewRCObj<WaitTask>()(Signal);
+        pThreadPool->EnqueueTask(Task);
+    }
+    for (auto& Task : WaitTasks)
+        Task->WaitUntilRunning();
+
+    // A -> B -> C
+    RefCntAutoPtr<DummyTask> pTaskA{MakeNewRCObj<DummyTask>()()};
+    RefCntAutoPtr<DummyTask> pTaskB{MakeNewRCObj<DummyTask>()()};
+    RefCntAutoPtr<DummyTask> pTaskC{MakeNewRCObj<DummyTask>()()};
+    pThreadPool->EnqueueTask(pTaskA);
+    {
+        IAsyncTask* pPrereq = pTaskA;
+        pThreadPool->EnqueueTask(pTaskB, &pPrereq, 1);
+    }
+    {
+        IAsyncTask* pPrereq = pTaskB;
+        pThreadPool->EnqueueTask(pTaskC, &pPrereq, 1);
+    }
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 3u);
+
+    pTaskB->SetPriority(10);
+    // Waiting tasks can be reprioritized
+    EXPECT_TRUE(pThreadPool->ReprioritizeTask(pTaskB));
+
+    // Remove the waiting task. Its dependent must still wait until it is finished.
+    EXPECT_TRUE(pThreadPool->RemoveTask(pTaskB));
+    EXPECT_FALSE(pThreadPool->RemoveTask(pTaskB));
+    EXPECT_FALSE(pThreadPool->ReprioritizeTask(pTaskB));
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 2u);
+
+    Signal.Trigger(true, 1);
+    pTaskA->WaitForCompletion();
+    EXPECT_FALSE(pTaskB->IsFinished());
+    EXPECT_FALSE(pTaskC->IsFinished());
+
+    // Enqueue B again
+    pThreadPool->EnqueueTask(pTaskB);
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_TRUE(pTaskB->IsFinished());
+    EXPECT_TRUE(pTaskC->IsFinished());
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+}
+
+TEST(Common_ThreadPool, RemoveWaitingTasks)
+{
+    TestRemoveWaitingTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+
+void TestReRunTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.Scheduler = Scheduler;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
 
     constexpr Uint32              NumTasks = 32;
@@ -442,4 +640,335 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ReRunTasks)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_EnqueueTask)
+{
+    constexpr Uint32 NumThreads = 8;
+    constexpr Uint32 NumTasks   = 256;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = THREAD_POOL_SCHEDULER_WORK_STEALING;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Every task enqueues a nested task that is placed into the queue of the same worker
+    std::vector<std::atomic<bool>> WorkComplete(NumTasks * 2);
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [i, &WorkComplete, pThreadPool = pThreadPool.RawPtr()](Uint32 ThreadId) //
+                         {
+                             EnqueueAsyncWork(pThreadPool,
+                                              [i, &WorkComplete](Uint32 ThreadId) //
+                                              {
+                                                  WorkComplete[NumTasks + i].store(true);
+                                                  return ASYNC_TASK_STATUS_COMPLETE;
+                                              });
+                             WorkComplete[i].store(true);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         },
+                         static_cast<float>(i % 4));
+    }
+
+    pThreadPool->WaitForAllTasks();
+
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), 0u);
+    for (size_t i = 0; i < WorkComplete.size(); ++i)
+        EXPECT_TRUE(WorkComplete[i]) << "i=" << i;
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_ProcessTask)
+{
+    constexpr Uint32 NumThreads = 4;
+    constexpr Uint32 NumTasks   = 64;
+
+    ThreadPoolCreateInfo PoolCI{0};
+    PoolCI.Scheduler = THREAD_POOL_SCHEDULER_WORK_STEALING;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    std::vector<std::thread> WorkerThreads(NumThreads);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        WorkerThreads[i] = std::thread{
+            [&ThreadPool = *pThreadPool, i] //
+            {
+                while (ThreadPool.ProcessTask(i, true))
+                {
+                }
+            }};
+    }
+
+    std::array<std::atomic<bool>, NumTasks> WorkComplete{};
+    for (size_t i = 0; i < WorkComplete.size(); ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [i, &WorkComplete](Uint32 ThreadId) //
+                         {
+                             WorkComplete[i].store(true);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), 0u);
+    for (size_t i = 0; i < WorkComplete.size(); ++i)
+        EXPECT_TRUE(WorkComplete[i]) << "i=" << i;
+
+    pThreadPool->StopThreads();
+    for (auto& Thread : WorkerThreads)
+    {
+        Thread.join();
+    }
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_PriorityBuckets)
+{
+    constexpr Uint32 NumTasks    = 8;
+    constexpr Uint32 RepeatCount = 10;
+
+    for (Uint32 k = 0; k < RepeatCount; ++k)
+    {
+        ThreadPoolCreateInfo PoolCI{1};
+        PoolCI.Scheduler          = THREAD_POOL_SCHEDULER_WORK_STEALING;
+        PoolCI.NumPriorityBuckets = 3;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        Threading::Signal       Signal;
+        RefCntAutoPtr<WaitTask> pWaitTask{MakeNewRCObj<WaitTask>()(Signal)};
+        pThreadPool->EnqueueTask(pWaitTask);
+        pWaitTask->WaitUntilRunning();
+
+        std::vector<int> CompletionOrder;
+        CompletionOrder.reserve(NumTasks);
+        std::array<RefCntAutoPtr<IAsyncTask>, NumTasks> Tasks;
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            Tasks[i] =
+                EnqueueAsyncWork(pThreadPool,
+                                 [&CompletionOrder, i](Uint32 ThreadId) //
+                                 {
+                                     CompletionOrder.push_back(i);
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+        }
+
+        // Bucket 1
+        Tasks[1]->SetPriority(1.5f);
+        Tasks[0]->SetPriority(1.25f);
+        EXPECT_TRUE(pThreadPool->ReprioritizeTask(Tasks[1]));
+        EXPECT_TRUE(pThreadPool->ReprioritizeTask(Tasks[0]));
+
+        // Bucket 2 (priorities above the last bucket are clamped)
+        Tasks[4]->SetPriority(100);
+        Tasks[5]->SetPriority(2);
+        Tasks[7]->SetPriority(101);
+        pThreadPool->ReprioritizeAllTasks();
+
+        EXPECT_GE(pThreadPool->GetQueueSize(), Tasks.size());
+        EXPECT_FALSE(pWaitTask->IsFinished());
+
+        Signal.Trigger(true, 1);
+
+        pThreadPool->WaitForAllTasks();
+
+        // Tasks within the same bucket are processed in FIFO order
+        const std::vector<int> ExpectedOrder = {4, 5, 7, 1, 0, 2, 3, 6};
+        ASSERT_EQ(ExpectedOrder.size(), CompletionOrder.size());
+        for (size_t i = 0; i < ExpectedOrder.size(); ++i)
+            EXPECT_EQ(ExpectedOrder[i], CompletionOrder[i]) << "i=" << i << " (N=" << k << ")";
+    }
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_RemoveTask)
+{
+    constexpr Uint32 NumThreads = 4;
+
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = THREAD_POOL_SCHEDULER_WORK_STEALING;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal Signal;
+
+    std::array<RefCntAutoPtr<WaitTask>, NumThreads> WaitTasks;
+    for (auto& Task : WaitTasks)
+    {
+        Task = MakeNewRCObj<WaitTask>()(Signal);
+        pThreadPool->EnqueueTask(Task);
+    }
+    // Make sure that all workers are busy before enqueuing the dummy tasks
+    // as any idle worker may steal a dummy task from another queue.
+    for (auto& Task : WaitTasks)
+    {
+        Task->WaitUntilRunning();
+    }
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), NumThreads);
+
+    std::array<RefCntAutoPtr<DummyTask>, 16> DummyTasks;
+    for (auto& Task : DummyTasks)
+    {
+        Task = MakeNewRCObj<DummyTask>()();
+        pThreadPool->EnqueueTask(Task);
+    }
+    EXPECT_EQ(pThreadPool->GetQueueSize(), DummyTasks.size());
+
+    for (size_t i = 0; i < DummyTasks.size(); i += 2)
+    {
+        EXPECT_TRUE(pThreadPool->RemoveTask(DummyTasks[i]));
+        // The task was already removed
+        EXPECT_FALSE(pThreadPool->RemoveTask(DummyTasks[i]));
+    }
+    EXPECT_EQ(pThreadPool->GetQueueSize(), DummyTasks.size() / 2);
+
+    for (size_t i = 1; i < DummyTasks.size(); i += 2)
+    {
+        DummyTasks[i]->SetPriority(static_cast<float>(i));
+        EXPECT_TRUE(pThreadPool->ReprioritizeTask(DummyTasks[i]));
+    }
+
+    for (auto& Task : WaitTasks)
+    {
+        // The task will not be removed since it is running
+        EXPECT_FALSE(pThreadPool->RemoveTask(Task));
+    }
+
+    Signal.Trigger(true, 1);
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    for (size_t i = 0; i < DummyTasks.size(); ++i)
+        EXPECT_EQ(DummyTasks[i]->IsFinished(), (i % 2) != 0) << "i=" << i;
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_Prerequisites)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_PrerequisiteContinuations)
+{
+    TestPrerequisiteContinuations(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_RemoveWaitingTasks)
+{
+    TestRemoveWaitingTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, WorkStealing_ReRunTasks)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, ParallelFor)
+{
+    for (THREAD_POOL_SCHEDULER Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        ThreadPoolCreateInfo PoolCI{4};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        constexpr Uint32 NumItems = 1013;
+        for (Uint32 GrainSize : {1u, 7u, 64u, NumItems, NumItems * 2})
+        {
+            std::vector<std::atomic<Uint32>> Counters(NumItems);
+            ParallelFor(pThreadPool, 10, NumItems, GrainSize,
+                        [&](Uint32 Idx) {
+                            Counters[Idx].fetch_add(1);
+                        });
+            for (Uint32 i = 0; i < NumItems; ++i)
+                EXPECT_EQ(Counters[i].load(), i >= 10 ? 1u : 0u) << "Item " << i << ", grain size " << GrainSize;
+        }
+
+        // Empty range
+        ParallelFor(pThreadPool, 5, 5, 1, [](Uint32 Idx) { ADD_FAILURE() << "Handler must not be called"; });
+
+        // Range ending at the maximum index must not overflow
+        {
+            std::atomic<Uint32> NumCalls{0};
+            ParallelFor(pThreadPool, 0xFFFFFFF0u, 0xFFFFFFFFu, 4, [&](Uint32 Idx) { NumCalls.fetch_add(1); });
+            EXPECT_EQ(NumCalls.load(), 15u);
+        }
+
+        // Nested ParallelFor called from worker threads
+        {
+            std::atomic<Uint32> NumCalls{0};
+            ParallelFor(pThreadPool, 0, 16, 1,
+                        [&](Uint32) {
+                            ParallelFor(pThreadPool, 0, 64, 4, [&](Uint32) { NumCalls.fetch_add(1); });
+                        });
+            EXPECT_EQ(NumCalls.load(), 16u * 64u);
+        }
+
+        pThreadPool->WaitForAllTasks();
+    }
+
+    // Null pool and pool with no threads
+    {
+        std::atomic<Uint32> NumCalls{0};
+        ParallelFor(nullptr, 0, 100, 8, [&](Uint32) { NumCalls.fetch_add(1); });
+        EXPECT_EQ(NumCalls.load(), 100u);
+
+        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+        ParallelFor(pThreadPool, 0, 100, 8, [&](Uint32) { NumCalls.fetch_add(1); });
+        EXPECT_EQ(NumCalls.load(), 200u);
+        // Process the helper tasks that found no work left
+        while (pThreadPool->GetQueueSize() > 0)
+            pThreadPool->ProcessTask(0, false);
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    }
+}
+
+TEST(Common_ThreadPool, CorePolicy)
+{
+    EXPECT_EQ(GetThreadPoolCoresMask(THREAD_POOL_CORE_POLICY_ANY), Uint64{0});
+
+    for (Uint32 Policy = THREAD_POOL_CORE_POLICY_ANY; Policy < THREAD_POOL_CORE_POLICY_COUNT; ++Policy)
+    {
+        constexpr Uint32 NumTasks = 16;
+
+        ThreadPoolCreateInfo PoolCI{4};
+        PoolCI.CorePolicy = static_cast<THREAD_POOL_CORE_POLICY>(Policy);
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        ASSERT_NE(pThreadPool, nullptr);
+
+        std::atomic<Uint32> NumTasksCompleted{0};
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&NumTasksCompleted](Uint32 ThreadId) //
+                             {
+                                 NumTasksCompleted.fetch_add(1);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+        EXPECT_EQ(NumTasksCompleted.load(), NumTasks) << "Policy=" << Policy;
+    }
+}
+
 } // namespace
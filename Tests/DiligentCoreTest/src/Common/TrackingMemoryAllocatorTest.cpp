@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "TrackingMemoryAllocator.hpp"
+
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <algorithm>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+const TrackingMemoryAllocator::DescriptionStats* FindStats(const std::vector<TrackingMemoryAllocator::DescriptionStats>& Stats, const char* Description)
+{
+    auto it = std::find_if(Stats.begin(), Stats.end(),
+                           [Description](const TrackingMemoryAllocator::DescriptionStats& DescStats) {
+                               return DescStats.Description == Description;
+                           });
+    return it != Stats.end() ? &*it : nullptr;
+}
+
+TEST(Common_TrackingMemoryAllocator, AllocateFree)
+{
+    TrackingMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    std::vector<std::pair<void*, size_t>> Allocations;
+    for (size_t Size : {1, 16, 100, 4096})
+    {
+        void* Ptr = Allocator.Allocate(Size, "Test A", __FILE__, __LINE__);
+        ASSERT_NE(Ptr, nullptr);
+        std::memset(Ptr, 0xCD, Size);
+        Allocations.emplace_back(Ptr, Size);
+    }
+
+    std::vector<void*> AlignedAllocations;
+    for (size_t Alignment : {16, 64, 256, 4096})
+    {
+        void* Ptr = Allocator.AllocateAligned(1000, Alignment, "Test B", __FILE__, __LINE__);
+        ASSERT_NE(Ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(Ptr) % Alignment, size_t{0});
+        std::memset(Ptr, 0xCD, 1000);
+        AlignedAllocations.emplace_back(Ptr);
+    }
+
+    {
+        const auto Stats = Allocator.GetStats();
+        ASSERT_EQ(Stats.size(), size_t{2});
+
+        const auto* pStatsA = FindStats(Stats, "Test A");
+        ASSERT_NE(pStatsA, nullptr);
+        EXPECT_EQ(pStatsA->LiveSize, Uint64{1 + 16 + 100 + 4096});
+        EXPECT_EQ(pStatsA->NumLiveAllocations, Uint64{4});
+        EXPECT_EQ(pStatsA->NumAllocations, Uint64{4});
+        EXPECT_EQ(pStatsA->NumIntervalAllocations, Uint64{4});
+
+        const auto* pStatsB = FindStats(Stats, "Test B");
+        ASSERT_NE(pStatsB, nullptr);
+        EXPECT_EQ(pStatsB->LiveSize, Uint64{4000});
+        EXPECT_EQ(pStatsB->NumLiveAllocations, Uint64{4});
+    }
+
+    for (auto& Allocation : Allocations)
+        Allocator.Free(Allocation.first);
+    for (void* Ptr : AlignedAllocations)
+        Allocator.FreeAligned(Ptr);
+
+    Allocator.StartInterval();
+    Allocator.Free(Allocator.Allocate(10, "Test B", __FILE__, __LINE__));
+
+    {
+        const auto Stats = Allocator.GetStats();
+
+        const auto* pStatsA = FindStats(Stats, "Test A");
+        ASSERT_NE(pStatsA, nullptr);
+        EXPECT_EQ(pStatsA->LiveSize, Uint64{0});
+        EXPECT_EQ(pStatsA->NumLiveAllocations, Uint64{0});
+        EXPECT_EQ(pStatsA->NumAllocations, Uint64{4});
+        EXPECT_EQ(pStatsA->TotalSize, Uint64{1 + 16 + 100 + 4096});
+        EXPECT_EQ(pStatsA->NumIntervalAllocations, Uint64{0});
+
+        const auto* pStatsB = FindStats(Stats, "Test B");
+        ASSERT_NE(pStatsB, nullptr);
+        EXPECT_EQ(pStatsB->LiveSize, Uint64{0});
+        EXPECT_EQ(pStatsB->NumAllocations, Uint64{5});
+        EXPECT_EQ(pStatsB->NumIntervalAllocations, Uint64{1});
+        EXPECT_EQ(pStatsB->IntervalSize, Uint64{10});
+    }
+
+    const auto Report = Allocator.GetReport(TrackingMemoryAllocator::ReportSortOrder::AllocationRate);
+    // Test B has more allocations in the interval and must go first
+    const auto PosA = Report.find("Test A");
+    const auto PosB = Report.find("Test B");
+    ASSERT_NE(PosA, std::string::npos);
+    ASSERT_NE(PosB, std::string::npos);
+    EXPECT_LT(PosB, PosA);
+}
+
+TEST(Common_TrackingMemoryAllocator, MultipleAllocators)
+{
+    // Allocators must not share the per-thread description cache entries
+    TrackingMemoryAllocator Allocator0{DefaultRawMemoryAllocator::GetAllocator()};
+    TrackingMemoryAllocator Allocator1{DefaultRawMemoryAllocator::GetAllocator()};
+
+    void* Ptr0 = Allocator0.Allocate(64, "Test", __FILE__, __LINE__);
+    void* Ptr1 = Allocator1.Allocate(32, "Test", __FILE__, __LINE__);
+
+    EXPECT_EQ(Allocator0.GetStats()[0].LiveSize, Uint64{64});
+    EXPECT_EQ(Allocator1.GetStats()[0].LiveSize, Uint64{32});
+
+    Allocator0.Free(Ptr0);
+    Allocator1.Free(Ptr1);
+}
+
+TEST(Common_TrackingMemoryAllocator, MultiThreaded)
+{
+    TrackingMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr Uint32 NumThreads     = 4;
+    constexpr Uint32 NumAllocations = 1000;
+
+    // Memory allocated by one thread is released by another
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+    {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&Allocator, &Allocations, t]() {
+                    for (Uint32 i = 0; i < NumAllocations; ++i)
+                        Allocations[t].push_back(Allocator.Allocate(8 + i % 64, "Test", __FILE__, __LINE__));
+                });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+    {
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&Allocator, &Allocations, t]() {
+                    for (void* Ptr : Allocations[(t + 1) % NumThreads])
+                        Allocator.Free(Ptr);
+                });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+    }
+
+    const auto Stats = Allocator.GetStats();
+    ASSERT_EQ(Stats.size(), size_t{1});
+    EXPECT_EQ(Stats[0].NumAllocations, Uint64{NumThreads * NumAllocations});
+    EXPECT_EQ(Stats[0].LiveSize, Uint64{0});
+    EXPECT_EQ(Stats[0].NumLiveAllocations, Uint64{0});
+}
+
+} // namespace
@@ -0,0 +1,406 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BCCompression.hpp"
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "GraphicsAccessories.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Reference decoders
+
+void DecodeBC1Block(const Uint8* pBlock, Uint8 (*Texels)[4])
+{
+    const Uint32 C0 = pBlock[0] | (pBlock[1] << 8);
+    const Uint32 C1 = pBlock[2] | (pBlock[3] << 8);
+
+    int Palette[4][4];
+    for (Uint32 i = 0; i < 2; ++i)
+    {
+        const Uint32 C = i == 0 ? C0 : C1;
+        const Uint32 R = (C >> 11) & 0x1F;
+        const Uint32 G = (C >> 5) & 0x3F;
+        const Uint32 B = C & 0x1F;
+
+        Palette[i][0] = (R << 3) | (R >> 2);
+        Palette[i][1] = (G << 2) | (G >> 4);
+        Palette[i][2] = (B << 3) | (B >> 2);
+        Palette[i][3] = 255;
+    }
+    for (Uint32 c = 0; c < 3; ++c)
+    {
+        if (C0 > C1)
+        {
+            Palette[2][c] = (2 * Palette[0][c] + Palette[1][c] + 1) / 3;
+            Palette[3][c] = (Palette[0][c] + 2 * Palette[1][c] + 1) / 3;
+        }
+        else
+        {
+            Palette[2][c] = (Palette[0][c] + Palette[1][c]) / 2;
+            Palette[3][c] = 0;
+        }
+    }
+    Palette[2][3] = 255;
+    Palette[3][3] = C0 > C1 ? 255 : 0;
+
+    const Uint32 IndexBits = pBlock[4] | (pBlock[5] << 8) | (pBlock[6] << 16) | (Uint32{pBlock[7]} << 24);
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const auto Idx = (IndexBits >> (i * 2)) & 3;
+        for (Uint32 c = 0; c < 4; ++c)
+            Texels[i][c] = static_cast<Uint8>(Palette[Idx][c]);
+    }
+}
+
+void DecodeBC4Block(const Uint8* pBlock, Uint8 (*Texels)[4], Uint32 Channel)
+{
+    const int A0 = pBlock[0];
+    const int A1 = pBlock[1];
+
+    int Palette[8] = {A0, A1};
+    if (A0 > A1)
+    {
+        for (int i = 2; i < 8; ++i)
+            Palette[i] = ((8 - i) * A0 + (i - 1) * A1 + 3) / 7;
+    }
+    else
+    {
+        for (int i = 2; i < 6; ++i)
+            Palette[i] = ((6 - i) * A0 + (i - 1) * A1 + 2) / 5;
+        Palette[6] = 0;
+        Palette[7] = 255;
+    }
+
+    Uint64 IndexBits = 0;
+    for (Uint32 b = 0; b < 6; ++b)
+        IndexBits |= Uint64{pBlock[2 + b]} << (b * 8);
+    for (Uint32 i = 0; i < 16; ++i)
+        Texels[i][Channel] = static_cast<Uint8>(Palette[(IndexBits >> (i * 3)) & 7]);
+}
+
+Uint32 ReadBits(const Uint8* pBlock, Uint32& Pos, Uint32 NumBits)
+{
+    Uint32 Value = 0;
+    for (Uint32 b = 0; b < NumBits; ++b, ++Pos)
+        Value |= ((pBlock[Pos >> 3] >> (Pos & 7)) & 1u) << b;
+    return Value;
+}
+
+// Decodes mode 6 BC7 block
+void DecodeBC7Block(const Uint8* pBlock, Uint8 (*Texels)[4])
+{
+    Uint32 Pos = 0;
+    ASSERT_EQ(ReadBits(pBlock, Pos, 7), 1u << 6);
+
+    Uint32 E[2][4];
+    for (Uint32 c = 0; c < 4; ++c)
+    {
+        E[0][c] = ReadBits(pBlock, Pos, 7);
+        E[1][c] = ReadBits(pBlock, Pos, 7);
+    }
+    for (Uint32 e = 0; e < 2; ++e)
+    {
+        const auto P = ReadBits(pBlock, Pos, 1);
+        for (Uint32 c = 0; c < 4; ++c)
+            E[e][c] = (E[e][c] << 1) | P;
+    }
+
+    static constexpr Uint32 Weights[] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const auto W = Weights[ReadBits(pBlock, Pos, i == 0 ? 3 : 4)];
+        for (Uint32 c = 0; c < 4; ++c)
+            Texels[i][c] = static_cast<Uint8>(((64 - W) * E[0][c] + W * E[1][c] + 32) >> 6);
+    }
+    EXPECT_EQ(Pos, 128u);
+}
+
+// Decodes the image into RGBA8
+std::vector<Uint8> Decode(TEXTURE_FORMAT Format, Uint32 Width, Uint32 Height, const std::vector<Uint8>& Data, size_t Stride)
+{
+    const auto& FmtAttribs = GetTextureFormatAttribs(Format);
+    const auto  BlockSize  = FmtAttribs.ComponentSize;
+
+    std::vector<Uint8> Image(size_t{Width} * Height * 4);
+    for (Uint32 by = 0; by < (Height + 3) / 4; ++by)
+    {
+        for (Uint32 bx = 0; bx < (Width + 3) / 4; ++bx)
+        {
+            const Uint8* pBlock = &Data[by * Stride + bx * BlockSize];
+
+            Uint8 Texels[16][4] = {};
+            for (auto& T : Texels)
+                T[3] = 255;
+
+            switch (Format)
+            {
+                case TEX_FORMAT_BC1_UNORM: DecodeBC1Block(pBlock, Texels); break;
+                case TEX_FORMAT_BC3_UNORM:
+                    DecodeBC1Block(pBlock + 8, Texels);
+                    DecodeBC4Block(pBlock, Texels, 3);
+                    break;
+                case TEX_FORMAT_BC4_UNORM: DecodeBC4Block(pBlock, Texels, 0); break;
+                case TEX_FORMAT_BC5_UNORM:
+                    DecodeBC4Block(pBlock, Texels, 0);
+                    DecodeBC4Block(pBlock + 8, Texels, 1);
+                    break;
+                case TEX_FORMAT_BC7_UNORM: DecodeBC7Block(pBlock, Texels); break;
+                default: ADD_FAILURE() << "Unexpected format";
+            }
+
+            for (Uint32 y = 0; y < 4 && by * 4 + y < Height; ++y)
+            {
+                for (Uint32 x = 0; x < 4 && bx * 4 + x < Width; ++x)
+                {
+                    for (Uint32 c = 0; c < 4; ++c)
+                        Image[((by * 4 + y) * Width + bx * 4 + x) * 4 + c] = Texels[y * 4 + x][c];
+                }
+            }
+        }
+    }
+    return Image;
+}
+
+// Smooth gradients with noise
+std::vector<Uint8> GenerateImage(Uint32 Width, Uint32 Height)
+{
+    std::vector<Uint8> Image(size_t{Width} * Height * 4);
+    FastRandInt        Rnd{0, -8, 8};
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float u = static_cast<float>(x) / static_cast<float>(Width);
+            const float v = static_cast<float>(y) / static_cast<float>(Height);
+
+            const float Values[] = {
+                255.f * u,
+                255.f * v,
+                127.5f + 127.5f * std::sin(6.f * (u + v)),
+                255.f - 127.f * u * v,
+            };
+            for (Uint32 c = 0; c < 4; ++c)
+                Image[(y * Width + x) * 4 + c] = static_cast<Uint8>(std::min(std::max(Values[c] + static_cast<float>(Rnd()), 0.f), 255.f));
+        }
+    }
+    return Image;
+}
+
+std::vector<Uint8> Compress(TEXTURE_FORMAT Format, Uint32 Width, Uint32 Height, const std::vector<Uint8>& Image, BC_COMPRESSION_QUALITY Quality, IThreadPool* pThreadPool, size_t& DstStride)
+{
+    const auto BlockSize = GetTextureFormatAttribs(Format).ComponentSize;
+    DstStride            = size_t{(Width + 3) / 4} * BlockSize;
+
+    std::vector<Uint8> Data(DstStride * ((Height + 3) / 4));
+
+    CompressBCAttribs Attribs;
+    Attribs.DstFormat   = Format;
+    Attribs.Width       = Width;
+    Attribs.Height      = Height;
+    Attribs.pSrcData    = Image.data();
+    Attribs.SrcStride   = size_t{Width} * 4;
+    Attribs.pDstData    = Data.data();
+    Attribs.DstStride   = DstStride;
+    Attribs.Quality     = Quality;
+    Attribs.pThreadPool = pThreadPool;
+    CompressBC(Attribs);
+
+    return Data;
+}
+
+double ComputeRMSE(const std::vector<Uint8>& Ref, const std::vector<Uint8>& Img, Uint32 NumChannels)
+{
+    double SumSq = 0;
+    for (size_t i = 0; i < Ref.size(); i += 4)
+    {
+        for (Uint32 c = 0; c < NumChannels; ++c)
+        {
+            const double d = static_cast<double>(Ref[i + c]) - static_cast<double>(Img[i + c]);
+            SumSq += d * d;
+        }
+    }
+    return std::sqrt(SumSq / static_cast<double>(Ref.size() / 4 * NumChannels));
+}
+
+void TestCompressionQuality(TEXTURE_FORMAT Format, Uint32 NumChannels, double MaxRMSE)
+{
+    constexpr Uint32 Width  = 64;
+    constexpr Uint32 Height = 48;
+
+    const auto Image = GenerateImage(Width, Height);
+
+    double Errors[3] = {};
+    for (auto Quality : {BC_COMPRESSION_QUALITY::Fast, BC_COMPRESSION_QUALITY::Normal, BC_COMPRESSION_QUALITY::High})
+    {
+        size_t     Stride = 0;
+        const auto Data   = Compress(Format, Width, Height, Image, Quality, nullptr, Stride);
+        const auto Result = Decode(Format, Width, Height, Data, Stride);
+
+        const auto Error                      = ComputeRMSE(Image, Result, NumChannels);
+        Errors[static_cast<size_t>(Quality)] = Error;
+        EXPECT_LT(Error, MaxRMSE) << GetTextureFormatAttribs(Format).Name << ", quality " << static_cast<int>(Quality);
+    }
+    EXPECT_LE(Errors[static_cast<size_t>(BC_COMPRESSION_QUALITY::High)], Errors[static_cast<size_t>(BC_COMPRESSION_QUALITY::Normal)]);
+}
+
+TEST(GraphicsAccessories_BCCompression, BC1)
+{
+    TestCompressionQuality(TEX_FORMAT_BC1_UNORM, 3, 8);
+}
+
+TEST(GraphicsAccessories_BCCompression, BC3)
+{
+    TestCompressionQuality(TEX_FORMAT_BC3_UNORM, 4, 8);
+}
+
+TEST(GraphicsAccessories_BCCompression, BC4)
+{
+    TestCompressionQuality(TEX_FORMAT_BC4_UNORM, 1, 4);
+}
+
+TEST(GraphicsAccessories_BCCompression, BC5)
+{
+    TestCompressionQuality(TEX_FORMAT_BC5_UNORM, 2, 4);
+}
+
+TEST(GraphicsAccessories_BCCompression, BC7)
+{
+    TestCompressionQuality(TEX_FORMAT_BC7_UNORM, 4, 6);
+}
+
+TEST(GraphicsAccessories_BCCompression, IsSupported)
+{
+    EXPECT_TRUE(IsBCCompressionSupported(TEX_FORMAT_BC1_UNORM_SRGB));
+    EXPECT_TRUE(IsBCCompressionSupported(TEX_FORMAT_BC7_UNORM_SRGB));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_BC2_UNORM));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_BC6H_UF16));
+    EXPECT_FALSE(IsBCCompressionSupported(TEX_FORMAT_RGBA8_UNORM));
+}
+
+TEST(GraphicsAccessories_BCCompression, BC1Transparency)
+{
+    constexpr Uint32 Width  = 8;
+    constexpr Uint32 Height = 8;
+
+    auto Image = GenerateImage(Width, Height);
+    for (Uint32 i = 0; i < Width * Height; ++i)
+        Image[i * 4 + 3] = (i % 3) == 0 ? 0 : 255;
+
+    size_t     Stride = 0;
+    const auto Data   = Compress(TEX_FORMAT_BC1_UNORM, Width, Height, Image, BC_COMPRESSION_QUALITY::High, nullptr, Stride);
+    const auto Result = Decode(TEX_FORMAT_BC1_UNORM, Width, Height, Data, Stride);
+    for (Uint32 i = 0; i < Width * Height; ++i)
+        EXPECT_EQ(Result[i * 4 + 3], Image[i * 4 + 3]) << "Texel " << i;
+}
+
+TEST(GraphicsAccessories_BCCompression, SolidColor)
+{
+    constexpr Uint32   Width  = 4;
+    constexpr Uint32   Height = 4;
+    std::vector<Uint8> Image(Width * Height * 4);
+    for (Uint32 i = 0; i < Width * Height; ++i)
+    {
+        Image[i * 4 + 0] = 37;
+        Image[i * 4 + 1] = 201;
+        Image[i * 4 + 2] = 90;
+        Image[i * 4 + 3] = 255;
+    }
+
+    for (auto Quality : {BC_COMPRESSION_QUALITY::Fast, BC_COMPRESSION_QUALITY::Normal, BC_COMPRESSION_QUALITY::High})
+    {
+        size_t Stride = 0;
+
+        // BC4 and BC5 store solid values exactly
+        auto Result = Decode(TEX_FORMAT_BC5_UNORM, Width, Height, Compress(TEX_FORMAT_BC5_UNORM, Width, Height, Image, Quality, nullptr, Stride), Stride);
+        EXPECT_EQ(ComputeRMSE(Image, Result, 2), 0);
+
+        // BC7 endpoints have 8 bits with the P-bit shared between all channels
+        Result = Decode(TEX_FORMAT_BC7_UNORM, Width, Height, Compress(TEX_FORMAT_BC7_UNORM, Width, Height, Image, Quality, nullptr, Stride), Stride);
+        EXPECT_LE(ComputeRMSE(Image, Result, 4), 1);
+    }
+}
+
+TEST(GraphicsAccessories_BCCompression, IncompleteBlocks)
+{
+    // Incomplete blocks must be encoded as if the edge texels were replicated
+    constexpr Uint32 Width  = 7;
+    constexpr Uint32 Height = 5;
+
+    const auto Image = GenerateImage(Width, Height);
+
+    std::vector<Uint8> PaddedImage(8 * 8 * 4);
+    for (Uint32 y = 0; y < 8; ++y)
+    {
+        for (Uint32 x = 0; x < 8; ++x)
+        {
+            const auto SrcX = std::min(x, Width - 1);
+            const auto SrcY = std::min(y, Height - 1);
+            for (Uint32 c = 0; c < 4; ++c)
+                PaddedImage[(y * 8 + x) * 4 + c] = Image[(SrcY * Width + SrcX) * 4 + c];
+        }
+    }
+
+    for (auto Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC4_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        size_t     Stride = 0;
+        const auto Data   = Compress(Format, Width, Height, Image, BC_COMPRESSION_QUALITY::High, nullptr, Stride);
+        const auto Ref    = Compress(Format, 8, 8, PaddedImage, BC_COMPRESSION_QUALITY::High, nullptr, Stride);
+        EXPECT_EQ(Data, Ref) << GetTextureFormatAttribs(Format).Name;
+    }
+}
+
+TEST(GraphicsAccessories_BCCompression, ThreadPool)
+{
+    constexpr Uint32 Width  = 256;
+    constexpr Uint32 Height = 200;
+
+    const auto Image = GenerateImage(Width, Height);
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (auto Format : {TEX_FORMAT_BC1_UNORM, TEX_FORMAT_BC3_UNORM, TEX_FORMAT_BC5_UNORM, TEX_FORMAT_BC7_UNORM})
+    {
+        size_t     Stride = 0;
+        const auto Ref    = Compress(Format, Width, Height, Image, BC_COMPRESSION_QUALITY::Normal, nullptr, Stride);
+        const auto Data   = Compress(Format, Width, Height, Image, BC_COMPRESSION_QUALITY::Normal, pThreadPool, Stride);
+        EXPECT_EQ(Data, Ref) << GetTextureFormatAttribs(Format).Name;
+    }
+}
+
+} // namespace
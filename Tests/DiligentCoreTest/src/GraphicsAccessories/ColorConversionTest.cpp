@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2019-2023 Diligent Graphics LLC
+ *  Copyright 2015-2019 Egor Yusov
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ColorConversion.h"
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Odd number of texels to test the tails of SIMD loops
+constexpr size_t NumTestTexels = 1031;
+
+std::vector<Uint8> GenerateRGBA8(size_t NumTexels)
+{
+    std::vector<Uint8> Data(NumTexels * 4);
+    FastRandInt        Rnd{0, 0, 255};
+    for (auto& c : Data)
+        c = static_cast<Uint8>(Rnd());
+    return Data;
+}
+
+TEST(GraphicsAccessories_ColorConversion, SRGBA8ToLinearRGBA32F)
+{
+    const auto         Src = GenerateRGBA8(NumTestTexels);
+    std::vector<float> Dst(Src.size());
+    SRGBA8ToLinearRGBA32F(Src.data(), Dst.data(), NumTestTexels);
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        const float Ref = (i % 4) == 3 ?
+            static_cast<float>(Src[i]) / 255.f :
+            GammaToLinear(static_cast<float>(Src[i]) / 255.f);
+        EXPECT_NEAR(Dst[i], Ref, 1e-6f) << "Element " << i;
+    }
+}
+
+TEST(GraphicsAccessories_ColorConversion, LinearRGBA32FToSRGBA8)
+{
+    std::vector<float> Src(NumTestTexels * 4);
+    FastRandFloat      Rnd{0, -0.1f, 1.1f};
+    for (auto& f : Src)
+        f = Rnd();
+    // Exact boundary values
+    Src[0] = 0;
+    Src[1] = 1;
+    Src[2] = 0.5f;
+    Src[3] = 0.5f;
+
+    std::vector<Uint8> Dst(Src.size());
+    LinearRGBA32FToSRGBA8(Src.data(), Dst.data(), NumTestTexels);
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        const float f = std::min(std::max(Src[i], 0.f), 1.f);
+        if ((i % 4) == 3)
+        {
+            EXPECT_EQ(Dst[i], static_cast<Uint8>(f * 255.f + 0.5f)) << "Element " << i;
+        }
+        else
+        {
+            const int Ref = static_cast<int>(LinearToGamma(f) * 255.f + 0.5f);
+            EXPECT_LE(std::abs(static_cast<int>(Dst[i]) - Ref), 1) << "Element " << i;
+        }
+    }
+    EXPECT_EQ(Dst[0], 0);
+    EXPECT_EQ(Dst[1], 255);
+}
+
+TEST(GraphicsAccessories_ColorConversion, RGBA16F)
+{
+    const auto          Src = GenerateRGBA8(NumTestTexels);
+    std::vector<Uint16> Half(Src.size());
+    RGBA8ToRGBA16F(Src.data(), Half.data(), NumTestTexels);
+
+    // Half precision is sufficient for the exact round trip
+    std::vector<Uint8> Dst(Src.size());
+    RGBA16FToRGBA8(Half.data(), Dst.data(), NumTestTexels);
+    EXPECT_TRUE(Dst == Src);
+
+    // clang-format off
+    const Uint16 SpecialHalves[] =
+    {
+        0x0000, // 0
+        0x3C00, // 1
+        0x3800, // 0.5
+        0xBC00, // -1
+        0x4000, // 2
+        0x7C00, // +Inf
+        0xFC00, // -Inf
+        0x0001, // Smallest denormal
+        0x3555, // ~0.333
+        0x8000, // -0
+        0x2C00, // 0.0625
+        0x3B00, // 0.875
+    };
+    const Uint8 RefValues[] =
+    {
+        0, 255, 128, 0, 255, 255, 0, 0, 85, 0, 16, 223
+    };
+    // clang-format on
+    static_assert(_countof(SpecialHalves) == _countof(RefValues), "Inconsistent array sizes");
+    static_assert(_countof(SpecialHalves) % 4 == 0, "The number of values must be a multiple of 4");
+
+    std::vector<Uint8> SpecialDst(_countof(SpecialHalves));
+    RGBA16FToRGBA8(SpecialHalves, SpecialDst.data(), _countof(SpecialHalves) / 4);
+    for (size_t i = 0; i < _countof(SpecialHalves); ++i)
+        EXPECT_EQ(SpecialDst[i], RefValues[i]) << "Half value 0x" << std::hex << SpecialHalves[i];
+}
+
+TEST(GraphicsAccessories_ColorConversion, PremultiplyAlphaRGBA8)
+{
+    // Test all color-alpha combinations. Three extra texels test the tail of the SIMD loop.
+    std::vector<Uint8> Data((256 * 256 + 3) * 4);
+    for (Uint32 a = 0; a < 256; ++a)
+    {
+        for (Uint32 c = 0; c < 256; ++c)
+        {
+            auto* pTexel = &Data[(a * 256 + c) * 4];
+            pTexel[0]    = static_cast<Uint8>(c);
+            pTexel[1]    = static_cast<Uint8>(255 - c);
+            pTexel[2]    = static_cast<Uint8>(c / 2);
+            pTexel[3]    = static_cast<Uint8>(a);
+        }
+    }
+    const auto Src = Data;
+    PremultiplyAlphaRGBA8(Data.data(), Data.size() / 4);
+    for (size_t i = 0; i < Data.size(); ++i)
+    {
+        const Uint32 a   = Src[(i & ~size_t{3}) + 3];
+        const Uint32 Ref = (i % 4) == 3 ? Src[i] : static_cast<Uint32>(std::floor(Src[i] * a / 255.0 + 0.5));
+        EXPECT_EQ(Data[i], Ref) << "Element " << i;
+    }
+}
+
+TEST(GraphicsAccessories_ColorConversion, PremultiplyAlphaRGBA32F)
+{
+    std::vector<float> Data(NumTestTexels * 4);
+    FastRandFloat      Rnd{0, 0.f, 4.f};
+    for (auto& f : Data)
+        f = Rnd();
+
+    const auto Src = Data;
+    PremultiplyAlphaRGBA32F(Data.data(), NumTestTexels);
+    for (size_t i = 0; i < Data.size(); ++i)
+    {
+        const float Ref = (i % 4) == 3 ? Src[i] : Src[i] * Src[(i & ~size_t{3}) + 3];
+        EXPECT_EQ(Data[i], Ref) << "Element " << i;
+    }
+}
+
+} // namespace
@@ -465,4 +465,143 @@ TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
     }
 }
 
+
+void VerifyNoOverlap(const std::vector<Region>& Regions)
+{
+    for (size_t i = 0; i < Regions.size(); ++i)
+    {
+        const auto& R0 = Regions[i];
+        if (R0.IsEmpty())
+            continue;
+        for (size_t j = i + 1; j < Regions.size(); ++j)
+        {
+            const auto& R1 = Regions[j];
+            if (R1.IsEmpty())
+                continue;
+            const bool Overlap = R0.x < R1.x + R1.width && R1.x < R0.x + R0.width && R0.y < R1.y + R1.height && R1.y < R0.y + R0.height;
+            EXPECT_FALSE(Overlap) << "Regions " << R0 << " and " << R1 << " overlap";
+        }
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_Allocate)
+{
+    DynamicAtlasManager Mgr{32, 32, DynamicAtlasManager::PackingStrategy::Skyline};
+    EXPECT_EQ(Mgr.GetPackingStrategy(), DynamicAtlasManager::PackingStrategy::Skyline);
+    EXPECT_TRUE(Mgr.IsEmpty());
+
+    auto R0 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(R0, Region(0, 0, 8, 4));
+    auto R1 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(R1, Region(8, 0, 8, 8));
+    auto R2 = Mgr.Allocate(16, 2);
+    EXPECT_EQ(R2, Region(16, 0, 16, 2));
+    // The lowest segment is [16, 32) at height 2
+    auto R3 = Mgr.Allocate(16, 4);
+    EXPECT_EQ(R3, Region(16, 2, 16, 4));
+    auto R4 = Mgr.Allocate(16, 4);
+    EXPECT_EQ(R4, Region(16, 6, 16, 4));
+    // Rests on R1, the space above R0 is kept
+    auto R5 = Mgr.Allocate(16, 4);
+    EXPECT_EQ(R5, Region(0, 8, 16, 4));
+    // Reuses the space above R0
+    auto R6 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(R6, Region(0, 4, 8, 4));
+
+    EXPECT_TRUE(Mgr.Allocate(33, 1).IsEmpty());
+    EXPECT_TRUE(Mgr.Allocate(1, 33).IsEmpty());
+    EXPECT_TRUE(Mgr.Allocate(32, 32).IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32 - 32 - 64 - 32 - 64 - 64 - 64 - 32});
+
+    // Freed regions are reused
+    Mgr.Free(std::move(R1));
+    auto R7 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(R7, Region(8, 0, 8, 8));
+
+    for (auto* R : {&R0, &R2, &R3, &R4, &R5, &R6, &R7})
+        Mgr.Free(std::move(*R));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{32 * 32});
+
+    // The skyline is reset when the atlas is empty
+    auto R8 = Mgr.Allocate(32, 32);
+    EXPECT_EQ(R8, Region(0, 0, 32, 32));
+    Mgr.Free(std::move(R8));
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_AllocateRandom)
+{
+    DynamicAtlasManager Mgr{256, 256, DynamicAtlasManager::PackingStrategy::Skyline};
+    const Uint32        NumIterations = 10;
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        FastRandInt         rnd{static_cast<unsigned int>(i), 1, 16};
+        std::vector<Region> Regions(i * 64);
+        for (auto& R : Regions)
+        {
+            R = Mgr.Allocate(rnd(), rnd());
+        }
+        VerifyNoOverlap(Regions);
+
+        // Free every other region and allocate again
+        for (size_t r = 0; r < Regions.size(); r += 2)
+        {
+            if (!Regions[r].IsEmpty())
+                Mgr.Free(std::move(Regions[r]));
+        }
+        for (size_t r = 0; r < Regions.size(); r += 2)
+        {
+            Regions[r] = Mgr.Allocate(rnd(), rnd());
+        }
+        VerifyNoOverlap(Regions);
+
+        for (auto& R : Regions)
+        {
+            if (!R.IsEmpty())
+                Mgr.Free(std::move(R));
+        }
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+// Packs glyph-like regions of similar height until the atlas is full and returns the atlas occupancy
+double PackGlyphs(DynamicAtlasManager::PackingStrategy Strategy, Uint32 AtlasSize, Uint32 Seed)
+{
+    DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Strategy};
+
+    FastRandInt rndW{Seed, 4, 24};
+    FastRandInt rndH{Seed + 1, 14, 18};
+
+    std::vector<Region> Regions;
+    Regions.reserve(size_t{AtlasSize} * AtlasSize / (4 * 14));
+
+    for (Uint32 NumFailures = 0; NumFailures < 16;)
+    {
+        auto R = Mgr.Allocate(rndW(), rndH());
+        if (!R.IsEmpty())
+            Regions.emplace_back(std::move(R));
+        else
+            ++NumFailures;
+    }
+
+    const double Occupancy = 1.0 - static_cast<double>(Mgr.GetTotalFreeArea()) / (static_cast<double>(AtlasSize) * static_cast<double>(AtlasSize));
+
+    for (auto& R : Regions)
+        Mgr.Free(std::move(R));
+    EXPECT_TRUE(Mgr.IsEmpty());
+
+    return Occupancy;
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, PackingOccupancy)
+{
+    constexpr Uint32 AtlasSize = 512;
+
+    for (Uint32 Seed = 0; Seed < 3; ++Seed)
+    {
+        EXPECT_GT(PackGlyphs(DynamicAtlasManager::PackingStrategy::Skyline, AtlasSize, Seed), 0.9) << "Seed " << Seed;
+        EXPECT_GT(PackGlyphs(DynamicAtlasManager::PackingStrategy::Guillotine, AtlasSize, Seed), 0.85) << "Seed " << Seed;
+    }
+}
+
 } // namespace
@@ -234,6 +234,31 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetSurfaceTransformString)
 #undef TEST_SURFACE_TRANSFORM_ENUM
 }
 
+TEST(GraphicsAccessories_GraphicsAccessories, GetSurfacePretransformMatrix)
+{
+    auto Transform = [](SURFACE_TRANSFORM SrfTransform, const float2& Pos) {
+        const float4 Res = float4{Pos.x, Pos.y, 0.5f, 1} * GetSurfacePretransformMatrix(SrfTransform);
+        EXPECT_EQ(Res.z, 0.5f);
+        EXPECT_EQ(Res.w, 1.f);
+        return float2{Res.x, Res.y};
+    };
+
+    // Clockwise rotation of the top right corner
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_IDENTITY, float2(1, 0.5f)), float2(1, 0.5f));
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_ROTATE_90, float2(1, 0.5f)), float2(0.5f, -1));
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_ROTATE_180, float2(1, 0.5f)), float2(-1, -0.5f));
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_ROTATE_270, float2(1, 0.5f)), float2(-0.5f, 1));
+
+    // Mirroring is applied before the rotation
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_HORIZONTAL_MIRROR, float2(1, 0.5f)), float2(-1, 0.5f));
+    EXPECT_EQ(Transform(SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90, float2(1, 0.5f)), float2(0.5f, 1));
+
+    EXPECT_FALSE(IsSurfaceTransformRotated90(SURFACE_TRANSFORM_IDENTITY));
+    EXPECT_TRUE(IsSurfaceTransformRotated90(SURFACE_TRANSFORM_ROTATE_90));
+    EXPECT_FALSE(IsSurfaceTransformRotated90(SURFACE_TRANSFORM_ROTATE_180));
+    EXPECT_TRUE(IsSurfaceTransformRotated90(SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270));
+}
+
 TEST(GraphicsAccessories_GraphicsAccessories, GetTextureFormatAttribs)
 {
     auto CheckFormatSize = [](TEXTURE_FORMAT* begin, TEXTURE_FORMAT* end, Uint32 RefSize) //
@@ -703,7 +728,7 @@ TEST(GraphicsAccessories_GraphicsAccessories, PipelineTypeFromShaderStages)
 
 TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineResourceFlagsString)
 {
-    static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 4), "Please add a test for the new flag here");
+    static_assert(PIPELINE_RESOURCE_FLAG_LAST == (1u << 5), "Please add a test for the new flag here");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NONE, true).c_str(), "PIPELINE_RESOURCE_FLAG_NONE");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NONE).c_str(), "UNKNOWN");
@@ -712,11 +737,13 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineResourceFlagsString)
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER, true).c_str(), "PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER, true).c_str(), "PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT, true).c_str(), "PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT");
+    EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS, true).c_str(), "PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS).c_str(), "NO_DYNAMIC_BUFFERS");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER).c_str(), "COMBINED_SAMPLER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_FORMATTED_BUFFER).c_str(), "FORMATTED_BUFFER");
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_GENERAL_INPUT_ATTACHMENT).c_str(), "GENERAL_INPUT_ATTACHMENT");
+    EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_INLINE_CONSTANTS).c_str(), "INLINE_CONSTANTS");
 
     EXPECT_STREQ(GetPipelineResourceFlagsString(PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS | PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER, true).c_str(),
                  "PIPELINE_RESOURCE_FLAG_NO_DYNAMIC_BUFFERS|PIPELINE_RESOURCE_FLAG_COMBINED_SAMPLER");
@@ -744,6 +771,19 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineShadingRateFlagsString)
     EXPECT_STREQ(GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAG_PER_PRIMITIVE | PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED).c_str(), "PER_PRIMITIVE | TEXTURE_BASED");
 }
 
+TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineDynamicStateFlagsString)
+{
+    static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x10, "Please update the test below to handle the new pipeline dynamic state flag");
+
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_NONE).c_str(), "NONE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE).c_str(), "CULL_MODE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE).c_str(), "FRONT_FACE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY).c_str(), "PRIMITIVE_TOPOLOGY");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_DEPTH).c_str(), "DEPTH");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_STENCIL).c_str(), "STENCIL");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_ALL).c_str(), "CULL_MODE | FRONT_FACE | PRIMITIVE_TOPOLOGY | DEPTH | STENCIL");
+}
+
 TEST(GraphicsAccessories_GraphicsAccessories, GetTextureComponentMappingString)
 {
     EXPECT_STREQ(GetTextureComponentMappingString(TextureComponentMapping::Identity()).c_str(), "rgba");
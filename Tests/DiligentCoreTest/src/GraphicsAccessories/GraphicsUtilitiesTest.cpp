@@ -28,6 +28,8 @@
 #include "GraphicsUtilities.h"
 #include "FastRand.hpp"
 #include "ColorConversion.h"
+#include "ThreadPool.hpp"
+#include "GraphicsAccessories.hpp"
 
 #include <vector>
 #include <array>
@@ -575,4 +577,33 @@ TEST(GraphicsTools_CalculateMipLevel, sRGB_BOX_AVE)
     EXPECT_TRUE(CoarseData == RefCoarseData);
 }
 
+TEST(GraphicsTools_CalculateMipLevel, ThreadPool)
+{
+    const Uint32 FineWidth   = 1023;
+    const Uint32 FineHeight  = 517;
+    const Uint32 NumChannels = 4;
+
+    std::vector<Uint8> FineData(FineWidth * FineHeight * NumChannels);
+
+    FastRandInt rnd(0, 0, 255);
+    for (auto& c : FineData)
+        c = static_cast<Uint8>(rnd());
+
+    const Uint32 CoarseWidth  = FineWidth / 2;
+    const Uint32 CoarseHeight = FineHeight / 2;
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    for (auto fmt : {TEX_FORMAT_RGBA8_UNORM, TEX_FORMAT_RGBA8_UNORM_SRGB, TEX_FORMAT_RGBA8_UINT})
+    {
+        std::vector<Uint8> RefCoarseData(CoarseWidth * CoarseHeight * NumChannels);
+        ComputeMipLevel({fmt, FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels, RefCoarseData.data(), CoarseWidth * NumChannels, MIP_FILTER_TYPE_DEFAULT, 0.25f});
+
+        std::vector<Uint8> CoarseData(RefCoarseData.size());
+        ComputeMipLevel({fmt, FineWidth, FineHeight, FineData.data(), FineWidth * NumChannels, CoarseData.data(), CoarseWidth * NumChannels, MIP_FILTER_TYPE_DEFAULT, 0.25f, pThreadPool});
+        EXPECT_TRUE(CoarseData == RefCoarseData) << GetTextureFormatAttribs(fmt).Name;
+    }
+}
+
 } // namespace
@@ -26,6 +26,9 @@
  */
 
 #include <memory>
+#include <thread>
+#include <vector>
+#include <atomic>
 
 #include "ResourceReleaseQueue.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
@@ -128,4 +131,148 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 }
 
+TEST(GraphicsAccessories_ResourceReleaseQueue, Sharded)
+{
+    struct Resource
+    {
+        std::atomic<int>& NumDestroyed;
+
+        explicit Resource(std::atomic<int>& _NumDestroyed) :
+            NumDestroyed{_NumDestroyed}
+        {}
+        ~Resource()
+        {
+            NumDestroyed.fetch_add(1);
+        }
+    };
+
+    std::atomic<int> NumDestroyed{0};
+    {
+        ShardedResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator(), 4);
+        EXPECT_EQ(Queue.GetNumShards(), 4u);
+
+        Queue.SafeReleaseResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 0);
+        Queue.SafeReleaseResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 1);
+        Queue.DiscardResource(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 1);
+        EXPECT_EQ(Queue.GetStaleResourceCount(), 2u);
+        EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), 1u);
+
+        // Only the resource released before command list 0 is moved to the release queue
+        Queue.DiscardStaleResources(0, 2);
+        EXPECT_EQ(Queue.GetStaleResourceCount(), 1u);
+        EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), 2u);
+
+        Queue.Purge(0);
+        EXPECT_EQ(NumDestroyed, 0);
+
+        Queue.Purge(1);
+        EXPECT_EQ(NumDestroyed, 1);
+
+        Queue.DiscardStaleResources(1, 3);
+        Queue.Purge(2);
+        EXPECT_EQ(NumDestroyed, 2);
+
+        Queue.Purge(3);
+        EXPECT_EQ(NumDestroyed, 3);
+        EXPECT_EQ(Queue.GetStaleResourceCount(), 0u);
+        EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), 0u);
+
+        // Shared resource is destroyed only when it is released by all queues
+        ShardedResourceReleaseQueue<DynamicStaleResourceWrapper> Queue2(DefaultRawMemoryAllocator::GetAllocator());
+
+        auto Wrapper = ShardedResourceReleaseQueue<DynamicStaleResourceWrapper>::CreateWrapper(std::unique_ptr<Resource>{new Resource{NumDestroyed}}, 2);
+        Queue.SafeReleaseResource(Wrapper, 0);
+        Queue2.SafeReleaseResource(Wrapper, 0);
+        Wrapper.GiveUpOwnership();
+
+        Queue.DiscardStaleResources(0, 4);
+        Queue2.DiscardStaleResources(0, 4);
+        Queue.Purge(4);
+        EXPECT_EQ(NumDestroyed, 3);
+        Queue2.Purge(4);
+        EXPECT_EQ(NumDestroyed, 4);
+    }
+}
+
+TEST(GraphicsAccessories_ResourceReleaseQueue, ShardedStress)
+{
+    // Every resource records the fence value it is associated with and
+    // verifies that it is never destroyed before this value is completed.
+    struct Resource
+    {
+        const Uint64               FenceValue;
+        const std::atomic<Uint64>& CompletedFenceValue;
+        std::atomic<int>&          NumDestroyed;
+        std::atomic<int>&          NumPrematurelyDestroyed;
+
+        ~Resource()
+        {
+            if (CompletedFenceValue.load() < FenceValue)
+                NumPrematurelyDestroyed.fetch_add(1);
+            NumDestroyed.fetch_add(1);
+        }
+    };
+
+    constexpr Uint32 NumProducers        = 16;
+    constexpr int    NumResourcesPerProd = 4096;
+
+    std::atomic<Uint64> NextCmdListNumber{0};
+    std::atomic<Uint64> CompletedFenceValue{0};
+    std::atomic<int>    NumDestroyed{0};
+    std::atomic<int>    NumPrematurelyDestroyed{0};
+    std::atomic<Uint32> NumRunningProducers{NumProducers};
+
+    ShardedResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator());
+
+    std::vector<std::thread> Producers;
+    for (Uint32 t = 0; t < NumProducers; ++t)
+    {
+        Producers.emplace_back([&, t]() {
+            for (int i = 0; i < NumResourcesPerProd; ++i)
+            {
+                if ((i + t) % 4 == 0)
+                {
+                    // Discard directly with the fence value that has not been completed yet
+                    const Uint64 FenceValue = CompletedFenceValue.load() + 1 + (i % 3);
+                    Queue.DiscardResource(std::unique_ptr<Resource>{new Resource{FenceValue, CompletedFenceValue, NumDestroyed, NumPrematurelyDestroyed}}, FenceValue);
+                }
+                else
+                {
+                    // Command list N is submitted with fence value N + 5 (see the submission loop below)
+                    const Uint64 CmdListNumber = NextCmdListNumber.load();
+                    Queue.SafeReleaseResource(std::unique_ptr<Resource>{new Resource{CmdListNumber + 5, CompletedFenceValue, NumDestroyed, NumPrematurelyDestroyed}}, CmdListNumber);
+                }
+            }
+            NumRunningProducers.fetch_add(-1);
+        });
+    }
+
+    // Emulate the submission thread: submit command lists, associate stale resources with
+    // fence values and complete fences with a lag.
+    Uint64 FenceValue = 1;
+    while (NumRunningProducers.load() > 0)
+    {
+        const Uint64 CmdListNumber = NextCmdListNumber.fetch_add(1);
+        EXPECT_EQ(CmdListNumber + 1, FenceValue);
+        Queue.DiscardStaleResources(CmdListNumber, FenceValue + 4);
+        if (FenceValue > 2)
+            CompletedFenceValue.store(FenceValue - 2);
+        Queue.Purge(CompletedFenceValue.load());
+        ++FenceValue;
+        std::this_thread::yield();
+    }
+
+    for (auto& Producer : Producers)
+        Producer.join();
+
+    Queue.DiscardStaleResources(NextCmdListNumber.load(), FenceValue + 4);
+    CompletedFenceValue.store(FenceValue + 4);
+    Queue.Purge(CompletedFenceValue.load());
+
+    EXPECT_EQ(Queue.GetStaleResourceCount(), 0u);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), 0u);
+    EXPECT_EQ(NumDestroyed, static_cast<int>(NumProducers) * NumResourcesPerProd);
+    EXPECT_EQ(NumPrematurelyDestroyed, 0);
+}
+
 } // namespace
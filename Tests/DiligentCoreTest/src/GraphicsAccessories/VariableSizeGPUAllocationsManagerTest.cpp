@@ -29,6 +29,10 @@
 #include "DefaultRawMemoryAllocator.hpp"
 #include "PlatformDefinitions.h"
 
+#include <random>
+#include <vector>
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 using namespace Diligent;
@@ -36,14 +40,15 @@ using namespace Diligent;
 namespace
 {
 
-TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
+template <typename AllocationsManagerType>
+void TestAllocateFree()
 {
     auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
 
-    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using OffsetType = typename AllocationsManagerType::OffsetType;
 
     {
-        VariableSizeAllocationsManager ListMgr(128, Allocator);
+        AllocationsManagerType ListMgr(128, Allocator);
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
         EXPECT_EQ(ListMgr.GetFreeSize(), size_t{128});
         EXPECT_EQ(ListMgr.GetUsedSize(), size_t{0});
@@ -137,7 +142,7 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
     }
 
     {
-        VariableSizeAllocationsManager ListMgr(128, Allocator);
+        AllocationsManagerType ListMgr(128, Allocator);
 
         auto a1 = ListMgr.Allocate(64, 1);
         EXPECT_EQ(a1.UnalignedOffset, OffsetType{0});
@@ -145,7 +150,7 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
 
         auto a2 = ListMgr.Allocate(128, 1);
-        EXPECT_EQ(a2, VariableSizeAllocationsManager::Allocation::InvalidAllocation());
+        EXPECT_EQ(a2, AllocationsManagerType::Allocation::InvalidAllocation());
 
         ListMgr.Extend(128);
         EXPECT_EQ(ListMgr.GetNumFreeBlocks(), size_t{1});
@@ -178,10 +183,11 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
     }
 }
 
-TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
+template <typename AllocationsManagerType>
+void TestFreeOrder()
 {
     auto& Allocator  = DefaultRawMemoryAllocator::GetAllocator();
-    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+    using OffsetType = typename AllocationsManagerType::OffsetType;
 
     {
         const auto NumAllocs = 6;
@@ -192,9 +198,9 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
         do
         {
             ++NumPerms;
-            VariableSizeAllocationsManager ListMgr(NumAllocs * 4, Allocator);
+            AllocationsManagerType ListMgr(NumAllocs * 4, Allocator);
 
-            VariableSizeAllocationsManager::Allocation allocs[NumAllocs];
+            typename AllocationsManagerType::Allocation allocs[NumAllocs];
             for (size_t a = 0; a < NumAllocs; ++a)
             {
                 allocs[a] = ListMgr.Allocate(4, 1);
@@ -210,13 +216,14 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
     }
 }
 
-TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
+template <typename GPUAllocationsManagerType>
+void TestGPUFree()
 {
     auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
     {
-        VariableSizeGPUAllocationsManager ListMgr(128, Allocator);
+        GPUAllocationsManagerType ListMgr(128, Allocator);
 
-        VariableSizeGPUAllocationsManager::Allocation al[16];
+        typename GPUAllocationsManagerType::Allocation al[16];
         for (size_t o = 0; o < _countof(al); ++o)
             al[o] = ListMgr.Allocate(8, 4);
         EXPECT_TRUE(ListMgr.IsFull());
@@ -249,4 +256,96 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateFree)
+{
+    TestAllocateFree<VariableSizeAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, FreeOrder)
+{
+    TestFreeOrder<VariableSizeAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
+{
+    TestGPUFree<VariableSizeGPUAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, TLSF_AllocateFree)
+{
+    TestAllocateFree<TLSFAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, TLSF_FreeOrder)
+{
+    TestFreeOrder<TLSFAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, TLSF_Free)
+{
+    TestGPUFree<TLSFGPUAllocationsManager>();
+}
+
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, TLSF_Random)
+{
+    auto& Allocator  = DefaultRawMemoryAllocator::GetAllocator();
+    using OffsetType = TLSFAllocationsManager::OffsetType;
+
+    constexpr OffsetType MaxSize = 1 << 20;
+
+    // Use small initial capacity to test growing of the block pool and the offset table
+    TLSFAllocationsManager Mgr{TLSFAllocationsManager::CreateInfo{Allocator, MaxSize, false, 4}};
+
+    std::mt19937                                    Gen{0};
+    std::uniform_int_distribution<OffsetType>       SizeDistr{1, 4096};
+    std::uniform_int_distribution<Uint32>           AlignmentDistr{0, 6};
+    std::vector<TLSFAllocationsManager::Allocation> Allocations;
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (Allocations.empty() || Gen() % 3 != 0)
+        {
+            const OffsetType Size      = SizeDistr(Gen);
+            const OffsetType Alignment = OffsetType{1} << AlignmentDistr(Gen);
+
+            auto Alloc = Mgr.Allocate(Size, Alignment);
+            if (!Alloc.IsValid())
+                continue;
+            EXPECT_GE(Alloc.Size, Size);
+            EXPECT_LE(AlignUp(Alloc.UnalignedOffset, Alignment) + Size, Alloc.UnalignedOffset + Alloc.Size);
+            EXPECT_LE(Alloc.UnalignedOffset + Alloc.Size, MaxSize);
+            Allocations.emplace_back(Alloc);
+        }
+        else
+        {
+            const size_t Idx = Gen() % Allocations.size();
+            std::swap(Allocations[Idx], Allocations.back());
+            Mgr.Free(std::move(Allocations.back()));
+            Allocations.pop_back();
+        }
+
+        if (i % 1000 == 0)
+        {
+            // Check that allocations do not overlap
+            auto Sorted = Allocations;
+            std::sort(Sorted.begin(), Sorted.end(), [](const auto& lhs, const auto& rhs) { return lhs.UnalignedOffset < rhs.UnalignedOffset; });
+            OffsetType UsedSize = 0;
+            for (size_t a = 0; a < Sorted.size(); ++a)
+            {
+                if (a > 0)
+                {
+                    EXPECT_LE(Sorted[a - 1].UnalignedOffset + Sorted[a - 1].Size, Sorted[a].UnalignedOffset);
+                }
+                UsedSize += Sorted[a].Size;
+            }
+            EXPECT_EQ(Mgr.GetUsedSize(), UsedSize);
+        }
+    }
+
+    for (auto& Alloc : Allocations)
+        Mgr.Free(std::move(Alloc));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetNumFreeBlocks(), size_t{1});
+    EXPECT_EQ(Mgr.GetMaxFreeBlockSize(), MaxSize);
+}
+
 } // namespace
@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+#include "../../../../Graphics/GraphicsEngine/include/PSOSerializer.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlob.h"
+#include "ThreadSignal.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+using DeviceType = DeviceObjectArchive::DeviceType;
+
+SerializedData MakeShaderData(size_t Size, Uint8 Seed)
+{
+    SerializedData Data{Size, GetRawAllocator()};
+    for (size_t i = 0; i < Size; ++i)
+        Data.Ptr<Uint8>()[i] = static_cast<Uint8>(Seed + i);
+    return Data;
+}
+
+RefCntAutoPtr<IDataBlob> CreateTestArchiveData()
+{
+    DeviceObjectArchive Archive;
+
+    auto& VkShaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    VkShaders.emplace_back(MakeShaderData(13, 1));
+    VkShaders.emplace_back(MakeShaderData(64, 2));
+    VkShaders.emplace_back(MakeShaderData(7, 3));
+
+    auto& GLShaders = Archive.GetDeviceShaders(DeviceType::OpenGL);
+    GLShaders.emplace_back(MakeShaderData(21, 4));
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+void CheckShaderData(const SerializedData& Data, size_t Size, Uint8 Seed)
+{
+    ASSERT_EQ(Data.Size(), Size);
+    for (size_t i = 0; i < Size; ++i)
+        EXPECT_EQ(Data.Ptr<const Uint8>()[i], static_cast<Uint8>(Seed + i));
+}
+
+TEST(DeviceObjectArchiveTest, LazyShaderLoading)
+{
+    auto pData = CreateTestArchiveData();
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+
+    EXPECT_FALSE(Archive.AreDeviceShadersLoaded(DeviceType::Vulkan));
+    EXPECT_FALSE(Archive.AreDeviceShadersLoaded(DeviceType::OpenGL));
+    // There is nothing to load for devices without shaders
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::Direct3D12));
+
+    CheckShaderData(Archive.GetSerializedShader(DeviceType::Vulkan, 1), 64, 2);
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::Vulkan));
+    EXPECT_FALSE(Archive.AreDeviceShadersLoaded(DeviceType::OpenGL));
+
+    CheckShaderData(Archive.GetSerializedShader(DeviceType::Vulkan, 0), 13, 1);
+    CheckShaderData(Archive.GetSerializedShader(DeviceType::Vulkan, 2), 7, 3);
+    EXPECT_FALSE(Archive.GetSerializedShader(DeviceType::Vulkan, 3));
+    EXPECT_FALSE(Archive.GetSerializedShader(DeviceType::Direct3D12, 0));
+
+    CheckShaderData(Archive.GetSerializedShader(DeviceType::OpenGL, 0), 21, 4);
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::OpenGL));
+}
+
+TEST(DeviceObjectArchiveTest, RemoveAndMergeUnloadedShaders)
+{
+    auto pData = CreateTestArchiveData();
+    ASSERT_NE(pData, nullptr);
+
+    DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+    Archive.RemoveDeviceData(DeviceType::OpenGL);
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::OpenGL));
+    EXPECT_FALSE(Archive.GetSerializedShader(DeviceType::OpenGL, 0));
+
+    const DeviceObjectArchive Src{DeviceObjectArchive::CreateInfo{pData}};
+    Archive.Merge(Src);
+
+    // Vulkan shaders are identical and must not be duplicated
+    const auto& VkShaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    ASSERT_EQ(VkShaders.size(), 3u);
+    CheckShaderData(VkShaders[1], 64, 2);
+
+    const auto& GLShaders = Archive.GetDeviceShaders(DeviceType::OpenGL);
+    ASSERT_EQ(GLShaders.size(), 1u);
+    CheckShaderData(GLShaders[0], 21, 4);
+
+    // Re-serialize the merged archive and make sure the shaders survive the round trip
+    RefCntAutoPtr<IDataBlob> pMergedData;
+    Archive.Serialize(&pMergedData);
+    ASSERT_NE(pMergedData, nullptr);
+
+    DeviceObjectArchive Merged{DeviceObjectArchive::CreateInfo{pMergedData}};
+    EXPECT_EQ(Merged.GetDeviceShaders(DeviceType::Vulkan).size(), 3u);
+    CheckShaderData(Merged.GetSerializedShader(DeviceType::Vulkan, 2), 7, 3);
+}
+
+SerializedData MakeShaderIndices(const std::vector<Uint32>& Indices)
+{
+    const DeviceObjectArchive::ShaderIndexArray IndexArray{Indices.data(), static_cast<Uint32>(Indices.size())};
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    PSOSerializer<SerializerMode::Measure>::SerializeShaderIndices(MeasureSer, IndexArray, nullptr);
+    auto Data = MeasureSer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> Ser{Data};
+    PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, IndexArray, nullptr);
+    return Data;
+}
+
+std::vector<Uint32> ReadShaderIndices(const SerializedData& Data)
+{
+    DynamicLinearAllocator Allocator{GetRawAllocator()};
+
+    DeviceObjectArchive::ShaderIndexArray IndexArray;
+    Serializer<SerializerMode::Read>      Ser{Data};
+    EXPECT_TRUE(PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, IndexArray, &Allocator));
+    return {IndexArray.pIndices, IndexArray.pIndices + IndexArray.Count};
+}
+
+Uint32 ReadShaderIndex(const SerializedData& Data)
+{
+    Uint32                           Index = ~0u;
+    Serializer<SerializerMode::Read> Ser{Data};
+    EXPECT_TRUE(Ser(Index));
+    return Index;
+}
+
+TEST(DeviceObjectArchiveTest, DeduplicateShaders)
+{
+    using ResourceType = DeviceObjectArchive::ResourceType;
+
+    DeviceObjectArchive Archive;
+
+    auto& VkShaders = Archive.GetDeviceShaders(DeviceType::Vulkan);
+    VkShaders.emplace_back(MakeShaderData(16, 1));
+    VkShaders.emplace_back(MakeShaderData(32, 2));
+    VkShaders.emplace_back(MakeShaderData(16, 1));
+    VkShaders.emplace_back(MakeShaderData(48, 3));
+    VkShaders.emplace_back(MakeShaderData(32, 2));
+
+    {
+        Uint32                              Index = 4;
+        Serializer<SerializerMode::Measure> MeasureSer;
+        MeasureSer(Index);
+        auto& DevData = Archive.GetResourceData(ResourceType::StandaloneShader, "Shader").DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)];
+        DevData       = MeasureSer.AllocateData(GetRawAllocator());
+        Serializer<SerializerMode::Write> Ser{DevData};
+        Ser(Index);
+    }
+    Archive.GetResourceData(ResourceType::GraphicsPipeline, "PSO").DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = MakeShaderIndices({2, 3, 4});
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    {
+        const DeviceObjectArchive Deduplicated{DeviceObjectArchive::CreateInfo{pData}};
+
+        const auto& Shaders = Deduplicated.GetDeviceShaders(DeviceType::Vulkan);
+        ASSERT_EQ(Shaders.size(), 3u);
+        CheckShaderData(Shaders[0], 16, 1);
+        CheckShaderData(Shaders[1], 32, 2);
+        CheckShaderData(Shaders[2], 48, 3);
+
+        EXPECT_EQ(ReadShaderIndex(Deduplicated.GetDeviceSpecificData(ResourceType::StandaloneShader, "Shader", DeviceType::Vulkan)), 1u);
+        EXPECT_EQ(ReadShaderIndices(Deduplicated.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "PSO", DeviceType::Vulkan)), (std::vector<Uint32>{0, 2, 1}));
+    }
+
+    // The source archive must not be modified
+    EXPECT_EQ(Archive.GetDeviceShaders(DeviceType::Vulkan).size(), 5u);
+    EXPECT_EQ(ReadShaderIndices(Archive.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "PSO", DeviceType::Vulkan)), (std::vector<Uint32>{2, 3, 4}));
+
+    {
+        DeviceObjectArchive Dst;
+        Dst.GetResourceData(ResourceType::GraphicsPipeline, "PSO");
+        Dst.AppendDeviceData(Archive, DeviceType::Vulkan);
+
+        EXPECT_EQ(Dst.GetDeviceShaders(DeviceType::Vulkan).size(), 3u);
+        EXPECT_EQ(ReadShaderIndices(Dst.GetDeviceSpecificData(ResourceType::GraphicsPipeline, "PSO", DeviceType::Vulkan)), (std::vector<Uint32>{0, 2, 1}));
+    }
+}
+
+TEST(DeviceObjectArchiveTest, ParallelShaderLoading)
+{
+    auto pData = CreateTestArchiveData();
+    ASSERT_NE(pData, nullptr);
+
+    const DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData}};
+
+    Threading::Signal StartSignal;
+
+    std::vector<std::thread> Threads(8);
+    for (auto& Thread : Threads)
+    {
+        Thread = std::thread{
+            [&]() {
+                StartSignal.Wait();
+                CheckShaderData(Archive.GetSerializedShader(DeviceType::Vulkan, 1), 64, 2);
+                CheckShaderData(Archive.GetSerializedShader(DeviceType::OpenGL, 0), 21, 4);
+            }};
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::Vulkan));
+    EXPECT_TRUE(Archive.AreDeviceShadersLoaded(DeviceType::OpenGL));
+}
+
+} // namespace
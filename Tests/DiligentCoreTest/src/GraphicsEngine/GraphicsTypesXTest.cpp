@@ -846,6 +846,8 @@ struct DumyShader final : IShader
     virtual void DILIGENT_CALL_TYPE GetBytecode(const void** ppBytecode, Uint64& Size) const override final {}
 
     virtual SHADER_STATUS DILIGENT_CALL_TYPE GetStatus(bool WaitForCompletion) override final { return SHADER_STATUS_UNINITIALIZED; }
+
+    virtual Float64 DILIGENT_CALL_TYPE GetCompileTime() const override final { return 0; }
 };
 
 TEST(GraphicsTypesXTest, RayTracingPipelineStateCreateInfoX)
@@ -1059,6 +1061,7 @@ TEST(GraphicsTypesXTest, GraphicsPipelineStateCreateInfoX)
         .SetNumViewports(7)
         .SetSubpassIndex(6)
         .SetShadingRateFlags(PIPELINE_SHADING_RATE_FLAG_PER_PRIMITIVE)
+        .SetDynamicStateFlags(PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE | PIPELINE_DYNAMIC_STATE_FLAG_DEPTH)
         .AddRenderTarget(TEX_FORMAT_RGBA8_UNORM_SRGB)
         .AddRenderTarget(TEX_FORMAT_RGBA32_FLOAT)
         .SetDepthFormat(TEX_FORMAT_D32_FLOAT)
@@ -1078,25 +1081,26 @@ TEST(GraphicsTypesXTest, GraphicsPipelineStateCreateInfoX)
         DescX.SetRenderPass(nullptr);
     }
 
-    Ref.PSODesc.Name                      = "Test Name2";
-    Ref.Flags                             = PSO_CREATE_FLAG_DONT_REMAP_SHADER_RESOURCES;
-    Ref.PSODesc.ResourceLayout            = ResLayoutDescX;
-    Ref.PSODesc.ImmediateContextMask      = ImmediateCtxMask;
-    Ref.PSODesc.SRBAllocationGranularity  = SRBAllocationGranularity;
-    Ref.GraphicsPipeline.BlendDesc        = BS_AlphaBlend;
-    Ref.GraphicsPipeline.SampleMask       = 0x12345678;
-    Ref.GraphicsPipeline.RasterizerDesc   = RS_WireFillNoCull;
-    Ref.GraphicsPipeline.DepthStencilDesc = DSS_DisableDepth;
-    Ref.GraphicsPipeline.InputLayout      = InputLayoutX;
-    Ref.GraphicsPipeline.NumViewports     = 7;
-    Ref.GraphicsPipeline.NumRenderTargets = 2;
-    Ref.GraphicsPipeline.SubpassIndex     = 6;
-    Ref.GraphicsPipeline.ShadingRateFlags = PIPELINE_SHADING_RATE_FLAG_PER_PRIMITIVE;
-    Ref.GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM_SRGB;
-    Ref.GraphicsPipeline.RTVFormats[1]    = TEX_FORMAT_RGBA32_FLOAT;
-    Ref.GraphicsPipeline.DSVFormat        = TEX_FORMAT_D32_FLOAT;
-    Ref.GraphicsPipeline.SmplDesc         = {1, 5};
-    Ref.GraphicsPipeline.NodeMask         = 0x7531;
+    Ref.PSODesc.Name                       = "Test Name2";
+    Ref.Flags                              = PSO_CREATE_FLAG_DONT_REMAP_SHADER_RESOURCES;
+    Ref.PSODesc.ResourceLayout             = ResLayoutDescX;
+    Ref.PSODesc.ImmediateContextMask       = ImmediateCtxMask;
+    Ref.PSODesc.SRBAllocationGranularity   = SRBAllocationGranularity;
+    Ref.GraphicsPipeline.BlendDesc         = BS_AlphaBlend;
+    Ref.GraphicsPipeline.SampleMask        = 0x12345678;
+    Ref.GraphicsPipeline.RasterizerDesc    = RS_WireFillNoCull;
+    Ref.GraphicsPipeline.DepthStencilDesc  = DSS_DisableDepth;
+    Ref.GraphicsPipeline.InputLayout       = InputLayoutX;
+    Ref.GraphicsPipeline.NumViewports      = 7;
+    Ref.GraphicsPipeline.NumRenderTargets  = 2;
+    Ref.GraphicsPipeline.SubpassIndex      = 6;
+    Ref.GraphicsPipeline.ShadingRateFlags  = PIPELINE_SHADING_RATE_FLAG_PER_PRIMITIVE;
+    Ref.GraphicsPipeline.DynamicStateFlags = PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE | PIPELINE_DYNAMIC_STATE_FLAG_DEPTH;
+    Ref.GraphicsPipeline.RTVFormats[0]     = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    Ref.GraphicsPipeline.RTVFormats[1]     = TEX_FORMAT_RGBA32_FLOAT;
+    Ref.GraphicsPipeline.DSVFormat         = TEX_FORMAT_D32_FLOAT;
+    Ref.GraphicsPipeline.SmplDesc          = {1, 5};
+    Ref.GraphicsPipeline.NodeMask          = 0x7531;
     EXPECT_STREQ(DescX.PSODesc.Name, Ref.PSODesc.Name);
     EXPECT_EQ(DescX, Ref);
 
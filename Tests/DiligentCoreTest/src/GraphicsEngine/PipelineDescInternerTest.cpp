@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "PipelineDescInterner.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(PipelineDescInternerTest, ResourceLayout)
+{
+    PipelineDescInterner Interner;
+
+    std::string Names[] = {"g_Tex", "g_Buff", "g_Sampler"};
+
+    // clang-format off
+    ShaderResourceVariableDesc Vars[] =
+    {
+        {SHADER_TYPE_PIXEL,  Names[0].c_str(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VERTEX, Names[1].c_str(), SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    ImmutableSamplerDesc ImtblSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, Names[2].c_str(), SamplerDesc{}}
+    };
+    // clang-format on
+
+    PipelineResourceLayoutDesc Layout;
+    Layout.NumVariables         = _countof(Vars);
+    Layout.Variables            = Vars;
+    Layout.NumImmutableSamplers = _countof(ImtblSamplers);
+    Layout.ImmutableSamplers    = ImtblSamplers;
+
+    auto pData0 = Interner.InternResourceLayout(Layout);
+    ASSERT_NE(pData0, nullptr);
+    EXPECT_EQ(pData0->Desc, Layout);
+    EXPECT_NE(pData0->Desc.Variables, Vars);
+    EXPECT_NE(pData0->Desc.Variables[0].Name, Vars[0].Name);
+    EXPECT_NE(pData0->Desc.ImmutableSamplers[0].SamplerOrTextureName, ImtblSamplers[0].SamplerOrTextureName);
+    EXPECT_GT(Interner.GetMemorySize(), Uint64{0});
+
+    // The interned data must not reference the source strings
+    std::string OrigName = Names[0];
+    Names[0]             = "xxxxx";
+    EXPECT_STREQ(pData0->Desc.Variables[0].Name, OrigName.c_str());
+    Names[0] = OrigName;
+
+    // Identical layout in different memory must return the same data
+    {
+        std::string                Names2[] = {"g_Tex", "g_Buff"};
+        ShaderResourceVariableDesc Vars2[]  = {Vars[0], Vars[1]};
+        Vars2[0].Name                       = Names2[0].c_str();
+        Vars2[1].Name                       = Names2[1].c_str();
+
+        PipelineResourceLayoutDesc Layout2 = Layout;
+        Layout2.Variables                  = Vars2;
+
+        auto pData1 = Interner.InternResourceLayout(Layout2);
+        EXPECT_EQ(pData1, pData0);
+    }
+
+    // Different layout
+    {
+        PipelineResourceLayoutDesc Layout2 = Layout;
+        Layout2.DefaultVariableType        = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+
+        auto pData1 = Interner.InternResourceLayout(Layout2);
+        ASSERT_NE(pData1, nullptr);
+        EXPECT_NE(pData1, pData0);
+        EXPECT_EQ(pData1->Desc, Layout2);
+    }
+
+    // The data is released with the last reference
+    const auto Size = Interner.GetMemorySize();
+    pData0.reset();
+    EXPECT_LT(Interner.GetMemorySize(), Size);
+}
+
+TEST(PipelineDescInternerTest, InputLayout)
+{
+    PipelineDescInterner Interner;
+
+    // clang-format off
+    LayoutElement Elems[] =
+    {
+        LayoutElement{0, 0, 3, VT_FLOAT32, False, 0},
+        LayoutElement{1, 0, 2, VT_FLOAT32, False, 12},
+        LayoutElement{2, 1, 4, VT_UINT8,   True,  0},
+    };
+    // clang-format on
+    const Uint32 Strides[] = {20, 4};
+
+    auto pData0 = Interner.InternInputLayout(InputLayoutDesc{Elems, _countof(Elems)}, Strides, _countof(Strides));
+    ASSERT_NE(pData0, nullptr);
+    EXPECT_EQ(pData0->Desc, (InputLayoutDesc{Elems, _countof(Elems)}));
+    EXPECT_NE(pData0->Desc.LayoutElements, Elems);
+    ASSERT_EQ(pData0->BufferSlotsUsed, 2u);
+    EXPECT_EQ(pData0->pStrides[0], 20u);
+    EXPECT_EQ(pData0->pStrides[1], 4u);
+
+    LayoutElement Elems2[] = {Elems[0], Elems[1], Elems[2]};
+
+    auto pData1 = Interner.InternInputLayout(InputLayoutDesc{Elems2, _countof(Elems2)}, Strides, _countof(Strides));
+    EXPECT_EQ(pData1, pData0);
+
+    Elems2[2].NumComponents = 2;
+
+    auto pData2 = Interner.InternInputLayout(InputLayoutDesc{Elems2, _countof(Elems2)}, Strides, _countof(Strides));
+    EXPECT_NE(pData2, pData0);
+}
+
+} // namespace
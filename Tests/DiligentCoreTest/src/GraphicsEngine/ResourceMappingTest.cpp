@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/ResourceMappingImpl.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/ResourceBindingPlan.hpp"
+#include "DeviceObject.h"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class DummyDeviceObject final : public ObjectBase<IDeviceObject>
+{
+public:
+    DummyDeviceObject(IReferenceCounters* pRefCounters) :
+        ObjectBase<IDeviceObject>{pRefCounters}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceObject, ObjectBase<IDeviceObject>)
+
+    virtual const DeviceObjectAttribs& DILIGENT_CALL_TYPE GetDesc() const override final { return m_Desc; }
+    virtual Int32 DILIGENT_CALL_TYPE                      GetUniqueID() const override final { return 0; }
+    virtual void DILIGENT_CALL_TYPE                       SetUserData(IObject* pUserData) override final {}
+    virtual IObject* DILIGENT_CALL_TYPE                   GetUserData() const override final { return nullptr; }
+
+private:
+    DeviceObjectAttribs m_Desc;
+};
+
+RefCntAutoPtr<ResourceMappingImpl> CreateResourceMapping()
+{
+    return RefCntAutoPtr<ResourceMappingImpl>{MakeNewRCObj<ResourceMappingImpl>()(DefaultRawMemoryAllocator::GetAllocator())};
+}
+
+TEST(ResourceMappingTest, StateId)
+{
+    auto pMapping1 = CreateResourceMapping();
+    auto pMapping2 = CreateResourceMapping();
+    EXPECT_NE(pMapping1->GetStateId(), pMapping2->GetStateId());
+
+    RefCntAutoPtr<IDeviceObject> pObjA{MakeNewRCObj<DummyDeviceObject>()()};
+    RefCntAutoPtr<IDeviceObject> pObjB{MakeNewRCObj<DummyDeviceObject>()()};
+
+    Uint64 StateId = pMapping1->GetStateId();
+
+    pMapping1->AddResource("A", pObjA, false);
+    EXPECT_NE(pMapping1->GetStateId(), StateId);
+    StateId = pMapping1->GetStateId();
+
+    // Adding the same object does not modify the mapping
+    pMapping1->AddResource("A", pObjA, false);
+    EXPECT_EQ(pMapping1->GetStateId(), StateId);
+
+    pMapping1->AddResource("A", pObjB, false);
+    EXPECT_NE(pMapping1->GetStateId(), StateId);
+    StateId = pMapping1->GetStateId();
+
+    // Removing a resource that is not in the mapping does not modify it
+    pMapping1->RemoveResourceByName("B", 0);
+    EXPECT_EQ(pMapping1->GetStateId(), StateId);
+
+    pMapping1->RemoveResourceByName("A", 0);
+    EXPECT_NE(pMapping1->GetStateId(), StateId);
+    EXPECT_EQ(pMapping1->GetSize(), size_t{0});
+
+    RefCntAutoPtr<IResourceMapping> pMappingImpl{pMapping2, ResourceMappingImpl::IID_InternalImpl};
+    EXPECT_EQ(pMappingImpl.RawPtr(), pMapping2.RawPtr());
+}
+
+TEST(ResourceMappingTest, BindingPlan)
+{
+    auto pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pObjA{MakeNewRCObj<DummyDeviceObject>()()};
+    RefCntAutoPtr<IDeviceObject> pObjB{MakeNewRCObj<DummyDeviceObject>()()};
+    RefCntAutoPtr<IDeviceObject> pObjC{MakeNewRCObj<DummyDeviceObject>()()};
+
+    pMapping->AddResource("A", pObjA, false);
+    IDeviceObject* ppArr[] = {pObjB, pObjC};
+    pMapping->AddResourceArray("Arr", 0, ppArr, _countof(ppArr), false);
+
+    ResourceBindingPlan Plan;
+
+    auto Resolve = [&](IDeviceObject* pRefA, IDeviceObject* pRefArr0, IDeviceObject* pRefArr1) {
+        Plan.Begin(pMapping);
+        IDeviceObject* const* ppA = Plan.Resolve("A", 1);
+        EXPECT_EQ(ppA[0], pRefA);
+        IDeviceObject* const* ppMissing = Plan.Resolve("Missing", 1);
+        EXPECT_EQ(ppMissing[0], nullptr);
+        IDeviceObject* const* ppArrObjs = Plan.Resolve("Arr", 3);
+        EXPECT_EQ(ppArrObjs[0], pRefArr0);
+        EXPECT_EQ(ppArrObjs[1], pRefArr1);
+        EXPECT_EQ(ppArrObjs[2], nullptr);
+        Plan.End();
+    };
+
+    EXPECT_FALSE(Plan.IsValid());
+    Resolve(pObjA, pObjB, pObjC);
+    EXPECT_TRUE(Plan.IsValid());
+
+    // The plan is reused while the mapping is not modified
+    Resolve(pObjA, pObjB, pObjC);
+    EXPECT_TRUE(Plan.IsValid());
+
+    // Modifying the mapping invalidates the plan
+    pMapping->AddResource("A", pObjC, false);
+    Plan.Begin(pMapping);
+    EXPECT_FALSE(Plan.IsValid());
+    Plan.End();
+    Plan.Invalidate();
+
+    Resolve(pObjC, pObjB, pObjC);
+    pMapping->RemoveResourceByName("Arr", 1);
+    Resolve(pObjC, pObjB, nullptr);
+
+    // Binding another mapping invalidates the plan
+    auto pMapping2 = CreateResourceMapping();
+    pMapping2->AddResource("A", pObjB, false);
+    Plan.Begin(pMapping2);
+    EXPECT_FALSE(Plan.IsValid());
+    EXPECT_EQ(Plan.Resolve("A", 1)[0], pObjB.RawPtr());
+    Plan.End();
+    EXPECT_TRUE(Plan.IsValid());
+}
+
+} // namespace
@@ -29,6 +29,8 @@
 #include "DefaultShaderSourceStreamFactory.h"
 #include "gtest/gtest.h"
 
+#include <string>
+
 using namespace Diligent;
 
 namespace
@@ -72,6 +74,40 @@ TEST(BytecodeCacheTest, Basic)
     }
 }
 
+TEST(BytecodeCacheTest, Compressed)
+{
+    BytecodeCacheCreateInfo CI{RENDER_DEVICE_TYPE_VULKAN};
+    CI.CompressBytecode = true;
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache(CI, &pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_COMPUTE;
+    ShaderCI.Desc.Name       = "TestName";
+    ShaderCI.Source          = "SomeCode";
+
+    std::string Data;
+    for (int i = 0; i < 256; ++i)
+        Data += "TestString" + std::to_string(i % 8);
+    RefCntAutoPtr<IDataBlob> pBytecodeSaved = DataBlobImpl::Create(Data.length(), Data.c_str());
+    pCache->AddBytecode(ShaderCI, pBytecodeSaved);
+
+    RefCntAutoPtr<IDataBlob> pShaderDataBlob;
+    pCache->Store(&pShaderDataBlob);
+    ASSERT_NE(pShaderDataBlob, nullptr);
+    EXPECT_LT(pShaderDataBlob->GetSize(), Data.length());
+    pCache->Clear();
+    EXPECT_TRUE(pCache->Load(pShaderDataBlob));
+
+    RefCntAutoPtr<IDataBlob> pBytecodeLoaded;
+    pCache->GetBytecode(ShaderCI, &pBytecodeLoaded);
+    ASSERT_NE(pBytecodeLoaded, nullptr);
+    EXPECT_EQ(pBytecodeSaved->GetSize(), pBytecodeLoaded->GetSize());
+    EXPECT_EQ(memcmp(pBytecodeSaved->GetConstDataPtr(), pBytecodeLoaded->GetConstDataPtr(), pBytecodeLoaded->GetSize()), 0);
+}
+
 TEST(BytecodeCacheTest, RemoveBytecode)
 {
     RefCntAutoPtr<IBytecodeCache> pCache;
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+#include "ConstantBufferWriter.hpp"
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// struct LightAttribs
+// {
+//     float4 Color;
+//     float3 Direction;
+//     float  Intensity;
+// };
+//
+// cbuffer cbTest
+// {
+//     float4x4     g_Transform;
+//     float        g_Time;
+//     uint         g_Flags;
+//     float2       g_Padding;
+//     float        g_Weights[3];
+//     LightAttribs g_Lights[2];
+// };
+constexpr ShaderCodeVariableDesc LightMembers[] = {
+    {"Color", "float4", SHADER_CODE_VARIABLE_CLASS_VECTOR, SHADER_CODE_BASIC_TYPE_FLOAT, 1, 4, 0},
+    {"Direction", "float3", SHADER_CODE_VARIABLE_CLASS_VECTOR, SHADER_CODE_BASIC_TYPE_FLOAT, 1, 3, 16},
+    {"Intensity", "float", SHADER_CODE_BASIC_TYPE_FLOAT, 28},
+};
+
+constexpr ShaderCodeVariableDesc Variables[] = {
+    {"g_Transform", "float4x4", SHADER_CODE_VARIABLE_CLASS_MATRIX_COLUMNS, SHADER_CODE_BASIC_TYPE_FLOAT, 4, 4, 0},
+    {"g_Time", "float", SHADER_CODE_BASIC_TYPE_FLOAT, 64},
+    {"g_Flags", "uint", SHADER_CODE_BASIC_TYPE_UINT, 68},
+    {"g_Padding", "float2", SHADER_CODE_VARIABLE_CLASS_VECTOR, SHADER_CODE_BASIC_TYPE_FLOAT, 1, 2, 72},
+    {"g_Weights", "float", SHADER_CODE_BASIC_TYPE_FLOAT, 80, 3},
+    {"g_Lights", "LightAttribs", _countof(LightMembers), LightMembers, 128, 2},
+};
+
+constexpr ShaderCodeBufferDesc BufferDesc{192, _countof(Variables), Variables};
+
+TEST(GraphicsTools_ConstantBufferWriter, Layout)
+{
+    ConstantBufferWriter Writer{BufferDesc};
+    EXPECT_EQ(Writer.GetSize(), 192u);
+    // 5 top-level fields + 2 lights with 3 members
+    EXPECT_EQ(Writer.GetNumFields(), 11u);
+
+    auto CheckField = [&](const char* Name, Uint32 Offset, Uint32 Size, Uint32 ArraySize) {
+        const Uint32 Id = Writer.GetFieldId(Name);
+        ASSERT_NE(Id, ConstantBufferWriter::InvalidFieldId) << Name;
+        const ConstantBufferWriter::FieldInfo& Field = Writer.GetField(Id);
+        EXPECT_EQ(Field.Name, Name);
+        EXPECT_EQ(Field.Offset, Offset) << Name;
+        EXPECT_EQ(Field.Size, Size) << Name;
+        EXPECT_EQ(Field.ArraySize, ArraySize) << Name;
+    };
+    CheckField("g_Transform", 0, 64, 1);
+    CheckField("g_Time", 64, 4, 1);
+    CheckField("g_Flags", 68, 4, 1);
+    CheckField("g_Weights", 80, 4, 3);
+    CheckField("g_Lights[0].Color", 128, 16, 1);
+    CheckField("g_Lights[0].Intensity", 156, 4, 1);
+    CheckField("g_Lights[1].Color", 160, 16, 1);
+    CheckField("g_Lights[1].Direction", 176, 12, 1);
+
+    EXPECT_EQ(Writer.GetField(Writer.GetFieldId("g_Weights")).ArrayStride, 16u);
+    EXPECT_EQ(Writer.GetFieldId("g_Lights"), ConstantBufferWriter::InvalidFieldId);
+    EXPECT_EQ(Writer.GetFieldId("g_Unknown"), ConstantBufferWriter::InvalidFieldId);
+}
+
+TEST(GraphicsTools_ConstantBufferWriter, SetData)
+{
+    ConstantBufferWriter Writer{BufferDesc};
+    // The buffer is initially dirty so that the first upload writes all data
+    EXPECT_TRUE(Writer.IsDirty());
+
+    const Uint32 TimeId    = Writer.GetFieldId("g_Time");
+    const Uint32 WeightsId = Writer.GetFieldId("g_Weights");
+    const Uint32 ColorId   = Writer.GetFieldId("g_Lights[1].Color");
+
+    EXPECT_FALSE(Writer.Set(TimeId, 0.f)) << "Setting the same value must not change the data";
+    EXPECT_TRUE(Writer.Set(TimeId, 1.5f));
+    EXPECT_TRUE(Writer.Set(WeightsId, 2.f, 2));
+    EXPECT_TRUE(Writer.Set(ColorId, float4{1, 2, 3, 4}));
+    EXPECT_TRUE(Writer.Set("g_Lights[0].Intensity", 5.f));
+    EXPECT_FALSE(Writer.Set("g_Lights[0].Intensity", 5.f));
+
+    const Uint8* pData = static_cast<const Uint8*>(Writer.GetData());
+    EXPECT_EQ(*reinterpret_cast<const float*>(pData + 64), 1.5f);
+    EXPECT_EQ(*reinterpret_cast<const float*>(pData + 80 + 2 * 16), 2.f);
+    EXPECT_EQ(*reinterpret_cast<const float4*>(pData + 160), (float4{1, 2, 3, 4}));
+    EXPECT_EQ(*reinterpret_cast<const float*>(pData + 156), 5.f);
+}
+
+} // namespace
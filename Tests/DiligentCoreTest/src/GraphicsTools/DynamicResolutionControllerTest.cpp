@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+#include "DynamicResolutionController.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+DynamicResolutionControllerCreateInfo GetTestCI()
+{
+    DynamicResolutionControllerCreateInfo CI;
+    CI.TargetFrameTime         = 0.010;
+    CI.MinScale                = 0.5f;
+    CI.MaxScale                = 1.0f;
+    CI.ScaleStep               = 0.25f;
+    CI.DecreaseThreshold       = 0.95f;
+    CI.IncreaseThreshold       = 0.85f;
+    CI.NumFramesToAverage      = 4;
+    CI.MinFramesBetweenChanges = 8;
+    CI.Width                   = 1920;
+    CI.Height                  = 1080;
+    return CI;
+}
+
+// Feeds the frame time until the scale changes; returns the number of frames
+Uint32 FeedUntilChange(DynamicResolutionController& Controller, double FrameTime, Uint32 MaxFrames = 100)
+{
+    for (Uint32 i = 1; i <= MaxFrames; ++i)
+    {
+        if (Controller.Update(FrameTime))
+            return i;
+    }
+    return 0;
+}
+
+TEST(GraphicsTools_DynamicResolutionController, ScaleSteps)
+{
+    DynamicResolutionController Controller{nullptr, GetTestCI()};
+    ASSERT_EQ(Controller.GetNumScales(), 3u);
+    EXPECT_FLOAT_EQ(Controller.GetScaleAt(0), 1.0f);
+    EXPECT_FLOAT_EQ(Controller.GetScaleAt(1), 0.75f);
+    EXPECT_FLOAT_EQ(Controller.GetScaleAt(2), 0.5f);
+
+    EXPECT_EQ(Controller.GetScaleIndex(), 0u);
+    EXPECT_EQ(Controller.GetRenderWidth(), 1920u);
+    EXPECT_EQ(Controller.GetRenderHeight(), 1080u);
+
+    Controller.SetScaleIndex(2);
+    EXPECT_EQ(Controller.GetRenderWidth(), 960u);
+    EXPECT_EQ(Controller.GetRenderHeight(), 540u);
+
+    EXPECT_FALSE(Controller.IsGPUTimingSupported());
+}
+
+TEST(GraphicsTools_DynamicResolutionController, Decrease)
+{
+    DynamicResolutionController Controller{nullptr, GetTestCI()};
+
+    // The scale must not change before MinFramesBetweenChanges frames are measured
+    EXPECT_EQ(FeedUntilChange(Controller, 0.020), 8u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 1u);
+    EXPECT_EQ(Controller.GetAverageGPUFrameTime(), 0.0);
+
+    EXPECT_EQ(FeedUntilChange(Controller, 0.020), 8u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 2u);
+
+    // Minimum scale is reached
+    EXPECT_EQ(FeedUntilChange(Controller, 0.020), 0u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 2u);
+    EXPECT_DOUBLE_EQ(Controller.GetAverageGPUFrameTime(), 0.020);
+}
+
+TEST(GraphicsTools_DynamicResolutionController, Increase)
+{
+    DynamicResolutionController Controller{nullptr, GetTestCI()};
+    Controller.SetScaleIndex(2);
+
+    // 0.005 * (0.75/0.5)^2 = 0.01125 > 0.0085: not enough headroom
+    EXPECT_EQ(FeedUntilChange(Controller, 0.005), 0u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 2u);
+
+    // The average is (0.005 + 0.003 * 3) / 4 = 0.0035 after three frames, and 0.0035 * 2.25 = 0.007875 <= 0.0085
+    EXPECT_EQ(FeedUntilChange(Controller, 0.003), 3u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 1u);
+
+    // 0.005 * (1/0.75)^2 = 0.00889 > 0.0085
+    EXPECT_EQ(FeedUntilChange(Controller, 0.005), 0u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 1u);
+
+    // (0.005 * 3 + 0.004) / 4 * (1/0.75)^2 = 0.00844 <= 0.0085
+    EXPECT_EQ(FeedUntilChange(Controller, 0.004), 1u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 0u);
+
+    // Maximum scale is reached
+    EXPECT_EQ(FeedUntilChange(Controller, 0.001), 0u);
+}
+
+TEST(GraphicsTools_DynamicResolutionController, Hysteresis)
+{
+    DynamicResolutionController Controller{nullptr, GetTestCI()};
+
+    // Frame time between the thresholds keeps the current scale
+    EXPECT_EQ(FeedUntilChange(Controller, 0.009), 0u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 0u);
+
+    Controller.SetScaleIndex(1);
+    EXPECT_EQ(FeedUntilChange(Controller, 0.009), 0u);
+    EXPECT_EQ(Controller.GetScaleIndex(), 1u);
+}
+
+} // namespace
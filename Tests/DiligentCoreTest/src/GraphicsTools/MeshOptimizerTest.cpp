@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshOptimizer.hpp"
+#include "ThreadPool.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Regular grid of GridSize x GridSize quads in the Z = 0 plane with randomly shuffled triangles
+struct ShuffledGridMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+
+    explicit ShuffledGridMesh(Uint32 GridSize)
+    {
+        for (Uint32 y = 0; y <= GridSize; ++y)
+        {
+            for (Uint32 x = 0; x <= GridSize; ++x)
+                Positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.f);
+        }
+
+        std::vector<std::array<Uint32, 3>> Tris;
+        for (Uint32 y = 0; y < GridSize; ++y)
+        {
+            for (Uint32 x = 0; x < GridSize; ++x)
+            {
+                const Uint32 v0 = x + y * (GridSize + 1);
+                const Uint32 v1 = v0 + 1;
+                const Uint32 v2 = v0 + GridSize + 1;
+                const Uint32 v3 = v2 + 1;
+                Tris.push_back({v0, v1, v2});
+                Tris.push_back({v2, v1, v3});
+            }
+        }
+
+        std::mt19937 Rng{42};
+        std::shuffle(Tris.begin(), Tris.end(), Rng);
+        for (const auto& Tri : Tris)
+            Indices.insert(Indices.end(), Tri.begin(), Tri.end());
+    }
+};
+
+// Returns the sorted list of triangles, each rotated so that the smallest index is first.
+// Rotation preserves the winding.
+template <typename IndexType>
+std::vector<std::array<IndexType, 3>> GetCanonicalTriangles(const std::vector<IndexType>& Indices)
+{
+    std::vector<std::array<IndexType, 3>> Tris;
+    for (size_t i = 0; i < Indices.size(); i += 3)
+    {
+        std::array<IndexType, 3> Tri{Indices[i], Indices[i + 1], Indices[i + 2]};
+        std::rotate(Tri.begin(), std::min_element(Tri.begin(), Tri.end()), Tri.end());
+        Tris.push_back(Tri);
+    }
+    std::sort(Tris.begin(), Tris.end());
+    return Tris;
+}
+
+TEST(MeshOptimizerTest, VertexCache)
+{
+    const ShuffledGridMesh Mesh{64};
+
+    const VertexCacheStatistics SrcStats = AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.Positions.size());
+
+    std::vector<Uint32> Indices = Mesh.Indices;
+    OptimizeVertexCache(Indices.data(), Indices.data(), Indices.size(), Mesh.Positions.size());
+    EXPECT_EQ(GetCanonicalTriangles(Indices), GetCanonicalTriangles(Mesh.Indices));
+
+    const VertexCacheStatistics DstStats = AnalyzeVertexCache(Indices.data(), Indices.size(), Mesh.Positions.size());
+    EXPECT_GT(SrcStats.ACMR, 2.f);
+    EXPECT_LT(DstStats.ACMR, 0.8f);
+    EXPECT_LT(DstStats.ATVR, 1.5f);
+
+    // 16-bit indices must produce the same order
+    std::vector<Uint16> Indices16{Mesh.Indices.begin(), Mesh.Indices.end()};
+    OptimizeVertexCache(Indices16.data(), Indices16.data(), Indices16.size(), Mesh.Positions.size());
+    EXPECT_TRUE(std::equal(Indices16.begin(), Indices16.end(), Indices.begin()));
+}
+
+TEST(MeshOptimizerTest, Overdraw)
+{
+    const ShuffledGridMesh Mesh{64};
+
+    std::vector<Uint32> Indices = Mesh.Indices;
+    OptimizeVertexCache(Indices.data(), Indices.data(), Indices.size(), Mesh.Positions.size());
+    const VertexCacheStatistics CacheStats = AnalyzeVertexCache(Indices.data(), Indices.size(), Mesh.Positions.size());
+
+    std::vector<Uint32> OverdrawIndices(Indices.size());
+    OptimizeOverdraw(OverdrawIndices.data(), Indices.data(), Indices.size(), Mesh.Positions.data(), sizeof(float3), Mesh.Positions.size());
+    EXPECT_EQ(GetCanonicalTriangles(OverdrawIndices), GetCanonicalTriangles(Mesh.Indices));
+
+    const VertexCacheStatistics OverdrawStats = AnalyzeVertexCache(OverdrawIndices.data(), OverdrawIndices.size(), Mesh.Positions.size());
+    EXPECT_LT(OverdrawStats.ACMR, CacheStats.ACMR * 1.1f);
+}
+
+TEST(MeshOptimizerTest, VertexFetchRemap)
+{
+    struct Vertex
+    {
+        float3 Pos;
+        Uint32 Id;
+    };
+    std::vector<Vertex> Vertices(6);
+    for (Uint32 i = 0; i < Vertices.size(); ++i)
+        Vertices[i] = {float3{static_cast<float>(i), 0, 0}, i};
+
+    // Vertex 3 is not used
+    std::vector<Uint16> Indices{5, 2, 0, 0, 2, 4, 1, 5, 0};
+
+    std::vector<Uint32> Remap(Vertices.size());
+    const Uint32        NumVertices = OptimizeVertexFetchRemap(Remap.data(), Indices.data(), Indices.size(), Vertices.size());
+    EXPECT_EQ(NumVertices, 5u);
+    EXPECT_EQ(Remap, (std::vector<Uint32>{2, 4, 1, ~0u, 3, 0}));
+
+    RemapIndices(Indices.data(), Indices.data(), Indices.size(), Remap.data());
+    EXPECT_EQ(Indices, (std::vector<Uint16>{0, 1, 2, 2, 1, 3, 4, 0, 2}));
+
+    RemapVertices(Vertices.data(), Vertices.data(), Vertices.size(), sizeof(Vertex), Remap.data());
+    const Uint32 ExpectedIds[] = {5, 2, 0, 4, 1};
+    for (Uint32 i = 0; i < NumVertices; ++i)
+        EXPECT_EQ(Vertices[i].Id, ExpectedIds[i]);
+}
+
+TEST(MeshOptimizerTest, QuantizeValues)
+{
+    EXPECT_EQ(QuantizeUNorm(0.f, 8), 0u);
+    EXPECT_EQ(QuantizeUNorm(0.5f, 8), 128u);
+    EXPECT_EQ(QuantizeUNorm(1.f, 8), 255u);
+    EXPECT_EQ(QuantizeUNorm(2.f, 16), 65535u);
+    EXPECT_EQ(QuantizeUNorm(-1.f, 16), 0u);
+
+    EXPECT_EQ(QuantizeSNorm(-1.f, 8), -127);
+    EXPECT_EQ(QuantizeSNorm(-0.5f, 8), -64);
+    EXPECT_EQ(QuantizeSNorm(0.5f, 16), 16384);
+    EXPECT_EQ(QuantizeSNorm(-2.f, 16), -32767);
+
+    EXPECT_EQ(QuantizeHalf(0.f), 0x0000);
+    EXPECT_EQ(QuantizeHalf(-0.f), 0x8000);
+    EXPECT_EQ(QuantizeHalf(1.f), 0x3C00);
+    EXPECT_EQ(QuantizeHalf(-2.f), 0xC000);
+    EXPECT_EQ(QuantizeHalf(0.1f), 0x2E66);
+    EXPECT_EQ(QuantizeHalf(65504.f), 0x7BFF);
+    EXPECT_EQ(QuantizeHalf(65520.f), 0x7C00);
+    EXPECT_EQ(QuantizeHalf(1e10f), 0x7C00);
+    EXPECT_EQ(QuantizeHalf(std::ldexp(1.f, -24)), 0x0001);
+    EXPECT_EQ(QuantizeHalf(std::ldexp(1.f, -14)), 0x0400);
+    EXPECT_EQ(QuantizeHalf(1e-10f), 0x0000);
+    EXPECT_EQ(QuantizeHalf(std::ldexp(1.5f, -25)), 0x0001);
+    EXPECT_EQ(QuantizeHalf(std::ldexp(1.f, -25)), 0x0000);
+    // Ties are rounded to even
+    EXPECT_EQ(QuantizeHalf(1.f + std::ldexp(1.f, -11)), 0x3C00);
+    EXPECT_EQ(QuantizeHalf(1.f + 3.f * std::ldexp(1.f, -11)), 0x3C02);
+}
+
+template <typename DstType>
+void TestQuantizeAttributes(VALUE_TYPE Type, DstType (*Reference)(float))
+{
+    // Odd size to exercise the scalar tail after the SIMD loop
+    std::vector<float> Src(200003);
+
+    std::mt19937                          Rng{7};
+    std::uniform_real_distribution<float> Dist{-1.25f, 1.25f};
+    for (float& Val : Src)
+        Val = Dist(Rng);
+    // Exact ties
+    Src[0] = 0.5f / 255.f;
+    Src[1] = -0.5f / 127.f;
+
+    QuantizeAttributesAttribs Attribs;
+    Attribs.pSrc      = Src.data();
+    Attribs.NumValues = Src.size();
+    Attribs.DstType   = Type;
+
+    std::vector<DstType> Dst(Src.size());
+    Attribs.pDst = Dst.data();
+    ASSERT_TRUE(QuantizeAttributes(Attribs));
+    for (size_t i = 0; i < Src.size(); ++i)
+    {
+        ASSERT_EQ(Dst[i], Reference(Src[i])) << "Value " << Src[i] << " at index " << i;
+    }
+
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+
+    std::vector<DstType> ParallelDst(Src.size());
+    Attribs.pDst        = ParallelDst.data();
+    Attribs.pThreadPool = pThreadPool;
+    ASSERT_TRUE(QuantizeAttributes(Attribs));
+    EXPECT_EQ(ParallelDst, Dst);
+}
+
+TEST(MeshOptimizerTest, QuantizeAttributes)
+{
+    TestQuantizeAttributes<Uint8>(VT_UINT8, [](float f) { return static_cast<Uint8>(QuantizeUNorm(f, 8)); });
+    TestQuantizeAttributes<Int8>(VT_INT8, [](float f) { return static_cast<Int8>(QuantizeSNorm(f, 8)); });
+    TestQuantizeAttributes<Uint16>(VT_UINT16, [](float f) { return static_cast<Uint16>(QuantizeUNorm(f, 16)); });
+    TestQuantizeAttributes<Int16>(VT_INT16, [](float f) { return static_cast<Int16>(QuantizeSNorm(f, 16)); });
+    TestQuantizeAttributes<Uint16>(VT_FLOAT16, [](float f) { return QuantizeHalf(f); });
+}
+
+TEST(MeshOptimizerTest, InvalidQuantizeAttribs)
+{
+    const float Src[4] = {};
+    Uint32      Dst[4] = {};
+
+    QuantizeAttributesAttribs Attribs;
+    Attribs.pSrc      = Src;
+    Attribs.pDst      = Dst;
+    Attribs.NumValues = 4;
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Destination type must be"};
+        Attribs.DstType = VT_UINT32;
+        EXPECT_FALSE(QuantizeAttributes(Attribs));
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"must not be null"};
+        Attribs.DstType = VT_UINT8;
+        Attribs.pDst    = nullptr;
+        EXPECT_FALSE(QuantizeAttributes(Attribs));
+    }
+}
+
+} // namespace
@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshletBuilder.hpp"
+#include "ThreadPool.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Regular grid of GridSize x GridSize quads in the Z = 0 plane, facing +Z
+struct GridMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+
+    explicit GridMesh(Uint32 GridSize)
+    {
+        for (Uint32 y = 0; y <= GridSize; ++y)
+        {
+            for (Uint32 x = 0; x <= GridSize; ++x)
+                Positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.f);
+        }
+
+        for (Uint32 y = 0; y < GridSize; ++y)
+        {
+            for (Uint32 x = 0; x < GridSize; ++x)
+            {
+                const Uint32 v0 = x + y * (GridSize + 1);
+                const Uint32 v1 = v0 + 1;
+                const Uint32 v2 = v0 + GridSize + 1;
+                const Uint32 v3 = v2 + 1;
+                Indices.insert(Indices.end(), {v0, v1, v2, v2, v1, v3});
+            }
+        }
+    }
+
+    BuildMeshletsAttribs GetAttribs() const
+    {
+        BuildMeshletsAttribs Attribs;
+        Attribs.pIndices    = Indices.data();
+        Attribs.IndexType   = VT_UINT32;
+        Attribs.NumIndices  = static_cast<Uint32>(Indices.size());
+        Attribs.pPositions  = Positions.data();
+        Attribs.NumVertices = static_cast<Uint32>(Positions.size());
+        return Attribs;
+    }
+};
+
+// Returns the triangle with the smallest index first, preserving the winding
+std::array<Uint32, 3> NormalizeTriangle(Uint32 v0, Uint32 v1, Uint32 v2)
+{
+    if (v1 < v0 && v1 < v2)
+        return {v1, v2, v0};
+    if (v2 < v0 && v2 < v1)
+        return {v2, v0, v1};
+    return {v0, v1, v2};
+}
+
+void VerifyMeshlets(const GridMesh& Mesh, const MeshletData& Data, Uint32 MaxVertices, Uint32 MaxPrimitives)
+{
+    ASSERT_EQ(Data.Meshlets.size(), Data.Bounds.size());
+
+    std::vector<std::array<Uint32, 3>> RefTriangles;
+    for (size_t i = 0; i < Mesh.Indices.size(); i += 3)
+        RefTriangles.push_back(NormalizeTriangle(Mesh.Indices[i], Mesh.Indices[i + 1], Mesh.Indices[i + 2]));
+
+    std::vector<std::array<Uint32, 3>> Triangles;
+    for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+    {
+        const MeshletDesc& Meshlet = Data.Meshlets[m];
+        EXPECT_GT(Meshlet.PrimitiveCount, 0u);
+        EXPECT_LE(Meshlet.VertexCount, MaxVertices);
+        EXPECT_LE(Meshlet.PrimitiveCount, MaxPrimitives);
+        ASSERT_LE(Meshlet.VertexOffset + Meshlet.VertexCount, Data.VertexIndices.size());
+        ASSERT_LE(Meshlet.PrimitiveOffset + Meshlet.PrimitiveCount, Data.PrimitiveIndices.size());
+
+        const MeshletBounds& Bounds = Data.Bounds[m];
+        for (Uint32 v = 0; v < Meshlet.VertexCount; ++v)
+        {
+            const float3& Pos = Mesh.Positions[Data.VertexIndices[Meshlet.VertexOffset + v]];
+            EXPECT_LE(length(Pos - Bounds.Center), Bounds.Radius * 1.001f);
+        }
+
+        // All triangles face +Z, so the meshlet is back-facing when viewed from below
+        EXPECT_NEAR(Bounds.ConeAxis.z, 1.f, 1e-5f);
+        EXPECT_NEAR(Bounds.ConeCutoff, 0.f, 1e-3f);
+        const float3 CameraPos = Bounds.Center - float3{0, 0, 10};
+        EXPECT_GE(dot(normalize(Bounds.ConeApex - CameraPos), Bounds.ConeAxis), Bounds.ConeCutoff);
+
+        for (Uint32 p = 0; p < Meshlet.PrimitiveCount; ++p)
+        {
+            const Uint32 Prim = Data.PrimitiveIndices[Meshlet.PrimitiveOffset + p];
+            EXPECT_EQ(Prim >> 24u, 0u);
+
+            Uint32 Verts[3];
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                const Uint32 LocalIdx = (Prim >> (c * 8u)) & 0xFFu;
+                ASSERT_LT(LocalIdx, Meshlet.VertexCount);
+                Verts[c] = Data.VertexIndices[Meshlet.VertexOffset + LocalIdx];
+            }
+            Triangles.push_back(NormalizeTriangle(Verts[0], Verts[1], Verts[2]));
+        }
+    }
+
+    // Every triangle must be present exactly once with the original winding
+    std::sort(RefTriangles.begin(), RefTriangles.end());
+    std::sort(Triangles.begin(), Triangles.end());
+    EXPECT_EQ(Triangles, RefTriangles);
+}
+
+TEST(MeshletBuilderTest, Grid)
+{
+    const GridMesh Mesh{32};
+
+    BuildMeshletsAttribs Attribs = Mesh.GetAttribs();
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(Attribs, Data));
+    VerifyMeshlets(Mesh, Data, Attribs.MaxVertices, Attribs.MaxPrimitives);
+
+    // 64 vertices cover at most 7x7 quads of a regular grid, which is 98 triangles.
+    // Well-built meshlets should be close to that.
+    const float AvgPrimitives = static_cast<float>(Mesh.Indices.size() / 3) / static_cast<float>(Data.Meshlets.size());
+    EXPECT_GE(AvgPrimitives, 80.f);
+}
+
+TEST(MeshletBuilderTest, UInt16Indices)
+{
+    const GridMesh Mesh{16};
+
+    std::vector<Uint16> Indices16{Mesh.Indices.begin(), Mesh.Indices.end()};
+
+    BuildMeshletsAttribs Attribs = Mesh.GetAttribs();
+    Attribs.pIndices             = Indices16.data();
+    Attribs.IndexType            = VT_UINT16;
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(Attribs, Data));
+    VerifyMeshlets(Mesh, Data, Attribs.MaxVertices, Attribs.MaxPrimitives);
+}
+
+TEST(MeshletBuilderTest, AdapterLimits)
+{
+    const GridMesh Mesh{16};
+
+    MeshShaderProperties MeshProps;
+    MeshProps.MaxOutputVertices   = 32;
+    MeshProps.MaxOutputPrimitives = 40;
+
+    BuildMeshletsAttribs Attribs = Mesh.GetAttribs();
+    Attribs.pMeshShaderProps     = &MeshProps;
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(Attribs, Data));
+    VerifyMeshlets(Mesh, Data, 32, 40);
+}
+
+TEST(MeshletBuilderTest, ThreadPool)
+{
+    // Large enough to be split into several groups
+    const GridMesh Mesh{100};
+
+    BuildMeshletsAttribs Attribs = Mesh.GetAttribs();
+
+    MeshletData RefData;
+    ASSERT_TRUE(BuildMeshlets(Attribs, RefData));
+
+    auto pThreadPool    = CreateThreadPool(ThreadPoolCreateInfo{4});
+    Attribs.pThreadPool = pThreadPool;
+
+    MeshletData Data;
+    ASSERT_TRUE(BuildMeshlets(Attribs, Data));
+    VerifyMeshlets(Mesh, Data, Attribs.MaxVertices, Attribs.MaxPrimitives);
+
+    // The result must not depend on the number of threads
+    ASSERT_EQ(Data.Meshlets.size(), RefData.Meshlets.size());
+    for (size_t m = 0; m < Data.Meshlets.size(); ++m)
+    {
+        EXPECT_EQ(Data.Meshlets[m].VertexOffset, RefData.Meshlets[m].VertexOffset);
+        EXPECT_EQ(Data.Meshlets[m].PrimitiveCount, RefData.Meshlets[m].PrimitiveCount);
+    }
+    EXPECT_EQ(Data.VertexIndices, RefData.VertexIndices);
+    EXPECT_EQ(Data.PrimitiveIndices, RefData.PrimitiveIndices);
+}
+
+TEST(MeshletBuilderTest, InvalidAttribs)
+{
+    const GridMesh Mesh{4};
+
+    BuildMeshletsAttribs Attribs = Mesh.GetAttribs();
+    MeshletData          Data;
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"exceeds the vertex count"};
+        Attribs.NumVertices = 10;
+        EXPECT_FALSE(BuildMeshlets(Attribs, Data));
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"must be a multiple of 3"};
+        Attribs            = Mesh.GetAttribs();
+        Attribs.NumIndices = 5;
+        EXPECT_FALSE(BuildMeshlets(Attribs, Data));
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Index type must be"};
+        Attribs           = Mesh.GetAttribs();
+        Attribs.IndexType = VT_UINT8;
+        EXPECT_FALSE(BuildMeshlets(Attribs, Data));
+    }
+
+    Attribs            = Mesh.GetAttribs();
+    Attribs.NumIndices = 0;
+    EXPECT_TRUE(BuildMeshlets(Attribs, Data));
+    EXPECT_TRUE(Data.Meshlets.empty());
+}
+
+} // namespace
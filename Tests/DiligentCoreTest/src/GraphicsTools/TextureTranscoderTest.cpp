@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TextureTranscoder.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Copies every subresource to a buffer with padded rows and checks that
+// each row matches the packed source data.
+void TestCopyPackedSubresources(const UploadBufferDesc& Desc, Uint32 BytesPerRow0, Uint32 NumRows0, Uint32 RowPadding)
+{
+    std::vector<Uint8> Packed;
+    for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            const auto MipSize = size_t{BytesPerRow0 >> Mip} * size_t{NumRows0 >> Mip};
+            for (size_t i = 0; i < MipSize; ++i)
+                Packed.push_back(static_cast<Uint8>(Packed.size() * 7 + 3));
+        }
+    }
+
+    size_t SrcOffset = 0;
+    for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+    {
+        for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        {
+            const Uint32 RowSize = BytesPerRow0 >> Mip;
+            const Uint32 NumRows = NumRows0 >> Mip;
+
+            MappedTextureSubresource Mapped;
+            Mapped.Stride      = RowSize + RowPadding;
+            Mapped.DepthStride = Mapped.Stride * NumRows;
+
+            std::vector<Uint8> Dst(static_cast<size_t>(Mapped.DepthStride));
+            Mapped.pData = Dst.data();
+            ASSERT_TRUE(CopyPackedTextureSubresource(Packed.data(), Packed.size(), Mip, Slice, Desc, Mapped));
+
+            for (Uint32 Row = 0; Row < NumRows; ++Row)
+            {
+                for (Uint32 i = 0; i < RowSize; ++i)
+                {
+                    ASSERT_EQ(Dst[Row * Mapped.Stride + i], Packed[SrcOffset + Row * RowSize + i])
+                        << "Slice " << Slice << ", Mip " << Mip << ", Row " << Row;
+                }
+            }
+            SrcOffset += size_t{RowSize} * NumRows;
+        }
+    }
+    EXPECT_EQ(SrcOffset, Packed.size());
+
+    // Truncated payload
+    std::vector<Uint8> Dst(size_t{BytesPerRow0 + RowPadding} * NumRows0);
+
+    MappedTextureSubresource Mapped;
+    Mapped.pData       = Dst.data();
+    Mapped.Stride      = BytesPerRow0 + RowPadding;
+    Mapped.DepthStride = Mapped.Stride * NumRows0;
+    EXPECT_FALSE(CopyPackedTextureSubresource(Packed.data(), Packed.size() - 1, Desc.MipLevels - 1, Desc.ArraySize - 1, Desc, Mapped));
+}
+
+TEST(TextureTranscoderTest, CopyPackedTextureSubresource_RGBA8)
+{
+    UploadBufferDesc Desc;
+    Desc.Width     = 16;
+    Desc.Height    = 8;
+    Desc.MipLevels = 3;
+    Desc.ArraySize = 2;
+    Desc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TestCopyPackedSubresources(Desc, 16 * 4, 8, 12);
+}
+
+TEST(TextureTranscoderTest, CopyPackedTextureSubresource_BC1)
+{
+    UploadBufferDesc Desc;
+    Desc.Width     = 32;
+    Desc.Height    = 16;
+    Desc.MipLevels = 2;
+    Desc.ArraySize = 3;
+    Desc.Format    = TEX_FORMAT_BC1_UNORM;
+    // 8x4 blocks of 8 bytes in the top mip
+    TestCopyPackedSubresources(Desc, 8 * 8, 4, 16);
+}
+
+} // namespace
@@ -25,6 +25,8 @@
  */
 
 #include "XXH128Hasher.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
 #include "gtest/gtest.h"
 #include <memory>
 #include <unordered_set>
@@ -76,4 +78,64 @@ TEST(XXH128HasherTest, Struct)
     EXPECT_EQ(Hasher1.Digest(), Hasher2.Digest());
 }
 
+TEST(XXH128HasherTest, ShaderCreateInfo)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source          = "void main() {}";
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_VERTEX;
+    ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_GLSL;
+
+    auto GetHash = [](const ShaderCreateInfo& CI) {
+        XXH128State Hasher;
+        Hasher.Update(CI);
+        return Hasher.Digest();
+    };
+    const auto RefHash = GetHash(ShaderCI);
+
+    // Asynchronous compilation flag must not affect the hash
+    ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+    EXPECT_EQ(GetHash(ShaderCI), RefHash);
+
+    ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR;
+    EXPECT_FALSE(GetHash(ShaderCI) == RefHash);
+}
+
+TEST(XXH128HasherTest, ShaderCreateInfoSourceFiles)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/BytecodeCache/IncludeTest0", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc.ShaderType            = SHADER_TYPE_VERTEX;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.FilePath                   = "IncludeBasicTest.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    XXH128State Hasher1;
+    Hasher1.Update(ShaderCI);
+
+    std::vector<std::string> SourceFiles;
+    XXH128State              Hasher2;
+    Hasher2.Update(ShaderCI, &SourceFiles);
+
+    // Collecting source files must not affect the hash
+    EXPECT_EQ(Hasher1.Digest(), Hasher2.Digest());
+
+    // Includes are reported before the file that includes them
+    ASSERT_EQ(SourceFiles.size(), size_t{2});
+    EXPECT_EQ(SourceFiles[0], "IncludeCommon.hlsl");
+    EXPECT_EQ(SourceFiles[1], "IncludeBasicTest.hlsl");
+
+    for (const auto& File : SourceFiles)
+    {
+        ShaderSourceFileInfo Info;
+        EXPECT_TRUE(GetShaderSourceFileInfo(pShaderSourceFactory, File.c_str(), Info));
+        EXPECT_GT(Info.Size, Uint64{0});
+    }
+
+    ShaderSourceFileInfo Info;
+    EXPECT_FALSE(GetShaderSourceFileInfo(pShaderSourceFactory, "NonExistentFile.hlsl", Info));
+}
+
 } // namespace
@@ -114,4 +114,28 @@ TEST(Platforms_PlatformMisc, SwapBytes)
     EXPECT_EQ(PlatformMisc::SwapBytes(fswap), f);
 }
 
+TEST(Platforms_PlatformMisc, GetCPUTopology)
+{
+    const CPUTopology Topology = PlatformMisc::GetCPUTopology();
+    ASSERT_FALSE(Topology.LogicalCores.empty());
+    EXPECT_GT(Topology.NumPhysicalCores, 0u);
+    EXPECT_LE(Topology.NumPhysicalCores, Topology.LogicalCores.size());
+    EXPECT_EQ(Topology.NumPerformanceCores + Topology.NumEfficiencyCores, Topology.LogicalCores.size());
+    EXPECT_EQ(Topology.PerformanceCoresMask & Topology.EfficiencyCoresMask, Uint64{0});
+
+    for (Uint32 i = 0; i < Topology.LogicalCores.size(); ++i)
+    {
+        const auto& Core = Topology.LogicalCores[i];
+        EXPECT_LE(Core.PhysicalCoreId, i);
+        EXPECT_LT(Core.CacheClusterId, Topology.LogicalCores.size());
+        if (i < 64 && Core.Type != CPUCoreType::Unknown)
+        {
+            const Uint64 CoreBit = Uint64{1} << i;
+            EXPECT_EQ((Topology.PerformanceCoresMask & CoreBit) != 0, Core.Type == CPUCoreType::Performance) << "i=" << i;
+            EXPECT_EQ((Topology.EfficiencyCoresMask & CoreBit) != 0, Core.Type == CPUCoreType::Efficiency) << "i=" << i;
+            EXPECT_EQ((Topology.PhysicalCoresMask & CoreBit) != 0, Core.PhysicalCoreId == i) << "i=" << i;
+        }
+    }
+}
+
 } // namespace
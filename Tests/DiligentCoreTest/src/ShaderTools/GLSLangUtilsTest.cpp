@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GLSLangUtils.hpp"
+#include "ThreadPool.hpp"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class GLSLangUtilsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+constexpr char VSSource[] = R"(
+#version 450 core
+void main()
+{
+    gl_Position = vec4(VALUE, VALUE, 0.0, 1.0);
+}
+)";
+
+constexpr char PSSource[] = R"(
+#version 450 core
+layout(location = 0) out vec4 Color;
+void main()
+{
+    Color = vec4(VALUE);
+}
+)";
+
+constexpr char CSSource[] = R"(
+#version 450 core
+layout(local_size_x = 8) in;
+layout(std430, binding = 0) buffer Data
+{
+    float g_Data[];
+};
+void main()
+{
+    g_Data[gl_GlobalInvocationID.x] = VALUE;
+}
+)";
+
+constexpr char BrokenSource[] = R"(
+#version 450 core
+void main()
+{
+    undeclared_variable = VALUE;
+}
+)";
+
+GLSLangUtils::GLSLtoSPIRVAttribs GetAttribs(SHADER_TYPE ShaderType, const char* Source)
+{
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType    = ShaderType;
+    Attribs.ShaderSource  = Source;
+    Attribs.SourceCodeLen = static_cast<int>(strlen(Source));
+    return Attribs;
+}
+
+TEST_F(GLSLangUtilsTest, WarmUp)
+{
+    GLSLangUtils::GlslangWarmUpAttribs WarmUpAttribs;
+    WarmUpAttribs.GLSLVersionDirective = "#version 450 core";
+    WarmUpAttribs.HLSL                 = true;
+    GLSLangUtils::WarmUpGlslang(WarmUpAttribs);
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs = GetAttribs(SHADER_TYPE_VERTEX, "#version 450 core\nvoid main(){ gl_Position = vec4(0.0); }\n");
+    EXPECT_FALSE(GLSLangUtils::GLSLtoSPIRV(Attribs).empty());
+}
+
+TEST_F(GLSLangUtilsTest, BatchCompilation)
+{
+    std::vector<GLSLangUtils::GLSLtoSPIRVAttribs> Attribs;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        Attribs.push_back(GetAttribs(SHADER_TYPE_VERTEX, VSSource));
+        Attribs.push_back(GetAttribs(SHADER_TYPE_PIXEL, PSSource));
+        Attribs.push_back(GetAttribs(SHADER_TYPE_COMPUTE, CSSource));
+    }
+    Attribs.push_back(GetAttribs(SHADER_TYPE_VERTEX, BrokenSource));
+
+    constexpr char SharedPreamble[] = "#define VALUE 0.5\n";
+
+    std::vector<std::vector<unsigned int>> RefSPIRVs;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to parse shader source"};
+        RefSPIRVs = GLSLangUtils::GLSLtoSPIRV(Attribs.data(), static_cast<Uint32>(Attribs.size()), SharedPreamble, nullptr);
+    }
+    ASSERT_EQ(RefSPIRVs.size(), Attribs.size());
+    for (size_t i = 0; i + 1 < RefSPIRVs.size(); ++i)
+        EXPECT_FALSE(RefSPIRVs[i].empty()) << "Shader " << i << " failed to compile";
+    EXPECT_TRUE(RefSPIRVs.back().empty());
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to parse shader source"};
+
+        const std::vector<std::vector<unsigned int>> SPIRVs = GLSLangUtils::GLSLtoSPIRV(Attribs.data(), static_cast<Uint32>(Attribs.size()), SharedPreamble, pThreadPool);
+        EXPECT_EQ(SPIRVs, RefSPIRVs);
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to parse shader source"};
+
+        // Without the shared preamble, VALUE is not defined
+        GLSLangUtils::GLSLtoSPIRVAttribs VSAttribs = GetAttribs(SHADER_TYPE_VERTEX, VSSource);
+        EXPECT_TRUE(GLSLangUtils::GLSLtoSPIRV(VSAttribs).empty());
+    }
+}
+
+TEST_F(GLSLangUtilsTest, SkipPerformancePasses)
+{
+    constexpr char Source[] = R"(
+#version 450 core
+layout(local_size_x = 8) in;
+layout(std430, binding = 0) buffer Data
+{
+    float g_Data[];
+};
+float Scale(float x)
+{
+    float y = x * 2.0;
+    return y * 0.5;
+}
+void main()
+{
+    g_Data[gl_GlobalInvocationID.x] = Scale(g_Data[gl_GlobalInvocationID.x]);
+}
+)";
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs = GetAttribs(SHADER_TYPE_COMPUTE, Source);
+
+    const std::vector<unsigned int> OptimizedSPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+    EXPECT_FALSE(OptimizedSPIRV.empty());
+
+    Attribs.OptimizeForPerformance = false;
+    const std::vector<unsigned int> UnoptimizedSPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+    EXPECT_FALSE(UnoptimizedSPIRV.empty());
+#if !DILIGENT_NO_HLSL
+    // Performance passes inline the function
+    EXPECT_NE(OptimizedSPIRV, UnoptimizedSPIRV);
+#endif
+}
+
+} // namespace
@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderBytecodeStore.hpp"
+
+#include <array>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr char TestShaderSource[] = R"(
+float4 main() : SV_Target
+{
+    return float4(0.0, 0.0, 0.0, 0.0);
+}
+)";
+
+ShaderCreateInfo GetTestShaderCI()
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source          = TestShaderSource;
+    ShaderCI.SourceLanguage  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc.ShaderType = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.Name       = "Test shader";
+    return ShaderCI;
+}
+
+TEST(ShaderBytecodeStoreTest, ComputeKey)
+{
+    const ShaderCreateInfo ShaderCI = GetTestShaderCI();
+
+    const auto Key = ShaderBytecodeStore::ComputeKey(ShaderCI, 0);
+    EXPECT_EQ(Key, ShaderBytecodeStore::ComputeKey(ShaderCI, 0));
+    EXPECT_NE(Key, ShaderBytecodeStore::ComputeKey(ShaderCI, 1));
+
+    {
+        // Shader name must not affect the key
+        ShaderCreateInfo ShaderCI2 = ShaderCI;
+        ShaderCI2.Desc.Name        = "Another name";
+        EXPECT_EQ(Key, ShaderBytecodeStore::ComputeKey(ShaderCI2, 0));
+    }
+
+    {
+        ShaderCreateInfo ShaderCI2 = ShaderCI;
+        ShaderCI2.EntryPoint       = "main2";
+        EXPECT_NE(Key, ShaderBytecodeStore::ComputeKey(ShaderCI2, 0));
+    }
+
+    {
+        constexpr ShaderMacro Macros[] = {{"MACRO", "1"}};
+        ShaderCreateInfo      ShaderCI2 = ShaderCI;
+        ShaderCI2.Macros                = {Macros, _countof(Macros)};
+        EXPECT_NE(Key, ShaderBytecodeStore::ComputeKey(ShaderCI2, 0));
+    }
+
+    {
+        ShaderCreateInfo ShaderCI2 = ShaderCI;
+        ShaderCI2.CompileFlags     = SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR;
+        EXPECT_NE(Key, ShaderBytecodeStore::ComputeKey(ShaderCI2, 0));
+    }
+}
+
+TEST(ShaderBytecodeStoreTest, FindAdd)
+{
+    auto pStore = ShaderBytecodeStore::Get(nullptr);
+    ASSERT_NE(pStore, nullptr);
+    EXPECT_EQ(pStore, ShaderBytecodeStore::Get(""));
+
+    const auto Key = ShaderBytecodeStore::ComputeKey(GetTestShaderCI(), 12345);
+
+    std::vector<Uint8> Bytecode;
+    EXPECT_FALSE(pStore->Find(Key, Bytecode));
+
+    constexpr std::array<Uint8, 8> RefBytecode = {1, 2, 3, 4, 5, 6, 7, 8};
+    pStore->Add(Key, RefBytecode.data(), RefBytecode.size());
+
+    ASSERT_TRUE(pStore->Find(Key, Bytecode));
+    EXPECT_EQ(Bytecode, std::vector<Uint8>(RefBytecode.begin(), RefBytecode.end()));
+}
+
+} // namespace
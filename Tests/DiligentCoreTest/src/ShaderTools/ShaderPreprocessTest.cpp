@@ -27,6 +27,7 @@
 #include <deque>
 
 #include "ShaderToolsCommon.hpp"
+#include "ShaderIncludeCache.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
 #include "RenderDevice.h"
 #include "TestingEnvironment.hpp"
@@ -194,6 +195,70 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+TEST(ShaderPreprocessTest, IncludeCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    auto& Cache = ShaderIncludeCache::GetInstance();
+    Cache.SetEnabled(true);
+    Cache.Invalidate();
+    Cache.ResetStatistics();
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "TestShader";
+    ShaderCI.FilePath                   = "InlineIncludeShaderTest.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    // The first run loads the shader and the three files it includes
+    const auto RefString = UnrollShaderIncludes(ShaderCI);
+    auto       Stats     = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumHits, 0u);
+    EXPECT_EQ(Stats.NumMisses, 4u);
+    EXPECT_EQ(Stats.NumFiles, 4u);
+    EXPECT_GT(Stats.TotalSourceSize, 0u);
+
+    // Subsequent runs are served from the cache.
+    // Note that ProcessShaderIncludes requests the shader file twice as it is included by one of the files.
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI), RefString);
+    EXPECT_TRUE(ProcessShaderIncludes(ShaderCI, {}));
+    Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumHits, 9u);
+    EXPECT_EQ(Stats.NumMisses, 4u);
+    EXPECT_DOUBLE_EQ(Stats.GetHitRate(), 9.0 / 13.0);
+
+    // Invalidating a single file only reloads this file
+    Cache.Invalidate("InlineIncludeShaderCommon1.hlsl");
+    EXPECT_EQ(Cache.GetStatistics().NumFiles, 3u);
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI), RefString);
+    Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumHits, 12u);
+    EXPECT_EQ(Stats.NumMisses, 5u);
+
+    // Files from another factory are not shared
+    {
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory2;
+        CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory2);
+        ASSERT_NE(pShaderSourceFactory2, nullptr);
+
+        auto ShaderCI2{ShaderCI};
+        ShaderCI2.pShaderSourceStreamFactory = pShaderSourceFactory2;
+        EXPECT_EQ(UnrollShaderIncludes(ShaderCI2), RefString);
+        Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumMisses, 9u);
+        EXPECT_EQ(Stats.NumFiles, 8u);
+    }
+
+    Cache.Invalidate();
+    EXPECT_EQ(Cache.GetStatistics().NumFiles, 0u);
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI), RefString);
+    EXPECT_EQ(Cache.GetStatistics().NumMisses, 13u);
+
+    Cache.SetEnabled(false);
+    EXPECT_EQ(Cache.GetStatistics().NumFiles, 0u);
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
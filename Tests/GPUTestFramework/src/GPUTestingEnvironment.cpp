@@ -663,6 +663,11 @@ GPUTestingEnvironment::~GPUTestingEnvironment()
                 "\n    GenerateMips              ", CmdCounters.GenerateMips,
                 "\n    ResolveTextureSubresource ", CmdCounters.ResolveTextureSubresource,
                 "\n    BindSparseResourceMemory  ", CmdCounters.BindSparseResourceMemory,
+                "\n    BeginRenderPass           ", CmdCounters.BeginRenderPass,
+                "\n    EndRenderPass             ", CmdCounters.EndRenderPass,
+                "\n  Allocations",
+                "\n    DescriptorSets            ", Stats.AllocationCounters.DescriptorSets,
+                "\n    DynamicHeapBytes          ", Stats.AllocationCounters.DynamicHeapBytes,
                 "\n  Primitives",
                 "\n    TRIANGLE_LIST             ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_LIST],
                 "\n    TRIANGLE_STRIP            ", Stats.PrimitiveCounts[PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP],
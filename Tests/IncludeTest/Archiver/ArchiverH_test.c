@@ -28,8 +28,8 @@
 
 void TestArchiver_CInterface(IArchiver* pArchiver)
 {
-    IArchiver_SerializeToBlob(pArchiver, 0, (IDataBlob**)NULL);
-    IArchiver_SerializeToStream(pArchiver, 0, (IFileStream*)NULL);
+    IArchiver_SerializeToBlob(pArchiver, 0, (IDataBlob**)NULL, false);
+    IArchiver_SerializeToStream(pArchiver, 0, (IFileStream*)NULL, false);
     IArchiver_AddShader(pArchiver, (IShader*)NULL);
     IArchiver_AddPipelineState(pArchiver, (IPipelineState*)NULL);
     IArchiver_AddPipelineResourceSignature(pArchiver, (IPipelineResourceSignature*)NULL);
@@ -30,3 +30,4 @@
 #endif
 
 #include "DiligentCore/Graphics/GraphicsAccessories/interface/VariableSizeAllocationsManager.hpp"
+#include "DiligentCore/Graphics/GraphicsAccessories/interface/TLSFAllocationsManager.hpp"
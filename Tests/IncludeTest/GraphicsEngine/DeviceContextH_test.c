@@ -29,8 +29,9 @@
 
 void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
 {
-    const struct DeviceContextDesc* pDesc       = NULL;
-    Uint64                          FrameNumber = 0;
+    const struct DeviceContextDesc* pDesc        = NULL;
+    Uint64                          FrameNumber  = 0;
+    void*                           pFrameMemory = NULL;
 
     pDesc = IDeviceContext_GetDesc(pCtx);
     (void)(pDesc);
@@ -44,6 +45,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_CommitShaderResources(pCtx, (struct IShaderResourceBinding*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_SetStencilRef(pCtx, 1u);
     IDeviceContext_SetBlendFactors(pCtx, (const float*)NULL);
+    IDeviceContext_SetDynamicRenderState(pCtx, (const struct DynamicRenderState*)NULL);
     IDeviceContext_SetVertexBuffers(pCtx, 0u, 1u, (struct IBuffer**)NULL, (const Uint64*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE, SET_VERTEX_BUFFERS_FLAG_RESET);
     IDeviceContext_InvalidateState(pCtx);
     IDeviceContext_SetIndexBuffer(pCtx, (struct IBuffer*)NULL, (Uint64)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
@@ -56,6 +58,7 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     IDeviceContext_EndRenderPass(pCtx);
     IDeviceContext_ClearDepthStencil(pCtx, (struct ITextureView*)NULL, CLEAR_DEPTH_FLAG, 1.0f, (Uint8)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_ClearRenderTarget(pCtx, (struct ITextureView*)NULL, (const float*)NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    IDeviceContext_InvalidateAttachments(pCtx, 0u, (struct ITextureView* const*)NULL);
 
     IDeviceContext_Draw(pCtx, (struct DrawAttribs*)NULL);
     IDeviceContext_DrawIndexed(pCtx, (struct DrawIndexedAttribs*)NULL);
@@ -79,8 +82,14 @@ void TestDeviceContextCInterface(struct IDeviceContext* pCtx)
     FrameNumber = IDeviceContext_GetFrameNumber(pCtx);
     (void)(FrameNumber);
 
+    pFrameMemory = IDeviceContext_AllocateFrameMemory(pCtx, (size_t)64, (size_t)16);
+    (void)(pFrameMemory);
+
     IDeviceContext_BeginQuery(pCtx, (struct IQuery*)NULL);
     IDeviceContext_EndQuery(pCtx, (struct IQuery*)NULL);
+    IDeviceContext_ResolveQueries(pCtx, (struct IQuery* const*)NULL, 0u, (struct IBuffer*)NULL, (Uint64)0, RESOURCE_STATE_TRANSITION_MODE_NONE);
+    IDeviceContext_BeginConditionalRendering(pCtx, (const struct BeginConditionalRenderingAttribs*)NULL);
+    IDeviceContext_EndConditionalRendering(pCtx);
 
     IDeviceContext_UpdateBuffer(pCtx, (struct IBuffer*)NULL, (Uint64)1, (Uint64)1, NULL, RESOURCE_STATE_TRANSITION_MODE_NONE);
     IDeviceContext_CopyBuffer(pCtx, (struct IBuffer*)NULL, (Uint64)0, RESOURCE_STATE_TRANSITION_MODE_NONE, (struct IBuffer*)NULL, (Uint64)0, (Uint64)128, RESOURCE_STATE_TRANSITION_MODE_NONE);
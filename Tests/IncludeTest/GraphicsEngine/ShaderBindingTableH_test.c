@@ -39,6 +39,7 @@ void TestShaderBindingTable_CInterface(IShaderBindingTable* pSBT)
     IShaderBindingTable_BindHitGroupForGeometry(pSBT, (ITopLevelAS*)NULL, "Instance name", "Geometry name", 0, "Shader group name", (const void*)NULL, 0);
     IShaderBindingTable_BindHitGroupForTLAS(pSBT, (ITopLevelAS*)NULL, 0, "Shader group name", (const void*)NULL, 0);
     IShaderBindingTable_BindHitGroupForInstance(pSBT, (ITopLevelAS*)NULL, "Instance name", 0, "Shader group name", (const void*)NULL, 0);
+    IShaderBindingTable_BindHitGroupForInstanceByIndex(pSBT, (ITopLevelAS*)NULL, 0, 0, "Shader group name", (const void*)NULL, 0);
     IShaderBindingTable_BindCallableShader(pSBT, "Shader group name", 0, (const void*)NULL, 0);
     IShaderBindingTable_BindHitGroupByIndex(pSBT, 0, "Shader group name", (const void*)NULL, 0);
 }
@@ -33,4 +33,7 @@ void TestBufferViewD3D12_CInterface(IBufferViewD3D12* pView)
 {
     D3D12_CPU_DESCRIPTOR_HANDLE Handle = IBufferViewD3D12_GetCPUDescriptorHandle(pView);
     (void)Handle;
+
+    Uint32 HeapIndex = IBufferViewD3D12_GetDescriptorHeapIndex(pView);
+    (void)HeapIndex;
 }
@@ -33,4 +33,7 @@ void TestSamplerD3D12_CInterface(ISamplerD3D12* pSampler)
 {
     D3D12_CPU_DESCRIPTOR_HANDLE Handle = ISamplerD3D12_GetCPUDescriptorHandle(pSampler);
     (void)Handle;
+
+    Uint32 HeapIndex = ISamplerD3D12_GetDescriptorHeapIndex(pSampler);
+    (void)HeapIndex;
 }
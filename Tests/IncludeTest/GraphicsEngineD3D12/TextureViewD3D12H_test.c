@@ -33,4 +33,7 @@ void TestTextureViewD3D12_CInterface(struct ITextureViewD3D12* pView)
 {
     D3D12_CPU_DESCRIPTOR_HANDLE Handle = ITextureViewD3D12_GetCPUDescriptorHandle(pView);
     (void)Handle;
+
+    Uint32 HeapIndex = ITextureViewD3D12_GetDescriptorHeapIndex(pView);
+    (void)HeapIndex;
 }
@@ -44,4 +44,8 @@ void TestRenderDeviceVkCInterface(IRenderDeviceVk* pDevice)
     IRenderDeviceVk_CreateBLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (BottomLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (IBottomLevelAS**)NULL);
     IRenderDeviceVk_CreateTLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (TopLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (ITopLevelAS**)NULL);
     IRenderDeviceVk_CreateFenceFromVulkanResource(pDevice, (VkSemaphore)NULL, (const FenceDesc*)NULL, (IFence**)NULL);
+
+    MemoryBudgetVk Budget;
+    IRenderDeviceVk_GetMemoryBudget(pDevice, &Budget);
+    IRenderDeviceVk_SetMemoryBudgetCallback(pDevice, (MemoryBudgetCallbackVkType)NULL, NULL, 0.9f);
 }
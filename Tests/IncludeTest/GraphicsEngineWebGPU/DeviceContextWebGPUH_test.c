@@ -32,4 +32,5 @@ void TestDeviceContextWebGPU_CInterface(IDeviceContextWebGPU* pCtx)
 {
     WGPUQueue wgpuQueue = IDeviceContextWebGPU_GetWebGPUQueue(pCtx);
     (void)wgpuQueue;
+    IDeviceContextWebGPU_BeginRenderBundle(pCtx, 0u, (const SetRenderTargetsAttribs*)NULL);
 }
@@ -45,8 +45,15 @@ void TestRenderStateCacheCInterface()
     IRenderStateCache_CreateTilePipelineState(pCache, (TilePipelineStateCreateInfo*)NULL, &pPSO);
     IRenderStateCache_WriteToBlob(pCache, 1234, (IDataBlob**)NULL);
     IRenderStateCache_WriteToStream(pCache, 1234, (IFileStream*)NULL);
+    IRenderStateCache_WriteToJournal(pCache, 1234, (IFileStream*)NULL);
     IRenderStateCache_Reset(pCache);
     IRenderStateCache_Reload(pCache, NULL, NULL);
     Uint32 Ver = IRenderStateCache_GetContentVersion(pCache);
     (void)Ver;
+    IRenderStateCache_WritePipelineUsage(pCache, (IDataBlob**)NULL);
+    Uint32 NumPrewarmed = IRenderStateCache_PrewarmPipelines(pCache, (IDataBlob*)NULL);
+    (void)NumPrewarmed;
+    Uint32 NumTotal = 0;
+    Uint32 NumReady = IRenderStateCache_GetPrewarmProgress(pCache, &NumTotal);
+    (void)NumReady;
 }